@@ -99,4 +99,31 @@ if(NOT HPX_FIND_PACKAGE)
 
   # Disable Asio's definition of NOMINMAX
   hpx_add_config_cond_define(ASIO_NO_NOMINMAX)
+
+  # Let Asio use io_uring for all socket operations (instead of epoll), this
+  # batches the submission of the operations and saves a system call for each
+  # of them. All code sharing Asio objects (e.g. the io_context of the
+  # io_service_pool) has to agree on the reactor, so this is set globally.
+  if(HPX_WITH_ASIO_IO_URING)
+    hpx_add_config_cond_define(ASIO_HAS_IO_URING)
+    hpx_add_config_cond_define(ASIO_DISABLE_EPOLL)
+  endif()
+endif()
+
+if(HPX_WITH_ASIO_IO_URING)
+  find_package(Liburing)
+  if(NOT Liburing_FOUND)
+    hpx_error(
+      "HPX_WITH_ASIO_IO_URING=ON requires liburing, set Liburing_ROOT to point to its installation directory"
+    )
+  endif()
+
+  get_target_property(_asio_target Asio::asio ALIASED_TARGET)
+  if(NOT _asio_target)
+    set(_asio_target Asio::asio)
+  endif()
+  target_include_directories(
+    ${_asio_target} SYSTEM INTERFACE ${Liburing_INCLUDE_DIRS}
+  )
+  target_link_libraries(${_asio_target} INTERFACE ${Liburing_LIBRARIES})
 endif()
@@ -9,13 +9,18 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components_base/traits/is_component.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/components/component_storage/server/migrate_from_storage.hpp>
 
+#include <cstddef>
+#include <map>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace hpx { namespace components
 {
@@ -55,6 +60,85 @@ namespace hpx { namespace components
         return async<action_type>(naming::get_locality_from_id(to_resurrect),
             to_resurrect, target);
     }
+
+    /// Migrate the components with the given ids from the storage facilities
+    /// they are currently stored on (resurrect the objects)
+    ///
+    /// The function \a migrate_from_storage<Component> will migrate all
+    /// components referenced by \a to_resurrect from the storage facilities
+    /// they are currently stored on. The data of all components which are
+    /// managed by the same locality and are stored in the same storage
+    /// facility is retrieved using a single action. The component instances
+    /// are resurrected on the locality specified by \a target.
+    ///
+    /// \param to_resurrect    [in] The global ids of the components to
+    ///                        migrate.
+    /// \param target          [in] The optional locality to resurrect the
+    ///                        objects on. By default each object is
+    ///                        resurrected on the locality it was located on
+    ///                        last.
+    ///
+    /// \tparam  The only template argument specifies the component type of the
+    ///          components to migrate from the storage facilities.
+    ///
+    /// \returns A future representing the global ids of the migrated
+    ///          component instances (in the same order as \a to_resurrect).
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<std::vector<hpx::id_type>>
+#else
+    inline typename std::enable_if<
+        traits::is_component<Component>::value,
+        future<std::vector<hpx::id_type>>
+    >::type
+#endif
+    migrate_from_storage(std::vector<hpx::id_type> const& to_resurrect,
+        hpx::id_type const& target = hpx::invalid_id)
+    {
+        std::map<hpx::id_type,
+            std::pair<std::vector<hpx::id_type>, std::vector<std::size_t>>>
+            ids;
+        for (std::size_t i = 0; i != to_resurrect.size(); ++i)
+        {
+            auto& p = ids[naming::get_locality_from_id(to_resurrect[i])];
+            p.first.push_back(to_resurrect[i]);
+            p.second.push_back(i);
+        }
+
+        typedef server::trigger_migrate_from_storage_here_bulk_action<
+            Component>
+            action_type;
+
+        std::vector<future<std::vector<hpx::id_type>>> resurrected;
+        std::vector<std::vector<std::size_t>> indices;
+        resurrected.reserve(ids.size());
+        indices.reserve(ids.size());
+        for (auto& p : ids)
+        {
+            resurrected.push_back(
+                async<action_type>(p.first, HPX_MOVE(p.second.first), target));
+            indices.push_back(HPX_MOVE(p.second.second));
+        }
+
+        std::size_t const count = to_resurrect.size();
+        return hpx::when_all(resurrected).then(
+            [count, indices = HPX_MOVE(indices)](
+                future<std::vector<future<std::vector<hpx::id_type>>>>&& f) {
+                // restore the original order of the ids
+                std::vector<hpx::id_type> result(count);
+                auto resurrected = f.get();
+                for (std::size_t i = 0; i != resurrected.size(); ++i)
+                {
+                    std::vector<hpx::id_type> ids = resurrected[i].get();
+                    for (std::size_t j = 0; j != ids.size(); ++j)
+                    {
+                        result[indices[i][j]] = HPX_MOVE(ids[j]);
+                    }
+                }
+                return result;
+            });
+    }
 }}
 
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components_base/traits/is_component.hpp>
 #include <hpx/futures/future.hpp>
@@ -17,7 +18,10 @@
 #include <hpx/components/component_storage/component_storage.hpp>
 #include <hpx/components/component_storage/server/migrate_to_storage.hpp>
 
+#include <map>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace hpx { namespace components
 {
@@ -55,6 +59,64 @@ namespace hpx { namespace components
             to_migrate, target_storage);
     }
 
+    /// Migrate the components with the given ids to the specified target
+    /// storage
+    ///
+    /// The function \a migrate_to_storage<Component> will migrate all
+    /// components referenced by \a to_migrate to the storage facility
+    /// specified with \a target_storage. The components are grouped by the
+    /// locality responsible for managing their addresses, and by the
+    /// locality they are currently located on, each group is migrated using
+    /// a single action and a single AGAS request.
+    ///
+    /// \param to_migrate      [in] The global ids of the components to
+    ///                        migrate.
+    /// \param target_storage  [in] The id of the storage facility to migrate
+    ///                        the objects to.
+    ///
+    /// \tparam  The only template argument specifies the component type of the
+    ///          components to migrate to the given storage facility.
+    ///
+    /// \returns A future which becomes ready once all components have been
+    ///          migrated.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<void>
+#else
+    inline typename std::enable_if<
+        traits::is_component<Component>::value, future<void>
+    >::type
+#endif
+    migrate_to_storage(std::vector<hpx::id_type> const& to_migrate,
+        hpx::id_type const& target_storage)
+    {
+        std::map<hpx::id_type, std::vector<hpx::id_type>> ids;
+        for (hpx::id_type const& id : to_migrate)
+        {
+            ids[naming::get_locality_from_id(id)].push_back(id);
+        }
+
+        typedef server::trigger_migrate_to_storage_here_bulk_action<Component>
+            action_type;
+
+        std::vector<future<void>> migrated;
+        migrated.reserve(ids.size());
+        for (auto& p : ids)
+        {
+            migrated.push_back(async<action_type>(
+                p.first, HPX_MOVE(p.second), target_storage));
+        }
+
+        return hpx::when_all(migrated).then(
+            [](future<std::vector<future<void>>>&& f) {
+                for (future<void>& migrated : f.get())
+                {
+                    migrated.get();
+                }
+            });
+    }
+
     /// Migrate the given component to the specified target storage
     ///
     /// The function \a migrate_to_storage will migrate the component
@@ -20,6 +20,7 @@
 #include <hpx/components/component_storage/export_definitions.hpp>
 
 #include <cstddef>
+#include <map>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +38,13 @@ namespace hpx::components::server {
         naming::gid_type migrate_to_here(
             std::vector<char> const&, hpx::id_type, naming::address const&);
         std::vector<char> migrate_from_here(naming::gid_type const&);
+
+        // Store all given objects, their ids are rebound to this storage
+        // using a single AGAS request per AGAS service instance.
+        void migrate_to_here_bulk(std::vector<std::vector<char>>,
+            std::vector<hpx::id_type>, std::vector<naming::address> const&);
+        std::vector<std::vector<char>> migrate_from_here_bulk(
+            std::vector<naming::gid_type> const&);
         std::size_t size() const
         {
             return data_.size();
@@ -44,11 +52,39 @@ namespace hpx::components::server {
 
         HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_to_here)
         HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_from_here)
+        HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_to_here_bulk)
+        HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_from_here_bulk)
         HPX_DEFINE_COMPONENT_ACTION(component_storage, size)
 
     private:
         hpx::unordered_map<naming::gid_type, std::vector<char>> data_;
     };
+
+    namespace detail {
+
+        // The ids of objects (and their addresses) which are located on the
+        // same locality (or are stored in the same storage), indices refers
+        // to the position of the ids in the original sequence of ids.
+        struct migration_bulk_request
+        {
+            std::vector<hpx::id_type> ids;
+            std::vector<naming::address> addrs;
+            std::vector<std::size_t> indices;
+        };
+
+        using migration_bulk_requests =
+            std::map<hpx::id_type, migration_bulk_request>;
+
+        // Invoke agas::begin_migration for all given ids and group them by
+        // the locality (or storage) the objects are currently located on.
+        // Has to be executed on the locality responsible for managing the
+        // addresses of the given objects.
+        HPX_MIGRATE_TO_STORAGE_EXPORT migration_bulk_requests
+        begin_migration_bulk(std::vector<hpx::id_type> const& ids);
+
+        HPX_MIGRATE_TO_STORAGE_EXPORT void end_migration_bulk(
+            std::vector<hpx::id_type> const& ids);
+    }    // namespace detail
 }    // namespace hpx::components::server
 
 HPX_REGISTER_ACTION_DECLARATION(
@@ -57,6 +93,12 @@ HPX_REGISTER_ACTION_DECLARATION(
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::components::server::component_storage::migrate_from_here_action,
     component_storage_migrate_component_from_here_action)
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::components::server::component_storage::migrate_to_here_bulk_action,
+    component_storage_migrate_components_to_here_action)
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::components::server::component_storage::migrate_from_here_bulk_action,
+    component_storage_migrate_components_from_here_action)
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::components::server::component_storage::size_action,
     component_storage_size_action)
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components_base/traits/component_pin_support.hpp>
 #include <hpx/components_base/traits/component_supports_migration.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -19,6 +21,7 @@
 #include <hpx/components/component_storage/export_definitions.hpp>
 #include <hpx/components/component_storage/server/component_storage.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -116,6 +119,39 @@ namespace hpx::components::server {
             return migrate_from_storage_here_id(
                 target_locality, ptr, to_resurrect);
         }
+
+        // convert the data extracted for several objects into living
+        // component instances
+        template <typename Component>
+        future<std::vector<hpx::id_type>> migrate_from_storage_here_bulk(
+            future<std::vector<std::vector<char>>>&& f,
+            std::vector<hpx::id_type> const& to_resurrect,
+            std::vector<naming::address> const& addrs,
+            hpx::id_type const& target_locality)
+        {
+            std::vector<std::vector<char>> data = f.get();
+            HPX_ASSERT(data.size() == to_resurrect.size());
+
+            std::vector<future<hpx::id_type>> resurrected;
+            resurrected.reserve(data.size());
+            for (std::size_t i = 0; i != data.size(); ++i)
+            {
+                resurrected.push_back(migrate_from_storage_here<Component>(
+                    hpx::make_ready_future(HPX_MOVE(data[i])), to_resurrect[i],
+                    addrs[i], target_locality));
+            }
+
+            return hpx::when_all(resurrected)
+                .then(launch::sync,
+                    [](future<std::vector<future<hpx::id_type>>>&& f) {
+                        std::vector<hpx::id_type> ids;
+                        for (future<hpx::id_type>& id : f.get())
+                        {
+                            ids.push_back(id.get());
+                        }
+                        return ids;
+                    });
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -164,4 +200,96 @@ namespace hpx::components::server {
             trigger_migrate_from_storage_here_action<Component>>
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This is executed on the locality responsible for managing the address
+    // resolution for all of the given objects. The data of all objects which
+    // are stored in the same storage is retrieved using a single action. The
+    // returned ids are in the same order as the given ones.
+    template <typename Component>
+    future<std::vector<hpx::id_type>> trigger_migrate_from_storage_here_bulk(
+        std::vector<hpx::id_type> const& to_resurrect,
+        hpx::id_type const& target_locality)
+    {
+        if constexpr (!traits::component_supports_migration<Component>::call())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "hpx::components::server::"
+                "trigger_migrate_from_storage_here_bulk",
+                "attempting to migrate an instance of a component which "
+                "does not support migration");
+        }
+
+        for (hpx::id_type const& id : to_resurrect)
+        {
+            if (naming::get_locality_id_from_id(id) != get_locality_id())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::components::server::"
+                    "trigger_migrate_from_storage_here_bulk",
+                    "this function has to be executed on the locality "
+                    "responsible for managing the addresses of the given "
+                    "objects");
+            }
+        }
+
+        auto requests = detail::begin_migration_bulk(to_resurrect);
+
+        // retrieve the data from the given storages
+        using action_type =
+            typename server::component_storage::migrate_from_here_bulk_action;
+
+        std::vector<future<std::vector<hpx::id_type>>> resurrected;
+        std::vector<std::vector<std::size_t>> indices;
+        resurrected.reserve(requests.size());
+        indices.reserve(requests.size());
+        for (auto& request : requests)
+        {
+            std::vector<naming::gid_type> gids;
+            gids.reserve(request.second.ids.size());
+            for (hpx::id_type const& id : request.second.ids)
+            {
+                gids.push_back(id.get_gid());
+            }
+
+            resurrected.push_back(
+                async<action_type>(request.first, HPX_MOVE(gids))
+                    .then(hpx::bind_back(
+                        &detail::migrate_from_storage_here_bulk<Component>,
+                        HPX_MOVE(request.second.ids),
+                        HPX_MOVE(request.second.addrs), target_locality)));
+            indices.push_back(HPX_MOVE(request.second.indices));
+        }
+
+        return hpx::when_all(resurrected)
+            .then([to_resurrect, indices = HPX_MOVE(indices)](
+                      future<std::vector<future<std::vector<hpx::id_type>>>>&&
+                          f) {
+                detail::end_migration_bulk(to_resurrect);
+
+                // restore the original order of the ids
+                std::vector<hpx::id_type> result(to_resurrect.size());
+                auto resurrected = f.get();
+                for (std::size_t i = 0; i != resurrected.size(); ++i)
+                {
+                    std::vector<hpx::id_type> ids = resurrected[i].get();
+                    HPX_ASSERT(ids.size() == indices[i].size());
+                    for (std::size_t j = 0; j != ids.size(); ++j)
+                    {
+                        result[indices[i][j]] = HPX_MOVE(ids[j]);
+                    }
+                }
+                return result;
+            });
+    }
+
+    template <typename Component>
+    struct trigger_migrate_from_storage_here_bulk_action
+      : ::hpx::actions::action<future<std::vector<hpx::id_type>> (*)(
+                                   std::vector<hpx::id_type> const&,
+                                   hpx::id_type const&),
+            &trigger_migrate_from_storage_here_bulk<Component>,
+            trigger_migrate_from_storage_here_bulk_action<Component>>
+    {
+    };
 }    // namespace hpx::components::server
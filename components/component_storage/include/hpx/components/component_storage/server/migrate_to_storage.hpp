@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/address.hpp>
@@ -16,6 +17,7 @@
 #include <hpx/components/component_storage/export_definitions.hpp>
 #include <hpx/components/component_storage/server/component_storage.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -121,6 +123,76 @@ namespace hpx::components::server {
 #else
             HPX_ASSERT(false);
             return hpx::make_ready_future(hpx::id_type{});
+#endif
+        }
+
+        // trigger the actual migration of several objects to storage, all
+        // objects are sent using a single action
+        template <typename Component>
+        future<void> migrate_to_storage_here_bulk_postproc(
+            [[maybe_unused]] std::vector<std::shared_ptr<Component>> ptrs,
+            [[maybe_unused]] std::vector<hpx::id_type> const& to_migrate,
+            [[maybe_unused]] hpx::id_type const& target_storage)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            HPX_ASSERT(ptrs.size() == to_migrate.size());
+
+            for (std::shared_ptr<Component> const& ptr : ptrs)
+            {
+                std::uint32_t const pin_count = ptr->pin_count();
+                if (pin_count == ~0x0u || pin_count > 1)
+                {
+                    for (std::size_t i = 0; i != ptrs.size(); ++i)
+                    {
+                        ptrs[i]->unmark_as_migrated(to_migrate[i]);
+                    }
+
+                    if (pin_count == ~0x0u)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                            "hpx::components::server::"
+                            "migrate_to_storage_here_bulk",
+                            "attempting to migrate an instance of a component "
+                            "which was already migrated");
+                    }
+
+                    HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                        "hpx::components::server::migrate_to_storage_here_bulk",
+                        "attempting to migrate an instance of a component "
+                        "which is currently pinned");
+                }
+            }
+
+            // serialize the given components
+            std::vector<std::vector<char>> data(ptrs.size());
+            std::vector<naming::address> addrs;
+            addrs.reserve(ptrs.size());
+
+            for (std::size_t i = 0; i != ptrs.size(); ++i)
+            {
+                {
+                    serialization::output_archive archive(data[i]);
+                    archive << ptrs[i];
+                }
+                addrs.emplace_back(ptrs[i]->get_current_address());
+            }
+
+            using action_type =
+                typename server::component_storage::migrate_to_here_bulk_action;
+
+            return hpx::async<action_type>(
+                target_storage, HPX_MOVE(data), to_migrate, addrs)
+                .then([ptrs = HPX_MOVE(ptrs)](future<void>&& f) {
+                    // clean up (source) memory of migrated objects
+                    for (std::shared_ptr<Component> const& ptr : ptrs)
+                    {
+                        ptr->mark_as_migrated();
+                    }
+                    f.get();
+                });
+#else
+            HPX_ASSERT(false);
+            return hpx::make_ready_future();
 #endif
         }
     }    // namespace detail
@@ -158,6 +230,49 @@ namespace hpx::components::server {
     {
     };
 
+    // This will be executed on the locality where all of the given objects
+    // live which are to be migrated
+    template <typename Component>
+    future<void> migrate_to_storage_here_bulk(
+        std::vector<hpx::id_type> const& to_migrate,
+        std::vector<naming::address> const& addrs,
+        hpx::id_type const& target_storage)
+    {
+        if constexpr (!traits::component_supports_migration<Component>::call())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "hpx::components::server::migrate_to_storage_here_bulk",
+                "attempting to migrate an instance of a component which "
+                "does not support migration");
+        }
+
+        HPX_ASSERT(to_migrate.size() == addrs.size());
+
+        // retrieve pointers to objects (must be local)
+        std::vector<std::shared_ptr<Component>> ptrs;
+        ptrs.reserve(to_migrate.size());
+        for (std::size_t i = 0; i != to_migrate.size(); ++i)
+        {
+            ptrs.push_back(hpx::detail::get_ptr_for_migration<Component>(
+                addrs[i], to_migrate[i]));
+        }
+
+        // perform actual migration by sending data over to target locality
+        return detail::migrate_to_storage_here_bulk_postproc<Component>(
+            HPX_MOVE(ptrs), to_migrate, target_storage);
+    }
+
+    template <typename Component>
+    struct migrate_to_storage_here_bulk_action
+      : ::hpx::actions::action<future<void> (*)(
+                                   std::vector<hpx::id_type> const&,
+                                   std::vector<naming::address> const&,
+                                   hpx::id_type const&),
+            &migrate_to_storage_here_bulk<Component>,
+            migrate_to_storage_here_bulk_action<Component>>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // This is executed on the locality responsible for managing the address
     // resolution for the given object.
@@ -209,4 +324,75 @@ namespace hpx::components::server {
             trigger_migrate_to_storage_here_action<Component>>
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This is executed on the locality responsible for managing the address
+    // resolution for all of the given objects. The objects are grouped by the
+    // locality they are currently located on, all objects of a group are
+    // migrated using a single action and are rebound in AGAS using a single
+    // request.
+    template <typename Component>
+    future<void> trigger_migrate_to_storage_here_bulk(
+        [[maybe_unused]] std::vector<hpx::id_type> const& to_migrate,
+        [[maybe_unused]] hpx::id_type const& target_storage)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        if constexpr (!traits::component_supports_migration<Component>::call())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "hpx::components::server::trigger_migrate_to_storage_here_bulk",
+                "attempting to migrate an instance of a component which "
+                "does not support migration");
+        }
+
+        for (hpx::id_type const& id : to_migrate)
+        {
+            if (naming::get_locality_id_from_id(id) != get_locality_id())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::components::server::"
+                    "trigger_migrate_to_storage_here_bulk",
+                    "this function has to be executed on the locality "
+                    "responsible for managing the addresses of the given "
+                    "objects");
+            }
+        }
+
+        auto requests = detail::begin_migration_bulk(to_migrate);
+
+        // perform actual object migration
+        using action_type =
+            server::migrate_to_storage_here_bulk_action<Component>;
+
+        std::vector<future<void>> migrated;
+        migrated.reserve(requests.size());
+        for (auto const& request : requests)
+        {
+            migrated.push_back(async<action_type>(request.first,
+                request.second.ids, request.second.addrs, target_storage));
+        }
+
+        return hpx::when_all(migrated).then(
+            [to_migrate](future<std::vector<future<void>>>&& f) {
+                detail::end_migration_bulk(to_migrate);
+                for (future<void>& migrated : f.get())
+                {
+                    migrated.get();
+                }
+            });
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future();
+#endif
+    }
+
+    template <typename Component>
+    struct trigger_migrate_to_storage_here_bulk_action
+      : ::hpx::actions::action<future<void> (*)(
+                                   std::vector<hpx::id_type> const&,
+                                   hpx::id_type const&),
+            &trigger_migrate_to_storage_here_bulk<Component>,
+            trigger_migrate_to_storage_here_bulk_action<Component>>
+    {
+    };
 }    // namespace hpx::components::server
@@ -31,6 +31,12 @@ HPX_REGISTER_ACTION(
 HPX_REGISTER_ACTION(
     hpx::components::server::component_storage::migrate_from_here_action,
     component_storage_migrate_component_from_here_action)
+HPX_REGISTER_ACTION(
+    hpx::components::server::component_storage::migrate_to_here_bulk_action,
+    component_storage_migrate_components_to_here_action)
+HPX_REGISTER_ACTION(
+    hpx::components::server::component_storage::migrate_from_here_bulk_action,
+    component_storage_migrate_components_from_here_action)
 HPX_REGISTER_ACTION(
     hpx::components::server::component_storage::size_action,
     component_storage_size_action)
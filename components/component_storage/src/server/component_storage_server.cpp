@@ -5,9 +5,14 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/components/component_storage/server/component_storage.hpp>
 #include <hpx/runtime_distributed/find_localities.hpp>
 
+#include <cstddef>
+#include <exception>
+#include <utility>
 #include <vector>
 
 namespace hpx { namespace components { namespace server {
@@ -46,6 +51,130 @@ namespace hpx { namespace components { namespace server {
         return data_.get_value(
             launch::sync, naming::detail::get_stripped_gid(id), true);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void component_storage::migrate_to_here_bulk(
+        std::vector<std::vector<char>> data, std::vector<hpx::id_type> ids,
+        std::vector<naming::address> const& current_lvas)
+    {
+        HPX_ASSERT(data.size() == ids.size());
+        HPX_ASSERT(current_lvas.size() == ids.size());
+
+        std::vector<naming::gid_type> gids;
+        std::vector<naming::address> addrs;
+        std::vector<hpx::future<void>> stored;
+        gids.reserve(ids.size());
+        addrs.reserve(ids.size());
+        stored.reserve(ids.size());
+
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            naming::gid_type gid(
+                naming::detail::get_stripped_gid(ids[i].get_gid()));
+            stored.push_back(data_.set_value(gid, HPX_MOVE(data[i])));
+
+            naming::address addr(current_lvas[i]);
+            addr.address_ = nullptr;    // invalidate lva
+
+            gids.push_back(gid);
+            addrs.push_back(addr);
+        }
+
+        // rebind all objects to this storage locality
+        bool const rebound = agas::bind(gids, addrs, this->gid_).get();
+        hpx::wait_all(stored);
+
+        if (!rebound)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::duplicate_component_address,
+                "component_storage::migrate_to_here_bulk",
+                "failed to rebind ids to storage locality: {}", gid_);
+        }
+
+        // we can now release the objects
+        for (hpx::id_type& id : ids)
+        {
+            id.make_unmanaged();
+        }
+    }
+
+    std::vector<std::vector<char>> component_storage::migrate_from_here_bulk(
+        std::vector<naming::gid_type> const& ids)
+    {
+        std::vector<hpx::future<std::vector<char>>> values;
+        values.reserve(ids.size());
+        for (naming::gid_type const& id : ids)
+        {
+            values.push_back(
+                data_.get_value(naming::detail::get_stripped_gid(id), true));
+        }
+
+        // return the stored data and erase it from the map
+        std::vector<std::vector<char>> result;
+        result.reserve(ids.size());
+        for (auto& value : values)
+        {
+            result.push_back(value.get());
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        migration_bulk_requests begin_migration_bulk(
+            std::vector<hpx::id_type> const& ids)
+        {
+            std::vector<
+                hpx::future<std::pair<hpx::id_type, naming::address>>>
+                marked;
+            marked.reserve(ids.size());
+            for (hpx::id_type const& id : ids)
+            {
+                marked.push_back(agas::begin_migration(id));
+            }
+            hpx::wait_all_nothrow(marked);
+
+            migration_bulk_requests requests;
+            std::exception_ptr e;
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                if (marked[i].has_exception())
+                {
+                    if (!e)
+                    {
+                        e = marked[i].get_exception_ptr();
+                    }
+                    continue;
+                }
+
+                auto r = marked[i].get();
+                auto& request = requests[r.first];
+                request.ids.push_back(ids[i]);
+                request.addrs.push_back(r.second);
+                request.indices.push_back(i);
+            }
+
+            if (e)
+            {
+                // release the ids which were successfully marked
+                for (auto const& request : requests)
+                {
+                    end_migration_bulk(request.second.ids);
+                }
+                std::rethrow_exception(e);
+            }
+            return requests;
+        }
+
+        void end_migration_bulk(std::vector<hpx::id_type> const& ids)
+        {
+            for (hpx::id_type const& id : ids)
+            {
+                agas::end_migration(id);
+            }
+        }
+    }    // namespace detail
 }}}    // namespace hpx::components::server
 
 HPX_REGISTER_UNORDERED_MAP(
@@ -16,6 +16,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 struct test_server
@@ -189,6 +190,70 @@ bool test_migrate_component_to_storage(hpx::id_type const& source,
     return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool test_migrate_components_to_storage(hpx::id_type const& source,
+    hpx::id_type const& target, hpx::components::component_storage storage,
+    hpx::id_type::management_type t)
+{
+    constexpr std::size_t num_objects = 10;
+    std::vector<hpx::id_type> oldids;
+
+    {
+        // create components on given locality
+        std::vector<test_client> clients;
+        std::vector<hpx::id_type> ids;
+        for (std::size_t i = 0; i != num_objects; ++i)
+        {
+            clients.emplace_back(source);
+            HPX_TEST_EQ(clients.back().call(), source);
+
+            ids.push_back(clients.back().get_id());
+
+            // remember the original ids for later resurrection
+            oldids.emplace_back(ids.back().get_gid(), t);
+        }
+
+        try
+        {
+            // migrate all objects to the target storage at once
+            hpx::components::migrate_to_storage<test_server>(
+                ids, storage.get_id())
+                .get();
+        }
+        catch (hpx::exception const&)
+        {
+            return false;
+        }
+
+        HPX_TEST_EQ(storage.size(hpx::launch::sync), num_objects);
+    }
+
+    HPX_TEST_EQ(storage.size(hpx::launch::sync), num_objects);
+
+    {
+        std::vector<hpx::id_type> ids =
+            hpx::components::migrate_from_storage<test_server>(oldids, target)
+                .get();
+
+        // the ids of the resurrected objects should be the same as the old
+        // ids (in the same order)
+        HPX_TEST_EQ(ids.size(), num_objects);
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            HPX_TEST_EQ(oldids[i], ids[i]);
+
+            // the objects should now live on the target locality
+            test_client t1;
+            t1.reset(ids[i]);
+            HPX_TEST_EQ(t1.call(), target);
+        }
+
+        HPX_TEST_EQ(storage.size(hpx::launch::sync), std::size_t(0));
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool test_migrate_component_from_storage(
     hpx::id_type const& source, hpx::components::component_storage storage)
@@ -254,6 +319,9 @@ void test_storage(hpx::id_type const& here, hpx::id_type const& there)
     HPX_TEST(test_migrate_component_to_storage(
         here, there, storage, hpx::id_type::management_type::managed));
 
+    HPX_TEST(test_migrate_components_to_storage(
+        here, there, storage, hpx::id_type::management_type::managed));
+
     //     HPX_TEST(test_migrate_component_from_storage(here, storage));
 }
 
@@ -0,0 +1,536 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/distributed_matrix/distributed_matrix.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/distribution_policies/container_distribution_policy.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_DISTRIBUTED_MATRIX_DECLARATION(...)                       \
+    HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(__VA_ARGS__)
+#define HPX_REGISTER_DISTRIBUTED_MATRIX(...)                                   \
+    HPX_REGISTER_PARTITIONED_VECTOR(__VA_ARGS__)
+
+namespace hpx {
+
+    /// The ways the tiles of a distributed_matrix can be mapped onto the
+    /// grid of localities
+    enum class matrix_distribution
+    {
+        /// each locality owns one contiguous block of tiles
+        block,
+        /// the tiles are dealt out to the localities in a round robin
+        /// fashion along both dimensions (as in ScaLAPACK)
+        block_cyclic
+    };
+
+    /// The coordinates of a tile in a distributed_matrix
+    struct tile_index
+    {
+        std::size_t row = 0;
+        std::size_t col = 0;
+    };
+
+    /// Direct access to a tile of a distributed_matrix which is located on
+    /// the calling locality. The elements of a tile are stored in row major
+    /// order, tiles at the right and at the bottom edges of the matrix may
+    /// be only partially used.
+    template <typename T, typename Data>
+    class distributed_matrix_tile
+    {
+        using partition_server_type = hpx::server::partitioned_vector<T, Data>;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        distributed_matrix_tile(
+            std::shared_ptr<partition_server_type> data, tile_index index,
+            size_type rows, size_type cols, size_type ld) noexcept
+          : data_(HPX_MOVE(data))
+          , index_(index)
+          , rows_(rows)
+          , cols_(cols)
+          , ld_(ld)
+        {
+        }
+
+        /// Return the coordinates of this tile
+        [[nodiscard]] tile_index index() const noexcept
+        {
+            return index_;
+        }
+
+        /// Return the number of rows of the matrix covered by this tile
+        [[nodiscard]] size_type rows() const noexcept
+        {
+            return rows_;
+        }
+
+        /// Return the number of columns of the matrix covered by this tile
+        [[nodiscard]] size_type cols() const noexcept
+        {
+            return cols_;
+        }
+
+        /// Return the distance between two consecutive rows of the tile
+        [[nodiscard]] size_type leading_dimension() const noexcept
+        {
+            return ld_;
+        }
+
+        [[nodiscard]] T& operator()(size_type row, size_type col)
+        {
+            HPX_ASSERT(row < rows_ && col < cols_);
+            return data_->get_data()[row * ld_ + col];
+        }
+
+        [[nodiscard]] T const& operator()(size_type row, size_type col) const
+        {
+            HPX_ASSERT(row < rows_ && col < cols_);
+            return data_->get_data()[row * ld_ + col];
+        }
+
+        /// Direct access to the storage of the tile
+        [[nodiscard]] Data& data() noexcept
+        {
+            return data_->get_data();
+        }
+
+        [[nodiscard]] Data const& data() const noexcept
+        {
+            return data_->get_data();
+        }
+
+    private:
+        std::shared_ptr<partition_server_type> data_;
+        tile_index index_;
+        size_type rows_;
+        size_type cols_;
+        size_type ld_;
+    };
+
+    /// A distributed_matrix is a two-dimensional container which is split
+    /// into equally sized tiles. Each tile is a segment of an underlying
+    /// partitioned_vector, the tiles are placed onto a two-dimensional grid
+    /// of localities using either a block or a block-cyclic distribution.
+    ///
+    /// Tiles can be fetched and stored as a whole with a single request,
+    /// tiles located on the calling locality can be accessed directly. The
+    /// segmented iterators of the matrix enumerate its tiles, which allows
+    /// to run per-tile tasks where the data lives.
+    ///
+    /// \note The element type has to be registered using
+    ///       HPX_REGISTER_DISTRIBUTED_MATRIX.
+    template <typename T, typename Data>
+    class distributed_matrix
+    {
+    public:
+        using vector_type = hpx::partitioned_vector<T, Data>;
+        using value_type = T;
+        using size_type = std::size_t;
+        using tile_type = distributed_matrix_tile<T, Data>;
+
+        using iterator = typename vector_type::iterator;
+        using const_iterator = typename vector_type::const_iterator;
+        using segment_iterator = typename vector_type::segment_iterator;
+        using const_segment_iterator =
+            typename vector_type::const_segment_iterator;
+        using local_segment_iterator =
+            typename vector_type::local_segment_iterator;
+        using const_local_segment_iterator =
+            typename vector_type::const_local_segment_iterator;
+
+        distributed_matrix() = default;
+
+        /// Create a matrix of \a rows x \a cols elements initialized with
+        /// \a val
+        ///
+        /// \param rows         The number of rows of the matrix
+        /// \param cols         The number of columns of the matrix
+        /// \param tile_rows    The number of rows of each tile
+        /// \param tile_cols    The number of columns of each tile
+        /// \param val          The initial value of all elements
+        /// \param distribution The mapping of the tiles onto the localities
+        /// \param policy       The localities to place the tiles on (all
+        ///                     localities by default), they are arranged in
+        ///                     a grid as close to square as possible
+        ///
+        distributed_matrix(size_type rows, size_type cols, size_type tile_rows,
+            size_type tile_cols, T const& val = T(),
+            matrix_distribution distribution =
+                matrix_distribution::block_cyclic,
+            container_distribution_policy const& policy =
+                container_layout(hpx::find_all_localities()))
+          : rows_(rows)
+          , cols_(cols)
+          , tile_rows_(tile_rows)
+          , tile_cols_(tile_cols)
+          , distribution_(distribution)
+        {
+            if (rows == 0 || cols == 0 || tile_rows == 0 || tile_cols == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "distributed_matrix::distributed_matrix",
+                    "the extents of the matrix and of its tiles must be "
+                    "non-zero");
+            }
+
+            num_tile_rows_ = (rows + tile_rows - 1) / tile_rows;
+            num_tile_cols_ = (cols + tile_cols - 1) / tile_cols;
+
+            std::vector<hpx::id_type> const localities =
+                policy.get_localities();
+
+            // arrange the localities in a grid with grid_rows_ <= grid_cols_
+            std::size_t const num_localities = localities.size();
+            grid_rows_ = 1;
+            for (std::size_t p = 1; p * p <= num_localities; ++p)
+            {
+                if (num_localities % p == 0)
+                    grid_rows_ = p;
+            }
+            grid_cols_ = num_localities / grid_rows_;
+
+            // every tile becomes one partition of the vector, listing the
+            // owner of each tile makes the vector place one partition per
+            // entry
+            std::size_t const num_tiles = num_tile_rows_ * num_tile_cols_;
+            std::vector<hpx::id_type> owners;
+            owners.reserve(num_tiles);
+            for (std::size_t i = 0; i != num_tile_rows_; ++i)
+            {
+                for (std::size_t j = 0; j != num_tile_cols_; ++j)
+                {
+                    owners.push_back(localities[get_owner({i, j})]);
+                }
+            }
+
+            vector_ = vector_type(num_tiles * tile_rows * tile_cols, val,
+                container_layout(num_tiles, HPX_MOVE(owners)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] size_type rows() const noexcept
+        {
+            return rows_;
+        }
+
+        [[nodiscard]] size_type cols() const noexcept
+        {
+            return cols_;
+        }
+
+        [[nodiscard]] size_type tile_rows() const noexcept
+        {
+            return tile_rows_;
+        }
+
+        [[nodiscard]] size_type tile_cols() const noexcept
+        {
+            return tile_cols_;
+        }
+
+        /// Return the number of tiles along the rows of the matrix
+        [[nodiscard]] size_type num_tile_rows() const noexcept
+        {
+            return num_tile_rows_;
+        }
+
+        /// Return the number of tiles along the columns of the matrix
+        [[nodiscard]] size_type num_tile_cols() const noexcept
+        {
+            return num_tile_cols_;
+        }
+
+        /// Return the number of rows of the grid of localities
+        [[nodiscard]] size_type grid_rows() const noexcept
+        {
+            return grid_rows_;
+        }
+
+        /// Return the number of columns of the grid of localities
+        [[nodiscard]] size_type grid_cols() const noexcept
+        {
+            return grid_cols_;
+        }
+
+        [[nodiscard]] matrix_distribution distribution() const noexcept
+        {
+            return distribution_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return the number of matrix rows covered by the given tile
+        [[nodiscard]] size_type tile_extent_rows(tile_index t) const noexcept
+        {
+            HPX_ASSERT(t.row < num_tile_rows_);
+            return (std::min)(tile_rows_, rows_ - t.row * tile_rows_);
+        }
+
+        /// Return the number of matrix columns covered by the given tile
+        [[nodiscard]] size_type tile_extent_cols(tile_index t) const noexcept
+        {
+            HPX_ASSERT(t.col < num_tile_cols_);
+            return (std::min)(tile_cols_, cols_ - t.col * tile_cols_);
+        }
+
+        /// Return the global id of the partition holding the given tile,
+        /// e.g. to run an action colocated with it
+        [[nodiscard]] hpx::id_type const& get_tile_id(tile_index t) const
+        {
+            return get_partition_data(t).partition_;
+        }
+
+        /// Return the id of the locality the given tile is located on
+        [[nodiscard]] std::uint32_t get_tile_locality_id(tile_index t) const
+        {
+            return get_partition_data(t).locality_id_;
+        }
+
+        [[nodiscard]] bool is_local(tile_index t) const
+        {
+            return get_partition_data(t).local_data_ != nullptr;
+        }
+
+        /// Return the coordinates of all tiles located on this locality
+        [[nodiscard]] std::vector<tile_index> local_tiles() const
+        {
+            std::vector<tile_index> result;
+            for (std::size_t i = 0; i != num_tile_rows_; ++i)
+            {
+                for (std::size_t j = 0; j != num_tile_cols_; ++j)
+                {
+                    if (is_local({i, j}))
+                        result.push_back({i, j});
+                }
+            }
+            return result;
+        }
+
+        /// Direct access to a tile located on the calling locality
+        [[nodiscard]] tile_type local_tile(tile_index t) const
+        {
+            auto const& part = get_partition_data(t);
+            if (!part.local_data_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "distributed_matrix::local_tile",
+                    "the given tile is not located on this locality");
+            }
+            return tile_type(part.local_data_, t, tile_extent_rows(t),
+                tile_extent_cols(t), tile_cols_);
+        }
+
+        /// Asynchronously fetch all elements of the given tile (including
+        /// unused elements of the edge tiles) in row major order
+        [[nodiscard]] hpx::future<std::vector<T>> get_tile(tile_index t) const
+        {
+            size_type const first = get_tile_offset(t);
+            return vector_.get_values(first, first + tile_rows_ * tile_cols_);
+        }
+
+        [[nodiscard]] std::vector<T> get_tile(
+            launch::sync_policy, tile_index t) const
+        {
+            return get_tile(t).get();
+        }
+
+        /// Asynchronously replace the elements of the given tile, \a values
+        /// has to hold tile_rows() * tile_cols() elements in row major order
+        hpx::future<void> set_tile(tile_index t, std::vector<T> const& values)
+        {
+            HPX_ASSERT(values.size() == tile_rows_ * tile_cols_);
+            return vector_.set_values(get_tile_offset(t), values);
+        }
+
+        void set_tile(launch::sync_policy, tile_index t,
+            std::vector<T> const& values)
+        {
+            set_tile(t, values).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] hpx::future<T> get_value(size_type row, size_type col)
+            const
+        {
+            return vector_.get_value(get_index(row, col));
+        }
+
+        [[nodiscard]] T get_value(
+            launch::sync_policy, size_type row, size_type col) const
+        {
+            return get_value(row, col).get();
+        }
+
+        hpx::future<void> set_value(
+            size_type row, size_type col, T const& val)
+        {
+            return vector_.set_value(get_index(row, col), val);
+        }
+
+        void set_value(launch::sync_policy, size_type row, size_type col,
+            T const& val)
+        {
+            set_value(row, col, val).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Iterate over all elements, tile by tile. The unused elements of
+        /// the edge tiles are part of the iteration.
+        [[nodiscard]] iterator begin()
+        {
+            return vector_.begin();
+        }
+
+        [[nodiscard]] const_iterator begin() const
+        {
+            return vector_.cbegin();
+        }
+
+        [[nodiscard]] iterator end()
+        {
+            return vector_.end();
+        }
+
+        [[nodiscard]] const_iterator end() const
+        {
+            return vector_.cend();
+        }
+
+        /// Iterate over the tiles of the matrix in row major order
+        [[nodiscard]] segment_iterator tile_begin()
+        {
+            return vector_.segment_begin();
+        }
+
+        [[nodiscard]] const_segment_iterator tile_begin() const
+        {
+            return vector_.segment_cbegin();
+        }
+
+        [[nodiscard]] segment_iterator tile_end()
+        {
+            return vector_.segment_end();
+        }
+
+        [[nodiscard]] const_segment_iterator tile_end() const
+        {
+            return vector_.segment_cend();
+        }
+
+        /// Iterate over the tiles located on the given locality
+        [[nodiscard]] local_segment_iterator tile_begin(std::uint32_t id)
+        {
+            return vector_.segment_begin(id);
+        }
+
+        [[nodiscard]] const_local_segment_iterator tile_begin(
+            std::uint32_t id) const
+        {
+            return vector_.segment_cbegin(id);
+        }
+
+        [[nodiscard]] local_segment_iterator tile_end(std::uint32_t id)
+        {
+            return vector_.segment_end(id);
+        }
+
+        [[nodiscard]] const_local_segment_iterator tile_end(
+            std::uint32_t id) const
+        {
+            return vector_.segment_cend(id);
+        }
+
+        /// Return the coordinates of the tile referenced by a segment
+        /// iterator of this matrix
+        template <typename SegmentIter>
+        [[nodiscard]] tile_index get_tile_index(SegmentIter const& it) const
+        {
+            auto const part = static_cast<std::size_t>(
+                it.base() - vector_.partitions_.cbegin());
+            return {part / num_tile_cols_, part % num_tile_cols_};
+        }
+
+        /// Access to the vector holding the tiles
+        [[nodiscard]] vector_type& get_vector() noexcept
+        {
+            return vector_;
+        }
+
+        [[nodiscard]] vector_type const& get_vector() const noexcept
+        {
+            return vector_;
+        }
+
+    private:
+        // index into the list of localities of the owner of the given tile
+        std::size_t get_owner(tile_index t) const noexcept
+        {
+            std::size_t row = 0;
+            std::size_t col = 0;
+            if (distribution_ == matrix_distribution::block_cyclic)
+            {
+                row = t.row % grid_rows_;
+                col = t.col % grid_cols_;
+            }
+            else
+            {
+                row = t.row * grid_rows_ / num_tile_rows_;
+                col = t.col * grid_cols_ / num_tile_cols_;
+            }
+            return row * grid_cols_ + col;
+        }
+
+        auto const& get_partition_data(tile_index t) const
+        {
+            HPX_ASSERT(t.row < num_tile_rows_ && t.col < num_tile_cols_);
+            return vector_.partitions_[t.row * num_tile_cols_ + t.col];
+        }
+
+        size_type get_tile_offset(tile_index t) const noexcept
+        {
+            HPX_ASSERT(t.row < num_tile_rows_ && t.col < num_tile_cols_);
+            return (t.row * num_tile_cols_ + t.col) * tile_rows_ * tile_cols_;
+        }
+
+        size_type get_index(size_type row, size_type col) const noexcept
+        {
+            HPX_ASSERT(row < rows_ && col < cols_);
+            return get_tile_offset({row / tile_rows_, col / tile_cols_}) +
+                (row % tile_rows_) * tile_cols_ + col % tile_cols_;
+        }
+
+        vector_type vector_;
+        size_type rows_ = 0;
+        size_type cols_ = 0;
+        size_type tile_rows_ = 1;
+        size_type tile_cols_ = 1;
+        size_type num_tile_rows_ = 0;
+        size_type num_tile_cols_ = 0;
+        size_type grid_rows_ = 1;
+        size_type grid_cols_ = 1;
+        matrix_distribution distribution_ = matrix_distribution::block_cyclic;
+    };
+}    // namespace hpx
@@ -0,0 +1,88 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/detail/mapped_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
+
+#include <cstddef>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \cond NOINTERNAL
+
+namespace hpx::detail {
+
+    // A read-write mapping of a whole file into memory. A mapped_file
+    // without a path is backed by anonymous memory instead.
+    class HPX_PARTITIONED_VECTOR_EXPORT mapped_file
+    {
+    public:
+        mapped_file() = default;
+
+        // open the given file, the file is created if it does not exist
+        explicit mapped_file(std::string path);
+
+        mapped_file(mapped_file&& rhs) noexcept;
+        mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file const&) = delete;
+
+        ~mapped_file();
+
+        // change the size of the mapping, the existing contents are kept
+        // up to the smaller of the old and the new size, all previous
+        // addresses are invalidated
+        void resize(std::size_t size);
+
+        // write back modified pages of a file-backed mapping
+        void flush() const;
+
+        [[nodiscard]] void* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] std::string const& path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        void map(std::size_t size);
+        void unmap() noexcept;
+        void close() noexcept;
+
+        std::string path_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+#if defined(HPX_WINDOWS)
+        void* file_ = nullptr;
+        void* mapping_ = nullptr;
+#else
+        int fd_ = -1;
+#endif
+    };
+
+    // Return the name of the file backing the next partition created on
+    // this locality. The files are placed into the directory given by the
+    // configuration entry hpx.partitioned_vector.storage_path and are
+    // numbered in order of creation, an application creating its vectors in
+    // the same order on the same number of localities refers to the same
+    // files when it is restarted.
+    HPX_PARTITIONED_VECTOR_EXPORT std::string next_mapped_file_path();
+}    // namespace hpx::detail
+
+/// \endcond
@@ -0,0 +1,402 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/mapped_vector.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+
+#include <hpx/components/containers/partitioned_vector/detail/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+
+    /// A mapped_vector is a sequence container for trivially copyable
+    /// elements which are stored in a memory-mapped file. It can be used as
+    /// the data type of the partitions of a partitioned_vector, e.g.
+    ///
+    /// \code
+    ///     using mapped_doubles = hpx::mapped_vector<double>;
+    ///     HPX_REGISTER_PARTITIONED_VECTOR(double, mapped_doubles)
+    ///
+    ///     hpx::partitioned_vector<double, mapped_doubles> v(
+    ///         size, 0.0, hpx::container_layout(localities));
+    /// \endcode
+    ///
+    /// Each partition is backed by its own file (see the configuration entry
+    /// hpx.partitioned_vector.storage_path). The operating system pages the
+    /// elements in when they are accessed, which allows for datasets larger
+    /// than the available memory. Opening an existing file keeps its
+    /// contents, the value given on construction is used for newly added
+    /// elements only. This way an application restarted with the same
+    /// vectors on the same localities reuses its data without having to
+    /// load it.
+    ///
+    /// Copies and deserialized instances are held in anonymous memory,
+    /// assigning to a file-backed vector writes the new elements to its file.
+    template <typename T>
+    class mapped_vector
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "mapped_vector requires a trivially copyable element type");
+
+        // the file starts off a header describing its contents
+        struct header
+        {
+            std::uint64_t magic;
+            std::uint64_t element_size;
+            std::uint64_t size;
+        };
+
+        static constexpr std::uint64_t header_magic =
+            0x3176702d787068;    // hpx-pv1
+        static constexpr std::size_t data_offset = 64;
+
+        static_assert(sizeof(header) <= data_offset &&
+                alignof(T) <= data_offset,
+            "the elements have to be properly aligned in the file");
+
+    public:
+        using value_type = T;
+        using allocator_type = std::allocator<T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = T const&;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using iterator = T*;
+        using const_iterator = T const*;
+
+        mapped_vector() = default;
+
+        explicit mapped_vector(size_type n)
+          : mapped_vector(detail::next_mapped_file_path(), n, T())
+        {
+        }
+
+        mapped_vector(size_type n, T const& val)
+          : mapped_vector(detail::next_mapped_file_path(), n, val)
+        {
+        }
+
+        mapped_vector(size_type n, T const& val, allocator_type const&)
+          : mapped_vector(detail::next_mapped_file_path(), n, val)
+        {
+        }
+
+        /// Open (or create) the given file and resize the vector to \a n
+        /// elements, the existing contents of the file are preserved
+        mapped_vector(std::string path, size_type n, T const& val = T())
+          : file_(HPX_MOVE(path))
+        {
+            if (file_.size() != 0)
+            {
+                header const* h = get_header();
+                if (file_.size() < data_offset || h->magic != header_magic ||
+                    h->element_size != sizeof(T))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "mapped_vector::mapped_vector",
+                        "'{}' does not hold elements of the requested type",
+                        file_.path());
+                }
+            }
+            resize(n, val);
+        }
+
+        mapped_vector(mapped_vector const& rhs)
+        {
+            assign(rhs.begin(), rhs.end());
+        }
+
+        mapped_vector(mapped_vector&& rhs) noexcept = default;
+
+        mapped_vector& operator=(mapped_vector const& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.begin(), rhs.end());
+            }
+            return *this;
+        }
+
+        mapped_vector& operator=(mapped_vector&& rhs)
+        {
+            // a file-backed vector never gives up its file
+            if (!file_.path().empty())
+            {
+                assign(rhs.begin(), rhs.end());
+            }
+            else
+            {
+                file_ = HPX_MOVE(rhs.file_);
+            }
+            return *this;
+        }
+
+        ~mapped_vector() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return data() + size();
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return data() + size();
+        }
+
+        [[nodiscard]] T* data() noexcept
+        {
+            return file_.data() == nullptr ?
+                nullptr :
+                reinterpret_cast<T*>(
+                    static_cast<char*>(file_.data()) + data_offset);
+        }
+
+        [[nodiscard]] T const* data() const noexcept
+        {
+            return const_cast<mapped_vector&>(*this).data();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return file_.data() == nullptr ?
+                0 :
+                static_cast<size_type>(get_header()->size);
+        }
+
+        [[nodiscard]] size_type max_size() const noexcept
+        {
+            return ((std::numeric_limits<size_type>::max)() - data_offset) /
+                sizeof(T);
+        }
+
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return file_.size() < data_offset ?
+                0 :
+                (file_.size() - data_offset) / sizeof(T);
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        void reserve(size_type n)
+        {
+            if (n <= capacity())
+            {
+                return;
+            }
+
+            bool const initialize = file_.data() == nullptr;
+            file_.resize(data_offset + n * sizeof(T));
+            if (initialize)
+            {
+                header* h = get_header();
+                h->magic = header_magic;
+                h->element_size = sizeof(T);
+                h->size = 0;
+            }
+        }
+
+        void resize(size_type n, T const& val = T())
+        {
+            size_type const old_size = size();
+            if (n > old_size)
+            {
+                reserve(n);
+                std::fill(data() + old_size, data() + n, val);
+            }
+            set_size(n);
+        }
+
+        // return the pages holding unused capacity to the file system
+        void shrink_to_fit()
+        {
+            file_.resize(data_offset + size() * sizeof(T));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] reference operator[](size_type pos) noexcept
+        {
+            HPX_ASSERT(pos < size());
+            return data()[pos];
+        }
+
+        [[nodiscard]] const_reference operator[](size_type pos) const noexcept
+        {
+            HPX_ASSERT(pos < size());
+            return data()[pos];
+        }
+
+        [[nodiscard]] reference front() noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] const_reference front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] reference back() noexcept
+        {
+            return (*this)[size() - 1];
+        }
+
+        [[nodiscard]] const_reference back() const noexcept
+        {
+            return (*this)[size() - 1];
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void assign(size_type n, T const& val)
+        {
+            reserve(n);
+            std::fill(data(), data() + n, val);
+            set_size(n);
+        }
+
+        void assign(T const* first, T const* last)
+        {
+            auto const n = static_cast<size_type>(last - first);
+            reserve(n);
+            if (n != 0)
+            {
+                std::memmove(data(), first, n * sizeof(T));
+            }
+            set_size(n);
+        }
+
+        void push_back(T const& val)
+        {
+            size_type const n = size();
+            if (n == capacity())
+            {
+                // val may refer to an element of this vector
+                T const tmp = val;
+                reserve((std::max)(2 * n, size_type(16)));
+                data()[n] = tmp;
+            }
+            else
+            {
+                data()[n] = val;
+            }
+            set_size(n + 1);
+        }
+
+        void pop_back() noexcept
+        {
+            HPX_ASSERT(!empty());
+            set_size(size() - 1);
+        }
+
+        void clear() noexcept
+        {
+            set_size(0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Write all modified elements back to the file
+        void flush() const
+        {
+            file_.flush();
+        }
+
+        /// Return the name of the file holding the elements, the name is
+        /// empty if the vector is held in anonymous memory
+        [[nodiscard]] std::string const& path() const noexcept
+        {
+            return file_.path();
+        }
+
+    private:
+        header* get_header() const noexcept
+        {
+            return static_cast<header*>(file_.data());
+        }
+
+        void set_size(size_type n) noexcept
+        {
+            HPX_ASSERT(n <= capacity());
+            if (file_.data() != nullptr)
+            {
+                get_header()->size = n;
+            }
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned) const
+        {
+            size_type const n = size();
+            ar << n;
+            if (n != 0)
+            {
+                ar << hpx::serialization::make_array(data(), n);
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned)
+        {
+            size_type n = 0;
+            ar >> n;
+
+            clear();
+            resize(n);
+            if (n != 0)
+            {
+                ar >> hpx::serialization::make_array(data(), n);
+            }
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        detail::mapped_file file_;
+    };
+}    // namespace hpx
@@ -177,6 +177,18 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return \a count consecutive elements starting at position
+        /// \a first in the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return Return the values of the elements in the range
+        ///         [first, first + count).
+        ///
+        std::vector<T> get_range(size_type first, size_type count) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -243,6 +255,16 @@ namespace hpx { namespace server {
         void set_values(
             std::vector<size_type> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        ///
+        /// \param val   The values to be copied
+        ///
+        void set_range(size_type first, std::vector<T> const& val);
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
@@ -261,6 +283,7 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_range)
 
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front)
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back)
@@ -270,6 +293,7 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_range)
 
         // HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data)
@@ -291,10 +315,14 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::get_values_action,                   \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        type::get_range_action, HPX_PP_CAT(__vector_get_range_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                   \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        type::set_range_action, HPX_PP_CAT(__vector_set_range_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
@@ -457,6 +485,31 @@ namespace hpx {
         future<std::vector<T>> get_values(
             std::vector<std::size_t> const& pos) const;
 
+        /// Returns \a count consecutive elements starting at position
+        /// \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return Returns the values of the elements in the range
+        ///         [first, first + count)
+        ///
+        std::vector<T> get_range(
+            launch::sync_policy, std::size_t first, std::size_t count) const;
+
+        /// Asynchronously returns \a count consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param count Number of elements to return
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<std::vector<T>> get_range(
+            std::size_t first, std::size_t count) const;
+
         // future<T> front_async() const
         // {
         //     HPX_ASSERT(this->get_id());
@@ -539,6 +592,28 @@ namespace hpx {
         future<void> set_values(
             std::vector<std::size_t> const& pos, std::vector<T> const& val);
 
+        /// Copy the values of \a val to consecutive elements starting at
+        /// position \a first in the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        void set_range(
+            launch::sync_policy, std::size_t first, std::vector<T> const& val);
+
+        /// Asynchronously copy the values of \a val to consecutive elements
+        /// starting at position \a first in the partitioned_vector_partition
+        /// component.
+        ///
+        /// \param first Position of the first element in the
+        ///              partitioned_vector_partition
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> set_range(std::size_t first, std::vector<T> const& val);
+
         //         void clear()
         //         {
         //             HPX_ASSERT(this->get_id());
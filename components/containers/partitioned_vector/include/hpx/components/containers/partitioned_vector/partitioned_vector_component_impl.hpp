@@ -23,6 +23,7 @@
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -209,6 +210,17 @@ namespace hpx { namespace server {
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector<T, Data>::get_range(
+        size_type first, size_type count) const
+    {
+        HPX_ASSERT(first + count <= partitioned_vector_partition_.size());
+
+        auto const begin = partitioned_vector_partition_.begin() + first;
+        return std::vector<T>(begin, begin + count);
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -264,6 +276,17 @@ namespace hpx { namespace server {
             partitioned_vector_partition_[pos[i]] = val[i];
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::set_range(
+        size_type first, std::vector<T> const& val)
+    {
+        HPX_ASSERT(first + val.size() <= partitioned_vector_partition_.size());
+
+        std::copy(val.begin(), val.end(),
+            partitioned_vector_partition_.begin() + first);
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
@@ -286,10 +309,14 @@ namespace hpx { namespace server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION(type::get_values_action,                               \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION(                                                       \
+        type::get_range_action, HPX_PP_CAT(__vector_get_range_action_, name))  \
     HPX_REGISTER_ACTION(                                                       \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name))                         \
+    HPX_REGISTER_ACTION(                                                       \
+        type::set_range_action, HPX_PP_CAT(__vector_set_range_action_, name))  \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name))            \
     HPX_REGISTER_ACTION(                                                       \
@@ -435,6 +462,31 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector_partition<T, Data>::get_range(
+        launch::sync_policy, std::size_t first, std::size_t count) const
+    {
+        return get_range(first, count).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::vector<T>>
+    partitioned_vector_partition<T, Data>::get_range(
+        std::size_t first, std::size_t count) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_range_action>(
+            this->get_id(), first, count);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(count);
+        return hpx::make_ready_future(std::vector<T>{});
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_value(
@@ -509,6 +561,31 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::set_range(
+        launch::sync_policy, std::size_t first, std::vector<T> const& val)
+    {
+        set_range(first, val).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::set_range(
+        std::size_t first, std::vector<T> const& val)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::set_range_action>(
+            this->get_id(), first, val);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(first);
+        HPX_UNUSED(val);
+        return hpx::make_ready_future();
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
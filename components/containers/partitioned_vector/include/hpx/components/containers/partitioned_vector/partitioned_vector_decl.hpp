@@ -254,6 +254,9 @@ namespace hpx {
         friend class segmented::const_segment_vector_iterator<T, Data,
             typename partitions_vector_type::const_iterator>;
 
+        friend class partitioned_vector_halo<T, Data>;
+        friend class distributed_matrix<T, Data>;
+
         std::size_t get_partition_size() const;
         std::size_t get_global_index(std::size_t segment, std::size_t part_size,
             size_type local_index) const;
@@ -715,6 +718,88 @@ namespace hpx {
             return get_values(pos_vec).get();
         }
 
+        /// Asynchronously returns the elements in the range [first, last)
+        /// of the vector container. One request is issued for each of the
+        /// partitions the range spans.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the given range.
+        ///
+        future<std::vector<T>> get_values(size_type first, size_type last) const
+        {
+            HPX_ASSERT(first <= last && last <= size_);
+            if (first == last)
+                return make_ready_future(std::vector<T>());
+
+            size_type const size = last - first;
+            size_type part = get_partition(first);
+            size_type local_first = get_local_index(first);
+
+            std::vector<future<std::vector<T>>> part_values_future;
+            while (first != last)
+            {
+                partition_data const& part_data = partitions_[part];
+                size_type const count =
+                    (std::min)(part_data.size_ - local_first, last - first);
+
+                if (part_data.local_data_)
+                {
+                    part_values_future.push_back(make_ready_future(
+                        part_data.local_data_->get_range(local_first, count)));
+                }
+                else
+                {
+                    part_values_future.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .get_range(local_first, count));
+                }
+
+                first += count;
+                local_first = 0;
+                ++part;
+            }
+
+            // a range within a single partition needs no merging
+            if (part_values_future.size() == 1)
+                return HPX_MOVE(part_values_future.front());
+
+            auto merge_func =
+                [size](std::vector<future<std::vector<T>>>&& part_values_f)
+                -> std::vector<T> {
+                std::vector<T> values;
+                values.reserve(size);
+
+                for (future<std::vector<T>>& part_f : part_values_f)
+                {
+                    std::vector<T> part_values = part_f.get();
+                    std::move(part_values.begin(), part_values.end(),
+                        std::back_inserter(values));
+                }
+                return values;
+            };
+
+            return dataflow(
+                launch::async, merge_func, HPX_MOVE(part_values_future));
+        }
+
+        /// Returns the elements in the range [first, last) of the vector
+        /// container.
+        ///
+        /// \param first Global position of the first element in the vector
+        /// \param last  Global position one past the last element
+        ///
+        /// \return Returns the values of the elements in the given range.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, size_type first, size_type last) const
+        {
+            return get_values(first, last).get();
+        }
+
         // //FRONT (never throws exception)
         // /** @brief Access the value of first element in the vector.
         //  *
@@ -1046,6 +1131,62 @@ namespace hpx {
             return set_values(pos, val).get();
         }
 
+        /// Asynchronously copy the values of \a val to the consecutive
+        /// elements starting at position \a first of the vector container.
+        /// One request is issued for each of the partitions the range spans.
+        ///
+        /// \param first Global position of the first element to set
+        /// \param val   The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type first, std::vector<T> const& val)
+        {
+            HPX_ASSERT(first + val.size() <= size_);
+            if (val.empty())
+                return make_ready_future();
+
+            size_type part = get_partition(first);
+            size_type local_first = get_local_index(first);
+
+            std::vector<future<void>> part_futures;
+            for (auto val_it = val.begin(); val_it != val.end(); /**/)
+            {
+                partition_data const& part_data = partitions_[part];
+                size_type const remaining =
+                    static_cast<size_type>(val.end() - val_it);
+                size_type const count =
+                    (std::min)(part_data.size_ - local_first, remaining);
+
+                if (part_data.local_data_)
+                {
+                    std::copy(val_it, val_it + count,
+                        part_data.local_data_->begin() + local_first);
+                }
+                else
+                {
+                    part_futures.push_back(
+                        partitioned_vector_partition_client(
+                            part_data.partition_)
+                            .set_range(local_first,
+                                std::vector<T>(val_it, val_it + count)));
+                }
+
+                val_it += count;
+                local_first = 0;
+                ++part;
+            }
+
+            return hpx::when_all(part_futures);
+        }
+
+        void set_values(
+            launch::sync_policy, size_type first, std::vector<T> const& val)
+        {
+            return set_values(first, val).get();
+        }
+
         // //CLEAR
         // //TODO if number of partitions is kept constant every time then
         // // clear should modified (clear each partitioned_vector_partition
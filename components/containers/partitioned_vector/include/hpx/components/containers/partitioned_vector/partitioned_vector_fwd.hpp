@@ -18,6 +18,12 @@ namespace hpx
     template <typename T, typename Data = std::vector<T>>
     class partitioned_vector;
 
+    template <typename T, typename Data>
+    class partitioned_vector_halo;
+
+    template <typename T, typename Data = std::vector<T>>
+    class distributed_matrix;
+
     namespace segmented {
 
         template <typename T, typename Data> class local_vector_iterator;
@@ -0,0 +1,321 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_halo.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        // Random access iterator over the interior elements of a
+        // partitioned_vector_halo including its ghost zones
+        template <typename Halo>
+        class partitioned_vector_halo_iterator
+          : public hpx::util::iterator_facade<
+                partitioned_vector_halo_iterator<Halo>,
+                typename Halo::value_type const,
+                std::random_access_iterator_tag,
+                typename Halo::value_type const&, std::ptrdiff_t>
+        {
+        public:
+            partitioned_vector_halo_iterator() = default;
+
+            partitioned_vector_halo_iterator(
+                Halo const* halo, std::ptrdiff_t index) noexcept
+              : halo_(halo)
+              , index_(index)
+            {
+            }
+
+        private:
+            friend class hpx::util::iterator_core_access;
+
+            typename Halo::value_type const& dereference() const
+            {
+                return (*halo_)[index_];
+            }
+
+            bool equal(
+                partitioned_vector_halo_iterator const& rhs) const noexcept
+            {
+                return halo_ == rhs.halo_ && index_ == rhs.index_;
+            }
+
+            void increment() noexcept
+            {
+                ++index_;
+            }
+
+            void decrement() noexcept
+            {
+                --index_;
+            }
+
+            void advance(std::ptrdiff_t n) noexcept
+            {
+                index_ += n;
+            }
+
+            std::ptrdiff_t distance_to(
+                partitioned_vector_halo_iterator const& rhs) const noexcept
+            {
+                return rhs.index_ - index_;
+            }
+
+            Halo const* halo_ = nullptr;
+            std::ptrdiff_t index_ = 0;
+        };
+    }    // namespace detail
+
+    /// A partitioned_vector_halo gives access to the elements of one partition
+    /// of a partitioned_vector located on the calling locality, extended by
+    /// ghost zones holding cached copies of the elements adjacent to that
+    /// partition. The ghost zones are refreshed by calling \a exchange, which
+    /// fetches all remote elements asynchronously, while the interior of the
+    /// partition may be accessed.
+    ///
+    /// Indices of the interior elements range from zero to size(), the left
+    /// ghost zone uses negative indices and the right ghost zone uses indices
+    /// starting at size().
+    ///
+    /// \note The partitioned_vector has to outlive the halo.
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_halo
+    {
+    private:
+        using vector_type = hpx::partitioned_vector<T, Data>;
+        using partition_server_type = hpx::server::partitioned_vector<T, Data>;
+
+        struct ghost_data
+        {
+            std::vector<T> left_;
+            std::vector<T> right_;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_iterator =
+            detail::partitioned_vector_halo_iterator<partitioned_vector_halo>;
+        using iterator = const_iterator;
+
+        /// Create a halo for the given partition of \a v
+        ///
+        /// \param v            The partitioned_vector the partition belongs to
+        /// \param part         Sequence number of the partition, it has to be
+        ///                     located on the calling locality
+        /// \param left_width   Number of elements to cache before the first
+        ///                     element of the partition
+        /// \param right_width  Number of elements to cache after the last
+        ///                     element of the partition
+        /// \param periodic     If true, the ghost zones of the first and the
+        ///                     last partition wrap around the ends of the
+        ///                     vector, otherwise they are truncated
+        ///
+        partitioned_vector_halo(vector_type const& v, std::size_t part,
+            std::size_t left_width, std::size_t right_width,
+            bool periodic = false)
+          : vector_(&v)
+          , ghosts_(std::make_shared<ghost_data>())
+        {
+            if (part >= v.partitions_.size() ||
+                !v.partitions_[part].local_data_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "partitioned_vector_halo::partitioned_vector_halo",
+                    "the given partition is not located on this locality");
+            }
+
+            auto const& part_data = v.partitions_[part];
+            local_data_ = part_data.local_data_;
+            begin_ = v.get_global_index(part, v.partition_size_, 0);
+
+            std::size_t const end = begin_ + part_data.size_;
+            std::size_t const size = v.size();
+            if (periodic)
+            {
+                left_width = (std::min)(left_width, size - part_data.size_);
+                right_width = (std::min)(right_width, size - part_data.size_);
+            }
+            else
+            {
+                left_width = (std::min)(left_width, begin_);
+                right_width = (std::min)(right_width, size - end);
+            }
+
+            ghosts_->left_.resize(left_width);
+            ghosts_->right_.resize(right_width);
+        }
+
+        /// Refresh the ghost zones from the adjacent partitions. One request
+        /// is issued for each remote partition the ghost zones overlap with.
+        /// The ghost zones must not be accessed before the returned future
+        /// becomes ready.
+        hpx::future<void> exchange()
+        {
+            std::size_t const size = vector_->size();
+            std::size_t const left = ghosts_->left_.size();
+            std::size_t const right = ghosts_->right_.size();
+            std::size_t const end = begin_ + local_data_->size();
+
+            // the ghost zones may wrap around the ends of the vector, each
+            // of them is fetched as at most two contiguous ranges
+            std::vector<hpx::future<std::vector<T>>> left_parts;
+            if (left > begin_)
+            {
+                left_parts.push_back(
+                    vector_->get_values(size - (left - begin_), size));
+            }
+            if (begin_ != 0 && left != 0)
+            {
+                left_parts.push_back(vector_->get_values(
+                    begin_ - (std::min)(left, begin_), begin_));
+            }
+
+            std::vector<hpx::future<std::vector<T>>> right_parts;
+            if (end != size && right != 0)
+            {
+                right_parts.push_back(vector_->get_values(
+                    end, end + (std::min)(right, size - end)));
+            }
+            if (right > size - end)
+            {
+                right_parts.push_back(
+                    vector_->get_values(0, right - (size - end)));
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [ghosts = ghosts_](
+                    std::vector<hpx::future<std::vector<T>>>&& lefts,
+                    std::vector<hpx::future<std::vector<T>>>&& rights) {
+                    auto it = ghosts->left_.begin();
+                    for (auto& f : lefts)
+                    {
+                        std::vector<T> values = f.get();
+                        it = std::move(values.begin(), values.end(), it);
+                    }
+                    HPX_ASSERT(it == ghosts->left_.end());
+
+                    it = ghosts->right_.begin();
+                    for (auto& f : rights)
+                    {
+                        std::vector<T> values = f.get();
+                        it = std::move(values.begin(), values.end(), it);
+                    }
+                    HPX_ASSERT(it == ghosts->right_.end());
+                },
+                HPX_MOVE(left_parts), HPX_MOVE(right_parts));
+        }
+
+        /// Refresh the ghost zones and wait for the exchange to complete
+        void exchange(launch::sync_policy)
+        {
+            exchange().get();
+        }
+
+        /// Return the number of interior elements
+        [[nodiscard]] size_type size() const
+        {
+            return local_data_->size();
+        }
+
+        /// Return the global index of the first interior element
+        [[nodiscard]] size_type global_begin() const noexcept
+        {
+            return begin_;
+        }
+
+        /// Return the width of the left ghost zone
+        [[nodiscard]] size_type left_width() const noexcept
+        {
+            return ghosts_->left_.size();
+        }
+
+        /// Return the width of the right ghost zone
+        [[nodiscard]] size_type right_width() const noexcept
+        {
+            return ghosts_->right_.size();
+        }
+
+        /// Direct access to the data of the partition
+        [[nodiscard]] Data& interior() noexcept
+        {
+            return local_data_->get_data();
+        }
+
+        [[nodiscard]] Data const& interior() const noexcept
+        {
+            return local_data_->get_data();
+        }
+
+        /// Access an element of the partition or of one of the ghost zones,
+        /// \a i has to be in the range [-left_width(), size() + right_width())
+        [[nodiscard]] T const& operator[](difference_type i) const
+        {
+            auto const n = static_cast<difference_type>(size());
+            if (i < 0)
+            {
+                HPX_ASSERT(-i <= static_cast<difference_type>(left_width()));
+                return ghosts_->left_[ghosts_->left_.size() + i];
+            }
+            if (i >= n)
+            {
+                HPX_ASSERT(i - n < static_cast<difference_type>(right_width()));
+                return ghosts_->right_[i - n];
+            }
+            return local_data_->get_data()[i];
+        }
+
+        /// Iterate over all elements including both ghost zones
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return const_iterator(
+                this, -static_cast<difference_type>(left_width()));
+        }
+
+        [[nodiscard]] const_iterator end() const
+        {
+            return const_iterator(
+                this, static_cast<difference_type>(size() + right_width()));
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] const_iterator cend() const
+        {
+            return end();
+        }
+
+    private:
+        vector_type const* vector_;
+        std::shared_ptr<partition_server_type> local_data_;
+        std::size_t begin_ = 0;
+        std::shared_ptr<ghost_data> ghosts_;
+    };
+}    // namespace hpx
@@ -14,6 +14,7 @@
 #include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/modules/async_distributed.hpp>
@@ -76,6 +77,10 @@ namespace hpx {
 
         typedef typename partitions_vector_type::const_iterator const_iterator;
 
+        // resolve the addresses of all remote partitions up front to avoid
+        // one AGAS round trip per partition when they are accessed first
+        std::vector<id_type> remote_partitions;
+
         std::size_t l = 0;
         const_iterator end = partitions_.cend();
         for (const_iterator it = partitions_.cbegin(); it != end; ++it, ++l)
@@ -86,6 +91,15 @@ namespace hpx {
                     get_ptr<partitioned_vector_partition_server>(it->partition_)
                         .then(get_ptr_helper{l, partitions_}));
             }
+            else
+            {
+                remote_partitions.push_back(it->partition_);
+            }
+        }
+
+        if (!remote_partitions.empty())
+        {
+            ptrs.push_back(hpx::agas::prefetch(remote_partitions));
         }
         hpx::wait_all(ptrs);
 
@@ -353,6 +367,9 @@ namespace hpx {
 
         std::size_t l = 0;
 
+        // resolve the addresses of all remote partitions up front
+        std::vector<id_type> remote_partitions;
+
         // Fixing the size of partitions to avoid race conditions between
         // possible reallocations during push back and the continuation
         // to set the local partition data
@@ -373,6 +390,10 @@ namespace hpx {
                         get_ptr<partitioned_vector_partition_server>(id).then(
                             get_ptr_helper{l, partitions_}));
                 }
+                else
+                {
+                    remote_partitions.push_back(id);
+                }
                 ++l;
 
                 allocated_size += size;
@@ -398,6 +419,10 @@ namespace hpx {
         }
         HPX_ASSERT(l == num_parts);
 
+        if (!remote_partitions.empty())
+        {
+            ptrs.push_back(hpx::agas::prefetch(remote_partitions));
+        }
         hpx::wait_all(ptrs);
 
         // cache our partition size
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_view.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_local_view.hpp>
 
@@ -0,0 +1,356 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/parallel/algorithms/uninitialized_relocate.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+
+#include <hpx/components/containers/partitioned_vector/detail/mapped_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::detail {
+
+    namespace {
+
+        [[noreturn]] void throw_mapping_error(
+            char const* function, std::string const& path)
+        {
+#if defined(HPX_WINDOWS)
+            auto const code = static_cast<unsigned long>(::GetLastError());
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error, function,
+                "could not map '{}' (error {})", path, code);
+#else
+            std::string const errstr = std::strerror(errno);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error, function,
+                "could not map '{}': {}", path, errstr);
+#endif
+        }
+
+        // mappings of at least this many bytes are relocated in parallel
+        // (if resized on an HPX thread)
+        constexpr std::size_t parallel_relocation_threshold =
+            std::size_t(1) << 20;
+
+        void relocate_bytes(void* dest, void const* src, std::size_t count)
+        {
+            auto const first = static_cast<std::byte const*>(src);
+            auto const dest_first = static_cast<std::byte*>(dest);
+
+            if (count >= parallel_relocation_threshold &&
+                hpx::threads::get_self_ptr() != nullptr)
+            {
+                hpx::experimental::uninitialized_relocate_n(
+                    hpx::execution::par, first, count, dest_first);
+            }
+            else
+            {
+                std::memcpy(dest, src, count);
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_file::mapped_file(std::string path)
+      : path_(HPX_MOVE(path))
+    {
+        std::size_t size = 0;
+
+#if defined(HPX_WINDOWS)
+        HANDLE const file = ::CreateFileA(path_.c_str(),
+            GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw_mapping_error("mapped_file::mapped_file", path_);
+        }
+        file_ = file;
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file, &file_size))
+        {
+            close();
+            throw_mapping_error("mapped_file::mapped_file", path_);
+        }
+        size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+        fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+        if (fd_ == -1)
+        {
+            throw_mapping_error("mapped_file::mapped_file", path_);
+        }
+
+        struct stat st = {};
+        if (::fstat(fd_, &st) != 0)
+        {
+            close();
+            throw_mapping_error("mapped_file::mapped_file", path_);
+        }
+        size = static_cast<std::size_t>(st.st_size);
+#endif
+
+        try
+        {
+            map(size);
+        }
+        catch (...)
+        {
+            close();
+            throw;
+        }
+    }
+
+    mapped_file::mapped_file(mapped_file&& rhs) noexcept
+      : path_(HPX_MOVE(rhs.path_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+#if defined(HPX_WINDOWS)
+      , file_(std::exchange(rhs.file_, nullptr))
+      , mapping_(std::exchange(rhs.mapping_, nullptr))
+#else
+      , fd_(std::exchange(rhs.fd_, -1))
+#endif
+    {
+    }
+
+    mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            close();
+
+            path_ = HPX_MOVE(rhs.path_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+#if defined(HPX_WINDOWS)
+            file_ = std::exchange(rhs.file_, nullptr);
+            mapping_ = std::exchange(rhs.mapping_, nullptr);
+#else
+            fd_ = std::exchange(rhs.fd_, -1);
+#endif
+        }
+        return *this;
+    }
+
+    mapped_file::~mapped_file()
+    {
+        unmap();
+        close();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void mapped_file::map(std::size_t size)
+    {
+        HPX_ASSERT(data_ == nullptr);
+        if (size == 0)
+        {
+            return;
+        }
+
+#if defined(HPX_WINDOWS)
+        if (file_ != nullptr)
+        {
+            // creating the mapping extends the file if necessary
+            auto const bytes = static_cast<std::uint64_t>(size);
+            mapping_ = ::CreateFileMappingA(file_, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(bytes >> 32),
+                static_cast<DWORD>(bytes & 0xffffffff), nullptr);
+            if (mapping_ == nullptr)
+            {
+                throw_mapping_error("mapped_file::map", path_);
+            }
+
+            data_ = ::MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, size);
+            if (data_ == nullptr)
+            {
+                ::CloseHandle(mapping_);
+                mapping_ = nullptr;
+                throw_mapping_error("mapped_file::map", path_);
+            }
+        }
+        else
+        {
+            data_ = ::VirtualAlloc(
+                nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (data_ == nullptr)
+            {
+                throw_mapping_error("mapped_file::map", path_);
+            }
+        }
+#else
+        void* address = MAP_FAILED;
+        if (fd_ != -1)
+        {
+            if (static_cast<std::size_t>(::lseek(fd_, 0, SEEK_END)) != size &&
+                ::ftruncate(fd_, static_cast<off_t>(size)) != 0)
+            {
+                throw_mapping_error("mapped_file::map", path_);
+            }
+            address = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        }
+        else
+        {
+            address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        }
+
+        if (address == MAP_FAILED)
+        {
+            throw_mapping_error("mapped_file::map", path_);
+        }
+        data_ = address;
+#endif
+        size_ = size;
+    }
+
+    void mapped_file::unmap() noexcept
+    {
+        if (data_ == nullptr)
+        {
+            return;
+        }
+
+#if defined(HPX_WINDOWS)
+        if (mapping_ != nullptr)
+        {
+            ::UnmapViewOfFile(data_);
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        else
+        {
+            ::VirtualFree(data_, 0, MEM_RELEASE);
+        }
+#else
+        ::munmap(data_, size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    void mapped_file::close() noexcept
+    {
+#if defined(HPX_WINDOWS)
+        if (file_ != nullptr)
+        {
+            ::CloseHandle(file_);
+            file_ = nullptr;
+        }
+#else
+        if (fd_ != -1)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void mapped_file::resize(std::size_t size)
+    {
+        if (size == size_)
+        {
+            return;
+        }
+
+#if defined(HPX_WINDOWS)
+        bool const file_backed = file_ != nullptr;
+#else
+        bool const file_backed = fd_ != -1;
+#endif
+
+        if (!file_backed)
+        {
+            // anonymous memory can't be extended in place
+            mapped_file tmp;
+            tmp.map(size);
+            if (data_ != nullptr && size != 0)
+            {
+                relocate_bytes(tmp.data_, data_, (std::min)(size, size_));
+            }
+            *this = HPX_MOVE(tmp);
+            return;
+        }
+
+        unmap();
+
+#if defined(HPX_WINDOWS)
+        // the mapping extends the file on its own, shrinking it has to be
+        // done explicitly
+        LARGE_INTEGER file_size;
+        file_size.QuadPart = static_cast<LONGLONG>(size);
+        if (!::SetFilePointerEx(file_, file_size, nullptr, FILE_BEGIN) ||
+            !::SetEndOfFile(file_))
+        {
+            throw_mapping_error("mapped_file::resize", path_);
+        }
+#else
+        if (size == 0 && ::ftruncate(fd_, 0) != 0)
+        {
+            throw_mapping_error("mapped_file::resize", path_);
+        }
+#endif
+
+        map(size);
+    }
+
+    void mapped_file::flush() const
+    {
+        if (data_ == nullptr)
+        {
+            return;
+        }
+
+#if defined(HPX_WINDOWS)
+        if (mapping_ != nullptr &&
+            (!::FlushViewOfFile(data_, size_) || !::FlushFileBuffers(file_)))
+        {
+            throw_mapping_error("mapped_file::flush", path_);
+        }
+#else
+        if (fd_ != -1 && ::msync(data_, size_, MS_SYNC) != 0)
+        {
+            throw_mapping_error("mapped_file::flush", path_);
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string next_mapped_file_path()
+    {
+        static std::atomic<std::size_t> sequence_number(0);
+
+        std::string const directory = hpx::get_config_entry(
+            "hpx.partitioned_vector.storage_path", ".");
+
+        return hpx::util::format("{}/partitioned_vector.{}.{}", directory,
+            hpx::get_locality_id(), sequence_number++);
+    }
+}    // namespace hpx::detail
@@ -0,0 +1,127 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/distributed_matrix.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_DISTRIBUTED_MATRIX(int)
+#endif
+
+int expected_value(std::size_t row, std::size_t col)
+{
+    return static_cast<int>(row * 100 + col);
+}
+
+void test_distributed_matrix(hpx::matrix_distribution distribution)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    // the edge tiles are only partially used
+    hpx::distributed_matrix<int> m(10, 7, 3, 2, -1, distribution);
+    HPX_TEST_EQ(m.rows(), std::size_t(10));
+    HPX_TEST_EQ(m.cols(), std::size_t(7));
+    HPX_TEST_EQ(m.num_tile_rows(), std::size_t(4));
+    HPX_TEST_EQ(m.num_tile_cols(), std::size_t(4));
+    HPX_TEST_EQ(m.grid_rows() * m.grid_cols(), localities.size());
+    HPX_TEST_EQ(m.tile_extent_rows({3, 0}), std::size_t(1));
+    HPX_TEST_EQ(m.tile_extent_cols({0, 3}), std::size_t(1));
+
+    for (std::size_t i = 0; i != m.num_tile_rows(); ++i)
+    {
+        for (std::size_t j = 0; j != m.num_tile_cols(); ++j)
+        {
+            // tile to locality mapping
+            std::size_t row = i % m.grid_rows();
+            std::size_t col = j % m.grid_cols();
+            if (distribution == hpx::matrix_distribution::block)
+            {
+                row = i * m.grid_rows() / m.num_tile_rows();
+                col = j * m.grid_cols() / m.num_tile_cols();
+            }
+            HPX_TEST_EQ(m.get_tile_locality_id({i, j}),
+                hpx::naming::get_locality_id_from_id(
+                    localities[row * m.grid_cols() + col]));
+        }
+    }
+
+    for (std::size_t r = 0; r != m.rows(); ++r)
+    {
+        for (std::size_t c = 0; c != m.cols(); ++c)
+        {
+            m.set_value(hpx::launch::sync, r, c, expected_value(r, c));
+        }
+    }
+
+    for (std::size_t r = 0; r != m.rows(); ++r)
+    {
+        for (std::size_t c = 0; c != m.cols(); ++c)
+        {
+            HPX_TEST_EQ(
+                m.get_value(hpx::launch::sync, r, c), expected_value(r, c));
+        }
+    }
+
+    // whole tiles are stored in row major order
+    std::vector<int> tile = m.get_tile(hpx::launch::sync, {1, 2});
+    HPX_TEST_EQ(tile.size(), m.tile_rows() * m.tile_cols());
+    HPX_TEST_EQ(tile[0], expected_value(3, 4));
+    HPX_TEST_EQ(tile[1], expected_value(3, 5));
+    HPX_TEST_EQ(tile[2], expected_value(4, 4));
+
+    for (int& value : tile)
+        value = -value;
+    m.set_tile(hpx::launch::sync, {1, 2}, tile);
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, 5, 5), -expected_value(5, 5));
+
+    // local tiles are accessible directly and are enumerated by the local
+    // segment iterators
+    std::uint32_t const here = hpx::get_locality_id();
+    std::vector<hpx::tile_index> const local = m.local_tiles();
+
+    std::size_t count = 0;
+    for (auto it = m.tile_begin(here); it != m.tile_end(here); ++it, ++count)
+    {
+        hpx::tile_index const t = m.get_tile_index(it);
+        HPX_TEST(m.is_local(t));
+        HPX_TEST_EQ(m.get_tile_locality_id(t), here);
+
+        auto const view = m.local_tile(t);
+        for (std::size_t r = 0; r != view.rows(); ++r)
+        {
+            for (std::size_t c = 0; c != view.cols(); ++c)
+            {
+                std::size_t const row = t.row * m.tile_rows() + r;
+                std::size_t const col = t.col * m.tile_cols() + c;
+                int const value = (t.row == 1 && t.col == 2) ?
+                    -expected_value(row, col) :
+                    expected_value(row, col);
+                HPX_TEST_EQ(view(r, c), value);
+            }
+        }
+    }
+    HPX_TEST_EQ(count, local.size());
+}
+
+int main()
+{
+    test_distributed_matrix(hpx::matrix_distribution::block_cyclic);
+    test_distributed_matrix(hpx::matrix_distribution::block);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,89 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/partitioned_vector_view.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+#endif
+
+void test_halo(hpx::partitioned_vector<int>& v, std::size_t num_partitions,
+    std::size_t width, bool periodic)
+{
+    auto const size = static_cast<std::ptrdiff_t>(v.size());
+    for (std::ptrdiff_t i = 0; i != size; ++i)
+    {
+        v.set_value(hpx::launch::sync, i, static_cast<int>(i));
+    }
+
+    std::uint32_t const here = hpx::get_locality_id();
+    for (auto it = v.segment_cbegin(here); it != v.segment_cend(here); ++it)
+    {
+        hpx::partitioned_vector_halo<int> halo(
+            v, v.get_partition(it), width, width, periodic);
+        hpx::future<void> f = halo.exchange();
+
+        // the interior can be used while the ghost zones are refreshed
+        auto const begin = static_cast<std::ptrdiff_t>(halo.global_begin());
+        std::ptrdiff_t idx = begin;
+        for (int value : halo.interior())
+        {
+            HPX_TEST_EQ(value, idx++);
+        }
+
+        f.get();
+
+        auto const left = static_cast<std::ptrdiff_t>(halo.left_width());
+        auto const right = static_cast<std::ptrdiff_t>(halo.right_width());
+        if (periodic && num_partitions != 1)
+        {
+            HPX_TEST_EQ(halo.left_width(), width);
+            HPX_TEST_EQ(halo.right_width(), width);
+        }
+
+        auto const n = static_cast<std::ptrdiff_t>(halo.size());
+        HPX_TEST_EQ(std::distance(halo.begin(), halo.end()), left + n + right);
+
+        idx = -left;
+        for (int value : halo)
+        {
+            HPX_TEST_EQ(value, static_cast<int>((begin + idx + size) % size));
+            ++idx;
+        }
+    }
+}
+
+int main()
+{
+    std::size_t const length = 64;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (std::size_t num_partitions : {1, 2, 4, 7})
+    {
+        hpx::partitioned_vector<int> v(
+            length, hpx::container_layout(num_partitions, localities));
+
+        test_halo(v, num_partitions, 1, false);
+        test_halo(v, num_partitions, 3, false);
+        test_halo(v, num_partitions, 5, true);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <hpx/components/containers/partitioned_vector/mapped_vector.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using mapped_ints = hpx::mapped_vector<int>;
+HPX_REGISTER_PARTITIONED_VECTOR(int, mapped_ints)
+
+std::string storage_path()
+{
+    return (hpx::filesystem::temp_directory_path() /
+        "hpx_partitioned_vector_mapped")
+        .string();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reopen()
+{
+    std::string const path = storage_path() + "/reopen.bin";
+    hpx::filesystem::remove(path);
+
+    {
+        mapped_ints v(path, 100, 1);
+        HPX_TEST_EQ(v.size(), std::size_t(100));
+        HPX_TEST_EQ(v.path(), path);
+
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            HPX_TEST_EQ(v[i], 1);
+            v[i] = static_cast<int>(i);
+        }
+        v.flush();
+    }
+
+    {
+        // the contents of the file are kept, new elements are initialized
+        mapped_ints v(path, 150, 7);
+        HPX_TEST_EQ(v.size(), std::size_t(150));
+        for (std::size_t i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(v[i], static_cast<int>(i));
+        }
+        for (std::size_t i = 100; i != v.size(); ++i)
+        {
+            HPX_TEST_EQ(v[i], 7);
+        }
+
+        v.push_back(42);
+        HPX_TEST_EQ(v.back(), 42);
+        v.pop_back();
+
+        // copies are held in memory
+        mapped_ints copy(v);
+        HPX_TEST(copy.path().empty());
+        HPX_TEST_EQ(copy.size(), v.size());
+        HPX_TEST_EQ(copy[42], 42);
+
+        v.resize(10);
+    }
+
+    {
+        mapped_ints v(path, 10);
+        HPX_TEST_EQ(v.size(), std::size_t(10));
+        HPX_TEST_EQ(v[9], 9);
+    }
+
+    hpx::filesystem::remove(path);
+}
+
+void test_partitioned_vector()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::size_t const size = 1000;
+
+    hpx::partitioned_vector<int, mapped_ints> v(
+        size, 3, hpx::container_layout(4 * localities.size(), localities));
+    HPX_TEST_EQ(v.size(), size);
+
+    for (std::size_t i = 0; i != size; i += 3)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), 3);
+        v.set_value(hpx::launch::sync, i, static_cast<int>(i));
+    }
+
+    hpx::partitioned_vector<int, mapped_ints> copy(v);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        int const expected = i % 3 == 0 ? static_cast<int>(i) : 3;
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), expected);
+        HPX_TEST_EQ(copy.get_value(hpx::launch::sync, i), expected);
+    }
+}
+
+int hpx_main()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_reopen();
+        test_partitioned_vector();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::filesystem::create_directories(storage_path());
+
+    std::vector<std::string> const cfg = {
+        "hpx.partitioned_vector.storage_path=" + storage_path()};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    hpx::filesystem::remove_all(storage_path());
+    return hpx::util::report_errors();
+}
+#endif
@@ -24,11 +24,12 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
+#include <hpx/concurrency/concurrent_hash_map.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/datastructures/serialization/optional.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
@@ -36,10 +37,14 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -50,26 +55,36 @@ namespace hpx { namespace server {
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in a concurrent hash
+    /// map, which allows for the actions of a partition to be executed
+    /// concurrently.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef hpx::util::concurrent_hash_map<Key, T, Hash, KeyEqual>
+            storage_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        storage_type partition_unordered_map_;
+
+        template <typename Map>
+        void insert_all(Map const& m)
+        {
+            m.for_each([this](Key const& key, T const& value) {
+                partition_unordered_map_.insert_or_assign(key, value);
+            });
+        }
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -87,15 +102,18 @@ namespace hpx { namespace server {
 
         partition_unordered_map(
             size_type bucket_count, Hash const& hash, KeyEqual const& equal)
-          : partition_unordered_map_(bucket_count, hash, equal)
+          : partition_unordered_map_(bucket_count,
+                storage_type::default_num_stripes, hash, equal)
         {
         }
 
-        // support components::copy
+        // support components::copy, the concurrent hash map can be neither
+        // copied nor moved, its elements are transferred one by one
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs)
-          , partition_unordered_map_(rhs.partition_unordered_map_)
+          , partition_unordered_map_(rhs.partition_unordered_map_.size())
         {
+            insert_all(rhs.partition_unordered_map_);
         }
 
         partition_unordered_map& operator=(partition_unordered_map const& rhs)
@@ -103,15 +121,18 @@ namespace hpx { namespace server {
             if (this != &rhs)
             {
                 this->base_type::operator=(rhs);
-                partition_unordered_map_ = rhs.partition_unordered_map_;
+                partition_unordered_map_.clear();
+                insert_all(rhs.partition_unordered_map_);
             }
             return *this;
         }
 
         partition_unordered_map(partition_unordered_map&& rhs)
           : base_type(HPX_MOVE(rhs))
-          , partition_unordered_map_(HPX_MOVE(rhs.partition_unordered_map_))
+          , partition_unordered_map_(rhs.partition_unordered_map_.size())
         {
+            insert_all(rhs.partition_unordered_map_);
+            rhs.partition_unordered_map_.clear();
         }
 
         partition_unordered_map& operator=(partition_unordered_map&& rhs)
@@ -119,8 +140,9 @@ namespace hpx { namespace server {
             if (this != &rhs)
             {
                 this->base_type::operator=(HPX_MOVE(rhs));
-                partition_unordered_map_ =
-                    HPX_MOVE(rhs.partition_unordered_map_);
+                partition_unordered_map_.clear();
+                insert_all(rhs.partition_unordered_map_);
+                rhs.partition_unordered_map_.clear();
             }
             return *this;
         }
@@ -128,38 +150,19 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type result;
+            result.reserve(partition_unordered_map_.size());
+            partition_unordered_map_.for_each(
+                [&](Key const& key, T const& value) {
+                    result.emplace(key, value);
+                });
+            return result;
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_.clear();
+            partition_unordered_map_.reserve(d.size());
+            partition_unordered_map_.insert(d.begin(), d.end());
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -172,21 +175,7 @@ namespace hpx { namespace server {
             return partition_unordered_map_.size();
         }
 
-        /// Returns the maximum possible number of elements
-        size_type max_size() const
-        {
-            return partition_unordered_map_.max_size();
-        }
-
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
-        }
-
-        /// Checks if the container has no elements, i.e. whether
-        /// begin() == end().
+        /// Checks if the container has no elements
         bool empty() const
         {
             return partition_unordered_map_.empty();
@@ -206,9 +195,8 @@ namespace hpx { namespace server {
         ///
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            std::optional<T> result = partition_unordered_map_.find(key);
+            if (!result)
             {
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "partition_unordered_map::get_value",
@@ -216,13 +204,11 @@ namespace hpx { namespace server {
                     "unordered_map");
             }
 
-            if (!erase)
-                return it->second;
-
-            auto on_exit = hpx::experimental::scope_exit(
-                [this, &it] { partition_unordered_map_.erase(it); });
-
-            return it->second;
+            if (erase)
+            {
+                partition_unordered_map_.erase(key);
+            }
+            return HPX_MOVE(*result);
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -235,26 +221,43 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
+            std::vector<std::optional<T>> found = bulk_find(keys);
+
             std::vector<T> result;
             result.reserve(keys.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            for (std::optional<T>& value : found)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (!value)
                 {
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
-                result.push_back(it->second);
+                result.push_back(HPX_MOVE(*value));
             }
             return result;
         }
 
+        /// Look up all given keys, the lookups for keys falling into the same
+        /// stripe of the underlying concurrent hash map are performed while
+        /// acquiring its lock only once.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return Return an (empty if not found) optional value for each of
+        ///         the given keys.
+        ///
+        std::vector<std::optional<T>> bulk_find(
+            std::vector<Key> const& keys) const
+        {
+            std::vector<std::optional<T>> result;
+            result.reserve(keys.size());
+            partition_unordered_map_.find(
+                keys.begin(), keys.end(), std::back_inserter(result));
+            return result;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
@@ -268,7 +271,7 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -281,10 +284,24 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
+        }
+
+        /// Insert all given elements whose keys are not present in the
+        /// partition_unordered_map yet, existing elements are left unchanged.
+        /// Elements falling into the same stripe of the underlying concurrent
+        /// hash map are inserted while acquiring its lock only once.
+        ///
+        /// \param values  The elements to insert
+        ///
+        /// \return Return the number of inserted elements
+        ///
+        std::size_t bulk_insert(std::vector<std::pair<Key, T>> const& values)
+        {
+            return partition_unordered_map_.insert(
+                values.begin(), values.end());
         }
 
         /// Remove all elements from the vector leaving the
@@ -298,7 +315,7 @@ namespace hpx { namespace server {
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
-            return partition_unordered_map_.erase(key);
+            return partition_unordered_map_.erase(key) ? 1 : 0;
         }
 
         /// Macros to define HPX component actions for all exported functions.
@@ -306,9 +323,11 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, bulk_find)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, bulk_insert)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
 
@@ -351,12 +370,18 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::bulk_find_action,       \
+        HPX_PP_CAT(__unordered_map_bulk_find_action_, name))                   \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::bulk_insert_action,     \
+        HPX_PP_CAT(__unordered_map_bulk_insert_action_, name))                 \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -408,12 +433,18 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::bulk_find_action,       \
+        HPX_PP_CAT(__unordered_map_bulk_find_action_, name))                   \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::bulk_insert_action,     \
+        HPX_PP_CAT(__unordered_map_bulk_insert_action_, name))                 \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -636,6 +667,63 @@ namespace hpx {
                 this->get_id(), keys, vals);
         }
 
+        /// Look up all given keys in the partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return Returns an (empty if not found) optional value for each of
+        ///         the given keys
+        ///
+        std::vector<std::optional<T>> bulk_find(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return bulk_find(keys).get();
+        }
+
+        /// Look up all given keys in the partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return This returns an (empty if not found) optional value for
+        ///         each of the given keys as the hpx::future
+        ///
+        future<std::vector<std::optional<T>>> bulk_find(
+            std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::bulk_find_action>(
+                this->get_id(), keys);
+        }
+
+        /// Insert all given elements whose keys are not present in the
+        /// partition_unordered_map component yet.
+        ///
+        /// \param values  The elements to insert
+        ///
+        /// \return Returns the number of inserted elements
+        ///
+        std::size_t bulk_insert(launch::sync_policy,
+            std::vector<std::pair<Key, T>> const& values)
+        {
+            return bulk_insert(values).get();
+        }
+
+        /// Insert all given elements whose keys are not present in the
+        /// partition_unordered_map component yet.
+        ///
+        /// \param values  The elements to insert
+        ///
+        /// \return This returns the number of inserted elements as the
+        ///         hpx::future
+        ///
+        future<std::size_t> bulk_insert(
+            std::vector<std::pair<Key, T>> const& values)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::bulk_insert_action>(
+                this->get_id(), values);
+        }
+
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
         ///
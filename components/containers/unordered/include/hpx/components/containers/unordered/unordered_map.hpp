@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/dataflow.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -32,6 +33,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -878,6 +880,156 @@ namespace hpx {
                 .erase(key);
         }
 
+        /// Insert all given elements whose keys are not present in the
+        /// unordered_map yet, existing elements are left unchanged. The
+        /// elements are grouped by partition, a single request is sent to
+        /// each remote partition, local partitions are accessed directly.
+        ///
+        /// \param values  The elements to insert
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         inserted elements
+        ///
+        future<std::size_t> bulk_insert(
+            std::vector<std::pair<Key, T>> const& values)
+        {
+            std::vector<std::vector<std::pair<Key, T>>> parts(
+                partitions_.size());
+            for (std::pair<Key, T> const& value : values)
+            {
+                parts[get_partition(value.first)].push_back(value);
+            }
+
+            std::size_t inserted = 0;
+            std::vector<future<std::size_t>> results;
+            for (std::size_t part = 0; part != parts.size(); ++part)
+            {
+                if (parts[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    inserted += part_data.local_data_->bulk_insert(parts[part]);
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .bulk_insert(parts[part]));
+                }
+            }
+
+            if (results.empty())
+                return make_ready_future(inserted);
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [inserted](std::vector<future<std::size_t>>&& f) {
+                    std::size_t result = inserted;
+                    for (future<std::size_t>& r : f)
+                    {
+                        result += r.get();
+                    }
+                    return result;
+                },
+                HPX_MOVE(results));
+        }
+
+        /// Insert all given elements whose keys are not present in the
+        /// unordered_map yet.
+        ///
+        /// \param values  The elements to insert
+        ///
+        /// \return Returns the number of inserted elements
+        ///
+        std::size_t bulk_insert(
+            launch::sync_policy, std::vector<std::pair<Key, T>> const& values)
+        {
+            return bulk_insert(values).get();
+        }
+
+        /// Look up all given keys. The keys are grouped by partition, a single
+        /// request is sent to each remote partition, local partitions are
+        /// accessed directly.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return This returns the hpx::future containing an (empty if not
+        ///         found) optional value for each of the given keys, in the
+        ///         order of the keys
+        ///
+        future<std::vector<std::optional<T>>> bulk_find(
+            std::vector<Key> const& keys) const
+        {
+            // the keys of each partition and their positions in the result
+            std::vector<std::vector<Key>> part_keys(partitions_.size());
+            std::vector<std::vector<std::size_t>> positions(
+                partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t const part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                positions[part].push_back(i);
+            }
+
+            std::vector<future<std::vector<std::optional<T>>>> results;
+            std::vector<std::size_t> parts;
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    results.push_back(make_ready_future(
+                        part_data.local_data_->bulk_find(part_keys[part])));
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .bulk_find(part_keys[part]));
+                }
+                parts.push_back(part);
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [size = keys.size(), parts = HPX_MOVE(parts),
+                    positions = HPX_MOVE(positions)](
+                    std::vector<future<std::vector<std::optional<T>>>>&& f) {
+                    std::vector<std::optional<T>> result(size);
+                    for (std::size_t i = 0; i != f.size(); ++i)
+                    {
+                        std::vector<std::optional<T>> values = f[i].get();
+                        std::vector<std::size_t> const& pos =
+                            positions[parts[i]];
+                        HPX_ASSERT(values.size() == pos.size());
+                        for (std::size_t j = 0; j != values.size(); ++j)
+                        {
+                            result[pos[j]] = HPX_MOVE(values[j]);
+                        }
+                    }
+                    return result;
+                },
+                HPX_MOVE(results));
+        }
+
+        /// Look up all given keys.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return Returns an (empty if not found) optional value for each of
+        ///         the given keys, in the order of the keys
+        ///
+        std::vector<std::optional<T>> bulk_find(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return bulk_find(keys).get();
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segmented::segment_unordered_map_iterator<Key, T, Hash,
             KeyEqual, typename partitions_vector_type::iterator>
@@ -17,7 +17,9 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -79,6 +81,43 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_operations(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m)
+{
+    std::size_t const count = 107;
+
+    std::vector<std::pair<Key, Value>> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        values.emplace_back(std::to_string(i), Value(i));
+    }
+    HPX_TEST_EQ(m.bulk_insert(hpx::launch::sync, values), count);
+    HPX_TEST_EQ(m.size(), count);
+
+    // existing elements are not overwritten
+    values[0].second = Value(-1);
+    values.emplace_back(std::to_string(count), Value(count));
+    HPX_TEST_EQ(m.bulk_insert(values).get(), std::size_t(1));
+    HPX_TEST_EQ(m.size(), count + 1);
+
+    std::vector<Key> keys;
+    for (std::size_t i = 0; i != count + 1; ++i)
+    {
+        keys.push_back(std::to_string(count - i));
+    }
+    keys.push_back("missing");
+
+    std::vector<std::optional<Value>> found =
+        m.bulk_find(hpx::launch::sync, keys);
+    HPX_TEST_EQ(found.size(), keys.size());
+    for (std::size_t i = 0; i != count + 1; ++i)
+    {
+        HPX_TEST(found[i].has_value());
+        HPX_TEST_EQ(*found[i], Value(count - i));
+    }
+    HPX_TEST(!found.back().has_value());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -110,6 +149,12 @@ void trivial_tests(DistPolicy const& policy)
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m(17, policy);
+        test_bulk_operations(m);
+    }
 }
 
 template <typename Key, typename Value>
@@ -151,6 +196,12 @@ void trivial_tests()
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m;
+        test_bulk_operations(m);
+    }
 }
 
 int main()
@@ -16,14 +16,18 @@
 #include <hpx/components/iostreams/server/output_stream.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/iostreams/stream.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
@@ -132,6 +136,23 @@ namespace hpx { namespace iostreams {
             return "/locality#console/output_stream#consolestream";
         }
 
+        // the suffix of the node-local file the output of a stream is written
+        // to (see hpx.iostreams.local_file)
+        inline char const* get_local_outstream_name(cout_tag)
+        {
+            return "cout";
+        }
+
+        inline char const* get_local_outstream_name(cerr_tag)
+        {
+            return "cerr";
+        }
+
+        inline char const* get_local_outstream_name(consolestream_tag)
+        {
+            return nullptr;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         hpx::future<hpx::id_type> create_ostream(
             char const* name, std::ostream& strm);
@@ -153,6 +174,25 @@ namespace hpx { namespace iostreams {
             release_ostream(get_outstream_name(tag), id);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // The minimal number of bytes sent to the console at once by
+        // asynchronous writes (hpx.iostreams.buffer_size) and the interval
+        // (in milliseconds) after which smaller amounts of data are sent
+        // nevertheless (hpx.iostreams.flush_interval)
+        HPX_IOSTREAMS_EXPORT std::size_t get_aggregation_size();
+        HPX_IOSTREAMS_EXPORT std::int64_t get_flush_interval();
+
+        // Open the node-local file the output of the given stream is written
+        // to, returns nullptr if hpx.iostreams.local_file is not set
+        HPX_IOSTREAMS_EXPORT std::unique_ptr<std::ostream> create_local_ostream(
+            char const* name);
+
+        template <typename Tag>
+        std::unique_ptr<std::ostream> create_local_ostream(Tag tag)
+        {
+            return create_local_ostream(get_local_outstream_name(tag));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void register_ostreams();
         void unregister_ostreams();
@@ -184,6 +224,67 @@ namespace hpx { namespace iostreams {
         using detail::buffer::mtx_;
         std::atomic<std::uint64_t> generational_count_;
 
+        // asynchronous writes are aggregated until this many bytes have been
+        // buffered or the timer fires
+        std::size_t aggregation_size_;
+        std::unique_ptr<util::interval_timer> flush_timer_;
+
+        // the node-local file all output is written to instead of sending it
+        // to the console
+        std::unique_ptr<std::ostream> local_stream_;
+
+        // Send the buffered data to the console asynchronously, or write it
+        // to the node-local file. Small amounts of data are kept in the
+        // buffer if aggregate is true. Unlocks the given lock.
+        template <typename Lock>
+        void send_async(Lock& l, bool aggregate)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            if (local_stream_)
+            {
+                // write while holding the lock to keep the output in order
+                buffer next = this->detail::buffer::init_locked();
+                hpx::no_mutex mtx;
+                next.write(
+                    make_std_ostream_write_function(*local_stream_), mtx);
+                l.unlock();
+                return;
+            }
+
+            if (this->detail::buffer::empty_locked() ||
+                (aggregate &&
+                    this->detail::buffer::size_locked() < aggregation_size_))
+            {
+                l.unlock();
+                return;
+            }
+
+            // Create the next buffer, returns the previous buffer
+            buffer next = this->detail::buffer::init_locked();
+
+            // Unlock the mutex before we cleanup.
+            l.unlock();
+
+            // Perform the write operation, then destroy the old buffer and
+            // stream.
+            typedef server::output_stream::write_async_action action_type;
+            hpx::post<action_type>(this->get_id(), hpx::get_locality_id(),
+                generational_count_++, next);
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(l);
+            HPX_UNUSED(aggregate);
+#endif
+        }
+
+        // invoked by the timer to send the aggregated data
+        bool flush_aggregated()
+        {
+            std::unique_lock<mutex_type> l(*mtx_);
+            send_async(l, false);
+            return true;
+        }
+
         // Performs a lazy streaming operation.
         template <typename T>
         ostream& streaming_operator_lazy(T const& subject)
@@ -203,20 +304,7 @@ namespace hpx { namespace iostreams {
 
             // If the buffer isn't empty, send it asynchronously to the
             // destination.
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
-
-                // Unlock the mutex before we cleanup.
-                l.unlock();
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::post<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            send_async(l, true);
 #else
             HPX_ASSERT(false);
             HPX_UNUSED(subject);
@@ -234,6 +322,12 @@ namespace hpx { namespace iostreams {
             // apply the subject to the local stream
             *static_cast<stream_base_type*>(this) << subject;
 
+            if (local_stream_)
+            {
+                send_async(l, false);
+                return *this;
+            }
+
             // Send even empty buffer to flush the data buffered server-side.
 
             // Create the next buffer, returns the previous buffer
@@ -264,26 +358,13 @@ namespace hpx { namespace iostreams {
         {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
             std::unique_lock<mutex_type> l(*mtx_);
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
 
-                // Unlock the mutex before we cleanup.
-                l.unlock();
+            // since mtx_ is recursive and apply will do an AGAS lookup, we
+            // need to ignore the lock here in case we are called recursively
+            hpx::util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
 
-                // since mtx_ is recursive and apply will do an AGAS lookup,
-                // we need to ignore the lock here in case we are called
-                // recursively
-                hpx::util::ignore_while_checking il(&l);
-                HPX_UNUSED(il);
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::post<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            send_async(l, true);
             return true;
 #else
             HPX_ASSERT(false);
@@ -300,18 +381,36 @@ namespace hpx { namespace iostreams {
         void initialize(Tag tag)
         {
             *static_cast<base_type*>(this) = detail::create_ostream(tag);
+
+            local_stream_ = detail::create_local_ostream(tag);
+            aggregation_size_ = detail::get_aggregation_size();
+            if (aggregation_size_ != 0 && !local_stream_)
+            {
+                flush_timer_ = std::make_unique<util::interval_timer>(
+                    [this]() { return flush_aggregated(); },
+                    std::chrono::milliseconds(detail::get_flush_interval()),
+                    "hpx::iostreams::ostream::flush_aggregated", true);
+                flush_timer_->start(false);
+            }
         }
 
         // reset this object during runtime system shutdown
         template <typename Tag>
         void uninitialize(Tag tag)
         {
+            if (flush_timer_)
+            {
+                flush_timer_->stop(true);
+                flush_timer_.reset();
+            }
+
             std::unique_lock<mutex_type> l(*mtx_, std::try_to_lock);
             if (l)
             {
                 streaming_operator_sync(
                     hpx::iostreams::flush_type(), l);    // unlocks
             }
+            local_stream_.reset();
 
             // FIXME: find a later spot to invoke this
             detail::release_ostream(tag, this->get_id());
@@ -324,6 +423,7 @@ namespace hpx { namespace iostreams {
           , buffer()
           , stream_base_type(*this)
           , generational_count_(0)
+          , aggregation_size_(0)
         {
         }
 
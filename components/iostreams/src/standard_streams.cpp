@@ -13,14 +13,22 @@
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/create_component.hpp>
 #include <hpx/functional/bind_back.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
 
 #include <hpx/components/iostreams/ostream.hpp>
 #include <hpx/components/iostreams/standard_streams.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -74,6 +82,53 @@ namespace hpx { namespace iostreams { namespace detail {
         return agas::on_symbol_namespace_event(cout_name, true);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t get_aggregation_size()
+    {
+        return hpx::util::from_string<std::size_t>(
+            hpx::get_config_entry("hpx.iostreams.buffer_size", "0"),
+            static_cast<std::size_t>(0));
+    }
+
+    std::int64_t get_flush_interval()
+    {
+        return hpx::util::from_string<std::int64_t>(
+            hpx::get_config_entry("hpx.iostreams.flush_interval", "10"),
+            static_cast<std::int64_t>(10));
+    }
+
+    std::unique_ptr<std::ostream> create_local_ostream(char const* name)
+    {
+        if (name == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::string const base = hpx::get_config_entry(
+            "hpx.iostreams.local_file", "");
+        if (base.empty())
+        {
+            return nullptr;
+        }
+
+        // every locality writes to its own file
+        std::string const file_name =
+            hpx::util::format("{}.{}.{}", base, hpx::get_locality_id(), name);
+
+        LRT_(info).format(
+            "detail::create_local_ostream: writing '{}' to '{}'", name,
+            file_name);
+
+        auto os = std::make_unique<std::ofstream>(file_name);
+        if (!*os)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::iostreams::detail::create_local_ostream",
+                "could not open the file {} for writing", file_name);
+        }
+        return os;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void release_ostream(char const* name, hpx::id_type const& /* id */)
     {
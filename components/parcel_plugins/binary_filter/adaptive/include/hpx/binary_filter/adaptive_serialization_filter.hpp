@@ -0,0 +1,107 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/serialization.hpp>
+#include <hpx/serialization/unique_ptr.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // Running averages of the compression ratio and of the time needed for
+    // compressing the parcels of one action type.
+    struct compression_statistics
+    {
+        hpx::spinlock mtx_;
+        double ratio_ = 1.0;          // compressed size / uncompressed size
+        double ns_per_byte_ = 0.0;    // time needed for compressing a byte
+        std::size_t samples_ = 0;
+        std::size_t skipped_ = 0;    // messages sent since the last sample
+    };
+
+    // The adaptive filter compresses the parcels of an action only if this
+    // pays off for the configured link bandwidth. It measures the compression
+    // ratio and speed achieved by the underlying filter for each action type
+    // and sends the parcels uncompressed as long as the expected reduction of
+    // the transfer time is smaller than the time needed for compressing and
+    // decompressing them. Every sample_interval-th message is compressed
+    // regardless, to detect changes in the compressibility of the data.
+    //
+    // The settings are taken from the configuration section
+    // [hpx.plugins.adaptive_serialization_filter]:
+    //
+    //      filter = zstd_serialization_filter  (the underlying filter)
+    //      policy = adaptive                   (or: always, never)
+    //      bandwidth = 1250                    (link bandwidth in MB/s)
+    //      min_size = 1024                     (in bytes)
+    //      sample_interval = 32
+    //
+    // The receiving end does not need any configuration, the decision is
+    // sent along with every message.
+    struct HPX_LIBRARY_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        explicit adaptive_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr) noexcept;
+
+        // Associate the filter with the statistics of the action type the
+        // compressed parcels belong to.
+        void set_statistics(compression_statistics* statistics) noexcept
+        {
+            statistics_ = statistics;
+        }
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+    private:
+        bool should_compress(std::size_t size);
+
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+            // clang-format off
+            ar & filter_;
+            // clang-format on
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter, override);
+
+        // the underlying filter, if the data is compressed
+        std::unique_ptr<serialization::binary_filter> filter_;
+        compression_statistics* statistics_;
+        std::vector<char> buffer_;
+        std::size_t current_;
+        std::size_t uncompressed_size_;
+        bool compress_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
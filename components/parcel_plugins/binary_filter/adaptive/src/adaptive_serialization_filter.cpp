@@ -0,0 +1,330 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/adaptive_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <string>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.adaptive_serialization_filter]
+    //      ...
+    //      filter = zstd_serialization_filter
+    //      policy = adaptive
+    //      bandwidth = 1250
+    //      min_size = 1024
+    //      sample_interval = 32
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::adaptive_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            // use the best available compression filter by default
+            return "filter = "
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+                   "zstd_serialization_filter\n"
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+                   "lz4_serialization_filter\n"
+#elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
+                   "snappy_serialization_filter\n"
+#elif defined(HPX_HAVE_COMPRESSION_ZLIB)
+                   "zlib_serialization_filter\n"
+#elif defined(HPX_HAVE_COMPRESSION_BZIP2)
+                   "bzip2_serialization_filter\n"
+#else
+                   "\n"
+#endif
+                   "policy = adaptive\n"
+                   "bandwidth = 1250\n"
+                   "min_size = 1024\n"
+                   "sample_interval = 32";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::adaptive_serialization_filter,
+    adaptive_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        enum class compression_policy
+        {
+            adaptive,
+            always,
+            never
+        };
+
+        // the configuration is read once as it is needed for every parcel
+        struct adaptive_configuration
+        {
+            adaptive_configuration()
+              : filter_(get_entry("filter", ""))
+              , policy_(compression_policy::adaptive)
+              , bytes_per_ns_(1.25)
+              , min_size_(1024)
+              , sample_interval_(32)
+            {
+                std::string const policy = get_entry("policy", "adaptive");
+                if (policy == "always")
+                {
+                    policy_ = compression_policy::always;
+                }
+                else if (policy == "never" || filter_.empty())
+                {
+                    policy_ = compression_policy::never;
+                }
+
+                // the bandwidth is given in MB/s
+                bytes_per_ns_ =
+                    (std::max)(hpx::util::from_string<double>(
+                                   get_entry("bandwidth", "1250"), 1250.0),
+                        1.0) *
+                    1e-3;
+                min_size_ = hpx::util::from_string<std::size_t>(
+                    get_entry("min_size", "1024"), min_size_);
+                sample_interval_ = hpx::util::from_string<std::size_t>(
+                    get_entry("sample_interval", "32"), sample_interval_);
+            }
+
+            static std::string get_entry(char const* key, char const* dflt)
+            {
+                return hpx::get_config_entry(
+                    std::string("hpx.plugins.adaptive_serialization_filter.") +
+                        key,
+                    dflt);
+            }
+
+            std::string filter_;
+            compression_policy policy_;
+            double bytes_per_ns_;
+            std::size_t min_size_;
+            std::size_t sample_interval_;
+        };
+
+        adaptive_configuration const& get_configuration()
+        {
+            static adaptive_configuration const configuration;
+            return configuration;
+        }
+
+        // weight of a new sample in the running averages
+        constexpr double sample_weight = 0.25;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_serialization_filter::adaptive_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */) noexcept
+      : statistics_(nullptr)
+      , current_(0)
+      , uncompressed_size_(0)
+      , compress_(compress)
+    {
+    }
+
+    bool adaptive_serialization_filter::should_compress(std::size_t size)
+    {
+        detail::adaptive_configuration const& config =
+            detail::get_configuration();
+
+        if (config.policy_ == detail::compression_policy::never ||
+            size < config.min_size_)
+        {
+            return false;
+        }
+        if (config.policy_ == detail::compression_policy::always ||
+            statistics_ == nullptr)
+        {
+            return true;
+        }
+
+        std::lock_guard<hpx::spinlock> l(statistics_->mtx_);
+        if (statistics_->samples_ == 0)
+        {
+            return true;
+        }
+
+        // Compressing pays off if the time saved by sending less data exceeds
+        // the time needed for compressing the data and for decompressing it
+        // on the receiving end (which is assumed to be not slower).
+        auto const bytes = static_cast<double>(size);
+        double const saved_ns =
+            bytes * (1.0 - statistics_->ratio_) / config.bytes_per_ns_;
+        double const cost_ns = 2.0 * bytes * statistics_->ns_per_byte_;
+        if (saved_ns > cost_ns)
+        {
+            return true;
+        }
+
+        // sample the compression ratio every once in a while
+        if (++statistics_->skipped_ >= config.sample_interval_)
+        {
+            statistics_->skipped_ = 0;
+            return true;
+        }
+        return false;
+    }
+
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        // this is called before the filter itself is serialized, the decision
+        // whether to compress is sent along with the data
+        if (compress_ && !filter_ && should_compress(size))
+        {
+            error_code ec(throwmode::lightweight);
+            filter_.reset(hpx::create_binary_filter(
+                detail::get_configuration().filter_.c_str(), true, nullptr,
+                ec));
+            if (ec)
+            {
+                filter_.reset();
+            }
+        }
+
+        if (filter_)
+        {
+            filter_->set_max_length(size);
+        }
+        else
+        {
+            buffer_.reserve(size);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t adaptive_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (filter_)
+        {
+            return filter_->init_data(buffer, size, buffer_size);
+        }
+
+        char const* src_begin = static_cast<char const*>(buffer);
+        buffer_.assign(src_begin, src_begin + size);
+        current_ = 0;
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (filter_)
+        {
+            filter_->load(dst, dst_count);
+            return;
+        }
+
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "adaptive_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        uncompressed_size_ += src_count;
+        if (filter_)
+        {
+            filter_->save(src, src_count);
+            return;
+        }
+
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (!filter_)
+        {
+            // send the data uncompressed
+            if (buffer_.size() > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            if (!buffer_.empty())
+            {
+                std::memcpy(dst, buffer_.data(), buffer_.size());
+            }
+            written = buffer_.size();
+            return true;
+        }
+
+        hpx::chrono::high_resolution_timer const timer;
+        if (!filter_->flush(dst, dst_count, written))
+        {
+            return false;
+        }
+
+        // update the statistics of the action type
+        if (statistics_ != nullptr && uncompressed_size_ != 0)
+        {
+            auto const bytes = static_cast<double>(uncompressed_size_);
+            double const ratio = static_cast<double>(written) / bytes;
+            double const ns_per_byte =
+                static_cast<double>(timer.elapsed_nanoseconds()) / bytes;
+
+            std::lock_guard<hpx::spinlock> l(statistics_->mtx_);
+            if (statistics_->samples_++ == 0)
+            {
+                statistics_->ratio_ = ratio;
+                statistics_->ns_per_byte_ = ns_per_byte;
+            }
+            else
+            {
+                statistics_->ratio_ += detail::sample_weight *
+                    (ratio - statistics_->ratio_);
+                statistics_->ns_per_byte_ += detail::sample_weight *
+                    (ns_per_byte - statistics_->ns_per_byte_);
+            }
+        }
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,91 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/zstd_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // Zstandard compresses considerably better than LZ4 and snappy at a
+    // moderate cost, which makes it a good fit for links with limited
+    // bandwidth. The compression level is taken from the configuration
+    // setting hpx.plugins.zstd_serialization_filter.level (default: 3).
+    //
+    // Small parcels compress much better if a dictionary trained on typical
+    // messages is used. The dictionary is loaded from the file given by the
+    // configuration setting hpx.plugins.zstd_serialization_filter.dictionary
+    // and has to be the same on all localities. The id of the dictionary is
+    // sent with every message and is verified by the receiving end.
+    struct HPX_LIBRARY_EXPORT zstd_serialization_filter
+      : public serialization::binary_filter
+    {
+        explicit zstd_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr);
+        ~zstd_serialization_filter() override;
+
+        zstd_serialization_filter(zstd_serialization_filter const&) = delete;
+        zstd_serialization_filter& operator=(
+            zstd_serialization_filter const&) = delete;
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+        // Train a dictionary of at most max_size bytes from the given sample
+        // messages (e.g. serialized parcels recorded from a typical run). The
+        // result can be stored in a file and used by setting
+        // hpx.plugins.zstd_serialization_filter.dictionary.
+        static std::vector<char> train_dictionary(
+            std::vector<std::vector<char>> const& samples,
+            std::size_t max_size = 112640);
+
+        // Write a dictionary created by train_dictionary to the given file.
+        static void save_dictionary(
+            std::string const& filename, std::vector<char> const& dictionary);
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+            // clang-format off
+            ar & dictionary_id_;
+            // clang-format on
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(zstd_serialization_filter, override);
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+        void* context_;
+        std::uint32_t dictionary_id_;
+        bool compress_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
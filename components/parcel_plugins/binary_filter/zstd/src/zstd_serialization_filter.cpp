@@ -0,0 +1,352 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <zdict.h>
+#include <zstd.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      level = 3
+    //      dictionary =
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "level = 3\n"
+                   "dictionary = ";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        int get_compression_level()
+        {
+            int const level = hpx::util::from_string<int>(
+                hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level",
+                    std::size_t(ZSTD_CLEVEL_DEFAULT)),
+                ZSTD_CLEVEL_DEFAULT);
+            return (std::min)(level, ZSTD_maxCLevel());
+        }
+
+        // The (optional) dictionary is loaded once and shared by all filter
+        // instances, the digested forms are immutable and can be used
+        // concurrently.
+        struct zstd_dictionary
+        {
+            zstd_dictionary()
+              : cdict_(nullptr)
+              , ddict_(nullptr)
+              , id_(0)
+            {
+                std::string const filename = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (filename.empty())
+                {
+                    return;
+                }
+
+                std::ifstream in(filename, std::ios::binary);
+                std::vector<char> const data(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+                if (!in && !in.eof())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                        "zstd_dictionary::zstd_dictionary",
+                        "could not read zstd dictionary from file: {}",
+                        filename);
+                }
+
+                id_ = ZDICT_getDictID(data.data(), data.size());
+                cdict_ = ZSTD_createCDict(
+                    data.data(), data.size(), get_compression_level());
+                ddict_ = ZSTD_createDDict(data.data(), data.size());
+                if (id_ == 0 || cdict_ == nullptr || ddict_ == nullptr)
+                {
+                    cleanup();
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_dictionary::zstd_dictionary",
+                        "file {} does not contain a valid zstd dictionary",
+                        filename);
+                }
+            }
+
+            ~zstd_dictionary()
+            {
+                cleanup();
+            }
+
+            zstd_dictionary(zstd_dictionary const&) = delete;
+            zstd_dictionary& operator=(zstd_dictionary const&) = delete;
+
+            void cleanup() noexcept
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+                cdict_ = nullptr;
+                ddict_ = nullptr;
+            }
+
+            ZSTD_CDict* cdict_;
+            ZSTD_DDict* ddict_;
+            std::uint32_t id_;
+        };
+
+        zstd_dictionary const& get_dictionary()
+        {
+            static zstd_dictionary const dictionary;
+            return dictionary;
+        }
+
+        [[noreturn]] void throw_zstd_error(
+            char const* function, std::size_t result)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error, function,
+                "zstd error: {}", ZSTD_getErrorName(result));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    zstd_serialization_filter::zstd_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , context_(nullptr)
+      , dictionary_id_(compress ? detail::get_dictionary().id_ : 0)
+      , compress_(compress)
+    {
+        if (compress_)
+        {
+            ZSTD_CCtx* ctx = ZSTD_createCCtx();
+            if (ctx != nullptr && dictionary_id_ == 0)
+            {
+                ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel,
+                    detail::get_compression_level());
+            }
+            context_ = ctx;
+        }
+        else
+        {
+            context_ = ZSTD_createDCtx();
+        }
+
+        if (context_ == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                "zstd_serialization_filter::zstd_serialization_filter",
+                "could not create zstd context");
+        }
+    }
+
+    zstd_serialization_filter::~zstd_serialization_filter()
+    {
+        if (compress_)
+        {
+            ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(context_));
+        }
+        else
+        {
+            ZSTD_freeDCtx(static_cast<ZSTD_DCtx*>(context_));
+        }
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        HPX_ASSERT(!compress_);
+
+        auto* ctx = static_cast<ZSTD_DCtx*>(context_);
+        buffer_.resize(buffer_size);
+
+        std::size_t result = 0;
+        if (dictionary_id_ != 0)
+        {
+            detail::zstd_dictionary const& dictionary =
+                detail::get_dictionary();
+            if (dictionary.id_ != dictionary_id_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "zstd_serialization_filter::init_data",
+                    "the data was compressed using a different zstd "
+                    "dictionary (id: {}) than the one loaded by this "
+                    "locality (id: {})",
+                    dictionary_id_, dictionary.id_);
+            }
+
+            result = ZSTD_decompress_usingDDict(ctx, buffer_.data(),
+                buffer_size, buffer, size, dictionary.ddict_);
+        }
+        else
+        {
+            result = ZSTD_decompressDCtx(
+                ctx, buffer_.data(), buffer_size, buffer, size);
+        }
+
+        if (ZSTD_isError(result))
+        {
+            detail::throw_zstd_error(
+                "zstd_serialization_filter::init_data", result);
+        }
+
+        buffer_.resize(result);
+        current_ = 0;
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        HPX_ASSERT(compress_);
+
+        // make sure we have enough memory
+        std::size_t const needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        auto* ctx = static_cast<ZSTD_CCtx*>(context_);
+        std::size_t result = 0;
+        if (dictionary_id_ != 0)
+        {
+            result = ZSTD_compress_usingCDict(ctx, dst, dst_count,
+                buffer_.data(), buffer_.size(),
+                detail::get_dictionary().cdict_);
+        }
+        else
+        {
+            result = ZSTD_compress2(
+                ctx, dst, dst_count, buffer_.data(), buffer_.size());
+        }
+
+        if (ZSTD_isError(result))
+        {
+            detail::throw_zstd_error(
+                "zstd_serialization_filter::flush", result);
+        }
+
+        written = result;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<char> zstd_serialization_filter::train_dictionary(
+        std::vector<std::vector<char>> const& samples, std::size_t max_size)
+    {
+        std::vector<char> data;
+        std::vector<std::size_t> sizes;
+        sizes.reserve(samples.size());
+        for (auto const& sample : samples)
+        {
+            data.insert(data.end(), sample.begin(), sample.end());
+            sizes.push_back(sample.size());
+        }
+
+        std::vector<char> dictionary(max_size);
+        std::size_t const result = ZDICT_trainFromBuffer(dictionary.data(),
+            dictionary.size(), data.data(), sizes.data(),
+            static_cast<unsigned>(sizes.size()));
+        if (ZDICT_isError(result))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "zstd_serialization_filter::train_dictionary",
+                "could not train zstd dictionary: {} (too few samples?)",
+                ZDICT_getErrorName(result));
+        }
+
+        dictionary.resize(result);
+        return dictionary;
+    }
+
+    void zstd_serialization_filter::save_dictionary(
+        std::string const& filename, std::vector<char> const& dictionary)
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out.write(
+            dictionary.data(), static_cast<std::streamsize>(dictionary.size()));
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "zstd_serialization_filter::save_dictionary",
+                "could not write zstd dictionary to file: {}", filename);
+        }
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
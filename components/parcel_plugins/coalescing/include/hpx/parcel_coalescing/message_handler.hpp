@@ -75,6 +75,8 @@ namespace hpx::plugins::parcel {
         void update_num_messages();
         void update_interval();
 
+        void adapt(std::int64_t time_since_last_parcel);
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
@@ -86,6 +88,14 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing: the number of coalesced parcels and the flush
+        // interval are derived from the observed time between parcels such
+        // that no parcel is delayed by more than the latency budget
+        bool adaptive_;
+        std::size_t max_coalesced_parcels_;
+        std::int64_t latency_budget_;
+        std::int64_t average_time_between_parcels_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +52,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100";
         }
     };
 }    // namespace hpx::traits
@@ -84,13 +89,28 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::int64_t get_latency_budget()
+        {
+            return hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                "100"));
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        num_coalesced_parcels_ = max_coalesced_parcels_;
     }
 
     void coalescing_message_handler::update_interval()
@@ -112,6 +132,11 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , latency_budget_((std::max)(detail::get_latency_budget(),
+            static_cast<std::int64_t>(1)))
+      , average_time_between_parcels_(latency_budget_ * 1000)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -165,13 +190,18 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+            adapt(time_since_last_parcel);
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or if parcels arrive too sparsely to be coalesced at all).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    num_coalesced_parcels_ <= 1)))
         {
             ++num_messages_;
             l.unlock();
@@ -189,6 +219,17 @@ namespace hpx::plugins::parcel {
         case detail::message_buffer::first_message:
             [[fallthrough]];
         case detail::message_buffer::normal:
+            // the number of parcels to coalesce may have been reduced since
+            // the buffer was created
+            if (buffer_.size() >= num_coalesced_parcels_)
+            {
+                flush_locked(l,
+                    parcelset::policies::message_handler::
+                        flush_mode_buffer_full,
+                    false, true);
+                break;
+            }
+
             // start deadline timer to flush buffer
             l.unlock();
             timer_.start(interval);
@@ -209,6 +250,39 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    void coalescing_message_handler::adapt(std::int64_t time_since_last_parcel)
+    {
+        std::int64_t const budget = latency_budget_ * 1000;    // [ns]
+
+        // exponentially weighted moving average of the time between parcels,
+        // long pauses are capped to recover quickly once traffic picks up
+        average_time_between_parcels_ +=
+            ((std::min)(time_since_last_parcel, 2 * budget) -
+                average_time_between_parcels_) /
+            8;
+        std::int64_t const average =
+            (std::max)(average_time_between_parcels_, std::int64_t(1));
+
+        // coalesce as many parcels as are expected to arrive within the
+        // latency budget, flush no later than when those should have arrived
+        std::size_t const num = (std::min)(max_coalesced_parcels_,
+            static_cast<std::size_t>((std::max)(budget / average,
+                std::int64_t(1))));
+
+        num_coalesced_parcels_ = num;
+        interval_ = static_cast<std::size_t>((std::max)(
+            (std::min)(budget, static_cast<std::int64_t>(num) * average) /
+                1000,
+            std::int64_t(1)));
+
+        // a pending buffer keeps its capacity, parcels beyond the new limit
+        // cause it to be flushed
+        if (buffer_.empty() && buffer_.capacity() != num)
+        {
+            buffer_ = detail::message_buffer(num);
+        }
+    }
+
     bool coalescing_message_handler::timer_flush()
     {
         // adjust timer if needed
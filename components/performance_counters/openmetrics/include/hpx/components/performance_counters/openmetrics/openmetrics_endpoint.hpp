@@ -0,0 +1,48 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx::performance_counters::openmetrics {
+
+    // Render the given counter values using the OpenMetrics text exposition
+    // format. Every counter is exposed as a metric named after its object
+    // and counter names (prefixed with 'hpx_'), the instance and the
+    // parameters of the counter are turned into labels. Monotonically
+    // increasing counters are exposed as counters, all other counters
+    // holding a single numeric value as gauges. Counters of other types and
+    // invalid values are skipped.
+    HPX_COMPONENT_EXPORT std::string format_metrics(
+        std::vector<counter_info> const& infos,
+        std::vector<counter_value> const& values);
+
+    // Return the port the endpoint of this locality is listening on, zero
+    // if the endpoint is not running
+    HPX_COMPONENT_EXPORT std::uint16_t get_endpoint_port();
+
+    // Return the metrics currently served by the endpoint of this locality,
+    // the values are taken from the most recent snapshot of the sampled
+    // counters, no counters are evaluated
+    HPX_COMPONENT_EXPORT std::string get_endpoint_metrics();
+
+    namespace detail {
+
+        // Start the endpoint if any counters were selected using
+        // hpx.openmetrics.counters, called during runtime startup
+        void start_endpoint();
+
+        // Stop the endpoint and release the sampled counters, called during
+        // runtime shutdown
+        void stop_endpoint();
+    }    // namespace detail
+}    // namespace hpx::performance_counters::openmetrics
@@ -0,0 +1,51 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/runtime_local/startup_function.hpp>
+
+#include <hpx/components/performance_counters/openmetrics/openmetrics_endpoint.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Add factory registration functionality, We register the module dynamically
+// as no executable links against it.
+HPX_REGISTER_COMPONENT_MODULE_DYNAMIC()
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::openmetrics {
+
+    bool get_startup(
+        hpx::startup_function_type& startup_func, bool& pre_startup)
+    {
+        // the counters are available only after all counter types have been
+        // registered during pre-startup
+        startup_func = detail::start_endpoint;
+        pre_startup = false;
+        return true;
+    }
+
+    bool get_shutdown(
+        hpx::shutdown_function_type& shutdown_func, bool& pre_shutdown)
+    {
+        // stop sampling while the counters are still alive
+        shutdown_func = detail::stop_endpoint;
+        pre_shutdown = true;
+        return true;
+    }
+}    // namespace hpx::performance_counters::openmetrics
+
+///////////////////////////////////////////////////////////////////////////////
+// Register the startup function starting the endpoint (if configured) and the
+// shutdown function stopping it.
+//
+// Note that this macro can be used not more than once in one module.
+HPX_REGISTER_STARTUP_SHUTDOWN_MODULE_DYNAMIC(
+    hpx::performance_counters::openmetrics::get_startup,
+    hpx::performance_counters::openmetrics::get_shutdown)
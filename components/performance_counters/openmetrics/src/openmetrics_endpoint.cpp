@@ -0,0 +1,643 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/io_service/io_service_pool.hpp>
+#include <hpx/modules/asio.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/performance_counters/counter_sampler.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/string_util/classification.hpp>
+#include <hpx/string_util/split.hpp>
+#include <hpx/string_util/trim.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <hpx/components/performance_counters/openmetrics/openmetrics_endpoint.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
+#include <asio/read_until.hpp>
+#include <asio/streambuf.hpp>
+#include <asio/write.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::performance_counters::openmetrics {
+
+    namespace {
+
+        // Replace all characters which are not allowed in metric names
+        std::string sanitize_name(std::string const& name)
+        {
+            std::string result;
+            result.reserve(name.size());
+            for (char const c : name)
+            {
+                bool const valid = (c >= 'a' && c <= 'z') ||
+                    (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                    c == '_';
+                result.push_back(valid ? c : '_');
+            }
+            return result;
+        }
+
+        // Label values and help texts use the same escaping rules
+        void append_escaped(std::string& out, std::string const& value)
+        {
+            for (char const c : value)
+            {
+                switch (c)
+                {
+                case '\\':
+                    out += "\\\\";
+                    break;
+
+                case '"':
+                    out += "\\\"";
+                    break;
+
+                case '\n':
+                    out += "\\n";
+                    break;
+
+                default:
+                    out.push_back(c);
+                    break;
+                }
+            }
+        }
+
+        void append_value(std::string& out, counter_value const& value)
+        {
+            if (value.scaling_ == 1)
+            {
+                out += std::to_string(value.value_);
+                return;
+            }
+
+            std::ostringstream strm;
+            strm.precision(std::numeric_limits<double>::max_digits10);
+            strm << value.get_value<double>();
+            out += strm.str();
+        }
+
+        std::string get_instance_name(counter_path_elements const& path)
+        {
+            std::string instance = path.instancename_;
+            if (path.instanceindex_ >= 0)
+            {
+                instance += '#' + std::to_string(path.instanceindex_);
+            }
+            if (!path.subinstancename_.empty())
+            {
+                instance += '/' + path.subinstancename_;
+                if (path.subinstanceindex_ >= 0)
+                {
+                    instance += '#' + std::to_string(path.subinstanceindex_);
+                }
+            }
+            return instance;
+        }
+
+        // Return the metric type exposing the given counter type, nullptr if
+        // counters of this type can't be exposed
+        char const* get_metric_type(counter_type type) noexcept
+        {
+            switch (type)
+            {
+            case counter_type::monotonically_increasing:
+                return "counter";
+
+            case counter_type::raw:
+                [[fallthrough]];
+            case counter_type::average_base:
+                [[fallthrough]];
+            case counter_type::average_count:
+                [[fallthrough]];
+            case counter_type::aggregating:
+                [[fallthrough]];
+            case counter_type::average_timer:
+                [[fallthrough]];
+            case counter_type::elapsed_time:
+                return "gauge";
+
+            default:
+                return nullptr;
+            }
+        }
+
+        struct metric_family
+        {
+            char const* type = nullptr;
+            std::string help;
+            std::string samples;
+        };
+    }    // namespace
+
+    std::string format_metrics(std::vector<counter_info> const& infos,
+        std::vector<counter_value> const& values)
+    {
+        HPX_ASSERT(infos.size() == values.size());
+
+        // all samples of a metric family have to be written together
+        std::map<std::string, metric_family> families;
+        for (std::size_t i = 0; i != infos.size(); ++i)
+        {
+            counter_info const& info = infos[i];
+            char const* type = get_metric_type(info.type_);
+            if (type == nullptr || !status_is_valid(values[i].status_))
+            {
+                continue;
+            }
+
+            counter_path_elements path;
+            error_code ec(throwmode::lightweight);
+            if (get_counter_path_elements(info.fullname_, path, ec) !=
+                    counter_status::valid_data ||
+                ec)
+            {
+                continue;
+            }
+
+            std::string name = "hpx_" +
+                sanitize_name(path.objectname_ + '_' + path.countername_);
+
+            metric_family& family = families[name];
+            if (family.type == nullptr)
+            {
+                family.type = type;
+                family.help = info.helptext_;
+            }
+            else if (std::strcmp(family.type, type) != 0)
+            {
+                // the samples of a metric family have to be of the same type
+                continue;
+            }
+
+            std::vector<std::pair<char const*, std::string>> labels;
+            if (path.parentinstancename_ == "locality" &&
+                path.parentinstanceindex_ >= 0)
+            {
+                labels.emplace_back(
+                    "locality", std::to_string(path.parentinstanceindex_));
+            }
+            std::string instance = get_instance_name(path);
+            if (!instance.empty())
+            {
+                labels.emplace_back("instance", HPX_MOVE(instance));
+            }
+            if (!path.parameters_.empty())
+            {
+                labels.emplace_back("parameters", path.parameters_);
+            }
+
+            std::string& samples = family.samples;
+            samples += name;
+            if (info.type_ == counter_type::monotonically_increasing)
+            {
+                samples += "_total";
+            }
+            if (!labels.empty())
+            {
+                char delimiter = '{';
+                for (auto const& label : labels)
+                {
+                    samples += delimiter;
+                    samples += label.first;
+                    samples += "=\"";
+                    append_escaped(samples, label.second);
+                    samples += '"';
+                    delimiter = ',';
+                }
+                samples += '}';
+            }
+            samples += ' ';
+            append_value(samples, values[i]);
+            samples += '\n';
+        }
+
+        std::string result;
+        for (auto const& family : families)
+        {
+            result += "# TYPE ";
+            result += family.first;
+            result += ' ';
+            result += family.second.type;
+            result += '\n';
+            if (!family.second.help.empty())
+            {
+                result += "# HELP ";
+                result += family.first;
+                result += ' ';
+                append_escaped(result, family.second.help);
+                result += '\n';
+            }
+            result += family.second.samples;
+        }
+        result += "# EOF\n";
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // larger requests are rejected by closing the connection
+        constexpr std::size_t max_request_size = 8192;
+
+        // the number of buffered snapshots, only the most recent one is used
+        constexpr std::size_t sampler_capacity = 16;
+
+        std::string make_response(char const* status,
+            std::string const& content_type, std::string const& body)
+        {
+            std::string response = "HTTP/1.1 ";
+            response += status;
+            response += "\r\nContent-Type: ";
+            response += content_type;
+            response += "\r\nContent-Length: ";
+            response += std::to_string(body.size());
+            response += "\r\nConnection: close\r\n\r\n";
+            response += body;
+            return response;
+        }
+
+        class endpoint;
+
+        // A connection serving a single request
+        class session : public std::enable_shared_from_this<session>
+        {
+        public:
+            session(asio::io_context& io_service, std::shared_ptr<endpoint> ep)
+              : socket_(io_service)
+              , request_(max_request_size)
+              , endpoint_(HPX_MOVE(ep))
+            {
+            }
+
+            asio::ip::tcp::socket& socket() noexcept
+            {
+                return socket_;
+            }
+
+            void start()
+            {
+                asio::async_read_until(socket_, request_, "\r\n\r\n",
+                    [self = shared_from_this()](
+                        std::error_code const& ec, std::size_t) {
+                        self->handle_read(ec);
+                    });
+            }
+
+        private:
+            void handle_read(std::error_code const& ec);
+
+            asio::ip::tcp::socket socket_;
+            asio::streambuf request_;
+            std::string response_;
+            std::shared_ptr<endpoint> endpoint_;
+        };
+
+        // The endpoint samples the selected counters periodically (on the
+        // HPX worker threads) and serves the most recent values from the
+        // threads of the io_service pool
+        class endpoint : public std::enable_shared_from_this<endpoint>
+        {
+        public:
+            endpoint(std::vector<std::string> const& names,
+                std::int64_t interval, asio::io_context& io_service)
+              : sampler_(std::make_unique<counter_sampler>(
+                    names, interval, sampler_capacity))
+              , infos_(sampler_->get_counter_infos())
+              , values_(sampler_->get_counter_scaling())
+              , io_service_(io_service)
+              , acceptor_(io_service)
+              , port_(0)
+            {
+            }
+
+            void start(std::string const& address, std::uint16_t port)
+            {
+                using asio::ip::tcp;
+
+                std::error_code ec;
+                util::endpoint_iterator_type const end = util::accept_end();
+                for (util::endpoint_iterator_type it =
+                         util::accept_begin(address, port, io_service_);
+                     it != end; ++it)
+                {
+                    tcp::endpoint const ep = *it;
+
+                    ec.clear();
+                    acceptor_.open(ep.protocol(), ec);
+                    if (!ec)
+                    {
+                        acceptor_.set_option(
+                            tcp::acceptor::reuse_address(true), ec);
+                    }
+                    if (!ec)
+                    {
+                        acceptor_.bind(ep, ec);
+                    }
+                    if (!ec)
+                    {
+                        acceptor_.listen(
+                            asio::socket_base::max_listen_connections, ec);
+                    }
+                    if (!ec)
+                    {
+                        break;
+                    }
+
+                    std::error_code ignored;
+                    acceptor_.close(ignored);
+                }
+
+                if (ec || !acceptor_.is_open())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::network_error,
+                        "openmetrics::endpoint::start",
+                        "unable to listen on {}:{}: {}", address, port,
+                        ec.message());
+                }
+                port_.store(acceptor_.local_endpoint().port(),
+                    std::memory_order_release);
+
+                // make sure the first scrape has recent values
+                sampler_->start();
+                sampler_->sample();
+
+                accept();
+            }
+
+            void stop()
+            {
+                port_.store(0, std::memory_order_release);
+
+                std::unique_ptr<counter_sampler> sampler;
+                {
+                    std::lock_guard<hpx::spinlock> l(mtx_);
+                    sampler = HPX_MOVE(sampler_);
+                }
+
+                // the acceptor is accessed from the io_service pool only
+                asio::post(io_service_, [self = shared_from_this()]() {
+                    std::error_code ignored;
+                    self->acceptor_.close(ignored);
+                });
+
+                if (sampler)
+                {
+                    sampler->stop();
+                }
+            }
+
+            std::uint16_t port() const noexcept
+            {
+                return port_.load(std::memory_order_acquire);
+            }
+
+            // Return the metrics for the most recent snapshot, the text is
+            // regenerated only if a new snapshot was taken
+            std::string get_metrics()
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+
+                bool updated = metrics_.empty();
+                if (sampler_)
+                {
+                    snapshots_.clear();
+                    std::size_t const count = sampler_->drain(snapshots_);
+                    if (count != 0)
+                    {
+                        // skip the time stamp of the snapshot
+                        std::size_t const size = sampler_->snapshot_size();
+                        std::int64_t const* snapshot =
+                            snapshots_.data() + (count - 1) * size + 1;
+                        for (std::size_t i = 0; i != values_.size(); ++i)
+                        {
+                            values_[i].value_ = snapshot[i];
+                        }
+                        updated = true;
+                    }
+                }
+
+                if (updated)
+                {
+                    metrics_ = format_metrics(infos_, values_);
+                }
+                return metrics_;
+            }
+
+        private:
+            void accept()
+            {
+                auto conn =
+                    std::make_shared<session>(io_service_, shared_from_this());
+                acceptor_.async_accept(conn->socket(),
+                    [self = shared_from_this(), conn](
+                        std::error_code const& ec) {
+                        if (ec == asio::error::operation_aborted ||
+                            !self->acceptor_.is_open())
+                        {
+                            return;
+                        }
+                        if (!ec)
+                        {
+                            conn->start();
+                        }
+                        self->accept();
+                    });
+            }
+
+            hpx::spinlock mtx_;
+            std::unique_ptr<counter_sampler> sampler_;
+            std::vector<counter_info> infos_;
+            std::vector<counter_value> values_;
+            std::vector<std::int64_t> snapshots_;
+            std::string metrics_;
+
+            asio::io_context& io_service_;
+            asio::ip::tcp::acceptor acceptor_;
+            std::atomic<std::uint16_t> port_;
+        };
+
+        void session::handle_read(std::error_code const& ec)
+        {
+            // the connection is closed once the session is released
+            if (ec)
+            {
+                return;
+            }
+
+            std::istream is(&request_);
+            std::string method, target;
+            is >> method >> target;
+            target = target.substr(0, target.find('?'));
+
+            if (method != "GET")
+            {
+                response_ = make_response("405 Method Not Allowed",
+                    "text/plain; charset=utf-8", "only GET is supported\n");
+            }
+            else if (target != "/metrics")
+            {
+                response_ = make_response(
+                    "404 Not Found", "text/plain; charset=utf-8", "");
+            }
+            else
+            {
+                response_ = make_response("200 OK",
+                    "application/openmetrics-text; version=1.0.0; "
+                    "charset=utf-8",
+                    endpoint_->get_metrics());
+            }
+
+            asio::async_write(socket_, asio::buffer(response_),
+                [self = shared_from_this()](
+                    std::error_code const&, std::size_t) {
+                    std::error_code ignored;
+                    self->socket_.shutdown(
+                        asio::ip::tcp::socket::shutdown_both, ignored);
+                });
+        }
+
+        // the endpoint of this locality
+        hpx::spinlock endpoint_mtx;
+        std::shared_ptr<endpoint> endpoint_instance;
+
+        std::shared_ptr<endpoint> get_endpoint()
+        {
+            std::lock_guard<hpx::spinlock> l(endpoint_mtx);
+            return endpoint_instance;
+        }
+
+        // The wildcard locality#* selects the counters of this locality, as
+        // remote counters can't be sampled
+        std::vector<std::string> get_counter_names(
+            std::string const& counters, std::uint32_t locality_id)
+        {
+            std::vector<std::string> entries;
+            hpx::string_util::split(entries, counters,
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::on);
+
+            std::string const wildcard = "{locality#*";
+            std::string const here = "{locality#" + std::to_string(locality_id);
+
+            std::vector<std::string> names;
+            names.reserve(entries.size());
+            for (std::string& name : entries)
+            {
+                hpx::string_util::trim(name);
+                if (name.empty())
+                {
+                    continue;
+                }
+
+                std::string::size_type pos = name.find(wildcard);
+                while (pos != std::string::npos)
+                {
+                    name.replace(pos, wildcard.size(), here);
+                    pos = name.find(wildcard, pos + here.size());
+                }
+                names.push_back(HPX_MOVE(name));
+            }
+            return names;
+        }
+    }    // namespace
+
+    std::uint16_t get_endpoint_port()
+    {
+        std::shared_ptr<endpoint> const ep = get_endpoint();
+        return ep ? ep->port() : 0;
+    }
+
+    std::string get_endpoint_metrics()
+    {
+        std::shared_ptr<endpoint> const ep = get_endpoint();
+        return ep ? ep->get_metrics() : std::string();
+    }
+
+    namespace detail {
+
+        void start_endpoint()
+        {
+            util::runtime_configuration const& cfg = hpx::get_config();
+
+            std::uint32_t const locality_id = hpx::get_locality_id();
+            std::vector<std::string> const names = get_counter_names(
+                cfg.get_entry("hpx.openmetrics.counters", ""), locality_id);
+            if (names.empty())
+            {
+                return;    // the endpoint is disabled
+            }
+
+            std::string const address =
+                cfg.get_entry("hpx.openmetrics.address", "127.0.0.1");
+
+            // every locality listens on its own port, zero selects any free
+            // port
+            auto port = util::get_entry_as<std::uint16_t>(
+                cfg, "hpx.openmetrics.port", 9464);
+            if (port != 0)
+            {
+                port = static_cast<std::uint16_t>(port + locality_id);
+            }
+
+            // the sampling interval is given in milliseconds
+            auto const interval = util::get_entry_as<std::int64_t>(
+                cfg, "hpx.openmetrics.interval", 1000);
+
+            hpx::util::io_service_pool* pool = hpx::get_thread_pool("io-pool");
+            if (pool == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "openmetrics::start_endpoint",
+                    "the io_service pool is not available");
+            }
+
+            auto ep = std::make_shared<endpoint>(
+                names, interval * 1000, pool->get_io_service());
+            ep->start(address, port);
+
+            std::lock_guard<hpx::spinlock> l(endpoint_mtx);
+            endpoint_instance = HPX_MOVE(ep);
+        }
+
+        void stop_endpoint()
+        {
+            std::shared_ptr<endpoint> ep;
+            {
+                std::lock_guard<hpx::spinlock> l(endpoint_mtx);
+                ep = HPX_MOVE(endpoint_instance);
+            }
+
+            if (ep)
+            {
+                ep->stop();
+            }
+        }
+    }    // namespace detail
+}    // namespace hpx::performance_counters::openmetrics
@@ -0,0 +1,148 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_OPENMETRICS_ENDPOINT) && !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <hpx/components/performance_counters/openmetrics/openmetrics_endpoint.hpp>
+
+#include <asio/connect.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read.hpp>
+#include <asio/write.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace openmetrics = hpx::performance_counters::openmetrics;
+using hpx::performance_counters::counter_info;
+using hpx::performance_counters::counter_type;
+using hpx::performance_counters::counter_value;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_format()
+{
+    std::vector<counter_info> infos(4);
+    infos[0].fullname_ = "/threads{locality#0/total}/count/cumulative";
+    infos[0].type_ = counter_type::monotonically_increasing;
+    infos[0].helptext_ = "returns the \"overall\" number\nof threads";
+    infos[1].fullname_ = "/threads{locality#0/worker-thread#1}/idle-rate";
+    infos[1].type_ = counter_type::raw;
+    infos[2].fullname_ = "/threads{locality#0/worker-thread#0}/idle-rate";
+    infos[2].type_ = counter_type::raw;
+    infos[3].fullname_ = "/runtime{locality#0/total}/component/count";
+    infos[3].type_ = counter_type::text;
+
+    std::vector<counter_value> values = {
+        counter_value(42), counter_value(2500, 100, true),
+        counter_value(7, 100, true), counter_value(1)};
+
+    std::string const expected =
+        "# TYPE hpx_threads_count_cumulative counter\n"
+        "# HELP hpx_threads_count_cumulative returns the \\\"overall\\\" "
+        "number\\nof threads\n"
+        "hpx_threads_count_cumulative_total{locality=\"0\",instance="
+        "\"total\"} 42\n"
+        "# TYPE hpx_threads_idle_rate gauge\n"
+        "hpx_threads_idle_rate{locality=\"0\",instance=\"worker-thread#1\"} "
+        "25\n"
+        "hpx_threads_idle_rate{locality=\"0\",instance=\"worker-thread#0\"} "
+        "0.070000000000000007\n"
+        "# EOF\n";
+    HPX_TEST_EQ(openmetrics::format_metrics(infos, values), expected);
+
+    // invalid values are skipped
+    values[0].status_ =
+        hpx::performance_counters::counter_status::invalid_data;
+    HPX_TEST_EQ(
+        openmetrics::format_metrics(infos, values).find("cumulative_total"),
+        std::string::npos);
+}
+
+std::string scrape(std::uint16_t port, std::string const& target)
+{
+    asio::io_context io_service;
+    asio::ip::tcp::socket socket(io_service);
+    socket.connect(asio::ip::tcp::endpoint(
+        asio::ip::make_address("127.0.0.1"), port));
+
+    std::string const request =
+        "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    asio::write(socket, asio::buffer(request));
+
+    // the endpoint closes the connection after sending the response
+    std::string response;
+    std::error_code ec;
+    asio::read(socket, asio::dynamic_buffer(response), ec);
+    HPX_TEST(ec == asio::error::eof);
+    return response;
+}
+
+void test_endpoint()
+{
+    std::uint16_t const port = openmetrics::get_endpoint_port();
+    HPX_TEST_NEQ(port, std::uint16_t(0));
+
+    // the values are sampled periodically
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::string const metrics = openmetrics::get_endpoint_metrics();
+    HPX_TEST_NEQ(
+        metrics.find("hpx_runtime_uptime{locality=\"0\",instance=\"total\"}"),
+        std::string::npos);
+    HPX_TEST_NEQ(metrics.find("# EOF\n"), std::string::npos);
+
+    std::string response = scrape(port, "/metrics");
+    HPX_TEST_EQ(response.find("HTTP/1.1 200 OK\r\n"), std::size_t(0));
+    HPX_TEST_NEQ(
+        response.find("Content-Type: application/openmetrics-text"),
+        std::string::npos);
+    HPX_TEST_NEQ(response.find("hpx_threads_count_cumulative_total"),
+        std::string::npos);
+    HPX_TEST_EQ(response.rfind("# EOF\n"), response.size() - 6);
+
+    response = scrape(port, "/unknown");
+    HPX_TEST_EQ(response.find("HTTP/1.1 404 Not Found\r\n"), std::size_t(0));
+}
+
+int hpx_main()
+{
+    test_format();
+    test_endpoint();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // select the counters and let the endpoint pick a free port
+    hpx::init_params init_args;
+    init_args.cfg = {
+        "hpx.openmetrics.counters=/runtime{locality#*/total}/uptime,"
+        "/threads{locality#*/total}/count/cumulative",
+        "hpx.openmetrics.port=0", "hpx.openmetrics.interval=10"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,52 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PAPI) && defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace performance_counters { namespace papi {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Per-task attribution of PAPI events: every worker thread counts the
+    // given events in its own event set, the counts are read around every
+    // sampling_rate'th execution phase of the HPX threads it runs and are
+    // accumulated for the annotation of the executed thread.
+    void start_task_counters(
+        std::vector<std::string> const& events, std::size_t sampling_rate);
+    void stop_task_counters();
+
+    // Return the sum of the counts of the given event over all sampled
+    // execution phases of HPX threads with the given annotation
+    std::int64_t get_task_event_count(
+        std::string const& annotation, std::size_t event, bool reset);
+
+    // Return the number of sampled execution phases of HPX threads with the
+    // given annotation
+    std::int64_t get_task_samples(std::string const& annotation, bool reset);
+
+    // counter creation functions
+    // /papi-task{locality#%d/total}/count@<annotation>,<event>
+    naming::gid_type create_task_count_counter(
+        counter_info const& info, error_code& ec);
+
+    // /papi-task{locality#%d/total}/samples@<annotation>
+    naming::gid_type create_task_samples_counter(
+        counter_info const& info, error_code& ec);
+}}}    // namespace hpx::performance_counters::papi
+
+#endif
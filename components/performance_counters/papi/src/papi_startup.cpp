@@ -10,6 +10,7 @@
 #if defined(HPX_HAVE_PAPI)
 
 #include <hpx/components/performance_counters/papi/server/papi.hpp>
+#include <hpx/components/performance_counters/papi/task_counters.hpp>
 #include <hpx/components/performance_counters/papi/util/papi.hpp>
 #include <hpx/components_base/component_commandline.hpp>
 #include <hpx/components_base/component_startup_shutdown.hpp>
@@ -21,16 +22,22 @@
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/runtime_local/thread_mapper.hpp>
+#include <hpx/string_util/classification.hpp>
+#include <hpx/string_util/split.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Add factory registration functionality
@@ -307,8 +314,46 @@ namespace hpx { namespace performance_counters { namespace papi {
             std::string v = vm["hpx:papi-event-info"].as<std::string>();
             util::list_events(v);
         }
+
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+        if (vm.count("hpx:papi-task-events"))
+        {
+            generic_counter_type_data const task_cnt_types[] = {
+                {"/papi-task/count", counter_type::monotonically_increasing,
+                    "returns the overall count of the given PAPI event in the "
+                    "sampled execution phases of the HPX threads with the "
+                    "given annotation (parameters: "
+                    "<annotation>,<PAPI event>)",
+                    HPX_PERFORMANCE_COUNTER_V1, &create_task_count_counter,
+                    &locality_counter_discoverer, ""},
+                {"/papi-task/samples", counter_type::monotonically_increasing,
+                    "returns the number of sampled execution phases of the "
+                    "HPX threads with the given annotation (parameter: "
+                    "<annotation>)",
+                    HPX_PERFORMANCE_COUNTER_V1, &create_task_samples_counter,
+                    &locality_counter_discoverer, ""}};
+            install_counter_types(task_cnt_types,
+                sizeof(task_cnt_types) / sizeof(task_cnt_types[0]));
+
+            std::vector<std::string> events;
+            hpx::string_util::split(events,
+                vm["hpx:papi-task-events"].as<std::string>(),
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::on);
+            start_task_counters(
+                events, vm["hpx:papi-task-sampling"].as<std::size_t>());
+        }
+#endif
     }
 
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+    // shutdown function for PAPI counter component
+    void shutdown()
+    {
+        stop_task_counters();
+    }
+#endif
+
     bool check_startup(
         hpx::startup_function_type& startup_func, bool& pre_startup)
     {
@@ -335,12 +380,30 @@ namespace hpx { namespace performance_counters { namespace papi {
         return false;
     }
 
+    bool check_shutdown(
+        hpx::shutdown_function_type& shutdown_func, bool& pre_shutdown)
+    {
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+        // stop attributing events to tasks before any threads go away
+        if (util::get_options().count("hpx:papi-task-events"))
+        {
+            shutdown_func = shutdown;
+            pre_shutdown = true;
+            return true;
+        }
+#else
+        HPX_UNUSED(shutdown_func);
+        HPX_UNUSED(pre_shutdown);
+#endif
+        return false;
+    }
 }}}    // namespace hpx::performance_counters::papi
 
 ///////////////////////////////////////////////////////////////////////////////
-// register a startup function for PAPI performance counter
-HPX_REGISTER_STARTUP_MODULE_DYNAMIC(
-    hpx::performance_counters::papi::check_startup)
+// register the startup and shutdown functions for PAPI performance counter
+HPX_REGISTER_STARTUP_SHUTDOWN_MODULE_DYNAMIC(
+    hpx::performance_counters::papi::check_startup,
+    hpx::performance_counters::papi::check_shutdown)
 
 // register related command line options
 HPX_REGISTER_COMMANDLINE_MODULE_DYNAMIC(
@@ -0,0 +1,397 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PAPI) && defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+
+#include <hpx/components/performance_counters/papi/task_counters.hpp>
+#include <hpx/components/performance_counters/papi/util/papi.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/threading_base/task_counter_hooks.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <papi.h>
+#include <pthread.h>
+
+#define NS_STR "hpx::performance_counters::papi::"
+
+namespace hpx { namespace performance_counters { namespace papi {
+
+    namespace {
+
+        // the events counted for every task, set before the hooks are
+        // installed
+        std::vector<std::string> task_event_names;
+        std::vector<int> task_event_codes;
+
+        struct annotation_counts
+        {
+            explicit annotation_counts(std::size_t num_events)
+              : counts_(num_events)
+              , samples_(0)
+            {
+            }
+
+            std::vector<std::atomic<std::int64_t>> counts_;
+            std::atomic<std::int64_t> samples_;
+        };
+
+        // The counts of all annotations, the entries are never removed
+        struct annotation_registry
+        {
+            annotation_counts* get(char const* annotation)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                auto& data = annotations_[annotation];
+                if (!data)
+                {
+                    data = std::make_unique<annotation_counts>(
+                        task_event_codes.size());
+                }
+                return data.get();
+            }
+
+            annotation_counts* find(std::string const& annotation)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                auto const it = annotations_.find(annotation);
+                return it != annotations_.end() ? it->second.get() : nullptr;
+            }
+
+            std::mutex mtx_;
+            std::map<std::string, std::unique_ptr<annotation_counts>>
+                annotations_;
+        };
+
+        annotation_registry& get_annotation_registry()
+        {
+            static annotation_registry registry;
+            return registry;
+        }
+
+        // every worker thread caches the data for the annotation pointers it
+        // has seen to avoid locking the registry
+        annotation_counts* get_annotation_counts(char const* annotation)
+        {
+            static thread_local std::unordered_map<char const*,
+                annotation_counts*>
+                cache;
+
+            auto it = cache.find(annotation);
+            if (it == cache.end())
+            {
+                it = cache
+                         .emplace(annotation,
+                             get_annotation_registry().get(annotation))
+                         .first;
+            }
+            return it->second;
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The PAPI event set of a worker thread, created when the thread
+        // samples its first task
+        class thread_event_set
+        {
+        public:
+            thread_event_set() = default;
+
+            ~thread_event_set()
+            {
+                if (evset_ != PAPI_NULL)
+                {
+                    destroy();
+                    PAPI_unregister_thread();
+                }
+            }
+
+            thread_event_set(thread_event_set const&) = delete;
+            thread_event_set& operator=(thread_event_set const&) = delete;
+
+            void begin() noexcept
+            {
+                valid_ = (evset_ != PAPI_NULL || init()) &&
+                    PAPI_read(evset_, start_.data()) == PAPI_OK;
+            }
+
+            void end(char const* annotation) noexcept
+            {
+                if (!valid_ || PAPI_read(evset_, end_.data()) != PAPI_OK)
+                {
+                    return;
+                }
+                valid_ = false;
+
+                try
+                {
+                    annotation_counts* data = get_annotation_counts(
+                        annotation != nullptr ? annotation : "<unknown>");
+
+                    for (std::size_t i = 0; i != start_.size(); ++i)
+                    {
+                        data->counts_[i].fetch_add(
+                            static_cast<std::int64_t>(end_[i] - start_[i]),
+                            std::memory_order_relaxed);
+                    }
+                    data->samples_.fetch_add(1, std::memory_order_relaxed);
+                }
+                catch (...)
+                {
+                    // ignore allocation failures, the counts are incomplete
+                    // then
+                }
+            }
+
+        private:
+            bool init() noexcept
+            {
+                // don't retry if the event set could not be created once
+                if (failed_)
+                {
+                    return false;
+                }
+                failed_ = true;
+
+                if (PAPI_register_thread() != PAPI_OK)
+                {
+                    return false;
+                }
+                if (PAPI_create_eventset(&evset_) != PAPI_OK)
+                {
+                    evset_ = PAPI_NULL;
+                    return false;
+                }
+
+                try
+                {
+                    start_.resize(task_event_codes.size());
+                    end_.resize(task_event_codes.size());
+                }
+                catch (...)
+                {
+                    destroy();
+                    return false;
+                }
+
+                for (int const code : task_event_codes)
+                {
+                    if (PAPI_add_event(evset_, code) != PAPI_OK)
+                    {
+                        destroy();
+                        return false;
+                    }
+                }
+
+                if (PAPI_start(evset_) != PAPI_OK)
+                {
+                    destroy();
+                    return false;
+                }
+
+                failed_ = false;
+                return true;
+            }
+
+            void destroy() noexcept
+            {
+                int state = 0;
+                if (PAPI_state(evset_, &state) == PAPI_OK &&
+                    (state & PAPI_RUNNING) != 0)
+                {
+                    PAPI_stop(evset_, end_.data());
+                }
+                PAPI_cleanup_eventset(evset_);
+                PAPI_destroy_eventset(&evset_);
+                evset_ = PAPI_NULL;
+            }
+
+            int evset_ = PAPI_NULL;
+            bool failed_ = false;
+            bool valid_ = false;
+            std::vector<long long> start_;
+            std::vector<long long> end_;
+        };
+
+        thread_event_set& get_thread_event_set()
+        {
+            static thread_local thread_event_set event_set;
+            return event_set;
+        }
+
+        void begin_task() noexcept
+        {
+            get_thread_event_set().begin();
+        }
+
+        void end_task(
+            char const* annotation, threads::thread_schedule_state) noexcept
+        {
+            get_thread_event_set().end(annotation);
+        }
+
+        threads::task_counter_hooks const task_hooks = {
+            &begin_task, &end_task};
+
+        ///////////////////////////////////////////////////////////////////////
+        bool verify_task_counter_paths(counter_info const& info,
+            counter_path_elements& paths, char const* name, error_code& ec)
+        {
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            if (paths.parentinstance_is_basename_ ||
+                paths.instancename_ != "total" || paths.instanceindex_ != -1)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                    "invalid counter instance name: {}", info.fullname_);
+                return false;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                    "the counter {} requires the thread annotation as its "
+                    "parameter",
+                    info.fullname_);
+                return false;
+            }
+            return true;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start_task_counters(
+        std::vector<std::string> const& events, std::size_t sampling_rate)
+    {
+        // every worker thread reads its own event set
+        util::papi_call(PAPI_thread_init(&pthread_self),
+            "failed to initialize PAPI thread support",
+            NS_STR "start_task_counters()");
+
+        std::vector<int> codes;
+        codes.reserve(events.size());
+        for (std::string const& event : events)
+        {
+            int code = PAPI_NULL;
+            util::papi_call(PAPI_event_name_to_code(
+                                const_cast<char*>(event.c_str()), &code),
+                "unknown PAPI event " + event, NS_STR "start_task_counters()");
+            codes.push_back(code);
+        }
+
+        task_event_names = events;
+        task_event_codes = HPX_MOVE(codes);
+
+        threads::set_task_counter_hooks(&task_hooks, sampling_rate);
+    }
+
+    void stop_task_counters()
+    {
+        // the event sets are released when the worker threads exit
+        threads::set_task_counter_hooks(nullptr);
+    }
+
+    std::int64_t get_task_event_count(
+        std::string const& annotation, std::size_t event, bool reset)
+    {
+        annotation_counts* data = get_annotation_registry().find(annotation);
+        if (data == nullptr || event >= data->counts_.size())
+        {
+            return 0;
+        }
+        return get_and_reset(data->counts_[event], reset);
+    }
+
+    std::int64_t get_task_samples(std::string const& annotation, bool reset)
+    {
+        annotation_counts* data = get_annotation_registry().find(annotation);
+        return data != nullptr ? get_and_reset(data->samples_, reset) : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    naming::gid_type create_task_count_counter(
+        counter_info const& info, error_code& ec)
+    {
+        counter_path_elements paths;
+        if (!verify_task_counter_paths(
+                info, paths, NS_STR "create_task_count_counter()", ec))
+        {
+            return naming::invalid_gid;
+        }
+
+        // the annotation itself may contain commas
+        std::string::size_type const pos = paths.parameters_.rfind(',');
+        auto const it = pos != std::string::npos ?
+            std::find(task_event_names.begin(), task_event_names.end(),
+                paths.parameters_.substr(pos + 1)) :
+            task_event_names.end();
+        if (it == task_event_names.end())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                NS_STR "create_task_count_counter()",
+                "the parameters of the counter {} have to be the thread "
+                "annotation followed by a comma and one of the events given "
+                "to --hpx:papi-task-events",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+
+        using performance_counters::detail::create_raw_counter;
+        hpx::function<std::int64_t(bool)> f =
+            [annotation = paths.parameters_.substr(0, pos),
+                event = static_cast<std::size_t>(
+                    it - task_event_names.begin())](bool reset) {
+                return get_task_event_count(annotation, event, reset);
+            };
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+
+    naming::gid_type create_task_samples_counter(
+        counter_info const& info, error_code& ec)
+    {
+        counter_path_elements paths;
+        if (!verify_task_counter_paths(
+                info, paths, NS_STR "create_task_samples_counter()", ec))
+        {
+            return naming::invalid_gid;
+        }
+
+        using performance_counters::detail::create_raw_counter;
+        hpx::function<std::int64_t(bool)> f =
+            [annotation = paths.parameters_](bool reset) {
+                return get_task_samples(annotation, reset);
+            };
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+}}}    // namespace hpx::performance_counters::papi
+
+#endif
@@ -20,6 +20,7 @@
 #endif
 #include <asio/ip/host_name.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <map>
@@ -80,7 +81,15 @@ namespace hpx {
             " the optional argument is one of:\n"
             "  preset - show available predefined events,\n"
             "  native - show available native events,\n"
-            "  all    - show all available events.");
+            "  all    - show all available events.")("hpx:papi-task-events",
+            value<std::string>(),
+            "attribute the given comma separated PAPI events to the "
+            "annotations of the executed HPX threads (requires "
+            "HPX_WITH_TASK_COUNTER_HOOKS=ON)")("hpx:papi-task-sampling",
+            value<std::size_t>()->default_value(100),
+            "measure the PAPI events given to --hpx:papi-task-events for "
+            "every n'th execution phase of the HPX threads run by each "
+            "worker thread (default: 100)");
         return papi_opts;
     }
 
@@ -144,6 +153,20 @@ namespace hpx {
                 NS_STR "check_options()");
             needed = true;
         }
+        if (vm.count("hpx:papi-task-events"))
+        {
+#if !defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+            HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
+                NS_STR "check_options()",
+                "--hpx:papi-task-events requires HPX to be configured with "
+                "HPX_WITH_TASK_COUNTER_HOOKS=ON");
+#endif
+            if (vm["hpx:papi-task-sampling"].as<std::size_t>() == 0)
+                HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
+                    NS_STR "check_options()",
+                    "argument to --hpx:papi-task-sampling must be positive");
+            needed = true;
+        }
         // FIXME: implement multiplexing properly and uncomment below when done
         if (vm.count("hpx:papi-multiplex"))
             HPX_THROW_EXCEPTION(hpx::error::not_implemented,
@@ -0,0 +1,111 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_WINDOWS)
+#include <hpx/futures/future.hpp>
+#include <hpx/lcos_local/channel.hpp>
+
+#include <hpx/components/process/export_definitions.hpp>
+
+#include <sys/types.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace components { namespace process {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The description of a process to be launched by spawn().
+    struct spawn_options
+    {
+        /// The executable to run
+        std::string exe;
+
+        /// The command line arguments, including the program name. If this
+        /// is empty, the program name is set to exe.
+        std::vector<std::string> args;
+
+        /// The environment of the process (as "name=value" entries). If this
+        /// is empty, the process inherits the environment of this process.
+        std::vector<std::string> env;
+
+        /// Look up exe in the directories listed in PATH, if it does not
+        /// contain a '/'
+        bool search_path = false;
+
+        /// Stream the standard output and error of the process, otherwise it
+        /// is inherited from this process
+        bool capture_stdout = true;
+        bool capture_stderr = true;
+    };
+
+    namespace detail {
+
+        struct async_child_data;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A process launched asynchronously by spawn(). The output of the process
+    /// is read by the I/O thread pool and delivered as chunks of data through
+    /// channels, which are closed once the process has closed its end of the
+    /// pipe. Waiting for the exit of the process suspends only the waiting
+    /// HPX thread.
+    class HPX_PROCESS_EXPORT async_child
+    {
+    public:
+        async_child() = default;
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        /// The process id of the launched process
+        pid_t pid() const noexcept;
+
+        /// The chunks of data written by the process to its standard output
+        /// (or error). The channels yield no data if the stream was not
+        /// captured.
+        hpx::lcos::local::receive_channel<std::string> stdout_channel() const;
+        hpx::lcos::local::receive_channel<std::string> stderr_channel() const;
+
+        /// Read all output of the process to its standard output (or error)
+        hpx::future<std::string> read_stdout() const;
+        hpx::future<std::string> read_stderr() const;
+
+        /// The exit code of the process becomes available once the process
+        /// has exited. A process terminated by a signal reports 128 plus the
+        /// signal number (as shells do).
+        hpx::shared_future<int> wait_for_exit() const;
+
+        /// Send a SIGKILL to the process
+        void terminate() const;
+
+    private:
+        friend async_child spawn(spawn_options const& options);
+
+        explicit async_child(std::shared_ptr<detail::async_child_data> data)
+          : data_(HPX_MOVE(data))
+        {
+        }
+
+        std::shared_ptr<detail::async_child_data> data_;
+    };
+
+    /// Launch the described process without blocking. The process is started
+    /// using posix_spawn, which does not copy the address space of this
+    /// process (as fork does). The I/O thread pool of the runtime is used to
+    /// read from the pipes connected to the process, so this can be called
+    /// only while the runtime is running.
+    HPX_PROCESS_EXPORT async_child spawn(spawn_options const& options);
+}}}    // namespace hpx::components::process
+
+#endif
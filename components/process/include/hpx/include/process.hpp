@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <hpx/components/process/async_child.hpp>
 #include <hpx/components/process/process.hpp>
 #include <hpx/components/process/util/initializers.hpp>
 
@@ -0,0 +1,336 @@
+// Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_WINDOWS)
+#include <hpx/async_local/async.hpp>
+#include <hpx/io_service/io_service_pool.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/threading.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+
+#include <hpx/components/process/async_child.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+extern char** environ;
+
+namespace hpx { namespace components { namespace process {
+
+    namespace detail {
+
+        using output_channel = hpx::lcos::local::channel<std::string>;
+
+        struct async_child_data
+        {
+            pid_t pid = -1;
+            output_channel stdout_;
+            output_channel stderr_;
+            hpx::shared_future<int> exit_code_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Reads the data from one end of a pipe using the given io_context
+        // and sends it through the channel, the channel is closed at the end
+        // of the stream.
+        class pipe_reader : public std::enable_shared_from_this<pipe_reader>
+        {
+        public:
+            pipe_reader(asio::io_context& io_service, int fd,
+                output_channel const& channel)
+              : stream_(io_service, fd)
+              , channel_(channel)
+            {
+            }
+
+            void read()
+            {
+                stream_.async_read_some(asio::buffer(buffer_),
+                    [self = shared_from_this()](
+                        std::error_code const& ec, std::size_t size) {
+                        self->handle_read(ec, size);
+                    });
+            }
+
+        private:
+            void handle_read(std::error_code const& ec, std::size_t size)
+            {
+                if (size != 0)
+                {
+                    channel_.set(std::string(buffer_.data(), size));
+                }
+
+                // end of stream or error
+                if (ec)
+                {
+                    channel_.close();
+                    return;
+                }
+                read();
+            }
+
+            asio::posix::stream_descriptor stream_;
+            output_channel channel_;
+            std::array<char, 4096> buffer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The returned future becomes ready once the process has exited. The
+        // waiting HPX thread is suspended between two (non-blocking) calls
+        // to waitpid.
+        hpx::future<int> wait_for_exit_async(pid_t pid)
+        {
+            return hpx::async([pid]() -> int {
+                constexpr std::chrono::microseconds max_delay(10000);
+                std::chrono::microseconds delay(50);
+
+                while (true)
+                {
+                    int status = 0;
+                    pid_t const ret = ::waitpid(pid, &status, WNOHANG);
+                    if (ret == pid)
+                    {
+                        if (WIFSIGNALED(status))
+                            return 128 + WTERMSIG(status);
+                        return WEXITSTATUS(status);
+                    }
+
+                    if (ret == -1 && errno != EINTR)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                            "process::async_child::wait_for_exit",
+                            "waitpid(2) failed: {}", std::strerror(errno));
+                    }
+
+                    hpx::this_thread::sleep_for(delay);
+                    delay = (std::min)(2 * delay, max_delay);
+                }
+            });
+        }
+
+        hpx::future<std::string> read_all(output_channel const& channel)
+        {
+            return hpx::async([channel]() -> std::string {
+                std::string result;
+                while (true)
+                {
+                    // getting a value fails once the channel is closed and
+                    // all data has been received
+                    hpx::future<std::string> f = channel.get();
+                    f.wait();
+                    if (f.has_exception())
+                        break;
+                    result += f.get();
+                }
+                return result;
+            });
+        }
+
+        // create a pipe whose ends are closed in the launched process
+        void create_pipe(int (&fds)[2])
+        {
+#if defined(__linux__)
+            int const result = ::pipe2(fds, O_CLOEXEC);
+#else
+            int result = ::pipe(fds);
+            if (result != -1)
+            {
+                ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+                ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+            }
+#endif
+            if (result == -1)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "process::spawn", "pipe(2) failed: {}",
+                    std::strerror(errno));
+            }
+        }
+
+        std::vector<char*> make_argv(std::vector<std::string> const& strings)
+        {
+            std::vector<char*> result;
+            result.reserve(strings.size() + 1);
+            for (std::string const& s : strings)
+            {
+                result.push_back(const_cast<char*>(s.c_str()));
+            }
+            result.push_back(nullptr);
+            return result;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    pid_t async_child::pid() const noexcept
+    {
+        return data_ ? data_->pid : -1;
+    }
+
+    hpx::lcos::local::receive_channel<std::string>
+    async_child::stdout_channel() const
+    {
+        return hpx::lcos::local::receive_channel<std::string>(data_->stdout_);
+    }
+
+    hpx::lcos::local::receive_channel<std::string>
+    async_child::stderr_channel() const
+    {
+        return hpx::lcos::local::receive_channel<std::string>(data_->stderr_);
+    }
+
+    hpx::future<std::string> async_child::read_stdout() const
+    {
+        return detail::read_all(data_->stdout_);
+    }
+
+    hpx::future<std::string> async_child::read_stderr() const
+    {
+        return detail::read_all(data_->stderr_);
+    }
+
+    hpx::shared_future<int> async_child::wait_for_exit() const
+    {
+        return data_->exit_code_;
+    }
+
+    void async_child::terminate() const
+    {
+        // the process id may have been reused once the process was reaped
+        if (data_ && !data_->exit_code_.is_ready())
+        {
+            ::kill(data_->pid, SIGKILL);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    async_child spawn(spawn_options const& options)
+    {
+        hpx::util::io_service_pool* pool = hpx::get_thread_pool("io-pool");
+        if (pool == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status, "process::spawn",
+                "the runtime is not currently running");
+        }
+
+        std::vector<std::string> args = options.args;
+        if (args.empty())
+        {
+            args.push_back(options.exe);
+        }
+        std::vector<char*> argv = detail::make_argv(args);
+        std::vector<char*> envp;
+        if (!options.env.empty())
+        {
+            envp = detail::make_argv(options.env);
+        }
+
+        int out[2] = {-1, -1};
+        int err[2] = {-1, -1};
+        if (options.capture_stdout)
+        {
+            detail::create_pipe(out);
+        }
+        if (options.capture_stderr)
+        {
+            detail::create_pipe(err);
+        }
+
+        // the pipes are connected in the launched process, all other file
+        // descriptors of the pipes are closed on exec
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        if (options.capture_stdout)
+        {
+            posix_spawn_file_actions_adddup2(&actions, out[1], STDOUT_FILENO);
+        }
+        if (options.capture_stderr)
+        {
+            posix_spawn_file_actions_adddup2(&actions, err[1], STDERR_FILENO);
+        }
+
+        pid_t pid = -1;
+        char* const* env = envp.empty() ? environ : envp.data();
+        int const result = options.search_path ?
+            ::posix_spawnp(&pid, options.exe.c_str(), &actions, nullptr,
+                argv.data(), env) :
+            ::posix_spawn(&pid, options.exe.c_str(), &actions, nullptr,
+                argv.data(), env);
+
+        posix_spawn_file_actions_destroy(&actions);
+
+        // close the ends of the pipes used by the launched process
+        for (int const fd : {out[1], err[1]})
+        {
+            if (fd != -1)
+                ::close(fd);
+        }
+
+        if (result != 0)
+        {
+            for (int const fd : {out[0], err[0]})
+            {
+                if (fd != -1)
+                    ::close(fd);
+            }
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status, "process::spawn",
+                "posix_spawn failed for {}: {}", options.exe,
+                std::strerror(result));
+        }
+
+        auto data = std::make_shared<detail::async_child_data>();
+        data->pid = pid;
+        data->exit_code_ = detail::wait_for_exit_async(pid);
+
+        asio::io_context& io_service = pool->get_io_service();
+        if (out[0] != -1)
+        {
+            std::make_shared<detail::pipe_reader>(
+                io_service, out[0], data->stdout_)
+                ->read();
+        }
+        else
+        {
+            data->stdout_.close();
+        }
+
+        if (err[0] != -1)
+        {
+            std::make_shared<detail::pipe_reader>(
+                io_service, err[0], data->stderr_)
+                ->read();
+        }
+        else
+        {
+            data->stderr_.close();
+        }
+
+        return async_child(HPX_MOVE(data));
+    }
+}}}    // namespace hpx::components::process
+
+#endif
@@ -0,0 +1,154 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && !defined(HPX_WINDOWS)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/process.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace process = hpx::components::process;
+
+///////////////////////////////////////////////////////////////////////////////
+process::spawn_options shell(std::string const& script)
+{
+    process::spawn_options options;
+    options.exe = "/bin/sh";
+    options.args = {"sh", "-c", script};
+    return options;
+}
+
+void test_output()
+{
+    process::async_child c =
+        process::spawn(shell("echo hello; echo oops >&2; exit 3"));
+    HPX_TEST(c);
+    HPX_TEST_NEQ(c.pid(), -1);
+
+    hpx::future<std::string> out = c.read_stdout();
+    hpx::future<std::string> err = c.read_stderr();
+
+    HPX_TEST_EQ(c.wait_for_exit().get(), 3);
+    HPX_TEST_EQ(out.get(), std::string("hello\n"));
+    HPX_TEST_EQ(err.get(), std::string("oops\n"));
+}
+
+void test_streaming()
+{
+    process::async_child c =
+        process::spawn(shell("for i in 1 2 3; do echo $i; sleep 0.1; done"));
+
+    // the chunks arrive while the process is running
+    auto channel = c.stdout_channel();
+    HPX_TEST_EQ(channel.get(hpx::launch::sync), std::string("1\n"));
+    HPX_TEST(!c.wait_for_exit().is_ready());
+
+    std::string rest;
+    while (true)
+    {
+        hpx::future<std::string> f = channel.get();
+        f.wait();
+        if (f.has_exception())
+            break;
+        rest += f.get();
+    }
+    HPX_TEST_EQ(rest, std::string("2\n3\n"));
+    HPX_TEST_EQ(c.wait_for_exit().get(), 0);
+}
+
+void test_many()
+{
+    constexpr std::size_t num_processes = 64;
+
+    std::vector<process::async_child> children;
+    std::vector<hpx::future<std::string>> outputs;
+    for (std::size_t i = 0; i != num_processes; ++i)
+    {
+        process::spawn_options options;
+        options.exe = "echo";
+        options.args = {"echo", std::to_string(i)};
+        options.search_path = true;
+        options.capture_stderr = false;
+
+        children.push_back(process::spawn(options));
+        outputs.push_back(children.back().read_stdout());
+    }
+
+    for (std::size_t i = 0; i != num_processes; ++i)
+    {
+        HPX_TEST_EQ(outputs[i].get(), std::to_string(i) + "\n");
+        HPX_TEST_EQ(children[i].wait_for_exit().get(), 0);
+    }
+}
+
+void test_environment()
+{
+    process::spawn_options options = shell("echo $SPAWN_PROCESS_TEST");
+    options.env = {"SPAWN_PROCESS_TEST=42"};
+    options.capture_stderr = false;
+
+    process::async_child c = process::spawn(options);
+    HPX_TEST_EQ(c.read_stdout().get(), std::string("42\n"));
+    HPX_TEST_EQ(c.read_stderr().get(), std::string());
+    HPX_TEST_EQ(c.wait_for_exit().get(), 0);
+}
+
+void test_terminate()
+{
+    process::async_child c = process::spawn(shell("exec sleep 60"));
+    c.terminate();
+    HPX_TEST_EQ(c.wait_for_exit().get(), 128 + 9);    // SIGKILL
+    HPX_TEST_EQ(c.read_stdout().get(), std::string());
+}
+
+void test_error()
+{
+    process::spawn_options options;
+    options.exe = "/this/executable/does/not/exist";
+
+    bool caught_exception = false;
+    try
+    {
+        process::spawn(options);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    test_output();
+    test_streaming();
+    test_many();
+    test_environment();
+    test_terminate();
+    test_error();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -316,6 +316,7 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
@@ -522,22 +523,6 @@ namespace hpx::parallel {
     // copy_if
     namespace detail {
 
-        // sequential copy_if with projection function
-        template <typename InIter1, typename InIter2, typename OutIter,
-            typename Pred, typename Proj>
-        constexpr util::in_out_result<InIter1, OutIter> sequential_copy_if(
-            InIter1 first, InIter2 last, OutIter dest, Pred&& pred, Proj&& proj)
-        {
-            while (first != last)
-            {
-                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                    *dest++ = *first;
-                ++first;
-            }
-            return util::in_out_result<InIter1, OutIter>{
-                HPX_MOVE(first), HPX_MOVE(dest)};
-        }
-
         template <typename IterPair>
         struct copy_if : public algorithm<copy_if<IterPair>, IterPair>
         {
@@ -552,16 +537,86 @@ namespace hpx::parallel {
                 ExPolicy, InIter1 first, InIter2 last, OutIter dest,
                 Pred&& pred, Proj&& proj /* = Proj()*/)
             {
-                return sequential_copy_if(first, last, dest,
+                return sequential_copy_if<ExPolicy>(first, last, dest,
                     HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
             }
 
+            // Count the elements to copy for each partition first, then
+            // compress the elements of each partition to their final
+            // location. This evaluates the predicate twice for each element,
+            // but avoids storing the outcome. The kernels evaluate the
+            // predicate on whole vector packs for simd execution policies.
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
-                typename FwdIter3, typename Pred, typename Proj = hpx::identity>
+                typename FwdIter3, typename Pred, typename Proj>
             static typename util::detail::algorithm_result<ExPolicy,
                 util::in_out_result<FwdIter1, FwdIter3>>::type
-            parallel(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
-                FwdIter3 dest, Pred&& pred, Proj&& proj /* = Proj()*/)
+            parallel_compress(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
+                FwdIter3 dest, Pred&& pred, Proj&& proj)
+            {
+                using result = util::detail::algorithm_result<ExPolicy,
+                    util::in_out_result<FwdIter1, FwdIter3>>;
+
+                if (first == last)
+                {
+                    return result::get(util::in_out_result<FwdIter1, FwdIter3>{
+                        HPX_MOVE(first), HPX_MOVE(dest)});
+                }
+
+                using execution_policy_type = std::decay_t<ExPolicy>;
+                std::size_t const count = detail::distance(first, last);
+                using scan_partitioner_type = util::scan_partitioner<ExPolicy,
+                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t>;
+
+                auto f1 = [pred, proj](FwdIter1 part_begin,
+                              std::size_t part_size) -> std::size_t {
+                    return sequential_copy_if<execution_policy_type>(
+                        part_begin, part_size, pred, proj);
+                };
+
+                auto f3 = [dest, pred = HPX_FORWARD(Pred, pred),
+                              proj = HPX_FORWARD(Proj, proj)](
+                              FwdIter1 part_begin, std::size_t part_size,
+                              std::size_t val) {
+                    sequential_copy_if<execution_policy_type>(part_begin,
+                        std::next(part_begin, part_size), std::next(dest, val),
+                        pred, proj);
+                };
+
+                auto f4 = [first, dest, count](std::vector<std::size_t>&& items,
+                              std::vector<hpx::future<void>>&& data) mutable
+                    -> util::in_out_result<FwdIter1, FwdIter3> {
+                    std::advance(first, count);
+                    std::advance(dest, items.back());
+
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    util::detail::clear_container(data);
+
+                    return util::in_out_result<FwdIter1, FwdIter3>{
+                        HPX_MOVE(first), HPX_MOVE(dest)};
+                };
+
+                return scan_partitioner_type::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count, std::size_t(0),
+                    // step 1 counts the elements to copy in each partition
+                    HPX_MOVE(f1),
+                    // step 2 propagates the partition results from left
+                    // to right
+                    std::plus<std::size_t>(),
+                    // step 3 copies the elements of each partition
+                    HPX_MOVE(f3),
+                    // step 4 use this return value
+                    HPX_MOVE(f4));
+            }
+
+            // Store the outcome of the predicate for each element in the
+            // first step and copy the selected elements in the last step.
+            template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+                typename FwdIter3, typename Pred, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter3>>::type
+            parallel_flags(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
+                FwdIter3 dest, Pred&& pred, Proj&& proj)
             {
                 typedef hpx::util::zip_iterator<FwdIter1, bool*> zip_iterator;
                 typedef util::detail::algorithm_result<ExPolicy,
@@ -652,6 +707,27 @@ namespace hpx::parallel {
                     // step 4 use this return value
                     HPX_MOVE(f4));
             }
+
+            template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+                typename FwdIter3, typename Pred, typename Proj = hpx::identity>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter3>>::type
+            parallel(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
+                FwdIter3 dest, Pred&& pred, Proj&& proj /* = Proj()*/)
+            {
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    return parallel_compress(HPX_FORWARD(ExPolicy, policy),
+                        first, last, dest, HPX_FORWARD(Pred, pred),
+                        HPX_FORWARD(Proj, proj));
+                }
+                else
+                {
+                    return parallel_flags(HPX_FORWARD(ExPolicy, policy),
+                        first, last, dest, HPX_FORWARD(Pred, pred),
+                        HPX_FORWARD(Proj, proj));
+                }
+            }
         };
     }    // namespace detail
 }    // namespace hpx::parallel
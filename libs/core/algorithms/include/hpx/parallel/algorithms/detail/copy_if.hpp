@@ -0,0 +1,81 @@
+//  Copyright (c) 2014-2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // provide implementation of std::copy_if supporting projections and
+    // counting the elements to copy
+    template <typename ExPolicy>
+    struct sequential_copy_if_t final
+      : hpx::functional::detail::tag_fallback<sequential_copy_if_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter1, typename InIter2, typename OutIter,
+            typename Pred, typename Proj>
+        friend constexpr util::in_out_result<InIter1, OutIter>
+        tag_fallback_invoke(sequential_copy_if_t<ExPolicy>, InIter1 first,
+            InIter2 last, OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            while (first != last)
+            {
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                    *dest++ = *first;
+                ++first;
+            }
+            return util::in_out_result<InIter1, OutIter>{
+                HPX_MOVE(first), HPX_MOVE(dest)};
+        }
+
+        template <typename InIter, typename Pred, typename Proj>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_copy_if_t<ExPolicy>, InIter first, std::size_t count,
+            Pred&& pred, Proj&& proj)
+        {
+            std::size_t result = 0;
+            for (/**/; count != 0; (void) ++first, --count)
+            {
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                    ++result;
+            }
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_copy_if_t<ExPolicy> sequential_copy_if =
+        sequential_copy_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter, typename Pred, typename Proj>
+    constexpr util::in_out_result<InIter1, OutIter> sequential_copy_if(
+        InIter1 first, InIter2 last, OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        return sequential_copy_if_t<ExPolicy>{}(first, last, dest,
+            HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+
+    template <typename ExPolicy, typename InIter, typename Pred, typename Proj>
+    constexpr std::size_t sequential_copy_if(
+        InIter first, std::size_t count, Pred&& pred, Proj&& proj)
+    {
+        return sequential_copy_if_t<ExPolicy>{}(
+            first, count, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,59 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // Count the elements of [first, first + count) mapped to each of the
+    // given bins, elements mapped to a bin outside of [0, num_bins) are
+    // ignored. The counts are added to the values already stored in 'bins'.
+    template <typename ExPolicy>
+    struct sequential_histogram_t final
+      : hpx::functional::detail::tag_fallback<sequential_histogram_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename F>
+        friend constexpr void tag_fallback_invoke(
+            sequential_histogram_t<ExPolicy>, InIter first, std::size_t count,
+            std::size_t* bins, std::size_t num_bins, F&& f)
+        {
+            for (/**/; count != 0; (void) ++first, --count)
+            {
+                // negative bin indices wrap around and are ignored as well
+                auto const bin =
+                    static_cast<std::size_t>(HPX_INVOKE(f, *first));
+                if (bin < num_bins)
+                {
+                    ++bins[bin];
+                }
+            }
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_histogram_t<ExPolicy> sequential_histogram =
+        sequential_histogram_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename F>
+    constexpr void sequential_histogram(InIter first, std::size_t count,
+        std::size_t* bins, std::size_t num_bins, F&& f)
+    {
+        sequential_histogram_t<ExPolicy>{}(
+            first, count, bins, num_bins, HPX_FORWARD(F, f));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,116 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // Smallest number of output elements produced by a single chunk of a
+    // parallel merge
+    inline constexpr std::size_t merge_path_min_chunk_size = 32768;
+
+    // Merge path partitioning: the merged output of two sorted ranges of
+    // lengths len1 and len2 forms a path through a len1 x len2 grid. Each
+    // cross diagonal, i.e. each output position, intersects this path exactly
+    // once. Returns the number of elements taken from the first range by the
+    // first 'diag' elements of the (stable) merge; the remaining
+    // 'diag - result' elements come from the second range. Equal elements of
+    // the first range precede those of the second range.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    constexpr std::size_t merge_path_search(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diag, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        std::size_t low = diag > len2 ? diag - len2 : 0;
+        std::size_t high = (std::min)(diag, len1);
+
+        while (low < high)
+        {
+            std::size_t const mid = low + (high - low) / 2;
+
+            // first1[mid] is part of the first 'diag' merged elements if it
+            // is not greater than the element of the second range it is
+            // compared with
+            if (!HPX_INVOKE(comp, HPX_INVOKE(proj2, first2[diag - mid - 1]),
+                    HPX_INVOKE(proj1, first1[mid])))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    // Determine the number of chunks a parallel merge producing 'count'
+    // elements should be divided into
+    template <typename ExPolicy>
+    std::size_t get_merge_path_num_chunks(ExPolicy& policy, std::size_t count)
+    {
+        std::size_t const cores =
+            execution::processing_units_count(policy.parameters(),
+                policy.executor(), hpx::chrono::null_duration, count);
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(policy.parameters(),
+            policy.executor(), hpx::chrono::null_duration, cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        // all chunks are of equal size, do not create more chunks than cores
+        chunk_size = (std::max)(chunk_size, merge_path_min_chunk_size);
+        chunk_size = (std::max)(chunk_size, (count + cores - 1) / cores);
+
+        return (count + chunk_size - 1) / chunk_size;
+    }
+
+    // Return the first output position of the given chunk
+    constexpr std::size_t get_merge_path_diagonal(
+        std::size_t chunk, std::size_t num_chunks, std::size_t count) noexcept
+    {
+        // avoid overflowing chunk * count
+        return count / num_chunks * chunk +
+            (count % num_chunks) * chunk / num_chunks;
+    }
+
+    // Run the given function for all chunks concurrently and wait for all of
+    // them to finish
+    template <typename ExPolicy, typename F>
+    void merge_path_for_each_chunk(
+        ExPolicy& policy, std::size_t num_chunks, F&& f)
+    {
+        auto&& items = execution::bulk_async_execute(policy.executor(),
+            HPX_FORWARD(F, f), hpx::util::counting_shape(num_chunks));
+
+        // always rethrow if items has at least one exceptional future
+        if (hpx::wait_all_nothrow(items))
+        {
+            util::detail::handle_local_exceptions<ExPolicy>::call(items);
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
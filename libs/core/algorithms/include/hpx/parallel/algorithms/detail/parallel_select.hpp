@@ -0,0 +1,255 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // Smallest number of elements handled by a single task of the parallel
+    // selection
+    inline constexpr std::size_t parallel_select_limit_per_task = 65536;
+
+    // Number of elements sampled for selecting the splitters
+    inline constexpr std::size_t parallel_select_sample_size = 16384;
+
+    // The parallel selection copies the splitters and moves the elements
+    // through a temporary buffer
+    template <typename Iter>
+    inline constexpr bool is_parallel_select_supported_v =
+        std::is_copy_constructible_v<
+            typename std::iterator_traits<Iter>::value_type> &&
+        std::is_default_constructible_v<
+            typename std::iterator_traits<Iter>::value_type>;
+
+    // Sample based parallel selection (Floyd-Rivest): two splitters are
+    // selected from a sorted random sample such that the nth element falls
+    // in between them with high probability. The elements are distributed
+    // to three buckets (less than, between, and greater than the splitters)
+    // in parallel, after which only the bucket containing the nth element is
+    // considered further. The expected size of that bucket is
+    // O(count / sqrt(parallel_select_sample_size)).
+    //
+    // Returns the sub-range containing the nth element once it has become
+    // too small to be processed in parallel. All elements before the
+    // returned sub-range are not greater than any element in it, all
+    // elements after it are not less than any element in it. An empty
+    // sub-range is returned if the nth element is already in its final
+    // position.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    std::pair<RandomIt, RandomIt> parallel_select(ExPolicy& policy,
+        RandomIt first, RandomIt nth, RandomIt last, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+        HPX_ASSERT(first <= nth && nth < last);
+
+        std::unique_ptr<value_type[]> buffer;
+
+        // the sample positions are chosen by a simple (fixed seed) xorshift
+        // generator, which makes the selection deterministic
+        std::uint64_t state = 0x9e3779b97f4a7c15ull;
+
+        while (true)
+        {
+            auto const count = static_cast<std::size_t>(last - first);
+
+            std::size_t const cores =
+                execution::processing_units_count(policy.parameters(),
+                    policy.executor(), hpx::chrono::null_duration, count);
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, cores, count);
+
+            util::detail::adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // all chunks are of equal size, do not create more chunks than
+            // cores
+            chunk_size = (std::max)(chunk_size, parallel_select_limit_per_task);
+            chunk_size = (std::max)(chunk_size, (count + cores - 1) / cores);
+
+            std::size_t const num_chunks =
+                (count + chunk_size - 1) / chunk_size;
+            if (num_chunks <= 1)
+            {
+                return {first, last};
+            }
+
+            // select the splitters from a sorted sample
+            std::size_t const sample_size =
+                (std::min)(count / 16, parallel_select_sample_size);
+
+            std::vector<value_type> sample;
+            sample.reserve(sample_size);
+            for (std::size_t i = 0; i != sample_size; ++i)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                sample.push_back(*std::next(first, state % count));
+            }
+            std::sort(sample.begin(), sample.end(), comp);
+
+            // the expected rank of the nth element in the sample is
+            // distributed around 'rank' with a standard deviation of at most
+            // sqrt(sample_size) / 2, the splitters are placed four standard
+            // deviations away
+            std::size_t delta = 1;
+            while (delta * delta < sample_size)
+            {
+                ++delta;
+            }
+            delta *= 2;
+
+            std::size_t const rank =
+                static_cast<std::size_t>(nth - first) * sample_size / count;
+
+            value_type const& lower = sample[rank > delta ? rank - delta : 0];
+            value_type const& upper =
+                sample[(std::min)(rank + delta, sample_size - 1)];
+
+            auto const bucket = [&](value_type const& value) -> std::size_t {
+                if (HPX_INVOKE(comp, value, lower))
+                {
+                    return 0;
+                }
+                return HPX_INVOKE(comp, upper, value) ? 2 : 1;
+            };
+
+            auto const chunk_begin = [=](std::size_t chunk) {
+                return (std::min)(chunk * chunk_size, count);
+            };
+            auto const chunk_count = [=](std::size_t chunk) {
+                return (std::min)((chunk + 1) * chunk_size, count) -
+                    chunk_begin(chunk);
+            };
+
+            // run the given function for all chunks concurrently
+            auto const for_each_chunk = [&](auto&& f) {
+                auto&& items = execution::bulk_async_execute(policy.executor(),
+                    HPX_FORWARD(decltype(f), f),
+                    hpx::util::counting_shape(num_chunks));
+
+                // always rethrow if items has at least one exceptional future
+                if (hpx::wait_all_nothrow(items))
+                {
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        items);
+                }
+            };
+
+            // count the elements of each bucket for all chunks, the buckets
+            // are computed again while moving the elements, which is cheaper
+            // than storing them
+            std::vector<std::array<std::size_t, 3>> offsets(num_chunks);
+            for_each_chunk([&](std::size_t chunk) {
+                std::array<std::size_t, 3> counts{};
+                RandomIt it = std::next(first, chunk_begin(chunk));
+                for (std::size_t i = chunk_count(chunk); i != 0; --i, ++it)
+                {
+                    ++counts[bucket(*it)];
+                }
+                offsets[chunk] = counts;
+            });
+
+            // compute where each chunk places the elements of each bucket
+            std::array<std::size_t, 4> bucket_begin{};
+            std::size_t offset = 0;
+            for (std::size_t b = 0; b != 3; ++b)
+            {
+                bucket_begin[b] = offset;
+                for (std::array<std::size_t, 3>& counts : offsets)
+                {
+                    std::size_t const size = counts[b];
+                    counts[b] = offset;
+                    offset += size;
+                }
+            }
+            bucket_begin[3] = offset;
+
+            auto const k = static_cast<std::size_t>(nth - first);
+            std::size_t target = 0;
+            while (k >= bucket_begin[target + 1])
+            {
+                ++target;
+            }
+
+            // no progress is possible if all elements fall into the bucket
+            // containing the nth element
+            if (bucket_begin[target + 1] - bucket_begin[target] == count)
+            {
+                if (target == 1 && !HPX_INVOKE(comp, lower, upper))
+                {
+                    // all elements are equivalent
+                    return {nth, nth};
+                }
+                return {first, last};
+            }
+
+            // the first iteration operates on the largest range
+            if (!buffer)
+            {
+                buffer.reset(new value_type[count]);
+            }
+            value_type* const buffer_first = buffer.get();
+
+            // move the elements of all chunks to their buckets in the buffer
+            // and back to the input sequence
+            for_each_chunk([&](std::size_t chunk) {
+                std::array<std::size_t, 3>& pos = offsets[chunk];
+                RandomIt it = std::next(first, chunk_begin(chunk));
+                for (std::size_t i = chunk_count(chunk); i != 0; --i, ++it)
+                {
+                    buffer_first[pos[bucket(*it)]++] = HPX_MOVE(*it);
+                }
+            });
+
+            for_each_chunk([&](std::size_t chunk) {
+                std::size_t const begin = chunk_begin(chunk);
+                std::move(buffer_first + begin,
+                    buffer_first + begin + chunk_count(chunk),
+                    std::next(first, begin));
+            });
+
+            if (target == 1 && !HPX_INVOKE(comp, lower, upper))
+            {
+                // the bucket containing the nth element holds equivalent
+                // elements only
+                return {nth, nth};
+            }
+
+            last = std::next(first, bucket_begin[target + 1]);
+            first = std::next(first, bucket_begin[target]);
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -8,14 +8,23 @@
 #pragma once
 
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/executors/execution.hpp>
 #include <hpx/executors/exception_list.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/util/low_level.hpp>
+#include <hpx/type_support/identity.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -23,6 +32,242 @@ namespace hpx::parallel::detail {
 
     inline constexpr std::size_t stable_sort_limit_per_task = 1 << 16;
 
+    // The buffer used if the buffer of N/2 elements can't be allocated is
+    // N/stable_sort_fallback_memory_divisor elements large
+    inline constexpr std::size_t stable_sort_fallback_memory_divisor = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Determine the number of chunks a parallel step of the merge processing
+    // 'count' elements should be divided into
+    constexpr std::size_t get_stable_sort_num_chunks(
+        std::size_t count, std::size_t cores) noexcept
+    {
+        std::size_t const num_chunks =
+            (count + merge_path_min_chunk_size - 1) / merge_path_min_chunk_size;
+        return (std::max)((std::min)(num_chunks, cores), std::size_t(1));
+    }
+
+    // Run the given function for all chunks concurrently and wait for all of
+    // them to finish
+    template <typename Exec, typename F>
+    void stable_sort_for_each_chunk(Exec& exec, std::size_t num_chunks, F&& f)
+    {
+        if (num_chunks == 1)
+        {
+            HPX_INVOKE(f, std::size_t(0));
+            return;
+        }
+
+        // rethrows the first exception, if any
+        hpx::wait_all(execution::bulk_async_execute(
+            exec, HPX_FORWARD(F, f), hpx::util::counting_shape(num_chunks)));
+    }
+
+    // Move the elements [first, first + count) into the uninitialized buffer
+    template <typename Exec, typename Iter, typename Value>
+    void parallel_uninit_move(Exec& exec, std::size_t cores, Iter first,
+        std::size_t count, Value* buffer)
+    {
+        std::size_t const num_chunks = get_stable_sort_num_chunks(count, cores);
+        stable_sort_for_each_chunk(exec, num_chunks, [&](std::size_t chunk) {
+            std::size_t const begin =
+                get_merge_path_diagonal(chunk, num_chunks, count);
+            std::size_t const end =
+                get_merge_path_diagonal(chunk + 1, num_chunks, count);
+            util::uninit_move(buffer + begin, first + begin, first + end);
+        });
+    }
+
+    // Reverse the elements of [first, last) by swapping both halves of the
+    // range chunk by chunk
+    template <typename Exec, typename Iter>
+    void parallel_reverse(Exec& exec, std::size_t cores, Iter first, Iter last)
+    {
+        std::size_t const count = static_cast<std::size_t>(last - first) / 2;
+        std::size_t const num_chunks = get_stable_sort_num_chunks(count, cores);
+        stable_sort_for_each_chunk(exec, num_chunks, [&](std::size_t chunk) {
+            std::size_t const begin =
+                get_merge_path_diagonal(chunk, num_chunks, count);
+            std::size_t const end =
+                get_merge_path_diagonal(chunk + 1, num_chunks, count);
+            std::swap_ranges(first + begin, first + end,
+                std::make_reverse_iterator(last - begin));
+        });
+    }
+
+    // Exchange [first, middle) and [middle, last) without using a buffer,
+    // returns the new position of first
+    template <typename Exec, typename Iter>
+    Iter parallel_rotate(
+        Exec& exec, std::size_t cores, Iter first, Iter middle, Iter last)
+    {
+        if (cores < 2 ||
+            static_cast<std::size_t>(last - first) <
+                2 * merge_path_min_chunk_size)
+        {
+            return std::rotate(first, middle, last);
+        }
+
+        parallel_reverse(exec, cores, first, middle);
+        parallel_reverse(exec, cores, middle, last);
+        parallel_reverse(exec, cores, first, last);
+        return first + (last - middle);
+    }
+
+    // Stable merge by moving the elements, the remaining elements of both
+    // ranges are moved as well
+    template <typename Iter1, typename Iter2, typename Iter3, typename Compare>
+    void stable_sort_move_merge(Iter1 first1, Iter1 last1, Iter2 first2,
+        Iter2 last2, Iter3 dest, Compare& comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first2, *first1))
+            {
+                *dest = HPX_MOVE(*first2);
+                ++first2;
+            }
+            else
+            {
+                *dest = HPX_MOVE(*first1);
+                ++first1;
+            }
+            ++dest;
+        }
+        dest = std::move(first1, last1, dest);
+        std::move(first2, last2, dest);
+    }
+
+    // Merge the sorted elements in the buffer [buf_first, buf_last) with
+    // the sorted range starting right after the space they occupied in the
+    // sequence, i.e. [out + (buf_last - buf_first), last), into [out, last).
+    //
+    // The first elements of the merged sequence fill exactly the free space
+    // in front of the second range, so they can be produced concurrently:
+    // the merge path of the free space is divided into chunks of equal size,
+    // which are merged independently of each other. Each such step consumes
+    // a part of the second range, which becomes the free space of the next
+    // step. The steps end once all elements of the buffer have been placed.
+    template <typename Exec, typename Iter, typename Value, typename Compare>
+    void parallel_half_merge(Exec& exec, std::size_t cores, Iter out,
+        Value* buf_first, Value* buf_last, Iter last, Compare& comp)
+    {
+        while (buf_first != buf_last)
+        {
+            std::size_t const count =
+                static_cast<std::size_t>(buf_last - buf_first);
+            Iter const first2 = out + count;
+            std::size_t const len2 = static_cast<std::size_t>(last - first2);
+
+            // merge the remaining elements sequentially if there are not
+            // enough of them for a parallel step
+            if (cores < 2 || count < merge_path_min_chunk_size || len2 == 0)
+            {
+                util::half_merge(buf_first, buf_last, first2, last, out, comp);
+                return;
+            }
+
+            std::size_t const taken1 = merge_path_search(buf_first, count,
+                first2, len2, count, comp, hpx::identity_v, hpx::identity_v);
+            std::size_t const taken2 = count - taken1;
+
+            std::size_t const num_chunks =
+                get_stable_sort_num_chunks(count, cores);
+            stable_sort_for_each_chunk(
+                exec, num_chunks, [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        get_merge_path_diagonal(chunk, num_chunks, count);
+                    std::size_t const end =
+                        get_merge_path_diagonal(chunk + 1, num_chunks, count);
+
+                    std::size_t const begin1 = merge_path_search(buf_first,
+                        taken1, first2, taken2, begin, comp, hpx::identity_v,
+                        hpx::identity_v);
+                    std::size_t const end1 = merge_path_search(buf_first,
+                        taken1, first2, taken2, end, comp, hpx::identity_v,
+                        hpx::identity_v);
+
+                    stable_sort_move_merge(buf_first + begin1,
+                        buf_first + end1, first2 + (begin - begin1),
+                        first2 + (end - end1), out + begin, comp);
+                });
+
+            out = first2;
+            buf_first += taken1;
+        }
+    }
+
+    // Destroys the elements moved into the buffer
+    template <typename Value>
+    struct destroy_buffer_guard
+    {
+        Value* first;
+        Value* last;
+
+        ~destroy_buffer_guard()
+        {
+            util::destroy(first, last);
+        }
+    };
+
+    // Merge the sorted ranges [first, middle) and [middle, last) by moving
+    // the first range into the (uninitialized) buffer
+    template <typename Exec, typename Iter, typename Value, typename Compare>
+    void buffered_merge(Exec& exec, std::size_t cores, Iter first,
+        Iter middle, Iter last, Value* buffer, Compare& comp)
+    {
+        std::size_t const count = static_cast<std::size_t>(middle - first);
+        parallel_uninit_move(exec, cores, first, count, buffer);
+
+        destroy_buffer_guard<Value> guard{buffer, buffer + count};
+        parallel_half_merge(
+            exec, cores, first, buffer, buffer + count, last, comp);
+    }
+
+    // Merge the sorted ranges [first, middle) and [middle, last) using a
+    // buffer of buffer_size elements. Ranges which don't fit into the buffer
+    // are split into two independent merges of smaller ranges: both ranges
+    // are divided at corresponding positions and the inner two parts are
+    // exchanged with a rotation.
+    template <typename Exec, typename Iter, typename Value, typename Compare>
+    void block_merge(Exec& exec, std::size_t cores, Iter first, Iter middle,
+        Iter last, Value* buffer, std::size_t buffer_size, Compare& comp)
+    {
+        std::size_t const len1 = static_cast<std::size_t>(middle - first);
+        std::size_t const len2 = static_cast<std::size_t>(last - middle);
+        if (len1 == 0 || len2 == 0 || !comp(*middle, *(middle - 1)))
+        {
+            return;
+        }
+
+        if (len1 <= buffer_size)
+        {
+            buffered_merge(exec, cores, first, middle, last, buffer, comp);
+            return;
+        }
+
+        Iter cut1 = first;
+        Iter cut2 = middle;
+        if (len1 >= len2)
+        {
+            cut1 += len1 / 2;
+            cut2 = std::lower_bound(middle, last, *cut1, comp);
+        }
+        else
+        {
+            cut2 += len2 / 2;
+            cut1 = std::upper_bound(first, middle, *cut2, comp);
+        }
+
+        Iter const new_middle =
+            parallel_rotate(exec, cores, cut1, middle, cut2);
+
+        block_merge(exec, cores, first, cut1, new_middle, buffer, buffer_size,
+            comp);
+        block_merge(exec, cores, new_middle, cut2, last, buffer, buffer_size,
+            comp);
+    }
+
     /// \struct parallel_stable_sort
     ///
     /// This a structure for to implement a parallel stable sort exception safe
@@ -34,9 +279,11 @@ namespace hpx::parallel::detail {
         util::range<Iter, Sent> range_initial;
         Compare comp;
         std::size_t nelem;
+        std::size_t memory_divisor;
         value_type* ptr;
 
-        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp);
+        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp,
+            std::size_t memory_divisor = 0);
 
         // / brief Perform sorting operation
         template <typename Exec>
@@ -52,6 +299,11 @@ namespace hpx::parallel::detail {
                 std::free(ptr);
             }
         }
+
+    private:
+        template <typename Exec>
+        void reduced_memory_sort(Exec& exec, std::uint32_t nthreads,
+            std::size_t chunk_size, std::size_t buffer_size);
     };    // end struct parallel_stable_sort
 
     /// \brief constructor of the typename
@@ -59,13 +311,16 @@ namespace hpx::parallel::detail {
     /// \param [in] first : range of elements to sort
     /// \param [in] last : range of elements to sort
     /// \param [in] comp : object for to compare two elements
+    /// \param [in] memory_divisor : use a buffer of N/memory_divisor elements
+    ///                 (N/2 elements if zero)
     template <typename Iter, typename Sent, typename Compare>
     parallel_stable_sort_helper<Iter, Sent,
         Compare>::parallel_stable_sort_helper(Iter first, Sent last,
-        Compare comp)
+        Compare comp, std::size_t memory_divisor)
       : range_initial(first, last)
       , comp(comp)
       , nelem(range_initial.size())
+      , memory_divisor(memory_divisor)
       , ptr(nullptr)
     {
         HPX_ASSERT(range_initial.size() >= 0);
@@ -79,9 +334,10 @@ namespace hpx::parallel::detail {
         try
         {
             std::size_t nptr = (nelem + 1) >> 1;
-            Iter last = range_initial.begin() + nelem;
+            Iter first = range_initial.begin();
+            Iter last = first + nelem;
 
-            if (nelem < chunk_size || nthreads < 2)
+            if (nelem < chunk_size || (nthreads < 2 && memory_divisor == 0))
             {
                 spin_sort(range_initial.begin(), range_initial.end(), comp);
                 return last;
@@ -95,30 +351,35 @@ namespace hpx::parallel::detail {
 
             // leave memory uninitialized, sample_sort will manage construction
             // etc.
-            ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
-            if (ptr == nullptr)
+            if (memory_divisor == 0)
+            {
+                ptr = static_cast<value_type*>(
+                    std::malloc(sizeof(value_type) * nptr));
+                if (ptr == nullptr)
+                {
+                    memory_divisor = stable_sort_fallback_memory_divisor;
+                }
+            }
+
+            if (memory_divisor != 0)
             {
-                throw std::bad_alloc();
+                std::size_t const buffer_size =
+                    (nelem + memory_divisor - 1) / memory_divisor;
+                reduced_memory_sort(exec, nthreads, chunk_size, buffer_size);
+                return last;
             }
 
             // Parallel Process
-            util::range<Iter, Sent> range_first(
-                range_initial.begin(), range_initial.begin() + nptr);
-            util::range<Iter, Sent> range_second(
-                range_initial.begin() + nptr, range_initial.end());
             util::range<value_type*> range_buffer(ptr, ptr + nptr);
 
-            sample_sort(exec, range_initial.begin(),
-                range_initial.begin() + nptr, comp, nthreads, range_buffer,
-                chunk_size);
+            sample_sort(exec, first, first + nptr, comp, nthreads,
+                range_buffer, chunk_size);
 
-            sample_sort(exec, range_initial.begin() + nptr, range_initial.end(),
-                comp, nthreads, range_buffer, chunk_size);
+            sample_sort(exec, first + nptr, last, comp, nthreads, range_buffer,
+                chunk_size);
 
-            range_buffer = parallel::util::init_move(range_buffer, range_first);
-            range_initial = parallel::util::half_merge(
-                range_initial, range_buffer, range_second, comp);
+            buffered_merge(
+                exec, nthreads, first, first + nptr, last, ptr, comp);
 
             return last;
         }
@@ -136,15 +397,52 @@ namespace hpx::parallel::detail {
         }
     }
 
+    // Sort using a buffer of buffer_size elements only: the runs of
+    // buffer_size elements are sorted independently, and then merged
+    // pairwise.
+    template <typename Iter, typename Sent, typename Compare>
+    template <typename Exec>
+    void parallel_stable_sort_helper<Iter, Sent, Compare>::reduced_memory_sort(
+        Exec& exec, std::uint32_t nthreads, std::size_t chunk_size,
+        std::size_t buffer_size)
+    {
+        buffer_size = (std::max)(buffer_size, std::size_t(1));
+        ptr = static_cast<value_type*>(
+            std::malloc(sizeof(value_type) * buffer_size));
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        Iter const first = range_initial.begin();
+        for (std::size_t pos = 0; pos < nelem; pos += buffer_size)
+        {
+            std::size_t const count = (std::min)(buffer_size, nelem - pos);
+            sample_sort(exec, first + pos, first + pos + count, comp, nthreads,
+                util::range<value_type*>(ptr, ptr + count), chunk_size);
+        }
+
+        for (std::size_t width = buffer_size; width < nelem; width *= 2)
+        {
+            for (std::size_t pos = 0; pos + width < nelem; pos += 2 * width)
+            {
+                std::size_t const end = (std::min)(pos + 2 * width, nelem);
+                block_merge(exec, nthreads, first + pos, first + pos + width,
+                    first + end, ptr, buffer_size, comp);
+            }
+        }
+    }
+
     template <typename Exec, typename Iter, typename Sent, typename Compare>
     Iter parallel_stable_sort(Exec&& exec, Iter first, Sent last,
-        std::size_t cores, std::size_t chunk_size, Compare&& comp)
+        std::size_t cores, std::size_t chunk_size, Compare&& comp,
+        std::size_t memory_divisor = 0)
     {
         using parallel_stable_sort_helper_t =
             parallel_stable_sort_helper<Iter, Sent, std::decay_t<Compare>>;
 
         parallel_stable_sort_helper_t sorter(
-            first, last, HPX_FORWARD(Compare, comp));
+            first, last, HPX_FORWARD(Compare, comp), memory_divisor);
 
         return sorter(HPX_FORWARD(Exec, exec), cores, chunk_size);
     }
@@ -0,0 +1,115 @@
+//  Copyright (c) 2014-2023 Hartmut Kaiser
+//  Copyright (c) 2017 Taeguk Kwon
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // sequential partition with projection function for bidirectional
+    // iterator.
+    template <typename BidirIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_bidirectional_iterator_v<BidirIter>)>
+    constexpr BidirIter sequential_partition_helper(
+        BidirIter first, BidirIter last, Pred&& pred, Proj&& proj)
+    {
+        while (true)
+        {
+            while (
+                first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+            {
+                ++first;
+            }
+            if (first == last)
+                break;
+
+            while (first != --last &&
+                !HPX_INVOKE(pred, HPX_INVOKE(proj, *last)))
+                ;
+            if (first == last)
+                break;
+
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+            std::ranges::iter_swap(first++, last);
+#else
+            std::iter_swap(first++, last);
+#endif
+        }
+
+        return first;
+    }
+
+    // sequential partition with projection function for forward iterator.
+    template <typename FwdIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::traits::is_forward_iterator_v<FwdIter> &&
+            !hpx::traits::is_bidirectional_iterator_v<FwdIter>)>
+    constexpr FwdIter sequential_partition_helper(
+        FwdIter first, FwdIter last, Pred&& pred, Proj&& proj)
+    {
+        while (first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+            ++first;
+
+        if (first == last)
+            return first;
+
+        for (FwdIter it = std::next(first); it != last; ++it)
+        {
+            if (HPX_INVOKE(pred, HPX_INVOKE(proj, *it)))
+            {
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(first++, it);
+#else
+                std::iter_swap(first++, it);
+#endif
+            }
+        }
+
+        return first;
+    }
+
+    // provide implementation of std::partition supporting projections
+    template <typename ExPolicy>
+    struct sequential_partition_t final
+      : hpx::functional::detail::tag_fallback<sequential_partition_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Pred, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_partition_t<ExPolicy>, FwdIter first, FwdIter last,
+            Pred&& pred, Proj&& proj)
+        {
+            return sequential_partition_helper(first, last,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_partition_t<ExPolicy> sequential_partition =
+        sequential_partition_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Pred, typename Proj>
+    constexpr FwdIter sequential_partition(
+        FwdIter first, FwdIter last, Pred&& pred, Proj&& proj)
+    {
+        return sequential_partition_t<ExPolicy>{}(
+            first, last, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
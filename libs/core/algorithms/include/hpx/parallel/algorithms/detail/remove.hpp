@@ -0,0 +1,62 @@
+//  Copyright (c) 2017 Taeguk Kwon
+//  Copyright (c) 2017-2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // provide implementation of std::remove_if supporting projections
+    template <typename ExPolicy>
+    struct sequential_remove_if_t final
+      : hpx::functional::detail::tag_fallback<sequential_remove_if_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Sent, typename Pred, typename Proj>
+        friend constexpr Iter tag_fallback_invoke(
+            sequential_remove_if_t<ExPolicy>, Iter first, Sent last,
+            Pred pred, Proj proj)
+        {
+            first = hpx::parallel::detail::sequential_find_if<
+                hpx::execution::sequenced_policy>(first, last, pred, proj);
+
+            if (first != last)
+            {
+                for (Iter i = first; ++i != last;)
+                    if (!HPX_INVOKE(pred, HPX_INVOKE(proj, *i)))
+                    {
+                        *first++ = HPX_MOVE(*i);
+                    }
+            }
+            return first;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_remove_if_t<ExPolicy> sequential_remove_if =
+        sequential_remove_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj>
+    constexpr Iter sequential_remove_if(
+        Iter first, Sent last, Pred pred, Proj proj)
+    {
+        return sequential_remove_if_t<ExPolicy>{}(
+            first, last, HPX_MOVE(pred), HPX_MOVE(proj));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
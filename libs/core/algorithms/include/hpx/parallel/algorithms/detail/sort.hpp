@@ -0,0 +1,46 @@
+//  Copyright (c) 2015-2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // sort the given (sub-)range using the (projected) comparison function,
+    // this is used for all leaves of the parallel sort
+    template <typename ExPolicy>
+    struct sequential_sort_t final
+      : hpx::functional::detail::tag_fallback<sequential_sort_t<ExPolicy>>
+    {
+    private:
+        template <typename RandomIt, typename Comp>
+        friend constexpr void tag_fallback_invoke(sequential_sort_t<ExPolicy>,
+            RandomIt first, RandomIt last, Comp&& comp)
+        {
+            std::sort(first, last, HPX_FORWARD(Comp, comp));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_sort_t<ExPolicy> sequential_sort =
+        sequential_sort_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    constexpr void sequential_sort(RandomIt first, RandomIt last, Comp&& comp)
+    {
+        return sequential_sort_t<ExPolicy>{}(
+            first, last, HPX_FORWARD(Comp, comp));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,68 @@
+//  Copyright (c) 2017 Taeguk Kwon
+//  Copyright (c) 2017-2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace hpx::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // provide implementation of std::unique supporting projections
+    template <typename ExPolicy>
+    struct sequential_unique_t final
+      : hpx::functional::detail::tag_fallback<sequential_unique_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Sent, typename Pred,
+            typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_unique_t<ExPolicy>, FwdIter first, Sent last,
+            Pred&& pred, Proj&& proj)
+        {
+            if (first == last)
+                return first;
+
+            using element_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            FwdIter result = first;
+            element_type result_projected = HPX_INVOKE(proj, *result);
+            while (++first != last)
+            {
+                if (!HPX_INVOKE(
+                        pred, result_projected, HPX_INVOKE(proj, *first)))
+                {
+                    if (++result != first)
+                    {
+                        *result = HPX_MOVE(*first);
+                    }
+                    result_projected = HPX_INVOKE(proj, *result);
+                }
+            }
+            return ++result;
+        }
+    };
+
+    // the execution policy selects the (vectorized) implementation, it
+    // defaults to the plain sequential one
+    template <typename ExPolicy = hpx::execution::sequenced_policy,
+        typename FwdIter, typename Sent, typename Pred, typename Proj>
+    constexpr FwdIter sequential_unique(
+        FwdIter first, Sent last, Pred&& pred, Proj&& proj)
+    {
+        return sequential_unique_t<ExPolicy>{}(
+            first, last, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -299,7 +299,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/result_types.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/parallel/util/scan_lookback_partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 #include <hpx/type_support/identity.hpp>
 
@@ -393,11 +393,12 @@ namespace hpx::parallel {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 3 steps.
-                // The first calculates the scan results for each partition. The
-                // second accumulates the result from left to right to be used
-                // by the third step--which operates on the same partitions the
-                // first step operated on.
+                // The overall scan algorithm is performed in a single pass
+                // over the input. The first step calculates the scan results
+                // for each partition. The second step combines the results of
+                // all preceding partitions (decoupled look-back) into the
+                // value the third step applies to the partition right after
+                // the first step has finished with it.
 
                 using hpx::get;
 
@@ -413,7 +414,7 @@ namespace hpx::parallel {
                         });
                 };
 
-                return util::scan_partitioner<ExPolicy,
+                return util::scan_lookback_partitioner<ExPolicy,
                     util::in_out_result<FwdIter1, FwdIter2>, T>::
                     call(
                         HPX_FORWARD(ExPolicy, policy),
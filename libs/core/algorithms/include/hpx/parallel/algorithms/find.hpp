@@ -777,6 +777,7 @@ namespace hpx {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
@@ -800,6 +801,70 @@ namespace hpx {
 
 namespace hpx::parallel {
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Synchronous searches over large random access sequences are run in
+        // waves of exponentially growing size starting from the front of the
+        // sequence. A match close to the beginning of the sequence ends the
+        // search after the first (small) wave instead of spawning tasks
+        // covering the whole sequence.
+        template <typename ExPolicy, typename Iter>
+        inline constexpr bool supports_speculative_find_v =
+            !hpx::is_async_execution_policy_v<ExPolicy> &&
+            !hpx::execution_policy_has_scheduler_executor_v<ExPolicy> &&
+            hpx::traits::is_random_access_iterator_v<Iter>;
+
+        // Run f1 over the given sequence in growing waves until the token
+        // signals a match. Returns false, if the sequence is not large enough
+        // for the waves to pay off, in which case nothing was done.
+        template <typename ExPolicy, typename Iter, typename Token,
+            typename F1>
+        bool speculative_find(ExPolicy& policy, Iter first, std::size_t count,
+            Token& tok, F1& f1)
+        {
+            // number of elements per core searched by the first wave
+            constexpr std::size_t first_wave_size = 4096;
+
+            std::size_t const cores =
+                execution::processing_units_count(policy.parameters(),
+                    policy.executor(), hpx::chrono::null_duration, count);
+
+            std::size_t size = cores * first_wave_size;
+            if (count < 4 * size)
+                return false;
+
+            using partitioner_type =
+                util::partitioner<std::decay_t<ExPolicy>, Iter, void>;
+
+            std::size_t offset = 0;
+            while (offset != count)
+            {
+                size = (std::min)(size, count - offset);
+
+                partitioner_type::call_with_index(
+                    policy, first + offset, size, 1,
+                    [f1, offset](Iter it, std::size_t part_size,
+                        std::size_t base_idx) mutable -> void {
+                        f1(it, part_size, base_idx + offset);
+                    },
+                    [](auto&&... data) -> void {
+                        if constexpr (sizeof...(data) == 1)
+                        {
+                            util::detail::clear_container(data...);
+                        }
+                    });
+
+                offset += size;
+                if (tok.was_cancelled(offset - 1))
+                    break;
+
+                size *= 2;
+            }
+            return true;
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     // find
     namespace detail {
@@ -879,6 +944,15 @@ namespace hpx::parallel {
                     return HPX_MOVE(first);
                 };
 
+                if constexpr (supports_speculative_find_v<policy_type, Iter>)
+                {
+                    if (speculative_find(policy, first,
+                            static_cast<std::size_t>(count), tok, f1))
+                    {
+                        return result::get(f2());
+                    }
+                }
+
                 using partitioner_type =
                     util::partitioner<policy_type, Iter, void>;
 
@@ -941,10 +1015,14 @@ namespace hpx::parallel {
                 };
 
                 auto f2 = [tok, count, first, last](
-                              auto&& data) mutable -> Iter {
-                    // make sure iterators embedded in the function objects that
-                    // are attached to futures are invalidated
-                    util::detail::clear_container(data);
+                              auto&&... data) mutable -> Iter {
+                    static_assert(sizeof...(data) < 2);
+                    if constexpr (sizeof...(data) == 1)
+                    {
+                        // make sure iterators embedded in the function objects
+                        // that are attached to futures are invalidated
+                        util::detail::clear_container(data...);
+                    }
 
                     auto find_res =
                         static_cast<difference_type>(tok.get_data());
@@ -960,6 +1038,15 @@ namespace hpx::parallel {
                     return HPX_MOVE(first);
                 };
 
+                if constexpr (supports_speculative_find_v<policy_type, Iter>)
+                {
+                    if (speculative_find(policy, first,
+                            static_cast<std::size_t>(count), tok, f1))
+                    {
+                        return result::get(f2());
+                    }
+                }
+
                 using partitioner_type =
                     util::partitioner<policy_type, Iter, void>;
                 return partitioner_type::call_with_index(
@@ -1021,10 +1108,14 @@ namespace hpx::parallel {
                 };
 
                 auto f2 = [tok, count, first, last](
-                              auto&& data) mutable -> Iter {
-                    // make sure iterators embedded in the function objects that
-                    // are attached to futures are invalidated
-                    util::detail::clear_container(data);
+                              auto&&... data) mutable -> Iter {
+                    static_assert(sizeof...(data) < 2);
+                    if constexpr (sizeof...(data) == 1)
+                    {
+                        // make sure iterators embedded in the function objects
+                        // that are attached to futures are invalidated
+                        util::detail::clear_container(data...);
+                    }
 
                     auto find_res =
                         static_cast<difference_type>(tok.get_data());
@@ -1040,6 +1131,15 @@ namespace hpx::parallel {
                     return HPX_MOVE(first);
                 };
 
+                if constexpr (supports_speculative_find_v<policy_type, Iter>)
+                {
+                    if (speculative_find(policy, first,
+                            static_cast<std::size_t>(count), tok, f1))
+                    {
+                        return result::get(f2());
+                    }
+                }
+
                 using partitioner_type =
                     util::partitioner<policy_type, Iter, void>;
                 return partitioner_type::call_with_index(
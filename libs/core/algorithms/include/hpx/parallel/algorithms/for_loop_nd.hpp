@@ -0,0 +1,463 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_nd.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space [0, extents[0]) x ... x [0, extents[N-1]). The index space
+    /// is divided into tiles, which are visited in Morton (Z-curve) order.
+    /// Within a tile, the last dimension varies fastest.
+    ///
+    /// The execution of for_loop_nd without specifying an execution policy is
+    /// equivalent to specifying \a hpx::execution::seq as the execution
+    /// policy.
+    ///
+    /// \tparam I           The type of the iteration variables. This must be
+    ///                     an integral type.
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam F           The type of the function (object) to invoke.
+    ///
+    /// \param extents      The number of iterations in each of the
+    ///                     dimensions.
+    /// \param f            The function (or function object) which will be
+    ///                     invoked for each point of the index space. It
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> f(I i0, I i1, ..., I iN-1);
+    ///                     \endcode \n
+    ///
+    /// The tiles are sized such that the data of all points of a tile (at 8
+    /// bytes per point) fits into the level 1 data cache of the first core,
+    /// as reported by \a hpx::threads::topology.
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the index
+    ///             space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    template <typename I, std::size_t N, typename F>
+    void for_loop_nd(std::array<I, N> const& extents, F&& f);
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space [0, extents[0]) x ... x [0, extents[N-1]). The index space
+    /// is divided into tiles of the given size, which are visited in Morton
+    /// (Z-curve) order. Within a tile, the last dimension varies fastest.
+    ///
+    /// \tparam I           The type of the iteration variables. This must be
+    ///                     an integral type.
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam F           The type of the function (object) to invoke.
+    ///
+    /// \param extents      The number of iterations in each of the
+    ///                     dimensions.
+    /// \param tile         The number of iterations of a tile in each of the
+    ///                     dimensions. All elements must be positive.
+    /// \param f            The function (or function object) which will be
+    ///                     invoked for each point of the index space. It
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> f(I i0, I i1, ..., I iN-1);
+    ///                     \endcode \n
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the index
+    ///             space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    template <typename I, std::size_t N, typename F>
+    void for_loop_nd(std::array<I, N> const& extents,
+        std::array<I, N> const& tile, F&& f);
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space [0, extents[0]) x ... x [0, extents[N-1]). The index space
+    /// is divided into tiles, which are visited in Morton (Z-curve) order.
+    /// Within a tile, the last dimension varies fastest. Executed according
+    /// to the policy.
+    ///
+    /// The tiles are distributed over the executor of the policy like the
+    /// iterations of \a hpx::experimental::for_loop, i.e. consecutive tiles
+    /// along the Morton curve are combined into chunks according to the
+    /// executor parameters of the policy.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam I           The type of the iteration variables. This must be
+    ///                     an integral type.
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam F           The type of the function (object) to invoke.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param extents      The number of iterations in each of the
+    ///                     dimensions.
+    /// \param f            The function (or function object) which will be
+    ///                     invoked for each point of the index space. It
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> f(I i0, I i1, ..., I iN-1);
+    ///                     \endcode \n
+    ///
+    /// The tiles are sized such that the data of all points of a tile (at 8
+    /// bytes per point) fits into the level 1 data cache of the first core,
+    /// as reported by \a hpx::threads::topology.
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the index
+    ///             space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    /// \returns  The \a for_loop_nd algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a hpx::execution::sequenced_task_policy or
+    ///           \a hpx::execution::parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename I, std::size_t N, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    for_loop_nd(ExPolicy&& policy, std::array<I, N> const& extents, F&& f);
+
+    /// The for_loop_nd implements loop functionality over an N-dimensional
+    /// index space [0, extents[0]) x ... x [0, extents[N-1]). The index space
+    /// is divided into tiles of the given size, which are visited in Morton
+    /// (Z-curve) order. Within a tile, the last dimension varies fastest.
+    /// Executed according to the policy.
+    ///
+    /// The tiles are distributed over the executor of the policy like the
+    /// iterations of \a hpx::experimental::for_loop, i.e. consecutive tiles
+    /// along the Morton curve are combined into chunks according to the
+    /// executor parameters of the policy.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam I           The type of the iteration variables. This must be
+    ///                     an integral type.
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam F           The type of the function (object) to invoke.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param extents      The number of iterations in each of the
+    ///                     dimensions.
+    /// \param tile         The number of iterations of a tile in each of the
+    ///                     dimensions. All elements must be positive.
+    /// \param f            The function (or function object) which will be
+    ///                     invoked for each point of the index space. It
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> f(I i0, I i1, ..., I iN-1);
+    ///                     \endcode \n
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the index
+    ///             space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    /// \returns  The \a for_loop_nd algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a hpx::execution::sequenced_task_policy or
+    ///           \a hpx::execution::parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename I, std::size_t N, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    for_loop_nd(ExPolicy&& policy, std::array<I, N> const& extents,
+        std::array<I, N> const& tile, F&& f);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/errors/error_code.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // for_loop_nd
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // Number of points of a default tile, chosen such that 8 bytes per
+        // point fit into the level 1 data cache
+        inline std::size_t get_for_loop_nd_tile_points()
+        {
+            static std::size_t const points = []() -> std::size_t {
+                auto const& topo = hpx::threads::create_topology();
+
+                hpx::error_code ec(hpx::throwmode::lightweight);
+                std::size_t cache_size =
+                    topo.get_cache_size(topo.get_core_affinity_mask(0, ec), 1);
+                if (ec || cache_size == 0)
+                {
+                    cache_size = 32768;    // a reasonable default
+                }
+                return (std::max)(cache_size / 8, std::size_t(64));
+            }();
+            return points;
+        }
+
+        // Choose a tile of roughly the default tile size, stretching the
+        // last (contiguous) dimension if the tile is clipped elsewhere
+        template <typename I, std::size_t N>
+        std::array<I, N> get_for_loop_nd_tile(std::array<I, N> const& extents)
+        {
+            std::size_t const points = get_for_loop_nd_tile_points();
+            auto const edge = (std::max)(
+                static_cast<std::size_t>(std::pow(static_cast<double>(points),
+                    1.0 / static_cast<double>(N))),
+                std::size_t(1));
+
+            std::array<I, N> tile;
+            std::size_t outer_points = 1;
+            for (std::size_t d = 0; d != N - 1; ++d)
+            {
+                tile[d] = static_cast<I>((std::max)(
+                    (std::min)(static_cast<std::size_t>(extents[d]), edge),
+                    std::size_t(1)));
+                outer_points *= static_cast<std::size_t>(tile[d]);
+            }
+            tile[N - 1] = static_cast<I>((std::max)(
+                (std::min)(static_cast<std::size_t>(extents[N - 1]),
+                    points / outer_points),
+                std::size_t(1)));
+            return tile;
+        }
+
+        // Interleave the bits of the coordinates of a tile
+        template <std::size_t N>
+        constexpr std::uint64_t morton_encode(
+            std::array<std::size_t, N> const& coords) noexcept
+        {
+            constexpr std::size_t bits = 64 / N;
+
+            std::uint64_t code = 0;
+            for (std::size_t b = 0; b != bits; ++b)
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    code |= ((static_cast<std::uint64_t>(coords[d]) >> b) & 1)
+                        << (b * N + (N - 1 - d));
+                }
+            }
+            return code;
+        }
+
+        template <std::size_t N>
+        std::array<std::size_t, N> tile_coordinates(std::size_t tile_index,
+            std::array<std::size_t, N> const& num_tiles) noexcept
+        {
+            std::array<std::size_t, N> coords;
+            for (std::size_t d = N; d != 0; --d)
+            {
+                coords[d - 1] = tile_index % num_tiles[d - 1];
+                tile_index /= num_tiles[d - 1];
+            }
+            return coords;
+        }
+
+        // Linear indices of all tiles, sorted along the Morton curve
+        template <std::size_t N>
+        std::vector<std::size_t> get_morton_tile_order(
+            std::array<std::size_t, N> const& num_tiles)
+        {
+            std::size_t total = 1;
+            for (std::size_t n : num_tiles)
+            {
+                total *= n;
+            }
+
+            std::vector<std::pair<std::uint64_t, std::size_t>> keys;
+            keys.reserve(total);
+            for (std::size_t i = 0; i != total; ++i)
+            {
+                keys.emplace_back(
+                    morton_encode(tile_coordinates(i, num_tiles)), i);
+            }
+            std::sort(keys.begin(), keys.end());
+
+            std::vector<std::size_t> order;
+            order.reserve(total);
+            for (auto const& key : keys)
+            {
+                order.push_back(key.second);
+            }
+            return order;
+        }
+
+        template <std::size_t D, typename I, std::size_t N, typename F>
+        HPX_FORCEINLINE void for_loop_nd_tile(std::array<I, N> const& first,
+            std::array<I, N> const& last, std::array<I, N>& idx, F& f)
+        {
+            if constexpr (D == N)
+            {
+                std::apply([&](auto... is) { HPX_INVOKE(f, is...); }, idx);
+            }
+            else
+            {
+                for (idx[D] = first[D]; idx[D] != last[D]; ++idx[D])
+                {
+                    for_loop_nd_tile<D + 1>(first, last, idx, f);
+                }
+            }
+        }
+
+        template <typename ExPolicy, typename I, std::size_t N, typename F>
+        util::detail::algorithm_result_t<ExPolicy> for_loop_nd(
+            ExPolicy&& policy, std::array<I, N> const& extents,
+            std::array<I, N> const& tile, F&& f)
+        {
+            std::array<std::size_t, N> num_tiles;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (!(tile[d] > I(0)))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::experimental::for_loop_nd",
+                        "all tile dimensions must be positive");
+                }
+                if (!(extents[d] > I(0)))
+                {
+                    return util::detail::algorithm_result<ExPolicy>::get();
+                }
+
+                auto const extent = static_cast<std::size_t>(extents[d]);
+                auto const size = static_cast<std::size_t>(tile[d]);
+                num_tiles[d] = (extent + size - 1) / size;
+            }
+
+            auto order = std::make_shared<std::vector<std::size_t> const>(
+                get_morton_tile_order(num_tiles));
+            std::size_t const total = order->size();
+
+            return hpx::experimental::for_loop(HPX_FORWARD(ExPolicy, policy),
+                std::size_t(0), total,
+                [order = HPX_MOVE(order), num_tiles, extents, tile,
+                    f = HPX_FORWARD(F, f)](std::size_t i) mutable {
+                    std::array<std::size_t, N> const coords =
+                        tile_coordinates((*order)[i], num_tiles);
+
+                    std::array<I, N> first, last, idx;
+                    for (std::size_t d = 0; d != N; ++d)
+                    {
+                        auto const size = static_cast<std::size_t>(tile[d]);
+                        std::size_t const begin = coords[d] * size;
+                        first[d] = static_cast<I>(begin);
+                        last[d] = static_cast<I>((std::min)(begin + size,
+                            static_cast<std::size_t>(extents[d])));
+                    }
+                    for_loop_nd_tile<0>(first, last, idx, f);
+                });
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct for_loop_nd_t final
+      : hpx::detail::tag_parallel_algorithm<for_loop_nd_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                std::is_integral_v<I> && (N != 0)
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::for_loop_nd_t,
+            ExPolicy&& policy, std::array<I, N> const& extents,
+            std::array<I, N> const& tile, F&& f)
+        {
+            return hpx::parallel::detail::for_loop_nd(
+                HPX_FORWARD(ExPolicy, policy), extents, tile,
+                HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                std::is_integral_v<I> && (N != 0)
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::for_loop_nd_t,
+            ExPolicy&& policy, std::array<I, N> const& extents, F&& f)
+        {
+            return hpx::parallel::detail::for_loop_nd(
+                HPX_FORWARD(ExPolicy, policy), extents,
+                hpx::parallel::detail::get_for_loop_nd_tile(extents),
+                HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_integral_v<I> && (N != 0)
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_nd_t,
+            std::array<I, N> const& extents, std::array<I, N> const& tile,
+            F&& f)
+        {
+            hpx::parallel::detail::for_loop_nd(
+                hpx::execution::seq, extents, tile, HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_integral_v<I> && (N != 0)
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_nd_t,
+            std::array<I, N> const& extents, F&& f)
+        {
+            hpx::parallel::detail::for_loop_nd(hpx::execution::seq, extents,
+                hpx::parallel::detail::get_for_loop_nd_tile(extents),
+                HPX_FORWARD(F, f));
+        }
+    } for_loop_nd{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
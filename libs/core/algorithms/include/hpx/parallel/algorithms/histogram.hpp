@@ -0,0 +1,444 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Counts the elements in the range [first, last) falling into each of
+    /// the bins of the given range. The function \a f maps every element to
+    /// the index of its bin, elements mapped to an index outside of
+    /// [0, std::size(bins)) are not counted. The number of elements mapped to
+    /// each bin is added to the value the bin holds on entry, which allows to
+    /// accumulate histograms over several ranges.
+    ///
+    /// \note   Complexity: Exactly std::distance(first, last) applications
+    ///         of \a f.
+    ///
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Bins        The type of the range of bins (deduced). The
+    ///                     iterators of the range must meet the requirements
+    ///                     of a random access iterator, its value type has to
+    ///                     be an arithmetic type.
+    /// \tparam F           The type of the function mapping the elements onto
+    ///                     their bins (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param bins         Refers to the range of bins the elements are
+    ///                     counted in.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). The signature
+    ///                     of this function should be equivalent to:
+    ///                     \code
+    ///                     std::size_t f(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&. The
+    ///                     type \a Type must be such that an object of type
+    ///                     \a FwdIter can be dereferenced and then implicitly
+    ///                     converted to Type. The returned index may be of any
+    ///                     integral type.
+    ///
+    /// \returns  The \a histogram algorithm returns \a void.
+    template <typename FwdIter, typename Bins, typename F>
+    void histogram(FwdIter first, FwdIter last, Bins&& bins, F&& f);
+
+    /// Counts the elements in the range [first, last) falling into each of
+    /// the bins of the given range. The function \a f maps every element to
+    /// the index of its bin, elements mapped to an index outside of
+    /// [0, std::size(bins)) are not counted. The number of elements mapped to
+    /// each bin is added to the value the bin holds on entry, which allows to
+    /// accumulate histograms over several ranges. Executed according to the
+    /// policy.
+    ///
+    /// The parallel algorithm splits the range into chunks that count their
+    /// elements in private bins concurrently, which avoids any contention
+    /// between the chunks. The private bins are combined using a tree
+    /// reduction. If executed using a vectorizing execution policy (\a simd
+    /// or \a par_simd), \a f may be invoked with whole vector packs of
+    /// elements, in which case it has to return a vector pack of bin indices.
+    /// Small numbers of bins are then updated without branching on the bin
+    /// indices.
+    ///
+    /// \note   Complexity: Exactly std::distance(first, last) applications
+    ///         of \a f. The parallel algorithm needs additional memory for
+    ///         std::size(bins) counters per chunk.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the invocations of \a f.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Bins        The type of the range of bins (deduced). The
+    ///                     iterators of the range must meet the requirements
+    ///                     of a random access iterator, its value type has to
+    ///                     be an arithmetic type.
+    /// \tparam F           The type of the function mapping the elements onto
+    ///                     their bins (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param bins         Refers to the range of bins the elements are
+    ///                     counted in. The range has to stay valid until the
+    ///                     algorithm has finished executing.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). The signature
+    ///                     of this function should be equivalent to:
+    ///                     \code
+    ///                     std::size_t f(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&. The
+    ///                     type \a Type must be such that an object of type
+    ///                     \a FwdIter can be dereferenced and then implicitly
+    ///                     converted to Type. The returned index may be of any
+    ///                     integral type.
+    ///
+    /// The invocations of \a f in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a f in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void otherwise.
+    template <typename ExPolicy, typename FwdIter, typename Bins, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    histogram(
+        ExPolicy&& policy, FwdIter first, FwdIter last, Bins&& bins, F&& f);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // Minimal number of elements handled by a single chunk
+        inline constexpr std::size_t histogram_limit_per_task = 65536ul;
+
+        // The private bins of the chunks are combined sequentially if their
+        // overall number does not exceed this limit
+        inline constexpr std::size_t histogram_sequential_merge_limit =
+            65536ul;
+
+        template <typename BinIter>
+        void histogram_add(
+            BinIter bins, std::vector<std::size_t> const& counts) noexcept
+        {
+            using value_type = hpx::traits::iter_value_t<BinIter>;
+
+            for (std::size_t const count : counts)
+            {
+                *bins += static_cast<value_type>(count);
+                ++bins;
+            }
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename BinIter,
+            typename F>
+        void parallel_histogram(ExPolicy&& policy, FwdIter first,
+            std::size_t count, BinIter bins, std::size_t num_bins, F& f)
+        {
+            using policy_type = std::decay_t<ExPolicy>;
+
+            // figure out the chunk size to use
+            std::size_t const cores =
+                execution::processing_units_count(policy.parameters(),
+                    policy.executor(), hpx::chrono::null_duration, count);
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, cores, count);
+
+            util::detail::adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // we should not get smaller than our histogram_limit_per_task
+            chunk_size = (std::max)(chunk_size, histogram_limit_per_task);
+
+            std::size_t const num_chunks =
+                (count + chunk_size - 1) / chunk_size;
+
+            if (num_chunks <= 1)
+            {
+                std::vector<std::size_t> counts(num_bins);
+                sequential_histogram<policy_type>(
+                    first, count, counts.data(), num_bins, f);
+                histogram_add(bins, counts);
+                return;
+            }
+
+            // run the given function for the given number of tasks
+            // concurrently
+            auto const for_each_task = [&](std::size_t num_tasks,
+                                           auto&& task) {
+                auto&& items = execution::bulk_async_execute(policy.executor(),
+                    HPX_FORWARD(decltype(task), task),
+                    hpx::util::counting_shape(num_tasks));
+
+                // wait for all tasks to finish
+                if (hpx::wait_all_nothrow(items))
+                {
+                    // always rethrow if items has at least one exceptional
+                    // future
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        items);
+                }
+            };
+
+            // the beginning of every chunk
+            std::vector<FwdIter> chunk_first;
+            chunk_first.reserve(num_chunks);
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                chunk_first.push_back(first);
+                if (chunk != num_chunks - 1)
+                {
+                    std::advance(first, chunk_size);
+                }
+            }
+
+            // count the elements of all chunks in their private bins
+            std::vector<std::vector<std::size_t>> counts(num_chunks);
+            for_each_task(num_chunks, [&](std::size_t chunk) {
+                std::size_t const begin = chunk * chunk_size;
+                std::size_t const n = (std::min)(chunk_size, count - begin);
+
+                counts[chunk].resize(num_bins);
+                sequential_histogram<policy_type>(
+                    chunk_first[chunk], n, counts[chunk].data(), num_bins, f);
+            });
+
+            // combine the private bins using a tree reduction, every level
+            // adds the bins of pairs of chunks concurrently
+            auto const merge = [&](std::size_t dest, std::size_t src) {
+                std::vector<std::size_t>& lhs = counts[dest];
+                std::vector<std::size_t> const& rhs = counts[src];
+                for (std::size_t bin = 0; bin != num_bins; ++bin)
+                {
+                    lhs[bin] += rhs[bin];
+                }
+            };
+
+            bool const merge_sequentially =
+                num_bins * num_chunks <= histogram_sequential_merge_limit;
+
+            for (std::size_t stride = 1; stride < num_chunks; stride *= 2)
+            {
+                std::size_t const num_merges =
+                    (num_chunks - stride + 2 * stride - 1) / (2 * stride);
+
+                if (merge_sequentially)
+                {
+                    for (std::size_t i = 0; i != num_merges; ++i)
+                    {
+                        merge(2 * stride * i, 2 * stride * i + stride);
+                    }
+                }
+                else
+                {
+                    for_each_task(num_merges, [&, stride](std::size_t i) {
+                        merge(2 * stride * i, 2 * stride * i + stride);
+                    });
+                }
+            }
+
+            histogram_add(bins, counts[0]);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename FwdIter>
+        struct histogram : public algorithm<histogram<FwdIter>, FwdIter>
+        {
+            constexpr histogram() noexcept
+              : algorithm<histogram, FwdIter>("histogram")
+            {
+            }
+
+            template <typename ExPolicy, typename BinIter, typename F>
+            static FwdIter sequential(ExPolicy, FwdIter first, FwdIter last,
+                BinIter bins, std::size_t num_bins, F&& f)
+            {
+                std::vector<std::size_t> counts(num_bins);
+                sequential_histogram<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(std::distance(first, last)),
+                    counts.data(), num_bins, f);
+
+                histogram_add(bins, counts);
+                return last;
+            }
+
+            template <typename ExPolicy, typename BinIter, typename F>
+            static util::detail::algorithm_result_t<ExPolicy, FwdIter>
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                BinIter bins, std::size_t num_bins, F&& f)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, FwdIter>;
+
+                auto const count =
+                    static_cast<std::size_t>(std::distance(first, last));
+
+                try
+                {
+                    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                    {
+                        return algorithm_result::get(
+                            execution::async_execute(policy.executor(),
+                                [policy, first, last, count, bins, num_bins,
+                                    f = HPX_FORWARD(F, f)]() mutable
+                                -> FwdIter {
+                                    parallel_histogram(policy, first, count,
+                                        bins, num_bins, f);
+                                    return last;
+                                }));
+                    }
+                    else
+                    {
+                        parallel_histogram(HPX_FORWARD(ExPolicy, policy),
+                            first, count, bins, num_bins, f);
+                        return algorithm_result::get(HPX_MOVE(last));
+                    }
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, FwdIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::histogram
+    inline constexpr struct histogram_t final
+      : hpx::detail::tag_parallel_algorithm<histogram_t>
+    {
+        // clang-format off
+        template <typename FwdIter, typename Bins, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_range_v<Bins> &&
+                hpx::is_invocable_v<F,
+                    hpx::traits::iter_reference_t<FwdIter>>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::histogram_t,
+            FwdIter first, FwdIter last, Bins&& bins, F&& f)
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<
+                              hpx::traits::range_iterator_t<Bins>>,
+                "Requires a random access range of bins.");
+
+            hpx::parallel::detail::histogram<FwdIter>().call(
+                hpx::execution::seq, first, last, hpx::util::begin(bins),
+                hpx::util::size(bins), HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Bins,
+            typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_range_v<Bins> &&
+                hpx::is_invocable_v<F,
+                    hpx::traits::iter_reference_t<FwdIter>>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::histogram_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, Bins&& bins, F&& f)
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<
+                              hpx::traits::range_iterator_t<Bins>>,
+                "Requires a random access range of bins.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::detail::histogram<FwdIter>().call(
+                       HPX_FORWARD(ExPolicy, policy), first, last,
+                       hpx::util::begin(bins), hpx::util::size(bins),
+                       HPX_FORWARD(F, f));
+        }
+    } histogram{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -287,8 +287,8 @@ namespace hpx {
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
-#include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -352,125 +352,43 @@ namespace hpx::parallel {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        struct lower_bound_helper;
-
-        struct upper_bound_helper
+        // Every chunk determines its part of both input ranges using merge
+        // path partitioning and merges them directly into the destination.
+        // All chunks produce the same number of elements.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Iter3, typename Comp, typename Proj1, typename Proj2>
+        void merge_path_merge(ExPolicy& policy, Iter1 first1, std::size_t len1,
+            Iter2 first2, std::size_t len2, Iter3 dest, Comp& comp,
+            Proj1& proj1, Proj2& proj2)
         {
-            // upper_bound with projection function.
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::upper_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = lower_bound_helper;
-        };
-
-        struct lower_bound_helper
-        {
-            // lower_bound with projection function.
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::lower_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = upper_bound_helper;
-        };
-
-        ///////////////////////////////////////////////////////////////////////
-        template <typename ExPolicy, typename Iter1, typename Sent1,
-            typename Iter2, typename Sent2, typename Iter3, typename Comp,
-            typename Proj1, typename Proj2, typename BinarySearchHelper>
-        void parallel_merge_helper(ExPolicy policy, Iter1 first1, Sent1 last1,
-            Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
-            Proj2&& proj2, bool range_reversal, BinarySearchHelper)
-        {
-            constexpr std::size_t threshold = 65536;
-
-            std::size_t const size1 = detail::distance(first1, last1);
-            std::size_t const size2 = detail::distance(first2, last2);
-
-            // Perform sequential merge if data size is smaller than threshold.
-            if (size1 + size2 <= threshold)
-            {
-                if (range_reversal)
-                {
-                    sequential_merge(first2, last2, first1, last1, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                        HPX_FORWARD(Proj1, proj1));
-                }
-                else
-                {
-                    sequential_merge(first1, last1, first2, last2, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
-                        HPX_FORWARD(Proj2, proj2));
-                }
-                return;
-            }
+            std::size_t const count = len1 + len2;
+            std::size_t const num_chunks =
+                get_merge_path_num_chunks(policy, count);
 
-            // Let size1 is bigger than size2 always.
-            if (size1 < size2)
+            if (num_chunks <= 1)
             {
-                // For stability of algorithm, must switch binary search methods
-                // when swapping size1 and size2.
-                parallel_merge_helper(policy, first2, last2, first1, last1,
-                    dest, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                    HPX_FORWARD(Proj1, proj1), !range_reversal,
-                    typename BinarySearchHelper::another_type());
+                sequential_merge(first1, first1 + len1, first2, first2 + len2,
+                    dest, comp, proj1, proj2);
                 return;
             }
 
-            HPX_ASSERT(size1 >= size2);
-            HPX_ASSERT(size1 >= 1ul);
-
-            Iter1 mid1 = first1 + size1 / 2;
-            Iter2 boundary2 = BinarySearchHelper::call(
-                first2, last2, HPX_INVOKE(proj1, *mid1), comp, proj2);
-            Iter3 target = dest + (mid1 - first1) + (boundary2 - first2);
-
-            *target = *mid1;
+            auto merge_chunk = [&](std::size_t chunk) {
+                std::size_t const diag_begin =
+                    get_merge_path_diagonal(chunk, num_chunks, count);
+                std::size_t const diag_end =
+                    get_merge_path_diagonal(chunk + 1, num_chunks, count);
 
-            hpx::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
-                    // Process left side ranges.
-                    parallel_merge_helper(policy, first1, mid1, first2,
-                        boundary2, dest, comp, proj1, proj2, range_reversal,
-                        BinarySearchHelper());
-                });
+                std::size_t const begin1 = merge_path_search(
+                    first1, len1, first2, len2, diag_begin, comp, proj1, proj2);
+                std::size_t const end1 = merge_path_search(
+                    first1, len1, first2, len2, diag_end, comp, proj1, proj2);
 
-            try
-            {
-                // Process right side ranges.
-                parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                    target + 1, HPX_FORWARD(Comp, comp),
-                    HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2),
-                    range_reversal, BinarySearchHelper());
-            }
-            catch (...)
-            {
-                fut.wait();
-
-                std::vector<hpx::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(HPX_MOVE(fut));
-                futures.emplace_back(hpx::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                util::detail::handle_local_exceptions<ExPolicy>::call(
-                    futures, errors);
-
-                HPX_UNREACHABLE;
-            }
+                sequential_merge(first1 + begin1, first1 + end1,
+                    first2 + (diag_begin - begin1), first2 + (diag_end - end1),
+                    dest + diag_begin, comp, proj1, proj2);
+            };
 
-            fut.get();
+            merge_path_for_each_chunk(policy, num_chunks, merge_chunk);
         }
 
         template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -490,12 +408,12 @@ namespace hpx::parallel {
                               Proj2, proj2)]() mutable -> result_type {
                 try
                 {
-                    parallel_merge_helper(HPX_MOVE(policy), first1, last1,
-                        first2, last2, dest, HPX_MOVE(comp), HPX_MOVE(proj1),
-                        HPX_MOVE(proj2), false, lower_bound_helper());
-
                     auto const len1 = detail::distance(first1, last1);
                     auto const len2 = detail::distance(first2, last2);
+
+                    merge_path_merge(policy, first1, len1, first2, len2, dest,
+                        comp, proj1, proj2);
+
                     return {std::next(first1, len1), std::next(first2, len2),
                         std::next(dest, len1 + len2)};
                 }
@@ -583,135 +501,77 @@ namespace hpx::parallel {
             return last;
         }
 
+        // The merge path split of the middle output position divides the
+        // problem into two independent halves of equal size: rotating the
+        // elements of both ranges that belong to the left half in front of
+        // the ones belonging to the right half leaves two smaller inplace
+        // merges.
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         void parallel_inplace_merge_helper(ExPolicy&& policy, Iter first,
             Iter middle, Sent last, Comp&& comp, Proj&& proj)
         {
             constexpr std::size_t threshold = 65536ul;
-            static_assert(threshold >= 5ul);
 
             std::size_t const left_size = middle - first;
             std::size_t const right_size = last - middle;
 
             // Perform sequential inplace_merge
             //   if data size is smaller than threshold.
-            if (left_size + right_size <= threshold)
+            if (left_size + right_size <= threshold || left_size == 0 ||
+                right_size == 0)
             {
                 sequential_inplace_merge(first, middle, last,
                     HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
                 return;
             }
 
-            if (left_size >= right_size)
-            {
-                // Means that always 'pivot' < 'middle'.
-                HPX_ASSERT(left_size >= 3ul);
-
-                // Select pivot in left-side range.
-                Iter pivot = first + left_size / 2;
-                Iter boundary = lower_bound_helper::call(
-                    middle, last, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = pivot + (boundary - middle);
-
-                // Swap two blocks, [pivot, middle) and [middle, boundary).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(pivot, middle, boundary);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, pivot, target, comp, proj);
-                    });
-
-                try
-                {
-                    // Process the range which is right-side of 'target'.
-                    parallel_inplace_merge_helper(
-                        policy, target + 1, boundary, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
+            std::size_t const diag = (left_size + right_size) / 2;
+            std::size_t const left_part = merge_path_search(
+                first, left_size, middle, right_size, diag, comp, proj, proj);
+            std::size_t const right_part = diag - left_part;
 
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
+            // Swap two blocks, [first + left_part, middle) and
+            //   [middle, middle + right_part).
+            // After this, [first, split) holds the smallest 'diag' elements
+            //   and [split, last) holds the remaining ones.
+            Iter const split = first + diag;
+            detail::sequential_rotate(
+                first + left_part, middle, middle + right_part);
 
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
-
-                    HPX_UNREACHABLE;
-                }
+            hpx::future<void> fut =
+                execution::async_execute(policy.executor(), [&]() -> void {
+                    // Process the range which is left-side of 'split'.
+                    parallel_inplace_merge_helper(
+                        policy, first, first + left_part, split, comp, proj);
+                });
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            try
+            {
+                // Process the range which is right-side of 'split'.
+                parallel_inplace_merge_helper(policy, split,
+                    split + (left_size - left_part), last, comp, proj);
             }
-            else    // left_size < right_size
+            catch (...)
             {
-                // Means that always 'pivot' < 'last'.
-                HPX_ASSERT(right_size >= 3ul);
-
-                // Select pivot in right-side range.
-                Iter pivot = middle + right_size / 2;
-                Iter boundary = upper_bound_helper::call(
-                    first, middle, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = boundary + (pivot - middle);
-
-                // Swap two blocks, [boundary, middle) and [middle, pivot+1).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(boundary, middle, pivot + 1);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, boundary, target, comp, proj);
-                    });
-
-                try
-                {
-                    // Process the range which is right-side of 'target'.
-                    parallel_inplace_merge_helper(
-                        policy, target + 1, pivot + 1, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
+                fut.wait();
 
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
+                std::vector<hpx::future<void>> futures;
+                futures.reserve(2);
+                futures.emplace_back(HPX_MOVE(fut));
+                futures.emplace_back(hpx::make_exceptional_future<void>(
+                    std::current_exception()));
 
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
 
-                    HPX_UNREACHABLE;
-                }
+                HPX_UNREACHABLE;
+            }
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            if (fut.valid())    // NOLINT
+            {
+                fut.get();
             }
         }
 
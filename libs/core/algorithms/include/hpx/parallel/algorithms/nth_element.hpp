@@ -138,10 +138,12 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
@@ -287,6 +289,26 @@ namespace hpx::parallel {
                         detail::advance_to_sentinel(first, last);
                     return_last = last_iter;
 
+                    if constexpr (is_parallel_select_supported_v<RandomIt>)
+                    {
+                        // narrow down the range containing the nth element
+                        // in parallel, then finish sequentially
+                        util::compare_projected<Pred&, Proj&> comp(pred, proj);
+                        auto const [sub_first, sub_last] = parallel_select(
+                            policy, first, nth, last_iter, comp);
+
+                        if (sub_first != sub_last)
+                        {
+                            std::uint32_t const level =
+                                detail::nbits64(sub_last - sub_first) * 2;
+                            detail::nth_element_seq(sub_first, nth, sub_last,
+                                level, comp, hpx::identity_v);
+                        }
+
+                        return util::detail::algorithm_result<ExPolicy,
+                            RandomIt>::get(HPX_MOVE(return_last));
+                    }
+
                     while (first != last_iter)
                     {
                         detail::pivot9(first, last_iter, pred);
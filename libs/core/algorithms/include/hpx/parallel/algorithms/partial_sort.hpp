@@ -117,6 +117,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -499,6 +500,31 @@ namespace hpx::parallel {
             }
         }
 
+        if constexpr (detail::is_parallel_select_supported_v<Iter>)
+        {
+            if (nmid != 0 && nmid != nelem)
+            {
+                // select the nmid smallest elements in parallel, then sort
+                // them in parallel
+                Iter const last = first + nelem;
+                auto const [sub_first, sub_last] =
+                    detail::parallel_select(policy, first, middle, last, comp);
+
+                if (sub_first != sub_last)
+                {
+                    std::nth_element(sub_first, middle, sub_last, comp);
+                }
+
+                return hpx::dataflow(
+                    [last](hpx::future<Iter>&& f) -> Iter {
+                        f.get();
+                        return last;
+                    },
+                    detail::parallel_sort_async(HPX_FORWARD(ExPolicy, policy),
+                        first, middle, HPX_FORWARD(Comp, comp)));
+            }
+        }
+
         std::uint32_t level = parallel::detail::nbits64(nelem) * 2;
         return detail::parallel_partial_sort(HPX_FORWARD(ExPolicy, policy),
             first, middle, first + nelem, level, HPX_FORWARD(Comp, comp));
@@ -0,0 +1,548 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/radix_sort.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Sorts the elements in the range [first, last) in ascending order
+    /// using a least significant digit radix sort. The order of equal
+    /// elements is preserved. The value type of the range has to be an
+    /// integral or a floating point type (float or double). The elements are
+    /// ordered as if compared using operator<(), except that negative zero is
+    /// ordered before positive zero and NaNs are ordered before (negative
+    /// sign) or after (positive sign) all other values.
+    ///
+    /// \note   Complexity: O(N * sizeof(T)), where N = std::distance(first,
+    ///         last) and T is the value type of the range. No comparisons are
+    ///         performed. The algorithm needs an additional buffer of N
+    ///         elements.
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// \returns  The \a radix_sort algorithm returns \a void.
+    template <typename RandomIt>
+    void radix_sort(RandomIt first, RandomIt last);
+
+    /// Sorts the elements in the range [first, last) in ascending order
+    /// using a least significant digit radix sort. The order of equal
+    /// elements is preserved. The value type of the range has to be an
+    /// integral or a floating point type (float or double). The elements are
+    /// ordered as if compared using operator<(), except that negative zero is
+    /// ordered before positive zero and NaNs are ordered before (negative
+    /// sign) or after (positive sign) all other values. Executed according to
+    /// the policy.
+    ///
+    /// Each pass of the parallel algorithm splits the range into chunks that
+    /// compute their local histogram of the current digit concurrently. The
+    /// histograms are combined into the target position of every chunk
+    /// and bucket, after which all chunks scatter their elements concurrently.
+    ///
+    /// \note   Complexity: O(N * sizeof(T)), where N = std::distance(first,
+    ///         last) and T is the value type of the range. No comparisons are
+    ///         performed. The algorithm needs an additional buffer of N
+    ///         elements.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void otherwise.
+    template <typename ExPolicy, typename RandomIt>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    radix_sort(ExPolicy&& policy, RandomIt first, RandomIt last);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/type_support/bit_cast.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // The keys are sorted one byte at a time
+        inline constexpr std::size_t radix_sort_digit_bits = 8;
+        inline constexpr std::size_t radix_sort_num_buckets =
+            std::size_t(1) << radix_sort_digit_bits;
+
+        // Minimal number of elements handled by a single chunk
+        inline constexpr std::size_t radix_sort_limit_per_task = 65536ul;
+
+        using radix_sort_histogram =
+            std::array<std::size_t, radix_sort_num_buckets>;
+
+        template <typename T>
+        inline constexpr bool is_radix_sortable_v = std::is_integral_v<T> ||
+            (std::is_floating_point_v<T> &&
+                (sizeof(T) == sizeof(std::uint32_t) ||
+                    sizeof(T) == sizeof(std::uint64_t)));
+
+        // Map a value onto an unsigned integer of the same size such that the
+        // order of the unsigned integers is the same as the order of the
+        // original values.
+        template <typename T>
+        constexpr auto to_radix_key(T value) noexcept
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return static_cast<std::uint8_t>(value);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                using key_type = std::make_unsigned_t<T>;
+                auto key = static_cast<key_type>(value);
+                if constexpr (std::is_signed_v<T>)
+                {
+                    // move negative values before all positive values
+                    key ^= key_type(1) << (sizeof(T) * CHAR_BIT - 1);
+                }
+                return key;
+            }
+            else
+            {
+                using key_type = std::conditional_t<sizeof(T) ==
+                        sizeof(std::uint32_t),
+                    std::uint32_t, std::uint64_t>;
+
+                constexpr key_type sign_bit = key_type(1)
+                    << (sizeof(T) * CHAR_BIT - 1);
+
+                // IEEE 754: negative values have to be ordered in reverse,
+                // positive values have to be ordered after all negative ones
+                auto const key = hpx::bit_cast<key_type>(value);
+                return (key & sign_bit) ? static_cast<key_type>(~key) :
+                                          static_cast<key_type>(key | sign_bit);
+            }
+        }
+
+        template <typename T>
+        constexpr std::size_t radix_digit(T value, std::size_t pass) noexcept
+        {
+            return static_cast<std::size_t>(
+                (to_radix_key(value) >> (pass * radix_sort_digit_bits)) &
+                (radix_sort_num_buckets - 1));
+        }
+
+        // Move the elements of [first, first + count) to dest ordered by the
+        // digit of the given pass, offsets holds the target position of the
+        // first element of each bucket.
+        template <typename SrcIter, typename DestIter>
+        void radix_sort_scatter(SrcIter first, std::size_t count,
+            DestIter dest, std::size_t pass, radix_sort_histogram& offsets)
+        {
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                std::size_t const digit = radix_digit(*first, pass);
+                *std::next(dest, offsets[digit]++) = HPX_MOVE(*first);
+            }
+        }
+
+        // Convert the histogram into the offsets of the buckets, returns
+        // false if all elements fall into the same bucket (the pass can be
+        // skipped in this case).
+        inline bool radix_sort_offsets(
+            radix_sort_histogram& histogram, std::size_t count) noexcept
+        {
+            std::size_t offset = 0;
+            for (std::size_t& bucket : histogram)
+            {
+                if (bucket == count)
+                {
+                    return false;
+                }
+                std::size_t const size = bucket;
+                bucket = offset;
+                offset += size;
+            }
+            return true;
+        }
+
+        template <typename RandomIt>
+        void sequential_radix_sort(RandomIt first, RandomIt last)
+        {
+            using value_type = hpx::traits::iter_value_t<RandomIt>;
+            constexpr std::size_t num_passes = sizeof(value_type);
+
+            auto const count =
+                static_cast<std::size_t>(std::distance(first, last));
+            if (count < 2)
+            {
+                return;
+            }
+
+            // the histograms of all digits can be gathered in a single pass
+            // as they don't depend on the order of the elements
+            std::array<radix_sort_histogram, num_passes> histograms{};
+            for (RandomIt it = first; it != last; ++it)
+            {
+                auto const key = to_radix_key(*it);
+                for (std::size_t pass = 0; pass != num_passes; ++pass)
+                {
+                    ++histograms[pass][static_cast<std::size_t>(
+                        (key >> (pass * radix_sort_digit_bits)) &
+                        (radix_sort_num_buckets - 1))];
+                }
+            }
+
+            std::unique_ptr<value_type[]> buffer(new value_type[count]);
+
+            bool in_buffer = false;
+            for (std::size_t pass = 0; pass != num_passes; ++pass)
+            {
+                radix_sort_histogram& offsets = histograms[pass];
+                if (!radix_sort_offsets(offsets, count))
+                {
+                    continue;
+                }
+
+                if (in_buffer)
+                {
+                    radix_sort_scatter(
+                        buffer.get(), count, first, pass, offsets);
+                }
+                else
+                {
+                    radix_sort_scatter(
+                        first, count, buffer.get(), pass, offsets);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                std::move(buffer.get(), buffer.get() + count, first);
+            }
+        }
+
+        template <typename ExPolicy, typename RandomIt>
+        void parallel_radix_sort(
+            ExPolicy&& policy, RandomIt first, RandomIt last)
+        {
+            using value_type = hpx::traits::iter_value_t<RandomIt>;
+            constexpr std::size_t num_passes = sizeof(value_type);
+
+            auto const count =
+                static_cast<std::size_t>(std::distance(first, last));
+
+            // figure out the chunk size to use
+            std::size_t const cores =
+                execution::processing_units_count(policy.parameters(),
+                    policy.executor(), hpx::chrono::null_duration, count);
+
+            std::size_t max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+            std::size_t chunk_size = execution::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, cores, count);
+
+            util::detail::adjust_chunk_size_and_max_chunks(
+                cores, count, max_chunks, chunk_size);
+
+            // we should not get smaller than our radix_sort_limit_per_task
+            chunk_size = (std::max)(chunk_size, radix_sort_limit_per_task);
+
+            std::size_t const num_chunks =
+                (count + chunk_size - 1) / chunk_size;
+            if (num_chunks <= 1)
+            {
+                sequential_radix_sort(first, last);
+                return;
+            }
+
+            auto const chunk_begin = [=](std::size_t chunk) {
+                return (std::min)(chunk * chunk_size, count);
+            };
+            auto const chunk_count = [=](std::size_t chunk) {
+                return (std::min)((chunk + 1) * chunk_size, count) -
+                    chunk_begin(chunk);
+            };
+
+            // run the given function for all chunks concurrently
+            auto const for_each_chunk = [&](auto&& f) {
+                auto&& items = execution::bulk_async_execute(policy.executor(),
+                    HPX_FORWARD(decltype(f), f),
+                    hpx::util::counting_shape(num_chunks));
+
+                // wait for all tasks to finish
+                if (hpx::wait_all_nothrow(items))
+                {
+                    // always rethrow if items has at least one exceptional
+                    // future
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        items);
+                }
+            };
+
+            std::unique_ptr<value_type[]> buffer(new value_type[count]);
+            value_type* const buffer_first = buffer.get();
+
+            // histograms and subsequently bucket offsets of all chunks
+            std::vector<radix_sort_histogram> histograms(num_chunks);
+
+            bool in_buffer = false;
+            for (std::size_t pass = 0; pass != num_passes; ++pass)
+            {
+                // gather the histograms of all chunks
+                for_each_chunk([&, pass](std::size_t chunk) {
+                    radix_sort_histogram& histogram = histograms[chunk];
+                    histogram.fill(0);
+
+                    std::size_t const n = chunk_count(chunk);
+                    std::size_t const begin = chunk_begin(chunk);
+                    if (in_buffer)
+                    {
+                        value_type const* it = buffer_first + begin;
+                        for (std::size_t i = 0; i != n; ++i, ++it)
+                        {
+                            ++histogram[radix_digit(*it, pass)];
+                        }
+                    }
+                    else
+                    {
+                        RandomIt it = std::next(first, begin);
+                        for (std::size_t i = 0; i != n; ++i, ++it)
+                        {
+                            ++histogram[radix_digit(*it, pass)];
+                        }
+                    }
+                });
+
+                // compute where each chunk places the elements of each bucket,
+                // the elements of one bucket are placed in the order of the
+                // chunks which keeps the sort stable
+                std::size_t offset = 0;
+                bool skip_pass = false;
+                for (std::size_t digit = 0; digit != radix_sort_num_buckets;
+                     ++digit)
+                {
+                    std::size_t const bucket_start = offset;
+                    for (radix_sort_histogram& histogram : histograms)
+                    {
+                        std::size_t const size = histogram[digit];
+                        histogram[digit] = offset;
+                        offset += size;
+                    }
+
+                    // all elements fall into the same bucket
+                    if (offset - bucket_start == count)
+                    {
+                        skip_pass = true;
+                        break;
+                    }
+                }
+                if (skip_pass)
+                {
+                    continue;
+                }
+
+                // move the elements of all chunks concurrently
+                for_each_chunk([&, pass](std::size_t chunk) {
+                    std::size_t const n = chunk_count(chunk);
+                    std::size_t const begin = chunk_begin(chunk);
+                    if (in_buffer)
+                    {
+                        radix_sort_scatter(buffer_first + begin, n, first, pass,
+                            histograms[chunk]);
+                    }
+                    else
+                    {
+                        radix_sort_scatter(std::next(first, begin), n,
+                            buffer_first, pass, histograms[chunk]);
+                    }
+                });
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                for_each_chunk([&](std::size_t chunk) {
+                    std::size_t const begin = chunk_begin(chunk);
+                    std::move(buffer_first + begin,
+                        buffer_first + begin + chunk_count(chunk),
+                        std::next(first, begin));
+                });
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandomIt>
+        struct radix_sort : public algorithm<radix_sort<RandomIt>, RandomIt>
+        {
+            constexpr radix_sort() noexcept
+              : algorithm<radix_sort, RandomIt>("radix_sort")
+            {
+            }
+
+            template <typename ExPolicy>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last)
+            {
+                sequential_radix_sort(first, last);
+                return last;
+            }
+
+            template <typename ExPolicy>
+            static util::detail::algorithm_result_t<ExPolicy, RandomIt>
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+                try
+                {
+                    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                    {
+                        return algorithm_result::get(
+                            execution::async_execute(policy.executor(),
+                                [policy, first, last]() mutable -> RandomIt {
+                                    parallel_radix_sort(
+                                        policy, first, last);
+                                    return last;
+                                }));
+                    }
+                    else
+                    {
+                        parallel_radix_sort(
+                            HPX_FORWARD(ExPolicy, policy), first, last);
+                        return algorithm_result::get(HPX_MOVE(last));
+                    }
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::radix_sort
+    inline constexpr struct radix_sort_t final
+      : hpx::detail::tag_parallel_algorithm<radix_sort_t>
+    {
+        // clang-format off
+        template <typename RandomIt,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<RandomIt>>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::radix_sort_t, RandomIt first, RandomIt last)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::detail::radix_sort<RandomIt>().call(
+                hpx::execution::seq, first, last);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<RandomIt>>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::radix_sort_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::detail::radix_sort<RandomIt>().call(
+                       HPX_FORWARD(ExPolicy, policy), first, last);
+        }
+    } radix_sort{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -366,6 +366,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/reduction_operators.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -119,329 +119,130 @@ namespace hpx { namespace experimental {
 #else
 
 #include <hpx/config.hpp>
-#include <hpx/datastructures/tuple.hpp>
-#include <hpx/execution/executors/execution.hpp>
-#include <hpx/iterator_support/range.hpp>
-#include <hpx/iterator_support/transform_iterator.hpp>
-#include <hpx/parallel/algorithms/for_each.hpp>
-#include <hpx/parallel/algorithms/inclusive_scan.hpp>
-#include <hpx/parallel/container_algorithms/copy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/result_types.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-/// \cond NOINTERNAL
-#ifdef EXTRA_DEBUG
-#include <iostream>
-#define DEBUG_REDUCE_BY_KEY(a) std::cout << a
-#else
-#define DEBUG_REDUCE_BY_KEY(a)
-#endif
-/// \endcond
-
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
     // -------------------------------------------------------------------
-    // simple iterator helper object for access to prev/next items
+    // The keys and values are reduced by a single segmented scan: the
+    // segments of equal consecutive keys are identified by a head flag
+    // (set for every element whose key does not compare equal to the key
+    // of the preceding element). The first step of the scan summarizes
+    // every partition by the number of heads it contains (treating its
+    // first element as a head), its first and last key, and the reduction
+    // of the values following its last head. Only the elements of the
+    // partition itself are read, as the preceding partition might be
+    // written to already if the output is the same as the input. The
+    // second step combines the summaries from left to right, where the
+    // head at the beginning of the right summary is dropped if its first
+    // key compares equal to the last key of the left summary, and a head
+    // resets the carried reduction. The third step reduces all segments of
+    // every partition using the carried reduction for the first segment
+    // and writes keys and reduced values directly to their final position.
+    // No temporary sequences are allocated and the values are read once,
+    // apart from those following the last head of every partition.
     // -------------------------------------------------------------------
-    struct reduce_stencil_transformer
+    template <typename Key, typename T>
+    struct reduce_by_key_summary
     {
-        // declare result type as a template
-        template <typename T>
-        struct result;
-
-        // specialize result for iterator type
-        template <typename This, typename Iterator>
-        struct result<This(Iterator)>
-        {
-            using element_type =
-                typename std::iterator_traits<Iterator>::reference;
-            using type = hpx::tuple<element_type, element_type, element_type>;
-        };
-
-        // call operator for stencil transform
-        // it will dereference tuple(it-1, it, it+1)
-        template <typename Iterator>
-        typename result<reduce_stencil_transformer(Iterator)>::type operator()(
-            Iterator const& it) const
-        {
-            using type =
-                typename result<reduce_stencil_transformer(Iterator)>::type;
-            return type(*std::prev(it), *it, *std::next(it));
-        }
+        std::size_t size = 0;     // number of elements summarized
+        std::size_t heads = 0;    // number of segments starting in them
+        Key first_key{};          // key of the first element
+        Key last_key{};           // key of the last element
+        T tail{};                 // reduction of the last (open) segment
     };
 
-    // -------------------------------------------------------------------
-    // transform iterator using reduce_stencil_transformer helper
-    // -------------------------------------------------------------------
-    template <typename Iterator,
-        typename Transformer = detail::reduce_stencil_transformer>
-    class reduce_stencil_iterator
-      : public hpx::util::transform_iterator<Iterator, Transformer>
+    // Reduce the segments of [key_first, key_first + count) continuing the
+    // segment summarized by 'prefix' (if any). A segment is written once the
+    // head of the next segment is reached (or after the last element if
+    // 'last' is set). All keys and values are read before any output is
+    // written, which allows for the output to be the same as the input
+    // sequences as long as every output is written at or before the
+    // position of the element being processed. Returns the number of
+    // segments written.
+    template <typename Key, typename T, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2, typename Compare,
+        typename Func>
+    std::size_t reduce_by_key_segments(
+        reduce_by_key_summary<Key, T> const& prefix, RanIter key_first,
+        std::size_t count, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, bool last, Compare& comp, Func& func)
     {
-    private:
-        using base_type = hpx::util::transform_iterator<Iterator, Transformer>;
+        std::size_t written = 0;
+        bool has_segment = prefix.size != 0;
 
-    public:
-        reduce_stencil_iterator() = default;
-
-        explicit reduce_stencil_iterator(Iterator const& it)
-          : base_type(it, Transformer())
+        Key key = prefix.last_key;
+        T value = prefix.tail;
+        for (/**/; count != 0; (void) ++key_first, ++values_first, --count)
         {
-        }
-
-        reduce_stencil_iterator(Iterator const& it, Transformer const& t)
-          : base_type(it, t)
-        {
-        }
-    };
-
-    template <typename Iterator, typename Transformer>
-    reduce_stencil_iterator<Iterator, Transformer> make_reduce_stencil_iterator(
-        Iterator const& it, Transformer const& t)
-    {
-        return reduce_stencil_iterator<Iterator, Transformer>(it, t);
-    }
+            Key curr_key = *key_first;
+            T curr_value = *values_first;
 
-    // -------------------------------------------------------------------
-    // state of a reduce by key step
-    // -------------------------------------------------------------------
-    struct reduce_key_series_states
-    {
-        bool start;    // START of a segment
-        bool end;      // END of a segment
-
-        explicit reduce_key_series_states(bool s = false, bool e = false)
-          : start(s)
-          , end(e)
-        {
+            if (has_segment && HPX_INVOKE(comp, key, curr_key))
+            {
+                value = HPX_INVOKE(func, HPX_MOVE(value), HPX_MOVE(curr_value));
+            }
+            else
+            {
+                if (has_segment)
+                {
+                    *keys_output++ = HPX_MOVE(key);
+                    *values_output++ = HPX_MOVE(value);
+                    ++written;
+                }
+                value = HPX_MOVE(curr_value);
+                has_segment = true;
+            }
+            key = HPX_MOVE(curr_key);
         }
-    };
 
-    // -------------------------------------------------------------------
-    // callable that actually computes the state using the stencil iterator
-    // -------------------------------------------------------------------
-    template <typename Transformer, typename StencilIterType,
-        typename KeyStateIterType, typename Compare>
-    struct reduce_stencil_generate
-    {
-        using element_type = typename Transformer::template result<Transformer(
-            StencilIterType)>::element_type;
-        using tuple_type = typename Transformer::template result<Transformer(
-            StencilIterType)>::type;
-        using KeyStateType =
-            typename std::iterator_traits<KeyStateIterType>::reference;
-
-        reduce_stencil_generate() {}
-
-        void operator()(tuple_type const& value, KeyStateType& kiter,
-            Compare const& comp) const
+        if (last && has_segment)
         {
-            // resolves to a tuple of values for *(it-1), *it, *(it+1)
-            element_type left = hpx::get<0>(value);
-            element_type mid = hpx::get<1>(value);
-            element_type right = hpx::get<2>(value);
-
-            // we need to determine which of three states this
-            // index is. It can be:
-            // 1. Middle of a set of equivalent keys.
-            // 2. Start of a set of equivalent keys.
-            // 3. End of a set of equivalent keys.
-            // 4. Both the start and end of a set of keys
-
-            bool const left_matches(comp(left, mid));
-            bool const right_matches(comp(mid, right));
-            kiter = reduce_key_series_states(!left_matches, !right_matches);
+            *keys_output = HPX_MOVE(key);
+            *values_output = HPX_MOVE(value);
+            ++written;
         }
-    };
-
-    // -------------------------------------------------------------------
-    // helper that extracts the final output iterators from copy_if
-    // -------------------------------------------------------------------
-    // Zip iterator has 3 iterators inside
-    // Iter1, key type : Iter2, value type : Iter3, state type
-    template <typename ZIter, typename iKey, typename iVal>
-    constexpr util::in_out_result<iKey, iVal> make_pair_result(
-        ZIter zipiter, iKey key_start, iVal val_start)
-    {
-        // the iterator we want is 'second' part of pair type (from copy_if)
-        auto t = zipiter.out.get_iterator_tuple();
-        iKey key_end = hpx::get<0>(t);
-        return util::in_out_result<iKey, iVal>{
-            key_end, std::next(val_start, std::distance(key_start, key_end))};
+        return written;
     }
 
-    // async version that returns future<pair> from future<zip_iterator<blah>>
-    template <typename ZIter, typename iKey, typename iVal>
-    hpx::future<util::in_out_result<iKey, iVal>> make_pair_result(
-        hpx::future<ZIter>&& ziter, iKey key_start, iVal val_start)
+    // Whether the output sequence starts at the same element as the input
+    // sequence (the outputs are not allowed to overlap the inputs in any
+    // other way).
+    template <typename InIter, typename OutIter>
+    bool reduce_by_key_is_in_place(InIter in, OutIter out)
     {
-        using result_type = util::in_out_result<iKey, iVal>;
-
-        return hpx::make_future<result_type>(
-            HPX_MOVE(ziter), [=](ZIter zipiter) {
-                auto t = zipiter.second.get_iterator_tuple();
-                iKey key_end = hpx::get<0>(t);
-                return result_type{key_end,
-                    std::next(val_start, std::distance(key_start, key_end))};
-            });
-    }
+        using in_reference = hpx::traits::iter_reference_t<InIter>;
+        using out_reference = hpx::traits::iter_reference_t<OutIter>;
 
-    // -------------------------------------------------------------------
-    // The main algorithm is implemented here, it replaces any async execution
-    // policy with a non async one so that no waits are necessary on the
-    // internal algorithms. Async execution is handled by the wrapper layer that
-    // calls this.
-    // -------------------------------------------------------------------
-    template <typename ExPolicy, typename RanIter, typename RanIter2,
-        typename FwdIter1, typename FwdIter2, typename Compare, typename Func>
-    static util::in_out_result<FwdIter1, FwdIter2> reduce_by_key_impl(
-        ExPolicy&& policy, RanIter key_first, RanIter key_last,
-        RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
-        Compare&& comp, Func&& func)
-    {
-        using namespace hpx::parallel::detail;
-        using namespace hpx::util;
-
-        // we need to determine based on the keys what is the key state for each
-        // key. The states are start, middle, end of a series and the special
-        // state start and end of the sequence
-        std::vector<reduce_key_series_states> key_state;
-        using keystate_iter_type =
-            std::vector<reduce_key_series_states>::iterator;
-        using reducebykey_iter = detail::reduce_stencil_iterator<RanIter,
-            reduce_stencil_transformer>;
-        using element_type = typename std::iterator_traits<RanIter>::reference;
-        using zip_ref = typename zip_iterator<reducebykey_iter,
-            keystate_iter_type>::reference;
-        //
-        const std::uint64_t number_of_keys = std::distance(key_first, key_last);
-        //
-        key_state.assign(number_of_keys, reduce_key_series_states());
+        if constexpr (std::is_lvalue_reference_v<in_reference> &&
+            std::is_lvalue_reference_v<out_reference>)
         {
-            reduce_stencil_transformer r_s_t;
-            reducebykey_iter reduce_begin =
-                make_reduce_stencil_iterator(key_first, r_s_t);
-            reducebykey_iter reduce_end =
-                make_reduce_stencil_iterator(key_last, r_s_t);
-
-            // FIXME: handle cases number_of_keys == 0 and
-            //        number_of_keys == 1
-
-            if (number_of_keys == 2)
-            {
-                // for two entries, one is a start, the other an end,
-                // if they are different, then they are both start/end
-                element_type left = *key_first;
-                element_type right = *std::next(key_first);
-                key_state[0] =
-                    reduce_key_series_states(true, !comp(left, right));
-                key_state[1] =
-                    reduce_key_series_states(!comp(left, right), true);
-            }
-            else
-            {
-                // do the first and last elements by hand to simplify the iterator
-                // traversal as there is no prev/next for first/last
-                element_type elem0 = *key_first;
-                element_type elem1 = *std::next(key_first);
-                key_state[0] = reduce_key_series_states(true, elem0 != elem1);
-                // middle elements
-                reduce_stencil_generate<reduce_stencil_transformer, RanIter,
-                    keystate_iter_type, Compare>
-                    kernel;
-                hpx::for_each(policy(hpx::execution::non_task),
-                    zip_iterator(reduce_begin + 1, key_state.begin() + 1),
-                    zip_iterator(reduce_end - 1, key_state.end() - 1),
-                    [&kernel, &comp](zip_ref ref) {
-                        kernel(hpx::get<0>(ref), hpx::get<1>(ref), comp);
-                    });
-                // Last element
-                element_type elem_n = *std::prev(key_last);
-                element_type elemn = *std::prev(std::prev(key_last));
-                key_state.back() =
-                    reduce_key_series_states(elem_n != elemn, true);
-            }
+            return static_cast<void const*>(std::addressof(*in)) ==
+                static_cast<void const*>(std::addressof(*out));
         }
+        else
         {
-            using zip_iterator_in = zip_iterator<RanIter2,
-                std::vector<reduce_key_series_states>::iterator>;
-            using zip_type_in = typename zip_iterator_in::value_type;
-
-            using zip_iterator_vout = zip_iterator<FwdIter2,
-                std::vector<reduce_key_series_states>::iterator>;
-
-            using value_type =
-                typename std::iterator_traits<RanIter2>::value_type;
-
-            zip_iterator_in states_begin =
-                zip_iterator(values_first, hpx::util::begin(key_state));
-            zip_iterator_in states_end = zip_iterator(
-                values_first + number_of_keys, hpx::util::end(key_state));
-            zip_iterator_vout states_out_begin =
-                zip_iterator(values_output, hpx::util::begin(key_state));
-
-            zip_type_in initial;
-            //
-            using lambda_type =
-                hpx::tuple<value_type, reduce_key_series_states>;
-            hpx::inclusive_scan(
-                policy(hpx::execution::non_task), states_begin, states_end,
-                states_out_begin,
-                // B is the current entry, A is the one passed in from 'previous'
-                [&func](zip_type_in a, zip_type_in b) -> lambda_type {
-                    value_type a_val = hpx::get<0>(a);
-                    reduce_key_series_states const a_state = hpx::get<1>(a);
-                    value_type b_val = hpx::get<0>(b);
-                    reduce_key_series_states const b_state = hpx::get<1>(b);
-                    DEBUG_REDUCE_BY_KEY("{ " << a_val << "+" << b_val << " },\t"
-                                             << a_state << b_state);
-                    // if carrying a start flag, then copy - don't add
-                    if (b_state.start)
-                    {
-                        DEBUG_REDUCE_BY_KEY(" = " << b_val << std::endl);
-                        return hpx::make_tuple(b_val,
-                            reduce_key_series_states(
-                                a_state.start || b_state.start, b_state.end));
-                    }
-
-                    // normal add of previous + this
-                    DEBUG_REDUCE_BY_KEY(
-                        " = " << func(a_val, b_val) << std::endl);
-
-                    value_type temp = func(a_val, b_val);
-                    return hpx::make_tuple(temp,
-                        reduce_key_series_states(
-                            a_state.start || b_state.start, b_state.end));
-                },
-                initial);
-
-            // now copy the values and keys for each element that is marked by
-            // an 'END' state to the final output
-            using zip2_ref = typename hpx::util::zip_iterator<RanIter, FwdIter2,
-                std::vector<reduce_key_series_states>::iterator>::reference;
-
-            std::vector<value_type> temp(number_of_keys);
-            hpx::copy(policy(hpx::execution::non_task), values_output,
-                values_output + number_of_keys, temp.begin());
-
-            return make_pair_result(
-                hpx::ranges::copy_if(policy(hpx::execution::non_task),
-                    zip_iterator(
-                        key_first, temp.begin(), hpx::util::begin(key_state)),
-                    zip_iterator(key_last, temp.begin() + number_of_keys,
-                        hpx::util::end(key_state)),
-                    zip_iterator(keys_output, values_output,
-                        hpx::util::begin(key_state)),
-                    // copies to dest only when 'end' state is true
-                    [](zip2_ref it) { return hpx::get<2>(it).end; }),
-                keys_output, values_output);
+            return false;
         }
     }
 
@@ -461,13 +262,23 @@ namespace hpx::parallel::detail {
         template <typename ExPolicy, typename RanIter, typename RanIter2,
             typename Compare, typename Func>
         static constexpr util::in_out_result<FwdIter1, FwdIter2> sequential(
-            ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            ExPolicy&&, RanIter key_first, RanIter key_last,
             RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
             Compare&& comp, Func&& func)
         {
-            return reduce_by_key_impl(HPX_FORWARD(ExPolicy, policy), key_first,
-                key_last, values_first, keys_output, values_output,
-                HPX_FORWARD(Compare, comp), HPX_FORWARD(Func, func));
+            using summary_type =
+                reduce_by_key_summary<hpx::traits::iter_value_t<RanIter>,
+                    hpx::traits::iter_value_t<RanIter2>>;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            std::size_t const written = reduce_by_key_segments(summary_type{},
+                key_first, count, values_first, keys_output, values_output,
+                true, comp, func);
+
+            std::advance(keys_output, written);
+            std::advance(values_output, written);
+            return util::in_out_result<FwdIter1, FwdIter2>{
+                HPX_MOVE(keys_output), HPX_MOVE(values_output)};
         }
 
         template <typename ExPolicy, typename RanIter, typename RanIter2,
@@ -478,16 +289,182 @@ namespace hpx::parallel::detail {
             RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
             Compare&& comp, Func&& func)
         {
-            return util::detail::algorithm_result<ExPolicy,
-                util::in_out_result<FwdIter1,
-                    FwdIter2>>::get(execution::async_execute(policy.executor(),
-                hpx::util::deferred_call(
-                    &hpx::parallel::detail::reduce_by_key_impl<ExPolicy&&,
-                        RanIter, RanIter2, FwdIter1, FwdIter2, Compare&&,
-                        Func&&>,
-                    policy, key_first, key_last, values_first, keys_output,
-                    values_output, HPX_FORWARD(Compare, comp),
-                    HPX_FORWARD(Func, func))));
+            using result_type = util::in_out_result<FwdIter1, FwdIter2>;
+            using result =
+                util::detail::algorithm_result<ExPolicy, result_type>;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count == 0)
+            {
+                return result::get(result_type{
+                    HPX_MOVE(keys_output), HPX_MOVE(values_output)});
+            }
+
+            using summary_type =
+                reduce_by_key_summary<hpx::traits::iter_value_t<RanIter>,
+                    hpx::traits::iter_value_t<RanIter2>>;
+
+            // the segments of every partition are written to the beginning
+            // of the partition if the output is the same as the input, and
+            // are moved to their final position once all partitions are done
+            bool const keys_in_place =
+                reduce_by_key_is_in_place(key_first, keys_output);
+            bool const values_in_place =
+                reduce_by_key_is_in_place(values_first, values_output);
+
+            // step 1 summarizes every partition, only the values following
+            // the last head of the partition are read
+            auto f1 = [key_first, values_first, comp, func](
+                          RanIter part_begin,
+                          std::size_t part_size) mutable -> summary_type {
+                auto const offset =
+                    static_cast<std::size_t>(part_begin - key_first);
+
+                summary_type summary;
+                summary.size = part_size;
+                summary.heads = 1;
+                summary.first_key = *part_begin;
+
+                std::size_t last_head = 0;
+                RanIter it = part_begin;
+                for (std::size_t i = 1; i != part_size; ++i)
+                {
+                    RanIter const next = std::next(it);
+                    if (!HPX_INVOKE(comp, *it, *next))
+                    {
+                        ++summary.heads;
+                        last_head = i;
+                    }
+                    it = next;
+                }
+                summary.last_key = *it;
+
+                RanIter2 value = std::next(values_first, offset + last_head);
+                summary.tail = *value;
+                for (++last_head, ++value; last_head != part_size;
+                     ++last_head, ++value)
+                {
+                    summary.tail =
+                        HPX_INVOKE(func, HPX_MOVE(summary.tail), *value);
+                }
+                return summary;
+            };
+
+            // step 2 propagates the partition summaries from left to right
+            auto f2 = [comp, func](summary_type const& lhs,
+                          summary_type const& rhs) mutable -> summary_type {
+                if (lhs.size == 0)
+                {
+                    return rhs;
+                }
+                if (rhs.size == 0)
+                {
+                    return lhs;
+                }
+
+                // the first segment of rhs continues the last segment of lhs
+                bool const joined =
+                    HPX_INVOKE(comp, lhs.last_key, rhs.first_key);
+
+                summary_type summary;
+                summary.size = lhs.size + rhs.size;
+                summary.heads = lhs.heads + rhs.heads - (joined ? 1 : 0);
+                summary.first_key = lhs.first_key;
+                summary.last_key = rhs.last_key;
+                summary.tail = joined && rhs.heads == 1 ?
+                    HPX_INVOKE(func, lhs.tail, rhs.tail) :
+                    rhs.tail;
+                return summary;
+            };
+
+            // step 3 writes the segments of every partition, the last
+            // segment is written in step 4
+            auto f3 = [key_first, values_first, keys_output, values_output,
+                          keys_in_place, values_in_place, comp, func](
+                          RanIter part_begin, std::size_t part_size,
+                          summary_type const& prefix) mutable
+                -> std::pair<std::size_t, std::size_t> {
+                auto const offset =
+                    static_cast<std::size_t>(part_begin - key_first);
+
+                // the first segment written is the one open at the
+                // beginning of the partition (if any)
+                std::size_t const dest =
+                    prefix.heads != 0 ? prefix.heads - 1 : 0;
+
+                std::size_t const written = reduce_by_key_segments(prefix,
+                    part_begin, part_size, std::next(values_first, offset),
+                    std::next(keys_output, keys_in_place ? offset : dest),
+                    std::next(values_output, values_in_place ? offset : dest),
+                    false, comp, func);
+
+                return {offset, written};
+            };
+
+            // step 4 moves the segments written in place to their final
+            // position and writes the last segment, which is summarized by
+            // the overall result of step 2
+            auto f4 = [keys_output, values_output, keys_in_place,
+                          values_in_place](std::vector<summary_type>&& items,
+                          std::vector<hpx::future<
+                              std::pair<std::size_t, std::size_t>>>&&
+                              data) mutable -> result_type {
+                std::size_t const segments = items.back().heads;
+
+                if (keys_in_place || values_in_place)
+                {
+                    // the partitions are processed in order, every
+                    // partition is moved towards the beginning of the
+                    // sequence
+                    std::size_t dest = 0;
+                    for (auto& f : data)
+                    {
+                        auto const [offset, written] = f.get();
+                        if (offset != dest)
+                        {
+                            if (keys_in_place)
+                            {
+                                auto const first =
+                                    std::next(keys_output, offset);
+                                std::move(first, std::next(first, written),
+                                    std::next(keys_output, dest));
+                            }
+                            if (values_in_place)
+                            {
+                                auto const first =
+                                    std::next(values_output, offset);
+                                std::move(first, std::next(first, written),
+                                    std::next(values_output, dest));
+                            }
+                        }
+                        dest += written;
+                    }
+                    HPX_ASSERT(dest + 1 == segments);
+                }
+
+                summary_type& summary = items.back();
+                *std::next(keys_output, segments - 1) =
+                    HPX_MOVE(summary.last_key);
+                *std::next(values_output, segments - 1) =
+                    HPX_MOVE(summary.tail);
+
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                util::detail::clear_container(data);
+
+                std::advance(keys_output, segments);
+                std::advance(values_output, segments);
+                return result_type{
+                    HPX_MOVE(keys_output), HPX_MOVE(values_output)};
+            };
+
+            using scan_partitioner_type =
+                util::scan_partitioner<ExPolicy, result_type, summary_type,
+                    std::pair<std::size_t, std::size_t>>;
+
+            return scan_partitioner_type::call(HPX_FORWARD(ExPolicy, policy),
+                key_first, count, summary_type{}, HPX_MOVE(f1),
+                HPX_MOVE(f2), HPX_MOVE(f3), HPX_MOVE(f4));
         }
     };
     /// \endcond
@@ -495,15 +472,6 @@ namespace hpx::parallel::detail {
 
 namespace hpx::experimental {
 
-#ifdef EXTRA_DEBUG
-    std::ostream& operator<<(
-        std::ostream& os, detail::reduce_key_series_states const& rs)
-    {
-        os << "{ start=" << rs.start << ",end=" << rs.end << "} ";
-        return os;
-    }
-#endif
-
     // clang-format off
     template <typename ExPolicy, typename RanIter, typename RanIter2,
         typename FwdIter1, typename FwdIter2,
@@ -522,27 +490,12 @@ namespace hpx::experimental {
         RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
         Compare comp = Compare(), Func func = Func())
     {
-        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy,
-            hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>>;
-
         static_assert(hpx::traits::is_random_access_iterator_v<RanIter> &&
                 hpx::traits::is_random_access_iterator_v<RanIter2> &&
                 hpx::traits::is_forward_iterator_v<FwdIter1> &&
                 hpx::traits::is_forward_iterator_v<FwdIter2>,
             "iterators : Random_access for inputs and forward for outputs.");
 
-        std::uint64_t const number_of_keys = std::distance(key_first, key_last);
-
-        if (number_of_keys <= 1)
-        {
-            // we only have a single key/value so that is our output
-            *keys_output = *key_first;
-            *values_output = *values_first;
-            return result::get(
-                hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>{
-                    keys_output, values_output});
-        }
-
         return hpx::parallel::detail::reduce_by_key<FwdIter1, FwdIter2>().call(
             HPX_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
             keys_output, values_output, HPX_MOVE(comp), HPX_MOVE(func));
@@ -221,6 +221,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/algorithms/detail/remove.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -247,24 +248,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        template <typename Iter, typename Sent, typename Pred, typename Proj>
-        constexpr Iter sequential_remove_if(
-            Iter first, Sent last, Pred pred, Proj proj)
-        {
-            first = hpx::parallel::detail::sequential_find_if<
-                hpx::execution::sequenced_policy>(first, last, pred, proj);
-
-            if (first != last)
-            {
-                for (Iter i = first; ++i != last;)
-                    if (!HPX_INVOKE(pred, HPX_INVOKE(proj, *i)))
-                    {
-                        *first++ = HPX_MOVE(*i);
-                    }
-            }
-            return first;
-        }
-
         template <typename FwdIter>
         struct remove_if : public algorithm<remove_if<FwdIter>, FwdIter>
         {
@@ -278,7 +261,7 @@ namespace hpx::parallel {
             static constexpr Iter sequential(
                 ExPolicy, Iter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_remove_if(first, last,
+                return sequential_remove_if<ExPolicy>(first, last,
                     HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
             }
 
@@ -262,11 +262,6 @@ namespace hpx::parallel {
             parallel(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
                 Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2)
             {
-                using difference_type1 =
-                    typename std::iterator_traits<Iter1>::difference_type;
-                using difference_type2 =
-                    typename std::iterator_traits<Iter2>::difference_type;
-
                 using result_type = util::in_out_result<Iter1, Iter3>;
                 using result =
                     util::detail::algorithm_result<ExPolicy, result_type>;
@@ -283,30 +278,23 @@ namespace hpx::parallel {
                         HPX_FORWARD(ExPolicy, policy), first1, last1, dest);
                 }
 
-                using buffer_type = typename set_operations_buffer<Iter3>::type;
                 using func_type = std::decay_t<F>;
 
-                // calculate approximate destination index
-                auto f1 = [](difference_type1 idx1,
-                              difference_type2 /* idx2 */) -> difference_type1 {
-                    return idx1;
-                };
-
                 // perform required set operation for one chunk
-                auto f2 = [proj1, proj2](Iter1 part_first1, Sent1 part_last1,
-                              Iter2 part_first2, Sent2 part_last2,
-                              buffer_type* d, func_type const& f) {
+                auto f2 = [proj1, proj2](Iter1 part_first1, Iter1 part_last1,
+                              Iter2 part_first2, Iter2 part_last2, auto d,
+                              func_type const& f) {
                     auto r = sequential_set_difference(part_first1, part_last1,
                         part_first2, part_last2, d, f, proj1, proj2);
                     // second element gets dropped on the floor later
-                    return util::in_in_out_result<Iter1, Iter2, buffer_type*>{
-                        r.in, part_first2, r.out};
+                    return util::in_in_out_result<Iter1, Iter2,
+                        decltype(r.out)>{r.in, part_first2, r.out};
                 };
 
                 auto last = set_operation(HPX_FORWARD(ExPolicy, policy), first1,
                     last1, first2, last2, dest, HPX_FORWARD(F, f),
                     HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2),
-                    HPX_MOVE(f1), HPX_MOVE(f2));
+                    HPX_MOVE(f2));
 
                 // construct return value
                 return util::detail::convert_to_result(HPX_MOVE(last),
@@ -160,6 +160,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -195,7 +196,8 @@ namespace hpx::parallel {
             {
                 return execution::async_execute(policy.executor(),
                     [first, last, comp = HPX_MOVE(comp)]() -> RandomIt {
-                        std::sort(first, last, comp);
+                        sequential_sort<std::decay_t<ExPolicy>>(
+                            first, last, comp);
                         return last;
                     });
             }
@@ -307,7 +309,7 @@ namespace hpx::parallel {
 
             if (static_cast<std::size_t>(N) < chunk_size)
             {
-                std::sort(first, last, comp);
+                sequential_sort<std::decay_t<ExPolicy>>(first, last, comp);
                 return hpx::make_ready_future(last);
             }
 
@@ -339,7 +341,7 @@ namespace hpx::parallel {
                 ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                std::sort(first, last_iter,
+                sequential_sort<ExPolicy>(first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
                 return last_iter;
             }
@@ -73,6 +73,13 @@ namespace hpx {
     /// uses the given comparison function object comp (defaults to using
     /// operator<()). Executed according to the policy.
     ///
+    /// The parallel algorithm sorts both halves of the range concurrently
+    /// and merges them using a buffer of N/2 elements. The merge is divided
+    /// into chunks of equal size along its merge path which are processed
+    /// concurrently. If the buffer can't be allocated, the algorithm falls
+    /// back to using a buffer of N/16 elements (see
+    /// \a hpx::experimental::reduced_memory_stable_sort).
+    ///
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
@@ -143,6 +150,113 @@ namespace hpx {
     // clang-format on
 }    // namespace hpx
 
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order
+    /// using an additional buffer of only N/memory_divisor elements. The
+    /// relative order of equal elements is preserved. The function uses the
+    /// given comparison function object comp (defaults to using operator<()).
+    ///
+    /// The runs of N/memory_divisor elements are sorted independently, after
+    /// which the sorted runs are merged pairwise. The merges of ranges that
+    /// don't fit into the buffer are split into smaller merges by exchanging
+    /// blocks of elements using rotations.
+    ///
+    /// \note   Complexity: O(N log(N) log(memory_divisor)), where
+    ///         N = std::distance(first, last) comparisons and moves.
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param memory_divisor The size of the range divided by the size of the
+    ///                     buffer to use (a value of 0 is treated as 1).
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise.
+    ///
+    /// \returns  The \a reduced_memory_stable_sort algorithm returns \a void.
+    template <typename RandomIt,
+        typename Comp = hpx::parallel::detail::less>
+    void reduced_memory_stable_sort(RandomIt first, RandomIt last,
+        std::size_t memory_divisor, Comp&& comp = Comp());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order
+    /// using an additional buffer of only N/memory_divisor elements. The
+    /// relative order of equal elements is preserved. The function uses the
+    /// given comparison function object comp (defaults to using operator<()).
+    /// Executed according to the policy.
+    ///
+    /// The runs of N/memory_divisor elements are sorted concurrently, after
+    /// which the sorted runs are merged pairwise. The merges of ranges that
+    /// don't fit into the buffer are split into smaller merges by exchanging
+    /// blocks of elements using (parallel) rotations, each merge of ranges
+    /// which fit into the buffer is processed in parallel.
+    ///
+    /// \note   Complexity: O(N log(N) log(memory_divisor)), where
+    ///         N = std::distance(first, last) comparisons and moves.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param memory_divisor The size of the range divided by the size of the
+    ///                     buffer to use (a value of 0 is treated as 1).
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a reduced_memory_stable_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void
+    ///           otherwise.
+    template <typename ExPolicy, typename RandomIt,
+        typename Comp = hpx::parallel::detail::less>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    reduced_memory_stable_sort(ExPolicy&& policy, RandomIt first,
+        RandomIt last, std::size_t memory_divisor, Comp&& comp = Comp());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
 #else    // DOXYGEN
 
 #include <hpx/config.hpp>
@@ -153,6 +267,7 @@ namespace hpx {
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
@@ -165,6 +280,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/type_support/identity.hpp>
+#include <hpx/type_support/void_guard.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -253,6 +369,70 @@ namespace hpx::parallel {
                 }
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // reduced_memory_stable_sort
+        template <typename RandomIt>
+        struct reduced_memory_stable_sort
+          : public algorithm<reduced_memory_stable_sort<RandomIt>, RandomIt>
+        {
+            constexpr reduced_memory_stable_sort() noexcept
+              : algorithm<reduced_memory_stable_sort, RandomIt>(
+                    "reduced_memory_stable_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Sentinel, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, Sentinel last,
+                std::size_t memory_divisor, Compare&& comp, Proj&& proj)
+            {
+                using compare_type = util::compare_projected<Compare&, Proj&>;
+
+                auto last_iter = detail::advance_to_sentinel(first, last);
+
+                return parallel_stable_sort(
+                    hpx::execution::sequenced_executor(), first, last_iter, 1,
+                    stable_sort_limit_per_task, compare_type(comp, proj),
+                    (std::max)(memory_divisor, std::size_t(1)));
+            }
+
+            template <typename ExPolicy, typename Sentinel, typename Compare,
+                typename Proj>
+            static util::detail::algorithm_result_t<ExPolicy, RandomIt>
+            parallel(ExPolicy&& policy, RandomIt first, Sentinel last,
+                std::size_t memory_divisor, Compare&& compare, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+                using compare_type = util::compare_projected<Compare&, Proj&>;
+
+                // number of elements to sort
+                auto last_iter = first;
+                std::size_t count =
+                    detail::advance_and_get_distance(last_iter, last);
+
+                std::size_t cores =
+                    execution::processing_units_count(policy.parameters(),
+                        policy.executor(), hpx::chrono::null_duration, count);
+
+                try
+                {
+                    compare_type comp(compare, proj);
+
+                    return algorithm_result::get(parallel_stable_sort(
+                        policy.executor(), first, last_iter, cores,
+                        stable_sort_limit_per_task, HPX_MOVE(comp),
+                        (std::max)(memory_divisor, std::size_t(1))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
         /// \endcond
     }    // namespace detail
 
@@ -352,4 +532,65 @@ namespace hpx {
     } stable_sort{};
 }    // namespace hpx
 
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::reduced_memory_stable_sort
+    inline constexpr struct reduced_memory_stable_sort_t final
+      : hpx::detail::tag_parallel_algorithm<reduced_memory_stable_sort_t>
+    {
+        // clang-format off
+        template <typename RandomIt,
+            typename Comp = hpx::parallel::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    hpx::traits::iter_value_t<RandomIt>,
+                    hpx::traits::iter_value_t<RandomIt>
+                >
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::reduced_memory_stable_sort_t, RandomIt first,
+            RandomIt last, std::size_t memory_divisor, Comp comp = Comp())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::detail::reduced_memory_stable_sort<RandomIt>().call(
+                hpx::execution::seq, first, last, memory_divisor,
+                HPX_MOVE(comp), hpx::identity_v);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Comp = hpx::parallel::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    hpx::traits::iter_value_t<RandomIt>,
+                    hpx::traits::iter_value_t<RandomIt>
+                >
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::reduced_memory_stable_sort_t,
+            ExPolicy&& policy, RandomIt first, RandomIt last,
+            std::size_t memory_divisor, Comp comp = Comp())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                hpx::parallel::util::detail::algorithm_result_t<ExPolicy>;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::detail::reduced_memory_stable_sort<RandomIt>()
+                       .call(HPX_FORWARD(ExPolicy, policy), first, last,
+                           memory_divisor, HPX_MOVE(comp), hpx::identity_v);
+        }
+    } reduced_memory_stable_sort{};
+}    // namespace hpx::experimental
+
 #endif
@@ -187,7 +187,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/parallel/util/scan_lookback_partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -283,10 +283,12 @@ namespace hpx::parallel {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 2
-                // subsequent parallel steps. The first calculates the scan
-                // results for each partition and the second produces the
-                // overall result
+                // The overall scan algorithm is performed in a single pass
+                // over the input. The first step calculates the scan results
+                // for each partition. The second step combines the results of
+                // all preceding partitions (decoupled look-back) into the
+                // value the third step applies to the partition right after
+                // the first step has finished with it.
 
                 using hpx::get;
 
@@ -301,9 +303,11 @@ namespace hpx::parallel {
                         });
                 };
 
-                return util::scan_partitioner<ExPolicy, result_type, T>::call(
-                    HPX_FORWARD(ExPolicy, policy), zip_iterator(first, dest),
-                    count, init,
+                using partitioner_type =
+                    util::scan_lookback_partitioner<ExPolicy, result_type, T>;
+
+                return partitioner_type::call(HPX_FORWARD(ExPolicy, policy),
+                    zip_iterator(first, dest), count, init,
                     // step 1 performs first part of scan algorithm
                     [op, conv](zip_iterator part_begin,
                         std::size_t part_size) mutable -> T {
@@ -433,6 +433,7 @@ namespace hpx {
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/prefetching.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -479,11 +480,19 @@ namespace hpx::parallel {
                         HPX_MOVE(init_));
                 }
 
-                auto f1 = [r, conv](
+                // honor the prefetching parameters attached to the policy
+                // (see hpx::execution::experimental::with_prefetch)
+                auto f1 = [r, conv,
+                              prefetcher = util::detail::make_chunk_prefetcher(
+                                  policy, first)](
                               Iter part_begin, std::size_t part_size) mutable {
                     auto val = HPX_INVOKE(conv, *part_begin);
-                    return detail::sequential_reduce<ExPolicy>(
-                        ++part_begin, --part_size, HPX_MOVE(val), r, conv);
+                    prefetcher.for_each_block(++part_begin, --part_size,
+                        [&](Iter it, std::size_t n) {
+                            val = detail::sequential_reduce<ExPolicy>(
+                                it, n, HPX_MOVE(val), r, conv);
+                        });
+                    return val;
                 };
 
                 return util::partitioner<ExPolicy, T>::call(
@@ -541,23 +550,29 @@ namespace hpx::parallel {
 
                 difference_type count = detail::distance(first1, last1);
 
-                auto f1 = [op1, op2 = HPX_FORWARD(Op2, op2)](
-                              zip_iterator part_begin,
+                // honor the prefetching parameters attached to the policy
+                // (see hpx::execution::experimental::with_prefetch)
+                auto f1 = [op1, op2 = HPX_FORWARD(Op2, op2),
+                              prefetcher = util::detail::make_chunk_prefetcher(
+                                  policy, first1)](zip_iterator part_begin,
                               std::size_t part_size) mutable -> T {
                     auto iters = part_begin.get_iterator_tuple();
                     Iter it1 = hpx::get<0>(iters);
                     Iter2 it2 = hpx::get<1>(iters);
 
-                    Iter last = it1;
-                    std::advance(last, part_size);
-
-                    auto&& r = HPX_INVOKE(op2, *it1, *it2);
+                    T r = HPX_INVOKE(op2, *it1, *it2);
                     ++it1;
                     ++it2;
 
-                    return detail::sequential_reduce<ExPolicy>(it1, last, it2,
-                        HPX_MOVE(r), HPX_FORWARD(Op1, op1),
-                        HPX_FORWARD(Op2, op2));
+                    prefetcher.for_each_block(
+                        it1, part_size - 1, [&](Iter it, std::size_t n) {
+                            Iter last = it;
+                            std::advance(last, n);
+                            r = detail::sequential_reduce<ExPolicy>(
+                                it, last, it2, HPX_MOVE(r), op1, op2);
+                            std::advance(it2, n);
+                        });
+                    return r;
                 };
 
                 return util::partitioner<ExPolicy, T>::call(
@@ -303,6 +303,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -332,34 +333,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential unique with projection function
-        template <typename FwdIter, typename Sent, typename Pred, typename Proj>
-        constexpr FwdIter sequential_unique(
-            FwdIter first, Sent last, Pred&& pred, Proj&& proj)
-        {
-            if (first == last)
-                return first;
-
-            using element_type =
-                typename std::iterator_traits<FwdIter>::value_type;
-
-            FwdIter result = first;
-            element_type result_projected = HPX_INVOKE(proj, *result);
-            while (++first != last)
-            {
-                if (!HPX_INVOKE(
-                        pred, result_projected, HPX_INVOKE(proj, *first)))
-                {
-                    if (++result != first)
-                    {
-                        *result = HPX_MOVE(*first);
-                    }
-                    result_projected = HPX_INVOKE(proj, *result);
-                }
-            }
-            return ++result;
-        }
-
         template <typename Iter>
         struct unique : public algorithm<unique<Iter>, Iter>
         {
@@ -373,8 +346,8 @@ namespace hpx::parallel {
             static constexpr InIter sequential(
                 ExPolicy, InIter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_unique(first, last, HPX_FORWARD(Pred, pred),
-                    HPX_FORWARD(Proj, proj));
+                return sequential_unique<ExPolicy>(first, last,
+                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
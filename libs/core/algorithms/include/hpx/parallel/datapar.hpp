@@ -14,18 +14,24 @@
 #include <hpx/executors/datapar/execution_policy.hpp>
 #include <hpx/parallel/datapar/adjacent_difference.hpp>
 #include <hpx/parallel/datapar/adjacent_find.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
 #include <hpx/parallel/datapar/equal.hpp>
 #include <hpx/parallel/datapar/fill.hpp>
 #include <hpx/parallel/datapar/find.hpp>
 #include <hpx/parallel/datapar/generate.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
+#include <hpx/parallel/datapar/histogram.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
 #include <hpx/parallel/datapar/mismatch.hpp>
+#include <hpx/parallel/datapar/partition.hpp>
 #include <hpx/parallel/datapar/reduce.hpp>
+#include <hpx/parallel/datapar/remove.hpp>
 #include <hpx/parallel/datapar/replace.hpp>
+#include <hpx/parallel/datapar/sort.hpp>
 #include <hpx/parallel/datapar/transfer.hpp>
 #include <hpx/parallel/datapar/transform_loop.hpp>
+#include <hpx/parallel/datapar/unique.hpp>
 #include <hpx/parallel/datapar/zip_iterator.hpp>
 
 #endif
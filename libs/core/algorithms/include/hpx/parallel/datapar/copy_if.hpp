@@ -0,0 +1,210 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The predicate is applied to whole vector packs of (projected) elements
+    template <typename Iter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct is_datapar_compress_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct is_datapar_compress_compatible<Iter, Pred, Proj,
+        std::enable_if_t<util::detail::iterator_datapar_compatible_v<Iter>>>
+      : std::is_invocable<Pred&,
+            hpx::util::invoke_result_t<Proj&,
+                traits::vector_pack_type_t<
+                    typename std::iterator_traits<Iter>::value_type>&>>
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    inline constexpr bool is_datapar_compress_compatible_v =
+        is_datapar_compress_compatible<Iter, Pred, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper for the stream compaction algorithms (copy_if, remove_if,
+    // unique). The elements are processed one vector pack at a time: they are
+    // copied to an aligned buffer (which also takes care of unaligned input
+    // sequences), the predicate is evaluated for the whole vector pack, and
+    // the selected elements are compacted inside the buffer before being
+    // written to the destination.
+    template <typename Iter>
+    struct datapar_compress
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+        static constexpr std::size_t alignment =
+            traits::vector_pack_alignment_v<V>;
+
+        // Load the next (at most) 'size' elements into the buffer. Unused
+        // elements are filled with the first element to make sure the
+        // predicate sees valid values only.
+        HPX_HOST_DEVICE HPX_FORCEINLINE static V load(
+            Iter it, std::size_t count, value_type* buffer)
+        {
+            std::copy_n(it, count, buffer);
+            if (count != size)
+            {
+                std::fill(buffer + count, buffer + size, buffer[0]);
+            }
+            return traits::vector_pack_load<V, value_type>::aligned(buffer);
+        }
+
+        // Emulated compress-store: move the first 'count' elements of the
+        // buffer whose mask element is set to the front of the buffer,
+        // without branching on the mask. Returns the number of selected
+        // elements.
+        template <typename Mask>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t compress(
+            value_type* buffer, std::size_t count, Mask& msk)
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                buffer[result] = buffer[i];
+                result += static_cast<bool>(traits::get(msk, i));
+            }
+            return result;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_copy_if
+    {
+        template <typename InIter, typename OutIter, typename Pred,
+            typename Proj>
+        static util::in_out_result<InIter, OutIter> call(InIter first,
+            std::size_t count, OutIter dest, Pred& pred, Proj& proj)
+        {
+            using compress = datapar_compress<InIter>;
+            using value_type = typename compress::value_type;
+
+            alignas(compress::alignment) value_type buffer[compress::size];
+
+            while (count != 0)
+            {
+                std::size_t const n = (std::min)(count, compress::size);
+                auto values = compress::load(first, n, buffer);
+                auto msk = HPX_INVOKE(pred, HPX_INVOKE(proj, values));
+
+                dest = std::copy_n(
+                    buffer, compress::compress(buffer, n, msk), dest);
+
+                std::advance(first, n);
+                count -= n;
+            }
+            return util::in_out_result<InIter, OutIter>{
+                HPX_MOVE(first), HPX_MOVE(dest)};
+        }
+
+        template <typename InIter, typename Pred, typename Proj>
+        static std::size_t count(
+            InIter first, std::size_t count, Pred& pred, Proj& proj)
+        {
+            using compress = datapar_compress<InIter>;
+            using value_type = typename compress::value_type;
+
+            alignas(compress::alignment) value_type buffer[compress::size];
+
+            std::size_t result = 0;
+            while (count >= compress::size)
+            {
+                auto values = compress::load(first, compress::size, buffer);
+                result += traits::count_bits(
+                    HPX_INVOKE(pred, HPX_INVOKE(proj, values)));
+
+                std::advance(first, compress::size);
+                count -= compress::size;
+            }
+
+            if (count != 0)
+            {
+                auto values = compress::load(first, count, buffer);
+                auto msk = HPX_INVOKE(pred, HPX_INVOKE(proj, values));
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    result += static_cast<bool>(traits::get(msk, i));
+                }
+            }
+            return result;
+        }
+    };
+
+    template <typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<InIter1, OutIter>
+    tag_invoke(sequential_copy_if_t<ExPolicy>, InIter1 first, InIter2 last,
+        OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        if constexpr (std::is_same_v<InIter1, InIter2> &&
+            is_datapar_compress_compatible_v<InIter1, Pred, Proj>)
+        {
+            return datapar_copy_if<ExPolicy>::call(
+                first, std::distance(first, last), dest, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_copy_if<base_policy_type>(first, last, dest,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename InIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t tag_invoke(
+        sequential_copy_if_t<ExPolicy>, InIter first, std::size_t count,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (is_datapar_compress_compatible_v<InIter, Pred, Proj>)
+        {
+            return datapar_copy_if<ExPolicy>::count(first, count, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_copy_if<base_policy_type>(first, count,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
@@ -0,0 +1,151 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The bin function is applied to whole vector packs of elements and has
+    // to return a vector pack of integral bin indices
+    template <typename V, typename F, typename Enable = void>
+    struct is_datapar_histogram_function : std::false_type
+    {
+    };
+
+    template <typename V, typename F>
+    struct is_datapar_histogram_function<V, F,
+        std::void_t<decltype(traits::get(
+            std::declval<hpx::util::invoke_result_t<F&, V&> const&>(), 0))>>
+      : std::is_integral<std::decay_t<decltype(traits::get(
+            std::declval<hpx::util::invoke_result_t<F&, V&> const&>(), 0))>>
+    {
+    };
+
+    template <typename Iter, typename F>
+    inline constexpr bool is_datapar_histogram_compatible_v = [] {
+        if constexpr (util::detail::iterator_datapar_compatible_v<Iter>)
+        {
+            using V = traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type>;
+            return is_datapar_histogram_function<V, F>::value;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Histograms of up to this many bins are updated by comparing the vector
+    // pack of bin indices with every bin, larger histograms are updated one
+    // element at a time.
+    inline constexpr std::size_t datapar_histogram_max_bins = 16;
+
+    template <typename ExPolicy>
+    struct datapar_histogram
+    {
+        template <typename IndexPack>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void update(std::size_t* bins,
+            std::size_t num_bins, IndexPack const& idx, std::size_t count)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                auto const bin = static_cast<std::size_t>(traits::get(idx, i));
+                if (bin < num_bins)
+                {
+                    ++bins[bin];
+                }
+            }
+        }
+
+        template <typename Iter, typename F>
+        static void call(Iter first, std::size_t count, std::size_t* bins,
+            std::size_t num_bins, F& f)
+        {
+            using compress = datapar_compress<Iter>;
+            using value_type = typename compress::value_type;
+
+            alignas(compress::alignment) value_type buffer[compress::size];
+
+            bool const compare_bins = num_bins <= datapar_histogram_max_bins;
+            while (count >= compress::size)
+            {
+                auto values = compress::load(first, compress::size, buffer);
+                auto const idx = HPX_INVOKE(f, values);
+
+                if (compare_bins)
+                {
+                    using index_pack = std::decay_t<decltype(idx)>;
+                    using index_type =
+                        std::decay_t<decltype(traits::get(idx, 0))>;
+
+                    // bin indices out of range do not match any bin, no
+                    // branches depend on the values
+                    for (std::size_t bin = 0; bin != num_bins; ++bin)
+                    {
+                        bins[bin] += traits::count_bits(
+                            idx == index_pack(static_cast<index_type>(bin)));
+                    }
+                }
+                else
+                {
+                    update(bins, num_bins, idx, compress::size);
+                }
+
+                std::advance(first, compress::size);
+                count -= compress::size;
+            }
+
+            if (count != 0)
+            {
+                auto values = compress::load(first, count, buffer);
+                update(bins, num_bins, HPX_INVOKE(f, values), count);
+            }
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename F,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(
+        sequential_histogram_t<ExPolicy>, InIter first, std::size_t count,
+        std::size_t* bins, std::size_t num_bins, F&& f)
+    {
+        if constexpr (is_datapar_histogram_compatible_v<InIter, F>)
+        {
+            datapar_histogram<ExPolicy>::call(first, count, bins, num_bins, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_histogram<base_policy_type>(
+                first, count, bins, num_bins, HPX_FORWARD(F, f));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
@@ -58,8 +58,7 @@ namespace hpx::parallel::util {
 
                     constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                    End const lastV = last - (size + 1);
-                    while (first < lastV)
+                    while (static_cast<std::size_t>(last - first) > size + 1)
                     {
                         datapar_loop_step<Begin>::callv(f, first);
                     }
@@ -119,9 +118,7 @@ namespace hpx::parallel::util {
 
                 constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                End const lastV = last - (size + 1);
-
-                while (first < lastV)
+                while (static_cast<std::size_t>(last - first) > size + 1)
                 {
                     int offset =
                         datapar_loop_pred_step<Begin>::callv(pred, first);
@@ -170,8 +167,7 @@ namespace hpx::parallel::util {
 
                     constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                    End const lastV = last - (size + 1);
-                    while (first < lastV)
+                    while (static_cast<std::size_t>(last - first) > size + 1)
                     {
                         datapar_loop_step_ind<Begin>::callv(f, first);
                     }
@@ -294,11 +290,17 @@ namespace hpx::parallel::util {
             HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr InIter call(
                 InIter first, std::size_t count, CancelToken& tok, F&& f)
             {
-                // check at the start of a partition only
-                if (tok.was_cancelled())
-                    return first;
-
-                return call(first, count, HPX_FORWARD(F, f));
+                // check the token every HPX_CANCELLATION_CHECK_INTERVAL
+                // vector packs, this keeps the vectorized inner loop intact
+                constexpr std::size_t block = HPX_CANCELLATION_CHECK_INTERVAL *
+                    traits::vector_pack_size_v<V>;
+
+                return cancellable_loop_n<hpx::execution::sequenced_policy,
+                    block>(
+                    first, count, [&tok]() { return tok.was_cancelled(); },
+                    [&](InIter it, std::size_t num) {
+                        return call(it, num, f);
+                    });
             }
         };
 
@@ -404,10 +406,22 @@ namespace hpx::parallel::util {
                 std::size_t base_idx, Iter it, std::size_t count,
                 CancelToken& tok, F&& f)
             {
-                if (tok.was_cancelled(base_idx))
-                    return it;
-
-                return call(base_idx, it, count, HPX_FORWARD(F, f));
+                // check the token every HPX_CANCELLATION_CHECK_INTERVAL
+                // vector packs, this keeps the vectorized inner loop intact
+                constexpr std::size_t block = HPX_CANCELLATION_CHECK_INTERVAL *
+                    traits::vector_pack_size_v<V>;
+
+                return cancellable_loop_n<hpx::execution::sequenced_policy,
+                    block>(
+                    it, count,
+                    [&tok, &base_idx]() {
+                        return tok.was_cancelled(base_idx);
+                    },
+                    [&](Iter first, std::size_t num) {
+                        first = call(base_idx, first, num, f);
+                        base_idx += num;
+                        return first;
+                    });
             }
         };
     }    // namespace detail
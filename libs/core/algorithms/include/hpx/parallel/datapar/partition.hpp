@@ -0,0 +1,200 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/assert.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/partition.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The predicate is applied to whole vector packs of (projected) elements
+    template <typename V, typename Pred, typename Proj, typename Enable = void>
+    struct is_datapar_partition_predicate : std::false_type
+    {
+    };
+
+    template <typename V, typename Pred, typename Proj>
+    struct is_datapar_partition_predicate<V, Pred, Proj,
+        std::void_t<decltype(HPX_INVOKE(std::declval<Pred&>(),
+            HPX_INVOKE(std::declval<Proj&>(), std::declval<V&>())))>>
+      : std::true_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    inline constexpr bool is_datapar_partition_compatible_v = [] {
+        if constexpr (util::detail::iterator_datapar_compatible_v<Iter>)
+        {
+            using V = traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type>;
+            return is_datapar_partition_predicate<V, Pred, Proj>::value;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_partition
+    {
+        // Distribute the first 'count' elements of the (aligned) buffer to
+        // the free space [write_left, write_right): elements satisfying the
+        // predicate are written to the front, all others to the back. The
+        // predicate is evaluated for a whole vector pack at once, the
+        // elements are stored without branching on the outcome (emulating a
+        // compress-store): each element is written to both ends and only the
+        // end it belongs to is advanced. This requires at least 'count' free
+        // elements at either end, or 'count' free elements overall.
+        // Returns the number of elements written to the front.
+        template <typename V, typename T, typename Iter, typename Pred,
+            typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t partition_block(
+            T const* buffer, std::size_t count, Iter write_left,
+            Iter write_right, Pred& pred, Proj& proj)
+        {
+            V values = traits::vector_pack_load<V, T>::aligned(buffer);
+            auto msk = HPX_INVOKE(pred, HPX_INVOKE(proj, values));
+
+            std::size_t left = 0;
+            std::size_t right = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                bool const is_left = traits::get(msk, i);
+                *(write_left + left) = buffer[i];
+                *(write_right - (right + 1)) = buffer[i];
+                left += is_left;
+                right += !is_left;
+            }
+            return left;
+        }
+
+        template <typename Iter, typename Pred, typename Proj>
+        static Iter call(Iter first, Iter last, Pred&& pred, Proj&& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+            constexpr std::size_t alignment =
+                traits::vector_pack_alignment_v<V>;
+
+            std::size_t const count = last - first;
+            if constexpr (size == 1)
+            {
+                return sequential_partition_helper(first, last,
+                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+            }
+            else if (count < 2 * size)
+            {
+                return sequential_partition_helper(first, last,
+                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+            }
+            else
+            {
+                // Keep one vector from either end of the sequence aside to
+                // create free space for the partitioned elements. The free
+                // space at both ends adds up to two vectors at all times.
+                alignas(alignment) value_type front[size];
+                alignas(alignment) value_type back[size];
+                alignas(alignment) value_type buffer[size] = {};
+
+                std::copy_n(first, size, front);
+                std::copy_n(last - size, size, back);
+
+                Iter write_left = first;
+                Iter write_right = last;
+                Iter read_left = first + size;
+                Iter read_right = last - size;
+
+                while (static_cast<std::size_t>(read_right - read_left) >=
+                    size)
+                {
+                    // reading from the side with less free space guarantees
+                    // enough free space at both ends for the next vector
+                    if (read_left - write_left <= write_right - read_right)
+                    {
+                        std::copy_n(read_left, size, buffer);
+                        read_left += size;
+                    }
+                    else
+                    {
+                        read_right -= size;
+                        std::copy_n(read_right, size, buffer);
+                    }
+
+                    std::size_t const left = partition_block<V>(
+                        buffer, size, write_left, write_right, pred, proj);
+                    write_left += left;
+                    write_right -= size - left;
+                }
+
+                // the remaining unpartitioned elements and the vectors kept
+                // aside exactly fill the free space
+                std::size_t const remaining = read_right - read_left;
+                std::copy_n(read_left, remaining, buffer);
+
+                auto const partition_rest = [&](value_type const* values,
+                                                std::size_t n) {
+                    std::size_t const left = partition_block<V>(
+                        values, n, write_left, write_right, pred, proj);
+                    write_left += left;
+                    write_right -= n - left;
+                };
+
+                partition_rest(buffer, remaining);
+                partition_rest(front, size);
+                partition_rest(back, size);
+
+                HPX_ASSERT(write_left == write_right);
+                return write_left;
+            }
+        }
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_partition_t<ExPolicy>, FwdIter first, FwdIter last,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (is_datapar_partition_compatible_v<FwdIter, Pred, Proj>)
+        {
+            return datapar_partition<ExPolicy>::call(first, last,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_partition<base_policy_type>(first, last,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
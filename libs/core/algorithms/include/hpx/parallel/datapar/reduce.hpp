@@ -10,17 +10,24 @@
 
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy.hpp>
 #include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/util/reduction_operators.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -141,6 +148,75 @@ namespace hpx { namespace parallel { namespace detail {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Reductions of arithmetic values using one of the reduction operators
+    // known to be applicable to vector packs are vectorized for all execution
+    // policies (unsequenced policies are handled by unseq/reduce.hpp).
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    inline constexpr bool is_vectorizable_reduce_v =
+        !hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+        !hpx::is_unsequenced_execution_policy_v<ExPolicy> &&
+        hpx::experimental::reduction_operators::is_vectorizable_v<Reduce, T> &&
+        hpx::parallel::util::detail::iterator_datapar_compatible<Iter>::value &&
+        std::is_same_v<typename std::iterator_traits<Iter>::value_type, T>;
+
+    // Unlike the loops used by datapar_reduce, this never writes back to the
+    // input sequence, which therefore may be const.
+    template <typename Iter, typename T, typename Reduce>
+    T vectorized_reduce_n(Iter first, std::size_t count, T init, Reduce& r)
+    {
+        using V = traits::vector_pack_type_t<T>;
+        constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        while (count != 0 && !util::detail::is_data_aligned(first))
+        {
+            init = r(init, *first);
+            ++first;
+            --count;
+        }
+
+        if (count >= size)
+        {
+            V acc(traits::vector_pack_load<V, T>::aligned(first));
+            std::advance(first, size);
+            count -= size;
+
+            for (/**/; count >= size; count -= size)
+            {
+                acc = r(acc, traits::vector_pack_load<V, T>::aligned(first));
+                std::advance(first, size);
+            }
+            init = r(init, static_cast<T>(traits::reduce(r, acc)));
+        }
+
+        for (/**/; count != 0; --count, ++first)
+        {
+            init = r(init, *first);
+        }
+        return init;
+    }
+
+    template <typename ExPolicy, typename InIterB, typename InIterE, typename T,
+        typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            is_vectorizable_reduce_v<ExPolicy, InIterB, T, Reduce> &&
+            hpx::traits::is_random_access_iterator_v<InIterE>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(sequential_reduce_t<ExPolicy>,
+        ExPolicy&&, InIterB first, InIterE last, T init, Reduce&& r)
+    {
+        return vectorized_reduce_n(first,
+            static_cast<std::size_t>(std::distance(first, last)), init, r);
+    }
+
+    template <typename ExPolicy, typename T, typename FwdIter, typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            is_vectorizable_reduce_v<ExPolicy, FwdIter, T, Reduce>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(sequential_reduce_t<ExPolicy>,
+        FwdIter part_begin, std::size_t part_size, T init, Reduce r)
+    {
+        return vectorized_reduce_n(part_begin, part_size, init, r);
+    }
+
     template <typename ExPolicy, typename Iter, typename Sent, typename T,
         typename Reduce, typename Convert,
         HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
@@ -0,0 +1,89 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/algorithms/detail/remove.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
+#include <hpx/parallel/datapar/find.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_remove_if
+    {
+        template <typename Iter, typename Pred, typename Proj>
+        static Iter call(Iter first, Iter last, Pred& pred, Proj& proj)
+        {
+            using compress = datapar_compress<Iter>;
+            using value_type = typename compress::value_type;
+
+            first = sequential_find_if<ExPolicy>(first, last, pred, proj);
+            if (first == last)
+            {
+                return first;
+            }
+
+            // all elements are loaded before the compacted elements are
+            // written, the destination never overtakes the source
+            alignas(compress::alignment) value_type buffer[compress::size];
+
+            Iter it = std::next(first);
+            std::size_t count = std::distance(it, last);
+            while (count != 0)
+            {
+                std::size_t const n = (std::min)(count, compress::size);
+                auto values = compress::load(it, n, buffer);
+                auto msk = !HPX_INVOKE(pred, HPX_INVOKE(proj, values));
+
+                first = std::copy_n(
+                    buffer, compress::compress(buffer, n, msk), first);
+
+                std::advance(it, n);
+                count -= n;
+            }
+            return first;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_remove_if_t<ExPolicy>, Iter first, Sent last, Pred pred,
+        Proj proj)
+    {
+        if constexpr (std::is_same_v<Iter, Sent> &&
+            is_datapar_compress_compatible_v<Iter, Pred, Proj>)
+        {
+            return datapar_remove_if<ExPolicy>::call(first, last, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_remove_if<base_policy_type>(
+                first, last, HPX_MOVE(pred), HPX_MOVE(proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
@@ -0,0 +1,228 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only the natural (ascending or descending) order of arithmetic values
+    // can be sorted using vector packs.
+    template <typename Comp>
+    struct is_datapar_sort_less : std::false_type
+    {
+    };
+
+    template <>
+    struct is_datapar_sort_less<detail::less> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_datapar_sort_less<std::less<>> : std::true_type
+    {
+    };
+
+    template <typename Comp, typename Proj>
+    struct is_datapar_sort_less<util::compare_projected<Comp, Proj>>
+      : std::integral_constant<bool,
+            std::is_same_v<std::decay_t<Proj>, hpx::identity> &&
+                is_datapar_sort_less<std::decay_t<Comp>>::value>
+    {
+    };
+
+    template <typename Comp>
+    struct is_datapar_sort_greater : std::false_type
+    {
+    };
+
+    template <>
+    struct is_datapar_sort_greater<detail::greater> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_datapar_sort_greater<std::greater<>> : std::true_type
+    {
+    };
+
+    template <typename Comp, typename Proj>
+    struct is_datapar_sort_greater<util::compare_projected<Comp, Proj>>
+      : std::integral_constant<bool,
+            std::is_same_v<std::decay_t<Proj>, hpx::identity> &&
+                is_datapar_sort_greater<std::decay_t<Comp>>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequences of up to this many elements are sorted using a sorting
+    // network
+    inline constexpr std::size_t datapar_sort_network_size = 16;
+
+    template <typename ExPolicy>
+    struct datapar_sort
+    {
+        // Sort a small sequence using Batcher's odd-even merge sort network
+        // for datapar_sort_network_size elements. The comparators touching
+        // elements beyond 'count' are skipped, which is equivalent to
+        // padding the sequence with elements that compare greater than all
+        // others. The compare-exchange operations do not branch on the
+        // compared values.
+        template <typename Iter, typename Comp>
+        static void sort_network(Iter first, std::size_t count, Comp comp)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            constexpr std::size_t size = datapar_sort_network_size;
+
+            HPX_ASSERT(count <= size);
+
+            value_type values[size];
+            std::copy_n(first, count, values);
+
+            for (std::size_t p = 1; p < size; p <<= 1)
+            {
+                for (std::size_t k = p; k >= 1; k >>= 1)
+                {
+                    for (std::size_t j = k % p; j + k < size; j += 2 * k)
+                    {
+                        for (std::size_t i = 0;
+                             i != (std::min)(k, size - j - k); ++i)
+                        {
+                            std::size_t const lo = i + j;
+                            std::size_t const hi = i + j + k;
+                            if (hi < count && lo / (2 * p) == hi / (2 * p))
+                            {
+                                value_type const a = values[lo];
+                                value_type const b = values[hi];
+                                bool const swap = comp(b, a);
+                                values[lo] = swap ? b : a;
+                                values[hi] = swap ? a : b;
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::copy_n(values, count, first);
+        }
+
+        // Introsort: quicksort partitioning the elements using vector packs,
+        // sorting networks for the small sub-sequences, and falling back to
+        // the scalar sort if the recursion gets too deep.
+        template <typename Iter, typename Comp>
+        static void sort(Iter first, Iter last, Comp comp, std::size_t depth)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            while (static_cast<std::size_t>(last - first) >
+                datapar_sort_network_size)
+            {
+                if (depth-- == 0)
+                {
+                    std::sort(first, last, comp);
+                    return;
+                }
+
+                std::size_t const chunk = (last - first) >> 3;
+                value_type const pivot = *mid9(first, first + chunk,
+                    first + 2 * chunk, first + 3 * chunk, first + 4 * chunk,
+                    first + 5 * chunk, first + 6 * chunk, first + 7 * chunk,
+                    last - 1, comp);
+
+                Iter const mid = datapar_partition<ExPolicy>::call(
+                    first, last,
+                    [&](auto const& v) { return comp(v, pivot); },
+                    hpx::identity_v);
+
+                if (mid == first)
+                {
+                    // no element orders before the pivot, all elements
+                    // equivalent to the pivot are in their final position
+                    first = datapar_partition<ExPolicy>::call(
+                        first, last,
+                        [&](auto const& v) { return !comp(pivot, v); },
+                        hpx::identity_v);
+                    continue;
+                }
+
+                // recurse into the smaller part only
+                if (mid - first < last - mid)
+                {
+                    sort(first, mid, comp, depth);
+                    first = mid;
+                }
+                else
+                {
+                    sort(mid, last, comp, depth);
+                    last = mid;
+                }
+            }
+
+            sort_network(first, last - first, comp);
+        }
+
+        template <typename Iter, typename Comp>
+        static void call(Iter first, Iter last, Comp comp)
+        {
+            std::size_t depth = 0;
+            for (std::size_t n = last - first; n > 1; n >>= 1)
+            {
+                depth += 2;
+            }
+            sort(first, last, comp, depth);
+        }
+    };
+
+    template <typename ExPolicy, typename RandomIt, typename Comp,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(sequential_sort_t<ExPolicy>,
+        RandomIt first, RandomIt last, Comp&& comp)
+    {
+        constexpr bool is_compatible =
+            util::detail::iterator_datapar_compatible_v<RandomIt>;
+
+        if constexpr (is_compatible &&
+            is_datapar_sort_less<std::decay_t<Comp>>::value)
+        {
+            datapar_sort<ExPolicy>::call(first, last, detail::less());
+        }
+        else if constexpr (is_compatible &&
+            is_datapar_sort_greater<std::decay_t<Comp>>::value)
+        {
+            datapar_sort<ExPolicy>::call(first, last, detail::greater());
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_sort<base_policy_type>(
+                first, last, HPX_FORWARD(Comp, comp));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
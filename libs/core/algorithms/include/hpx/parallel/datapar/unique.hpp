@@ -0,0 +1,124 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The binary predicate is applied to two vector packs of (projected)
+    // elements
+    template <typename Iter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct is_datapar_unique_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct is_datapar_unique_compatible<Iter, Pred, Proj,
+        std::enable_if_t<util::detail::iterator_datapar_compatible_v<Iter>>>
+      : std::is_invocable<Pred&,
+            hpx::util::invoke_result_t<Proj&,
+                traits::vector_pack_type_t<
+                    typename std::iterator_traits<Iter>::value_type>&>,
+            hpx::util::invoke_result_t<Proj&,
+                traits::vector_pack_type_t<
+                    typename std::iterator_traits<Iter>::value_type>&>>
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    inline constexpr bool is_datapar_unique_compatible_v =
+        is_datapar_unique_compatible<Iter, Pred, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_unique
+    {
+        // Each element is compared with its predecessor in the input
+        // sequence. As the predicate is required to be an equivalence
+        // relation, this is the same as comparing it with the last element
+        // that was kept.
+        template <typename Iter, typename Pred, typename Proj>
+        static Iter call(Iter first, Iter last, Pred& pred, Proj& proj)
+        {
+            using compress = datapar_compress<Iter>;
+            using value_type = typename compress::value_type;
+
+            if (first == last)
+            {
+                return first;
+            }
+
+            // Both vector packs are loaded before the compacted elements are
+            // written. The destination never overtakes the source and the
+            // predecessor of the first loaded element was either not
+            // overwritten or was overwritten with itself.
+            alignas(compress::alignment) value_type prev[compress::size];
+            alignas(compress::alignment) value_type buffer[compress::size];
+
+            Iter it = std::next(first);
+            Iter dest = it;
+            std::size_t count = std::distance(it, last);
+            while (count != 0)
+            {
+                std::size_t const n = (std::min)(count, compress::size);
+                auto prev_values = compress::load(std::prev(it), n, prev);
+                auto values = compress::load(it, n, buffer);
+                auto msk = !HPX_INVOKE(pred, HPX_INVOKE(proj, prev_values),
+                    HPX_INVOKE(proj, values));
+
+                dest = std::copy_n(
+                    buffer, compress::compress(buffer, n, msk), dest);
+
+                std::advance(it, n);
+                count -= n;
+            }
+            return dest;
+        }
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_unique_t<ExPolicy>, FwdIter first, Sent last, Pred&& pred,
+        Proj&& proj)
+    {
+        if constexpr (std::is_same_v<FwdIter, Sent> &&
+            is_datapar_unique_compatible_v<FwdIter, Pred, Proj>)
+        {
+            return datapar_unique<ExPolicy>::call(first, last, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_unique<base_policy_type>(first, last,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
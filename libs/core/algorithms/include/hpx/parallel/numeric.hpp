@@ -14,6 +14,7 @@
 
 #include <hpx/parallel/algorithms/adjacent_difference.hpp>
 #include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/parallel/algorithms/transform_exclusive_scan.hpp>
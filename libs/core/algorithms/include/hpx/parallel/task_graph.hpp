@@ -0,0 +1,265 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/errors/exception_list.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Top-level namespace
+namespace hpx::experimental {
+
+    /// A \c task_graph records a directed acyclic graph of tasks once and
+    /// executes it any number of times. The tasks, their dependencies, and the
+    /// state needed to track them are created while recording the graph, and
+    /// are reused by every replay. This avoids allocating the shared states
+    /// and attaching the continuations that building the same graph out of
+    /// futures (e.g. using \a hpx::dataflow) requires for every iteration of
+    /// an application.
+    ///
+    /// A task can depend only on tasks that were added to the graph before
+    /// it, which makes sure that the graph has no cycles.
+    class task_graph
+    {
+    public:
+        /// The type of the handles identifying the tasks of a \c task_graph
+        using node = std::size_t;
+
+        HPX_CORE_EXPORT task_graph();
+        HPX_CORE_EXPORT ~task_graph();
+
+        task_graph(task_graph const&) = delete;
+        task_graph(task_graph&&) noexcept = default;
+
+        task_graph& operator=(task_graph const&) = delete;
+        task_graph& operator=(task_graph&&) noexcept = default;
+
+        /// \brief Creates a new \c task_graph and invokes \c f with a
+        ///        reference to it, \c f is expected to add the tasks of the
+        ///        graph.
+        ///
+        /// \tparam F  The type of the user defined function to invoke.
+        ///
+        /// \param f   The user defined function recording the tasks.
+        ///
+        /// \returns   The recorded \c task_graph.
+        template <typename F>
+        static task_graph record(F&& f)
+        {
+            task_graph g;
+            HPX_INVOKE(HPX_FORWARD(F, f), g);
+            return g;
+        }
+
+        /// \brief Adds a task to compute \c f() to the graph. The task is run
+        ///        on every replay of the graph, after all of the given
+        ///        dependencies have completed.
+        ///
+        /// \tparam F     The type of the user defined function to invoke.
+        /// \tparam Nodes The types of the handles of the dependencies.
+        ///
+        /// \param f      The user defined function to invoke.
+        /// \param dependencies The handles of the tasks that have to
+        ///               complete before \c f is invoked.
+        ///
+        /// \returns      The handle identifying the new task.
+        // clang-format off
+        template <typename F, typename... Nodes,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_invocable_v<std::decay_t<F>&> &&
+                (std::is_convertible_v<Nodes, node> && ...)
+            )>
+        // clang-format on
+        node add(F&& f, Nodes... dependencies)
+        {
+            std::array<node, sizeof...(Nodes)> const deps = {
+                static_cast<node>(dependencies)...};
+            return add_node(hpx::move_only_function<void()>(HPX_FORWARD(F, f)),
+                deps.data(), deps.size());
+        }
+
+        /// \brief Adds a task to compute \c f() to the graph. The task is run
+        ///        on every replay of the graph, after all of the given
+        ///        dependencies have completed.
+        ///
+        /// \tparam F     The type of the user defined function to invoke.
+        ///
+        /// \param f      The user defined function to invoke.
+        /// \param dependencies The handles of the tasks that have to
+        ///               complete before \c f is invoked.
+        ///
+        /// \returns      The handle identifying the new task.
+        template <typename F>
+        node add(F&& f, std::vector<node> const& dependencies)
+        {
+            return add_node(hpx::move_only_function<void()>(HPX_FORWARD(F, f)),
+                dependencies.data(), dependencies.size());
+        }
+
+        /// \brief Makes the task \c n depend on the task \c dependency, which
+        ///        must have been added to the graph before \c n.
+        HPX_CORE_EXPORT void add_dependency(node n, node dependency);
+
+        /// \brief Returns the number of tasks in the graph.
+        [[nodiscard]] HPX_CORE_EXPORT std::size_t size() const noexcept;
+
+        /// \brief Removes all tasks from the graph.
+        HPX_CORE_EXPORT void clear();
+
+        /// \brief Executes all tasks of the graph respecting their
+        ///        dependencies.
+        ///
+        /// The graph must not be modified or destroyed and must not be
+        /// replayed again before the returned future has become ready. If
+        /// any of the tasks throws an exception, the tasks that have not been
+        /// started yet are skipped and the returned future holds an
+        /// \a hpx::exception_list with all exceptions thrown.
+        ///
+        /// \tparam Executor  The type of the executor to use.
+        ///
+        /// \param exec       The executor to use for running the tasks.
+        ///
+        /// \returns          A future that becomes ready once all tasks have
+        ///                   completed.
+        // clang-format off
+        template <typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_any_v<std::decay_t<Executor>>
+            )>
+        // clang-format on
+        hpx::future<void> replay(Executor&& exec)
+        {
+            hpx::future<void> f = start_replay();
+
+            // the graph may be destroyed as soon as the last task has
+            // completed, don't access it after spawning the last root
+            graph_data* data = data_.get();
+            node const* roots = data->roots.data();
+            std::size_t const num_roots = data->roots.size();
+
+            std::decay_t<Executor> const& e = exec;
+            for (std::size_t i = 0; i != num_roots; ++i)
+            {
+                spawn(e, data, roots[i]);
+            }
+            return f;
+        }
+
+        /// \brief Executes all tasks of the graph respecting their
+        ///        dependencies using the default parallel executor.
+        hpx::future<void> replay()
+        {
+            return replay(execution::parallel_executor{});
+        }
+
+    private:
+        struct node_data
+        {
+            hpx::move_only_function<void()> f;
+            std::vector<node> successors;
+            std::size_t num_dependencies = 0;
+        };
+
+        struct graph_data
+        {
+            std::vector<node_data> nodes;
+
+            // the state of the replays is created once for all of them
+            std::vector<node> roots;
+            std::unique_ptr<std::atomic<std::size_t>[]> pending;
+            std::size_t num_pending = 0;
+            bool modified = true;
+
+            std::atomic<std::size_t> remaining{0};
+            std::atomic<bool> running{false};
+            std::atomic<bool> failed{false};
+            hpx::exception_list errors;
+            hpx::promise<void> done;
+        };
+
+        HPX_CORE_EXPORT node add_node(hpx::move_only_function<void()> f,
+            node const* dependencies, std::size_t count);
+
+        HPX_CORE_EXPORT hpx::future<void> start_replay();
+
+        HPX_CORE_EXPORT static void add_exception(
+            graph_data* data, std::exception_ptr e);
+
+        // completes the replay once the last of its tasks has finished
+        HPX_CORE_EXPORT static void finish_node(graph_data* data);
+
+        template <typename Executor>
+        static void spawn(Executor const& exec, graph_data* data, node n)
+        {
+            hpx::parallel::execution::post(
+                exec, [exec, data, n]() { execute(exec, data, n); });
+        }
+
+        template <typename Executor>
+        static void execute(Executor const& exec, graph_data* data, node n)
+        {
+            constexpr node no_node = static_cast<node>(-1);
+            while (true)
+            {
+                node_data& current = data->nodes[n];
+                if (!data->failed.load(std::memory_order_relaxed))
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() { current.f(); },
+                        [data](std::exception_ptr e) {
+                            add_exception(data, HPX_MOVE(e));
+                        });
+                }
+
+                // the last successor that became ready is run directly by
+                // this thread, all others are spawned as new tasks
+                node next = no_node;
+                for (node const successor : current.successors)
+                {
+                    if (data->pending[successor].fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next != no_node)
+                        {
+                            spawn(exec, data, next);
+                        }
+                        next = successor;
+                    }
+                }
+
+                finish_node(data);
+                if (next == no_node)
+                {
+                    break;
+                }
+                n = next;
+            }
+        }
+
+    private:
+        std::unique_ptr<graph_data> data_;
+    };
+}    // namespace hpx::experimental
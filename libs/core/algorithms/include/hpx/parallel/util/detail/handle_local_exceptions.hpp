@@ -18,9 +18,11 @@
 #endif
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <list>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -28,6 +30,106 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parallel::util::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Collects the exceptions thrown by concurrently executed chunks of an
+    // algorithm. The exceptions are kept in a lock-free list, its nodes are
+    // allocated only if an exception was actually thrown. A std::bad_alloc
+    // is only recorded, as it has to be rethrown as is.
+    class concurrent_exception_collector
+    {
+    private:
+        struct node
+        {
+            std::exception_ptr exception_;
+            node* next_;
+        };
+
+    public:
+        concurrent_exception_collector() = default;
+
+        concurrent_exception_collector(
+            concurrent_exception_collector const&) = delete;
+        concurrent_exception_collector(
+            concurrent_exception_collector&&) = delete;
+        concurrent_exception_collector& operator=(
+            concurrent_exception_collector const&) = delete;
+        concurrent_exception_collector& operator=(
+            concurrent_exception_collector&&) = delete;
+
+        ~concurrent_exception_collector()
+        {
+            node* n = head_.load(std::memory_order_relaxed);
+            while (n != nullptr)
+            {
+                node* next = n->next_;
+                delete n;
+                n = next;
+            }
+        }
+
+        // Store the exception currently being handled, this has to be called
+        // from within a catch block.
+        void capture() noexcept
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            try
+            {
+                throw;
+            }
+            catch (std::bad_alloc const&)
+            {
+                bad_alloc_thrown_.store(true, std::memory_order_relaxed);
+            }
+            catch (...)
+            {
+                node* n = new (std::nothrow)
+                    node{std::current_exception(), nullptr};
+                if (n == nullptr)
+                {
+                    bad_alloc_thrown_.store(true, std::memory_order_relaxed);
+                    return;
+                }
+
+                n->next_ = head_.load(std::memory_order_relaxed);
+                while (!head_.compare_exchange_weak(n->next_, n,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+#endif
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return !bad_alloc_thrown_.load(std::memory_order_relaxed) &&
+                head_.load(std::memory_order_acquire) == nullptr;
+        }
+
+        [[nodiscard]] bool bad_alloc_thrown() const noexcept
+        {
+            return bad_alloc_thrown_.load(std::memory_order_relaxed);
+        }
+
+        // Move all collected exceptions into the given list, this may be
+        // called only after all chunks have finished executing.
+        void extract(std::list<std::exception_ptr>& errors)    //-V826
+        {
+            node* n = head_.exchange(nullptr, std::memory_order_acquire);
+            while (n != nullptr)
+            {
+                errors.push_front(HPX_MOVE(n->exception_));
+
+                node* next = n->next_;
+                delete n;
+                n = next;
+            }
+        }
+
+    private:
+        std::atomic<node*> head_{nullptr};
+        std::atomic<bool> bad_alloc_thrown_{false};
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename Enable = void>
     struct handle_local_exceptions
@@ -84,6 +186,28 @@ namespace hpx::parallel::util::detail {
             }
         }
 
+        // rethrow std::bad_alloc or the collected exceptions, if any
+        static void call(concurrent_exception_collector& errors)
+        {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+            HPX_ASSERT(errors.empty());
+#else
+            if (errors.empty())
+            {
+                return;
+            }
+
+            if (errors.bad_alloc_thrown())
+            {
+                throw std::bad_alloc();
+            }
+
+            std::list<std::exception_ptr> l;    //-V826
+            errors.extract(l);
+            throw exception_list(HPX_MOVE(l));
+#endif
+        }
+
     private:
         template <typename Future>
         static void call_helper_single([[maybe_unused]] Future const& f,
@@ -567,6 +691,18 @@ namespace hpx::parallel::util::detail {
             }
         }
 
+        static void call(concurrent_exception_collector const& errors)
+        {
+            if (!errors.empty())
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                std::terminate();
+#else
+                parallel_exception_termination_handler();
+#endif
+            }
+        }
+
     private:
         template <typename Future>
         static void call_helper_single([[maybe_unused]] Future const& f)
@@ -7,9 +7,14 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/invoke_fused.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/prefetching.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -37,6 +42,103 @@ namespace hpx::parallel::util::detail {
             // clang-format on
         }
     };
+
+    // Executes the iterations of a chunk in blocks, prefetching the elements
+    // accessed by later blocks (see hpx::execution::experimental::
+    // with_prefetch). This is possible only if the chunks of the algorithm
+    // do not produce a result.
+    template <typename F, typename Prefetcher>
+    struct prefetching_partitioner_iteration
+    {
+        std::decay_t<F> f_;
+        Prefetcher prefetcher_;
+        bool strided_ = false;
+
+        template <typename T>
+        void operator()(T&& t)
+        {
+            auto it = hpx::get<0>(t);
+            std::size_t const count = hpx::get<1>(t);
+
+            if constexpr (hpx::tuple_size<std::decay_t<T>>::value == 3)
+            {
+                // the iterations of strided loops can't be split into blocks
+                if (strided_)
+                {
+                    f_(it, count, hpx::get<2>(t));
+                    return;
+                }
+
+                prefetcher_.for_each_block(it, count, hpx::get<2>(t),
+                    [&](auto block, std::size_t n, std::size_t base_idx) {
+                        f_(block, n, base_idx);
+                    });
+            }
+            else
+            {
+                prefetcher_.for_each_block(
+                    it, count, [&](auto block, std::size_t n) {
+                        f_(block, n);
+                    });
+            }
+        }
+    };
+
+    // Stores the result of every chunk into its preallocated slot and
+    // captures the exceptions thrown by a chunk, which allows to run all
+    // chunks without creating a future for each of them. All chunks but
+    // the last have the same size, the slot of a chunk is derived from its
+    // position in the sequence starting at first_.
+    template <typename Result, typename FwdIter, typename F>
+    struct result_slots_partitioner_iteration
+    {
+        std::decay_t<F> f_;
+        FwdIter first_;
+        std::size_t chunk_size_;
+        Result* results_;
+        concurrent_exception_collector* errors_;
+
+        template <typename T>
+        void operator()(T&& t)
+        {
+            auto const offset = std::distance(first_, hpx::get<0>(t));
+            std::size_t const slot =
+                static_cast<std::size_t>(offset) / chunk_size_;
+            try
+            {
+                results_[slot] =
+                    hpx::invoke_fused_r<Result>(f_, HPX_FORWARD(T, t));
+            }
+            catch (...)
+            {
+                errors_->capture();
+            }
+        }
+    };
+
+    // Create the function invoked for every chunk of an algorithm executed
+    // with the given policy on the range starting at first
+    template <typename Result, typename ExPolicy, typename IterOrR, typename F>
+    auto make_partitioner_iteration(ExPolicy const& policy, IterOrR first,
+        F&& f, bool strided = false)
+    {
+        if constexpr (std::is_void_v<Result> &&
+            supports_chunk_prefetching_v<ExPolicy, IterOrR>)
+        {
+            using prefetcher_type =
+                decltype(make_chunk_prefetcher(policy, first));
+            return prefetching_partitioner_iteration<F, prefetcher_type>{
+                HPX_FORWARD(F, f), make_chunk_prefetcher(policy, first),
+                strided};
+        }
+        else
+        {
+            HPX_UNUSED(policy);
+            HPX_UNUSED(first);
+            HPX_UNUSED(strided);
+            return partitioner_iteration<Result, F>{HPX_FORWARD(F, f)};
+        }
+    }
 }    // namespace hpx::parallel::util::detail
 
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
@@ -69,6 +171,56 @@ namespace hpx::traits {
         }
     };
 
+    template <typename F, typename Prefetcher>
+    struct get_function_address<
+        parallel::util::detail::prefetching_partitioner_iteration<F,
+            Prefetcher>>
+    {
+        [[nodiscard]] static constexpr std::size_t call(
+            parallel::util::detail::prefetching_partitioner_iteration<F,
+                Prefetcher> const& f) noexcept
+        {
+            return get_function_address<std::decay_t<F>>::call(f.f_);
+        }
+    };
+
+    template <typename F, typename Prefetcher>
+    struct get_function_annotation<
+        parallel::util::detail::prefetching_partitioner_iteration<F,
+            Prefetcher>>
+    {
+        [[nodiscard]] static constexpr char const* call(
+            parallel::util::detail::prefetching_partitioner_iteration<F,
+                Prefetcher> const& f) noexcept
+        {
+            return get_function_annotation<std::decay_t<F>>::call(f.f_);
+        }
+    };
+
+    template <typename Result, typename FwdIter, typename F>
+    struct get_function_address<parallel::util::detail::
+            result_slots_partitioner_iteration<Result, FwdIter, F>>
+    {
+        [[nodiscard]] static constexpr std::size_t call(
+            parallel::util::detail::result_slots_partitioner_iteration<Result,
+                FwdIter, F> const& f) noexcept
+        {
+            return get_function_address<std::decay_t<F>>::call(f.f_);
+        }
+    };
+
+    template <typename Result, typename FwdIter, typename F>
+    struct get_function_annotation<parallel::util::detail::
+            result_slots_partitioner_iteration<Result, FwdIter, F>>
+    {
+        [[nodiscard]] static constexpr char const* call(
+            parallel::util::detail::result_slots_partitioner_iteration<Result,
+                FwdIter, F> const& f) noexcept
+        {
+            return get_function_annotation<std::decay_t<F>>::call(f.f_);
+        }
+    };
+
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
     template <typename Result, typename F>
     struct get_function_annotation_itt<
@@ -81,6 +233,31 @@ namespace hpx::traits {
             return get_function_annotation_itt<std::decay_t<F>>::call(f.f_);
         }
     };
+
+    template <typename F, typename Prefetcher>
+    struct get_function_annotation_itt<
+        parallel::util::detail::prefetching_partitioner_iteration<F,
+            Prefetcher>>
+    {
+        [[nodiscard]] static util::itt::string_handle call(
+            parallel::util::detail::prefetching_partitioner_iteration<F,
+                Prefetcher> const& f) noexcept
+        {
+            return get_function_annotation_itt<std::decay_t<F>>::call(f.f_);
+        }
+    };
+
+    template <typename Result, typename FwdIter, typename F>
+    struct get_function_annotation_itt<parallel::util::detail::
+            result_slots_partitioner_iteration<Result, FwdIter, F>>
+    {
+        [[nodiscard]] static util::itt::string_handle call(
+            parallel::util::detail::result_slots_partitioner_iteration<Result,
+                FwdIter, F> const& f) noexcept
+        {
+            return get_function_annotation_itt<std::decay_t<F>>::call(f.f_);
+        }
+    };
 #endif
 }    // namespace hpx::traits
 #endif
@@ -0,0 +1,290 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/config/defines.hpp>
+#include <hpx/execution/executors/default_parameters.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_traits.hpp>
+#include <hpx/futures/traits/is_future.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::parallel::util::detail {
+
+    // The partitioners run an algorithm sequentially on the calling thread if
+    // the number of elements is too small to amortize the overheads of
+    // creating and joining the parallel tasks. The threshold is learned
+    // separately for every call site (every combination of an execution
+    // policy and the function invoked for each chunk, i.e. for every
+    // algorithm, element type and user supplied function) from the
+    // execution times of previous invocations:
+    //
+    //   - sequential invocations measure the time needed to process one
+    //     element (t)
+    //   - parallel invocations of small ranges measure the overhead (o) of
+    //     the parallel execution, i.e. the part of the execution time that is
+    //     not explained by processing count elements on p cores
+    //
+    // Running count elements in parallel is faster than running them
+    // sequentially if o + count * t / p < count * t, which gives a threshold
+    // of o / (t * (1 - 1/p)) elements. The first invocation with at most
+    // sequential_fallback_probe_size elements is run sequentially to obtain
+    // a first measurement of t. No invocation is run sequentially if it is
+    // expected to take longer than sequential_fallback_max_time.
+    //
+    // The fallback is applied only to the parallel_executor used with the
+    // default executor parameters, any other executor or executor parameters
+    // object keeps full control over the execution of the algorithm.
+    inline constexpr std::size_t sequential_fallback_probe_size = 1024;
+    inline constexpr double sequential_fallback_max_time = 200000.0;    // ns
+
+    struct sequential_fallback_data
+    {
+        // returns whether an invocation on count elements should be run
+        // sequentially
+        bool run_sequentially(std::size_t count) const noexcept
+        {
+            if (count < threshold_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+            return count <= sequential_fallback_probe_size &&
+                !probed_.load(std::memory_order_relaxed);
+        }
+
+        // merge the measured execution time (in nanoseconds) of a sequential
+        // invocation
+        void update_sequential(std::size_t count, std::uint64_t elapsed)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            double const iteration_time =
+                static_cast<double>(elapsed) / static_cast<double>(count);
+            if (!probed_.load(std::memory_order_relaxed))
+            {
+                iteration_time_ = iteration_time;
+                probed_.store(true, std::memory_order_relaxed);
+            }
+            else
+            {
+                iteration_time_ = smoothing * iteration_time +
+                    (1.0 - smoothing) * iteration_time_;
+            }
+            update_threshold();
+        }
+
+        // merge the measured execution time (in nanoseconds) of a parallel
+        // invocation on the given number of cores
+        void update_parallel(
+            std::size_t count, std::size_t cores, std::uint64_t elapsed)
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            cores_ = (std::max)(cores, std::size_t(1));
+
+            // the overhead can be derived only if the time needed per
+            // element is known, invocations on large ranges are dominated by
+            // the (imperfectly scaling) processing of the elements
+            double const work = iteration_time_ * static_cast<double>(count);
+            if (iteration_time_ == 0.0 ||
+                work > 4 * sequential_fallback_max_time)
+            {
+                return;
+            }
+
+            double const parallel_work = work / static_cast<double>(cores_);
+            double const overhead =
+                (std::max)(static_cast<double>(elapsed) - parallel_work, 0.0);
+            if (overhead_ == 0.0)
+            {
+                overhead_ = overhead;
+            }
+            else
+            {
+                overhead_ =
+                    smoothing * overhead + (1.0 - smoothing) * overhead_;
+            }
+            update_threshold();
+        }
+
+        [[nodiscard]] std::size_t threshold() const noexcept
+        {
+            return threshold_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void update_threshold() noexcept
+        {
+            if (iteration_time_ == 0.0)
+            {
+                return;
+            }
+
+            double const max_count =
+                sequential_fallback_max_time / iteration_time_;
+            double const speedup = 1.0 - 1.0 / static_cast<double>(cores_);
+
+            double threshold = max_count;
+            if (speedup != 0.0)
+            {
+                threshold = (std::min)(
+                    overhead_ / (iteration_time_ * speedup), max_count);
+            }
+            threshold_.store(static_cast<std::size_t>(threshold),
+                std::memory_order_relaxed);
+        }
+
+        static constexpr double smoothing = 0.25;
+
+        std::atomic<std::size_t> threshold_{0};
+        std::atomic<bool> probed_{false};
+
+        hpx::spinlock mtx_;
+        double iteration_time_ = 0.0;    // ns per element
+        double overhead_ = 0.0;          // ns per parallel invocation
+        std::size_t cores_ = 1;
+    };
+
+    // the learned state of one call site
+    template <typename ExPolicy, typename F>
+    inline sequential_fallback_data sequential_fallback_site{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The items returned by the parallel execution which can be replaced by
+    // the result of a sequential execution
+    template <typename Items>
+    struct is_sequential_fallback_items : std::false_type
+    {
+    };
+
+    template <>
+    struct is_sequential_fallback_items<hpx::future<void>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_sequential_fallback_items<std::vector<hpx::future<T>>>
+      : std::true_type
+    {
+    };
+
+    template <typename ExPolicy, typename Items>
+    inline constexpr bool supports_sequential_fallback_v =
+#if defined(HPX_ALGORITHMS_HAVE_SEQUENTIAL_FALLBACK) &&                        \
+    !defined(HPX_COMPUTE_DEVICE_CODE)
+        std::is_same_v<typename ExPolicy::executor_type,
+            hpx::execution::parallel_executor> &&
+        std::is_same_v<typename ExPolicy::executor_parameters_type,
+            hpx::execution::experimental::default_parameters> &&
+        is_sequential_fallback_items<Items>::value;
+#else
+        false;
+#endif
+
+    // Invoke f (processing all elements at once) and wrap its result into
+    // the items the parallel execution would have produced
+    template <typename Items, typename F>
+    Items make_sequential_items(F&& f)
+    {
+        if constexpr (hpx::traits::is_future_v<Items>)
+        {
+            HPX_FORWARD(F, f)();
+            return hpx::make_ready_future();
+        }
+        else
+        {
+            Items items;
+            items.reserve(1);
+            if constexpr (std::is_void_v<
+                              hpx::traits::future_traits_t<
+                                  typename Items::value_type>>)
+            {
+                HPX_FORWARD(F, f)();
+                items.push_back(hpx::make_ready_future());
+            }
+            else
+            {
+                items.push_back(hpx::make_ready_future(HPX_FORWARD(F, f)()));
+            }
+            return items;
+        }
+    }
+
+    // Measures the execution time of an invocation and merges it into the
+    // state of the call site (unless the invocation has thrown)
+    class sequential_fallback_timer
+    {
+    public:
+        template <typename ExPolicy>
+        sequential_fallback_timer(sequential_fallback_data& data,
+            ExPolicy const& policy, std::size_t count, bool sequential)
+          : data_(data)
+          , count_(count)
+          , cores_(sequential ?
+                    1 :
+                    execution::processing_units_count(
+                        policy.parameters(), policy.executor(),
+                        hpx::chrono::null_duration, count))
+          , sequential_(sequential)
+          , exceptions_(std::uncaught_exceptions())
+          , start_(hpx::chrono::high_resolution_clock::now())
+        {
+        }
+
+        sequential_fallback_timer(sequential_fallback_timer const&) = delete;
+        sequential_fallback_timer(sequential_fallback_timer&&) = delete;
+        sequential_fallback_timer& operator=(
+            sequential_fallback_timer const&) = delete;
+        sequential_fallback_timer& operator=(
+            sequential_fallback_timer&&) = delete;
+
+        ~sequential_fallback_timer()
+        {
+            if (std::uncaught_exceptions() != exceptions_)
+            {
+                return;
+            }
+
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - start_;
+            if (sequential_)
+            {
+                data_.update_sequential(count_, elapsed);
+            }
+            else
+            {
+                data_.update_parallel(count_, cores_, elapsed);
+            }
+        }
+
+    private:
+        sequential_fallback_data& data_;
+        std::size_t count_;
+        std::size_t cores_;
+        bool sequential_;
+        int exceptions_;
+        std::uint64_t start_;
+    };
+}    // namespace hpx::parallel::util::detail
@@ -22,6 +22,7 @@
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
+#include <hpx/parallel/util/detail/sequential_fallback.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -56,7 +57,8 @@ namespace hpx::parallel::util::detail {
                 policy, first, count);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
         }
         else if constexpr (!invokes_testing_function)
@@ -65,7 +67,8 @@ namespace hpx::parallel::util::detail {
                 detail::get_bulk_iteration_shape_idx(policy, first, count);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
         }
         else
@@ -75,7 +78,8 @@ namespace hpx::parallel::util::detail {
                 policy, inititems, f, first, count);
 
             auto&& workitems = execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
 
             return std::make_pair(HPX_MOVE(inititems), HPX_MOVE(workitems));
@@ -98,6 +102,59 @@ namespace hpx::parallel::util::detail {
             typename F2>
         static decltype(auto) call(ExPolicy_&& policy, FwdIter first,
             std::size_t count, F1&& f1, F2&& f2)
+        {
+            using policy_type = std::decay_t<ExPolicy_>;
+            using items_type = std::decay_t<decltype(
+                detail::foreach_partition<Result>(policy, first, count, f1))>;
+
+            if constexpr (supports_sequential_fallback_v<policy_type,
+                              items_type>)
+            {
+                auto& site =
+                    sequential_fallback_site<policy_type, std::decay_t<F1>>;
+                bool const sequential = site.run_sequentially(count);
+                sequential_fallback_timer timer(
+                    site, policy, count, sequential);
+
+                if (sequential)
+                {
+                    return call_sequential<items_type>(
+                        first, count, HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+                }
+                return call_parallel(HPX_FORWARD(ExPolicy_, policy), first,
+                    count, HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+            }
+            else
+            {
+                return call_parallel(HPX_FORWARD(ExPolicy_, policy), first,
+                    count, HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+            }
+        }
+
+    private:
+        // run all iterations on the calling thread
+        template <typename Items, typename FwdIter, typename F1, typename F2>
+        static decltype(auto) call_sequential(
+            FwdIter first, std::size_t count, F1&& f1, F2&& f2)
+        {
+            FwdIter last = parallel::detail::next(first, count);
+            try
+            {
+                return reduce(make_sequential_items<Items>([&]() {
+                    return HPX_INVOKE(f1, first, count, std::size_t(0));
+                }),
+                    HPX_FORWARD(F2, f2), HPX_MOVE(last));
+            }
+            catch (...)
+            {
+                handle_local_exceptions::call(std::current_exception());
+            }
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2>
+        static decltype(auto) call_parallel(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, F1&& f1, F2&& f2)
         {
             // inform parameter traits
             using scoped_executor_parameters =
@@ -125,7 +182,6 @@ namespace hpx::parallel::util::detail {
             }
         }
 
-    private:
         template <typename F, typename Items1, typename Items2,
             typename FwdIter>
         static auto reduce(
@@ -15,6 +15,7 @@
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/functional/invoke_result.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/threading_base/preemption.hpp>
 #include <hpx/type_support/identity.hpp>
 
 #include <algorithm>
@@ -337,6 +338,74 @@ namespace hpx::parallel::util {
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
+        // Run the given loop in chunks of HPX_PREEMPTION_CHECK_INTERVAL
+        // iterations if the execution policy is parallel, which gives the
+        // runtime the chance to preempt long running partitions in between
+        // (see hpx::this_thread::check_preempt).
+        template <typename ExPolicy, typename Iter, typename Loop>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr Iter preemptible_loop_n(
+            Iter it, std::size_t num, Loop&& loop)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            if constexpr (hpx::is_parallel_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                constexpr std::size_t chunk = HPX_PREEMPTION_CHECK_INTERVAL;
+                while (num > chunk)
+                {
+                    it = loop(it, chunk);
+                    num -= chunk;
+
+                    hpx::this_thread::check_preempt();
+                }
+            }
+#endif
+            return loop(it, num);
+        }
+
+        // Run the given loop in blocks of HPX_CANCELLATION_CHECK_INTERVAL
+        // iterations and stop as soon as the given predicate signals that the
+        // remaining iterations are not needed anymore. This allows for a
+        // partition to exit early if some other partition has found the
+        // result already, not only at its start. Parallel loops are
+        // additionally checked for preemption every
+        // HPX_PREEMPTION_CHECK_INTERVAL iterations.
+        template <typename ExPolicy,
+            std::size_t Block = HPX_CANCELLATION_CHECK_INTERVAL,
+            typename Iter, typename Cancelled, typename Loop>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr Iter cancellable_loop_n(
+            Iter it, std::size_t num, Cancelled&& cancelled, Loop&& loop)
+        {
+            static_assert(Block != 0, "the block size must not be zero");
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            [[maybe_unused]] std::size_t since_preempt_check = 0;
+#endif
+            while (num != 0)
+            {
+                if (cancelled())
+                    return it;
+
+                std::size_t const n = (std::min)(num, Block);
+                it = loop(it, n);
+                num -= n;
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+                if constexpr (hpx::is_parallel_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    since_preempt_check += n;
+                    if (since_preempt_check >= HPX_PREEMPTION_CHECK_INTERVAL)
+                    {
+                        since_preempt_check = 0;
+                        hpx::this_thread::check_preempt();
+                    }
+                }
+#endif
+            }
+            return it;
+        }
+
         // Helper class to repeatedly call a function a given number of times
         // starting from a given iterator position.
         struct loop_n_helper
@@ -431,8 +500,10 @@ namespace hpx::parallel::util {
                 hpx::traits::is_random_access_iterator_v<Iter> ||
                     std::is_integral_v<Iter>>;
 
-            return detail::loop_n_helper::call(
-                it, count, HPX_FORWARD(F, f), pred());
+            return detail::preemptible_loop_n<ExPolicy>(
+                it, count, [&](Iter first, std::size_t num) {
+                    return detail::loop_n_helper::call(first, num, f, pred());
+                });
         }
 
         template <typename Iter, typename CancelToken, typename F>
@@ -444,8 +515,11 @@ namespace hpx::parallel::util {
                 hpx::traits::is_random_access_iterator_v<Iter> ||
                     std::is_integral_v<Iter>>;
 
-            return detail::loop_n_helper::call(
-                it, count, tok, HPX_FORWARD(F, f), pred());
+            return detail::cancellable_loop_n<ExPolicy>(
+                it, count, [&tok]() { return tok.was_cancelled(); },
+                [&](Iter first, std::size_t num) {
+                    return detail::loop_n_helper::call(first, num, f, pred());
+                });
         }
     };
 
@@ -569,8 +643,11 @@ namespace hpx::parallel::util {
                 hpx::traits::is_random_access_iterator_v<Iter> ||
                     std::is_integral<Iter>::value>;
 
-            return detail::loop_n_ind_helper::call(
-                it, count, HPX_FORWARD(F, f), pred());
+            return detail::preemptible_loop_n<ExPolicy>(
+                it, count, [&](Iter first, std::size_t num) {
+                    return detail::loop_n_ind_helper::call(
+                        first, num, f, pred());
+                });
         }
 
         template <typename Iter, typename CancelToken, typename F>
@@ -578,12 +655,12 @@ namespace hpx::parallel::util {
         tag_fallback_invoke(hpx::parallel::util::loop_n_ind_t<ExPolicy>,
             Iter it, std::size_t count, CancelToken& tok, F&& f)
         {
-            using pred = std::integral_constant<bool,
-                hpx::traits::is_random_access_iterator_v<Iter> ||
-                    std::is_integral<Iter>::value>;
+            // check at the start of a partition only
+            if (tok.was_cancelled())
+                return it;
 
-            return detail::loop_n_ind_helper::call(
-                it, count, tok, HPX_FORWARD(F, f), pred());
+            return hpx::parallel::util::loop_n_ind_t<ExPolicy>{}(
+                it, count, HPX_FORWARD(F, f));
         }
     };
 
@@ -1233,8 +1310,13 @@ namespace hpx::parallel::util {
             std::size_t base_idx, Iter it, std::size_t count, F&& f)
         {
             using cat = typename std::iterator_traits<Iter>::iterator_category;
-            return detail::loop_idx_n<cat>::call(
-                base_idx, it, count, HPX_FORWARD(F, f));
+            return detail::preemptible_loop_n<ExPolicy>(
+                it, count, [&](Iter first, std::size_t num) {
+                    first = detail::loop_idx_n<cat>::call(
+                        base_idx, first, num, f);
+                    base_idx += num;
+                    return first;
+                });
         }
 
         template <typename Iter, typename CancelToken, typename F>
@@ -1244,8 +1326,15 @@ namespace hpx::parallel::util {
             F&& f)
         {
             using cat = typename std::iterator_traits<Iter>::iterator_category;
-            return detail::loop_idx_n<cat>::call(
-                base_idx, it, count, tok, HPX_FORWARD(F, f));
+            return detail::cancellable_loop_n<ExPolicy>(
+                it, count,
+                [&tok, &base_idx]() { return tok.was_cancelled(base_idx); },
+                [&](Iter first, std::size_t num) {
+                    first = detail::loop_idx_n<cat>::call(
+                        base_idx, first, num, f);
+                    base_idx += num;
+                    return first;
+                });
         }
     };
 
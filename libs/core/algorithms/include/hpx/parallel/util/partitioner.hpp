@@ -18,12 +18,15 @@
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/parallel/util/adapt_thread_priority.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
+#include <hpx/parallel/util/detail/sequential_fallback.hpp>
 #include <hpx/type_support/empty_function.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/type_support/void_guard.hpp>
@@ -60,7 +63,8 @@ namespace hpx::parallel::util::detail {
                 policy, it_or_r, count);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, it_or_r, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
         }
         else if constexpr (!invokes_testing_function)
@@ -69,7 +73,8 @@ namespace hpx::parallel::util::detail {
                 detail::get_bulk_iteration_shape(policy, it_or_r, count);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, it_or_r, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
         }
         else
@@ -79,13 +84,66 @@ namespace hpx::parallel::util::detail {
                 policy, inititems, f, it_or_r, count);
 
             auto&& workitems = execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, it_or_r, HPX_FORWARD(F, f)),
                 HPX_MOVE(shape));
 
             return std::make_pair(HPX_MOVE(inititems), HPX_MOVE(workitems));
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // The results of the chunks can be stored into preallocated slots
+    // (instead of being returned through a future for each chunk) if the
+    // chunks would otherwise be scheduled using futures, if all chunks but
+    // the last have the same size, and if the reduction step does not
+    // observe the futures (it is wrapped using hpx::unwrapping).
+    template <typename F>
+    inline constexpr bool is_unwrapping_reduction_v = false;
+
+    template <typename F>
+    inline constexpr bool is_unwrapping_reduction_v<
+        hpx::util::detail::functional_unwrap_impl<F, 1>> = true;
+
+    template <typename ExPolicy, typename FwdIter, typename Result,
+        typename Items, typename F2>
+    inline constexpr bool supports_result_slots_v =
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        !std::is_void_v<Result> && !std::is_same_v<Result, bool> &&
+        std::is_default_constructible_v<Result> &&
+        std::is_move_assignable_v<Result> &&
+        hpx::traits::is_random_access_iterator_v<FwdIter> &&
+        !execution::extract_has_variable_chunk_size_v<
+            execution::extract_executor_parameters_t<ExPolicy>> &&
+        std::is_same_v<Items, std::vector<hpx::future<Result>>> &&
+        is_unwrapping_reduction_v<F2>;
+#else
+        false;
+#endif
+
+    // Run all chunks, storing their results into the given vector (one slot
+    // per chunk, in order) and capturing their exceptions into the given
+    // collector. The returned items signal the completion of all chunks.
+    template <typename Result, typename ExPolicy, typename FwdIter, typename F>
+    auto partition_with_result_slots(ExPolicy policy, FwdIter first,
+        std::size_t count, F&& f, std::vector<Result>& results,
+        concurrent_exception_collector& errors)
+    {
+        FwdIter const base = first;
+        auto&& shape = detail::get_bulk_iteration_shape(policy, first, count);
+
+        std::size_t const num_chunks = hpx::util::size(shape);
+        std::size_t const chunk_size =
+            num_chunks != 0 ? hpx::get<1>(*hpx::util::begin(shape)) : 1;
+
+        results.resize(num_chunks);
+
+        return execution::bulk_async_execute(policy.executor(),
+            result_slots_partitioner_iteration<Result, FwdIter, F>{
+                HPX_FORWARD(F, f), base, chunk_size, results.data(), &errors},
+            HPX_MOVE(shape));
+    }
+
     template <typename Result, typename ExPolicy, typename FwdIter,
         typename Stride, typename F>
     auto partition_with_index(
@@ -109,7 +167,8 @@ namespace hpx::parallel::util::detail {
                 policy, first, count, stride);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f), stride != 1),
                 HPX_MOVE(shape));
         }
         else if constexpr (!invokes_testing_function)
@@ -118,7 +177,8 @@ namespace hpx::parallel::util::detail {
                 policy, first, count, stride);
 
             return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f), stride != 1),
                 HPX_MOVE(shape));
         }
         else
@@ -128,7 +188,8 @@ namespace hpx::parallel::util::detail {
                 policy, inititems, f, first, count, stride);
 
             auto&& workitems = execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{HPX_FORWARD(F, f)},
+                make_partitioner_iteration<Result>(
+                    policy, first, HPX_FORWARD(F, f), stride != 1),
                 HPX_MOVE(shape));
 
             return std::make_pair(HPX_MOVE(inititems), HPX_MOVE(workitems));
@@ -191,6 +252,77 @@ namespace hpx::parallel::util::detail {
             typename F2>
         static decltype(auto) call(ExPolicy_&& policy, FwdIter first,
             std::size_t count, F1&& f1, F2&& f2)
+        {
+            using policy_type = std::decay_t<ExPolicy_>;
+            using items_type = std::decay_t<decltype(
+                detail::partition<Result>(policy, first, count, f1))>;
+
+            if constexpr (supports_sequential_fallback_v<policy_type,
+                              items_type>)
+            {
+                auto& site =
+                    sequential_fallback_site<policy_type, std::decay_t<F1>>;
+                bool const sequential = site.run_sequentially(count);
+                sequential_fallback_timer timer(
+                    site, policy, count, sequential);
+
+                if (sequential)
+                {
+                    return call_sequential<items_type>(
+                        HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2), first, count);
+                }
+                return call_parallel(HPX_FORWARD(ExPolicy_, policy), first,
+                    count, HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+            }
+            else
+            {
+                return call_parallel(HPX_FORWARD(ExPolicy_, policy), first,
+                    count, HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+            }
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename Stride,
+            typename F1, typename F2>
+        static decltype(auto) call_with_index(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, Stride stride, F1&& f1, F2&& f2)
+        {
+            using policy_type = std::decay_t<ExPolicy_>;
+            using items_type =
+                std::decay_t<decltype(detail::partition_with_index<Result>(
+                    policy, first, count, stride, f1))>;
+
+            if constexpr (supports_sequential_fallback_v<policy_type,
+                              items_type>)
+            {
+                auto& site =
+                    sequential_fallback_site<policy_type, std::decay_t<F1>>;
+                bool const sequential = site.run_sequentially(count);
+                sequential_fallback_timer timer(
+                    site, policy, count, sequential);
+
+                if (sequential)
+                {
+                    return call_sequential<items_type>(HPX_FORWARD(F1, f1),
+                        HPX_FORWARD(F2, f2), first, count, std::size_t(0));
+                }
+                return call_with_index_parallel(HPX_FORWARD(ExPolicy_, policy),
+                    first, count, stride, HPX_FORWARD(F1, f1),
+                    HPX_FORWARD(F2, f2));
+            }
+            else
+            {
+                return call_with_index_parallel(HPX_FORWARD(ExPolicy_, policy),
+                    first, count, stride, HPX_FORWARD(F1, f1),
+                    HPX_FORWARD(F2, f2));
+            }
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2, typename Data>
+        // requires is_container<Data>
+        static decltype(auto) call_with_data(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, F1&& f1, F2&& f2,
+            std::vector<std::size_t> const& chunk_sizes, Data&& data)
         {
             // inform parameter traits
             using scoped_executor_parameters =
@@ -202,9 +334,9 @@ namespace hpx::parallel::util::detail {
 
             try
             {
-                auto&& items =
-                    detail::partition<Result>(HPX_FORWARD(ExPolicy_, policy),
-                        first, count, HPX_FORWARD(F1, f1));
+                auto&& items = detail::partition_with_data<Result>(
+                    HPX_FORWARD(ExPolicy_, policy), first, count, chunk_sizes,
+                    HPX_FORWARD(Data, data), HPX_FORWARD(F1, f1));
 
                 scoped_params.mark_end_of_scheduling();
 
@@ -216,10 +348,72 @@ namespace hpx::parallel::util::detail {
             }
         }
 
-        template <typename ExPolicy_, typename FwdIter, typename Stride,
-            typename F1, typename F2>
-        static decltype(auto) call_with_index(ExPolicy_&& policy, FwdIter first,
-            std::size_t count, Stride stride, F1&& f1, F2&& f2)
+    private:
+        // run all iterations on the calling thread
+        template <typename Items, typename F1, typename F2, typename... Ts>
+        static decltype(auto) call_sequential(F1&& f1, F2&& f2, Ts&&... ts)
+        {
+            try
+            {
+                return reduce(make_sequential_items<Items>(
+                                  [&]() { return HPX_INVOKE(f1, ts...); }),
+                    HPX_FORWARD(F2, f2));
+            }
+            catch (...)
+            {
+                handle_local_exceptions::call(std::current_exception());
+            }
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2>
+        static decltype(auto) call_parallel(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, F1&& f1, F2&& f2)
+        {
+            using items_type = std::decay_t<decltype(
+                detail::partition<Result>(policy, first, count, f1))>;
+
+            if constexpr (supports_result_slots_v<std::decay_t<ExPolicy_>,
+                              FwdIter, Result, items_type, std::decay_t<F2>>)
+            {
+                return call_parallel_result_slots(
+                    HPX_FORWARD(ExPolicy_, policy), first, count,
+                    HPX_FORWARD(F1, f1), HPX_FORWARD(F2, f2));
+            }
+            else
+            {
+                // inform parameter traits
+                using scoped_executor_parameters =
+                    detail::scoped_executor_parameters_ref<parameters_type,
+                        typename std::decay_t<ExPolicy_>::executor_type>;
+
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                try
+                {
+                    auto&& items = detail::partition<Result>(
+                        HPX_FORWARD(ExPolicy_, policy), first, count,
+                        HPX_FORWARD(F1, f1));
+
+                    scoped_params.mark_end_of_scheduling();
+
+                    return reduce(HPX_MOVE(items), HPX_FORWARD(F2, f2));
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(std::current_exception());
+                }
+            }
+        }
+
+        // The chunks store their results into preallocated slots and
+        // capture their exceptions, no future is created for any chunk
+        // (see supports_result_slots_v).
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2>
+        static decltype(auto) call_parallel_result_slots(ExPolicy_&& policy,
+            FwdIter first, std::size_t count, F1&& f1, F2&& f2)
         {
             // inform parameter traits
             using scoped_executor_parameters =
@@ -231,13 +425,26 @@ namespace hpx::parallel::util::detail {
 
             try
             {
-                auto&& items = detail::partition_with_index<Result>(
-                    HPX_FORWARD(ExPolicy_, policy), first, count, stride,
-                    HPX_FORWARD(F1, f1));
+                std::vector<Result> results;
+                concurrent_exception_collector errors;
+
+                auto&& items = detail::partition_with_result_slots<Result>(
+                    HPX_FORWARD(ExPolicy_, policy), first, count,
+                    HPX_FORWARD(F1, f1), results, errors);
 
                 scoped_params.mark_end_of_scheduling();
 
-                return reduce(HPX_MOVE(items), HPX_FORWARD(F2, f2));
+                // wait for all tasks to finish, rethrow the exceptions
+                // reported by the executor
+                if (hpx::wait_all_nothrow(items))
+                {
+                    handle_local_exceptions::call(items);
+                }
+
+                // rethrow the exceptions thrown by the chunks, if any
+                handle_local_exceptions::call(errors);
+
+                return HPX_INVOKE(f2, HPX_MOVE(results));
             }
             catch (...)
             {
@@ -245,12 +452,10 @@ namespace hpx::parallel::util::detail {
             }
         }
 
-        template <typename ExPolicy_, typename FwdIter, typename F1,
-            typename F2, typename Data>
-        // requires is_container<Data>
-        static decltype(auto) call_with_data(ExPolicy_&& policy, FwdIter first,
-            std::size_t count, F1&& f1, F2&& f2,
-            std::vector<std::size_t> const& chunk_sizes, Data&& data)
+        template <typename ExPolicy_, typename FwdIter, typename Stride,
+            typename F1, typename F2>
+        static decltype(auto) call_with_index_parallel(ExPolicy_&& policy,
+            FwdIter first, std::size_t count, Stride stride, F1&& f1, F2&& f2)
         {
             // inform parameter traits
             using scoped_executor_parameters =
@@ -262,9 +467,9 @@ namespace hpx::parallel::util::detail {
 
             try
             {
-                auto&& items = detail::partition_with_data<Result>(
-                    HPX_FORWARD(ExPolicy_, policy), first, count, chunk_sizes,
-                    HPX_FORWARD(Data, data), HPX_FORWARD(F1, f1));
+                auto&& items = detail::partition_with_index<Result>(
+                    HPX_FORWARD(ExPolicy_, policy), first, count, stride,
+                    HPX_FORWARD(F1, f1));
 
                 scoped_params.mark_end_of_scheduling();
 
@@ -276,7 +481,6 @@ namespace hpx::parallel::util::detail {
             }
         }
 
-    private:
         template <typename Items, typename F,
             typename Enable =
                 std::enable_if_t<!hpx::traits::is_pair_v<std::decay_t<Items>>>>
@@ -9,15 +9,25 @@
 #include <hpx/config.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/default_parameters.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/iterator_support/range.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/traits/is_range.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -433,6 +443,110 @@ namespace hpx::parallel::util {
             return loop_n_ind_helper::call(
                 it, count, HPX_FORWARD(F, f), std::true_type());
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return the latency (in nanoseconds) of loads from main memory. It is
+        // measured once, on first invocation.
+        HPX_CORE_EXPORT std::uint64_t get_memory_latency();
+
+        // Refers to the elements data[indices[i]], which are accessed by
+        // the i-th iteration of an algorithm (see
+        // hpx::execution::experimental::prefetch_indirect)
+        template <typename Data, typename Indices>
+        struct indirect_range
+        {
+            Data const* data;
+            Indices const* indices;
+        };
+
+        HPX_FORCEINLINE void prefetch_address(void const* p) noexcept
+        {
+#if defined(HPX_HAVE_MM_PREFETCH)
+            _mm_prefetch(
+                const_cast<char*>(static_cast<char const*>(p)), _MM_HINT_T0);
+#else
+            (void) p;
+#endif
+        }
+
+        // prefetch the elements [first, last) of the given range, once per
+        // cache line
+        template <typename Range>
+        void prefetch_elements(std::reference_wrapper<Range> rng,
+            std::size_t first, std::size_t last)
+        {
+            using value_type = std::decay_t<decltype(*hpx::util::begin(
+                std::declval<Range&>()))>;
+            constexpr std::size_t step =
+                (std::max)(threads::get_cache_line_size() / sizeof(value_type),
+                    std::size_t(1));
+
+            last = (std::min)(last, hpx::util::size(rng.get()));
+            if (first >= last)
+            {
+                return;
+            }
+
+            auto const it = hpx::util::begin(rng.get());
+            for (std::size_t i = first; i < last; i += step)
+            {
+                prefetch_address(std::addressof(it[i]));
+            }
+            prefetch_address(std::addressof(it[last - 1]));
+        }
+
+        // prefetch the elements data[indices[i]] for all i in [first, last)
+        template <typename Data, typename Indices>
+        void prefetch_elements(indirect_range<Data, Indices> const& rng,
+            std::size_t first, std::size_t last)
+        {
+            std::size_t const size = hpx::util::size(*rng.data);
+            last = (std::min)(last, hpx::util::size(*rng.indices));
+
+            auto const indices = hpx::util::begin(*rng.indices);
+            auto const data = hpx::util::begin(*rng.data);
+            for (std::size_t i = first; i < last; ++i)
+            {
+                auto const idx = static_cast<std::size_t>(indices[i]);
+                if (idx < size)
+                {
+                    prefetch_address(std::addressof(data[idx]));
+                }
+            }
+        }
+
+        template <typename Range>
+        struct prefetch_range_type
+        {
+            using type = std::reference_wrapper<Range const>;
+        };
+
+        template <typename Data, typename Indices>
+        struct prefetch_range_type<indirect_range<Data, Indices>>
+        {
+            using type = indirect_range<Data, Indices>;
+        };
+
+        template <typename Range>
+        using prefetch_range_type_t = typename prefetch_range_type<Range>::type;
+
+        template <typename Range>
+        constexpr auto make_prefetch_range(Range const& rng) noexcept
+        {
+            if constexpr (std::is_same_v<prefetch_range_type_t<Range>,
+                              std::reference_wrapper<Range const>>)
+            {
+                return std::cref(rng);
+            }
+            else
+            {
+                return rng;
+            }
+        }
+
+        struct prefetching_parameters_base
+        {
+        };
     }    // namespace prefetching
 
     ///////////////////////////////////////////////////////////////////////////
@@ -575,3 +689,277 @@ namespace hpx::parallel::util {
         };
     }    // namespace detail
 }    // namespace hpx::parallel::util
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters which make the parallel algorithms prefetch the
+    /// elements of the given ranges accessed by upcoming iterations. The
+    /// i-th iteration of an algorithm is assumed to access the i-th element
+    /// of each range (or the element data[indices[i]] for ranges created by
+    /// \a prefetch_indirect). The iterations of every chunk are executed in
+    /// blocks, before executing a block the elements accessed \a distance
+    /// iterations ahead are prefetched.
+    ///
+    /// If no distance is given, it is derived (for every chunk) from the
+    /// measured latency of loads from main memory and the measured
+    /// execution time of the first block of iterations of the chunk.
+    ///
+    /// The parameters are usually attached to an execution policy using
+    /// \a with_prefetch.
+    template <typename... Ranges>
+    struct prefetching_parameters
+      : hpx::parallel::util::prefetching::prefetching_parameters_base
+    {
+        /// The number of iterations executed between issuing prefetches
+        static constexpr std::size_t block_size = 64;
+
+        /// The largest prefetch distance derived from the memory latency
+        static constexpr std::size_t max_distance = 8192;
+
+        template <typename... Ranges_>
+        explicit prefetching_parameters(
+            std::size_t distance, Ranges_ const&... rngs)
+          : ranges_(hpx::parallel::util::prefetching::make_prefetch_range(
+                rngs)...)
+          , distance_(distance)
+        {
+        }
+
+        /// Return the distance (in iterations) of the prefetched elements,
+        /// zero if it is derived from the memory latency
+        [[nodiscard]] constexpr std::size_t distance() const noexcept
+        {
+            return distance_;
+        }
+
+        /// \cond NOINTERNAL
+        // Invoke f(offset, n) for consecutive blocks of the count iterations
+        // starting at iteration base_idx, prefetching the elements accessed
+        // by later blocks on the way
+        template <typename F>
+        void run(std::size_t base_idx, std::size_t count, F&& f) const
+        {
+            std::size_t distance = distance_;
+            std::size_t offset = 0;
+            if (distance == 0 && count != 0)
+            {
+                std::size_t const n = (std::min)(count, block_size);
+
+                std::uint64_t const start =
+                    hpx::chrono::high_resolution_clock::now();
+                f(offset, n);
+                distance = tune_distance(
+                    hpx::chrono::high_resolution_clock::now() - start, n);
+
+                offset = n;
+            }
+
+            while (offset != count)
+            {
+                std::size_t const n = (std::min)(count - offset, block_size);
+                prefetch(base_idx + offset + distance, n,
+                    hpx::util::make_index_pack_t<sizeof...(Ranges)>());
+                f(offset, n);
+                offset += n;
+            }
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        // cover the memory latency with the execution time of the iterations
+        // in between
+        static std::size_t tune_distance(std::uint64_t elapsed, std::size_t n)
+        {
+            double const iteration_time = (std::max)(
+                static_cast<double>(elapsed) / static_cast<double>(n), 1.0);
+            double const distance = std::ceil(
+                static_cast<double>(
+                    hpx::parallel::util::prefetching::get_memory_latency()) /
+                iteration_time);
+            return static_cast<std::size_t>(
+                (std::clamp)(distance, 1.0, static_cast<double>(max_distance)));
+        }
+
+        template <std::size_t... Is>
+        void prefetch(std::size_t first, std::size_t n,
+            hpx::util::index_pack<Is...>) const
+        {
+            (hpx::parallel::util::prefetching::prefetch_elements(
+                 hpx::get<Is>(ranges_), first, first + n),
+                ...);
+        }
+
+        hpx::tuple<
+            hpx::parallel::util::prefetching::prefetch_range_type_t<Ranges>...>
+            ranges_;
+        std::size_t distance_;
+        /// \endcond
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Create a range referring to the elements data[indices[i]] for
+    /// prefetching (see \a with_prefetch), as accessed by gather-style
+    /// indirect loops (e.g. sparse matrix-vector products).
+    template <typename Data, typename Indices>
+    constexpr hpx::parallel::util::prefetching::indirect_range<Data, Indices>
+    prefetch_indirect(Data const& data, Indices const& indices) noexcept
+    {
+        return {std::addressof(data), std::addressof(indices)};
+    }
+
+    /// Attach \a prefetching_parameters to the given execution policy. The
+    /// parallel algorithms executed with the returned policy prefetch the
+    /// elements of the given ranges accessed \a distance iterations ahead.
+    /// The executor parameters of the given policy are kept.
+    ///
+    /// The algorithms running chunks of iterations which do not produce a
+    /// result (e.g. \a for_each, \a for_loop, \a transform, \a copy) as well
+    /// as \a transform_reduce honour the prefetching parameters, all other
+    /// algorithms ignore them.
+    ///
+    /// \note The ranges are referenced, they have to outlive the algorithms
+    ///       executed with the returned policy.
+    template <typename ExPolicy, typename... Ranges,
+        typename Enable = std::enable_if_t<
+            hpx::is_execution_policy_v<std::decay_t<ExPolicy>>>>
+    decltype(auto) with_prefetch(
+        ExPolicy&& policy, std::size_t distance, Ranges const&... rngs)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+        prefetching_parameters<Ranges...> params(distance, rngs...);
+        if constexpr (std::is_same_v<parameters_type, default_parameters>)
+        {
+            return policy.with(HPX_MOVE(params));
+        }
+        else
+        {
+            return policy.with(policy.parameters(), HPX_MOVE(params));
+        }
+    }
+
+    /// Attach \a prefetching_parameters to the given execution policy, the
+    /// prefetch distance is derived from the measured memory latency.
+    template <typename ExPolicy, typename Range, typename... Ranges,
+        typename Enable = std::enable_if_t<
+            hpx::is_execution_policy_v<std::decay_t<ExPolicy>> &&
+            !std::is_integral_v<Range>>>
+    decltype(auto) with_prefetch(
+        ExPolicy&& policy, Range const& rng, Ranges const&... rngs)
+    {
+        return with_prefetch(
+            HPX_FORWARD(ExPolicy, policy), std::size_t(0), rng, rngs...);
+    }
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <typename... Ranges>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::prefetching_parameters<Ranges...>>
+  : std::true_type
+{
+};
+/// \endcond
+
+namespace hpx::parallel::util::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parameters>
+    inline constexpr bool is_prefetching_parameters_v = std::is_base_of_v<
+        prefetching::prefetching_parameters_base, std::decay_t<Parameters>>;
+
+    template <typename... Ranges>
+    constexpr hpx::execution::experimental::prefetching_parameters<
+        Ranges...> const&
+    get_prefetching_parameters(
+        hpx::execution::experimental::prefetching_parameters<Ranges...> const&
+            params) noexcept
+    {
+        return params;
+    }
+
+    // Executes the iterations of a chunk in blocks while prefetching the
+    // elements accessed by later blocks. The index of an iteration is its
+    // distance from the beginning of the whole range.
+    template <typename Parameters, typename Iter>
+    struct chunk_prefetcher
+    {
+        Parameters params_;
+        Iter first_;
+
+        // invoke f(it, n) for consecutive blocks of the chunk
+        template <typename F>
+        void for_each_block(Iter it, std::size_t count, F&& f) const
+        {
+            params_.run(parallel::detail::distance(first_, it), count,
+                [&](std::size_t, std::size_t n) {
+                    f(it, n);
+                    it = parallel::detail::next(it, n);
+                });
+        }
+
+        // invoke f(it, n, base_idx) for consecutive blocks of the chunk
+        template <typename F>
+        void for_each_block(
+            Iter it, std::size_t count, std::size_t base_idx, F&& f) const
+        {
+            params_.run(
+                base_idx, count, [&](std::size_t offset, std::size_t n) {
+                    f(it, n, base_idx + offset);
+                    it = parallel::detail::next(it, n);
+                });
+        }
+    };
+
+    // Used if no prefetching parameters are attached to the execution policy
+    struct no_chunk_prefetcher
+    {
+        template <typename Iter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr void for_each_block(
+            Iter it, std::size_t count, F&& f) const
+        {
+            f(it, count);
+        }
+
+        template <typename Iter, typename F>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr void for_each_block(
+            Iter it, std::size_t count, std::size_t base_idx, F&& f) const
+        {
+            f(it, count, base_idx);
+        }
+    };
+
+    template <typename ExPolicy, typename IterOrR>
+    inline constexpr bool supports_chunk_prefetching_v =
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        is_prefetching_parameters_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type> &&
+        (hpx::traits::is_random_access_iterator_v<IterOrR> ||
+            std::is_integral_v<IterOrR>);
+#else
+        false;
+#endif
+
+    // Create the object executing the chunks of an algorithm invoked with
+    // the given policy on the range starting at first
+    template <typename ExPolicy, typename IterOrR>
+    auto make_chunk_prefetcher(ExPolicy const& policy, IterOrR first)
+    {
+        if constexpr (supports_chunk_prefetching_v<ExPolicy, IterOrR>)
+        {
+            auto const& params =
+                get_prefetching_parameters(policy.parameters());
+            return chunk_prefetcher<std::decay_t<decltype(params)>, IterOrR>{
+                params, first};
+        }
+        else
+        {
+            HPX_UNUSED(policy);
+            HPX_UNUSED(first);
+            return no_chunk_prefetcher{};
+        }
+    }
+}    // namespace hpx::parallel::util::detail
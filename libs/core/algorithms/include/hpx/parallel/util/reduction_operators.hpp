@@ -0,0 +1,280 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/reduction_operators.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#endif
+
+#include <type_traits>
+
+namespace hpx::experimental::reduction_operators {
+
+    /// The reduction operators defined in this namespace can be applied to
+    /// scalar values as well as to vector packs. Reductions over contiguous
+    /// sequences of arithmetic values using these operators (e.g. hpx::reduce
+    /// or the combining step of hpx::collectives::all_reduce on a
+    /// channel_communicator) are vectorized if HPX was configured with
+    /// datapar support, even if no vectorizing execution policy was given.
+    ///
+    /// \note Vectorizing a floating point reduction changes the order in
+    ///       which the elements are combined, use \a kahan_sum if the result
+    ///       has to be accurate.
+    struct sum
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+
+    struct product
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+            return lhs * rhs;
+        }
+    };
+
+    struct minimum
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+#if defined(HPX_HAVE_DATAPAR)
+            return hpx::parallel::traits::choose(rhs < lhs, rhs, lhs);
+#else
+            return rhs < lhs ? rhs : lhs;
+#endif
+        }
+    };
+
+    struct maximum
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+#if defined(HPX_HAVE_DATAPAR)
+            return hpx::parallel::traits::choose(lhs < rhs, rhs, lhs);
+#else
+            return lhs < rhs ? rhs : lhs;
+#endif
+        }
+    };
+
+    // the logical operators produce one (true) or zero (false)
+    struct logical_and
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+#if defined(HPX_HAVE_DATAPAR)
+            return hpx::parallel::traits::choose(
+                lhs != T(0) && rhs != T(0), T(1), T(0));
+#else
+            return (lhs != T(0) && rhs != T(0)) ? T(1) : T(0);
+#endif
+        }
+    };
+
+    struct logical_or
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+#if defined(HPX_HAVE_DATAPAR)
+            return hpx::parallel::traits::choose(
+                lhs != T(0) || rhs != T(0), T(1), T(0));
+#else
+            return (lhs != T(0) || rhs != T(0)) ? T(1) : T(0);
+#endif
+        }
+    };
+
+    struct bit_and
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+            return lhs & rhs;
+        }
+    };
+
+    struct bit_or
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+            return lhs | rhs;
+        }
+    };
+
+    struct bit_xor
+    {
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T operator()(
+            T const& lhs, T const& rhs) const
+        {
+            return lhs ^ rhs;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The running sum of a compensated (Kahan-Babuska) summation. It is used
+    /// as the initial value of a reduction using \a kahan_sum, the result is
+    /// retrieved by calling \a get.
+    template <typename T>
+    struct kahan_accumulator
+    {
+        static_assert(std::is_floating_point_v<T>,
+            "kahan_accumulator requires a floating point type");
+
+        constexpr kahan_accumulator() = default;
+
+        // implicit conversion allows to start a partition off its first
+        // element
+        constexpr kahan_accumulator(T value) noexcept
+          : sum_(value)
+        {
+        }
+
+        constexpr void add(T value) noexcept
+        {
+            T const t = sum_ + value;
+
+            // keep the low-order bits of whichever operand is smaller
+            T const abs_sum = sum_ < T(0) ? -sum_ : sum_;
+            T const abs_value = value < T(0) ? -value : value;
+            if (abs_sum >= abs_value)
+            {
+                compensation_ += (sum_ - t) + value;
+            }
+            else
+            {
+                compensation_ += (value - t) + sum_;
+            }
+            sum_ = t;
+        }
+
+        [[nodiscard]] constexpr T get() const noexcept
+        {
+            return sum_ + compensation_;
+        }
+
+        T sum_ = T(0);
+        T compensation_ = T(0);
+    };
+
+    /// Compensated summation of floating point values, the reduction has to
+    /// start off a \a kahan_accumulator, e.g.
+    ///
+    /// \code
+    ///     auto const acc = hpx::reduce(hpx::execution::par, v.begin(),
+    ///         v.end(), kahan_accumulator<double>(), kahan_sum());
+    ///     double s = acc.get();
+    /// \endcode
+    ///
+    /// \note This reduction is never vectorized.
+    struct kahan_sum
+    {
+        template <typename T>
+        constexpr kahan_accumulator<T> operator()(
+            kahan_accumulator<T> lhs, T const& rhs) const noexcept
+        {
+            lhs.add(rhs);
+            return lhs;
+        }
+
+        template <typename T>
+        constexpr kahan_accumulator<T> operator()(
+            T const& lhs, kahan_accumulator<T> rhs) const noexcept
+        {
+            rhs.add(lhs);
+            return rhs;
+        }
+
+        template <typename T>
+        constexpr kahan_accumulator<T> operator()(kahan_accumulator<T> lhs,
+            kahan_accumulator<T> const& rhs) const noexcept
+        {
+            lhs.add(rhs.sum_);
+            lhs.add(rhs.compensation_);
+            return lhs;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Whether the given reduction operator can be applied to vector packs of
+    /// values of the given type
+    template <typename F, typename T>
+    struct is_vectorizable : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<sum, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<product, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<minimum, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<maximum, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<logical_and, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<logical_or, T> : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<bit_and, T> : std::is_integral<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<bit_or, T> : std::is_integral<T>
+    {
+    };
+
+    template <typename T>
+    struct is_vectorizable<bit_xor, T> : std::is_integral<T>
+    {
+    };
+
+    template <typename F, typename T>
+    inline constexpr bool is_vectorizable_v =
+        is_vectorizable<std::decay_t<F>, std::decay_t<T>>::value;
+}    // namespace hpx::experimental::reduction_operators
@@ -0,0 +1,383 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution/execution.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
+#include <hpx/parallel/util/detail/select_partitioner.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::parallel::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Largest number of elements handled by a single chunk of the
+        // single-pass scan if no chunk size was specified explicitly. Small
+        // chunks keep the partial results of a chunk in the cache until its
+        // prefix has been applied.
+        inline constexpr std::size_t scan_lookback_max_chunk_size = 16384;
+
+        // State of the descriptor of a single chunk
+        enum class scan_chunk_status : std::uint8_t
+        {
+            invalid = 0,      // nothing has been published yet
+            aggregate = 1,    // the reduction of the chunk itself is known
+            prefix = 2,       // the inclusive prefix of the chunk is known
+            failed = 3        // the chunk (or one of its predecessors) failed
+        };
+
+        // Every chunk publishes its results through a descriptor. The values
+        // are written once and become visible by a release-store of the
+        // status.
+        template <typename T>
+        struct scan_chunk_descriptor
+        {
+            std::atomic<scan_chunk_status> status_{scan_chunk_status::invalid};
+            T aggregate_{};
+            T prefix_{};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The look-back partitioner performs the scan in a single pass over
+        // the input using decoupled look-back: the chunks are handed out in
+        // order to a fixed number of tasks. Each chunk computes its local scan
+        // and publishes its aggregate, after which it walks its predecessors
+        // from right to left, combining their aggregates until it finds a
+        // predecessor whose inclusive prefix is already known. The chunk then
+        // publishes its own inclusive prefix and immediately applies its
+        // exclusive prefix to its (still cached) partial results.
+        //
+        // As chunks are handed out in order, all predecessors of a chunk have
+        // been picked up by some task already. Their aggregates do not depend
+        // on any other chunk, which guarantees forward progress.
+        template <typename ExPolicy, typename R, typename Result1>
+        struct scan_lookback_static_partitioner
+        {
+            using parameters_type = typename ExPolicy::executor_parameters_type;
+            using executor_type = typename ExPolicy::executor_type;
+
+            using scoped_executor_parameters =
+                detail::scoped_executor_parameters_ref<parameters_type,
+                    executor_type>;
+
+            using handle_local_exceptions =
+                detail::handle_local_exceptions<ExPolicy>;
+
+            using descriptor_type =
+                hpx::util::cache_line_data<scan_chunk_descriptor<Result1>>;
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call([[maybe_unused]] ExPolicy_ policy,
+                [[maybe_unused]] FwdIter first,
+                [[maybe_unused]] std::size_t count, [[maybe_unused]] T&& init,
+                [[maybe_unused]] F1&& f1, [[maybe_unused]] F2&& f2,
+                [[maybe_unused]] F3&& f3, [[maybe_unused]] F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<Result1> prefixes;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    HPX_ASSERT(count > 0);
+
+                    std::size_t const cores =
+                        execution::processing_units_count(policy.parameters(),
+                            policy.executor(), hpx::chrono::null_duration,
+                            count);
+
+                    std::size_t max_chunks =
+                        execution::maximal_number_of_chunks(
+                            policy.parameters(), policy.executor(), cores,
+                            count);
+
+                    std::size_t chunk_size = execution::get_chunk_size(
+                        policy.parameters(), policy.executor(),
+                        hpx::chrono::null_duration, cores, count);
+
+                    bool const has_chunk_size = chunk_size != 0;
+                    util::detail::adjust_chunk_size_and_max_chunks(
+                        cores, count, max_chunks, chunk_size);
+
+                    // prefer many small chunks unless told otherwise
+                    if (!has_chunk_size)
+                    {
+                        chunk_size = (std::min)(
+                            chunk_size, scan_lookback_max_chunk_size);
+                    }
+
+                    std::size_t const num_chunks =
+                        (count + chunk_size - 1) / chunk_size;
+
+                    // determine the beginning of every chunk
+                    std::vector<FwdIter> chunk_first;
+                    chunk_first.reserve(num_chunks);
+                    for (std::size_t i = 0; i != num_chunks; ++i)
+                    {
+                        chunk_first.push_back(first);
+                        if (i + 1 != num_chunks)
+                        {
+                            std::advance(first, chunk_size);
+                        }
+                    }
+
+                    std::vector<descriptor_type> descriptors(num_chunks);
+                    std::atomic<std::size_t> next_chunk(0);
+                    Result1 const initial(HPX_FORWARD(T, init));
+
+                    auto process_chunk = [&](std::size_t chunk) {
+                        auto& desc = descriptors[chunk].data_;
+                        std::size_t const size = chunk == num_chunks - 1 ?
+                            count - chunk * chunk_size :
+                            chunk_size;
+
+                        try
+                        {
+                            Result1 aggregate =
+                                HPX_INVOKE(f1, chunk_first[chunk], size);
+
+                            if (chunk == 0)
+                            {
+                                desc.prefix_ =
+                                    HPX_INVOKE(f2, initial, aggregate);
+                                desc.status_.store(scan_chunk_status::prefix,
+                                    std::memory_order_release);
+
+                                HPX_INVOKE(f3, chunk_first[chunk], size,
+                                    initial);
+                                return;
+                            }
+
+                            desc.aggregate_ = aggregate;
+                            desc.status_.store(scan_chunk_status::aggregate,
+                                std::memory_order_release);
+
+                            Result1 exclusive;
+                            if (!look_back(descriptors, chunk, f2, exclusive))
+                            {
+                                // a predecessor failed, its exception is
+                                // reported by the task that ran it
+                                desc.status_.store(scan_chunk_status::failed,
+                                    std::memory_order_release);
+                                return;
+                            }
+
+                            desc.prefix_ = HPX_INVOKE(f2, exclusive, aggregate);
+                            desc.status_.store(scan_chunk_status::prefix,
+                                std::memory_order_release);
+
+                            HPX_INVOKE(
+                                f3, chunk_first[chunk], size, exclusive);
+                        }
+                        catch (...)
+                        {
+                            // make sure no successor waits forever
+                            desc.status_.store(scan_chunk_status::failed,
+                                std::memory_order_release);
+                            throw;
+                        }
+                    };
+
+                    // every task processes chunks in order until all chunks
+                    // have been handed out
+                    auto worker = [&](std::size_t) {
+                        std::size_t chunk = next_chunk++;
+                        for (/**/; chunk < num_chunks; chunk = next_chunk++)
+                        {
+                            process_chunk(chunk);
+                        }
+                    };
+
+                    {
+                        auto&& items = execution::bulk_async_execute(
+                            policy.executor(), worker,
+                            hpx::util::counting_shape(
+                                (std::min)(cores, num_chunks)));
+
+                        scoped_params.mark_end_of_scheduling();
+
+                        // the descriptors are referenced by all tasks, wait
+                        // for them before leaving this scope
+                        if (hpx::wait_all_nothrow(items))
+                        {
+                            handle_local_exceptions::call(items, errors);
+                        }
+                    }
+
+                    // provide the exclusive prefix of every chunk and the
+                    // overall result
+                    prefixes.reserve(num_chunks + 1);
+                    prefixes.push_back(initial);
+                    for (auto& desc : descriptors)
+                    {
+                        prefixes.push_back(HPX_MOVE(desc.data_.prefix_));
+                    }
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+                return reduce(
+                    HPX_MOVE(prefixes), HPX_MOVE(errors), HPX_FORWARD(F4, f4));
+#endif
+            }
+
+        private:
+            // Combine the results of all predecessors of the given chunk.
+            // Returns false if one of the predecessors failed.
+            template <typename F2>
+            static bool look_back(std::vector<descriptor_type>& descriptors,
+                std::size_t chunk, F2& f2, Result1& exclusive)
+            {
+                bool has_value = false;
+                while (chunk-- != 0)
+                {
+                    auto& pred = descriptors[chunk].data_;
+
+                    scan_chunk_status status =
+                        pred.status_.load(std::memory_order_acquire);
+                    if (status == scan_chunk_status::invalid)
+                    {
+                        hpx::util::yield_while([&]() {
+                            status =
+                                pred.status_.load(std::memory_order_acquire);
+                            return status == scan_chunk_status::invalid;
+                        });
+                    }
+
+                    if (status == scan_chunk_status::failed)
+                    {
+                        return false;
+                    }
+
+                    Result1 const& value =
+                        status == scan_chunk_status::prefix ? pred.prefix_ :
+                                                              pred.aggregate_;
+
+                    // the predecessor's value goes to the left
+                    if (has_value)
+                    {
+                        exclusive = HPX_INVOKE(f2, value, exclusive);
+                    }
+                    else
+                    {
+                        exclusive = value;
+                        has_value = true;
+                    }
+
+                    if (status == scan_chunk_status::prefix)
+                    {
+                        return true;
+                    }
+                }
+
+                // the first chunk always publishes its prefix
+                HPX_ASSERT(false);
+                return false;
+            }
+
+            template <typename F>
+            static R reduce([[maybe_unused]] std::vector<Result1>&& prefixes,
+                [[maybe_unused]] std::list<std::exception_ptr>&& errors,
+                [[maybe_unused]] F&& f)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                // always rethrow if 'errors' is not empty
+                handle_local_exceptions::call(errors);
+
+                try
+                {
+                    // all tasks have finished already, there are no futures
+                    // left to hand over
+                    return f(HPX_MOVE(prefixes),
+                        std::vector<hpx::future<void>>());
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_local_exceptions::call(std::current_exception());
+                }
+
+                HPX_UNREACHABLE;    //-V779
+#endif
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename R, typename Result1>
+        struct scan_lookback_task_static_partitioner
+        {
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static hpx::future<R> call(ExPolicy_&& policy, FwdIter first,
+                std::size_t count, T&& init, F1&& f1, F2&& f2, F3&& f3, F4&& f4)
+            {
+                return execution::async_execute(policy.executor(),
+                    [first, count, policy = HPX_FORWARD(ExPolicy_, policy),
+                        init = HPX_FORWARD(T, init), f1 = HPX_FORWARD(F1, f1),
+                        f2 = HPX_FORWARD(F2, f2), f3 = HPX_FORWARD(F3, f3),
+                        f4 = HPX_FORWARD(F4, f4)]() mutable -> R {
+                        using partitioner_type =
+                            scan_lookback_static_partitioner<ExPolicy, R,
+                                Result1>;
+                        return partitioner_type::call(
+                            HPX_FORWARD(ExPolicy_, policy), first, count,
+                            HPX_MOVE(init), f1, f2, f3, f4);
+                    });
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Single-pass alternative to the scan_partitioner for scans whose third
+    // step does not produce a result. It expects the same step functions:
+    //
+    // ExPolicy:    execution policy
+    // R:           overall result type
+    // Result1:     intermediate result type of first and second step
+    template <typename ExPolicy, typename R = void, typename Result1 = R>
+    struct scan_lookback_partitioner
+      : detail::select_partitioner<std::decay_t<ExPolicy>,
+            detail::scan_lookback_static_partitioner,
+            detail::scan_lookback_task_static_partitioner>::template apply<R,
+            Result1>
+    {
+    };
+}    // namespace hpx::parallel::util
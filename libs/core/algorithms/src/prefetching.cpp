@@ -0,0 +1,89 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/parallel/util/prefetching.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace hpx::parallel::util::prefetching {
+
+    namespace {
+
+        // The latency is measured by chasing pointers through a buffer
+        // considerably larger than the last level cache of most systems. Its
+        // cache lines are visited in random order, which defeats the
+        // hardware prefetchers.
+        constexpr std::size_t latency_buffer_size = std::size_t(64) << 20;
+        constexpr std::size_t latency_num_hops = std::size_t(1) << 16;
+
+        // used if the measurement fails
+        constexpr std::uint64_t default_memory_latency = 100;    // ns
+
+        std::uint64_t measure_memory_latency()
+        {
+            std::size_t const stride =
+                (std::max)(threads::get_cache_line_size() / sizeof(std::size_t),
+                    std::size_t(1));
+            std::size_t const num_lines =
+                latency_buffer_size / (stride * sizeof(std::size_t));
+
+            // link all cache lines into a single cycle visiting them in
+            // random order
+            std::vector<std::size_t> order(num_lines);
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+
+            std::vector<std::size_t> buffer(num_lines * stride);
+            for (std::size_t i = 0; i != num_lines; ++i)
+            {
+                buffer[order[i] * stride] =
+                    order[(i + 1) % num_lines] * stride;
+            }
+
+            std::size_t pos = order[0] * stride;
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            for (std::size_t i = 0; i != latency_num_hops; ++i)
+            {
+                pos = buffer[pos];
+            }
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - start;
+
+            // make sure the loop is not optimized away
+            if (pos >= buffer.size())
+            {
+                return default_memory_latency;
+            }
+            return (std::max)(
+                elapsed / latency_num_hops, static_cast<std::uint64_t>(1));
+        }
+    }    // namespace
+
+    std::uint64_t get_memory_latency()
+    {
+        static std::uint64_t const latency = [] {
+            try
+            {
+                return measure_memory_latency();
+            }
+            catch (std::exception const&)
+            {
+                return default_memory_latency;
+            }
+        }();
+        return latency;
+    }
+}    // namespace hpx::parallel::util::prefetching
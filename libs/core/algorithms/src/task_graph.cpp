@@ -0,0 +1,175 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/task_graph.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_graph::task_graph()
+      : data_(std::make_unique<graph_data>())
+    {
+    }
+
+#if defined(HPX_DEBUG)
+    task_graph::~task_graph()
+    {
+        // the last replay must have completed
+        HPX_ASSERT(!data_ || !data_->running.load(std::memory_order_acquire));
+    }
+#else
+    task_graph::~task_graph() = default;
+#endif
+
+    task_graph::node task_graph::add_node(hpx::move_only_function<void()> f,
+        node const* dependencies, std::size_t count)
+    {
+        if (data_->running.load(std::memory_order_acquire))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::add", "the task_graph is being replayed");
+        }
+
+        node const n = data_->nodes.size();
+        data_->nodes.emplace_back();
+        data_->nodes.back().f = HPX_MOVE(f);
+        data_->modified = true;
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            add_dependency(n, dependencies[i]);
+        }
+        return n;
+    }
+
+    void task_graph::add_dependency(node n, node dependency)
+    {
+        if (data_->running.load(std::memory_order_acquire))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::add_dependency",
+                "the task_graph is being replayed");
+        }
+
+        if (n >= data_->nodes.size() || dependency >= n)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "task_graph::add_dependency",
+                "a task can depend only on tasks that were added before it");
+        }
+
+        data_->nodes[dependency].successors.push_back(n);
+        ++data_->nodes[n].num_dependencies;
+        data_->modified = true;
+    }
+
+    std::size_t task_graph::size() const noexcept
+    {
+        return data_->nodes.size();
+    }
+
+    void task_graph::clear()
+    {
+        if (data_->running.load(std::memory_order_acquire))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::clear", "the task_graph is being replayed");
+        }
+
+        data_->nodes.clear();
+        data_->modified = true;
+    }
+
+    hpx::future<void> task_graph::start_replay()
+    {
+        graph_data& data = *data_;
+
+        bool expected = false;
+        if (!data.running.compare_exchange_strong(
+                expected, true, std::memory_order_acq_rel))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "task_graph::replay", "the task_graph is being replayed");
+        }
+
+        std::size_t const num_nodes = data.nodes.size();
+        if (data.modified)
+        {
+            data.roots.clear();
+            for (std::size_t i = 0; i != num_nodes; ++i)
+            {
+                if (data.nodes[i].num_dependencies == 0)
+                {
+                    data.roots.push_back(i);
+                }
+            }
+
+            if (data.num_pending != num_nodes)
+            {
+                data.pending.reset(new std::atomic<std::size_t>[num_nodes]);
+                data.num_pending = num_nodes;
+            }
+            data.modified = false;
+        }
+
+        if (num_nodes == 0)
+        {
+            data.running.store(false, std::memory_order_release);
+            return hpx::make_ready_future();
+        }
+
+        // spawning the root tasks makes the new values visible to them
+        for (std::size_t i = 0; i != num_nodes; ++i)
+        {
+            data.pending[i].store(
+                data.nodes[i].num_dependencies, std::memory_order_relaxed);
+        }
+        data.remaining.store(num_nodes, std::memory_order_relaxed);
+        data.failed.store(false, std::memory_order_relaxed);
+
+        data.done = hpx::promise<void>();
+        return data.done.get_future();
+    }
+
+    void task_graph::add_exception(graph_data* data, std::exception_ptr e)
+    {
+        data->failed.store(true, std::memory_order_relaxed);
+        data->errors.add(HPX_MOVE(e));
+    }
+
+    void task_graph::finish_node(graph_data* data)
+    {
+        if (data->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+
+        // the graph may be destroyed or replayed again as soon as the
+        // promise has been made ready
+        hpx::promise<void> done = HPX_MOVE(data->done);
+        if (data->failed.load(std::memory_order_relaxed))
+        {
+            hpx::exception_list errors = HPX_MOVE(data->errors);
+            data->errors = hpx::exception_list();
+            data->running.store(false, std::memory_order_release);
+            done.set_exception(std::make_exception_ptr(HPX_MOVE(errors)));
+        }
+        else
+        {
+            data->running.store(false, std::memory_order_release);
+            done.set_value();
+        }
+    }
+}    // namespace hpx::experimental
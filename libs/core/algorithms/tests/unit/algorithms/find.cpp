@@ -25,6 +25,9 @@ void test_find()
     test_find(par, IteratorTag());
     test_find(par_unseq, IteratorTag());
 
+    test_find_large(par, IteratorTag());
+    test_find_large(par_unseq, IteratorTag());
+
     test_find_async(seq(task), IteratorTag());
     test_find_async(par(task), IteratorTag());
 }
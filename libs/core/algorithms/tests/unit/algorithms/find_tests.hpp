@@ -69,6 +69,44 @@ void test_find(ExPolicy&& policy, IteratorTag)
     HPX_TEST(index == iterator(test_index));
 }
 
+// large sequences are searched in waves of growing size starting from the
+// front, make sure matches are found wherever they are located
+template <typename ExPolicy, typename IteratorTag>
+void test_find_large(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy_v<ExPolicy>,
+        "hpx::is_execution_policy_v<ExPolicy>");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::size_t const size = 16 * 4096 * hpx::get_os_thread_count() + 7;
+
+    std::vector<std::size_t> const positions = {0, 1, 4097, size / 3,
+        size / 2, size - 2, size - 1};
+    for (std::size_t pos : positions)
+    {
+        std::vector<int> c(size);
+        std::fill(std::begin(c), std::end(c), dis(gen));
+        c[pos] = 1;
+        c[size - 1] = 1;
+
+        iterator index = hpx::find(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), int(1));
+
+        HPX_TEST(index == iterator(std::begin(c) + pos));
+    }
+
+    // no match at all
+    std::vector<int> c(size);
+    std::fill(std::begin(c), std::end(c), dis(gen));
+
+    iterator index = hpx::find(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), int(1));
+
+    HPX_TEST(index == iterator(std::end(c)));
+}
+
 template <typename Policy, typename ExPolicy, typename IteratorTag>
 void test_find_explicit_sender_direct(Policy l, ExPolicy&& policy, IteratorTag)
 {
@@ -0,0 +1,148 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// every point of the index space has to be visited exactly once
+template <typename... Policy>
+void test_for_loop_nd_2d(std::array<int, 2> const& extents,
+    std::array<int, 2> const* tile, Policy&&... policy)
+{
+    std::vector<std::atomic<int>> visits(
+        static_cast<std::size_t>(extents[0] * extents[1]));
+    for (auto& v : visits)
+    {
+        v.store(0);
+    }
+
+    auto f = [&](int i, int j) {
+        HPX_TEST(i >= 0 && i < extents[0]);
+        HPX_TEST(j >= 0 && j < extents[1]);
+        ++visits[static_cast<std::size_t>(i * extents[1] + j)];
+    };
+
+    if (tile != nullptr)
+    {
+        hpx::experimental::for_loop_nd(policy..., extents, *tile, f);
+    }
+    else
+    {
+        hpx::experimental::for_loop_nd(policy..., extents, f);
+    }
+
+    for (auto const& v : visits)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename... Policy>
+void test_for_loop_nd_3d(std::array<std::size_t, 3> const& extents,
+    std::array<std::size_t, 3> const& tile, Policy&&... policy)
+{
+    std::size_t const size = extents[0] * extents[1] * extents[2];
+    std::vector<std::atomic<int>> visits(size);
+    for (auto& v : visits)
+    {
+        v.store(0);
+    }
+
+    hpx::experimental::for_loop_nd(policy..., extents, tile,
+        [&](std::size_t i, std::size_t j, std::size_t k) {
+            ++visits[(i * extents[1] + j) * extents[2] + k];
+        });
+
+    for (auto const& v : visits)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename... Policy>
+void test_for_loop_nd(Policy&&... policy)
+{
+    std::array<int, 2> const tile2{7, 13};
+
+    test_for_loop_nd_2d({1000, 1000}, nullptr, policy...);
+    test_for_loop_nd_2d({3, 5000}, nullptr, policy...);
+    test_for_loop_nd_2d({1000, 1000}, &tile2, policy...);
+    test_for_loop_nd_2d({1, 1}, &tile2, policy...);
+    test_for_loop_nd_2d({0, 100}, &tile2, policy...);
+
+    test_for_loop_nd_3d({50, 60, 70}, {8, 8, 8}, policy...);
+    test_for_loop_nd_3d({50, 60, 70}, {1, 100, 3}, policy...);
+}
+
+void test_for_loop_nd_async()
+{
+    using namespace hpx::execution;
+
+    std::array<std::size_t, 3> const extents{40, 50, 60};
+    std::atomic<std::size_t> count(0);
+
+    hpx::future<void> f = hpx::experimental::for_loop_nd(par(task), extents,
+        [&](std::size_t, std::size_t, std::size_t) { ++count; });
+    f.get();
+
+    HPX_TEST_EQ(count.load(), extents[0] * extents[1] * extents[2]);
+}
+
+void test_for_loop_nd_bad_tile()
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::for_loop_nd(hpx::execution::par,
+            std::array<int, 2>{10, 10}, std::array<int, 2>{0, 4},
+            [](int, int) {});
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    test_for_loop_nd();
+    test_for_loop_nd(seq);
+    test_for_loop_nd(par);
+    test_for_loop_nd(par_unseq);
+    test_for_loop_nd(par.with(experimental::static_chunk_size(1)));
+
+    test_for_loop_nd_async();
+    test_for_loop_nd_bad_tile();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,159 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// use a size that spans several chunks of the parallel algorithm
+#if defined(HPX_DEBUG)
+constexpr std::size_t test_size = 200003;
+#else
+constexpr std::size_t test_size = 2000003;
+#endif
+
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<int> make_input(std::size_t size, int max_value)
+{
+    std::vector<int> c(size);
+    std::uniform_int_distribution<int> dis(-2, max_value);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+template <typename Bin>
+std::vector<Bin> make_expected(std::vector<int> const& c, std::size_t num_bins)
+{
+    // negative values and values beyond the last bin are not counted
+    std::vector<Bin> expected(num_bins);
+    for (int const v : c)
+    {
+        if (v >= 0 && static_cast<std::size_t>(v) < num_bins)
+        {
+            ++expected[v];
+        }
+    }
+    return expected;
+}
+
+template <typename Bin>
+void test_histogram(std::size_t num_bins, std::size_t size = test_size)
+{
+    std::vector<int> const c =
+        make_input(size, static_cast<int>(num_bins) + 2);
+    std::vector<Bin> const expected = make_expected<Bin>(c, num_bins);
+
+    auto const bin = [](int v) { return v; };
+
+    std::vector<Bin> bins(num_bins);
+    hpx::experimental::histogram(c.begin(), c.end(), bins, bin);
+    HPX_TEST(bins == expected);
+
+    bins.assign(num_bins, Bin(0));
+    hpx::experimental::histogram(
+        hpx::execution::seq, c.begin(), c.end(), bins, bin);
+    HPX_TEST(bins == expected);
+
+    bins.assign(num_bins, Bin(0));
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, bin);
+    HPX_TEST(bins == expected);
+
+    bins.assign(num_bins, Bin(0));
+    hpx::experimental::histogram(
+        hpx::execution::par_unseq, c.begin(), c.end(), bins, bin);
+    HPX_TEST(bins == expected);
+
+    bins.assign(num_bins, Bin(0));
+    hpx::future<void> f =
+        hpx::experimental::histogram(hpx::execution::par(hpx::execution::task),
+            c.begin(), c.end(), bins, bin);
+    f.get();
+    HPX_TEST(bins == expected);
+
+    // the counts are added to the values of the bins
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, bin);
+    for (std::size_t i = 0; i != num_bins; ++i)
+    {
+        HPX_TEST_EQ(bins[i], 2 * expected[i]);
+    }
+}
+
+void test_histogram_forward()
+{
+    std::vector<int> const v = make_input(test_size, 10);
+    std::list<int> const c(v.begin(), v.end());
+    std::vector<std::size_t> const expected =
+        make_expected<std::size_t>(v, 8);
+
+    std::vector<std::size_t> bins(8);
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, [](int v) { return v; });
+    HPX_TEST(bins == expected);
+}
+
+void test_histogram_small()
+{
+    std::vector<int> c;
+    std::vector<std::size_t> bins(4);
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, [](int v) { return v; });
+    HPX_TEST(bins == std::vector<std::size_t>(4));
+
+    c = {1, 3, 3, 7};
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, [](int v) { return v; });
+    HPX_TEST(bins == std::vector<std::size_t>({0, 1, 0, 2}));
+
+    // no bins at all
+    bins.clear();
+    hpx::experimental::histogram(
+        hpx::execution::par, c.begin(), c.end(), bins, [](int v) { return v; });
+    HPX_TEST(bins.empty());
+
+    test_histogram<std::size_t>(10, 1000);
+}
+
+int hpx_main()
+{
+    test_histogram<std::size_t>(1);
+    test_histogram<std::size_t>(16);
+    test_histogram<std::uint32_t>(256);
+    test_histogram<double>(100);
+    test_histogram<std::size_t>(100000);
+
+    test_histogram_forward();
+    test_histogram_small();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -123,6 +123,39 @@ void test_nth_element_async(ExPolicy p, IteratorTag)
     }
 }
 
+// large enough to be processed by the parallel selection
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element_large(
+    ExPolicy policy, IteratorTag, std::size_t range, std::size_t nth)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::size_t const size = 1000003;
+    std::vector<std::size_t> c(size);
+    std::generate(
+        std::begin(c), std::end(c), [range]() { return std::rand() % range; });
+    std::vector<std::size_t> d = c;
+
+    hpx::nth_element(policy, iterator(std::begin(c)),
+        iterator(std::begin(c) + nth), iterator(std::end(c)));
+
+    std::nth_element(std::begin(d), std::begin(d) + nth, std::end(d));
+
+    HPX_TEST_EQ(c[nth], d[nth]);
+    HPX_TEST(std::all_of(std::begin(c), std::begin(c) + nth,
+        [&](std::size_t v) { return v <= c[nth]; }));
+    HPX_TEST(std::all_of(std::begin(c) + nth, std::end(c),
+        [&](std::size_t v) { return v >= c[nth]; }));
+
+    std::sort(std::begin(c), std::end(c));
+    std::sort(std::begin(d), std::end(d));
+    HPX_TEST(c == d);
+}
+
 template <typename IteratorTag>
 void test_nth_element()
 {
@@ -134,6 +167,14 @@ void test_nth_element()
 
     test_nth_element_async(seq(task), IteratorTag());
     test_nth_element_async(par(task), IteratorTag());
+
+    for (std::size_t range : {2, 1000, RAND_MAX})
+    {
+        test_nth_element_large(par, IteratorTag(), range, 0);
+        test_nth_element_large(par, IteratorTag(), range, 999999);
+        test_nth_element_large(
+            par, IteratorTag(), range, std::rand() % 1000003);
+    }
 }
 
 void nth_element_test()
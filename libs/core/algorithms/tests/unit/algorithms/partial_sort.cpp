@@ -11,6 +11,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <random>
@@ -109,6 +110,24 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
 }
 
+// large enough to be processed by the parallel selection
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy policy, std::size_t middle)
+{
+    std::size_t const size = 1000003;
+
+    std::vector<std::uint64_t> A(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, size / 4);
+    std::generate(A.begin(), A.end(), [&]() { return dis(gen); });
+
+    std::vector<std::uint64_t> B = A;
+    std::sort(B.begin(), B.end());
+
+    hpx::partial_sort(policy, A.begin(), A.begin() + middle, A.end());
+
+    HPX_TEST(std::equal(A.begin(), A.begin() + middle, B.begin()));
+}
+
 template <typename IteratorTag>
 void test_partial_sort()
 {
@@ -126,6 +145,11 @@ void partial_sort_test()
 {
     test_partial_sort<std::random_access_iterator_tag>();
     test_partial_sort<std::forward_iterator_tag>();
+
+    for (std::size_t middle : {1, 1000, 500000, 1000002})
+    {
+        test_partial_sort_large(hpx::execution::par, middle);
+    }
 }
 
 int hpx_main(hpx::program_options::variables_map& vm)
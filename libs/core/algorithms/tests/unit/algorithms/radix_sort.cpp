@@ -0,0 +1,155 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// use a size that spans several chunks of the parallel algorithm
+#if defined(HPX_DEBUG)
+constexpr std::size_t test_size = 200003;
+#else
+constexpr std::size_t test_size = 2000003;
+#endif
+
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> make_input(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(-1e6, 1e6);
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dis(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    return c;
+}
+
+template <typename T>
+void test_radix_sort(std::size_t size = test_size)
+{
+    std::vector<T> c = make_input<T>(size);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> d = c;
+    hpx::experimental::radix_sort(d.begin(), d.end());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::experimental::radix_sort(hpx::execution::seq, d.begin(), d.end());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::experimental::radix_sort(hpx::execution::par, d.begin(), d.end());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::experimental::radix_sort(
+        hpx::execution::par_unseq, d.begin(), d.end());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::future<void> f = hpx::experimental::radix_sort(
+        hpx::execution::par(hpx::execution::task), d.begin(), d.end());
+    f.get();
+    HPX_TEST(d == expected);
+}
+
+template <typename T>
+void test_radix_sort_few_keys()
+{
+    // most of the passes are skipped as all keys share most of their bytes
+    std::vector<T> c(test_size);
+    std::uniform_int_distribution<int> dis(0, 7);
+    std::generate(
+        c.begin(), c.end(), [&]() { return static_cast<T>(dis(gen)); });
+
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::experimental::radix_sort(hpx::execution::par, c.begin(), c.end());
+    HPX_TEST(c == expected);
+}
+
+void test_radix_sort_special_values()
+{
+    std::vector<double> c = {3.0, -0.5, std::numeric_limits<double>::max(),
+        -std::numeric_limits<double>::infinity(), 0.0,
+        std::numeric_limits<double>::lowest(),
+        std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::denorm_min(), -2.0};
+
+    std::vector<double> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::experimental::radix_sort(c.begin(), c.end());
+    HPX_TEST(c == expected);
+}
+
+void test_radix_sort_small()
+{
+    std::vector<int> c;
+    hpx::experimental::radix_sort(hpx::execution::par, c.begin(), c.end());
+    HPX_TEST(c.empty());
+
+    c = {42};
+    hpx::experimental::radix_sort(hpx::execution::par, c.begin(), c.end());
+    HPX_TEST_EQ(c[0], 42);
+
+    test_radix_sort<int>(1000);
+}
+
+int hpx_main()
+{
+    test_radix_sort<std::uint64_t>();
+    test_radix_sort<std::int64_t>();
+    test_radix_sort<std::uint32_t>();
+    test_radix_sort<std::int16_t>();
+    test_radix_sort<float>();
+    test_radix_sort<double>();
+
+    test_radix_sort_few_keys<std::uint64_t>();
+    test_radix_sort_few_keys<float>();
+
+    test_radix_sort_special_values();
+    test_radix_sort_small();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -73,6 +73,22 @@ void reduce_test3()
     test_reduce3<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_reduce_ordered()
+{
+    using namespace hpx::execution;
+
+    test_reduce_ordered(seq, IteratorTag());
+    test_reduce_ordered(par, IteratorTag());
+}
+
+void reduce_ordered_test()
+{
+    test_reduce_ordered<std::random_access_iterator_tag>();
+    test_reduce_ordered<std::forward_iterator_tag>();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_reduce_exception()
@@ -130,6 +146,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     reduce_test1();
     reduce_test2();
     reduce_test3();
+    reduce_ordered_test();
 
     reduce_exception_test();
     reduce_bad_alloc_test();
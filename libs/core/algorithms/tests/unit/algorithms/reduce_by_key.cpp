@@ -9,6 +9,8 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/parallel/algorithms/reduce_by_key.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <iomanip>
 #include <random>
 #include <utility>
@@ -484,6 +486,97 @@ void test_reduce_by_key1()
         [](double a) { return std::floor(a); });
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_reduce_by_key_edge_cases(ExPolicy&& policy)
+{
+    std::vector<int> keys, values;
+    std::vector<int> o_keys(4, -1), o_values(4, -1);
+
+    // empty input
+    auto result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), o_keys.begin(), o_values.begin());
+    HPX_TEST(result.in == o_keys.begin());
+    HPX_TEST(result.out == o_values.begin());
+
+    // a single key
+    keys = {3};
+    values = {5};
+    result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), o_keys.begin(), o_values.begin());
+    HPX_TEST(result.in == o_keys.begin() + 1);
+    HPX_TEST(result.out == o_values.begin() + 1);
+    HPX_TEST_EQ(o_keys[0], 3);
+    HPX_TEST_EQ(o_values[0], 5);
+
+    // distinct output ranges
+    keys = {1, 1, 2, 3, 3, 3};
+    values = {1, 2, 3, 4, 5, 6};
+    result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), o_keys.begin(), o_values.begin());
+    HPX_TEST(result.in == o_keys.begin() + 3);
+    HPX_TEST(result.out == o_values.begin() + 3);
+    HPX_TEST(o_keys == std::vector<int>({1, 2, 3, -1}));
+    HPX_TEST(o_values == std::vector<int>({3, 3, 15, -1}));
+    HPX_TEST(keys == std::vector<int>({1, 1, 2, 3, 3, 3}));
+    HPX_TEST(values == std::vector<int>({1, 2, 3, 4, 5, 6}));
+}
+
+// the output is written in place, partitioned into chunks of different sizes
+template <typename ExPolicy>
+void test_reduce_by_key_in_place(ExPolicy&& policy)
+{
+    std::vector<std::vector<int>> const all_keys = {
+        {1, 2, 3, 4, 5, 6, 7},
+        {1, 1, 1, 1, 2, 3, 4},
+        {1, 2, 3, 4, 4, 4, 4},
+        {1, 2, 3, 3, 4, 5, 6},
+        {1, 1, 1, 1, 1, 1, 1},
+    };
+
+    for (auto const& k : all_keys)
+    {
+        std::vector<int> keys = k;
+        std::vector<int> values = {1, 2, 3, 4, 5, 6, 7};
+
+        std::vector<int> expected_keys(keys.size());
+        std::vector<int> expected_values(values.size());
+        auto expected = hpx::experimental::reduce_by_key(hpx::execution::seq,
+            keys.begin(), keys.end(), values.begin(), expected_keys.begin(),
+            expected_values.begin());
+        auto const segments = expected.in - expected_keys.begin();
+
+        auto result = hpx::experimental::reduce_by_key(policy, keys.begin(),
+            keys.end(), values.begin(), keys.begin(), values.begin());
+        HPX_TEST(result.in == keys.begin() + segments);
+        HPX_TEST(result.out == values.begin() + segments);
+        HPX_TEST(std::equal(keys.begin(), keys.begin() + segments,
+            expected_keys.begin()));
+        HPX_TEST(std::equal(values.begin(), values.begin() + segments,
+            expected_values.begin()));
+    }
+}
+
+void test_reduce_by_key2()
+{
+    using namespace hpx::execution;
+
+    test_reduce_by_key_edge_cases(seq);
+    test_reduce_by_key_edge_cases(par);
+    test_reduce_by_key_edge_cases(par_unseq);
+
+    // two chunks (4 and 3 elements) and three chunks (3, 3, and 1 elements)
+    for (std::size_t chunk_size : {4, 3})
+    {
+        hpx::execution::experimental::static_chunk_size cs(chunk_size);
+        test_reduce_by_key_in_place(par.with(cs));
+        test_reduce_by_key_in_place(par_unseq.with(cs));
+    }
+
+    // the first chunk is scanned while the remaining ones are summarized
+    test_reduce_by_key_in_place(par);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -495,7 +588,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     gen.seed(seed);
 
     test_reduce_by_key1();
-    //    test_reduce_by_key2();
+    test_reduce_by_key2();
     return hpx::local::finalize();
 }
 
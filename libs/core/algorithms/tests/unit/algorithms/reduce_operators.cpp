@@ -0,0 +1,122 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace ops = hpx::experimental::reduction_operators;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename F, typename Expected>
+void test_reduce(ExPolicy policy, std::vector<T> const& c, T init, F op,
+    Expected expected)
+{
+    static_assert(ops::is_vectorizable_v<F, T>);
+
+    T const result = hpx::reduce(policy, c.begin(), c.end(), init, op);
+    HPX_TEST_EQ(result, std::accumulate(c.begin(), c.end(), init, expected));
+}
+
+template <typename ExPolicy>
+void test_reduce_operators(ExPolicy policy)
+{
+    // an odd size to cover the remainder of the vectorized loops
+    std::size_t const size = 10007;
+
+    std::vector<std::int64_t> ints(size);
+    std::iota(ints.begin(), ints.end(), std::int64_t(-5000));
+
+    test_reduce(policy, ints, std::int64_t(0), ops::sum(), std::plus<>());
+    test_reduce(policy, ints, std::int64_t(42), ops::minimum(),
+        [](auto lhs, auto rhs) { return (std::min)(lhs, rhs); });
+    test_reduce(policy, ints, std::int64_t(-42), ops::maximum(),
+        [](auto lhs, auto rhs) { return (std::max)(lhs, rhs); });
+    test_reduce(
+        policy, ints, ~std::int64_t(0), ops::bit_and(), std::bit_and<>());
+    test_reduce(policy, ints, std::int64_t(0), ops::bit_or(), std::bit_or<>());
+    test_reduce(
+        policy, ints, std::int64_t(0), ops::bit_xor(), std::bit_xor<>());
+
+    std::vector<std::int32_t> flags(size, 1);
+    test_reduce(policy, flags, 1, ops::logical_and(),
+        [](int lhs, int rhs) { return (lhs != 0 && rhs != 0) ? 1 : 0; });
+    flags[size / 2] = 0;
+    test_reduce(policy, flags, 1, ops::logical_and(),
+        [](int lhs, int rhs) { return (lhs != 0 && rhs != 0) ? 1 : 0; });
+
+    std::vector<std::int32_t> zeros(size, 0);
+    test_reduce(policy, zeros, 0, ops::logical_or(),
+        [](int lhs, int rhs) { return (lhs != 0 || rhs != 0) ? 1 : 0; });
+    zeros[size - 1] = 3;
+    test_reduce(policy, zeros, 0, ops::logical_or(),
+        [](int lhs, int rhs) { return (lhs != 0 || rhs != 0) ? 1 : 0; });
+
+    // products and sums of small powers of two are exact
+    std::vector<double> doubles(size, 1.0);
+    doubles[7] = 2.0;
+    doubles[size - 1] = 0.5;
+    doubles[size / 3] = 4.0;
+    test_reduce(policy, doubles, 1.0, ops::product(), std::multiplies<>());
+    test_reduce(policy, doubles, 0.0, ops::sum(), std::plus<>());
+}
+
+template <typename ExPolicy>
+void test_kahan_sum(ExPolicy policy)
+{
+    // naive summation loses the small values entirely
+    std::vector<double> c = {1.0, 1e100, 1.0, -1e100};
+    auto const acc = hpx::reduce(policy, c.begin(), c.end(),
+        ops::kahan_accumulator<double>(), ops::kahan_sum());
+    HPX_TEST_EQ(acc.get(), 2.0);
+
+    // 0.1 has no exact representation, the compensated sum is correctly
+    // rounded
+    std::vector<double> tenths(100000, 0.1);
+    auto const sum = hpx::reduce(policy, tenths.begin(), tenths.end(),
+        ops::kahan_accumulator<double>(), ops::kahan_sum());
+    HPX_TEST_EQ(sum.get(), 10000.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    test_reduce_operators(seq);
+    test_reduce_operators(par);
+    test_reduce_operators(par_unseq);
+
+    test_kahan_sum(seq);
+    test_kahan_sum(par);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
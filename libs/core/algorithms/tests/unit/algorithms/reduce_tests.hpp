@@ -200,6 +200,33 @@ void test_reduce3_async(ExPolicy p, IteratorTag)
     HPX_TEST_EQ(f.get(), r2);
 }
 
+// the results of the chunks are combined in order (the operation is not
+// commutative)
+template <typename ExPolicy, typename IteratorTag>
+void test_reduce_ordered(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<std::string>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::string> c(10007);
+    std::uniform_int_distribution<int> dis('a', 'z');
+    for (auto& s : c)
+    {
+        s = std::string(1, static_cast<char>(dis(gen)));
+    }
+
+    std::string const val("init");
+    std::string r1 = hpx::reduce(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), val);
+
+    // verify values
+    std::string r2 = std::accumulate(std::begin(c), std::end(c), val);
+    HPX_TEST_EQ(r1, r2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_reduce_exception(ExPolicy policy, IteratorTag)
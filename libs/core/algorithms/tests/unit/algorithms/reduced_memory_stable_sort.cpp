@@ -0,0 +1,141 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// use a size that spans several chunks of the parallel merge
+#if defined(HPX_DEBUG)
+constexpr std::size_t test_size = 200003;
+#else
+constexpr std::size_t test_size = 2000003;
+#endif
+
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the elements are compared by their key only, the second member records
+// the original position
+using element = std::pair<std::uint32_t, std::size_t>;
+
+struct compare_keys
+{
+    bool operator()(element const& lhs, element const& rhs) const noexcept
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+std::vector<element> make_input(std::size_t size, std::uint32_t num_keys)
+{
+    std::uniform_int_distribution<std::uint32_t> dis(0, num_keys - 1);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element(dis(gen), i);
+    }
+    return c;
+}
+
+void test_reduced_memory_stable_sort(
+    std::size_t memory_divisor, std::uint32_t num_keys)
+{
+    std::vector<element> c = make_input(test_size, num_keys);
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(), compare_keys());
+
+    std::vector<element> d = c;
+    hpx::experimental::reduced_memory_stable_sort(
+        d.begin(), d.end(), memory_divisor, compare_keys());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::experimental::reduced_memory_stable_sort(hpx::execution::seq,
+        d.begin(), d.end(), memory_divisor, compare_keys());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::experimental::reduced_memory_stable_sort(hpx::execution::par,
+        d.begin(), d.end(), memory_divisor, compare_keys());
+    HPX_TEST(d == expected);
+
+    d = c;
+    hpx::future<void> f = hpx::experimental::reduced_memory_stable_sort(
+        hpx::execution::par(hpx::execution::task), d.begin(), d.end(),
+        memory_divisor, compare_keys());
+    f.get();
+    HPX_TEST(d == expected);
+}
+
+// the parallel merge of hpx::stable_sort keeps the order of equal elements
+void test_stable_sort_merge(std::uint32_t num_keys)
+{
+    std::vector<element> c = make_input(test_size, num_keys);
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(), compare_keys());
+
+    hpx::stable_sort(hpx::execution::par, c.begin(), c.end(), compare_keys());
+    HPX_TEST(c == expected);
+
+    // the second half of the sorted sequence precedes the first half
+    std::rotate(c.begin(), c.begin() + c.size() / 2, c.end());
+    hpx::stable_sort(hpx::execution::par, c.begin(), c.end(), compare_keys());
+    HPX_TEST(std::is_sorted(c.begin(), c.end(), compare_keys()));
+}
+
+void test_reduced_memory_stable_sort_small()
+{
+    std::vector<int> c;
+    hpx::experimental::reduced_memory_stable_sort(
+        hpx::execution::par, c.begin(), c.end(), 16);
+    HPX_TEST(c.empty());
+
+    c = {3, 1, 2};
+    hpx::experimental::reduced_memory_stable_sort(
+        hpx::execution::par, c.begin(), c.end(), 0);
+    HPX_TEST(c == std::vector<int>({1, 2, 3}));
+}
+
+int hpx_main()
+{
+    for (std::size_t memory_divisor : {1, 2, 16, 100})
+    {
+        test_reduced_memory_stable_sort(memory_divisor, 100);
+        test_reduced_memory_stable_sort(memory_divisor, 1u << 30);
+    }
+
+    test_stable_sort_merge(100);
+    test_stable_sort_merge(1u << 30);
+
+    test_reduced_memory_stable_sort_small();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
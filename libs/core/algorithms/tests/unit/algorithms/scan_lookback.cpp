@@ -0,0 +1,119 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The parallel scans combine the results of the chunks in a single pass
+// (decoupled look-back). Verify that the order of the operands is preserved
+// for an associative, but non-commutative operation over many chunks.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the affine function x -> a * x + b
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+
+    friend bool operator==(affine const& lhs, affine const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+// apply lhs first, then rhs
+affine compose(affine const& lhs, affine const& rhs)
+{
+    return affine{rhs.a * lhs.a, rhs.a * lhs.b + rhs.b};
+}
+
+constexpr std::size_t test_size = 100007;
+
+std::vector<affine> make_input()
+{
+    std::vector<affine> c(test_size);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = affine{2 * i + 3, i};
+    }
+    return c;
+}
+
+template <typename ExPolicy>
+void test_scans(ExPolicy&& policy)
+{
+    std::vector<affine> const c = make_input();
+    affine const init{5, 7};
+    auto const op = [](affine const& lhs, affine const& rhs) {
+        return compose(lhs, rhs);
+    };
+    auto const conv = [](affine const& f) { return affine{f.b + 1, f.a}; };
+
+    std::vector<affine> d(c.size());
+    std::vector<affine> expected(c.size());
+
+    hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), op, init);
+    std::inclusive_scan(c.begin(), c.end(), expected.begin(), op, init);
+    HPX_TEST(d == expected);
+
+    hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), op);
+    std::inclusive_scan(c.begin(), c.end(), expected.begin(), op);
+    HPX_TEST(d == expected);
+
+    hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), init, op);
+    std::exclusive_scan(c.begin(), c.end(), expected.begin(), init, op);
+    HPX_TEST(d == expected);
+
+    hpx::transform_inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), op, conv, init);
+    std::transform_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), op, conv, init);
+    HPX_TEST(d == expected);
+
+    hpx::transform_exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, op, conv);
+    std::transform_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, op, conv);
+    HPX_TEST(d == expected);
+}
+
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    test_scans(par);
+    test_scans(par_unseq);
+
+    // many small chunks exercise looking back across several predecessors
+    experimental::static_chunk_size cs(7);
+    test_scans(par.with(cs));
+    test_scans(par_unseq.with(cs));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The parallel set operations partition their input along the merge path of
+// both sequences. Verify the results for inputs large enough to be split into
+// several chunks and containing long runs of equivalent elements, which have
+// to be handled by a single chunk.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iterator>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::size_t> make_sorted_input(std::size_t size, std::size_t range)
+{
+    std::vector<std::size_t> c(size);
+    std::generate(std::begin(c), std::end(c),
+        [range]() { return static_cast<std::size_t>(std::rand()) % range; });
+    std::sort(std::begin(c), std::end(c));
+    return c;
+}
+
+template <typename ExPolicy>
+void test_set_operations(
+    ExPolicy&& policy, std::size_t size1, std::size_t size2, std::size_t range)
+{
+    std::vector<std::size_t> const c1 = make_sorted_input(size1, range);
+    std::vector<std::size_t> const c2 = make_sorted_input(size2, range);
+
+    std::vector<std::size_t> d(size1 + size2), expected(size1 + size2);
+
+    {
+        auto result = hpx::set_union(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(d));
+        auto expected_result = std::set_union(std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(expected));
+
+        HPX_TEST_EQ(std::distance(std::begin(d), result),
+            std::distance(std::begin(expected), expected_result));
+        HPX_TEST(std::equal(std::begin(d), result, std::begin(expected)));
+    }
+
+    {
+        auto result = hpx::set_intersection(policy, std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2), std::begin(d));
+        auto expected_result = std::set_intersection(std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2), std::begin(expected));
+
+        HPX_TEST_EQ(std::distance(std::begin(d), result),
+            std::distance(std::begin(expected), expected_result));
+        HPX_TEST(std::equal(std::begin(d), result, std::begin(expected)));
+    }
+
+    {
+        auto result = hpx::set_difference(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(d));
+        auto expected_result = std::set_difference(std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2), std::begin(expected));
+
+        HPX_TEST_EQ(std::distance(std::begin(d), result),
+            std::distance(std::begin(expected), expected_result));
+        HPX_TEST(std::equal(std::begin(d), result, std::begin(expected)));
+    }
+
+    {
+        auto result = hpx::set_symmetric_difference(policy, std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2), std::begin(d));
+        auto expected_result =
+            std::set_symmetric_difference(std::begin(c1), std::end(c1),
+                std::begin(c2), std::end(c2), std::begin(expected));
+
+        HPX_TEST_EQ(std::distance(std::begin(d), result),
+            std::distance(std::begin(expected), expected_result));
+        HPX_TEST(std::equal(std::begin(d), result, std::begin(expected)));
+    }
+
+    {
+        auto result = hpx::merge(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(d));
+        std::merge(std::begin(c1), std::end(c1), std::begin(c2), std::end(c2),
+            std::begin(expected));
+
+        HPX_TEST(result == std::end(d));
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_set_operations(ExPolicy&& policy)
+{
+    // many duplicates
+    test_set_operations(policy, 300007, 200003, 1000);
+    test_set_operations(policy, 300007, 1007, 10);
+    // all elements equivalent
+    test_set_operations(policy, 200003, 300007, 1);
+    // few duplicates
+    test_set_operations(policy, 200003, 300007, 1000000007);
+}
+
+int hpx_main()
+{
+    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+
+    using namespace hpx::execution;
+
+    test_set_operations(par);
+    test_set_operations(par_unseq);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,169 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/parallel/util/prefetching.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+constexpr std::size_t num_elements = 100007;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_each(ExPolicy&& policy)
+{
+    std::vector<std::size_t> v(num_elements, 0);
+
+    hpx::for_each(policy, v.begin(), v.end(), [](std::size_t& i) { ++i; });
+    HPX_TEST_EQ(std::accumulate(v.begin(), v.end(), std::size_t(0)),
+        num_elements);
+
+    hpx::experimental::for_loop(
+        policy, std::size_t(0), num_elements, [&](std::size_t i) { v[i] = i; });
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        HPX_TEST_EQ(v[i], i);
+    }
+}
+
+template <typename ExPolicy>
+void test_transform(ExPolicy&& policy)
+{
+    std::vector<std::size_t> src(num_elements);
+    std::iota(src.begin(), src.end(), std::size_t(0));
+    std::vector<std::size_t> dest(num_elements);
+
+    hpx::transform(policy, src.begin(), src.end(), dest.begin(),
+        [](std::size_t i) { return 2 * i; });
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        HPX_TEST_EQ(dest[i], 2 * i);
+    }
+
+    std::vector<std::size_t> copied(num_elements);
+    hpx::copy(policy, src.begin(), src.end(), copied.begin());
+    HPX_TEST(copied == src);
+}
+
+template <typename ExPolicy>
+void test_transform_reduce(ExPolicy&& policy)
+{
+    std::vector<std::uint64_t> v(num_elements);
+    std::iota(v.begin(), v.end(), std::uint64_t(0));
+
+    std::uint64_t const expected =
+        std::uint64_t(num_elements) * (num_elements - 1) / 2;
+
+    HPX_TEST_EQ(hpx::transform_reduce(policy, v.begin(), v.end(),
+                    std::uint64_t(0), std::plus<>(),
+                    [](std::uint64_t i) { return i; }),
+        expected);
+
+    std::vector<std::uint64_t> ones(num_elements, 1);
+    HPX_TEST_EQ(hpx::transform_reduce(
+                    policy, v.begin(), v.end(), ones.begin(), std::uint64_t(0)),
+        expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_explicit_distance()
+{
+    std::vector<std::size_t> data(num_elements);
+
+    test_for_each(ex::with_prefetch(hpx::execution::par, 128, data));
+    test_transform(ex::with_prefetch(hpx::execution::par, 1, data));
+    test_transform_reduce(ex::with_prefetch(hpx::execution::par, 4096, data));
+
+    auto policy = ex::with_prefetch(hpx::execution::par, 32, data);
+    HPX_TEST_EQ(policy.parameters().distance(), static_cast<std::size_t>(32));
+}
+
+void test_derived_distance()
+{
+    std::vector<std::size_t> data(num_elements);
+
+    test_for_each(ex::with_prefetch(hpx::execution::par, data));
+    test_transform(ex::with_prefetch(hpx::execution::par, data, data));
+    test_transform_reduce(ex::with_prefetch(hpx::execution::par, data));
+
+    auto policy = ex::with_prefetch(hpx::execution::par, data);
+    HPX_TEST_EQ(policy.parameters().distance(), static_cast<std::size_t>(0));
+
+    HPX_TEST_NEQ(hpx::parallel::util::prefetching::get_memory_latency(),
+        std::uint64_t(0));
+}
+
+void test_other_parameters()
+{
+    std::vector<std::size_t> data(num_elements);
+
+    // the prefetching parameters are combined with the existing ones
+    auto policy = hpx::execution::par.with(ex::static_chunk_size(1000));
+    test_for_each(ex::with_prefetch(policy, 16, data));
+    test_transform_reduce(ex::with_prefetch(policy, data));
+
+    // strided loops are not prefetched but still execute correctly
+    std::vector<std::size_t> v(num_elements, 0);
+    hpx::experimental::for_loop_strided(
+        ex::with_prefetch(hpx::execution::par, 16, v), std::size_t(0),
+        num_elements, 3, [&](std::size_t i) { v[i] = 1; });
+    HPX_TEST_EQ(std::accumulate(v.begin(), v.end(), std::size_t(0)),
+        (num_elements + 2) / 3);
+}
+
+void test_indirect()
+{
+    // gather-style loop: out[i] = data[indices[i]]
+    std::vector<std::size_t> data(num_elements);
+    std::iota(data.begin(), data.end(), std::size_t(0));
+
+    std::vector<std::size_t> indices(data);
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(42));
+
+    std::vector<std::size_t> out(num_elements);
+    auto const gather = [&](std::size_t i) { out[i] = data[indices[i]]; };
+
+    hpx::experimental::for_loop(
+        ex::with_prefetch(
+            hpx::execution::par, 64, ex::prefetch_indirect(data, indices)),
+        std::size_t(0), num_elements, gather);
+    HPX_TEST(out == indices);
+
+    std::fill(out.begin(), out.end(), 0);
+    hpx::experimental::for_loop(
+        ex::with_prefetch(
+            hpx::execution::par, indices, ex::prefetch_indirect(data, indices)),
+        std::size_t(0), num_elements, gather);
+    HPX_TEST(out == indices);
+}
+
+int hpx_main()
+{
+    test_explicit_distance();
+    test_derived_distance();
+    test_other_parameters();
+    test_indirect();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
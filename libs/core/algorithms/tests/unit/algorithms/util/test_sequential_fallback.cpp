@@ -0,0 +1,139 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/parallel/util/detail/sequential_fallback.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace util = hpx::parallel::util;
+
+// the maximal threshold for invocations needing 10ns per element
+constexpr std::size_t max_threshold =
+    static_cast<std::size_t>(util::detail::sequential_fallback_max_time / 10);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_learned_threshold()
+{
+    util::detail::sequential_fallback_data data;
+
+    // the first small invocation is run sequentially to measure the time
+    // needed per element, large invocations are never probed
+    HPX_TEST(data.run_sequentially(10));
+    HPX_TEST(!data.run_sequentially(
+        util::detail::sequential_fallback_probe_size + 1));
+    HPX_TEST_EQ(data.threshold(), static_cast<std::size_t>(0));
+
+    // 10ns per element
+    data.update_sequential(10, 100);
+    HPX_TEST(!data.run_sequentially(10));
+
+    // a parallel invocation on 4 cores has an overhead of ~50us, which
+    // results in a threshold of 50us / (10ns * (1 - 1/4)) ~ 6600 elements
+    data.update_parallel(10, 4, 50000);
+    HPX_TEST(data.run_sequentially(5000));
+    HPX_TEST(!data.run_sequentially(10000));
+
+    // the threshold never exceeds the number of elements which can be
+    // processed sequentially in sequential_fallback_max_time
+    data.update_parallel(10, 4, 10000000);
+    HPX_TEST(data.threshold() <= max_threshold);
+}
+
+void test_single_core()
+{
+    util::detail::sequential_fallback_data data;
+
+    // running on a single core never pays off
+    data.update_sequential(100, 1000);
+    data.update_parallel(100, 1, 1000);
+    HPX_TEST_EQ(data.threshold(), max_threshold);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_small_inputs()
+{
+    std::vector<int> v(64);
+    std::iota(v.begin(), v.end(), 0);
+
+    std::size_t on_calling_thread = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        auto const id = hpx::this_thread::get_id();
+
+        std::vector<hpx::thread::id> ids(v.size());
+        hpx::for_each(hpx::execution::par, v.begin(), v.end(),
+            [&](int j) { ids[j] = hpx::this_thread::get_id(); });
+
+        if (std::all_of(ids.begin(), ids.end(),
+                [&](hpx::thread::id const& t) { return t == id; }))
+        {
+            ++on_calling_thread;
+        }
+
+        // the results are the same, regardless of how the algorithm was run
+        HPX_TEST_EQ(hpx::reduce(hpx::execution::par, v.begin(), v.end(), 0),
+            63 * 64 / 2);
+    }
+
+#if defined(HPX_ALGORITHMS_HAVE_SEQUENTIAL_FALLBACK)
+    // at least the first invocation probes the sequential execution
+    HPX_TEST_NEQ(on_calling_thread, static_cast<std::size_t>(0));
+#endif
+}
+
+void test_exceptions()
+{
+    std::vector<int> v(16);
+
+    // exceptions thrown by a sequential invocation are reported the same
+    // way as for parallel invocations
+    for (int i = 0; i != 10; ++i)
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::for_each(hpx::execution::par, v.begin(), v.end(),
+                [](int) { throw std::runtime_error("test"); });
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_NEQ(e.size(), static_cast<std::size_t>(0));
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    test_learned_threshold();
+    test_single_core();
+    test_small_inputs();
+    test_exceptions();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
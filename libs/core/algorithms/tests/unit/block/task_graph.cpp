@@ -0,0 +1,155 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/experimental/task_graph.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// a diamond shaped graph computing ((x + 1) + (x * 2)) for every replay
+void task_graph_test_diamond()
+{
+    int x = 0, a = 0, b = 0, result = 0;
+
+    auto g = hpx::experimental::task_graph::record([&](auto& g) {
+        auto first = g.add([&] { ++x; });
+        auto left = g.add([&] { a = x + 1; }, first);
+        auto right = g.add([&] { b = x * 2; }, first);
+        g.add([&] { result = a + b; }, left, right);
+    });
+    HPX_TEST_EQ(g.size(), static_cast<std::size_t>(4));
+
+    for (int i = 1; i != 100; ++i)
+    {
+        g.replay().get();
+        HPX_TEST_EQ(result, (i + 1) + (i * 2));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a chain of stages each of which depends on all tasks of the previous stage
+template <typename Executor>
+void task_graph_test_stages(Executor&& exec)
+{
+    constexpr int num_stages = 10;
+    constexpr int stage_size = 16;
+
+    std::vector<std::atomic<int>> counts(num_stages);
+    std::atomic<int> errors(0);
+
+    hpx::experimental::task_graph g;
+    std::vector<hpx::experimental::task_graph::node> previous;
+    for (int stage = 0; stage != num_stages; ++stage)
+    {
+        std::vector<hpx::experimental::task_graph::node> current;
+        for (int i = 0; i != stage_size; ++i)
+        {
+            current.push_back(g.add(
+                [&, stage] {
+                    // all tasks of the previous stage have completed
+                    if (stage != 0 &&
+                        counts[stage - 1].load() % stage_size != 0)
+                    {
+                        ++errors;
+                    }
+                    ++counts[stage];
+                },
+                previous));
+        }
+        previous = std::move(current);
+    }
+
+    for (int i = 1; i != 10; ++i)
+    {
+        g.replay(exec).get();
+        for (auto const& count : counts)
+        {
+            HPX_TEST_EQ(count.load(), i * stage_size);
+        }
+    }
+    HPX_TEST_EQ(errors.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void task_graph_test_exceptions()
+{
+    hpx::experimental::task_graph g;
+
+    int skipped = 0;
+    auto n = g.add([] { throw std::runtime_error("test"); });
+    g.add([&] { ++skipped; }, n);
+
+    // the graph can be replayed after it has failed
+    for (int i = 0; i != 3; ++i)
+    {
+        bool caught_exception = false;
+        try
+        {
+            g.replay().get();
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+    HPX_TEST_EQ(skipped, 0);
+
+    // tasks can depend only on existing tasks added before them
+    bool caught_exception = false;
+    try
+    {
+        g.add_dependency(0, 1);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // an empty graph is ready immediately
+    g.clear();
+    HPX_TEST_EQ(g.size(), static_cast<std::size_t>(0));
+    g.replay().get();
+}
+
+int hpx_main()
+{
+    task_graph_test_diamond();
+    task_graph_test_stages(hpx::execution::parallel_executor{});
+    task_graph_test_stages(hpx::execution::sequenced_executor{});
+    task_graph_test_exceptions();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,133 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if(ExPolicy&& policy, IteratorTag, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<> dis(-1000, 1000);
+
+    std::vector<int> c(size);
+    std::vector<int> d(size, -1);
+    std::vector<int> e(size, -1);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+    // the predicate is invoked for vector packs of elements
+    auto result = hpx::copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d),
+        [](auto const& i) { return i > 0; });
+    auto solution = std::copy_if(std::begin(c), std::end(c), std::begin(e),
+        [](int i) { return i > 0; });
+
+    HPX_TEST(result == std::begin(d) + (solution - std::begin(e)));
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if_async(ExPolicy&& policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size(), -1);
+    std::vector<int> e(c.size(), -1);
+    std::iota(std::begin(c), std::end(c), -5003);
+
+    auto f = hpx::copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d),
+        [](auto const& i) { return (i & 1) == 0; });
+    f.wait();
+
+    std::copy_if(std::begin(c), std::end(c), std::begin(e),
+        [](int i) { return (i & 1) == 0; });
+
+    HPX_TEST(d == e);
+}
+
+template <typename IteratorTag>
+void test_copy_if_datapar()
+{
+    using namespace hpx::execution;
+
+    // cover partial vector packs at the ends of the partitions
+    for (std::size_t size : {0, 1, 7, 33, 1000, 10007, 100003})
+    {
+        test_copy_if(simd, IteratorTag(), size);
+        test_copy_if(par_simd, IteratorTag(), size);
+    }
+
+    test_copy_if_async(simd(task), IteratorTag());
+    test_copy_if_async(par_simd(task), IteratorTag());
+}
+
+void copy_if_test()
+{
+    test_copy_if_datapar<std::random_access_iterator_tag>();
+    test_copy_if_datapar<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    copy_if_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,118 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// the bin function is invoked with whole vector packs of elements, sequences
+// of all sizes around the size of the vector packs are tested
+template <typename ExPolicy>
+void test_histogram_datapar(ExPolicy&& policy, std::size_t num_bins)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<int> dist(
+        -2, static_cast<int>(num_bins) + 2);
+
+    auto const bin = [](auto v) { return v; };
+
+    for (std::size_t size : {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1001,
+             100003})
+    {
+        std::vector<int> c(size);
+        std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+
+        std::vector<std::size_t> expected(num_bins);
+        for (int const v : c)
+        {
+            if (v >= 0 && static_cast<std::size_t>(v) < num_bins)
+            {
+                ++expected[v];
+            }
+        }
+
+        std::vector<std::size_t> bins(num_bins);
+        hpx::experimental::histogram(policy, c.begin(), c.end(), bins, bin);
+        HPX_TEST(bins == expected);
+    }
+}
+
+void test_histogram()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t num_bins : {1, 4, 16, 17, 1000})
+    {
+        test_histogram_datapar(simd, num_bins);
+        test_histogram_datapar(par_simd, num_bins);
+    }
+
+    // a bin function accepting single elements only uses the scalar path
+    std::vector<double> c(1000);
+    std::iota(c.begin(), c.end(), 0.0);
+
+    std::vector<std::size_t> bins(10);
+    hpx::experimental::histogram(simd, c.begin(), c.end(), bins,
+        [](double v) { return static_cast<int>(v / 100); });
+    HPX_TEST(bins == std::vector<std::size_t>(10, 100));
+
+    // asynchronous execution
+    bins.assign(10, 0);
+    hpx::experimental::histogram(par_simd(task), c.begin(), c.end(), bins,
+        [](double v) { return static_cast<int>(v / 100); })
+        .get();
+    HPX_TEST(bins == std::vector<std::size_t>(10, 100));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_histogram();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
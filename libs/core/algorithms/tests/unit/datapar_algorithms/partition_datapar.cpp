@@ -0,0 +1,81 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../algorithms/partition_tests.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_partition_datapar()
+{
+    using namespace hpx::execution;
+
+    int rand_base = _gen();
+
+    // the predicates are invoked for vector packs of elements
+    auto less = [rand_base](auto const& n) { return n < rand_base; };
+    auto greater = [rand_base](auto const& n) { return n > rand_base; };
+
+    test_partition(simd, IteratorTag(), int(), less, rand_base);
+    test_partition(par_simd, IteratorTag(), int(), greater, rand_base);
+
+    test_partition_async(simd(task), IteratorTag(), int(), less, rand_base);
+    test_partition_async(
+        par_simd(task), IteratorTag(), int(), greater, rand_base);
+
+    test_partition_heavy(simd, IteratorTag(), int(), less, rand_base);
+    test_partition_heavy(par_simd, IteratorTag(), int(), greater, rand_base);
+}
+
+void partition_test()
+{
+    test_partition_datapar<std::random_access_iterator_tag>();
+    test_partition_datapar<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    _gen.seed(seed);
+
+    partition_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_SORT_TEST_SIZE 50000L
+#define HPX_SORT_TEST_SIZE_STRINGS 10000L
+#endif
+
+#include "../algorithms/sort_tests.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// sequences of all sizes around the size of the sorting networks and
+// sequences containing many duplicates
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_datapar(ExPolicy&& policy, T, Compare comp)
+{
+    std::mt19937 gen(std::rand());
+
+    for (std::size_t size = 0; size != 200; ++size)
+    {
+        for (int distinct : {1, 2, 7, 1000})
+        {
+            std::uniform_int_distribution<int> dist(0, distinct - 1);
+
+            std::vector<T> c(size);
+            for (auto& v : c)
+            {
+                v = static_cast<T>(dist(gen));
+            }
+
+            std::vector<T> expected = c;
+            std::sort(expected.begin(), expected.end(), comp);
+
+            hpx::sort(policy, c.begin(), c.end(), comp);
+            HPX_TEST(c == expected);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void test_sort1()
+{
+    using namespace hpx::execution;
+
+    // default comparison operator (std::less)
+    test_sort1(simd, int());
+    test_sort1(par_simd, int());
+    test_sort1(simd, double());
+    test_sort1(par_simd, double());
+
+    test_sort1_comp(simd, std::int64_t(), std::greater<>());
+    test_sort1_comp(par_simd, float(), std::greater<>());
+
+    // user supplied comparison operator, not vectorized
+    test_sort1_comp(simd, double(), std::greater<double>());
+    test_sort1_comp(par_simd, std::string(), std::greater<std::string>());
+
+    // Async execution
+    test_sort1_async(simd(task), int());
+    test_sort1_async(par_simd(task), float(), std::less<>());
+}
+
+void test_sort2()
+{
+    using namespace hpx::execution;
+
+    // already sorted sequences
+    test_sort2(simd, int());
+    test_sort2(par_simd, double());
+    test_sort2_comp(par_simd, int(), std::greater<>());
+
+    test_sort2_async(par_simd(task), float());
+}
+
+void test_sort3()
+{
+    using namespace hpx::execution;
+
+    test_sort_datapar(simd, int(), std::less<>());
+    test_sort_datapar(simd, double(), std::greater<>());
+    test_sort_datapar(par_simd, std::int16_t(), std::less<>());
+    test_sort_datapar(par_simd, float(), std::greater<>());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_sort1();
+    test_sort2();
+    test_sort3();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,84 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::util {
+
+    /// The HPX subsystems the allocated memory is attributed to
+    enum class memory_category : std::uint8_t
+    {
+        stacks = 0,         ///< the stacks of HPX threads
+        shared_states,      ///< the shared states of futures
+        parcel_buffers,     ///< the serialization buffers of outgoing parcels
+        component_heaps,    ///< the heaps of component instances
+    };
+
+    inline constexpr std::size_t num_memory_categories = 4;
+
+    /// Returns the name of the given memory category
+    HPX_CORE_EXPORT char const* get_memory_category_name(
+        memory_category category) noexcept;
+
+    /// The memory currently allocated for a memory category
+    struct memory_statistics
+    {
+        std::int64_t bytes = 0;           ///< currently allocated bytes
+        std::uint64_t allocations = 0;    ///< overall number of allocations
+    };
+
+    /// Returns the memory currently allocated for the given category. All
+    /// values are zero if HPX_ALLOCATOR_SUPPORT_WITH_MEMORY_STATISTICS is
+    /// not enabled.
+    HPX_CORE_EXPORT memory_statistics get_memory_statistics(
+        memory_category category) noexcept;
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+    namespace detail {
+
+        struct memory_statistics_data
+        {
+            std::atomic<std::int64_t> bytes{0};
+            std::atomic<std::uint64_t> allocations{0};
+        };
+
+        HPX_CORE_EXPORT memory_statistics_data& get_memory_statistics_data(
+            memory_category category) noexcept;
+    }    // namespace detail
+
+    /// Attribute the allocation of the given number of bytes to the given
+    /// memory category
+    inline void record_allocation(
+        memory_category category, std::size_t bytes) noexcept
+    {
+        auto& data = detail::get_memory_statistics_data(category);
+        data.bytes.fetch_add(
+            static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+        data.allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Attribute the deallocation of the given number of bytes to the given
+    /// memory category
+    inline void record_deallocation(
+        memory_category category, std::size_t bytes) noexcept
+    {
+        detail::get_memory_statistics_data(category).bytes.fetch_sub(
+            static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+    }
+#else
+    constexpr void record_allocation(memory_category, std::size_t) noexcept {}
+    constexpr void record_deallocation(memory_category, std::size_t) noexcept
+    {
+    }
+#endif
+}    // namespace hpx::util
@@ -0,0 +1,370 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file numa_caching_allocator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::util {
+
+    /// Statistics of all \a numa_caching_allocator instances. The numbers are
+    /// collected per thread and are periodically (and on thread exit) added
+    /// to the totals, they may therefore lag behind slightly.
+    struct numa_caching_allocator_statistics
+    {
+        /// The number of allocations served from a cache
+        std::uint64_t hits = 0;
+
+        /// The number of allocations forwarded to the underlying allocator
+        std::uint64_t misses = 0;
+
+        /// The number of blocks deallocated on a thread belonging to a NUMA
+        /// domain different from the domain of the allocating thread
+        std::uint64_t remote_frees = 0;
+
+        /// The number of remotely freed blocks which were taken back by a
+        /// thread of the owning NUMA domain
+        std::uint64_t reclaimed = 0;
+    };
+
+    /// Returns the statistics of all \a numa_caching_allocator instances,
+    /// optionally resetting them.
+    HPX_CORE_EXPORT numa_caching_allocator_statistics
+    get_numa_caching_allocator_statistics(bool reset = false) noexcept;
+
+    namespace detail {
+
+        /// Set the NUMA domain the calling thread belongs to. This is called
+        /// by the worker threads of the thread pools once their affinity has
+        /// been set. All other threads are considered to belong to domain 0.
+        HPX_CORE_EXPORT void set_thread_numa_domain(
+            std::size_t domain) noexcept;
+        HPX_CORE_EXPORT std::size_t get_thread_numa_domain() noexcept;
+
+        HPX_CORE_EXPORT void add_numa_caching_allocator_statistics(
+            numa_caching_allocator_statistics const& stats) noexcept;
+    }    // namespace detail
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
+    !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
+        defined(HPX_HAVE_HIP))
+    ///////////////////////////////////////////////////////////////////////////
+    /// A caching allocator for single objects which keeps its caches per
+    /// thread, but tags each block with the NUMA domain of the thread that
+    /// allocated it. Blocks deallocated on a thread of the same domain are
+    /// put into the cache of that thread. Blocks deallocated on a thread of a
+    /// different domain (e.g. after the owning task was stolen) are pushed
+    /// onto a lock-free return list of the owning domain, from where they
+    /// are taken back by the threads of that domain once their own cache is
+    /// exhausted. Allocations of more than one object are forwarded to the
+    /// underlying allocator.
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    struct numa_caching_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = typename traits::value_type;
+        using pointer = typename traits::pointer;
+        using const_pointer = typename traits::const_pointer;
+        using size_type = typename traits::size_type;
+        using difference_type = typename traits::difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = numa_caching_allocator<U,
+                typename traits::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = typename traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            typename traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap =
+            typename traits::propagate_on_container_swap;
+
+    private:
+        static constexpr std::size_t max_domains =
+            HPX_HAVE_MAX_NUMA_DOMAIN_COUNT;
+
+        // the maximal number of blocks kept in the cache of a thread
+        static constexpr std::size_t max_cached_blocks = 256;
+
+        // the number of events after which the statistics of a thread are
+        // added to the totals
+        static constexpr std::uint64_t statistics_interval = 1024;
+
+        // The storage for the object comes first, the block can be converted
+        // from and to a pointer to the object. While the block is unused, the
+        // storage holds the pointer to the next free block.
+        struct block
+        {
+            alignas((std::max)(alignof(value_type), alignof(block*)))
+                unsigned char storage[(std::max)(
+                    sizeof(value_type), sizeof(block*))];
+            std::size_t domain;
+        };
+
+        static void set_next(block* b, block* next) noexcept
+        {
+            ::new (static_cast<void*>(b->storage)) block*(next);
+        }
+
+        static block* get_next(block* b) noexcept
+        {
+            return *std::launder(reinterpret_cast<block**>(b->storage));
+        }
+
+        using block_allocator =
+            typename traits::template rebind_alloc<block>;
+        using block_traits = std::allocator_traits<block_allocator>;
+
+        struct alignas(64) return_list
+        {
+            std::atomic<block*> head{nullptr};
+        };
+
+        // Blocks may be freed remotely during static destruction, the return
+        // lists are intentionally never destroyed.
+        static return_list* return_lists()
+        {
+            static return_list* lists = new return_list[max_domains];
+            return lists;
+        }
+
+        struct allocated_cache
+        {
+            explicit allocated_cache(Allocator const& a) noexcept(
+                noexcept(std::is_nothrow_copy_constructible_v<Allocator>))
+              : alloc(a)
+              , domain(detail::get_thread_numa_domain() % max_domains)
+            {
+                static_assert(std::is_standard_layout_v<block>);
+            }
+
+            allocated_cache(allocated_cache const&) = delete;
+            allocated_cache(allocated_cache&&) = delete;
+            allocated_cache& operator=(allocated_cache const&) = delete;
+            allocated_cache& operator=(allocated_cache&&) = delete;
+
+            ~allocated_cache()
+            {
+                while (head != nullptr)
+                {
+                    block* b = head;
+                    head = get_next(b);
+                    block_traits::deallocate(alloc, b, 1);
+                }
+                detail::add_numa_caching_allocator_statistics(stats);
+            }
+
+            block* allocate()
+            {
+                if (head == nullptr)
+                {
+                    reclaim();
+                }
+
+                if (head != nullptr)
+                {
+                    block* b = head;
+                    head = get_next(b);
+                    --count;
+                    record(stats.hits);
+                    return b;
+                }
+
+                block* b = block_traits::allocate(alloc, 1);
+                if (b == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                ::new (static_cast<void*>(b)) block;
+                b->domain = domain;
+
+                record(stats.misses);
+                return b;
+            }
+
+            void deallocate(block* b) noexcept
+            {
+                if (b->domain != domain)
+                {
+                    // return the block to its owning domain
+                    std::atomic<block*>& list = return_lists()[b->domain].head;
+                    block* next = list.load(std::memory_order_relaxed);
+                    do
+                    {
+                        set_next(b, next);
+                    } while (!list.compare_exchange_weak(next, b,
+                        std::memory_order_release, std::memory_order_relaxed));
+
+                    record(stats.remote_frees);
+                    return;
+                }
+
+                if (count == max_cached_blocks)
+                {
+                    block_traits::deallocate(alloc, b, 1);
+                    return;
+                }
+
+                set_next(b, head);
+                head = b;
+                ++count;
+            }
+
+        private:
+            // take back all blocks of this domain which were freed remotely,
+            // the list is only ever taken as a whole, which avoids ABA issues
+            void reclaim() noexcept
+            {
+                block* b = return_lists()[domain].head.exchange(
+                    nullptr, std::memory_order_acquire);
+                while (b != nullptr)
+                {
+                    block* next = get_next(b);
+                    if (count == max_cached_blocks)
+                    {
+                        block_traits::deallocate(alloc, b, 1);
+                    }
+                    else
+                    {
+                        set_next(b, head);
+                        head = b;
+                        ++count;
+                        record(stats.reclaimed);
+                    }
+                    b = next;
+                }
+            }
+
+            void record(std::uint64_t& counter) noexcept
+            {
+                ++counter;
+                if (++events == statistics_interval)
+                {
+                    detail::add_numa_caching_allocator_statistics(stats);
+                    stats = numa_caching_allocator_statistics();
+                    events = 0;
+                }
+            }
+
+            HPX_NO_UNIQUE_ADDRESS block_allocator alloc;
+            std::size_t const domain;
+            block* head = nullptr;
+            std::size_t count = 0;
+            numa_caching_allocator_statistics stats;
+            std::uint64_t events = 0;
+        };
+
+        allocated_cache& cache()
+        {
+            thread_local allocated_cache allocated_data(alloc);
+            return allocated_data;
+        }
+
+    public:
+        explicit numa_caching_allocator(Allocator const& alloc =
+                                            Allocator{}) noexcept(noexcept(std::
+                is_nothrow_copy_constructible_v<Allocator>))
+          : alloc(alloc)
+        {
+        }
+
+        template <typename U, typename Alloc>
+        explicit numa_caching_allocator(
+            numa_caching_allocator<U, Alloc> const& rhs) noexcept(noexcept(std::
+                is_nothrow_copy_constructible_v<Alloc>))
+          : alloc(rhs.alloc)
+        {
+        }
+
+        [[nodiscard]] static constexpr pointer address(value_type& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] static constexpr const_pointer address(
+            value_type const& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+            if (n != 1)
+            {
+                return traits::allocate(alloc, n);
+            }
+            return reinterpret_cast<pointer>(cache().allocate()->storage);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (n != 1)
+            {
+                traits::deallocate(alloc, p, n);
+                return;
+            }
+            cache().deallocate(reinterpret_cast<block*>(p));
+        }
+
+        [[nodiscard]] constexpr size_type max_size() noexcept
+        {
+            return traits::max_size(alloc);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            traits::construct(alloc, p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            traits::destroy(alloc, p);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            numa_caching_allocator const& lhs,
+            numa_caching_allocator const& rhs) noexcept
+        {
+            return lhs.alloc == rhs.alloc;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            numa_caching_allocator const& lhs,
+            numa_caching_allocator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+#else
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    using numa_caching_allocator = Allocator;
+#endif
+}    // namespace hpx::util
@@ -8,6 +8,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/allocator_support/memory_statistics.hpp>
+#include <hpx/allocator_support/numa_caching_allocator.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -18,7 +20,12 @@
 
 namespace hpx::util {
 
-#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_NUMA_CACHING)
+    // all allocations going through the caching allocator use the NUMA-aware
+    // caches instead
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    using thread_local_caching_allocator = numa_caching_allocator<T, Allocator>;
+#elif defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                           \
     !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
         defined(HPX_HAVE_HIP))
     ///////////////////////////////////////////////////////////////////////////
@@ -158,12 +165,17 @@ namespace hpx::util {
             {
                 throw std::bad_array_new_length();
             }
-            return cache().allocate(n);
+
+            pointer p = cache().allocate(n);
+            record_allocation(memory_category::shared_states, n * sizeof(T));
+            return p;
         }
 
         void deallocate(pointer p, size_type n) noexcept
         {
             cache().deallocate(p, n);
+            record_deallocation(
+                memory_category::shared_states, n * sizeof(T));
         }
 
         [[nodiscard]] constexpr size_type max_size() noexcept
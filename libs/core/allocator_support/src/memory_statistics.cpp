@@ -0,0 +1,62 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/memory_statistics.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::util {
+
+    char const* get_memory_category_name(memory_category category) noexcept
+    {
+        switch (category)
+        {
+        case memory_category::stacks:
+            return "stacks";
+        case memory_category::shared_states:
+            return "shared-states";
+        case memory_category::parcel_buffers:
+            return "parcel-buffers";
+        case memory_category::component_heaps:
+            return "component-heaps";
+        default:
+            break;
+        }
+        return "unknown";
+    }
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+    namespace detail {
+
+        // Memory may be released during static destruction, the statistics
+        // are intentionally never destroyed.
+        memory_statistics_data& get_memory_statistics_data(
+            memory_category category) noexcept
+        {
+            static memory_statistics_data* data =
+                new memory_statistics_data[num_memory_categories];
+            return data[static_cast<std::size_t>(category)];
+        }
+    }    // namespace detail
+
+    memory_statistics get_memory_statistics(memory_category category) noexcept
+    {
+        auto const& data = detail::get_memory_statistics_data(category);
+
+        memory_statistics result;
+        result.bytes = data.bytes.load(std::memory_order_relaxed);
+        result.allocations = data.allocations.load(std::memory_order_relaxed);
+        return result;
+    }
+#else
+    memory_statistics get_memory_statistics(memory_category) noexcept
+    {
+        return {};
+    }
+#endif
+}    // namespace hpx::util
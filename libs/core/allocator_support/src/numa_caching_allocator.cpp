@@ -0,0 +1,80 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/numa_caching_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::util {
+
+    namespace {
+
+        struct statistics_totals
+        {
+            std::atomic<std::uint64_t> hits{0};
+            std::atomic<std::uint64_t> misses{0};
+            std::atomic<std::uint64_t> remote_frees{0};
+            std::atomic<std::uint64_t> reclaimed{0};
+        };
+
+        // Caches may be flushed during static destruction, the totals are
+        // intentionally never destroyed.
+        statistics_totals& get_statistics_totals() noexcept
+        {
+            static statistics_totals* totals = new statistics_totals;
+            return *totals;
+        }
+
+        std::uint64_t read(std::atomic<std::uint64_t>& value, bool reset)
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        thread_local std::size_t thread_numa_domain = 0;
+    }    // namespace
+
+    numa_caching_allocator_statistics get_numa_caching_allocator_statistics(
+        bool reset) noexcept
+    {
+        statistics_totals& totals = get_statistics_totals();
+
+        numa_caching_allocator_statistics result;
+        result.hits = read(totals.hits, reset);
+        result.misses = read(totals.misses, reset);
+        result.remote_frees = read(totals.remote_frees, reset);
+        result.reclaimed = read(totals.reclaimed, reset);
+        return result;
+    }
+
+    namespace detail {
+
+        void set_thread_numa_domain(std::size_t domain) noexcept
+        {
+            thread_numa_domain = domain;
+        }
+
+        std::size_t get_thread_numa_domain() noexcept
+        {
+            return thread_numa_domain;
+        }
+
+        void add_numa_caching_allocator_statistics(
+            numa_caching_allocator_statistics const& stats) noexcept
+        {
+            statistics_totals& totals = get_statistics_totals();
+            totals.hits.fetch_add(stats.hits, std::memory_order_relaxed);
+            totals.misses.fetch_add(stats.misses, std::memory_order_relaxed);
+            totals.remote_frees.fetch_add(
+                stats.remote_frees, std::memory_order_relaxed);
+            totals.reclaimed.fetch_add(
+                stats.reclaimed, std::memory_order_relaxed);
+        }
+    }    // namespace detail
+}    // namespace hpx::util
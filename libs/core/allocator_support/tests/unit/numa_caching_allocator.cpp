@@ -0,0 +1,130 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/numa_caching_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct object
+{
+    explicit object(std::size_t value) noexcept
+      : value(value)
+    {
+    }
+
+    std::size_t value;
+    double padding[3] = {};
+};
+
+using allocator_type = hpx::util::numa_caching_allocator<object>;
+using traits = std::allocator_traits<allocator_type>;
+
+constexpr std::size_t count = 100;
+
+std::vector<object*> allocate_objects(std::size_t domain)
+{
+    hpx::util::detail::set_thread_numa_domain(domain);
+
+    allocator_type alloc;
+    std::vector<object*> objects;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        object* p = traits::allocate(alloc, 1);
+        traits::construct(alloc, p, i);
+        objects.push_back(p);
+    }
+    return objects;
+}
+
+void deallocate_objects(std::size_t domain, std::vector<object*>& objects)
+{
+    hpx::util::detail::set_thread_numa_domain(domain);
+
+    allocator_type alloc;
+    for (std::size_t i = 0; i != objects.size(); ++i)
+    {
+        HPX_TEST_EQ(objects[i]->value, i);
+        traits::destroy(alloc, objects[i]);
+        traits::deallocate(alloc, objects[i], 1);
+    }
+    objects.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_local_reuse()
+{
+    hpx::util::get_numa_caching_allocator_statistics(true);
+
+    // the statistics of a thread are added to the totals on thread exit
+    std::thread([] {
+        std::vector<object*> objects = allocate_objects(0);
+        deallocate_objects(0, objects);
+
+        objects = allocate_objects(0);
+        deallocate_objects(0, objects);
+    }).join();
+
+    auto const stats = hpx::util::get_numa_caching_allocator_statistics(true);
+    HPX_TEST_EQ(stats.misses, std::uint64_t(count));
+    HPX_TEST_EQ(stats.hits, std::uint64_t(count));
+    HPX_TEST_EQ(stats.remote_frees, std::uint64_t(0));
+}
+
+void test_remote_free()
+{
+    if (HPX_HAVE_MAX_NUMA_DOMAIN_COUNT < 2)
+    {
+        return;
+    }
+
+    hpx::util::get_numa_caching_allocator_statistics(true);
+
+    std::vector<object*> objects;
+    std::thread([&] { objects = allocate_objects(0); }).join();
+
+    // blocks freed on a thread of another domain go back to their owner
+    std::thread([&] { deallocate_objects(1, objects); }).join();
+
+    auto stats = hpx::util::get_numa_caching_allocator_statistics(true);
+    HPX_TEST_EQ(stats.misses, std::uint64_t(count));
+    HPX_TEST_EQ(stats.remote_frees, std::uint64_t(count));
+
+    // a thread of the owning domain reuses the returned blocks
+    std::thread([&] {
+        objects = allocate_objects(0);
+        deallocate_objects(0, objects);
+    }).join();
+
+    stats = hpx::util::get_numa_caching_allocator_statistics(true);
+    HPX_TEST_EQ(stats.reclaimed, std::uint64_t(count));
+    HPX_TEST_EQ(stats.hits, std::uint64_t(count));
+    HPX_TEST_EQ(stats.misses, std::uint64_t(0));
+}
+
+void test_arrays()
+{
+    // allocations of more than one object bypass the caches
+    hpx::util::numa_caching_allocator<int> alloc;
+    std::vector<int, hpx::util::numa_caching_allocator<int>> v(1000, 42, alloc);
+    v.resize(10000, 43);
+    HPX_TEST_EQ(v[999], 42);
+    HPX_TEST_EQ(v[1000], 43);
+}
+
+int main()
+{
+    test_local_reuse();
+    test_remote_free();
+    test_arrays();
+
+    return hpx::util::report_errors();
+}
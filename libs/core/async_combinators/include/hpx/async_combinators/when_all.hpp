@@ -124,11 +124,59 @@ namespace hpx {
     hpx::future<Container> when_all_n(InputIter begin, std::size_t count);
 }    // namespace hpx
 
+namespace hpx::experimental {
+    /// \copybrief hpx::when_all(InputIter first, InputIter last)
+    ///
+    /// The futures are held in a small vector storing up to \a N futures
+    /// without allocating memory, which avoids allocations when joining few
+    /// futures.
+    ///
+    /// \tparam N       The number of futures stored inline in the returned
+    ///                 container, defaults to HPX_WHEN_ALL_INLINE_SIZE.
+    ///
+    /// \param first    [in] The iterator pointing to the first element of a
+    ///                 sequence of \a future or \a shared_future objects for
+    ///                 which \a when_all_inline should wait.
+    /// \param last     [in] The iterator pointing to the last element of a
+    ///                 sequence of \a future or \a shared_future objects for
+    ///                 which \a when_all_inline should wait.
+    ///
+    /// \return   Returns a future holding the same list of futures as has
+    ///           been passed to \a when_all_inline.
+    ///
+    /// \note To reuse a container of futures for many joins without
+    ///       allocating, pass it as an rvalue to \a hpx::when_all. The
+    ///       returned future holds the same container.
+    template <std::size_t N = HPX_WHEN_ALL_INLINE_SIZE, typename InputIter>
+    hpx::future<small_vector<
+        future<typename std::iterator_traits<InputIter>::value_type>, N>>
+    when_all_inline(InputIter first, InputIter last);
+
+    /// \copybrief when_all_inline(InputIter first, InputIter last)
+    ///
+    /// \tparam N       The number of futures stored inline in the returned
+    ///                 container, defaults to HPX_WHEN_ALL_INLINE_SIZE.
+    ///
+    /// \param begin    [in] The iterator pointing to the first element of a
+    ///                 sequence of \a future or \a shared_future objects for
+    ///                 which \a when_all_inline should wait.
+    /// \param count    [in] The number of elements in the sequence starting at
+    ///                 \a first.
+    ///
+    /// \return   Returns a future holding the same list of futures as has
+    ///           been passed to \a when_all_inline.
+    template <std::size_t N = HPX_WHEN_ALL_INLINE_SIZE, typename InputIter>
+    hpx::future<small_vector<
+        future<typename std::iterator_traits<InputIter>::value_type>, N>>
+    when_all_inline(InputIter begin, std::size_t count);
+}    // namespace hpx::experimental
+
 #else    // DOXYGEN
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/tag_invoke.hpp>
 #include <hpx/futures/detail/future_data.hpp>
@@ -290,6 +338,44 @@ namespace hpx {
     } when_all_n{};
 }    // namespace hpx
 
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    struct when_all_inline_t final : hpx::functional::tag<when_all_inline_t<N>>
+    {
+    private:
+        template <typename Iterator>
+        using container_type = hpx::detail::small_vector<
+            hpx::lcos::detail::future_iterator_traits_t<Iterator>, N>;
+
+        template <typename Iterator,
+            typename Enable =
+                std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
+        friend decltype(auto) tag_invoke(
+            when_all_inline_t, Iterator begin, Iterator end)
+        {
+            return hpx::lcos::detail::when_all_impl(
+                hpx::lcos::detail::acquire_future_iterators<Iterator,
+                    container_type<Iterator>>(begin, end));
+        }
+
+        template <typename Iterator,
+            typename Enable =
+                std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
+        friend decltype(auto) tag_invoke(
+            when_all_inline_t, Iterator begin, std::size_t count)
+        {
+            return hpx::lcos::detail::when_all_impl(
+                hpx::lcos::detail::acquire_future_n<Iterator,
+                    container_type<Iterator>>(begin, count));
+        }
+    };
+
+    template <std::size_t N = HPX_WHEN_ALL_INLINE_SIZE>
+    inline constexpr when_all_inline_t<N> when_all_inline{};
+}    // namespace hpx::experimental
+
 namespace hpx::lcos {
 
     template <typename... Args>
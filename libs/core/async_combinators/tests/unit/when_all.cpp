@@ -12,7 +12,9 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <string>
@@ -69,6 +71,61 @@ void test_when_all_from_list_iterators()
         HPX_TEST(r.is_ready());
 }
 
+void test_when_all_from_moved_list()
+{
+    unsigned const count = 10;
+    std::vector<hpx::future<int>> futures;
+    for (unsigned j = 0; j < count; ++j)
+    {
+        hpx::lcos::local::futures_factory<int()> task(make_int_slowly);
+        futures.push_back(task.get_future());
+        task.post();
+    }
+
+    // the futures are returned in the container passed to when_all
+    hpx::future<int> const* data = futures.data();
+
+    auto r = hpx::when_all(std::move(futures));
+    auto result = r.get();
+
+    HPX_TEST_EQ(result.size(), static_cast<std::size_t>(count));
+    HPX_TEST(result.data() == data);
+    for (const auto& r : result)
+        HPX_TEST(r.is_ready());
+}
+
+void test_when_all_inline()
+{
+    unsigned const count = 3;
+    std::list<hpx::future<int>> futures;
+    for (unsigned j = 0; j < 2 * count; ++j)
+    {
+        hpx::lcos::local::futures_factory<int()> task(make_int_slowly);
+        futures.push_back(task.get_future());
+        task.post();
+    }
+
+    auto r1 = hpx::experimental::when_all_inline<count>(
+        futures.begin(), std::next(futures.begin(), count));
+    auto result1 = r1.get();
+
+    HPX_TEST_EQ(result1.size(), static_cast<std::size_t>(count));
+    for (const auto& r : result1)
+        HPX_TEST(r.is_ready());
+
+    // more futures than can be stored inline
+    auto r2 = hpx::experimental::when_all_inline<2>(
+        std::next(futures.begin(), count), count);
+    auto result2 = r2.get();
+
+    HPX_TEST_EQ(result2.size(), static_cast<std::size_t>(count));
+    for (const auto& r : result2)
+        HPX_TEST(r.is_ready());
+
+    for (const auto& f : futures)
+        HPX_TEST(!f.valid());
+}
+
 void test_when_all_one_future()
 {
     hpx::lcos::local::futures_factory<int()> pt1(make_int_slowly);
@@ -254,6 +311,8 @@ int hpx_main(variables_map&)
     {
         test_when_all_from_list();
         test_when_all_from_list_iterators();
+        test_when_all_from_moved_list();
+        test_when_all_inline();
         test_when_all_one_future();
         test_when_all_two_futures();
         test_when_all_three_futures();
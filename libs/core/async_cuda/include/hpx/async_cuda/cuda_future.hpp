@@ -36,15 +36,23 @@ namespace hpx { namespace cuda { namespace experimental {
     using event_mode = std::true_type;
     using callback_mode = std::false_type;
 
+    // the future is made ready by a cuda host callback which hands the
+    // completion over to the polling function, no events have to be queried
+    struct host_callback_mode
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         // -------------------------------------------------------------
         // cuda future data implementation
-        // This version supports 2 modes of operation
+        // This version supports 3 modes of operation
         // 1) a callback based future that is made ready
         // by a cuda callback when the stream event occurs
         // 2) an event based callback that must be polled/queried by
         // the runtime to set the future ready state
+        // 3) a host callback based future, the cuda callback only enqueues
+        // the completion which is then handled by the polling function
         template <typename Allocator, typename Mode>
         struct future_data;
 
@@ -92,6 +100,50 @@ namespace hpx { namespace cuda { namespace experimental {
             }
         };
 
+        template <typename Allocator>
+        struct future_data<Allocator, host_callback_mode>
+          : lcos::detail::future_data_allocator<void, Allocator,
+                future_data<Allocator, host_callback_mode>>
+        {
+            HPX_NON_COPYABLE(future_data);
+
+            using init_no_addref =
+                typename lcos::detail::future_data_allocator<void, Allocator,
+                    future_data>::init_no_addref;
+
+            using other_allocator = typename std::allocator_traits<
+                Allocator>::template rebind_alloc<future_data>;
+
+            future_data() {}
+
+            future_data(init_no_addref no_addref, other_allocator const& alloc,
+                cudaStream_t stream, int device)
+              : lcos::detail::future_data_allocator<void, Allocator,
+                    future_data>(no_addref, alloc)
+            {
+                add_host_callback(
+                    [fdp = hpx::intrusive_ptr<future_data>(this)](
+                        cudaError_t status) {
+                        HPX_ASSERT(status != cudaErrorNotReady);
+
+                        if (status == cudaSuccess)
+                        {
+                            fdp->set_data(hpx::util::unused);
+                        }
+                        else
+                        {
+                            fdp->set_exception(
+                                std::make_exception_ptr(cuda_exception(
+                                    std::string(
+                                        "cuda function returned error code :") +
+                                        cudaGetErrorString(status),
+                                    status)));
+                        }
+                    },
+                    stream, device);
+            }
+        };
+
         template <typename Allocator>
         struct future_data<Allocator, callback_mode>
           : lcos::detail::future_data_allocator<void, Allocator,
@@ -187,9 +239,11 @@ namespace hpx { namespace cuda { namespace experimental {
                 hpx::util::allocator_deleter<other_allocator>{alloc});
 
             static_assert(std::is_same_v<Mode, event_mode> ||
-                    std::is_same_v<Mode, callback_mode>,
+                    std::is_same_v<Mode, callback_mode> ||
+                    std::is_same_v<Mode, host_callback_mode>,
                 "get_future mode not supported!");
-            if constexpr (std::is_same_v<Mode, event_mode>)
+            if constexpr (std::is_same_v<Mode, event_mode> ||
+                std::is_same_v<Mode, host_callback_mode>)
             {
                 traits::construct(
                     alloc, p.get(), init_no_addref{}, alloc, stream, device);
@@ -226,6 +280,18 @@ namespace hpx { namespace cuda { namespace experimental {
             return get_future<Allocator, event_mode>(a, stream, device);
         }
 
+        // -------------------------------------------------------------
+        // main API call to get a future from a stream using allocator, the
+        // future is made ready through a host callback if possible
+        template <typename Allocator>
+        hpx::future<void> get_future_with_host_callback(
+            Allocator const& a, cudaStream_t stream, int device = -1)
+        {
+            if (device == -1)
+                check_cuda_error(cudaGetDevice(&device));
+            return get_future<Allocator, host_callback_mode>(a, stream, device);
+        }
+
         // -------------------------------------------------------------
         // non allocator version of : get future with a callback set
         HPX_CORE_EXPORT hpx::future<void> get_future_with_callback(
@@ -235,6 +301,11 @@ namespace hpx { namespace cuda { namespace experimental {
         // non allocator version of : get future with an event set
         HPX_CORE_EXPORT hpx::future<void> get_future_with_event(
             cudaStream_t stream, int device = -1);
+
+        // -------------------------------------------------------------
+        // non allocator version of : get future with a host callback set
+        HPX_CORE_EXPORT hpx::future<void> get_future_with_host_callback(
+            cudaStream_t stream, int device = -1);
     }    // namespace detail
 }}}      // namespace hpx::cuda::experimental
 
@@ -0,0 +1,312 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/cuda_executor.hpp>
+#include <hpx/async_cuda/detail/cuda_event_callback.hpp>
+#include <hpx/async_cuda/get_targets.hpp>
+#include <hpx/async_cuda/target.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/experimental/scope_exit.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+
+// CUDA runtime
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+//
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace detail {
+
+        // -------------------------------------------------------------------------
+        // A stream managed by a cuda_stream_pool_executor together with the
+        // number of operations launched on it which have not completed yet
+        struct pool_stream
+        {
+            explicit pool_stream(int device)
+              : target_(device)
+              , stream_(target_.native_handle().get_stream())
+              , device_(device)
+              , pending_(0)
+            {
+            }
+
+            pool_stream(pool_stream const&) = delete;
+            pool_stream& operator=(pool_stream const&) = delete;
+
+            hpx::cuda::experimental::target target_;
+            cudaStream_t stream_;
+            int device_;
+            std::atomic<std::size_t> pending_;
+        };
+
+        struct stream_pool
+        {
+            stream_pool(std::vector<hpx::cuda::experimental::target> const&
+                            targets,
+                std::size_t num_streams_per_device)
+              : next_(0)
+            {
+                HPX_ASSERT(!targets.empty() && num_streams_per_device != 0);
+
+                streams_.reserve(targets.size() * num_streams_per_device);
+                for (std::size_t i = 0; i != num_streams_per_device; ++i)
+                {
+                    // interleave the devices to spread ties
+                    for (auto const& t : targets)
+                    {
+                        streams_.push_back(std::make_unique<pool_stream>(
+                            t.native_handle().get_device()));
+                    }
+                }
+            }
+
+            // Select the stream with the fewest pending operations, starting
+            // the search at a different stream every time to distribute the
+            // operations evenly between streams with the same load
+            pool_stream& select() noexcept
+            {
+                std::size_t const n = streams_.size();
+                std::size_t best =
+                    next_.fetch_add(1, std::memory_order_relaxed) % n;
+                std::size_t best_pending =
+                    streams_[best]->pending_.load(std::memory_order_relaxed);
+
+                for (std::size_t i = 1; i != n && best_pending != 0; ++i)
+                {
+                    std::size_t const s = (best + i) % n;
+                    std::size_t const pending =
+                        streams_[s]->pending_.load(std::memory_order_relaxed);
+                    if (pending < best_pending)
+                    {
+                        best = s;
+                        best_pending = pending;
+                    }
+                }
+                return *streams_[best];
+            }
+
+            std::vector<std::unique_ptr<pool_stream>> streams_;
+            std::atomic<std::size_t> next_;
+        };
+    }    // namespace detail
+
+    // -------------------------------------------------------------------------
+    // Launches cuda functions and kernels on a pool of streams, possibly
+    // spanning several devices. Every operation is dispatched to the stream
+    // with the fewest pending (launched but not completed) operations, which
+    // allows independent operations to run concurrently. The completion of
+    // operations is detected through events taken from the cuda_event_pool,
+    // CUDA event polling has to be enabled.
+    // -------------------------------------------------------------------------
+    struct cuda_stream_pool_executor
+    {
+        using future_type = hpx::future<void>;
+
+        static constexpr std::size_t default_num_streams_per_device = 4;
+
+        // -------------------------------------------------------------------------
+        // create num_streams_per_device streams on every device available
+        explicit cuda_stream_pool_executor(std::size_t num_streams_per_device =
+                                               default_num_streams_per_device)
+          : cuda_stream_pool_executor(
+                get_local_targets(), num_streams_per_device)
+        {
+        }
+
+        // create num_streams_per_device streams on every given device
+        cuda_stream_pool_executor(std::vector<target> const& targets,
+            std::size_t num_streams_per_device = default_num_streams_per_device)
+          : pool_(std::make_shared<detail::stream_pool>(
+                targets, num_streams_per_device))
+        {
+        }
+
+        // create num_streams streams on the given device
+        cuda_stream_pool_executor(int device, std::size_t num_streams)
+          : cuda_stream_pool_executor(
+                std::vector<target>{target(device)}, num_streams)
+        {
+        }
+
+        // -------------------------------------------------------------------------
+        // the number of streams managed by this executor
+        std::size_t num_streams() const noexcept
+        {
+            return pool_->streams_.size();
+        }
+
+        // the device and the number of pending operations of a stream
+        int get_device(std::size_t stream) const noexcept
+        {
+            HPX_ASSERT(stream < num_streams());
+            return pool_->streams_[stream]->device_;
+        }
+
+        std::size_t get_pending(std::size_t stream) const noexcept
+        {
+            HPX_ASSERT(stream < num_streams());
+            return pool_->streams_[stream]->pending_.load(
+                std::memory_order_relaxed);
+        }
+
+        // -------------------------------------------------------------------------
+        // OneWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
+            cuda_stream_pool_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.post(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // -------------------------------------------------------------------------
+        // TwoWay Execution
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            cuda_stream_pool_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.async(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        friend bool operator==(cuda_stream_pool_executor const& lhs,
+            cuda_stream_pool_executor const& rhs) noexcept
+        {
+            return lhs.pool_ == rhs.pool_;
+        }
+
+        friend bool operator!=(cuda_stream_pool_executor const& lhs,
+            cuda_stream_pool_executor const& rhs) noexcept
+        {
+            return lhs.pool_ != rhs.pool_;
+        }
+
+    protected:
+        // -------------------------------------------------------------------------
+        // launch a cuda function on the least loaded stream, the stream is
+        // counted as being busy with the operation until the given callback
+        // is invoked on its completion
+        template <typename Callback, typename R, typename... Params,
+            typename... Args>
+        void launch(Callback&& on_completed, R (*cuda_function)(Params...),
+            Args&&... args) const
+        {
+            detail::pool_stream& s = pool_->select();
+            s.pending_.fetch_add(1, std::memory_order_relaxed);
+
+            bool launched = false;
+            auto on_exit = hpx::experimental::scope_exit([&] {
+                if (!launched)
+                {
+                    s.pending_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            });
+
+            // make sure we run on the correct device
+            check_cuda_error(cudaSetDevice(s.device_));
+
+            // insert the stream handle in the arg list and call the cuda
+            // function
+            detail::dispatch_helper<R, Params...> helper{};
+            helper(cuda_function, HPX_FORWARD(Args, args)..., s.stream_);
+
+            detail::add_event_callback(
+                [&s, pool = pool_,
+                    f = HPX_FORWARD(Callback, on_completed)](
+                    cudaError_t status) mutable {
+                    s.pending_.fetch_sub(1, std::memory_order_relaxed);
+                    f(status);
+                },
+                s.stream_, s.device_);
+            launched = true;
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on the least loaded stream and return without a
+        // future. Throws cuda_exception if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        void post(R (*cuda_function)(Params...), Args&&... args) const
+        {
+            launch([](cudaError_t) {}, cuda_function,
+                HPX_FORWARD(Args, args)...);
+        }
+
+        // -------------------------------------------------------------------------
+        // launch a kernel on the least loaded stream and return a future that
+        // will become ready when the task completes.
+        // Puts a cuda_exception in the future if the async launch fails.
+        template <typename R, typename... Params, typename... Args>
+        hpx::future<void> async(
+            R (*cuda_kernel)(Params...), Args&&... args) const
+        {
+            return hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    hpx::promise<void> p;
+                    hpx::future<void> f = p.get_future();
+                    launch(
+                        [p = HPX_MOVE(p)](cudaError_t status) mutable {
+                            HPX_ASSERT(status != cudaErrorNotReady);
+                            if (status == cudaSuccess)
+                            {
+                                p.set_value();
+                            }
+                            else
+                            {
+                                p.set_exception(
+                                    std::make_exception_ptr(cuda_exception(
+                                        std::string("cuda function returned "
+                                                    "error code :") +
+                                            cudaGetErrorString(status),
+                                        status)));
+                            }
+                        },
+                        cuda_kernel, HPX_FORWARD(Args, args)...);
+                    return f;
+                },
+                [&](std::exception_ptr&& ep) {
+                    return hpx::make_exceptional_future<void>(HPX_MOVE(ep));
+                });
+        }
+
+    private:
+        std::shared_ptr<detail::stream_pool> pool_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<
+        hpx::cuda::experimental::cuda_stream_pool_executor> : std::true_type
+    {
+        // we support fire and forget without returning a waitable/future
+    };
+
+    template <>
+    struct is_two_way_executor<
+        hpx::cuda::experimental::cuda_stream_pool_executor> : std::true_type
+    {
+        // we support returning a waitable/future
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -42,6 +42,7 @@
     #define cudaEventQuery hipEventQuery
     #define cudaEventRecord hipEventRecord
     #define cudaFree hipFree
+    #define cudaFreeHost hipHostFree
     #define cudaGetDevice hipGetDevice
     #define cudaGetDeviceCount hipGetDeviceCount
     #define cudaGetDeviceProperties hipGetDeviceProperties
@@ -67,6 +68,7 @@
     #define cudaStreamDestroy hipStreamDestroy
     #define cudaStreamNonBlocking hipStreamNonBlocking
     #define cudaStreamSynchronize hipStreamSynchronize
+    #define cudaStreamWaitEvent hipStreamWaitEvent
     #define cudaSuccess hipSuccess
 
 #elif defined(HPX_HAVE_CUDA)
@@ -19,6 +19,7 @@
 #include <hpx/functional/move_only_function.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <cstddef>
 #include <string>
 
 namespace hpx { namespace cuda { namespace experimental { namespace detail {
@@ -28,6 +29,21 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
     HPX_CORE_EXPORT void add_event_callback(
         event_callback_function_type&& f, cudaStream_t stream, int device = 0);
 
+    // Invoke the callback once all work launched on the stream so far has
+    // completed. The CUDA runtime notifies the completion through a stream
+    // callback which only pushes the callback to a lock-free queue, the
+    // queue is drained by the polling function, which doesn't have to query
+    // any events. If the number of pending host callbacks exceeds the
+    // threshold, the callback is registered using add_event_callback
+    // instead, as querying events scales better to very high rates of
+    // operations.
+    HPX_CORE_EXPORT void add_host_callback(
+        event_callback_function_type&& f, cudaStream_t stream, int device = 0);
+
+    // Set the number of pending host callbacks beyond which
+    // add_host_callback falls back to polling events (default: 256)
+    HPX_CORE_EXPORT void set_host_callback_threshold(std::size_t threshold);
+
     HPX_CORE_EXPORT void register_polling(hpx::threads::thread_pool_base& pool);
     HPX_CORE_EXPORT void unregister_polling(
         hpx::threads::thread_pool_base& pool);
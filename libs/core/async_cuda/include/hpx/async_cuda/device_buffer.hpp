@@ -0,0 +1,223 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
+#include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/serialization/detail/allow_device_memory.hpp>
+#include <hpx/serialization/detail/allow_zero_copy_receive.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace cuda { namespace experimental {
+
+    namespace detail {
+
+        // The memory of a device_buffer, shared by all of its copies.
+        struct device_buffer_data
+        {
+            explicit device_buffer_data(std::size_t bytes)
+              : bytes_(bytes)
+            {
+                if (bytes_ != 0)
+                {
+                    check_cuda_error(cudaMalloc(&device_, bytes_));
+                }
+            }
+
+            device_buffer_data(device_buffer_data const&) = delete;
+            device_buffer_data(device_buffer_data&&) = delete;
+            device_buffer_data& operator=(device_buffer_data const&) = delete;
+            device_buffer_data& operator=(device_buffer_data&&) = delete;
+
+            ~device_buffer_data()
+            {
+                // errors can't be reported from here
+                if (host_ != nullptr)
+                {
+                    cudaFreeHost(host_);
+                }
+                if (device_ != nullptr)
+                {
+                    cudaFree(device_);
+                }
+            }
+
+            // pinned host memory used to stage the data through
+            void* staging_buffer()
+            {
+                if (host_ == nullptr && bytes_ != 0)
+                {
+                    check_cuda_error(cudaMallocHost(&host_, bytes_));
+                }
+                return host_;
+            }
+
+            void download()
+            {
+                check_cuda_error(cudaMemcpy(staging_buffer(), device_, bytes_,
+                    cudaMemcpyDeviceToHost));
+            }
+
+            // data received into the staging buffer is copied to the device
+            // on first access
+            void upload()
+            {
+                if (needs_upload_)
+                {
+                    check_cuda_error(cudaMemcpy(
+                        device_, host_, bytes_, cudaMemcpyHostToDevice));
+                    needs_upload_ = false;
+                }
+            }
+
+            std::size_t bytes_;
+            void* device_ = nullptr;
+            void* host_ = nullptr;
+            bool needs_upload_ = false;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A buffer of device memory which can be passed as an argument to
+    // (remote) actions. Parcelports which are able to access device memory
+    // directly (see hpx.parcel.<parcelport>.device_memory) send the data as
+    // a zero-copy chunk straight from device memory and receive it straight
+    // into device memory. All other parcelports stage the data through
+    // pinned host memory. The memory is allocated on the current device.
+    //
+    // Copies of a device_buffer refer to the same memory. The received data
+    // is copied to the device on the first call to data() if it had to be
+    // staged, this function is not thread-safe.
+    template <typename T>
+    class device_buffer
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "device_buffer requires a trivially copyable value type");
+
+    public:
+        using value_type = T;
+
+        device_buffer() = default;
+
+        explicit device_buffer(std::size_t size)
+          : size_(size)
+          , data_(std::make_shared<detail::device_buffer_data>(
+                size * sizeof(T)))
+        {
+        }
+
+        [[nodiscard]] T* data() const
+        {
+            if (!data_)
+            {
+                return nullptr;
+            }
+            data_->upload();
+            return static_cast<T*>(data_->device_);
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        static bool use_device_memory(
+            Archive const& ar, std::size_t bytes) noexcept
+        {
+            auto const* device_memory = ar.template try_get_extra_data<
+                serialization::detail::allow_device_memory>();
+            return device_memory != nullptr && !ar.disable_data_chunking() &&
+                bytes >= device_memory->zero_copy_serialization_threshold;
+        }
+
+        // The data is sent as a chunk straight from device memory only if
+        // it is not copied into the archive.
+        void save(serialization::output_archive& ar, unsigned) const
+        {
+            std::size_t const bytes = size_ * sizeof(T);
+            bool const direct = use_device_memory(ar, bytes);
+
+            ar << size_ << direct;
+            if (bytes == 0)
+            {
+                return;
+            }
+
+            if (direct)
+            {
+                ar.save_binary_chunk(data(), bytes);
+            }
+            else if (ar.is_preprocessing())
+            {
+                // the data is not touched while determining the size
+                ar.save_binary_chunk(data_->host_, bytes);
+            }
+            else
+            {
+                data_->upload();
+                data_->download();
+                ar.save_binary_chunk(data_->host_, bytes);
+            }
+        }
+
+        // The data can be received straight into device memory only if it
+        // was sent as a chunk and if the receiving parcelport places the
+        // chunks directly into their final buffers.
+        void load(serialization::input_archive& ar, unsigned)
+        {
+            bool direct = false;
+            ar >> size_ >> direct;
+
+            std::size_t const bytes = size_ * sizeof(T);
+            data_ = std::make_shared<detail::device_buffer_data>(bytes);
+            if (bytes == 0)
+            {
+                return;
+            }
+
+            bool const allow_zero_copy_receive =
+                ar.try_get_extra_data<
+                    serialization::detail::allow_zero_copy_receive>() !=
+                nullptr;
+
+            if (direct && allow_zero_copy_receive &&
+                ar.try_get_extra_data<
+                    serialization::detail::allow_device_memory>() != nullptr)
+            {
+                ar.load_binary_chunk(data_->device_, bytes, true);
+            }
+            else
+            {
+                // the data may arrive after the parcel was de-serialized
+                ar.load_binary_chunk(
+                    data_->staging_buffer(), bytes, allow_zero_copy_receive);
+                data_->needs_upload_ = true;
+            }
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        std::size_t size_ = 0;
+        std::shared_ptr<detail::device_buffer_data> data_;
+    };
+}}}    // namespace hpx::cuda::experimental
+
+#include <hpx/config/warnings_suffix.hpp>
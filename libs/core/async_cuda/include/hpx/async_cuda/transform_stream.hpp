@@ -8,13 +8,18 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_cuda/cuda_event.hpp>
+#include <hpx/async_cuda/cuda_exception.hpp>
 #include <hpx/async_cuda/custom_gpu_api.hpp>
+#include <hpx/async_cuda/detail/cuda_event_callback.hpp>
+#include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/algorithms/detail/partial_algorithm.hpp>
 #include <hpx/execution/algorithms/then.hpp>
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/experimental/scope_exit.hpp>
 #include <hpx/type_support/pack.hpp>
 
 #include <exception>
@@ -75,6 +80,27 @@ namespace hpx { namespace cuda { namespace experimental {
             extend_argument_lifetimes(stream, HPX_FORWARD(Ts, ts)...);
         }
 
+        // Make all work launched on waiting_stream from now on wait for the
+        // work launched on stream so far, without synchronizing with the host
+        inline void wait_for_stream(
+            cudaStream_t stream, cudaStream_t waiting_stream)
+        {
+            int device = 0;
+            check_cuda_error(cudaGetDevice(&device));
+
+            cudaEvent_t event;
+            cuda_event_pool& pool = cuda_event_pool::get_event_pool();
+            pool.pop(event, device);
+
+            // cudaStreamWaitEvent waits for the work captured by the event at
+            // the time of the call, the event can be reused right away
+            auto on_exit = hpx::experimental::scope_exit(
+                [&] { pool.push(event, device); });
+
+            check_cuda_error(cudaEventRecord(event, stream));
+            check_cuda_error(cudaStreamWaitEvent(waiting_stream, event, 0));
+        }
+
         template <typename R, typename... Ts>
         void set_value_event_callback_void(
             cudaStream_t stream, R&& r, Ts&&... ts)
@@ -187,10 +213,11 @@ namespace hpx { namespace cuda { namespace experimental {
                                 }
                                 else
                                 {
-                                    // When the streams are different, we add a
-                                    // callback which will call set_value on the
-                                    // receiver.
-                                    set_value_event_callback_void(stream,
+                                    // When the streams are different, we make
+                                    // the next stream wait for this one on the
+                                    // device and call set_value immediately.
+                                    wait_for_stream(stream, r.stream);
+                                    set_value_immediate_void(stream,
                                         HPX_MOVE(r), HPX_FORWARD(Ts, ts)...);
                                 }
                             }
@@ -227,10 +254,11 @@ namespace hpx { namespace cuda { namespace experimental {
                                 }
                                 else
                                 {
-                                    // When the streams are different, we add a
-                                    // callback which will call set_value on the
-                                    // receiver.
-                                    set_value_event_callback_non_void(stream,
+                                    // When the streams are different, we make
+                                    // the next stream wait for this one on the
+                                    // device and call set_value immediately.
+                                    wait_for_stream(stream, r.stream);
+                                    set_value_immediate_non_void(stream,
                                         HPX_MOVE(r), HPX_MOVE(t),
                                         HPX_FORWARD(Ts, ts)...);
                                 }
@@ -320,6 +348,33 @@ namespace hpx { namespace cuda { namespace experimental {
         {
             r.set_value(HPX_FORWARD(Ts, ts)...);
         }
+
+        // Launches f once for every index in [0, shape) on the stream and
+        // forwards the value sent by the predecessor (if any)
+        template <typename Shape, typename F>
+        struct bulk_on_device_function
+        {
+            Shape shape;
+            std::decay_t<F> f;
+
+            void operator()(cudaStream_t stream)
+            {
+                for (Shape i = 0; i != shape; ++i)
+                {
+                    HPX_INVOKE(f, i, stream);
+                }
+            }
+
+            template <typename T>
+            std::decay_t<T> operator()(T&& t, cudaStream_t stream)
+            {
+                for (Shape i = 0; i != shape; ++i)
+                {
+                    HPX_INVOKE(f, i, t, stream);
+                }
+                return HPX_FORWARD(T, t);
+            }
+        };
     }    // namespace detail
 
     // NOTE: This is not a customization of
@@ -349,4 +404,55 @@ namespace hpx { namespace cuda { namespace experimental {
                 transform_stream_t, F, cudaStream_t>{HPX_FORWARD(F, f), stream};
         }
     } transform_stream{};
+
+    // then_on_device is the name used for transform_stream in pipelines
+    // running on the device: consecutive adaptors using the same stream are
+    // launched right away without synchronizing with the host, adaptors using
+    // different streams are ordered on the device using an event. The host
+    // is notified of the completion of the launched work only when the
+    // values are sent to a receiver which does not run on the device (e.g.
+    // hpx::execution::experimental::then or continues_on), which is the
+    // point where the pipeline transfers back to the host.
+    inline constexpr transform_stream_t const& then_on_device =
+        transform_stream;
+
+    // bulk_on_device(s, shape, f, stream) calls f(i, v, stream) for every i
+    // in [0, shape), where v is the value sent by s (if any), and sends v
+    // once all launches have been enqueued. Like then_on_device, the
+    // operations are chained on the device.
+    inline constexpr struct bulk_on_device_t final
+      : hpx::functional::detail::tag_fallback<bulk_on_device_t>
+    {
+    private:
+        // clang-format off
+        template <typename S, typename Shape, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::is_sender_v<S> &&
+                std::is_integral_v<Shape>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            bulk_on_device_t, S&& s, Shape shape, F&& f,
+            cudaStream_t stream = {})
+        {
+            using function_type = detail::bulk_on_device_function<Shape, F>;
+            return detail::transform_stream_sender<S, function_type>{
+                HPX_FORWARD(S, s), function_type{shape, HPX_FORWARD(F, f)},
+                stream};
+        }
+
+        // clang-format off
+        template <typename Shape, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_integral_v<Shape>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            bulk_on_device_t, Shape shape, F&& f, cudaStream_t stream = {})
+        {
+            return hpx::execution::experimental::detail::partial_algorithm<
+                bulk_on_device_t, Shape, F, cudaStream_t>{
+                shape, HPX_FORWARD(F, f), stream};
+        }
+    } bulk_on_device{};
 }}}    // namespace hpx::cuda::experimental
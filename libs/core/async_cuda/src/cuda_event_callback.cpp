@@ -82,6 +82,63 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         return get_event_callback_vector().size();
     }
 
+    // Holds a callback registered by add_host_callback together with the
+    // status reported by the CUDA runtime
+    struct host_callback
+    {
+        event_callback_function_type f;
+        cudaError_t status;
+    };
+
+    using host_callback_queue_type =
+        concurrency::ConcurrentQueue<host_callback*>;
+
+    host_callback_queue_type& get_host_callback_queue()
+    {
+        static host_callback_queue_type host_callback_queue;
+        return host_callback_queue;
+    }
+
+    // the number of host callbacks which have not been invoked yet
+    std::atomic<std::size_t>& get_pending_host_callbacks()
+    {
+        static std::atomic<std::size_t> pending_host_callbacks{0};
+        return pending_host_callbacks;
+    }
+
+    std::atomic<std::size_t>& get_host_callback_threshold()
+    {
+        static std::atomic<std::size_t> host_callback_threshold{256};
+        return host_callback_threshold;
+    }
+
+    // this is called by the CUDA runtime on a non-hpx thread, it only hands
+    // the callback over to the polling function
+    void CUDART_CB host_callback_function(
+        cudaStream_t, cudaError_t status, void* user_data)
+    {
+        auto* callback = static_cast<host_callback*>(user_data);
+        callback->status = status;
+        get_host_callback_queue().enqueue(callback);
+    }
+
+    // Invoke all host callbacks which have been handed over by the CUDA
+    // runtime, this can be done concurrently by all polling threads
+    void invoke_host_callbacks()
+    {
+        host_callback* callback = nullptr;
+        while (get_host_callback_queue().try_dequeue(callback))
+        {
+            std::unique_ptr<host_callback> p(callback);
+            get_pending_host_callbacks().fetch_sub(
+                1, std::memory_order_relaxed);
+
+            cud_debug.debug(debug::str<>("set ready host callback"),
+                "callback", debug::ptr(callback));
+            p->f(p->status);
+        }
+    }
+
     void add_to_event_callback_queue(event_callback&& continuation)
     {
         HPX_ASSERT_MSG(get_register_polling_count() != 0,
@@ -122,6 +179,47 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
             event_callback{event, HPX_MOVE(f), device});
     }
 
+    void add_host_callback(
+        event_callback_function_type&& f, cudaStream_t stream, int device)
+    {
+        HPX_ASSERT_MSG(get_register_polling_count() != 0,
+            "CUDA event polling has not been enabled on any pool. Make sure "
+            "that CUDA event polling is enabled on at least one thread pool.");
+
+        // fall back to polling events for very high rates of operations
+        std::atomic<std::size_t>& pending = get_pending_host_callbacks();
+        if (pending.load(std::memory_order_relaxed) >=
+            get_host_callback_threshold().load(std::memory_order_relaxed))
+        {
+            add_event_callback(HPX_MOVE(f), stream, device);
+            return;
+        }
+
+        auto callback = std::make_unique<host_callback>(
+            host_callback{HPX_MOVE(f), cudaSuccess});
+
+        pending.fetch_add(1, std::memory_order_relaxed);
+        cudaError_t const error = cudaStreamAddCallback(
+            stream, host_callback_function, callback.get(), 0);
+        if (error != cudaSuccess)
+        {
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            check_cuda_error(error);
+        }
+
+        cud_debug.debug(debug::str<>("host callback added"), "callback",
+            debug::ptr(callback.get()));
+
+        // the callback is owned by the CUDA runtime now
+        callback.release();
+    }
+
+    void set_host_callback_threshold(std::size_t threshold)
+    {
+        get_host_callback_threshold().store(
+            threshold, std::memory_order_relaxed);
+    }
+
     // Background progress function for async CUDA operations. Checks for completed
     // cudaEvent_t and calls the associated callback when ready. We first process
     // events that have been added to the vector of events, which should be
@@ -134,6 +232,9 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
 
         auto& event_callback_vector = detail::get_event_callback_vector();
 
+        // Host callbacks don't need any events to be queried
+        invoke_host_callbacks();
+
         // Don't poll if another thread is already polling
         std::unique_lock<hpx::cuda::experimental::detail::mutex_type> lk(
             detail::get_vector_mtx(), std::try_to_lock);
@@ -210,8 +311,11 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         }
 
         using hpx::threads::policies::detail::polling_status;
-        return get_event_callback_vector().empty() ? polling_status::idle :
-                                                     polling_status::busy;
+        return get_event_callback_vector().empty() &&
+                get_pending_host_callbacks().load(std::memory_order_relaxed) ==
+                    0 ?
+            polling_status::idle :
+            polling_status::busy;
     }
 
     std::size_t get_work_count()
@@ -226,6 +330,8 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         }
 
         work_count += get_number_of_enqueued_events();
+        work_count +=
+            get_pending_host_callbacks().load(std::memory_order_relaxed);
 
         return work_count;
     }
@@ -253,6 +359,10 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
                 get_event_callback_queue().size_approx() == 0;
             bool event_vector_empty = get_event_callback_vector().empty();
             lk.unlock();
+            HPX_ASSERT_MSG(get_pending_host_callbacks() == 0,
+                "CUDA event polling was disabled while there are pending "
+                "CUDA host callbacks. Make sure CUDA event polling is not "
+                "disabled too early.");
             HPX_ASSERT_MSG(event_queue_empty,
                 "CUDA event polling was disabled while there are unprocessed "
                 "CUDA events. Make sure CUDA event polling is not disabled too "
@@ -26,4 +26,11 @@ namespace hpx { namespace cuda { namespace experimental { namespace detail {
         return get_future_with_event(
             hpx::util::internal_allocator<>{}, stream, device);
     }
+
+    hpx::future<void> get_future_with_host_callback(
+        cudaStream_t stream, int device)
+    {
+        return get_future_with_host_callback(
+            hpx::util::internal_allocator<>{}, stream, device);
+    }
 }}}}    // namespace hpx::cuda::experimental::detail
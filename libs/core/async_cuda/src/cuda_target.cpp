@@ -196,6 +196,12 @@ namespace hpx { namespace cuda { namespace experimental {
         return detail::get_future_with_callback(handle_.get_stream());
     }
 
+    hpx::future<void> target::get_future_with_host_callback() const
+    {
+        return detail::get_future_with_host_callback(
+            handle_.get_stream(), handle_.get_device());
+    }
+
     target& get_default_target()
     {
         static target target_;
@@ -167,6 +167,30 @@ int hpx_main(hpx::program_options::variables_map& vm)
           std::cout << "copy continuation triggered\n";
       }).get();
 
+    // --------------------
+    // test futures made ready through host callbacks, the second batch
+    // exceeds the threshold and falls back to polling events
+    std::cout << "host callback futures : " << testd2 + 2 << std::endl;
+    for (std::size_t threshold : {std::size_t(256), std::size_t(0)})
+    {
+        hpx::cuda::experimental::detail::set_host_callback_threshold(
+            threshold);
+
+        std::vector<hpx::future<void>> futures;
+        for (int i = 0; i != 10; ++i)
+        {
+            cuda_trivial_kernel<double>(
+                testd2 + 2, target.native_handle().get_stream());
+            futures.push_back(target.get_future_with_host_callback());
+        }
+        hpx::wait_all(futures);
+        for (auto& f : futures)
+        {
+            HPX_TEST(!f.has_exception());
+        }
+    }
+    hpx::cuda::experimental::detail::set_host_callback_threshold(256);
+
     // --------------------
     // test a full kernel example
     HPX_TEST(test_saxpy(cudaexec));
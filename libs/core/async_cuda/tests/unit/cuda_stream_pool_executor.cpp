@@ -0,0 +1,86 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/assert.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// -------------------------------------------------------------------------
+// Launch kernels through a cuda_stream_pool_executor spanning all devices and
+// verify that all of them complete and are accounted for.
+
+template <typename T>
+extern void cuda_trivial_kernel(T, cudaStream_t stream);
+
+// -------------------------------------------------------------------------
+int hpx_main()
+{
+    // install cuda future polling handler
+    hpx::cuda::experimental::enable_user_polling poll("default");
+
+    int number_devices = 0;
+    hpx::cuda::experimental::check_cuda_error(
+        cudaGetDeviceCount(&number_devices));
+    HPX_ASSERT(number_devices > 0);
+
+    hpx::cuda::experimental::cuda_stream_pool_executor exec(2);
+    HPX_TEST_EQ(
+        exec.num_streams(), static_cast<std::size_t>(2 * number_devices));
+
+    std::vector<hpx::future<void>> futs;
+    for (int i = 0; i != 20; ++i)
+    {
+        futs.push_back(hpx::async(
+            exec, cuda_trivial_kernel<float>, static_cast<float>(i)));
+    }
+    hpx::post(exec, cuda_trivial_kernel<float>, 20.0f);
+
+    hpx::wait_all(futs);
+    for (auto& f : futs)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    // all operations, including the one launched by post, are completed
+    // eventually
+    hpx::future<void> last =
+        hpx::async(exec, cuda_trivial_kernel<float>, 21.0f);
+    last.get();
+    while (true)
+    {
+        std::size_t pending = 0;
+        for (std::size_t s = 0; s != exec.num_streams(); ++s)
+        {
+            pending += exec.get_pending(s);
+        }
+        if (pending == 0)
+        {
+            break;
+        }
+        hpx::this_thread::yield();
+    }
+
+    // the streams are interleaved between the devices
+    for (std::size_t s = 0; s != exec.num_streams(); ++s)
+    {
+        HPX_TEST_EQ(exec.get_device(s), static_cast<int>(s) % number_devices);
+    }
+
+    return hpx::local::finalize();
+}
+
+// -------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that device buffers are serialized as zero-copy chunks
+// located in device memory if the archive allows for it, and that they are
+// staged through host memory otherwise.
+
+#include <hpx/modules/async_cuda.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cuda = hpx::cuda::experimental;
+
+constexpr std::size_t num_elements = 4 * HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+
+///////////////////////////////////////////////////////////////////////////////
+cuda::device_buffer<double> make_buffer()
+{
+    std::vector<double> host(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        host[i] = static_cast<double>(i);
+    }
+
+    cuda::device_buffer<double> buffer(num_elements);
+    cuda::check_cuda_error(cudaMemcpy(buffer.data(), host.data(),
+        num_elements * sizeof(double), cudaMemcpyHostToDevice));
+    return buffer;
+}
+
+void check_buffer(cuda::device_buffer<double> const& buffer)
+{
+    HPX_TEST_EQ(buffer.size(), num_elements);
+
+    std::vector<double> host(buffer.size());
+    cuda::check_cuda_error(cudaMemcpy(host.data(), buffer.data(),
+        num_elements * sizeof(double), cudaMemcpyDeviceToHost));
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        HPX_TEST_EQ(host[i], static_cast<double>(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// archives which don't know about device memory get a copy of the data
+void test_staging()
+{
+    cuda::device_buffer<double> const os = make_buffer();
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << os;
+    }
+
+    cuda::device_buffer<double> is;
+    {
+        hpx::serialization::input_archive iarchive(buffer, buffer.size());
+        iarchive >> is;
+    }
+
+    HPX_TEST(is.data() != os.data());
+    check_buffer(is);
+}
+
+// Simulate a parcelport which is able to access device memory: the chunk is
+// sent from and received into device memory.
+void test_device_memory(bool receive_into_device_memory)
+{
+    cuda::device_buffer<double> const os = make_buffer();
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, 0, &chunks, nullptr, HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+        oarchive
+            .get_extra_data<hpx::serialization::detail::allow_device_memory>()
+            .zero_copy_serialization_threshold =
+            HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+        oarchive << os;
+    }
+
+    void const* source = nullptr;
+    for (auto& chunk : chunks)
+    {
+        if (chunk.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST(source == nullptr);
+            source = chunk.data_.cpos_;
+            chunk.data_.pos_ = nullptr;
+        }
+    }
+
+    // the data was not copied
+    HPX_TEST(source == os.data());
+
+    cuda::device_buffer<double> is;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, buffer.size(), &chunks);
+        iarchive.get_extra_data<
+            hpx::serialization::detail::allow_zero_copy_receive>();
+        if (receive_into_device_memory)
+        {
+            iarchive.get_extra_data<
+                hpx::serialization::detail::allow_device_memory>();
+        }
+        iarchive >> is;
+    }
+
+    for (auto const& chunk : chunks)
+    {
+        if (chunk.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST(chunk.data_.pos_ != nullptr);
+            cuda::check_cuda_error(cudaMemcpy(chunk.data_.pos_, source,
+                chunk.size_,
+                receive_into_device_memory ? cudaMemcpyDeviceToDevice :
+                                             cudaMemcpyDeviceToHost));
+
+            // the data was received into its final buffer
+            HPX_TEST_EQ(chunk.data_.pos_ == is.data(),
+                receive_into_device_memory);
+        }
+    }
+
+    check_buffer(is);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_staging();
+    test_device_memory(true);
+    test_device_memory(false);
+
+    return hpx::util::report_errors();
+}
@@ -98,6 +98,14 @@ struct increment
     }
 };
 
+struct increment_bulk
+{
+    void operator()(int, int* p, cudaStream_t stream) const
+    {
+        increment_kernel<<<1, 1, 0, stream>>>(p);
+    }
+};
+
 struct cuda_memcpy_async
 {
     template <typename... Ts>
@@ -292,6 +300,41 @@ int hpx_main()
         cu::check_cuda_error(cudaFree(p));
     }
 
+    // Chaining bulk launches and launches on different streams without
+    // intermediate synchronization
+    {
+        using type = int;
+        type p_h = 0;
+
+        type* p;
+        cu::check_cuda_error(cudaMalloc((void**) &p, sizeof(type)));
+
+        cudaStream_t stream1;
+        cudaStream_t stream2;
+        cu::check_cuda_error(
+            cudaStreamCreateWithFlags(&stream1, cudaStreamNonBlocking));
+        cu::check_cuda_error(
+            cudaStreamCreateWithFlags(&stream2, cudaStreamNonBlocking));
+
+        auto s = ex::just(p, &p_h, sizeof(type), cudaMemcpyHostToDevice) |
+            cu::then_on_device(cuda_memcpy_async{}, stream1) |
+            ex::then(&cu::check_cuda_error) |
+            ex::then([p] { return p; }) |
+            cu::bulk_on_device(3, increment_bulk{}, stream1) |
+            cu::then_on_device(increment{}, stream2) |
+            cu::bulk_on_device(2, increment_bulk{}, stream1);
+        ex::when_all(ex::just(&p_h), std::move(s), ex::just(sizeof(type)),
+            ex::just(cudaMemcpyDeviceToHost)) |
+            cu::then_on_device(cuda_memcpy_async{}, stream2) |
+            ex::then(&cu::check_cuda_error) |
+            ex::then([&p_h] { HPX_TEST_EQ(p_h, 6); }) |
+            ex::transfer(ex::thread_pool_scheduler{}) | tt::sync_wait();
+
+        cu::check_cuda_error(cudaStreamDestroy(stream1));
+        cu::check_cuda_error(cudaStreamDestroy(stream2));
+        cu::check_cuda_error(cudaFree(p));
+    }
+
     return hpx::local::finalize();
 }
 
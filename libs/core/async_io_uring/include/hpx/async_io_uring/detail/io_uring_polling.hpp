@@ -0,0 +1,32 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+
+namespace hpx::io_uring::experimental::detail {
+
+    // Submit the operations queued since the last call and make the futures
+    // of all completed operations ready, called by the scheduling loop
+    HPX_CORE_EXPORT hpx::threads::policies::detail::polling_status poll();
+
+    // The number of operations which have been queued but not completed yet
+    HPX_CORE_EXPORT std::size_t get_work_count();
+
+    // Register the io_uring polling function with the scheduler of the given
+    // pool (see scheduler_base.hpp)
+    HPX_CORE_EXPORT void register_polling(hpx::threads::thread_pool_base& pool);
+
+    // Unregister the io_uring polling function, only use this once all
+    // operations have completed
+    HPX_CORE_EXPORT void unregister_polling(
+        hpx::threads::thread_pool_base& pool);
+}    // namespace hpx::io_uring::experimental::detail
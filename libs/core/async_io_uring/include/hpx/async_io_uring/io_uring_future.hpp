@@ -0,0 +1,81 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file io_uring_future.hpp
+/// \page hpx::io_uring::experimental::async_read
+/// \headerfile hpx/modules/async_io_uring.hpp
+///
+/// Asynchronous file I/O through io_uring. The operations are queued on a
+/// ring shared by all threads, the queued operations are submitted to the
+/// kernel with a single system call, and their completions are collected
+/// by the scheduling loop of the threads of all pools io_uring polling is
+/// enabled for (see enable_user_polling).
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/uio.h>
+
+namespace hpx::io_uring::experimental {
+
+    /// The number of operations the ring can hold before the queued
+    /// operations have to be submitted, more operations can be in flight
+    constexpr unsigned ring_entries = 256;
+
+    /// Read up to \a size bytes from the file \a fd at \a offset into
+    /// \a buffer. The returned future becomes ready with the number of bytes
+    /// read once the read has completed, or holds a std::system_error if the
+    /// read failed. The buffer has to stay valid until then.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_read(
+        int fd, void* buffer, std::size_t size, std::uint64_t offset);
+
+    /// Write \a size bytes from \a buffer to the file \a fd at \a offset. The
+    /// returned future becomes ready with the number of bytes written once
+    /// the write has completed, or holds a std::system_error if the write
+    /// failed. The buffer has to stay valid until then.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_write(
+        int fd, void const* buffer, std::size_t size, std::uint64_t offset);
+
+    /// Flush the data (and the metadata, unless \a datasync is set) of the
+    /// file \a fd to the storage device. Note that io_uring does not order
+    /// the operations on a file, the writes to be flushed have to be
+    /// completed before this is called.
+    HPX_CORE_EXPORT hpx::future<void> async_fsync(
+        int fd, bool datasync = false);
+
+    /// Register the given buffers with the ring. Registered buffers are
+    /// mapped into the kernel once instead of on every operation, they are
+    /// used by async_read_fixed and async_write_fixed. Registering buffers
+    /// replaces no earlier registration, unregister_buffers has to be called
+    /// first.
+    HPX_CORE_EXPORT void register_buffers(iovec const* buffers, unsigned count);
+
+    /// Unregister the buffers registered with the ring, no operations using
+    /// them may be in flight.
+    HPX_CORE_EXPORT void unregister_buffers();
+
+    /// Like async_read, but \a buffer has to lie within the registered
+    /// buffer with the index \a buffer_index.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_read_fixed(int fd,
+        void* buffer, std::size_t size, std::uint64_t offset,
+        unsigned buffer_index);
+
+    /// Like async_write, but \a buffer has to lie within the registered
+    /// buffer with the index \a buffer_index.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_write_fixed(int fd,
+        void const* buffer, std::size_t size, std::uint64_t offset,
+        unsigned buffer_index);
+
+    /// Submit all queued operations right away instead of waiting for the
+    /// next pass of the scheduling loop. Returns the number of operations
+    /// submitted.
+    HPX_CORE_EXPORT std::size_t submit();
+}    // namespace hpx::io_uring::experimental
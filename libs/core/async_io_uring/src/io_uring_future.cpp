@@ -0,0 +1,379 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_io_uring/detail/io_uring_polling.hpp>
+#include <hpx/async_io_uring/io_uring_future.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <liburing.h>
+
+namespace hpx::io_uring::experimental {
+
+    namespace detail {
+
+        using polling_status = hpx::threads::policies::detail::polling_status;
+
+        // The maximal number of completions collected by one call to poll
+        constexpr unsigned completion_batch = 64;
+
+        // ---------------------------------------------------------------------
+        // An operation which has been queued on the ring, the result of the
+        // completion is handed to the future returned for the operation
+        struct operation
+        {
+            virtual ~operation() = default;
+            virtual void complete(int result) = 0;
+        };
+
+        template <typename T>
+        struct promise_operation final : operation
+        {
+            void complete(int result) override
+            {
+                if (result < 0)
+                {
+                    promise.set_exception(
+                        std::make_exception_ptr(std::system_error(-result,
+                            std::system_category(), "io_uring operation")));
+                }
+                else if constexpr (std::is_void_v<T>)
+                {
+                    promise.set_value();
+                }
+                else
+                {
+                    promise.set_value(static_cast<T>(result));
+                }
+            }
+
+            hpx::promise<T> promise;
+        };
+
+        // ---------------------------------------------------------------------
+        // The ring shared by all threads. io_uring requires the submission
+        // and the completion queue to be accessed by one thread at a time,
+        // both are protected by the same lock.
+        class ring
+        {
+        public:
+            ring()
+            {
+                int const result =
+                    io_uring_queue_init(ring_entries, &ring_, 0);
+                if (result < 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                        "hpx::io_uring::experimental::detail::ring",
+                        "io_uring_queue_init failed: {}",
+                        std::strerror(-result));
+                }
+            }
+
+            ~ring()
+            {
+                io_uring_queue_exit(&ring_);
+            }
+
+            ring(ring const&) = delete;
+            ring& operator=(ring const&) = delete;
+
+            // Queue an operation, it is submitted by the next call to poll
+            // (or submit). All operations queued in between two passes of the
+            // scheduling loop are submitted with a single system call this
+            // way.
+            template <typename T, typename Prepare>
+            hpx::future<T> enqueue(Prepare&& prepare)
+            {
+                auto op = std::make_unique<promise_operation<T>>();
+                hpx::future<T> f = op->promise.get_future();
+
+                {
+                    std::lock_guard<hpx::util::spinlock> l(mtx_);
+
+                    io_uring_sqe* sqe = get_sqe();
+                    prepare(sqe);
+                    io_uring_sqe_set_data(sqe, op.get());
+
+                    ++queued_;
+                    pending_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                op.release();
+                return f;
+            }
+
+            std::size_t submit()
+            {
+                std::lock_guard<hpx::util::spinlock> l(mtx_);
+                return submit_locked();
+            }
+
+            polling_status poll()
+            {
+                if (pending_.load(std::memory_order_relaxed) == 0)
+                {
+                    return polling_status::idle;
+                }
+
+                std::unique_lock<hpx::util::spinlock> l(
+                    mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                {
+                    // another thread is polling already
+                    return polling_status::busy;
+                }
+
+                submit_locked();
+
+                io_uring_cqe* cqes[completion_batch];
+                unsigned const count =
+                    io_uring_peek_batch_cqe(&ring_, cqes, completion_batch);
+
+                std::pair<operation*, int> completed[completion_batch];
+                for (unsigned i = 0; i != count; ++i)
+                {
+                    completed[i].first =
+                        static_cast<operation*>(io_uring_cqe_get_data(cqes[i]));
+                    completed[i].second = cqes[i]->res;
+                }
+                io_uring_cq_advance(&ring_, count);
+
+                l.unlock();
+
+                // make the futures ready without holding the lock, this may
+                // run continuations
+                for (unsigned i = 0; i != count; ++i)
+                {
+                    std::unique_ptr<operation> op(completed[i].first);
+                    op->complete(completed[i].second);
+                }
+                pending_.fetch_sub(count, std::memory_order_relaxed);
+
+                return polling_status::busy;
+            }
+
+            std::size_t get_work_count() const noexcept
+            {
+                return pending_.load(std::memory_order_relaxed);
+            }
+
+            void register_buffers(iovec const* buffers, unsigned count)
+            {
+                std::lock_guard<hpx::util::spinlock> l(mtx_);
+
+                int const result =
+                    io_uring_register_buffers(&ring_, buffers, count);
+                if (result < 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                        "hpx::io_uring::experimental::register_buffers",
+                        "io_uring_register_buffers failed: {}",
+                        std::strerror(-result));
+                }
+            }
+
+            void unregister_buffers()
+            {
+                std::lock_guard<hpx::util::spinlock> l(mtx_);
+
+                int const result = io_uring_unregister_buffers(&ring_);
+                if (result < 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                        "hpx::io_uring::experimental::unregister_buffers",
+                        "io_uring_unregister_buffers failed: {}",
+                        std::strerror(-result));
+                }
+            }
+
+        private:
+            io_uring_sqe* get_sqe()
+            {
+                io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+                if (sqe == nullptr)
+                {
+                    // the submission queue is full, make room by submitting
+                    // the queued operations right away
+                    submit_locked();
+                    sqe = io_uring_get_sqe(&ring_);
+                    if (sqe == nullptr)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                            "hpx::io_uring::experimental::detail::ring",
+                            "the io_uring submission queue is full");
+                    }
+                }
+                return sqe;
+            }
+
+            std::size_t submit_locked() noexcept
+            {
+                if (queued_ == 0)
+                {
+                    return 0;
+                }
+
+                // the kernel may refuse to accept new operations while the
+                // completion queue is full (-EBUSY), the operations which
+                // have not been accepted are submitted again later
+                int const result = io_uring_submit(&ring_);
+                if (result <= 0)
+                {
+                    return 0;
+                }
+
+                auto const submitted = static_cast<std::size_t>(result);
+                queued_ -= (std::min)(submitted, queued_);
+                return submitted;
+            }
+
+            hpx::util::spinlock mtx_;
+            ::io_uring ring_;
+            std::size_t queued_ = 0;
+            std::atomic<std::size_t> pending_{0};
+        };
+
+        ring& get_ring()
+        {
+            static ring r;
+            return r;
+        }
+
+        // a single io_uring operation transfers at most UINT_MAX bytes, larger
+        // requests complete as short reads or writes
+        unsigned clamp_size(std::size_t size) noexcept
+        {
+            return static_cast<unsigned>((std::min)(size,
+                static_cast<std::size_t>(
+                    (std::numeric_limits<unsigned>::max)())));
+        }
+
+        template <typename T, typename Prepare>
+        hpx::future<T> enqueue(Prepare&& prepare)
+        {
+            try
+            {
+                return get_ring().enqueue<T>(HPX_FORWARD(Prepare, prepare));
+            }
+            catch (...)
+            {
+                return hpx::make_exceptional_future<T>(
+                    std::current_exception());
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        polling_status poll()
+        {
+            return get_ring().poll();
+        }
+
+        std::size_t get_work_count()
+        {
+            return get_ring().get_work_count();
+        }
+
+        void register_polling(hpx::threads::thread_pool_base& pool)
+        {
+            // create the ring before the scheduler starts polling it
+            get_ring();
+
+            auto* sched = pool.get_scheduler();
+            sched->set_io_uring_polling_functions(&poll, &get_work_count);
+        }
+
+        void unregister_polling(hpx::threads::thread_pool_base& pool)
+        {
+            HPX_ASSERT_MSG(get_work_count() == 0,
+                "io_uring polling was disabled while there are operations "
+                "which have not completed. Make sure io_uring polling is not "
+                "disabled too early.");
+
+            auto* sched = pool.get_scheduler();
+            sched->clear_io_uring_polling_function();
+        }
+    }    // namespace detail
+
+    // -------------------------------------------------------------------------
+    hpx::future<std::size_t> async_read(
+        int fd, void* buffer, std::size_t size, std::uint64_t offset)
+    {
+        return detail::enqueue<std::size_t>([&](io_uring_sqe* sqe) {
+            io_uring_prep_read(
+                sqe, fd, buffer, detail::clamp_size(size), offset);
+        });
+    }
+
+    hpx::future<std::size_t> async_write(
+        int fd, void const* buffer, std::size_t size, std::uint64_t offset)
+    {
+        return detail::enqueue<std::size_t>([&](io_uring_sqe* sqe) {
+            io_uring_prep_write(
+                sqe, fd, buffer, detail::clamp_size(size), offset);
+        });
+    }
+
+    hpx::future<void> async_fsync(int fd, bool datasync)
+    {
+        return detail::enqueue<void>([&](io_uring_sqe* sqe) {
+            io_uring_prep_fsync(sqe, fd, datasync ? IORING_FSYNC_DATASYNC : 0);
+        });
+    }
+
+    void register_buffers(iovec const* buffers, unsigned count)
+    {
+        detail::get_ring().register_buffers(buffers, count);
+    }
+
+    void unregister_buffers()
+    {
+        detail::get_ring().unregister_buffers();
+    }
+
+    hpx::future<std::size_t> async_read_fixed(int fd, void* buffer,
+        std::size_t size, std::uint64_t offset, unsigned buffer_index)
+    {
+        return detail::enqueue<std::size_t>([&](io_uring_sqe* sqe) {
+            io_uring_prep_read_fixed(sqe, fd, buffer, detail::clamp_size(size),
+                offset, static_cast<int>(buffer_index));
+        });
+    }
+
+    hpx::future<std::size_t> async_write_fixed(int fd, void const* buffer,
+        std::size_t size, std::uint64_t offset, unsigned buffer_index)
+    {
+        return detail::enqueue<std::size_t>([&](io_uring_sqe* sqe) {
+            io_uring_prep_write_fixed(sqe, fd, buffer,
+                detail::clamp_size(size), offset,
+                static_cast<int>(buffer_index));
+        });
+    }
+
+    std::size_t submit()
+    {
+        return detail::get_ring().submit();
+    }
+}    // namespace hpx::io_uring::experimental
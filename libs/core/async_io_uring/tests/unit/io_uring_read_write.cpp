@@ -0,0 +1,149 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/async_io_uring.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace io_uring = hpx::io_uring::experimental;
+
+constexpr std::size_t num_blocks = 64;
+constexpr std::size_t block_size = 4096;
+
+char block_value(std::size_t block, std::size_t i)
+{
+    return static_cast<char>('a' + (block + i) % 26);
+}
+
+void test_read_write(int fd)
+{
+    // queue all writes at once, they are submitted in batches
+    std::vector<std::vector<char>> blocks(num_blocks);
+    std::vector<hpx::future<std::size_t>> writes;
+    for (std::size_t b = 0; b != num_blocks; ++b)
+    {
+        blocks[b].resize(block_size);
+        for (std::size_t i = 0; i != block_size; ++i)
+        {
+            blocks[b][i] = block_value(b, i);
+        }
+        writes.push_back(io_uring::async_write(fd, blocks[b].data(),
+            block_size, static_cast<std::uint64_t>(b * block_size)));
+    }
+
+    for (auto& f : writes)
+    {
+        HPX_TEST_EQ(f.get(), block_size);
+    }
+    io_uring::async_fsync(fd).get();
+
+    // read the blocks back in reverse order
+    std::vector<char> data(num_blocks * block_size);
+    std::vector<hpx::future<std::size_t>> reads;
+    for (std::size_t b = num_blocks; b != 0; --b)
+    {
+        reads.push_back(io_uring::async_read(fd,
+            data.data() + (b - 1) * block_size, block_size,
+            static_cast<std::uint64_t>((b - 1) * block_size)));
+    }
+
+    for (auto& f : reads)
+    {
+        HPX_TEST_EQ(f.get(), block_size);
+    }
+    for (std::size_t b = 0; b != num_blocks; ++b)
+    {
+        for (std::size_t i = 0; i != block_size; ++i)
+        {
+            HPX_TEST_EQ(data[b * block_size + i], block_value(b, i));
+        }
+    }
+
+    // reading beyond the end of the file reads nothing
+    HPX_TEST_EQ(io_uring::async_read(fd, data.data(), block_size,
+                    static_cast<std::uint64_t>(num_blocks * block_size))
+                    .get(),
+        static_cast<std::size_t>(0));
+}
+
+void test_registered_buffers(int fd)
+{
+    std::vector<char> buffer(2 * block_size);
+    iovec iov{buffer.data(), buffer.size()};
+    io_uring::register_buffers(&iov, 1);
+
+    for (std::size_t i = 0; i != block_size; ++i)
+    {
+        buffer[i] = block_value(7, i);
+    }
+    HPX_TEST_EQ(
+        io_uring::async_write_fixed(fd, buffer.data(), block_size, 0, 0).get(),
+        block_size);
+    HPX_TEST_EQ(io_uring::async_read_fixed(
+                    fd, buffer.data() + block_size, block_size, 0, 0)
+                    .get(),
+        block_size);
+
+    for (std::size_t i = 0; i != block_size; ++i)
+    {
+        HPX_TEST_EQ(buffer[block_size + i], block_value(7, i));
+    }
+
+    io_uring::unregister_buffers();
+}
+
+void test_error()
+{
+    // the error is reported through the future
+    char c = 0;
+    bool caught_exception = false;
+    try
+    {
+        io_uring::async_read(-1, &c, 1, 0).get();
+    }
+    catch (std::system_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    std::string filename = "io_uring_read_write_XXXXXX";
+    int fd = mkstemp(filename.data());
+    HPX_TEST(fd >= 0);
+
+    {
+        io_uring::enable_user_polling polling;
+
+        test_read_write(fd);
+        test_registered_buffers(fd);
+        test_error();
+    }
+
+    close(fd);
+    unlink(filename.c_str());
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -27,6 +27,17 @@
 
 namespace hpx { namespace mpi { namespace experimental {
 
+    // -----------------------------------------------------------------
+    // how the outstanding MPI requests are polled for completion
+    enum class polling_mode : std::uint8_t
+    {
+        // by the scheduling loop of the worker threads of a thread pool
+        scheduler,
+        // by a dedicated (non-HPX) thread, started by init and stopped by
+        // finalize
+        thread
+    };
+
     // -----------------------------------------------------------------
     namespace detail {
 
@@ -117,7 +128,8 @@ namespace hpx { namespace mpi { namespace experimental {
             bool error_handler_initialized_ = false;
             int rank_ = -1;
             int size_ = -1;
-            // requests vector holds the requests that are checked
+            polling_mode polling_mode_ = polling_mode::scheduler;
+            // the number of active requests in the requests vector
             std::atomic<std::uint32_t> requests_vector_size_{0};
             // requests queue holds the requests recently added
             std::atomic<std::uint32_t> requests_queue_size_{0};
@@ -141,9 +153,13 @@ namespace hpx { namespace mpi { namespace experimental {
         // -----------------------------------------------------------------
         // we track requests and callbacks in two vectors even though
         // we have the request stored in the request_callback vector already
-        // the reason for this is because we can use MPI_Testany
+        // the reason for this is because we can use MPI_Testsome
         // with a vector of requests to save overheads compared
-        // to testing one by one every item (using a list)
+        // to testing one by one every item (using a list). The vectors form
+        // a table whose slots are reused once their request has completed,
+        // the table only grows if all slots are in use and is never
+        // compacted, so that it is not reallocated while the number of
+        // outstanding requests is stable
         HPX_CORE_EXPORT std::vector<MPI_Request>& get_requests_vector();
 
         // -----------------------------------------------------------------
@@ -233,9 +249,12 @@ namespace hpx { namespace mpi { namespace experimental {
 
     // initialize the hpx::mpi background request handler
     // All ranks should call this function,
-    // but only one thread per rank needs to do so
+    // but only one thread per rank needs to do so. The requests are polled
+    // by the given pool or, in polling_mode::thread, by a dedicated thread
+    // (the pool name is ignored in that case)
     HPX_CORE_EXPORT void init(bool init_mpi = false,
-        std::string const& pool_name = "", bool init_errorhandler = false);
+        std::string const& pool_name = "", bool init_errorhandler = false,
+        polling_mode mode = polling_mode::scheduler);
 
     // -----------------------------------------------------------------
     HPX_CORE_EXPORT void finalize(std::string const& pool_name = "");
@@ -245,11 +264,12 @@ namespace hpx { namespace mpi { namespace experimental {
     // handled elsewhere
     struct [[nodiscard]] enable_user_polling
     {
-        enable_user_polling(
-            std::string const& pool_name = "", bool init_errorhandler = false)
+        enable_user_polling(std::string const& pool_name = "",
+            bool init_errorhandler = false,
+            polling_mode mode = polling_mode::scheduler)
           : pool_name_(pool_name)
         {
-            mpi::experimental::init(false, pool_name, init_errorhandler);
+            mpi::experimental::init(false, pool_name, init_errorhandler, mode);
         }
 
         ~enable_user_polling()
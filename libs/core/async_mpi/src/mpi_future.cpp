@@ -19,6 +19,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,9 +56,27 @@ namespace hpx { namespace mpi { namespace experimental {
 
         std::size_t get_num_active_requests_in_vector()
         {
-            return std::count_if(detail::get_requests_vector().begin(),
-                detail::get_requests_vector().end(),
-                [](MPI_Request r) { return r != MPI_REQUEST_NULL; });
+            return get_mpi_info().requests_vector_size_;
+        }
+
+        // the slots of the request table whose request has completed
+        std::vector<std::size_t>& get_free_slots()
+        {
+            static std::vector<std::size_t> free_slots;
+            return free_slots;
+        }
+
+        // buffers passed to MPI_Testsome, reused by every poll
+        std::vector<int>& get_completed_indices()
+        {
+            static std::vector<int> completed_indices;
+            return completed_indices;
+        }
+
+        std::vector<MPI_Status>& get_completed_statuses()
+        {
+            static std::vector<MPI_Status> completed_statuses;
+            return completed_statuses;
         }
 
         // used internally to add an MPI_Request to the lockfree queue
@@ -77,13 +96,25 @@ namespace hpx { namespace mpi { namespace experimental {
         }
 
         // used internally to add a request to the main polling vector
-        // that is passed to MPI_Testany
+        // that is passed to MPI_Testsome, the request takes a free slot if
+        // there is one
         void add_to_request_callback_vector(request_callback&& req_callback)
         {
-            get_requests_vector().push_back(req_callback.request);
-            get_request_callback_vector().push_back(std::move(req_callback));
-            get_mpi_info().requests_vector_size_ =
-                static_cast<std::uint32_t>(get_requests_vector().size());
+            auto& free_slots = get_free_slots();
+            if (free_slots.empty())
+            {
+                get_requests_vector().push_back(req_callback.request);
+                get_request_callback_vector().push_back(
+                    std::move(req_callback));
+            }
+            else
+            {
+                std::size_t const index = free_slots.back();
+                free_slots.pop_back();
+                get_requests_vector()[index] = req_callback.request;
+                get_request_callback_vector()[index] = std::move(req_callback);
+            }
+            ++(get_mpi_info().requests_vector_size_);
 
             if constexpr (mpi_debug.is_enabled())
             {
@@ -236,124 +267,81 @@ namespace hpx { namespace mpi { namespace experimental {
             }
         }
 
-        bool keep_trying = !requests_vector.empty();
-        while (keep_trying)
+        if (detail::get_mpi_info().requests_vector_size_ == 0)
         {
-            int index = 0;
-            int flag = 0;
-            MPI_Status status;
+            return polling_status::idle;
+        }
 
-            int result = MPI_Testany(static_cast<int>(requests_vector.size()),
-                requests_vector.data(), &index, &flag, &status);
+        // test all requests at once and handle the completed ones as a batch
+        auto& indices = detail::get_completed_indices();
+        auto& statuses = detail::get_completed_statuses();
+        indices.resize(requests_vector.size());
+        statuses.resize(requests_vector.size());
 
-            if constexpr (mpi_debug.is_enabled())
-            {
-                if (result == MPI_SUCCESS)
-                {
-                    static auto poll_deb =
-                        mpi_debug.make_timer(1, debug::str<>("Poll - success"));
-
-                    mpi_debug.timed(poll_deb, detail::get_mpi_info(),
-                        debug::str<>("Success"), "index",
-                        debug::dec<>(index == MPI_UNDEFINED ? -1 : index),
-                        "flag", debug::dec<>(flag), "status",
-                        debug::hex(status.MPI_ERROR));
-                }
-                else
-                {
-                    auto poll_deb =
-                        mpi_debug.make_timer(1, debug::str<>("Poll - <ERR>"));
-
-                    mpi_debug.error(poll_deb, detail::get_mpi_info(),
-                        debug::str<>("Poll <ERR>"), "MPI_ERROR",
-                        detail::error_message(status.MPI_ERROR), "status",
-                        debug::dec<>(status.MPI_ERROR), "index",
-                        debug::dec<>(index), "flag", debug::dec<>(flag));
-                }
-            }
-
-            // No operation completed
-            if (index == MPI_UNDEFINED)
-                break;
+        int outcount = 0;
+        int const result =
+            MPI_Testsome(static_cast<int>(requests_vector.size()),
+                requests_vector.data(), &outcount, indices.data(),
+                statuses.data());
 
-            keep_trying = flag;
-            if constexpr (mpi_debug.is_enabled())
-            {
-                // One operation completed
-                if (keep_trying)
-                {
-                    mpi_debug.debug(debug::str<>("MPI_Testany(set)"),
-                        detail::get_mpi_info(), "request",
-                        debug::hex<8>(requests_vector[std::size_t(index)]),
-                        "vector size", debug::dec<3>(requests_vector.size()),
-                        "non null",
-                        debug::dec<3>(
-                            detail::get_num_active_requests_in_vector()));
-                }
-            }
-            if (result != MPI_SUCCESS)    // Error and operation not completed
-                keep_trying = false;
-            if (keep_trying || result != MPI_SUCCESS)
-            {
-                // Invoke the callback with the status of the completed
-                // operation (status of the request is forwarded to MPI_Testany)
-                request_callback_vector[std::size_t(index)].callback_function(
-                    result);
-
-                // Remove the request from our vector to prevent retesting
-                requests_vector[std::size_t(index)] = MPI_REQUEST_NULL;
-
-                // Could store only the callbacks, right now the request
-                // is only used for an assert
-                request_callback_vector[std::size_t(index)].request =
-                    MPI_REQUEST_NULL;
-            }
+        if (result != MPI_SUCCESS && result != MPI_ERR_IN_STATUS)
+        {
+            // it is unknown which requests the error refers to
+            mpi_debug.error(debug::str<>("Poll <ERR>"), detail::get_mpi_info(),
+                "MPI_ERROR", detail::error_message(result));
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "hpx::mpi::experimental::poll",
+                "MPI_Testsome failed: {}", detail::error_message(result));
         }
 
-        // if there are more than 25% NULL request handles in our vector,
-        // compact them
-        if (!requests_vector.empty())
+        // all requests are MPI_REQUEST_NULL
+        if (outcount == MPI_UNDEFINED)
         {
-            std::size_t nulls = std::count(requests_vector.begin(),
-                requests_vector.end(), MPI_REQUEST_NULL);
+            outcount = 0;
+        }
 
-            if (nulls > requests_vector.size() / 4)    //-V112
-            {
-                // compact away any requests that have been replaced by
-                // MPI_REQUEST_NULL
-                auto end1 = std::remove(requests_vector.begin(),
-                    requests_vector.end(), MPI_REQUEST_NULL);
-                requests_vector.resize(
-                    std::distance(requests_vector.begin(), end1));
-
-                auto end2 = std::remove_if(request_callback_vector.begin(),
-                    request_callback_vector.end(),
-                    [](detail::request_callback& req_callback) {
-                        return req_callback.request == MPI_REQUEST_NULL;
-                    });
-                request_callback_vector.resize(
-                    std::distance(request_callback_vector.begin(), end2));
-
-                if (requests_vector.size() != request_callback_vector.size())
-                {
-                    HPX_THROW_EXCEPTION(hpx::error::invalid_status,
-                        "hpx::mpi::experimental::poll",
-                        "Fatal Error: Mismatch in vectors");
-                }
+        if constexpr (mpi_debug.is_enabled())
+        {
+            static auto poll_deb =
+                mpi_debug.make_timer(1, debug::str<>("Poll - success"));
 
-                detail::get_mpi_info().requests_vector_size_ =
-                    static_cast<std::uint32_t>(requests_vector.size());
+            mpi_debug.timed(poll_deb, detail::get_mpi_info(),
+                debug::str<>("Success"), "completed", debug::dec<>(outcount),
+                "vector size", debug::dec<3>(requests_vector.size()));
+        }
 
-                if constexpr (mpi_debug.is_enabled())
-                {
-                    mpi_debug.debug(debug::str<>("MPI_REQUEST_NULL"),
-                        detail::get_mpi_info(), "nulls ", debug::dec<>(nulls));
-                }
-            }
+        for (int i = 0; i != outcount; ++i)
+        {
+            std::size_t const index = static_cast<std::size_t>(indices[i]);
+
+            // the status of every request is reported only if any of them
+            // failed
+            int const status = result == MPI_ERR_IN_STATUS ?
+                statuses[i].MPI_ERROR :
+                MPI_SUCCESS;
+
+            // free the slot before invoking the callback, MPI_Testsome has
+            // already set the request to MPI_REQUEST_NULL
+            requests_vector[index] = MPI_REQUEST_NULL;
+            detail::request_callback_function_type callback =
+                HPX_MOVE(request_callback_vector[index].callback_function);
+            request_callback_vector[index].request = MPI_REQUEST_NULL;
+            detail::get_free_slots().push_back(index);
+            --(detail::get_mpi_info().requests_vector_size_);
+
+            // Invoke the callback with the status of the completed operation
+            callback(status);
         }
 
-        return requests_vector.empty() ? polling_status::idle :
-                                         polling_status::busy;
+        // all slots are free, start filling the table from the beginning
+        if (detail::get_mpi_info().requests_vector_size_ == 0)
+        {
+            requests_vector.clear();
+            request_callback_vector.clear();
+            detail::get_free_slots().clear();
+            return polling_status::idle;
+        }
+        return polling_status::busy;
     }
 
     namespace detail {
@@ -413,13 +401,69 @@ namespace hpx { namespace mpi { namespace experimental {
             auto* sched = pool.get_scheduler();
             sched->clear_mpi_polling_function();
         }
+
+        // -------------------------------------------------------------
+        // the thread polling the requests in polling_mode::thread
+        struct polling_thread
+        {
+            std::thread thread_;
+            std::atomic<bool> stop_{false};
+        };
+
+        polling_thread& get_polling_thread()
+        {
+            static polling_thread polling_thread_;
+            return polling_thread_;
+        }
+
+        void start_polling_thread()
+        {
+#if defined(HPX_DEBUG)
+            ++get_register_polling_count();
+#endif
+            mpi_debug.debug(debug::str<>("start polling thread"));
+
+            polling_thread& pt = get_polling_thread();
+            HPX_ASSERT(!pt.thread_.joinable());
+
+            pt.stop_.store(false, std::memory_order_relaxed);
+            pt.thread_ = std::thread([&pt]() {
+                using hpx::threads::policies::detail::polling_status;
+                while (!pt.stop_.load(std::memory_order_acquire))
+                {
+                    if (hpx::mpi::experimental::poll() == polling_status::idle)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        void stop_polling_thread()
+        {
+#if defined(HPX_DEBUG)
+            HPX_ASSERT_MSG(get_request_callback_queue().size_approx() == 0 &&
+                    get_num_active_requests_in_vector() == 0,
+                "MPI request polling was disabled while there are active "
+                "MPI requests. Make sure MPI request polling is not disabled "
+                "too early.");
+#endif
+            mpi_debug.debug(debug::str<>("stop polling thread"));
+
+            polling_thread& pt = get_polling_thread();
+            pt.stop_.store(true, std::memory_order_release);
+            if (pt.thread_.joinable())
+            {
+                pt.thread_.join();
+            }
+        }
     }    // namespace detail
 
     // initialize the hpx::mpi background request handler
     // All ranks should call this function,
     // but only one thread per rank needs to do so
-    void init(
-        bool init_mpi, std::string const& pool_name, bool init_errorhandler)
+    void init(bool init_mpi, std::string const& pool_name,
+        bool init_errorhandler, polling_mode mode)
     {
         if (init_mpi)
         {
@@ -464,8 +508,13 @@ namespace hpx { namespace mpi { namespace experimental {
             detail::get_mpi_info().error_handler_initialized_ = true;
         }
 
+        detail::get_mpi_info().polling_mode_ = mode;
+        if (mode == polling_mode::thread)
+        {
+            detail::start_polling_thread();
+        }
         // install polling loop on requested thread pool
-        if (pool_name.empty())
+        else if (pool_name.empty())
         {
             detail::register_polling(hpx::resource::get_thread_pool(0));
         }
@@ -479,6 +528,14 @@ namespace hpx { namespace mpi { namespace experimental {
 
     void finalize(std::string const& pool_name)
     {
+        // the polling thread must not call into MPI after it was finalized
+        bool const polling_thread =
+            detail::get_mpi_info().polling_mode_ == polling_mode::thread;
+        if (polling_thread)
+        {
+            detail::stop_polling_thread();
+        }
+
         if (detail::get_mpi_info().error_handler_initialized_)
         {
             HPX_ASSERT(detail::hpx_mpi_errhandler != 0);
@@ -493,7 +550,11 @@ namespace hpx { namespace mpi { namespace experimental {
         mpi_debug.debug(debug::str<>("Clearing mode"), detail::get_mpi_info(),
             "disable_user_polling");
 
-        if (pool_name.empty())
+        if (polling_thread)
+        {
+            detail::get_mpi_info().polling_mode_ = polling_mode::scheduler;
+        }
+        else if (pool_name.empty())
         {
             detail::unregister_polling(hpx::resource::get_thread_pool(0));
         }
@@ -80,6 +80,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
     const std::uint64_t iterations = vm["iterations"].as<std::uint64_t>();
     //
     output = vm.count("output") != 0;
+    auto const mode = vm.count("polling-thread") != 0 ?
+        hpx::mpi::experimental::polling_mode::thread :
+        hpx::mpi::experimental::polling_mode::scheduler;
 
     if (rank == 0 && output)
     {
@@ -90,7 +93,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     {
         // this needs to scope all uses of hpx::mpi::experimental::executor
-        hpx::mpi::experimental::enable_user_polling enable_polling;
+        hpx::mpi::experimental::enable_user_polling enable_polling(
+            "", false, mode);
 
         // Ring send/recv around N ranks
         // Rank 0      : Send then Recv
@@ -194,7 +198,9 @@ int main(int argc, char* argv[])
         value<std::uint64_t>()->default_value(5000),
         "number of iterations to test")
 
-        ("output", "display messages during test");
+        ("output", "display messages during test")
+
+        ("polling-thread", "poll the MPI requests from a dedicated thread");
     // clang-format on
 
     // Initialize and run HPX.
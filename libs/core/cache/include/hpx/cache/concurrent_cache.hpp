@@ -0,0 +1,695 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache is a local cache which may be accessed
+    ///        by several threads at the same time.
+    ///
+    /// The entries are distributed over a number of shards based on the hash
+    /// of their keys. Every shard is protected by its own lock and keeps its
+    /// entries in a hash map and a list ordered by the time of their last
+    /// access, all operations on a single key take constant time. If the
+    /// capacity of a shard is exceeded, the entry comparing greatest (using
+    /// the operator< of \a Entry, as the default UpdatePolicy of the
+    /// \a local_cache does) out of the few least recently accessed entries
+    /// of the shard is discarded. For a \a lru_entry this is the least
+    /// recently used entry.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache,
+    ///                       must model the CacheEntry concept
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. Every shard collects its own
+    ///                       statistics. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty
+    ///                       stubs allowing the code to compile.
+    /// \tparam Mutex         A (optional) type of the lock protecting a
+    ///                       shard. The default is std::mutex.
+    /// \tparam Hash          A (optional) hash function for the keys. The
+    ///                       default is std::hash<Key>.
+    /// \tparam KeyEqual      A (optional) function object comparing two keys
+    ///                       for equality. The default is
+    ///                       std::equal_to<Key>.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Mutex = std::mutex, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using mutex_type = Mutex;
+        using value_type = typename entry_type::value_type;
+        using size_type = std::size_t;
+        using entry_pair = std::pair<key_type, entry_type>;
+
+        /// The number of least recently accessed entries of a shard which are
+        /// considered for removal if the shard is full
+        static constexpr size_type eviction_candidates = 4;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        struct shard
+        {
+            using storage_type = std::list<entry_pair>;
+            using map_type = std::unordered_map<key_type,
+                typename storage_type::iterator, Hash, KeyEqual>;
+
+            mutable mutex_type mtx_;
+            storage_type storage_;
+            map_type map_;
+            size_type current_size_ = 0;
+            size_type max_size_ = 0;
+            statistics_type statistics_;
+        };
+
+        static size_type default_num_shards() noexcept
+        {
+            size_type const cores = std::thread::hardware_concurrency();
+            return cores != 0 ? 4 * cores : 16;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is usually
+        ///                   determined by the unit of the values returned by
+        ///                   the entry's \a get_size function. The capacity is
+        ///                   distributed evenly between the shards.
+        /// \param num_shards [in] The number of shards the entries are
+        ///                   distributed over, this is rounded up to the next
+        ///                   power of two. The default is zero, which creates
+        ///                   four shards per core.
+        explicit concurrent_cache(
+            size_type max_size = 0, size_type num_shards = 0)
+          : max_size_(max_size)
+        {
+            if (num_shards == 0)
+            {
+                num_shards = default_num_shards();
+            }
+
+            size_type n = 1;
+            while (n < num_shards)
+            {
+                n *= 2;
+            }
+
+            shards_.reserve(n);
+            for (size_type i = 0; i != n; ++i)
+            {
+                shards_.push_back(std::make_unique<shard>());
+            }
+            distribute_capacity();
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache(concurrent_cache&&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache&&) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance, the sum of the
+        ///          sizes of all shards.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (auto const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                result += s->current_size_;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \note The unit of this value is usually determined by the unit of
+        ///       the return values of the entry's function \a entry#get_size.
+        ///
+        /// \returns The maximum size this cache instance is currently allowed
+        ///          to reach. If this number is zero the cache has no limit.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_;
+        }
+
+        /// \brief Return the number of shards of the cache.
+        [[nodiscard]] size_type num_shards() const noexcept
+        {
+            return shards_.size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        /// \note This function must not be called while the cache is accessed
+        ///       concurrently.
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            distribute_capacity();
+
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                while (s->max_size_ != 0 && s->current_size_ > s->max_size_ &&
+                    evict(*s))
+                {
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param k      [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not call the entry's function
+        ///               \a entry#touch. It just checks if the cache contains
+        ///               an entry corresponding to the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& k) const
+        {
+            shard const& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.map_.find(k) != s.map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param k      [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] Return the full real key found in the cache
+        /// \param val    [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the value corresponding to the provided
+        ///               key is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& k, key_type& realkey, entry_type& val)
+        {
+            shard& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            auto const it = s.map_.find(k);
+            if (it == s.map_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            touch(s, it->second);
+
+            // got hit
+            s.statistics_.got_hit();    // update statistics
+
+            realkey = it->second->first;
+            val = it->second->second;
+            return true;
+        }
+
+        /// \copydoc get_entry(key_type const&, key_type&, entry_type&)
+        bool get_entry(key_type const& k, entry_type& val)
+        {
+            key_type tmp;
+            return get_entry(k, tmp, val);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param k      [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param val    [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding value.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the value corresponding to the provided
+        ///               key is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& k, value_type& val)
+        {
+            shard& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            auto const it = s.map_.find(k);
+            if (it == s.map_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            touch(s, it->second);
+
+            // got hit
+            s.statistics_.got_hit();    // update statistics
+
+            val = it->second->second.get();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new element into this cache
+        ///
+        /// \param k      [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param val    [in] The value which should be added to the cache.
+        ///
+        /// \note         This function invokes the entry's function
+        ///               \a entry#insert. If it returns false, the key/value
+        ///               pair will be not inserted into the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache, otherwise it returns
+        ///               \a false.
+        bool insert(key_type const& k, value_type const& val)
+        {
+            return insert(k, entry_type(val));
+        }
+
+        /// \copydoc insert(key_type const&, value_type const&)
+        bool insert(key_type const& k, value_type&& val)
+        {
+            return insert(k, entry_type(HPX_MOVE(val)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param k      [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param e      [in] The entry which should be added to the cache.
+        ///
+        /// \note         This function invokes the entry's function
+        ///               \a entry#insert. If it returns false, the key/value
+        ///               pair will be not inserted into the cache. The entry
+        ///               is not inserted either if the key is held by the
+        ///               cache already, or if its shard is full and none of
+        ///               the existing entries may be removed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache, otherwise it returns
+        ///               \a false.
+        template <typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool insert(key_type const& k, Entry_&& e)
+        {
+            shard& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::insert_entry);
+
+            if (s.map_.find(k) != s.map_.end())
+            {
+                return false;
+            }
+            return insert_nonexist(s, k, HPX_FORWARD(Entry_, e));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param k      [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param val    [in] The value which should be used as a replacement
+        ///               for the existing value in the cache. Any existing
+        ///               cache entry is not changed except for its value.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the indexed value is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename Value,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Value>, value_type>, int> =
+                0>
+        bool update(key_type const& k, Value&& val)
+        {
+            return update_if(k, HPX_FORWARD(Value, val),
+                [](key_type const&, key_type const&) { return false; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param k      [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param val    [in] The value which should be used as a replacement
+        ///               for the existing value in the cache. Any existing
+        ///               cache entry is not changed except for its value.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \note         The function will call the entry's \a entry#touch
+        ///               function if the indexed value is found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F, typename Value,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Value>, value_type>, int> =
+                0>
+        bool update_if(key_type const& k, Value&& val, F&& f)
+        {
+            shard& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            auto const it = s.map_.find(k);
+            if (it == s.map_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                return insert_nonexist(
+                    s, k, entry_type(HPX_FORWARD(Value, val)));
+            }
+
+            if (f(k, it->second->first))
+            {
+                return false;
+            }
+
+            // got hit!
+            it->second->second.get() = HPX_FORWARD(Value, val);
+            touch(s, it->second);
+
+            s.statistics_.got_hit();    // update statistics
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove the entry identified by the given key
+        ///
+        /// \returns      This function returns the size of the removed entry
+        ///               (zero if the cache does not hold the key).
+        size_type erase(key_type const& k)
+        {
+            shard& s = get_shard(k);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::erase_entry);
+
+            auto const it = s.map_.find(k);
+            if (it == s.map_.end())
+            {
+                return 0;
+            }
+
+            size_type const entry_size = it->second->second.get_size();
+            remove(s, it->second);
+
+            s.statistics_.got_eviction();    // update statistics
+            return entry_size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache (an object of the type
+        ///               \a entry_pair). An entry is considered for removal
+        ///               from the cache whenever the value returned from this
+        ///               invocation is \a true. The shards are locked one
+        ///               after the other while the function is invoked for
+        ///               their entries.
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries (which is the sum of the values returned by
+        ///               the \a entry#get_size functions of the removed
+        ///               entries).
+        template <typename Func = policies::always<entry_pair>,
+            typename =
+                std::enable_if_t<std::is_invocable_v<Func const&, entry_pair&>>>
+        size_type erase(Func const& ep = Func())
+        {
+            size_type erased = 0;
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                update_on_exit update(
+                    s->statistics_, statistics::method::erase_entry);
+
+                for (auto it = s->storage_.begin(); it != s->storage_.end();)
+                {
+                    auto const current = it++;
+                    if (ep(*current))
+                    {
+                        erased += current->second.get_size();
+                        remove(*s, current);
+
+                        s->statistics_.got_eviction();    // update statistics
+                    }
+                }
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache and
+        /// resets the statistics of all shards.
+        void clear()
+        {
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                s->map_.clear();
+                s->storage_.clear();
+                s->current_size_ = 0;
+                s->statistics_.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Invoke the given function for the statistics of every shard
+        ///
+        /// \param f      [in] A callable taking a reference to the
+        ///               \a statistics_type of a shard, it is invoked for
+        ///               every shard while holding the lock of the shard.
+        ///               This can be used to accumulate the statistics of all
+        ///               shards, for instance:
+        ///
+        /// \code
+        ///     std::size_t hits = 0;
+        ///     cache.for_each_statistics(
+        ///         [&](auto& stat) { hits += stat.hits(false); });
+        /// \endcode
+        template <typename F>
+        void for_each_statistics(F&& f)
+        {
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                f(s->statistics_);
+            }
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] size_type shard_index(key_type const& k) const
+        {
+            // spread the bits of the hash, std::hash is the identity for
+            // integers on many platforms
+            std::size_t h = Hash()(k);
+            h ^= h >> 33;
+            h *= static_cast<std::size_t>(0xff51afd7ed558ccdULL);
+            h ^= h >> 33;
+            return h & (shards_.size() - 1);
+        }
+
+        [[nodiscard]] shard& get_shard(key_type const& k)
+        {
+            return *shards_[shard_index(k)];
+        }
+
+        [[nodiscard]] shard const& get_shard(key_type const& k) const
+        {
+            return *shards_[shard_index(k)];
+        }
+
+        void distribute_capacity()
+        {
+            size_type const n = shards_.size();
+            size_type const shard_size =
+                max_size_ != 0 ? (max_size_ + n - 1) / n : 0;
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                s->max_size_ = shard_size;
+            }
+        }
+
+        // mark the entry as the most recently accessed one of its shard
+        static void touch(shard& s, typename shard::storage_type::iterator it)
+        {
+            it->second.touch();
+            s.storage_.splice(s.storage_.begin(), s.storage_, it);
+        }
+
+        static void remove(shard& s, typename shard::storage_type::iterator it)
+        {
+            s.current_size_ -= it->second.get_size();
+            s.map_.erase(it->first);
+            s.storage_.erase(it);
+        }
+
+        template <typename Entry_>
+        static bool insert_nonexist(shard& s, key_type const& k, Entry_&& e)
+        {
+            // ask entry if it really wants to be inserted
+            if (!e.insert())
+            {
+                return false;
+            }
+
+            // make sure the shard doesn't get too large
+            size_type const entry_size = e.get_size();
+            if (s.max_size_ != 0)
+            {
+                if (entry_size > s.max_size_)
+                {
+                    return false;
+                }
+                while (s.current_size_ + entry_size > s.max_size_)
+                {
+                    if (!evict(s))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            s.storage_.emplace_front(k, HPX_FORWARD(Entry_, e));
+            try
+            {
+                s.map_.emplace(k, s.storage_.begin());
+            }
+            catch (...)
+            {
+                s.storage_.pop_front();
+                throw;
+            }
+            s.current_size_ += entry_size;
+
+            s.statistics_.got_insertion();    // update statistics
+            return true;
+        }
+
+        // Remove the 'oldest' (according to the ordering of the entries) of
+        // the least recently accessed entries which may be removed, this
+        // considers a constant number of entries only
+        static bool evict(shard& s)
+        {
+            using iterator = typename shard::storage_type::iterator;
+
+            iterator victim = s.storage_.end();
+            size_type candidates = 0;
+            for (auto it = s.storage_.rbegin();
+                 it != s.storage_.rend() && candidates != eviction_candidates;
+                 ++it)
+            {
+                if (!it->second.remove())
+                {
+                    continue;    // do not remove this entry from the cache
+                }
+
+                // the entry comparing greatest is discarded first
+                iterator const current = std::prev(it.base());
+                if (victim == s.storage_.end() ||
+                    victim->second < current->second)
+                {
+                    victim = current;
+                }
+                ++candidates;
+            }
+
+            if (victim == s.storage_.end())
+            {
+                return false;
+            }
+
+            remove(s, victim);
+            s.statistics_.got_eviction();    // update statistics
+            return true;
+        }
+
+    private:
+        size_type max_size_;
+        std::vector<std::unique_ptr<shard>> shards_;
+    };
+}    // namespace hpx::util::cache
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <hpx/cache/policies/always.hpp>
 #include <hpx/cache/statistics/no_statistics.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <list>
 #include <map>
 #include <type_traits>
@@ -34,19 +36,41 @@ namespace hpx::util::cache {
     ///                       the type \a statistics#no_statistics which does
     ///                       not collect any numbers, but provides empty stubs
     ///                       allowing the code to compile.
+    /// \tparam AdmissionPolicy A (optional) type deciding which entries are
+    ///                       admitted to the cache if it is full. The default
+    ///                       is \a policies#always_admit, which admits every
+    ///                       new entry, evicting the least recently used one.
+    ///                       Using \a policies#tinylfu turns the cache into a
+    ///                       W-TinyLFU cache: new entries are inserted into a
+    ///                       small window and enter the main part of the
+    ///                       cache only if they are accessed more frequently
+    ///                       than the entry they would replace.
     template <typename Key, typename Entry,
-        typename Statistics = statistics::no_statistics>
+        typename Statistics = statistics::no_statistics,
+        typename AdmissionPolicy = policies::always_admit<Key>>
     class lru_cache
     {
     public:
         using key_type = Key;
         using entry_type = Entry;
         using statistics_type = Statistics;
+        using admission_policy_type = AdmissionPolicy;
         using entry_pair = std::pair<key_type, entry_type>;
         using storage_type = std::list<entry_pair>;
-        using map_type = std::map<Key, typename storage_type::iterator>;
         using size_type = std::size_t;
 
+    private:
+        // the position of an entry, either in the window or in the main part
+        // of the cache
+        struct location
+        {
+            typename storage_type::iterator it;
+            bool in_window;
+        };
+
+    public:
+        using map_type = std::map<Key, location>;
+
     private:
         using update_on_exit = typename statistics_type::update_on_exit;
 
@@ -62,6 +86,8 @@ namespace hpx::util::cache {
         ///
         explicit lru_cache(size_type max_size = 0)
           : max_size_(max_size)
+          , max_window_size_(admission_policy_type::window_size(max_size))
+          , admission_(max_size)
         {
         }
 
@@ -104,6 +130,16 @@ namespace hpx::util::cache {
         ///
         void reserve(size_type max_size)
         {
+            max_window_size_ = admission_policy_type::window_size(max_size);
+            admission_.reserve(max_size);
+
+            // move the entries which do not fit into the window anymore to
+            // the main part of the cache
+            while (window_size_ > max_window_size_)
+            {
+                move_to_main(std::prev(window_.end()));
+            }
+
             if (max_size > max_size_)
             {
                 max_size_ = max_size;
@@ -160,10 +196,12 @@ namespace hpx::util::cache {
             if (it == map_.end())
             {
                 // Got miss
+                admission_.record_access(key);
                 statistics_.got_miss();    // update statistics
                 return false;
             }
 
+            admission_.record_access(it->first);
             touch(it->second);
 
             // update statistics
@@ -171,7 +209,7 @@ namespace hpx::util::cache {
 
             // got hit
             realkey = it->first;
-            entry = it->second->second;
+            entry = it->second.it->second;
 
             return true;
         }
@@ -205,6 +243,10 @@ namespace hpx::util::cache {
         /// \note         This function assumes that the entry is not in the
         ///               cache already. Inserting an already existing entry
         ///               is considered undefined behavior
+        ///
+        /// \returns      This function returns \a false if the key is held
+        ///               by the cache already or if the admission policy
+        ///               refused the entry, otherwise it returns \a true.
         template <typename Entry_,
             typename = std::enable_if_t<
                 std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
@@ -217,30 +259,80 @@ namespace hpx::util::cache {
                 return false;
             }
 
-            insert_nonexist(key, HPX_FORWARD(Entry_, entry));
-            return true;
+            return insert_nonexist(key, HPX_FORWARD(Entry_, entry));
         }
 
     private:
         template <typename Entry_,
             typename = std::enable_if_t<
                 std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
-        void insert_nonexist(key_type const& key, Entry_&& entry)
+        bool insert_nonexist(key_type const& key, Entry_&& entry)
         {
-            // insert ...
-            storage_.emplace_front(key, HPX_FORWARD(Entry_, entry));
-            map_[key] = storage_.begin();
+            if (max_window_size_ == 0)
+            {
+                // ask the admission policy whether the new entry replaces
+                // the least recently used one if the cache is full
+                if (current_size_ + 1 > max_size_ && !storage_.empty() &&
+                    !admission_.admit(key, storage_.back().first))
+                {
+                    return false;
+                }
+
+                // insert ...
+                storage_.emplace_front(key, HPX_FORWARD(Entry_, entry));
+                map_[key] = location{storage_.begin(), false};
+                ++current_size_;
+
+                // update statistics
+                statistics_.got_insertion();
+
+                // Do we need to evict a cache entry?
+                if (current_size_ > max_size_)
+                {
+                    // evict an entry
+                    evict();
+                }
+                return true;
+            }
+
+            // new entries are always inserted into the window
+            window_.emplace_front(key, HPX_FORWARD(Entry_, entry));
+            map_[key] = location{window_.begin(), true};
+            ++window_size_;
             ++current_size_;
 
             // update statistics
             statistics_.got_insertion();
 
+            if (window_size_ > max_window_size_)
+            {
+                // the least recently used entry of the window either enters
+                // the main part of the cache or is evicted
+                auto const candidate = std::prev(window_.end());
+                if (current_size_ > max_size_ && !storage_.empty())
+                {
+                    if (admission_.admit(
+                            candidate->first, storage_.back().first))
+                    {
+                        evict(std::prev(storage_.end()), false);
+                        move_to_main(candidate);
+                    }
+                    else
+                    {
+                        evict(candidate, true);
+                    }
+                    return true;
+                }
+                move_to_main(candidate);
+            }
+
             // Do we need to evict a cache entry?
             if (current_size_ > max_size_)
             {
                 // evict an entry
                 evict();
             }
+            return true;
         }
 
     public:
@@ -273,13 +365,15 @@ namespace hpx::util::cache {
             if (it == map_.end())
             {
                 // got miss
+                admission_.record_access(key);
                 statistics_.got_miss();    // update statistics
                 insert_nonexist(key, HPX_FORWARD(Entry_, entry));
                 return;
             }
 
             // got hit!
-            it->second->second = HPX_FORWARD(Entry_, entry);
+            admission_.record_access(it->first);
+            it->second.it->second = HPX_FORWARD(Entry_, entry);
             touch(it->second);
 
             // update statistics
@@ -326,17 +420,18 @@ namespace hpx::util::cache {
             if (it == map_.end())
             {
                 // got miss
+                admission_.record_access(key);
                 statistics_.got_miss();    // update statistics
-                insert_nonexist(key, HPX_FORWARD(Entry_, entry));
-                return true;
+                return insert_nonexist(key, HPX_FORWARD(Entry_, entry));
             }
 
             if (f(key, it->first))
                 return false;
 
             // got hit!
+            admission_.record_access(it->first);
             touch(it->second);
-            it->second->second = HPX_FORWARD(Entry_, entry);
+            it->second.it->second = HPX_FORWARD(Entry_, entry);
 
             // update statistics
             statistics_.got_hit();
@@ -366,12 +461,21 @@ namespace hpx::util::cache {
             size_type erased = 0;
             for (auto it = map_.begin(); it != map_.end();)
             {
-                auto jt = it->second;
-                if (ep(*jt))
+                location const loc = it->second;
+                if (ep(*loc.it))
                 {
                     ++erased;
 
-                    storage_.erase(jt);
+                    if (loc.in_window)
+                    {
+                        window_.erase(loc.it);
+                        --window_size_;
+                    }
+                    else
+                    {
+                        storage_.erase(loc.it);
+                    }
+                    --current_size_;
                     it = map_.erase(it);
 
                     // update statistics
@@ -406,8 +510,11 @@ namespace hpx::util::cache {
         {
             size_type const erased = current_size_;
             current_size_ = 0;
+            window_size_ = 0;
             map_.clear();
             storage_.clear();
+            window_.clear();
+            admission_.clear();
             return erased;
         }
 
@@ -428,26 +535,60 @@ namespace hpx::util::cache {
         }
 
     private:
-        void touch(typename storage_type::iterator it)
+        void touch(location const& loc)
         {
-            storage_.splice(storage_.begin(), storage_, it);
+            storage_type& list = loc.in_window ? window_ : storage_;
+            list.splice(list.begin(), list, loc.it);
         }
 
-        void evict()
+        void move_to_main(typename storage_type::iterator it)
+        {
+            storage_.splice(storage_.begin(), window_, it);
+            map_[it->first].in_window = false;
+            --window_size_;
+        }
+
+        void evict(typename storage_type::iterator it, bool in_window)
         {
             statistics_.got_eviction();
-            map_.erase(storage_.back().first);
-            storage_.pop_back();
+            map_.erase(it->first);
+            if (in_window)
+            {
+                window_.erase(it);
+                --window_size_;
+            }
+            else
+            {
+                storage_.erase(it);
+            }
             --current_size_;
         }
 
+        // evict the least recently used entry of the main part of the cache,
+        // or of the window if the main part is empty
+        void evict()
+        {
+            if (!storage_.empty())
+            {
+                evict(std::prev(storage_.end()), false);
+            }
+            else
+            {
+                evict(std::prev(window_.end()), true);
+            }
+        }
+
     private:
         size_type max_size_;
         size_type current_size_ = 0;
+        size_type max_window_size_;
+        size_type window_size_ = 0;
 
         storage_type storage_;
+        storage_type window_;
         map_type map_;
 
         statistics_type statistics_;
+        admission_policy_type admission_;
     };
 }    // namespace hpx::util::cache
@@ -8,6 +8,8 @@
 
 #include <hpx/config.hpp>
 
+#include <cstddef>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util::cache::policies {
 
@@ -20,4 +22,31 @@ namespace hpx::util::cache::policies {
             return true;    // always true
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The admission policy of a cache which admits every new entry, it does
+    // not use a window (see tinylfu for the interface of admission policies)
+    template <typename Key>
+    struct always_admit
+    {
+        explicit constexpr always_admit(std::size_t = 0) noexcept {}
+
+        static constexpr void reserve(std::size_t) noexcept {}
+
+        [[nodiscard]] static constexpr std::size_t window_size(
+            std::size_t) noexcept
+        {
+            return 0;
+        }
+
+        static constexpr void record_access(Key const&) noexcept {}
+
+        [[nodiscard]] static constexpr bool admit(
+            Key const&, Key const&) noexcept
+        {
+            return true;    // always true
+        }
+
+        static constexpr void clear() noexcept {}
+    };
 }    // namespace hpx::util::cache::policies
@@ -0,0 +1,178 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class tinylfu tinylfu.hpp hpx/cache/policies/tinylfu.hpp
+    ///
+    /// The \a tinylfu admission policy implements W-TinyLFU for the
+    /// \a lru_cache. New entries are inserted into a small window (1% of the
+    /// capacity of the cache), which is managed as a separate LRU list. An
+    /// entry evicted from the window is admitted to the main part of the
+    /// cache only if it has been accessed more frequently than the least
+    /// recently used entry of the main part, which is evicted instead. This
+    /// protects frequently used entries from being flushed by scans.
+    ///
+    /// The access frequencies are estimated using a count-min sketch of
+    /// four bit counters, all of which are halved after a number of accesses
+    /// proportional to the capacity of the cache (aging). This way the
+    /// estimates reflect the recent history of accesses only.
+    ///
+    /// \tparam Key   The type of the keys used by the cache
+    /// \tparam Hash  A (optional) hash function for the keys. The default is
+    ///               std::hash<Key>.
+    template <typename Key, typename Hash = std::hash<Key>>
+    class tinylfu
+    {
+    private:
+        // every word of the sketch holds 16 four bit counters
+        static constexpr std::uint64_t counter_mask = 0xf;
+        static constexpr std::uint64_t reset_mask = 0x7777777777777777ULL;
+        static constexpr std::size_t num_rows = 4;
+
+        // the counters are halved after this many accesses per cache entry
+        static constexpr std::size_t sample_factor = 10;
+
+        [[nodiscard]] static constexpr std::uint64_t mix(
+            std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+    public:
+        /// \brief Construct a policy for a cache holding up to \a capacity
+        ///        entries.
+        explicit tinylfu(std::size_t capacity = 0)
+        {
+            reserve(capacity);
+        }
+
+        /// \brief Resize the sketch for a cache holding up to \a capacity
+        ///        entries, this resets all frequencies.
+        void reserve(std::size_t capacity)
+        {
+            std::size_t words = 8;
+            while (words < capacity)
+            {
+                words *= 2;
+            }
+
+            table_.assign(words, 0);
+            sample_size_ = sample_factor * (std::max)(capacity, words);
+            additions_ = 0;
+        }
+
+        /// \brief The number of entries of a cache with the given capacity
+        ///        which are held in the window.
+        [[nodiscard]] static constexpr std::size_t window_size(
+            std::size_t capacity) noexcept
+        {
+            return capacity >= 100 ? capacity / 100 : (capacity != 0 ? 1 : 0);
+        }
+
+        /// \brief Record an access to the given key (a hit or a miss).
+        void record_access(Key const& k) noexcept
+        {
+            std::uint64_t const h = Hash()(k);
+
+            bool added = false;
+            for (std::size_t i = 0; i != num_rows; ++i)
+            {
+                std::uint64_t& word = table_[index(h, i)];
+                unsigned const shift = offset(h, i);
+                if (((word >> shift) & counter_mask) != counter_mask)
+                {
+                    word += std::uint64_t(1) << shift;
+                    added = true;
+                }
+            }
+
+            if (added && ++additions_ == sample_size_)
+            {
+                age();
+            }
+        }
+
+        /// \brief Return the estimated number of recent accesses to the given
+        ///        key (at most 15).
+        [[nodiscard]] std::size_t frequency(Key const& k) const noexcept
+        {
+            std::uint64_t const h = Hash()(k);
+
+            std::uint64_t result = counter_mask;
+            for (std::size_t i = 0; i != num_rows; ++i)
+            {
+                result = (std::min)(result,
+                    (table_[index(h, i)] >> offset(h, i)) & counter_mask);
+            }
+            return static_cast<std::size_t>(result);
+        }
+
+        /// \brief Decide whether the \a candidate evicted from the window
+        ///        replaces the \a victim in the main part of the cache.
+        [[nodiscard]] bool admit(
+            Key const& candidate, Key const& victim) const noexcept
+        {
+            return frequency(candidate) > frequency(victim);
+        }
+
+        /// \brief Reset all frequencies.
+        void clear() noexcept
+        {
+            std::fill(table_.begin(), table_.end(), 0);
+            additions_ = 0;
+        }
+
+    private:
+        [[nodiscard]] std::size_t index(
+            std::uint64_t h, std::size_t row) const noexcept
+        {
+            // every row uses a different hash derived from the key's hash
+            std::uint64_t const rh = mix(h + row * 0x9e3779b97f4a7c15ULL);
+            return static_cast<std::size_t>(rh) & (table_.size() - 1);
+        }
+
+        [[nodiscard]] static unsigned offset(
+            std::uint64_t h, std::size_t row) noexcept
+        {
+            // select one of the 16 counters of a word, a different one for
+            // every row
+            return static_cast<unsigned>(((mix(h) >> (row * 4 + 32)) & 0xf) *
+                4);
+        }
+
+        // halve all counters
+        void age() noexcept
+        {
+            for (std::uint64_t& word : table_)
+            {
+                word = (word >> 1) & reset_mask;
+            }
+            additions_ /= 2;
+        }
+
+        std::vector<std::uint64_t> table_;
+        std::size_t sample_size_ = 0;
+        std::size_t additions_ = 0;
+    };
+}    // namespace hpx::util::cache::policies
@@ -0,0 +1,134 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of a concurrent_cache with the throughput of a
+// lru_cache protected by a single lock, both accessed by one task per worker
+// thread.
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+#if HPX_DEBUG
+constexpr std::size_t NUM_TESTS = 100000;
+#else
+constexpr std::size_t NUM_TESTS = 10000000;
+#endif
+
+constexpr std::size_t NUM_KEYS = 100000;
+
+// keys are drawn from a simple linear congruential sequence, about 70% of
+// the accesses hit the cache
+inline std::size_t next_key(std::uint64_t& state) noexcept
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<std::size_t>(state >> 33) % NUM_KEYS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+using entry_type = hpx::util::cache::entries::lru_entry<std::size_t>;
+
+struct locked_lru_cache
+{
+    bool get_entry(std::size_t key, entry_type& e)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        std::size_t realkey;
+        return cache_.get_entry(key, realkey, e);
+    }
+
+    void insert(std::size_t key, entry_type&& e)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        cache_.insert(key, HPX_MOVE(e));
+    }
+
+    hpx::spinlock mtx_;
+    hpx::util::cache::lru_cache<std::size_t, entry_type> cache_{
+        NUM_KEYS * 7 / 10};
+};
+
+using concurrent_cache_type =
+    hpx::util::cache::concurrent_cache<std::size_t, entry_type,
+        hpx::util::cache::statistics::no_statistics, hpx::spinlock>;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+void access_cache(Cache& c, std::size_t iterations, std::uint64_t seed)
+{
+    std::uint64_t state = seed;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::size_t const key = next_key(state);
+
+        entry_type e;
+        if (!c.get_entry(key, e))
+        {
+            c.insert(key, entry_type(key));
+        }
+    }
+}
+
+template <typename Cache>
+double measure(Cache& c, std::size_t num_tasks)
+{
+    std::size_t const iterations = NUM_TESTS / num_tasks;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async(
+            [&c, iterations, t]() { access_cache(c, iterations, t + 1); }));
+    }
+    hpx::wait_all(tasks);
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+int hpx_main()
+{
+    std::size_t const num_tasks = hpx::get_os_thread_count();
+
+    {
+        locked_lru_cache c;
+        double const elapsed = measure(c, num_tasks);
+        std::cout << "lru_cache with a global lock: " << (NUM_TESTS / elapsed)
+                  << " [op/s] (" << (elapsed / NUM_TESTS) << " [s/op])\n";
+    }
+
+    {
+        concurrent_cache_type c(NUM_KEYS * 7 / 10);
+        double const elapsed = measure(c, num_tasks);
+        std::cout << "concurrent_cache (" << c.num_shards()
+                  << " shards): " << (NUM_TESTS / elapsed) << " [op/s] ("
+                  << (elapsed / NUM_TESTS) << " [s/op])\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,212 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using entry_type = hpx::util::cache::entries::lru_entry<std::string>;
+using cache_type = hpx::util::cache::concurrent_cache<std::string, entry_type,
+    hpx::util::cache::statistics::local_statistics>;
+
+char const* const colors[][2] = {{"white", "255,255,255"},
+    {"yellow", "255,255,0"}, {"green", "0,255,0"}, {"blue", "0,0,255"},
+    {"magenta", "255,0,255"}, {"black", "0,0,0"}};
+
+constexpr std::size_t num_colors = sizeof(colors) / sizeof(colors[0]);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(0, 4);
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(4));
+
+    for (auto const& color : colors)
+    {
+        HPX_TEST(c.insert(color[0], color[1]));
+    }
+    HPX_TEST_EQ(c.size(), num_colors);
+
+    // inserting an existing key fails
+    HPX_TEST(!c.insert("white", "0,0,0"));
+
+    for (auto const& color : colors)
+    {
+        std::string value;
+        HPX_TEST(c.get_entry(color[0], value));
+        HPX_TEST_EQ(value, std::string(color[1]));
+    }
+
+    std::string value;
+    HPX_TEST(!c.get_entry("orange", value));
+    HPX_TEST(!c.holds_key("orange"));
+
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t insertions = 0;
+    c.for_each_statistics([&](auto& stat) {
+        hits += stat.hits();
+        misses += stat.misses();
+        insertions += stat.insertions();
+    });
+    HPX_TEST_EQ(hits, num_colors);
+    HPX_TEST_EQ(misses, static_cast<std::size_t>(1));
+    HPX_TEST_EQ(insertions, num_colors);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_erase()
+{
+    cache_type c;
+
+    HPX_TEST(c.update("black", "255,0,0"));    // isn't in the cache
+    HPX_TEST(c.update("black", "0,0,0"));
+
+    std::string black;
+    HPX_TEST(c.get_entry("black", black));
+    HPX_TEST_EQ(black, std::string("0,0,0"));
+
+    // the update is refused by the predicate
+    HPX_TEST(!c.update_if("black", "1,1,1",
+        [](std::string const&, std::string const&) { return true; }));
+
+    HPX_TEST_EQ(c.erase("black"), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(c.erase("black"), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+
+    for (auto const& color : colors)
+    {
+        HPX_TEST(c.insert(color[0], color[1]));
+    }
+
+    // remove all entries with a red component
+    HPX_TEST_EQ(c.erase([](cache_type::entry_pair const& p) {
+        return p.second.get()[0] == '2';
+    }),
+        static_cast<std::size_t>(3));
+    HPX_TEST_EQ(c.size(), num_colors - 3);
+
+    c.clear();
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_eviction()
+{
+    // use a single shard to make the eviction order predictable
+    cache_type c(3, 1);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // touch the oldest entry, the next oldest one is evicted instead
+    std::string value;
+    HPX_TEST(c.get_entry("white", value));
+
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(3));
+
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+
+    // shrinking the cache evicts the least recently used entries
+    c.reserve(1);
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(1));
+    HPX_TEST(c.holds_key("blue"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_size_entry()
+{
+    using size_entry_type =
+        hpx::util::cache::entries::size_entry<std::string>;
+    using size_cache_type =
+        hpx::util::cache::concurrent_cache<std::string, size_entry_type>;
+
+    size_cache_type c(10, 1);
+
+    HPX_TEST(c.insert("a", size_entry_type("a", 4)));
+    HPX_TEST(c.insert("b", size_entry_type("b", 4)));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(8));
+
+    // does not fit without evicting an entry
+    HPX_TEST(c.insert("c", size_entry_type("c", 4)));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(8));
+
+    // larger than the whole cache
+    HPX_TEST(!c.insert("d", size_entry_type("d", 11)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    constexpr std::size_t num_threads = 8;
+    constexpr std::size_t num_keys = 1000;
+    constexpr std::size_t num_iterations = 10000;
+
+    hpx::util::cache::concurrent_cache<std::size_t,
+        hpx::util::cache::entries::lru_entry<std::size_t>,
+        hpx::util::cache::statistics::local_statistics>
+        c(num_keys / 2);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                std::size_t const key = (i * (t + 1)) % num_keys;
+                std::size_t value = 0;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, 2 * key);
+                }
+                else
+                {
+                    c.insert(key, 2 * key);
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // the capacity is split between the shards, rounding up
+    HPX_TEST_LTE(c.size(), num_keys / 2 + c.num_shards());
+
+    std::size_t accesses = 0;
+    c.for_each_statistics(
+        [&](auto& stat) { accesses += stat.hits() + stat.misses(); });
+    HPX_TEST_EQ(accesses, num_threads * num_iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_update_erase();
+    test_lru_eviction();
+    test_size_entry();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
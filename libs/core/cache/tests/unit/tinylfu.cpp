@@ -0,0 +1,139 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/policies/tinylfu.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_frequency()
+{
+    hpx::util::cache::policies::tinylfu<std::size_t> policy(1000);
+
+    HPX_TEST_EQ(policy.frequency(42), static_cast<std::size_t>(0));
+
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        policy.record_access(42);
+    }
+    policy.record_access(43);
+
+    // the sketch may overestimate, but never underestimates
+    HPX_TEST_LTE(static_cast<std::size_t>(5), policy.frequency(42));
+    HPX_TEST_LTE(static_cast<std::size_t>(1), policy.frequency(43));
+    HPX_TEST(policy.admit(42, 43));
+    HPX_TEST(!policy.admit(43, 42));
+
+    // the counters saturate
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        policy.record_access(42);
+    }
+    HPX_TEST_EQ(policy.frequency(42), static_cast<std::size_t>(15));
+
+    policy.clear();
+    HPX_TEST_EQ(policy.frequency(42), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_aging()
+{
+    hpx::util::cache::policies::tinylfu<std::size_t> policy(8);
+
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        policy.record_access(1);
+    }
+    std::size_t const before = policy.frequency(1);
+    HPX_TEST_LTE(static_cast<std::size_t>(8), before);
+
+    // accessing many other keys halves the counters eventually
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        policy.record_access(1000 + i);
+    }
+    HPX_TEST_LT(policy.frequency(1), before);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+std::size_t count_hot_hits(Cache& c)
+{
+    constexpr std::size_t num_hot = 50;
+
+    // make a set of keys hot
+    for (std::size_t r = 0; r != 5; ++r)
+    {
+        for (std::size_t k = 0; k != num_hot; ++k)
+        {
+            std::size_t realkey = 0;
+            std::size_t value = 0;
+            if (!c.get_entry(k, realkey, value))
+            {
+                c.insert(k, k);
+            }
+        }
+    }
+
+    // scan through many keys which are accessed once only
+    for (std::size_t k = 1000; k != 3000; ++k)
+    {
+        std::size_t realkey = 0;
+        std::size_t value = 0;
+        if (!c.get_entry(k, realkey, value))
+        {
+            c.insert(k, k);
+        }
+    }
+
+    std::size_t hits = 0;
+    for (std::size_t k = 0; k != num_hot; ++k)
+    {
+        if (c.holds_key(k))
+        {
+            ++hits;
+        }
+    }
+    return hits;
+}
+
+void test_scan_resistance()
+{
+    using statistics_type = hpx::util::cache::statistics::local_statistics;
+
+    // the scan flushes a plain LRU cache
+    hpx::util::cache::lru_cache<std::size_t, std::size_t, statistics_type>
+        lru(100);
+    HPX_TEST_EQ(count_hot_hits(lru), static_cast<std::size_t>(0));
+    HPX_TEST_LTE(lru.size(), static_cast<std::size_t>(100));
+
+    // most of the hot keys survive the scan with W-TinyLFU (the sketch may
+    // overestimate the frequency of some of the scanned keys)
+    hpx::util::cache::lru_cache<std::size_t, std::size_t, statistics_type,
+        hpx::util::cache::policies::tinylfu<std::size_t>>
+        tinylfu(100);
+    HPX_TEST_LTE(static_cast<std::size_t>(25), count_hot_hits(tinylfu));
+    HPX_TEST_LTE(tinylfu.size(), static_cast<std::size_t>(100));
+
+    // the window holds the most recently inserted key
+    HPX_TEST(tinylfu.holds_key(2999));
+
+    tinylfu.clear();
+    HPX_TEST_EQ(tinylfu.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_frequency();
+    test_aging();
+    test_scan_resistance();
+
+    return hpx::util::report_errors();
+}
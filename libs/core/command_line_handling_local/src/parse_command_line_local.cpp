@@ -521,8 +521,10 @@ namespace hpx::local::detail {
                 "the queue scheduling policy to use, options are "
                 "'local', 'local-priority-fifo','local-priority-lifo', "
                 "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
-                "'static-priority', 'local-workrequesting-fifo', and "
-                "'local-workrequesting-lifo' (default: 'local-priority'; "
+                "'static-priority', 'local-workrequesting-fifo', "
+                "'local-workrequesting-lifo', 'local-priority-edf', "
+                "'shared-priority', and 'shared-priority-multiqueue' "
+                "(default: 'local-priority'; "
                 "all option values can be abbreviated)")
             ("hpx:high-priority-threads", value<std::size_t>(),
                 "the number of operating system threads maintaining a high "
@@ -21,7 +21,12 @@
 #include <hpx/functional/invoke_fused.hpp>
 #include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/iterator_support/range.hpp>
-#include <hpx/parallel/container_algorithms/for_each.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/destroy.hpp>
+#include <hpx/parallel/algorithms/uninitialized_copy.hpp>
+#include <hpx/parallel/algorithms/uninitialized_fill.hpp>
+#include <hpx/parallel/algorithms/uninitialized_relocate.hpp>
+#include <hpx/parallel/algorithms/uninitialized_value_construct.hpp>
 #include <hpx/parallel/util/adapt_sharing_mode.hpp>
 #include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/partitioner_with_cleanup.hpp>
@@ -123,10 +128,58 @@ namespace hpx::compute::host {
             }
 
         public:
-            // Constructs count objects of type T in allocated uninitialized
-            // storage pointed to by p, using placement-new. This will use the
+            // Value-initializes count objects of type T in allocated
+            // uninitialized storage pointed to by p. This will use the
             // underlying executors to distribute the memory according to
-            // first touch memory placement.
+            // first touch memory placement. The elements are partitioned in
+            // the same way as by any other parallel algorithm invoked with
+            // the policy of this allocator on the same number of elements
+            // (e.g. hpx::for_each), every element is therefore touched first
+            // by the target that will later iterate over it. Note that value
+            // initialization touches the memory for all element types (unlike
+            // default initialization).
+            template <typename U>
+            void bulk_construct(U* p, std::size_t count)
+            {
+                hpx::uninitialized_value_construct_n(
+                    parallel::util::adapt_sharing_mode(policy_,
+                        hpx::threads::thread_sharing_hint::
+                            do_not_share_function),
+                    p, count);
+            }
+
+            // Constructs count copies of value in allocated uninitialized
+            // storage pointed to by p, with the same placement of the
+            // elements as above.
+            template <typename U>
+            void bulk_construct(U* p, std::size_t count, U const& value)
+            {
+                hpx::uninitialized_fill_n(
+                    parallel::util::adapt_sharing_mode(policy_,
+                        hpx::threads::thread_sharing_hint::
+                            do_not_share_function),
+                    p, count, value);
+            }
+
+            // Copy-constructs count objects in allocated uninitialized
+            // storage pointed to by p from the elements starting at first,
+            // with the same placement of the elements as above.
+            template <typename U, typename FwdIter,
+                typename Enable_ = std::enable_if_t<
+                    hpx::traits::is_forward_iterator_v<FwdIter>>>
+            void bulk_copy_construct(U* p, FwdIter first, std::size_t count)
+            {
+                hpx::uninitialized_copy_n(
+                    parallel::util::adapt_sharing_mode(policy_,
+                        hpx::threads::thread_sharing_hint::
+                            do_not_share_function),
+                    first, count, p);
+            }
+
+            // Constructs count objects of type T from the given arguments in
+            // allocated uninitialized storage pointed to by p, using
+            // placement-new, with the same placement of the elements as
+            // above.
             template <typename U, typename... Args>
             void bulk_construct(U* p, std::size_t count, Args&&... args)
             {
@@ -193,6 +246,20 @@ namespace hpx::compute::host {
                     });
             }
 
+            // Relocates count objects from src into allocated uninitialized
+            // storage pointed to by dest, with the same placement of the
+            // elements as above. Trivially relocatable elements are copied
+            // chunk-wise using memmove.
+            template <typename U>
+            void bulk_relocate(U* dest, U* src, std::size_t count)
+            {
+                hpx::experimental::uninitialized_relocate_n(
+                    parallel::util::adapt_sharing_mode(policy_,
+                        hpx::threads::thread_sharing_hint::
+                            do_not_share_function),
+                    src, count, dest);
+            }
+
             // Constructs an object of type T in allocated uninitialized storage
             // pointed to by p, using placement-new
             template <typename U, typename... Args>
@@ -203,19 +270,25 @@ namespace hpx::compute::host {
                     HPX_FORWARD(Args, args)...);
             }
 
-            // Calls the destructor of count objects pointed to by p
+            // Calls the destructor of count objects pointed to by p. The
+            // elements are destroyed by the same targets that have
+            // constructed them, nothing is done for trivially destructible
+            // element types.
             template <typename U>
-            void bulk_destroy(U* p, std::size_t count)
+            void bulk_destroy(
+                [[maybe_unused]] U* p, [[maybe_unused]] std::size_t count)
             {
-                if (count == std::size_t(0))
+                if constexpr (!std::is_trivially_destructible_v<U>)
                 {
-                    return;
+                    if (count != std::size_t(0))
+                    {
+                        hpx::destroy_n(
+                            parallel::util::adapt_sharing_mode(policy_,
+                                hpx::threads::thread_sharing_hint::
+                                    do_not_share_function),
+                            p, count);
+                    }
                 }
-
-                // keep memory locality, use executor...
-                auto irange = hpx::util::counting_shape(count);
-                hpx::ranges::for_each(policy_, irange,
-                    [p](std::size_t i) { std::destroy_at(p + i); });
             }
 
             // Calls the destructor of the object pointed to by p
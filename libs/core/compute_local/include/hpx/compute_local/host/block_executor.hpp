@@ -247,7 +247,7 @@ namespace hpx { namespace compute { namespace host {
                     auto part_results =
                         hpx::parallel::execution::bulk_sync_execute(
                             executors_[i], HPX_FORWARD(F, f),
-                            util::iterator_range(begin, part_end),
+                            util::iterator_range(part_begin, part_end),
                             HPX_FORWARD(Ts, ts)...);
                     results.emplace(results.end(),
                         std::make_move_iterator(part_results.begin()),
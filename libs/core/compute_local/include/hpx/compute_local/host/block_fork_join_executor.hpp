@@ -144,6 +144,8 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param barrier The barrier used for joining the worker threads at
+        ///        the end of each parallel region.
         ///
         /// \note   This constructor will create one fork_join_executor for
         ///         each numa domain
@@ -153,9 +155,11 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize::small_,
             fork_join_executor::loop_schedule const schedule =
                 fork_join_executor::loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            fork_join_executor::barrier_type const barrier =
+                fork_join_executor::barrier_type::flat)
           : block_fork_join_executor(compute::host::numa_domains(), priority,
-                stacksize, schedule, yield_delay)
+                stacksize, schedule, yield_delay, barrier)
         {
         }
 
@@ -168,6 +172,8 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param barrier The barrier used for joining the worker threads at
+        ///        the end of each parallel region.
         ///
         /// \note   This constructor will create one fork_join_executor for
         ///         each given target
@@ -178,12 +184,14 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize::small_,
             fork_join_executor::loop_schedule const schedule =
                 fork_join_executor::loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            fork_join_executor::barrier_type const barrier =
+                fork_join_executor::barrier_type::flat)
           : exec_(cores_for_targets(targets), priority, stacksize,
                 targets.size() == 1 ?
                     schedule :
                     fork_join_executor::loop_schedule::static_,
-                yield_delay)
+                yield_delay, barrier)
         {
             // don't build a hierarchy of executors if there is only one target
             // mask given
@@ -200,7 +208,7 @@ namespace hpx::execution::experimental {
                     // create the sub-executors
                     block_execs_[index] = fork_join_executor(
                         targets[index].native_handle().get_device(), priority,
-                        stacksize, schedule, yield_delay);
+                        stacksize, schedule, yield_delay, barrier);
                 };
 
                 hpx::parallel::execution::bulk_sync_execute(
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/compute_local/host/page_allocation.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/futures/future.hpp>
@@ -18,6 +19,7 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/type_support/construct_at.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <vector>
@@ -55,15 +57,19 @@ namespace hpx::parallel::util {
         };
 
     public:
-        numa_allocator(Executors const& executors, hpx::threads::topology& topo)
+        numa_allocator(Executors const& executors, hpx::threads::topology& topo,
+            compute::host::page_size_policy pages =
+                compute::host::page_size_policy::default_pages)
           : executors_(executors)
           , topo_(topo)
+          , pages_(pages)
         {
         }
 
         numa_allocator(numa_allocator const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , pages_(rhs.pages_)
         {
         }
 
@@ -73,6 +79,7 @@ namespace hpx::parallel::util {
         numa_allocator(numa_allocator<U, Executors> const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , pages_(rhs.pages_)
         {
         }
 
@@ -90,17 +97,35 @@ namespace hpx::parallel::util {
         pointer allocate(size_type cnt, void const* = nullptr)
         {
             // allocate memory
-            pointer p = static_cast<pointer>(topo_.allocate(cnt * sizeof(T)));
+            pointer p = static_cast<pointer>(
+                pages_ == compute::host::page_size_policy::default_pages ?
+                    topo_.allocate(cnt * sizeof(T)) :
+                    compute::host::allocate_pages(cnt * sizeof(T), pages_));
+
+            // first touch policy, distribute onto executors using the same
+            // partitioning as the block_executor, with the partition
+            // boundaries rounded to whole pages
+            std::size_t const num_executors = executors_.size();
+            std::size_t const page_elements = (std::max)(std::size_t(1),
+                compute::host::get_page_size(pages_) / sizeof(T));
+            auto partition_offset = [&](std::size_t i) {
+                if (i == num_executors)
+                {
+                    return cnt;
+                }
+                std::size_t const offset = (i * cnt) / num_executors;
+                return (std::min)(cnt,
+                    (offset + page_elements / 2) / page_elements *
+                        page_elements);
+            };
 
-            // first touch policy, distribute evenly onto executors
-            std::size_t part_size = cnt / executors_.size();
             std::vector<hpx::future<void>> first_touch;
-            first_touch.reserve(executors_.size());
+            first_touch.reserve(num_executors);
 
-            for (std::size_t i = 0; i != executors_.size(); ++i)
+            for (std::size_t i = 0; i != num_executors; ++i)
             {
-                pointer begin = p + i * part_size;
-                pointer end = begin + part_size;
+                pointer begin = p + partition_offset(i);
+                pointer end = p + partition_offset(i + 1);
                 first_touch.push_back(hpx::for_each(
                     hpx::execution::par(hpx::execution::task).on(executors_[i]),
                     begin, end,
@@ -145,7 +170,12 @@ namespace hpx::parallel::util {
 
         void deallocate(pointer p, size_type cnt) noexcept
         {
-            topo_.deallocate(p, cnt * sizeof(T));
+            if (pages_ == compute::host::page_size_policy::default_pages)
+            {
+                topo_.deallocate(p, cnt * sizeof(T));
+                return;
+            }
+            compute::host::deallocate_pages(p, cnt * sizeof(T), pages_);
         }
 
         // size
@@ -182,6 +212,7 @@ namespace hpx::parallel::util {
 
         Executors const& executors_;
         hpx::threads::topology& topo_;
+        compute::host::page_size_policy pages_;
     };
 }    // namespace hpx::parallel::util
 // namespace hpx::parallel::util
@@ -10,6 +10,7 @@
 
 #include <hpx/assert.hpp>
 #include <hpx/async_local/async.hpp>
+#include <hpx/compute_local/host/page_allocation.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/executors/guided_pool_executor.hpp>
 #include <hpx/functional/bind.hpp>
@@ -147,6 +148,74 @@ namespace hpx { namespace compute { namespace host {
     template <typename T>
     using numa_binding_helper_ptr = std::shared_ptr<numa_binding_helper<T>>;
 
+    /// A binding helper which places the pages of a 1D array onto the numa
+    /// domains in contiguous blocks, using the same partitioning of the
+    /// elements as the block_executor. When the array is processed using a
+    /// block_executor with one target per numa domain, each partition only
+    /// accesses memory bound to the domain it runs on. A page straddling two
+    /// partitions is bound to the partition holding the larger part of it.
+    template <typename T>
+    struct block_numa_binding_helper : numa_binding_helper<T>
+    {
+        // num_partitions is the number of targets of the block_executor, the
+        // default is to use one partition per numa domain
+        explicit block_numa_binding_helper(
+            std::size_t num_elements, std::size_t num_partitions = 0)
+          : num_elements_(num_elements)
+          , num_partitions_(num_partitions)
+        {
+        }
+
+        std::size_t operator()(T const* const base_ptr,
+            T const* const page_ptr, std::size_t const page_size,
+            std::size_t const domains) const override
+        {
+            std::size_t const partitions =
+                num_partitions_ != 0 ? num_partitions_ : domains;
+            if (num_elements_ == 0 || partitions == 0)
+            {
+                return 0;
+            }
+
+            // the element in the middle of the page decides
+            std::size_t element =
+                static_cast<std::size_t>(page_ptr - base_ptr) +
+                page_size / sizeof(T) / 2;
+            if (element >= num_elements_)
+            {
+                element = num_elements_ - 1;
+            }
+
+            // partition i covers [i * N / P, (i + 1) * N / P), see
+            // block_executor::bulk_async_execute_impl
+            std::size_t const partition =
+                ((element + 1) * partitions - 1) / num_elements_;
+            return partition * domains / partitions;
+        }
+
+        std::string description() const override
+        {
+            std::ostringstream temp;
+            temp << "Block " << std::dec << " N " << num_elements_
+                 << " partitions " << num_partitions_;
+            return temp.str();
+        }
+
+        std::size_t memory_bytes() const override
+        {
+            return sizeof(T) * num_elements_;
+        }
+
+        std::size_t array_size(std::size_t axis) const override
+        {
+            return axis == 0 ? num_elements_ : 1;
+        }
+
+    private:
+        std::size_t num_elements_;
+        std::size_t num_partitions_;
+    };
+
     /// The numa_binding_allocator allocates memory using a policy based on
     /// hwloc flags for memory binding.
     /// This allocator can be used to request data that is bound
@@ -176,10 +245,12 @@ namespace hpx { namespace compute { namespace host {
 
         // construct without a memory binder function
         // only first touch or interleave policies are valid
-        numa_binding_allocator(
-            threads::hpx_hwloc_membind_policy policy, unsigned int flags)
+        numa_binding_allocator(threads::hpx_hwloc_membind_policy policy,
+            unsigned int flags,
+            page_size_policy pages = page_size_policy::default_pages)
           : policy_(policy)
           , flags_(flags)
+          , pages_(pages)
           , init_mutex()
         {
             nba_deb.debug("no binder function");
@@ -188,12 +259,15 @@ namespace hpx { namespace compute { namespace host {
         }
 
         // construct using a memory binder function for placing pages
-        // according to a user defined pattern using first touch policy
+        // according to a user defined pattern using first touch policy, the
+        // pages are placed at the granularity of the page size policy
         numa_binding_allocator(numa_binding_helper_ptr bind_func,
-            threads::hpx_hwloc_membind_policy policy, unsigned int flags)
+            threads::hpx_hwloc_membind_policy policy, unsigned int flags,
+            page_size_policy pages = page_size_policy::default_pages)
           : binding_helper_(bind_func)
           , policy_(policy)
           , flags_(flags)
+          , pages_(pages)
           , init_mutex()
         {
             nba_deb.debug("allocator");
@@ -204,6 +278,7 @@ namespace hpx { namespace compute { namespace host {
           : binding_helper_(rhs.binding_helper_)
           , policy_(rhs.policy_)
           , flags_(rhs.flags_)
+          , pages_(rhs.pages_)
           , init_mutex()
         {
             nba_deb.debug("Copy allocator");
@@ -215,6 +290,7 @@ namespace hpx { namespace compute { namespace host {
           : binding_helper_(rhs.binding_helper_)
           , policy_(rhs.policy_)
           , flags_(rhs.flags_)
+          , pages_(rhs.pages_)
           , init_mutex()
         {
             nba_deb.debug("Copy allocator rebind");
@@ -225,6 +301,7 @@ namespace hpx { namespace compute { namespace host {
           : binding_helper_(HPX_MOVE(rhs.binding_helper_))
           , policy_(rhs.policy_)
           , flags_(rhs.flags_)
+          , pages_(rhs.pages_)
           , init_mutex()
         {
             nba_deb.debug("Move constructor");
@@ -236,6 +313,7 @@ namespace hpx { namespace compute { namespace host {
             binding_helper_ = rhs.binding_helper_;
             policy_ = rhs.policy_;
             flags_ = rhs.flags_;
+            pages_ = rhs.pages_;
 
             nba_deb.debug("Assignment operator");
             return *this;
@@ -247,6 +325,7 @@ namespace hpx { namespace compute { namespace host {
             binding_helper_ = rhs.binding_helper_;
             policy_ = rhs.policy_;
             flags_ = rhs.flags_;
+            pages_ = rhs.pages_;
 
             nba_deb.debug("Move assignment");
             return *this;
@@ -270,6 +349,11 @@ namespace hpx { namespace compute { namespace host {
         // then spawns threads to touch memory if membind_user is selected
         pointer allocate(size_type n)
         {
+            if (pages_ != page_size_policy::default_pages)
+            {
+                return allocate_with_page_size_policy(n);
+            }
+
             pointer result = nullptr;
 
             if (policy_ ==
@@ -341,6 +425,11 @@ namespace hpx { namespace compute { namespace host {
 #ifdef NUMA_BINDING_ALLOCATOR_DEBUG_PAGE_BINDING
                 display_binding(p, binding_helper_);
 #endif
+                if (pages_ != page_size_policy::default_pages)
+                {
+                    deallocate_pages(p, n * sizeof(T), pages_);
+                    return;
+                }
                 threads::create_topology().deallocate(p, n * sizeof(T));
             }
             catch (...)
@@ -552,7 +641,48 @@ namespace hpx { namespace compute { namespace host {
             return display.str();
         }
 
+        // the granularity at which pages are placed onto numa domains
+        std::size_t page_size() const noexcept
+        {
+            return get_page_size(pages_);
+        }
+
     protected:
+        // Allocate huge pages (or pages advised to be merged into transparent
+        // huge pages) and bind them using the memory binding policy
+        pointer allocate_with_page_size_policy(size_type n)
+        {
+            threads::hwloc_bitmap_ptr bitmap =
+                threads::get_thread_manager().get_pool_numa_bitmap(
+                    binding_helper_->pool_name());
+
+            pointer result =
+                static_cast<pointer>(allocate_pages(n * sizeof(T), pages_));
+            nba_deb.debug(debug::str<>("alloc:pages"),
+                debug::hex<12, void*>(result), " page size ",
+                debug::hex<2>(page_size()));
+
+            try
+            {
+                if (policy_ == threads::hpx_hwloc_membind_policy::membind_user)
+                {
+                    // touch whole (huge) pages from the domain they belong to
+                    initialize_pages(result, n);
+                }
+                else
+                {
+                    threads::create_topology().set_area_membind(
+                        result, n * sizeof(T), bitmap, policy_, 0);
+                }
+            }
+            catch (...)
+            {
+                deallocate_pages(result, n * sizeof(T), pages_);
+                throw;
+            }
+            return result;
+        }
+
         std::vector<threads::hwloc_bitmap_ptr> create_nodesets(
             threads::hwloc_bitmap_ptr bitmap) const
         {
@@ -585,7 +715,7 @@ namespace hpx { namespace compute { namespace host {
             size_type numa_domain,
             std::vector<threads::hwloc_bitmap_ptr> const& nodesets) const
         {
-            size_type const pagesize = threads::get_memory_page_size();
+            size_type const pagesize = page_size();
             size_type const pageN = pagesize / sizeof(T);
             size_type const num_pages =
                 (n * sizeof(T) + pagesize - 1) / pagesize;
@@ -664,6 +794,7 @@ namespace hpx { namespace compute { namespace host {
         std::shared_ptr<numa_binding_helper<T>> binding_helper_;
         threads::hpx_hwloc_membind_policy policy_;
         unsigned int flags_;
+        page_size_policy pages_ = page_size_policy::default_pages;
 
     private:
         mutable std::mutex init_mutex;
@@ -0,0 +1,54 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file page_allocation.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
+namespace hpx::compute::host {
+
+    /// The kind of memory pages used for large allocations made by the NUMA
+    /// aware allocators.
+    enum class page_size_policy
+    {
+        /// Use the default (small) memory pages of the system.
+        default_pages,
+
+        /// Use (small) memory pages, but advise the kernel to back the
+        /// allocation with transparent huge pages (madvise(MADV_HUGEPAGE)).
+        /// The allocation is aligned to 2MB.
+        transparent_huge_pages,
+
+        /// Use explicit 2MB huge pages (MAP_HUGETLB). Falls back to
+        /// transparent huge pages if no huge pages are available.
+        huge_pages_2mb,
+
+        /// Use explicit 1GB huge pages (MAP_HUGETLB). Falls back to
+        /// transparent huge pages if no huge pages are available.
+        huge_pages_1gb
+    };
+
+    /// Return the size of the pages used for the given policy in bytes. This
+    /// is the granularity at which the pages of an allocation can be placed
+    /// onto different NUMA domains.
+    HPX_CORE_EXPORT std::size_t get_page_size(page_size_policy policy) noexcept;
+
+    /// Allocate \a len bytes of page aligned memory using the given policy.
+    /// The memory is not bound to any NUMA domain, it is placed by the first
+    /// touch unless explicitly bound afterwards. Throws
+    /// hpx::error::out_of_memory if the memory could not be allocated.
+    HPX_CORE_EXPORT void* allocate_pages(
+        std::size_t len, page_size_policy policy);
+
+    /// Free memory previously allocated using allocate_pages with the same
+    /// length and policy.
+    HPX_CORE_EXPORT void deallocate_pages(
+        void* addr, std::size_t len, page_size_policy policy) noexcept;
+}    // namespace hpx::compute::host
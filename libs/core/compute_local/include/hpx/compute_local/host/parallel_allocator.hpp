@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/block_allocator.hpp>
+#include <hpx/executors/execution_policy.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::compute::host {
+
+    /// The parallel_allocator obtains its memory from the given (standard)
+    /// allocator, but constructs, copies, relocates, and destroys the
+    /// elements of the containers using it (e.g. hpx::compute::vector) in
+    /// parallel, using the given execution policy (see
+    /// hpx::uninitialized_value_construct_n, hpx::uninitialized_fill_n,
+    /// hpx::uninitialized_copy_n, and hpx::destroy_n).
+    ///
+    /// using allocator_type = hpx::compute::host::parallel_allocator<T>;
+    /// using vector_type = hpx::compute::vector<T, allocator_type>;
+    ///
+    /// // constructs and destroys the elements on all cores
+    /// vector_type v(N);
+    ///
+    /// // uses the given executor for the same
+    /// auto alloc = hpx::compute::host::make_parallel_allocator<T>(
+    ///     hpx::execution::par.on(exec));
+    /// hpx::compute::vector<T, decltype(alloc)> w(N, alloc);
+    ///
+    template <typename T, typename Policy = hpx::execution::parallel_policy,
+        typename Allocator = std::allocator<T>>
+    struct parallel_allocator : public detail::policy_allocator<T, Policy>
+    {
+    private:
+        using base_type = detail::policy_allocator<T, Policy>;
+        using alloc_traits = typename std::allocator_traits<
+            Allocator>::template rebind_traits<T>;
+
+    public:
+        using allocator_type = typename alloc_traits::allocator_type;
+        using typename base_type::pointer;
+        using typename base_type::size_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = parallel_allocator<U, Policy, Allocator>;
+        };
+
+        parallel_allocator()
+          : base_type(Policy())
+        {
+        }
+
+        explicit parallel_allocator(
+            Policy const& policy, Allocator const& alloc = Allocator())
+          : base_type(policy)
+          , alloc_(alloc)
+        {
+        }
+
+        template <typename U>
+        parallel_allocator(
+            parallel_allocator<U, Policy, Allocator> const& rhs)
+          : base_type(rhs.policy())
+          , alloc_(rhs.allocator())
+        {
+        }
+
+        // Allocates n * sizeof(T) bytes of uninitialized storage using the
+        // underlying allocator
+        pointer allocate(size_type n, void const* /* hint */ = nullptr)
+        {
+            return alloc_traits::allocate(alloc_, n);
+        }
+
+        // Deallocates the storage referenced by the pointer p, which must
+        // be a pointer obtained by an earlier call to allocate()
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            alloc_traits::deallocate(alloc_, p, n);
+        }
+
+        size_type max_size() const noexcept
+        {
+            return alloc_traits::max_size(alloc_);
+        }
+
+        allocator_type const& allocator() const noexcept
+        {
+            return alloc_;
+        }
+
+        template <typename U, typename Alloc>
+        friend bool operator==(parallel_allocator const& lhs,
+            parallel_allocator<U, Policy, Alloc> const& rhs) noexcept
+        {
+            return lhs.allocator() == rhs.allocator();
+        }
+
+        template <typename U, typename Alloc>
+        friend bool operator!=(parallel_allocator const& lhs,
+            parallel_allocator<U, Policy, Alloc> const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        allocator_type alloc_;
+    };
+
+    /// Create a parallel_allocator which constructs and destroys the
+    /// elements using the given execution policy.
+    template <typename T, typename Policy,
+        typename Enable = std::enable_if_t<
+            hpx::is_execution_policy_v<std::decay_t<Policy>>>>
+    parallel_allocator<T, std::decay_t<Policy>> make_parallel_allocator(
+        Policy&& policy)
+    {
+        return parallel_allocator<T, std::decay_t<Policy>>(
+            HPX_FORWARD(Policy, policy));
+    }
+}    // namespace hpx::compute::host
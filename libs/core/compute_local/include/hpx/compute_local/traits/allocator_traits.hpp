@@ -12,9 +12,15 @@
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/compute_local/host/traits/access_target.hpp>
 #include <hpx/compute_local/traits/access_target.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/uninitialized_relocate.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/type_support/detail/wrap_int.hpp>
+#include <hpx/type_support/uninitialized_relocation_primitives.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace hpx::compute::traits {
@@ -174,6 +180,60 @@ namespace hpx::compute::traits {
             bulk_construct::call(0, alloc, p, count, HPX_FORWARD(Ts, vs)...);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        struct bulk_copy_construct
+        {
+            template <typename Allocator, typename InIter>
+            HPX_HOST_DEVICE static void call(hpx::traits::detail::wrap_int,
+                Allocator& alloc,
+                typename std::allocator_traits<Allocator>::pointer p,
+                InIter first,
+                typename std::allocator_traits<Allocator>::size_type count)
+            {
+                using size_type =
+                    typename std::allocator_traits<Allocator>::size_type;
+
+                size_type constructed = 0;
+                for (/**/; constructed != count; ++constructed, ++first)
+                {
+#if defined(__CUDA_ARCH__)
+                    allocator_traits<Allocator>::construct(
+                        alloc, p + constructed, *first);
+#else
+                    try
+                    {
+                        allocator_traits<Allocator>::construct(
+                            alloc, p + constructed, *first);
+                    }
+                    catch (...)
+                    {
+                        allocator_traits<Allocator>::bulk_destroy(
+                            alloc, p, constructed);
+                        throw;
+                    }
+#endif
+                }
+            }
+
+            template <typename Allocator, typename InIter>
+            HPX_HOST_DEVICE static auto call(int, Allocator& alloc,
+                typename std::allocator_traits<Allocator>::pointer p,
+                InIter first,
+                typename std::allocator_traits<Allocator>::size_type count)
+                -> decltype(alloc.bulk_copy_construct(p, first, count))
+            {
+                alloc.bulk_copy_construct(p, first, count);
+            }
+        };
+
+        template <typename Allocator, typename InIter>
+        HPX_HOST_DEVICE void call_bulk_copy_construct(Allocator& alloc,
+            typename std::allocator_traits<Allocator>::pointer p, InIter first,
+            typename std::allocator_traits<Allocator>::size_type count)
+        {
+            bulk_copy_construct::call(0, alloc, p, first, count);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct bulk_destroy
         {
@@ -210,6 +270,76 @@ namespace hpx::compute::traits {
         {
             bulk_destroy::call(0, alloc, p, count);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Ranges of at least this many bytes are relocated in parallel (if
+        // the relocation is requested on an HPX thread)
+        inline constexpr std::size_t parallel_relocation_threshold =
+            std::size_t(1) << 20;
+
+        struct bulk_relocate
+        {
+            template <typename Allocator>
+            static void call(hpx::traits::detail::wrap_int, Allocator& alloc,
+                typename std::allocator_traits<Allocator>::pointer dest,
+                typename std::allocator_traits<Allocator>::pointer src,
+                typename std::allocator_traits<Allocator>::size_type count)
+            {
+                using pointer =
+                    typename std::allocator_traits<Allocator>::pointer;
+                using value_type =
+                    typename std::allocator_traits<Allocator>::value_type;
+
+                if constexpr (std::is_pointer_v<pointer>)
+                {
+                    // trivially relocatable elements are copied using
+                    // memmove, large ranges are split into chunks which are
+                    // relocated concurrently
+                    if (count * sizeof(value_type) >=
+                            parallel_relocation_threshold &&
+                        hpx::threads::get_self_ptr() != nullptr)
+                    {
+                        hpx::experimental::uninitialized_relocate_n(
+                            hpx::execution::par, src, count, dest);
+                    }
+                    else
+                    {
+                        hpx::experimental::util::
+                            uninitialized_relocate_n_primitive(
+                                src, count, dest);
+                    }
+                }
+                else
+                {
+                    // fancy pointers are accessed through the allocator
+                    for (pointer end = src + count; src != end; ++src, ++dest)
+                    {
+                        allocator_traits<Allocator>::construct(
+                            alloc, dest, HPX_MOVE(*src));
+                        allocator_traits<Allocator>::destroy(alloc, src);
+                    }
+                }
+            }
+
+            template <typename Allocator>
+            static auto call(int, Allocator& alloc,
+                typename std::allocator_traits<Allocator>::pointer dest,
+                typename std::allocator_traits<Allocator>::pointer src,
+                typename std::allocator_traits<Allocator>::size_type count)
+                -> decltype(alloc.bulk_relocate(dest, src, count))
+            {
+                alloc.bulk_relocate(dest, src, count);
+            }
+        };
+
+        template <typename Allocator>
+        void call_bulk_relocate(Allocator& alloc,
+            typename std::allocator_traits<Allocator>::pointer dest,
+            typename std::allocator_traits<Allocator>::pointer src,
+            typename std::allocator_traits<Allocator>::size_type count)
+        {
+            bulk_relocate::call(0, alloc, dest, src, count);
+        }
     }    // namespace detail
 
     template <typename Allocator>
@@ -287,6 +417,13 @@ namespace hpx::compute::traits {
                 alloc, p, count, HPX_FORWARD(Ts, vs)...);
         }
 
+        template <typename InIter>
+        HPX_HOST_DEVICE static void bulk_copy_construct(
+            Allocator& alloc, pointer p, InIter first, size_type count)
+        {
+            detail::call_bulk_copy_construct(alloc, p, first, count);
+        }
+
         HPX_HOST_DEVICE
         static void bulk_destroy(
             Allocator& alloc, pointer p, size_type count) noexcept
@@ -294,5 +431,16 @@ namespace hpx::compute::traits {
             if (p != nullptr)
                 detail::call_bulk_destroy(alloc, p, count);
         }
+
+        // Move count objects from the storage pointed to by src into the
+        // uninitialized storage pointed to by dest and end the lifetime of
+        // the source objects (the ranges must not overlap). Allocators can
+        // customize this by providing a member function bulk_relocate.
+        static void bulk_relocate(
+            Allocator& alloc, pointer dest, pointer src, size_type count)
+        {
+            if (count != 0)
+                detail::call_bulk_relocate(alloc, dest, src, count);
+        }
     };
 }    // namespace hpx::compute::traits
@@ -16,6 +16,7 @@
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/util/transfer.hpp>
 #include <hpx/runtime_local/report_error.hpp>
+#include <hpx/type_support/uninitialized_relocation_primitives.hpp>
 
 #include <cstddef>
 #include <initializer_list>
@@ -91,7 +92,7 @@ namespace hpx::compute {
           , alloc_(alloc)
           , data_(alloc_traits::allocate(alloc_, size_))
         {
-            hpx::parallel::util::copy(first, last, begin());
+            alloc_traits::bulk_copy_construct(alloc_, data_, first, size_);
         }
 
         vector(vector const& other)
@@ -100,7 +101,8 @@ namespace hpx::compute {
           , alloc_(other.alloc_)
           , data_(alloc_traits::allocate(alloc_, capacity_))
         {
-            hpx::parallel::util::copy(other.begin(), other.end(), begin());
+            alloc_traits::bulk_copy_construct(
+                alloc_, data_, other.begin(), size_);
         }
 
         vector(vector const& other, Allocator const& alloc)
@@ -109,7 +111,8 @@ namespace hpx::compute {
           , alloc_(alloc)
           , data_(alloc_traits::allocate(alloc_, capacity_))
         {
-            hpx::parallel::util::copy(other.begin(), other.end(), begin());
+            alloc_traits::bulk_copy_construct(
+                alloc_, data_, other.begin(), size_);
         }
 
         vector(vector&& other)
@@ -140,7 +143,8 @@ namespace hpx::compute {
           , alloc_(alloc)
           , data_(alloc_traits::allocate(alloc_, capacity_))
         {
-            hpx::parallel::util::copy(init.begin(), init.end(), begin());
+            alloc_traits::bulk_copy_construct(
+                alloc_, data_, init.begin(), size_);
         }
 
         ~vector()
@@ -174,8 +178,16 @@ namespace hpx::compute {
             allocator_type tmp_alloc = other.alloc_;
 
             pointer data = alloc_traits::allocate(tmp_alloc, other.capacity_);
-            hpx::parallel::util::copy(other.begin(), other.end(),
-                iterator(data, 0, alloc_traits::target(tmp_alloc)));
+            try
+            {
+                alloc_traits::bulk_copy_construct(
+                    tmp_alloc, data, other.begin(), other.size_);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(tmp_alloc, data, other.capacity_);
+                throw;
+            }
 
             if (data_ != nullptr)
             {
@@ -278,6 +290,23 @@ namespace hpx::compute {
             return capacity_;
         }
 
+        /// Effects: If n > capacity(), allocates new storage for n elements
+        /// and relocates the existing elements into it (see
+        /// allocator_traits::bulk_relocate, large ranges of trivially
+        /// relocatable elements are relocated in parallel). Otherwise there
+        /// are no effects.
+        ///
+        /// Remarks: If an exception is thrown other than by the move
+        /// constructor of a non-CopyInsertable T there are no effects.
+        ///
+        void reserve(size_type n)
+        {
+            if (n > capacity_)
+            {
+                reallocate(n, size_, [](pointer, size_type) {});
+            }
+        }
+
         /// Returns: size() == 0
         bool empty() const noexcept
         {
@@ -293,9 +322,11 @@ namespace hpx::compute {
         /// Remarks: If an exception is thrown other than by the move constructor
         /// of a non-CopyInsertable T there are no effects.
         ///
-        void resize(size_type /* size */)
+        void resize(size_type size)
         {
-            // TODO: implement this
+            resize_impl(size, [this](pointer p, size_type count) {
+                alloc_traits::bulk_construct(alloc_, p, count);
+            });
         }
 
         /// Effects: If size <= size(), equivalent to calling pop_back()
@@ -306,9 +337,13 @@ namespace hpx::compute {
         ///
         /// Remarks: If an exception is thrown there are no effects.
         ///
-        void resize(size_type /* size */, T const& /* val */)
+        void resize(size_type size, T const& val)
         {
-            // TODO: implement this
+            // the new elements are constructed before the existing ones are
+            // relocated, val may refer to an element of this vector
+            resize_impl(size, [this, &val](pointer p, size_type count) {
+                alloc_traits::bulk_construct(alloc_, p, count, val);
+            });
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -373,6 +408,79 @@ namespace hpx::compute {
         }
 
     private:
+        template <typename F>
+        void resize_impl(size_type size, F&& construct)
+        {
+            if (size <= size_)
+            {
+                alloc_traits::bulk_destroy(alloc_, data_ + size, size_ - size);
+                size_ = size;
+            }
+            else if (size <= capacity_)
+            {
+                construct(data_ + size_, size - size_);
+                size_ = size;
+            }
+            else
+            {
+                reallocate(size, size, HPX_FORWARD(F, construct));
+            }
+        }
+
+        // Move the elements of this vector into new storage for capacity
+        // elements, construct(p, count) is invoked to construct the elements
+        // added at the end if size > size()
+        template <typename F>
+        void reallocate(size_type capacity, size_type size, F&& construct)
+        {
+            pointer data = alloc_traits::allocate(alloc_, capacity);
+            try
+            {
+                construct(data + size_, size - size_);
+                try
+                {
+                    relocate_elements(data);
+                }
+                catch (...)
+                {
+                    alloc_traits::bulk_destroy(
+                        alloc_, data + size_, size - size_);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(alloc_, data, capacity);
+                throw;
+            }
+
+            if (data_ != nullptr)
+            {
+                alloc_traits::deallocate(alloc_, data_, capacity_);
+            }
+
+            size_ = size;
+            capacity_ = capacity;
+            data_ = HPX_MOVE(data);
+        }
+
+        // Elements which may throw while being relocated are copied (if
+        // possible) to leave this vector unchanged in case of an exception
+        void relocate_elements(pointer data)
+        {
+            if constexpr (hpx::experimental::util::detail::relocation_traits<
+                              T*, T*>::is_noexcept_relocatable_v ||
+                !std::is_copy_constructible_v<T>)
+            {
+                alloc_traits::bulk_relocate(alloc_, data, data_, size_);
+            }
+            else
+            {
+                alloc_traits::bulk_copy_construct(alloc_, data, data_, size_);
+                alloc_traits::bulk_destroy(alloc_, data_, size_);
+            }
+        }
+
         size_type size_;
         size_type capacity_;
         allocator_type alloc_;
@@ -0,0 +1,160 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/page_allocation.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/mman.h>
+#define HPX_COMPUTE_LOCAL_HAVE_MMAP
+#endif
+
+namespace hpx::compute::host {
+
+    namespace {
+
+        constexpr std::size_t huge_page_size_2mb = std::size_t(1) << 21;
+        constexpr std::size_t huge_page_size_1gb = std::size_t(1) << 30;
+
+        constexpr std::size_t round_up(
+            std::size_t value, std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+#if defined(HPX_COMPUTE_LOCAL_HAVE_MMAP)
+        // allocate memory aligned to the given (huge) page size and advise
+        // the kernel to back it with transparent huge pages
+        void* allocate_aligned_pages(std::size_t len, std::size_t alignment)
+        {
+            std::size_t const total = len + alignment;
+            void* p = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            // trim the excess memory in front of and behind the aligned area
+            auto const begin = reinterpret_cast<std::uintptr_t>(p);
+            auto const aligned = round_up(begin, alignment);
+            if (aligned != begin)
+            {
+                munmap(p, aligned - begin);
+            }
+            if (std::uintptr_t const end = aligned + len; end != begin + total)
+            {
+                munmap(reinterpret_cast<void*>(end), begin + total - end);
+            }
+
+#if defined(MADV_HUGEPAGE)
+            // a failure means that transparent huge pages are not supported,
+            // the memory can still be used
+            madvise(reinterpret_cast<void*>(aligned), len, MADV_HUGEPAGE);
+#endif
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        void* allocate_huge_pages(std::size_t len, page_size_policy policy)
+        {
+#if defined(MAP_HUGETLB)
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+            flags |= (policy == page_size_policy::huge_pages_1gb ? 30 : 21)
+                << MAP_HUGE_SHIFT;
+#endif
+            void* p =
+                mmap(nullptr, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (p != MAP_FAILED)
+            {
+                return p;
+            }
+#endif
+            // no huge pages of the requested size are available
+            return allocate_aligned_pages(len, get_page_size(policy));
+        }
+#endif
+    }    // namespace
+
+    std::size_t get_page_size([[maybe_unused]] page_size_policy policy) noexcept
+    {
+#if defined(HPX_COMPUTE_LOCAL_HAVE_MMAP)
+        switch (policy)
+        {
+        case page_size_policy::transparent_huge_pages:
+            [[fallthrough]];
+        case page_size_policy::huge_pages_2mb:
+            return huge_page_size_2mb;
+
+        case page_size_policy::huge_pages_1gb:
+            return huge_page_size_1gb;
+
+        case page_size_policy::default_pages:
+            [[fallthrough]];
+        default:
+            break;
+        }
+#endif
+        return threads::get_memory_page_size();
+    }
+
+    void* allocate_pages(std::size_t len, page_size_policy policy)
+    {
+        void* p = nullptr;
+
+#if defined(HPX_COMPUTE_LOCAL_HAVE_MMAP)
+        if (policy != page_size_policy::default_pages)
+        {
+            std::size_t const size = round_up(len, get_page_size(policy));
+            if (policy == page_size_policy::transparent_huge_pages)
+            {
+                p = allocate_aligned_pages(size, get_page_size(policy));
+            }
+            else
+            {
+                p = allocate_huge_pages(size, policy);
+            }
+        }
+        else
+#endif
+        {
+            p = threads::create_topology().allocate(len);
+        }
+
+        if (p == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                "hpx::compute::host::allocate_pages",
+                "could not allocate {} bytes of memory", len);
+        }
+        return p;
+    }
+
+    void deallocate_pages(void* addr, std::size_t len,
+        [[maybe_unused]] page_size_policy policy) noexcept
+    {
+#if defined(HPX_COMPUTE_LOCAL_HAVE_MMAP)
+        if (policy != page_size_policy::default_pages)
+        {
+            munmap(addr, round_up(len, get_page_size(policy)));
+            return;
+        }
+#endif
+        try
+        {
+            threads::create_topology().deallocate(addr, len);
+        }
+        catch (...)
+        {
+            ;    // just ignore errors from create_topology
+        }
+    }
+}    // namespace hpx::compute::host
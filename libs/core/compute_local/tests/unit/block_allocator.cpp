@@ -5,8 +5,12 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/hpx_init.hpp>
+#include <hpx/algorithm.hpp>
 #include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/parallel/util/adapt_sharing_mode.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -71,6 +75,67 @@ struct test
     }
 };
 
+///////////////////////////////////////////////////////////////////////////////
+std::size_t current_numa_domain()
+{
+    auto const& rp = hpx::resource::get_partitioner();
+    return rp.get_topology().get_numa_node_number(
+        rp.get_pu_num(hpx::get_worker_thread_num()));
+}
+
+// every element records the NUMA domain it was constructed on
+struct touched
+{
+    touched()
+      : domain(current_numa_domain())
+    {
+    }
+
+    touched(touched const&)
+      : domain(current_numa_domain())
+    {
+    }
+
+    touched& operator=(touched const&) = default;
+
+    std::size_t domain;
+};
+
+template <typename Vector, typename Policy>
+void test_first_touch_domains(Vector const& v, Policy const& policy)
+{
+    // the elements should be iterated over on the same NUMA domain they
+    // were constructed on (the iterations must not be stolen by threads of
+    // other domains, though)
+    std::atomic<std::size_t> mismatches(0);
+    hpx::for_each(hpx::parallel::util::adapt_sharing_mode(policy,
+                      hpx::threads::thread_sharing_hint::do_not_share_function),
+        v.begin(), v.end(), [&](touched const& t) {
+            if (t.domain != current_numa_domain())
+            {
+                ++mismatches;
+            }
+        });
+    HPX_TEST_EQ(mismatches.load(), std::size_t(0));
+}
+
+void test_first_touch(std::size_t count)
+{
+    using allocator_type = hpx::compute::host::block_allocator<touched>;
+    using vector_type = hpx::compute::vector<touched, allocator_type>;
+
+    allocator_type alloc(hpx::compute::host::numa_domains());
+
+    vector_type v(count, alloc);
+    test_first_touch_domains(v, alloc.policy());
+
+    vector_type filled(count, touched(), alloc);
+    test_first_touch_domains(filled, alloc.policy());
+
+    vector_type copied(v);
+    test_first_touch_domains(copied, alloc.policy());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -96,6 +161,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_bulk_allocator<int>(0);
 
+    {
+        std::size_t count = dis(gen);
+        test_first_touch(count);
+    }
+
     return hpx::finalize();
 }
 
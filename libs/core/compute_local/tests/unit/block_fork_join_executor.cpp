@@ -324,6 +324,7 @@ int hpx_main()
             for (auto const schedule : {
                      fork_join_executor::loop_schedule::static_,
                      fork_join_executor::loop_schedule::dynamic,
+                     fork_join_executor::loop_schedule::work_stealing,
                  })
             {
                 test_executor(priority, stacksize, schedule);
@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <hpx/compute_local/host/numa_binding_allocator.hpp>
+#include <hpx/compute_local/host/page_allocation.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using hpx::compute::host::page_size_policy;
+
+constexpr page_size_policy policies[] = {page_size_policy::default_pages,
+    page_size_policy::transparent_huge_pages, page_size_policy::huge_pages_2mb,
+    page_size_policy::huge_pages_1gb};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate_pages()
+{
+    std::size_t const len = (std::size_t(3) << 20) + 1;
+    for (page_size_policy policy : policies)
+    {
+        std::size_t const page_size = hpx::compute::host::get_page_size(policy);
+        HPX_TEST_NEQ(page_size, std::size_t(0));
+        HPX_TEST_EQ(page_size % hpx::threads::get_memory_page_size(),
+            std::size_t(0));
+
+        void* p = hpx::compute::host::allocate_pages(len, policy);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(
+            reinterpret_cast<std::uintptr_t>(p) % page_size, std::uintptr_t(0));
+
+        std::memset(p, 0x42, len);
+        HPX_TEST_EQ(static_cast<unsigned char*>(p)[len - 1], 0x42);
+
+        hpx::compute::host::deallocate_pages(p, len, policy);
+    }
+}
+
+// the pages are bound to the partition of the block_executor which holds the
+// element in the middle of the page
+void test_block_binding_helper()
+{
+    using helper_type = hpx::compute::host::block_numa_binding_helper<double>;
+
+    std::size_t const page_elements = 512;
+    std::size_t const num_elements = 100 * page_elements + 17;
+    std::vector<double> data(num_elements);
+
+    for (std::size_t domains = 1; domains <= 4; ++domains)
+    {
+        for (std::size_t partitions : {std::size_t(0), domains, 2 * domains})
+        {
+            helper_type helper(num_elements, partitions);
+            std::size_t const p = partitions != 0 ? partitions : domains;
+
+            double const* base = data.data();
+            std::size_t previous_domain = 0;
+            for (std::size_t offset = 0; offset < num_elements;
+                 offset += page_elements)
+            {
+                std::size_t const domain = helper(base, base + offset,
+                    page_elements * sizeof(double), domains);
+                HPX_TEST_LT(domain, domains);
+
+                // the domains are assigned in ascending order
+                HPX_TEST_LTE(previous_domain, domain);
+                previous_domain = domain;
+
+                std::size_t element = offset + page_elements / 2;
+                if (element >= num_elements)
+                {
+                    element = num_elements - 1;
+                }
+
+                std::size_t partition = 0;
+                while (((partition + 1) * num_elements) / p <= element)
+                {
+                    ++partition;
+                }
+                HPX_TEST_EQ(domain, partition * domains / p);
+            }
+            HPX_TEST_EQ(previous_domain, domains - 1);
+        }
+    }
+}
+
+void test_numa_binding_allocator()
+{
+    using allocator_type = hpx::compute::host::numa_binding_allocator<int>;
+
+    std::size_t const num_elements = std::size_t(5) << 20;
+    for (page_size_policy policy : policies)
+    {
+        auto helper = std::make_shared<
+            hpx::compute::host::block_numa_binding_helper<int>>(num_elements);
+
+        allocator_type alloc(helper,
+            hpx::threads::hpx_hwloc_membind_policy::membind_user, 0, policy);
+        HPX_TEST_EQ(alloc.page_size(),
+            hpx::compute::host::get_page_size(policy));
+
+        int* p = alloc.allocate(num_elements);
+        HPX_TEST(p != nullptr);
+        for (std::size_t i = 0; i != num_elements; ++i)
+        {
+            p[i] = static_cast<int>(i);
+        }
+        HPX_TEST_EQ(p[num_elements - 1], static_cast<int>(num_elements - 1));
+        alloc.deallocate(p, num_elements);
+    }
+}
+
+int hpx_main()
+{
+    test_allocate_pages();
+    test_block_binding_helper();
+    test_numa_binding_allocator();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
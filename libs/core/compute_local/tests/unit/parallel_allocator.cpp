@@ -0,0 +1,140 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> construction_count(0);
+std::atomic<std::size_t> destruction_count(0);
+
+struct test
+{
+    test()
+      : value(42)
+    {
+        ++construction_count;
+    }
+
+    explicit test(int v)
+      : value(v)
+    {
+        ++construction_count;
+    }
+
+    test(test const& rhs)
+      : value(rhs.value)
+    {
+        ++construction_count;
+    }
+
+    test& operator=(test const&) = default;
+
+    ~test()
+    {
+        ++destruction_count;
+    }
+
+    int value;
+};
+
+template <typename Allocator>
+void test_vector(Allocator const& alloc, std::size_t count)
+{
+    construction_count.store(0);
+    destruction_count.store(0);
+
+    {
+        hpx::compute::vector<test, Allocator> v(count, alloc);
+        HPX_TEST_EQ(v.size(), count);
+        HPX_TEST_EQ(construction_count.load(), count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(v[i].value, 42);
+        }
+
+        hpx::compute::vector<test, Allocator> filled(count, test(17), alloc);
+        HPX_TEST_EQ(construction_count.load(), 2 * count + 1);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(filled[i].value, 17);
+        }
+
+        hpx::compute::vector<test, Allocator> copied(filled);
+        HPX_TEST_EQ(construction_count.load(), 3 * count + 1);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(copied[i].value, 17);
+        }
+
+        v.clear();
+        HPX_TEST_EQ(destruction_count.load(), count + 1);
+    }
+
+    // all elements have been destroyed exactly once
+    HPX_TEST_EQ(destruction_count.load(), construction_count.load());
+}
+
+void test_resize(std::size_t count)
+{
+    using allocator_type =
+        hpx::compute::host::parallel_allocator<std::string>;
+
+    hpx::compute::vector<std::string, allocator_type> v(count, "value");
+    v.resize(2 * count, "fill");
+    HPX_TEST_EQ(v.size(), 2 * count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(v[i], std::string("value"));
+        HPX_TEST_EQ(v[count + i], std::string("fill"));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using allocator_type = hpx::compute::host::parallel_allocator<test>;
+
+    static_assert(
+        std::is_same_v<std::allocator_traits<allocator_type>::rebind_alloc<int>,
+            hpx::compute::host::parallel_allocator<int,
+                hpx::execution::parallel_policy, std::allocator<test>>>);
+
+    test_vector(allocator_type(), 0);
+    test_vector(allocator_type(), 100);
+    test_vector(allocator_type(), 100000);
+
+    auto alloc = hpx::compute::host::make_parallel_allocator<test>(
+        hpx::execution::par.on(hpx::execution::parallel_executor()));
+    test_vector(alloc, 100000);
+
+    test_resize(10000);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,93 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Vector, typename T>
+void test_resize(Vector& v, std::size_t count, T const& value, T const& fill)
+{
+    v.resize(count, value);
+    HPX_TEST_EQ(v.size(), count);
+    HPX_TEST_LTE(count, v.capacity());
+
+    // growing relocates the existing elements and appends copies of fill
+    v.resize(2 * count, fill);
+    HPX_TEST_EQ(v.size(), 2 * count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(v[i] == value);
+        HPX_TEST(v[count + i] == fill);
+    }
+
+    // reserving does not change the elements
+    v.reserve(4 * count);
+    HPX_TEST_EQ(v.size(), 2 * count);
+    HPX_TEST_LTE(4 * count, v.capacity());
+    HPX_TEST(v[0] == value);
+    HPX_TEST(v[2 * count - 1] == fill);
+
+    // appending elements within the capacity does not reallocate
+    auto const data = v.data();
+    v.resize(3 * count);
+    HPX_TEST(v.data() == data);
+    HPX_TEST(v[2 * count] == T());
+
+    // shrinking keeps the capacity
+    v.resize(count / 2);
+    HPX_TEST_EQ(v.size(), count / 2);
+    HPX_TEST_LTE(4 * count, v.capacity());
+    HPX_TEST(v.empty() || v[0] == value);
+}
+
+template <typename T>
+void test_vector_resize(std::size_t count, T const& value, T const& fill)
+{
+    {
+        hpx::compute::vector<T> v;
+        test_resize(v, count, value, fill);
+    }
+
+    {
+        using allocator_type = hpx::compute::host::block_allocator<T>;
+        allocator_type alloc(hpx::compute::host::get_local_targets());
+        hpx::compute::vector<T, allocator_type> v(alloc);
+        test_resize(v, count, value, fill);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // small vectors are relocated sequentially, large ones in parallel
+    test_vector_resize<int>(100, 42, 17);
+    test_vector_resize<double>(std::size_t(1) << 18, 4.2, 1.7);
+
+    // elements which are not trivially relocatable
+    test_vector_resize<std::string>(1000, "value", "fill");
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,604 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file concurrent_hash_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A concurrent hash map. The map is split into a fixed number of stripes
+    /// (selected by the upper bits of the hash), each of which is an open
+    /// addressing hash table (using linear probing) protected by its own
+    /// spinlock. Stripes grow independently of each other, operations on
+    /// different stripes never contend, and there is no global rehash.
+    ///
+    /// Elements are never accessed without holding the lock of their stripe,
+    /// find copies the value out of the map, visit invokes a function on the
+    /// element while holding the lock. The functions passed to visit and
+    /// for_each_in_stripe must not access the map.
+    ///
+    /// The stripes are the unit of parallel iteration: the elements of
+    /// different stripes can be visited concurrently, e.g.
+    ///
+    /// \code
+    ///     hpx::experimental::for_loop(hpx::execution::par, 0,
+    ///         map.num_stripes(), [&](std::size_t stripe) {
+    ///             map.for_each_in_stripe(stripe, f);
+    ///         });
+    /// \endcode
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>,
+        typename Allocator = std::allocator<std::pair<Key const, T>>>
+    class concurrent_hash_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+
+        static constexpr size_type default_num_stripes = 64;
+        static constexpr size_type max_num_stripes = size_type(1) << 16;
+
+    private:
+        struct slot
+        {
+            std::size_t hash = 0;
+            std::optional<std::pair<Key, T>> value;
+        };
+
+        using slot_allocator = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<slot>;
+        using slots_type = std::vector<slot, slot_allocator>;
+
+        struct stripe_data
+        {
+            explicit stripe_data(slot_allocator const& alloc)
+              : slots(alloc)
+            {
+            }
+
+            mutable hpx::util::spinlock mtx;
+            std::atomic<size_type> size{0};
+            slots_type slots;    // empty or a power of two
+        };
+
+        using stripe = util::cache_aligned_data_derived<stripe_data>;
+        using stripe_allocator = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<stripe>;
+
+        // the table of a stripe is grown once it is more than 3/4 full
+        static constexpr size_type min_capacity = 8;
+
+        static constexpr bool needs_grow(
+            size_type size, size_type capacity) noexcept
+        {
+            return (size + 1) * 4 > capacity * 3;
+        }
+
+        static constexpr size_type round_up(size_type n) noexcept
+        {
+            size_type result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    public:
+        /// Construct an empty map, reserving space for the given number of
+        /// elements. The number of stripes is rounded up to a power of two.
+        explicit concurrent_hash_map(size_type capacity = 0,
+            size_type num_stripes = default_num_stripes,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(),
+            Allocator const& alloc = Allocator())
+          : hash_(hash)
+          , equal_(equal)
+          , alloc_(alloc)
+          , num_stripes_(round_up((std::max)(num_stripes, size_type(1))))
+          , stripes_(nullptr)
+        {
+            HPX_ASSERT(num_stripes_ <= max_num_stripes);
+
+            stripes_ = std::allocator_traits<stripe_allocator>::allocate(
+                alloc_, num_stripes_);
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                std::allocator_traits<stripe_allocator>::construct(
+                    alloc_, stripes_ + i, slot_allocator(alloc_));
+            }
+            reserve(capacity);
+        }
+
+        concurrent_hash_map(concurrent_hash_map const&) = delete;
+        concurrent_hash_map(concurrent_hash_map&&) = delete;
+        concurrent_hash_map& operator=(concurrent_hash_map const&) = delete;
+        concurrent_hash_map& operator=(concurrent_hash_map&&) = delete;
+
+        ~concurrent_hash_map()
+        {
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                std::allocator_traits<stripe_allocator>::destroy(
+                    alloc_, stripes_ + i);
+            }
+            std::allocator_traits<stripe_allocator>::deallocate(
+                alloc_, stripes_, num_stripes_);
+        }
+
+        /// Return the number of elements, the result is accurate only if
+        /// the map is not modified concurrently.
+        [[nodiscard]] size_type size() const noexcept
+        {
+            size_type result = 0;
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                result += stripes_[i].size.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] constexpr size_type num_stripes() const noexcept
+        {
+            return num_stripes_;
+        }
+
+        /// Reserve space for at least the given number of elements, assuming
+        /// the elements are evenly distributed over the stripes.
+        void reserve(size_type capacity)
+        {
+            size_type const per_stripe =
+                (capacity + num_stripes_ - 1) / num_stripes_;
+            if (per_stripe == 0)
+            {
+                return;
+            }
+
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> l(stripes_[i].mtx);
+                while (needs_grow(per_stripe, stripes_[i].slots.size()))
+                {
+                    grow(stripes_[i]);
+                }
+            }
+        }
+
+        void clear()
+        {
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                slots_type slots{slot_allocator(alloc_)};
+                {
+                    std::lock_guard<hpx::util::spinlock> l(stripes_[i].mtx);
+                    std::swap(slots, stripes_[i].slots);
+                    stripes_[i].size.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// Insert the given element if no element with an equivalent key
+        /// exists, returns whether the element was inserted.
+        bool insert(value_type const& value)
+        {
+            return emplace(value.first, value.second);
+        }
+
+        bool insert(value_type&& value)
+        {
+            return emplace(value.first, HPX_MOVE(value.second));
+        }
+
+        /// Insert an element constructed from the given arguments if no
+        /// element with an equivalent key exists, returns whether the element
+        /// was inserted.
+        template <typename K, typename... Ts>
+        bool emplace(K&& key, Ts&&... ts)
+        {
+            std::size_t const h = hash(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<hpx::util::spinlock> l(s.mtx);
+            return insert_locked(
+                s, h, HPX_FORWARD(K, key), HPX_FORWARD(Ts, ts)...)
+                .second;
+        }
+
+        /// Insert the given element or assign the value to the existing
+        /// element with an equivalent key, returns whether the element was
+        /// inserted.
+        template <typename K, typename M>
+        bool insert_or_assign(K&& key, M&& value)
+        {
+            std::size_t const h = hash(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<hpx::util::spinlock> l(s.mtx);
+            auto [pos, inserted] =
+                insert_locked(s, h, HPX_FORWARD(K, key), HPX_FORWARD(M, value));
+            if (!inserted)
+            {
+                s.slots[pos].value->second = HPX_FORWARD(M, value);
+            }
+            return inserted;
+        }
+
+        /// Insert all elements of the given range, elements of the same
+        /// stripe are inserted while holding its lock once. Returns the
+        /// number of inserted elements.
+        template <typename FwdIter>
+        size_type insert(FwdIter first, FwdIter last)
+        {
+            std::vector<std::pair<std::size_t, FwdIter>> elements;
+            elements.reserve(
+                static_cast<std::size_t>(std::distance(first, last)));
+            for (/**/; first != last; ++first)
+            {
+                elements.emplace_back(hash(first->first), first);
+            }
+            sort_by_stripe(elements);
+
+            size_type inserted = 0;
+            for_each_stripe_group(
+                elements, [&](stripe& s, std::size_t h, FwdIter it) {
+                    if (insert_locked(s, h, it->first, it->second).second)
+                    {
+                        ++inserted;
+                    }
+                });
+            return inserted;
+        }
+
+        /// Copy the value of the element with the given key into result,
+        /// returns whether the element was found.
+        bool find(Key const& key, T& result) const
+        {
+            return visit(key, [&](Key const&, T const& value) {
+                result = value;
+            });
+        }
+
+        [[nodiscard]] std::optional<T> find(Key const& key) const
+        {
+            std::optional<T> result;
+            visit(key,
+                [&](Key const&, T const& value) { result.emplace(value); });
+            return result;
+        }
+
+        /// Look up all keys of the given range, for each key an
+        /// std::optional<T> is written to dest. Keys of the same stripe are
+        /// looked up while holding its lock once. Returns the number of keys
+        /// found.
+        template <typename FwdIter, typename OutIter>
+        size_type find(FwdIter first, FwdIter last, OutIter dest) const
+        {
+            // pairs of the hash and the position of each key
+            std::vector<FwdIter> positions;
+            std::vector<std::pair<std::size_t, std::size_t>> keys;
+            for (/**/; first != last; ++first)
+            {
+                keys.emplace_back(hash(*first), positions.size());
+                positions.push_back(first);
+            }
+
+            std::vector<std::optional<T>> results(keys.size());
+            sort_by_stripe(keys);
+
+            size_type found = 0;
+            for_each_stripe_group(
+                keys, [&](stripe& s, std::size_t h, std::size_t i) {
+                    std::size_t const pos = find_locked(s, h, *positions[i]);
+                    if (pos != npos)
+                    {
+                        results[i].emplace(s.slots[pos].value->second);
+                        ++found;
+                    }
+                });
+
+            std::move(results.begin(), results.end(), dest);
+            return found;
+        }
+
+        [[nodiscard]] bool contains(Key const& key) const
+        {
+            return visit(key, [](Key const&, T const&) {});
+        }
+
+        /// Invoke f(key, value) on the element with the given key while
+        /// holding the lock of its stripe, returns whether the element was
+        /// found.
+        template <typename F>
+        bool visit(Key const& key, F&& f)
+        {
+            std::size_t const h = hash(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<hpx::util::spinlock> l(s.mtx);
+            std::size_t const pos = find_locked(s, h, key);
+            if (pos == npos)
+            {
+                return false;
+            }
+
+            auto& value = *s.slots[pos].value;
+            HPX_FORWARD(F, f)(std::as_const(value.first), value.second);
+            return true;
+        }
+
+        template <typename F>
+        bool visit(Key const& key, F&& f) const
+        {
+            return const_cast<concurrent_hash_map&>(*this).visit(
+                key, [&](Key const& k, T const& value) {
+                    HPX_FORWARD(F, f)(k, value);
+                });
+        }
+
+        /// Remove the element with the given key, returns whether the
+        /// element was found.
+        bool erase(Key const& key)
+        {
+            std::size_t const h = hash(key);
+            stripe& s = get_stripe(h);
+
+            std::lock_guard<hpx::util::spinlock> l(s.mtx);
+            std::size_t const pos = find_locked(s, h, key);
+            if (pos == npos)
+            {
+                return false;
+            }
+
+            erase_locked(s, pos);
+            return true;
+        }
+
+        /// Invoke f(key, value) on all elements of the given stripe while
+        /// holding its lock.
+        template <typename F>
+        void for_each_in_stripe(size_type stripe_index, F&& f)
+        {
+            HPX_ASSERT(stripe_index < num_stripes_);
+
+            stripe& s = stripes_[stripe_index];
+            std::lock_guard<hpx::util::spinlock> l(s.mtx);
+            for (slot& e : s.slots)
+            {
+                if (e.value)
+                {
+                    f(std::as_const(e.value->first), e.value->second);
+                }
+            }
+        }
+
+        template <typename F>
+        void for_each_in_stripe(size_type stripe_index, F&& f) const
+        {
+            const_cast<concurrent_hash_map&>(*this).for_each_in_stripe(
+                stripe_index,
+                [&](Key const& k, T const& value) { f(k, value); });
+        }
+
+        /// Invoke f(key, value) on all elements, one stripe after the
+        /// other.
+        template <typename F>
+        void for_each(F&& f)
+        {
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                for_each_in_stripe(i, f);
+            }
+        }
+
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (size_type i = 0; i != num_stripes_; ++i)
+            {
+                for_each_in_stripe(i, f);
+            }
+        }
+
+    private:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // mix the bits of the hash, users' hash functions are often the
+        // identity
+        template <typename K>
+        std::size_t hash(K const& key) const
+        {
+            std::uint64_t const h = static_cast<std::uint64_t>(hash_(key)) *
+                11400714819323198485llu;
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        // the stripe is selected by the upper bits of the hash, the position
+        // inside the stripe by the lower bits
+        std::size_t stripe_index(std::size_t h) const noexcept
+        {
+            return (static_cast<std::uint64_t>(h) >> 48) & (num_stripes_ - 1);
+        }
+
+        stripe& get_stripe(std::size_t h) const noexcept
+        {
+            return stripes_[stripe_index(h)];
+        }
+
+        template <typename Elements>
+        void sort_by_stripe(Elements& elements) const
+        {
+            std::sort(elements.begin(), elements.end(),
+                [this](auto const& lhs, auto const& rhs) {
+                    return stripe_index(lhs.first) < stripe_index(rhs.first);
+                });
+        }
+
+        // invoke f(stripe, hash, element) for all elements while holding the
+        // lock of their stripe, the elements have to be sorted by stripe
+        template <typename Elements, typename F>
+        void for_each_stripe_group(Elements const& elements, F&& f) const
+        {
+            auto it = elements.begin();
+            while (it != elements.end())
+            {
+                std::size_t const index = stripe_index(it->first);
+                stripe& s = stripes_[index];
+
+                std::lock_guard<hpx::util::spinlock> l(s.mtx);
+                for (/**/;
+                     it != elements.end() && stripe_index(it->first) == index;
+                     ++it)
+                {
+                    f(s, it->first, it->second);
+                }
+            }
+        }
+
+        // all functions below have to be called while holding the lock of
+        // the given stripe
+        template <typename K>
+        std::size_t find_locked(
+            stripe const& s, std::size_t h, K const& key) const
+        {
+            if (s.slots.empty())
+            {
+                return npos;
+            }
+
+            std::size_t const mask = s.slots.size() - 1;
+            for (std::size_t pos = h & mask;; pos = (pos + 1) & mask)
+            {
+                slot const& e = s.slots[pos];
+                if (!e.value)
+                {
+                    return npos;
+                }
+                if (e.hash == h && equal_(e.value->first, key))
+                {
+                    return pos;
+                }
+            }
+        }
+
+        // returns the position of the element and whether it was inserted
+        template <typename K, typename... Ts>
+        std::pair<std::size_t, bool> insert_locked(
+            stripe& s, std::size_t h, K&& key, Ts&&... ts)
+        {
+            std::size_t const existing = find_locked(s, h, key);
+            if (existing != npos)
+            {
+                return {existing, false};
+            }
+
+            size_type const size = s.size.load(std::memory_order_relaxed);
+            if (needs_grow(size, s.slots.size()))
+            {
+                grow(s);
+            }
+
+            std::size_t const pos = free_slot(s, h);
+            slot& e = s.slots[pos];
+            e.value.emplace(std::piecewise_construct,
+                std::forward_as_tuple(HPX_FORWARD(K, key)),
+                std::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+            e.hash = h;
+
+            s.size.store(size + 1, std::memory_order_relaxed);
+            return {pos, true};
+        }
+
+        static std::size_t free_slot(stripe const& s, std::size_t h) noexcept
+        {
+            std::size_t const mask = s.slots.size() - 1;
+            std::size_t pos = h & mask;
+            while (s.slots[pos].value)
+            {
+                pos = (pos + 1) & mask;
+            }
+            return pos;
+        }
+
+        void grow(stripe& s)
+        {
+            slots_type slots((std::max)(s.slots.size() * 2, min_capacity),
+                slot_allocator(alloc_));
+            std::swap(slots, s.slots);
+
+            for (slot& e : slots)
+            {
+                if (e.value)
+                {
+                    slot& target = s.slots[free_slot(s, e.hash)];
+                    target.hash = e.hash;
+                    target.value.emplace(HPX_MOVE(*e.value));
+                }
+            }
+        }
+
+        // backward shift deletion, no tombstones are needed
+        void erase_locked(stripe& s, std::size_t pos)
+        {
+            std::size_t const mask = s.slots.size() - 1;
+            s.slots[pos].value.reset();
+
+            for (std::size_t next = (pos + 1) & mask; s.slots[next].value;
+                 next = (next + 1) & mask)
+            {
+                // move the element to the freed slot if that slot lies
+                // between its home position and its current position
+                std::size_t const home = s.slots[next].hash & mask;
+                if (((next - home) & mask) >= ((next - pos) & mask))
+                {
+                    s.slots[pos].hash = s.slots[next].hash;
+                    s.slots[pos].value.emplace(
+                        HPX_MOVE(*s.slots[next].value));
+                    s.slots[next].value.reset();
+                    pos = next;
+                }
+            }
+
+            s.size.store(s.size.load(std::memory_order_relaxed) - 1,
+                std::memory_order_relaxed);
+        }
+
+        HPX_NO_UNIQUE_ADDRESS Hash hash_;
+        HPX_NO_UNIQUE_ADDRESS KeyEqual equal_;
+        HPX_NO_UNIQUE_ADDRESS stripe_allocator alloc_;
+
+        size_type const num_stripes_;
+        stripe* stripes_;
+    };
+}    // namespace hpx::util
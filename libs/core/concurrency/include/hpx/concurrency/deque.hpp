@@ -260,10 +260,14 @@ namespace hpx::lockfree {
         using node_allocator =
             typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
 
+        // epoch_freelist_t returns unused nodes to the operating system
         using pool =
             std::conditional_t<std::is_same_v<freelist_t, caching_freelist_t>,
                 caching_freelist<node, node_allocator>,
-                static_freelist<node, node_allocator>>;
+                std::conditional_t<
+                    std::is_same_v<freelist_t, epoch_freelist_t>,
+                    epoch_freelist<node, node_allocator>,
+                    static_freelist<node, node_allocator>>>;
 
     private:
         anchor anchor_;
@@ -436,6 +440,8 @@ namespace hpx::lockfree {
         // to allocate a new deque node. Complexity: O(Processes)
         bool push_left(T data)
         {
+            [[maybe_unused]] typename pool::epoch_guard_type guard;
+
             // Allocate the new node which we will be inserting.
             node* n = alloc_node(nullptr, nullptr, HPX_MOVE(data));
 
@@ -493,6 +499,8 @@ namespace hpx::lockfree {
         // to allocate a new deque node. Complexity: O(Processes)
         bool push_right(T data)
         {
+            [[maybe_unused]] typename pool::epoch_guard_type guard;
+
             // Allocate the new node which we will be inserting.
             node* n = alloc_node(nullptr, nullptr, HPX_MOVE(data));
 
@@ -549,6 +557,8 @@ namespace hpx::lockfree {
         // Complexity: O(Processes)
         bool pop_left(T& r) noexcept
         {
+            [[maybe_unused]] typename pool::epoch_guard_type guard;
+
             // Loop until we either pop an element or learn that the deque is
             // empty.
             while (true)
@@ -617,6 +627,8 @@ namespace hpx::lockfree {
         // Complexity: O(Processes)
         bool pop_right(T& r) noexcept
         {
+            [[maybe_unused]] typename pool::epoch_guard_type guard;
+
             // Loop until we either pop an element or learn that the deque is
             // empty.
             while (true)
@@ -231,6 +231,54 @@ namespace hpx::concurrency::detail {
             }
         }
 
+        /// \brief Attempt to pop the right half of the remaining items of the
+        ///        queue.
+        ///
+        /// Attempt to pop the right half (rounded up) of the remaining items
+        /// of the queue at once. If no items are left hpx::nullopt is
+        /// returned, otherwise the popped range [first, last).
+        hpx::optional<std::pair<T, T>> pop_right_half() noexcept
+        {
+            range desired_range{0, 0};
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::optional<std::pair<T, T>>(hpx::nullopt);
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count = expected_range.last - expected_range.first;
+                desired_range = range{expected_range.first,
+                    static_cast<T>(expected_range.last - (count + 1) / 2)};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::pair<T, T>(desired_range.last, expected_range.last));
+        }
+
+        /// \brief Refill an empty queue with the given range.
+        ///
+        /// Replace the range of the queue, other threads may concurrently
+        /// attempt to pop items. This must be called only by the thread
+        /// owning the queue and only if the queue is empty (no other thread
+        /// can add items to it).
+        void refill(T first, T last) noexcept
+        {
+            HPX_ASSERT(empty());
+            HPX_ASSERT(first <= last);
+            current_range.data_.store(
+                range{first, last}, std::memory_order_release);
+        }
+
         constexpr bool empty() const noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
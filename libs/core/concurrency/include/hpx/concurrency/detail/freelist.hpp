@@ -58,6 +58,32 @@ namespace hpx::lockfree {
         }
     };
 
+    // A freelist returning the nodes it does not need anymore to the
+    // operating system, see detail::epoch_freelist. The threads accessing
+    // the nodes have to hold an epoch_guard_type while doing so.
+    template <typename T, typename Alloc = std::allocator<T>>
+    class epoch_freelist : public lockfree::detail::epoch_freelist<T, Alloc>
+    {
+        using base_type = lockfree::detail::epoch_freelist<T, Alloc>;
+
+    public:
+        explicit epoch_freelist(std::size_t n = 0)
+          : lockfree::detail::epoch_freelist<T, Alloc>(Alloc(), n)
+        {
+        }
+
+        T* allocate()
+        {
+            return this->base_type::template allocate<true, false>();
+        }
+
+        // the node has to be destroyed already
+        void deallocate(T* n) noexcept
+        {
+            this->base_type::template deallocate<true>(n);
+        }
+    };
+
     struct caching_freelist_t
     {
     };
@@ -65,4 +91,8 @@ namespace hpx::lockfree {
     struct static_freelist_t
     {
     };
+
+    struct epoch_freelist_t
+    {
+    };
 }    // namespace hpx::lockfree
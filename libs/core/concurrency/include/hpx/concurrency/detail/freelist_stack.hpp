@@ -15,6 +15,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/concurrency/epoch.hpp>
 #include <hpx/concurrency/detail/tagged_ptr.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/type_support/bit_cast.hpp>
@@ -28,6 +29,15 @@
 
 namespace hpx::lockfree::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Freelists that never return their nodes to the operating system while
+    // in use don't require the threads accessing their nodes to hold an
+    // epoch_guard.
+    struct no_epoch_guard
+    {
+        constexpr no_epoch_guard() noexcept = default;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Alloc = std::allocator<T>>
     class freelist_stack : Alloc
@@ -42,6 +52,7 @@ namespace hpx::lockfree::detail {
     public:
         using index_t = T*;
         using tagged_node_handle = tagged_ptr<T>;
+        using epoch_guard_type = no_epoch_guard;
 
         template <typename Allocator>
         explicit freelist_stack(Allocator const& alloc, std::size_t n = 0)
@@ -436,6 +447,7 @@ namespace hpx::lockfree::detail {
     public:
         using tagged_node_handle = tagged_index;
         using index_t = tagged_index::index_t;
+        using epoch_guard_type = no_epoch_guard;
 
         template <typename Allocator>
         fixed_size_freelist(Allocator const& alloc, std::size_t count)
@@ -623,8 +635,173 @@ namespace hpx::lockfree::detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // A freelist that returns the nodes it does not need anymore to the
+    // operating system. Deallocated nodes are retired first and are reused
+    // or freed only once no thread can access them anymore, the threads
+    // accessing the nodes of the data structure using the freelist have to
+    // hold an epoch_guard (see epoch_guard_type) while doing so.
+    //
+    // The freelist keeps as many nodes as have been reserved (during
+    // construction or using reserve), all other nodes are freed once they
+    // have been reclaimed. This bounds the memory held by a data structure
+    // by its high water mark of reserved and live nodes.
+    template <typename T, typename Alloc = std::allocator<T>>
+    class epoch_freelist : public freelist_stack<T, Alloc>
+    {
+        using base_type = freelist_stack<T, Alloc>;
+
+        // the storage of retired nodes is used to link them
+        static_assert(sizeof(T) >= sizeof(epoch_retire_list::node) &&
+            alignof(T) >= alignof(epoch_retire_list::node));
+
+        // attempt to reclaim retired nodes every n-th deallocation
+        static constexpr std::size_t collect_interval = 64;
+
+    public:
+        using tagged_node_handle = typename base_type::tagged_node_handle;
+        using epoch_guard_type = epoch_guard;
+
+        template <typename Allocator>
+        explicit epoch_freelist(Allocator const& alloc, std::size_t n = 0)
+          : base_type(alloc, n)
+          , alloc_(alloc)
+          , reserved_(static_cast<std::ptrdiff_t>(n))
+          , pooled_(static_cast<std::ptrdiff_t>(n))
+        {
+        }
+
+        epoch_freelist(epoch_freelist const&) = delete;
+        epoch_freelist(epoch_freelist&&) = delete;
+        epoch_freelist& operator=(epoch_freelist const&) = delete;
+        epoch_freelist& operator=(epoch_freelist&&) = delete;
+
+        // the remaining retired nodes are freed by the base class
+        ~epoch_freelist()
+        {
+            retired_.clear([this](void* p) {
+                base_type::template deallocate<false>(static_cast<T*>(p));
+            });
+        }
+
+        template <bool ThreadSafe>
+        void reserve(std::size_t count)
+        {
+            base_type::template reserve<ThreadSafe>(count);
+            reserved_.fetch_add(
+                static_cast<std::ptrdiff_t>(count), std::memory_order_relaxed);
+            pooled_.fetch_add(
+                static_cast<std::ptrdiff_t>(count), std::memory_order_relaxed);
+        }
+
+        template <bool ThreadSafe, bool Bounded, typename... Ts>
+        T* construct(Ts&&... ts)
+        {
+            T* node = allocate<ThreadSafe, Bounded>();
+            if (node)
+                new (node) T(HPX_FORWARD(Ts, ts)...);
+            return node;
+        }
+
+        template <bool ThreadSafe>
+        void destruct(tagged_node_handle const& tagged_ptr) noexcept
+        {
+            destruct<ThreadSafe>(tagged_ptr.get_ptr());
+        }
+
+        template <bool ThreadSafe>
+        void destruct(T* n) noexcept
+        {
+            std::destroy_at(n);
+            deallocate<ThreadSafe>(n);
+        }
+
+        // Attempt to reclaim the retired nodes, returns the number of
+        // reclaimed nodes.
+        std::size_t collect()
+        {
+            return retired_.collect(
+                [this](void* p) { reclaim(static_cast<T*>(p)); });
+        }
+
+    protected:
+        template <bool ThreadSafe, bool Bounded>
+        T* allocate()
+        {
+            // nodes taken from the freelist might be reclaimed concurrently
+            // by other threads
+            epoch_guard_type guard;
+
+            T* node = base_type::template allocate<ThreadSafe, true>();
+            if (node == nullptr)
+            {
+                epoch::try_advance();
+                if (collect() != 0)
+                {
+                    node = base_type::template allocate<ThreadSafe, true>();
+                }
+            }
+
+            if (node != nullptr)
+            {
+                pooled_.fetch_sub(1, std::memory_order_relaxed);
+                return node;
+            }
+
+            if constexpr (!Bounded)
+            {
+                node = std::allocator_traits<Alloc>::allocate(alloc_, 1);
+                std::memset(static_cast<void*>(node), 0, sizeof(T));
+            }
+            return node;
+        }
+
+        // The node has been destroyed already, it is retired and will be
+        // reused or freed once no thread can access it anymore.
+        template <bool ThreadSafe>
+        void deallocate(T* n) noexcept
+        {
+            retired_.retire(n);
+
+            if (deallocations_.fetch_add(1, std::memory_order_relaxed) %
+                    collect_interval ==
+                collect_interval - 1)
+            {
+                epoch::try_advance();
+                collect();
+            }
+        }
+
+    private:
+        void reclaim(T* n) noexcept
+        {
+            if (pooled_.load(std::memory_order_relaxed) <
+                reserved_.load(std::memory_order_relaxed))
+            {
+                pooled_.fetch_add(1, std::memory_order_relaxed);
+                base_type::template deallocate<true>(n);
+            }
+            else
+            {
+                std::allocator_traits<Alloc>::deallocate(alloc_, n, 1);
+            }
+        }
+
+        Alloc alloc_;
+        epoch_retire_list retired_;
+
+        // number of nodes to keep, and (approximate) number of nodes held
+        // by the freelist
+        std::atomic<std::ptrdiff_t> reserved_;
+        std::atomic<std::ptrdiff_t> pooled_;
+
+        std::atomic<std::size_t> deallocations_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Node based data structures using ReclaimNodes == true return the nodes
+    // they don't need anymore to the operating system (see epoch_freelist).
     template <typename T, typename Alloc, bool IsCompileTimeSized,
-        bool IsFixedSize, std::size_t Capacity>
+        bool IsFixedSize, std::size_t Capacity, bool ReclaimNodes = false>
     struct select_freelist
     {
         using fixed_sized_storage_type = std::conditional_t<IsCompileTimeSized,
@@ -633,7 +810,8 @@ namespace hpx::lockfree::detail {
 
         using type = std::conditional_t<IsCompileTimeSized || IsFixedSize,
             fixed_size_freelist<T, fixed_sized_storage_type>,
-            freelist_stack<T, Alloc>>;
+            std::conditional_t<ReclaimNodes, epoch_freelist<T, Alloc>,
+                freelist_stack<T, Alloc>>>;
     };
 
     template <typename T, bool IsNodeBased>
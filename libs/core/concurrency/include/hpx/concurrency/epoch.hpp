@@ -0,0 +1,212 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file epoch.hpp
+/// Epoch based memory reclamation for lock-free data structures (see K.
+/// Fraser, "Practical lock-freedom", 2004).
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::lockfree {
+
+    namespace detail {
+
+        struct epoch_record;
+
+        HPX_CORE_EXPORT epoch_record* epoch_enter() noexcept;
+        HPX_CORE_EXPORT void epoch_leave(epoch_record* record) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Threads accessing the nodes of a lock-free data structure announce
+    // this by holding an epoch_guard. An object that has been unlinked from
+    // a data structure is retired (see epoch_retire_list) and may be freed
+    // only after the global epoch has been advanced twice since, at which
+    // point no thread can hold a reference to it anymore. The global epoch
+    // can be advanced only once all threads holding an epoch_guard have
+    // observed its current value.
+    //
+    // The epoch is advanced by the scheduling loops of the HPX worker threads
+    // (see quiescent_state) and by data structures that have retired
+    // objects waiting to be freed.
+    namespace epoch {
+
+        // Return the current global epoch.
+        [[nodiscard]] HPX_CORE_EXPORT std::uint64_t current() noexcept;
+
+        // Advance the global epoch if all threads holding an epoch_guard
+        // have observed the current epoch, returns whether the epoch has
+        // been advanced (by this or by any other thread).
+        HPX_CORE_EXPORT bool try_advance() noexcept;
+
+        // Announce that the calling thread does not hold any references to
+        // nodes of lock-free data structures. This is called regularly by
+        // the scheduling loop of the HPX worker threads, it attempts to
+        // advance the epoch every so often.
+        HPX_CORE_EXPORT void quiescent_state() noexcept;
+
+        // Return whether an object retired in the given epoch can't be
+        // accessed by any thread anymore.
+        [[nodiscard]] inline bool is_reclaimable(
+            std::uint64_t retired) noexcept
+        {
+            return current() >= retired + 2;
+        }
+    }    // namespace epoch
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Objects retired while an epoch_guard is held by the current thread are
+    // not freed before the guard has been released. Guards can be nested.
+    // The guard is associated with the current OS thread, an HPX thread must
+    // therefore not be suspended while holding an epoch_guard.
+    class epoch_guard
+    {
+    public:
+        epoch_guard() noexcept
+          : record_(detail::epoch_enter())
+        {
+        }
+
+        epoch_guard(epoch_guard const&) = delete;
+        epoch_guard(epoch_guard&&) = delete;
+        epoch_guard& operator=(epoch_guard const&) = delete;
+        epoch_guard& operator=(epoch_guard&&) = delete;
+
+        ~epoch_guard()
+        {
+            detail::epoch_leave(record_);
+        }
+
+    private:
+        detail::epoch_record* record_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A list of objects that have been unlinked from a lock-free data
+    // structure but might still be accessed by threads holding an
+    // epoch_guard. Retiring an object and collecting the objects that can be
+    // freed are both thread-safe and lock-free.
+    //
+    // The list is intrusive: the storage of a retired object is used to
+    // link it into the list, the object has to be destroyed before being
+    // retired, and its storage has to be at least as large as (and aligned
+    // like) epoch_retire_list::node.
+    class epoch_retire_list
+    {
+    public:
+        struct node
+        {
+            node* next;
+            std::uint64_t epoch;
+        };
+
+        constexpr epoch_retire_list() noexcept = default;
+
+        epoch_retire_list(epoch_retire_list const&) = delete;
+        epoch_retire_list(epoch_retire_list&&) = delete;
+        epoch_retire_list& operator=(epoch_retire_list const&) = delete;
+        epoch_retire_list& operator=(epoch_retire_list&&) = delete;
+
+        // the remaining objects have to be collected explicitly (see clear)
+        ~epoch_retire_list() = default;
+
+        // Retire the object stored at the given address.
+        void retire(void* p) noexcept
+        {
+            node* n = ::new (p) node{nullptr, epoch::current()};
+            push(n, n);
+        }
+
+        // Invoke f(p) for all retired objects that can't be accessed
+        // anymore, returns the number of objects passed to f.
+        template <typename F>
+        std::size_t collect(F&& f)
+        {
+            if (head_.load(std::memory_order_relaxed) == nullptr)
+            {
+                return 0;
+            }
+
+            node* list = head_.exchange(nullptr, std::memory_order_acquire);
+            std::uint64_t const now = epoch::current();
+
+            std::size_t count = 0;
+            node* keep = nullptr;
+            node* keep_last = nullptr;
+            while (list != nullptr)
+            {
+                node* next = list->next;
+                if (now >= list->epoch + 2)
+                {
+                    f(static_cast<void*>(list));
+                    ++count;
+                }
+                else
+                {
+                    list->next = keep;
+                    keep = list;
+                    if (keep_last == nullptr)
+                    {
+                        keep_last = list;
+                    }
+                }
+                list = next;
+            }
+
+            if (keep != nullptr)
+            {
+                push(keep, keep_last);
+            }
+            return count;
+        }
+
+        // Invoke f(p) for all retired objects, this is not thread-safe and
+        // may be used only once no thread accesses the data structure
+        // anymore.
+        template <typename F>
+        std::size_t clear(F&& f)
+        {
+            std::size_t count = 0;
+            node* list = head_.exchange(nullptr, std::memory_order_acquire);
+            while (list != nullptr)
+            {
+                node* next = list->next;
+                f(static_cast<void*>(list));
+                ++count;
+                list = next;
+            }
+            return count;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return head_.load(std::memory_order_relaxed) == nullptr;
+        }
+
+    private:
+        void push(node* first, node* last) noexcept
+        {
+            last->next = head_.load(std::memory_order_relaxed);
+            while (!head_.compare_exchange_weak(last->next, first,
+                std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::atomic<node*> head_{nullptr};
+    };
+}    // namespace hpx::lockfree
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -29,7 +29,8 @@ namespace hpx::lockfree {
      * popping is lock-free,
      *  construction/destruction has to be synchronized. It uses a freelist for
      *  memory management, freed nodes are pushed to the freelist and not
-     *  returned to the OS before the queue is destroyed.
+     *  returned to the OS before the queue is destroyed, unless
+     *  ReclaimNodes is true.
      *
      *  \b Policies:
      *  - \ref hpx::lockfree::fixed_sized, defaults to \c
@@ -51,13 +52,20 @@ namespace hpx::lockfree {
      *    hpx::lockfree::allocator<std::allocator<void>> \n Specifies the
      *    allocator that is used for the internal freelist
      *
+     *  - ReclaimNodes, defaults to false \n If the queue is node based,
+     *    nodes exceeding the number of initially reserved nodes are returned
+     *    to the OS once no thread accesses them anymore (see
+     *    hpx::lockfree::epoch_guard). This bounds the memory held by the
+     *    queue by its high water mark.
+     *
      *  \b Requirements:
      *   - T must have a copy constructor
      *   - T must have a trivial assignment operator
      *   - T must have a trivial destructor
      */
     template <typename T, typename Allocator = std::allocator<T>,
-        std::size_t Capacity = 0, bool IsFixedSize = false>
+        std::size_t Capacity = 0, bool IsFixedSize = false,
+        bool ReclaimNodes = false>
     class queue
     {
     private:
@@ -115,7 +123,8 @@ namespace hpx::lockfree {
             Allocator>::template rebind_alloc<node>;
 
         using pool_t = typename detail::select_freelist<node, node_allocator,
-            compile_time_sized, fixed_sized, capacity>::type;
+            compile_time_sized, fixed_sized, capacity, ReclaimNodes>::type;
+        using epoch_guard_type = typename pool_t::epoch_guard_type;
 
         using tagged_node_handle = typename pool_t::tagged_node_handle;
         using handle_type = typename detail::select_tagged_handle<node,
@@ -341,6 +350,8 @@ namespace hpx::lockfree {
         template <bool Bounded, typename T_>
         bool do_push(T_&& t)
         {
+            [[maybe_unused]] epoch_guard_type guard;
+
             node* n = pool.template construct<true, Bounded>(
                 HPX_FORWARD(T_, t), pool.null_handle());
             handle_type node_handle = pool.get_handle(n);
@@ -459,6 +470,8 @@ namespace hpx::lockfree {
         bool pop(U& ret) noexcept(
             noexcept(std::is_nothrow_constructible_v<U, T>))
         {
+            [[maybe_unused]] epoch_guard_type guard;
+
             for (;;)
             {
                 tagged_node_handle head = head_.load(std::memory_order_acquire);
@@ -29,7 +29,8 @@ namespace hpx::lockfree {
      * popping is lock-free,
      *  construction/destruction has to be synchronized. It uses a freelist for
      *  memory management, freed nodes are pushed to the freelist and not
-     *  returned to the OS before the stack is destroyed.
+     *  returned to the OS before the stack is destroyed, unless
+     *  ReclaimNodes is true.
      *
      *  \b Policies:
      *
@@ -52,12 +53,18 @@ namespace hpx::lockfree {
      *    hpx::lockfree::allocator<std::allocator<void>> <br> Specifies the
      *    allocator that is used for the internal freelist
      *
+     *  - ReclaimNodes, defaults to false <br> If the stack is node based,
+     *    nodes exceeding the number of initially reserved nodes are returned
+     *    to the OS once no thread accesses them anymore (see
+     *    hpx::lockfree::epoch_guard).
+     *
      *  \b Requirements:
      *  - T must have a copy constructor
      *
      */
     template <typename T, typename Allocator = std::allocator<T>,
-        std::size_t Capacity = 0, bool IsFixedSize = false>
+        std::size_t Capacity = 0, bool IsFixedSize = false,
+        bool ReclaimNodes = false>
     class stack
     {
     private:
@@ -100,7 +107,8 @@ namespace hpx::lockfree {
             Allocator>::template rebind_alloc<node>;
 
         using pool_t = typename detail::select_freelist<node, node_allocator,
-            compile_time_sized, fixed_sized, capacity>::type;
+            compile_time_sized, fixed_sized, capacity, ReclaimNodes>::type;
+        using epoch_guard_type = typename pool_t::epoch_guard_type;
         using tagged_node_handle = typename pool_t::tagged_node_handle;
 
         // check compile-time capacity
@@ -582,6 +590,8 @@ namespace hpx::lockfree {
         template <typename F>
         bool consume_one(F&& f)
         {
+            [[maybe_unused]] epoch_guard_type guard;
+
             tagged_node_handle old_tos = tos.load(std::memory_order_consume);
 
             for (;;)
@@ -0,0 +1,188 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/epoch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::lockfree {
+
+    namespace detail {
+
+        struct epoch_record_data
+        {
+            // (epoch << 1) | 1 while the thread holds an epoch_guard, zero
+            // otherwise
+            std::atomic<std::uint64_t> state{0};
+            std::uint32_t nesting = 0;
+
+            // the record is owned by a thread
+            std::atomic<bool> in_use{true};
+
+            epoch_record* next = nullptr;
+        };
+
+        // Every thread that has used an epoch_guard owns a record, records
+        // are reused once their threads have exited but are never freed.
+        struct epoch_record
+          : util::cache_aligned_data_derived<epoch_record_data>
+        {
+        };
+    }    // namespace detail
+
+    namespace {
+
+        std::atomic<std::uint64_t> global_epoch{0};
+        std::atomic<detail::epoch_record*> records{nullptr};
+
+        // attempt to advance the epoch on every n-th quiescent state
+        constexpr std::uint32_t quiescent_interval = 128;
+
+        detail::epoch_record* acquire_record()
+        {
+            using detail::epoch_record;
+
+            for (epoch_record* r = records.load(std::memory_order_acquire);
+                 r != nullptr; r = r->next)
+            {
+                bool expected = false;
+                if (!r->in_use.load(std::memory_order_relaxed) &&
+                    r->in_use.compare_exchange_strong(
+                        expected, true, std::memory_order_acquire))
+                {
+                    return r;
+                }
+            }
+
+            auto* r = new epoch_record();
+            r->next = records.load(std::memory_order_relaxed);
+            while (!records.compare_exchange_weak(r->next, r,
+                std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            return r;
+        }
+
+        struct thread_record
+        {
+            thread_record() = default;
+
+            thread_record(thread_record const&) = delete;
+            thread_record(thread_record&&) = delete;
+            thread_record& operator=(thread_record const&) = delete;
+            thread_record& operator=(thread_record&&) = delete;
+
+            ~thread_record()
+            {
+                if (record != nullptr)
+                {
+                    HPX_ASSERT(record->nesting == 0);
+                    record->state.store(0, std::memory_order_relaxed);
+                    record->in_use.store(false, std::memory_order_release);
+                }
+            }
+
+            detail::epoch_record* get()
+            {
+                if (record == nullptr)
+                {
+                    record = acquire_record();
+                }
+                return record;
+            }
+
+            detail::epoch_record* record = nullptr;
+            std::uint32_t quiescent_calls = 0;
+        };
+
+        thread_record& get_thread_record() noexcept
+        {
+            static thread_local thread_record record;
+            return record;
+        }
+    }    // namespace
+
+    namespace detail {
+
+        epoch_record* epoch_enter() noexcept
+        {
+            epoch_record* r = get_thread_record().get();
+            if (r->nesting++ == 0)
+            {
+                r->state.store(
+                    (global_epoch.load(std::memory_order_relaxed) << 1) | 1,
+                    std::memory_order_relaxed);
+
+                // the announcement has to be visible before any of the
+                // nodes are accessed
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+            return r;
+        }
+
+        void epoch_leave(epoch_record* r) noexcept
+        {
+            // an HPX thread holding a guard has been moved to a different
+            // worker thread
+            HPX_ASSERT(r == get_thread_record().record);
+            HPX_ASSERT(r->nesting != 0);
+
+            if (--r->nesting == 0)
+            {
+                r->state.store(0, std::memory_order_release);
+            }
+        }
+    }    // namespace detail
+
+    namespace epoch {
+
+        std::uint64_t current() noexcept
+        {
+            return global_epoch.load(std::memory_order_acquire);
+        }
+
+        bool try_advance() noexcept
+        {
+            std::uint64_t current =
+                global_epoch.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            for (detail::epoch_record* r =
+                     records.load(std::memory_order_acquire);
+                r != nullptr; r = r->next)
+            {
+                std::uint64_t const state =
+                    r->state.load(std::memory_order_relaxed);
+                if ((state & 1) != 0 && (state >> 1) != current)
+                {
+                    return false;
+                }
+            }
+
+            // the threads that have left their critical regions have done so
+            // before the epoch is advanced
+            std::atomic_thread_fence(std::memory_order_acquire);
+            global_epoch.compare_exchange_strong(current, current + 1,
+                std::memory_order_release, std::memory_order_relaxed);
+            return true;
+        }
+
+        void quiescent_state() noexcept
+        {
+            thread_record& record = get_thread_record();
+            if (++record.quiescent_calls % quiescent_interval == 0 &&
+                (record.record == nullptr || record.record->nesting == 0))
+            {
+                try_advance();
+            }
+        }
+    }    // namespace epoch
+}    // namespace hpx::lockfree
@@ -0,0 +1,196 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using map_type = hpx::util::concurrent_hash_map<int, std::string>;
+
+void test_basic()
+{
+    map_type map;
+    HPX_TEST(map.empty());
+
+    HPX_TEST(map.insert(std::make_pair(1, std::string("one"))));
+    HPX_TEST(map.emplace(2, "two"));
+    HPX_TEST(!map.emplace(2, "zwei"));
+    HPX_TEST_EQ(map.size(), std::size_t(2));
+
+    std::string value;
+    HPX_TEST(map.find(2, value));
+    HPX_TEST_EQ(value, std::string("two"));
+    HPX_TEST(!map.find(3, value));
+    HPX_TEST(!map.find(3).has_value());
+
+    HPX_TEST(!map.insert_or_assign(2, "deux"));
+    HPX_TEST_EQ(*map.find(2), std::string("deux"));
+
+    HPX_TEST(map.visit(1, [](int key, std::string& v) {
+        HPX_TEST_EQ(key, 1);
+        v += "!";
+    }));
+    HPX_TEST_EQ(*map.find(1), std::string("one!"));
+
+    HPX_TEST(map.erase(1));
+    HPX_TEST(!map.erase(1));
+    HPX_TEST(!map.contains(1));
+    HPX_TEST(map.contains(2));
+
+    map.clear();
+    HPX_TEST(map.empty());
+}
+
+// a single stripe with a table that is repeatedly grown and from which
+// elements are erased in between the elements they collided with
+void test_collisions()
+{
+    struct bad_hash
+    {
+        std::size_t operator()(int i) const noexcept
+        {
+            return static_cast<std::size_t>(i % 7);
+        }
+    };
+
+    hpx::util::concurrent_hash_map<int, int, bad_hash> map(0, 1);
+    HPX_TEST_EQ(map.num_stripes(), std::size_t(1));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(map.emplace(i, i));
+    }
+    for (int i = 0; i < 1000; i += 3)
+    {
+        HPX_TEST(map.erase(i));
+    }
+    for (int i = 0; i != 1000; ++i)
+    {
+        std::optional<int> const value = map.find(i);
+        HPX_TEST_EQ(value.has_value(), i % 3 != 0);
+        if (value)
+        {
+            HPX_TEST_EQ(*value, i);
+        }
+    }
+}
+
+void test_bulk()
+{
+    map_type map(1000);
+
+    std::vector<std::pair<int, std::string>> elements;
+    for (int i = 0; i != 1000; ++i)
+    {
+        elements.emplace_back(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(map.insert(elements.begin(), elements.end()),
+        std::size_t(1000));
+    HPX_TEST_EQ(map.insert(elements.begin(), elements.end()), std::size_t(0));
+
+    std::vector<int> keys = {5, 2000, 999, -1, 0};
+    std::vector<std::optional<std::string>> results(keys.size());
+    HPX_TEST_EQ(map.find(keys.begin(), keys.end(), results.begin()),
+        std::size_t(3));
+
+    HPX_TEST_EQ(*results[0], std::string("5"));
+    HPX_TEST(!results[1].has_value());
+    HPX_TEST_EQ(*results[2], std::string("999"));
+    HPX_TEST(!results[3].has_value());
+    HPX_TEST_EQ(*results[4], std::string("0"));
+}
+
+void test_parallel_iteration()
+{
+    hpx::util::concurrent_hash_map<int, int> map;
+    for (int i = 0; i != 10000; ++i)
+    {
+        map.emplace(i, 1);
+    }
+
+    std::atomic<int> sum(0);
+    hpx::experimental::for_loop(hpx::execution::par, std::size_t(0),
+        map.num_stripes(), [&](std::size_t stripe) {
+            map.for_each_in_stripe(stripe, [&](int, int& value) {
+                ++value;
+                sum += value;
+            });
+        });
+    HPX_TEST_EQ(sum.load(), 20000);
+
+    int count = 0;
+    map.for_each([&](int, int value) {
+        HPX_TEST_EQ(value, 2);
+        ++count;
+    });
+    HPX_TEST_EQ(count, 10000);
+}
+
+void test_concurrent()
+{
+    constexpr int num_threads = 8;
+    constexpr int num_keys = 5000;
+
+    hpx::util::concurrent_hash_map<int, int> map;
+
+    std::vector<hpx::future<void>> threads;
+    for (int t = 0; t != num_threads; ++t)
+    {
+        threads.push_back(hpx::async([&, t]() {
+            for (int i = 0; i != num_keys; ++i)
+            {
+                int const key = t * num_keys + i;
+                HPX_TEST(map.emplace(key, key));
+
+                // all threads modify the shared counter
+                map.emplace(-1, 0);
+                map.visit(-1, [](int, int& value) { ++value; });
+
+                if (i % 2 == 0)
+                {
+                    HPX_TEST(map.erase(key));
+                }
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(*map.find(-1), num_threads * num_keys);
+    HPX_TEST_EQ(map.size(), std::size_t(num_threads * num_keys / 2 + 1));
+    for (int key = 0; key != num_threads * num_keys; ++key)
+    {
+        HPX_TEST_EQ(map.contains(key), key % 2 != 0);
+    }
+}
+
+int hpx_main()
+{
+    test_basic();
+    test_collisions();
+    test_bulk();
+    test_parallel_iteration();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
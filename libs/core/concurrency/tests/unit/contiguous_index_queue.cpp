@@ -91,6 +91,44 @@ void test_basic()
         HPX_TEST(!q.pop_left());
         HPX_TEST(!q.pop_right());
     }
+
+    {
+        // Popping half of the items from the right should give us the upper
+        // half of the remaining range (rounded up).
+        std::uint32_t first = 3;
+        std::uint32_t last = 8;
+        hpx::concurrency::detail::contiguous_index_queue<> q{first, last};
+
+        auto half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, std::uint32_t(5));
+        HPX_TEST_EQ(half->second, std::uint32_t(8));
+
+        half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, std::uint32_t(4));
+        HPX_TEST_EQ(half->second, std::uint32_t(5));
+
+        half = q.pop_right_half();
+        HPX_TEST(half);
+        HPX_TEST_EQ(half->first, std::uint32_t(3));
+        HPX_TEST_EQ(half->second, std::uint32_t(4));
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_right_half());
+
+        // Refilling an empty queue should give us the new range.
+        q.refill(5, 8);
+        for (std::uint32_t curr_expected = 5; curr_expected < 8;
+             ++curr_expected)
+        {
+            hpx::optional<std::uint32_t> curr = q.pop_left();
+            HPX_TEST(curr);
+            HPX_TEST_EQ(curr.value(), curr_expected);
+        }
+
+        HPX_TEST(q.empty());
+    }
 }
 
 enum class pop_mode
@@ -0,0 +1,151 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the global epoch is not advanced past threads holding an
+// epoch_guard, and that the lock-free data structures reclaiming their nodes
+// work under contention.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstdint>
+#include <memory>
+
+#include "test_common.hpp"
+
+namespace epoch = hpx::lockfree::epoch;
+
+void advance_epoch(int count)
+{
+    std::uint64_t const target = epoch::current() + count;
+    while (epoch::current() < target)
+    {
+        epoch::try_advance();
+        hpx::this_thread::yield();
+    }
+}
+
+void test_epoch_guard()
+{
+    std::uint64_t start = 0;
+    {
+        hpx::lockfree::epoch_guard guard;
+        start = epoch::current();
+
+        // the epoch can be advanced at most once while the guard is held
+        for (int i = 0; i != 10; ++i)
+        {
+            epoch::try_advance();
+        }
+        HPX_TEST(epoch::current() <= start + 1);
+
+        // guards can be nested
+        {
+            hpx::lockfree::epoch_guard nested;
+            epoch::try_advance();
+        }
+        HPX_TEST(epoch::current() <= start + 1);
+    }
+
+    advance_epoch(2);
+    HPX_TEST(epoch::current() >= start + 2);
+}
+
+void test_retire_list()
+{
+    struct object
+    {
+        void* next;
+        std::uint64_t epoch;
+    };
+
+    object objects[4];
+    hpx::lockfree::epoch_retire_list retired;
+    HPX_TEST(retired.empty());
+
+    int collected = 0;
+    auto const collect = [&](void*) { ++collected; };
+
+    {
+        hpx::lockfree::epoch_guard guard;
+        for (object& o : objects)
+        {
+            retired.retire(&o);
+        }
+
+        // the objects can't be reclaimed while the guard is held
+        epoch::try_advance();
+        epoch::try_advance();
+        HPX_TEST_EQ(retired.collect(collect), std::size_t(0));
+        HPX_TEST(!retired.empty());
+    }
+
+    advance_epoch(2);
+    HPX_TEST_EQ(retired.collect(collect), std::size_t(4));
+    HPX_TEST_EQ(collected, 4);
+    HPX_TEST(retired.empty());
+
+    retired.retire(&objects[0]);
+    HPX_TEST_EQ(retired.clear(collect), std::size_t(1));
+    HPX_TEST_EQ(collected, 5);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+using reclaiming_queue =
+    hpx::lockfree::queue<long, std::allocator<long>, 0, false, true>;
+using reclaiming_stack =
+    hpx::lockfree::stack<long, std::allocator<long>, 0, false, true>;
+
+template <typename Container, bool Bounded>
+void test_stress()
+{
+    using tester_type = queue_stress_tester<Bounded>;
+
+    std::unique_ptr<tester_type> tester(new tester_type(2, 2));
+
+    Container c(128);
+    tester->run(c);
+}
+
+void test_deque()
+{
+    hpx::lockfree::deque<long, hpx::lockfree::epoch_freelist_t> d(16);
+
+    for (long i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(d.push_right(i));
+    }
+
+    long value = 0;
+    for (long i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(d.pop_left(value));
+        HPX_TEST_EQ(value, i);
+    }
+    HPX_TEST(d.empty());
+}
+
+int hpx_main(hpx::program_options::variables_map&)
+{
+    test_epoch_guard();
+    test_retire_list();
+
+    test_stress<reclaiming_queue, true>();
+    test_stress<reclaiming_queue, false>();
+    test_stress<reclaiming_stack, true>();
+    test_stress<reclaiming_stack, false>();
+    test_deque();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init(hpx_main, argc, argv);
+    return hpx::util::report_errors();
+}
@@ -178,11 +178,38 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+/// This defines the number of independently locked shards the local AGAS
+/// cache is split into. Ranges of GIDs are kept in one additional shard.
+///
+/// This value can be changed at runtime by setting the configuration parameter:
+///
+///   hpx.agas.local_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_LOCAL_CACHE_SHARDS)
+#if !defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+#  define HPX_AGAS_LOCAL_CACHE_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+/// This defines the maximal time [us] pending decref requests are held back
+/// in order to send them to AGAS in bulk. A value of zero disables the time
+/// limit.
+///
+/// This value can be changed at runtime by setting the configuration parameter:
+///
+///   hpx.agas.refcnt_flush_interval = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_REFCNT_FLUSH_INTERVAL)
+#if !defined(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)
+#  define HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
@@ -367,6 +394,57 @@
 #  define HPX_THREAD_QUEUE_MAX_ADD_NEW_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Number of staged tasks converted into threads while the queue is unlocked
+// before the new threads are published to the work items queue in one go.
+#if !defined(HPX_THREAD_QUEUE_ADD_NEW_BATCH_SIZE)
+#  define HPX_THREAD_QUEUE_ADD_NEW_BATCH_SIZE 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximal size of trivially destructible results for which the shared states
+// of promises and packaged tasks are recycled through a per-thread cache.
+#if !defined(HPX_FUTURES_CACHED_SHARED_STATE_MAX_SIZE)
+#  define HPX_FUTURES_CACHED_SHARED_STATE_MAX_SIZE 64
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Default for the maximal number of asynchronous continuations of a chain
+// that are run by a single HPX thread (hpx.fused_continuation_depth). Fusing
+// continuations is disabled by default.
+#if !defined(HPX_FUSED_CONTINUATION_MAX_DEPTH)
+#  define HPX_FUSED_CONTINUATION_MAX_DEPTH 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of inputs hpx::experimental::when_all_inline and
+// hpx::execution::experimental::when_all_vector store without allocating.
+#if !defined(HPX_WHEN_ALL_INLINE_SIZE)
+#  define HPX_WHEN_ALL_INLINE_SIZE 4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Size [bytes] of the per-site data below which hpx::collectives::all_reduce
+// on a channel_communicator uses recursive doubling instead of one of the
+// bandwidth-optimal (ring or Rabenseifner) algorithms.
+#if !defined(HPX_COLLECTIVES_ALL_REDUCE_SMALL_MESSAGE_SIZE)
+#  define HPX_COLLECTIVES_ALL_REDUCE_SMALL_MESSAGE_SIZE 65536
+#endif
+
+// Size [bytes] of the blocks sent to each site up to which
+// hpx::collectives::all_to_all on a channel_communicator uses the Bruck
+// algorithm instead of the pairwise exchange.
+#if !defined(HPX_COLLECTIVES_ALL_TO_ALL_SMALL_MESSAGE_SIZE)
+#  define HPX_COLLECTIVES_ALL_TO_ALL_SMALL_MESSAGE_SIZE 256
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Default size [bytes] of the segments a broadcast on a channel_communicator
+// splits its payload into.
+#if !defined(HPX_COLLECTIVES_BROADCAST_SEGMENT_SIZE)
+#  define HPX_COLLECTIVES_BROADCAST_SEGMENT_SIZE 1048576
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Minimum number of terminated threads to delete in one go.
 #if !defined(HPX_THREAD_QUEUE_MIN_DELETE_COUNT)
@@ -392,6 +470,13 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Interval [ms] at which a thread queue trims its lists of recycled threads
+// back to its recent working set, 0 disables trimming.
+#if !defined(HPX_THREAD_QUEUE_TRIM_INTERVAL)
+#  define HPX_THREAD_QUEUE_TRIM_INTERVAL 0
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
@@ -399,6 +484,35 @@
 #  define HPX_IDLE_BACKOFF_TIME_MAX 1000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Number of unsatisfied steal requests circulated in the local NUMA domain
+// before the work-requesting scheduler asks remote NUMA domains for work (used
+// only if hierarchical victim selection is enabled).
+#if !defined(HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF)
+#  define HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF 4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximal number of tasks the work-requesting scheduler sends in response to a
+// single steal-half request.
+#if !defined(HPX_WORKREQUESTING_MAX_STEAL_BATCH)
+#  define HPX_WORKREQUESTING_MAX_STEAL_BATCH 256
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of iterations the parallel loops run between two cooperative
+// preemption checks (see hpx::this_thread::check_preempt).
+#if !defined(HPX_PREEMPTION_CHECK_INTERVAL)
+#  define HPX_PREEMPTION_CHECK_INTERVAL 1024
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of iterations the cancellable loops (used by the searching
+// algorithms, e.g. find_if) run between two checks of the cancellation token.
+#if !defined(HPX_CANCELLATION_CHECK_INTERVAL)
+#  define HPX_CANCELLATION_CHECK_INTERVAL 256
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_WRAPPER_HEAP_STEP)
 #  define HPX_WRAPPER_HEAP_STEP 0xFFFFU
@@ -366,7 +366,7 @@ namespace hpx::threads::coroutines::detail {
             this->start_yield_fiber(&this->asan_fake_stack, m_caller);
 #endif
 
-            do_yield();
+            swap_context(*this, m_caller, detail::exit_hint());
         }
 
     protected:
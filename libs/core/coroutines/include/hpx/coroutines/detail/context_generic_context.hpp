@@ -239,6 +239,12 @@ namespace hpx::threads::coroutines {
                 return stack_size_;
             }
 
+            // stack usage tracking is not supported for this context
+            static constexpr std::size_t get_stack_usage() noexcept
+            {
+                return 0;
+            }
+
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             std::ptrdiff_t get_available_stack_space() const noexcept
             {
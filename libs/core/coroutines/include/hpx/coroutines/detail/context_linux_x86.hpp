@@ -16,8 +16,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/config/defines.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/coroutines/detail/stack_usage.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 #include <hpx/coroutines/signal_handler_debugging.hpp>
 #include <hpx/debugging/attach_debugger.hpp>
@@ -30,6 +33,7 @@
 #include <hpx/debugging/backtrace.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -77,9 +81,12 @@
 // by 25% at least on P4 for invoke+yield back loops at the cost of a slightly
 // higher instruction cache use and is thus enabled by default.
 
-#if defined(__x86_64__)
+#if defined(__x86_64__) || defined(__aarch64__)
 extern "C" void swapcontext_stack(void***, void**) noexcept;
 extern "C" void swapcontext_stack2(void***, void**) noexcept;
+
+// Restores the given context without saving the current one
+extern "C" void jumpcontext_stack(void**) noexcept;
 #else
 extern "C" void swapcontext_stack(void***, void**) noexcept
     __attribute((regparm(2)));
@@ -200,7 +207,7 @@ namespace hpx::threads::coroutines::detail::lx {
 
         void prefetch() const
         {
-#if defined(__x86_64__)
+#if defined(__x86_64__) || defined(__aarch64__)
             static_assert(sizeof(void*) == 8);
 #else
             static_assert(sizeof(void*) == 4);
@@ -212,7 +219,7 @@ namespace hpx::threads::coroutines::detail::lx {
                 static_cast<void**>(m_sp) + 64 / sizeof(void*), 1, 3);
             __builtin_prefetch(
                 static_cast<void**>(m_sp) + 64 / sizeof(void*), 0, 3);
-#if !defined(__x86_64__)
+#if !defined(__x86_64__) && !defined(__aarch64__)
             __builtin_prefetch(
                 static_cast<void**>(m_sp) + 32 / sizeof(void*), 1, 3);
             __builtin_prefetch(
@@ -237,6 +244,9 @@ namespace hpx::threads::coroutines::detail::lx {
         friend void swap_context(x86_linux_context_impl_base& from,
             x86_linux_context_impl_base const& to, yield_hint) noexcept;
 
+        friend void swap_context(x86_linux_context_impl_base& from,
+            x86_linux_context_impl_base const& to, exit_hint) noexcept;
+
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
         void start_switch_fiber(void** fake_stack) noexcept
         {
@@ -289,6 +299,7 @@ namespace hpx::threads::coroutines::detail::lx {
                     static_cast<std::ptrdiff_t>(default_stack_size) :
                     stack_size)
           , m_stack(nullptr)
+          , m_stack_filled(0)
         {
         }
 
@@ -311,13 +322,15 @@ namespace hpx::threads::coroutines::detail::lx {
                     "stack size of {1} is invalid", m_stack_size));
             }
 
-            m_stack =
-                posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+            m_stack = posix::allocate_pooled_stack(
+                static_cast<std::size_t>(m_stack_size));
             if (m_stack == nullptr)
             {
                 throw std::runtime_error("could not allocate memory for stack");
             }
 
+            fill_stack_if_tracked(static_cast<std::size_t>(m_stack_size));
+
             posix::watermark_stack(
                 m_stack, static_cast<std::size_t>(m_stack_size));
 
@@ -328,8 +341,7 @@ namespace hpx::threads::coroutines::detail::lx {
                        static_cast<std::size_t>(m_stack_size) / sizeof(void*)) -
                 context_size;
 
-            m_sp[cb_idx] = this;
-            m_sp[funp_idx] = reinterpret_cast<void*>(funp);
+            init_context_data(funp);
 
 #if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
             {
@@ -354,7 +366,7 @@ namespace hpx::threads::coroutines::detail::lx {
                 VALGRIND_STACK_DEREGISTER(
                     reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                posix::free_stack(
+                posix::deallocate_pooled_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size));
             }
         }
@@ -395,10 +407,12 @@ namespace hpx::threads::coroutines::detail::lx {
                        static_cast<std::size_t>(m_stack_size) / sizeof(void*)) -
                 context_size;
 
+            fill_stack_if_tracked(static_cast<std::size_t>(
+                reinterpret_cast<char*>(m_sp) - static_cast<char*>(m_stack)));
+
             typedef void fun(void*);
             fun* funp = trampoline<CoroutineImpl>;
-            m_sp[cb_idx] = this;
-            m_sp[funp_idx] = reinterpret_cast<void*>(funp);
+            init_context_data(funp);
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
             asan_stack_size = m_stack_size;
             asan_stack_bottom = const_cast<void const*>(m_stack);
@@ -411,6 +425,17 @@ namespace hpx::threads::coroutines::detail::lx {
                 context_size;
         }
 
+        // Return the high-water mark of the stack since the coroutine was
+        // (re-)bound, zero if stack usage tracking is disabled.
+        std::size_t get_stack_usage() const noexcept
+        {
+            if (m_stack_filled == 0)
+                return 0;
+
+            return measure_stack_usage(m_stack, m_stack_filled,
+                static_cast<std::size_t>(m_stack_size));
+        }
+
         using counter_type = std::atomic<std::int64_t>;
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -456,6 +481,9 @@ namespace hpx::threads::coroutines::detail::lx {
         friend void swap_context(x86_linux_context_impl_base& from,
             x86_linux_context_impl_base const& to, yield_hint) noexcept;
 
+        friend void swap_context(x86_linux_context_impl_base& from,
+            x86_linux_context_impl_base const& to, exit_hint) noexcept;
+
     private:
         void set_sigsegv_handler()
         {
@@ -484,27 +512,89 @@ namespace hpx::threads::coroutines::detail::lx {
 #endif
         }
 
-#if defined(__x86_64__)
+#if defined(__x86_64__) &&                                                     \
+    defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
         // structure of context_data:
-        // 11: additional alignment (or valgrind_id if enabled)
-        // 10: parm 0 of trampoline
-        // 9:  dummy return address for trampoline
-        // 8:  return addr (here: start addr)
-        // 7:  rbp
-        // 6:  rbx
-        // 5:  rsi
-        // 4:  rdi
+        // 9:  additional alignment (or valgrind_id if enabled)
+        // 8:  parm 0 of trampoline
+        // 7:  dummy return address for trampoline
+        // 6:  return addr (here: start addr)
+        // 5:  rbp
+        // 4:  rbx
         // 3:  r12
         // 2:  r13
         // 1:  r14
         // 0:  r15
 #if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
-        static constexpr std::size_t const valgrind_id_idx = 11;
+        static constexpr std::size_t const valgrind_id_idx = 9;
+#endif
+
+        static constexpr std::size_t const context_size = 10;
+        static constexpr std::size_t const cb_idx = 8;
+        static constexpr std::size_t const funp_idx = 6;
+#elif defined(__x86_64__)
+        // structure of context_data:
+        // 10: valgrind_id (if enabled)
+        // 9:  parm 0 of trampoline
+        // 8:  dummy return address for trampoline
+        // 7:  return addr (here: start addr)
+        // 6:  rbp
+        // 5:  rbx
+        // 4:  r12
+        // 3:  r13
+        // 2:  r14
+        // 1:  r15
+        // 0:  mxcsr (low half), x87 control word (high half)
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+        static constexpr std::size_t const valgrind_id_idx = 10;
+#endif
+
+        static constexpr std::size_t const context_size = 11;
+        static constexpr std::size_t const cb_idx = 9;
+        static constexpr std::size_t const funp_idx = 7;
+        static constexpr std::size_t const fp_state_idx = 0;
+
+        // the defaults as set up by the ABI: all exceptions masked, round to
+        // nearest, extended precision for x87
+        static constexpr std::uint64_t const fp_state_default =
+            0x1F80 | (std::uint64_t(0x037F) << 32);
+#elif defined(__aarch64__) &&                                                  \
+    defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
+        // structure of context_data:
+        // 21:     additional alignment (or valgrind_id if enabled)
+        // 20:     parm 0 of trampoline
+        // 19:     x30 (here: start addr)
+        // 18:     x29
+        // 8-17:   x19-x28
+        // 0-7:    d8-d15
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+        static constexpr std::size_t const valgrind_id_idx = 21;
 #endif
 
-        static constexpr std::size_t const context_size = 12;
-        static constexpr std::size_t const cb_idx = 10;
-        static constexpr std::size_t const funp_idx = 8;
+        static constexpr std::size_t const context_size = 22;
+        static constexpr std::size_t const cb_idx = 20;
+        static constexpr std::size_t const funp_idx = 19;
+#elif defined(__aarch64__)
+        // structure of context_data:
+        // 23:     additional alignment (or valgrind_id if enabled)
+        // 22:     parm 0 of trampoline
+        // 21:     additional alignment
+        // 20:     fpcr
+        // 19:     x30 (here: start addr)
+        // 18:     x29
+        // 8-17:   x19-x28
+        // 0-7:    d8-d15
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+        static constexpr std::size_t const valgrind_id_idx = 23;
+#endif
+
+        static constexpr std::size_t const context_size = 24;
+        static constexpr std::size_t const cb_idx = 22;
+        static constexpr std::size_t const funp_idx = 19;
+        static constexpr std::size_t const fp_state_idx = 20;
+
+        // round to nearest, no traps enabled
+        static constexpr std::uint64_t const fp_state_default = 0;
 #else
         // structure of context_data:
         // 7: valgrind_id (if enabled)
@@ -523,8 +613,37 @@ namespace hpx::threads::coroutines::detail::lx {
         static constexpr std::size_t const funp_idx = 4;
 #endif
 
+        // set up the initial context, switching to it calls the trampoline
+        template <typename F>
+        void init_context_data(F* funp) noexcept
+        {
+            m_sp[cb_idx] = this;
+            m_sp[funp_idx] = reinterpret_cast<void*>(funp);
+#if (defined(__x86_64__) || defined(__aarch64__)) &&                           \
+    !defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
+            // a new coroutine does not inherit the floating point control
+            // state of the thread it is first run on
+            m_sp[fp_state_idx] = reinterpret_cast<void*>(fp_state_default);
+#endif
+        }
+
+        // pre-fill the unused part of the stack if its usage is tracked,
+        // possibly only its lower end
+        void fill_stack_if_tracked(std::size_t size) noexcept
+        {
+            m_stack_filled = 0;
+            if (get_stack_usage_handler() != nullptr)
+            {
+                m_stack_filled = (std::min)(size,
+                    get_stack_fill_size(
+                        static_cast<std::size_t>(m_stack_size)));
+                fill_stack(m_stack, m_stack_filled);
+            }
+        }
+
         std::ptrdiff_t m_stack_size;
         void* m_stack;
+        std::size_t m_stack_filled;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
@@ -553,6 +672,20 @@ namespace hpx::threads::coroutines::detail::lx {
         swapcontext_stack2(&from.m_sp, to.m_sp);
 #else
         swapcontext_stack(&from.m_sp, to.m_sp);
+#endif
+    }
+
+    // The context of a terminated coroutine is not needed anymore, as its
+    // stack is re-initialized by rebind_stack before it is invoked again.
+    inline void swap_context(
+        [[maybe_unused]] x86_linux_context_impl_base& from,
+        x86_linux_context_impl_base const& to, exit_hint) noexcept
+    {
+        to.prefetch();
+#if defined(__x86_64__) || defined(__aarch64__)
+        jumpcontext_stack(to.m_sp);
+#else
+        swapcontext_stack2(&from.m_sp, to.m_sp);
 #endif
     }
 }    // namespace hpx::threads::coroutines::detail::lx
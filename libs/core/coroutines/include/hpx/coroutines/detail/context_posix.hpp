@@ -167,6 +167,7 @@ namespace hpx::threads::coroutines::detail::posix::ucontext {
 
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 
 #include <atomic>
@@ -250,7 +251,8 @@ namespace hpx::threads::coroutines {
                 if (m_stack != nullptr)
                     return;
 
-                m_stack = alloc_stack(static_cast<std::size_t>(m_stack_size));
+                m_stack = allocate_pooled_stack(
+                    static_cast<std::size_t>(m_stack_size));
                 if (m_stack == nullptr)
                 {
                     throw std::runtime_error(
@@ -332,7 +334,7 @@ namespace hpx::threads::coroutines {
             ~ucontext_context_impl()
             {
                 if (m_stack)
-                    free_stack(m_stack, m_stack_size);
+                    deallocate_pooled_stack(m_stack, m_stack_size);
             }
 
             // Return the size of the reserved stack address space.
@@ -341,6 +343,12 @@ namespace hpx::threads::coroutines {
                 return m_stack_size;
             }
 
+            // stack usage tracking is not supported for this context
+            static constexpr std::size_t get_stack_usage() noexcept
+            {
+                return 0;
+            }
+
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             std::ptrdiff_t get_available_stack_space() const noexcept
             {
@@ -281,6 +281,12 @@ namespace hpx::threads::coroutines {
                 return stacksize_;
             }
 
+            // stack usage tracking is not supported for this context
+            static constexpr std::size_t get_stack_usage() noexcept
+            {
+                return 0;
+            }
+
             static constexpr void reset_stack(bool) noexcept {}
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
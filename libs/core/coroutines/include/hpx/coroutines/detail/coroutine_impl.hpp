@@ -34,6 +34,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/coroutine_fwd.hpp>
 #include <hpx/coroutines/detail/context_base.hpp>
+#include <hpx/coroutines/detail/stack_usage.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/move_only_function.hpp>
@@ -124,6 +125,13 @@ namespace hpx::threads::coroutines::detail {
             m_arg = nullptr;
             m_fun.reset();
 
+            // Report the stack usage of the finished thread, this has to
+            // happen before the stack is reset
+            if (!direct_execution)
+            {
+                report_stack_usage();
+            }
+
             // Then reset the id and stack as they may be used by the
             // destructors of the thread function above
             this->super_type::reset();
@@ -143,6 +151,20 @@ namespace hpx::threads::coroutines::detail {
         }
 
     private:
+        void report_stack_usage() const noexcept
+        {
+            stack_usage_handler_type const handler = get_stack_usage_handler();
+            if (handler != nullptr)
+            {
+                std::size_t const used = this->get_stack_usage();
+                if (used != 0)
+                {
+                    handler(this->get_thread_id(), used,
+                        static_cast<std::size_t>(this->get_stacksize()));
+                }
+            }
+        }
+
         result_type m_result;
         arg_type* m_arg;
         functor_type m_fun;
@@ -33,9 +33,25 @@ namespace hpx::threads::coroutines::detail {
             HPX_ASSERT(pimpl_);
         }
 
-        arg_type yield_impl(result_type) override
-        {
-            // stackless coroutines don't support suspension
+        arg_type yield_impl(result_type arg) override
+        {
+            // Stackless coroutines run on the stack of the underlying OS
+            // thread and can't be suspended. A request to merely yield is
+            // honored by continuing to run the coroutine, any other
+            // suspension is not supported.
+            switch (arg.first)
+            {
+            case threads::thread_schedule_state::pending:
+                [[fallthrough]];
+            case threads::thread_schedule_state::pending_boost:
+                [[fallthrough]];
+            case threads::thread_schedule_state::pending_do_not_schedule:
+                return threads::thread_restart_state::signaled;
+
+            default:
+                break;
+            }
+
             HPX_ASSERT(false);
             return threads::thread_restart_state::abort;
         }
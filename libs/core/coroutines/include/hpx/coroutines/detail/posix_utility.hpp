@@ -31,6 +31,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/memory_statistics.hpp>
 #include <hpx/assert.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
@@ -114,6 +115,9 @@ namespace hpx::threads::coroutines::detail::posix {
             throw std::runtime_error(error_message);
         }
 
+        hpx::util::record_allocation(
+            hpx::util::memory_category::stacks, size);
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -166,14 +170,14 @@ namespace hpx::threads::coroutines::detail::posix {
             void** real_stack =
                 static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
             ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+            hpx::util::record_deallocation(
+                hpx::util::memory_category::stacks, size + EXEC_PAGESIZE);
+            return;
         }
-        else
-        {
-            ::munmap(stack, size);
-        }
-#else
-        ::munmap(stack, size);
 #endif
+        ::munmap(stack, size);
+        hpx::util::record_deallocation(
+            hpx::util::memory_category::stacks, size);
     }
 
 #else
@@ -200,7 +204,10 @@ namespace hpx::threads::coroutines::detail::posix {
      */
     inline void* alloc_stack(std::size_t size)
     {
-        return new stack_aligner[size / sizeof(stack_aligner)];
+        void* stack = new stack_aligner[size / sizeof(stack_aligner)];
+        hpx::util::record_allocation(
+            hpx::util::memory_category::stacks, size);
+        return stack;
     }
 
     inline void watermark_stack(void* stack, std::size_t size) {}    // no-op
@@ -213,6 +220,8 @@ namespace hpx::threads::coroutines::detail::posix {
     inline void free_stack(void* stack, std::size_t size)
     {
         delete[] static_cast<stack_aligner*>(stack);
+        hpx::util::record_deallocation(
+            hpx::util::memory_category::stacks, size);
     }
 
 #endif    // non-mmap() implementation of alloc_stack()/free_stack()
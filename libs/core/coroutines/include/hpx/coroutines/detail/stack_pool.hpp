@@ -0,0 +1,68 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// The stack pool keeps coroutine stacks that are not in use anymore for later
+// reuse instead of handing them back to the operating system. Each worker
+// (operating system) thread maintains its own LIFO free list per stack size,
+// stacks that do not fit into the per-thread free list are handed over to a
+// global overflow pool from where any other thread can pick them up.
+//
+// Optionally, stacks of the small and medium sizes are carved out of memory
+// regions backed by (explicit or transparent) huge pages. Such stacks are never
+// released to the operating system and do not use guard pages, they are
+// used only if guard pages are disabled (see use_guard_pages).
+namespace hpx::threads::coroutines::detail::posix {
+
+    struct stack_pool_parameters
+    {
+        // enable pooling of stacks
+        bool enabled_ = false;
+
+        // back small and medium sized stacks with huge pages
+        bool use_huge_pages_ = false;
+
+        // maximal number of stacks (per stack size) kept by each thread
+        std::size_t thread_cache_size_ = 16;
+
+        // maximal number of stacks (per stack size) kept in the global pool
+        std::size_t global_pool_size_ = 256;
+
+        // stacks up to this size are allocated from huge pages (if enabled)
+        std::size_t huge_page_max_stack_size_ = HPX_MEDIUM_STACK_SIZE;
+    };
+
+    // Set the parameters of the stack pool. This has to be called before the
+    // first stack is allocated and after use_guard_pages has been set.
+    HPX_CORE_EXPORT void configure_stack_pool(
+        stack_pool_parameters const& params) noexcept;
+
+    HPX_CORE_EXPORT bool stack_pool_enabled() noexcept;
+
+    // Allocate a stack of the given size, reuse a pooled stack if possible.
+    HPX_CORE_EXPORT void* allocate_pooled_stack(std::size_t size);
+
+    // Return a stack to the pool (or the operating system if the pools are
+    // full).
+    HPX_CORE_EXPORT void deallocate_pooled_stack(
+        void* stack, std::size_t size) noexcept;
+
+    // Release all stacks held by the free list of the calling thread to the
+    // global pool.
+    HPX_CORE_EXPORT void flush_thread_stack_pool() noexcept;
+
+    // statistics
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_hits(bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_misses(bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_resident_bytes(
+        bool reset) noexcept;
+}    // namespace hpx::threads::coroutines::detail::posix
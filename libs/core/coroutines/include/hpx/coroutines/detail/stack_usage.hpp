@@ -0,0 +1,53 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
+
+#include <cstddef>
+
+// Stack usage tracking: if a handler is registered, the stack of a coroutine
+// is filled with a known pattern whenever a thread starts running on it. Once
+// the thread function has returned, the stack is scanned for the deepest
+// location that was overwritten and the resulting high-water mark is reported
+// to the handler. Filling the stack touches all of its pages, this is meant
+// for diagnostic purposes only. Alternatively, only the lower end of the
+// stacks is filled, in which case only threads coming close to exhausting
+// their stack are reported.
+namespace hpx::threads::coroutines::detail {
+
+    using stack_usage_handler_type = void (*)(
+        hpx::threads::thread_id const& id, std::size_t used,
+        std::size_t stacksize) noexcept;
+
+    // Register a handler receiving the stack usage of terminated threads,
+    // passing nullptr disables stack usage tracking.
+    HPX_CORE_EXPORT void set_stack_usage_handler(
+        stack_usage_handler_type handler) noexcept;
+    HPX_CORE_EXPORT stack_usage_handler_type get_stack_usage_handler() noexcept;
+
+    // Restrict filling the stacks to the given percentage of their size at
+    // their lower end, only threads using more than the remaining part of
+    // their stack are reported then. The default of 100 fills all of the
+    // stack.
+    HPX_CORE_EXPORT void set_stack_fill_percentage(
+        std::size_t percentage) noexcept;
+
+    // Return the number of bytes at the lower end of a stack of the given
+    // size to fill.
+    HPX_CORE_EXPORT std::size_t get_stack_fill_size(std::size_t size) noexcept;
+
+    // Fill the given stack memory with the watermark pattern.
+    HPX_CORE_EXPORT void fill_stack(void* stack, std::size_t size) noexcept;
+
+    // Return the number of bytes at the upper end of the given stack memory
+    // that were overwritten since its lowest 'filled' bytes were filled, zero
+    // if none of those were overwritten.
+    HPX_CORE_EXPORT std::size_t measure_stack_usage(
+        void const* stack, std::size_t filled, std::size_t size) noexcept;
+}    // namespace hpx::threads::coroutines::detail
@@ -41,6 +41,13 @@ namespace hpx::threads::coroutines::detail {
     {
     };
 
+    // Used for the final switch of a terminated coroutine back to its caller.
+    // A context may skip saving the state of the terminated coroutine, as
+    // its stack is re-initialized before it is invoked again.
+    class exit_hint : public yield_hint
+    {
+    };
+
     /////////////////////////////////////////////////////////////////////////////
     // This is the base class of all context implementations
     struct context_impl_base
@@ -215,7 +215,8 @@ namespace hpx::threads {
         /// zero. It is up to the scheduler to decide how to interpret NUMA
         /// domain indices that are larger than the number of available NUMA
         /// domains to the scheduler. Typically indices will wrap around when
-        /// too large.
+        /// too large. Use \a hpx::threads::get_numa_domain_hint to create a
+        /// hint referring to the NUMA domain holding a given piece of memory.
         numa = 2,
     };
 
@@ -0,0 +1,476 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+
+#include <hpx/allocator_support/memory_statistics.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::coroutines::detail::posix {
+
+    namespace {
+
+        stack_pool_parameters pool_params;
+
+        std::atomic<std::uint64_t> pool_hits(0);
+        std::atomic<std::uint64_t> pool_misses(0);
+        std::atomic<std::uint64_t> pool_resident_bytes(0);
+
+        // the number of distinct stack sizes handled by the pools
+        constexpr std::size_t max_size_classes = 8;
+
+        constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+        bool is_huge_page_stack(std::size_t size) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+            return pool_params.use_huge_pages_ &&
+                size <= pool_params.huge_page_max_stack_size_;
+#else
+            (void) size;
+            return false;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct free_list
+        {
+            void* pop() noexcept
+            {
+                if (stacks_.empty())
+                    return nullptr;
+
+                void* stack = stacks_.back();
+                stacks_.pop_back();
+                return stack;
+            }
+
+            std::size_t size_ = 0;
+            std::vector<void*> stacks_;
+        };
+
+        // find the free list for the given stack size, claim an unused one if
+        // needed
+        free_list* find_free_list(free_list* lists, std::size_t size) noexcept
+        {
+            for (std::size_t i = 0; i != max_size_classes; ++i)
+            {
+                if (lists[i].size_ == size)
+                    return &lists[i];
+
+                if (lists[i].size_ == 0)
+                {
+                    lists[i].size_ = size;
+                    return &lists[i];
+                }
+            }
+            return nullptr;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct global_stack_pool
+        {
+            global_stack_pool() = default;
+
+            global_stack_pool(global_stack_pool const&) = delete;
+            global_stack_pool(global_stack_pool&&) = delete;
+            global_stack_pool& operator=(global_stack_pool const&) = delete;
+            global_stack_pool& operator=(global_stack_pool&&) = delete;
+
+            ~global_stack_pool()
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                destroyed_ = true;
+
+                for (free_list& fl : lists_)
+                {
+                    if (!is_huge_page_stack(fl.size_))
+                    {
+                        for (void* stack : fl.stacks_)
+                        {
+                            free_stack(stack, fl.size_);
+                        }
+                    }
+                    fl.stacks_.clear();
+                }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+                for (auto const& slab : slabs_)
+                {
+                    ::munmap(slab.first, slab.second);
+                    hpx::util::record_deallocation(
+                        hpx::util::memory_category::stacks, slab.second);
+                }
+#endif
+                slabs_.clear();
+            }
+
+            hpx::util::detail::spinlock mtx_;
+            free_list lists_[max_size_classes];
+            std::vector<std::pair<void*, std::size_t>> slabs_;
+            bool destroyed_ = false;
+        };
+
+        global_stack_pool& get_global_stack_pool()
+        {
+            static global_stack_pool pool;
+            return pool;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the thread local cache is guarded by a flag as stacks might be
+        // released after the cache itself was destroyed
+        thread_local bool thread_cache_destroyed = false;
+
+        struct thread_stack_cache
+        {
+            thread_stack_cache() = default;
+
+            thread_stack_cache(thread_stack_cache const&) = delete;
+            thread_stack_cache(thread_stack_cache&&) = delete;
+            thread_stack_cache& operator=(thread_stack_cache const&) = delete;
+            thread_stack_cache& operator=(thread_stack_cache&&) = delete;
+
+            ~thread_stack_cache()
+            {
+                flush();
+                thread_cache_destroyed = true;
+            }
+
+            void flush() noexcept;
+
+            free_list lists_[max_size_classes];
+        };
+
+        thread_local thread_stack_cache thread_cache;
+
+        // hand over a stack to the global pool, returns false if the stack
+        // was not accepted
+        bool push_global(void* stack, std::size_t size) noexcept
+        {
+            global_stack_pool& pool = get_global_stack_pool();
+
+            std::lock_guard<hpx::util::detail::spinlock> l(pool.mtx_);
+            if (pool.destroyed_)
+                return false;
+
+            free_list* fl = find_free_list(pool.lists_, size);
+            if (fl == nullptr)
+                return false;
+
+            // stacks carved out of huge pages are never released
+            if (!is_huge_page_stack(size) &&
+                fl->stacks_.size() >= pool_params.global_pool_size_)
+            {
+                return false;
+            }
+
+            try
+            {
+                fl->stacks_.push_back(stack);
+            }
+            catch (...)
+            {
+                return false;
+            }
+
+            pool_resident_bytes.fetch_add(size, std::memory_order_relaxed);
+            return true;
+        }
+
+        void* pop_global(std::size_t size) noexcept
+        {
+            global_stack_pool& pool = get_global_stack_pool();
+
+            std::lock_guard<hpx::util::detail::spinlock> l(pool.mtx_);
+            free_list* fl = find_free_list(pool.lists_, size);
+            if (fl == nullptr)
+                return nullptr;
+
+            void* stack = fl->pop();
+            if (stack != nullptr)
+            {
+                pool_resident_bytes.fetch_sub(size, std::memory_order_relaxed);
+            }
+            return stack;
+        }
+
+        void release_stack(void* stack, std::size_t size) noexcept
+        {
+            if (!push_global(stack, size) && !is_huge_page_stack(size))
+            {
+                free_stack(stack, size);
+            }
+        }
+
+        void thread_stack_cache::flush() noexcept
+        {
+            for (free_list& l : lists_)
+            {
+                for (void* stack : l.stacks_)
+                {
+                    pool_resident_bytes.fetch_sub(
+                        l.size_, std::memory_order_relaxed);
+                    release_stack(stack, l.size_);
+                }
+                l.stacks_.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        // Allocate a memory region backed by huge pages, carve it into stacks
+        // of the given size, return the first one and cache all others.
+        void* allocate_huge_page_stacks(std::size_t size, free_list* fl)
+        {
+            std::size_t const slab_size =
+                ((size + huge_page_size - 1) / huge_page_size) * huge_page_size;
+
+            void* mapped = MAP_FAILED;
+            std::size_t mapped_size = slab_size;
+            void* slab = nullptr;
+
+#if defined(MAP_HUGETLB)
+            // try explicit huge pages first
+            mapped = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            slab = mapped;
+#endif
+            if (mapped == MAP_FAILED)
+            {
+                // fall back to transparent huge pages, over-allocate to be
+                // able to align the region to the huge page size
+                mapped_size = slab_size + huge_page_size;
+                mapped = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS,
+#endif
+                    -1, 0);
+
+                if (mapped == MAP_FAILED)
+                {
+                    throw std::runtime_error(
+                        "mmap() failed to allocate huge page backed thread "
+                        "stacks");
+                }
+
+                auto const addr = reinterpret_cast<std::uintptr_t>(mapped);
+                slab = reinterpret_cast<void*>(
+                    (addr + huge_page_size - 1) & ~(huge_page_size - 1));
+
+#if defined(MADV_HUGEPAGE)
+                ::madvise(slab, slab_size, MADV_HUGEPAGE);
+#endif
+            }
+
+            hpx::util::record_allocation(
+                hpx::util::memory_category::stacks, mapped_size);
+
+            {
+                global_stack_pool& pool = get_global_stack_pool();
+                std::lock_guard<hpx::util::detail::spinlock> l(pool.mtx_);
+                pool.slabs_.emplace_back(mapped, mapped_size);
+            }
+
+            std::size_t const num_stacks = slab_size / size;
+            HPX_ASSERT(num_stacks != 0);
+
+            for (std::size_t i = 1; i != num_stacks; ++i)
+            {
+                void* stack = static_cast<char*>(slab) + i * size;
+                if (fl != nullptr &&
+                    fl->stacks_.size() < pool_params.thread_cache_size_)
+                {
+                    fl->stacks_.push_back(stack);
+                    pool_resident_bytes.fetch_add(
+                        size, std::memory_order_relaxed);
+                }
+                else
+                {
+                    release_stack(stack, size);
+                }
+            }
+            return slab;
+        }
+#endif
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void configure_stack_pool(stack_pool_parameters const& params) noexcept
+    {
+        pool_params = params;
+
+        // Stacks carved out of huge pages can't be separated by guard
+        // pages: explicit huge pages can't be protected at the granularity
+        // of a (small) page, and protecting parts of a transparent huge page
+        // splits it into small pages, which defeats its purpose. Huge page
+        // backed stacks are therefore used only if guard pages are disabled.
+        if (use_guard_pages)
+        {
+            pool_params.use_huge_pages_ = false;
+        }
+    }
+
+    bool stack_pool_enabled() noexcept
+    {
+        return pool_params.enabled_;
+    }
+
+    void* allocate_pooled_stack(std::size_t size)
+    {
+        if (!pool_params.enabled_)
+        {
+            return alloc_stack(size);
+        }
+
+        free_list* fl = nullptr;
+        if (!thread_cache_destroyed)
+        {
+            fl = find_free_list(thread_cache.lists_, size);
+            if (fl != nullptr)
+            {
+                if (void* stack = fl->pop(); stack != nullptr)
+                {
+                    pool_resident_bytes.fetch_sub(
+                        size, std::memory_order_relaxed);
+                    pool_hits.fetch_add(1, std::memory_order_relaxed);
+                    return stack;
+                }
+            }
+        }
+
+        if (void* stack = pop_global(size); stack != nullptr)
+        {
+            pool_hits.fetch_add(1, std::memory_order_relaxed);
+            return stack;
+        }
+
+        pool_misses.fetch_add(1, std::memory_order_relaxed);
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        if (is_huge_page_stack(size))
+        {
+            return allocate_huge_page_stacks(size, fl);
+        }
+#endif
+        return alloc_stack(size);
+    }
+
+    void deallocate_pooled_stack(void* stack, std::size_t size) noexcept
+    {
+        if (!pool_params.enabled_)
+        {
+            free_stack(stack, size);
+            return;
+        }
+
+        if (!thread_cache_destroyed)
+        {
+            free_list* fl = find_free_list(thread_cache.lists_, size);
+            if (fl != nullptr &&
+                fl->stacks_.size() < pool_params.thread_cache_size_)
+            {
+                try
+                {
+                    fl->stacks_.push_back(stack);
+                    pool_resident_bytes.fetch_add(
+                        size, std::memory_order_relaxed);
+                    return;
+                }
+                catch (...)
+                {
+                    // fall back to the global pool
+                }
+            }
+        }
+
+        release_stack(stack, size);
+    }
+
+    void flush_thread_stack_pool() noexcept
+    {
+        if (!thread_cache_destroyed)
+        {
+            thread_cache.flush();
+        }
+    }
+
+    std::uint64_t get_stack_pool_hits(bool reset) noexcept
+    {
+        return util::get_and_reset_value(pool_hits, reset);
+    }
+
+    std::uint64_t get_stack_pool_misses(bool reset) noexcept
+    {
+        return util::get_and_reset_value(pool_misses, reset);
+    }
+
+    std::uint64_t get_stack_pool_resident_bytes(bool) noexcept
+    {
+        return pool_resident_bytes.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#else
+
+namespace hpx::threads::coroutines::detail::posix {
+
+    // stack pooling is supported for POSIX systems only
+    void configure_stack_pool(stack_pool_parameters const&) noexcept {}
+
+    bool stack_pool_enabled() noexcept
+    {
+        return false;
+    }
+
+    void* allocate_pooled_stack(std::size_t)
+    {
+        return nullptr;
+    }
+
+    void deallocate_pooled_stack(void*, std::size_t) noexcept {}
+
+    void flush_thread_stack_pool() noexcept {}
+
+    std::uint64_t get_stack_pool_hits(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_misses(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_resident_bytes(bool) noexcept
+    {
+        return 0;
+    }
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
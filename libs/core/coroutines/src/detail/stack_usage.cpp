@@ -0,0 +1,81 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_usage.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::coroutines::detail {
+
+    namespace {
+
+        // this is the same pattern as the one used by posix::watermark_stack
+        constexpr std::uintptr_t stack_fill_pattern =
+            static_cast<std::uintptr_t>(0xDEADBEEFDEADBEEFull);
+
+        std::atomic<stack_usage_handler_type> stack_usage_handler(nullptr);
+        std::atomic<std::size_t> stack_fill_percentage(100);
+    }    // namespace
+
+    void set_stack_usage_handler(stack_usage_handler_type handler) noexcept
+    {
+        stack_usage_handler.store(handler, std::memory_order_release);
+    }
+
+    stack_usage_handler_type get_stack_usage_handler() noexcept
+    {
+        return stack_usage_handler.load(std::memory_order_acquire);
+    }
+
+    void set_stack_fill_percentage(std::size_t percentage) noexcept
+    {
+        stack_fill_percentage.store(
+            (std::min)(percentage, static_cast<std::size_t>(100)),
+            std::memory_order_relaxed);
+    }
+
+    std::size_t get_stack_fill_size(std::size_t size) noexcept
+    {
+        std::size_t const percentage =
+            stack_fill_percentage.load(std::memory_order_relaxed);
+        if (percentage == 100)
+        {
+            return size;
+        }
+
+        // keep the filled part aligned to the pattern size
+        return size / 100 * percentage / sizeof(std::uintptr_t) *
+            sizeof(std::uintptr_t);
+    }
+
+    void fill_stack(void* stack, std::size_t size) noexcept
+    {
+        auto* begin = static_cast<std::uintptr_t*>(stack);
+        std::fill(begin, begin + size / sizeof(std::uintptr_t),
+            stack_fill_pattern);
+    }
+
+    std::size_t measure_stack_usage(
+        void const* stack, std::size_t filled, std::size_t size) noexcept
+    {
+        // stacks grow downwards, find the lowest location that was modified
+        auto const* begin = static_cast<std::uintptr_t const*>(stack);
+        auto const* last = begin + filled / sizeof(std::uintptr_t);
+        auto const* it = std::find_if(begin, last,
+            [](std::uintptr_t value) { return value != stack_fill_pattern; });
+        if (it == last)
+        {
+            return 0;
+        }
+
+        auto const* end = begin + size / sizeof(std::uintptr_t);
+        return static_cast<std::size_t>(end - it) * sizeof(std::uintptr_t);
+    }
+}    // namespace hpx::threads::coroutines::detail
@@ -24,6 +24,10 @@
 //     load the new stack pointer, pop registers from the new stack
 //     and returns to new caller.
 //
+//     Only the callee-saved registers (RBP, RBX, R12-R15) are saved. The
+//     floating point control state (MXCSR and the x87 control word) is saved
+//     as well unless HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH is defined.
+//
 //     RDI is set to be the parameter for the function to be called.
 //     The first time RDI is the first parameter of the trampoline.
 //     Otherwise it is simply discarded.
@@ -51,6 +55,8 @@
 
 // Note: .align 4 below means alignment at 2^4 boundary (16 bytes
 
+#if defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
+
 #define HPX_COROUTINE_SWAPCONTEXT(name)                                       \
     asm (                                                                     \
         ".text \n\t"                                                          \
@@ -58,11 +64,9 @@
         ".globl " #name "\n\t"                                                \
         HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
     #name ":\n\t"                                                             \
-        "movq  64(%rsi), %rcx\n\t"                                            \
+        "movq  48(%rsi), %rcx\n\t"                                            \
         "pushq %rbp\n\t"                                                      \
         "pushq %rbx\n\t"                                                      \
-        "pushq %rax\n\t"                                                      \
-        "pushq %rdx\n\t"                                                      \
         "pushq %r12\n\t"                                                      \
         "pushq %r13\n\t"                                                      \
         "pushq %r14\n\t"                                                      \
@@ -73,20 +77,108 @@
         "popq  %r14\n\t"                                                      \
         "popq  %r13\n\t"                                                      \
         "popq  %r12\n\t"                                                      \
-        "popq  %rdx\n\t"                                                      \
-        "popq  %rax\n\t"                                                      \
         "popq  %rbx\n\t"                                                      \
         "popq  %rbp\n\t"                                                      \
-        "movq 80(%rsi), %rdi\n\t"                                             \
+        "movq 64(%rsi), %rdi\n\t"                                             \
         "add   $8, %rsp\n\t"                                                  \
         "jmp   *%rcx\n\t"                                                     \
         "ud2\n\t"                                                             \
     )                                                                         \
 /**/
 
+// RDI is to.sp, the current context is not saved
+#define HPX_COROUTINE_JUMPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text \n\t"                                                          \
+        ".align 4\n"                                                          \
+        ".globl " #name "\n\t"                                                \
+        HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
+    #name ":\n\t"                                                             \
+        "movq  48(%rdi), %rcx\n\t"                                            \
+        "movq  %rdi, %rsp\n\t"                                                \
+        "popq  %r15\n\t"                                                      \
+        "popq  %r14\n\t"                                                      \
+        "popq  %r13\n\t"                                                      \
+        "popq  %r12\n\t"                                                      \
+        "popq  %rbx\n\t"                                                      \
+        "popq  %rbp\n\t"                                                      \
+        "movq 16(%rsp), %rdi\n\t"                                             \
+        "add   $8, %rsp\n\t"                                                  \
+        "jmp   *%rcx\n\t"                                                     \
+        "ud2\n\t"                                                             \
+    )                                                                         \
+/**/
+
+#else
+
+#define HPX_COROUTINE_SWAPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text \n\t"                                                          \
+        ".align 4\n"                                                          \
+        ".globl " #name "\n\t"                                                \
+        HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
+    #name ":\n\t"                                                             \
+        "movq  56(%rsi), %rcx\n\t"                                            \
+        "pushq %rbp\n\t"                                                      \
+        "pushq %rbx\n\t"                                                      \
+        "pushq %r12\n\t"                                                      \
+        "pushq %r13\n\t"                                                      \
+        "pushq %r14\n\t"                                                      \
+        "pushq %r15\n\t"                                                      \
+        "leaq  -8(%rsp), %rsp\n\t"                                            \
+        "stmxcsr (%rsp)\n\t"                                                  \
+        "fnstcw 4(%rsp)\n\t"                                                  \
+        "movq  %rsp, (%rdi)\n\t"                                              \
+        "movq  %rsi, %rsp\n\t"                                                \
+        "ldmxcsr (%rsp)\n\t"                                                  \
+        "fldcw 4(%rsp)\n\t"                                                   \
+        "leaq  8(%rsp), %rsp\n\t"                                             \
+        "popq  %r15\n\t"                                                      \
+        "popq  %r14\n\t"                                                      \
+        "popq  %r13\n\t"                                                      \
+        "popq  %r12\n\t"                                                      \
+        "popq  %rbx\n\t"                                                      \
+        "popq  %rbp\n\t"                                                      \
+        "movq 72(%rsi), %rdi\n\t"                                             \
+        "add   $8, %rsp\n\t"                                                  \
+        "jmp   *%rcx\n\t"                                                     \
+        "ud2\n\t"                                                             \
+    )                                                                         \
+/**/
+
+// RDI is to.sp, the current context is not saved
+#define HPX_COROUTINE_JUMPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text \n\t"                                                          \
+        ".align 4\n"                                                          \
+        ".globl " #name "\n\t"                                                \
+        HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
+    #name ":\n\t"                                                             \
+        "movq  56(%rdi), %rcx\n\t"                                            \
+        "movq  %rdi, %rsp\n\t"                                                \
+        "ldmxcsr (%rsp)\n\t"                                                  \
+        "fldcw 4(%rsp)\n\t"                                                   \
+        "leaq  8(%rsp), %rsp\n\t"                                             \
+        "popq  %r15\n\t"                                                      \
+        "popq  %r14\n\t"                                                      \
+        "popq  %r13\n\t"                                                      \
+        "popq  %r12\n\t"                                                      \
+        "popq  %rbx\n\t"                                                      \
+        "popq  %rbp\n\t"                                                      \
+        "movq 16(%rsp), %rdi\n\t"                                             \
+        "add   $8, %rsp\n\t"                                                  \
+        "jmp   *%rcx\n\t"                                                     \
+        "ud2\n\t"                                                             \
+    )                                                                         \
+/**/
+
+#endif
+
 HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack);
 HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack2);
+HPX_COROUTINE_JUMPCONTEXT(jumpcontext_stack);
 
+#undef HPX_COROUTINE_JUMPCONTEXT
 #undef HPX_COROUTINE_SWAPCONTEXT
 #undef HPX_COROUTINE_TYPE_DIRECTIVE
 
@@ -0,0 +1,141 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#if !defined(__aarch64__)
+#error This file is for AArch64 CPUs only.
+#endif
+
+#if !defined(__GNUC__)
+#error This file requires compilation with gcc.
+#endif
+
+//     X0 is &from.sp
+//     X1 is to.sp
+//
+//     The callee-saved registers (X19-X28, the frame pointer X29, the link
+//     register X30 and the low halves of V8-V15) are stored below the
+//     current stack pointer, the stack pointer is saved in from.sp, and the
+//     registers are restored from the new stack. The floating point control
+//     register (FPCR) is saved as well unless
+//     HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH is defined.
+//
+//     X0 is set to be the parameter for the function to be called. The
+//     first time X30 holds the address of the trampoline and X0 is its first
+//     parameter. Otherwise X0 is simply discarded.
+//
+//     NOTE: The stores and loads are done pairwise, writing FPCR is skipped
+//           if the value does not change, as it may be serializing.
+
+#define HPX_COROUTINE_TYPE_DIRECTIVE(name) ".type " #name ", %function\n\t"
+
+#define HPX_COROUTINE_SAVE_REGISTERS                                          \
+        "stp   d8,  d9,  [sp, #0]\n\t"                                        \
+        "stp   d10, d11, [sp, #16]\n\t"                                       \
+        "stp   d12, d13, [sp, #32]\n\t"                                       \
+        "stp   d14, d15, [sp, #48]\n\t"                                       \
+        "stp   x19, x20, [sp, #64]\n\t"                                       \
+        "stp   x21, x22, [sp, #80]\n\t"                                       \
+        "stp   x23, x24, [sp, #96]\n\t"                                       \
+        "stp   x25, x26, [sp, #112]\n\t"                                      \
+        "stp   x27, x28, [sp, #128]\n\t"                                      \
+        "stp   x29, x30, [sp, #144]\n\t"                                      \
+/**/
+
+#define HPX_COROUTINE_RESTORE_REGISTERS                                       \
+        "ldp   d8,  d9,  [sp, #0]\n\t"                                        \
+        "ldp   d10, d11, [sp, #16]\n\t"                                       \
+        "ldp   d12, d13, [sp, #32]\n\t"                                       \
+        "ldp   d14, d15, [sp, #48]\n\t"                                       \
+        "ldp   x19, x20, [sp, #64]\n\t"                                       \
+        "ldp   x21, x22, [sp, #80]\n\t"                                       \
+        "ldp   x23, x24, [sp, #96]\n\t"                                       \
+        "ldp   x25, x26, [sp, #112]\n\t"                                      \
+        "ldp   x27, x28, [sp, #128]\n\t"                                      \
+        "ldp   x29, x30, [sp, #144]\n\t"                                      \
+/**/
+
+#if defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
+
+// frame: 160 bytes of registers, followed by the parameter
+#define HPX_COROUTINE_SAVE_FP_STATE
+#define HPX_COROUTINE_RESTORE_FP_STATE
+#define HPX_COROUTINE_FRAME_SIZE "160"
+#define HPX_COROUTINE_PARM_OFFSET "160"
+
+#else
+
+// frame: 160 bytes of registers, FPCR and padding, followed by the parameter
+#define HPX_COROUTINE_SAVE_FP_STATE                                           \
+        "mrs   x9, fpcr\n\t"                                                  \
+        "str   x9, [sp, #160]\n\t"                                            \
+/**/
+#define HPX_COROUTINE_RESTORE_FP_STATE                                        \
+        "ldr   x9, [sp, #160]\n\t"                                            \
+        "mrs   x10, fpcr\n\t"                                                 \
+        "cmp   x9, x10\n\t"                                                   \
+        "b.eq  1f\n\t"                                                        \
+        "msr   fpcr, x9\n"                                                    \
+    "1:\n\t"                                                                  \
+/**/
+#define HPX_COROUTINE_FRAME_SIZE "176"
+#define HPX_COROUTINE_PARM_OFFSET "176"
+
+#endif
+
+#define HPX_COROUTINE_SWAPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text \n\t"                                                          \
+        ".p2align 4\n"                                                        \
+        ".globl " #name "\n\t"                                                \
+        HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
+    #name ":\n\t"                                                             \
+        "sub   sp, sp, #" HPX_COROUTINE_FRAME_SIZE "\n\t"                     \
+        HPX_COROUTINE_SAVE_REGISTERS                                          \
+        HPX_COROUTINE_SAVE_FP_STATE                                           \
+        "mov   x9, sp\n\t"                                                    \
+        "str   x9, [x0]\n\t"                                                  \
+        "mov   sp, x1\n\t"                                                    \
+        HPX_COROUTINE_RESTORE_FP_STATE                                        \
+        HPX_COROUTINE_RESTORE_REGISTERS                                       \
+        "ldr   x0, [sp, #" HPX_COROUTINE_PARM_OFFSET "]\n\t"                  \
+        "add   sp, sp, #" HPX_COROUTINE_FRAME_SIZE "\n\t"                     \
+        "ret\n\t"                                                             \
+    )                                                                         \
+/**/
+
+// X0 is to.sp, the current context is not saved
+#define HPX_COROUTINE_JUMPCONTEXT(name)                                       \
+    asm (                                                                     \
+        ".text \n\t"                                                          \
+        ".p2align 4\n"                                                        \
+        ".globl " #name "\n\t"                                                \
+        HPX_COROUTINE_TYPE_DIRECTIVE(name)                                    \
+    #name ":\n\t"                                                             \
+        "mov   sp, x0\n\t"                                                    \
+        HPX_COROUTINE_RESTORE_FP_STATE                                        \
+        HPX_COROUTINE_RESTORE_REGISTERS                                       \
+        "ldr   x0, [sp, #" HPX_COROUTINE_PARM_OFFSET "]\n\t"                  \
+        "add   sp, sp, #" HPX_COROUTINE_FRAME_SIZE "\n\t"                     \
+        "ret\n\t"                                                             \
+    )                                                                         \
+/**/
+
+HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack);
+HPX_COROUTINE_SWAPCONTEXT(swapcontext_stack2);
+HPX_COROUTINE_JUMPCONTEXT(jumpcontext_stack);
+
+#undef HPX_COROUTINE_JUMPCONTEXT
+#undef HPX_COROUTINE_SWAPCONTEXT
+#undef HPX_COROUTINE_PARM_OFFSET
+#undef HPX_COROUTINE_FRAME_SIZE
+#undef HPX_COROUTINE_RESTORE_FP_STATE
+#undef HPX_COROUTINE_SAVE_FP_STATE
+#undef HPX_COROUTINE_RESTORE_REGISTERS
+#undef HPX_COROUTINE_SAVE_REGISTERS
+#undef HPX_COROUTINE_TYPE_DIRECTIVE
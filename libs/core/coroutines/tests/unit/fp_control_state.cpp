@@ -0,0 +1,109 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that a change of the floating point control state (here the rounding
+// mode) does not leak between coroutines and the thread running them if the
+// native context switch saves it (HPX_COROUTINES_WITH_MINIMAL_CONTEXT_SWITCH
+// is OFF). This covers both, the regular context switch and the switch back
+// from a terminated coroutine.
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/config/defines.hpp>
+#include <hpx/coroutines/coroutine.hpp>
+#include <hpx/coroutines/detail/coroutine_self.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cfenv>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    (defined(__x86_64__) || defined(__aarch64__)) &&                           \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&                           \
+    !defined(HPX_COROUTINES_HAVE_MINIMAL_CONTEXT_SWITCH)
+
+using hpx::threads::coroutines::coroutine;
+using hpx::threads::coroutines::detail::coroutine_self;
+
+///////////////////////////////////////////////////////////////////////////////
+coroutine::result_type suspended()
+{
+    return {hpx::threads::thread_schedule_state::suspended,
+        hpx::threads::invalid_thread_id};
+}
+
+coroutine::result_type terminated()
+{
+    return {hpx::threads::thread_schedule_state::terminated,
+        hpx::threads::invalid_thread_id};
+}
+
+// changes the rounding mode and terminates without restoring it
+coroutine::result_type change_rounding(coroutine::arg_type)
+{
+    // a new coroutine starts with the default state
+    HPX_TEST_EQ(std::fegetround(), FE_TONEAREST);
+
+    std::fesetround(FE_UPWARD);
+    coroutine_self::get_self()->yield(suspended());
+
+    // the rounding mode of the coroutine is restored when it is resumed
+    HPX_TEST_EQ(std::fegetround(), FE_UPWARD);
+
+    std::fesetround(FE_TOWARDZERO);
+    coroutine_self::get_self()->yield(suspended());
+    HPX_TEST_EQ(std::fegetround(), FE_TOWARDZERO);
+
+    return terminated();
+}
+
+void test_rounding_mode()
+{
+    HPX_TEST_EQ(std::fegetround(), FE_TONEAREST);
+
+    coroutine c1(&change_rounding, hpx::threads::invalid_thread_id);
+    coroutine c2(&change_rounding, hpx::threads::invalid_thread_id);
+
+    // the thread does not see the change made by the coroutine
+    c1();
+    HPX_TEST_EQ(std::fegetround(), FE_TONEAREST);
+
+    // nor does the coroutine see the state of the thread, or of other
+    // coroutines
+    std::fesetround(FE_DOWNWARD);
+    c2();
+    HPX_TEST_EQ(std::fegetround(), FE_DOWNWARD);
+
+    c1();
+    HPX_TEST_EQ(std::fegetround(), FE_DOWNWARD);
+    c2();
+    HPX_TEST_EQ(std::fegetround(), FE_DOWNWARD);
+
+    // terminating the coroutines switches back without saving their state
+    c1();
+    HPX_TEST(c1.impl()->exited());
+    HPX_TEST_EQ(std::fegetround(), FE_DOWNWARD);
+
+    std::fesetround(FE_TONEAREST);
+    c2();
+    HPX_TEST(c2.impl()->exited());
+    HPX_TEST_EQ(std::fegetround(), FE_TONEAREST);
+}
+
+int main()
+{
+    test_rounding_mode();
+
+    return hpx::util::report_errors();
+}
+
+#else
+
+int main()
+{
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,155 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the statistics collected by the stack pool and that pooled stacks
+// keep their guard pages.
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+constexpr std::size_t stack_size = HPX_SMALL_STACK_SIZE;
+
+void reset_statistics()
+{
+    posix::get_stack_pool_hits(true);
+    posix::get_stack_pool_misses(true);
+}
+
+std::uint64_t resident_stacks()
+{
+    return posix::get_stack_pool_resident_bytes(false) / stack_size;
+}
+
+std::vector<void*> allocate(std::size_t count)
+{
+    std::vector<void*> stacks;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        stacks.push_back(posix::allocate_pooled_stack(stack_size));
+    }
+    return stacks;
+}
+
+void deallocate(std::vector<void*> const& stacks)
+{
+    for (void* stack : stacks)
+    {
+        posix::deallocate_pooled_stack(stack, stack_size);
+    }
+}
+
+void test_statistics()
+{
+    reset_statistics();
+
+    // the first stack is a miss, returning it makes it resident
+    void* stack = posix::allocate_pooled_stack(stack_size);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), std::uint64_t(0));
+    HPX_TEST_EQ(posix::get_stack_pool_misses(false), std::uint64_t(1));
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(0));
+
+    posix::deallocate_pooled_stack(stack, stack_size);
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(1));
+
+    // the same stack is handed out again
+    HPX_TEST_EQ(posix::allocate_pooled_stack(stack_size), stack);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), std::uint64_t(1));
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(0));
+    posix::deallocate_pooled_stack(stack, stack_size);
+
+    // two stacks are kept by this thread, four by the global pool, all
+    // others are released
+    std::vector<void*> stacks = allocate(8);
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), std::uint64_t(2));
+    HPX_TEST_EQ(posix::get_stack_pool_misses(false), std::uint64_t(8));
+    deallocate(stacks);
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(6));
+
+    // flushing the free list of this thread releases the stacks not fitting
+    // into the global pool
+    posix::flush_thread_stack_pool();
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(4));
+
+    // other threads pick up the stacks from the global pool
+    reset_statistics();
+    std::thread([] {
+        deallocate(allocate(4));
+        posix::flush_thread_stack_pool();
+    }).join();
+    HPX_TEST_EQ(posix::get_stack_pool_hits(false), std::uint64_t(4));
+    HPX_TEST_EQ(posix::get_stack_pool_misses(false), std::uint64_t(0));
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(4));
+
+    // resetting does not change the number of resident bytes
+    posix::get_stack_pool_resident_bytes(true);
+    HPX_TEST_EQ(resident_stacks(), std::uint64_t(4));
+}
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+void test_guard_page()
+{
+    // huge page backed stacks were requested, but guard pages take priority
+    char* stack = static_cast<char*>(posix::allocate_pooled_stack(stack_size));
+
+    pid_t const pid = ::fork();
+    if (pid == 0)
+    {
+        // writing below the stack has to hit the guard page
+        *(static_cast<char volatile*>(stack) - 1) = 0;
+        ::_exit(0);
+    }
+
+    int status = 0;
+    HPX_TEST_EQ(::waitpid(pid, &status, 0), pid);
+    HPX_TEST(WIFSIGNALED(status));
+    if (WIFSIGNALED(status))
+    {
+        HPX_TEST(WTERMSIG(status) == SIGSEGV || WTERMSIG(status) == SIGBUS);
+    }
+
+    posix::deallocate_pooled_stack(stack, stack_size);
+}
+#endif
+
+int main()
+{
+    posix::use_guard_pages = true;
+
+    posix::stack_pool_parameters params;
+    params.enabled_ = true;
+    params.use_huge_pages_ = true;
+    params.thread_cache_size_ = 2;
+    params.global_pool_size_ = 4;
+    posix::configure_stack_pool(params);
+
+    if (posix::stack_pool_enabled())
+    {
+        test_statistics();
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+        test_guard_page();
+#endif
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,388 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file async_scope.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/allocator_deleter.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/traits/is_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/queries/get_stop_token.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/get_env.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/stop_token.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    class async_scope;
+
+    namespace detail {
+
+        // The operation states waiting for an async_scope to become empty
+        // are linked into an intrusive list held by the scope.
+        struct async_scope_waiter_base
+        {
+            explicit async_scope_waiter_base(
+                void (*complete)(async_scope_waiter_base*) noexcept) noexcept
+              : complete_(complete)
+            {
+            }
+
+            async_scope_waiter_base* next = nullptr;
+            void (*complete_)(async_scope_waiter_base*) noexcept;
+
+            void complete() noexcept
+            {
+                (*complete_)(this);
+            }
+        };
+
+        template <typename Receiver>
+        struct async_scope_on_empty_operation_state;
+
+        struct async_scope_on_empty_sender;
+
+        template <typename Sender, typename Allocator>
+        struct async_scope_spawned_operation_state;
+    }    // namespace detail
+
+    /// An \c async_scope tracks senders that were started eagerly without the
+    /// caller needing to manage the lifetimes of any objects (like
+    /// \a start_detached), and allows to wait for all of them to complete.
+    /// The work in flight is tracked by a single atomic counter; joining it
+    /// does not require a future or any other shared state per spawned
+    /// sender.
+    ///
+    /// The sender returned by \a on_empty completes once no spawned work is
+    /// in flight anymore. The spawned senders are connected to receivers
+    /// whose environment provides the stop token of the scope, which allows
+    /// to cancel all of them using \a request_stop.
+    ///
+    /// The destructor calls std::terminate if spawned work is still in
+    /// flight.
+    class async_scope
+    {
+    public:
+        async_scope() = default;
+
+        async_scope(async_scope const&) = delete;
+        async_scope(async_scope&&) = delete;
+        async_scope& operator=(async_scope const&) = delete;
+        async_scope& operator=(async_scope&&) = delete;
+
+        ~async_scope()
+        {
+            // spawned work must have completed, the last completed one
+            // might still be notifying the waiters
+            std::unique_lock l(mtx_);
+            if (count_.load(std::memory_order_acquire) != 0)
+            {
+                std::terminate();
+            }
+        }
+
+        /// \brief Eagerly starts the given sender, the scope keeps track of
+        ///        it until it completes.
+        ///
+        /// The sender must not complete with an error, std::terminate is
+        /// called otherwise (errors can be handled before, e.g. using
+        /// \a let_error).
+        ///
+        /// \param sender     The sender to start.
+        /// \param allocator  The allocator used to allocate the operation
+        ///                   state of the sender.
+        // clang-format off
+        template <typename Sender,
+            typename Allocator = hpx::util::internal_allocator<>,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender> &&
+                hpx::traits::is_allocator_v<Allocator>
+            )>
+        // clang-format on
+        void spawn(Sender&& sender, Allocator const& allocator = Allocator{})
+        {
+            using operation_state_type =
+                detail::async_scope_spawned_operation_state<Sender, Allocator>;
+            using other_allocator = typename std::allocator_traits<
+                Allocator>::template rebind_alloc<operation_state_type>;
+            using allocator_traits = std::allocator_traits<other_allocator>;
+            using unique_ptr = std::unique_ptr<operation_state_type,
+                util::allocator_deleter<other_allocator>>;
+
+            other_allocator alloc(allocator);
+            unique_ptr p(allocator_traits::allocate(alloc, 1),
+                hpx::util::allocator_deleter<other_allocator>{alloc});
+
+            allocator_traits::construct(
+                alloc, p.get(), HPX_FORWARD(Sender, sender), *this, alloc);
+
+            // the operation state may complete before start returns
+            count_.fetch_add(1, std::memory_order_relaxed);
+            p.release()->start();
+        }
+
+        /// \brief Returns a sender that completes once all of the work
+        ///        spawned on this scope has completed.
+        [[nodiscard]] detail::async_scope_on_empty_sender on_empty() noexcept;
+
+        /// \brief Requests all spawned work to stop, through the stop token
+        ///        of the environment of the receivers it is connected to.
+        bool request_stop() noexcept
+        {
+            return stop_source_.request_stop();
+        }
+
+        /// \brief Returns the stop token that is provided to the spawned
+        ///        senders.
+        [[nodiscard]] hpx::experimental::in_place_stop_token get_stop_token()
+            const noexcept
+        {
+            return stop_source_.get_token();
+        }
+
+    private:
+        template <typename Receiver>
+        friend struct detail::async_scope_on_empty_operation_state;
+
+        template <typename Sender, typename Allocator>
+        friend struct detail::async_scope_spawned_operation_state;
+
+        void add_waiter(detail::async_scope_waiter_base* waiter) noexcept
+        {
+            {
+                std::unique_lock l(mtx_);
+                if (count_.load(std::memory_order_acquire) != 0)
+                {
+                    waiter->next = waiters_;
+                    waiters_ = waiter;
+                    return;
+                }
+            }
+            waiter->complete();
+        }
+
+        void remove_work() noexcept
+        {
+            std::size_t count = count_.load(std::memory_order_relaxed);
+            while (count > 1)
+            {
+                if (count_.compare_exchange_weak(
+                        count, count - 1, std::memory_order_acq_rel))
+                {
+                    return;
+                }
+            }
+
+            // This may be the last work in flight, the scope may be
+            // destroyed as soon as the count (observed while holding the
+            // lock) has become zero.
+            detail::async_scope_waiter_base* waiters = nullptr;
+            {
+                std::unique_lock l(mtx_);
+                if (count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                {
+                    return;
+                }
+                waiters = std::exchange(waiters_, nullptr);
+            }
+
+            // complete the waiters in the order they were added
+            detail::async_scope_waiter_base* reversed = nullptr;
+            while (waiters != nullptr)
+            {
+                detail::async_scope_waiter_base* next = waiters->next;
+                waiters->next = reversed;
+                reversed = waiters;
+                waiters = next;
+            }
+
+            while (reversed != nullptr)
+            {
+                // completing a waiter may destroy it
+                detail::async_scope_waiter_base* next = reversed->next;
+                reversed->complete();
+                reversed = next;
+            }
+        }
+
+        std::atomic<std::size_t> count_{0};
+        hpx::spinlock mtx_;
+        detail::async_scope_waiter_base* waiters_ = nullptr;
+        hpx::experimental::in_place_stop_source stop_source_;
+    };
+
+    namespace detail {
+
+        template <typename Sender, typename Allocator>
+        struct async_scope_spawned_operation_state
+        {
+            struct async_scope_receiver
+            {
+                async_scope_spawned_operation_state* op_state;
+
+                template <typename Error>
+                [[noreturn]] friend void tag_invoke(
+                    set_error_t, async_scope_receiver&&, Error&&) noexcept
+                {
+                    HPX_ASSERT_MSG(false,
+                        "set_error was called on the receiver of "
+                        "async_scope::spawn, terminating. If you want to "
+                        "allow errors from the predecessor sender, handle "
+                        "them first with e.g. let_error.");
+                    std::terminate();
+                }
+
+                friend void tag_invoke(
+                    set_stopped_t, async_scope_receiver&& r) noexcept
+                {
+                    r.op_state->finish();
+                }
+
+                template <typename... Ts>
+                friend void tag_invoke(
+                    set_value_t, async_scope_receiver&& r, Ts&&...) noexcept
+                {
+                    r.op_state->finish();
+                }
+
+                friend auto tag_invoke(
+                    get_env_t, async_scope_receiver const& r) noexcept
+                {
+                    return make_env<get_stop_token_t>(
+                        r.op_state->scope.get_stop_token());
+                }
+            };
+
+            using allocator_type = typename std::allocator_traits<Allocator>::
+                template rebind_alloc<async_scope_spawned_operation_state>;
+
+            HPX_NO_UNIQUE_ADDRESS allocator_type alloc;
+            async_scope& scope;
+
+            using operation_state_type =
+                connect_result_t<Sender, async_scope_receiver>;
+            std::decay_t<operation_state_type> op_state;
+
+            template <typename Sender_>
+            async_scope_spawned_operation_state(Sender_&& sender,
+                async_scope& scope, allocator_type const& alloc)
+              : alloc(alloc)
+              , scope(scope)
+              , op_state(connect(HPX_FORWARD(Sender_, sender),
+                    async_scope_receiver{this}))
+            {
+            }
+
+            void start() & noexcept
+            {
+                hpx::execution::experimental::start(op_state);
+            }
+
+            void finish() noexcept
+            {
+                // the scope may be destroyed once the work has been removed
+                async_scope& s = scope;
+
+                allocator_type other_alloc(alloc);
+                std::allocator_traits<allocator_type>::destroy(
+                    other_alloc, this);
+                std::allocator_traits<allocator_type>::deallocate(
+                    other_alloc, this, 1);
+
+                s.remove_work();
+            }
+        };
+
+        template <typename Receiver>
+        struct async_scope_on_empty_operation_state : async_scope_waiter_base
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+            async_scope& scope;
+
+            template <typename Receiver_>
+            async_scope_on_empty_operation_state(
+                Receiver_&& receiver, async_scope& scope)
+              : async_scope_waiter_base(&complete)
+              , receiver(HPX_FORWARD(Receiver_, receiver))
+              , scope(scope)
+            {
+            }
+
+            async_scope_on_empty_operation_state(
+                async_scope_on_empty_operation_state&&) = delete;
+            async_scope_on_empty_operation_state& operator=(
+                async_scope_on_empty_operation_state&&) = delete;
+            async_scope_on_empty_operation_state(
+                async_scope_on_empty_operation_state const&) = delete;
+            async_scope_on_empty_operation_state& operator=(
+                async_scope_on_empty_operation_state const&) = delete;
+
+            static void complete(async_scope_waiter_base* p) noexcept
+            {
+                auto& receiver =
+                    static_cast<async_scope_on_empty_operation_state*>(p)
+                        ->receiver;
+                hpx::execution::experimental::set_value(HPX_MOVE(receiver));
+            }
+
+            void start() & noexcept
+            {
+                scope.add_waiter(this);
+            }
+
+            friend void tag_invoke(
+                start_t, async_scope_on_empty_operation_state& os) noexcept
+            {
+                os.start();
+            }
+        };
+
+        struct async_scope_on_empty_sender
+        {
+            using is_sender = void;
+
+            async_scope* scope;
+
+            using completion_signatures =
+                hpx::execution::experimental::completion_signatures<
+                    hpx::execution::experimental::set_value_t()>;
+
+            template <typename Env>
+            friend auto tag_invoke(get_completion_signatures_t,
+                async_scope_on_empty_sender const&, Env) noexcept
+                -> completion_signatures;
+
+            template <typename Receiver>
+            friend async_scope_on_empty_operation_state<Receiver> tag_invoke(
+                connect_t, async_scope_on_empty_sender const& s,
+                Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), *s.scope};
+            }
+        };
+    }    // namespace detail
+
+    inline detail::async_scope_on_empty_sender async_scope::on_empty() noexcept
+    {
+        return detail::async_scope_on_empty_sender{this};
+    }
+}    // namespace hpx::execution::experimental
@@ -18,6 +18,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_result.hpp>
 #include <hpx/iterator_support/counting_shape.hpp>
@@ -188,6 +189,11 @@ namespace hpx::execution::experimental {
     // additional operations such as let_value to deliver dynamic shape
     // information to the bulk operation.
     //
+    // An executor parameters object (e.g. static_chunk_size, guided_chunk_size,
+    // or auto_chunk_size) can be passed as an additional argument. Schedulers
+    // which execute the invocations in chunks (e.g. the thread_pool_scheduler)
+    // use it to determine the chunk sizes, other schedulers ignore it.
+    //
     inline constexpr struct bulk_t final
       : hpx::functional::detail::tag_priority<bulk_t>
     {
@@ -213,6 +219,30 @@ namespace hpx::execution::experimental {
                 HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f));
         }
 
+        // clang-format off
+        template <typename Sender, typename Shape, typename F,
+            typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender> &&
+                hpx::traits::is_executor_parameters_v<Parameters> &&
+                experimental::detail::is_completion_scheduler_tag_invocable_v<
+                    hpx::execution::experimental::set_value_t, Sender,
+                    bulk_t, Shape, F, Parameters
+                >
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_override_invoke(bulk_t,
+            Sender&& sender, Shape const& shape, F&& f, Parameters&& params)
+        {
+            auto scheduler =
+                hpx::execution::experimental::get_completion_scheduler<
+                    hpx::execution::experimental::set_value_t>(sender);
+
+            return hpx::functional::tag_invoke(bulk_t{}, HPX_MOVE(scheduler),
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params));
+        }
+
         // clang-format off
         template <typename Sender, typename Shape, typename F,
             HPX_CONCEPT_REQUIRES_(
@@ -243,6 +273,23 @@ namespace hpx::execution::experimental {
                 HPX_FORWARD(F, f)};
         }
 
+        // the executor parameters are ignored by schedulers which don't
+        // customize bulk
+        // clang-format off
+        template <typename Sender, typename Shape, typename F,
+            typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender> &&
+                hpx::traits::is_executor_parameters_v<Parameters>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(bulk_t,
+            Sender&& sender, Shape&& shape, F&& f, Parameters&&)
+        {
+            return bulk_t{}(HPX_FORWARD(Sender, sender),
+                HPX_FORWARD(Shape, shape), HPX_FORWARD(F, f));
+        }
+
         template <typename Shape, typename F>
         friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
             bulk_t, Shape&& shape, F&& f)
@@ -250,5 +297,20 @@ namespace hpx::execution::experimental {
             return detail::partial_algorithm<bulk_t, Shape, F>{
                 HPX_FORWARD(Shape, shape), HPX_FORWARD(F, f)};
         }
+
+        // clang-format off
+        template <typename Shape, typename F, typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                !is_sender_v<Shape> &&
+                hpx::traits::is_executor_parameters_v<Parameters>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            bulk_t, Shape&& shape, F&& f, Parameters&& params)
+        {
+            return detail::partial_algorithm<bulk_t, Shape, F, Parameters>{
+                HPX_FORWARD(Shape, shape), HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params)};
+        }
     } bulk{};
 }    // namespace hpx::execution::experimental
@@ -21,6 +21,8 @@
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/type_support/meta.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <exception>
 #include <mutex>
 
@@ -78,19 +80,21 @@ namespace hpx::execution::experimental {
     // operation states to hold the work units to make scheduling
     // allocation-free. -- end note]
     //
+    // The queue is a lock-free intrusive multi-producer single-consumer
+    // queue: scheduling work pushes the operation state onto an atomic stack,
+    // run() takes all queued operation states at once and executes them in
+    // the order they were scheduled. The mutex and condition variable are
+    // used only while run() waits for work, and only the first operation
+    // state scheduled while run() is waiting wakes it up.
+    //
     class run_loop
     {
         struct run_loop_opstate_base
         {
-            explicit run_loop_opstate_base(run_loop_opstate_base* tail) noexcept
-              : next(this)
-              , tail(tail)
-            {
-            }
-
-            run_loop_opstate_base(run_loop_opstate_base* tail,
-                void (*execute)(run_loop_opstate_base*) noexcept) noexcept
-              : next(tail)
+            explicit run_loop_opstate_base(
+                void (*execute)(run_loop_opstate_base*) noexcept =
+                    nullptr) noexcept
+              : next(nullptr)
               , execute_(execute)
             {
             }
@@ -104,11 +108,7 @@ namespace hpx::execution::experimental {
             ~run_loop_opstate_base() = default;
 
             run_loop_opstate_base* next;
-            union
-            {
-                void (*execute_)(run_loop_opstate_base*) noexcept;
-                run_loop_opstate_base* tail;
-            };
+            void (*execute_)(run_loop_opstate_base*) noexcept;
 
             void execute() noexcept
             {
@@ -129,11 +129,10 @@ namespace hpx::execution::experimental {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
 
                 template <typename Receiver_>
-                type(run_loop_opstate_base* tail, run_loop& loop,
-                    Receiver_&& receiver) noexcept(noexcept(std::
-                        is_nothrow_constructible_v<std::decay_t<Receiver>,
-                            Receiver_>))
-                  : run_loop_opstate_base(tail)
+                type(run_loop& loop, Receiver_&& receiver) noexcept(
+                    std::is_nothrow_constructible_v<std::decay_t<Receiver>,
+                        Receiver_>)
+                  : run_loop_opstate_base(&execute)
                   , loop(loop)
                   , receiver(HPX_FORWARD(Receiver_, receiver))
                 {
@@ -162,13 +161,6 @@ namespace hpx::execution::experimental {
                         });
                 }
 
-                type(run_loop_opstate_base* next, run_loop& loop, Receiver r)
-                  : run_loop_opstate_base(next, &execute)
-                  , loop(loop)
-                  , receiver(HPX_MOVE(r))
-                {
-                }
-
                 friend void tag_invoke(
                     hpx::execution::experimental::start_t, type& os) noexcept
                 {
@@ -208,12 +200,12 @@ namespace hpx::execution::experimental {
                 friend operation_state<Receiver> tag_invoke(
                     hpx::execution::experimental::connect_t,
                     run_loop_sender const& s,
-                    Receiver&& receiver) noexcept(noexcept(std::
+                    Receiver&& receiver) noexcept(std::
                         is_nothrow_constructible_v<operation_state<Receiver>,
-                            run_loop_opstate_base*, run_loop&>))
+                            run_loop&, Receiver>)
                 {
                     return operation_state<Receiver>(
-                        &s.loop.head, s.loop, HPX_FORWARD(Receiver, receiver));
+                        s.loop, HPX_FORWARD(Receiver, receiver));
                 }
 
                 // clang-format off
@@ -299,52 +291,128 @@ namespace hpx::execution::experimental {
         hpx::intrusive_ptr<detail::run_loop_data> mtx;
         hpx::lcos::local::detail::condition_variable cond_var;
 
-        // MSVC and gcc don't properly handle the friend declaration above
-#if defined(HPX_MSVC) || defined(HPX_GCC_VERSION)
-    public:
-#endif
-        run_loop_opstate_base head;
+        // The stack of scheduled operation states, most recently scheduled
+        // first. It holds &sleeping while run() waits for work.
+        std::atomic<run_loop_opstate_base*> head{nullptr};
+        std::atomic<bool> stop{false};
+        run_loop_opstate_base sleeping;
 
-    private:
-        bool stop = false;
+        // Set by the thread waking up run(), protected by the mutex.
+        bool woken = false;
 
         void push_back(run_loop_opstate_base* t)
+        {
+            if (stop.load(std::memory_order_relaxed))
+            {
+                stop.store(false, std::memory_order_relaxed);
+            }
+
+            run_loop_opstate_base* old_head =
+                head.load(std::memory_order_relaxed);
+            do
+            {
+                t->next = old_head == &sleeping ? nullptr : old_head;
+            } while (!head.compare_exchange_weak(old_head, t,
+                std::memory_order_release, std::memory_order_relaxed));
+
+            // The run_loop can't be destroyed before we have woken it up.
+            if (old_head == &sleeping)
+            {
+                wake_up();
+            }
+        }
+
+        void wake_up()
         {
             auto const local_mtx = mtx;    // keep alive
             std::unique_lock l(local_mtx->mtx_);
 
-            stop = false;
-            t->next = &head;
-            head.tail = head.tail->next = t;
+            woken = true;
             cond_var.notify_one(HPX_MOVE(l));
         }
 
-        run_loop_opstate_base* pop_front()
+        // Take all scheduled operation states, returns them in the order
+        // they were scheduled.
+        run_loop_opstate_base* pop_all() noexcept
         {
-            auto const local_mtx = mtx;    // keep alive
-            std::unique_lock l(local_mtx->mtx_);
+            run_loop_opstate_base* current =
+                head.exchange(nullptr, std::memory_order_acquire);
 
-            while (head.next == &head && !stop)
+            run_loop_opstate_base* reversed = nullptr;
+            while (current != nullptr)
             {
-                cond_var.wait(l);
+                run_loop_opstate_base* next = current->next;
+                current->next = reversed;
+                reversed = current;
+                current = next;
             }
+            return reversed;
+        }
 
-            if (head.tail == head.next)
+        static std::size_t execute_all(run_loop_opstate_base* t) noexcept
+        {
+            std::size_t count = 0;
+            while (t != nullptr)
             {
-                head.tail = &head;
+                // executing an operation state may destroy it
+                run_loop_opstate_base* next = t->next;
+                t->execute();
+                t = next;
+                ++count;
             }
+            return count;
+        }
 
-            // std::exchange(head.next, head.next->next);
-            auto const old_val = HPX_MOVE(head.next);
-            head.next = HPX_MOVE(head.next->next);
-            return old_val;
+        // Waits until new work has been scheduled or finish() has been
+        // called, returns false if run() should return.
+        bool wait()
+        {
+            if (stop.load(std::memory_order_seq_cst))
+            {
+                synchronize_with_finish();
+                return false;
+            }
+
+            run_loop_opstate_base* expected = nullptr;
+            if (!head.compare_exchange_strong(
+                    expected, &sleeping, std::memory_order_seq_cst))
+            {
+                return true;    // new work has been scheduled
+            }
+
+            if (stop.load(std::memory_order_seq_cst))
+            {
+                expected = &sleeping;
+                if (head.compare_exchange_strong(
+                        expected, nullptr, std::memory_order_seq_cst))
+                {
+                    synchronize_with_finish();
+                    return false;
+                }
+
+                // a concurrent push_back() or finish() is waking us up
+            }
+
+            std::unique_lock l(mtx->mtx_);
+            while (!woken)
+            {
+                cond_var.wait(l);
+            }
+            woken = false;
+            return true;
+        }
+
+        // finish() accesses the run_loop while holding the lock only, the
+        // run_loop may be destroyed once we have acquired it.
+        void synchronize_with_finish()
+        {
+            std::unique_lock l(mtx->mtx_);
         }
 
     public:
         // [exec.run_loop.ctor] construct/copy/destroy
         run_loop() noexcept
           : mtx(new detail::run_loop_data(), false)
-          , head(&head)    //-V546
         {
         }
 
@@ -357,7 +425,8 @@ namespace hpx::execution::experimental {
         // Otherwise, has no effects.
         ~run_loop()
         {
-            if (head.next != &head || !stop)
+            if (head.load(std::memory_order_relaxed) != nullptr ||
+                !stop.load(std::memory_order_relaxed))
             {
                 std::terminate();
             }
@@ -372,21 +441,43 @@ namespace hpx::execution::experimental {
         void run()
         {
             // Precondition: state is starting.
-            //HPX_ASSERT(head.next != &head || !stop);
-            for (run_loop_opstate_base* t; (t = pop_front()) != &head; /**/)
+            while (true)
             {
-                t->execute();
+                if (run_loop_opstate_base* t = pop_all())
+                {
+                    execute_all(t);
+                }
+                else if (!wait())
+                {
+                    break;
+                }
             }
             HPX_ASSERT(stop);    // Postcondition: state is finishing.
         }
 
+        // Executes all work scheduled so far without waiting for new work,
+        // returns the number of executed work items. This allows to drive the
+        // run_loop from an external event loop. poll() must not be called
+        // concurrently with run() or poll().
+        std::size_t poll()
+        {
+            return execute_all(pop_all());
+        }
+
         void finish()
         {
             auto const local_mtx = mtx;    // keep alive
             std::unique_lock l(local_mtx->mtx_);
 
-            stop = true;
-            cond_var.notify_all(HPX_MOVE(l));
+            stop.store(true, std::memory_order_seq_cst);
+
+            run_loop_opstate_base* expected = &sleeping;
+            if (head.compare_exchange_strong(
+                    expected, nullptr, std::memory_order_seq_cst))
+            {
+                woken = true;
+                cond_var.notify_one(HPX_MOVE(l));
+            }
         }
     };
 
@@ -13,7 +13,6 @@
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/datastructures/variant.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -29,9 +28,7 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
-#include <hpx/functional/move_only_function.hpp>
 #include <hpx/modules/memory.hpp>
-#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/type_support/meta.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -40,7 +37,6 @@
 #include <cstddef>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -139,6 +135,19 @@ namespace hpx::execution::experimental {
 
             // TODO: add forwarding_sender_query
 
+            // The operation states connected to a split sender are linked
+            // into an intrusive stack of continuations of the shared state,
+            // no memory is allocated for registering them.
+            struct continuation_base
+            {
+                continuation_base* next = nullptr;
+
+                virtual void complete() noexcept = 0;
+
+            protected:
+                ~continuation_base() = default;
+            };
+
             struct shared_state
             {
                 struct split_receiver;
@@ -147,10 +156,13 @@ namespace hpx::execution::experimental {
                     Allocator>::template rebind_alloc<shared_state>;
                 HPX_NO_UNIQUE_ADDRESS allocator_type alloc;
 
-                hpx::spinlock mtx;
                 hpx::util::atomic_count reference_count{0};
                 std::atomic<bool> start_called{false};
-                std::atomic<bool> predecessor_done{false};
+
+                // The head of the stack of registered continuations. It is
+                // set to the shared state itself once the predecessor has
+                // completed, no continuations are added after that.
+                std::atomic<void*> continuations{nullptr};
 
                 using operation_state_type =
                     std::decay_t<connect_result_t<Sender, split_receiver>>;
@@ -170,9 +182,6 @@ namespace hpx::execution::experimental {
                     value_type>
                     v;
 
-                using continuation_type = hpx::move_only_function<void()>;
-                hpx::detail::small_vector<continuation_type, 1> continuations;
-
                 struct split_receiver
                 {
                     hpx::intrusive_ptr<shared_state> state;
@@ -301,113 +310,64 @@ namespace hpx::execution::experimental {
 
                 virtual void set_predecessor_done()
                 {
-                    predecessor_done = true;
-
+                    // Marking the predecessor as done and taking the stack of
+                    // continuations registered so far is a single atomic
+                    // operation. The values/errors stored into the shared
+                    // state before are visible to all continuations.
+                    void* head =
+                        continuations.exchange(this, std::memory_order_acq_rel);
+                    HPX_ASSERT(head != this);
+
+                    // The continuations have been pushed in reverse order of
+                    // their registration.
+                    continuation_base* reversed = nullptr;
+                    auto* current = static_cast<continuation_base*>(head);
+                    while (current != nullptr)
                     {
-                        // We require taking the lock here to synchronize with
-                        // threads attempting to add continuations to the vector
-                        // of continuations. However, it is enough to take it
-                        // once and release it immediately.
-                        //
-                        // Without the lock we may not see writes to the vector.
-                        // With the lock threads attempting to add continuations
-                        // will either:
-                        // - See predecessor_done = true in which case they will
-                        //   call the continuation directly without adding it to
-                        //   the vector of continuations. Accessing the vector
-                        //   below without the lock is safe in this case because
-                        //   the vector is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done after taking
-                        //   the lock they can again release the lock and call
-                        //   the continuation directly. Accessing the vector
-                        //   without the lock is again safe because the vector
-                        //   is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done is still
-                        //   false after taking the lock, they will proceed to
-                        //   add a continuation to the vector. Since they keep
-                        //   the lock they can safely write to the vector. This
-                        //   thread will not proceed past the lock until they
-                        //   have finished writing to the vector.
-                        //
-                        // Importantly, once this thread has taken and released
-                        // this lock, threads attempting to add continuations to
-                        // the vector must see predecessor_done = true after
-                        // taking the lock in their threads and will not add
-                        // continuations to the vector.
-                        std::unique_lock l{mtx};
+                        continuation_base* next = current->next;
+                        current->next = reversed;
+                        reversed = current;
+                        current = next;
                     }
 
-                    if (!continuations.empty())
+                    while (reversed != nullptr)
                     {
-                        for (auto const& continuation : continuations)
-                        {
-                            continuation();
-                        }
-
-                        continuations.clear();
+                        // completing a continuation may destroy it
+                        continuation_base* next = reversed->next;
+                        reversed->complete();
+                        reversed = next;
                     }
                 }
 
                 template <typename Receiver>
-                void add_continuation(Receiver& receiver) = delete;
+                void complete_continuation(Receiver&& receiver)
+                {
+                    // TODO: Should this preserve the scheduler? It does not
+                    // if we call set_* inline.
+                    hpx::visit(done_error_value_visitor<Receiver>{
+                                   HPX_FORWARD(Receiver, receiver)},
+                        v);
+                }
 
-                template <typename Receiver>
-                void add_continuation(Receiver&& receiver)
+                void add_continuation(continuation_base* continuation)
                 {
-                    if (predecessor_done)
-                    {
-                        // If we read predecessor_done here it means that one of
-                        // set_error/set_stopped/set_value has been called and
-                        // values/errors have been stored into the shared state.
-                        // We can trigger the continuation directly.
-                        // TODO: Should this preserve the scheduler? It does not
-                        // if we call set_* inline.
-                        hpx::visit(
-                            done_error_value_visitor<Receiver>{
-                                HPX_FORWARD(Receiver, receiver)},
-                            v);
-                    }
-                    else
+                    void* head = continuations.load(std::memory_order_acquire);
+                    do
                     {
-                        // If predecessor_done is false, we have to take the
-                        // lock to potentially add the continuation to the
-                        // vector of continuations.
-                        std::unique_lock l{mtx};
-
-                        if (predecessor_done)
+                        if (head == this)
                         {
-                            // By the time the lock has been taken,
-                            // predecessor_done might already be true and we can
-                            // release the lock early and call the continuation
-                            // directly again.
-                            l.unlock();
-                            hpx::visit(
-                                done_error_value_visitor<Receiver>{
-                                    HPX_FORWARD(Receiver, receiver)},
-                                v);
+                            // One of set_error/set_stopped/set_value has been
+                            // called and values/errors have been stored into
+                            // the shared state. We can trigger the
+                            // continuation directly.
+                            continuation->complete();
+                            return;
                         }
-                        else
-                        {
-                            // If predecessor_done is still false, we add the
-                            // continuation to the vector of continuations. This
-                            // has to be done while holding the lock, since
-                            // other threads may also try to add continuations
-                            // to the vector and the vector is not threadsafe in
-                            // itself. The continuation will be called later
-                            // when set_error/set_stopped/set_value is called.
-                            continuations.emplace_back(
-                                [this,
-                                    receiver = HPX_FORWARD(
-                                        Receiver, receiver)]() mutable {
-                                    hpx::visit(
-                                        done_error_value_visitor<Receiver>{
-                                            HPX_MOVE(receiver)},
-                                        v);
-                                });
-                        }
-                    }
+                        continuation->next =
+                            static_cast<continuation_base*>(head);
+                    } while (!continuations.compare_exchange_weak(head,
+                        continuation, std::memory_order_release,
+                        std::memory_order_acquire));
                 }
 
                 void start() & noexcept
@@ -532,7 +492,7 @@ namespace hpx::execution::experimental {
             split_sender& operator=(split_sender&&) = default;
 
             template <typename Receiver>
-            struct operation_state
+            struct operation_state final : continuation_base
             {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
                 hpx::intrusive_ptr<shared_state> state;
@@ -550,6 +510,11 @@ namespace hpx::execution::experimental {
                 operation_state(operation_state const&) = delete;
                 operation_state& operator=(operation_state const&) = delete;
 
+                void complete() noexcept override
+                {
+                    state->complete_continuation(HPX_MOVE(receiver));
+                }
+
                 friend void tag_invoke(start_t, operation_state& os) noexcept
                 {
                     // Lazy submission means that we wait to start the
@@ -560,7 +525,7 @@ namespace hpx::execution::experimental {
                         os.state->start();
                     }
 
-                    os.state->add_continuation(HPX_MOVE(os.receiver));
+                    os.state->add_continuation(&os);
                 }
             };
 
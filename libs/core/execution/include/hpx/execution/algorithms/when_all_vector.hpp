@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/datastructures/variant.hpp>
 #include <hpx/execution/algorithms/detail/single_result.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/type_support/meta.hpp>
 #include <hpx/type_support/pack.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <exception>
@@ -233,7 +235,8 @@ namespace hpx::when_all_vector_detail {
             // predecessor senders send nothing
             using value_types_storage_type =
                 std::conditional_t<is_void_value_type, void_value_type,
-                    std::vector<std::optional<element_value_type>>>;
+                    hpx::detail::small_vector<std::optional<element_value_type>,
+                        HPX_WHEN_ALL_INLINE_SIZE>>;
             value_types_storage_type ts;
 
             // The first error sent by any predecessor sender is stored in a
@@ -248,22 +251,34 @@ namespace hpx::when_all_vector_detail {
 
             // The operation states are stored in an array of optionals of
             // the operation states to handle the non-movability and
-            // non-copyability of them
+            // non-copyability of them, arrays of up to
+            // HPX_WHEN_ALL_INLINE_SIZE elements are stored in place
             using operation_state_type =
                 hpx::execution::experimental::connect_result_t<Sender,
                     when_all_vector_receiver>;
-            using operation_states_storage_type =
-                std::unique_ptr<std::optional<operation_state_type>[]>;
-            operation_states_storage_type op_states = nullptr;
+            using operation_state_storage_type =
+                std::optional<operation_state_type>;
+            std::array<operation_state_storage_type, HPX_WHEN_ALL_INLINE_SIZE>
+                inline_op_states;
+            std::unique_ptr<operation_state_storage_type[]> allocated_op_states;
+            operation_state_storage_type* op_states = nullptr;
 
             template <typename Receiver_>
             operation_state(Receiver_&& receiver, std::vector<Sender>&& senders)
               : num_predecessors(senders.size())
               , receiver(HPX_FORWARD(Receiver_, receiver))
             {
-                op_states =
-                    std::make_unique<std::optional<operation_state_type>[]>(
-                        num_predecessors);
+                if (num_predecessors > HPX_WHEN_ALL_INLINE_SIZE)
+                {
+                    allocated_op_states =
+                        std::make_unique<operation_state_storage_type[]>(
+                            num_predecessors);
+                    op_states = allocated_op_states.get();
+                }
+                else
+                {
+                    op_states = inline_op_states.data();
+                }
                 std::size_t i = 0;
                 for (auto&& sender : senders)
                 {
@@ -381,7 +396,7 @@ namespace hpx::when_all_vector_detail {
                     for (std::size_t i = 0; i < os.num_predecessors; ++i)
                     {
                         hpx::execution::experimental::start(
-                            os.op_states.get()[i].value());
+                            os.op_states[i].value());
                     }
                 }
             }
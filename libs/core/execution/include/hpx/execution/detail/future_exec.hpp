@@ -157,10 +157,39 @@ namespace hpx::lcos::detail {
     ///////////////////////////////////////////////////////////////////////////
     struct post_policy_spawner
     {
+        post_policy_spawner() = default;
+
+        // Continuations may be run inline only if their launch policy leaves
+        // the placement, priority, and stack size of the new thread to the
+        // runtime. Explicit requests (and launch::fork) are always honored by
+        // creating a new thread.
+        template <typename Policy>
+        explicit constexpr post_policy_spawner(Policy const& policy) noexcept
+          : may_run_inline_(
+                policy.policy() != hpx::detail::launch_policy::fork &&
+                policy.priority() == threads::thread_priority::default_ &&
+                (policy.stacksize() == threads::thread_stacksize::default_ ||
+                    policy.stacksize() == threads::thread_stacksize::small_) &&
+                policy.hint().mode == threads::thread_schedule_hint_mode::none)
+        {
+        }
+
+        // A fused continuation is triggered by the thread that runs the
+        // continuation it depends on.
         template <typename F>
         void operator()(F&& f, hpx::threads::thread_description desc,
-            threads::thread_id_ref_type& id) const
+            threads::thread_id_ref_type& id, bool fused = false) const
         {
+            // avoid creating a new thread if the continuation may run on the
+            // thread that made its future ready
+            if (may_run_inline_ &&
+                lcos::detail::can_run_continuation_inline(fused))
+            {
+                lcos::detail::inline_continuation_scope const scope;
+                HPX_FORWARD(F, f)();
+                return;
+            }
+
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(HPX_FORWARD(F, f)),
                 HPX_MOVE(desc), threads::thread_priority::default_,
@@ -170,6 +199,13 @@ namespace hpx::lcos::detail {
 
             threads::register_thread(data, id);
         }
+
+        bool may_run_inline_ = false;
+    };
+
+    template <>
+    struct is_fusing_spawner<post_policy_spawner> : std::true_type
+    {
     };
 
     template <typename Executor>
@@ -201,7 +237,7 @@ namespace hpx::lcos::detail {
             new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
 
         static_cast<shared_state*>(p.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type(policy),
             HPX_FORWARD(Policy, policy));
 
         return p;
@@ -242,7 +278,7 @@ namespace hpx::lcos::detail {
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type(policy),
             HPX_FORWARD(Policy, policy));
 
         return r;
@@ -284,7 +320,7 @@ namespace hpx::lcos::detail {
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<false>(
-            HPX_FORWARD(Future, future), spawner_type{},
+            HPX_FORWARD(Future, future), spawner_type(policy),
             HPX_FORWARD(Policy, policy));
 
         return r;
@@ -10,7 +10,9 @@
 
 #include <hpx/execution/executors/adaptive_static_chunk_size.hpp>
 #include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/cache_aware_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
+#include <hpx/execution/executors/feedback_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/executors/num_cores.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
@@ -0,0 +1,199 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/cache_aware_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/steady_clock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // The size of the cache available to a single core is the share of
+        // the cache of the given level which belongs to the processing units
+        // of the core (i.e. the whole cache for private caches, a fraction of
+        // it for shared caches). The smallest share of all cores is used,
+        // zero is returned if the topology does not report the cache.
+        inline std::size_t get_per_core_cache_size(int level)
+        {
+            if (level < 1 || level > 5)
+            {
+                return 0;
+            }
+
+            // the topology is queried only once for all cache levels
+            static std::array<std::size_t, 5> const sizes = [] {
+                auto const& topo = hpx::threads::create_topology();
+                std::size_t const num_pus = topo.get_number_of_pus();
+
+                std::array<std::size_t, 5> result = {};
+                for (int l = 1; l <= 5; ++l)
+                {
+                    std::size_t& size = result[l - 1];
+                    for (std::size_t pu = 0; pu != num_pus; ++pu)
+                    {
+                        hpx::error_code ec(hpx::throwmode::lightweight);
+                        auto const& mask = topo.get_core_affinity_mask(pu, ec);
+                        if (ec)
+                        {
+                            continue;
+                        }
+
+                        std::size_t const core_size =
+                            topo.get_cache_size(mask, l);
+                        if (core_size != 0 && (size == 0 || core_size < size))
+                        {
+                            size = core_size;
+                        }
+                    }
+                }
+                return result;
+            }();
+
+            return sizes[static_cast<std::size_t>(level - 1)];
+        }
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces whose working set fits into a
+    /// given fraction of the cache of a single core. The cache sizes are
+    /// read from the machine topology (\a hpx::threads::topology), the
+    /// working set of a chunk is estimated from the number of bytes touched
+    /// by a single iteration, which has to be specified by the user.
+    /// The chunk size is reduced further if this is necessary to create at
+    /// least one chunk per core.
+    ///
+    /// This is most beneficial for streaming algorithms (like \a transform,
+    /// \a copy, or \a reduce) operating on large ranges, where chunks based
+    /// on the number of cores only are considerably larger than the caches.
+    ///
+    /// \note For instance, a \a transform from a range of doubles into
+    ///       another range of doubles touches 16 bytes per iteration.
+    ///
+    struct cache_aware_chunk_size
+    {
+        /// Construct a \a cache_aware_chunk_size executor parameters object
+        ///
+        /// \param bytes_per_iteration [in] The number of bytes touched by a
+        ///                     single loop iteration (the sum of the element
+        ///                     sizes of all ranges accessed by the
+        ///                     algorithm).
+        /// \param cache_level  [in] The level of the cache the working set of
+        ///                     a chunk should fit into (default: 2).
+        /// \param cache_fraction [in] The fraction of the cache the working
+        ///                     set of a chunk should occupy (default: 0.5),
+        ///                     which leaves room for other data.
+        ///
+        explicit cache_aware_chunk_size(std::size_t bytes_per_iteration,
+            int cache_level = 2, double cache_fraction = 0.5)
+          : bytes_per_iteration_(
+                (std::max)(bytes_per_iteration, static_cast<std::size_t>(1)))
+          , cache_size_(detail::get_per_core_cache_size(cache_level))
+          , cache_level_(cache_level)
+          , cache_fraction_((std::clamp)(cache_fraction, 0.0, 1.0))
+        {
+            if (cache_size_ == 0)
+            {
+                cache_size_ = default_cache_size;
+            }
+        }
+
+        /// Construct a \a cache_aware_chunk_size executor parameters object
+        /// for an algorithm accessing one element of each of the given types
+        /// per iteration.
+        template <typename... Ts>
+        static cache_aware_chunk_size for_types(
+            int cache_level = 2, double cache_fraction = 0.5)
+        {
+            return cache_aware_chunk_size(
+                (sizeof(Ts) + ... + 0), cache_level, cache_fraction);
+        }
+
+        /// Return the size of the cache (in bytes) available to a single core
+        /// used by this object.
+        constexpr std::size_t get_cache_size() const noexcept
+        {
+            return cache_size_;
+        }
+
+        /// Return the number of loop iterations whose working set fits into
+        /// the configured fraction of the cache.
+        constexpr std::size_t get_cache_resident_iterations() const noexcept
+        {
+            auto const iterations = static_cast<std::size_t>(
+                cache_fraction_ * static_cast<double>(cache_size_) /
+                static_cast<double>(bytes_per_iteration_));
+            return (std::max)(iterations, static_cast<std::size_t>(1));
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            cache_aware_chunk_size const& this_, Executor&,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t input_size) noexcept
+        {
+            if (cores <= 1 || input_size == 0)
+            {
+                return input_size;
+            }
+
+            // create at least one chunk per core
+            std::size_t const max_chunk_size = (input_size + cores - 1) / cores;
+            return (std::min)(
+                this_.get_cache_resident_iterations(), max_chunk_size);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & bytes_per_iteration_ & cache_size_ & cache_level_ &
+                cache_fraction_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        // used if the topology does not report the size of the cache
+        static constexpr std::size_t default_cache_size = 256 * 1024;
+
+        std::size_t bytes_per_iteration_ = 1;
+        std::size_t cache_size_ = default_cache_size;
+        int cache_level_ = 2;
+        double cache_fraction_ = 0.5;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::cache_aware_chunk_size> : std::true_type
+{
+};
+/// \endcond
@@ -0,0 +1,396 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/feedback_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Timing history of all call sites of a feedback_chunk_size object,
+        // keyed by the annotation of the executor used for the call.
+        //
+        // The algorithms may invoke the customization points on different
+        // copies of the executor parameters (and on different threads), so
+        // the state of the running invocations is kept here as well.
+        // Concurrent invocations of the same call site are matched in the
+        // order they have begun.
+        struct feedback_chunk_size_history
+        {
+            // state of a running invocation
+            struct invocation
+            {
+                std::uint64_t start = 0;
+                std::size_t count = 0;
+                std::size_t cores = 1;
+                std::size_t chunk_size = 0;
+            };
+
+            struct entry
+            {
+                double iteration_time = 0.0;    // smoothed, nanoseconds
+                std::size_t invocations = 0;
+                std::deque<invocation> running;
+            };
+
+            // invocations that never end are dropped eventually
+            static constexpr std::size_t max_running = 64;
+
+            // return the smoothed execution time of one iteration (zero if
+            // unknown)
+            double get(std::string const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto const it = entries_.find(key);
+                return it != entries_.end() ? it->second.iteration_time : 0.0;
+            }
+
+            void begin(std::string const& key, std::uint64_t start)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                std::deque<invocation>& running = entries_[key].running;
+                if (running.size() == max_running)
+                {
+                    running.pop_front();
+                }
+                running.push_back(invocation{start});
+            }
+
+            // the overall number of iterations of the oldest invocation
+            // that has not determined its chunk size yet
+            void set_count(std::string const& key, std::size_t count)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                if (invocation* inv = find_pending(key))
+                {
+                    inv->count = count;
+                }
+            }
+
+            void set_chunk_size(std::string const& key, std::size_t count,
+                std::size_t cores, std::size_t chunk_size)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                if (invocation* inv = find_pending(key))
+                {
+                    if (inv->count == 0)
+                    {
+                        inv->count = count;
+                    }
+                    inv->cores = cores;
+                    inv->chunk_size = chunk_size;
+                }
+            }
+
+            // merge the measured execution time of one iteration of the
+            // oldest running invocation
+            void end(std::string const& key, std::uint64_t now,
+                double smoothing)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto const it = entries_.find(key);
+                if (it == entries_.end() || it->second.running.empty())
+                {
+                    return;
+                }
+
+                entry& e = it->second;
+                invocation const inv = e.running.front();
+                e.running.pop_front();
+
+                if (inv.count == 0 || inv.chunk_size == 0)
+                {
+                    return;
+                }
+
+                // the chunks were run concurrently on at most 'cores' cores
+                std::size_t const num_chunks =
+                    (inv.count + inv.chunk_size - 1) / inv.chunk_size;
+                std::size_t const concurrency = (std::max)(
+                    (std::min)(inv.cores, num_chunks), std::size_t(1));
+
+                double const iteration_time =
+                    static_cast<double>(now - inv.start) *
+                    static_cast<double>(concurrency) /
+                    static_cast<double>(inv.count);
+
+                if (e.invocations++ == 0)
+                {
+                    e.iteration_time = iteration_time;
+                }
+                else
+                {
+                    e.iteration_time = smoothing * iteration_time +
+                        (1.0 - smoothing) * e.iteration_time;
+                }
+            }
+
+            std::size_t invocations(std::string const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto const it = entries_.find(key);
+                return it != entries_.end() ? it->second.invocations : 0;
+            }
+
+        private:
+            invocation* find_pending(std::string const& key)
+            {
+                auto const it = entries_.find(key);
+                if (it == entries_.end())
+                {
+                    return nullptr;
+                }
+
+                for (invocation& inv : it->second.running)
+                {
+                    if (inv.chunk_size == 0)
+                    {
+                        return &inv;
+                    }
+                }
+                return nullptr;
+            }
+
+            hpx::spinlock mtx_;
+            std::map<std::string, entry> entries_;
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is adjusted between subsequent
+    /// invocations of an algorithm such that each chunk runs for the target
+    /// amount of time specified.
+    /// The first invocation measures the execution of 1% of the overall
+    /// number of iterations (similar to \a auto_chunk_size). Every invocation
+    /// measures its overall execution time and refines the estimated
+    /// execution time of a single iteration, which is used to determine the
+    /// chunk size of the next invocation.
+    /// The timing history is kept separately for every call site, identified
+    /// by the annotation of the executor used (see
+    /// \a hpx::execution::experimental::with_annotation). All copies of a
+    /// \a feedback_chunk_size object share the same history, they can be
+    /// used concurrently.
+    ///
+    /// \note Executor annotations are available only if HPX was configured
+    ///       with HPX_WITH_THREAD_DESCRIPTION=ON. Otherwise, all call sites
+    ///       share the same history.
+    ///
+    struct feedback_chunk_size
+    {
+    public:
+        /// Construct a \a feedback_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a feedback_chunk_size executor
+        ///       parameter types will use 200 microseconds as the target time
+        ///       for which any of the scheduled chunks should run.
+        ///
+        feedback_chunk_size()
+          : history_(std::make_shared<detail::feedback_chunk_size_history>())
+        {
+        }
+
+        /// Construct a \a feedback_chunk_size executor parameters object
+        ///
+        /// \param target_time  [in] The time each of the scheduled chunks
+        ///                     should run for.
+        /// \param smoothing    [in] The weight (between 0 and 1) of a new
+        ///                     measurement when updating the estimated
+        ///                     execution time of a single iteration.
+        ///
+        explicit feedback_chunk_size(
+            hpx::chrono::steady_duration const& target_time,
+            double smoothing = 0.5)
+          : history_(std::make_shared<detail::feedback_chunk_size_history>())
+          , target_time_(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    target_time.value())
+                    .count())
+          , smoothing_((std::clamp)(smoothing, 0.0, 1.0))
+        {
+        }
+
+        /// Return the number of invocations measured for the call site using
+        /// the given annotation.
+        std::size_t get_invocations(std::string const& annotation = "") const
+        {
+            return history_->invocations(annotation);
+        }
+
+        /// Return the estimated execution time of one iteration for the call
+        /// site using the given annotation (zero if unknown).
+        std::chrono::nanoseconds get_iteration_time(
+            std::string const& annotation = "") const
+        {
+            return std::chrono::nanoseconds(
+                static_cast<std::int64_t>(history_->get(annotation)));
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type synchronously invokes the provided
+        // testing function in order to approximate the chunk-size for call
+        // sites it has not seen before.
+        using invokes_testing_function = std::true_type;
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_begin_execution_t,
+            feedback_chunk_size const& this_, Executor&& exec)
+        {
+            this_.history_->begin(
+                get_key(exec), hpx::chrono::high_resolution_clock::now());
+        }
+
+        // Estimate execution time for one iteration
+        template <typename Executor, typename F>
+        friend auto tag_override_invoke(
+            hpx::parallel::execution::measure_iteration_t,
+            feedback_chunk_size const& this_, Executor&& exec, F&& f,
+            std::size_t count)
+        {
+            std::string const key = get_key(exec);
+            this_.history_->set_count(key, count);
+
+            // use the history, if available
+            double const t = this_.history_->get(key);
+            if (t != 0.0)
+            {
+                return std::chrono::nanoseconds(
+                    (std::max)(static_cast<std::int64_t>(t), std::int64_t(1)));
+            }
+
+            // otherwise measure 1% of the iterations
+            if (count >= 100)
+            {
+                using hpx::chrono::high_resolution_clock;
+                std::uint64_t const start = high_resolution_clock::now();
+
+                std::size_t const test_chunk_size = f(count / 100);
+                if (test_chunk_size != 0)
+                {
+                    std::uint64_t const elapsed =
+                        high_resolution_clock::now() - start;
+                    return std::chrono::nanoseconds((std::max)(
+                        elapsed / test_chunk_size, std::uint64_t(1)));
+                }
+            }
+
+            return std::chrono::nanoseconds(0);
+        }
+
+        // Estimate a chunk size based on the execution time of one iteration
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            feedback_chunk_size const& this_, Executor& exec,
+            hpx::chrono::steady_duration const& iteration_duration,
+            std::size_t cores, std::size_t count)
+        {
+            std::string const key = get_key(exec);
+
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                iteration_duration.value())
+                          .count();
+
+            // algorithms that do not measure iterations rely on the history
+            if (ns == 0)
+            {
+                ns = static_cast<std::int64_t>(this_.history_->get(key));
+            }
+
+            std::size_t chunk_size = 0;
+            if (ns != 0)
+            {
+                chunk_size = (std::clamp)(
+                    static_cast<std::size_t>(this_.target_time_ / ns),
+                    std::size_t(1), (std::max)(count, std::size_t(1)));
+            }
+            else
+            {
+                chunk_size = (count + cores - 1) / cores;
+            }
+
+            this_.history_->set_chunk_size(key, count, cores, chunk_size);
+            return chunk_size;
+        }
+
+        // Record the execution time of the whole invocation
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_end_execution_t,
+            feedback_chunk_size const& this_, Executor&& exec)
+        {
+            this_.history_->end(get_key(exec),
+                hpx::chrono::high_resolution_clock::now(), this_.smoothing_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        static std::string get_key(Executor const& exec)
+        {
+            char const* annotation =
+                hpx::execution::experimental::get_annotation(exec);
+            return annotation != nullptr ? std::string(annotation) :
+                                           std::string();
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // the timing history is local to the process
+            // clang-format off
+            ar & target_time_ & smoothing_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::feedback_chunk_size_history> history_;
+
+        std::int64_t target_time_ = 200000;    // nanoseconds
+        double smoothing_ = 0.5;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::feedback_chunk_size> : std::true_type
+{
+};
+/// \endcond
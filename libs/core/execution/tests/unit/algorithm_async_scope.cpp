@@ -0,0 +1,194 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+struct on_empty_receiver
+{
+    std::atomic<int>& completed;
+    ex::run_loop* loop = nullptr;
+
+    template <typename E>
+    friend void tag_invoke(ex::set_error_t, on_empty_receiver&&, E&&) noexcept
+    {
+        HPX_TEST(false);
+    }
+
+    friend void tag_invoke(ex::set_stopped_t, on_empty_receiver&&) noexcept
+    {
+        HPX_TEST(false);
+    }
+
+    friend void tag_invoke(ex::set_value_t, on_empty_receiver&& r) noexcept
+    {
+        ++r.completed;
+        if (r.loop != nullptr)
+        {
+            r.loop->finish();
+        }
+    }
+};
+
+// completes with set_stopped if stop has been requested through the stop
+// token of the environment of its receiver
+struct stop_checking_sender
+{
+    using is_sender = void;
+
+    std::atomic<int>& executed;
+
+    template <typename R>
+    struct operation_state
+    {
+        std::decay_t<R> r;
+        std::atomic<int>& executed;
+
+        friend void tag_invoke(ex::start_t, operation_state& os) noexcept
+        {
+            if (ex::get_stop_token(ex::get_env(os.r)).stop_requested())
+            {
+                ex::set_stopped(std::move(os.r));
+            }
+            else
+            {
+                ++os.executed;
+                ex::set_value(std::move(os.r));
+            }
+        }
+    };
+
+    template <typename R>
+    friend operation_state<R> tag_invoke(
+        ex::connect_t, stop_checking_sender&& s, R&& r)
+    {
+        return {std::forward<R>(r), s.executed};
+    }
+
+    template <typename Env>
+    friend auto tag_invoke(
+        ex::get_completion_signatures_t, stop_checking_sender const&, Env)
+        -> ex::completion_signatures<ex::set_value_t(), ex::set_stopped_t()>;
+};
+
+void test_empty()
+{
+    ex::async_scope scope;
+
+    // an empty scope completes on_empty immediately
+    std::atomic<int> completed{0};
+    auto os = ex::connect(scope.on_empty(), on_empty_receiver{completed});
+    ex::start(os);
+    HPX_TEST_EQ(completed.load(), 1);
+
+    tt::sync_wait(scope.on_empty());
+}
+
+void test_spawn_inline()
+{
+    ex::async_scope scope;
+
+    int count = 0;
+    for (int i = 0; i != 10; ++i)
+    {
+        scope.spawn(ex::just(i) | ex::then([&](int) { ++count; }));
+    }
+    HPX_TEST_EQ(count, 10);
+
+    tt::sync_wait(scope.on_empty());
+}
+
+void test_spawn_run_loop()
+{
+    constexpr int num_producers = 4;
+    constexpr int num_tasks = 100;
+
+    ex::run_loop loop;
+    auto sched = loop.get_scheduler();
+
+    ex::async_scope scope;
+
+    std::atomic<int> count{0};
+    std::vector<hpx::thread> producers;
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.emplace_back([&]() {
+            for (int j = 0; j != num_tasks; ++j)
+            {
+                scope.spawn(ex::schedule(sched) | ex::then([&]() { ++count; }));
+            }
+        });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    HPX_TEST_EQ(count.load(), 0);
+
+    // all waiters complete once the spawned work has completed
+    std::atomic<int> completed{0};
+    auto os1 = ex::connect(scope.on_empty(), on_empty_receiver{completed});
+    auto os2 =
+        ex::connect(scope.on_empty(), on_empty_receiver{completed, &loop});
+    ex::start(os1);
+    ex::start(os2);
+    HPX_TEST_EQ(completed.load(), 0);
+
+    loop.run();
+
+    HPX_TEST_EQ(count.load(), num_producers * num_tasks);
+    HPX_TEST_EQ(completed.load(), 2);
+}
+
+void test_request_stop()
+{
+    ex::async_scope scope;
+    HPX_TEST(!scope.get_stop_token().stop_requested());
+
+    // the spawned work observes the stop token of the scope
+    std::atomic<int> executed{0};
+    scope.spawn(stop_checking_sender{executed});
+    HPX_TEST_EQ(executed.load(), 1);
+
+    HPX_TEST(scope.request_stop());
+    HPX_TEST(scope.get_stop_token().stop_requested());
+
+    scope.spawn(stop_checking_sender{executed});
+    HPX_TEST_EQ(executed.load(), 1);
+
+    tt::sync_wait(scope.on_empty());
+}
+
+int hpx_main()
+{
+    test_empty();
+    test_spawn_inline();
+    test_spawn_run_loop();
+    test_request_stop();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -76,6 +76,74 @@ void test_execute()
     loop.run();
 }
 
+void test_execute_multiple_producers()
+{
+    constexpr int num_producers = 8;
+    constexpr int num_tasks = 1000;
+
+    hpx::thread::id parent_id = hpx::this_thread::get_id();
+
+    ex::run_loop loop;
+    auto sched = loop.get_scheduler();
+
+    std::atomic<int> count{0};
+    std::vector<hpx::thread> producers;
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.emplace_back([&]() {
+            for (int j = 0; j != num_tasks; ++j)
+            {
+                ex::execute(sched, [&]() {
+                    HPX_TEST_EQ(hpx::this_thread::get_id(), parent_id);
+                    if (++count == num_producers * num_tasks)
+                    {
+                        loop.finish();
+                    }
+                });
+
+                // give the run_loop a chance to run out of work
+                if (j % 100 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    loop.run();
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    HPX_TEST_EQ(count.load(), num_producers * num_tasks);
+}
+
+void test_poll()
+{
+    ex::run_loop loop;
+    auto sched = loop.get_scheduler();
+
+    // work is executed in the order it was scheduled
+    std::vector<int> executed;
+    for (int i = 0; i != 10; ++i)
+    {
+        ex::execute(sched, [&executed, i]() { executed.push_back(i); });
+    }
+
+    HPX_TEST_EQ(loop.poll(), static_cast<std::size_t>(10));
+    HPX_TEST_EQ(loop.poll(), static_cast<std::size_t>(0));
+
+    HPX_TEST_EQ(executed.size(), static_cast<std::size_t>(10));
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(executed[i], i);
+    }
+
+    loop.finish();
+    loop.run();
+}
+
 struct check_context_receiver
 {
     hpx::thread::id parent_id;
@@ -1759,6 +1827,8 @@ int hpx_main()
 {
     RUN_TEST(test_concepts);
     RUN_TEST(test_execute);
+    RUN_TEST(test_execute_multiple_producers);
+    RUN_TEST(test_poll);
     RUN_TEST(test_sender_receiver_basic);
     RUN_TEST(test_sender_receiver_then);
     RUN_TEST(test_sender_receiver_then_wait);
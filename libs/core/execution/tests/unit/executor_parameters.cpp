@@ -8,7 +8,9 @@
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -142,6 +144,68 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_feedback_chunk_size()
+{
+    {
+        hpx::execution::experimental::feedback_chunk_size fcs;
+        parameters_test(fcs);
+
+        // all copies share the timing history of the (unannotated) call site
+        HPX_TEST_NEQ(fcs.get_invocations(), std::size_t(0));
+    }
+    {
+        hpx::execution::experimental::feedback_chunk_size fcs(
+            std::chrono::microseconds(50), 0.25);
+        parameters_test(fcs);
+    }
+    {
+        // concurrent invocations using copies of the same parameters object
+        hpx::execution::experimental::feedback_chunk_size fcs;
+
+        constexpr std::size_t num_invocations = 8;
+        std::vector<std::vector<int>> data(
+            num_invocations, std::vector<int>(10007));
+
+        std::vector<hpx::future<void>> results;
+        results.reserve(num_invocations);
+        for (auto& c : data)
+        {
+            results.push_back(hpx::for_each(
+                hpx::execution::par(hpx::execution::task).with(fcs),
+                std::begin(c), std::end(c), [](int& v) { v = 42; }));
+        }
+
+        for (std::size_t i = 0; i != num_invocations; ++i)
+        {
+            results[i].get();
+            HPX_TEST(std::all_of(std::begin(data[i]), std::end(data[i]),
+                [](int v) { return v == 42; }));
+        }
+
+        std::size_t const invocations = fcs.get_invocations();
+        HPX_TEST_LT(std::size_t(0), invocations);
+        HPX_TEST_LTE(invocations, num_invocations);
+    }
+}
+
+void test_cache_aware_chunk_size()
+{
+    {
+        hpx::execution::experimental::cache_aware_chunk_size cacs(
+            sizeof(std::size_t));
+        parameters_test(cacs);
+
+        HPX_TEST_NEQ(cacs.get_cache_size(), std::size_t(0));
+        HPX_TEST_EQ(cacs.get_cache_resident_iterations(),
+            cacs.get_cache_size() / (2 * sizeof(std::size_t)));
+    }
+    {
+        auto cacs = hpx::execution::experimental::cache_aware_chunk_size::
+            for_types<double, double>(3, 0.25);
+        parameters_test(cacs);
+    }
+}
+
 void test_num_cores()
 {
     {
@@ -218,6 +282,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_feedback_chunk_size();
+    test_cache_aware_chunk_size();
     test_num_cores();
 
     test_combined_hooks();
@@ -13,6 +13,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/sender.hpp>
 #include <hpx/type_support/construct_at.hpp>
+#include <hpx/type_support/is_trivially_relocatable.hpp>
 
 #include <cstddef>
 #include <cstring>
@@ -59,10 +60,23 @@ namespace hpx::detail {
     }
 #endif
 
+    // Implementations stored in the sbo storages may declare that they can be
+    // relocated using memcpy by defining a static constexpr bool member
+    // 'is_trivially_relocatable'.
+    template <typename Impl, typename Enable = void>
+    inline constexpr bool is_trivially_relocatable_impl_v = false;
+
+    template <typename Impl>
+    inline constexpr bool is_trivially_relocatable_impl_v<Impl,
+        std::enable_if_t<Impl::is_trivially_relocatable>> = true;
+
     template <typename Base, std::size_t EmbeddedStorageSize,
         std::size_t AlignmentSize = sizeof(void*)>
     class movable_sbo_storage
     {
+        static_assert(EmbeddedStorageSize >= sizeof(void*),
+            "the embedded storage must be able to hold at least a pointer");
+
     protected:
         using base_type = Base;
         static constexpr std::size_t embedded_storage_size =
@@ -89,6 +103,11 @@ namespace hpx::detail {
         base_type* object =
             const_cast<base_type*>(get_empty_vtable<base_type>());
 
+        // True if the object is stored in the embedded storage and can be
+        // moved by copying the bytes of the embedded storage, i.e. without
+        // going through its virtual functions.
+        bool trivially_relocatable = false;
+
         // Returns true when it's safe to use the embedded storage, i.e.
         // when the size and alignment of Impl are small enough.
         template <typename Impl>
@@ -124,6 +143,7 @@ namespace hpx::detail {
             if (using_embedded_storage())
             {
                 get().~base_type();
+                trivially_relocatable = false;
             }
             else
             {
@@ -142,12 +162,24 @@ namespace hpx::detail {
 
             if (!other.empty())
             {
-                if (other.using_embedded_storage())
+                if (other.trivially_relocatable)
+                {
+                    // the moved-from object is not destroyed, it has been
+                    // relocated
+                    std::memcpy(&data.embedded_storage,
+                        &other.data.embedded_storage, embedded_storage_size);
+                    object =
+                        reinterpret_cast<base_type*>(&data.embedded_storage);
+                    trivially_relocatable = true;
+                    other.trivially_relocatable = false;
+                }
+                else if (other.using_embedded_storage())
                 {
                     auto p =
                         reinterpret_cast<base_type*>(&data.embedded_storage);
                     other.get().move_into(p);
                     object = p;
+                    other.get().~base_type();
                 }
                 else
                 {
@@ -216,6 +248,7 @@ namespace hpx::detail {
                 Impl* p = reinterpret_cast<Impl*>(&data.embedded_storage);
                 hpx::construct_at(p, HPX_FORWARD(Ts, ts)...);
                 object = p;
+                trivially_relocatable = is_trivially_relocatable_impl_v<Impl>;
             }
             else
             {
@@ -239,6 +272,7 @@ namespace hpx::detail {
         using storage_base_type::empty;
         using storage_base_type::object;
         using storage_base_type::release;
+        using storage_base_type::trivially_relocatable;
         using storage_base_type::using_embedded_storage;
 
         void copy_assign(copyable_sbo_storage const& other) &
@@ -254,6 +288,7 @@ namespace hpx::detail {
                         reinterpret_cast<base_type*>(&data.embedded_storage);
                     other.get().clone_into(p);
                     object = p;
+                    trivially_relocatable = other.trivially_relocatable;
                 }
                 else
                 {
@@ -433,6 +468,10 @@ namespace hpx::execution::experimental::detail {
     template <typename Receiver, typename... Ts>
     struct any_receiver_impl final : any_receiver_base<Ts...>
     {
+        static constexpr bool is_trivially_relocatable =
+            hpx::experimental::is_trivially_relocatable_v<
+                std::decay_t<Receiver>>;
+
         std::decay_t<Receiver> receiver;
 
         template <typename Receiver_,
@@ -622,6 +661,9 @@ namespace hpx::execution::experimental::detail {
     template <typename Sender, typename... Ts>
     struct unique_any_sender_impl final : unique_any_sender_base<Ts...>
     {
+        static constexpr bool is_trivially_relocatable =
+            hpx::experimental::is_trivially_relocatable_v<std::decay_t<Sender>>;
+
         std::decay_t<Sender> sender;
 
         template <typename Sender_,
@@ -647,6 +689,9 @@ namespace hpx::execution::experimental::detail {
     template <typename Sender, typename... Ts>
     struct any_sender_impl final : any_sender_base<Ts...>
     {
+        static constexpr bool is_trivially_relocatable =
+            hpx::experimental::is_trivially_relocatable_v<std::decay_t<Sender>>;
+
         std::decay_t<Sender> sender;
 
         template <typename Sender_,
@@ -712,8 +757,17 @@ namespace hpx::execution::experimental {
     }    // namespace detail
 #endif
 
-    template <typename... Ts>
-    class unique_any_sender
+    /// The default size of the embedded storage of \c unique_any_sender and
+    /// \c any_sender. Senders larger than this are allocated on the heap.
+    inline constexpr std::size_t any_sender_embedded_storage_size =
+        4 * sizeof(void*);
+
+    /// \c basic_unique_any_sender is a type-erased, move-only sender sending
+    /// the values \c Ts. Senders of at most \c EmbeddedStorageSize bytes
+    /// are stored in the object itself, larger ones are allocated on the
+    /// heap.
+    template <std::size_t EmbeddedStorageSize, typename... Ts>
+    class basic_unique_any_sender
 #if defined(HPX_MSVC) || !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
@@ -724,17 +778,17 @@ namespace hpx::execution::experimental {
         using impl_type = detail::unique_any_sender_impl<Sender, Ts...>;
 
         using storage_type =
-            hpx::detail::movable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::movable_sbo_storage<base_type, EmbeddedStorageSize>;
 
         storage_type storage{};
 
     public:
-        unique_any_sender() = default;
+        basic_unique_any_sender() = default;
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_unique_any_sender>>>
+        basic_unique_any_sender(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
@@ -742,31 +796,33 @@ namespace hpx::execution::experimental {
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender& operator=(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_unique_any_sender>>>
+        basic_unique_any_sender& operator=(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
             return *this;
         }
 
-        ~unique_any_sender() = default;
+        ~basic_unique_any_sender() = default;
 
-        unique_any_sender(unique_any_sender&&) = default;
-        unique_any_sender(unique_any_sender const&) = delete;
-        unique_any_sender& operator=(unique_any_sender&&) = default;
-        unique_any_sender& operator=(unique_any_sender const&) = delete;
+        basic_unique_any_sender(basic_unique_any_sender&&) = default;
+        basic_unique_any_sender(basic_unique_any_sender const&) = delete;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender&&) = default;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender const&) = delete;
 
         template <typename Env>
-        friend auto tag_invoke(
-            get_completion_signatures_t, unique_any_sender const&, Env) noexcept
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_unique_any_sender const&, Env) noexcept
             -> completion_signatures<set_value_t(Ts...),
                 set_error_t(std::exception_ptr)>;
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, unique_any_sender&& s,
-            R&& r)
+            hpx::execution::experimental::connect_t,
+            basic_unique_any_sender&& s, R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -779,7 +835,14 @@ namespace hpx::execution::experimental {
     };
 
     template <typename... Ts>
-    class any_sender
+    using unique_any_sender =
+        basic_unique_any_sender<any_sender_embedded_storage_size, Ts...>;
+
+    /// \c basic_any_sender is a type-erased, copyable sender sending the
+    /// values \c Ts. Senders of at most \c EmbeddedStorageSize bytes are
+    /// stored in the object itself, larger ones are allocated on the heap.
+    template <std::size_t EmbeddedStorageSize, typename... Ts>
+    class basic_any_sender
 #if defined(HPX_MSVC) || !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
@@ -790,17 +853,17 @@ namespace hpx::execution::experimental {
         using impl_type = detail::any_sender_impl<Sender, Ts...>;
 
         using storage_type =
-            hpx::detail::copyable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::copyable_sbo_storage<base_type, EmbeddedStorageSize>;
 
         storage_type storage{};
 
     public:
-        any_sender() = default;
+        basic_any_sender() = default;
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -813,8 +876,8 @@ namespace hpx::execution::experimental {
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender& operator=(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender& operator=(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -826,21 +889,22 @@ namespace hpx::execution::experimental {
             return *this;
         }
 
-        ~any_sender() = default;
+        ~basic_any_sender() = default;
 
-        any_sender(any_sender&&) = default;
-        any_sender(any_sender const&) = default;
-        any_sender& operator=(any_sender&&) = default;
-        any_sender& operator=(any_sender const&) = default;
+        basic_any_sender(basic_any_sender&&) = default;
+        basic_any_sender(basic_any_sender const&) = default;
+        basic_any_sender& operator=(basic_any_sender&&) = default;
+        basic_any_sender& operator=(basic_any_sender const&) = default;
 
         template <typename Env>
-        friend auto tag_invoke(get_completion_signatures_t, any_sender const&,
-            Env) noexcept -> completion_signatures<set_value_t(Ts...),
-            set_error_t(std::exception_ptr)>;
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_any_sender const&, Env) noexcept
+            -> completion_signatures<set_value_t(Ts...),
+                set_error_t(std::exception_ptr)>;
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender& s, R&& r)
+            hpx::execution::experimental::connect_t, basic_any_sender& s, R&& r)
         {
             return s.storage.get().connect(
                 detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
@@ -848,7 +912,8 @@ namespace hpx::execution::experimental {
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender&& s, R&& r)
+            hpx::execution::experimental::connect_t, basic_any_sender&& s,
+            R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -859,6 +924,10 @@ namespace hpx::execution::experimental {
                 .connect(detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
         }
     };
+
+    template <typename... Ts>
+    using any_sender =
+        basic_any_sender<any_sender_embedded_storage_size, Ts...>;
 }    // namespace hpx::execution::experimental
 
 namespace hpx::detail {
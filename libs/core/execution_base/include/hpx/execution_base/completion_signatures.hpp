@@ -1103,7 +1103,13 @@ namespace hpx::execution::experimental {
             hpx::is_nothrow_invocable_v<select_impl_t<T, Promise>>)
             -> hpx::util::invoke_result_t<select_impl_t<T, Promise>>
         {
-            if constexpr (detail::is_awaitable_sender_v<T, Promise>)
+            // awaitables are senders as well, make sure to select the same
+            // alternative as select_impl
+            if constexpr (is_awaitable_v<T>)
+            {
+                return HPX_FORWARD(T, t);
+            }
+            else if constexpr (detail::is_awaitable_sender_v<T, Promise>)
             {
                 auto hcoro =
                     hpx::coroutine_handle<Promise>::from_promise(promise);
@@ -12,6 +12,7 @@
 #include "algorithm_test_utils.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
 #include <string>
 #include <utility>
@@ -201,6 +202,35 @@ struct large_sender : sender<Ts...>
     large_sender& operator=(large_sender const&) = default;
 };
 
+std::atomic<int> counted_sender_instances{0};
+
+template <typename... Ts>
+struct counted_sender : sender<Ts...>
+{
+    explicit counted_sender(Ts... ts)
+      : sender<Ts...>(std::move(ts)...)
+    {
+        ++counted_sender_instances;
+    }
+    counted_sender(counted_sender&& rhs)
+      : sender<Ts...>(static_cast<sender<Ts...>&&>(rhs))
+    {
+        ++counted_sender_instances;
+    }
+    counted_sender(counted_sender const& rhs)
+      : sender<Ts...>(static_cast<sender<Ts...> const&>(rhs))
+    {
+        ++counted_sender_instances;
+    }
+    counted_sender& operator=(counted_sender&&) = default;
+    counted_sender& operator=(counted_sender const&) = default;
+
+    ~counted_sender()
+    {
+        --counted_sender_instances;
+    }
+};
+
 struct error_receiver
 {
     std::atomic<bool>& set_error_called;
@@ -513,6 +543,64 @@ void test_unique_any_sender_set_error()
     }
 }
 
+void test_any_sender_embedded_storage()
+{
+    auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+
+    // senders larger than the default embedded storage can be stored in a
+    // larger embedded storage
+    {
+        constexpr std::size_t size = sizeof(large_sender<int>) + sizeof(void*);
+        ex::basic_any_sender<size, int> as1{large_sender<int>{42}};
+        auto as2 = as1;
+        auto as3 = std::move(as1);
+
+        static_assert(ex::is_sender_v<decltype(as2)>);
+
+        std::atomic<bool> set_value_called{false};
+        auto os2 = ex::connect(
+            as2, callback_receiver<decltype(f)>{f, set_value_called});
+        ex::start(os2);
+        HPX_TEST(set_value_called);
+
+        set_value_called = false;
+        auto os3 = ex::connect(std::move(as3),
+            callback_receiver<decltype(f)>{f, set_value_called});
+        ex::start(os3);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        constexpr std::size_t size =
+            sizeof(large_non_copyable_sender<int>) + sizeof(void*);
+        ex::basic_unique_any_sender<size, int> as1{
+            large_non_copyable_sender<int>{42}};
+        auto as2 = std::move(as1);
+
+        std::atomic<bool> set_value_called{false};
+        auto os = ex::connect(std::move(as2),
+            callback_receiver<decltype(f)>{f, set_value_called});
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    // moving a type-erased sender destroys the moved-from sender
+    {
+        {
+            ex::unique_any_sender<int> as1{counted_sender<int>{42}};
+            auto as2 = std::move(as1);
+            auto as3 = std::move(as2);
+            HPX_TEST_EQ(counted_sender_instances.load(), 1);
+
+            ex::any_sender<int> as4{counted_sender<int>{42}};
+            auto as5 = as4;
+            auto as6 = std::move(as4);
+            HPX_TEST_EQ(counted_sender_instances.load(), 3);
+        }
+        HPX_TEST_EQ(counted_sender_instances.load(), 0);
+    }
+}
+
 // This tests that the empty vtable types used in the implementation of any_*
 // are not destroyed too early. We use ensure_started inside the function to
 // trigger the use of the empty vtables for any_receiver and
@@ -612,6 +700,9 @@ int main()
     test_any_sender_set_error();
     test_unique_any_sender_set_error();
 
+    // Custom embedded storage sizes and moving type-erased senders
+    test_any_sender_embedded_storage();
+
     // Test use of *any_* in globals
     test_globals();
 
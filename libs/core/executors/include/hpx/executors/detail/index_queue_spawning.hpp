@@ -20,6 +20,7 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/executors/detail/hierarchical_spawning.hpp>
+#include <hpx/executors/detail/numa_domains.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/iterator_support/range.hpp>
@@ -27,6 +28,7 @@
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/pack.hpp>
 
 #include <algorithm>
@@ -34,6 +36,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -101,24 +104,56 @@ namespace hpx::parallel::execution::detail {
                 do_work_chunk(f, ts, *index);
             }
 
-            if (allow_stealing)
+            if (!allow_stealing)
             {
-                // Then steal from the opposite end of the neighboring queues
-                static constexpr auto opposite_end =
-                    hpx::concurrency::detail::opposite_end_v<Which>;
+                return;
+            }
+
+            // Then steal from the opposite end of the neighboring queues
+            static constexpr auto opposite_end =
+                hpx::concurrency::detail::opposite_end_v<Which>;
+
+            auto steal_from = [&](std::size_t neighbor_thread) {
+                auto& neighbor_queue = state->queues[neighbor_thread].data_;
+                while ((index = neighbor_queue.template pop<opposite_end>()))
+                {
+                    do_work_chunk(f, ts, *index);
+                }
+            };
 
+            numa_domains const* domains = state->domains.get();
+            if (domains == nullptr)
+            {
                 for (std::uint32_t offset = 1; offset != state->num_threads;
                      ++offset)
                 {
-                    std::size_t neighbor_thread =
-                        (worker_thread + offset) % state->num_threads;
-                    auto& neighbor_queue = state->queues[neighbor_thread].data_;
+                    steal_from((worker_thread + offset) % state->num_threads);
+                }
+                return;
+            }
 
-                    while (
-                        (index = neighbor_queue.template pop<opposite_end>()))
-                    {
-                        do_work_chunk(f, ts, *index);
-                    }
+            // The worker threads span several NUMA domains: steal from the
+            // queues of the own domain first, then from the queues of the
+            // other domains.
+            std::uint32_t const position = domains->positions[worker_thread];
+            std::uint32_t const num_domains = domains->num_domains();
+
+            std::uint32_t const domain = domains->domain_of(position);
+
+            for (std::uint32_t d = 0; d != num_domains; ++d)
+            {
+                std::uint32_t const current = (domain + d) % num_domains;
+                std::uint32_t const begin = domains->offsets[current];
+                std::uint32_t const count =
+                    domains->offsets[current + 1] - begin;
+
+                // start with the neighbor of this worker in its own domain
+                std::uint32_t const start = d == 0 ? position - begin : 0;
+                for (std::uint32_t offset = d == 0 ? 1 : 0; offset != count;
+                     ++offset)
+                {
+                    steal_from(
+                        domains->workers[begin + (start + offset) % count]);
                 }
             }
         }
@@ -298,22 +333,13 @@ namespace hpx::parallel::execution::detail {
                 part_begin, part_end, static_cast<std::uint32_t>(num_threads));
         }
 
-        // Spawn a task which will process a number of chunks. If the queue
-        // contains no chunks no task will be spawned.
+        // Post a task to the given worker thread (unless a different hint was
+        // given).
         template <typename Task>
-        void do_work_task(hpx::threads::thread_description const& desc,
+        void post_task(hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, bool dont_bind_to_core,
-            Task&& task_f) const
+            std::uint32_t const worker_thread, Task&& task_f) const
         {
-            std::uint32_t const worker_thread = task_f.worker_thread;
-            if (queues[worker_thread].data_.empty())
-            {
-                // If the queue is empty we don't spawn a task. We only signal
-                // that this "task" is ready.
-                task_f.finish();
-                return;
-            }
-
             // run task on small stack
             auto post_policy = hpx::execution::experimental::with_stacksize(
                 policy, threads::thread_stacksize::small_);
@@ -352,6 +378,106 @@ namespace hpx::parallel::execution::detail {
             }
         }
 
+        // Spawn a task which will process a number of chunks. If the queue
+        // contains no chunks no task will be spawned.
+        template <typename Task>
+        void do_work_task(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, bool dont_bind_to_core,
+            Task&& task_f) const
+        {
+            std::uint32_t const worker_thread = task_f.worker_thread;
+            if (queues[worker_thread].data_.empty())
+            {
+                // If the queue is empty we don't spawn a task. We only signal
+                // that this "task" is ready.
+                task_f.finish();
+                return;
+            }
+
+            post_task(desc, pool, dont_bind_to_core, worker_thread,
+                HPX_FORWARD(Task, task_f));
+        }
+
+        // Spawn the tasks for the worker threads of one NUMA domain, this is
+        // run on the first worker thread of the domain. The queue of that
+        // worker thread is handled inline.
+        void spawn_domain(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, std::uint32_t const domain,
+            std::uint32_t const chunk_size, bool reverse_placement,
+            bool allow_stealing)
+        {
+            auto const size =
+                static_cast<std::uint32_t>(hpx::util::size(shape));
+
+            std::uint32_t const begin = domains->offsets[domain];
+            std::uint32_t const end = domains->offsets[domain + 1];
+            for (std::uint32_t i = begin + 1; i != end; ++i)
+            {
+                task_function<index_queue_bulk_state> task_f{
+                    hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
+                    chunk_size, domains->workers[i], reverse_placement,
+                    allow_stealing};
+                try
+                {
+                    do_work_task(desc, pool, false,
+                        task_function<index_queue_bulk_state>(task_f));
+                }
+                catch (std::bad_alloc const&)
+                {
+                    // the chunks of the worker thread are left for the
+                    // other worker threads to steal
+                    bad_alloc_thrown = true;
+                    task_f.finish();
+                }
+                catch (...)
+                {
+                    task_f.store_exception(std::current_exception());
+                    task_f.finish();
+                }
+            }
+
+            task_function<index_queue_bulk_state>{
+                hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
+                chunk_size, domains->workers[begin], reverse_placement,
+                allow_stealing}();
+        }
+
+        // Spawn one task per NUMA domain which in turn spawns the tasks for
+        // the worker threads of its domain. This keeps the number of tasks
+        // created by the calling thread (and the number of tasks it creates
+        // on remote domains) as small as possible.
+        void execute_numa(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, std::uint32_t const chunk_size,
+            bool reverse_placement, bool allow_stealing)
+        {
+            std::uint32_t const num_domains = domains->num_domains();
+
+            // spawn the task for the domain of the calling thread last, this
+            // gives the remote domains a head start
+            std::uint32_t local_domain = num_domains;
+            auto const local_worker_thread = hpx::get_local_worker_thread_num();
+            if (local_worker_thread >= first_thread &&
+                local_worker_thread < first_thread + num_threads)
+            {
+                local_domain = domains->domain_of(domains->positions[
+                    local_worker_thread - first_thread]);    //-V104
+            }
+
+            for (std::uint32_t i = 1; i <= num_domains; ++i)
+            {
+                std::uint32_t const domain =
+                    (local_domain + i) % num_domains;
+                post_task(desc, pool, domain == local_domain,
+                    domains->workers[domains->offsets[domain]],
+                    [state = hpx::intrusive_ptr<index_queue_bulk_state>(this),
+                        desc, pool, domain, chunk_size, reverse_placement,
+                        allow_stealing]() {
+                        state->spawn_domain(desc, pool, domain, chunk_size,
+                            reverse_placement, allow_stealing);
+                    });
+            }
+        }
+
     public:
         template <typename F_, typename... Ts_>
         index_queue_bulk_state(std::size_t first_thread,
@@ -416,6 +542,27 @@ namespace hpx::parallel::execution::detail {
                 }
             }
 
+            bool reverse_placement =
+                hint.placement_mode() == placement::depth_first_reverse ||
+                hint.placement_mode() == placement::breadth_first_reverse;
+            bool allow_stealing =
+                !hpx::threads::do_not_share_function(hint.sharing_mode());
+
+            // Use two-level spawning if the worker threads span more than one
+            // NUMA domain.
+            if (num_threads > 1)
+            {
+                domains = get_numa_domains(
+                    pool, first_thread, num_threads, pu_mask);
+            }
+
+            if (domains)
+            {
+                execute_numa(desc, pool, chunk_size, reverse_placement,
+                    allow_stealing);
+                return;
+            }
+
             // Spawn the worker threads for all except the local queue.
             auto local_worker_thread =
                 static_cast<std::uint32_t>(hpx::get_local_worker_thread_num());
@@ -433,12 +580,6 @@ namespace hpx::parallel::execution::detail {
                     local_worker_thread + first_thread);    //-V106
             }
 
-            bool reverse_placement =
-                hint.placement_mode() == placement::depth_first_reverse ||
-                hint.placement_mode() == placement::breadth_first_reverse;
-            bool allow_stealing =
-                !hpx::threads::do_not_share_function(hint.sharing_mode());
-
             for (std::uint32_t pu = 0;
                  worker_thread != num_threads && pu != num_pus; ++pu)
             {
@@ -509,6 +650,10 @@ namespace hpx::parallel::execution::detail {
             queues;
         hpx::util::cache_aligned_data<std::atomic<std::size_t>> tasks_remaining;
 
+        // The worker threads grouped by NUMA domain, this is empty if all
+        // worker threads belong to the same domain.
+        std::shared_ptr<numa_domains const> domains;
+
         std::atomic<bool> bad_alloc_thrown{false};
         hpx::exception_list exceptions;
     };
@@ -0,0 +1,65 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hpx::parallel::execution::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The worker threads of a bulk operation grouped by NUMA domain: the
+    // workers of domain d are workers[offsets[d]] to workers[offsets[d + 1] -
+    // 1], positions holds the index of every worker thread in workers.
+    struct numa_domains
+    {
+        [[nodiscard]] std::uint32_t num_domains() const noexcept
+        {
+            return static_cast<std::uint32_t>(offsets.size() - 1);
+        }
+
+        // Return the NUMA domain of the worker thread at the given position
+        // in workers.
+        [[nodiscard]] std::uint32_t domain_of(
+            std::uint32_t const position) const noexcept
+        {
+            std::uint32_t domain = 0;
+            while (offsets[domain + 1] <= position)
+            {
+                ++domain;
+            }
+            return domain;
+        }
+
+        std::vector<std::uint32_t> workers;
+        std::vector<std::uint32_t> offsets;
+        std::vector<std::uint32_t> positions;
+    };
+
+    // Group the worker threads first_thread to first_thread + num_threads - 1
+    // (running on the processing units in pu_mask) of the given pool by the
+    // NUMA domain of the processing unit they run on. Returns an empty
+    // pointer if all of them belong to the same domain. The grouping is
+    // computed once per pool and PU mask (by every OS thread).
+    HPX_CORE_EXPORT std::shared_ptr<numa_domains const> get_numa_domains(
+        threads::thread_pool_base const* pool, std::size_t first_thread,
+        std::size_t num_threads, hpx::threads::mask_cref_type pu_mask);
+
+    // Replace the function returning the NUMA domain of a processing unit
+    // (used for testing), an empty function restores the default which
+    // queries the topology.
+    using numa_domain_of_pu_type = hpx::function<std::size_t(std::size_t)>;
+
+    HPX_CORE_EXPORT void set_numa_domain_of_pu(numa_domain_of_pu_type f);
+}    // namespace hpx::parallel::execution::detail
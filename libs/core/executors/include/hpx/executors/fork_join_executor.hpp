@@ -30,16 +30,19 @@
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/topology.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/synchronization/combining_tree_barrier.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -64,17 +67,45 @@ namespace hpx::execution::experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// If the worker threads span more than one NUMA domain, the start of a
+    /// parallel region is signaled by the calling thread only to the worker
+    /// threads of its own domain and to one thread (the leader) of every other
+    /// domain, which in turn signals the threads of its domain. Similarly,
+    /// the leaders wait for the threads of their domain to finish and signal
+    /// the completion of the whole domain to the calling thread (unless the
+    /// tree barrier is used). Idle worker threads spin first, then yield to
+    /// other work after the yield delay, and finally park (sleep for
+    /// increasing durations) if no new work arrives for a considerably longer
+    /// time.
     class fork_join_executor
     {
     public:
         /// Type of loop schedule for use with the fork_join_executor.
         /// loop_schedule::static_ implies no work-stealing;
         /// loop_schedule::dynamic allows stealing when a worker has finished
-        /// its local work.
+        /// its local work;
+        /// loop_schedule::work_stealing steals half of the remaining work of
+        /// another worker at once (which can in turn be stolen by other
+        /// workers), which is better suited for irregular loops.
+        /// The workers steal from the workers of their own NUMA domain first.
         enum class loop_schedule
         {
             static_,
             dynamic,
+            work_stealing,
+        };
+
+        /// Type of the barrier used for waiting for all worker threads to
+        /// finish a parallel region. barrier_type::flat lets the calling
+        /// thread poll the state of each worker thread; barrier_type::tree
+        /// combines the arrivals of the worker threads in a tree that
+        /// follows the order of their PUs (see hpx::combining_tree_barrier),
+        /// which scales better for large numbers of worker threads.
+        enum class barrier_type
+        {
+            flat,
+            tree,
         };
 
         /// \cond NOINTERNAL
@@ -124,6 +155,12 @@ namespace hpx::execution::experimental {
                 void const* shape_;
                 void* argument_pack_;
                 void* results_;
+
+                // The order in which the other threads are visited when
+                // stealing work, nullptr if the threads are visited in the
+                // order of their indices. This does not change between
+                // parallel regions.
+                std::uint32_t const* steal_order_ = nullptr;
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -136,6 +173,24 @@ namespace hpx::execution::experimental {
                 using base_type::base_type;
             };
 
+            // Members used if the worker threads span more than one NUMA
+            // domain.
+            struct domain_data
+            {
+                // the state of the whole domain, idle once all threads of the
+                // domain have finished the current parallel region
+                std::atomic<thread_state> state_;
+
+                // the thread signaling the other threads of the domain
+                std::size_t leader_ = 0;
+
+                // all threads of the domain (including the leader)
+                std::vector<std::size_t> threads_;
+            };
+
+            using domains_type =
+                std::vector<hpx::util::cache_aligned_data<domain_data>>;
+
             // Members that are used for all parallel regions executed through
             // this executor.
             threads::thread_pool_base* pool_ = nullptr;
@@ -144,7 +199,9 @@ namespace hpx::execution::experimental {
             threads::thread_stacksize stacksize_ =
                 threads::thread_stacksize::small_;
             loop_schedule schedule_ = loop_schedule::static_;
+            barrier_type barrier_ = barrier_type::flat;
             std::uint64_t yield_delay_;
+            std::uint64_t park_delay_;
 
             std::size_t main_thread_;
             std::size_t num_threads_;
@@ -158,13 +215,48 @@ namespace hpx::execution::experimental {
             // The current queues for each worker HPX thread.
             queues_type queues_;
 
+            // The NUMA domains of the worker threads, empty if all of them
+            // belong to the same domain.
+            domains_type domains_;
+            std::vector<std::size_t> thread_domains_;
+            std::size_t main_domain_ = 0;
+            std::vector<std::uint32_t> steal_orders_;
+
+            // The barrier all threads arrive at after finishing a parallel
+            // region, only used for barrier_type::tree.
+            std::unique_ptr<hpx::combining_tree_barrier> join_barrier_;
+
             // executor properties
             char const* annotation_ = nullptr;
 
+            // the minimal time after which idle worker threads park
+            static constexpr std::chrono::milliseconds min_park_delay{100};
+
+            // the maximal time a parked worker thread sleeps
+            static constexpr std::chrono::microseconds max_park_time{1000};
+
+            static std::uint64_t get_park_delay(std::uint64_t yield_delay,
+                double timestamp_scale) noexcept
+            {
+                // park after a hundred times the yield delay
+                auto const min_delay = static_cast<std::uint64_t>(
+                    static_cast<double>(
+                        std::chrono::nanoseconds(min_park_delay).count()) /
+                    timestamp_scale);
+                if (yield_delay > (std::numeric_limits<std::uint64_t>::max)() /
+                        100)
+                {
+                    return (std::numeric_limits<std::uint64_t>::max)();
+                }
+                return (std::max)(100 * yield_delay, min_delay);
+            }
+
             template <typename Op>
             static thread_state wait_state_this_thread_while(
                 std::atomic<thread_state> const& tstate, thread_state state,
-                std::uint64_t yield_delay, Op&& op)
+                std::uint64_t yield_delay, Op&& op,
+                std::uint64_t park_delay =
+                    (std::numeric_limits<std::uint64_t>::max)())
             {
                 auto current = tstate.load(std::memory_order_acquire);
                 if (HPX_UNLIKELY(op(current, state)))
@@ -172,6 +264,8 @@ namespace hpx::execution::experimental {
                     HPX_SMT_PAUSE;
 
                     std::uint64_t const base_time = util::hardware::timestamp();
+                    std::chrono::microseconds park_time(10);
+
                     current = tstate.load(std::memory_order_acquire);
                     while (HPX_LIKELY(op(current, state)))
                     {
@@ -186,8 +280,15 @@ namespace hpx::execution::experimental {
                             }
                         }
 
-                        if (HPX_UNLIKELY((util::hardware::timestamp() -
-                                             base_time) > yield_delay))
+                        std::uint64_t const elapsed =
+                            util::hardware::timestamp() - base_time;
+                        if (HPX_UNLIKELY(elapsed > park_delay))
+                        {
+                            hpx::this_thread::sleep_for(park_time);
+                            park_time = (std::min)(2 * park_time,
+                                std::chrono::microseconds(max_park_time));
+                        }
+                        else if (HPX_UNLIKELY(elapsed > yield_delay))
                         {
                             hpx::this_thread::yield();
                         }
@@ -216,11 +317,32 @@ namespace hpx::execution::experimental {
                 hpx::spinlock& exception_mutex_;
                 std::exception_ptr& exception_;
                 std::uint64_t yield_delay_;
+                std::uint64_t park_delay_;
 
                 // Changing data for each parallel region.
                 region_data_type& region_data_;
                 queues_type& queues_;
 
+                hpx::combining_tree_barrier* join_barrier_;
+
+                // The NUMA domains of the worker threads (these are
+                // initialized after the worker threads have been created).
+                domains_type& domains_;
+                std::vector<std::size_t> const& thread_domains_;
+
+                // Return the domain this thread is the leader of, if any.
+                domain_data* leader_domain() const noexcept
+                {
+                    if (domains_.empty())
+                    {
+                        return nullptr;
+                    }
+
+                    domain_data& domain =
+                        domains_[thread_domains_[thread_index_]].data_;
+                    return domain.leader_ == thread_index_ ? &domain : nullptr;
+                }
+
                 void set_state_this_thread(thread_state state) const noexcept
                 {
                     region_data_[thread_index_].data_.state_.store(
@@ -244,18 +366,52 @@ namespace hpx::execution::experimental {
                     // wait as long the state is 'idle'
                     auto state = shared_data::wait_state_this_thread_while(
                         data.state_, thread_state::idle, yield_delay_,
-                        std::equal_to<>());
+                        std::equal_to<>(), park_delay_);
 
+                    domain_data* const domain = leader_domain();
                     while (HPX_LIKELY(state != thread_state::stopping))
                     {
+                        // signal the other threads of the domain
+                        if (domain != nullptr)
+                        {
+                            for (std::size_t const t : domain->threads_)
+                            {
+                                if (t != thread_index_)
+                                {
+                                    copy_region_data(
+                                        region_data_[t].data_, data, state);
+                                }
+                            }
+                        }
+
                         data.thread_function_helper_(region_data_,
                             thread_index_, num_threads_, queues_,
                             exception_mutex_, exception_);
 
+                        if (join_barrier_ != nullptr)
+                        {
+                            [[maybe_unused]] auto const token =
+                                join_barrier_->arrive(thread_index_);
+                        }
+                        else if (domain != nullptr)
+                        {
+                            // wait for the other threads of the domain to
+                            // finish, then signal the completion of the domain
+                            for (std::size_t const t : domain->threads_)
+                            {
+                                shared_data::wait_state_this_thread_while(
+                                    region_data_[t].data_.state_,
+                                    thread_state::idle, yield_delay_,
+                                    std::not_equal_to<>());
+                            }
+                            domain->state_.store(
+                                thread_state::idle, std::memory_order_release);
+                        }
+
                         // wait as long the state is 'idle'
                         state = shared_data::wait_state_this_thread_while(
                             data.state_, thread_state::idle, yield_delay_,
-                            std::equal_to<>());
+                            std::equal_to<>(), park_delay_);
                     }
 
                     HPX_ASSERT(
@@ -264,6 +420,66 @@ namespace hpx::execution::experimental {
                 }
             };
 
+            static void copy_region_data(region_data& data,
+                region_data const& source, thread_state state) noexcept
+            {
+                data.element_function_ = source.element_function_;
+                data.shape_ = source.shape_;
+                data.argument_pack_ = source.argument_pack_;
+                data.thread_function_helper_ = source.thread_function_helper_;
+                data.results_ = source.results_;
+
+                data.state_.store(state, std::memory_order_release);
+            }
+
+            // Signal the start of a parallel region to the worker threads. If
+            // the worker threads span more than one NUMA domain only the
+            // threads of the domain of the main thread and the leaders of the
+            // other domains are signaled directly.
+            void start_region(
+                region_data const& source, thread_state state) noexcept
+            {
+                if (domains_.empty())
+                {
+                    for (std::size_t t = 0; t != num_threads_; ++t)
+                    {
+                        copy_region_data(region_data_[t].data_, source, state);
+                    }
+                    return;
+                }
+
+                // signal the remote domains first to give them a head start
+                for (std::size_t d = 0; d != domains_.size(); ++d)
+                {
+                    if (d != main_domain_)
+                    {
+                        domain_data& domain = domains_[d].data_;
+                        domain.state_.store(state, std::memory_order_relaxed);
+                        copy_region_data(
+                            region_data_[domain.leader_].data_, source, state);
+                    }
+                }
+
+                for (std::size_t const t :
+                    domains_[main_domain_].data_.threads_)
+                {
+                    copy_region_data(region_data_[t].data_, source, state);
+                }
+            }
+
+            // Return the index of the thread to steal from for the given
+            // offset (between 1 and num_threads - 1).
+            static std::size_t get_victim(region_data const& data,
+                std::size_t thread_index, std::size_t offset,
+                std::size_t num_threads) noexcept
+            {
+                if (data.steal_order_ != nullptr)
+                {
+                    return data.steal_order_[offset - 1];
+                }
+                return (thread_index + offset) % num_threads;
+            }
+
             void set_state_main_thread(thread_state state) noexcept
             {
                 region_data_[main_thread_].data_.state_.store(
@@ -312,7 +528,7 @@ namespace hpx::execution::experimental {
 
                 // the array of queues is needed only if work-stealing was
                 // enabled
-                if (schedule_ == loop_schedule::dynamic)
+                if (schedule_ != loop_schedule::static_)
                 {
                     queues_.resize(num_threads_);
                 }
@@ -381,7 +597,9 @@ namespace hpx::execution::experimental {
                             launch::async_policy>::call(policy, desc, pool_,
                             thread_function{num_threads_, t, schedule_,
                                 exception_mutex_, exception_, yield_delay_,
-                                region_data_, queues_});
+                                park_delay_, region_data_, queues_,
+                                join_barrier_.get(), domains_,
+                                thread_domains_});
 
                         ++t;
                     }
@@ -394,9 +612,186 @@ namespace hpx::execution::experimental {
                 // the PU-mask
                 HPX_ASSERT(t == num_threads_);
 
+                init_numa_domains(main_pu_num);
+
                 wait_state_all(thread_state::idle);
             }
 
+            // Group the worker threads by NUMA domain, if they span more than
+            // one domain.
+            void init_numa_domains(std::size_t main_pu_num)
+            {
+                if (num_threads_ == 1)
+                {
+                    return;
+                }
+
+                auto const& rp = hpx::resource::get_partitioner();
+                auto const& topo = rp.get_topology();
+
+                // the worker threads are placed on the worker thread with
+                // the same index (see init_threads)
+                std::vector<std::size_t> numa_nodes(num_threads_);
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    numa_nodes[t] = topo.get_numa_node_number(
+                        t == main_thread_ ? main_pu_num : rp.get_pu_num(t));
+                }
+
+                std::vector<std::size_t> distinct(numa_nodes);
+                std::sort(distinct.begin(), distinct.end());
+                distinct.erase(std::unique(distinct.begin(), distinct.end()),
+                    distinct.end());
+                if (distinct.size() <= 1)
+                {
+                    return;
+                }
+
+                domains_type domains(distinct.size());
+                thread_domains_.resize(num_threads_);
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    auto const d = static_cast<std::size_t>(
+                        std::lower_bound(distinct.begin(), distinct.end(),
+                            numa_nodes[t]) -
+                        distinct.begin());
+                    thread_domains_[t] = d;
+
+                    domain_data& domain = domains[d].data_;
+                    if (domain.threads_.empty())
+                    {
+                        domain.leader_ = t;
+                    }
+                    domain.threads_.push_back(t);
+                }
+
+                // the main thread signals the threads of its own domain
+                main_domain_ = thread_domains_[main_thread_];
+                domains[main_domain_].data_.leader_ = main_thread_;
+
+                for (auto& domain : domains)
+                {
+                    domain.data_.state_.store(
+                        thread_state::idle, std::memory_order_relaxed);
+                }
+                domains_.swap(domains);
+
+                if (schedule_ != loop_schedule::static_)
+                {
+                    init_steal_orders();
+                }
+            }
+
+            // Let every thread steal from the threads of its own domain first,
+            // then from the threads of the other domains.
+            void init_steal_orders()
+            {
+                std::size_t const num_victims = num_threads_ - 1;
+                steal_orders_.resize(num_threads_ * num_victims);
+
+                std::size_t const num_domains = domains_.size();
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    std::uint32_t* order = &steal_orders_[t * num_victims];
+
+                    std::size_t const d = thread_domains_[t];
+                    auto const& own = domains_[d].data_.threads_;
+                    auto const position = static_cast<std::size_t>(
+                        std::find(own.begin(), own.end(), t) - own.begin());
+                    for (std::size_t i = 1; i != own.size(); ++i)
+                    {
+                        *order++ = static_cast<std::uint32_t>(
+                            own[(position + i) % own.size()]);
+                    }
+
+                    for (std::size_t i = 1; i != num_domains; ++i)
+                    {
+                        for (std::size_t const victim :
+                            domains_[(d + i) % num_domains].data_.threads_)
+                        {
+                            *order++ = static_cast<std::uint32_t>(victim);
+                        }
+                    }
+
+                    region_data_[t].data_.steal_order_ =
+                        &steal_orders_[t * num_victims];
+                }
+            }
+
+            void init_join_barrier()
+            {
+                if (barrier_ == barrier_type::tree && num_threads_ > 1)
+                {
+                    join_barrier_ =
+                        std::make_unique<hpx::combining_tree_barrier>(
+                            num_threads_);
+                }
+            }
+
+            // Wait for all threads to finish their work assigned to them in
+            // the current parallel region, the main thread has finished its
+            // work already.
+            void join_region() const
+            {
+                if (!join_barrier_)
+                {
+                    if (domains_.empty())
+                    {
+                        wait_state_all(thread_state::idle);
+                        return;
+                    }
+
+                    // wait for the threads of the own domain and for the
+                    // leaders of the other domains to signal that their
+                    // domain has finished
+                    for (std::size_t const t :
+                        domains_[main_domain_].data_.threads_)
+                    {
+                        if (t != main_thread_)
+                        {
+                            wait_state_this_thread_while(
+                                region_data_[t].data_.state_,
+                                thread_state::idle, yield_delay_,
+                                std::not_equal_to<>());
+                        }
+                    }
+
+                    for (std::size_t d = 0; d != domains_.size(); ++d)
+                    {
+                        if (d != main_domain_)
+                        {
+                            wait_state_this_thread_while(
+                                domains_[d].data_.state_, thread_state::idle,
+                                yield_delay_, std::not_equal_to<>());
+                        }
+                    }
+                    return;
+                }
+
+                auto const token = join_barrier_->arrive(main_thread_);
+                if (HPX_UNLIKELY(!join_barrier_->try_wait(token)))
+                {
+                    std::uint64_t const base_time = util::hardware::timestamp();
+                    while (HPX_LIKELY(!join_barrier_->try_wait(token)))
+                    {
+                        for (int i = 0; i < 128; ++i)
+                        {
+                            HPX_SMT_PAUSE;
+                            if (HPX_UNLIKELY(join_barrier_->try_wait(token)))
+                            {
+                                return;
+                            }
+                        }
+
+                        if (HPX_UNLIKELY((util::hardware::timestamp() -
+                                             base_time) > yield_delay_))
+                        {
+                            hpx::this_thread::yield();
+                        }
+                    }
+                }
+            }
+
             static constexpr void init_local_work_queue(queue_type& queue,
                 std::size_t thread_index, std::size_t num_threads,
                 std::size_t size) noexcept
@@ -425,32 +820,39 @@ namespace hpx::execution::experimental {
             /// \cond NOINTERNAL
             explicit shared_data(threads::thread_priority priority,
                 threads::thread_stacksize stacksize, loop_schedule schedule,
-                std::chrono::nanoseconds yield_delay)
+                std::chrono::nanoseconds yield_delay, barrier_type barrier)
               : pool_(this_thread::get_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(schedule)
+              , barrier_(barrier)
               , yield_delay_(static_cast<std::uint64_t>(
                     yield_delay.count() / pool_->timestamp_scale()))
+              , park_delay_(
+                    get_park_delay(yield_delay_, pool_->timestamp_scale()))
               , num_threads_(pool_->get_os_thread_count())
               , pu_mask_(full_mask(num_threads_))
               , region_data_(num_threads_)
             {
                 HPX_ASSERT(pool_);
 
+                init_join_barrier();
                 init_threads();
             }
 
             explicit shared_data(threads::thread_priority priority,
                 threads::thread_stacksize stacksize, loop_schedule schedule,
-                std::chrono::nanoseconds yield_delay,
+                std::chrono::nanoseconds yield_delay, barrier_type barrier,
                 hpx::threads::mask_cref_type pu_mask)
               : pool_(this_thread::get_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(schedule)
+              , barrier_(barrier)
               , yield_delay_(static_cast<std::uint64_t>(
                     yield_delay.count() / pool_->timestamp_scale()))
+              , park_delay_(
+                    get_park_delay(yield_delay_, pool_->timestamp_scale()))
               , num_threads_(hpx::threads::count(pu_mask))
               , pu_mask_(pu_mask)
               , region_data_(num_threads_)
@@ -466,6 +868,7 @@ namespace hpx::execution::experimental {
                         pu_mask, pool_ ? pool_->get_os_thread_count() : -1);
                 }
 
+                init_join_barrier();
                 init_threads();
             }
 
@@ -485,7 +888,7 @@ namespace hpx::execution::experimental {
             {
                 return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
                     stacksize_ == rhs.stacksize_ &&
-                    schedule_ == rhs.schedule_ &&
+                    schedule_ == rhs.schedule_ && barrier_ == rhs.barrier_ &&
                     yield_delay_ == rhs.yield_delay_ &&
                     pu_mask_ == rhs.pu_mask_;
             }
@@ -637,7 +1040,8 @@ namespace hpx::execution::experimental {
                                  ++offset)
                             {
                                 std::size_t const neighbor_index =
-                                    (thread_index + offset) % num_threads;
+                                    get_victim(data, thread_index, offset,
+                                        num_threads);
 
                                 if (rdata[neighbor_index].data_.state_.load(
                                         std::memory_order_acquire) !=
@@ -682,6 +1086,103 @@ namespace hpx::execution::experimental {
 
                     set_state(data.state_, thread_state::idle);
                 }
+
+                // Main entry point for a single parallel region (work-stealing
+                // scheduling).
+                static void call_work_stealing(region_data_type& rdata,
+                    std::size_t thread_index, std::size_t num_threads,
+                    queues_type& queues, hpx::spinlock& exception_mutex,
+                    std::exception_ptr& exception) noexcept
+                {
+                    region_data& data = rdata[thread_index].data_;
+                    hpx::detail::try_catch_exception_ptr(
+                        [&] {
+                            // Cast void pointers back to the actual types given
+                            // to bulk_sync_execute.
+                            auto& element_function =
+                                *static_cast<F*>(data.element_function_);
+                            auto& shape = *static_cast<S const*>(data.shape_);
+                            auto& argument_pack =
+                                *static_cast<Tuple*>(data.argument_pack_);
+
+                            // Set up the local queues and state.
+                            queue_type& local_queue =
+                                queues[thread_index].data_;
+                            std::size_t const size = hpx::util::size(shape);
+                            init_local_work_queue(
+                                local_queue, thread_index, num_threads, size);
+
+                            set_state(data.state_, thread_state::active);
+
+                            auto const process = [&](std::uint32_t index) {
+                                auto it =
+                                    std::next(hpx::util::begin(shape), index);
+                                if constexpr (std::is_void_v<Result>)
+                                {
+                                    invoke_helper(index_pack_type{},
+                                        element_function, *it, argument_pack);
+                                }
+                                else
+                                {
+                                    auto& results =
+                                        *static_cast<Result*>(data.results_);
+                                    results[index] = invoke_helper(
+                                        index_pack_type{}, element_function,
+                                        *it, argument_pack);
+                                }
+                            };
+
+                            while (true)
+                            {
+                                // Process local items first.
+                                hpx::optional<std::uint32_t> index;
+                                while ((index = local_queue.pop_left()))
+                                {
+                                    process(*index);
+                                }
+
+                                // Steal half of the remaining items of
+                                // another thread at once and move them to the
+                                // local queue, where other threads can in
+                                // turn steal from them.
+                                hpx::optional<
+                                    std::pair<std::uint32_t, std::uint32_t>>
+                                    stolen;
+                                for (std::size_t offset = 1;
+                                     !stolen && offset < num_threads; ++offset)
+                                {
+                                    std::size_t const victim = get_victim(
+                                        data, thread_index, offset,
+                                        num_threads);
+
+                                    if (rdata[victim].data_.state_.load(
+                                            std::memory_order_acquire) ==
+                                        thread_state::active)
+                                    {
+                                        stolen = queues[victim]
+                                                     .data_.pop_right_half();
+                                    }
+                                }
+
+                                if (!stolen)
+                                {
+                                    break;
+                                }
+                                local_queue.refill(
+                                    stolen->first, stolen->second);
+                            }
+                        },
+                        [&](std::exception_ptr&& ep) {
+                            std::lock_guard<decltype(exception_mutex)> l(
+                                exception_mutex);
+                            if (!exception)
+                            {
+                                exception = HPX_MOVE(ep);
+                            }
+                        });
+
+                    set_state(data.state_, thread_state::idle);
+                }
             };
 
             template <typename Fs, typename Args>
@@ -756,24 +1257,25 @@ namespace hpx::execution::experimental {
                     func = &thread_function_helper<Result, F, S,
                         Args>::call_static;
                 }
-                else
+                else if (schedule_ == loop_schedule::dynamic)
                 {
                     func = &thread_function_helper<Result, F, S,
                         Args>::call_dynamic;
                 }
-
-                for (std::size_t t = 0; t != num_threads_; ++t)
+                else
                 {
-                    region_data& data = region_data_[t].data_;
+                    func = &thread_function_helper<Result, F, S,
+                        Args>::call_work_stealing;
+                }
 
-                    data.element_function_ = &f;
-                    data.shape_ = &shape;
-                    data.argument_pack_ = &argument_pack;
-                    data.thread_function_helper_ = func;
-                    data.results_ = results;
+                region_data data;
+                data.element_function_ = &f;
+                data.shape_ = &shape;
+                data.argument_pack_ = &argument_pack;
+                data.thread_function_helper_ = func;
+                data.results_ = results;
 
-                    data.state_.store(state, std::memory_order_release);
-                }
+                start_region(data, state);
                 return func;
             }
 
@@ -784,18 +1286,14 @@ namespace hpx::execution::experimental {
                 constexpr thread_function_helper_type* func =
                     &thread_function_helper_invoke<Fs, Args>::call;
 
-                for (std::size_t t = 0; t != num_threads_; ++t)
-                {
-                    region_data& data = region_data_[t].data_;
-
-                    data.element_function_ = &function_pack;
-                    data.shape_ = nullptr;
-                    data.argument_pack_ = &args;
-                    data.thread_function_helper_ = func;
-
-                    data.state_.store(state, std::memory_order_release);
-                }
+                region_data data;
+                data.element_function_ = &function_pack;
+                data.shape_ = nullptr;
+                data.argument_pack_ = &args;
+                data.thread_function_helper_ = func;
+                data.results_ = nullptr;
 
+                start_region(data, state);
                 return func;
             }
 
@@ -808,7 +1306,7 @@ namespace hpx::execution::experimental {
 
                 // Wait for all threads to finish their work assigned to
                 // them in this parallel region.
-                wait_state_all(thread_state::idle);
+                join_region();
 
                 // rethrow exception, if any
                 if (exception_)
@@ -940,7 +1438,7 @@ namespace hpx::execution::experimental {
 
                 // Wait for all threads to finish their work assigned to
                 // them in this parallel region.
-                wait_state_all(thread_state::idle);
+                join_region();
 
                 // rethrow exception, if any
                 if (exception_)
@@ -1067,12 +1565,15 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param barrier The barrier used for joining the worker threads at
+        ///        the end of each parallel region.
         explicit fork_join_executor(
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule schedule = loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            barrier_type barrier = barrier_type::flat)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1084,7 +1585,7 @@ namespace hpx::execution::experimental {
             }
 
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, schedule, yield_delay);
+                priority, stacksize, schedule, yield_delay, barrier);
         }
 
         /// \brief Construct a fork_join_executor.
@@ -1096,12 +1597,15 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param barrier The barrier used for joining the worker threads at
+        ///        the end of each parallel region.
         explicit fork_join_executor(hpx::threads::mask_cref_type pu_mask,
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule schedule = loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            barrier_type barrier = barrier_type::flat)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1113,7 +1617,7 @@ namespace hpx::execution::experimental {
             }
 
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, schedule, yield_delay, pu_mask);
+                priority, stacksize, schedule, yield_delay, barrier, pu_mask);
         }
 
         friend fork_join_executor tag_invoke(
@@ -1167,6 +1671,9 @@ namespace hpx::execution::experimental {
 
     HPX_CORE_EXPORT std::ostream& operator<<(
         std::ostream& os, fork_join_executor::loop_schedule schedule);
+
+    HPX_CORE_EXPORT std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::barrier_type barrier);
 }    // namespace hpx::execution::experimental
 
 namespace hpx::parallel::execution {
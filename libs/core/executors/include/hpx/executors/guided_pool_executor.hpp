@@ -7,20 +7,29 @@
 #pragma once
 
 #include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
 #include <hpx/debugging/demangle_helper.hpp>
 #include <hpx/debugging/print.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/executors/dataflow.hpp>
+#include <hpx/executors/numa_placement_engine.hpp>
 #include <hpx/functional/bind_back.hpp>
+#include <hpx/functional/experimental/scope_exit.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/is_future_tuple.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/modules/topology.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 //#define GUIDED_POOL_EXECUTOR_FAKE_NOOP
 
@@ -239,6 +248,36 @@ namespace hpx::parallel::execution {
                 return p.get_future();
             }
         };
+
+        // --------------------------------------------------------------------
+        // helper : cost model based scheduling for async() execution, the
+        // cost model is evaluated once all arguments have become ready
+        // --------------------------------------------------------------------
+        template <typename Executor>
+        struct pre_execution_async_cost_schedule
+        {
+            Executor const& executor_;
+
+            explicit pre_execution_async_cost_schedule(Executor const& executor)
+              : executor_(executor)
+            {
+            }
+
+            template <typename F, typename... Ts>
+            auto operator()(F&& f, Ts&&... ts) const
+            {
+                placement_estimate const estimate =
+                    executor_.hint_(peek_future_result(ts)...);
+                int const domain = executor_.engine_->place(estimate);
+
+                gpx_deb.debug(debug::str<>("cost_schedule"), "domain ", domain,
+                    "work ", estimate.work);
+
+                return executor_.launch(domain, estimate.work,
+                    hpx::util::deferred_call(
+                        HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+            }
+        };
     }    // namespace detail
 
     // --------------------------------------------------------------------
@@ -254,6 +293,14 @@ namespace hpx::parallel::execution {
     {
     };
 
+    // Template type for a cost model hint, its call operator returns a
+    // placement_estimate (the estimated work and the preferred NUMA domain)
+    // for the arguments of a task
+    template <typename... Args>
+    struct pool_cost_hint
+    {
+    };
+
     // --------------------------------------------------------------------
     template <typename H>
     struct guided_pool_executor;
@@ -529,6 +576,166 @@ namespace hpx::parallel::execution {
         bool hp_sync_;
     };
 
+    // --------------------------------------------------------------------
+    // this is a guided pool executor using a cost model: the hint returns an
+    // estimate of the work of a task and its preferred NUMA domain, and a
+    // placement engine balances the estimated work across the NUMA domains.
+    // The hint is evaluated only once all futures among the arguments have
+    // become ready, and for bulk_async_execute the hints of all elements are
+    // evaluated before any task is placed, which allows to place the largest
+    // tasks first.
+    template <typename Tag>
+    struct guided_pool_executor<pool_cost_hint<Tag>>
+    {
+        template <typename Executor>
+        friend struct detail::pre_execution_async_cost_schedule;
+
+    public:
+        explicit guided_pool_executor(threads::thread_pool_base* pool,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_)
+          : pool_(pool)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , engine_(std::make_shared<numa_placement_engine>(
+                threads::create_topology().get_number_of_numa_nodes()))
+        {
+        }
+
+        // executors sharing a placement engine balance their tasks together
+        guided_pool_executor(threads::thread_pool_base* pool,
+            std::shared_ptr<numa_placement_engine> engine,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_)
+          : pool_(pool)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , engine_(HPX_MOVE(engine))
+        {
+            HPX_ASSERT(engine_);
+        }
+
+        [[nodiscard]] std::shared_ptr<numa_placement_engine> const&
+        placement_engine() const noexcept
+        {
+            return engine_;
+        }
+
+    private:
+        // --------------------------------------------------------------------
+        // launch the task on the given domain, its estimated work is removed
+        // from the load of the domain once it has completed
+        template <typename F>
+        auto launch(int domain, std::size_t work, F&& f) const
+        {
+            using result_type = hpx::util::invoke_result_t<std::decay_t<F>&>;
+
+            lcos::local::futures_factory<result_type()> p(
+                [engine = engine_, domain, work,
+                    f = HPX_FORWARD(F, f)]() mutable -> result_type {
+                    auto on_exit = hpx::experimental::scope_exit(
+                        [&] { engine->complete(domain, work); });
+                    return f();
+                });
+
+            p.post(pool_, "guided cost",
+                hpx::launch::async_policy(priority_, stacksize_,
+                    hpx::threads::thread_schedule_hint(
+                        hpx::threads::thread_schedule_hint_mode::numa,
+                        static_cast<std::int16_t>(domain))));
+
+            return p.get_future();
+        }
+
+        // --------------------------------------------------------------------
+        template <typename F, typename... Ts>
+        friend auto tag_invoke(hpx::parallel::execution::async_execute_t,
+            guided_pool_executor const& exec, F&& f, Ts&&... ts)
+            -> future<hpx::util::detail::invoke_deferred_result_t<F, Ts...>>
+        {
+            // hold onto the function until all futures have become ready,
+            // then evaluate the cost model and place the task
+            return dataflow(launch::sync,
+                detail::pre_execution_async_cost_schedule<guided_pool_executor>(
+                    exec),
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // --------------------------------------------------------------------
+        // .then() execute, the cost model is evaluated with the value of the
+        // predecessor (see the notes of the numa hint version above)
+        template <typename F, typename Future, typename... Ts,
+            typename = std::enable_if_t<hpx::traits::is_future_v<Future>>>
+        friend auto tag_invoke(hpx::parallel::execution::then_execute_t,
+            guided_pool_executor const& exec, F&& f, Future&& predecessor,
+            Ts&&... ts)
+            -> future<
+                hpx::util::detail::invoke_deferred_result_t<F, Future, Ts...>>
+        {
+            return dataflow(
+                launch::sync,
+                [f = HPX_FORWARD(F, f), exec](
+                    Future&& predecessor, Ts&&... /* ts */) mutable {
+                    placement_estimate const estimate = exec.hint_(
+                        detail::future_extract_value()(predecessor));
+                    int const domain = exec.engine_->place(estimate);
+
+                    return exec.launch(domain, estimate.work,
+                        hpx::util::deferred_call(
+                            HPX_MOVE(f), HPX_MOVE(predecessor)));
+                },
+                HPX_FORWARD(Future, predecessor), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // --------------------------------------------------------------------
+        // bulk execution: the cost model is evaluated for all elements of the
+        // shape first, the tasks are then placed together
+        template <typename F, typename S, typename... Ts,
+            HPX_CONCEPT_REQUIRES_(!std::is_integral_v<S>)>
+        friend auto tag_invoke(hpx::parallel::execution::bulk_async_execute_t,
+            guided_pool_executor const& exec, F&& f, S const& shape,
+            Ts&&... ts)
+        {
+            using shape_element =
+                typename hpx::traits::range_traits<S>::value_type;
+            using result_type = hpx::util::detail::invoke_deferred_result_t<F,
+                shape_element, Ts...>;
+
+            std::vector<placement_estimate> estimates;
+            for (auto const& elem : shape)
+            {
+                estimates.push_back(exec.hint_(elem, ts...));
+            }
+
+            std::vector<int> domains(estimates.size());
+            exec.engine_->place_bulk(
+                estimates.data(), estimates.size(), domains.data());
+
+            std::vector<hpx::future<result_type>> results;
+            results.reserve(estimates.size());
+
+            std::size_t i = 0;
+            for (auto const& elem : shape)
+            {
+                results.push_back(exec.launch(domains[i], estimates[i].work,
+                    hpx::util::deferred_call(f, elem, ts...)));
+                ++i;
+            }
+            return results;
+        }
+
+    private:
+        threads::thread_pool_base* pool_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+        pool_cost_hint<Tag> hint_;
+        std::shared_ptr<numa_placement_engine> engine_;
+    };
+
     // --------------------------------------------------------------------
     // guided_pool_executor_shim
     // an executor compatible with scheduled executor API
@@ -650,6 +857,12 @@ namespace hpx::parallel::execution {
     {
     };
 
+    template <typename Tag>
+    struct is_bulk_two_way_executor<guided_pool_executor<pool_cost_hint<Tag>>>
+      : std::true_type
+    {
+    };
+
     // ----------------------------
     template <typename Hint>
     struct executor_execution_category<guided_pool_executor_shim<Hint>>
@@ -8,17 +8,25 @@
 
 #include <hpx/config.hpp>
 #include <hpx/concepts/has_member_xxx.hpp>
+#include <hpx/concurrency/queue.hpp>
 #include <hpx/execution/traits/executor_traits.hpp>
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/packaged_task.hpp>
 #include <hpx/threading_base/print.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -39,6 +47,22 @@ namespace hpx::execution::experimental {
         HPX_HAS_MEMBER_XXX_TRAIT_DEF(in_flight_estimate)
     }    // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The way a limiting_executor handles tasks submitted while the number of
+    // tasks in flight exceeds the upper threshold
+    enum class limiting_mode : std::uint8_t
+    {
+        // the submitting thread yields until the number of tasks in flight
+        // has dropped to the lower threshold
+        yield = 0,
+
+        // the task is put into a (lock-free) queue, it is launched by the
+        // completion of an earlier task, the submitting thread never waits
+        // for post and async_execute (other operations yield as above). The
+        // limit is the upper threshold given on construction.
+        queue = 1
+    };
+
     template <typename BaseExecutor>
     struct limiting_executor
     {
@@ -58,6 +82,14 @@ namespace hpx::execution::experimental {
               : limiting_(lim)
               , f_(HPX_FORWARD(F, f))
             {
+                if (limiting_.mode_ == limiting_mode::queue)
+                {
+                    // wait for a free slot, queued tasks take precedence
+                    hpx::util::yield_while(
+                        [&]() { return !limiting_.try_acquire_slot(); });
+                    return;
+                }
+
                 limiting_.count_up();
                 if (exceeds_upper())
                 {
@@ -145,6 +177,37 @@ namespace hpx::execution::experimental {
             F f_;
         };
 
+        // --------------------------------------------------------------------
+        // this is the wrapper used for the tasks launched in 'queue' mode, its
+        // completion launches the next queued task (if any)
+        template <typename F>
+        struct queueing_wrapper
+        {
+            queueing_wrapper(limiting_executor& lim, F&& f)
+              : limiting_(lim)
+              , f_(HPX_MOVE(f))
+            {
+            }
+
+            void operator()()
+            {
+                auto on_exit = hpx::experimental::scope_exit([&] {
+                    lim_debug.debug(hpx::debug::str<>("Count Down"));
+                    limiting_.count_down();
+                });
+
+                HPX_INVOKE(f_);
+            }
+
+            limiting_executor& limiting_;
+            F f_;
+        };
+
+        struct queued_task
+        {
+            hpx::move_only_function<void()> f_;
+        };
+
     public:
         using execution_category = typename BaseExecutor::execution_category;
         using executor_parameters_type =
@@ -152,22 +215,30 @@ namespace hpx::execution::experimental {
 
         // --------------------------------------------------------------------
         limiting_executor(BaseExecutor& ex, std::size_t lower,
-            std::size_t upper, bool block_on_destruction = true)
+            std::size_t upper, bool block_on_destruction = true,
+            limiting_mode mode = limiting_mode::yield)
           : executor_(ex)
           , count_(0)
           , lower_threshold_(lower)
           , upper_threshold_(upper)
           , block_(block_on_destruction)
+          , mode_(mode)
+          , queue_limit_((std::max)(upper, static_cast<std::size_t>(1)))
+          , queue_(0)
         {
         }
 
         limiting_executor(std::size_t lower, std::size_t upper,
-            bool block_on_destruction = true)
+            bool block_on_destruction = true,
+            limiting_mode mode = limiting_mode::yield)
           : executor_(BaseExecutor{})
           , count_(0)
           , lower_threshold_(lower)
           , upper_threshold_(upper)
           , block_(block_on_destruction)
+          , mode_(mode)
+          , queue_limit_((std::max)(upper, static_cast<std::size_t>(1)))
+          , queue_(0)
         {
         }
 
@@ -176,7 +247,21 @@ namespace hpx::execution::experimental {
         {
             if (block_)
             {
-                set_and_wait(0, 0);
+                if (mode_ == limiting_mode::queue)
+                {
+                    wait_all();
+                }
+                else
+                {
+                    set_and_wait(0, 0);
+                }
+            }
+
+            // tasks that were never launched are dropped
+            queued_task* task = nullptr;
+            while (queue_.pop(task))
+            {
+                delete task;
             }
         }
 
@@ -206,6 +291,27 @@ namespace hpx::execution::experimental {
             hpx::parallel::execution::async_execute_t, limiting_executor& exec,
             F&& f, Ts&&... ts)
         {
+            using result_type =
+                decltype(hpx::parallel::execution::async_execute(
+                    exec.executor_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+            using value_type = hpx::util::invoke_result_t<F, Ts...>;
+
+            // queueing is possible only if the base executor returns a plain
+            // future
+            if constexpr (std::is_same_v<result_type, hpx::future<value_type>>)
+            {
+                if (exec.mode_ == limiting_mode::queue)
+                {
+                    hpx::packaged_task<value_type()> task(
+                        hpx::util::deferred_call(
+                            HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+                    hpx::future<value_type> result = task.get_future();
+
+                    exec.submit(HPX_MOVE(task));
+                    return result;
+                }
+            }
+
             return hpx::parallel::execution::async_execute(exec.executor_,
                 throttling_wrapper<F>(exec, exec.executor_, HPX_FORWARD(F, f)),
                 HPX_FORWARD(Ts, ts)...);
@@ -229,6 +335,13 @@ namespace hpx::execution::experimental {
         friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
             limiting_executor& exec, F&& f, Ts&&... ts)
         {
+            if (exec.mode_ == limiting_mode::queue)
+            {
+                exec.submit(hpx::util::deferred_call(
+                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+                return;
+            }
+
             hpx::parallel::execution::post(exec.executor_,
                 throttling_wrapper<F>(exec, exec.executor_, HPX_FORWARD(F, f)),
                 HPX_FORWARD(Ts, ts)...);
@@ -291,9 +404,16 @@ namespace hpx::execution::experimental {
             ++count_;
         }
 
-        void count_down() const noexcept
+        void count_down()
         {
-            --count_;
+            if (mode_ == limiting_mode::queue)
+            {
+                complete_queued();
+            }
+            else
+            {
+                --count_;
+            }
         }
 
         void set_and_wait(std::size_t lower, std::size_t upper)
@@ -302,6 +422,67 @@ namespace hpx::execution::experimental {
             wait();
         }
 
+        // --------------------------------------------------------------------
+        // 'queue' mode: count_ is the number of tasks which have been
+        // submitted but have not completed yet (running or queued). Tasks are
+        // queued only while queue_limit_ tasks are running, which means that
+        // there is a queued task (or one which is about to be queued) exactly
+        // if count_ exceeds the limit.
+        bool try_acquire_slot() noexcept
+        {
+            std::size_t count = count_.load();
+            while (count < queue_limit_)
+            {
+                if (count_.compare_exchange_weak(count, count + 1))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename F>
+        void launch(F&& f)
+        {
+            // the executor could be destroyed as soon as the task has
+            // completed, don't touch it after having launched the task
+            BaseExecutor exec = executor_;
+            hpx::parallel::execution::post(exec,
+                queueing_wrapper<std::decay_t<F>>(*this, HPX_FORWARD(F, f)));
+        }
+
+        template <typename F>
+        void submit(F&& f)
+        {
+            if (count_.fetch_add(1) < queue_limit_)
+            {
+                launch(HPX_FORWARD(F, f));
+                return;
+            }
+
+            lim_debug.debug(hpx::debug::str<>("Queued"));
+            queue_.push(new queued_task{HPX_FORWARD(F, f)});
+        }
+
+        // Called on completion of a task, launches a queued task instead (if
+        // any). The decrement is the last access to the executor if no task
+        // is waiting.
+        void complete_queued()
+        {
+            if (count_.fetch_sub(1) <= queue_limit_)
+            {
+                return;
+            }
+
+            // a task has been queued, but its submitter might not have
+            // pushed it yet
+            queued_task* task = nullptr;
+            hpx::util::yield_while([&]() { return !queue_.pop(task); });
+
+            std::unique_ptr<queued_task> t(task);
+            launch(HPX_MOVE(t->f_));
+        }
+
     private:
         // --------------------------------------------------------------------
         BaseExecutor executor_;
@@ -309,6 +490,9 @@ namespace hpx::execution::experimental {
         mutable std::size_t lower_threshold_;
         mutable std::size_t upper_threshold_;
         bool block_;
+        limiting_mode mode_;
+        std::size_t queue_limit_;
+        hpx::lockfree::queue<queued_task*> queue_;
     };
 }    // namespace hpx::execution::experimental
 
@@ -0,0 +1,181 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace hpx::parallel::execution {
+
+    // --------------------------------------------------------------------
+    // The estimate returned by the cost model of a task (see pool_cost_hint):
+    // the estimated amount of work (in arbitrary, but consistent units) and
+    // the NUMA domain the task would preferably run on (-1 if none).
+    struct placement_estimate
+    {
+        std::size_t work = 1;
+        int domain = -1;
+
+        // Create an estimate for a task operating on the given data, the
+        // preferred domain is the NUMA domain the data is located in. The
+        // memory has to be touched (i.e. physically allocated) already.
+        [[nodiscard]] static placement_estimate for_data(
+            void const* data, std::size_t work) noexcept
+        {
+            threads::thread_schedule_hint const hint =
+                threads::get_numa_domain_hint(data);
+            return placement_estimate{work,
+                hint.mode == threads::thread_schedule_hint_mode::numa ?
+                    static_cast<int>(hint.hint) :
+                    -1};
+        }
+    };
+
+    // --------------------------------------------------------------------
+    // The placement engine keeps track of the estimated amount of work placed
+    // on each NUMA domain which has not completed yet. A task is placed on its
+    // preferred domain unless that domain is loaded considerably more than
+    // the least loaded domain, in which case it is placed on the least loaded
+    // domain instead (tasks without a preference always are).
+    class numa_placement_engine
+    {
+    public:
+        // The preferred domain is used as long as its load does not exceed the
+        // minimal load by more than the given fraction of the average load
+        // (or by more than the work of the task itself).
+        explicit numa_placement_engine(
+            std::size_t num_domains, double imbalance = 0.25)
+          : num_domains_((std::max)(num_domains, static_cast<std::size_t>(1)))
+          , imbalance_(imbalance)
+          , loads_(new load_type[num_domains_])
+        {
+        }
+
+        [[nodiscard]] std::size_t num_domains() const noexcept
+        {
+            return num_domains_;
+        }
+
+        // the estimated amount of work placed on the given domain which has
+        // not completed yet
+        [[nodiscard]] std::uint64_t load(std::size_t domain) const noexcept
+        {
+            HPX_ASSERT(domain < num_domains_);
+            return loads_[domain].data_.load(std::memory_order_relaxed);
+        }
+
+        // Select the domain for a task, its work is added to the load of the
+        // domain until complete() is called.
+        int place(placement_estimate const& estimate) noexcept
+        {
+            std::size_t const domain = select(estimate, current_loads());
+            loads_[domain].data_.fetch_add(
+                estimate.work, std::memory_order_relaxed);
+            return static_cast<int>(domain);
+        }
+
+        // Select the domains for a batch of tasks at once. The tasks are
+        // placed in the order of decreasing work (largest task first), which
+        // results in a considerably better balance than placing them one by
+        // one if the work of the tasks varies a lot.
+        void place_bulk(placement_estimate const* estimates, std::size_t count,
+            int* domains)
+        {
+            std::vector<std::uint64_t> loads = current_loads();
+            std::vector<std::uint64_t> added(num_domains_, 0);
+
+            std::vector<std::size_t> order(count);
+            std::iota(order.begin(), order.end(), static_cast<std::size_t>(0));
+            std::stable_sort(order.begin(), order.end(),
+                [&](std::size_t lhs, std::size_t rhs) {
+                    return estimates[lhs].work > estimates[rhs].work;
+                });
+
+            for (std::size_t const i : order)
+            {
+                std::size_t const domain = select(estimates[i], loads);
+                loads[domain] += estimates[i].work;
+                added[domain] += estimates[i].work;
+                domains[i] = static_cast<int>(domain);
+            }
+
+            for (std::size_t d = 0; d != num_domains_; ++d)
+            {
+                if (added[d] != 0)
+                {
+                    loads_[d].data_.fetch_add(
+                        added[d], std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Remove the work of a completed task from the load of its domain.
+        void complete(int domain, std::size_t work) noexcept
+        {
+            HPX_ASSERT(domain >= 0 &&
+                static_cast<std::size_t>(domain) < num_domains_);
+            loads_[static_cast<std::size_t>(domain)].data_.fetch_sub(
+                work, std::memory_order_relaxed);
+        }
+
+    private:
+        using load_type =
+            hpx::util::cache_aligned_data<std::atomic<std::uint64_t>>;
+
+        [[nodiscard]] std::vector<std::uint64_t> current_loads() const
+        {
+            std::vector<std::uint64_t> loads(num_domains_);
+            for (std::size_t d = 0; d != num_domains_; ++d)
+            {
+                loads[d] = load(d);
+            }
+            return loads;
+        }
+
+        [[nodiscard]] std::size_t select(placement_estimate const& estimate,
+            std::vector<std::uint64_t> const& loads) const noexcept
+        {
+            std::size_t const least = static_cast<std::size_t>(
+                std::min_element(loads.begin(), loads.end()) - loads.begin());
+
+            if (estimate.domain < 0 ||
+                static_cast<std::size_t>(estimate.domain) >= num_domains_)
+            {
+                return least;
+            }
+
+            std::size_t const preferred =
+                static_cast<std::size_t>(estimate.domain);
+
+            std::uint64_t const total =
+                std::accumulate(loads.begin(), loads.end(), std::uint64_t(0));
+            auto const tolerance = (std::max)(
+                static_cast<std::uint64_t>(estimate.work),
+                static_cast<std::uint64_t>(imbalance_ *
+                    static_cast<double>(total) /
+                    static_cast<double>(num_domains_)));
+
+            return loads[preferred] - loads[least] <= tolerance ? preferred :
+                                                                  least;
+        }
+
+        std::size_t num_domains_;
+        double imbalance_;
+        std::unique_ptr<load_type[]> loads_;
+    };
+}    // namespace hpx::parallel::execution
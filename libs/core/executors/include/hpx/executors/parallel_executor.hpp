@@ -83,6 +83,11 @@ namespace hpx::execution {
     ///
     /// This executor conforms to the concepts of a TwoWayExecutor,
     /// and a BulkTwoWayExecutor
+    ///
+    /// If the cores used by the executor span more than one NUMA domain, bulk
+    /// execution (without a hierarchical threshold) spawns one task per NUMA
+    /// domain, which in turn spawns the tasks for the cores of its domain.
+    /// The tasks steal work from the cores of their own domain first.
     template <typename Policy>
     struct parallel_policy_executor
     {
@@ -0,0 +1,306 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/execution_base/completion_scheduler.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/coroutine_utils.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/type_support/coroutines_support.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace hpx::execution::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename Scheduler>
+        inline constexpr bool is_thread_pool_policy_scheduler_v = false;
+
+        template <typename Policy>
+        inline constexpr bool is_thread_pool_policy_scheduler_v<
+            thread_pool_policy_scheduler<Policy>> = true;
+
+        template <typename Sender>
+        using value_completion_scheduler_t =
+            std::decay_t<hpx::util::invoke_result_t<
+                get_completion_scheduler_t<set_value_t>, Sender const&>>;
+
+        // detect the senders returned by schedule(thread_pool_scheduler)
+        template <typename Sender, typename Enable = void>
+        inline constexpr bool is_thread_pool_schedule_sender_v = false;
+
+        template <typename Sender>
+        inline constexpr bool is_thread_pool_schedule_sender_v<Sender,
+            std::enable_if_t<is_thread_pool_policy_scheduler_v<
+                value_completion_scheduler_t<Sender>>>> =
+            std::is_same_v<Sender,
+                typename value_completion_scheduler_t<Sender>::template sender<
+                    value_completion_scheduler_t<Sender>>>;
+
+        // Awaiting the sender returned by schedule(thread_pool_scheduler)
+        // from a task resumes the task on a new stackless HPX thread, no
+        // operation state is created for the sender.
+        template <typename Scheduler>
+        struct stackless_schedule_awaiter
+        {
+            Scheduler scheduler;
+
+            static constexpr bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(hpx::coroutine_handle<> h) const
+            {
+                auto const policy = with_stacksize(
+                    scheduler.policy(), threads::thread_stacksize::nostack);
+                scheduler.execute([h]() { h.resume(); }, policy);
+            }
+
+            static constexpr void await_resume() noexcept {}
+        };
+
+        template <typename T>
+        struct task_promise_result
+        {
+            template <typename U>
+            void return_value(U&& value)
+            {
+                result.template emplace<1>(HPX_FORWARD(U, value));
+            }
+
+            T get_result()
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(std::get<2>(result));
+                }
+                return std::get<1>(HPX_MOVE(result));
+            }
+
+            std::variant<std::monostate, T, std::exception_ptr> result;
+        };
+
+        template <>
+        struct task_promise_result<void>
+        {
+            struct void_value
+            {
+            };
+
+            void return_void() noexcept
+            {
+                result.template emplace<1>();
+            }
+
+            void get_result()
+            {
+                if (result.index() == 2)
+                {
+                    std::rethrow_exception(std::get<2>(result));
+                }
+            }
+
+            std::variant<std::monostate, void_value, std::exception_ptr> result;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    /// A \c task is a lazily started, stackless coroutine producing a value
+    /// of type \c T. A \c task is started either by awaiting it from another
+    /// coroutine or by using it as a sender (e.g. with \a sync_wait or
+    /// \a start_detached).
+    ///
+    /// Awaiting a task transfers control to it directly, and the task
+    /// transfers control back to the awaiting coroutine once it has
+    /// completed (symmetric transfer), no HPX threads are created for this.
+    /// Awaiting the sender returned by \a schedule for a
+    /// \a thread_pool_scheduler from a \c task resumes the task on a new
+    /// stackless HPX thread of that scheduler. As a result, code composed
+    /// from tasks does not need an HPX thread stack per task. Blocking inside
+    /// a task (e.g. using \a hpx::future::get) blocks the underlying worker
+    /// thread, rather use \c co_await.
+    ///
+    /// \tparam T  The type of the value produced by the task.
+    template <typename T = void>
+    class task
+    {
+        static_assert(!std::is_reference_v<T>,
+            "hpx::execution::experimental::task does not support references");
+
+    public:
+        struct promise_type;
+        using handle_type = hpx::coroutine_handle<promise_type>;
+
+    private:
+        struct final_awaiter
+        {
+            static constexpr bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            hpx::coroutine_handle<> await_suspend(handle_type h) noexcept
+            {
+                // continue with the awaiting coroutine, if any
+                if (hpx::coroutine_handle<> cont = h.promise().continuation())
+                {
+                    return cont;
+                }
+                return hpx::noop_coroutine();
+            }
+
+            static constexpr void await_resume() noexcept {}
+        };
+
+    public:
+        /// \cond NOINTERNAL
+        struct promise_type
+          : detail::task_promise_result<T>
+          , with_awaitable_senders<promise_type>
+        {
+            task get_return_object() noexcept
+            {
+                return task(handle_type::from_promise(*this));
+            }
+
+            static constexpr hpx::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            static constexpr final_awaiter final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                this->result.template emplace<2>(std::current_exception());
+            }
+
+            template <typename Value>
+            decltype(auto) await_transform(Value&& value)
+            {
+                using value_type = std::decay_t<Value>;
+                if constexpr (detail::is_thread_pool_schedule_sender_v<
+                                  value_type>)
+                {
+                    using scheduler_type =
+                        detail::value_completion_scheduler_t<value_type>;
+                    return detail::stackless_schedule_awaiter<scheduler_type>{
+                        get_completion_scheduler<set_value_t>(value)};
+                }
+                else
+                {
+                    return with_awaitable_senders<
+                        promise_type>::await_transform(HPX_FORWARD(Value,
+                        value));
+                }
+            }
+        };
+        /// \endcond
+
+    private:
+        struct awaiter
+        {
+            handle_type coro;
+
+            static constexpr bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            template <typename Promise>
+            hpx::coroutine_handle<> await_suspend(
+                hpx::coroutine_handle<Promise> parent) noexcept
+            {
+                coro.promise().set_continuation(parent);
+                return coro;
+            }
+
+            T await_resume()
+            {
+                return coro.promise().get_result();
+            }
+        };
+
+    public:
+        task(task&& rhs) noexcept
+          : coro_(std::exchange(rhs.coro_, {}))
+        {
+        }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (coro_)
+                {
+                    coro_.destroy();
+                }
+                coro_ = std::exchange(rhs.coro_, {});
+            }
+            return *this;
+        }
+
+        task(task const&) = delete;
+        task& operator=(task const&) = delete;
+
+        ~task()
+        {
+            if (coro_)
+            {
+                coro_.destroy();
+            }
+        }
+
+        /// Start the task and suspend the awaiting coroutine until the task
+        /// has completed.
+        friend awaiter operator co_await(task&& t) noexcept
+        {
+            return awaiter{t.coro_};
+        }
+
+        // make the task awaitable from coroutines that transform awaitables
+        // using as_awaitable (e.g. the ones used to connect it to receivers)
+        // clang-format off
+        template <typename Task, typename Promise,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_same_v<std::decay_t<Task>, task>
+            )>
+        // clang-format on
+        friend awaiter tag_invoke(as_awaitable_t, Task&& t, Promise&) noexcept
+        {
+            return awaiter{t.coro_};
+        }
+
+    private:
+        explicit task(handle_type coro) noexcept
+          : coro_(coro)
+        {
+        }
+
+        handle_type coro_;
+    };
+}    // namespace hpx::execution::experimental
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
@@ -19,10 +19,12 @@
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution/algorithms/bulk.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/execution_base/completion_scheduler.hpp>
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
@@ -34,9 +36,11 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -70,6 +74,21 @@ namespace hpx::execution::experimental::detail {
         HPX_INVOKE(HPX_FORWARD(F, f), HPX_FORWARD(T, t), hpx::get<Is>(ts)...);
     }
 
+    // Invoke the bulk function for the elements [i_begin, i_end) of the shape
+    template <typename OperationState, typename Ts>
+    void bulk_scheduler_invoke_range(OperationState* op_state, Ts& ts,
+        std::size_t const i_begin, std::size_t const i_end)
+    {
+        using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
+
+        auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
+        for (std::size_t i = i_begin; i != i_end; (void) ++it, ++i)
+        {
+            bulk_scheduler_invoke_helper(
+                index_pack_type{}, op_state->f, *it, ts);
+        }
+    }
+
     inline hpx::threads::mask_type full_mask(
         std::size_t first_thread, std::size_t num_threads)
     {
@@ -137,19 +156,21 @@ namespace hpx::execution::experimental::detail {
 
             hpx::util::itt::mark_event e(notify_event);
 #endif
-            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
+            // chunks of varying sizes are described by their boundaries
+            auto const& chunk_bounds = op_state->chunk_bounds;
+            if (!chunk_bounds.empty())
+            {
+                bulk_scheduler_invoke_range(op_state, ts, chunk_bounds[index],
+                    chunk_bounds[index + 1]);
+                return;
+            }
 
-            auto const i_begin =
+            auto const i_begin = op_state->first_item +
                 static_cast<std::size_t>(index) * task_f->chunk_size;
             auto const i_end =
                 (std::min)(i_begin + task_f->chunk_size, task_f->size);
 
-            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
-            for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
-            {
-                bulk_scheduler_invoke_helper(
-                    index_pack_type{}, op_state->f, *it, ts);
-            }
+            bulk_scheduler_invoke_range(op_state, ts, i_begin, i_end);
         }
 
         template <hpx::concurrency::detail::queue_end Which, typename Ts>
@@ -439,6 +460,126 @@ namespace hpx::execution::experimental::detail {
         using range_value_type =
             hpx::traits::iter_value_t<hpx::traits::range_iterator_t<Shape>>;
 
+        // Calculate the chunk size from the executor parameters given to bulk
+        // for the remaining count elements of the shape
+        template <typename Parameters, typename Duration>
+        std::size_t get_chunk_size(Parameters& params,
+            Duration const& iteration_duration, std::size_t const count) const
+        {
+            namespace pex = hpx::parallel::execution;
+
+            // the parameters are queried using an executor which runs the
+            // testing function (if any) on the calling thread
+            hpx::execution::sequenced_executor exec;
+
+            std::size_t const cores = op_state->num_worker_threads;
+            std::size_t const max_chunks =
+                pex::maximal_number_of_chunks(params, exec, cores, count);
+            std::size_t chunk_size = pex::get_chunk_size(
+                params, exec, iteration_duration, cores, count);
+
+            // make sure, chunk size and max_chunks are consistent
+            if (chunk_size == 0)
+            {
+                chunk_size = max_chunks == 0 ?
+                    get_bulk_scheduler_chunk_size(
+                        static_cast<std::uint32_t>(cores), count) :
+                    (count + max_chunks - 1) / max_chunks;
+            }
+            else if (max_chunks != 0 &&
+                (count + chunk_size - 1) / chunk_size > max_chunks)
+            {
+                chunk_size = (count + max_chunks - 1) / max_chunks;
+            }
+
+            return chunk_size;
+        }
+
+        // Calculate chunk size and number of chunks. Executor parameters
+        // measuring the execution time of the iterations (auto_chunk_size)
+        // execute the first iterations on the calling thread, executor
+        // parameters with variable chunk sizes (guided_chunk_size) store the
+        // boundaries of all chunks in the operation state.
+        template <typename Ts>
+        std::uint32_t init_chunks(
+            Ts& ts, std::uint32_t const size, std::uint32_t& chunk_size)
+        {
+            namespace pex = hpx::parallel::execution;
+
+            auto& params = op_state->params;
+            using parameters_type = std::decay_t<decltype(params)>;
+
+            if constexpr (std::is_same_v<parameters_type,
+                              pex::null_parameters_t>)
+            {
+                HPX_UNUSED(ts);
+                chunk_size = get_bulk_scheduler_chunk_size(
+                    op_state->num_worker_threads, size);
+                return (size + chunk_size - 1) / chunk_size;
+            }
+            else if constexpr (pex::extract_has_variable_chunk_size_v<
+                                   parameters_type>)
+            {
+                HPX_UNUSED(ts);
+
+                auto& chunk_bounds = op_state->chunk_bounds;
+                chunk_bounds.clear();
+                chunk_bounds.push_back(0);
+
+                std::size_t first = 0;
+                while (first != size)
+                {
+                    std::size_t const count = size - first;
+                    std::size_t const chunk =
+                        (std::max)(get_chunk_size(params,
+                                       hpx::chrono::null_duration, count),
+                            std::size_t(1));
+
+                    first += (std::min)(chunk, count);
+                    chunk_bounds.push_back(first);
+                }
+
+                chunk_size = 0;
+                return static_cast<std::uint32_t>(chunk_bounds.size() - 1);
+            }
+            else if constexpr (pex::extract_invokes_testing_function_v<
+                                   parameters_type>)
+            {
+                std::size_t count = size;
+                auto test_function =
+                    [&](std::size_t test_chunk_size) -> std::size_t {
+                    test_chunk_size = (std::min)(test_chunk_size, count);
+                    bulk_scheduler_invoke_range(
+                        op_state, ts, 0, test_chunk_size);
+                    count -= test_chunk_size;
+                    return test_chunk_size;
+                };
+
+                // note: running the test function will modify 'count'
+                auto const iteration_duration = pex::measure_iteration(params,
+                    hpx::execution::sequenced_executor{}, test_function, count);
+
+                op_state->first_item = size - count;
+                if (count == 0)
+                {
+                    chunk_size = 1;
+                    return 0;
+                }
+
+                chunk_size = static_cast<std::uint32_t>(
+                    get_chunk_size(params, iteration_duration, count));
+                return static_cast<std::uint32_t>(
+                    (count + chunk_size - 1) / chunk_size);
+            }
+            else
+            {
+                HPX_UNUSED(ts);
+                chunk_size = static_cast<std::uint32_t>(
+                    get_chunk_size(params, hpx::chrono::null_duration, size));
+                return (size + chunk_size - 1) / chunk_size;
+            }
+        }
+
         template <typename... Ts>
         void execute(Ts&&... ts)
         {
@@ -452,10 +593,23 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
+            // Store sent values in the operation state
+            op_state->ts.template emplace<hpx::tuple<Ts...>>(
+                HPX_FORWARD(Ts, ts)...);
+
             // Calculate chunk size and number of chunks
-            std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
-                op_state->num_worker_threads, size);
-            std::uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
+            std::uint32_t chunk_size = 0;
+            std::uint32_t const num_chunks = init_chunks(
+                hpx::get<hpx::tuple<Ts...>>(op_state->ts), size, chunk_size);
+
+            // all iterations may have been executed while determining the
+            // chunk size
+            if (num_chunks == 0)
+            {
+                hpx::visit(set_value_end_loop_visitor<OperationState>{op_state},
+                    HPX_MOVE(op_state->ts));
+                return;
+            }
 
             // launch only as many tasks as we have chunks
             std::size_t const num_pus = op_state->num_worker_threads;
@@ -471,10 +625,6 @@ namespace hpx::execution::experimental::detail {
             HPX_ASSERT(hpx::threads::count(op_state->pu_mask) ==
                 op_state->num_worker_threads);
 
-            // Store sent values in the operation state
-            op_state->ts.template emplace<hpx::tuple<Ts...>>(
-                HPX_FORWARD(Ts, ts)...);
-
             // thread placement
             hpx::threads::thread_schedule_hint const hint =
                 hpx::execution::experimental::get_hint(op_state->scheduler);
@@ -606,12 +756,20 @@ namespace hpx::execution::experimental::detail {
     // thread will be spawned. Once the HPX thread has finished working on its
     // own queue, it will attempt to steal work from other queues.
     //
+    // By default, the chunk size is chosen such that every worker thread
+    // handles between 4 and 8 chunks. If an executor parameters object was
+    // passed to bulk, it determines the chunk sizes instead, in the same way as
+    // for the parallel algorithms (e.g. static_chunk_size, dynamic_chunk_size,
+    // guided_chunk_size, or auto_chunk_size). Chunks not handled yet are
+    // stolen by worker threads which have finished their own queues.
+    //
     // Since predecessor sender must complete on an HPX thread (the completion
     // scheduler is a thread_pool_scheduler; otherwise the customization defined
     // in this file is not chosen) it will be reused as one of the worker
     // threads.
     //
-    template <typename Policy, typename Sender, typename Shape, typename F>
+    template <typename Policy, typename Sender, typename Shape, typename F,
+        typename Parameters = hpx::parallel::execution::null_parameters_t>
     class thread_pool_bulk_sender
     {
     private:
@@ -619,6 +777,7 @@ namespace hpx::execution::experimental::detail {
         HPX_NO_UNIQUE_ADDRESS std::decay_t<Sender> sender;
         HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
         HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+        HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
         hpx::threads::mask_type pu_mask;
 
     public:
@@ -649,6 +808,28 @@ namespace hpx::execution::experimental::detail {
         {
         }
 
+        // clang-format off
+        template <typename Sender_, typename Shape_, typename F_,
+            typename Parameters_,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_parameters_v<Parameters_>
+            )>
+        // clang-format on
+        thread_pool_bulk_sender(thread_pool_policy_scheduler<Policy>&& sched,
+            Sender_&& sender, Shape_&& shape, F_&& f, Parameters_&& params)
+          : scheduler(HPX_MOVE(sched))
+          , sender(HPX_FORWARD(Sender_, sender))
+          , shape(HPX_FORWARD(Shape_, shape))
+          , f(HPX_FORWARD(F_, f))
+          , params(HPX_FORWARD(Parameters_, params))
+          , pu_mask(detail::full_mask(
+                hpx::execution::experimental::get_first_core(scheduler),
+                hpx::parallel::execution::processing_units_count(
+                    hpx::parallel::execution::null_parameters, scheduler,
+                    hpx::chrono::null_duration, 0)))
+        {
+        }
+
         thread_pool_bulk_sender(thread_pool_bulk_sender&&) = default;
         thread_pool_bulk_sender(thread_pool_bulk_sender const&) = default;
         thread_pool_bulk_sender& operator=(thread_pool_bulk_sender&&) = default;
@@ -720,7 +901,13 @@ namespace hpx::execution::experimental::detail {
                 queues;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+
+            // the number of elements executed while determining the chunk
+            // size, the boundaries of all chunks if they have varying sizes
+            std::size_t first_item = 0;
+            std::vector<std::size_t> chunk_bounds;
             hpx::util::cache_aligned_data<std::atomic<std::size_t>>
                 tasks_remaining;
 
@@ -731,10 +918,10 @@ namespace hpx::execution::experimental::detail {
             hpx::exception_list exceptions;
 
             template <typename Scheduler_, typename Sender_, typename Shape_,
-                typename F_, typename Receiver_>
+                typename F_, typename Parameters_, typename Receiver_>
             operation_state(Scheduler_&& scheduler, Sender_&& sender,
-                Shape_&& shape, F_&& f, hpx::threads::mask_type pumask,
-                Receiver_&& receiver)
+                Shape_&& shape, F_&& f, Parameters_&& params,
+                hpx::threads::mask_type pumask, Receiver_&& receiver)
               : scheduler(HPX_FORWARD(Scheduler_, scheduler))
               , op_state(hpx::execution::experimental::connect(
                     HPX_FORWARD(Sender_, sender),
@@ -749,6 +936,7 @@ namespace hpx::execution::experimental::detail {
               , queues(num_worker_threads)
               , shape(HPX_FORWARD(Shape_, shape))
               , f(HPX_FORWARD(F_, f))
+              , params(HPX_FORWARD(Parameters_, params))
               , receiver(HPX_FORWARD(Receiver_, receiver))
             {
                 tasks_remaining.data_.store(
@@ -769,7 +957,7 @@ namespace hpx::execution::experimental::detail {
         {
             return operation_state<std::decay_t<Receiver>>{
                 HPX_MOVE(s.scheduler), HPX_MOVE(s.sender), HPX_MOVE(s.shape),
-                HPX_MOVE(s.f), HPX_MOVE(s.pu_mask),
+                HPX_MOVE(s.f), HPX_MOVE(s.params), HPX_MOVE(s.pu_mask),
                 HPX_FORWARD(Receiver, receiver)};
         }
 
@@ -778,7 +966,7 @@ namespace hpx::execution::experimental::detail {
             connect_t, thread_pool_bulk_sender& s, Receiver&& receiver)
         {
             return operation_state<std::decay_t<Receiver>>{s.scheduler,
-                s.sender, s.shape, s.f, s.pu_mask,
+                s.sender, s.shape, s.f, s.params, s.pu_mask,
                 HPX_FORWARD(Receiver, receiver)};
         }
     };
@@ -835,4 +1023,63 @@ namespace hpx::execution::experimental {
                 HPX_FORWARD(F, f)};
         }
     }
+
+    // The given executor parameters determine the sizes of the chunks the
+    // invocations are grouped into (see thread_pool_bulk_sender).
+    //
+    // clang-format off
+    template <typename Policy, typename Sender, typename Shape, typename F,
+        typename Parameters,
+        HPX_CONCEPT_REQUIRES_(
+            !std::is_integral_v<Shape> &&
+            hpx::traits::is_executor_parameters_v<Parameters>
+        )>
+    // clang-format on
+    constexpr auto tag_invoke(bulk_t,
+        thread_pool_policy_scheduler<Policy> scheduler, Sender&& sender,
+        Shape const& shape, F&& f, Parameters&& params)
+    {
+        if constexpr (std::is_same_v<Policy, launch::sync_policy>)
+        {
+            // fall back to non-bulk scheduling if sync execution was requested
+            return detail::bulk_sender<Sender, Shape, F>{
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f)};
+        }
+        else
+        {
+            return detail::thread_pool_bulk_sender<Policy, Sender, Shape, F,
+                std::decay_t<Parameters>>{HPX_MOVE(scheduler),
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params)};
+        }
+    }
+
+    // clang-format off
+    template <typename Policy, typename Sender, typename Count, typename F,
+        typename Parameters,
+        HPX_CONCEPT_REQUIRES_(
+            std::is_integral_v<Count> &&
+            hpx::traits::is_executor_parameters_v<Parameters>
+        )>
+    // clang-format on
+    constexpr decltype(auto) tag_invoke(bulk_t,
+        thread_pool_policy_scheduler<Policy> scheduler, Sender&& sender,
+        Count const& count, F&& f, Parameters&& params)
+    {
+        if constexpr (std::is_same_v<Policy, launch::sync_policy>)
+        {
+            // fall back to non-bulk scheduling if sync execution was requested
+            return detail::bulk_sender<Sender, hpx::util::counting_shape<Count>,
+                F>{HPX_FORWARD(Sender, sender),
+                hpx::util::counting_shape(count), HPX_FORWARD(F, f)};
+        }
+        else
+        {
+            return detail::thread_pool_bulk_sender<Policy, Sender,
+                hpx::util::counting_shape<Count>, F, std::decay_t<Parameters>>{
+                HPX_MOVE(scheduler), HPX_FORWARD(Sender, sender),
+                hpx::util::counting_shape(count), HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params)};
+        }
+    }
 }    // namespace hpx::execution::experimental
@@ -21,6 +21,9 @@ namespace hpx::execution::experimental {
         case fork_join_executor::loop_schedule::dynamic:
             os << "dynamic";
             break;
+        case fork_join_executor::loop_schedule::work_stealing:
+            os << "work_stealing";
+            break;
         default:
             os << "<unknown>";
             break;
@@ -34,4 +37,29 @@ namespace hpx::execution::experimental {
 
         return os;
     }
+
+    std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::barrier_type barrier)
+    {
+        switch (barrier)
+        {
+        case fork_join_executor::barrier_type::flat:
+            os << "flat";
+            break;
+        case fork_join_executor::barrier_type::tree:
+            os << "tree";
+            break;
+        default:
+            os << "<unknown>";
+            break;
+        }
+
+        os << " ("
+           << static_cast<
+                  std::underlying_type_t<fork_join_executor::barrier_type>>(
+                  barrier)
+           << ")";
+
+        return os;
+    }
 }    // namespace hpx::execution::experimental
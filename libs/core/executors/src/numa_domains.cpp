@@ -0,0 +1,145 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/executors/detail/numa_domains.hpp>
+#include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::execution::detail {
+
+    namespace {
+
+        std::mutex numa_domain_of_pu_mtx;
+        numa_domain_of_pu_type numa_domain_of_pu;
+
+        // incremented whenever the function returning the NUMA domain of a
+        // processing unit is replaced, this invalidates the cached groupings
+        std::atomic<std::size_t> numa_domains_generation(0);
+
+        std::shared_ptr<numa_domains const> make_numa_domains(
+            std::size_t first_thread, std::size_t num_threads)
+        {
+            auto const& rp = hpx::resource::get_partitioner();
+            auto const& topo = rp.get_topology();
+
+            std::vector<std::size_t> domains(num_threads);
+            {
+                std::lock_guard<std::mutex> l(numa_domain_of_pu_mtx);
+                for (std::size_t i = 0; i != num_threads; ++i)
+                {
+                    std::size_t const pu_num =
+                        rp.get_pu_num(i + first_thread);    //-V106
+                    domains[i] = numa_domain_of_pu ?
+                        numa_domain_of_pu(pu_num) :
+                        topo.get_numa_node_number(pu_num);
+                }
+            }
+
+            std::vector<std::size_t> distinct(domains);
+            std::sort(distinct.begin(), distinct.end());
+            distinct.erase(std::unique(distinct.begin(), distinct.end()),
+                distinct.end());
+            if (distinct.size() <= 1)
+            {
+                return {};
+            }
+
+            auto result = std::make_shared<numa_domains>();
+            result->workers.reserve(num_threads);
+            result->offsets.reserve(distinct.size() + 1);
+            result->positions.resize(num_threads);
+            for (std::size_t const domain : distinct)
+            {
+                result->offsets.push_back(
+                    static_cast<std::uint32_t>(result->workers.size()));
+                for (std::uint32_t i = 0; i != num_threads; ++i)
+                {
+                    if (domains[i] == domain)
+                    {
+                        result->positions[i] =
+                            static_cast<std::uint32_t>(result->workers.size());
+                        result->workers.push_back(i);
+                    }
+                }
+            }
+            result->offsets.push_back(
+                static_cast<std::uint32_t>(result->workers.size()));
+            return result;
+        }
+
+        struct numa_domains_cache_entry
+        {
+            threads::thread_pool_base const* pool;
+            std::size_t first_thread;
+            std::size_t num_threads;
+            hpx::threads::mask_type pu_mask;
+            std::size_t generation;
+            std::shared_ptr<numa_domains const> domains;
+        };
+
+        // the number of groupings cached by every OS thread
+        constexpr std::size_t max_cached_numa_domains = 16;
+    }    // namespace
+
+    // The cache is thread local, a lookup therefore does not need any
+    // synchronization.
+    std::shared_ptr<numa_domains const> get_numa_domains(
+        threads::thread_pool_base const* pool, std::size_t first_thread,
+        std::size_t num_threads, hpx::threads::mask_cref_type pu_mask)
+    {
+        static thread_local std::vector<numa_domains_cache_entry> cache;
+
+        std::size_t const generation =
+            numa_domains_generation.load(std::memory_order_acquire);
+
+        auto const it = std::find_if(cache.begin(), cache.end(),
+            [&](numa_domains_cache_entry const& entry) {
+                return entry.pool == pool &&
+                    entry.first_thread == first_thread &&
+                    entry.num_threads == num_threads &&
+                    entry.pu_mask == pu_mask;
+            });
+
+        if (it != cache.end())
+        {
+            if (it->generation == generation)
+            {
+                return it->domains;
+            }
+            cache.erase(it);
+        }
+
+        auto domains = make_numa_domains(first_thread, num_threads);
+
+        if (cache.size() == max_cached_numa_domains)
+        {
+            cache.erase(cache.begin());
+        }
+        cache.push_back(numa_domains_cache_entry{pool, first_thread,
+            num_threads, pu_mask, generation, domains});
+
+        return domains;
+    }
+
+    void set_numa_domain_of_pu(numa_domain_of_pu_type f)
+    {
+        std::lock_guard<std::mutex> l(numa_domain_of_pu_mtx);
+        numa_domain_of_pu = HPX_MOVE(f);
+        numa_domains_generation.fetch_add(1, std::memory_order_release);
+    }
+}    // namespace hpx::parallel::execution::detail
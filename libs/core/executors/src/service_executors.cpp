@@ -9,13 +9,11 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/io_service/io_service_pool.hpp>
 
-#include <asio/io_context.hpp>
-
 namespace hpx::parallel::execution::detail {
 
     void service_executor::post(
         hpx::util::io_service_pool* pool, hpx::function<void()>&& f)
     {
-        pool->get_io_service().post(HPX_MOVE(f));
+        pool->post(HPX_MOVE(f));
     }
 }    // namespace hpx::parallel::execution::detail
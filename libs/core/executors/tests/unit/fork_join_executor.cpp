@@ -446,29 +446,37 @@ void static_check_executor()
 }
 
 template <typename... ExecutorArgs>
+void test_executor_impl(ExecutorArgs const&... args)
+{
+    test_bulk_sync(args...);
+    test_bulk_async(args...);
+    test_bulk_sync_exception(args...);
+    test_bulk_async_exception(args...);
+
+    test_bulk_sync_with_result(args...);
+    test_bulk_async_with_result(args...);
+    test_bulk_sync_exception_with_result(args...);
+    test_bulk_async_exception_with_result(args...);
+
+    test_invoke_sync_homogeneous(args...);
+    test_invoke_sync(args...);
+    test_invoke_sync_homogeneous_exception(args...);
+    test_invoke_sync_exception(args...);
+
+    test_processing_mask(args...);
+}
+
 void test_executor(hpx::threads::thread_priority priority,
     hpx::threads::thread_stacksize stacksize,
-    fork_join_executor::loop_schedule schedule)
+    fork_join_executor::loop_schedule schedule,
+    fork_join_executor::barrier_type barrier)
 {
     std::cerr << "testing fork_join_executor with priority = " << priority
               << ", stacksize = " << stacksize << ", schedule = " << schedule
-              << "\n";
-    test_bulk_sync(priority, stacksize, schedule);
-    test_bulk_async(priority, stacksize, schedule);
-    test_bulk_sync_exception(priority, stacksize, schedule);
-    test_bulk_async_exception(priority, stacksize, schedule);
-
-    test_bulk_sync_with_result(priority, stacksize, schedule);
-    test_bulk_async_with_result(priority, stacksize, schedule);
-    test_bulk_sync_exception_with_result(priority, stacksize, schedule);
-    test_bulk_async_exception_with_result(priority, stacksize, schedule);
-
-    test_invoke_sync_homogeneous(priority, stacksize, schedule);
-    test_invoke_sync(priority, stacksize, schedule);
-    test_invoke_sync_homogeneous_exception(priority, stacksize, schedule);
-    test_invoke_sync_exception(priority, stacksize, schedule);
-
-    test_processing_mask(priority, stacksize, schedule);
+              << ", barrier = " << barrier << "\n";
+
+    test_executor_impl(priority, stacksize, schedule,
+        std::chrono::milliseconds(1), barrier);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -494,10 +502,15 @@ int hpx_main()
             for (auto const schedule : {
                      fork_join_executor::loop_schedule::static_,
                      fork_join_executor::loop_schedule::dynamic,
+                     fork_join_executor::loop_schedule::work_stealing,
                  })
             {
+                for (auto const barrier : {
+                         fork_join_executor::barrier_type::flat,
+                         fork_join_executor::barrier_type::tree,
+                     })
                 {
-                    test_executor(priority, stacksize, schedule);
+                    test_executor(priority, stacksize, schedule, barrier);
                 }
             }
         }
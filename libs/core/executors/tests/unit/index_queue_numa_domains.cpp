@@ -0,0 +1,188 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the bulk execution of the parallel executor if its worker threads
+// span more than one NUMA domain. The NUMA domains are simulated by assigning
+// the processing units of the worker threads alternately to two domains.
+
+#include <hpx/execution.hpp>
+#include <hpx/executors/detail/index_queue_spawning.hpp>
+#include <hpx/executors/detail/numa_domains.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace exec_detail = hpx::parallel::execution::detail;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_grouping()
+{
+    auto const& rp = hpx::resource::get_partitioner();
+    hpx::threads::thread_pool_base const* pool =
+        hpx::threads::detail::get_self_or_default_pool();
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    if (num_threads < 2)
+    {
+        return;
+    }
+
+    hpx::threads::mask_type mask = hpx::threads::mask_type();
+    hpx::threads::resize(mask, hpx::threads::hardware_concurrency());
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::threads::set(mask, rp.get_pu_num(i));
+    }
+
+    auto const domains =
+        exec_detail::get_numa_domains(pool, 0, num_threads, mask);
+    HPX_TEST(domains);
+    if (!domains)
+    {
+        return;
+    }
+
+    HPX_TEST_EQ(domains->num_domains(), std::uint32_t(2));
+    HPX_TEST_EQ(domains->workers.size(), num_threads);
+    HPX_TEST_EQ(domains->positions.size(), num_threads);
+    for (std::uint32_t i = 0; i != num_threads; ++i)
+    {
+        std::uint32_t const position = domains->positions[i];
+        HPX_TEST_EQ(domains->workers[position], i);
+        HPX_TEST_EQ(domains->domain_of(position), i % 2);
+    }
+
+    // the grouping is cached
+    HPX_TEST(
+        exec_detail::get_numa_domains(pool, 0, num_threads, mask) == domains);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk(std::size_t size)
+{
+    hpx::execution::parallel_executor exec;
+
+    std::vector<std::atomic<std::size_t>> counts(size);
+    for (auto& count : counts)
+    {
+        count.store(0);
+    }
+
+    hpx::parallel::execution::bulk_async_execute(
+        exec, [&](std::size_t i) { ++counts[i]; },
+        hpx::util::counting_shape(size))
+        .get();
+
+    for (auto const& count : counts)
+    {
+        HPX_TEST_EQ(count.load(), std::size_t(1));
+    }
+}
+
+void test_bulk_exception(std::size_t size)
+{
+    hpx::execution::parallel_executor exec;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_async_execute(
+            exec,
+            [&](std::size_t i) {
+                if (i == size / 2)
+                {
+                    throw std::runtime_error("test");
+                }
+            },
+            hpx::util::counting_shape(size))
+            .get();
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), std::size_t(1));
+        for (std::exception_ptr const& ep : e)
+        {
+            try
+            {
+                std::rethrow_exception(ep);
+            }
+            catch (std::runtime_error const&)
+            {
+            }
+            catch (...)
+            {
+                HPX_TEST(false);
+            }
+        }
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    // simulate two NUMA domains, the worker threads alternate between them
+    auto const& rp = hpx::resource::get_partitioner();
+    std::vector<std::size_t> pu_domains(hpx::threads::hardware_concurrency());
+    for (std::size_t i = 0; i != hpx::get_os_thread_count(); ++i)
+    {
+        pu_domains[rp.get_pu_num(i)] = i % 2;
+    }
+
+    exec_detail::set_numa_domain_of_pu([pu_domains](std::size_t pu_num) {
+        return pu_domains[pu_num];
+    });
+
+    test_grouping();
+
+    for (std::size_t size : {std::size_t(1), std::size_t(3), std::size_t(107),
+             std::size_t(10007)})
+    {
+        test_bulk(size);
+        test_bulk_exception(size);
+    }
+
+    // restore the actual NUMA domains
+    exec_detail::set_numa_domain_of_pu({});
+
+    test_bulk(10007);
+    test_bulk_exception(10007);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
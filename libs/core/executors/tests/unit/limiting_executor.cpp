@@ -103,10 +103,56 @@ void test_limit()
     // HPX_TEST_LTE(task_1_max, max1 + hpx::get_num_worker_threads());
 }
 
+// in 'queue' mode the tasks exceeding the limit are queued and launched by the
+// completion of earlier tasks, the submitting thread does not wait
+static atype task_2_counter(0);
+static atype task_2_total(0);
+static atype task_2_max(0);
+static const std::int64_t max2 = 16;
+
+void test_limit_queue()
+{
+    auto exec2 = hpx::execution::parallel_executor(
+        hpx::threads::thread_stacksize::small_);
+
+    constexpr std::size_t num_tasks = 10000;
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    {
+        hpx::execution::experimental::limiting_executor<decltype(exec2)> lexec2(
+            exec2, max2 / 2, max2, true,
+            hpx::execution::experimental::limiting_mode::queue);
+
+        for (std::size_t i = 0; i != num_tasks / 2; ++i)
+        {
+            futures.push_back(
+                hpx::async(lexec2, &test_fn, std::ref(task_2_counter),
+                    std::ref(task_2_total), std::ref(task_2_max)));
+        }
+        for (std::size_t i = 0; i != num_tasks / 2; ++i)
+        {
+            hpx::post(lexec2, &test_fn, std::ref(task_2_counter),
+                std::ref(task_2_total), std::ref(task_2_max));
+        }
+    }
+
+    // the executor blocks until all tasks (including the queued ones) have
+    // completed
+    auto not_ready = std::count_if(
+        futures.begin(), futures.end(), [](auto& f) { return !f.is_ready(); });
+    HPX_TEST_EQ(not_ready, 0);
+    HPX_TEST_EQ(task_2_total, static_cast<std::int64_t>(num_tasks));
+
+    std::cout << "Exec 2 had max " << task_2_max << " (allowed = " << max2
+              << ") from a total of " << task_2_total << std::endl;
+    HPX_TEST_LTE(task_2_max, max2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
     test_limit();
+    test_limit_queue();
 
     return hpx::local::finalize();
 }
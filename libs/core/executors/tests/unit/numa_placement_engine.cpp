@@ -0,0 +1,90 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/executors/numa_placement_engine.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::parallel::execution::numa_placement_engine;
+using hpx::parallel::execution::placement_estimate;
+
+void test_preferred_domain()
+{
+    numa_placement_engine engine(2);
+
+    // the preferred domain is used while the load is balanced
+    HPX_TEST_EQ(engine.place(placement_estimate{10, 1}), 1);
+    HPX_TEST_EQ(engine.load(1), static_cast<std::uint64_t>(10));
+
+    // a task without preference goes to the least loaded domain
+    HPX_TEST_EQ(engine.place(placement_estimate{10, -1}), 0);
+
+    // a large task makes domain 0 overloaded, so the next task preferring
+    // it is placed on domain 1 instead
+    HPX_TEST_EQ(engine.place(placement_estimate{1000, 0}), 0);
+    HPX_TEST_EQ(engine.place(placement_estimate{10, 0}), 1);
+
+    // once the large task has completed, the preference is honored again
+    engine.complete(0, 1000);
+    HPX_TEST_EQ(engine.place(placement_estimate{10, 0}), 0);
+
+    // an invalid domain is treated like no preference
+    HPX_TEST_EQ(engine.place(placement_estimate{10, 5}), 0);
+}
+
+void test_bulk()
+{
+    numa_placement_engine engine(4);
+
+    // tasks with very different costs, the largest tasks are placed first
+    std::vector<placement_estimate> estimates = {{1, -1}, {1000, -1},
+        {10, -1}, {1000, -1}, {100, -1}, {1000, -1}, {1000, -1}, {10, -1}};
+    std::vector<int> domains(estimates.size());
+    engine.place_bulk(estimates.data(), estimates.size(), domains.data());
+
+    // every large task has a domain of its own
+    std::vector<int> large_tasks(4, 0);
+    for (std::size_t i = 0; i != estimates.size(); ++i)
+    {
+        HPX_TEST(domains[i] >= 0 && domains[i] < 4);
+        if (estimates[i].work == 1000)
+        {
+            ++large_tasks[static_cast<std::size_t>(domains[i])];
+        }
+    }
+    for (int count : large_tasks)
+    {
+        HPX_TEST_EQ(count, 1);
+    }
+
+    std::uint64_t total = 0;
+    for (std::size_t d = 0; d != engine.num_domains(); ++d)
+    {
+        HPX_TEST_LTE(engine.load(d), static_cast<std::uint64_t>(1000 + 121));
+        total += engine.load(d);
+    }
+    HPX_TEST_EQ(total, static_cast<std::uint64_t>(4121));
+
+    for (std::size_t i = 0; i != estimates.size(); ++i)
+    {
+        engine.complete(domains[i], estimates[i].work);
+    }
+    for (std::size_t d = 0; d != engine.num_domains(); ++d)
+    {
+        HPX_TEST_EQ(engine.load(d), static_cast<std::uint64_t>(0));
+    }
+}
+
+int main()
+{
+    test_preferred_domain();
+    test_bulk();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This test requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/execution.hpp>
+#include <hpx/executors/task.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+bool runs_stackless()
+{
+    auto* data = hpx::threads::get_self_id_data();
+    return data != nullptr && data->is_stackless();
+}
+
+ex::task<int> answer()
+{
+    co_return 42;
+}
+
+ex::task<int> add(int a)
+{
+    int const b = co_await answer();
+    co_return a + b;
+}
+
+ex::task<> test_symmetric_transfer()
+{
+    // awaiting tasks does not create new threads
+    hpx::thread::id const id = hpx::this_thread::get_id();
+    HPX_TEST_EQ(co_await add(1), 43);
+    HPX_TEST_EQ(hpx::this_thread::get_id(), id);
+}
+
+ex::task<int> test_schedule(ex::thread_pool_scheduler sched)
+{
+    co_await ex::schedule(sched);
+    HPX_TEST(runs_stackless());
+
+    // senders are awaitable as well
+    int const value = co_await ex::just(41);
+    co_return value + 1;
+}
+
+ex::task<int> test_future()
+{
+    hpx::future<int> f = hpx::async([] { return 42; });
+    co_return co_await f;
+}
+
+ex::task<> throw_exception()
+{
+    throw std::runtime_error("test");
+    co_return;
+}
+
+ex::task<bool> test_exception()
+{
+    try
+    {
+        co_await throw_exception();
+    }
+    catch (std::runtime_error const&)
+    {
+        co_return true;
+    }
+    co_return false;
+}
+
+// many concurrent tasks, each resumed on a stackless thread
+ex::task<> increment(ex::thread_pool_scheduler sched, std::atomic<int>& count)
+{
+    co_await ex::schedule(sched);
+    ++count;
+}
+
+ex::task<> test_many(ex::thread_pool_scheduler sched)
+{
+    std::atomic<int> count(0);
+    for (int i = 0; i != 1000; ++i)
+    {
+        co_await increment(sched, count);
+    }
+    HPX_TEST_EQ(count.load(), 1000);
+}
+
+int hpx_main()
+{
+    ex::thread_pool_scheduler sched{};
+
+    tt::sync_wait(test_symmetric_transfer());
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(test_schedule(sched))), 42);
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(test_future())), 42);
+    HPX_TEST(hpx::get<0>(*tt::sync_wait(test_exception())));
+    tt::sync_wait(test_many(sched));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
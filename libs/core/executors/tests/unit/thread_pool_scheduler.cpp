@@ -1713,6 +1713,100 @@ void test_bulk()
     }
 }
 
+template <typename Parameters>
+void test_bulk_parameters(Parameters&& params)
+{
+    std::vector<int> const ns = {0, 1, 10, 43, 10007};
+
+    for (int n : ns)
+    {
+        std::vector<std::atomic<int>> v(n);
+
+        ex::schedule(ex::thread_pool_scheduler{}) |
+            ex::bulk(
+                n, [&](int i) { ++v[i]; }, params) |
+            tt::sync_wait();
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i].load(), 1);
+        }
+    }
+
+    for (int n : ns)
+    {
+        std::vector<int> v(n, -1);
+
+        auto v_out = hpx::get<0>(
+            *(ex::transfer_just(ex::thread_pool_scheduler{}, std::move(v)) |
+                ex::bulk(
+                    n, [](int i, std::vector<int>& v) { v[i] = i; }, params) |
+                tt::sync_wait()));
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v_out[i], i);
+        }
+    }
+
+    // irregular work
+    {
+        int const n = 1000;
+        std::vector<std::atomic<int>> v(n);
+
+        ex::bulk(
+            ex::schedule(ex::thread_pool_scheduler{}), n,
+            [&](int i) {
+                if (i % 100 == 0)
+                {
+                    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                ++v[i];
+            },
+            params) |
+            tt::sync_wait();
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i].load(), 1);
+        }
+    }
+
+    // exceptions are reported the same way as without executor parameters
+    {
+        bool caught_exception = false;
+        try
+        {
+            ex::transfer_just(ex::thread_pool_scheduler{}) |
+                ex::bulk(
+                    100,
+                    [](int i) {
+                        if (i == 3)
+                        {
+                            throw std::runtime_error("error");
+                        }
+                    },
+                    params) |
+                tt::sync_wait();
+        }
+        catch (std::runtime_error const& e)
+        {
+            caught_exception = true;
+            HPX_TEST(std::string(e.what()).find("error") == 0);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+void test_bulk_parameters()
+{
+    test_bulk_parameters(hpx::execution::experimental::static_chunk_size(7));
+    test_bulk_parameters(hpx::execution::experimental::dynamic_chunk_size(3));
+    test_bulk_parameters(hpx::execution::experimental::guided_chunk_size());
+    test_bulk_parameters(hpx::execution::experimental::auto_chunk_size(10));
+    test_bulk_parameters(hpx::execution::experimental::num_cores(2));
+}
+
 void test_completion_scheduler()
 {
     {
@@ -1814,6 +1908,7 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_parameters();
     test_completion_scheduler();
 
     return hpx::local::finalize();
@@ -22,6 +22,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/construct_at.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -70,6 +71,70 @@ namespace hpx::lcos::detail {
     HPX_CORE_EXPORT void set_run_on_completed_error_handler(
         run_on_completed_error_handler_type f);
 
+    ///////////////////////////////////////////////////////////////////////
+    // Continuations attached with an asynchronous launch policy are run
+    // directly on the HPX thread making their future ready (instead of on a
+    // new HPX thread) as long as fewer than the given number of
+    // continuations are already nested on the stack of that thread. A depth
+    // of zero (the default) disables running continuations inline.
+    HPX_CORE_EXPORT void set_inline_continuation_depth(
+        std::size_t depth) noexcept;
+    HPX_CORE_EXPORT std::size_t get_inline_continuation_depth() noexcept;
+
+    // A chain of continuations attached with an asynchronous launch policy
+    // (e.g. f.then(a).then(b)) is fused into a single HPX thread: each
+    // continuation of the chain is run inline by the thread that has run
+    // the continuation it depends on, as long as fewer than the given number
+    // of continuations are already nested on the stack of that thread. A
+    // depth of zero (the default) fuses continuations only as far as they
+    // may be run inline anyways.
+    HPX_CORE_EXPORT void set_fused_continuation_depth(
+        std::size_t depth) noexcept;
+    HPX_CORE_EXPORT std::size_t get_fused_continuation_depth() noexcept;
+
+    // Return whether an asynchronous continuation may be run inline on the
+    // calling thread, this takes into account the nesting depth and the
+    // remaining stack space. Continuations fused with the continuation run
+    // by the calling thread are limited by the larger of both depths.
+    HPX_CORE_EXPORT bool can_run_continuation_inline(
+        bool fused = false) noexcept;
+
+    // Spawners scheduling continuations on the default thread pool allow
+    // for fusing asynchronous continuations, those using arbitrary executors
+    // do not.
+    template <typename Spawner>
+    struct is_fusing_spawner : std::false_type
+    {
+    };
+
+    template <typename Spawner>
+    inline constexpr bool is_fusing_spawner_v =
+        is_fusing_spawner<std::decay_t<Spawner>>::value;
+
+    // Keep track of the nesting depth of continuations run inline
+    struct inline_continuation_scope
+    {
+        inline_continuation_scope() noexcept
+          : count_(threads::get_continuation_recursion_count())
+        {
+            ++count_;
+        }
+
+        inline_continuation_scope(inline_continuation_scope const&) = delete;
+        inline_continuation_scope(inline_continuation_scope&&) = delete;
+        inline_continuation_scope& operator=(
+            inline_continuation_scope const&) = delete;
+        inline_continuation_scope& operator=(
+            inline_continuation_scope&&) = delete;
+
+        ~inline_continuation_scope()
+        {
+            --count_;
+        }
+
+        std::size_t& count_;
+    };
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct future_data;
@@ -277,6 +342,14 @@ namespace hpx::lcos::detail {
 
         virtual void execute_deferred(error_code& /*ec*/ = throws) {}
 
+        // Return whether this shared state is made ready by an asynchronous
+        // continuation that is being run and that continuations attached to
+        // this shared state may be fused with.
+        virtual bool runs_fusable_continuation() const noexcept
+        {
+            return false;
+        }
+
         // cancellation is disabled by default
         virtual bool cancelable() const noexcept
         {
@@ -486,6 +559,10 @@ namespace hpx::lcos::detail {
                     "data has already been set for this future");
             }
 
+#if defined(HPX_HAVE_TASK_TRACING)
+            threads::tracing::future_ready(this);
+#endif
+
             // reset runs_child_ thread id to avoid keeping the thread
             // alive as long as the future
             this->base_type::runs_child_.reset();
@@ -563,6 +640,10 @@ namespace hpx::lcos::detail {
                     "data has already been set for this future");
             }
 
+#if defined(HPX_HAVE_TASK_TRACING)
+            threads::tracing::future_ready(this);
+#endif
+
             // reset runs_child_ thread id to avoid keeping the thread
             // alive as long as the future
             this->base_type::runs_child_.reset();
@@ -782,6 +863,23 @@ namespace hpx::lcos::detail {
         other_allocator alloc_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The shared states for small results that are trivially destructible are
+    // recycled through a thread local cache by default. Larger results are
+    // allocated from the heap to avoid holding on to too much memory.
+    template <typename Result>
+    inline constexpr bool use_cached_shared_state_v = [] {
+        if constexpr (std::is_void_v<Result> || std::is_reference_v<Result>)
+        {
+            return true;
+        }
+        else
+        {
+            return std::is_trivially_destructible_v<Result> &&
+                sizeof(Result) <= HPX_FUTURES_CACHED_SHARED_STATE_MAX_SIZE;
+        }
+    }();
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct timed_future_data : future_data<Result>
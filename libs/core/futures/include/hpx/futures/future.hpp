@@ -506,21 +506,10 @@ namespace hpx::lcos::detail {
         }
 
 #if defined(HPX_HAVE_CXX20_COROUTINES)
-        bool await_ready() const noexcept
+        lcos::detail::future_awaiter<Derived> operator co_await() noexcept
         {
-            return lcos::detail::await_ready(
-                *static_cast<Derived const*>(this));
-        }
-
-        template <typename Promise>
-        void await_suspend(lcos::detail::coroutine_handle<Promise> rh)
-        {
-            lcos::detail::await_suspend(*static_cast<Derived*>(this), rh);
-        }
-
-        decltype(auto) await_resume()
-        {
-            return lcos::detail::await_resume(*static_cast<Derived*>(this));
+            return lcos::detail::future_awaiter<Derived>(
+                *static_cast<Derived*>(this));
         }
 #endif
 
@@ -23,6 +23,7 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -178,6 +179,7 @@ namespace hpx::lcos::detail {
         // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
         explicit continuation(Func&& f)
           : started_(false)
+          , fusing_thread_(nullptr)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
         {
@@ -187,6 +189,7 @@ namespace hpx::lcos::detail {
         continuation(init_no_addref no_addref, Func&& f)
           : base_type(no_addref)
           , started_(false)
+          , fusing_thread_(nullptr)
           , id_(threads::invalid_thread_id)
           , f_(HPX_FORWARD(Func, f))
         {
@@ -227,6 +230,20 @@ namespace hpx::lcos::detail {
             run_impl<Unwrap>(HPX_MOVE(f));
         }
 
+        // Run the continuation such that the continuations attached to it
+        // may be fused with it (i.e. may be run inline by the same thread).
+        // Only continuations that are triggered by this thread while it runs
+        // the continuation are fused, not those attached to the shared state
+        // concurrently by other threads.
+        template <bool Unwrap>
+        void run_fusable(traits::detail::shared_state_ptr_for_t<Future>&& f)
+        {
+            fusing_thread_.store(
+                threads::get_self_id().get(), std::memory_order_relaxed);
+            run_impl<Unwrap>(HPX_MOVE(f));
+            fusing_thread_.store(nullptr, std::memory_order_relaxed);
+        }
+
         template <bool Unwrap, typename Spawner>
         void async(traits::detail::shared_state_ptr_for_t<Future>&& f,
             Spawner&& spawner)
@@ -237,14 +254,38 @@ namespace hpx::lcos::detail {
 
             hpx::intrusive_ptr<continuation> this_(this);
             hpx::threads::thread_description desc(f_, "async");
-            spawner(
-                [this_ = HPX_MOVE(this_), f = HPX_MOVE(f)]() mutable -> void {
-                    this_->template run_impl<Unwrap>(HPX_MOVE(f));
-                },
-                desc, this->runs_child_);
+            if constexpr (is_fusing_spawner_v<Spawner>)
+            {
+                // the spawner runs this continuation inline if it is fused
+                // with the continuation it depends on
+                bool const fused = f->runs_fusable_continuation();
+                spawner(
+                    [this_ = HPX_MOVE(this_),
+                        f = HPX_MOVE(f)]() mutable -> void {
+                        this_->template run_fusable<Unwrap>(HPX_MOVE(f));
+                    },
+                    desc, this->runs_child_, fused);
+            }
+            else
+            {
+                spawner(
+                    [this_ = HPX_MOVE(this_),
+                        f = HPX_MOVE(f)]() mutable -> void {
+                        this_->template run_impl<Unwrap>(HPX_MOVE(f));
+                    },
+                    desc, this->runs_child_);
+            }
         }
 
     public:
+        bool runs_fusable_continuation() const noexcept override
+        {
+            void* const fusing_thread =
+                fusing_thread_.load(std::memory_order_relaxed);
+            return fusing_thread != nullptr &&
+                fusing_thread == threads::get_self_id().get();
+        }
+
         // cancellation support
         bool cancelable() const noexcept override
         {
@@ -342,6 +383,7 @@ namespace hpx::lcos::detail {
 
     protected:
         bool started_;
+        std::atomic<void*> fusing_thread_;
         threads::thread_id_type id_;
         std::decay_t<F> f_;
     };
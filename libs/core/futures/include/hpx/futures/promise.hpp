@@ -10,6 +10,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/errors.hpp>
@@ -35,19 +37,8 @@ namespace hpx {
             using shared_state_type = SharedState;
             using init_no_addref = typename shared_state_type::init_no_addref;
 
-        public:
-            promise_base()
-              : shared_state_(new shared_state_type(init_no_addref{}), false)
-              , future_retrieved_(false)
-              , shared_future_retrieved_(false)
-            {
-            }
-
             template <typename Allocator>
-            promise_base(std::allocator_arg_t, Allocator const& a)
-              : shared_state_()
-              , future_retrieved_(false)
-              , shared_future_retrieved_(false)
+            static shared_state_type* create_shared_state(Allocator const& a)
             {
                 using allocator_shared_state_type =
                     traits::shared_state_allocator_t<SharedState, Allocator>;
@@ -66,7 +57,41 @@ namespace hpx {
                     util::allocator_deleter<other_allocator>{alloc});
 
                 traits::construct(alloc, p.get(), init_no_addref{}, alloc);
-                shared_state_.reset(p.release(), false);
+                return p.release();
+            }
+
+            static shared_state_type* create_shared_state()
+            {
+                // the shared states of small results are recycled through a
+                // thread local cache
+                if constexpr (std::is_same_v<SharedState,
+                                  lcos::detail::future_data<R>> &&
+                    lcos::detail::use_cached_shared_state_v<R>)
+                {
+                    return create_shared_state(
+                        hpx::util::thread_local_caching_allocator<char,
+                            hpx::util::internal_allocator<>>{});
+                }
+                else
+                {
+                    return new shared_state_type(init_no_addref{});
+                }
+            }
+
+        public:
+            promise_base()
+              : shared_state_(create_shared_state(), false)
+              , future_retrieved_(false)
+              , shared_future_retrieved_(false)
+            {
+            }
+
+            template <typename Allocator>
+            promise_base(std::allocator_arg_t, Allocator const& a)
+              : shared_state_(create_shared_state(a), false)
+              , future_retrieved_(false)
+              , shared_future_retrieved_(false)
+            {
             }
 
             promise_base(promise_base&& other) noexcept
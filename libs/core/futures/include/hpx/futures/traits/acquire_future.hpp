@@ -133,9 +133,19 @@ namespace hpx::traits {
             template <typename Range_>
             HPX_FORCEINLINE Range operator()(Range_&& futures) const
             {
-                Range values;
-                transform_future_disp(HPX_FORWARD(Range_, futures), values);
-                return values;
+                // a range passed as an rvalue owns its futures already, its
+                // storage is reused instead of copying the futures
+                if constexpr (std::is_same_v<Range_, Range>)
+                {
+                    return HPX_MOVE(futures);
+                }
+                else
+                {
+                    Range values;
+                    transform_future_disp(
+                        HPX_FORWARD(Range_, futures), values);
+                    return values;
+                }
             }
         };
     }    // namespace detail
@@ -16,6 +16,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/type_support/coroutines_support.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <memory>
@@ -52,30 +53,6 @@ namespace hpx::lcos::detail {
     ///////////////////////////////////////////////////////////////////////////
     // Allow using co_await with an expression which evaluates to
     // hpx::future<T>.
-    template <typename T>
-    HPX_FORCEINLINE bool await_ready(hpx::future<T> const& f) noexcept
-    {
-        return f.is_ready();
-    }
-
-    HPX_HAS_MEMBER_XXX_TRAIT_DEF(set_exception);
-
-    template <typename T, typename Promise,
-        typename = std::enable_if_t<has_set_exception_v<Promise>>>
-    HPX_FORCEINLINE void await_suspend(
-        hpx::future<T>& f, coroutine_handle<Promise> rh)
-    {
-        // f.then([=](future<T> result) {});
-        auto st = traits::detail::get_shared_state(f);
-        st->set_on_completed([st, rh]() mutable {
-            if (st->has_exception())
-            {
-                rh.promise().set_exception(st->get_exception_ptr());
-            }
-            rh();
-        });
-    }
-
     template <typename T>
     HPX_FORCEINLINE T await_resume(hpx::future<T>& f)
     {
@@ -98,32 +75,64 @@ namespace hpx::lcos::detail {
     // Allow using co_await with an expression which evaluates to
     // hpx::shared_future<T>.
     template <typename T>
-    HPX_FORCEINLINE bool await_ready(hpx::shared_future<T> const& f) noexcept
+    HPX_FORCEINLINE T await_resume(hpx::shared_future<T>& f)
     {
-        return f.is_ready();
+        return f.get();
     }
 
-    template <typename T, typename Promise,
-        typename = std::enable_if_t<has_set_exception_v<Promise>>>
-    HPX_FORCEINLINE void await_suspend(
-        hpx::shared_future<T>& f, coroutine_handle<Promise> rh)
+    ///////////////////////////////////////////////////////////////////////////
+    // The awaiter used for co_await on hpx::future<T> and
+    // hpx::shared_future<T>. The awaiting coroutine is resumed directly by
+    // the thread making the future ready (subject to the same recursion and
+    // stack space limits as any other continuation). If the future becomes
+    // ready while the awaiter is being attached, the coroutine continues
+    // without being suspended instead of being resumed from inside
+    // await_suspend.
+    template <typename Future>
+    struct future_awaiter
     {
-        // f.then([=](shared_future<T> result) {})
-        auto st = traits::detail::get_shared_state(f);
-        st->set_on_completed([st, rh]() mutable {
-            if (st->has_exception())
-            {
-                rh.promise().set_exception(st->get_exception_ptr());
-            }
-            rh();
-        });
-    }
+        explicit future_awaiter(Future& f) noexcept
+          : f_(f)
+        {
+        }
 
-    template <typename T>
-    HPX_FORCEINLINE T await_resume(hpx::shared_future<T>& f)
-    {
-        return f.get();
-    }
+        future_awaiter(future_awaiter const&) = delete;
+        future_awaiter(future_awaiter&&) = delete;
+        future_awaiter& operator=(future_awaiter const&) = delete;
+        future_awaiter& operator=(future_awaiter&&) = delete;
+
+        ~future_awaiter() = default;
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return f_.is_ready();
+        }
+
+        template <typename Promise>
+        bool await_suspend(coroutine_handle<Promise> rh)
+        {
+            // whichever of the completion handler and await_suspend finishes
+            // last is responsible for continuing the coroutine, the
+            // completion handler must not touch the awaiter after resuming it
+            auto const& st = traits::detail::get_shared_state(f_);
+            st->set_on_completed([this, rh]() mutable {
+                if (attached_.exchange(true, std::memory_order_acq_rel))
+                {
+                    rh.resume();
+                }
+            });
+            return !attached_.exchange(true, std::memory_order_acq_rel);
+        }
+
+        decltype(auto) await_resume()
+        {
+            return lcos::detail::await_resume(f_);
+        }
+
+    private:
+        Future& f_;
+        std::atomic<bool> attached_{false};
+    };
 
     ///////////////////////////////////////////////////////////////////////////
     // derive from future shared state as this will be combined with the
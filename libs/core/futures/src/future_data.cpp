@@ -19,7 +19,10 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -36,6 +39,65 @@ namespace hpx::lcos::detail {
         run_on_completed_error_handler = HPX_MOVE(f);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<std::size_t> inline_continuation_depth(0);
+
+    void set_inline_continuation_depth(std::size_t depth) noexcept
+    {
+        inline_continuation_depth.store(depth, std::memory_order_relaxed);
+    }
+
+    std::size_t get_inline_continuation_depth() noexcept
+    {
+        return inline_continuation_depth.load(std::memory_order_relaxed);
+    }
+
+    static std::atomic<std::size_t> fused_continuation_depth(
+        HPX_FUSED_CONTINUATION_MAX_DEPTH);
+
+    void set_fused_continuation_depth(std::size_t depth) noexcept
+    {
+        fused_continuation_depth.store(depth, std::memory_order_relaxed);
+    }
+
+    std::size_t get_fused_continuation_depth() noexcept
+    {
+        return fused_continuation_depth.load(std::memory_order_relaxed);
+    }
+
+    bool can_run_continuation_inline(bool fused) noexcept
+    {
+        // fusing continuations only extends the set of continuations that
+        // may be run inline
+        std::size_t const max_depth = fused ?
+            (std::max)(
+                inline_continuation_depth.load(std::memory_order_relaxed),
+                fused_continuation_depth.load(std::memory_order_relaxed)) :
+            inline_continuation_depth.load(std::memory_order_relaxed);
+        if (max_depth == 0)
+        {
+            return false;
+        }
+
+        // never run continuations on threads not managed by HPX, those might
+        // not expect to be blocked by arbitrary user code
+        if (threads::get_self_ptr() == nullptr)
+        {
+            return false;
+        }
+
+        if (threads::get_continuation_recursion_count() >= max_depth)
+        {
+            return false;
+        }
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        return this_thread::has_sufficient_stack_space();
+#else
+        return true;
+#endif
+    }
+
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -359,6 +421,9 @@ namespace hpx::lcos::detail {
             s = state_.load(std::memory_order_relaxed);
             if (s == empty)
             {
+#if defined(HPX_HAVE_TASK_TRACING)
+                threads::tracing::future_wait(this);
+#endif
                 cond_.wait(l, "future_data_base::wait", ec);
                 if (ec)
                 {
@@ -389,6 +454,9 @@ namespace hpx::lcos::detail {
             std::unique_lock l(mtx_);
             if (state_.load(std::memory_order_relaxed) == empty)
             {
+#if defined(HPX_HAVE_TASK_TRACING)
+                threads::tracing::future_wait(this);
+#endif
                 threads::thread_restart_state const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
                 if (ec)
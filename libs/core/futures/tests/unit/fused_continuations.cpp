@@ -0,0 +1,106 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that chains of asynchronous continuations are run by a single thread
+// if enabled, and that long chains of continuations are split across threads.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr std::size_t max_depth = 16;
+constexpr std::size_t chain_length = 10000;
+
+void test_fused_chain()
+{
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+
+    hpx::thread::id ids[3];
+    auto record_id = [&](std::size_t i) {
+        return [&ids, i](hpx::future<void>&&) {
+            ids[i] = hpx::this_thread::get_id();
+        };
+    };
+
+    hpx::future<void> result =
+        f.then(record_id(0)).then(record_id(1)).then(record_id(2));
+
+    p.set_value();
+    result.get();
+
+    // all continuations of the chain were run by the same thread
+    HPX_TEST_NEQ(ids[0], hpx::thread::id());
+    HPX_TEST_EQ(ids[0], ids[1]);
+    HPX_TEST_EQ(ids[1], ids[2]);
+}
+
+void test_fused_exception()
+{
+    hpx::promise<int> p;
+    hpx::future<int> f = p.get_future();
+
+    bool caught_exception = false;
+    hpx::future<int> result =
+        f.then([](hpx::future<int>&& f) -> int {
+             f.get();
+             throw std::runtime_error("test");
+         }).then([](hpx::future<int>&& f) { return f.get() + 1; });
+
+    p.set_value(0);
+    try
+    {
+        result.get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_long_chain()
+{
+    hpx::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+
+    // fusing all of those continuations would overflow the stack
+    for (std::size_t i = 0; i != chain_length; ++i)
+    {
+        f = f.then([](hpx::future<std::size_t>&& f) { return f.get() + 1; });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), chain_length);
+}
+
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::lcos::detail::get_fused_continuation_depth(), max_depth);
+
+    test_fused_chain();
+    test_fused_exception();
+    test_long_chain();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.fused_continuation_depth=" + std::to_string(max_depth)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,101 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that continuations are run inline on the thread making their future
+// ready if enabled, that long chains of continuations fall back to being run
+// on new threads, and that launch policies requesting a specific priority or
+// placement keep running continuations on new threads.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+constexpr std::size_t max_depth = 8;
+constexpr std::size_t chain_length = 10000;
+
+void test_inline()
+{
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+
+    hpx::thread::id continuation_id;
+    hpx::future<void> result =
+        f.then(hpx::launch::async, [&](hpx::future<void>&&) {
+            continuation_id = hpx::this_thread::get_id();
+        });
+
+    // the continuation runs as part of making the future ready
+    p.set_value();
+    HPX_TEST(result.is_ready());
+    HPX_TEST_EQ(continuation_id, hpx::this_thread::get_id());
+}
+
+void test_explicit_policy(hpx::launch policy)
+{
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+
+    hpx::thread::id continuation_id;
+    hpx::future<void> result = f.then(policy, [&](hpx::future<void>&&) {
+        continuation_id = hpx::this_thread::get_id();
+    });
+
+    p.set_value();
+    result.get();
+    HPX_TEST_NEQ(continuation_id, hpx::this_thread::get_id());
+}
+
+void test_long_chain()
+{
+    hpx::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+
+    // nesting all of those continuations would overflow the stack
+    for (std::size_t i = 0; i != chain_length; ++i)
+    {
+        f = f.then(hpx::launch::async,
+            [](hpx::future<std::size_t>&& f) { return f.get() + 1; });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), chain_length);
+}
+
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::lcos::detail::get_inline_continuation_depth(), max_depth);
+
+    test_inline();
+    {
+        hpx::launch policy = hpx::launch::async;
+        policy.set_priority(hpx::threads::thread_priority::high);
+        test_explicit_policy(policy);
+    }
+    {
+        hpx::launch policy = hpx::launch::async;
+        policy.set_hint(hpx::threads::thread_schedule_hint(0));
+        test_explicit_policy(policy);
+    }
+    test_explicit_policy(hpx::launch::fork);
+    test_long_chain();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.inline_continuation_depth=" + std::to_string(max_depth)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
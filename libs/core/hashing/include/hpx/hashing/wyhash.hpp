@@ -0,0 +1,283 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This code is based on wyhash (final version 4) by Wang Yi, which has been
+// released into the public domain: https://github.com/wangyi-fudan/wyhash
+
+/// \file wyhash.hpp
+/// \page hpx::util::wyhash
+/// \headerfile hpx/hashing.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(HPX_MSVC) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#endif
+
+namespace hpx::util {
+
+    namespace detail::wyhash {
+
+        // the default secret of the reference implementation
+        inline constexpr std::uint64_t secret[4] = {0xa0761d6478bd642full,
+            0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+            0x589965cc75374cc3ull};
+
+        // the constants used by the reference implementation of wyhash64
+        inline constexpr std::uint64_t secret64[2] = {
+            0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull};
+
+        // Calculate the 128 bit product of a and b, the lower half is stored
+        // in a, the upper half in b
+        HPX_FORCEINLINE void mum(std::uint64_t& a, std::uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128_t;
+
+            uint128_t const r = static_cast<uint128_t>(a) * b;
+            a = static_cast<std::uint64_t>(r);
+            b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(HPX_MSVC) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            std::uint64_t const ha = a >> 32, hb = b >> 32;
+            std::uint64_t const la = static_cast<std::uint32_t>(a);
+            std::uint64_t const lb = static_cast<std::uint32_t>(b);
+
+            std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la,
+                                rl = la * lb;
+            std::uint64_t const t = rl + (rm0 << 32);
+            std::uint64_t c = t < rl;
+            std::uint64_t const lo = t + (rm1 << 32);
+            c += lo < t;
+
+            a = lo;
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+        }
+
+        HPX_FORCEINLINE std::uint64_t mix(
+            std::uint64_t a, std::uint64_t b) noexcept
+        {
+            mum(a, b);
+            return a ^ b;
+        }
+
+        // The reads use the native byte order, the hash values are therefore
+        // not the same on little and big endian machines
+        HPX_FORCEINLINE std::uint64_t read8(unsigned char const* p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        HPX_FORCEINLINE std::uint64_t read4(unsigned char const* p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        // read one to three bytes
+        HPX_FORCEINLINE std::uint64_t read3(
+            unsigned char const* p, std::size_t k) noexcept
+        {
+            return (static_cast<std::uint64_t>(p[0]) << 16) |
+                (static_cast<std::uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+        }
+    }    // namespace detail::wyhash
+
+    /// Calculate the 64 bit hash of the \a len bytes starting at \a key.
+    ///
+    /// Keys of up to 16 bytes are hashed without any loop. Longer keys are
+    /// processed in blocks of 48 bytes, which are split into three
+    /// independent lanes of 16 bytes each. The lanes do not depend on each
+    /// other, which allows the processor to execute their multiplications in
+    /// parallel.
+    [[nodiscard]] inline std::uint64_t wyhash(
+        void const* key, std::size_t len, std::uint64_t seed = 0) noexcept
+    {
+        using namespace detail::wyhash;
+
+        auto const* p = static_cast<unsigned char const*>(key);
+        seed ^= mix(seed ^ secret[0], secret[1]);
+
+        std::uint64_t a, b;
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                std::size_t const k = (len >> 3) << 2;
+                a = (read4(p) << 32) | read4(p + k);
+                b = (read4(p + len - 4) << 32) | read4(p + len - 4 - k);
+            }
+            else if (len > 0)
+            {
+                a = read3(p, len);
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            std::size_t i = len;
+            if (i > 48)
+            {
+                std::uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                    see1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ see1);
+                    see2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+
+            while (i > 16)
+            {
+                seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+
+            a = read8(p + i - 16);
+            b = read8(p + i - 8);
+        }
+
+        a ^= secret[1];
+        b ^= seed;
+        mum(a, b);
+        return mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+
+    /// Calculate the 64 bit hash of a key consisting of the two words \a a
+    /// and \a b (for instance a global id).
+    [[nodiscard]] inline std::uint64_t wyhash64(
+        std::uint64_t a, std::uint64_t b) noexcept
+    {
+        using namespace detail::wyhash;
+
+        a ^= secret64[0];
+        b ^= secret64[1];
+        mum(a, b);
+        return mix(a ^ secret64[0], b ^ secret64[1]);
+    }
+
+    /// Calculate the hashes of the \a count strings starting at \a keys and
+    /// store them in \a out. This gives the same results as calling wyhash
+    /// for every string.
+    inline void wyhash_batch(std::string_view const* keys, std::size_t count,
+        std::uint64_t* out, std::uint64_t seed = 0) noexcept
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            out[i] = wyhash(keys[i].data(), keys[i].size(), seed);
+        }
+    }
+
+    /// Calculate the hashes of the \a count integers starting at \a keys and
+    /// store them in \a out. This gives the same results as calling
+    /// wyhash64(keys[i], seed) for every key.
+    inline void wyhash_batch(std::uint64_t const* keys, std::size_t count,
+        std::uint64_t* out, std::uint64_t seed = 0) noexcept
+    {
+        // the keys are hashed four at a time, the calculations for the keys
+        // are independent and can be overlapped (or vectorized) by the
+        // compiler
+        std::size_t i = 0;
+        for (/**/; i + 4 <= count; i += 4)
+        {
+            std::uint64_t const h0 = wyhash64(keys[i], seed);
+            std::uint64_t const h1 = wyhash64(keys[i + 1], seed);
+            std::uint64_t const h2 = wyhash64(keys[i + 2], seed);
+            std::uint64_t const h3 = wyhash64(keys[i + 3], seed);
+            out[i] = h0;
+            out[i + 1] = h1;
+            out[i + 2] = h2;
+            out[i + 3] = h3;
+        }
+        for (/**/; i != count; ++i)
+        {
+            out[i] = wyhash64(keys[i], seed);
+        }
+    }
+
+    /// Calculate the hashes of the \a count two word keys \a msbs[i] and
+    /// \a lsbs[i] (for instance the parts of global ids) and store them in
+    /// \a out. This gives the same results as calling wyhash64 for every
+    /// key.
+    inline void wyhash_batch(std::uint64_t const* msbs,
+        std::uint64_t const* lsbs, std::size_t count,
+        std::uint64_t* out) noexcept
+    {
+        std::size_t i = 0;
+        for (/**/; i + 4 <= count; i += 4)
+        {
+            std::uint64_t const h0 = wyhash64(msbs[i], lsbs[i]);
+            std::uint64_t const h1 = wyhash64(msbs[i + 1], lsbs[i + 1]);
+            std::uint64_t const h2 = wyhash64(msbs[i + 2], lsbs[i + 2]);
+            std::uint64_t const h3 = wyhash64(msbs[i + 3], lsbs[i + 3]);
+            out[i] = h0;
+            out[i + 1] = h1;
+            out[i + 2] = h2;
+            out[i + 3] = h3;
+        }
+        for (/**/; i != count; ++i)
+        {
+            out[i] = wyhash64(msbs[i], lsbs[i]);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A (transparent) hash function object for strings, integers and
+    /// enumerations based on wyhash. It can be used as the hash function of
+    /// the unordered containers.
+    struct wyhasher
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(std::string_view s) const noexcept
+        {
+            return static_cast<std::size_t>(wyhash(s.data(), s.size()));
+        }
+
+        [[nodiscard]] std::size_t operator()(
+            std::string const& s) const noexcept
+        {
+            return static_cast<std::size_t>(wyhash(s.data(), s.size()));
+        }
+
+        [[nodiscard]] std::size_t operator()(char const* s) const noexcept
+        {
+            return static_cast<std::size_t>(wyhash(s, std::strlen(s)));
+        }
+
+        template <typename T,
+            typename Enable =
+                std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+        [[nodiscard]] std::size_t operator()(T value) const noexcept
+        {
+            return static_cast<std::size_t>(
+                wyhash64(static_cast<std::uint64_t>(value), 0));
+        }
+    };
+}    // namespace hpx::util
@@ -0,0 +1,150 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/config/endian.hpp>
+#include <hpx/hashing/wyhash.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The test vectors published with the reference implementation (wyhash final
+// version 4, test_vector.cpp), the seed is the index of the message. The
+// reference reads the keys in the native byte order, the values apply to
+// little endian machines only.
+struct test_vector
+{
+    char const* message;
+    std::uint64_t hash;
+};
+
+constexpr test_vector test_vectors[] = {
+    {"", 0x0409638ee2bde459ull},
+    {"a", 0xa8412d091b5fe0a9ull},
+    {"abc", 0x32dd92e4b2915153ull},
+    {"message digest", 0x8619124089a3a16bull},
+    {"abcdefghijklmnopqrstuvwxyz", 0x7a43afb61d7f5f40ull},
+    {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        0xff42329b90e50d58ull},
+    {"123456789012345678901234567890123456789012345678901234567890123456789"
+     "01234567890",
+        0xc39cab13b115aad3ull},
+};
+
+void test_reference_vectors()
+{
+    if constexpr (hpx::endian::native != hpx::endian::little)
+    {
+        return;
+    }
+
+    std::uint64_t seed = 0;
+    for (test_vector const& v : test_vectors)
+    {
+        HPX_TEST_EQ(
+            hpx::util::wyhash(v.message, std::strlen(v.message), seed), v.hash);
+        ++seed;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Keys of all lengths covering the short paths and the 16 and 48 byte blocks
+std::vector<std::string> make_keys()
+{
+    std::vector<std::string> keys;
+    for (std::size_t len = 0; len != 150; ++len)
+    {
+        std::string key(len, '\0');
+        for (std::size_t i = 0; i != len; ++i)
+        {
+            key[i] = static_cast<char>((len * 31 + i * 7) & 0xff);
+        }
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+void test_batch_strings()
+{
+    std::vector<std::string> const keys = make_keys();
+    std::vector<std::string_view> const views(keys.begin(), keys.end());
+
+    for (std::uint64_t seed : {std::uint64_t(0), std::uint64_t(42)})
+    {
+        std::vector<std::uint64_t> hashes(views.size());
+        hpx::util::wyhash_batch(
+            views.data(), views.size(), hashes.data(), seed);
+
+        for (std::size_t i = 0; i != views.size(); ++i)
+        {
+            HPX_TEST_EQ(hashes[i],
+                hpx::util::wyhash(views[i].data(), views[i].size(), seed));
+        }
+    }
+}
+
+void test_batch_integers()
+{
+    // counts which are not a multiple of the batch width exercise the
+    // remainder loop
+    for (std::size_t count :
+        {std::size_t(0), std::size_t(1), std::size_t(3), std::size_t(4),
+            std::size_t(5), std::size_t(17)})
+    {
+        std::vector<std::uint64_t> keys(count);
+        std::vector<std::uint64_t> lsbs(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            keys[i] = i * 0x9e3779b97f4a7c15ull;
+            lsbs[i] = ~keys[i] + i;
+        }
+
+        std::vector<std::uint64_t> hashes(count);
+        hpx::util::wyhash_batch(keys.data(), count, hashes.data(), 42);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(hashes[i], hpx::util::wyhash64(keys[i], 42));
+        }
+
+        hpx::util::wyhash_batch(
+            keys.data(), lsbs.data(), count, hashes.data());
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_TEST_EQ(hashes[i], hpx::util::wyhash64(keys[i], lsbs[i]));
+        }
+    }
+}
+
+void test_wyhasher()
+{
+    hpx::util::wyhasher const hasher;
+
+    std::string const s("message digest");
+    std::size_t const h = hasher(s);
+    HPX_TEST_EQ(h, hasher(std::string_view(s)));
+    HPX_TEST_EQ(h, hasher(s.c_str()));
+    HPX_TEST_EQ(h,
+        static_cast<std::size_t>(hpx::util::wyhash(s.data(), s.size())));
+
+    HPX_TEST_EQ(
+        hasher(42), static_cast<std::size_t>(hpx::util::wyhash64(42, 0)));
+}
+
+int main()
+{
+    test_reference_vectors();
+    test_batch_strings();
+    test_batch_integers();
+    test_wyhasher();
+
+    return hpx::util::report_errors();
+}
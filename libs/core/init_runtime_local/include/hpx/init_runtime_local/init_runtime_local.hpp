@@ -78,6 +78,16 @@ namespace hpx {
                 std::reference_wrapper<hpx::runtime const> rt_;
             };
 
+#if defined(HPX_HAVE_LOCK_PROFILING)
+            // Enable lock profiling if hpx.lock_profiling.enable is set
+            HPX_CORE_EXPORT void activate_lock_profiling(
+                hpx::util::runtime_configuration const& cfg);
+
+            // Print the locks with the longest wait times at shutdown (see
+            // hpx.lock_profiling.report)
+            HPX_CORE_EXPORT void add_lock_profiling_report(hpx::runtime& rt);
+#endif
+
             // Default params to initialize the init_params struct
             [[maybe_unused]] static int dummy_argc = 1;
             [[maybe_unused]] static char app_name[256] = HPX_APPLICATION_STRING;
@@ -11,10 +11,12 @@
 #include <hpx/logging/config/defines.hpp>
 
 #include <hpx/init_runtime_local/detail/init_logging.hpp>
+#include <hpx/logging/async_backend.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/get_worker_thread_num.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -962,6 +964,13 @@ namespace hpx::util {
             init_hpx_console_log(ini);
             init_app_console_log(ini);
             init_debuglog_console_log(ini);
+
+            // write the log records from a background thread, if requested
+            if (get_entry_as<int>(ini, "hpx.logging.async", 0) != 0)
+            {
+                logging::start_async_backend(get_entry_as<std::size_t>(
+                    ini, "hpx.logging.async_buffer_size", 1024));
+            }
         }
 
         void init_logging_local(runtime_configuration& ini)
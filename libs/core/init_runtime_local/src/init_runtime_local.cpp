@@ -18,6 +18,7 @@
 #include <hpx/init_runtime_local/detail/init_logging.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/lock_registration/lock_profiling.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/filesystem.hpp>
 #include <hpx/modules/format.hpp>
@@ -42,6 +43,9 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/preemption.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -50,8 +54,10 @@
 #include <cstdlib>
 #endif
 
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
@@ -237,6 +243,42 @@ namespace hpx {
         ///////////////////////////////////////////////////////////////////////////
         namespace detail {
 
+#if defined(HPX_HAVE_LOCK_PROFILING)
+            ///////////////////////////////////////////////////////////////////////
+            void activate_lock_profiling(
+                hpx::util::runtime_configuration const& cfg)
+            {
+                if (hpx::util::get_entry_as<int>(
+                        cfg, "hpx.lock_profiling.enable", 0) == 0)
+                {
+                    return;
+                }
+
+                util::set_lock_profiling_description_handler([]() {
+                    threads::thread_id_type const id = threads::get_self_id();
+                    if (!id)
+                    {
+                        return std::string("<non-HPX thread>");
+                    }
+                    return threads::as_string(
+                        threads::get_thread_description(id));
+                });
+                util::enable_lock_profiling();
+            }
+
+            void add_lock_profiling_report(hpx::runtime& rt)
+            {
+                auto const max_locks = hpx::util::get_entry_as<std::size_t>(
+                    rt.get_config(), "hpx.lock_profiling.report", 20);
+                if (util::lock_profiling_enabled() && max_locks != 0)
+                {
+                    rt.add_shutdown_function([max_locks]() {
+                        util::print_lock_profiles(std::cerr, max_locks);
+                    });
+                }
+            }
+#endif
+
             ///////////////////////////////////////////////////////////////////////
             void activate_global_options(
                 local::detail::command_line_handling& cmdline)
@@ -245,7 +287,18 @@ namespace hpx {
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+                threads::coroutines::detail::posix::configure_stack_pool(
+                    cmdline.rtcfg_.get_stack_pool_parameters());
 #endif
+                // the stack size selection relies on the recorded stack usage,
+                // it only needs to know about threads coming close to exhausting
+                // their stacks though
+                bool const track_usage = hpx::util::get_entry_as<int>(
+                    cmdline.rtcfg_, "hpx.stacks.track_usage", 0) != 0;
+                bool const auto_select = hpx::util::get_entry_as<int>(
+                    cmdline.rtcfg_, "hpx.stacks.auto_select", 0) != 0;
+                threads::enable_stack_usage_tracking(
+                    track_usage || auto_select, !track_usage);
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
                 {
@@ -258,6 +311,9 @@ namespace hpx {
                     util::disable_lock_detection();
                 }
 #endif
+#ifdef HPX_HAVE_LOCK_PROFILING
+                activate_lock_profiling(cmdline.rtcfg_);
+#endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
                 threads::policies::set_minimal_deadlock_detection_enabled(
                     cmdline.rtcfg_.enable_minimal_deadlock_detection());
@@ -293,6 +349,10 @@ namespace hpx {
                 if (!!shutdown)
                     rt.add_shutdown_function(HPX_MOVE(shutdown));
 
+#if defined(HPX_HAVE_LOCK_PROFILING)
+                add_lock_profiling_report(rt);
+#endif
+
                 if (vm.count("hpx:dump-config-initial"))
                 {
                     std::cout << "Configuration after runtime construction:\n";
@@ -391,6 +451,17 @@ namespace hpx {
                     [](std::exception_ptr const& e) {
                         hpx::detail::report_exception_and_terminate(e);
                     });
+                hpx::lcos::detail::set_inline_continuation_depth(
+                    hpx::util::get_entry_as<std::size_t>(
+                        cfg, "hpx.inline_continuation_depth", 0));
+                hpx::lcos::detail::set_fused_continuation_depth(
+                    hpx::util::get_entry_as<std::size_t>(cfg,
+                        "hpx.fused_continuation_depth",
+                        HPX_FUSED_CONTINUATION_MAX_DEPTH));
+                hpx::threads::set_preemption_time_slice(
+                    std::chrono::microseconds(
+                        hpx::util::get_entry_as<std::int64_t>(
+                            cfg, "hpx.preemption_time_slice", 0)));
 #if defined(HPX_HAVE_VERIFY_LOCKS)
                 hpx::util::set_registered_locks_error_handler(
                     &hpx::detail::registered_locks_error_handler);
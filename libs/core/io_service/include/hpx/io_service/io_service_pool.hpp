@@ -18,6 +18,7 @@
 #include <winsock2.h>
 #endif
 #include <asio/io_context.hpp>
+#include <asio/post.hpp>
 
 // The boost asio support includes termios.h. The termios.h file on ppc64le
 // defines these macros, which are also used by blaze, blaze_tensor as Template
@@ -25,6 +26,8 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -90,6 +93,27 @@ namespace hpx::util {
         /// \brief Get an io_service to use.
         asio::io_context& get_io_service(int index = -1);
 
+        /// \brief Post the given function to one of the io_service objects.
+        ///
+        /// If the pool is elastic (see \a set_max_size), additional threads
+        /// are started whenever the posted functions pile up. Those threads
+        /// exit again after being idle for a while.
+        template <typename F>
+        void post(F&& f)
+        {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            asio::post(get_io_service(),
+                [this, f = HPX_FORWARD(F, f)]() mutable {
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    f();
+                });
+
+            if (max_size_ > pool_size_)
+            {
+                grow_if_needed();
+            }
+        }
+
         /// \brief access underlying thread handle
         std::thread& get_os_thread_handle(std::size_t thread_num);
 
@@ -99,6 +123,26 @@ namespace hpx::util {
             return pool_size_;
         }
 
+        /// \brief Set the number of threads this pool may grow to under load,
+        ///        values smaller than size() disable the growing
+        void set_max_size(std::size_t max_size) noexcept
+        {
+            max_size_ = max_size;
+        }
+
+        /// \brief Get the number of threads this pool may grow to under load
+        std::size_t max_size() const noexcept
+        {
+            return (std::max)(max_size_, pool_size_);
+        }
+
+        /// \brief Get the number of threads currently running in this pool,
+        ///        including the ones started because of the load
+        std::size_t num_active_threads() const noexcept
+        {
+            return active_threads_.load(std::memory_order_relaxed);
+        }
+
         /// \brief Activate the thread \a index for this thread pool
         void thread_run(std::size_t index, barrier* startup = nullptr) const;
 
@@ -119,6 +163,18 @@ namespace hpx::util {
         void wait_locked();
 
     private:
+        // start an additional thread if the pending work piles up
+        void grow_if_needed();
+
+        struct elastic_thread
+        {
+            std::thread thread_;
+            std::atomic<bool> done_{false};
+        };
+
+        void elastic_thread_run(std::size_t index, std::size_t thread_num,
+            elastic_thread* self);
+
         using io_service_ptr = std::unique_ptr<asio::io_context>;
         using work_type = std::unique_ptr<asio::io_context::work>;
 
@@ -159,6 +215,19 @@ namespace hpx::util {
         // Barriers for waiting for work to finish on all worker threads
         std::unique_ptr<barrier> wait_barrier_;
         std::unique_ptr<barrier> continue_barrier_;
+
+        /// maximal number of OS threads to execute in this pool
+        std::size_t max_size_ = 0;
+
+        /// the number of functions posted but not started yet
+        std::atomic<std::size_t> pending_{0};
+
+        /// the number of running OS threads
+        std::atomic<std::size_t> active_threads_{0};
+
+        /// the threads started because of the load
+        std::vector<std::unique_ptr<elastic_thread>> elastic_threads_;
+        std::size_t next_elastic_thread_num_ = 0;
     };
 }    // namespace hpx::util
 
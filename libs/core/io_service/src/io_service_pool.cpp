@@ -18,6 +18,7 @@
 
 #include <asio/io_context.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -27,6 +28,13 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    namespace {
+
+        // threads started because of the load exit after being idle for
+        // this long
+        constexpr std::chrono::milliseconds elastic_idle_timeout(100);
+    }    // namespace
+
     io_service_pool::io_service_pool(std::size_t pool_size,
         threads::policies::callback_notifier const& notifier,
         char const* pool_name, char const* name_postfix)
@@ -192,7 +200,9 @@ namespace hpx::util {
         }
 
         next_io_service_ = 0;
+        next_elastic_thread_num_ = 0;
         stopped_ = false;
+        active_threads_.store(num_threads, std::memory_order_relaxed);
 
         HPX_ASSERT(pool_size_ == io_services_.size());
         HPX_ASSERT(threads_.size() == io_services_.size());
@@ -216,6 +226,76 @@ namespace hpx::util {
         for (auto& thread : threads_)
             thread.join();
         threads_.clear();
+
+        for (auto& elastic : elastic_threads_)
+            elastic->thread_.join();
+        elastic_threads_.clear();
+
+        active_threads_.store(0, std::memory_order_relaxed);
+    }
+
+    void io_service_pool::grow_if_needed()
+    {
+        std::size_t const active =
+            active_threads_.load(std::memory_order_relaxed);
+        if (active >= max_size_ ||
+            pending_.load(std::memory_order_relaxed) <= active)
+        {
+            return;
+        }
+
+        // never block the thread posting the work
+        std::unique_lock<std::mutex> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock() || stopped_ || threads_.empty() ||
+            active_threads_.load(std::memory_order_relaxed) >= max_size_)
+        {
+            return;
+        }
+
+        // reap the threads which have exited in the meantime
+        for (auto it = elastic_threads_.begin(); it != elastic_threads_.end();)
+        {
+            if ((*it)->done_.load(std::memory_order_acquire))
+            {
+                (*it)->thread_.join();
+                it = elastic_threads_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // the additional threads are distributed over the io_services in a
+        // round-robin fashion, they are numbered after the regular threads
+        std::size_t const thread_num = pool_size_ + next_elastic_thread_num_++;
+        std::size_t const index = thread_num % pool_size_;
+
+        auto elastic = std::make_unique<elastic_thread>();
+        active_threads_.fetch_add(1, std::memory_order_relaxed);
+        elastic->thread_ = std::thread(&io_service_pool::elastic_thread_run,
+            this, index, thread_num, elastic.get());
+        elastic_threads_.emplace_back(HPX_MOVE(elastic));
+    }
+
+    void io_service_pool::elastic_thread_run(
+        std::size_t index, std::size_t thread_num, elastic_thread* self)
+    {
+        notifier_.on_start_thread(
+            thread_num, thread_num, pool_name_, pool_name_postfix_);
+
+        // keep running as long as there is work to do, this returns 0 if the
+        // thread was idle for too long or if the io_service was stopped
+        asio::io_context& io_service = *io_services_[index];
+        while (io_service.run_one_for(elastic_idle_timeout) != 0)
+        {
+        }
+
+        notifier_.on_stop_thread(
+            thread_num, thread_num, pool_name_, pool_name_postfix_);
+
+        active_threads_.fetch_sub(1, std::memory_order_relaxed);
+        self->done_.store(true, std::memory_order_release);
     }
 
     void io_service_pool::stop()
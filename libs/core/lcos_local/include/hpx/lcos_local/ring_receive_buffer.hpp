@@ -0,0 +1,338 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file ring_receive_buffer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/no_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lcos::local {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A receive buffer which maps the generation steps onto a fixed number
+        // of preallocated slots (step % window). The shared state of a slot is
+        // reused once the previous future handed out for it has been released,
+        // receiving and storing values therefore does not allocate memory in
+        // the steady state.
+        template <typename T, typename Mutex>
+        class ring_receive_buffer_base
+        {
+        protected:
+            using mutex_type = Mutex;
+
+            struct slot_state : lcos::detail::future_data<T>
+            {
+                using base_type = lcos::detail::future_data<T>;
+                using init_no_addref = typename base_type::init_no_addref;
+
+                slot_state() noexcept
+                  : base_type(init_no_addref{})
+                {
+                }
+
+                // the slot holds the only reference to the shared state
+                bool is_unique() const noexcept
+                {
+                    return this->count_ == 1;
+                }
+            };
+
+            using slot_state_ptr = hpx::intrusive_ptr<slot_state>;
+
+            struct slot
+            {
+                slot_state_ptr state;
+                std::size_t step = 0;
+                bool in_use = false;
+                bool future_retrieved = false;
+                bool value_set = false;
+            };
+
+        public:
+            explicit ring_receive_buffer_base(std::size_t window)
+              : slots_(window)
+            {
+                if (window == 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "ring_receive_buffer::ring_receive_buffer",
+                        "the receive window must not be empty");
+                }
+
+                for (slot& s : slots_)
+                {
+                    s.state = slot_state_ptr(new slot_state(), false);
+                }
+            }
+
+            ~ring_receive_buffer_base()
+            {
+                HPX_ASSERT(active_ == 0);
+            }
+
+            ring_receive_buffer_base(ring_receive_buffer_base&& other) noexcept
+              : slots_(HPX_MOVE(other.slots_))
+              , active_(other.active_)
+            {
+                other.active_ = 0;
+            }
+
+            ring_receive_buffer_base& operator=(
+                ring_receive_buffer_base&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    slots_ = HPX_MOVE(other.slots_);
+                    active_ = other.active_;
+                    other.active_ = 0;
+                }
+                return *this;
+            }
+
+            hpx::future<T> receive(std::size_t step)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                return receive_locked(step);
+            }
+
+            // Retrieve the futures for the consecutive steps
+            // [first_step, first_step + count) while acquiring the lock only
+            // once.
+            template <typename OutIter>
+            OutIter receive(std::size_t first_step, std::size_t count,
+                OutIter dest)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    *dest++ = receive_locked(first_step + i);
+                }
+                return dest;
+            }
+
+            bool try_receive(std::size_t step, hpx::future<T>* f = nullptr)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                slot& s = slots_[step % slots_.size()];
+                if (!s.in_use || s.step != step)
+                {
+                    return false;
+                }
+
+                if (f != nullptr)
+                {
+                    *f = retrieve_future(s);
+                }
+                return true;
+            }
+
+            bool empty() const noexcept
+            {
+                return active_ == 0;
+            }
+
+            std::size_t window_size() const noexcept
+            {
+                return slots_.size();
+            }
+
+            // return the number of released buffer entries
+            std::size_t cancel_waiting(
+                std::exception_ptr const& e, bool force_delete_entries = false)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                std::size_t count = 0;
+                for (slot& s : slots_)
+                {
+                    if (!s.in_use)
+                    {
+                        continue;
+                    }
+
+                    if (!s.value_set)
+                    {
+                        s.state->set_exception(e);
+                    }
+                    else if (!force_delete_entries)
+                    {
+                        continue;
+                    }
+
+                    release(s);
+                    ++count;
+                }
+                return count;
+            }
+
+        protected:
+            template <typename Lock, typename... Ts>
+            void store(std::size_t step, Lock* lock, Ts&&... ts)
+            {
+                slot_state_ptr state;
+
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+
+                    slot& s = get_slot(step);
+                    HPX_ASSERT_LOCKED(l, !s.value_set);
+
+                    // keep the shared state alive (and prevent it from being
+                    // reused) until the value was set
+                    state = s.state;
+                    s.value_set = true;
+                    if (s.future_retrieved)
+                    {
+                        release(s);
+                    }
+                }
+
+                if (lock)
+                    lock->unlock();
+
+                // set the value, but only after the lock went out of scope
+                state->set_value(HPX_FORWARD(Ts, ts)...);
+            }
+
+        private:
+            hpx::future<T> receive_locked(std::size_t step)
+            {
+                return retrieve_future(get_slot(step));
+            }
+
+            hpx::future<T> retrieve_future(slot& s)
+            {
+                if (s.future_retrieved)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::future_already_retrieved,
+                        "ring_receive_buffer::receive",
+                        "the future for this step has already been retrieved");
+                }
+
+                auto f =
+                    hpx::traits::future_access<hpx::future<T>>::create(s.state);
+
+                s.future_retrieved = true;
+                if (s.value_set)
+                {
+                    release(s);
+                }
+                return f;
+            }
+
+            // return the slot holding the given step, (re-)activate it if
+            // necessary
+            slot& get_slot(std::size_t step)
+            {
+                slot& s = slots_[step % slots_.size()];
+                if (s.in_use)
+                {
+                    if (s.step != step)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                            "ring_receive_buffer::get_slot",
+                            "the step is outside of the receive window, the "
+                            "slot is still in use by step {}",
+                            s.step);
+                    }
+                    return s;
+                }
+
+                if (s.state->is_unique())
+                {
+                    s.state->reset();
+                }
+                else
+                {
+                    // a future from the previous use of this slot is still
+                    // alive, the shared state can't be reused
+                    s.state = slot_state_ptr(new slot_state(), false);
+                }
+
+                s.step = step;
+                s.in_use = true;
+                s.future_retrieved = false;
+                s.value_set = false;
+                ++active_;
+
+                return s;
+            }
+
+            void release(slot& s) noexcept
+            {
+                HPX_ASSERT(s.in_use && active_ != 0);
+                s.in_use = false;
+                --active_;
+            }
+
+            mutable mutex_type mtx_;
+            std::vector<slot> slots_;
+            std::size_t active_ = 0;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A receive buffer for a bounded number of outstanding generation steps.
+    /// Other than \a receive_buffer, which allocates a new entry for each
+    /// step, the steps are mapped onto a fixed window of preallocated slots.
+    /// At most \a window consecutive steps can be outstanding at any time;
+    /// using a step which maps onto a slot still in use by a different step
+    /// throws \a hpx::error::invalid_status.
+    template <typename T, typename Mutex = hpx::spinlock>
+    class ring_receive_buffer
+      : public detail::ring_receive_buffer_base<T, Mutex>
+    {
+        using base_type = detail::ring_receive_buffer_base<T, Mutex>;
+
+    public:
+        explicit ring_receive_buffer(std::size_t window)
+          : base_type(window)
+        {
+        }
+
+        template <typename Lock = hpx::no_mutex>
+        void store_received(std::size_t step, T&& val, Lock* lock = nullptr)
+        {
+            this->store(step, lock, HPX_MOVE(val));
+        }
+    };
+
+    template <typename Mutex>
+    class ring_receive_buffer<void, Mutex>
+      : public detail::ring_receive_buffer_base<void, Mutex>
+    {
+        using base_type = detail::ring_receive_buffer_base<void, Mutex>;
+
+    public:
+        explicit ring_receive_buffer(std::size_t window)
+          : base_type(window)
+        {
+        }
+
+        template <typename Lock = hpx::no_mutex>
+        void store_received(std::size_t step, Lock* lock = nullptr)
+        {
+            this->store(step, lock);
+        }
+    };
+}    // namespace hpx::lcos::local
@@ -0,0 +1,187 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lcos_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+using hpx::lcos::local::ring_receive_buffer;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_receive_store()
+{
+    ring_receive_buffer<int> buffer(4);
+    HPX_TEST_EQ(buffer.window_size(), std::size_t(4));
+    HPX_TEST(buffer.empty());
+
+    // receive before store and store before receive, several laps around
+    // the window
+    for (std::size_t step = 0; step != 100; ++step)
+    {
+        if (step % 2 == 0)
+        {
+            hpx::future<int> f = buffer.receive(step);
+            HPX_TEST(!f.is_ready());
+            buffer.store_received(step, static_cast<int>(step));
+            HPX_TEST_EQ(f.get(), static_cast<int>(step));
+        }
+        else
+        {
+            buffer.store_received(step, static_cast<int>(step));
+            HPX_TEST_EQ(buffer.receive(step).get(), static_cast<int>(step));
+        }
+        HPX_TEST(buffer.empty());
+    }
+
+    // futures kept alive across laps don't see values of later steps
+    std::vector<hpx::future<int>> futures;
+    for (std::size_t step = 0; step != 12; ++step)
+    {
+        buffer.store_received(step, static_cast<int>(step));
+        futures.push_back(buffer.receive(step));
+    }
+    for (std::size_t step = 0; step != 12; ++step)
+    {
+        HPX_TEST_EQ(futures[step].get(), static_cast<int>(step));
+    }
+    HPX_TEST(buffer.empty());
+}
+
+void test_window()
+{
+    ring_receive_buffer<int> buffer(2);
+
+    hpx::future<int> f0 = buffer.receive(0);
+    hpx::future<int> f1 = buffer.receive(1);
+
+    // step 2 maps onto the slot still used by step 0
+    bool caught_exception = false;
+    try
+    {
+        buffer.store_received(2, 2);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    HPX_TEST(buffer.try_receive(0));
+    HPX_TEST(!buffer.try_receive(2));
+
+    buffer.store_received(0, 0);
+    buffer.store_received(2, 2);
+    HPX_TEST_EQ(f0.get(), 0);
+    HPX_TEST_EQ(buffer.receive(2).get(), 2);
+
+    buffer.store_received(1, 1);
+    HPX_TEST_EQ(f1.get(), 1);
+    HPX_TEST(buffer.empty());
+}
+
+void test_batched_receive()
+{
+    ring_receive_buffer<int> buffer(8);
+
+    std::vector<hpx::future<int>> futures;
+    buffer.receive(10, 8, std::back_inserter(futures));
+    HPX_TEST_EQ(futures.size(), std::size_t(8));
+
+    for (std::size_t step = 17; step >= 10; --step)
+    {
+        buffer.store_received(step, static_cast<int>(step));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), static_cast<int>(i + 10));
+    }
+    HPX_TEST(buffer.empty());
+}
+
+void test_cancel()
+{
+    ring_receive_buffer<void> buffer(4);
+
+    hpx::future<void> f0 = buffer.receive(0);
+    hpx::future<void> f1 = buffer.receive(1);
+    buffer.store_received(2);
+
+    std::exception_ptr e =
+        std::make_exception_ptr(std::runtime_error("cancelled"));
+    HPX_TEST_EQ(buffer.cancel_waiting(e), std::size_t(2));
+    HPX_TEST(!buffer.empty());
+    HPX_TEST_EQ(buffer.cancel_waiting(e, true), std::size_t(1));
+    HPX_TEST(buffer.empty());
+
+    HPX_TEST(f0.has_exception());
+    HPX_TEST(f1.has_exception());
+
+    // the slots can be used again after cancellation
+    buffer.store_received(4);
+    buffer.receive(4).get();
+    HPX_TEST(buffer.empty());
+}
+
+void test_concurrent()
+{
+    constexpr std::size_t window = 16;
+    constexpr std::size_t steps = 10000;
+
+    ring_receive_buffer<std::size_t> buffer(window);
+
+    hpx::future<void> consumer = hpx::async([&]() {
+        std::vector<hpx::future<std::size_t>> futures;
+        futures.reserve(window);
+        for (std::size_t step = 0; step != steps; step += window)
+        {
+            futures.clear();
+            buffer.receive(step, window, std::back_inserter(futures));
+            for (std::size_t i = 0; i != window; ++i)
+            {
+                HPX_TEST_EQ(futures[i].get(), step + i);
+            }
+        }
+    });
+
+    for (std::size_t step = 0; step != steps; ++step)
+    {
+        // wait until the consumer has released the slot from the last lap
+        while (step >= window && buffer.try_receive(step - window))
+        {
+            hpx::this_thread::yield();
+        }
+        buffer.store_received(step, std::size_t(step));
+    }
+
+    consumer.get();
+    HPX_TEST(buffer.empty());
+}
+
+int hpx_main()
+{
+    test_receive_store();
+    test_window();
+    test_batched_receive();
+    test_cancel();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,183 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lock_profiling.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/function.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    /// Contention statistics collected for a lock while lock profiling is
+    /// enabled. All times are given in nanoseconds.
+    struct lock_profile
+    {
+        /// The address of the lock, nullptr if the statistics of all locks
+        /// registered with the same name have been combined
+        void const* lock = nullptr;
+
+        /// The name registered for the lock (see \a set_lock_name), empty if
+        /// none was registered
+        std::string name;
+
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contentions = 0;
+        std::uint64_t wait_time = 0;
+        std::uint64_t max_wait_time = 0;
+
+        /// The longest waits for the lock together with the description of
+        /// the waiting thread, longest first
+        std::vector<std::pair<std::uint64_t, std::string>> longest_waits;
+    };
+
+    /// The number of longest waits recorded for each lock
+    inline constexpr std::size_t lock_profile_max_waits = 4;
+
+#if defined(HPX_HAVE_LOCK_PROFILING)
+
+    /// Enable or disable collecting contention statistics for the locks
+    /// provided by HPX. Profiling is disabled by default, it is enabled at
+    /// startup if hpx.lock_profiling.enable is set.
+    HPX_CORE_EXPORT void enable_lock_profiling(bool enable = true) noexcept;
+    HPX_CORE_EXPORT bool lock_profiling_enabled() noexcept;
+
+    /// Register a name for the given lock. The statistics of all locks
+    /// registered with the same name are combined when reported, which
+    /// allows identifying locks that are destroyed and re-created.
+    HPX_CORE_EXPORT void set_lock_name(
+        void const* lock, char const* name) noexcept;
+
+    /// Notify the profiler that the given lock is about to be destroyed.
+    /// Its statistics are kept (combined with those of other locks of the
+    /// same name), but are no longer attributed to its address.
+    HPX_CORE_EXPORT void forget_lock(void const* lock) noexcept;
+
+    HPX_CORE_EXPORT void record_lock_acquisition(void const* lock) noexcept;
+    HPX_CORE_EXPORT void record_contended_lock_acquisition(
+        void const* lock, std::uint64_t wait_time) noexcept;
+
+    using lock_profiling_description_handler_type =
+        hpx::function<std::string()>;
+
+    /// Sets a handler which gets called to describe the waiting thread
+    /// whenever a wait is among the longest waits recorded for a lock.
+    HPX_CORE_EXPORT void set_lock_profiling_description_handler(
+        lock_profiling_description_handler_type) noexcept;
+
+    /// Returns the statistics of all locks that have been acquired while
+    /// profiling was enabled, sorted by decreasing overall wait time. The
+    /// statistics of locks sharing a name are combined.
+    HPX_CORE_EXPORT std::vector<lock_profile> get_lock_profiles(
+        bool reset = false);
+
+    /// Returns the statistics combined over all locks.
+    HPX_CORE_EXPORT lock_profile get_lock_profile_totals();
+
+    HPX_CORE_EXPORT void reset_lock_profiles() noexcept;
+
+    /// Print the statistics of (at most) the given number of locks with the
+    /// longest overall wait times.
+    HPX_CORE_EXPORT void print_lock_profiles(
+        std::ostream& os, std::size_t max_locks = 20);
+
+#else
+
+    constexpr inline void enable_lock_profiling(bool = true) noexcept {}
+    constexpr inline bool lock_profiling_enabled() noexcept
+    {
+        return false;
+    }
+
+    constexpr inline void set_lock_name(void const*, char const*) noexcept {}
+    constexpr inline void forget_lock(void const*) noexcept {}
+
+    constexpr inline void record_lock_acquisition(void const*) noexcept {}
+    constexpr inline void record_contended_lock_acquisition(
+        void const*, std::uint64_t) noexcept
+    {
+    }
+
+    inline std::vector<lock_profile> get_lock_profiles(bool = false)
+    {
+        return {};
+    }
+    inline lock_profile get_lock_profile_totals()
+    {
+        return {};
+    }
+
+    constexpr inline void reset_lock_profiles() noexcept {}
+
+    inline void print_lock_profiles(std::ostream&, std::size_t = 20) {}
+
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Used by the lock implementations to record an acquisition. The time
+    // spent waiting is measured from the first call to contended() (if any)
+    // to the call to acquired().
+    class profile_lock_acquisition
+    {
+    public:
+#if defined(HPX_HAVE_LOCK_PROFILING)
+        explicit profile_lock_acquisition(void const* lock) noexcept
+          : lock_(lock_profiling_enabled() ? lock : nullptr)
+        {
+        }
+
+        void contended() noexcept
+        {
+            if (lock_ != nullptr && start_ == clock_type::time_point())
+            {
+                start_ = clock_type::now();
+            }
+        }
+
+        void acquired() const noexcept
+        {
+            if (lock_ == nullptr)
+            {
+                return;
+            }
+
+            if (start_ == clock_type::time_point())
+            {
+                record_lock_acquisition(lock_);
+            }
+            else
+            {
+                record_contended_lock_acquisition(lock_,
+                    static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            clock_type::now() - start_)
+                            .count()));
+            }
+        }
+
+    private:
+        using clock_type = std::chrono::steady_clock;
+
+        void const* lock_;
+        clock_type::time_point start_;
+#else
+        explicit constexpr profile_lock_acquisition(void const*) noexcept {}
+
+        constexpr void contended() const noexcept {}
+        constexpr void acquired() const noexcept {}
+#endif
+    };
+}    // namespace hpx::util
@@ -0,0 +1,428 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_PROFILING)
+#include <hpx/lock_registration/lock_profiling.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    namespace {
+
+        struct lock_statistics
+        {
+            bool is_longest_wait(std::uint64_t wait_time) const noexcept
+            {
+                return longest_waits.size() < lock_profile_max_waits ||
+                    wait_time > longest_waits.back().first;
+            }
+
+            void add_wait(std::uint64_t wait_time, std::string description)
+            {
+                auto const it = std::upper_bound(longest_waits.begin(),
+                    longest_waits.end(), wait_time,
+                    [](std::uint64_t t, auto const& wait) {
+                        return t > wait.first;
+                    });
+                longest_waits.emplace(it, wait_time, HPX_MOVE(description));
+                if (longest_waits.size() > lock_profile_max_waits)
+                {
+                    longest_waits.pop_back();
+                }
+            }
+
+            void merge(lock_statistics const& rhs)
+            {
+                acquisitions += rhs.acquisitions;
+                contentions += rhs.contentions;
+                wait_time += rhs.wait_time;
+                max_wait_time = (std::max)(max_wait_time, rhs.max_wait_time);
+                for (auto const& wait : rhs.longest_waits)
+                {
+                    if (is_longest_wait(wait.first))
+                    {
+                        add_wait(wait.first, wait.second);
+                    }
+                }
+            }
+
+            void reset() noexcept
+            {
+                acquisitions = 0;
+                contentions = 0;
+                wait_time = 0;
+                max_wait_time = 0;
+                longest_waits.clear();
+            }
+
+            lock_profile get_profile(void const* lock) const
+            {
+                return lock_profile{lock, name, acquisitions, contentions,
+                    wait_time, max_wait_time, longest_waits};
+            }
+
+            std::string name;
+            std::uint64_t acquisitions = 0;
+            std::uint64_t contentions = 0;
+            std::uint64_t wait_time = 0;
+            std::uint64_t max_wait_time = 0;
+            std::vector<std::pair<std::uint64_t, std::string>> longest_waits;
+        };
+
+        using mutex_type = hpx::util::detail::spinlock;
+
+        // The statistics are spread over several independently locked maps
+        // to keep the profiler itself from becoming a point of contention.
+        struct alignas(64) profiler_shard
+        {
+            mutex_type mtx;
+            std::unordered_map<void const*, lock_statistics> locks;
+        };
+
+        constexpr std::size_t num_shards = 64;
+
+        struct lock_profiler
+        {
+            profiler_shard& get_shard(void const* lock) noexcept
+            {
+                auto const h = reinterpret_cast<std::uintptr_t>(lock) *
+                    static_cast<std::uintptr_t>(0x9e3779b97f4a7c15ull);
+                return shards[(h >> 16) % num_shards];
+            }
+
+            std::string describe_waiter() const
+            {
+                if (!description_handler)
+                {
+                    return "<unknown>";
+                }
+
+                try
+                {
+                    return description_handler();
+                }
+                catch (...)
+                {
+                    return "<unknown>";
+                }
+            }
+
+            std::atomic<bool> enabled{false};
+            lock_profiling_description_handler_type description_handler;
+
+            profiler_shard shards[num_shards];
+
+            // statistics of destroyed locks, combined by name
+            mutex_type retired_mtx;
+            std::map<std::string, lock_statistics> retired;
+        };
+
+        // Locks may be destroyed during static destruction, the profiler is
+        // intentionally never destroyed.
+        lock_profiler& get_lock_profiler()
+        {
+            static lock_profiler* profiler = new lock_profiler;
+            return *profiler;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_lock_profiling(bool enable) noexcept
+    {
+        get_lock_profiler().enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    bool lock_profiling_enabled() noexcept
+    {
+        return get_lock_profiler().enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_lock_name(void const* lock, char const* name) noexcept
+    {
+        if (name == nullptr || *name == '\0')
+        {
+            return;
+        }
+
+        profiler_shard& shard = get_lock_profiler().get_shard(lock);
+        try
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            shard.locks[lock].name = name;
+        }
+        catch (...)
+        {
+            // the lock remains unnamed
+        }
+    }
+
+    void forget_lock(void const* lock) noexcept
+    {
+        lock_profiler& profiler = get_lock_profiler();
+        profiler_shard& shard = profiler.get_shard(lock);
+
+        lock_statistics stats;
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            auto const it = shard.locks.find(lock);
+            if (it == shard.locks.end())
+            {
+                return;
+            }
+            stats = HPX_MOVE(it->second);
+            shard.locks.erase(it);
+        }
+
+        if (stats.acquisitions != 0)
+        {
+            try
+            {
+                std::lock_guard<mutex_type> l(profiler.retired_mtx);
+                auto& retired = profiler.retired[stats.name];
+                retired.name = stats.name;
+                retired.merge(stats);
+            }
+            catch (...)
+            {
+                // the statistics of the lock are lost
+            }
+        }
+    }
+
+    void record_lock_acquisition(void const* lock) noexcept
+    {
+        lock_profiler& profiler = get_lock_profiler();
+        if (!profiler.enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        profiler_shard& shard = profiler.get_shard(lock);
+        try
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            ++shard.locks[lock].acquisitions;
+        }
+        catch (...)
+        {
+            // the acquisition is not recorded
+        }
+    }
+
+    void record_contended_lock_acquisition(
+        void const* lock, std::uint64_t wait_time) noexcept
+    {
+        lock_profiler& profiler = get_lock_profiler();
+        if (!profiler.enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        profiler_shard& shard = profiler.get_shard(lock);
+        try
+        {
+            {
+                std::lock_guard<mutex_type> l(shard.mtx);
+
+                lock_statistics& stats = shard.locks[lock];
+                ++stats.acquisitions;
+                ++stats.contentions;
+                stats.wait_time += wait_time;
+                stats.max_wait_time =
+                    (std::max)(stats.max_wait_time, wait_time);
+
+                if (!stats.is_longest_wait(wait_time))
+                {
+                    return;
+                }
+            }
+
+            // describe the waiting thread without holding the lock
+            std::string description = profiler.describe_waiter();
+
+            std::lock_guard<mutex_type> l(shard.mtx);
+            auto const it = shard.locks.find(lock);
+            if (it != shard.locks.end() &&
+                it->second.is_longest_wait(wait_time))
+            {
+                it->second.add_wait(wait_time, HPX_MOVE(description));
+            }
+        }
+        catch (...)
+        {
+            // the acquisition is not recorded
+        }
+    }
+
+    void set_lock_profiling_description_handler(
+        lock_profiling_description_handler_type f) noexcept
+    {
+        get_lock_profiler().description_handler = HPX_MOVE(f);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<lock_profile> get_lock_profiles(bool reset)
+    {
+        lock_profiler& profiler = get_lock_profiler();
+
+        std::vector<lock_profile> result;
+        std::map<std::string, lock_statistics> named;
+
+        for (profiler_shard& shard : profiler.shards)
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            for (auto& [lock, stats] : shard.locks)
+            {
+                if (stats.acquisitions != 0)
+                {
+                    if (stats.name.empty())
+                    {
+                        result.push_back(stats.get_profile(lock));
+                    }
+                    else
+                    {
+                        auto& combined = named[stats.name];
+                        combined.name = stats.name;
+                        combined.merge(stats);
+                    }
+                }
+
+                if (reset)
+                {
+                    stats.reset();
+                }
+            }
+        }
+
+        {
+            std::lock_guard<mutex_type> l(profiler.retired_mtx);
+            for (auto const& [name, stats] : profiler.retired)
+            {
+                auto& combined = named[name];
+                combined.name = name;
+                combined.merge(stats);
+            }
+
+            if (reset)
+            {
+                profiler.retired.clear();
+            }
+        }
+
+        for (auto const& [name, stats] : named)
+        {
+            result.push_back(stats.get_profile(nullptr));
+        }
+
+        std::sort(result.begin(), result.end(),
+            [](lock_profile const& lhs, lock_profile const& rhs) {
+                if (lhs.wait_time != rhs.wait_time)
+                {
+                    return lhs.wait_time > rhs.wait_time;
+                }
+                return lhs.acquisitions > rhs.acquisitions;
+            });
+
+        return result;
+    }
+
+    lock_profile get_lock_profile_totals()
+    {
+        lock_profiler& profiler = get_lock_profiler();
+
+        lock_statistics totals;
+        for (profiler_shard& shard : profiler.shards)
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            for (auto const& [lock, stats] : shard.locks)
+            {
+                totals.merge(stats);
+            }
+        }
+
+        {
+            std::lock_guard<mutex_type> l(profiler.retired_mtx);
+            for (auto const& [name, stats] : profiler.retired)
+            {
+                totals.merge(stats);
+            }
+        }
+
+        return totals.get_profile(nullptr);
+    }
+
+    void reset_lock_profiles() noexcept
+    {
+        lock_profiler& profiler = get_lock_profiler();
+        for (profiler_shard& shard : profiler.shards)
+        {
+            std::lock_guard<mutex_type> l(shard.mtx);
+            for (auto& [lock, stats] : shard.locks)
+            {
+                stats.reset();
+            }
+        }
+
+        std::lock_guard<mutex_type> l(profiler.retired_mtx);
+        profiler.retired.clear();
+    }
+
+    void print_lock_profiles(std::ostream& os, std::size_t max_locks)
+    {
+        std::vector<lock_profile> const profiles = get_lock_profiles();
+
+        std::size_t const count = (std::min)(max_locks, profiles.size());
+        os << "lock profile: " << profiles.size()
+           << " locks acquired, showing " << count
+           << " with the longest overall wait time\n";
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            lock_profile const& p = profiles[i];
+
+            os << "  ";
+            if (!p.name.empty())
+            {
+                os << p.name;
+            }
+            else if (p.lock != nullptr)
+            {
+                os << p.lock;
+            }
+            else
+            {
+                os << "<destroyed unnamed locks>";
+            }
+
+            os << ": acquisitions: " << p.acquisitions
+               << ", contended: " << p.contentions
+               << ", wait time: " << p.wait_time
+               << " [ns], longest wait: " << p.max_wait_time << " [ns]\n";
+
+            for (auto const& [wait_time, description] : p.longest_waits)
+            {
+                os << "    " << wait_time << " [ns]: " << description << "\n";
+            }
+        }
+    }
+}    // namespace hpx::util
+
+#endif
@@ -0,0 +1,63 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace hpx::util::logging {
+
+    namespace writer {
+
+        struct named_write;
+    }    // namespace writer
+
+    /**
+        @brief Starts writing the log records asynchronously
+
+        Once started, the log records are still formatted by the thread that
+        generates them (the formatters need the context of this thread), but
+        they are written to their destinations by a background thread. Every
+        thread which generates log records pushes them into its own lock-free
+        buffer holding up to @c buffer_size records, the background thread
+        drains all buffers. A thread which finds its buffer full waits for
+        the background thread to make room.
+
+        The background thread is stopped (and all remaining records are
+        written) by @ref stop_async_backend, at the latest when the
+        application exits.
+    */
+    HPX_CORE_EXPORT void start_async_backend(std::size_t buffer_size = 1024);
+
+    /**
+        @brief Writes all pending log records and stops the background thread
+
+        Log records generated afterwards are written synchronously again.
+    */
+    HPX_CORE_EXPORT void stop_async_backend();
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> async_backend_active;
+
+        // Pushes a formatted record written to the destinations of the given
+        // writer by the background thread. Returns false if the asynchronous
+        // backend is not active, the record has to be written synchronously
+        // then.
+        HPX_CORE_EXPORT bool push_async_record(
+            writer::named_write const& writer, std::string&& record);
+    }    // namespace detail
+
+    /// Returns whether log records are written asynchronously
+    inline bool is_async_backend_active() noexcept
+    {
+        return detail::async_backend_active.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::util::logging
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/async_backend.hpp>
 #include <hpx/logging/format/destinations.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
@@ -399,11 +400,25 @@ namespace hpx::util::logging::writer {
             m_format(out, msg);
 
 #if defined(HPX_COMPUTE_HOST_CODE)
+            // hand the formatted message to the background thread, if enabled
+            if (is_async_backend_active() &&
+                logging::detail::push_async_record(*this, out.str()))
+            {
+                return;
+            }
+
             message const formatted(HPX_MOVE(out));
             m_destination(formatted);
 #endif
         }
 
+        /** @brief Writes an already formatted message to the destinations
+         */
+        void write_formatted(message const& msg) const
+        {
+            m_destination(msg);
+        }
+
         /** @brief Replaces a formatter from the named formatter.
 
             You can use this, for instance, when you want to share
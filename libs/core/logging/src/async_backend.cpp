@@ -0,0 +1,360 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/logging/async_backend.hpp>
+#include <hpx/logging/format/named_write.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::util::logging {
+
+    namespace detail {
+
+        std::atomic<bool> async_backend_active(false);
+    }    // namespace detail
+
+    namespace {
+
+        struct async_record
+        {
+            writer::named_write const* writer = nullptr;
+            std::string text;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The records generated by one thread, filled by this thread and
+        // drained by the background thread only
+        class thread_buffer
+        {
+        public:
+            explicit thread_buffer(std::size_t capacity)
+              : records_(capacity)
+            {
+            }
+
+            // leaves the record untouched if the buffer is full
+            bool push(writer::named_write const& w, std::string& text)
+            {
+                std::size_t const head = head_.load(std::memory_order_relaxed);
+                if (head - tail_.load(std::memory_order_acquire) ==
+                    records_.size())
+                {
+                    return false;
+                }
+
+                async_record& r = records_[head % records_.size()];
+                r.writer = &w;
+                r.text = HPX_MOVE(text);
+
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            template <typename F>
+            std::size_t drain(F&& f)
+            {
+                std::size_t const tail = tail_.load(std::memory_order_relaxed);
+                std::size_t const head = head_.load(std::memory_order_acquire);
+
+                for (std::size_t i = tail; i != head; ++i)
+                {
+                    async_record& r = records_[i % records_.size()];
+                    f(*r.writer, HPX_MOVE(r.text));
+                    r.text.clear();
+
+                    tail_.store(i + 1, std::memory_order_release);
+                }
+                return head - tail;
+            }
+
+            bool empty() const noexcept
+            {
+                return head_.load(std::memory_order_acquire) ==
+                    tail_.load(std::memory_order_acquire);
+            }
+
+            // set once the owning thread has exited
+            std::atomic<bool> orphaned{false};
+
+        private:
+            std::vector<async_record> records_;
+            std::atomic<std::size_t> head_{0};
+            std::atomic<std::size_t> tail_{0};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct thread_buffer_holder
+        {
+            thread_buffer_holder() = default;
+
+            thread_buffer_holder(thread_buffer_holder const&) = delete;
+            thread_buffer_holder& operator=(
+                thread_buffer_holder const&) = delete;
+
+            ~thread_buffer_holder()
+            {
+                if (buffer)
+                {
+                    buffer->orphaned.store(true, std::memory_order_release);
+                }
+            }
+
+            std::shared_ptr<thread_buffer> buffer;
+            std::size_t epoch = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class async_backend
+        {
+        public:
+            async_backend() = default;
+
+            async_backend(async_backend const&) = delete;
+            async_backend& operator=(async_backend const&) = delete;
+
+            ~async_backend()
+            {
+                stop();
+            }
+
+            void start(std::size_t buffer_size)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                if (thread_.joinable())
+                {
+                    return;
+                }
+
+                buffer_size_ = (std::max)(buffer_size, std::size_t(1));
+                epoch_.fetch_add(1, std::memory_order_release);
+                stop_ = false;
+
+                thread_ = std::thread(&async_backend::run, this);
+                detail::async_backend_active.store(
+                    true, std::memory_order_release);
+            }
+
+            void stop()
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    if (!thread_.joinable())
+                    {
+                        return;
+                    }
+
+                    // new records are written synchronously from now on
+                    detail::async_backend_active.store(false);
+                    stop_ = true;
+                }
+
+                cond_.notify_all();
+                thread_.join();
+
+                // threads which have seen the backend active may still be
+                // pushing records, wait for them to finish
+                while (pushes_in_flight_.load() != 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                // write the records pushed while the background thread was
+                // being stopped
+                drain_all();
+
+                std::lock_guard<std::mutex> l(mtx_);
+                buffers_.clear();
+            }
+
+            bool push(writer::named_write const& w, std::string& text)
+            {
+                // stop() waits for all pushes that have seen the backend
+                // active before it writes the remaining records (the
+                // operations are sequentially consistent, so either the push
+                // sees the backend inactive or stop() sees the push)
+                pushes_in_flight_.fetch_add(1);
+                push_guard const guard{pushes_in_flight_};
+
+                if (!detail::async_backend_active.load())
+                {
+                    return false;
+                }
+
+                thread_local thread_buffer_holder holder;
+
+                if (holder.epoch != epoch_.load(std::memory_order_acquire) ||
+                    !holder.buffer)
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    if (!detail::async_backend_active.load(
+                            std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+
+                    if (holder.buffer)
+                    {
+                        holder.buffer->orphaned.store(
+                            true, std::memory_order_release);
+                    }
+                    holder.buffer =
+                        std::make_shared<thread_buffer>(buffer_size_);
+                    holder.epoch = epoch_.load(std::memory_order_relaxed);
+                    buffers_.push_back(holder.buffer);
+                }
+
+                // wait for the background thread to make room
+                while (!holder.buffer->push(w, text))
+                {
+                    if (!detail::async_backend_active.load(
+                            std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+                    cond_.notify_one();
+                    std::this_thread::yield();
+                }
+                return true;
+            }
+
+        private:
+            struct push_guard
+            {
+                ~push_guard()
+                {
+                    pushes_in_flight_.fetch_sub(1);
+                }
+
+                std::atomic<std::size_t>& pushes_in_flight_;
+            };
+
+            void run()
+            {
+                while (true)
+                {
+                    if (drain_all() != 0)
+                    {
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> l(mtx_);
+                    if (stop_)
+                    {
+                        break;
+                    }
+                    cond_.wait_for(l, std::chrono::milliseconds(1));
+                }
+            }
+
+            std::size_t drain_all()
+            {
+                std::vector<std::shared_ptr<thread_buffer>> buffers;
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+
+                    // forget about the buffers of exited threads once those
+                    // have been drained completely
+                    buffers_.erase(
+                        std::remove_if(buffers_.begin(), buffers_.end(),
+                            [](std::shared_ptr<thread_buffer> const& b) {
+                                return b->orphaned.load(
+                                           std::memory_order_acquire) &&
+                                    b->empty();
+                            }),
+                        buffers_.end());
+                    buffers = buffers_;
+                }
+
+                std::size_t count = 0;
+                for (auto const& buffer : buffers)
+                {
+                    count += buffer->drain(
+                        [](writer::named_write const& w, std::string&& text) {
+                            try
+                            {
+                                message const msg(
+                                    std::stringstream(HPX_MOVE(text)));
+                                w.write_formatted(msg);
+                            }
+                            catch (...)
+                            {
+                                // ignore failing destinations, this must not
+                                // stop the background thread
+                            }
+                        });
+                }
+                return count;
+            }
+
+            std::mutex mtx_;
+            std::condition_variable cond_;
+            std::vector<std::shared_ptr<thread_buffer>> buffers_;
+            std::atomic<std::size_t> epoch_{0};
+            std::atomic<std::size_t> pushes_in_flight_{0};
+            std::size_t buffer_size_ = 1024;
+            std::thread thread_;
+            bool stop_ = false;
+        };
+
+        async_backend& get_async_backend()
+        {
+            static async_backend backend;
+            return backend;
+        }
+
+        void stop_async_backend_at_exit()
+        {
+            get_async_backend().stop();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start_async_backend(std::size_t buffer_size)
+    {
+        async_backend& backend = get_async_backend();
+
+        // the destinations have to be alive while the remaining records are
+        // written, register the handler after those have been created
+        static bool const registered =
+            std::atexit(&stop_async_backend_at_exit) == 0;
+        HPX_UNUSED(registered);
+
+        backend.start(buffer_size);
+    }
+
+    void stop_async_backend()
+    {
+        get_async_backend().stop();
+    }
+
+    namespace detail {
+
+        bool push_async_record(
+            writer::named_write const& writer, std::string&& record)
+        {
+            if (!async_backend_active.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            return get_async_backend().push(writer, record);
+        }
+    }    // namespace detail
+}    // namespace hpx::util::logging
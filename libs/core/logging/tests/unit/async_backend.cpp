@@ -0,0 +1,132 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that no log records are lost if the asynchronous backend is stopped
+// while other threads are generating log records.
+
+#include <hpx/logging/async_backend.hpp>
+#include <hpx/logging/format/named_write.hpp>
+#include <hpx/logging/manipulator.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_threads = 8;
+constexpr std::size_t num_records = 10000;
+constexpr std::size_t num_rounds = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+// the number of times each record was written
+struct received_records
+{
+    received_records()
+      : counts(num_threads, std::vector<std::size_t>(num_records, 0))
+    {
+    }
+
+    std::mutex mtx;
+    std::vector<std::vector<std::size_t>> counts;
+};
+
+struct counting_destination : hpx::util::logging::destination::manipulator
+{
+    explicit counting_destination(received_records& records)
+      : records_(&records)
+    {
+    }
+
+    void operator()(hpx::util::logging::message const& msg) override
+    {
+        std::istringstream in(msg.full_string());
+        std::size_t thread = 0;
+        std::size_t record = 0;
+        in >> thread >> record;
+
+        HPX_TEST(!in.fail());
+        HPX_TEST_LT(thread, num_threads);
+        HPX_TEST_LT(record, num_records);
+        if (!in.fail() && thread < num_threads && record < num_records)
+        {
+            std::lock_guard<std::mutex> l(records_->mtx);
+            ++records_->counts[thread][record];
+        }
+    }
+
+    received_records* records_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stop_while_logging()
+{
+    received_records records;
+
+    hpx::util::logging::writer::named_write writer;
+    writer.set_destination("count", counting_destination(records));
+    writer.write("|", "count");
+
+    // a small buffer makes the generating threads wait for the background
+    // thread frequently
+    hpx::util::logging::start_async_backend(16);
+    HPX_TEST(hpx::util::logging::is_async_backend_active());
+
+    std::atomic<std::size_t> started(0);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            ++started;
+            for (std::size_t i = 0; i != num_records; ++i)
+            {
+                std::stringstream out;
+                out << t << ' ' << i;
+                writer(hpx::util::logging::message(std::move(out)));
+            }
+        });
+    }
+
+    // stop the backend while the records are being generated
+    while (started.load() != num_threads)
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    hpx::util::logging::stop_async_backend();
+    HPX_TEST(!hpx::util::logging::is_async_backend_active());
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // every record was written exactly once
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        for (std::size_t i = 0; i != num_records; ++i)
+        {
+            HPX_TEST_EQ(records.counts[t][i], std::size_t(1));
+        }
+    }
+}
+
+int main()
+{
+    for (std::size_t i = 0; i != num_rounds; ++i)
+    {
+        test_stop_while_logging();
+    }
+
+    return hpx::util::report_errors();
+}
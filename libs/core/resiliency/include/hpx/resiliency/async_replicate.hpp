@@ -15,13 +15,22 @@
 #include <hpx/resiliency/resiliency_cpos.hpp>
 #include <hpx/resiliency/util.hpp>
 
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/invoke_fused.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/async_local.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/stop_token.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -94,6 +103,183 @@ namespace hpx::resiliency::experimental {
                 },
                 HPX_MOVE(results));
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Bookkeeping for replicas of which only the first valid result is
+        // needed. The first valid result is made available right away and
+        // a stop is requested for the remaining replicas.
+        template <typename Result, typename Pred>
+        struct replicate_first_state
+        {
+            replicate_first_state(std::size_t n, Pred&& pred)
+              : remaining_(n)
+              , pred_(HPX_MOVE(pred))
+            {
+            }
+
+            hpx::future<Result> get_future()
+            {
+                return promise_.get_future();
+            }
+
+            [[nodiscard]] hpx::stop_token get_token() const noexcept
+            {
+                return stop_.get_token();
+            }
+
+            [[nodiscard]] bool stop_requested() const noexcept
+            {
+                return stop_.stop_requested();
+            }
+
+            // Each replica has to report exactly once, either with its
+            // result, with an exception, or through finished if it was
+            // skipped
+            void set_value(Result&& result)
+            {
+                if (HPX_INVOKE(pred_, result) && !done_.exchange(true))
+                {
+                    stop_.request_stop();
+                    promise_.set_value(HPX_MOVE(result));
+                }
+                finished();
+            }
+
+            void set_exception(std::exception_ptr ex)
+            {
+                try
+                {
+                    std::rethrow_exception(ex);
+                }
+                catch (abort_replicate_exception const&)
+                {
+                    // abort the replication altogether
+                    if (!done_.exchange(true))
+                    {
+                        stop_.request_stop();
+                        promise_.set_exception(HPX_MOVE(ex));
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<hpx::spinlock> l(mtx_);
+                    ex_ = HPX_MOVE(ex);
+                }
+                finished();
+            }
+
+            void finished()
+            {
+                if (--remaining_ == 0 && !done_.exchange(true))
+                {
+                    if (bool(ex_))
+                    {
+                        promise_.set_exception(ex_);
+                    }
+                    else
+                    {
+                        // no correct results were produced
+                        promise_.set_exception(std::make_exception_ptr(
+                            abort_replicate_exception{}));
+                    }
+                }
+            }
+
+        private:
+            std::atomic<std::size_t> remaining_;
+            std::atomic<bool> done_ = false;
+            hpx::stop_source stop_;
+            hpx::promise<Result> promise_;
+            Pred pred_;
+
+            hpx::spinlock mtx_;
+            std::exception_ptr ex_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Functions accepting a stop_token as their first argument get
+        // passed the token which is signaled once a valid result is known
+        template <typename F, typename... Ts>
+        inline constexpr bool is_stoppable_replica_v =
+            std::is_invocable_v<F&, hpx::stop_token, Ts&...>;
+
+        template <typename F, typename... Ts>
+        using replicate_first_result_t =
+            typename std::conditional_t<
+                is_stoppable_replica_v<std::decay_t<F>, std::decay_t<Ts>...>,
+                hpx::util::detail::invoke_deferred_result<F, hpx::stop_token,
+                    Ts...>,
+                hpx::util::detail::invoke_deferred_result<F, Ts...>>::type;
+
+        template <typename Result, typename Pred, typename F, typename... Ts>
+        struct async_replicate_first_state
+          : replicate_first_state<Result, Pred>
+        {
+            template <typename F_, typename... Ts_>
+            async_replicate_first_state(
+                std::size_t n, Pred&& pred, F_&& f, Ts_&&... ts)
+              : replicate_first_state<Result, Pred>(n, HPX_MOVE(pred))
+              , f_(HPX_FORWARD(F_, f))
+              , ts_(HPX_FORWARD(Ts_, ts)...)
+            {
+            }
+
+            void run()
+            {
+                // replicas that were not started before a valid result was
+                // produced are skipped
+                if (this->stop_requested())
+                {
+                    this->finished();
+                    return;
+                }
+
+                try
+                {
+                    if constexpr (is_stoppable_replica_v<F, Ts...>)
+                    {
+                        this->set_value(hpx::invoke_fused(
+                            [&](auto&... ts) {
+                                return HPX_INVOKE(f_, this->get_token(), ts...);
+                            },
+                            ts_));
+                    }
+                    else
+                    {
+                        this->set_value(hpx::invoke_fused(f_, ts_));
+                    }
+                }
+                catch (...)
+                {
+                    this->set_exception(std::current_exception());
+                }
+            }
+
+            F f_;
+            hpx::tuple<Ts...> ts_;
+        };
+
+        template <typename Pred, typename F, typename... Ts>
+        hpx::future<replicate_first_result_t<F, Ts...>> async_replicate_first(
+            std::size_t n, Pred&& pred, F&& f, Ts&&... ts)
+        {
+            using result_type = replicate_first_result_t<F, Ts...>;
+            using state_type = async_replicate_first_state<result_type,
+                std::decay_t<Pred>, std::decay_t<F>, std::decay_t<Ts>...>;
+
+            // all replicas share a single state holding the function and its
+            // arguments
+            auto state = std::make_shared<state_type>(n,
+                std::decay_t<Pred>(HPX_FORWARD(Pred, pred)), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+
+            hpx::future<result_type> result = state->get_future();
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                hpx::post([state]() { state->run(); });
+            }
+            return result;
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -128,27 +314,29 @@ namespace hpx::resiliency::experimental {
     ///////////////////////////////////////////////////////////////////////////
     // Asynchronously launch given function \a f exactly \a n times. Verify the
     // result of those invocations using the given predicate \a pred. Return the
-    // first valid result.
+    // first valid result. Replicas not started before the first valid result
+    // is known are skipped, if \a f accepts a stop_token as its first argument
+    // the token is signaled at that point.
     template <typename Pred, typename F, typename... Ts>
-    hpx::future<hpx::util::detail::invoke_deferred_result_t<F, Ts...>>
-    tag_invoke(async_replicate_validate_t, std::size_t n, Pred&& pred, F&& f,
+    hpx::future<detail::replicate_first_result_t<F, Ts...>> tag_invoke(
+        async_replicate_validate_t, std::size_t n, Pred&& pred, F&& f,
         Ts&&... ts)
     {
-        return detail::async_replicate_vote_validate(n,
-            detail::replicate_voter{}, HPX_FORWARD(Pred, pred),
+        return detail::async_replicate_first(n, HPX_FORWARD(Pred, pred),
             HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     // Asynchronously launch given function \a f exactly \a n times. Verify the
     // result of those invocations by checking for exception. Return the first
-    // valid result.
+    // valid result. Replicas not started before the first valid result is
+    // known are skipped, if \a f accepts a stop_token as its first argument
+    // the token is signaled at that point.
     template <typename F, typename... Ts>
-    hpx::future<hpx::util::detail::invoke_deferred_result_t<F, Ts...>>
-    tag_invoke(async_replicate_t, std::size_t n, F&& f, Ts&&... ts)
+    hpx::future<detail::replicate_first_result_t<F, Ts...>> tag_invoke(
+        async_replicate_t, std::size_t n, F&& f, Ts&&... ts)
     {
-        return detail::async_replicate_vote_validate(n,
-            detail::replicate_voter{}, detail::replicate_validator{},
+        return detail::async_replicate_first(n, detail::replicate_validator{},
             HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
     }
 }    // namespace hpx::resiliency::experimental
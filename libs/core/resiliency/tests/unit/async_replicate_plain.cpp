@@ -12,6 +12,8 @@
 #include <hpx/init.hpp>
 #include <hpx/modules/resiliency.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/stop_token.hpp>
+#include <hpx/thread.hpp>
 
 #include <atomic>
 #include <stdexcept>
@@ -47,6 +49,21 @@ int deep_thought()
         throw vogon_exception();
 }
 
+std::atomic<int> started(0);
+
+int cancellable_answer(hpx::stop_token token)
+{
+    // the first replica succeeds, all others run until they are cancelled
+    if (++started == 1)
+        return 42;
+
+    while (!token.stop_requested())
+    {
+        hpx::this_thread::yield();
+    }
+    return 0;
+}
+
 int hpx_main()
 {
     {
@@ -133,6 +150,11 @@ int hpx_main()
             HPX_TEST(false);
         }
         HPX_TEST(exception_caught);
+
+        // the remaining replicas are cancelled once a valid result is known
+        f = hpx::resiliency::experimental::async_replicate_validate(
+            4, &validate, &cancellable_answer);
+        HPX_TEST_EQ(f.get(), 42);
     }
 
     return hpx::local::finalize();
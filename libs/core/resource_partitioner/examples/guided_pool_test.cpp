@@ -23,6 +23,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "system_characteristics.hpp"
 
@@ -121,6 +122,23 @@ namespace hpx::parallel::execution {
             return 56;
         }
     };
+
+    // ------------------------------------------------------------------------
+    // a cost model hint returns the estimated work of a task and the NUMA
+    // domain it should preferably run on
+    template <>
+    struct pool_cost_hint<guided_test_tag>
+    {
+        placement_estimate operator()(std::size_t n) const
+        {
+            return placement_estimate{n, -1};
+        }
+
+        placement_estimate operator()(std::vector<double> const& v) const
+        {
+            return placement_estimate::for_data(v.data(), v.size());
+        }
+    };
 }    // namespace hpx::parallel::execution
 
 using namespace hpx::parallel::execution;
@@ -193,6 +211,41 @@ int hpx_main()
 
     new_future.get();
 
+    // ------------------------------------------------------------------------
+    // test 4
+    // ------------------------------------------------------------------------
+    std::cout << std::endl << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+    std::cout << "Testing cost model guided exec" << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+
+    using hint_type4 = pool_cost_hint<guided_test_tag>;
+    hpx::parallel::execution::guided_pool_executor<hint_type4> guided_cost_exec(
+        &hpx::resource::get_thread_pool(CUSTOM_POOL_NAME));
+
+    // the tasks are placed on the least loaded NUMA domain
+    std::vector<double> data(1000, 1.0);
+    hpx::future<double> gf4 = hpx::async(
+        guided_cost_exec,
+        [](std::vector<double> const& v) {
+            double sum = 0;
+            for (double d : v)
+            {
+                sum += d;
+            }
+            return sum;
+        },
+        std::cref(data));
+    std::cout << "sum = " << gf4.get() << std::endl;
+
+    // the work of the tasks varies a lot, bulk execution places the
+    // largest tasks first
+    std::vector<std::size_t> sizes = {10, 100000, 1000, 10000, 100, 50000};
+    auto bulk_futures = hpx::parallel::execution::bulk_async_execute(
+        guided_cost_exec,
+        [](std::size_t n) { async_guided(n, false, "bulk"); }, sizes);
+    hpx::wait_all(bulk_futures);
+
     return hpx::local::finalize();
 }
 
@@ -21,6 +21,7 @@
 #include <atomic>
 #include <cstddef>
 #include <iosfwd>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -124,6 +125,29 @@ namespace hpx::resource::detail {
         void add_resource(std::vector<hpx::resource::numa_domain> const& ndv,
             std::string const& pool_name, bool exclusive = true);
 
+        // manage the binding of the service thread pools
+        void set_service_affinity(std::vector<hpx::resource::pu> const& pv,
+            std::string const& service_pool_name);
+        void set_service_affinity(hpx::resource::numa_domain const& nd,
+            std::string const& service_pool_name);
+
+        // Return the processing units the threads of the given service pool
+        // should be bound to, the mask is empty if the threads should not be
+        // bound at all
+        threads::mask_type get_service_affinity_mask(
+            std::string const& service_pool_name,
+            threads::mask_cref_type used_processing_units) const;
+
+        // manage the quality of service mode
+        void enable_qos(qos_parameters const& params);
+
+        // Return the parameters of the quality of service mode, nullptr if
+        // it is not enabled
+        qos_parameters const* get_qos_parameters() const noexcept
+        {
+            return qos_enabled_ ? &qos_ : nullptr;
+        }
+
         threads::policies::detail::affinity_data const& get_affinity_data()
             const noexcept
         {
@@ -208,6 +232,7 @@ namespace hpx::resource::detail {
         ////////////////////////////////////////////////////////////////////////
         // called in hpx_init run_or_start
         void setup_pools();
+        void setup_qos_pool();
         void setup_schedulers();
         void reconfigure_affinities();
         void reconfigure_affinities_locked();
@@ -242,6 +267,14 @@ namespace hpx::resource::detail {
         mutable mutex_type mtx_;
         std::vector<detail::init_pool_data> initial_thread_pools_;
 
+        // explicitly requested binding of the service thread pools
+        std::map<std::string, threads::mask_type> service_affinity_masks_;
+
+        // quality of service mode
+        qos_parameters qos_;
+        bool qos_enabled_ = false;
+        bool qos_requested_ = false;
+
         // reference to the topology and affinity data
         hpx::threads::policies::detail::affinity_data affinity_data_;
 
@@ -191,6 +191,27 @@ namespace hpx::resource {
             std::vector<hpx::resource::numa_domain> const& ndv,
             std::string const& pool_name, bool exclusive = true);
 
+        // Bind the OS threads of the service thread pools (e.g. the io,
+        // timer, and parcel pools) to the given processing units. An empty
+        // pool name applies the binding to all service pools which have not
+        // been bound explicitly. This overrides the configured default
+        // binding (see hpx.service_affinity).
+        HPX_CORE_EXPORT void set_service_affinity(
+            std::vector<hpx::resource::pu> const& pv,
+            std::string const& service_pool_name = "");
+        HPX_CORE_EXPORT void set_service_affinity(
+            hpx::resource::numa_domain const& nd,
+            std::string const& service_pool_name = "");
+
+        // Reserve cores for latency-class work (threads with high priority)
+        // in a pool of their own. The cores are taken from the end of the
+        // ones which have not been assigned to any pool when the pools are
+        // configured. New work is routed to the latency pool or the default
+        // pool according to its priority. This overrides the configured
+        // defaults (see hpx.qos).
+        HPX_CORE_EXPORT void enable_qos(
+            qos_parameters const& params = qos_parameters());
+
         // Access all available NUMA domains
         HPX_CORE_EXPORT std::vector<numa_domain> const& numa_domains() const;
 
@@ -88,6 +88,30 @@ namespace hpx::resource {
 
     using background_work_function = hpx::function<bool(std::size_t)>;
 
+    /// The parameters of the quality of service mode of the resource
+    /// partitioner (see partitioner::enable_qos and hpx.qos). In this mode
+    /// some of the cores are reserved for a pool running latency-class work
+    /// (threads with high priority) only, all other work runs on the
+    /// default pool.
+    struct qos_parameters
+    {
+        /// The name of the pool reserved for latency-class work
+        /// (hpx.qos.latency_pool)
+        std::string latency_pool = "latency";
+
+        /// The number of cores reserved for latency-class work
+        /// (hpx.qos.latency_cores)
+        std::size_t latency_cores = 1;
+
+        /// Whether new work is placed on the other pool if its own pool has
+        /// no idle cores but the other one has (hpx.qos.lending)
+        bool lending = true;
+
+        /// The number of idle cores of the latency pool which are never lent
+        /// to other work (hpx.qos.lend_reserve)
+        std::size_t lend_reserve = 0;
+    };
+
     // Choose same names as in command-line options except with _ instead of
     // -.
 
@@ -107,6 +131,8 @@ namespace hpx::resource {
         shared_priority = 7,
         local_workrequesting_fifo = 8,
         local_workrequesting_lifo = 9,
+        local_priority_edf = 10,
+        shared_priority_multiqueue = 11,
     };
 
 #define HPX_SCHEDULING_POLICY_UNSCOPED_ENUM_DEPRECATION_MSG                    \
@@ -26,7 +26,9 @@
 #include <cstdint>
 #include <iosfwd>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -148,6 +150,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_workrequesting_lifo:
             sched = "local_workrequesting_lifo";
             break;
+        case resource::scheduling_policy::local_priority_edf:
+            sched = "local_priority_edf";
+            break;
         case resource::scheduling_policy::static_:
             sched = "static";
             break;
@@ -163,6 +168,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::scheduling_policy::shared_priority_multiqueue:
+            sched = "shared_priority_multiqueue";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -407,6 +415,9 @@ namespace hpx::resource::detail {
     // -2 checks whether there are empty pools
     void partitioner::setup_pools()
     {
+        // Reserve the cores for latency-class work, if requested
+        setup_qos_pool();
+
         // Assign all free resources to the default pool
         bool first = true;
         for (hpx::resource::numa_domain& d : numa_domains_)
@@ -456,6 +467,104 @@ namespace hpx::resource::detail {
         //! FIXME add allow-empty-pools policy. Wait, does this even make sense??
     }
 
+    // Create the pool for latency-class work of the quality of service mode
+    // (if enabled) from the last cores not assigned to any other pool. At
+    // least one core is left for the default pool, the mode stays disabled
+    // if there are not enough cores.
+    void partitioner::setup_qos_pool()
+    {
+        if (!qos_requested_)
+        {
+            if (util::get_entry_as<int>(rtcfg_, "hpx.qos.enabled", 0) == 0)
+            {
+                return;
+            }
+
+            qos_.latency_pool =
+                rtcfg_.get_entry("hpx.qos.latency_pool", qos_.latency_pool);
+            qos_.latency_cores = util::get_entry_as<std::size_t>(
+                rtcfg_, "hpx.qos.latency_cores", qos_.latency_cores);
+            qos_.lending =
+                util::get_entry_as<int>(rtcfg_, "hpx.qos.lending", 1) != 0;
+            qos_.lend_reserve = util::get_entry_as<std::size_t>(
+                rtcfg_, "hpx.qos.lend_reserve", qos_.lend_reserve);
+        }
+
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            if (qos_.latency_pool.empty() ||
+                qos_.latency_pool == get_default_pool_name())
+            {
+                l.unlock();
+                throw_invalid_argument("partitioner::setup_qos_pool",
+                    "the pool for latency-class work must not be the default "
+                    "pool: '" + qos_.latency_pool + "'");
+            }
+
+            // a pool created explicitly by the application is used as is
+            std::size_t const num_thread_pools = initial_thread_pools_.size();
+            for (std::size_t i = 1; i != num_thread_pools; ++i)
+            {
+                if (qos_.latency_pool == initial_thread_pools_[i].pool_name_)
+                {
+                    qos_enabled_ = true;
+                    return;
+                }
+            }
+        }
+
+        // collect the cores none of the processing units of which have been
+        // assigned to a pool yet
+        std::vector<core const*> free_cores;
+        for (numa_domain const& d : numa_domains_)
+        {
+            for (core const& c : d.cores_)
+            {
+                bool is_free = !c.pus_.empty();
+                for (pu const& p : c.pus_)
+                {
+                    is_free = is_free && p.thread_occupancy_count_ == 0;
+                }
+                if (is_free)
+                {
+                    free_cores.push_back(&c);
+                }
+            }
+        }
+
+        std::size_t const num_cores = (std::min)(qos_.latency_cores,
+            free_cores.empty() ? 0 : free_cores.size() - 1);
+        if (num_cores == 0)
+        {
+            return;
+        }
+
+        create_thread_pool(qos_.latency_pool, scheduling_policy::unspecified,
+            default_scheduler_mode_);
+        for (std::size_t i = free_cores.size() - num_cores;
+             i != free_cores.size(); ++i)
+        {
+            add_resource(*free_cores[i], qos_.latency_pool);
+        }
+
+        qos_.latency_cores = num_cores;
+        qos_enabled_ = true;
+    }
+
+    void partitioner::enable_qos(qos_parameters const& params)
+    {
+        if (is_initialized_)
+        {
+            throw_invalid_argument("partitioner::enable_qos",
+                "the quality of service mode has to be enabled before the "
+                "thread pools are configured");
+        }
+
+        qos_ = params;
+        qos_requested_ = true;
+    }
+
     // This function is called in hpx_init, before the instantiation of the
     // runtime It takes care of configuring some internal parameters of the
     // resource partitioner related to the pools' schedulers
@@ -493,6 +602,11 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_workrequesting_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-edf").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_edf;
+        }
         else if (0 == std::string("static").find(default_scheduler_str))
         {
             default_scheduler = scheduling_policy::static_;
@@ -517,6 +631,12 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("shared-priority-multiqueue")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::shared_priority_multiqueue;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -789,6 +909,79 @@ namespace hpx::resource::detail {
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////
+    void partitioner::set_service_affinity(
+        std::vector<pu> const& pv, std::string const& service_pool_name)
+    {
+        auto mask = threads::mask_type();
+        threads::resize(mask, topo_.get_number_of_pus());
+        for (pu const& p : pv)
+        {
+            threads::set(mask, p.id_);
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+        service_affinity_masks_[service_pool_name] = HPX_MOVE(mask);
+    }
+
+    void partitioner::set_service_affinity(
+        numa_domain const& nd, std::string const& service_pool_name)
+    {
+        std::vector<pu> pv;
+        for (core const& c : nd.cores_)
+        {
+            pv.insert(pv.end(), c.pus_.begin(), c.pus_.end());
+        }
+        set_service_affinity(pv, service_pool_name);
+    }
+
+    threads::mask_type partitioner::get_service_affinity_mask(
+        std::string const& service_pool_name,
+        threads::mask_cref_type used_processing_units) const
+    {
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            auto it = service_affinity_masks_.find(service_pool_name);
+            if (it == service_affinity_masks_.end())
+            {
+                it = service_affinity_masks_.find(std::string());
+            }
+            if (it != service_affinity_masks_.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::string const affinity =
+            rtcfg_.get_entry("hpx.service_affinity", "network");
+        if (affinity == "none")
+        {
+            return {};
+        }
+
+        if (affinity == "numa")
+        {
+            // bind to the first NUMA domain, preferring the processing units
+            // not used by any of the thread pools
+            threads::mask_type mask = topo_.get_numa_node_affinity_mask(0);
+            threads::mask_type const unused = ~used_processing_units & mask;
+            return threads::any(unused) ? unused : mask;
+        }
+
+        if (affinity == "network")
+        {
+            // bind close to the network adapters (falls back to the first
+            // NUMA domain if their locality is not known)
+            return topo_.get_service_affinity_mask(used_processing_units);
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "partitioner::get_service_affinity_mask",
+            "unknown service affinity '{}' (expected none, numa, or network)",
+            affinity);
+    }
+
     void partitioner::set_scheduler(
         scheduling_policy sched, std::string const& pool_name)
     {
@@ -207,6 +207,23 @@ namespace hpx::resource {
         partitioner_.add_resource(ndv, pool_name, exclusive);
     }
 
+    void partitioner::set_service_affinity(
+        std::vector<pu> const& pv, std::string const& service_pool_name)
+    {
+        partitioner_.set_service_affinity(pv, service_pool_name);
+    }
+
+    void partitioner::set_service_affinity(
+        numa_domain const& nd, std::string const& service_pool_name)
+    {
+        partitioner_.set_service_affinity(nd, service_pool_name);
+    }
+
+    void partitioner::enable_qos(qos_parameters const& params)
+    {
+        partitioner_.enable_qos(params);
+    }
+
     std::vector<numa_domain> const& partitioner::numa_domains() const
     {
         return partitioner_.numa_domains();
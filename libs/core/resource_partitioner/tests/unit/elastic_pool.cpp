@@ -0,0 +1,87 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elasticity controller suspends the cores of an idle pool and
+// that all work still gets done once the load increases again.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 10000;
+
+std::size_t count_active_cores(hpx::threads::thread_pool_base& pool)
+{
+    std::size_t active = 0;
+    std::size_t const num_threads = pool.get_os_thread_count();
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        if (pool.get_state(i) == hpx::state::running)
+        {
+            ++active;
+        }
+    }
+    return active;
+}
+
+int hpx_main()
+{
+    hpx::threads::thread_pool_base& pool =
+        hpx::resource::get_thread_pool("default");
+
+    // an idle pool should shrink to a single core
+    auto const start = std::chrono::steady_clock::now();
+    while (count_active_cores(pool) != 1 &&
+        std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(count_active_cores(pool), std::size_t(1));
+
+    // all work has to be executed while cores are being resumed
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&count]() {
+            hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+            ++count;
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    // shutting down has to resume all suspended cores
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[], std::string const& scheduler)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=" + scheduler, "hpx.elasticity.enabled=1",
+        "hpx.elasticity.interval=10"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(argc, argv, "local");
+    test_scheduler(argc, argv, "local-priority-fifo");
+
+    return hpx::util::report_errors();
+}
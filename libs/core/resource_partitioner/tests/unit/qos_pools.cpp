@@ -0,0 +1,102 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the quality of service mode of the resource partitioner reserves
+// cores for latency-class work and routes new work according to its priority.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::string current_pool_name()
+{
+    return hpx::this_thread::get_pool()->get_pool_name();
+}
+
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::resource::get_num_thread_pools(), std::size_t(2));
+    // the reserved cores may have several processing units each
+    std::size_t const latency_threads =
+        hpx::resource::get_num_threads("latency");
+    HPX_TEST_LTE(std::size_t(1), latency_threads);
+    HPX_TEST_EQ(hpx::resource::get_num_threads("default"),
+        hpx::resource::get_num_threads() - latency_threads);
+
+    hpx::execution::parallel_executor exec_hp(
+        hpx::threads::thread_priority::high);
+    hpx::execution::parallel_executor exec;
+
+    // latency-class work runs on the reserved cores
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(hpx::async(exec_hp, &current_pool_name).get(),
+            std::string("latency"));
+    }
+
+    // all other work runs on the default pool, even if created from a
+    // thread running on the latency pool
+    std::vector<hpx::future<std::string>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async(exec, &current_pool_name));
+        futures.push_back(hpx::async(exec_hp, [&exec]() {
+            return hpx::async(exec, &current_pool_name).get();
+        }));
+    }
+    for (auto& f : futures)
+    {
+        HPX_TEST_EQ(f.get(), std::string("default"));
+    }
+
+    // work explicitly created on the latency pool from the outside is routed
+    // as well
+    hpx::execution::parallel_executor exec_latency(
+        &hpx::resource::get_thread_pool("latency"));
+    HPX_TEST_EQ(hpx::async(exec_latency, &current_pool_name).get(),
+        std::string("default"));
+
+    return hpx::local::finalize();
+}
+
+void init_resource_partitioner_handler(
+    hpx::resource::partitioner& rp, hpx::program_options::variables_map const&)
+{
+    hpx::resource::qos_parameters params;
+    params.latency_cores = 2;
+    params.lending = false;
+    rp.enable_qos(params);
+}
+
+int main(int argc, char* argv[])
+{
+    // enable the quality of service mode through the configuration
+    {
+        hpx::local::init_params init_args;
+        init_args.cfg = {"hpx.os_threads=4", "hpx.qos.enabled=1",
+            "hpx.qos.lending=0"};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    // enable the quality of service mode explicitly
+    {
+        hpx::local::init_params init_args;
+        init_args.cfg = {"hpx.os_threads=4"};
+        init_args.rp_callback = &init_resource_partitioner_handler;
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the binding and the elastic sizing of the service thread pools.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/io_service.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(HPX_HAVE_IO_POOL)
+std::size_t service_pu = 0;
+
+void test_service_affinity()
+{
+    hpx::util::io_service_pool* pool = hpx::get_thread_pool("io_pool");
+    HPX_TEST(pool != nullptr);
+
+    std::promise<hpx::threads::mask_type> p;
+    std::future<hpx::threads::mask_type> f = p.get_future();
+    pool->post([&]() {
+        p.set_value(hpx::threads::create_topology().get_cpubind_mask());
+    });
+
+    hpx::threads::mask_type const mask = f.get();
+    HPX_TEST_EQ(hpx::threads::count(mask), static_cast<std::size_t>(1));
+    HPX_TEST(hpx::threads::test(mask, service_pu));
+}
+
+template <typename Pred>
+bool wait_for(Pred&& pred)
+{
+    auto const until =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!pred())
+    {
+        if (std::chrono::steady_clock::now() > until)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void test_elastic_pool()
+{
+    hpx::util::io_service_pool* pool = hpx::get_thread_pool("io_pool");
+    HPX_TEST_EQ(pool->size(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(pool->max_size(), static_cast<std::size_t>(2));
+
+    // the first two functions can complete only if they run concurrently,
+    // which requires the pool to start an additional thread
+    std::atomic<std::size_t> started(0);
+    std::atomic<std::size_t> finished(0);
+    for (int i = 0; i != 3; ++i)
+    {
+        pool->post([&]() {
+            ++started;
+            wait_for([&]() { return started.load() >= 2; });
+            ++finished;
+        });
+    }
+
+    HPX_TEST(wait_for([&]() { return finished.load() == 3; }));
+    HPX_TEST(pool->num_active_threads() <= pool->max_size());
+
+    // the additional thread exits after being idle for a while
+    HPX_TEST(wait_for([&]() { return pool->num_active_threads() == 1; }));
+}
+#endif
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_IO_POOL)
+    test_service_affinity();
+    test_elastic_pool();
+#endif
+
+    return hpx::local::finalize();
+}
+
+void init_resource_partitioner_handler(
+    hpx::resource::partitioner& rp, hpx::program_options::variables_map const&)
+{
+#if defined(HPX_HAVE_IO_POOL)
+    // bind the io pool to the last processing unit of the machine
+    hpx::resource::pu const& p =
+        rp.numa_domains().back().cores().back().pus().back();
+    service_pu = p.id();
+    rp.set_service_affinity(std::vector<hpx::resource::pu>{p}, "io_pool");
+#else
+    (void) rp;
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1", "hpx.threadpools.io_pool_size=1",
+        "hpx.threadpools.io_pool_max_size=2"};
+    init_args.rp_callback = &init_resource_partitioner_handler;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -139,17 +139,24 @@ int hpx_main()
     return hpx::local::finalize();
 }
 
-void test_scheduler(
-    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+void test_scheduler(int argc, char* argv[],
+    hpx::resource::scheduling_policy scheduler, bool fast_suspend)
 {
+    using hpx::threads::policies::scheduler_mode;
+
     hpx::local::init_params init_args;
 
     init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
-    init_args.rp_callback = [scheduler](hpx::resource::partitioner& rp,
+    init_args.rp_callback = [scheduler, fast_suspend](
+                                hpx::resource::partitioner& rp,
                                 hpx::program_options::variables_map const&) {
-        rp.create_thread_pool("worker", scheduler,
-            hpx::threads::policies::scheduler_mode::default_ |
-                hpx::threads::policies::scheduler_mode::enable_elasticity);
+        scheduler_mode mode =
+            scheduler_mode::default_ | scheduler_mode::enable_elasticity;
+        if (fast_suspend)
+        {
+            mode = mode | scheduler_mode::enable_fast_suspend;
+        }
+        rp.create_thread_pool("worker", scheduler, mode);
 
         std::size_t const worker_pool_threads =
             rp.get_number_requested_threads() - 1;
@@ -196,7 +203,8 @@ int main(int argc, char* argv[])
 
     for (auto const scheduler : schedulers)
     {
-        test_scheduler(argc, argv, scheduler);
+        test_scheduler(argc, argv, scheduler, false);
+        test_scheduler(argc, argv, scheduler, true);
     }
 
     return hpx::util::report_errors();
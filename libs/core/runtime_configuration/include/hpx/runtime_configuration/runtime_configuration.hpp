@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/ini/ini.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -19,6 +20,7 @@
 #include <hpx/runtime_configuration/runtime_mode.hpp>
 #include <hpx/runtime_configuration/static_factory_data.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -30,6 +32,47 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    namespace detail {
+
+        // A cached configuration entry may be updated while other threads
+        // read it. The value is accessed using relaxed atomic operations, it
+        // is not used to synchronize with other data.
+        template <typename T>
+        class cached_config_entry
+        {
+        public:
+            constexpr explicit cached_config_entry(T value) noexcept
+              : value_(value)
+            {
+            }
+
+            cached_config_entry(cached_config_entry const& rhs) noexcept
+              : value_(rhs.load())
+            {
+            }
+
+            cached_config_entry& operator=(
+                cached_config_entry const& rhs) noexcept
+            {
+                store(rhs.load());
+                return *this;
+            }
+
+            [[nodiscard]] T load() const noexcept
+            {
+                return value_.load(std::memory_order_relaxed);
+            }
+
+            void store(T value) noexcept
+            {
+                value_.store(value, std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<T> value_;
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     // The runtime_configuration class is a wrapper for the runtime
     // configuration data allowing to extract configuration information in a
@@ -85,12 +128,25 @@ namespace hpx::util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get the number of shards the AGAS client-side local cache is split
+        // into
+        std::size_t get_agas_local_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
 
+        // Get whether AGAS notifies localities about stale cache entries
+        bool get_agas_cache_invalidation_mode() const;
+
+        // Get whether the ids bound to names are cached locally
+        bool get_agas_symbol_caching_mode() const;
+
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the maximal time [us] decref requests are held back
+        std::int64_t get_agas_refcnt_flush_interval() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -110,10 +166,49 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // return the configuration of the coroutine stack pool
+        threads::coroutines::detail::posix::stack_pool_parameters
+        get_stack_pool_parameters() const;
 #endif
 
         // return trace_depth for stack-backtraces
-        std::size_t trace_depth() const;
+        std::size_t trace_depth() const noexcept
+        {
+            return trace_depth_.load();
+        }
+
+        // return the amount of diagnostic information to attach to exceptions
+        int get_exception_verbosity() const noexcept
+        {
+            return exception_verbosity_.load();
+        }
+
+        // Return whether suspending a thread while holding a lock should throw
+        // an exception (as opposed to logging the error)
+        bool throw_on_held_lock() const noexcept
+        {
+            return throw_on_held_lock_.load();
+        }
+
+        // The entries accessed on hot paths are converted to their typed
+        // representation once, whenever the configuration is (re-)initialized
+        // or an entry is added. This has to be called after modifying any of
+        // those entries through a section other than this object.
+        void update_cached_entries();
+
+        // Add or replace an entry, this updates the cached entries.
+        void add_entry(std::string const& key, entry_type const& val)
+        {
+            section::add_entry(key, val);
+            update_cached_entries();
+        }
+
+        void add_entry(std::string const& key, std::string const& val)
+        {
+            section::add_entry(key, val);
+            update_cached_entries();
+        }
 
         // Returns the number of OS threads this locality is running.
         std::size_t get_os_thread_count() const;
@@ -134,6 +229,10 @@ namespace hpx::util {
         // Return the configured sizes of any of the know thread pools
         std::size_t get_thread_pool_size(char const* poolname) const;
 
+        // Return the number of threads any of the known thread pools may grow
+        // to under load
+        std::size_t get_thread_pool_max_size(char const* poolname) const;
+
         // Return the endianness to be used for out-serialization
         std::string get_endian_out() const;
 
@@ -190,6 +289,9 @@ namespace hpx::util {
         std::ptrdiff_t medium_stacksize;
         std::ptrdiff_t large_stacksize;
         std::ptrdiff_t huge_stacksize;
+        detail::cached_config_entry<std::size_t> trace_depth_;
+        detail::cached_config_entry<int> exception_verbosity_;
+        detail::cached_config_entry<bool> throw_on_held_lock_;
         bool need_to_call_pre_initialize;
 #if defined(__linux) || defined(linux) || defined(__linux__)
         char const* argv0;
@@ -20,12 +20,16 @@
 #include <hpx/version.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <random>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -372,6 +376,147 @@ namespace hpx::util {
     }
 
     namespace detail {
+
+        // The plugin manifest caches the outcome of scanning the component
+        // directories: shared libraries which could be loaded but export
+        // neither component nor plugin factories are recorded together with
+        // their size and modification time, and are skipped (not loaded at
+        // all) by later runs as long as the file is unchanged. Libraries
+        // which fail to load are not recorded, as this may depend on the
+        // environment.
+        struct plugin_manifest
+        {
+            explicit plugin_manifest(std::string path)
+              : path_(HPX_MOVE(path))
+            {
+                if (path_.empty())
+                {
+                    return;
+                }
+
+                std::ifstream in(path_);
+                std::string line;
+                while (std::getline(in, line))
+                {
+                    // <size> <mtime> <path>
+                    std::string::size_type const p1 = line.find(' ');
+                    std::string::size_type const p2 = p1 != std::string::npos ?
+                        line.find(' ', p1 + 1) :
+                        std::string::npos;
+                    if (p2 == std::string::npos)
+                    {
+                        continue;
+                    }
+
+                    try
+                    {
+                        entries_[line.substr(p2 + 1)] = {
+                            std::stoull(line.substr(0, p1)),
+                            std::stoll(line.substr(p1 + 1, p2 - p1 - 1))};
+                    }
+                    catch (std::exception const&)
+                    {
+                        // ignore malformed entries
+                    }
+                }
+            }
+
+            bool enabled() const noexcept
+            {
+                return !path_.empty();
+            }
+
+            // return whether the given library is known not to be an HPX
+            // module
+            bool is_skipped(filesystem::path const& lib) const
+            {
+                auto const it = entries_.find(lib.string());
+                return it != entries_.end() && it->second == get_stamp(lib);
+            }
+
+            void add_skipped(filesystem::path const& lib)
+            {
+                entries_[lib.string()] = get_stamp(lib);
+                modified_ = true;
+            }
+
+            void remove(filesystem::path const& lib)
+            {
+                modified_ = entries_.erase(lib.string()) != 0 || modified_;
+            }
+
+            // write the manifest if it was changed, the file is replaced
+            // atomically as several processes may start at the same time
+            void save() const
+            {
+                if (!modified_)
+                {
+                    return;
+                }
+
+                std::string const tmp =
+                    path_ + "." + std::to_string(std::random_device()());
+                {
+                    std::ofstream out(tmp);
+                    for (auto const& [lib, stamp] : entries_)
+                    {
+                        out << stamp.first << ' ' << stamp.second << ' ' << lib
+                            << '\n';
+                    }
+                    if (!out)
+                    {
+                        LRT_(warning).format(
+                            "could not write plugin manifest: {}", path_);
+                        std::remove(tmp.c_str());
+                        return;
+                    }
+                }
+
+                std::error_code ec;
+                filesystem::rename(tmp, path_, ec);
+                if (ec)
+                {
+                    LRT_(warning).format("could not write plugin manifest: {}",
+                        ec.message());
+                    std::remove(tmp.c_str());
+                }
+            }
+
+        private:
+            using stamp_type = std::pair<std::uintmax_t, std::int64_t>;
+
+            template <typename Time>
+            static std::int64_t get_time(Time const& t)
+            {
+                // Boost.Filesystem reports a time_t
+                if constexpr (std::is_arithmetic_v<Time>)
+                {
+                    return static_cast<std::int64_t>(t);
+                }
+                else
+                {
+                    return static_cast<std::int64_t>(
+                        t.time_since_epoch().count());
+                }
+            }
+
+            static stamp_type get_stamp(filesystem::path const& lib)
+            {
+                std::error_code ec;
+                std::uintmax_t const size = filesystem::file_size(lib, ec);
+                if (ec)
+                {
+                    return {0, 0};
+                }
+                auto const time = filesystem::last_write_time(lib, ec);
+                return ec ? stamp_type{0, 0} : stamp_type{size, get_time(time)};
+            }
+
+            std::string path_;
+            std::map<std::string, stamp_type> entries_;
+            bool modified_ = false;
+        };
+
         inline bool cmppath_less(
             std::pair<filesystem::path, std::string> const& lhs,
             std::pair<filesystem::path, std::string> const& rhs)
@@ -481,6 +626,19 @@ namespace hpx::util {
         if (libdata.empty())
             return plugin_registries;
 
+        // skip the libraries known not to be HPX modules
+        detail::plugin_manifest manifest(
+            ini.get_entry("hpx.plugin_manifest", ""));
+        if (manifest.enabled())
+        {
+            auto const is_skipped = [&](auto const& p) {
+                return manifest.is_skipped(p.first);
+            };
+            libdata.erase(
+                std::remove_if(libdata.begin(), libdata.end(), is_skipped),
+                libdata.end());
+        }
+
         // make sure each node loads libraries in a different order
         std::random_device random_device;
         std::mt19937 generator(random_device());
@@ -545,7 +703,17 @@ namespace hpx::util {
             if (must_keep_loaded)
             {
                 modules.emplace(p.second, HPX_MOVE(d));
+                manifest.remove(p.first);
             }
+            else if (manifest.enabled())
+            {
+                manifest.add_skipped(p.first);
+            }
+        }
+
+        if (manifest.enabled())
+        {
+            manifest.save();
         }
         return plugin_registries;
     }
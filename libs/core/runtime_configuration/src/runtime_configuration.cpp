@@ -105,6 +105,7 @@ namespace hpx::util {
             "[hpx]",
             "location = ${HPX_LOCATION:$[system.prefix]}",
             "component_paths = ${HPX_COMPONENT_PATHS}",
+            "plugin_manifest = ${HPX_PLUGIN_MANIFEST}",
             "component_base_paths = $[hpx.location]"    // NOLINT
                 HPX_INI_PATH_DELIMITER "$[system.executable_prefix]",
             "component_path_suffixes = " +
@@ -119,6 +120,7 @@ namespace hpx::util {
             "finalize_wait_time = ${HPX_FINALIZE_WAIT_TIME:-1.0}",
             "shutdown_timeout = ${HPX_SHUTDOWN_TIMEOUT:-1.0}",
             "shutdown_check_count = ${HPX_SHUTDOWN_CHECK_COUNT:10}",
+            "bootstrap_tree_arity = ${HPX_BOOTSTRAP_TREE_ARITY:0}",
 #ifdef HPX_HAVE_VERIFY_LOCKS
 #if defined(HPX_DEBUG)
             "lock_detection = ${HPX_LOCK_DETECTION:1}",
@@ -161,6 +163,8 @@ namespace hpx::util {
             "pu_offset = 0",
             "numa_sensitive = 0",
             "loopback_network = 0",
+            // binding of the service threads: none, numa, or network
+            "service_affinity = ${HPX_SERVICE_AFFINITY:network}",
             "max_background_threads = "
             "${HPX_MAX_BACKGROUND_THREADS:$[hpx.os_threads]}",
             "max_idle_loop_count = ${HPX_MAX_IDLE_LOOP_COUNT:" HPX_PP_STRINGIZE(
@@ -171,7 +175,15 @@ namespace hpx::util {
             "max_idle_backoff_time = "
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
+            "idle_parking = ${HPX_IDLE_PARKING:0}",
 #endif
+            "timer_wheel = ${HPX_TIMER_WHEEL:0}",
+            "fast_suspend = ${HPX_FAST_SUSPEND:0}",
+            "inline_continuation_depth = ${HPX_INLINE_CONTINUATION_DEPTH:0}",
+            "fused_continuation_depth = ${HPX_FUSED_CONTINUATION_DEPTH:"
+                HPX_PP_STRINGIZE(
+                    HPX_PP_EXPAND(HPX_FUSED_CONTINUATION_MAX_DEPTH)) "}",
+            "preemption_time_slice = ${HPX_PREEMPTION_TIME_SLICE:0}",
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
@@ -202,6 +214,34 @@ namespace hpx::util {
             "enable = 1",
 #endif
 
+            // adapt the number of active cores of a pool to its load
+            "[hpx.elasticity]",
+            "enabled = ${HPX_ELASTICITY:0}",
+            "min_threads = ${HPX_ELASTICITY_MIN_THREADS:1}",
+            "max_threads = ${HPX_ELASTICITY_MAX_THREADS:0}",
+            "interval = ${HPX_ELASTICITY_INTERVAL:100}",
+            "grow_queue_length = ${HPX_ELASTICITY_GROW_QUEUE_LENGTH:2.0}",
+            "shrink_idle_rate = ${HPX_ELASTICITY_SHRINK_IDLE_RATE:0.9}",
+
+            // reserve cores for latency-class (high priority) work
+            "[hpx.qos]",
+            "enabled = ${HPX_QOS:0}",
+            "latency_pool = ${HPX_QOS_LATENCY_POOL:latency}",
+            "latency_cores = ${HPX_QOS_LATENCY_CORES:1}",
+            "lending = ${HPX_QOS_LENDING:1}",
+            "lend_reserve = ${HPX_QOS_LEND_RESERVE:0}",
+
+#if defined(HPX_HAVE_NETWORKING)
+            // steal stealable actions between localities
+            "[hpx.work_stealing]",
+            "enabled = ${HPX_WORK_STEALING:0}",
+            "interval = ${HPX_WORK_STEALING_INTERVAL:10}",
+            "fanout = ${HPX_WORK_STEALING_FANOUT:2}",
+            "gossip_size = ${HPX_WORK_STEALING_GOSSIP_SIZE:8}",
+            "max_batch = ${HPX_WORK_STEALING_MAX_BATCH:64}",
+            "idle_threshold = ${HPX_WORK_STEALING_IDLE_THRESHOLD:0}",
+#endif
+
             "[hpx.stacks]",
             "small_size = ${HPX_SMALL_STACK_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_SMALL_STACK_SIZE)) "}",
@@ -214,8 +254,21 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:0}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGE_STACKS:0}",
+            "pool_thread_cache_size = ${HPX_STACK_POOL_THREAD_CACHE_SIZE:16}",
+            "pool_global_size = ${HPX_STACK_POOL_GLOBAL_SIZE:256}",
 #endif
+            "track_usage = ${HPX_TRACK_STACK_USAGE:0}",
+            "auto_select = ${HPX_AUTO_SELECT_STACK_SIZE:0}",
+
+#ifdef HPX_HAVE_LOCK_PROFILING
+            "[hpx.lock_profiling]",
+            "enable = ${HPX_LOCK_PROFILING:0}",
+            // number of locks listed at shutdown, zero to disable the report
+            "report = ${HPX_LOCK_PROFILING_REPORT:20}",
 
+#endif
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:" HPX_PP_STRINGIZE(
@@ -257,6 +310,19 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "trim_interval = "
+            "${HPX_THREAD_QUEUE_TRIM_INTERVAL:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_TRIM_INTERVAL)) "}",
+            "workrequesting_numa_hierarchical = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_NUMA_HIERARCHICAL:0}",
+            "workrequesting_numa_remote_backoff = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_NUMA_REMOTE_BACKOFF:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF)) "}",
+            "workrequesting_steal_half = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_STEAL_HALF:0}",
+            "workrequesting_max_steal_batch = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_MAX_STEAL_BATCH:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_WORKREQUESTING_MAX_STEAL_BATCH)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -304,11 +370,18 @@ namespace hpx::util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "refcnt_flush_interval = ${HPX_AGAS_REFCNT_FLUSH_INTERVAL:"
+            HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)) "}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:"
+            HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SHARDS)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
+            "use_cache_invalidation = ${HPX_AGAS_USE_CACHE_INVALIDATION:0}",
+            "use_symbol_caching = ${HPX_AGAS_USE_SYMBOL_CACHING:0}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
@@ -380,6 +453,8 @@ namespace hpx::util {
             "format = ${HPX_LOGFORMAT:" HPX_LOGFORMAT
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
                 HPX_TIMEFORMAT ") [%idx%]|\\n}",
+            "async = ${HPX_LOGASYNC:0}",
+            "async_buffer_size = ${HPX_LOGASYNC_BUFFER_SIZE:1024}",
 
             // general console logging
             "[hpx.logging.console]",
@@ -686,6 +761,9 @@ namespace hpx::util {
       , medium_stacksize(HPX_MEDIUM_STACK_SIZE)
       , large_stacksize(HPX_LARGE_STACK_SIZE)
       , huge_stacksize(HPX_HUGE_STACK_SIZE)
+      , trace_depth_(HPX_HAVE_THREAD_BACKTRACE_DEPTH)
+      , exception_verbosity_(2)
+      , throw_on_held_lock_(true)
       , need_to_call_pre_initialize(true)
 #if defined(__linux) || defined(linux) || defined(__linux__)
       , argv0(argv0_)
@@ -706,6 +784,8 @@ namespace hpx::util {
         large_stacksize = init_large_stack_size();
         HPX_ASSERT(init_huge_stack_size() <= HPX_HUGE_STACK_SIZE);
         huge_stacksize = init_huge_stack_size();
+
+        update_cached_entries();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -737,6 +817,30 @@ namespace hpx::util {
         medium_stacksize = init_medium_stack_size();
         large_stacksize = init_large_stack_size();
         huge_stacksize = init_huge_stack_size();
+
+        update_cached_entries();
+    }
+
+    void runtime_configuration::update_cached_entries()
+    {
+        std::size_t trace_depth = HPX_HAVE_THREAD_BACKTRACE_DEPTH;
+        int exception_verbosity = 2;
+        bool throw_on_held_lock = true;
+
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            trace_depth = hpx::util::get_entry_as<std::size_t>(
+                *sec, "trace_depth", HPX_HAVE_THREAD_BACKTRACE_DEPTH);
+            exception_verbosity =
+                hpx::util::get_entry_as<int>(*sec, "exception_verbosity", 2);
+            throw_on_held_lock =
+                hpx::util::get_entry_as<int>(*sec, "throw_on_held_lock", 1) !=
+                0;
+        }
+
+        trace_depth_.store(trace_depth);
+        exception_verbosity_.store(exception_verbosity);
+        throw_on_held_lock_.store(throw_on_held_lock);
     }
 
     std::size_t runtime_configuration::get_ipc_data_buffer_cache_size() const
@@ -889,6 +993,19 @@ namespace hpx::util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        std::size_t num_shards = HPX_AGAS_LOCAL_CACHE_SHARDS;
+
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            num_shards = hpx::util::get_entry_as<std::size_t>(
+                *sec, "local_cache_shards", num_shards);
+        }
+
+        return num_shards != 0 ? num_shards : 1;    // limit lower bound
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
@@ -908,6 +1025,26 @@ namespace hpx::util {
         return false;
     }
 
+    bool runtime_configuration::get_agas_cache_invalidation_mode() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "use_cache_invalidation", 0) != 0;
+        }
+        return false;
+    }
+
+    bool runtime_configuration::get_agas_symbol_caching_mode() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "use_symbol_caching", 0) != 0;
+        }
+        return false;
+    }
+
     std::size_t runtime_configuration::get_agas_max_pending_refcnt_requests()
         const
     {
@@ -920,6 +1057,17 @@ namespace hpx::util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::int64_t runtime_configuration::get_agas_refcnt_flush_interval() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::int64_t>(*sec,
+                "refcnt_flush_interval",
+                HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL);
+        }
+        return HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1012,16 +1160,6 @@ namespace hpx::util {
 #endif
     }
 
-    std::size_t runtime_configuration::trace_depth() const
-    {
-        if (util::section const* sec = get_section("hpx"); nullptr != sec)
-        {
-            return hpx::util::get_entry_as<std::size_t>(
-                *sec, "trace_depth", HPX_HAVE_THREAD_BACKTRACE_DEPTH);
-        }
-        return HPX_HAVE_THREAD_BACKTRACE_DEPTH;
-    }
-
     std::size_t runtime_configuration::get_os_thread_count() const
     {
         if (num_os_threads == 0)
@@ -1058,6 +1196,20 @@ namespace hpx::util {
         return 2;    // the default size for all pools is 2
     }
 
+    std::size_t runtime_configuration::get_thread_pool_max_size(
+        char const* poolname) const
+    {
+        std::size_t const size = get_thread_pool_size(poolname);
+        if (util::section const* sec = get_section("hpx.threadpools");
+            nullptr != sec)
+        {
+            return (std::max)(size,
+                hpx::util::get_entry_as<std::size_t>(
+                    *sec, std::string(poolname) + "_max_size", size));
+        }
+        return size;    // by default, pools are not resized
+    }
+
     // Return the endianness to be used for out-serialization
     std::string runtime_configuration::get_endian_out() const
     {
@@ -1099,6 +1251,29 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    threads::coroutines::detail::posix::stack_pool_parameters
+    runtime_configuration::get_stack_pool_parameters() const
+    {
+        threads::coroutines::detail::posix::stack_pool_parameters params;
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            params.enabled_ =
+                hpx::util::get_entry_as<int>(*sec, "use_pool", 0) != 0;
+            params.use_huge_pages_ =
+                hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) != 0;
+            params.thread_cache_size_ = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_thread_cache_size", params.thread_cache_size_);
+            params.global_pool_size_ = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_global_size", params.global_pool_size_);
+            params.huge_page_max_stack_size_ =
+                static_cast<std::size_t>((std::max)(
+                    get_stack_size(threads::thread_stacksize::small_),
+                    get_stack_size(threads::thread_stacksize::medium)));
+        }
+        return params;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1170,6 +1345,9 @@ namespace hpx::util {
             section applroot;
             applroot.add_section("application", appcfg);
             this->section::merge(applroot);
+
+            // the cached entries may refer to the application configuration
+            update_cached_entries();
         }
         catch (hpx::exception const& e)
         {
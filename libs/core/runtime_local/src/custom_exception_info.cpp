@@ -16,7 +16,6 @@
 #include <hpx/modules/threading.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/threadmanager.hpp>
-#include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
 #include <hpx/runtime_local/get_locality_id.hpp>
@@ -64,8 +63,9 @@ namespace hpx {
     // return a string holding a formatted message.
     std::string diagnostic_information(hpx::exception_info const& xi)
     {
-        int const verbosity = util::from_string<int>(
-            get_config_entry("hpx.exception_verbosity", "2"));
+        hpx::runtime const* rt = get_runtime_ptr();
+        int const verbosity =
+            rt != nullptr ? rt->get_config().get_exception_verbosity() : 2;
 
         std::ostringstream strm;
         strm << "\n";
@@ -397,16 +397,17 @@ namespace hpx::detail {
     {
         std::int64_t const pid = ::getpid();
 
-        auto const trace_depth =
-            util::from_string<std::size_t>(get_config_entry(
-                "hpx.trace_depth", HPX_HAVE_THREAD_BACKTRACE_DEPTH));
+        hpx::runtime const* rt = get_runtime_ptr();
+        std::size_t const trace_depth = rt != nullptr ?
+            rt->get_config().trace_depth() :
+            static_cast<std::size_t>(HPX_HAVE_THREAD_BACKTRACE_DEPTH);
 
         std::string const back_trace(
             hpx::util::trace_on_new_stack(trace_depth));
 
         std::string state_name("not running");
         std::string hostname;
-        if (hpx::runtime const* rt = get_runtime_ptr())
+        if (rt != nullptr)
         {
             state const rts_state = rt->get_state();
             state_name = get_runtime_state_name(rts_state);
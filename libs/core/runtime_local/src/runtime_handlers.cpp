@@ -14,7 +14,6 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/threadmanager.hpp>
-#include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
 #include <hpx/runtime_local/runtime_handlers.hpp>
@@ -96,7 +95,8 @@ namespace hpx { namespace detail {
         std::string back_trace = hpx::util::trace(std::size_t(128));
 
         // throw or log, depending on config options
-        if (get_config_entry("hpx.throw_on_held_lock", "1") == "0")
+        hpx::runtime const* rt = get_runtime_ptr();
+        if (rt != nullptr && !rt->get_config().throw_on_held_lock())
         {
             if (back_trace.empty())
             {
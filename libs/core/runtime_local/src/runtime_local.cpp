@@ -435,10 +435,13 @@ namespace hpx {
 #ifdef HPX_HAVE_IO_POOL
         io_pool_notifier_ = HPX_MOVE(io_pool_notifier);
         io_pool_->init(rtcfg_.get_thread_pool_size("io_pool"));
+        io_pool_->set_max_size(rtcfg_.get_thread_pool_max_size("io_pool"));
 #endif
 #ifdef HPX_HAVE_TIMER_POOL
         timer_pool_notifier_ = HPX_MOVE(timer_pool_notifier);
         timer_pool_->init(rtcfg_.get_thread_pool_size("timer_pool"));
+        timer_pool_->set_max_size(
+            rtcfg_.get_thread_pool_max_size("timer_pool"));
 #endif
 
         thread_manager_.reset(new hpx::threads::threadmanager(rtcfg_,
@@ -1881,9 +1884,16 @@ namespace hpx {
 
         notification_policy_type notifier;
 
+        // the threads of the service pools are bound separately from the
+        // worker threads
+        bool const service_thread =
+            type == runtime_local::os_thread_type::io_thread ||
+            type == runtime_local::os_thread_type::timer_thread ||
+            type == runtime_local::os_thread_type::parcel_thread;
+
         notifier.add_on_start_thread_callback(
             hpx::bind(&runtime::init_tss_helper, this, prefix, type, _1, _2, _3,
-                _4, false));
+                _4, service_thread));
         notifier.add_on_stop_thread_callback(
             hpx::bind(&runtime::deinit_tss_helper, this, prefix, _1));
         notifier.set_on_error_callback(
@@ -1960,12 +1970,19 @@ namespace hpx {
                 thread_manager_->get_used_processing_units();
 
             // --hpx:bind=none  should disable all affinity definitions
-            if (threads::any(used_processing_units))
+            if (threads::any(used_processing_units) &&
+                resource::is_partitioner_valid())
             {
-                this->topology_.set_thread_affinity_mask(
-                    this->topology_.get_service_affinity_mask(
-                        used_processing_units),
-                    ec);
+                // the binding can be configured using the resource
+                // partitioner or hpx.service_affinity (none leaves the
+                // threads unbound)
+                threads::mask_type const service_mask =
+                    resource::get_partitioner().get_service_affinity_mask(
+                        pool_name ? pool_name : "", used_processing_units);
+                if (threads::any(service_mask))
+                {
+                    this->topology_.set_thread_affinity_mask(service_mask, ec);
+                }
 
                 // comment this out for now as on CircleCI this is causing
                 // unending grief
@@ -0,0 +1,98 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the cached configuration entries follow the changes made to the
+// configuration at runtime.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_initial_entries()
+{
+    auto const& cfg = hpx::get_runtime().get_config();
+
+    // set on the command line, see main
+    HPX_TEST_EQ(cfg.get_exception_verbosity(), 1);
+    HPX_TEST_EQ(cfg.trace_depth(), std::size_t(5));
+    HPX_TEST(cfg.throw_on_held_lock());
+}
+
+void test_set_config_entry()
+{
+    auto const& cfg = hpx::get_runtime().get_config();
+
+    hpx::set_config_entry("hpx.exception_verbosity", "0");
+    HPX_TEST_EQ(cfg.get_exception_verbosity(), 0);
+
+    hpx::set_config_entry("hpx.trace_depth", std::size_t(9));
+    HPX_TEST_EQ(cfg.trace_depth(), std::size_t(9));
+}
+
+void test_add_entry()
+{
+    auto& cfg = hpx::get_runtime().get_config();
+
+    cfg.add_entry("hpx.throw_on_held_lock", "0");
+    HPX_TEST(!cfg.throw_on_held_lock());
+
+    cfg.add_entry("hpx.throw_on_held_lock", "1");
+    HPX_TEST(cfg.throw_on_held_lock());
+
+    cfg.add_entry("hpx.trace_depth", "7");
+    HPX_TEST_EQ(cfg.trace_depth(), std::size_t(7));
+}
+
+void test_application_configuration()
+{
+    auto& cfg = hpx::get_runtime().get_config();
+
+    // the entry refers to the application configuration, which is not
+    // loaded yet
+    cfg.add_entry(
+        "hpx.exception_verbosity", "$[application.settings.verbosity:2]");
+    HPX_TEST_EQ(cfg.get_exception_verbosity(), 2);
+
+    std::string const filename = "cached_config_entries.ini";
+    {
+        std::ofstream out(filename);
+        out << "[settings]\nverbosity = 1\n";
+    }
+
+    HPX_TEST(cfg.load_application_configuration(filename.c_str()));
+    HPX_TEST_EQ(cfg.get_exception_verbosity(), 1);
+
+    std::remove(filename.c_str());
+}
+
+int hpx_main()
+{
+    test_initial_entries();
+    test_set_config_entry();
+    test_add_entry();
+    test_application_configuration();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.exception_verbosity=1", "hpx.trace_depth=5"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
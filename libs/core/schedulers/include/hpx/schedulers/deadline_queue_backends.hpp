@@ -0,0 +1,146 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::policies {
+
+    struct deadline_fifo;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first: the items are kept in a binary heap ordered by
+    // the deadline of the referenced thread (see thread_init_data::deadline).
+    // Items with the same deadline (in particular all items without a
+    // deadline) are handed out in FIFO order. Stealing takes the item with the
+    // earliest deadline as well, which lets idle cores pick up the most
+    // urgent work of their neighbors.
+    template <typename T>
+    struct deadline_fifo_backend
+    {
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+    private:
+        using time_point = std::chrono::steady_clock::time_point;
+
+        struct heap_item
+        {
+            time_point deadline_;
+            std::uint64_t sequence_;
+            T value_;
+        };
+
+        // std::push_heap/pop_heap maintain a max-heap, invert the ordering
+        struct later
+        {
+            bool operator()(
+                heap_item const& lhs, heap_item const& rhs) const noexcept
+            {
+                if (lhs.deadline_ != rhs.deadline_)
+                    return rhs.deadline_ < lhs.deadline_;
+                return rhs.sequence_ < lhs.sequence_;
+            }
+        };
+
+        static time_point get_deadline(const_reference val) noexcept
+        {
+            if constexpr (std::is_convertible_v<T,
+                              thread_id_ref_type::thread_repr*>)
+            {
+                return static_cast<thread_data const*>(val)->get_deadline();
+            }
+            else
+            {
+                // thread_queue wraps the thread id if queue wait times are
+                // being measured
+                return get_thread_id_data(val->data)->get_deadline();
+            }
+        }
+
+    public:
+        explicit deadline_fifo_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+        {
+            heap_.reserve(static_cast<std::size_t>(initial_size));
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            time_point const deadline = get_deadline(val);
+
+            std::lock_guard<hpx::util::spinlock> l(mtx_);
+            heap_.push_back(heap_item{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), later{});
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        bool push(rvalue_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            time_point const deadline = get_deadline(val);
+
+            std::lock_guard<hpx::util::spinlock> l(mtx_);
+            heap_.push_back(heap_item{deadline, sequence_++, HPX_MOVE(val)});
+            std::push_heap(heap_.begin(), heap_.end(), later{});
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        bool pop(reference val, bool /* steal */ = true) noexcept
+        {
+            if (size_.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            std::lock_guard<hpx::util::spinlock> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end(), later{});
+            val = HPX_MOVE(heap_.back().value_);
+            heap_.pop_back();
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        bool empty() noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+    private:
+        hpx::util::spinlock mtx_;
+        std::vector<heap_item> heap_;
+        std::uint64_t sequence_ = 0;
+        std::atomic<std::size_t> size_{0};
+    };
+
+    struct deadline_fifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = deadline_fifo_backend<T>;
+        };
+    };
+}    // namespace hpx::threads::policies
@@ -543,11 +543,17 @@ namespace hpx::threads::policies {
         void create_thread(thread_init_data& data, thread_id_ref_type* id,
             error_code& ec) override
         {
-            // NOTE: This scheduler ignores NUMA hints.
-            std::size_t num_thread =
-                data.schedulehint.mode == thread_schedule_hint_mode::thread ?
-                data.schedulehint.hint :
-                static_cast<std::size_t>(-1);
+            std::size_t num_thread = static_cast<std::size_t>(-1);
+            if (data.schedulehint.mode == thread_schedule_hint_mode::thread)
+            {
+                num_thread = data.schedulehint.hint;
+            }
+            else if (data.schedulehint.mode ==
+                    thread_schedule_hint_mode::numa &&
+                data.schedulehint.hint >= 0)
+            {
+                num_thread = select_numa_thread(data.schedulehint.hint);
+            }
 
             if (static_cast<std::size_t>(-1) == num_thread)
             {
@@ -658,6 +664,9 @@ namespace hpx::threads::policies {
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
             [[maybe_unused]] thread_queue_type* this_queue)
         {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->record_steal_attempt(num_thread);
+#endif
             thread_queue_type* q = nullptr;
             if (num_thread < num_high_priority_queues_)
             {
@@ -674,6 +683,7 @@ namespace hpx::threads::policies {
                             q->increment_num_stolen_from_pending();
                             this_high_priority_queue
                                 ->increment_num_stolen_to_pending();
+                            this->record_steal(num_thread, idx, 1);
 #endif
                             return true;
                         }
@@ -685,6 +695,7 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_pending();
                         this_queue->increment_num_stolen_to_pending();
+                        this->record_steal(num_thread, idx, 1);
 #endif
                         return true;
                     }
@@ -702,6 +713,7 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_pending();
                         this_queue->increment_num_stolen_to_pending();
+                        this->record_steal(num_thread, idx, 1);
 #endif
                         return true;
                     }
@@ -727,7 +739,10 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                 this_high_priority_queue->increment_num_pending_accesses();
                 if (result)
+                {
+                    this->end_steal_attempt(num_thread);
                     return true;
+                }
                 this_high_priority_queue->increment_num_pending_misses();
 #else
                 if (result)
@@ -744,7 +759,10 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                 q->increment_num_pending_accesses();
                 if (result)
+                {
+                    this->end_steal_attempt(num_thread);
                     return true;
+                }
                 q->increment_num_pending_misses();
 #else
                 if (result)
@@ -770,7 +788,16 @@ namespace hpx::threads::policies {
                 return true;
             }
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            if (low_priority_queue_.get_next_thread(thrd))
+            {
+                this->end_steal_attempt(num_thread);
+                return true;
+            }
+            return false;
+#else
             return low_priority_queue_.get_next_thread(thrd);
+#endif
         }
 
         // Schedule the passed thread
@@ -779,7 +806,6 @@ namespace hpx::threads::policies {
             bool allow_fallback = false,
             thread_priority priority = thread_priority::default_) override
         {
-            // NOTE: This scheduler ignores NUMA hints.
             auto num_thread = static_cast<std::size_t>(-1);
             if (schedulehint.mode == thread_schedule_hint_mode::thread)
             {
@@ -787,6 +813,11 @@ namespace hpx::threads::policies {
             }
             else
             {
+                if (schedulehint.mode == thread_schedule_hint_mode::numa &&
+                    schedulehint.hint >= 0)
+                {
+                    num_thread = select_numa_thread(schedulehint.hint);
+                }
                 allow_fallback = false;
             }
 
@@ -889,7 +920,6 @@ namespace hpx::threads::policies {
             bool allow_fallback = false,
             thread_priority priority = thread_priority::default_) override
         {
-            // NOTE: This scheduler ignores NUMA hints.
             auto num_thread = static_cast<std::size_t>(-1);
             if (schedulehint.mode == thread_schedule_hint_mode::thread)
             {
@@ -897,6 +927,11 @@ namespace hpx::threads::policies {
             }
             else
             {
+                if (schedulehint.mode == thread_schedule_hint_mode::numa &&
+                    schedulehint.hint >= 0)
+                {
+                    num_thread = select_numa_thread(schedulehint.hint);
+                }
                 allow_fallback = false;
             }
 
@@ -1156,6 +1191,39 @@ namespace hpx::threads::policies {
             return true;
         }
 
+        bool has_higher_priority_work(std::size_t num_thread,
+            thread_priority priority) const noexcept override
+        {
+            if (num_thread >= num_queues_)
+            {
+                return false;
+            }
+
+            switch (priority)
+            {
+            case thread_priority::low:
+                if (queues_[num_thread].data_->get_queue_length(
+                        std::memory_order_relaxed) != 0 ||
+                    bound_queues_[num_thread].data_->get_queue_length(
+                        std::memory_order_relaxed) != 0)
+                {
+                    return true;
+                }
+                [[fallthrough]];
+
+            case thread_priority::default_:
+                [[fallthrough]];
+            case thread_priority::normal:
+                return num_thread < num_high_priority_queues_ &&
+                    high_priority_queues_[num_thread].data_->get_queue_length(
+                        std::memory_order_relaxed) != 0;
+
+            default:
+                break;
+            }
+            return false;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Enumerate matching threads from all queues
         bool enumerate_threads(hpx::function<bool(thread_id_type)> const& f,
@@ -1294,6 +1362,9 @@ namespace hpx::threads::policies {
             thread_queue_type* this_high_priority_queue,
             thread_queue_type* this_queue)
         {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->record_steal_attempt(num_thread);
+#endif
             bool result = true;
             thread_queue_type* q = nullptr;
             if (num_thread < num_high_priority_queues_)
@@ -1315,6 +1386,7 @@ namespace hpx::threads::policies {
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue
                                 ->increment_num_stolen_to_staged(added);
+                            this->record_steal(num_thread, idx, added);
 #endif
                             return result;
                         }
@@ -1329,6 +1401,7 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        this->record_steal(num_thread, idx, added);
 #endif
                         return result;
                     }
@@ -1349,6 +1422,7 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        this->record_steal(num_thread, idx, added);
 #endif
                         return result;
                     }
@@ -1500,6 +1574,10 @@ namespace hpx::threads::policies {
             bound_queues_[num_thread].data_->on_start_thread(num_thread);
             queues_[num_thread].data_->on_start_thread(num_thread);
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->init_steal_telemetry(num_thread, affinity_data_);
+#endif
+
             std::size_t const num_threads = num_queues_;
             auto const& topo = create_topology();
 
@@ -1516,6 +1594,10 @@ namespace hpx::threads::policies {
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
             }
 
+            // allow for NUMA hints to be resolved to this thread
+            set_numa_domain(num_thread,
+                static_cast<std::size_t>(numa_domains[num_thread]));
+
             // iterate over the number of threads again to determine where to
             // steal from
             std::ptrdiff_t const radius =
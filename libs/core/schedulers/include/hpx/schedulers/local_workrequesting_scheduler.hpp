@@ -20,7 +20,9 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -28,6 +30,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -87,9 +90,84 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// Optionally, victims can be selected hierarchically based on the hardware
+// topology. In this mode a thief first asks workers running on the same core,
+// then workers in the same NUMA domain. Workers located in other NUMA domains
+// are asked only after a configurable number of steal requests circulated in
+// the local domain have returned unsatisfied. This keeps idle workers from
+// pulling tasks (and their working set) across the socket interconnect while
+// there is still work available locally.
 
 namespace hpx::threads::policies {
 
+    namespace detail {
+
+        // Select a random victim out of the num_queues cores for a steal
+        // request that has already been sent to the cores in asked (which
+        // includes the thief). Cores in core_victims are selected first,
+        // followed by cores in numa_victims, followed by all remaining cores
+        // if allow_remote is set. Returns std::size_t(-1) if no victim is
+        // left.
+        template <typename Generator>
+        std::size_t select_hierarchical_victim(std::size_t num_queues,
+            mask_cref_type asked, mask_cref_type core_victims,
+            mask_cref_type numa_victims, bool allow_remote,
+            Generator& gen) noexcept
+        {
+            auto const select = [&](auto&& is_candidate) -> std::size_t {
+                std::size_t num_candidates = 0;
+                for (std::size_t i = 0; i != num_queues; ++i)
+                {
+                    if (!test(asked, i) && is_candidate(i))
+                    {
+                        ++num_candidates;
+                    }
+                }
+
+                if (num_candidates == 0)
+                {
+                    return static_cast<std::size_t>(-1);
+                }
+
+                std::uniform_int_distribution<std::size_t> uniform(
+                    0, num_candidates - 1);
+
+                std::size_t selected_victim = uniform(gen);
+                for (std::size_t i = 0; i != num_queues; ++i)
+                {
+                    if (!test(asked, i) && is_candidate(i))
+                    {
+                        if (selected_victim == 0)
+                        {
+                            return i;
+                        }
+                        --selected_victim;
+                    }
+                }
+
+                HPX_ASSERT(false);
+                return static_cast<std::size_t>(-1);
+            };
+
+            std::size_t victim =
+                select([&](std::size_t i) { return test(core_victims, i); });
+            if (victim != static_cast<std::size_t>(-1))
+            {
+                return victim;
+            }
+
+            victim =
+                select([&](std::size_t i) { return test(numa_victims, i); });
+            if (victim != static_cast<std::size_t>(-1) || !allow_remote)
+            {
+                return victim;
+            }
+
+            return select([](std::size_t) { return true; });
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     using default_local_workrequesting_scheduler_terminated_queue =
@@ -151,6 +229,23 @@ namespace hpx::threads::policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+
+            // select victims hierarchically: same core, same NUMA domain,
+            // remote NUMA domains
+            bool numa_hierarchical_ = false;
+
+            // number of unsatisfied local steal requests before remote NUMA
+            // domains are asked for work
+            std::uint16_t numa_remote_backoff_ =
+                HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF;
+
+            // always request half of the victim's pending tasks instead of
+            // adaptively switching between steal-one and steal-half
+            bool steal_half_ = false;
+
+            // maximal number of tasks sent in response to a single steal-half
+            // request
+            std::size_t max_steal_batch_ = HPX_WORKREQUESTING_MAX_STEAL_BATCH;
         };
         using init_parameter_type = init_parameter;
 
@@ -187,13 +282,15 @@ namespace hpx::threads::policies {
             steal_request() = default;
 
             steal_request(std::size_t const num_thread, task_channel* channel,
-                mask_cref_type victims, bool idle, bool const stealhalf)
+                mask_cref_type victims, bool idle, bool const stealhalf,
+                bool const allow_remote = true)
               : channel_(channel)
               , victims_(victims)
               , num_thread_(static_cast<std::uint16_t>(num_thread))
               , attempt_(static_cast<std::uint16_t>(count(victims) - 1))
               , state_(idle ? state::idle : state::working)
               , stealhalf_(stealhalf)
+              , allow_remote_(allow_remote)
             {
             }
 
@@ -204,6 +301,9 @@ namespace hpx::threads::policies {
             state state_ = state::failed;
             // true ? attempt steal-half : attempt steal-one
             bool stealhalf_ = false;
+            // true ? all cores may be asked : only cores in the thief's NUMA
+            // domain may be asked (hierarchical mode only)
+            bool allow_remote_ = true;
         };
 
         ////////////////////////////////////////////////////////////////////////
@@ -283,6 +383,17 @@ namespace hpx::threads::policies {
             std::uint16_t num_recent_tasks_executed_ = 0;
             bool stealhalf_ = false;
 
+            // hierarchical victim selection: cores sharing the same physical
+            // core and cores sharing the same NUMA domain (a set bit means
+            // 'may be asked in this tier')
+            mask_type core_victims_;
+            mask_type numa_victims_;
+
+            // the number of consecutive local steal requests that returned
+            // unsatisfied
+            std::uint16_t num_failed_local_requests_ = 0;
+            bool has_local_victims_ = false;
+
 #if defined(HPX_HAVE_WORKREQUESTING_LAST_VICTIM)
             // core number the last stolen tasks originated from
             std::uint16_t last_victim_ = static_cast<std::uint16_t>(-1);
@@ -292,6 +403,17 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_sent_ = 0;
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
+#endif
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+            // number of steal responses carrying more than one task and the
+            // overall number of tasks sent in those
+            std::atomic<std::int64_t> num_stolen_batches_{0};
+            std::atomic<std::int64_t> num_stolen_batch_tasks_{0};
+
+            // number of times a steal request of this core was sent to a
+            // core located in a remote NUMA domain (hierarchical mode only),
+            // updated by the cores forwarding the request
+            std::atomic<std::int64_t> num_steal_requests_remote_{0};
 #endif
         };
 
@@ -314,6 +436,11 @@ namespace hpx::threads::policies {
           , affinity_data_(init.affinity_data_)
           , num_queues_(init.num_queues_)
           , num_high_priority_queues_(init.num_high_priority_queues_)
+          , numa_hierarchical_(init.numa_hierarchical_)
+          , numa_remote_backoff_(init.numa_remote_backoff_)
+          , steal_half_(init.steal_half_)
+          , max_steal_batch_(
+                (std::max)(init.max_steal_batch_, static_cast<std::size_t>(1)))
         {
             HPX_ASSERT(init.num_queues_ != 0);
             HPX_ASSERT(num_high_priority_queues_ != 0);
@@ -604,6 +731,60 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        std::int64_t get_num_stolen_batches(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_stolen_batches_, reset);
+                }
+                return count;
+            }
+
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_stolen_batches_, reset);
+        }
+
+        std::int64_t get_num_stolen_batch_tasks(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_stolen_batch_tasks_, reset);
+                }
+                return count;
+            }
+
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_stolen_batch_tasks_, reset);
+        }
+
+        std::int64_t get_num_steal_requests_remote(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_steal_requests_remote_, reset);
+                }
+                return count;
+            }
+
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_steal_requests_remote_, reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -665,10 +846,17 @@ namespace hpx::threads::policies {
         void create_thread(thread_init_data& data, thread_id_ref_type* id,
             error_code& ec) override
         {
-            std::size_t num_thread =
-                data.schedulehint.mode == thread_schedule_hint_mode::thread ?
-                data.schedulehint.hint :
-                static_cast<std::size_t>(-1);
+            std::size_t num_thread = static_cast<std::size_t>(-1);
+            if (data.schedulehint.mode == thread_schedule_hint_mode::thread)
+            {
+                num_thread = data.schedulehint.hint;
+            }
+            else if (data.schedulehint.mode ==
+                    thread_schedule_hint_mode::numa &&
+                data.schedulehint.hint >= 0)
+            {
+                num_thread = select_numa_thread(data.schedulehint.hint);
+            }
 
             if (static_cast<std::size_t>(-1) == num_thread)
             {
@@ -785,11 +973,21 @@ namespace hpx::threads::policies {
                 }
                 else
                 {
+                    // The previous round was not successful, remember this
+                    // to allow for asking remote NUMA domains eventually
+                    if (!req.allow_remote_ &&
+                        d.num_failed_local_requests_ <
+                            (std::numeric_limits<std::uint16_t>::max)())
+                    {
+                        ++d.num_failed_local_requests_;
+                    }
+
                     // Continue circulating the steal request if it makes sense
                     req.state_ = steal_request::state::idle;
                     req.victims_ = d.victims_;
                     req.attempt_ =
                         static_cast<std::uint16_t>(count(d.victims_) - 1);
+                    req.allow_remote_ = allow_remote_steal(d);
 
                     std::size_t victim = next_victim(d, req);
                     data_[victim].data_.requests_->set(HPX_MOVE(req));
@@ -850,12 +1048,15 @@ namespace hpx::threads::policies {
 
             // Send tasks from our queue to the requesting core, depending on
             // what's requested, either one task or half of the available tasks
+            // (limited by the maximal batch size)
             std::size_t max_num_to_steal = 1;
             if (req.stealhalf_)
             {
-                max_num_to_steal = d.queue_->get_pending_queue_length(
-                                       std::memory_order_relaxed) /
-                    2;
+                max_num_to_steal = (std::min)(
+                    static_cast<std::size_t>(d.queue_->get_pending_queue_length(
+                                                 std::memory_order_relaxed) /
+                        2),
+                    max_steal_batch_);
             }
 
             if (max_num_to_steal != 0)
@@ -877,6 +1078,16 @@ namespace hpx::threads::policies {
                 // we are ready to send at least one task
                 if (!thrds.tasks_.empty())
                 {
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                    if (thrds.tasks_.size() > 1)
+                    {
+                        d.num_stolen_batches_.fetch_add(
+                            1, std::memory_order_relaxed);
+                        d.num_stolen_batch_tasks_.fetch_add(
+                            static_cast<std::int64_t>(thrds.tasks_.size()),
+                            std::memory_order_relaxed);
+                    }
+#endif
                     // send these tasks to the core that has sent the steal
                     // request
                     req.channel_->set(HPX_MOVE(thrds));
@@ -911,6 +1122,7 @@ namespace hpx::threads::policies {
                 d.high_priority_queue_->increment_num_pending_accesses();
                 if (result)
                 {
+                    this->end_steal_attempt(num_thread);
                     ++d.num_recent_tasks_executed_;
                     return true;
                 }
@@ -939,6 +1151,13 @@ namespace hpx::threads::policies {
 #endif
             }
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            if (result)
+            {
+                this->end_steal_attempt(num_thread);
+            }
+#endif
+
             if (allow_stealing && result)
             {
                 // We found a task to run, however before running it we handle
@@ -966,6 +1185,9 @@ namespace hpx::threads::policies {
 
             if (low_priority_queue_.get_next_thread(thrd))
             {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                this->end_steal_attempt(num_thread);
+#endif
                 ++d.num_recent_tasks_executed_;
                 return true;
             }
@@ -986,6 +1208,11 @@ namespace hpx::threads::policies {
             }
             else
             {
+                if (schedulehint.mode == thread_schedule_hint_mode::numa &&
+                    schedulehint.hint >= 0)
+                {
+                    num_thread = select_numa_thread(schedulehint.hint);
+                }
                 allow_fallback = false;
             }
 
@@ -1055,6 +1282,11 @@ namespace hpx::threads::policies {
             }
             else
             {
+                if (schedulehint.mode == thread_schedule_hint_mode::numa &&
+                    schedulehint.hint >= 0)
+                {
+                    num_thread = select_numa_thread(schedulehint.hint);
+                }
                 allow_fallback = false;
             }
 
@@ -1315,6 +1547,39 @@ namespace hpx::threads::policies {
             return true;
         }
 
+        bool has_higher_priority_work(std::size_t num_thread,
+            thread_priority priority) const noexcept override
+        {
+            if (num_thread >= num_queues_)
+            {
+                return false;
+            }
+
+            auto const& d = data_[num_thread].data_;
+            switch (priority)
+            {
+            case thread_priority::low:
+                if (d.bound_queue_->get_queue_length(
+                        std::memory_order_relaxed) != 0 ||
+                    d.queue_->get_queue_length(std::memory_order_relaxed) != 0)
+                {
+                    return true;
+                }
+                [[fallthrough]];
+
+            case thread_priority::default_:
+                [[fallthrough]];
+            case thread_priority::normal:
+                return num_thread < num_high_priority_queues_ &&
+                    d.high_priority_queue_->get_queue_length(
+                        std::memory_order_relaxed) != 0;
+
+            default:
+                break;
+            }
+            return false;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Enumerate matching threads from all queues
         bool enumerate_threads(hpx::function<bool(thread_id_type)> const& f,
@@ -1495,6 +1760,26 @@ namespace hpx::threads::policies {
             return result;
         }
 
+        // return the next victim taking into account the hardware topology of
+        // the thief: cores sharing the same physical core are asked first,
+        // followed by cores in the same NUMA domain, followed by all remaining
+        // cores (if allowed)
+        std::size_t hierarchical_victim(steal_request const& req) noexcept
+        {
+            auto const& thief = data_[req.num_thread_].data_;
+            return detail::select_hierarchical_victim(num_queues_,
+                req.victims_, thief.core_victims_, thief.numa_victims_,
+                req.allow_remote_, gen_);
+        }
+
+        // decide whether the next steal request sent by the given core may
+        // ask cores located in remote NUMA domains
+        bool allow_remote_steal(scheduler_data const& d) const noexcept
+        {
+            return !numa_hierarchical_ || !d.has_local_victims_ ||
+                d.num_failed_local_requests_ >= numa_remote_backoff_;
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1520,11 +1805,31 @@ namespace hpx::threads::policies {
                 }
                 else
 #endif
+                    if (numa_hierarchical_)
+                {
+                    victim = hierarchical_victim(req);
+                }
+                else
                 {
                     victim = random_victim(req);
                 }
             }
 
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+            // account the request to the thief, not to the forwarding core
+            if (numa_hierarchical_ && victim != static_cast<std::size_t>(-1) &&
+                victim != req.num_thread_)
+            {
+                auto& thief = data_[req.num_thread_].data_;
+                if (!test(thief.core_victims_, victim) &&
+                    !test(thief.numa_victims_, victim))
+                {
+                    thief.num_steal_requests_remote_.fetch_add(
+                        1, std::memory_order_relaxed);
+                }
+            }
+#endif
+
             // couldn't find victim, return steal request to thief
             if (victim == static_cast<std::size_t>(-1))
             {
@@ -1549,7 +1854,11 @@ namespace hpx::threads::policies {
             {
                 // Estimate work-stealing efficiency during the last interval;
                 // switch strategies if the value is below a threshold
-                if (d.num_recent_steals_ >=
+                if (steal_half_)
+                {
+                    d.stealhalf_ = true;
+                }
+                else if (d.num_recent_steals_ >=
                     scheduler_data::num_steal_adaptive_interval_)
                 {
                     double const ratio =
@@ -1576,11 +1885,14 @@ namespace hpx::threads::policies {
                     }
                 }
 
-                steal_request req(
-                    d.num_thread_, d.tasks_, d.victims_, idle, d.stealhalf_);
+                steal_request req(d.num_thread_, d.tasks_, d.victims_, idle,
+                    d.stealhalf_, allow_remote_steal(d));
                 std::size_t victim = next_victim(d, req);
 
                 ++d.requested_;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                this->record_steal_attempt(d.num_thread_);
+#endif
                 data_[victim].data_.requests_->set(HPX_MOVE(req));
 #if defined(HPX_HAVE_WORKREQUESTING_STEAL_STATISTICS)
                 ++d.steal_requests_sent_;
@@ -1605,6 +1917,10 @@ namespace hpx::threads::policies {
                 // if at least one thrd was received
                 if (!thrds.tasks_.empty())
                 {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    this->record_steal(
+                        d.num_thread_, thrds.num_thread_, thrds.tasks_.size());
+#endif
                     // Schedule all but the first received task in reverse order
                     // to maintain the sequence of tasks as pulled from the
                     // victims queue.
@@ -1647,6 +1963,7 @@ namespace hpx::threads::policies {
                     }
 
                     ++d.num_recent_steals_;
+                    d.num_failed_local_requests_ = 0;
                     return true;
                 }
             }
@@ -1775,6 +2092,57 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            if (numa_hierarchical_)
+            {
+                init_hierarchical_victims(d, num_thread);
+            }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->init_steal_telemetry(num_thread, affinity_data_);
+#endif
+
+            // allow for NUMA hints to be resolved to this thread
+            set_numa_domain(num_thread,
+                create_topology().get_numa_node_number(
+                    affinity_data_.get_pu_num(num_thread)));
+        }
+
+        // Determine the cores sharing the same physical core and the cores
+        // sharing the same NUMA domain with the given core.
+        void init_hierarchical_victims(
+            scheduler_data& d, std::size_t num_thread)
+        {
+            auto const& topo = create_topology();
+
+            std::size_t const num_pu = affinity_data_.get_pu_num(num_thread);
+            mask_type const core_mask = topo.get_core_affinity_mask(num_pu);
+            mask_type const numa_mask = topo.get_numa_node_affinity_mask(num_pu);
+
+            resize(d.core_victims_, num_queues_);
+            reset(d.core_victims_);
+            resize(d.numa_victims_, num_queues_);
+            reset(d.numa_victims_);
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                std::size_t const other_pu = affinity_data_.get_pu_num(i);
+                if (any(core_mask & topo.get_core_affinity_mask(other_pu)))
+                {
+                    set(d.core_victims_, i);
+                }
+                else if (any(numa_mask &
+                             topo.get_numa_node_affinity_mask(other_pu)))
+                {
+                    set(d.numa_victims_, i);
+                }
+            }
+
+            d.has_local_victims_ = any(d.core_victims_) || any(d.numa_victims_);
+            d.num_failed_local_requests_ = 0;
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1837,6 +2205,12 @@ namespace hpx::threads::policies {
         detail::affinity_data const& affinity_data_;
         std::size_t const num_queues_;
         std::size_t const num_high_priority_queues_;
+
+        bool const numa_hierarchical_;
+        std::uint16_t const numa_remote_backoff_;
+
+        bool const steal_half_;
+        std::size_t const max_steal_batch_;
     };
 }    // namespace hpx::threads::policies
 
@@ -0,0 +1,287 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::policies {
+
+    template <std::size_t NumQueues>
+    struct multiqueue_priority;
+
+    namespace detail {
+
+        // xorshift64*, every OS thread uses its own sequence
+        inline std::uint64_t multiqueue_random() noexcept
+        {
+            thread_local std::uint64_t state =
+                static_cast<std::uint64_t>(
+                    reinterpret_cast<std::uintptr_t>(&state)) |
+                1;
+
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1DULL;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A relaxed concurrent priority queue (MultiQueue, see Rihani, Sanders,
+    // and Dementiev, "MultiQueues: Simpler, Faster, and Better Relaxed
+    // Concurrent Priority Queues", 2014). The items are ordered by the
+    // priority value of the referenced thread (see
+    // thread_init_data::priority_value) or by the value itself for integral
+    // types, smaller values are handed out first.
+    //
+    // The queue consists of NumQueues binary heaps, each protected by its own
+    // lock. An item is pushed onto a randomly chosen heap. Popping an item
+    // compares the top items of two randomly chosen heaps and takes the more
+    // urgent one. The items are therefore not handed out in strict priority
+    // order, but contention is low as concurrent operations are spread over
+    // all heaps. Items with the same priority value on the same heap (in
+    // particular all items without a priority value) are handed out in FIFO
+    // order. Stealing takes the most urgent item as well.
+    template <typename T, std::size_t NumQueues>
+    struct multiqueue_priority_backend
+    {
+        static_assert(NumQueues != 0, "a MultiQueue needs at least one heap");
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+    private:
+        struct heap_item
+        {
+            std::int64_t priority_;
+            std::uint64_t sequence_;
+            T value_;
+        };
+
+        // std::push_heap/pop_heap maintain a max-heap, invert the ordering
+        struct less_urgent
+        {
+            bool operator()(
+                heap_item const& lhs, heap_item const& rhs) const noexcept
+            {
+                if (lhs.priority_ != rhs.priority_)
+                    return rhs.priority_ < lhs.priority_;
+                return rhs.sequence_ < lhs.sequence_;
+            }
+        };
+
+        struct heap
+        {
+            hpx::util::spinlock mtx_;
+            std::vector<heap_item> items_;
+            std::uint64_t sequence_ = 0;
+
+            // the priority value of the top item (valid only if the heap is
+            // not empty) and the number of items, both can be read without
+            // holding the lock
+            std::atomic<std::int64_t> top_{0};
+            std::atomic<std::size_t> size_{0};
+        };
+
+        static std::int64_t get_priority_value(const_reference val) noexcept
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                // plain values are their own priority
+                return static_cast<std::int64_t>(val);
+            }
+            else if constexpr (std::is_same_v<T, thread_id_ref_type>)
+            {
+                return get_thread_id_data(val)->get_priority_value();
+            }
+            else if constexpr (std::is_convertible_v<T,
+                                   thread_id_ref_type::thread_repr*>)
+            {
+                return static_cast<thread_data const*>(val)
+                    ->get_priority_value();
+            }
+            else
+            {
+                // thread_queue wraps the thread id if queue wait times are
+                // being measured
+                return get_thread_id_data(val->data)->get_priority_value();
+            }
+        }
+
+        heap& random_heap() noexcept
+        {
+            return queues_[detail::multiqueue_random() % NumQueues].data_;
+        }
+
+        template <typename U>
+        static void push_locked(heap& h, std::int64_t priority, U&& val)
+        {
+            h.items_.push_back(
+                heap_item{priority, h.sequence_++, HPX_FORWARD(U, val)});
+            std::push_heap(h.items_.begin(), h.items_.end(), less_urgent{});
+
+            h.top_.store(
+                h.items_.front().priority_, std::memory_order_relaxed);
+            h.size_.store(h.items_.size(), std::memory_order_release);
+        }
+
+        static bool pop_locked(heap& h, reference val) noexcept
+        {
+            if (h.items_.empty())
+                return false;
+
+            std::pop_heap(h.items_.begin(), h.items_.end(), less_urgent{});
+            val = HPX_MOVE(h.items_.back().value_);
+            h.items_.pop_back();
+
+            if (!h.items_.empty())
+            {
+                h.top_.store(
+                    h.items_.front().priority_, std::memory_order_relaxed);
+            }
+            h.size_.store(h.items_.size(), std::memory_order_release);
+            return true;
+        }
+
+        template <typename U>
+        bool push_impl(U&& val)
+        {
+            std::int64_t const priority = get_priority_value(val);
+
+            // avoid waiting for a heap which is in use by another thread
+            for (std::size_t i = 0; i != NumQueues; ++i)
+            {
+                heap& h = random_heap();
+                std::unique_lock<hpx::util::spinlock> l(
+                    h.mtx_, std::try_to_lock);
+                if (l.owns_lock())
+                {
+                    push_locked(h, priority, HPX_FORWARD(U, val));
+                    return true;
+                }
+            }
+
+            heap& h = random_heap();
+            std::lock_guard<hpx::util::spinlock> l(h.mtx_);
+            push_locked(h, priority, HPX_FORWARD(U, val));
+            return true;
+        }
+
+    public:
+        explicit multiqueue_priority_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : queues_(
+                std::make_unique<util::cache_aligned_data<heap>[]>(NumQueues))
+        {
+            for (std::size_t i = 0; i != NumQueues; ++i)
+            {
+                queues_[i].data_.items_.reserve(
+                    static_cast<std::size_t>(initial_size / NumQueues));
+            }
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            return push_impl(val);
+        }
+
+        bool push(rvalue_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            return push_impl(HPX_MOVE(val));
+        }
+
+        bool pop(reference val, bool /* steal */ = true) noexcept
+        {
+            // take the more urgent of the top items of two random heaps
+            for (std::size_t i = 0; i != NumQueues; ++i)
+            {
+                heap* first = &random_heap();
+                heap* second = &random_heap();
+
+                bool const first_empty =
+                    first->size_.load(std::memory_order_acquire) == 0;
+                bool const second_empty =
+                    second->size_.load(std::memory_order_acquire) == 0;
+                if (first_empty && second_empty)
+                    break;
+
+                if (first_empty ||
+                    (!second_empty &&
+                        second->top_.load(std::memory_order_relaxed) <
+                            first->top_.load(std::memory_order_relaxed)))
+                {
+                    first = second;
+                }
+
+                std::unique_lock<hpx::util::spinlock> l(
+                    first->mtx_, std::try_to_lock);
+                if (l.owns_lock() && pop_locked(*first, val))
+                    return true;
+            }
+
+            // make sure no item is missed if the random choices failed
+            std::size_t const start =
+                detail::multiqueue_random() % NumQueues;
+            for (std::size_t i = 0; i != NumQueues; ++i)
+            {
+                heap& h = queues_[(start + i) % NumQueues].data_;
+                if (h.size_.load(std::memory_order_acquire) == 0)
+                    continue;
+
+                std::lock_guard<hpx::util::spinlock> l(h.mtx_);
+                if (pop_locked(h, val))
+                    return true;
+            }
+            return false;
+        }
+
+        bool empty() noexcept
+        {
+            for (std::size_t i = 0; i != NumQueues; ++i)
+            {
+                if (queues_[i].data_.size_.load(std::memory_order_acquire) !=
+                    0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::unique_ptr<util::cache_aligned_data<heap>[]> queues_;
+    };
+
+    // NumQueues is the number of heaps making up a single MultiQueue, it
+    // should be a small multiple of the number of cores sharing the queue
+    template <std::size_t NumQueues = 4>
+    struct multiqueue_priority
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = multiqueue_priority_backend<T, NumQueues>;
+        };
+    };
+}    // namespace hpx::threads::policies
@@ -599,6 +599,37 @@ namespace hpx::threads::policies {
             HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
         }
 
+        // add a batch of threads to the map while holding the lock only once
+        void add_to_thread_map(
+            threads::thread_id_ref_type const* tids, std::size_t count)
+        {
+            scoped_lock lk(thread_map_mtx_.data_);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                std::pair<thread_map_type::iterator, bool> const p =
+                    thread_map_.insert(tids[i].noref());
+
+                if (HPX_UNLIKELY(!p.second))
+                {
+                    std::string const map_size =
+                        std::to_string(thread_map_.size());
+                    thread_map_count_.data_ += static_cast<std::int32_t>(i);
+
+                    lk.unlock();
+                    HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                        "queue_holder_thread::add_to_thread_map",
+                        "Couldn't add new thread to the thread map {}",
+                        map_size);
+                }
+            }
+
+            thread_map_count_.data_ += static_cast<std::int32_t>(count);
+
+            tq_deb.debug(debug::str<>("map add"), queue_data_print(this),
+                debug::dec<4>(count));
+        }
+
         // ----------------------------------------------------------------
         void remove_from_thread_map(threads::thread_id_type tid, bool dealloc)
         {
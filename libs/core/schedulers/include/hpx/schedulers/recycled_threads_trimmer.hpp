@@ -0,0 +1,97 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace hpx::threads::policies {
+
+    // Number of recycled thread objects (and the bytes held by them and
+    // their stacks) released by all thread queues of this process (see
+    // thread_queue_init_parameters::trim_interval_).
+    HPX_CORE_EXPORT void record_trimmed_threads(
+        std::int64_t count, std::int64_t bytes) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_trimmed_threads_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_trimmed_threads_bytes(bool reset) noexcept;
+
+    namespace detail {
+
+        // Keeps track of the working set of a thread queue (the moving
+        // average of the peak number of threads it held during the last
+        // trim intervals) and of the number of recycled thread objects
+        // exceeding it. The queue's mutex has to be held while calling any
+        // of the member functions.
+        class recycled_threads_trimmer
+        {
+        public:
+            explicit recycled_threads_trimmer(
+                std::int64_t interval_ms) noexcept
+              : interval_(static_cast<std::uint64_t>(
+                    (std::max)(interval_ms, std::int64_t(0))) *
+                    1000000)
+            {
+            }
+
+            [[nodiscard]] constexpr bool enabled() const noexcept
+            {
+                return interval_ != 0;
+            }
+
+            // record the current number of threads held by the queue
+            void sample(std::int64_t count) noexcept
+            {
+                if (count > peak_)
+                    peak_ = count;
+            }
+
+            // Returns the number of recycled thread objects to release now,
+            // at most max_count at a time. The working set is re-evaluated
+            // once per trim interval, recycled thread objects beyond it (and
+            // beyond keep_min) are released gradually.
+            std::int64_t update(std::int64_t count, std::int64_t recycled,
+                std::int64_t keep_min, std::int64_t max_count) noexcept
+            {
+                sample(count);
+
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                if (now - last_ >= interval_)
+                {
+                    // exponentially weighted moving average of the peaks,
+                    // stored in units of 1/8 thread
+                    if (last_ == 0)
+                        average_ = 8 * peak_;
+                    else
+                        average_ += peak_ - average_ / 8;
+
+                    last_ = now;
+                    peak_ = count;
+
+                    std::int64_t const keep =
+                        (std::max)(keep_min, (average_ + 7) / 8);
+                    excess_ = recycled > keep ? recycled - keep : 0;
+                }
+
+                std::int64_t const release =
+                    (std::min)((std::min)(excess_, recycled), max_count);
+                excess_ -= release;
+                return release;
+            }
+
+        private:
+            std::uint64_t interval_;
+            std::uint64_t last_ = 0;
+            std::int64_t peak_ = 0;
+            std::int64_t average_ = 0;
+            std::int64_t excess_ = 0;
+        };
+    }    // namespace detail
+}    // namespace hpx::threads::policies
@@ -16,6 +16,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/recycled_threads_trimmer.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
@@ -126,41 +127,59 @@ namespace hpx::threads::policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        // Return the heap of recycled thread objects for the given stack size
+        thread_heap_type* get_thread_heap(
+            [[maybe_unused]] std::ptrdiff_t stacksize) noexcept
         {
-            HPX_ASSERT_OWNS_LOCK(lk);
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
+            // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_heap_small_;
             }
-            else if (stacksize == parameters_.medium_stacksize_)
+            if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_heap_medium_;
             }
-            else if (stacksize == parameters_.large_stacksize_)
+            if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_heap_large_;
             }
-            else if (stacksize == parameters_.huge_stacksize_)
+            if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_heap_huge_;
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_heap_nostack_;
             }
-            HPX_ASSERT(heap);
+            HPX_ASSERT(false);
 #endif
+            return nullptr;
+        }
+
+        // Take ownership of an unused thread object with the given stack
+        // size, if available (the queue's mutex must be held).
+        bool take_thread_object(
+            threads::thread_id_ref_type& thrd, std::ptrdiff_t stacksize)
+        {
+            thread_heap_type* heap = get_thread_heap(stacksize);
+            if (heap == nullptr || heap->empty())
+            {
+                return false;
+            }
 
+            thrd = heap->back();
+            heap->pop_back();
+            return true;
+        }
+
+        // Bind the given thread object to the thread described by data, or
+        // allocate a new thread object if none was given (the queue's mutex
+        // does not have to be held).
+        void init_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
                 data.initial_state == thread_schedule_state::pending_boost)
@@ -168,42 +187,66 @@ namespace hpx::threads::policies {
                 data.initial_state = thread_schedule_state::pending;
             }
 
-            // ASAN gets confused by reusing threads/stacks
-#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            // Check for an unused thread object.
-            if (heap && !heap->empty())    //-V522
+            if (thrd)
             {
-                // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
+                // rebind the recycled thread object
                 get_thread_id_data(thrd)->rebind(data);
+                return;
+            }
+
+            // Allocate a new thread object.
+            threads::thread_data* p;
+            if (stacksize == parameters_.nostack_stacksize_)
+            {
+                p = threads::thread_data_stackless::create(
+                    data, this, stacksize);
             }
             else
-#endif
             {
-                hpx::unlock_guard<Lock> ull(lk);
+                p = threads::thread_data_stackful::create(
+                    data, this, stacksize);
+            }
+            thrd = thread_id_ref_type(p, thread_id_addref::no);
+        }
 
-                // Allocate a new thread object.
-                threads::thread_data* p;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_ref_type(p, thread_id_addref::no);
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT_OWNS_LOCK(lk);
+
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            // Check for an unused thread object, allocating a new one is done
+            // without holding the lock.
+            if (take_thread_object(thrd, stacksize))
+            {
+                init_thread_object(thrd, data, stacksize);
+            }
+            else
+            {
+                hpx::unlock_guard<Lock> ull(lk);
+                init_thread_object(thrd, data, stacksize);
             }
         }
 
         static util::internal_allocator<task_description>
             task_description_alloc_;
 
+        // Number of staged tasks converted into threads at once
+        static constexpr std::size_t add_new_batch_size =
+            HPX_THREAD_QUEUE_ADD_NEW_BATCH_SIZE;
+
         ///////////////////////////////////////////////////////////////////////
         // add new threads if there is some amount of work available
+        //
+        // The staged tasks are converted in batches. The lock is held only
+        // while taking a batch of tasks (and recycled thread objects) off the
+        // queues and while adding the new threads to the thread map. The
+        // thread objects are initialized without holding the lock. The new
+        // threads are made visible to the work-item counters with a single
+        // atomic update per batch.
         std::size_t add_new(std::int64_t add_count, thread_queue* addfrom,
             std::unique_lock<mutex_type>& lk, bool steal = false)
         {
@@ -214,67 +257,119 @@ namespace hpx::threads::policies {
                 return 0;
             }
 
+            task_description* tasks[add_new_batch_size];
+            threads::thread_id_ref_type thrds[add_new_batch_size];
+            std::ptrdiff_t stacksizes[add_new_batch_size];
+
             std::size_t added = 0;
-            task_description* task = nullptr;
-            while (add_count-- && addfrom->new_tasks_.pop(task, steal))
+            while (add_count != 0)
             {
+                // take a batch of staged tasks off the queue
+                std::size_t count = 0;
+                while (count != add_new_batch_size && add_count != 0 &&
+                    addfrom->new_tasks_.pop(tasks[count], steal))
+                {
+                    --add_count;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-                if (get_maintain_queue_wait_times_enabled())
+                    if (get_maintain_queue_wait_times_enabled())
+                    {
+                        addfrom->new_tasks_wait_ +=
+                            hpx::chrono::high_resolution_clock::now() -
+                            tasks[count]->waittime;
+                        ++addfrom->new_tasks_wait_count_;
+                    }
+#endif
+                    threads::thread_init_data const& data = tasks[count]->data;
+                    stacksizes[count] =
+                        data.scheduler_base->get_stack_size(data.stacksize);
+                    take_thread_object(thrds[count], stacksizes[count]);
+                    ++count;
+                }
+
+                if (count == 0)
                 {
-                    addfrom->new_tasks_wait_ +=
-                        hpx::chrono::high_resolution_clock::now() -
-                        task->waittime;
-                    ++addfrom->new_tasks_wait_count_;
+                    break;
                 }
-#endif
-                // create the new thread
-                threads::thread_init_data& data = task->data;
 
-                [[maybe_unused]] bool const schedule_now =
-                    data.initial_state == thread_schedule_state::pending;
+                // create the new threads
+                {
+                    hpx::unlock_guard<std::unique_lock<mutex_type>> ull(lk);
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        init_thread_object(
+                            thrds[i], tasks[i]->data, stacksizes[i]);
 
-                threads::thread_id_ref_type thrd;
-                create_thread_object(thrd, data, lk);
+                        // insert the thread into the work-items queue assuming
+                        // it is in pending state, thread would go out of
+                        // scope otherwise
+                        HPX_ASSERT(tasks[i]->data.initial_state ==
+                            thread_schedule_state::pending);
 
-                std::destroy_at(task);
-                task_description_alloc_.deallocate(task, 1);
+                        std::destroy_at(tasks[i]);
+                        task_description_alloc_.deallocate(tasks[i], 1);
+                    }
+                }
 
-                // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
+                // add the new entries to the map of all threads
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    std::pair<thread_map_type::iterator, bool> const p =
+                        thread_map_.emplace(thrds[i].noref());
 
-                // 26110: Caller failing to hold lock 'lk'
+                    // 26110: Caller failing to hold lock 'lk'
 #if defined(HPX_MSVC)
 #pragma warning(push)
 #pragma warning(disable : 26110)
 #endif
 
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
-                        "thread_queue::add_new",
-                        "Couldn't add new thread to the thread map");
-                }
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        // remove the entries added so far and release all
+                        // thread objects of this batch, none of them has
+                        // been made visible to the schedulers yet
+                        for (std::size_t j = 0; j != i; ++j)
+                        {
+                            thread_map_.erase(thrds[j].noref());
+                        }
+                        for (std::size_t j = 0; j != count; ++j)
+                        {
+                            threads::thread_data* thrd =
+                                get_thread_id_data(thrds[j]);
+                            thrds[j].detach();
+                            deallocate(thrd);
+                        }
+
+                        // all tasks of this batch were taken off the queue
+                        addfrom->new_tasks_count_.data_ -=
+                            static_cast<std::int64_t>(count);
+                        lk.unlock();
+                        HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                            "thread_queue::add_new",
+                            "Couldn't add new thread to the thread map");
+                    }
 
 #if defined(HPX_MSVC)
 #pragma warning(pop)
 #endif
+                }
 
-                ++thread_map_count_;
+                thread_map_count_ += static_cast<std::int64_t>(count);
+                trimmer_.sample(
+                    thread_map_count_.load(std::memory_order_relaxed));
 
                 // Decrement only after thread_map_count_ has been incremented
-                --addfrom->new_tasks_count_.data_;
+                addfrom->new_tasks_count_.data_ -=
+                    static_cast<std::int64_t>(count);
 
-                // insert the thread into the work-items queue assuming it is
-                // in pending state, thread would go out of scope otherwise
-                HPX_ASSERT(schedule_now);
-
-                // pushing the new thread into the pending queue of the
+                // pushing the new threads into the pending queue of the
                 // specified thread_queue
-                ++added;
-                schedule_thread(HPX_MOVE(thrd));
+                schedule_threads(thrds, count);
+                added += count;
+
+                if (count != add_new_batch_size)
+                {
+                    break;
+                }
             }
 
             if (added)
@@ -446,9 +541,74 @@ namespace hpx::threads::policies {
                     --delete_count;
                 }
             }
+
+            trim_recycled_threads_locked();
+
             return terminated_items_count_.load(std::memory_order_acquire) == 0;
         }
 
+    private:
+        // Release the recycled thread objects (and their stacks) exceeding the
+        // recent working set of this queue, the coldest ones first (see
+        // thread_queue_init_parameters::trim_interval_).
+        void trim_recycled_threads_locked() noexcept
+        {
+            if (!trimmer_.enabled())
+                return;
+
+            thread_heap_type* const heaps[] = {&thread_heap_huge_,
+                &thread_heap_large_, &thread_heap_medium_, &thread_heap_small_,
+                &thread_heap_nostack_};
+
+            std::size_t recycled = 0;
+            for (thread_heap_type const* heap : heaps)
+            {
+                recycled += heap->size();
+            }
+
+            std::int64_t release = trimmer_.update(
+                thread_map_count_.load(std::memory_order_relaxed),
+                static_cast<std::int64_t>(recycled),
+                parameters_.init_threads_count_,
+                (std::max)(parameters_.min_delete_count_, std::int64_t(1)));
+            if (release == 0)
+                return;
+
+            // release the thread objects with the largest stacks first
+            std::int64_t count = 0;
+            std::int64_t bytes = 0;
+            for (thread_heap_type* heap : heaps)
+            {
+                auto const n = (std::min)(
+                    static_cast<std::size_t>(release), heap->size());
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    threads::thread_data* p = get_thread_id_data((*heap)[i]);
+
+                    std::ptrdiff_t const stacksize = p->get_stack_size();
+                    bytes += stacksize == parameters_.nostack_stacksize_ ?
+                        static_cast<std::int64_t>(
+                            sizeof(threads::thread_data_stackless)) :
+                        static_cast<std::int64_t>(
+                            sizeof(threads::thread_data_stackful)) +
+                            stacksize;
+
+                    deallocate(p);
+                }
+
+                heap->erase(heap->begin(),
+                    heap->begin() + static_cast<std::ptrdiff_t>(n));
+
+                count += static_cast<std::int64_t>(n);
+                release -= static_cast<std::int64_t>(n);
+                if (release == 0)
+                    break;
+            }
+
+            record_trimmed_threads(count, bytes);
+        }
+
     public:
         bool cleanup_terminated(bool delete_all = false)    //-V1071
         {
@@ -495,6 +655,7 @@ namespace hpx::threads::policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
+          , trimmer_(parameters.trim_interval_)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -724,6 +885,8 @@ namespace hpx::threads::policies {
                     return;
                 }
                 ++thread_map_count_;
+                trimmer_.sample(
+                    thread_map_count_.load(std::memory_order_relaxed));
 
                 // this thread has to be in the map now
                 HPX_ASSERT(thread_map_.find(thrd.noref()) != thread_map_.end());
@@ -890,6 +1053,26 @@ namespace hpx::threads::policies {
             return false;
         }
 
+        // Schedule the passed threads, the work-item counter is updated only
+        // once
+        void schedule_threads(
+            threads::thread_id_ref_type* thrds, std::size_t count)
+        {
+            work_items_count_.data_ += static_cast<std::int64_t>(count);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                work_items_.push(new thread_description{HPX_MOVE(thrds[i]),
+                    hpx::chrono::high_resolution_clock::now()});
+#else
+                // detach the thread from the id_ref without decrementing
+                // the reference count
+                work_items_.push(thrds[i].detach());
+#endif
+            }
+        }
+
         // Schedule the passed thread
         void schedule_thread(
             threads::thread_id_ref_type thrd, bool other_end = false)
@@ -1225,6 +1408,9 @@ namespace hpx::threads::policies {
         thread_heap_type thread_heap_huge_;
         thread_heap_type thread_heap_nostack_;
 
+        // decides how many recycled thread objects to release
+        detail::recycled_threads_trimmer trimmer_;
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
         std::uint64_t cleanup_terminated_time_;
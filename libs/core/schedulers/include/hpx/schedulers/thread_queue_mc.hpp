@@ -105,32 +105,61 @@ namespace hpx::threads::policies {
                 return 0;
             }
 
+            // The staged tasks are converted in batches, which allows adding
+            // all new threads of a batch to the thread map while holding the
+            // map's lock only once.
+            constexpr std::size_t batch_size =
+                HPX_THREAD_QUEUE_ADD_NEW_BATCH_SIZE;
+            threads::thread_id_ref_type tids[batch_size];
+
             std::size_t added = 0;
-            task_description task;
-            while (add_count-- && addfrom->new_task_items_.pop(task, stealing))
+            while (add_count != 0)
             {
-                // create the new thread
-                threads::thread_init_data& data = task;
-                threads::thread_id_ref_type tid;
+                std::size_t count = 0;
+                task_description task;
+                while (count != batch_size && add_count != 0 &&
+                    addfrom->new_task_items_.pop(task, stealing))
+                {
+                    --add_count;
 
-                holder_->create_thread_object(tid, data);
-                holder_->add_to_thread_map(tid.noref());
+                    // create the new thread
+                    threads::thread_init_data& data = task;
+                    holder_->create_thread_object(tids[count], data);
 
-                // Decrement only after thread_map_count_ has been incremented
-                --addfrom->new_tasks_count_.data_;
+                    // insert the thread into work-items queue assuming it is
+                    // in pending state
+                    HPX_ASSERT(
+                        data.initial_state == thread_schedule_state::pending);
+                    ++count;
+                }
+
+                if (count == 0)
+                {
+                    break;
+                }
 
-                tqmc_deb.debug(debug::str<>("add_new"), "stealing", stealing,
-                    debug::threadinfo<threads::thread_id_ref_type*>(&tid));
+                holder_->add_to_thread_map(tids, count);
 
-                // insert the thread into work-items queue assuming it is in
-                // pending state
-                HPX_ASSERT(
-                    data.initial_state == thread_schedule_state::pending);
+                // Decrement only after thread_map_count_ has been incremented
+                addfrom->new_tasks_count_.data_ -=
+                    static_cast<std::int32_t>(count);
 
-                // pushing the new thread into the pending queue of the
+                // pushing the new threads into the pending queue of the
                 // specified thread_queue
-                ++added;
-                schedule_work(HPX_MOVE(tid), stealing);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    tqmc_deb.debug(debug::str<>("add_new"), "stealing",
+                        stealing,
+                        debug::threadinfo<threads::thread_id_ref_type*>(
+                            &tids[i]));
+                    schedule_work(HPX_MOVE(tids[i]), stealing);
+                }
+                added += count;
+
+                if (count != batch_size)
+                {
+                    break;
+                }
             }
 
             return added;
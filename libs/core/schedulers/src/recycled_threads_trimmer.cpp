@@ -0,0 +1,37 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/schedulers/recycled_threads_trimmer.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::threads::policies {
+
+    namespace {
+
+        std::atomic<std::int64_t> trimmed_threads_count(0);
+        std::atomic<std::int64_t> trimmed_threads_bytes(0);
+    }    // namespace
+
+    void record_trimmed_threads(std::int64_t count, std::int64_t bytes) noexcept
+    {
+        trimmed_threads_count.fetch_add(count, std::memory_order_relaxed);
+        trimmed_threads_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    std::int64_t get_trimmed_threads_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(trimmed_threads_count, reset);
+    }
+
+    std::int64_t get_trimmed_threads_bytes(bool reset) noexcept
+    {
+        return util::get_and_reset_value(trimmed_threads_bytes, reset);
+    }
+}    // namespace hpx::threads::policies
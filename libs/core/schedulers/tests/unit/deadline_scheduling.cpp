@@ -0,0 +1,110 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the local-priority-edf scheduler runs the pending threads in the
+// order of their deadlines and that missed deadlines are being counted.
+
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+constexpr std::size_t num_tasks = 8;
+
+std::mutex mtx;
+std::vector<std::size_t> order;
+
+void record(std::size_t i, hpx::latch& l)
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        order.push_back(i);
+    }
+    l.count_down(1);
+}
+
+void test_deadline_order()
+{
+    order.clear();
+
+    hpx::latch l(num_tasks + 1);
+
+    // schedule the threads in the reverse order of their deadlines
+    auto const now = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        thread_init_data data(make_thread_function_nullary(hpx::bind(
+                                  &record, num_tasks - i - 1, std::ref(l))),
+            "deadline_scheduling");
+        data.deadline = now + std::chrono::hours(num_tasks - i);
+        register_work(data);
+    }
+
+    // wait for all threads to finish, this suspends the current thread
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), num_tasks);
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+}
+
+void test_missed_deadlines()
+{
+    auto& pool = hpx::resource::get_thread_pool("default");
+    std::int64_t const missed =
+        pool.get_missed_deadline_count(static_cast<std::size_t>(-1), false);
+
+    hpx::latch l(num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        thread_init_data data(
+            make_thread_function_nullary(hpx::bind(&record, i, std::ref(l))),
+            "deadline_scheduling");
+        data.deadline = std::chrono::steady_clock::now();
+        register_work(data);
+    }
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(
+        pool.get_missed_deadline_count(static_cast<std::size_t>(-1), false),
+        missed + static_cast<std::int64_t>(num_tasks));
+}
+
+int hpx_main()
+{
+    test_deadline_order();
+    test_missed_deadlines();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the order of execution is deterministic only if there is exactly one
+    // worker thread
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=local-priority-edf", "hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
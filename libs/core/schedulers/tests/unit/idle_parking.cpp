@@ -0,0 +1,61 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that parked worker threads are reliably woken up when new work
+// arrives.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+int hpx_main()
+{
+    count = 0;
+    for (int burst = 0; burst != 10; ++burst)
+    {
+        // give all other worker threads the chance to park themselves
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(100);
+        for (int i = 0; i != 100; ++i)
+        {
+            futures.push_back(hpx::async([]() { ++count; }));
+        }
+        hpx::wait_all(futures);
+    }
+
+    HPX_TEST_EQ(count.load(), static_cast<std::size_t>(1000));
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[], std::string const& scheduler)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=" + scheduler, "hpx.idle_parking=1",
+        "hpx.max_idle_loop_count=100"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(argc, argv, "local-priority-fifo");
+    test_scheduler(argc, argv, "static");
+    test_scheduler(argc, argv, "local-workrequesting-fifo");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the MultiQueue priority queue backend and the
+// shared-priority-multiqueue scheduler which is using it.
+
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+template <std::size_t NumQueues>
+using backend_type = typename hpx::threads::policies::multiqueue_priority<
+    NumQueues>::template apply<std::int64_t>::type;
+
+constexpr std::int64_t num_items = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_strict_order()
+{
+    // a MultiQueue made up of a single heap is a plain priority queue
+    backend_type<1> q;
+    HPX_TEST(q.empty());
+
+    std::vector<std::int64_t> values(num_items);
+    std::iota(values.begin(), values.end(), std::int64_t(0));
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+
+    for (std::int64_t v : values)
+    {
+        q.push(v);
+    }
+    HPX_TEST(!q.empty());
+
+    std::int64_t v = 0;
+    for (std::int64_t i = 0; i != num_items; ++i)
+    {
+        HPX_TEST(q.pop(v));
+        HPX_TEST_EQ(v, i);
+    }
+    HPX_TEST(!q.pop(v));
+    HPX_TEST(q.empty());
+}
+
+void test_relaxed_order()
+{
+    backend_type<4> q;
+
+    std::vector<std::int64_t> values(num_items);
+    std::iota(values.begin(), values.end(), std::int64_t(0));
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+
+    for (std::int64_t v : values)
+    {
+        q.push(v);
+    }
+
+    // every item is handed out exactly once and the order is close to the
+    // strict one
+    std::vector<std::int64_t> popped;
+    std::int64_t v = 0;
+    while (q.pop(v))
+    {
+        popped.push_back(v);
+    }
+    HPX_TEST(q.empty());
+    HPX_TEST_EQ(static_cast<std::int64_t>(popped.size()), num_items);
+
+    std::int64_t rank_error = 0;
+    for (std::size_t i = 0; i != popped.size(); ++i)
+    {
+        rank_error += std::abs(popped[i] - static_cast<std::int64_t>(i));
+    }
+    HPX_TEST_LT(rank_error / num_items, std::int64_t(100));
+
+    std::sort(popped.begin(), popped.end());
+    std::sort(values.begin(), values.end());
+    HPX_TEST(popped == values);
+}
+
+void test_concurrent_access()
+{
+    constexpr std::size_t num_threads = 4;
+
+    backend_type<8> q;
+    std::atomic<std::int64_t> num_popped(0);
+    std::atomic<std::int64_t> sum_popped(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (auto i = static_cast<std::int64_t>(t); i < num_items;
+                 i += static_cast<std::int64_t>(num_threads))
+            {
+                q.push(i);
+
+                std::int64_t v = 0;
+                if (q.pop(v))
+                {
+                    ++num_popped;
+                    sum_popped += v;
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    std::int64_t v = 0;
+    while (q.pop(v))
+    {
+        ++num_popped;
+        sum_popped += v;
+    }
+
+    HPX_TEST_EQ(num_popped.load(), num_items);
+    HPX_TEST_EQ(sum_popped.load(), num_items * (num_items - 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_tasks = 100;
+
+std::mutex mtx;
+std::vector<std::int64_t> order;
+
+void record(std::int64_t i, hpx::latch& l)
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        order.push_back(i);
+    }
+    l.count_down(1);
+}
+
+void test_scheduler()
+{
+    hpx::latch l(num_tasks + 1);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        std::int64_t const priority =
+            static_cast<std::int64_t>(num_tasks - i - 1);
+        thread_init_data data(make_thread_function_nullary(
+                                  hpx::bind(&record, priority, std::ref(l))),
+            "multiqueue_priority");
+        data.priority_value = priority;
+        register_work(data);
+    }
+
+    // wait for all threads to finish, this suspends the current thread
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), num_tasks);
+    std::sort(order.begin(), order.end());
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], static_cast<std::int64_t>(i));
+    }
+}
+
+int hpx_main()
+{
+    test_strict_order();
+    test_relaxed_order();
+    test_concurrent_access();
+    test_scheduler();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=shared-priority-multiqueue"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,92 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that threads created with a hint referring to the NUMA domain of a
+// piece of memory are run on a worker thread belonging to that domain.
+
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+constexpr std::size_t num_tasks = 100;
+
+std::atomic<std::size_t> misplaced(0);
+
+void check_placement(double const* data, hpx::latch& l)
+{
+    auto const& topo = hpx::threads::create_topology();
+
+    hpx::threads::mask_type const data_mask =
+        topo.get_thread_affinity_mask_from_lva(data);
+    hpx::threads::mask_type const cpu_mask = topo.get_cpubind_mask();
+
+    if (!hpx::threads::any(data_mask & cpu_mask))
+    {
+        ++misplaced;
+    }
+    l.count_down(1);
+}
+
+int hpx_main()
+{
+    // first touch the data from this thread
+    std::vector<double> data(1024 * 1024, 1.0);
+
+    hpx::threads::thread_schedule_hint const hint =
+        hpx::threads::get_numa_domain_hint(data.data());
+
+    // the NUMA domain of the data might not be available on all systems
+    if (hint.mode == hpx::threads::thread_schedule_hint_mode::numa)
+    {
+        misplaced = 0;
+
+        hpx::latch l(num_tasks + 1);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            thread_init_data init(
+                make_thread_function_nullary(hpx::bind(
+                    &check_placement, data.data(), std::ref(l))),
+                "numa_domain_hint", hpx::threads::thread_priority::normal,
+                hint);
+            register_work(init);
+        }
+        l.arrive_and_wait();
+
+        HPX_TEST_EQ(misplaced.load(), static_cast<std::size_t>(0));
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[], std::string const& scheduler)
+{
+    // prevent threads from being stolen across NUMA domains
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=" + scheduler, "hpx.numa_sensitive=2"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(argc, argv, "local-priority-fifo");
+    test_scheduler(argc, argv, "local-workrequesting-fifo");
+
+    return hpx::util::report_errors();
+}
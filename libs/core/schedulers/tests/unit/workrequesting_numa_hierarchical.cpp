@@ -0,0 +1,161 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the work-requesting schedulers make progress if victims are
+// selected hierarchically based on the NUMA topology, and that victims in the
+// thief's core and NUMA domain are asked before any other cores.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void spawn_tree(std::size_t depth)
+{
+    ++count;
+    if (depth == 0)
+    {
+        return;
+    }
+
+    std::vector<hpx::future<void>> children;
+    children.reserve(4);
+    for (int i = 0; i != 4; ++i)
+    {
+        children.push_back(hpx::async(&spawn_tree, depth - 1));
+    }
+    hpx::wait_all(children);
+}
+
+// returns whether all worker threads of the default pool run in the same
+// NUMA domain
+bool single_numa_domain()
+{
+    auto const& rp = hpx::resource::get_partitioner();
+
+    std::set<std::size_t> domains;
+    std::size_t const num_threads = hpx::resource::get_num_threads(0);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        domains.insert(rp.get_topology().get_numa_node_number(
+            rp.get_pu_num(i)));
+    }
+    return domains.size() == 1;
+}
+
+int hpx_main()
+{
+    count = 0;
+    hpx::async(&spawn_tree, 6).get();
+
+    // 1 + 4 + 16 + ... + 4^6
+    HPX_TEST_EQ(count.load(), static_cast<std::size_t>(5461));
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    // no steal request may leave the NUMA domain if there is only one
+    if (single_numa_domain())
+    {
+        HPX_TEST_EQ(hpx::resource::get_thread_pool(0)
+                        .get_num_steal_requests_remote(std::size_t(-1), false),
+            static_cast<std::int64_t>(0));
+    }
+#endif
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_victim_selection()
+{
+    using hpx::threads::policies::detail::select_hierarchical_victim;
+
+    constexpr std::size_t num_queues = 8;
+    constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    // the thief is core 0, core 1 shares its physical core, cores 2 and 3
+    // share its NUMA domain
+    hpx::threads::mask_type core_victims = hpx::threads::mask_type();
+    hpx::threads::mask_type numa_victims = hpx::threads::mask_type();
+    hpx::threads::resize(core_victims, num_queues);
+    hpx::threads::resize(numa_victims, num_queues);
+    hpx::threads::set(core_victims, 1);
+    hpx::threads::set(numa_victims, 2);
+    hpx::threads::set(numa_victims, 3);
+
+    std::mt19937 gen(42);
+    for (bool const allow_remote : {false, true})
+    {
+        for (int repeat = 0; repeat != 10; ++repeat)
+        {
+            hpx::threads::mask_type asked = hpx::threads::mask_type();
+            hpx::threads::resize(asked, num_queues);
+            hpx::threads::set(asked, 0);
+
+            std::vector<std::size_t> victims;
+            while (true)
+            {
+                std::size_t const victim = select_hierarchical_victim(
+                    num_queues, asked, core_victims, numa_victims,
+                    allow_remote, gen);
+                if (victim == none)
+                    break;
+
+                HPX_TEST(victim < num_queues);
+                HPX_TEST(!hpx::threads::test(asked, victim));
+                hpx::threads::set(asked, victim);
+                victims.push_back(victim);
+            }
+
+            // local victims are asked first, remote ones only if allowed
+            HPX_TEST_EQ(victims.size(), allow_remote ? num_queues - 1 : 3);
+            HPX_TEST_EQ(victims[0], static_cast<std::size_t>(1));
+            HPX_TEST(victims[1] == 2 || victims[1] == 3);
+            HPX_TEST(victims[2] == 2 || victims[2] == 3);
+            for (std::size_t i = 3; i < victims.size(); ++i)
+            {
+                HPX_TEST(victims[i] >= 4);
+            }
+        }
+    }
+}
+
+void test_scheduler(int argc, char* argv[], std::string const& scheduler,
+    std::string const& backoff)
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=" + scheduler,
+        "hpx.thread_queue.workrequesting_numa_hierarchical=1",
+        "hpx.thread_queue.workrequesting_numa_remote_backoff=" + backoff};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_victim_selection();
+
+    for (char const* backoff : {"0", "1", "4"})
+    {
+        test_scheduler(argc, argv, "local-workrequesting-fifo", backoff);
+        test_scheduler(argc, argv, "local-workrequesting-lifo", backoff);
+    }
+
+    return hpx::util::report_errors();
+}
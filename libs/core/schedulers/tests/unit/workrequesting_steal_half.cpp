@@ -0,0 +1,130 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the work-requesting schedulers answer steal requests with
+// batches of tasks if steal-half is enabled, and that no batch exceeds the
+// configured maximal size. The tasks are held on the queue of the spawning
+// worker until the first of them has been stolen, the first steal request
+// answered by that worker therefore always finds (nearly) all of them.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_tasks = 10000;
+
+std::size_t max_steal_batch = 1;
+std::size_t spawning_thread = 0;
+std::atomic<bool> stolen(false);
+std::atomic<std::size_t> count(0);
+
+void busy_task()
+{
+    if (hpx::get_worker_thread_num() != spawning_thread)
+    {
+        stolen = true;
+    }
+    else
+    {
+        // let the spawning worker handle steal requests instead of running
+        // the tasks itself until one of them has been stolen
+        while (!stolen.load() && hpx::get_num_worker_threads() > 1)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+
+    // keep the tasks long enough for idle workers to find the queue of the
+    // spawning worker non-empty
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+        std::chrono::microseconds(10))
+    {
+    }
+    ++count;
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    auto& pool = hpx::resource::get_thread_pool(0);
+
+    // reset the counters
+    pool.get_num_stolen_batches(std::size_t(-1), true);
+    pool.get_num_stolen_batch_tasks(std::size_t(-1), true);
+#endif
+
+    // all tasks are created on this worker, the other workers have to steal
+    spawning_thread = hpx::get_worker_thread_num();
+    stolen = false;
+    count = 0;
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&busy_task));
+    }
+    hpx::wait_all(tasks);
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    std::int64_t const batches =
+        pool.get_num_stolen_batches(std::size_t(-1), false);
+    std::int64_t const batch_tasks =
+        pool.get_num_stolen_batch_tasks(std::size_t(-1), false);
+
+    auto const max_batch = static_cast<std::int64_t>(max_steal_batch);
+    if (max_batch == 1)
+    {
+        // every steal response carries a single task
+        HPX_TEST_EQ(batches, static_cast<std::int64_t>(0));
+        HPX_TEST_EQ(batch_tasks, static_cast<std::int64_t>(0));
+    }
+    else if (hpx::get_num_worker_threads() > 1)
+    {
+        // every batch carries at least two and at most max_batch tasks
+        HPX_TEST_LT(static_cast<std::int64_t>(0), batches);
+        HPX_TEST_LTE(2 * batches, batch_tasks);
+        HPX_TEST_LTE(batch_tasks, max_batch * batches);
+    }
+#endif
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[], std::string const& scheduler,
+    std::string const& max_batch)
+{
+    max_steal_batch = std::stoul(max_batch);
+
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=" + scheduler,
+        "hpx.thread_queue.workrequesting_steal_half=1",
+        "hpx.thread_queue.workrequesting_max_steal_batch=" + max_batch};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    for (char const* max_batch : {"1", "2", "256"})
+    {
+        test_scheduler(argc, argv, "local-workrequesting-fifo", max_batch);
+        test_scheduler(argc, argv, "local-workrequesting-lifo", max_batch);
+    }
+
+    return hpx::util::report_errors();
+}
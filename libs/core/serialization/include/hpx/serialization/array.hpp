@@ -17,6 +17,7 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_zero_copy_serializable.hpp>
 
 #if defined(HPX_SERIALIZATION_HAVE_BOOST_TYPES)
 #include <hpx/serialization/boost_array.hpp>    // for backwards compatibility
@@ -73,8 +74,7 @@ namespace hpx::serialization {
 
             constexpr bool use_optimized =
                 std::is_default_constructible_v<element_type> &&
-                (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                    !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+                hpx::traits::is_zero_copy_serializable_v<element_type>;
 
             if constexpr (use_optimized)
             {
@@ -195,3 +195,16 @@ namespace hpx::serialization {
         return ar;
     }
 }    // namespace hpx::serialization
+
+namespace hpx::traits {
+
+    // contiguous sequences of std::array<T, N> can be serialized as one block
+    // if this is possible for T (e.g. std::vector<std::array<double, 3>>)
+    template <typename T, std::size_t N>
+    struct is_zero_copy_serializable<std::array<T, N>>
+      : std::integral_constant<bool,
+            is_zero_copy_serializable_v<std::remove_const_t<T>> &&
+                sizeof(std::array<T, N>) == N * sizeof(T)>
+    {
+    };
+}    // namespace hpx::traits
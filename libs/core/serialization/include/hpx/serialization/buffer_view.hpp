@@ -0,0 +1,206 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/detail/input_buffer_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A read-only view of a contiguous sequence of trivially copyable
+    /// objects (e.g. the characters of a string), which can be used as an
+    /// action argument. It is serialized like the corresponding std::string
+    /// (the elements are copied as raw bytes). De-serializing a view from an
+    /// archive reading from a buffer with a known owner (as the parcelsets
+    /// do for the received messages) does not allocate and copy the data,
+    /// the view references it in place and keeps the whole buffer alive
+    /// instead. Otherwise the data is copied into memory owned by the view.
+    ///
+    /// This is meant for arguments which are consumed right away, views
+    /// kept around keep the receive buffer of their parcel alive. The
+    /// objects referenced by a view constructed from a pointer or from a
+    /// std::basic_string_view are not owned by it, they have to stay valid
+    /// until the view and all its copies are destroyed (for action arguments
+    /// this includes sending the parcel).
+    template <typename T>
+    class buffer_view
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "buffer_view can be used with trivially copyable types only");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_pointer = T const*;
+        using const_reference = T const&;
+        using const_iterator = T const*;
+        using iterator = const_iterator;
+
+        constexpr buffer_view() noexcept = default;
+
+        // reference the given data
+        constexpr buffer_view(T const* data, std::size_t size) noexcept
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        template <typename Traits>
+        constexpr buffer_view(std::basic_string_view<T, Traits> sv) noexcept
+          : data_(sv.data())
+          , size_(sv.size())
+        {
+        }
+
+        // reference the given data which is kept alive by owner
+        buffer_view(T const* data, std::size_t size,
+            std::shared_ptr<void const> owner) noexcept
+          : data_(data)
+          , size_(size)
+          , owner_(HPX_MOVE(owner))
+        {
+        }
+
+        // take ownership of the given string or vector
+        template <typename Traits, typename Allocator>
+        explicit buffer_view(std::basic_string<T, Traits, Allocator>&& s)
+        {
+            take(HPX_MOVE(s));
+        }
+
+        template <typename Allocator>
+        explicit buffer_view(std::vector<T, Allocator>&& v)
+        {
+            take(HPX_MOVE(v));
+        }
+
+        [[nodiscard]] constexpr T const* data() const noexcept
+        {
+            return data_;
+        }
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        [[nodiscard]] constexpr T const& operator[](
+            std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < size_);
+            return data_[i];
+        }
+
+        // returns whether the view keeps the referenced data alive
+        [[nodiscard]] bool owns_data() const noexcept
+        {
+            return owner_ != nullptr;
+        }
+
+        template <typename Traits,
+            typename Enable = std::enable_if_t<
+                std::is_same_v<typename Traits::char_type, T>>>
+        constexpr operator std::basic_string_view<T, Traits>() const noexcept
+        {
+            return std::basic_string_view<T, Traits>(data_, size_);
+        }
+
+        void reset() noexcept
+        {
+            data_ = nullptr;
+            size_ = 0;
+            owner_.reset();
+        }
+
+    private:
+        template <typename Container>
+        void take(Container&& c)
+        {
+            auto owner = std::make_shared<Container>(HPX_MOVE(c));
+            data_ = owner->data();
+            size_ = owner->size();
+            owner_ = HPX_MOVE(owner);
+        }
+
+        T const* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::shared_ptr<void const> owner_;
+    };
+
+    using string_buffer_view = buffer_view<char>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // load view
+    template <typename T>
+    void serialize(input_archive& ar, buffer_view<T>& v, unsigned)
+    {
+        std::uint64_t size = 0;
+        ar >> size;    //-V128
+
+        v.reset();
+        if (size == 0)
+        {
+            return;
+        }
+
+        auto const count = static_cast<std::size_t>(size);
+        auto const* buffer =
+            ar.try_get_extra_data<detail::input_buffer_owner>();
+        if (buffer != nullptr && buffer->owner != nullptr)
+        {
+            // reference the data in place, if possible
+            void const* data =
+                ar.load_binary_view(count * sizeof(T), alignof(T));
+            if (data != nullptr)
+            {
+                v = buffer_view<T>(
+                    static_cast<T const*>(data), count, buffer->owner);
+                return;
+            }
+        }
+
+        std::shared_ptr<T> data(new T[count], std::default_delete<T[]>());
+        load_binary(ar, data.get(), count * sizeof(T));
+        T const* p = data.get();
+        v = buffer_view<T>(p, count, HPX_MOVE(data));
+    }
+
+    // save view
+    template <typename T>
+    void serialize(output_archive& ar, buffer_view<T> const& v, unsigned)
+    {
+        std::uint64_t const size = v.size();
+        ar << size;
+        save_binary(ar, v.data(), v.size() * sizeof(T));
+    }
+}    // namespace hpx::serialization
@@ -46,5 +46,14 @@ namespace hpx::serialization {
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(
             void* address, std::size_t count, bool allow_zero_copy_receive) = 0;
+
+        // Skip the next count bytes and return their address in the
+        // underlying buffer. Returns nullptr (and skips nothing) if the data
+        // can't be referenced in place or is not aligned as requested.
+        virtual void const* load_binary_view(
+            std::size_t /* count */, std::size_t /* alignment */)
+        {
+            return nullptr;
+        }
     };
 }    // namespace hpx::serialization
@@ -0,0 +1,37 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <cstddef>
+
+namespace hpx::serialization::detail {
+
+    // Archives tagged with this are handled by a network layer which is able
+    // to send zero-copy chunks from (and receive them into) device memory.
+    // Chunks smaller than the threshold (set for output archives only) are
+    // copied into the archive and have to be located in host memory.
+    struct allow_device_memory
+    {
+        std::size_t zero_copy_serialization_threshold = 0;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::allow_device_memory>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static constexpr void reset(
+        serialization::detail::allow_device_memory*) noexcept
+    {
+    }
+};
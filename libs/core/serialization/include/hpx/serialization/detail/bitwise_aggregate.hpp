@@ -0,0 +1,274 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/config/defines.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::traits {
+
+    template <typename T, typename Enable = void>
+    struct is_bitwise_serializable;
+
+    // Detection of aggregates which can be serialized using a single memcpy:
+    // trivially copyable, standard layout aggregates without padding whose
+    // members are all bitwise serializable (recursively), and which do not
+    // expose any serialization functions. The members are decomposed in the
+    // same way as for the automatic serialization of brace-initializable
+    // types.
+    namespace detail {
+
+        // The detected arity of an aggregate is only reliable if every member
+        // can be initialized from a separate braced initializer, otherwise
+        // (e.g. for members that are C-style arrays) elided braces are
+        // counted as well.
+        template <typename T, std::size_t... I>
+        constexpr auto is_braced_constructible(std::index_sequence<I...>,
+            T*) noexcept -> decltype(T{{_wildcard<I>}...}, std::true_type{})
+        {
+            return {};
+        }
+
+        template <std::size_t... I>
+        constexpr std::false_type is_braced_constructible(
+            std::index_sequence<I...>, ...) noexcept
+        {
+            return {};
+        }
+
+        template <typename T, std::size_t N>
+        inline constexpr bool is_braced_constructible_v =
+            decltype(is_braced_constructible(std::make_index_sequence<N>{},
+                static_cast<T*>(nullptr)))::value;
+
+        template <typename T, typename Enable = void>
+        struct has_exact_arity : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct has_exact_arity<T, std::void_t<decltype(arity<T>())>>
+          : std::integral_constant<bool,
+                is_braced_constructible_v<T, decltype(arity<T>())::value> &&
+                    !is_braced_constructible_v<T,
+                        decltype(arity<T>())::value + 1>>
+        {
+        };
+
+        template <typename T>
+        class has_serialize_member
+        {
+            template <typename T1>
+            static std::false_type test(...);
+
+            // clang-format off
+            template <typename T1,
+                typename = decltype(std::declval<T1&>().serialize(
+                    std::declval<hpx::serialization::output_archive&>(), 0u))>
+            static std::true_type test(int);
+            // clang-format on
+
+        public:
+            static constexpr bool value = decltype(test<T>(0))::value;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename... Ts>
+        struct aggregate_members
+        {
+        };
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<1>)
+        {
+            auto& [p1] = t;
+            return aggregate_members<decltype(p1)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<2>)
+        {
+            auto& [p1, p2] = t;
+            return aggregate_members<decltype(p1), decltype(p2)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<3>)
+        {
+            auto& [p1, p2, p3] = t;
+            return aggregate_members<decltype(p1), decltype(p2),
+                decltype(p3)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<4>)
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<5>)
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<6>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<7>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<8>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<9>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<10>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<11>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<12>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<13>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<14>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14)>{};
+        }
+
+        template <typename T>
+        auto get_aggregate_members(T& t, size<15>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
+                p15] = t;
+            return aggregate_members<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14), decltype(p15)>{};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct is_bitwise_member
+          : std::integral_constant<bool,
+                !std::is_const_v<T> &&
+                    (std::is_enum_v<T> || is_bitwise_serializable<T>::value)>
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct is_bitwise_member<std::array<T, N>>
+          : std::integral_constant<bool,
+                N != 0 && is_bitwise_member<T>::value &&
+                    sizeof(std::array<T, N>) == N * sizeof(T)>
+        {
+        };
+
+        template <typename T, typename Members>
+        struct has_bitwise_members_impl;
+
+        template <typename T, typename... Ts>
+        struct has_bitwise_members_impl<T, aggregate_members<Ts...>>
+          : std::integral_constant<bool,
+                (is_bitwise_member<Ts>::value && ...) &&
+                    sizeof(T) == (sizeof(Ts) + ...)>
+        {
+        };
+
+        template <typename T>
+        struct has_bitwise_members
+          : has_bitwise_members_impl<T,
+                decltype(get_aggregate_members(std::declval<T&>(),
+                    size<decltype(arity<T>())::value>()))>
+        {
+        };
+
+        // The conditions are evaluated lazily, the members are inspected only
+        // if the aggregate can be safely decomposed.
+        template <typename T>
+        struct is_bitwise_aggregate
+          : std::conjunction<std::is_class<T>, std::is_aggregate<T>,
+                std::is_trivially_copyable<T>, std::is_standard_layout<T>,
+                std::negation<std::is_empty<T>>,
+                std::negation<has_serialize_member<T>>,
+                std::negation<has_serialize_adl<T>>, has_exact_arity<T>,
+                has_bitwise_members<T>>
+        {
+        };
+    }    // namespace detail
+}    // namespace hpx::traits
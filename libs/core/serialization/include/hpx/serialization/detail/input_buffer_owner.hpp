@@ -0,0 +1,37 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <memory>
+
+namespace hpx::serialization::detail {
+
+    // Input archives tagged with this read from a buffer which is kept alive
+    // by the stored owner. Objects de-serialized from such an archive may
+    // reference the data in the buffer in place, as long as they hold on to
+    // the owner (see serialization::buffer_view).
+    struct input_buffer_owner
+    {
+        std::shared_ptr<void const> owner;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::input_buffer_owner>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(serialization::detail::input_buffer_owner* p) noexcept
+    {
+        p->owner.reset();
+    }
+};
@@ -15,6 +15,7 @@
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_table.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/string.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
@@ -27,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 namespace hpx::serialization::detail {
@@ -102,11 +104,15 @@ namespace hpx::serialization {
             {
                 static Pointer call(input_archive& ar)
                 {
-                    std::string name;
-                    ar >> name;
+                    void const* handle =
+                        load_polymorphic_type(ar, [](std::string const& name) {
+                            return polymorphic_intrusive_factory::instance()
+                                .get_handle(name);
+                        });
 
-                    Pointer t(polymorphic_intrusive_factory::instance()
-                                  .create<referred_type>(name));
+                    Pointer t(
+                        polymorphic_intrusive_factory::create<referred_type>(
+                            handle));
                     ar >> *t;
                     return t;
                 }
@@ -114,7 +120,9 @@ namespace hpx::serialization {
 
             struct polymorphic_with_id
             {
-                static Pointer call(input_archive& ar)
+                // the archive type is deduced as it is incomplete here
+                template <typename Archive>
+                static Pointer call(Archive& ar)
                 {
 #if !defined(HPX_DEBUG)
                     std::uint32_t id;
@@ -127,7 +135,11 @@ namespace hpx::serialization {
 #else
                     std::uint32_t id;
                     std::string name;
-                    ar >> name;
+                    if (!ar.trusted_peer())
+                    {
+                        // trusted peers send the type id only
+                        ar >> name;
+                    }
                     ar >> id;
 
                     Pointer t(polymorphic_id_factory::create<referred_type>(
@@ -179,15 +191,22 @@ namespace hpx::serialization {
             {
                 static void call(output_archive& ar, Pointer const& ptr)
                 {
-                    std::string const name = access::get_name(ptr.get());
-                    ar << name;
-                    ar << *ptr;
+                    // the name is retrieved only the first time the type
+                    // occurs in the archive
+                    referred_type const& t = *ptr;
+                    save_polymorphic_type(ar, typeid(t), [&]() {
+                        return std::make_pair(
+                            access::get_name(&t), static_cast<void*>(nullptr));
+                    });
+                    ar << t;
                 }
             };
 
             struct polymorphic_with_id
             {
-                static void call(output_archive& ar, Pointer const& ptr)
+                // the archive type is deduced as it is incomplete here
+                template <typename Archive>
+                static void call(Archive& ar, Pointer const& ptr)
                 {
 #if !defined(HPX_DEBUG)
                     std::uint32_t const id = polymorphic_id_factory::get_id(
@@ -198,7 +217,11 @@ namespace hpx::serialization {
                     std::string const name = access::get_name(ptr.get());
                     std::uint32_t const id =
                         polymorphic_id_factory::get_id(name);
-                    ar << name;
+                    if (!ar.trusted_peer())
+                    {
+                        // trusted peers send the type id only
+                        ar << name;
+                    }
                     ar << id;
                     ar << *ptr;
 #endif
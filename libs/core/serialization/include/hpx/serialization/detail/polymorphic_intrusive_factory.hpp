@@ -49,6 +49,19 @@ namespace hpx::serialization::detail {
             return static_cast<T*>(create(name));
         }
 
+        // return an opaque handle identifying the factory function for the
+        // given name, can be used to create an object without a name lookup
+        [[nodiscard]] HPX_CORE_EXPORT void const* get_handle(
+            std::string const& name) const;
+
+        template <typename T>
+        [[nodiscard]] static T* create(void const* handle)
+        {
+            return static_cast<T*>(
+                static_cast<ctor_map_type::value_type const*>(handle)
+                    ->second());
+        }
+
     private:
         ctor_map_type map_;
     };
@@ -152,6 +152,10 @@ namespace hpx::serialization::detail {
     private:
         polymorphic_nonintrusive_factory() = default;
 
+        // retrieve the functions for the type stored in the archive
+        [[nodiscard]] function_bunch_type const& load_bunch(
+            input_archive& ar) const;
+
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
         serializer_map_type map_;
@@ -9,12 +9,14 @@
 #pragma once
 
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_table.hpp>
 
 #include <hpx/serialization/input_archive.hpp>
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/string.hpp>
 
 #include <string>
+#include <utility>
 
 namespace hpx::serialization::detail {
 
@@ -24,30 +26,34 @@ namespace hpx::serialization::detail {
         // It's safe to call typeid here. The typeid(t) return value is
         // only used for local lookup to the portable string that goes over the
         // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
-
-        map_.at(class_name).save_function(ar, &t);
+        auto const* bunch = static_cast<function_bunch_type const*>(
+            save_polymorphic_type(ar, typeid(t), [&]() {
+                std::string const& class_name =
+                    typeinfo_map_.at(typeid(t).name());
+                return std::make_pair(class_name, &map_.at(class_name));
+            }));
+
+        bunch->save_function(ar, &t);
     }
 
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        map_.at(class_name).load_function(ar, &t);
+        load_bunch(ar).load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        function_bunch_type const& bunch = map_.at(class_name);
-        T* t = static_cast<T*>(bunch.create_function(ar));
+        return static_cast<T*>(load_bunch(ar).create_function(ar));
+    }
 
-        return t;
+    inline function_bunch_type const&
+    polymorphic_nonintrusive_factory::load_bunch(input_archive& ar) const
+    {
+        return *static_cast<function_bunch_type const*>(
+            load_polymorphic_type(ar, [this](std::string const& class_name) {
+                return static_cast<void const*>(&map_.at(class_name));
+            }));
     }
 }    // namespace hpx::serialization::detail
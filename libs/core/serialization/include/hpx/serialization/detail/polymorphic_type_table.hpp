@@ -0,0 +1,126 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    // The polymorphic types (serialized with their name) an archive has seen
+    // so far. The name of a type is sent only the first time the type occurs
+    // in an archive, after that the (archive local) index of the type is sent
+    // instead. This avoids handling the type names for each polymorphic
+    // object.
+    struct output_polymorphic_types
+    {
+        struct entry
+        {
+            std::uint32_t index;
+            void const* data;
+        };
+
+        std::unordered_map<std::type_index, entry> types;
+    };
+
+    struct input_polymorphic_types
+    {
+        std::vector<void const*> types;
+    };
+}    // namespace hpx::serialization::detail
+
+namespace hpx::util {
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    template <>
+    struct extra_data_helper<serialization::detail::output_polymorphic_types>
+    {
+        HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+        HPX_CORE_EXPORT static void reset(
+            serialization::detail::output_polymorphic_types* data) noexcept;
+    };
+
+    template <>
+    struct extra_data_helper<serialization::detail::input_polymorphic_types>
+    {
+        HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+        HPX_CORE_EXPORT static void reset(
+            serialization::detail::input_polymorphic_types* data) noexcept;
+    };
+}    // namespace hpx::util
+
+namespace hpx::serialization::detail {
+
+    // Store the index of the given (dynamic) type. If the type occurs for the
+    // first time in this archive, get_type is invoked to retrieve the name of
+    // the type and the factory specific data associated with it, the name is
+    // stored as well. Returns the factory specific data.
+    //
+    // The archive type is deduced as it is incomplete here.
+    template <typename Archive, typename F>
+    void const* save_polymorphic_type(
+        Archive& ar, std::type_info const& type, F&& get_type)
+    {
+        auto& types =
+            ar.template get_extra_data<output_polymorphic_types>().types;
+
+        auto const index = static_cast<std::uint32_t>(types.size());
+        auto [it, inserted] = types.try_emplace(std::type_index(type),
+            output_polymorphic_types::entry{index, nullptr});
+
+        ar << it->second.index;
+        if (inserted)
+        {
+            auto [name, data] = get_type();
+            it->second.data = data;
+            ar << name;
+        }
+        return it->second.data;
+    }
+
+    // Load the index of a type (and the name of the type, if it occurs for the
+    // first time in this archive, in which case find_type is invoked to
+    // retrieve the factory specific data for the name). Returns the factory
+    // specific data.
+    template <typename Archive, typename F>
+    void const* load_polymorphic_type(Archive& ar, F&& find_type)
+    {
+        auto& types =
+            ar.template get_extra_data<input_polymorphic_types>().types;
+
+        std::uint32_t index = 0;
+        ar >> index;
+
+        if (index < types.size())
+        {
+            return types[index];
+        }
+
+        if (index != types.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "hpx::serialization::detail::load_polymorphic_type",
+                "unexpected polymorphic type index: {}", index);
+        }
+
+        std::string name;
+        ar >> name;
+
+        void const* data = find_type(name);
+        types.push_back(data);
+        return data;
+    }
+}    // namespace hpx::serialization::detail
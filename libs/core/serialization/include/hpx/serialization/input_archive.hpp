@@ -17,6 +17,7 @@
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
 #include <hpx/serialization/input_container.hpp>
+#include <hpx/serialization/streaming_container.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 
@@ -34,59 +35,22 @@ namespace hpx::serialization {
     {
         using base_type = basic_archive<input_archive>;
 
-        template <typename Container>
+        template <typename Container,
+            typename Enable =
+                std::enable_if_t<!std::is_base_of_v<input_stream, Container>>>
         explicit input_archive(Container& buffer,
             std::size_t inbound_data_size = 0,
             std::vector<serialization_chunk>* chunks = nullptr)
-          : base_type(0U)
-          , buffer_(new input_container<Container>(
+          : input_archive(std::make_unique<input_container<Container>>(
                 buffer, chunks, inbound_data_size))
         {
-            // endianness needs to be saved separately as it is needed to
-            // properly interpret the flags
-
-            // FIXME: make bool once integer compression is implemented
-            std::uint64_t endianness = 0ul;
-            load(endianness);
-            if (endianness)
-            {
-                flags_ = static_cast<std::uint32_t>(
-                    hpx::serialization::archive_flags::endian_big);
-            }
-
-#if !defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
-            if ((endianness && (endian::native == endian::little)) ||
-                (!endianness && (endian::native == endian::big)))
-            {
-                HPX_THROW_EXCEPTION(hpx::error::bad_request,
-                    "hpx::serialization::input_archive::input_archive",
-                    "Converting endianness is not supported by the "
-                    "serialization library, please reconfigure HPX with "
-                    "-DHPX_SERIALIZATION_WITH_SUPPORTS_ENDIANESS=On");
-            }
-#endif
-            // Load flags sent by the other end to make sure both ends have
-            // the same assumptions about the archive format. It is safe to
-            // overwrite the flags_ now.
-            std::uint32_t flags = 0;
-            load(flags);
-            flags_ = flags;
-
-            // load the zero-copy limit used by the other end
-            std::uint64_t zero_copy_serialization_threshold;
-            load(zero_copy_serialization_threshold);
-            buffer_->set_zero_copy_serialization_threshold(
-                zero_copy_serialization_threshold);
-
-            bool has_filter = false;
-            load(has_filter);
+        }
 
-            if (has_filter && enable_compression())
-            {
-                serialization::binary_filter* filter = nullptr;
-                *this >> detail::raw_ptr(filter);
-                buffer_->set_filter(filter);
-            }
+        // Create an archive which reads the serialized data from the given
+        // stream while it is being received.
+        explicit input_archive(input_stream& stream)
+          : input_archive(std::make_unique<streaming_input_container>(stream))
+        {
         }
 
         template <typename T>
@@ -109,6 +73,16 @@ namespace hpx::serialization {
                 "HPX does not support serialization of raw pointers. "
                 "Please use smart pointers instead.");
 #endif
+            if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            {
+                // trusted peers agree on the size of all integral types
+                if (trusted_peer())
+                {
+                    load_binary(&t, sizeof(T));
+                    return;
+                }
+            }
+
             if constexpr (!std::is_integral_v<T> && !std::is_enum_v<T>)
             {
                 if constexpr (hpx::traits::is_bitwise_serializable_v<T> ||
@@ -253,6 +227,76 @@ namespace hpx::serialization {
         }
 #endif
 
+        explicit input_archive(std::unique_ptr<erased_input_container> buffer)
+          : base_type(0U)
+          , buffer_(HPX_MOVE(buffer))
+        {
+            // The archive either starts with the endianness marker (all
+            // zeros or all ones) or, if it was created for a trusted peer,
+            // directly with the flags.
+            std::uint32_t marker = 0;
+            load_binary(&marker, sizeof(marker));
+
+            std::uint64_t zero_copy_serialization_threshold = 0;
+            if (marker != 0 && marker != ~0u &&
+                (marker & archive_flags::trusted_peer))
+            {
+                flags_ = marker;
+                load_binary(&zero_copy_serialization_threshold,
+                    sizeof(zero_copy_serialization_threshold));
+            }
+            else
+            {
+                // endianness needs to be saved separately as it is needed to
+                // properly interpret the flags
+
+                // FIXME: make bool once integer compression is implemented
+                std::uint32_t endianness_tail = 0;
+                load_binary(&endianness_tail, sizeof(endianness_tail));
+
+                bool const endianness = marker != 0;
+                if (endianness)
+                {
+                    flags_ = static_cast<std::uint32_t>(
+                        hpx::serialization::archive_flags::endian_big);
+                }
+
+#if !defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                if ((endianness && (endian::native == endian::little)) ||
+                    (!endianness && (endian::native == endian::big)))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_request,
+                        "hpx::serialization::input_archive::input_archive",
+                        "Converting endianness is not supported by the "
+                        "serialization library, please reconfigure HPX with "
+                        "-DHPX_SERIALIZATION_WITH_SUPPORTS_ENDIANESS=On");
+                }
+#endif
+                // Load flags sent by the other end to make sure both ends
+                // have the same assumptions about the archive format. It is
+                // safe to overwrite the flags_ now.
+                std::uint32_t flags = 0;
+                load(flags);
+                flags_ = flags;
+
+                // load the zero-copy limit used by the other end
+                load(zero_copy_serialization_threshold);
+            }
+
+            buffer_->set_zero_copy_serialization_threshold(
+                zero_copy_serialization_threshold);
+
+            bool has_filter = false;
+            load(has_filter);
+
+            if (has_filter && enable_compression())
+            {
+                serialization::binary_filter* filter = nullptr;
+                *this >> detail::raw_ptr(filter);
+                buffer_->set_filter(filter);
+            }
+        }
+
     public:
         void load_binary(void* address, std::size_t count)
         {
@@ -284,6 +328,23 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Skip the next count bytes of the archive data and return their
+        // address, if the data can be referenced in place (the archive is
+        // not compressed and the address is a multiple of the given
+        // alignment). Otherwise nullptr is returned and nothing is read.
+        void const* load_binary_view(std::size_t count, std::size_t alignment)
+        {
+            if (HPX_UNLIKELY(0 == count))
+                return nullptr;
+
+            void const* data = buffer_->load_binary_view(count, alignment);
+            if (data != nullptr)
+            {
+                size_ += count;
+            }
+            return data;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
@@ -127,7 +127,7 @@ namespace hpx::serialization {
             }
             else
             {
-                std::size_t new_current = current_ + count;
+                std::size_t const new_current = current_ + count;
                 if (new_current > access_traits::size(cont_))
                 {
                     HPX_THROW_EXCEPTION(hpx::error::serialization_error,
@@ -137,31 +137,35 @@ namespace hpx::serialization {
 
                 access_traits::read(cont_, count, current_, address);
 
-                current_ = new_current;
+                advance(new_current, count);
+            }
+        }
 
-                if (chunks_ != nullptr)
-                {
-                    current_chunk_size_ += count;
-
-                    // make sure we switch to the next serialization_chunk if
-                    // necessary
-                    std::size_t const current_chunk_size =
-                        get_chunk_size(current_chunk_);
-                    if (current_chunk_size != 0 &&
-                        current_chunk_size_ >= current_chunk_size)
-                    {
-                        // raise an error if we read past the serialization_chunk
-                        if (current_chunk_size_ > current_chunk_size)
-                        {
-                            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                                "input_container::load_binary",
-                                "archive data bstream structure mismatch");
-                        }
-                        ++current_chunk_;
-                        current_chunk_size_ = 0;
-                    }
-                }
+        void const* load_binary_view(
+            std::size_t count, std::size_t alignment) override
+        {
+            if (filter_ != nullptr)
+            {
+                return nullptr;    // the data has to be decompressed first
+            }
+
+            std::size_t const new_current = current_ + count;
+            if (new_current > access_traits::size(cont_))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "input_container::load_binary_view",
+                    "archive data bstream is too short");
+            }
+
+            void const* data = access_traits::data(cont_, current_);
+            if (data == nullptr ||
+                reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+            {
+                return nullptr;
             }
+
+            advance(new_current, count);
+            return data;
         }
 
         void load_binary_chunk(void* address, std::size_t count,
@@ -212,6 +216,36 @@ namespace hpx::serialization {
             }
         }
 
+    private:
+        void advance(std::size_t new_current, std::size_t count)
+        {
+            current_ = new_current;
+
+            if (chunks_ != nullptr)
+            {
+                current_chunk_size_ += count;
+
+                // make sure we switch to the next serialization_chunk if
+                // necessary
+                std::size_t const current_chunk_size =
+                    get_chunk_size(current_chunk_);
+                if (current_chunk_size != 0 &&
+                    current_chunk_size_ >= current_chunk_size)
+                {
+                    // raise an error if we read past the serialization_chunk
+                    if (current_chunk_size_ > current_chunk_size)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                            "input_container::load_binary",
+                            "archive data bstream structure mismatch");
+                    }
+                    ++current_chunk_;
+                    current_chunk_size_ = 0;
+                }
+            }
+        }
+
+    public:
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
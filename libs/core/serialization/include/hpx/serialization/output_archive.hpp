@@ -16,6 +16,7 @@
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
 #include <hpx/serialization/output_container.hpp>
+#include <hpx/serialization/streaming_container.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 
@@ -108,50 +109,26 @@ namespace hpx::serialization {
     public:
         using base_type = basic_archive<output_archive>;
 
-        template <typename Container>
+        template <typename Container,
+            typename Enable =
+                std::enable_if_t<!std::is_base_of_v<output_stream, Container>>>
         explicit output_archive(Container& buffer, std::uint32_t flags = 0U,
             std::vector<serialization_chunk>* chunks = nullptr,
             binary_filter* filter = nullptr,
             std::size_t zero_copy_serialization_threshold = 0)
-          : base_type(make_flags(flags, chunks))
-          , buffer_(detail::create_output_container(buffer, chunks, filter,
-                zero_copy_serialization_threshold,
-                typename traits::serialization_access_data<
-                    Container>::preprocessing_only()))
+          : output_archive(
+                detail::create_output_container(buffer, chunks, filter,
+                    zero_copy_serialization_threshold,
+                    typename traits::serialization_access_data<
+                        Container>::preprocessing_only()),
+                make_flags(flags, chunks), filter,
+                zero_copy_serialization_threshold)
         {
-            // cache the preprocessing flag in the base class to avoid asking
-            // the buffer repeatedly
-            if (buffer_->is_preprocessing())
-            {
-                flags_ = static_cast<std::uint32_t>(
-                    flags_ | archive_flags::archive_is_preprocessing);
-            }
-
-            // endianness needs to be saved separately as it is needed to
-            // properly interpret the flags
-            //
-            // FIXME: make bool once integer compression is implemented
-            std::uint64_t const endianness = endian_big() ? ~0ul : 0ul;
-            save(endianness);
-
-            // send flags sent by the other end to make sure both ends have
-            // the same assumptions about the archive format
-            save(flags_);
-
-            // send the zero-copy limit
-            save(static_cast<std::uint64_t>(zero_copy_serialization_threshold));
-
-            bool const has_filter = filter != nullptr;
-            save(has_filter);
-
-            if (has_filter && enable_compression())
-            {
-                *this << detail::raw_ptr(filter);
-                buffer_->set_filter(filter);
-            }
         }
 
-        template <typename Container>
+        template <typename Container,
+            typename Enable =
+                std::enable_if_t<!std::is_base_of_v<output_stream, Container>>>
         output_archive(Container& buffer, archive_flags flags,
             std::vector<serialization_chunk>* chunks = nullptr,
             binary_filter* filter = nullptr,
@@ -161,6 +138,20 @@ namespace hpx::serialization {
         {
         }
 
+        // Create an archive which passes the serialized data to the given
+        // stream in pieces of at most chunk_size bytes while the
+        // serialization is in progress. Streamed archives can't be
+        // compressed.
+        output_archive(output_stream& stream, std::size_t chunk_size,
+            std::uint32_t flags = 0U,
+            std::size_t zero_copy_serialization_threshold = 0)
+          : output_archive(std::make_unique<streaming_output_container>(stream,
+                               chunk_size, zero_copy_serialization_threshold),
+                flags | archive_flags::archive_is_saving, nullptr,
+                zero_copy_serialization_threshold)
+        {
+        }
+
         [[nodiscard]] constexpr std::size_t bytes_written() const noexcept
         {
             return size_;
@@ -208,6 +199,16 @@ namespace hpx::serialization {
                 "HPX does not support serialization of raw pointers. "
                 "Please use smart pointers instead.");
 #endif
+            if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+            {
+                // trusted peers agree on the size of all integral types
+                if (trusted_peer())
+                {
+                    save_binary(&t, sizeof(T));
+                    return;
+                }
+            }
+
             if constexpr (!std::is_integral_v<T> && !std::is_enum_v<T>)
             {
                 if constexpr (hpx::traits::is_bitwise_serializable_v<T> ||
@@ -335,6 +336,60 @@ namespace hpx::serialization {
         }
 #endif
 
+        output_archive(std::unique_ptr<erased_output_container> buffer,
+            std::uint32_t flags, binary_filter* filter,
+            std::size_t zero_copy_serialization_threshold)
+          : base_type(flags)
+          , buffer_(HPX_MOVE(buffer))
+        {
+            // cache the preprocessing flag in the base class to avoid asking
+            // the buffer repeatedly
+            if (buffer_->is_preprocessing())
+            {
+                flags_ = static_cast<std::uint32_t>(
+                    flags_ | archive_flags::archive_is_preprocessing);
+            }
+
+            if (trusted_peer())
+            {
+                // trusted peers don't need to agree on the endianness, the
+                // flags come first, they can't be confused with the
+                // endianness marker written otherwise (which is either all
+                // zeros or all ones)
+                save_binary(&flags_, sizeof(flags_));
+
+                std::uint64_t const threshold =
+                    zero_copy_serialization_threshold;
+                save_binary(&threshold, sizeof(threshold));
+            }
+            else
+            {
+                // endianness needs to be saved separately as it is needed to
+                // properly interpret the flags
+                //
+                // FIXME: make bool once integer compression is implemented
+                std::uint64_t const endianness = endian_big() ? ~0ul : 0ul;
+                save(endianness);
+
+                // send flags sent by the other end to make sure both ends
+                // have the same assumptions about the archive format
+                save(flags_);
+
+                // send the zero-copy limit
+                save(static_cast<std::uint64_t>(
+                    zero_copy_serialization_threshold));
+            }
+
+            bool const has_filter = filter != nullptr;
+            save(has_filter);
+
+            if (has_filter && enable_compression())
+            {
+                *this << detail::raw_ptr(filter);
+                buffer_->set_filter(filter);
+            }
+        }
+
     public:
         void save_binary(void const* address, std::size_t count)
         {
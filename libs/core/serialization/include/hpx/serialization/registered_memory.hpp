@@ -0,0 +1,116 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/serialize_buffer_fwd.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A network layer (usually a parcelport) which is able to register memory
+    // for remote direct memory access (RDMA). The handles returned from
+    // register_memory are opaque to HPX, they are handed back to the same
+    // registrar only.
+    struct memory_registrar
+    {
+        virtual ~memory_registrar() = default;
+
+        // Register the given block of memory, return nullptr if the memory
+        // could not be registered.
+        virtual void* register_memory(void* address, std::size_t size) = 0;
+
+        // Release a registration created by register_memory.
+        virtual void unregister_memory(void* handle) noexcept = 0;
+    };
+
+    // Make a registrar known. All registered memory allocated so far is
+    // registered with it right away, all memory allocated later on is
+    // registered as soon as it is allocated.
+    HPX_CORE_EXPORT void add_memory_registrar(memory_registrar& registrar);
+
+    // Release all registrations created by the given registrar, this has to
+    // be called before the registrar is destroyed.
+    HPX_CORE_EXPORT void remove_memory_registrar(
+        memory_registrar& registrar) noexcept;
+
+    // Return the handle created by the given registrar for the block of
+    // registered memory containing [address, address + size), or nullptr if
+    // that memory was not allocated as registered memory.
+    [[nodiscard]] HPX_CORE_EXPORT void* get_memory_registration(
+        memory_registrar const& registrar, void const* address,
+        std::size_t size) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocate memory which is registered with all known registrars. Freed
+    // blocks stay registered and are reused by later allocations of a
+    // similar size, so the (expensive) registration happens only once.
+    [[nodiscard]] HPX_CORE_EXPORT void* allocate_registered_memory(
+        std::size_t size);
+    HPX_CORE_EXPORT void deallocate_registered_memory(void* p) noexcept;
+
+    // Give the cached (unused) blocks of registered memory back to the
+    // system.
+    HPX_CORE_EXPORT void release_unused_registered_memory() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Standard allocator placing its data in registered memory, suitable for
+    // serialize_buffer, std::vector, and the partitions of a
+    // partitioned_vector.
+    template <typename T>
+    struct registered_allocator
+    {
+        using value_type = T;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        constexpr registered_allocator() noexcept = default;
+
+        template <typename U>
+        constexpr explicit registered_allocator(
+            registered_allocator<U> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(allocate_registered_memory(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            deallocate_registered_memory(p);
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(registered_allocator<T> const&,
+        registered_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(registered_allocator<T> const&,
+        registered_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+
+    // A serialize_buffer whose data can be sent using RDMA without
+    // registering it for each message.
+    template <typename T>
+    using registered_serialize_buffer =
+        serialize_buffer<T, registered_allocator<T>>;
+}    // namespace hpx::serialization
+
+#include <hpx/config/warnings_suffix.hpp>
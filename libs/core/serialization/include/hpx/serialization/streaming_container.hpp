@@ -0,0 +1,209 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/container.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The receiving end of an output_archive in streaming mode. The archive
+    // passes the serialized data in pieces of bounded size while the
+    // serialization is still in progress.
+    struct output_stream
+    {
+        virtual ~output_stream() = default;
+
+        // Consume the next piece of the serialized data. The memory referred
+        // to has to stay valid only until the next call to write() or
+        // flush() returns, which allows the data to be sent asynchronously.
+        virtual void write(void const* data, std::size_t size) = 0;
+
+        // All data has been passed to write(), return only after all of it
+        // has been consumed.
+        virtual void flush() = 0;
+    };
+
+    // The source of an input_archive in streaming mode.
+    struct input_stream
+    {
+        virtual ~input_stream() = default;
+
+        // Place the next size bytes of the serialized data at the given
+        // address, waiting for the data to become available if necessary.
+        virtual void read(void* data, std::size_t size) = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the serialized data in chunks of at most chunk_size bytes and
+    // pass those to the output stream as soon as they are complete. Two chunk
+    // buffers are used alternately, one of them being filled while the other
+    // is still being consumed. Blocks of memory larger than the zero-copy
+    // threshold are passed to the stream directly (without copying), split
+    // into pieces of at most chunk_size bytes.
+    struct streaming_output_container : erased_output_container
+    {
+        streaming_output_container(output_stream& stream,
+            std::size_t chunk_size,
+            std::size_t zero_copy_serialization_threshold = 0)
+          : stream_(stream)
+          , chunk_size_(chunk_size != 0 ? chunk_size : 1)
+          , current_buffer_(0)
+          , zero_copy_serialization_threshold_(
+                zero_copy_serialization_threshold)
+        {
+            if (zero_copy_serialization_threshold_ == 0)
+            {
+                zero_copy_serialization_threshold_ =
+                    HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+            }
+            buffers_[0].reserve(chunk_size_);
+            buffers_[1].reserve(chunk_size_);
+        }
+
+        void flush() override
+        {
+            write_buffer();
+            stream_.flush();
+        }
+
+        [[nodiscard]] std::size_t get_num_chunks() const noexcept override
+        {
+            return 1;
+        }
+
+        void reset() override
+        {
+            buffers_[0].clear();
+            buffers_[1].clear();
+        }
+
+        void set_filter(binary_filter* /* filter */) override
+        {
+            // the data of compressed archives can't be streamed
+            HPX_ASSERT(false);
+        }
+
+        void save_binary(void const* address, std::size_t count) override
+        {
+            HPX_ASSERT(count != 0);
+
+            auto const* src = static_cast<char const*>(address);
+            while (count != 0)
+            {
+                std::vector<char>& buffer = buffers_[current_buffer_];
+
+                std::size_t const n =
+                    (std::min)(count, chunk_size_ - buffer.size());
+                buffer.insert(buffer.end(), src, src + n);
+
+                if (buffer.size() == chunk_size_)
+                {
+                    write_buffer();
+                }
+
+                src += n;
+                count -= n;
+            }
+        }
+
+        std::size_t save_binary_chunk(
+            void const* address, std::size_t count) override
+        {
+            if (count < zero_copy_serialization_threshold_)
+            {
+                this->streaming_output_container::save_binary(address, count);
+            }
+            else
+            {
+                // the data has to be passed on in order
+                write_buffer();
+
+                auto const* src = static_cast<char const*>(address);
+                for (std::size_t n = 0; n < count; n += chunk_size_)
+                {
+                    stream_.write(src + n, (std::min)(count - n, chunk_size_));
+                }
+            }
+
+            // all data is sent through the stream
+            return count;
+        }
+
+    private:
+        void write_buffer()
+        {
+            std::vector<char>& buffer = buffers_[current_buffer_];
+            if (!buffer.empty())
+            {
+                stream_.write(buffer.data(), buffer.size());
+
+                // the other buffer was released by the stream, reuse it
+                current_buffer_ ^= 1;
+                buffers_[current_buffer_].clear();
+            }
+        }
+
+        output_stream& stream_;
+        std::size_t chunk_size_;
+        std::vector<char> buffers_[2];
+        std::size_t current_buffer_;
+        std::size_t zero_copy_serialization_threshold_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Read the serialized data from an input stream while it is being
+    // received. Larger blocks of memory are read directly into their final
+    // destination.
+    struct streaming_input_container : erased_input_container
+    {
+        explicit streaming_input_container(input_stream& stream) noexcept
+          : stream_(stream)
+        {
+        }
+
+        void set_filter(binary_filter* filter) override
+        {
+            if (filter != nullptr)
+            {
+                std::unique_ptr<binary_filter> const f(filter);
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "streaming_input_container::set_filter",
+                    "the data of compressed archives can't be streamed");
+            }
+        }
+
+        void set_zero_copy_serialization_threshold(
+            std::size_t /* zero_copy_serialization_threshold */) override
+        {
+        }
+
+        void load_binary(void* address, std::size_t count) override
+        {
+            stream_.read(address, count);
+        }
+
+        void load_binary_chunk(void* address, std::size_t count,
+            bool /* allow_zero_copy_receive */) override
+        {
+            stream_.read(address, count);
+        }
+
+    private:
+        input_stream& stream_;
+    };
+}    // namespace hpx::serialization
@@ -11,20 +11,38 @@
 #include <hpx/serialization/config/defines.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+#include <hpx/serialization/detail/bitwise_aggregate.hpp>
+#endif
+
 #include <type_traits>
 
 namespace hpx::traits {
 
+    namespace detail {
+
 #if !defined(HPX_SERIALIZATION_HAVE_ALLOW_RAW_POINTER_SERIALIZATION)
-    template <typename T, typename Enable = void>
-    struct is_bitwise_serializable : std::is_arithmetic<T>
+        template <typename T>
+        using is_bitwise_serializable_scalar = std::is_arithmetic<T>;
+#else
+        template <typename T>
+        using is_bitwise_serializable_scalar = std::integral_constant<bool,
+            std::is_arithmetic_v<T> || std::is_pointer_v<T>>;
+#endif
+    }    // namespace detail
+
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+    // padding-free aggregates of bitwise serializable members are bitwise
+    // serializable as well, see detail/bitwise_aggregate.hpp
+    template <typename T, typename Enable>
+    struct is_bitwise_serializable
+      : std::disjunction<detail::is_bitwise_serializable_scalar<T>,
+            detail::is_bitwise_aggregate<T>>
     {
     };
 #else
     template <typename T, typename Enable = void>
-    struct is_bitwise_serializable
-      : std::integral_constant<bool,
-            std::is_arithmetic_v<T> || std::is_pointer_v<T>>
+    struct is_bitwise_serializable : detail::is_bitwise_serializable_scalar<T>
     {
     };
 #endif
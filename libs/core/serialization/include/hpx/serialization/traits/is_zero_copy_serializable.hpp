@@ -0,0 +1,52 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+
+#include <type_traits>
+
+namespace hpx::traits {
+
+    // This trait specifies whether contiguous sequences of objects of the
+    // given type (std::vector, std::array, std::valarray, serialize_buffer,
+    // and hpx::serialization::array) may be serialized as one block of raw
+    // memory. Such blocks are sent as separate chunks and, if supported by the
+    // parcelport, are received directly into the memory of the container
+    // without any intermediate copy.
+    //
+    // By default, this is the case for all bitwise serializable types. Types
+    // that should be serialized member-wise if used on their own can opt in
+    // using HPX_IS_ZERO_COPY_SERIALIZABLE. The type still has to expose its
+    // serialization functions, those are used whenever the array optimizations
+    // are disabled for an archive (e.g. if the endianness of the receiving
+    // locality differs).
+    template <typename T, typename Enable = void>
+    struct is_zero_copy_serializable
+      : std::integral_constant<bool,
+            is_bitwise_serializable_v<T> || !is_not_bitwise_serializable_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_zero_copy_serializable_v =
+        is_zero_copy_serializable<T>::value;
+}    // namespace hpx::traits
+
+#define HPX_IS_ZERO_COPY_SERIALIZABLE(T)                                       \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct is_zero_copy_serializable<T> : std::true_type                   \
+        {                                                                      \
+            static_assert(std::is_trivially_copyable_v<T>,                     \
+                "zero-copy serializable types have to be trivially "           \
+                "copyable");                                                   \
+        };                                                                     \
+    }                                                                          \
+    /**/
@@ -57,6 +57,13 @@ namespace hpx::traits {
             return decompressed_size;
         }
 
+        // the data can't be referenced in place
+        static constexpr void const* data(Container const& /* cont */,
+            std::size_t /* current */) noexcept
+        {
+            return nullptr;
+        }
+
         static constexpr void reset(Container& /* cont */) noexcept {}
     };
 
@@ -155,6 +162,12 @@ namespace hpx::traits {
             return filter->init_data(
                 &cont[current], cont.size() - current, decompressed_size);
         }
+
+        [[nodiscard]] static void const* data(
+            Container const& cont, std::size_t current) noexcept
+        {
+            return &cont[current];
+        }
     };
 
     template <typename Container>
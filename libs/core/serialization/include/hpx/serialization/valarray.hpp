@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 
@@ -26,8 +27,8 @@ namespace hpx::serialization {
         if (sz == 0)
             return;
 
-        for (std::size_t i = 0; i < sz; ++i)
-            ar >> arr[i];
+        // zero-copy serializable elements are received as one block
+        ar >> hpx::serialization::make_array(&arr[0], arr.size());
     }
 
     template <typename T>
@@ -39,7 +40,6 @@ namespace hpx::serialization {
         if (sz == 0)
             return;
 
-        for (auto const& v : arr)
-            ar << v;
+        ar << hpx::serialization::make_array(&arr[0], arr.size());
     }
 }    // namespace hpx::serialization
@@ -16,6 +16,7 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_zero_copy_serializable.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -63,8 +64,7 @@ namespace hpx::serialization {
 
         constexpr bool use_optimized =
             std::is_default_constructible_v<element_type> &&
-            (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+            hpx::traits::is_zero_copy_serializable_v<element_type>;
 
         if constexpr (use_optimized)
         {
@@ -128,8 +128,7 @@ namespace hpx::serialization {
 
         constexpr bool use_optimized =
             std::is_default_constructible_v<element_type> &&
-            (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+            hpx::traits::is_zero_copy_serializable_v<element_type>;
 
         if constexpr (use_optimized)
         {
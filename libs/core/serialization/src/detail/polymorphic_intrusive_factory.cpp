@@ -43,4 +43,17 @@ namespace hpx::serialization::detail {
     {
         return map_.at(name)();
     }
+
+    void const* polymorphic_intrusive_factory::get_handle(
+        std::string const& name) const
+    {
+        auto const it = map_.find(name);
+        if (it == map_.end())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "polymorphic_intrusive_factory::get_handle",
+                "Unknown typename: {}", name);
+        }
+        return &*it;
+    }
 }    // namespace hpx::serialization::detail
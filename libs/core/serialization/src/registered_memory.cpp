@@ -0,0 +1,237 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/registered_memory.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    namespace {
+
+        // Blocks are allocated in sizes of powers of two (page aligned) to
+        // make them reusable for allocations of similar size.
+        constexpr std::size_t min_block_size = 4096;
+
+        constexpr std::size_t block_size(std::size_t size) noexcept
+        {
+            std::size_t result = min_block_size;
+            while (result < size)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+        struct registered_block
+        {
+            std::size_t size;
+            std::vector<std::pair<memory_registrar*, void*>> handles;
+        };
+
+        struct memory_registry
+        {
+            void register_block(char* address, registered_block& block) const
+            {
+                for (memory_registrar* registrar : registrars_)
+                {
+                    if (void* handle =
+                            registrar->register_memory(address, block.size))
+                    {
+                        block.handles.emplace_back(registrar, handle);
+                    }
+                }
+            }
+
+            static void unregister_block(registered_block& block) noexcept
+            {
+                for (auto const& [registrar, handle] : block.handles)
+                {
+                    registrar->unregister_memory(handle);
+                }
+                block.handles.clear();
+            }
+
+            std::mutex mtx_;
+            std::vector<memory_registrar*> registrars_;
+
+            // all blocks (used and cached), ordered by their address
+            std::map<char const*, registered_block> blocks_;
+
+            // the unused blocks, ordered by their size
+            std::multimap<std::size_t, char*> cached_;
+        };
+
+        // The registry is never destroyed, as registered memory may still be
+        // released during static destruction.
+        memory_registry& registry()
+        {
+            static memory_registry* registry = new memory_registry;
+            return *registry;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void add_memory_registrar(memory_registrar& registrar)
+    {
+        memory_registry& r = registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+        HPX_ASSERT(std::find(r.registrars_.begin(), r.registrars_.end(),
+                       &registrar) == r.registrars_.end());
+
+        r.registrars_.push_back(&registrar);
+        for (auto& [address, block] : r.blocks_)
+        {
+            if (void* handle = registrar.register_memory(
+                    const_cast<char*>(address), block.size))
+            {
+                block.handles.emplace_back(&registrar, handle);
+            }
+        }
+    }
+
+    void remove_memory_registrar(memory_registrar& registrar) noexcept
+    {
+        memory_registry& r = registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+        auto const it =
+            std::find(r.registrars_.begin(), r.registrars_.end(), &registrar);
+        if (it == r.registrars_.end())
+        {
+            return;
+        }
+
+        r.registrars_.erase(it);
+        for (auto& [address, block] : r.blocks_)
+        {
+            auto& handles = block.handles;
+            auto const h = std::find_if(handles.begin(), handles.end(),
+                [&](auto const& p) { return p.first == &registrar; });
+            if (h != handles.end())
+            {
+                registrar.unregister_memory(h->second);
+                handles.erase(h);
+            }
+        }
+    }
+
+    void* get_memory_registration(memory_registrar const& registrar,
+        void const* address, std::size_t size) noexcept
+    {
+        memory_registry& r = registry();
+        auto const* p = static_cast<char const*>(address);
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+
+        // find the block starting at or before the given address
+        auto it = r.blocks_.upper_bound(p);
+        if (it == r.blocks_.begin())
+        {
+            return nullptr;
+        }
+
+        --it;
+        if (p + size > it->first + it->second.size)
+        {
+            return nullptr;
+        }
+
+        for (auto const& [entry, handle] : it->second.handles)
+        {
+            if (entry == &registrar)
+            {
+                return handle;
+            }
+        }
+        return nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate_registered_memory(std::size_t size)
+    {
+        memory_registry& r = registry();
+        std::size_t const bytes = block_size(size);
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+
+        // reuse a cached block of the same size, if possible
+        if (auto const it = r.cached_.find(bytes); it != r.cached_.end())
+        {
+            char* address = it->second;
+            r.cached_.erase(it);
+            return address;
+        }
+
+        auto* address = static_cast<char*>(
+            ::operator new(bytes, std::align_val_t(min_block_size)));
+
+        registered_block& block =
+            r.blocks_.emplace(address, registered_block{bytes, {}})
+                .first->second;
+        try
+        {
+            r.register_block(address, block);
+        }
+        catch (...)
+        {
+            memory_registry::unregister_block(block);
+            r.blocks_.erase(address);
+            ::operator delete(address, std::align_val_t(min_block_size));
+            throw;
+        }
+        return address;
+    }
+
+    void deallocate_registered_memory(void* p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        memory_registry& r = registry();
+        auto* address = static_cast<char*>(p);
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+
+        auto const it = r.blocks_.find(address);
+        if (it == r.blocks_.end())
+        {
+            HPX_ASSERT(false);
+            return;
+        }
+
+        // keep the block (and its registrations) for later reuse
+        r.cached_.emplace(it->second.size, address);
+    }
+
+    void release_unused_registered_memory() noexcept
+    {
+        memory_registry& r = registry();
+
+        std::lock_guard<std::mutex> l(r.mtx_);
+        for (auto const& [size, address] : r.cached_)
+        {
+            auto const it = r.blocks_.find(address);
+            HPX_ASSERT(it != r.blocks_.end());
+
+            memory_registry::unregister_block(it->second);
+            r.blocks_.erase(it);
+            ::operator delete(address, std::align_val_t(min_block_size));
+        }
+        r.cached_.clear();
+    }
+}    // namespace hpx::serialization
@@ -0,0 +1,452 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time, the throughput, and the number of memory
+// allocations needed for serializing and de-serializing a set of
+// representative types using the various archive modes. The results are
+// printed as JSON (see hpx::util::perftests_print_times) to allow tracking
+// them over time.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/variant.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// count all allocations made by the measured operations (the replacements are
+// not inlined to avoid false positives of -Wmismatched-new-delete)
+std::atomic<std::uint64_t> allocations(0);
+
+HPX_NOINLINE void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size != 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+HPX_NOINLINE void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+HPX_NOINLINE void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the default options, set from the command line
+std::size_t test_count = 100;
+std::size_t batch_size = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+// bitwise serializable aggregate
+struct particle
+{
+    double x, y, z;
+    float mass;
+    std::int32_t id;
+};
+
+struct shape
+{
+    explicit shape(double scale = 1.0)
+      : scale(scale)
+    {
+    }
+    virtual ~shape() = default;
+
+    double scale;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & scale;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(shape);
+};
+
+struct circle : shape
+{
+    explicit circle(double radius = 0.0)
+      : radius(radius)
+    {
+    }
+
+    double radius;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<shape>(*this) & radius;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(circle, override);
+};
+
+struct polygon : shape
+{
+    polygon() = default;
+    explicit polygon(std::size_t n)
+      : corners(n)
+    {
+    }
+
+    std::vector<std::pair<double, double>> corners;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<shape>(*this) & corners;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(polygon, override);
+};
+
+using inner_variant = std::variant<double, std::string>;
+using nested_variant =
+    std::variant<std::int64_t, std::string, std::vector<inner_variant>>;
+
+///////////////////////////////////////////////////////////////////////////////
+// archive streams collecting the data in (and reading it from) a vector
+struct vector_output_stream : hpx::serialization::output_stream
+{
+    explicit vector_output_stream(std::vector<char>& data) noexcept
+      : data_(data)
+    {
+    }
+
+    void write(void const* data, std::size_t size) override
+    {
+        auto const* p = static_cast<char const*>(data);
+        data_.insert(data_.end(), p, p + size);
+    }
+
+    void flush() override {}
+
+    std::vector<char>& data_;
+};
+
+struct vector_input_stream : hpx::serialization::input_stream
+{
+    explicit vector_input_stream(std::vector<char> const& data) noexcept
+      : data_(data)
+      , current_(0)
+    {
+    }
+
+    void read(void* data, std::size_t size) override
+    {
+        if (current_ + size > data_.size())
+        {
+            throw std::runtime_error("archive data bstream is too short");
+        }
+        std::memcpy(data, &data_[current_], size);
+        current_ += size;
+    }
+
+    std::vector<char> const& data_;
+    std::size_t current_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct archive_mode
+{
+    char const* name;
+    std::uint32_t flags;
+    bool zero_copy;
+    bool streaming;
+};
+
+using hpx::serialization::archive_flags;
+
+// clang-format off
+archive_mode const modes[] = {
+    {"default", 0, true, false},
+    {"no_zero_copy",
+        static_cast<std::uint32_t>(archive_flags::disable_data_chunking),
+        false, false},
+    {"no_array_optimization",
+        static_cast<std::uint32_t>(archive_flags::disable_array_optimization),
+        true, false},
+    {"trusted_peer",
+        static_cast<std::uint32_t>(archive_flags::trusted_peer), true, false},
+    {"streaming", 0, true, true},
+};
+// clang-format on
+
+constexpr std::size_t streaming_chunk_size = 65536;
+
+// The buffers are reused from one operation to the next (as the parcel layer
+// does), the counted allocations are made by the archives and the
+// de-serialized objects only.
+struct archive_buffers
+{
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+};
+
+template <typename T>
+std::size_t save(archive_mode const& mode, archive_buffers& buffers, T& value)
+{
+    buffers.data.clear();
+    buffers.chunks.clear();
+
+    if (mode.streaming)
+    {
+        vector_output_stream stream(buffers.data);
+        hpx::serialization::output_archive archive(
+            stream, streaming_chunk_size, mode.flags);
+        archive << value;
+        archive.flush();
+        return archive.bytes_written();
+    }
+
+    hpx::serialization::output_archive archive(
+        buffers.data, mode.flags, mode.zero_copy ? &buffers.chunks : nullptr);
+    archive << value;
+    archive.flush();
+
+    // add the data which was not copied into the buffer
+    std::size_t size = archive.bytes_written();
+    for (auto const& chunk : buffers.chunks)
+    {
+        if (chunk.type_ ==
+            hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            size += chunk.size();
+        }
+    }
+    return size;
+}
+
+template <typename T>
+void load(archive_mode const& mode, archive_buffers& buffers, T& value)
+{
+    if (mode.streaming)
+    {
+        vector_input_stream stream(buffers.data);
+        hpx::serialization::input_archive archive(stream);
+        archive >> value;
+        return;
+    }
+
+    hpx::serialization::input_archive archive(buffers.data,
+        buffers.data.size(), mode.zero_copy ? &buffers.chunks : nullptr);
+    archive >> value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Record the time per operation, the throughput in MB/s, and the number of
+// allocations per operation for each of the batches.
+template <typename F>
+void report(std::string const& name, std::string const& mode,
+    std::size_t bytes, F&& f)
+{
+    // first batch to cache the data
+    for (std::size_t j = 0; j != batch_size; ++j)
+    {
+        f();
+    }
+
+    auto const batch = static_cast<double>(batch_size);
+    for (std::size_t i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start_allocations = allocations.load();
+        hpx::chrono::high_resolution_timer const timer;
+
+        for (std::size_t j = 0; j != batch_size; ++j)
+        {
+            f();
+        }
+
+        double const elapsed = timer.elapsed() / batch;
+        double const allocated =
+            static_cast<double>(allocations.load() - start_allocations) /
+            batch;
+
+        hpx::util::perftests_report_value(name, mode, elapsed);
+        hpx::util::perftests_report_value(name + " (MB/s)", mode,
+            elapsed != 0.0 ? static_cast<double>(bytes) / elapsed * 1e-6 :
+                             0.0);
+        hpx::util::perftests_report_value(
+            name + " (allocations)", mode, allocated);
+    }
+}
+
+template <typename T>
+void measure(std::string const& name, T& value)
+{
+    for (archive_mode const& mode : modes)
+    {
+        archive_buffers buffers;
+        std::size_t const bytes = save(mode, buffers, value);
+
+        report(name + ", serialize", mode.name, bytes,
+            [&]() { save(mode, buffers, value); });
+
+        report(name + ", deserialize", mode.name, bytes, [&]() {
+            T result;
+            load(mode, buffers, result);
+        });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["size"].as<std::size_t>();
+    test_count = vm["test_count"].as<std::size_t>();
+    batch_size = vm["batch_size"].as<std::size_t>();
+
+    if (test_count == 0 || batch_size == 0)
+    {
+        std::cerr << "test_count and batch_size must be positive...\n"
+                  << std::flush;
+        return hpx::local::finalize();
+    }
+
+    {
+        particle p{1.0, 2.0, 3.0, 4.0f, 5};
+        measure("particle", p);
+    }
+
+    {
+        std::vector<particle> v(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            auto const d = static_cast<double>(i);
+            v[i] = particle{d, d + 1, d + 2, 1.0f, static_cast<int>(i)};
+        }
+        measure("vector<particle>", v);
+    }
+
+    {
+        std::vector<double> v(size, 3.1415);
+        measure("vector<double>", v);
+    }
+
+    {
+        std::vector<std::string> v(size, std::string(32, 'x'));
+        measure("vector<string>", v);
+    }
+
+    {
+        std::map<std::int32_t, std::string> m;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            m.emplace(static_cast<std::int32_t>(i), std::to_string(i));
+        }
+        measure("map<int32_t, string>", m);
+    }
+
+    {
+        std::vector<std::shared_ptr<shape>> v;
+        v.reserve(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            if (i % 2 == 0)
+                v.push_back(std::make_shared<circle>(1.0));
+            else
+                v.push_back(std::make_shared<polygon>(4));
+        }
+        measure("vector<shared_ptr<shape>>", v);
+    }
+
+    {
+        std::vector<nested_variant> v;
+        v.reserve(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            switch (i % 3)
+            {
+            case 0:
+                v.emplace_back(static_cast<std::int64_t>(i));
+                break;
+            case 1:
+                v.emplace_back(std::to_string(i));
+                break;
+            default:
+                v.emplace_back(std::vector<inner_variant>{
+                    inner_variant(1.0), inner_variant("1")});
+                break;
+            }
+        }
+        measure("vector<nested_variant>", v);
+    }
+
+    {
+        using buffer_type = hpx::serialization::serialize_buffer<double>;
+        buffer_type b(size);
+        std::fill(b.data(), b.data() + size, 2.71828);
+        measure("serialize_buffer<double>", b);
+    }
+
+    {
+        hpx::future<std::vector<double>> f =
+            hpx::make_ready_future(std::vector<double>(size, 1.4142));
+        measure("future<vector<double>>", f);
+    }
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("size", value<std::size_t>()->default_value(1000),
+            "number of elements of the containers")
+        ("test_count", value<std::size_t>()->default_value(100),
+            "number of batches to be averaged")
+        ("batch_size", value<std::size_t>()->default_value(10),
+            "number of operations to time together")
+        ;
+    // clang-format on
+
+    // avoid counting allocations made by other worker threads
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = {"hpx.os_threads=1"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,247 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the name of a polymorphic type is stored only the
+// first time the type occurs in an archive, and that the types are restored
+// correctly if several polymorphic types are interleaved.
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ====================== intrusive polymorphic types ========================
+struct base
+{
+    explicit base(int value = 0)
+      : value(value)
+    {
+    }
+    virtual ~base() = default;
+
+    virtual int kind() const
+    {
+        return 0;
+    }
+
+    int value;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value;
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(base);
+};
+
+struct derived_with_a_rather_long_name_1 : base
+{
+    explicit derived_with_a_rather_long_name_1(int value = 0)
+      : base(value)
+    {
+    }
+
+    int kind() const override
+    {
+        return 1;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<base>(*this);
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(derived_with_a_rather_long_name_1, override);
+};
+
+struct derived_with_a_rather_long_name_2 : base
+{
+    explicit derived_with_a_rather_long_name_2(int value = 0)
+      : base(value)
+    {
+    }
+
+    int kind() const override
+    {
+        return 2;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & hpx::serialization::base_object<base>(*this);
+        // clang-format on
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(derived_with_a_rather_long_name_2, override);
+};
+
+// ==================== non-intrusive polymorphic types ======================
+struct shape
+{
+    explicit shape(int value = 0)
+      : value(value)
+    {
+    }
+    virtual ~shape() = default;
+
+    virtual int kind() const = 0;
+
+    int value;
+};
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(shape)
+
+template <typename Archive>
+void serialize(Archive& ar, shape& s, unsigned)
+{
+    // clang-format off
+    ar & s.value;
+    // clang-format on
+}
+
+struct circle_with_a_rather_long_name : shape
+{
+    explicit circle_with_a_rather_long_name(int value = 0)
+      : shape(value)
+    {
+    }
+
+    int kind() const override
+    {
+        return 3;
+    }
+};
+
+template <typename Archive>
+void serialize(Archive& ar, circle_with_a_rather_long_name& c, unsigned)
+{
+    // clang-format off
+    ar & hpx::serialization::base_object<shape>(c);
+    // clang-format on
+}
+HPX_SERIALIZATION_REGISTER_CLASS(circle_with_a_rather_long_name)
+
+struct square_with_a_rather_long_name : shape
+{
+    explicit square_with_a_rather_long_name(int value = 0)
+      : shape(value)
+    {
+    }
+
+    int kind() const override
+    {
+        return 4;
+    }
+};
+
+template <typename Archive>
+void serialize(Archive& ar, square_with_a_rather_long_name& s, unsigned)
+{
+    // clang-format off
+    ar & hpx::serialization::base_object<shape>(s);
+    // clang-format on
+}
+HPX_SERIALIZATION_REGISTER_CLASS(square_with_a_rather_long_name)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t serialized_size(T const& t)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << t;
+    return buffer.size();
+}
+
+template <typename Base, typename Derived1, typename Derived2>
+void test_type_table(std::string const& name)
+{
+    std::size_t const count = 100;
+
+    using vector_type = std::vector<std::shared_ptr<Base>>;
+
+    vector_type os;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        if (i % 3 == 0)
+            os.push_back(std::make_shared<Derived1>(static_cast<int>(i)));
+        else
+            os.push_back(std::make_shared<Derived2>(static_cast<int>(i)));
+    }
+
+    // the type name is stored for the first object of a type only
+    std::size_t const size_single = serialized_size(vector_type{os[0]});
+    std::size_t const size_same =
+        serialized_size(vector_type{os[0], os[3]});
+    std::size_t const size_other =
+        serialized_size(vector_type{os[0], os[1]});
+    HPX_TEST_LTE(size_same - size_single + name.size(),
+        size_other - size_single);
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << os << os[1] << os[0];
+    }
+
+    vector_type is;
+    std::shared_ptr<Base> is1, is0;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> is >> is1 >> is0;
+    }
+
+    HPX_TEST_EQ(is.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(is[i]->kind(), os[i]->kind());
+        HPX_TEST_EQ(is[i]->value, os[i]->value);
+    }
+    HPX_TEST_EQ(is1->kind(), os[1]->kind());
+    HPX_TEST_EQ(is0->kind(), os[0]->kind());
+
+    // the table is local to each archive
+    for (int i = 0; i != 2; ++i)
+    {
+        std::vector<char> buffer2;
+        {
+            hpx::serialization::output_archive oarchive(buffer2);
+            oarchive << os[1];
+        }
+
+        std::shared_ptr<Base> p;
+        {
+            hpx::serialization::input_archive iarchive(buffer2);
+            iarchive >> p;
+        }
+        HPX_TEST_EQ(p->kind(), os[1]->kind());
+        HPX_TEST_EQ(p->value, os[1]->value);
+    }
+}
+
+int main()
+{
+    test_type_table<base, derived_with_a_rather_long_name_1,
+        derived_with_a_rather_long_name_2>(
+        "derived_with_a_rather_long_name_1");
+    test_type_table<shape, circle_with_a_rather_long_name,
+        square_with_a_rather_long_name>("circle_with_a_rather_long_name");
+
+    return hpx::util::report_errors();
+}
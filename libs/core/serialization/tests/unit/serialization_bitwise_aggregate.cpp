@@ -0,0 +1,159 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct particle
+{
+    double x, y, z;
+    float mass;
+    std::int32_t id;
+};
+
+bool operator==(particle const& lhs, particle const& rhs)
+{
+    return std::tie(lhs.x, lhs.y, lhs.z, lhs.mass, lhs.id) ==
+        std::tie(rhs.x, rhs.y, rhs.z, rhs.mass, rhs.id);
+}
+
+enum class kind : std::int32_t
+{
+    fluid,
+    solid
+};
+
+struct cell
+{
+    std::array<double, 3> center;
+    particle p;
+    kind k;
+    std::int32_t neighbors;
+};
+
+bool operator==(cell const& lhs, cell const& rhs)
+{
+    return std::tie(lhs.center, lhs.p, lhs.k, lhs.neighbors) ==
+        std::tie(rhs.center, rhs.p, rhs.k, rhs.neighbors);
+}
+
+// the padding between the members prevents bitwise serialization
+struct padded
+{
+    char c;
+    double d;
+};
+
+bool operator==(padded const& lhs, padded const& rhs)
+{
+    return lhs.c == rhs.c && lhs.d == rhs.d;
+}
+
+struct with_string
+{
+    std::string s;
+    double d;
+};
+
+struct with_serialize
+{
+    double d;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & d;
+        // clang-format on
+    }
+};
+
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+static_assert(hpx::traits::is_bitwise_serializable_v<particle>);
+static_assert(hpx::traits::is_bitwise_serializable_v<cell>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<padded>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<with_string>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<with_serialize>);
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_roundtrip(T const& os)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << os;
+
+    hpx::serialization::input_archive iarchive(buffer);
+    T is;
+    iarchive >> is;
+    HPX_TEST(os == is);
+}
+
+void test_vector_is_one_chunk()
+{
+    std::size_t const num_elements =
+        HPX_ZERO_COPY_SERIALIZATION_THRESHOLD / sizeof(particle) + 1;
+
+    std::vector<particle> os;
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        os.push_back(particle{d, d + 1, d + 2, static_cast<float>(d),
+            static_cast<std::int32_t>(i)});
+    }
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+    oarchive << os;
+
+#if defined(HPX_SERIALIZATION_HAVE_BITWISE_AGGREGATES)
+    std::size_t pointer_chunks = 0;
+    for (auto const& chunk : chunks)
+    {
+        if (chunk.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST(chunk.data_.cpos_ == os.data());
+            HPX_TEST_EQ(chunk.size_, num_elements * sizeof(particle));
+            ++pointer_chunks;
+        }
+    }
+    HPX_TEST_EQ(pointer_chunks, std::size_t(1));
+#endif
+
+    hpx::serialization::input_archive iarchive(
+        buffer, oarchive.bytes_written(), &chunks);
+    std::vector<particle> is;
+    iarchive >> is;
+    HPX_TEST(os == is);
+}
+
+int main()
+{
+    test_roundtrip(particle{1.0, 2.0, 3.0, 4.0f, 5});
+    test_roundtrip(cell{
+        {1.0, 2.0, 3.0}, particle{4.0, 5.0, 6.0, 7.0f, 8}, kind::solid, 9});
+    test_roundtrip(padded{'a', 42.0});
+    test_roundtrip(std::vector<cell>(100,
+        cell{{1.0, 2.0, 3.0}, particle{4.0, 5.0, 6.0, 7.0f, 8}, kind::fluid,
+            9}));
+    test_roundtrip(std::vector<padded>(100, padded{'b', 43.0}));
+
+    test_vector_is_one_chunk();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,174 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that buffer_views reference the data of archives with
+// a known buffer owner in place and copy it otherwise.
+
+#include <hpx/serialization/buffer_view.hpp>
+#include <hpx/serialization/detail/input_buffer_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using hpx::serialization::buffer_view;
+using hpx::serialization::string_buffer_view;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool references(std::vector<char> const& buffer, buffer_view<T> const& v)
+{
+    auto const* p = reinterpret_cast<char const*>(v.data());
+    return p >= buffer.data() && p + v.size() * sizeof(T) <= buffer.data() +
+        buffer.size();
+}
+
+void test_string_view()
+{
+    std::string const key1 = "first key";
+    std::string const key2(1000, 'x');
+
+    auto buffer = std::make_shared<std::vector<char>>();
+    {
+        hpx::serialization::output_archive oarchive(*buffer);
+        oarchive << string_buffer_view(std::string_view(key1))
+                 << string_buffer_view(std::string_view(key2))
+                 << string_buffer_view() << key1;
+    }
+
+    // views are compatible with std::string
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        std::string s1, s2, s3;
+        string_buffer_view v;
+        iarchive >> s1 >> s2 >> s3 >> v;
+        HPX_TEST_EQ(s1, key1);
+        HPX_TEST_EQ(s2, key2);
+        HPX_TEST(s3.empty());
+        HPX_TEST_EQ(std::string_view(v), std::string_view(key1));
+    }
+
+    // without an owner, the data is copied
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        string_buffer_view v1, v2, v3, v4;
+        iarchive >> v1 >> v2 >> v3 >> v4;
+
+        HPX_TEST_EQ(std::string_view(v1), std::string_view(key1));
+        HPX_TEST_EQ(std::string_view(v2), std::string_view(key2));
+        HPX_TEST(v3.empty());
+        HPX_TEST_EQ(std::string_view(v4), std::string_view(key1));
+
+        HPX_TEST(v1.owns_data() && !references(*buffer, v1));
+        HPX_TEST(v2.owns_data() && !references(*buffer, v2));
+    }
+
+    // with an owner, the data is referenced in place
+    string_buffer_view v1, v2, v3, v4;
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        iarchive
+            .get_extra_data<hpx::serialization::detail::input_buffer_owner>()
+            .owner = buffer;
+        iarchive >> v1 >> v2 >> v3 >> v4;
+    }
+
+    HPX_TEST_EQ(std::string_view(v1), std::string_view(key1));
+    HPX_TEST_EQ(std::string_view(v2), std::string_view(key2));
+    HPX_TEST(v3.empty());
+    HPX_TEST_EQ(std::string_view(v4), std::string_view(key1));
+
+    HPX_TEST(v1.owns_data() && references(*buffer, v1));
+    HPX_TEST(v2.owns_data() && references(*buffer, v2));
+    HPX_TEST(v4.owns_data() && references(*buffer, v4));
+
+    // the views keep the buffer alive
+    std::weak_ptr<std::vector<char>> const weak = buffer;
+    buffer.reset();
+    HPX_TEST(!weak.expired());
+
+    v1.reset();
+    v2.reset();
+    v4.reset();
+    HPX_TEST(weak.expired());
+}
+
+void test_vector_view()
+{
+    std::vector<std::uint32_t> values(100);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto buffer = std::make_shared<std::vector<char>>();
+    {
+        hpx::serialization::output_archive oarchive(*buffer);
+
+        // the second view is not aligned in the archive
+        oarchive << buffer_view<std::uint32_t>(values.data(), values.size())
+                 << char('x')
+                 << buffer_view<std::uint32_t>(values.data(), values.size());
+    }
+
+    buffer_view<std::uint32_t> v1, v2;
+    char c = 0;
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        iarchive
+            .get_extra_data<hpx::serialization::detail::input_buffer_owner>()
+            .owner = buffer;
+        iarchive >> v1 >> c >> v2;
+    }
+
+    HPX_TEST_EQ(c, 'x');
+    HPX_TEST_EQ(v1.size(), values.size());
+    HPX_TEST_EQ(v2.size(), values.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(v1[i], values[i]);
+        HPX_TEST_EQ(v2[i], values[i]);
+    }
+}
+
+void test_ownership()
+{
+    std::string s(100, 'y');
+    char const* data = s.data();
+
+    string_buffer_view v(std::move(s));
+    HPX_TEST(v.owns_data());
+    HPX_TEST(v.data() == data);
+    HPX_TEST_EQ(v.size(), std::size_t(100));
+
+    string_buffer_view const copy = v;
+    v.reset();
+    HPX_TEST(v.empty());
+    HPX_TEST_EQ(
+        std::string_view(copy), std::string_view(std::string(100, 'y')));
+
+    std::vector<char> vec = {'a', 'b', 'c'};
+    string_buffer_view const from_vector(std::move(vec));
+    HPX_TEST_EQ(std::string_view(from_vector), std::string_view("abc"));
+}
+
+int main()
+{
+    test_string_view();
+    test_vector_view();
+    test_ownership();
+
+    return hpx::util::report_errors();
+}
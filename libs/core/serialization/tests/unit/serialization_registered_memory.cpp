@@ -0,0 +1,174 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that registered memory is registered once with each of
+// the known registrars, that the registrations can be found for the memory
+// referenced by zero-copy chunks, and that freed memory is reused without
+// registering it again.
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/registered_memory.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using hpx::serialization::get_memory_registration;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_registrar : hpx::serialization::memory_registrar
+{
+    void* register_memory(void* address, std::size_t size) override
+    {
+        HPX_TEST(address != nullptr);
+        HPX_TEST_NEQ(size, static_cast<std::size_t>(0));
+
+        ++registered_;
+        auto* handle = new std::size_t(size);
+        handles_[handle] = address;
+        return handle;
+    }
+
+    void unregister_memory(void* handle) noexcept override
+    {
+        ++unregistered_;
+        HPX_TEST_EQ(handles_.erase(handle), static_cast<std::size_t>(1));
+        delete static_cast<std::size_t*>(handle);
+    }
+
+    std::size_t registered_ = 0;
+    std::size_t unregistered_ = 0;
+    std::map<void*, void*> handles_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_registration()
+{
+    test_registrar registrar;
+
+    // memory allocated before the registrar is known gets registered, too
+    void* p1 = hpx::serialization::allocate_registered_memory(100);
+    HPX_TEST(get_memory_registration(registrar, p1, 100) == nullptr);
+
+    hpx::serialization::add_memory_registrar(registrar);
+    HPX_TEST_EQ(registrar.registered_, static_cast<std::size_t>(1));
+
+    void* h1 = get_memory_registration(registrar, p1, 100);
+    HPX_TEST(h1 != nullptr);
+
+    // any part of the block is covered by the registration
+    HPX_TEST(get_memory_registration(
+                 registrar, static_cast<char*>(p1) + 10, 50) == h1);
+
+    void* p2 = hpx::serialization::allocate_registered_memory(10000);
+    HPX_TEST_EQ(registrar.registered_, static_cast<std::size_t>(2));
+    HPX_TEST(get_memory_registration(registrar, p2, 10000) != nullptr);
+    HPX_TEST(get_memory_registration(registrar, p2, 10000) != h1);
+
+    // other memory is not registered
+    std::vector<char> v(100);
+    HPX_TEST(get_memory_registration(registrar, v.data(), v.size()) == nullptr);
+
+    // freed memory is reused without being registered again
+    hpx::serialization::deallocate_registered_memory(p1);
+    void* p3 = hpx::serialization::allocate_registered_memory(200);
+    HPX_TEST_EQ(p3, p1);
+    HPX_TEST_EQ(registrar.registered_, static_cast<std::size_t>(2));
+    HPX_TEST(get_memory_registration(registrar, p3, 200) == h1);
+
+    hpx::serialization::deallocate_registered_memory(p2);
+    hpx::serialization::deallocate_registered_memory(p3);
+
+    hpx::serialization::remove_memory_registrar(registrar);
+    HPX_TEST_EQ(registrar.unregistered_, registrar.registered_);
+    HPX_TEST(registrar.handles_.empty());
+
+    hpx::serialization::release_unused_registered_memory();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_serialize_buffer()
+{
+    using buffer_type =
+        hpx::serialization::registered_serialize_buffer<double>;
+
+    test_registrar registrar;
+    hpx::serialization::add_memory_registrar(registrar);
+
+    {
+        std::size_t const size = 100000;
+        buffer_type os(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            os[i] = static_cast<double>(i);
+        }
+
+        std::vector<char> buffer;
+        std::vector<hpx::serialization::serialization_chunk> chunks;
+        {
+            hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+            oarchive << os;
+        }
+
+        // the zero-copy chunk refers to registered memory
+        std::size_t zero_copy_chunks = 0;
+        for (auto const& chunk : chunks)
+        {
+            if (chunk.type_ ==
+                hpx::serialization::chunk_type::chunk_type_pointer)
+            {
+                ++zero_copy_chunks;
+                HPX_TEST(get_memory_registration(registrar, chunk.data_.cpos_,
+                             chunk.size_) != nullptr);
+            }
+        }
+        HPX_TEST_EQ(zero_copy_chunks, static_cast<std::size_t>(1));
+
+        // received data is placed into registered memory as well
+        buffer_type is;
+        {
+            hpx::serialization::input_archive iarchive(
+                buffer, buffer.size(), &chunks);
+            iarchive >> is;
+        }
+
+        HPX_TEST_EQ(is.size(), size);
+        HPX_TEST(get_memory_registration(registrar, is.data(),
+                     is.size() * sizeof(double)) != nullptr);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            HPX_TEST_EQ(is[i], os[i]);
+        }
+    }
+
+    {
+        std::vector<std::int32_t,
+            hpx::serialization::registered_allocator<std::int32_t>>
+            v(1000, 42);
+        HPX_TEST(get_memory_registration(registrar, v.data(),
+                     v.size() * sizeof(std::int32_t)) != nullptr);
+    }
+
+    hpx::serialization::remove_memory_registrar(registrar);
+    HPX_TEST_EQ(registrar.unregistered_, registrar.registered_);
+
+    hpx::serialization::release_unused_registered_memory();
+}
+
+int main()
+{
+    test_registration();
+    test_serialize_buffer();
+
+    return hpx::util::report_errors();
+}
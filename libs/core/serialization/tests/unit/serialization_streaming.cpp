@@ -0,0 +1,203 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that streaming archives hand out the serialized data in
+// pieces of bounded size, pass large blocks of memory on without copying
+// them, and that the data can be de-serialized incrementally.
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t chunk_size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_output_stream : hpx::serialization::output_stream
+{
+    void write(void const* data, std::size_t size) override
+    {
+        HPX_TEST_NEQ(size, static_cast<std::size_t>(0));
+        HPX_TEST_LTE(size, chunk_size);
+
+        // the previous piece must still be valid at this point
+        if (previous_ != nullptr)
+        {
+            HPX_TEST(std::memcmp(previous_, &data_[data_.size() -
+                previous_size_], previous_size_) == 0);
+        }
+
+        auto const* p = static_cast<char const*>(data);
+        data_.insert(data_.end(), p, p + size);
+        pieces_.push_back(p);
+
+        previous_ = p;
+        previous_size_ = size;
+    }
+
+    void flush() override
+    {
+        ++flushed_;
+        previous_ = nullptr;
+    }
+
+    std::vector<char> data_;
+    std::vector<char const*> pieces_;
+    char const* previous_ = nullptr;
+    std::size_t previous_size_ = 0;
+    int flushed_ = 0;
+};
+
+struct test_input_stream : hpx::serialization::input_stream
+{
+    explicit test_input_stream(std::vector<char> const& data)
+      : data_(data)
+    {
+    }
+
+    void read(void* data, std::size_t size) override
+    {
+        HPX_TEST_LTE(current_ + size, data_.size());
+        std::memcpy(data, &data_[current_], size);
+        current_ += size;
+        max_read_ = (std::max)(max_read_, size);
+    }
+
+    std::vector<char> const& data_;
+    std::size_t current_ = 0;
+    std::size_t max_read_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_small_values()
+{
+    std::vector<std::string> os;
+    for (int i = 0; i != 1000; ++i)
+    {
+        os.push_back(std::string(static_cast<std::size_t>(i % 37), 'a') +
+            std::to_string(i));
+    }
+
+    test_output_stream out;
+    {
+        hpx::serialization::output_archive oarchive(out, chunk_size);
+        oarchive << os;
+        oarchive.flush();
+
+        HPX_TEST_EQ(oarchive.bytes_written(), out.data_.size());
+    }
+    HPX_TEST_EQ(out.flushed_, 1);
+
+    // the data was handed out while it was being serialized
+    HPX_TEST_LT(chunk_size, out.data_.size());
+    HPX_TEST_LTE(out.pieces_.size(), out.data_.size() / chunk_size + 1);
+
+    test_input_stream in(out.data_);
+    std::vector<std::string> is;
+    {
+        hpx::serialization::input_archive iarchive(in);
+        iarchive >> is;
+    }
+
+    HPX_TEST_EQ(in.current_, out.data_.size());
+    HPX_TEST(os == is);
+}
+
+void test_large_block()
+{
+    std::size_t const size = 64 * chunk_size + 17;
+
+    std::vector<double> os(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        os[i] = static_cast<double>(i) * 0.5;
+    }
+
+    test_output_stream out;
+    {
+        hpx::serialization::output_archive oarchive(
+            out, chunk_size, 0, chunk_size);
+        oarchive << os;
+        oarchive.flush();
+    }
+
+    // the vector was passed on in pieces without copying it
+    auto const* begin = reinterpret_cast<char const*>(os.data());
+    auto const* end = begin + size * sizeof(double);
+    std::size_t zero_copy_pieces = 0;
+    for (char const* p : out.pieces_)
+    {
+        if (p >= begin && p < end)
+            ++zero_copy_pieces;
+    }
+    HPX_TEST_EQ(zero_copy_pieces,
+        (size * sizeof(double) + chunk_size - 1) / chunk_size);
+
+    // large blocks are read directly into their destination
+    test_input_stream in(out.data_);
+    std::vector<double> is;
+    {
+        hpx::serialization::input_archive iarchive(in);
+        iarchive >> is;
+    }
+
+    HPX_TEST_EQ(in.max_read_, size * sizeof(double));
+    HPX_TEST(os == is);
+}
+
+void test_serialize_buffer()
+{
+    using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+    std::size_t const size = 10 * chunk_size + 3;
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<char>(i % 127);
+    }
+
+    buffer_type os(data.data(), size, buffer_type::reference);
+    std::string const tail("tail");
+
+    test_output_stream out;
+    {
+        hpx::serialization::output_archive oarchive(
+            out, chunk_size, 0, chunk_size);
+        oarchive << os << tail;
+        oarchive.flush();
+    }
+
+    test_input_stream in(out.data_);
+    buffer_type is;
+    std::string is_tail;
+    {
+        hpx::serialization::input_archive iarchive(in);
+        iarchive >> is >> is_tail;
+    }
+
+    HPX_TEST_EQ(is.size(), size);
+    HPX_TEST(std::equal(is.data(), is.data() + is.size(), data.data()));
+    HPX_TEST_EQ(is_tail, tail);
+}
+
+int main()
+{
+    test_small_values();
+    test_large_block();
+    test_serialize_buffer();
+
+    return hpx::util::report_errors();
+}
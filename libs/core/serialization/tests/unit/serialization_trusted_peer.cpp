@@ -0,0 +1,172 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that archives created for trusted peers are smaller than
+// the portable archives and that the input archive detects which of the two
+// formats it was handed.
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+using hpx::serialization::archive_flags;
+
+///////////////////////////////////////////////////////////////////////////////
+enum class color : std::uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+struct record
+{
+    std::int8_t i8 = 0;
+    std::uint16_t u16 = 0;
+    std::int32_t i32 = 0;
+    std::uint64_t u64 = 0;
+    color c = color::red;
+    bool b = false;
+    double d = 0.0;
+    std::string name;
+    std::map<std::int32_t, std::string> attributes;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & i8 & u16 & i32 & u64 & c & b & d & name & attributes;
+        // clang-format on
+    }
+
+    friend bool operator==(record const& lhs, record const& rhs)
+    {
+        return lhs.i8 == rhs.i8 && lhs.u16 == rhs.u16 && lhs.i32 == rhs.i32 &&
+            lhs.u64 == rhs.u64 && lhs.c == rhs.c && lhs.b == rhs.b &&
+            lhs.d == rhs.d && lhs.name == rhs.name &&
+            lhs.attributes == rhs.attributes;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t round_trip(T const& os, T& is, std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << os;
+        size = oarchive.bytes_written();
+
+        HPX_TEST_EQ(oarchive.trusted_peer(),
+            static_cast<bool>(flags & archive_flags::trusted_peer));
+    }
+
+    // the input archive has no knowledge of the format used by the sender
+    hpx::serialization::input_archive iarchive(buffer, buffer.size());
+    HPX_TEST_EQ(iarchive.trusted_peer(),
+        static_cast<bool>(flags & archive_flags::trusted_peer));
+    iarchive >> is;
+
+    return size;
+}
+
+void test_header()
+{
+    std::uint32_t const trusted =
+        static_cast<std::uint32_t>(archive_flags::trusted_peer);
+
+    std::vector<char> portable_buffer;
+    std::vector<char> trusted_buffer;
+    std::uint32_t flags = 0;
+    {
+        hpx::serialization::output_archive portable(portable_buffer);
+        hpx::serialization::output_archive compact(trusted_buffer, trusted);
+        HPX_TEST_LT(compact.bytes_written(), portable.bytes_written());
+        flags = compact.flags();
+    }
+
+    // the flags used by the sender are restored by the receiver
+    hpx::serialization::input_archive iarchive(
+        trusted_buffer, trusted_buffer.size());
+    HPX_TEST(iarchive.trusted_peer());
+    HPX_TEST_EQ(iarchive.flags(), flags);
+}
+
+void test_integrals()
+{
+    std::vector<std::int16_t> values;
+    for (std::int16_t i = -1000; i != 1000; i += 7)
+    {
+        values.push_back(i);
+    }
+
+    for (std::uint32_t flags :
+        {std::uint32_t(0), std::uint32_t(archive_flags::trusted_peer)})
+    {
+        std::vector<std::int16_t> os = values;
+        std::vector<std::int16_t> is;
+        round_trip(os, is, flags);
+        HPX_TEST(os == is);
+    }
+
+    // integral values are stored using their native size for trusted peers
+    std::int16_t const os = -42;
+    std::int16_t is = 0;
+    std::size_t const portable_size = round_trip(os, is, 0);
+    HPX_TEST_EQ(os, is);
+
+    is = 0;
+    std::size_t const trusted_size = round_trip(
+        os, is, static_cast<std::uint32_t>(archive_flags::trusted_peer));
+    HPX_TEST_EQ(os, is);
+    HPX_TEST_LT(trusted_size, portable_size);
+}
+
+void test_record()
+{
+    record os;
+    os.i8 = -5;
+    os.u16 = 65000;
+    os.i32 = -123456;
+    os.u64 = 0x123456789abcdef0ull;
+    os.c = color::blue;
+    os.b = true;
+    os.d = 3.1415;
+    os.name = "trusted";
+    os.attributes = {{1, "one"}, {-2, "minus two"}, {3, "three"}};
+
+    record portable;
+    std::size_t const portable_size = round_trip(os, portable, 0);
+    HPX_TEST(os == portable);
+
+    record trusted;
+    std::size_t const trusted_size = round_trip(
+        os, trusted, static_cast<std::uint32_t>(archive_flags::trusted_peer));
+    HPX_TEST(os == trusted);
+    HPX_TEST_LT(trusted_size, portable_size);
+}
+
+int main()
+{
+    test_header();
+    test_integrals();
+    test_record();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,211 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that large contiguous sequences are sent as separate
+// chunks and that those chunks are deserialized directly into the memory of
+// the receiving containers if zero-copy receive operations are allowed.
+
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/allow_zero_copy_receive.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/traits/is_zero_copy_serializable.hpp>
+#include <hpx/serialization/valarray.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <valarray>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct particle
+{
+    double position[3];
+    double velocity[3];
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & position & velocity;
+        // clang-format on
+    }
+
+    friend bool operator==(particle const& lhs, particle const& rhs)
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(particle)) == 0;
+    }
+};
+
+HPX_IS_ZERO_COPY_SERIALIZABLE(particle)
+
+static_assert(hpx::traits::is_zero_copy_serializable_v<double>);
+static_assert(hpx::traits::is_zero_copy_serializable_v<particle>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<particle>);
+static_assert(
+    hpx::traits::is_zero_copy_serializable_v<std::array<particle, 4>>);
+static_assert(
+    !hpx::traits::is_zero_copy_serializable_v<std::array<std::vector<int>, 4>>);
+
+constexpr std::size_t num_elements = 4 * HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+
+///////////////////////////////////////////////////////////////////////////////
+// Simulate a parcelport supporting zero-copy receive operations: the
+// deserialization pass hands out the addresses the pointer chunks have to be
+// received into, the data itself is placed there afterwards.
+template <typename T, typename Data>
+void test_zero_copy(T const& os, T& is, Data const* data)
+{
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+        oarchive << os;
+    }
+
+    std::vector<void const*> sources;
+    for (auto& chunk : chunks)
+    {
+        if (chunk.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            sources.push_back(chunk.data_.cpos_);
+            chunk.data_.pos_ = nullptr;
+        }
+    }
+
+    // the sequence was not copied into the parcel buffer
+    HPX_TEST_EQ(sources.size(), std::size_t(1));
+    HPX_TEST(sources[0] == data);
+    HPX_TEST_LT(
+        buffer.size(), std::size_t(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD));
+
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, buffer.size(), &chunks);
+        iarchive.get_extra_data<
+            hpx::serialization::detail::allow_zero_copy_receive>();
+        iarchive >> is;
+    }
+
+    for (auto const& chunk : chunks)
+    {
+        if (chunk.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST(chunk.data_.pos_ != nullptr);
+            std::memcpy(chunk.data_.pos_, sources[0], chunk.size_);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_vector()
+{
+    std::vector<double> os(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        os[i] = static_cast<double>(i);
+    }
+
+    std::vector<double> is;
+    test_zero_copy(os, is, os.data());
+    HPX_TEST(os == is);
+}
+
+void test_vector_of_arrays()
+{
+    std::vector<std::array<double, 3>> os(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        os[i] = {d, d + 1, d + 2};
+    }
+
+    std::vector<std::array<double, 3>> is;
+    test_zero_copy(os, is, os.data());
+    HPX_TEST(os == is);
+}
+
+void test_vector_of_user_type()
+{
+    std::vector<particle> os(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        os[i] = particle{{d, d, d}, {-d, -d, -d}};
+    }
+
+    std::vector<particle> is;
+    test_zero_copy(os, is, os.data());
+    HPX_TEST(os == is);
+}
+
+void test_std_array()
+{
+    std::vector<std::array<int, num_elements>> os(1);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        os[0][i] = static_cast<int>(i);
+    }
+
+    std::vector<std::array<int, num_elements>> is;
+    test_zero_copy(os, is, os.data());
+    HPX_TEST(os == is);
+}
+
+void test_valarray()
+{
+    std::valarray<double> os(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        os[i] = static_cast<double>(i);
+    }
+
+    std::valarray<double> is;
+    test_zero_copy(os, is, &os[0]);
+    HPX_TEST_EQ(is.size(), os.size());
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        HPX_TEST_EQ(os[i], is[i]);
+    }
+}
+
+void test_serialize_buffer()
+{
+    using buffer_type = hpx::serialization::serialize_buffer<particle>;
+
+    buffer_type os(num_elements);
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        os[i] = particle{{d, d, d}, {d, d, d}};
+    }
+
+    buffer_type is;
+    test_zero_copy(os, is, os.data());
+    HPX_TEST_EQ(is.size(), os.size());
+    for (std::size_t i = 0; i != num_elements; ++i)
+    {
+        HPX_TEST(os[i] == is[i]);
+    }
+}
+
+int main()
+{
+    test_vector();
+    test_vector_of_arrays();
+    test_vector_of_user_type();
+    test_std_array();
+    test_valarray();
+    test_serialize_buffer();
+
+    return hpx::util::report_errors();
+}
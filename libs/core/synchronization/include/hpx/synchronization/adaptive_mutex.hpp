@@ -0,0 +1,222 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file adaptive_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx {
+
+    ///
+    /// \brief \a adaptive_mutex is a mutex that spins for a while before
+    ///        suspending the calling HPX thread on contention.
+    ///        The time spent spinning is derived from the (sampled) time the
+    ///        mutex has recently been held: if the current owner is likely
+    ///        to release the mutex sooner than a context switch would take,
+    ///        waiting threads spin, otherwise they are suspended right away
+    ///        (as with \a hpx::mutex). Calls from threads that are not HPX
+    ///        threads never suspend but yield the operating system thread.
+    ///
+    ///        \a adaptive_mutex satisfies all requirements of
+    ///        \namedrequirement{Mutex}. It does not detect recursive locking.
+    ///
+    ///        \a hpx::adaptive_mutex is neither copyable nor movable.
+    ///
+    class adaptive_mutex
+    {
+    public:
+        /// \brief \a hpx::adaptive_mutex is neither copyable nor movable
+        HPX_NON_COPYABLE(adaptive_mutex);
+
+        /// \brief Contention counters of an \a adaptive_mutex
+        struct statistics
+        {
+            /// number of lock operations that found the mutex locked
+            std::uint64_t contended = 0;
+
+            /// number of contended lock operations that acquired the mutex
+            /// while spinning
+            std::uint64_t spin_acquired = 0;
+
+            /// number of contended lock operations that had to suspend
+            std::uint64_t suspended = 0;
+
+            /// moving average of the time the mutex was held [ns]
+            std::uint64_t average_hold_time = 0;
+        };
+
+        /// \brief Waiting threads never spin longer than this [ns]
+        static constexpr std::uint64_t max_spin_time = 10000;
+
+        ///
+        /// \brief Constructs the \a adaptive_mutex. The \a adaptive_mutex is
+        ///        in unlocked state after the constructor completes.
+        ///
+        /// \param description description of the \a adaptive_mutex.
+        ///
+        HPX_CORE_EXPORT explicit adaptive_mutex(
+            char const* const description = "") noexcept;
+
+        HPX_CORE_EXPORT ~adaptive_mutex();
+
+        ///
+        /// \brief Locks the mutex, spinning or suspending the calling thread
+        ///        while the mutex is owned by another thread.
+        ///
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            if (!acquire_lock())
+            {
+                lock_contended();
+            }
+            acquired();
+        }
+
+        ///
+        /// \brief Tries to lock the mutex, returns immediately.
+        ///
+        /// \return bool \a try_lock returns \a true on successful lock
+        ///              acquisition, otherwise returns \a false.
+        ///
+        bool try_lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            if (acquire_lock())
+            {
+                acquired();
+                return true;
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        ///
+        /// \brief Unlocks the mutex, resumes one of the suspended threads, if
+        ///        any.
+        ///
+        void unlock()
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+
+            if (acquired_at_ != 0)
+            {
+                update_hold_time(
+                    hpx::chrono::high_resolution_clock::now() - acquired_at_);
+            }
+
+            if (state_.exchange(unlocked, std::memory_order_release) ==
+                locked_with_waiters)
+            {
+                resume_waiter();
+            }
+
+            HPX_ITT_SYNC_RELEASED(this);
+            util::unregister_lock(this);
+        }
+
+        ///
+        /// \brief Returns the contention counters of this mutex.
+        ///
+        statistics get_statistics() const noexcept
+        {
+            statistics s;
+            s.contended = num_contended_.load(std::memory_order_relaxed);
+            s.spin_acquired =
+                num_spin_acquired_.load(std::memory_order_relaxed);
+            s.suspended = num_suspended_.load(std::memory_order_relaxed);
+            s.average_hold_time =
+                average_hold_time_.load(std::memory_order_relaxed);
+            return s;
+        }
+
+        ///
+        /// \brief Resets the contention counters of this mutex.
+        ///
+        void reset_statistics() noexcept
+        {
+            num_contended_.store(0, std::memory_order_relaxed);
+            num_spin_acquired_.store(0, std::memory_order_relaxed);
+            num_suspended_.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        enum : std::uint32_t
+        {
+            unlocked = 0,
+            locked = 1,
+            locked_with_waiters = 2
+        };
+
+        bool acquire_lock() noexcept
+        {
+            std::uint32_t expected = unlocked;
+            return state_.load(std::memory_order_relaxed) == unlocked &&
+                state_.compare_exchange_strong(
+                    expected, locked, std::memory_order_acquire);
+        }
+
+        void acquired()
+        {
+            // the time the mutex is held is measured for every n-th
+            // acquisition only, reading the clock is not free
+            acquired_at_ = (++num_acquired_ & (hold_time_sampling - 1)) == 0 ?
+                hpx::chrono::high_resolution_clock::now() :
+                0;
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        void update_hold_time(std::uint64_t hold_time) noexcept
+        {
+            // only the owner of the mutex writes the average
+            std::uint64_t const average =
+                average_hold_time_.load(std::memory_order_relaxed);
+            average_hold_time_.store(
+                average - average / 8 + hold_time / 8,
+                std::memory_order_relaxed);
+        }
+
+        HPX_CORE_EXPORT void lock_contended();
+        HPX_CORE_EXPORT void resume_waiter();
+
+        static constexpr std::uint32_t hold_time_sampling = 8;
+
+        std::atomic<std::uint32_t> state_{unlocked};
+
+        // accessed by the owner of the mutex only
+        std::uint32_t num_acquired_ = 0;
+        std::uint64_t acquired_at_ = 0;
+
+        std::atomic<std::uint64_t> average_hold_time_;
+
+        std::atomic<std::uint64_t> num_contended_{0};
+        std::atomic<std::uint64_t> num_spin_acquired_{0};
+        std::atomic<std::uint64_t> num_suspended_{0};
+
+        // support for suspending waiting threads
+        hpx::spinlock mtx_;
+        hpx::lcos::local::detail::condition_variable cond_;
+    };
+}    // namespace hpx
+
+#include <hpx/config/warnings_suffix.hpp>
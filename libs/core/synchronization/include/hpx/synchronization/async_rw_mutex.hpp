@@ -9,18 +9,15 @@
 
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/operation_state.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
-#include <hpx/functional/move_only_function.hpp>
-#include <hpx/synchronization/mutex.hpp>
 
+#include <atomic>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -34,6 +31,99 @@ namespace hpx::experimental {
             readwrite
         };
 
+        // Base class of the operation states of the senders returned by
+        // async_rw_mutex. Operation states waiting for a shared state to
+        // become ready are linked through the next pointer, i.e. waiting does
+        // not require any allocation.
+        struct async_rw_mutex_operation_state_base
+        {
+            async_rw_mutex_operation_state_base* next = nullptr;
+
+            virtual void continuation() noexcept = 0;
+
+        protected:
+            ~async_rw_mutex_operation_state_base() = default;
+        };
+
+        // Lock-free list of the operation states waiting for a shared state
+        // to become ready. Once the shared state is ready the list is
+        // replaced by a tag and operation states that are started later
+        // continue immediately.
+        class async_rw_mutex_waiters
+        {
+        public:
+            explicit async_rw_mutex_waiters(bool ready) noexcept
+              : head(ready ? ready_tag() : nullptr)
+            {
+            }
+
+            async_rw_mutex_waiters(async_rw_mutex_waiters const&) = delete;
+            async_rw_mutex_waiters& operator=(
+                async_rw_mutex_waiters const&) = delete;
+
+            bool is_ready() const noexcept
+            {
+                return head.load(std::memory_order_acquire) == ready_tag();
+            }
+
+            // Returns false if the shared state is already ready, the
+            // operation state was not added in this case.
+            bool add(async_rw_mutex_operation_state_base* op) noexcept
+            {
+                auto* h = head.load(std::memory_order_acquire);
+                do
+                {
+                    if (h == ready_tag())
+                    {
+                        return false;
+                    }
+                    op->next = h;
+                } while (!head.compare_exchange_weak(h, op,
+                    std::memory_order_release, std::memory_order_acquire));
+                return true;
+            }
+
+            void set_ready() noexcept
+            {
+                auto* h = head.exchange(ready_tag(), std::memory_order_acq_rel);
+                HPX_ASSERT(h != ready_tag());
+
+                // continue the operation states in the order they were started
+                async_rw_mutex_operation_state_base* ops = nullptr;
+                while (h != nullptr)
+                {
+                    auto* next = h->next;
+                    h->next = ops;
+                    ops = h;
+                    h = next;
+                }
+
+                while (ops != nullptr)
+                {
+                    // the operation state may go out of scope while running
+                    // its continuation
+                    auto* next = ops->next;
+                    ops->continuation();
+                    ops = next;
+                }
+            }
+
+        private:
+            // The address of the list itself never refers to an operation
+            // state
+            async_rw_mutex_operation_state_base* ready_tag() const noexcept
+            {
+                return reinterpret_cast<async_rw_mutex_operation_state_base*>(
+                    const_cast<async_rw_mutex_waiters*>(this));
+            }
+
+            std::atomic<async_rw_mutex_operation_state_base*> head;
+        };
+
+        // A shared state represents one generation of accesses, either a
+        // single read-write access or any number of consecutive read-only
+        // accesses. The shared state becomes ready (and the accesses of its
+        // generation continue) when the previous shared state is destroyed.
         template <typename T>
         struct async_rw_mutex_shared_state
         {
@@ -42,12 +132,13 @@ namespace hpx::experimental {
 
             hpx::optional<T> value;
             shared_state_ptr_type next_state;
-            hpx::mutex mtx;
-            hpx::detail::small_vector<
-                hpx::move_only_function<void(shared_state_ptr_type)>, 1>
-                continuations;
+            async_rw_mutex_waiters waiters;
 
-            async_rw_mutex_shared_state() = default;
+            // Only the state for the first access is ready on construction
+            explicit async_rw_mutex_shared_state(bool ready = false) noexcept
+              : waiters(ready)
+            {
+            }
 
             async_rw_mutex_shared_state(async_rw_mutex_shared_state&&) = delete;
             async_rw_mutex_shared_state& operator=(
@@ -60,10 +151,9 @@ namespace hpx::experimental {
 
             ~async_rw_mutex_shared_state()
             {
-                // The last state does not have a next state. If this state has
-                // a next state it must always have continuations.
-                HPX_ASSERT((continuations.empty() && !next_state) ||
-                    (!continuations.empty() && next_state));
+                // This state is kept alive by the previous state until it is
+                // ready.
+                HPX_ASSERT(waiters.is_ready());
 
                 // This state must always have the value set by the time it is
                 // destructed. If there is no next state the value is destructed
@@ -75,11 +165,7 @@ namespace hpx::experimental {
                     // The current state has now finished all accesses to the
                     // wrapped value, so we move the value to the next state.
                     next_state->set_value(HPX_MOVE(value.value()));
-
-                    for (auto& continuation : continuations)
-                    {
-                        continuation(next_state);
-                    }
+                    next_state->waiters.set_ready();
                 }
             }
 
@@ -97,13 +183,6 @@ namespace hpx::experimental {
                 HPX_ASSERT(!next_state);
                 next_state = HPX_MOVE(state);
             }
-
-            template <typename F>
-            void add_continuation(F&& continuation)
-            {
-                std::lock_guard<hpx::mutex> l(mtx);
-                continuations.emplace_back(HPX_FORWARD(F, continuation));
-            }
         };
 
         template <>
@@ -113,12 +192,13 @@ namespace hpx::experimental {
                 std::shared_ptr<async_rw_mutex_shared_state>;
 
             shared_state_ptr_type next_state;
-            hpx::mutex mtx;
-            hpx::detail::small_vector<
-                hpx::move_only_function<void(shared_state_ptr_type)>, 1>
-                continuations;
+            async_rw_mutex_waiters waiters;
 
-            async_rw_mutex_shared_state() = default;
+            // Only the state for the first access is ready on construction
+            explicit async_rw_mutex_shared_state(bool ready = false) noexcept
+              : waiters(ready)
+            {
+            }
 
             async_rw_mutex_shared_state(async_rw_mutex_shared_state&&) = delete;
             async_rw_mutex_shared_state& operator=(
@@ -131,14 +211,13 @@ namespace hpx::experimental {
 
             ~async_rw_mutex_shared_state()
             {
-                // The last state does not have a next state. If this state has
-                // a next state it must always have continuations.
-                HPX_ASSERT((continuations.empty() && !next_state) ||
-                    (!continuations.empty() && next_state));
+                // This state is kept alive by the previous state until it is
+                // ready.
+                HPX_ASSERT(waiters.is_ready());
 
-                for (auto& continuation : continuations)
+                if (HPX_LIKELY(next_state))
                 {
-                    continuation(next_state);
+                    next_state->waiters.set_ready();
                 }
             }
 
@@ -149,13 +228,6 @@ namespace hpx::experimental {
                 HPX_ASSERT(!next_state);
                 next_state = HPX_MOVE(state);
             }
-
-            template <typename F>
-            void add_continuation(F&& continuation)
-            {
-                std::lock_guard<hpx::mutex> l(mtx);
-                continuations.emplace_back(HPX_FORWARD(F, continuation));
-            }
         };
 
         template <typename ReadWriteT, typename ReadT,
@@ -334,26 +406,31 @@ namespace hpx::experimental {
 
     // Implementation details:
     //
-    // The async_rw_mutex protects access to a given resource using two
-    // reference counted shared states, the current and the previous state. Each
-    // shared state guards access to the next stage; when the shared state goes
-    // out of scope it triggers continuations for the next stage.
+    // The async_rw_mutex protects access to a given resource using a chain of
+    // reference counted shared states, one per generation of accesses. A
+    // generation is either a single read-write access or any number of
+    // consecutive read-only accesses. Each shared state holds on to the next
+    // state; when the shared state goes out of scope it moves the value to
+    // the next state and makes the next state ready.
     //
-    // When read-write access is required a sender is created which holds on to
-    // the newly created shared state for the read-write access and the previous
-    // state. When the sender is connected to a receiver, a callback is added to
-    // the previous shared state's destructor. The callback holds the new state,
+    // When read-write access is required a new shared state is created and
+    // linked to the current state, and a sender holding the new state is
+    // returned. When the sender is connected to a receiver and started, the
+    // operation state adds itself to the intrusive list of waiters of the
+    // shared state (or continues immediately if the state is already ready)
     // and passes a wrapper holding the shared state to set_value. Once the
     // receiver which receives the wrapper has let the wrapper go out of scope
-    // (and all other references to the shared state are out of scope), the new
-    // shared state will again trigger its continuations.
+    // (and all other references to the shared state are out of scope), the
+    // next shared state becomes ready.
     //
-    // When read-only access is required and the previous access was read-only
-    // the procedure is the same as for read-write access. When read-only access
-    // follows a previous read-only access the shared state is reused between
-    // all consecutive read-only accesses, such that multiple read-only accesses
-    // can run concurrently, and the next access (which must be read-write) is
-    // triggered once all instances of that shared state have gone out of scope.
+    // When read-only access is required and the previous access was
+    // read-write the procedure is the same as for read-write access. When
+    // read-only access follows a previous read-only access the shared state
+    // is reused (no allocation is needed) between all consecutive read-only
+    // accesses, such that multiple read-only accesses can run concurrently
+    // and continue together once their generation is ready. The next access
+    // (which must be read-write) is triggered once all instances of that
+    // shared state have gone out of scope.
     //
     // The protected value is moved from state to state and is released when the
     // last shared state is destroyed.
@@ -392,47 +469,26 @@ namespace hpx::experimental {
 
         sender<detail::async_rw_mutex_access_type::read> read()
         {
+            // Consecutive read-only accesses share the same state
             if (prev_access == detail::async_rw_mutex_access_type::readwrite)
             {
-                prev_state = HPX_MOVE(state);
-                state = std::allocate_shared<shared_state_type, allocator_type>(
-                    alloc);
+                next_generation();
                 prev_access = detail::async_rw_mutex_access_type::read;
-
-                // Only the first access has no previous shared state. When
-                // there is a previous state we set the next state so that the
-                // value can be passed from the previous state to the next
-                // state.
-                if (HPX_LIKELY(prev_state))
-                {
-                    prev_state->set_next_state(state);
-                }
             }
-            return {prev_state, state};
+            return {state};
         }
 
         sender<detail::async_rw_mutex_access_type::readwrite> readwrite()
         {
-            prev_state = HPX_MOVE(state);
-            state =
-                std::allocate_shared<shared_state_type, allocator_type>(alloc);
+            next_generation();
             prev_access = detail::async_rw_mutex_access_type::readwrite;
-
-            // Only the first access has no previous shared state. When there is
-            // a previous state we set the next state so that the value can be
-            // passed from the previous state to the next state.
-            if (HPX_LIKELY(prev_state))
-            {
-                prev_state->set_next_state(state);
-            }
-            return {HPX_MOVE(prev_state), state};
+            return {state};
         }
 
     private:
         template <detail::async_rw_mutex_access_type AccessType>
         struct sender
         {
-            shared_state_ptr_type prev_state;
             shared_state_ptr_type state;
 
             using access_type =
@@ -458,17 +514,15 @@ namespace hpx::experimental {
                 sender const&, Env) -> generate_completion_signatures<Env>;
 
             template <typename R>
-            struct operation_state
+            struct operation_state final
+              : detail::async_rw_mutex_operation_state_base
             {
                 std::decay_t<R> r;
-                shared_state_ptr_type prev_state;
                 shared_state_ptr_type state;
 
                 template <typename R_>
-                operation_state(R_&& r, shared_state_ptr_type prev_state,
-                    shared_state_ptr_type state)
+                operation_state(R_&& r, shared_state_ptr_type state)
                   : r(HPX_FORWARD(R_, r))
-                  , prev_state(HPX_MOVE(prev_state))
                   , state(HPX_MOVE(state))
                 {
                 }
@@ -478,6 +532,22 @@ namespace hpx::experimental {
                 operation_state(operation_state const&) = delete;
                 operation_state& operator=(operation_state const&) = delete;
 
+                // Called once all accesses of the previous generation have
+                // finished
+                void continuation() noexcept override
+                {
+                    try
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r), access_type{HPX_MOVE(state)});
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), std::current_exception());
+                    }
+                }
+
                 friend void tag_invoke(hpx::execution::experimental::start_t,
                     operation_state& os) noexcept
                 {
@@ -485,35 +555,13 @@ namespace hpx::experimental {
                         "async_rw_lock::sender::operation_state state is "
                         "empty, was the sender already started?");
 
-                    auto continuation =
-                        [r = HPX_MOVE(os.r)](
-                            shared_state_ptr_type state) mutable {
-                            try
-                            {
-                                hpx::execution::experimental::set_value(
-                                    HPX_MOVE(r), access_type{HPX_MOVE(state)});
-                            }
-                            catch (...)
-                            {
-                                hpx::execution::experimental::set_error(
-                                    HPX_MOVE(r), std::current_exception());
-                            }
-                        };
-
-                    if (os.prev_state)
-                    {
-                        os.prev_state->add_continuation(HPX_MOVE(continuation));
-
-                        // We release prev_state here to allow continuations to
-                        // run. The operation state may otherwise keep it alive
-                        // longer than needed.
-                        os.prev_state.reset();
-                    }
-                    else
+                    // The state is already ready if this is the first access
+                    // or if all accesses of the previous generation have
+                    // already finished. We can immediately trigger the
+                    // continuation in this case.
+                    if (!os.state->waiters.add(&os))
                     {
-                        // There is no previous state on the first access. We
-                        // can immediately trigger the continuation.
-                        continuation(HPX_MOVE(os.state));
+                        os.continuation();
                     }
                 }
             };
@@ -522,17 +570,30 @@ namespace hpx::experimental {
             friend auto tag_invoke(
                 hpx::execution::experimental::connect_t, sender&& s, R&& r)
             {
-                return operation_state<R>{HPX_FORWARD(R, r),
-                    HPX_MOVE(s.prev_state), HPX_MOVE(s.state)};
+                return operation_state<R>{HPX_FORWARD(R, r), HPX_MOVE(s.state)};
             }
         };
 
+        // Create the state for the next generation of accesses. Only the
+        // first access has no previous shared state. When there is a previous
+        // state we set the next state so that the next state becomes ready
+        // once all accesses of the previous state have finished.
+        void next_generation()
+        {
+            auto next = std::allocate_shared<shared_state_type, allocator_type>(
+                alloc, !state);
+            if (HPX_LIKELY(state))
+            {
+                state->set_next_state(next);
+            }
+            state = HPX_MOVE(next);
+        }
+
         allocator_type alloc;
 
         detail::async_rw_mutex_access_type prev_access =
             detail::async_rw_mutex_access_type::readwrite;
 
-        shared_state_ptr_type prev_state;
         shared_state_ptr_type state;
     };
 
@@ -580,50 +641,20 @@ namespace hpx::experimental {
 
         sender<detail::async_rw_mutex_access_type::read> read()
         {
+            // Consecutive read-only accesses share the same state
             if (prev_access == detail::async_rw_mutex_access_type::readwrite)
             {
-                prev_state = HPX_MOVE(state);
-                state = std::allocate_shared<shared_state_type, allocator_type>(
-                    alloc);
+                next_generation();
                 prev_access = detail::async_rw_mutex_access_type::read;
-
-                // Only the first access has no previous shared state. When
-                // there is a previous state we set the next state so that the
-                // value can be passed from the previous state to the next
-                // state. When there is no previous state we need to move the
-                // value to the first state.
-                if (HPX_LIKELY(prev_state))
-                {
-                    prev_state->set_next_state(state);
-                }
-                else
-                {
-                    state->set_value(HPX_MOVE(value));
-                }
             }
-            return {prev_state, state};
+            return {state};
         }
 
         sender<detail::async_rw_mutex_access_type::readwrite> readwrite()
         {
-            prev_state = HPX_MOVE(state);
-            state =
-                std::allocate_shared<shared_state_type, allocator_type>(alloc);
-
-            // Only the first access has no previous shared state. When there is
-            // a previous state we set the next state so that the value can be
-            // passed from the previous state to the next state. When there is
-            // no previous state we need to move the value to the first state.
-            if (HPX_LIKELY(prev_state))    //-V1051
-            {
-                prev_state->set_next_state(state);
-            }
-            else
-            {
-                state->set_value(HPX_MOVE(value));
-            }
+            next_generation();
             prev_access = detail::async_rw_mutex_access_type::readwrite;
-            return {HPX_MOVE(prev_state), state};
+            return {state};
         }
 
     private:
@@ -634,7 +665,6 @@ namespace hpx::experimental {
         template <detail::async_rw_mutex_access_type AccessType>
         struct sender
         {
-            shared_state_ptr_type prev_state;
             shared_state_ptr_type state;
 
             using access_type =
@@ -660,17 +690,15 @@ namespace hpx::experimental {
                 sender const&, Env) -> generate_completion_signatures<Env>;
 
             template <typename R>
-            struct operation_state
+            struct operation_state final
+              : detail::async_rw_mutex_operation_state_base
             {
                 std::decay_t<R> r;
-                shared_state_ptr_type prev_state;
                 shared_state_ptr_type state;
 
                 template <typename R_>
-                operation_state(R_&& r, shared_state_ptr_type prev_state,
-                    shared_state_ptr_type state)
+                operation_state(R_&& r, shared_state_ptr_type state)
                   : r(HPX_FORWARD(R_, r))
-                  , prev_state(HPX_MOVE(prev_state))
                   , state(HPX_MOVE(state))
                 {
                 }
@@ -680,6 +708,22 @@ namespace hpx::experimental {
                 operation_state(operation_state const&) = delete;
                 operation_state& operator=(operation_state const&) = delete;
 
+                // Called once all accesses of the previous generation have
+                // finished
+                void continuation() noexcept override
+                {
+                    try
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r), access_type{HPX_MOVE(state)});
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), std::current_exception());
+                    }
+                }
+
                 friend void tag_invoke(hpx::execution::experimental::start_t,
                     operation_state& os) noexcept
                 {
@@ -687,34 +731,13 @@ namespace hpx::experimental {
                         "async_rw_lock::sender::operation_state state is "
                         "empty, was the sender already started?");
 
-                    auto continuation =
-                        [r = HPX_MOVE(os.r)](
-                            shared_state_ptr_type state) mutable {
-                            try
-                            {
-                                hpx::execution::experimental::set_value(
-                                    HPX_MOVE(r), access_type{HPX_MOVE(state)});
-                            }
-                            catch (...)
-                            {
-                                hpx::execution::experimental::set_error(
-                                    HPX_MOVE(r), std::current_exception());
-                            }
-                        };
-
-                    if (os.prev_state)
-                    {
-                        os.prev_state->add_continuation(HPX_MOVE(continuation));
-                        // We release prev_state here to allow continuations to
-                        // run. The operation state may otherwise keep it alive
-                        // longer than needed.
-                        os.prev_state.reset();
-                    }
-                    else
+                    // The state is already ready if this is the first access
+                    // or if all accesses of the previous generation have
+                    // already finished. We can immediately trigger the
+                    // continuation in this case.
+                    if (!os.state->waiters.add(&os))
                     {
-                        // There is no previous state on the first access. We
-                        // can immediately trigger the continuation.
-                        continuation(HPX_MOVE(os.state));
+                        os.continuation();
                     }
                 }
             };
@@ -723,18 +746,36 @@ namespace hpx::experimental {
             friend auto tag_invoke(
                 hpx::execution::experimental::connect_t, sender&& s, R&& r)
             {
-                return operation_state<R>{HPX_FORWARD(R, r),
-                    HPX_MOVE(s.prev_state), HPX_MOVE(s.state)};
+                return operation_state<R>{HPX_FORWARD(R, r), HPX_MOVE(s.state)};
             }
         };
 
+        // Create the state for the next generation of accesses. Only the
+        // first access has no previous shared state. When there is a previous
+        // state we set the next state so that the value can be passed from
+        // the previous state to the next state. When there is no previous
+        // state we need to move the value to the first state.
+        void next_generation()
+        {
+            auto next = std::allocate_shared<shared_state_type, allocator_type>(
+                alloc, !state);
+            if (HPX_LIKELY(state))
+            {
+                state->set_next_state(next);
+            }
+            else
+            {
+                next->set_value(HPX_MOVE(value));
+            }
+            state = HPX_MOVE(next);
+        }
+
         value_type value;
         allocator_type alloc;
 
         detail::async_rw_mutex_access_type prev_access =
             detail::async_rw_mutex_access_type::readwrite;
 
-        shared_state_ptr_type prev_state;
         shared_state_ptr_type state;
     };
 }    // namespace hpx::experimental
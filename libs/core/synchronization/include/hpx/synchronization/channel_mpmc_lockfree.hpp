@@ -0,0 +1,493 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The lock-free ring buffer is based on the bounded MPMC queue described by
+//  Dmitry Vyukov (https://www.1024cores.net/home/lock-free-algorithms/queues/
+//  bounded-mpmc-queue).
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/construct_at.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::lcos::local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free implementation of the channel concept. This channel is
+    // bounded to a size given at construction time (rounded up to the next
+    // power of two) and supports multiple producers and multiple consumers.
+    // Every slot of the ring-buffer carries a sequence number telling whether
+    // it is ready to be written or to be read for a given position, producers
+    // and consumers claim positions using a single atomic operation on the
+    // tail or head position. Batches of values are transferred by claiming
+    // several consecutive positions at once.
+    //
+    // The non-blocking operations (set, get, set_n, get_n) may be used from
+    // any thread. The blocking operations (send, receive, send_n, receive_n)
+    // suspend the calling HPX thread while the channel is full or empty.
+    // Values sent before the channel was closed can still be received after
+    // it has been closed.
+    template <typename T>
+    class channel_mpmc_lockfree
+    {
+    private:
+        // a claimed slot must always be published, values are therefore moved
+        // into and out of the slots only
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+            "channel_mpmc_lockfree requires a nothrow move constructible "
+            "value type");
+
+        using mutex_type = hpx::spinlock;
+
+        struct slot
+        {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* value() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        static constexpr std::size_t round_up(std::size_t size) noexcept
+        {
+            std::size_t result = 1;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    public:
+        explicit channel_mpmc_lockfree(std::size_t size)
+          : mask_(round_up(size) - 1)
+          , buffer_(new slot[mask_ + 1])
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i <= mask_; ++i)
+            {
+                buffer_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        channel_mpmc_lockfree(channel_mpmc_lockfree const&) = delete;
+        channel_mpmc_lockfree(channel_mpmc_lockfree&&) = delete;
+        channel_mpmc_lockfree& operator=(channel_mpmc_lockfree const&) = delete;
+        channel_mpmc_lockfree& operator=(channel_mpmc_lockfree&&) = delete;
+
+        ~channel_mpmc_lockfree()
+        {
+            // destroy the values that were not received
+            std::size_t const tail =
+                tail_.data_.load(std::memory_order_relaxed);
+            for (std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+                 pos != tail; ++pos)
+            {
+                std::destroy_at(buffer_[pos & mask_].value());
+            }
+        }
+
+        // Store the given value, returns false if the channel is full or has
+        // been closed.
+        bool set(T&& t)
+        {
+            return notify_receivers(set_impl(t));
+        }
+
+        // Retrieve a value, returns false if the channel is empty. Returns
+        // whether the channel is non-empty without retrieving a value if val
+        // is nullptr.
+        bool get(T* val = nullptr)
+        {
+            if (val == nullptr)
+            {
+                std::size_t const pos =
+                    head_.data_.load(std::memory_order_relaxed);
+                return buffer_[pos & mask_].sequence.load(
+                           std::memory_order_acquire) == pos + 1;
+            }
+            return notify_senders(get_impl(*val));
+        }
+
+        // Store up to count values from the given range, returns the number
+        // of values stored (zero if the channel is full or has been closed).
+        template <typename Iterator>
+        std::size_t set_n(Iterator first, std::size_t count)
+        {
+            return notify_receivers(set_n_impl(first, count));
+        }
+
+        // Retrieve up to count values and write them to the given output
+        // iterator, returns the number of values retrieved.
+        template <typename OutIterator>
+        std::size_t get_n(OutIterator out, std::size_t count)
+        {
+            return notify_senders(get_n_impl(out, count));
+        }
+
+        // Store the given value, suspends the calling HPX thread while the
+        // channel is full. Returns false if the channel has been closed.
+        bool send(T&& t)
+        {
+            return notify_receivers(wait_for(waiting_senders_, not_full_,
+                       "channel_mpmc_lockfree::send",
+                       [&]() { return set_impl(t); })) != 0;
+        }
+
+        // Retrieve a value, suspends the calling HPX thread while the channel
+        // is empty. Returns false if the channel has been closed and is
+        // empty.
+        bool receive(T& val)
+        {
+            return notify_senders(wait_for(waiting_receivers_, not_empty_,
+                       "channel_mpmc_lockfree::receive",
+                       [&]() { return get_impl(val); })) != 0;
+        }
+
+        // Store all count values from the given range, suspends the calling
+        // HPX thread while the channel is full. Returns the number of values
+        // stored, which is less than count only if the channel has been
+        // closed.
+        template <typename Iterator>
+        std::size_t send_n(Iterator first, std::size_t count)
+        {
+            std::size_t sent = 0;
+            while (sent != count)
+            {
+                std::size_t const n = notify_receivers(
+                    wait_for(waiting_senders_, not_full_,
+                        "channel_mpmc_lockfree::send_n",
+                        [&]() { return set_n_impl(first, count - sent); }));
+                if (n == 0)
+                {
+                    break;    // closed
+                }
+                std::advance(first, n);
+                sent += n;
+            }
+            return sent;
+        }
+
+        // Retrieve at least one and up to count values, suspends the calling
+        // HPX thread while the channel is empty. Returns the number of values
+        // retrieved, zero if the channel has been closed and is empty.
+        template <typename OutIterator>
+        std::size_t receive_n(OutIterator out, std::size_t count)
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            return notify_senders(wait_for(waiting_receivers_, not_empty_,
+                "channel_mpmc_lockfree::receive_n",
+                [&]() { return get_n_impl(out, count); }));
+        }
+
+        // Close the channel, wakes up all suspended senders and receivers.
+        std::size_t close()
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (closed_.exchange(true))
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::channel_mpmc_lockfree::close",
+                    "attempting to close an already closed channel");
+            }
+
+            not_full_.notify_all_no_unlock(l);
+            not_empty_.notify_all(HPX_MOVE(l));
+            return 0;
+        }
+
+        bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+        constexpr std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        // Claim up to count consecutive positions starting at the given
+        // position for writing (readiness == 0) or reading (readiness == 1).
+        // Returns the number of claimed positions, sets pos to the first of
+        // them.
+        std::size_t claim(std::atomic<std::size_t>& position,
+            std::size_t readiness, std::size_t count,
+            std::size_t& pos) noexcept
+        {
+            pos = position.load(std::memory_order_relaxed);
+            while (true)
+            {
+                // count the consecutive slots that are ready
+                std::size_t n = 0;
+                bool stale = false;
+                while (n != count && n <= mask_)
+                {
+                    std::size_t const seq =
+                        buffer_[(pos + n) & mask_].sequence.load(
+                            std::memory_order_acquire);
+                    auto const diff = static_cast<std::ptrdiff_t>(
+                        seq - (pos + n + readiness));
+                    if (diff != 0)
+                    {
+                        // another thread claimed this position already
+                        stale = n == 0 && diff > 0;
+                        break;
+                    }
+                    ++n;
+                }
+
+                if (stale)
+                {
+                    pos = position.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (n == 0)
+                {
+                    return 0;    // full or empty
+                }
+
+                // the slots can't be claimed by other threads, as this would
+                // have required to advance the position
+                if (position.compare_exchange_weak(
+                        pos, pos + n, std::memory_order_relaxed))
+                {
+                    return n;
+                }
+            }
+        }
+
+        // The operations below do not notify suspended threads. A claimed
+        // slot is always released, operations that may throw are performed
+        // before claiming or after releasing a slot.
+        std::size_t set_impl(T& t)
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t pos = 0;
+            if (claim(tail_.data_, 0, 1, pos) == 0)
+            {
+                return 0;
+            }
+
+            slot& s = buffer_[pos & mask_];
+            hpx::construct_at(s.value(), HPX_MOVE(t));
+            s.sequence.store(pos + 1, std::memory_order_release);
+            return 1;
+        }
+
+        std::size_t get_impl(T& val)
+        {
+            std::size_t pos = 0;
+            if (claim(head_.data_, 1, 1, pos) == 0)
+            {
+                return 0;
+            }
+
+            slot& s = buffer_[pos & mask_];
+            T t(HPX_MOVE(*s.value()));
+            std::destroy_at(s.value());
+            s.sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+            val = HPX_MOVE(t);
+            return 1;
+        }
+
+        template <typename Iterator>
+        std::size_t set_n_impl(Iterator first, std::size_t count)
+        {
+            if (count == 0 || closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            // values that may throw while being copied are copied before
+            // claiming a slot for them, one at a time
+            if constexpr (!std::is_nothrow_constructible_v<T,
+                              decltype(*first)>)
+            {
+                std::size_t n = 0;
+                for (/**/; n != count; ++n, ++first)
+                {
+                    T t(*first);
+                    if (set_impl(t) == 0)
+                    {
+                        break;
+                    }
+                }
+                return n;
+            }
+            else
+            {
+                std::size_t pos = 0;
+                std::size_t const n = claim(tail_.data_, 0, count, pos);
+                for (std::size_t i = 0; i != n; ++i, ++first)
+                {
+                    slot& s = buffer_[(pos + i) & mask_];
+                    hpx::construct_at(s.value(), *first);
+                    s.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return n;
+            }
+        }
+
+        template <typename OutIterator>
+        std::size_t get_n_impl(OutIterator& out, std::size_t count)
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            std::size_t pos = 0;
+            std::size_t const n = claim(head_.data_, 1, count, pos);
+
+            std::size_t i = 0;
+            auto release = [&]() noexcept -> T {
+                slot& s = buffer_[(pos + i) & mask_];
+                T t(HPX_MOVE(*s.value()));
+                std::destroy_at(s.value());
+                s.sequence.store(
+                    pos + i + mask_ + 1, std::memory_order_release);
+                ++i;
+                return t;
+            };
+
+            try
+            {
+                while (i != n)
+                {
+                    *out = release();
+                    ++out;
+                }
+            }
+            catch (...)
+            {
+                // release the remaining claimed slots, their values are lost
+                while (i != n)
+                {
+                    release();
+                }
+                throw;
+            }
+            return n;
+        }
+
+        // wake up suspended threads if needed after n slots have been
+        // published
+        std::size_t notify(std::atomic<std::size_t>& waiting,
+            lcos::local::detail::condition_variable& cond, std::size_t n)
+        {
+            if (n == 0)
+            {
+                return 0;
+            }
+
+            // either the suspending thread sees the published slots or this
+            // thread sees the suspending thread (see wait_for)
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                if (n == 1)
+                {
+                    cond.notify_one(HPX_MOVE(l));
+                }
+                else
+                {
+                    cond.notify_all(HPX_MOVE(l));
+                }
+            }
+            return n;
+        }
+
+        std::size_t notify_receivers(std::size_t n)
+        {
+            return notify(waiting_receivers_, not_empty_, n);
+        }
+
+        std::size_t notify_senders(std::size_t n)
+        {
+            return notify(waiting_senders_, not_full_, n);
+        }
+
+        // repeat the given operation until it succeeds (returns non-zero) or
+        // the channel has been closed, suspending the calling thread in
+        // between
+        template <typename F>
+        std::size_t wait_for(std::atomic<std::size_t>& waiting,
+            lcos::local::detail::condition_variable& cond,
+            char const* description, F&& f)
+        {
+            if (std::size_t const n = f(); n != 0)
+            {
+                return n;
+            }
+
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            while (true)
+            {
+                // announce the waiting thread before retrying, either the
+                // retry succeeds or the notifying thread sees the waiter
+                waiting.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                std::size_t const n = f();
+                if (n != 0 || closed_.load(std::memory_order_relaxed))
+                {
+                    waiting.fetch_sub(1, std::memory_order_relaxed);
+                    return n;
+                }
+
+                cond.wait(l, description);
+                waiting.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        // keep the head and the tail position in separate cache lines
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        std::size_t const mask_;
+        std::unique_ptr<slot[]> buffer_;
+
+        std::atomic<bool> closed_{false};
+
+        // support for suspending senders and receivers
+        hpx::util::cache_aligned_data<mutex_type> mtx_;
+        std::atomic<std::size_t> waiting_senders_{0};
+        std::atomic<std::size_t> waiting_receivers_{0};
+        lcos::local::detail::condition_variable not_full_;
+        lcos::local::detail::condition_variable not_empty_;
+    };
+}    // namespace hpx::lcos::local
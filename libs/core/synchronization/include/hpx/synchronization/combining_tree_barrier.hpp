@@ -0,0 +1,186 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file combining_tree_barrier.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A software combining tree (see P.-C. Yew et al., "Distributing
+        // Hot-Spot Addressing in Large-Scale Multiprocessors", 1987). Each
+        // participant arrives at the leaf its index belongs to, the last
+        // participant arriving at a node proceeds to its parent. At most
+        // fan_in threads ever contend on the same counter, and the
+        // participants sharing a leaf have adjacent indices. Passing the
+        // worker thread numbers (or any other numbering following the order
+        // of the processing units) as participant indices makes the tree
+        // follow the core topology.
+        class HPX_CORE_EXPORT combining_tree
+        {
+        public:
+            static constexpr std::size_t default_fan_in = 4;
+
+            explicit combining_tree(
+                std::size_t num_participants, std::size_t fan_in);
+
+            combining_tree(combining_tree const&) = delete;
+            combining_tree(combining_tree&&) = delete;
+            combining_tree& operator=(combining_tree const&) = delete;
+            combining_tree& operator=(combining_tree&&) = delete;
+
+            ~combining_tree();
+
+            // Returns true for the last participant to arrive. The tree is
+            // reset by the time the last participant has arrived, every
+            // participant may arrive again once all participants have
+            // arrived.
+            bool arrive(std::size_t participant) noexcept;
+
+            [[nodiscard]] constexpr std::size_t num_participants()
+                const noexcept
+            {
+                return num_participants_;
+            }
+
+        private:
+            struct node_data
+            {
+                std::atomic<std::uint32_t> count;
+                std::uint32_t expected;
+                std::size_t parent;    // npos for the root
+            };
+            using node = util::cache_aligned_data_derived<node_data>;
+
+            std::size_t const num_participants_;
+            std::size_t const fan_in_;
+            std::size_t num_nodes_;
+            std::unique_ptr<node[]> nodes_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A reusable barrier for a fixed number of participants, each of which
+    /// identifies itself by a unique index in [0, expected). In contrast to
+    /// \a hpx::barrier, the arrivals are combined in a tree (see
+    /// detail::combining_tree) instead of all participants updating the
+    /// same counter under a lock, which avoids the arrival storm on a single
+    /// cache line for larger numbers of participants. Waiting participants
+    /// spin (and yield) on the phase of the barrier instead of being
+    /// suspended.
+    class combining_tree_barrier
+    {
+    public:
+        using arrival_token = std::uint64_t;
+
+        explicit combining_tree_barrier(std::size_t expected,
+            std::size_t fan_in = detail::combining_tree::default_fan_in)
+          : tree_(expected, fan_in)
+        {
+        }
+
+        [[nodiscard]] std::size_t expected() const noexcept
+        {
+            return tree_.num_participants();
+        }
+
+        /// Arrive at the barrier without waiting, the returned token can be
+        /// passed to wait or try_wait.
+        [[nodiscard]] arrival_token arrive(std::size_t participant) noexcept
+        {
+            // the phase can't change before this participant has arrived
+            arrival_token const phase = phase_.data_.load(
+                std::memory_order_acquire);
+            if (tree_.arrive(participant))
+            {
+                phase_.data_.store(phase + 1, std::memory_order_release);
+            }
+            return phase;
+        }
+
+        /// Returns whether all participants have arrived in the phase
+        /// identified by the given token.
+        [[nodiscard]] bool try_wait(arrival_token token) const noexcept
+        {
+            return phase_.data_.load(std::memory_order_acquire) != token;
+        }
+
+        void wait(arrival_token token) const
+        {
+            hpx::util::yield_while([&]() { return !try_wait(token); },
+                "combining_tree_barrier::wait");
+        }
+
+        void arrive_and_wait(std::size_t participant)
+        {
+            wait(arrive(participant));
+        }
+
+    private:
+        detail::combining_tree tree_;
+        util::cache_aligned_data<std::atomic<arrival_token>> phase_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A single-use latch for a fixed number of participants, each of which
+    /// counts down exactly once using its unique index in [0, expected).
+    /// The count downs are combined in a tree (see combining_tree_barrier).
+    class combining_tree_latch
+    {
+    public:
+        explicit combining_tree_latch(std::size_t expected,
+            std::size_t fan_in = detail::combining_tree::default_fan_in)
+          : tree_(expected, fan_in)
+          , released_(expected == 0)
+        {
+        }
+
+        void count_down(std::size_t participant) noexcept
+        {
+            if (tree_.arrive(participant))
+            {
+                released_.data_.store(true, std::memory_order_release);
+            }
+        }
+
+        [[nodiscard]] bool try_wait() const noexcept
+        {
+            return released_.data_.load(std::memory_order_acquire);
+        }
+
+        void wait() const
+        {
+            hpx::util::yield_while(
+                [&]() { return !try_wait(); }, "combining_tree_latch::wait");
+        }
+
+        void arrive_and_wait(std::size_t participant)
+        {
+            count_down(participant);
+            wait();
+        }
+
+    private:
+        detail::combining_tree tree_;
+        util::cache_aligned_data<std::atomic<bool>> released_;
+    };
+}    // namespace hpx
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -81,7 +81,7 @@ namespace hpx {
         ///
         /// \param description description of the \a mutex.
         ///
-#if defined(HPX_HAVE_ITTNOTIFY)
+#if defined(HPX_HAVE_ITTNOTIFY) || defined(HPX_HAVE_LOCK_PROFILING)
         HPX_CORE_EXPORT mutex(char const* const description = "");
 #else
         HPX_HOST_DEVICE_CONSTEXPR mutex(char const* const = "") noexcept
@@ -0,0 +1,159 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file reader_biased_shared_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx {
+
+    ///
+    /// \brief \a reader_biased_shared_mutex is a shared mutex optimized for
+    ///        read-mostly data. Instead of a single shared state, readers
+    ///        register in one of several counters (one per worker thread by
+    ///        default), each occupying a cache line of its own. Acquiring and
+    ///        releasing a shared lock touches the counter of the current
+    ///        worker thread only, as long as no writer is active. Writers
+    ///        announce themselves and wait for all counters to drain, which
+    ///        makes exclusive locking considerably more expensive than for
+    ///        \a hpx::shared_mutex.
+    ///
+    ///        Readers that arrive while a writer is waiting or active are
+    ///        suspended until the writer has released the mutex.
+    ///
+    ///        \a reader_biased_shared_mutex satisfies all requirements of
+    ///        \namedrequirement{SharedMutex}.
+    ///
+    class reader_biased_shared_mutex
+    {
+    public:
+        /// \brief \a hpx::reader_biased_shared_mutex is neither copyable nor
+        ///        movable
+        HPX_NON_COPYABLE(reader_biased_shared_mutex);
+
+        ///
+        /// \brief Constructs the mutex using one reader counter per
+        ///        processing unit.
+        ///
+        HPX_CORE_EXPORT reader_biased_shared_mutex();
+
+        ///
+        /// \brief Constructs the mutex using the given number of reader
+        ///        counters.
+        ///
+        HPX_CORE_EXPORT explicit reader_biased_shared_mutex(
+            std::size_t num_slots);
+
+        HPX_CORE_EXPORT ~reader_biased_shared_mutex();
+
+        ///
+        /// \brief Acquires shared ownership of the mutex.
+        ///
+        void lock_shared()
+        {
+            if (!try_lock_shared_fast(current_slot()))
+            {
+                lock_shared_slow();
+            }
+            util::register_lock(this);
+        }
+
+        ///
+        /// \brief Tries to acquire shared ownership of the mutex, fails if a
+        ///        writer is active or waiting.
+        ///
+        HPX_CORE_EXPORT bool try_lock_shared();
+
+        ///
+        /// \brief Releases shared ownership of the mutex.
+        ///
+        void unlock_shared()
+        {
+            util::unregister_lock(this);
+
+            // the calling thread might have been moved to a different worker
+            // thread since acquiring the lock, the counters are balanced in
+            // sum only
+            current_slot().data_.fetch_sub(1, std::memory_order_seq_cst);
+            if (writer_.data_.load(std::memory_order_seq_cst))
+            {
+                notify_writer();
+            }
+        }
+
+        ///
+        /// \brief Acquires exclusive ownership of the mutex.
+        ///
+        HPX_CORE_EXPORT void lock();
+
+        ///
+        /// \brief Tries to acquire exclusive ownership of the mutex, fails if
+        ///        the mutex is locked by any reader or writer.
+        ///
+        HPX_CORE_EXPORT bool try_lock();
+
+        ///
+        /// \brief Releases exclusive ownership of the mutex.
+        ///
+        HPX_CORE_EXPORT void unlock();
+
+    private:
+        using slot_type = util::cache_line_data<std::atomic<std::int64_t>>;
+
+        HPX_CORE_EXPORT slot_type& current_slot() noexcept;
+
+        bool try_lock_shared_fast(slot_type& slot) noexcept
+        {
+            // Announce the reader before looking for a writer. The writer
+            // announces itself before summing up the counters, so either
+            // this thread sees the writer or the writer sees this thread.
+            slot.data_.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer_.data_.load(std::memory_order_seq_cst))
+            {
+                return true;
+            }
+
+            slot.data_.fetch_sub(1, std::memory_order_seq_cst);
+            notify_writer();
+            return false;
+        }
+
+        HPX_CORE_EXPORT void lock_shared_slow();
+        HPX_CORE_EXPORT void notify_writer();
+
+        // returns whether all readers have left, has to be called while
+        // holding mtx_
+        bool drained() const noexcept;
+
+        std::size_t const num_slots_;
+        std::unique_ptr<slot_type[]> slots_;
+
+        // a writer is active or waiting for the readers to leave
+        util::cache_line_data<std::atomic<bool>> writer_;
+
+        // support for suspending readers and writers
+        hpx::spinlock mtx_;
+        bool writer_draining_ = false;
+        hpx::lcos::local::detail::condition_variable readers_cond_;
+        hpx::lcos::local::detail::condition_variable writers_cond_;
+        hpx::lcos::local::detail::condition_variable drained_cond_;
+    };
+}    // namespace hpx
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -19,6 +19,7 @@
 
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/lock_registration/lock_profiling.hpp>
 #include <hpx/modules/itt_notify.hpp>
 
 #include <atomic>
@@ -46,7 +47,7 @@ namespace hpx {
             std::atomic<bool> v_;
 
         public:
-#if defined(HPX_HAVE_ITTNOTIFY)
+#if defined(HPX_HAVE_ITTNOTIFY) || defined(HPX_HAVE_LOCK_PROFILING)
             spinlock() noexcept
               : v_(false)
             {
@@ -57,11 +58,13 @@ namespace hpx {
               : v_(false)
             {
                 HPX_ITT_SYNC_CREATE(this, "hpx::spinlock", desc);
+                util::set_lock_name(this, desc);
             }
 
             ~spinlock()
             {
                 HPX_ITT_SYNC_DESTROY(this);
+                util::forget_lock(this);
             }
 #else
             constexpr spinlock() noexcept
@@ -80,6 +83,7 @@ namespace hpx {
             void lock()
             {
                 HPX_ITT_SYNC_PREPARE(this);
+                util::profile_lock_acquisition profile(this);
 
                 // Checking for the value in is_locked() ensures that
                 // acquire_lock is only called when is_locked computes to false.
@@ -102,6 +106,7 @@ namespace hpx {
                 //      but the nature of execution will still remain the same.
                 if (!acquire_lock())
                 {
+                    profile.contended();
                     auto pred = [this]() noexcept { return is_locked(); };
                     do
                     {
@@ -111,6 +116,7 @@ namespace hpx {
 
                 HPX_ITT_SYNC_ACQUIRED(this);
                 util::register_lock(this);
+                profile.acquired();
             }
 
             bool try_lock() noexcept(
@@ -122,6 +128,7 @@ namespace hpx {
                 {
                     HPX_ITT_SYNC_ACQUIRED(this);
                     util::register_lock(this);
+                    util::profile_lock_acquisition(this).acquired();
                     return true;
                 }
 
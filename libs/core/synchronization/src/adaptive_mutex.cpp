@@ -0,0 +1,105 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx {
+
+    namespace {
+
+        // the initial guess for the time the mutex is held, makes waiting
+        // threads spin until the first measurements are available [ns]
+        constexpr std::uint64_t initial_hold_time = 500;
+    }    // namespace
+
+    adaptive_mutex::adaptive_mutex(
+        [[maybe_unused]] char const* const description) noexcept
+      : average_hold_time_(initial_hold_time)
+    {
+        HPX_ITT_SYNC_CREATE(this, "hpx::adaptive_mutex", description);
+        HPX_ITT_SYNC_RENAME(this, "hpx::adaptive_mutex");
+    }
+
+    adaptive_mutex::~adaptive_mutex()
+    {
+        HPX_ITT_SYNC_DESTROY(this);
+    }
+
+    void adaptive_mutex::lock_contended()
+    {
+        num_contended_.fetch_add(1, std::memory_order_relaxed);
+
+        // spin for about twice the time the mutex is usually held, don't
+        // spin at all if the owner is likely to hold on to the mutex for
+        // longer than it takes to suspend and resume this thread
+        std::uint64_t const spin_time =
+            2 * average_hold_time_.load(std::memory_order_relaxed);
+        if (spin_time <= max_spin_time)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            for (std::size_t k = 1;; ++k)
+            {
+                HPX_SMT_PAUSE;
+                if (acquire_lock())
+                {
+                    num_spin_acquired_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                // avoid reading the clock on every iteration
+                if ((k % 16) == 0 &&
+                    hpx::chrono::high_resolution_clock::now() - start >
+                        spin_time)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (threads::get_self_ptr() == nullptr)
+        {
+            // threads that are not HPX threads can't be suspended
+            for (std::size_t k = 0; !acquire_lock(); ++k)
+            {
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::adaptive_mutex::lock");
+            }
+            return;
+        }
+
+        num_suspended_.fetch_add(1, std::memory_order_relaxed);
+
+        // Mark the mutex as having waiters before suspending. The thread
+        // releasing the mutex resets the state before taking the lock to
+        // resume a waiting thread, which can't happen in between marking the
+        // state and enqueueing this thread on the condition variable.
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        while (state_.exchange(locked_with_waiters,
+                   std::memory_order_acquire) != unlocked)
+        {
+            cond_.wait(l, "hpx::adaptive_mutex::lock");
+        }
+    }
+
+    void adaptive_mutex::resume_waiter()
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost);
+    }
+}    // namespace hpx
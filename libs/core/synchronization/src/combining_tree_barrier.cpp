@@ -0,0 +1,109 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/synchronization/combining_tree_barrier.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::detail {
+
+    namespace {
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        constexpr std::size_t ceil_div(std::size_t n, std::size_t d) noexcept
+        {
+            return (n + d - 1) / d;
+        }
+    }    // namespace
+
+    // The nodes are stored level by level starting with the leaves, the
+    // children of a node are adjacent on the level below.
+    combining_tree::combining_tree(
+        std::size_t num_participants, std::size_t fan_in)
+      : num_participants_(num_participants)
+      , fan_in_((std::max)(fan_in, std::size_t(2)))
+      , num_nodes_(0)
+    {
+        std::size_t width = ceil_div((std::max)(num_participants_,
+                                         std::size_t(1)),
+            fan_in_);
+        for (std::size_t w = width;; w = ceil_div(w, fan_in_))
+        {
+            num_nodes_ += w;
+            if (w == 1)
+            {
+                break;
+            }
+        }
+
+        nodes_.reset(new node[num_nodes_]);
+
+        // leaves count their participants
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            std::size_t const first = i * fan_in_;
+            nodes_[i].expected = static_cast<std::uint32_t>(
+                (std::min)(first + fan_in_, num_participants_) -
+                (std::min)(first, num_participants_));
+        }
+
+        // inner nodes count their children
+        while (width != 1)
+        {
+            std::size_t const parents = ceil_div(width, fan_in_);
+            std::size_t const parent_begin = begin + width;
+            for (std::size_t i = 0; i != width; ++i)
+            {
+                nodes_[begin + i].parent = parent_begin + i / fan_in_;
+            }
+            for (std::size_t i = 0; i != parents; ++i)
+            {
+                nodes_[parent_begin + i].expected = static_cast<std::uint32_t>(
+                    (std::min)((i + 1) * fan_in_, width) - i * fan_in_);
+            }
+            begin = parent_begin;
+            width = parents;
+        }
+        nodes_[begin].parent = npos;
+
+        for (std::size_t i = 0; i != num_nodes_; ++i)
+        {
+            nodes_[i].count.store(
+                nodes_[i].expected, std::memory_order_relaxed);
+        }
+    }
+
+    combining_tree::~combining_tree() = default;
+
+    bool combining_tree::arrive(std::size_t participant) noexcept
+    {
+        HPX_ASSERT(participant < num_participants_);
+
+        std::size_t index = participant / fan_in_;
+        while (index != npos)
+        {
+            node& n = nodes_[index];
+            if (n.count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return false;
+            }
+
+            // no participant arrives at this node again before all
+            // participants have arrived
+            n.count.store(n.expected, std::memory_order_relaxed);
+            index = n.parent;
+        }
+        return true;
+    }
+}    // namespace hpx::detail
@@ -10,10 +10,12 @@
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/lock_registration/lock_profiling.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
@@ -23,19 +25,21 @@
 namespace hpx {
 
     ///////////////////////////////////////////////////////////////////////////
-#if HPX_HAVE_ITTNOTIFY != 0
+#if HPX_HAVE_ITTNOTIFY != 0 || defined(HPX_HAVE_LOCK_PROFILING)
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
+        util::set_lock_name(this, description);
     }
 #endif
 
-#if HPX_HAVE_ITTNOTIFY != 0
+#if HPX_HAVE_ITTNOTIFY != 0 || defined(HPX_HAVE_LOCK_PROFILING)
     mutex::~mutex()
     {
         HPX_ITT_SYNC_DESTROY(this);
+        util::forget_lock(this);
     }
 #else
     mutex::~mutex() = default;
@@ -46,6 +50,7 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
+        util::profile_lock_acquisition profile(this);
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type const self_id = threads::get_self_id();
@@ -60,6 +65,10 @@ namespace hpx {
 
         while (owner_id_ != threads::invalid_thread_id)
         {
+            profile.contended();
+#if defined(HPX_HAVE_TASK_TRACING)
+            threads::tracing::lock_wait(this);
+#endif
             cond_.wait(l, ec);
             if (ec)
             {
@@ -71,6 +80,7 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+        profile.acquired();
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
@@ -90,6 +100,7 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+        util::profile_lock_acquisition(this).acquired();
         return true;
     }
 
@@ -146,11 +157,13 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
+        util::profile_lock_acquisition profile(this);
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type const self_id = threads::get_self_id();
         if (owner_id_ != threads::invalid_thread_id)
         {
+            profile.contended();
             threads::thread_restart_state const reason =
                 cond_.wait_until(l, abs_time, ec);
             if (ec)
@@ -175,6 +188,7 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+        profile.acquired();
         return true;
     }
 }    // namespace hpx
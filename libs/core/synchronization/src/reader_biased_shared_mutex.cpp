@@ -0,0 +1,163 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace hpx {
+
+    reader_biased_shared_mutex::reader_biased_shared_mutex()
+      : reader_biased_shared_mutex(threads::hardware_concurrency())
+    {
+    }
+
+    reader_biased_shared_mutex::reader_biased_shared_mutex(
+        std::size_t num_slots)
+      : num_slots_(num_slots != 0 ? num_slots : 1)
+      , slots_(new slot_type[num_slots_])
+      , writer_(false)
+    {
+        for (std::size_t i = 0; i != num_slots_; ++i)
+        {
+            slots_[i].data_.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    reader_biased_shared_mutex::~reader_biased_shared_mutex()
+    {
+        HPX_ASSERT(!writer_.data_.load(std::memory_order_relaxed));
+        HPX_ASSERT(drained());
+    }
+
+    reader_biased_shared_mutex::slot_type&
+    reader_biased_shared_mutex::current_slot() noexcept
+    {
+        std::size_t num = hpx::get_worker_thread_num();
+        if (num == static_cast<std::size_t>(-1))
+        {
+            // spread threads that are not HPX threads as well
+            num = std::hash<std::thread::id>()(std::this_thread::get_id());
+        }
+        return slots_[num % num_slots_];
+    }
+
+    bool reader_biased_shared_mutex::drained() const noexcept
+    {
+        // A reader that has moved to a different worker thread releases its
+        // lock through a different counter than it acquired it with. The sum
+        // does not drop to zero before all readers have left, though, as
+        // every decrement observed here is preceded by an increment that is
+        // observed as well.
+        std::int64_t readers = 0;
+        for (std::size_t i = 0; i != num_slots_; ++i)
+        {
+            readers += slots_[i].data_.load(std::memory_order_seq_cst);
+        }
+        HPX_ASSERT(readers >= 0);
+        return readers == 0;
+    }
+
+    void reader_biased_shared_mutex::lock_shared_slow()
+    {
+        do
+        {
+            std::unique_lock<hpx::spinlock> l(mtx_);
+            while (writer_.data_.load(std::memory_order_relaxed))
+            {
+                readers_cond_.wait(
+                    l, "hpx::reader_biased_shared_mutex::lock_shared");
+            }
+        } while (!try_lock_shared_fast(current_slot()));
+    }
+
+    bool reader_biased_shared_mutex::try_lock_shared()
+    {
+        if (try_lock_shared_fast(current_slot()))
+        {
+            util::register_lock(this);
+            return true;
+        }
+        return false;
+    }
+
+    void reader_biased_shared_mutex::notify_writer()
+    {
+        // the writer checks for the readers to have left while holding the
+        // lock, it either sees the updated counter or it is waiting already
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        if (writer_draining_)
+        {
+            drained_cond_.notify_one(HPX_MOVE(l));
+        }
+    }
+
+    void reader_biased_shared_mutex::lock()
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        while (writer_.data_.load(std::memory_order_relaxed))
+        {
+            writers_cond_.wait(l, "hpx::reader_biased_shared_mutex::lock");
+        }
+
+        // new readers back off from now on, wait for the remaining ones
+        writer_.data_.store(true, std::memory_order_seq_cst);
+
+        writer_draining_ = true;
+        while (!drained())
+        {
+            drained_cond_.wait(l, "hpx::reader_biased_shared_mutex::lock");
+        }
+        writer_draining_ = false;
+
+        util::register_lock(this);
+    }
+
+    bool reader_biased_shared_mutex::try_lock()
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        if (writer_.data_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        writer_.data_.store(true, std::memory_order_seq_cst);
+        if (!drained())
+        {
+            // resume the readers that have backed off in the meantime
+            writer_.data_.store(false, std::memory_order_seq_cst);
+            readers_cond_.notify_all(HPX_MOVE(l));
+            return false;
+        }
+
+        util::register_lock(this);
+        return true;
+    }
+
+    void reader_biased_shared_mutex::unlock()
+    {
+        util::unregister_lock(this);
+
+        std::unique_lock<hpx::spinlock> l(mtx_);
+        writer_.data_.store(false, std::memory_order_seq_cst);
+
+        writers_cond_.notify_one_no_unlock(l);
+        readers_cond_.notify_all(HPX_MOVE(l));
+    }
+}    // namespace hpx
@@ -0,0 +1,142 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t num_threads = 16;
+constexpr std::size_t num_iterations = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+// short critical sections, waiting threads should mostly spin
+void test_short_critical_sections()
+{
+    hpx::adaptive_mutex mtx;
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                ++counter;
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(counter, num_threads * num_iterations);
+
+    auto const stats = mtx.get_statistics();
+    HPX_TEST(stats.spin_acquired <= stats.contended);
+    HPX_TEST(stats.suspended <= stats.contended);
+    HPX_TEST(stats.average_hold_time <= hpx::adaptive_mutex::max_spin_time);
+
+    mtx.reset_statistics();
+    HPX_TEST_EQ(mtx.get_statistics().contended, std::uint64_t(0));
+}
+
+// long critical sections, waiting threads are suspended
+void test_long_critical_sections()
+{
+    hpx::adaptive_mutex mtx;
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != 10; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                ++counter;
+
+                // the current thread is not suspended while holding the
+                // mutex, busy wait instead
+                auto const start = std::chrono::steady_clock::now();
+                while (std::chrono::steady_clock::now() - start <
+                    std::chrono::microseconds(200))
+                {
+                }
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(counter, num_threads * 10);
+
+    auto const stats = mtx.get_statistics();
+    HPX_TEST(stats.average_hold_time > hpx::adaptive_mutex::max_spin_time);
+    HPX_TEST(stats.contended == 0 || stats.suspended != 0);
+}
+
+// threads that are not HPX threads never suspend
+void test_non_hpx_threads()
+{
+    hpx::adaptive_mutex mtx;
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_threads / 2; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                ++counter;
+            }
+        }));
+    }
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != 2; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                ++counter;
+            }
+        });
+    }
+
+    hpx::wait_all(futures);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(counter, (num_threads / 2 + 2) * num_iterations);
+}
+
+int hpx_main()
+{
+    test_short_critical_sections();
+    test_long_critical_sections();
+    test_non_hpx_threads();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -191,6 +191,21 @@ void test_moved(async_rw_mutex<ReadWriteT, ReadT> rwm)
     HPX_TEST(called);
 }
 
+template <typename ReadWriteT, typename ReadT = ReadWriteT>
+void test_read_after_readwrite(async_rw_mutex<ReadWriteT, ReadT> rwm)
+{
+    // Read-only accesses following a finished read-write access continue
+    // right away, without waiting for a later read-write access
+    rwm.readwrite() | sync_wait();
+
+    std::atomic<std::size_t> called{0};
+    auto s1 = rwm.read() | then([&](auto) { ++called; });
+    auto s2 = rwm.read() | then([&](auto) { ++called; });
+    std::move(s1) | sync_wait();
+    std::move(s2) | sync_wait();
+    HPX_TEST_EQ(called.load(), static_cast<std::size_t>(2));
+}
+
 template <typename ReadWriteT, typename ReadT = ReadWriteT>
 void test_multiple_accesses(
     async_rw_mutex<ReadWriteT, ReadT> rwm, std::size_t iterations)
@@ -275,6 +290,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_moved(async_rw_mutex<std::size_t>{0});
     test_moved(async_rw_mutex<mytype, mytype_base>{mytype{}});
 
+    test_read_after_readwrite(async_rw_mutex<void>{});
+    test_read_after_readwrite(async_rw_mutex<std::size_t>{0});
+    test_read_after_readwrite(async_rw_mutex<mytype, mytype_base>{mytype{}});
+
     std::size_t iterations = 100;
     test_multiple_accesses(async_rw_mutex<void>{}, iterations);
     test_multiple_accesses(async_rw_mutex<std::size_t>{0}, iterations);
@@ -0,0 +1,331 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using hpx::lcos::local::channel_mpmc_lockfree;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_set_get()
+{
+    channel_mpmc_lockfree<int> c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+    HPX_TEST(!c.get());
+
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.set(int(i)));
+    }
+    HPX_TEST(!c.set(42));
+    HPX_TEST(c.get());
+
+    int value = 0;
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(value, i);
+    }
+    HPX_TEST(!c.get(&value));
+}
+
+void test_set_n_get_n()
+{
+    channel_mpmc_lockfree<int> c(8);
+
+    std::vector<int> values(10);
+    std::iota(values.begin(), values.end(), 0);
+
+    // only as many values as fit are stored, wrapping around the ring
+    HPX_TEST_EQ(c.set_n(values.begin(), 5), std::size_t(5));
+
+    std::vector<int> received;
+    HPX_TEST_EQ(c.get_n(std::back_inserter(received), 3), std::size_t(3));
+    HPX_TEST_EQ(c.set_n(values.begin() + 5, 5), std::size_t(5));
+    HPX_TEST_EQ(c.set_n(values.begin(), 5), std::size_t(1));
+
+    HPX_TEST_EQ(c.get_n(std::back_inserter(received), 20), std::size_t(8));
+    HPX_TEST_EQ(c.get_n(std::back_inserter(received), 20), std::size_t(0));
+
+    HPX_TEST_EQ(received.size(), std::size_t(11));
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(received[i], i);
+    }
+    HPX_TEST_EQ(received[10], 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int num_producers = 4;
+constexpr int num_consumers = 4;
+constexpr int num_values = 10000;
+constexpr std::size_t batch_size = 7;
+
+void test_send_receive()
+{
+    channel_mpmc_lockfree<int> c(16);
+
+    std::vector<hpx::future<void>> producers;
+    for (int p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async([&c, p]() {
+            std::vector<int> values(num_values);
+            std::iota(values.begin(), values.end(), p * num_values);
+
+            // send the first half in batches, the rest one by one
+            std::size_t const half = num_values / 2;
+            std::size_t sent = 0;
+            while (sent != half)
+            {
+                std::size_t const n = (std::min)(batch_size, half - sent);
+                HPX_TEST_EQ(c.send_n(values.begin() + sent, n), n);
+                sent += n;
+            }
+            for (; sent != values.size(); ++sent)
+            {
+                HPX_TEST(c.send(int(values[sent])));
+            }
+        }));
+    }
+
+    std::vector<hpx::future<std::int64_t>> consumers;
+    for (int i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([&c, i]() {
+            std::int64_t sum = 0;
+            std::vector<int> values(batch_size);
+            while (true)
+            {
+                std::size_t n = 0;
+                if (i % 2 == 0)
+                {
+                    n = c.receive_n(values.begin(), batch_size);
+                }
+                else if (c.receive(values[0]))
+                {
+                    n = 1;
+                }
+
+                if (n == 0)
+                {
+                    break;    // closed and drained
+                }
+                HPX_TEST(n <= batch_size);
+                sum = std::accumulate(values.begin(), values.begin() + n, sum);
+            }
+            return sum;
+        }));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+    HPX_TEST(c.is_closed());
+
+    std::int64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    std::int64_t const total = std::int64_t(num_producers) * num_values;
+    HPX_TEST_EQ(sum, total * (total - 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct throwing_copy
+{
+    explicit throwing_copy(int value = 0) noexcept
+      : value(value)
+    {
+    }
+
+    throwing_copy(throwing_copy const& rhs)
+      : value(rhs.value)
+    {
+        if (value < 0)
+        {
+            throw std::runtime_error("throwing_copy");
+        }
+    }
+
+    throwing_copy(throwing_copy&&) noexcept = default;
+    throwing_copy& operator=(throwing_copy const&) = default;
+    throwing_copy& operator=(throwing_copy&&) noexcept = default;
+
+    int value;
+};
+
+struct throwing_output
+{
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    throwing_output& operator*() noexcept
+    {
+        return *this;
+    }
+    throwing_output& operator++() noexcept
+    {
+        return *this;
+    }
+
+    throwing_output& operator=(throwing_copy&& t)
+    {
+        if (t.value < 0)
+        {
+            throw std::runtime_error("throwing_output");
+        }
+        received->push_back(t.value);
+        return *this;
+    }
+
+    std::vector<int>* received;
+};
+
+void test_throwing_values()
+{
+    channel_mpmc_lockfree<throwing_copy> c(4);
+
+    // values that fail to be copied don't leave a claimed slot behind
+    std::vector<throwing_copy> values;
+    values.reserve(3);
+    for (int value : {1, -1, 2})
+    {
+        values.emplace_back(value);
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        c.set_n(values.begin(), values.size());
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(c.set(throwing_copy(-2)));
+    HPX_TEST(c.set(throwing_copy(3)));
+
+    // all claimed slots are released if writing a value fails
+    std::vector<int> received;
+    caught_exception = false;
+    try
+    {
+        c.get_n(throwing_output{&received}, 3);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(received.size(), std::size_t(1));
+    HPX_TEST_EQ(received[0], 1);
+    HPX_TEST(!c.get());
+
+    HPX_TEST_EQ(c.set_n(values.begin() + 2, 1), std::size_t(1));
+    HPX_TEST_EQ(c.get_n(throwing_output{&received}, 3), std::size_t(1));
+    HPX_TEST_EQ(received.size(), std::size_t(2));
+    HPX_TEST_EQ(received[1], 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_close()
+{
+    channel_mpmc_lockfree<std::vector<int>> c(4);
+    HPX_TEST(c.set(std::vector<int>(3, 1)));
+    HPX_TEST(c.set(std::vector<int>(3, 2)));
+
+    c.close();
+
+    // values sent before closing the channel can still be received
+    HPX_TEST(!c.set(std::vector<int>(3, 3)));
+    HPX_TEST(!c.send(std::vector<int>(3, 3)));
+
+    std::vector<int> value;
+    HPX_TEST(c.receive(value));
+    HPX_TEST_EQ(value[0], 1);
+
+    // receive_n returns the remaining values only
+    std::vector<std::vector<int>> values(2);
+    HPX_TEST_EQ(c.receive_n(values.begin(), 2), std::size_t(1));
+    HPX_TEST_EQ(values[0][0], 2);
+    HPX_TEST(!c.receive(value));
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // values that were not received are destroyed with the channel
+    channel_mpmc_lockfree<std::vector<int>> c2(4);
+    HPX_TEST(c2.set(std::vector<int>(100)));
+}
+
+void test_close_wakes_receivers()
+{
+    channel_mpmc_lockfree<int> c(4);
+
+    std::vector<hpx::future<bool>> receivers;
+    for (int i = 0; i != 8; ++i)
+    {
+        receivers.push_back(hpx::async([&c]() {
+            int value = 0;
+            return c.receive(value);
+        }));
+    }
+
+    HPX_TEST(c.send(1));
+    c.close();
+
+    int received = 0;
+    for (auto& f : receivers)
+    {
+        received += f.get() ? 1 : 0;
+    }
+    HPX_TEST_EQ(received, 1);
+}
+
+int hpx_main()
+{
+    test_set_get();
+    test_set_n_get_n();
+    test_send_receive();
+    test_throwing_values();
+    test_close();
+    test_close_wakes_receivers();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
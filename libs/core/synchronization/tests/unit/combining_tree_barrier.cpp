@@ -0,0 +1,130 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/barrier.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_combining_tree(std::size_t participants, std::size_t fan_in)
+{
+    hpx::detail::combining_tree tree(participants, fan_in);
+    HPX_TEST_EQ(tree.num_participants(), participants);
+
+    // exactly the last arriving participant reaches the root, in every phase
+    for (int phase = 0; phase != 3; ++phase)
+    {
+        std::size_t reached_root = 0;
+        for (std::size_t i = 0; i != participants; ++i)
+        {
+            std::size_t const participant =
+                phase % 2 == 0 ? i : participants - i - 1;
+            if (tree.arrive(participant))
+            {
+                ++reached_root;
+                HPX_TEST_EQ(i, participants - 1);
+            }
+        }
+        HPX_TEST_EQ(reached_root, static_cast<std::size_t>(1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_barrier(std::size_t participants, std::size_t fan_in)
+{
+    constexpr int phases = 100;
+
+    hpx::combining_tree_barrier b(participants, fan_in);
+    HPX_TEST_EQ(b.expected(), participants);
+
+    std::vector<std::atomic<std::size_t>> arrived(phases);
+    for (auto& a : arrived)
+    {
+        a.store(0);
+    }
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(participants);
+    for (std::size_t i = 0; i != participants; ++i)
+    {
+        results.push_back(hpx::async([&, i]() {
+            for (int phase = 0; phase != phases; ++phase)
+            {
+                ++arrived[phase];
+                b.arrive_and_wait(i);
+
+                // nobody leaves a phase before everybody has arrived
+                HPX_TEST_EQ(arrived[phase].load(), participants);
+            }
+        }));
+    }
+    hpx::wait_all(results);
+
+    // split arrive and wait
+    auto const token = b.arrive(0);
+    HPX_TEST(participants == 1 || !b.try_wait(token));
+    for (std::size_t i = 1; i != participants; ++i)
+    {
+        (void) b.arrive(i);
+    }
+    HPX_TEST(b.try_wait(token));
+    b.wait(token);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_latch(std::size_t participants, std::size_t fan_in)
+{
+    hpx::combining_tree_latch l(participants, fan_in);
+    HPX_TEST(participants == 0 || !l.try_wait());
+
+    std::atomic<std::size_t> counted_down(0);
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(participants);
+    for (std::size_t i = 0; i != participants; ++i)
+    {
+        results.push_back(hpx::async([&, i]() {
+            ++counted_down;
+            l.arrive_and_wait(i);
+            HPX_TEST_EQ(counted_down.load(), participants);
+        }));
+    }
+
+    l.wait();
+    HPX_TEST(l.try_wait());
+    HPX_TEST_EQ(counted_down.load(), participants);
+
+    hpx::wait_all(results);
+}
+
+int hpx_main()
+{
+    for (std::size_t const fan_in : {2, 3, 4, 16})
+    {
+        for (std::size_t const participants : {1, 2, 5, 16, 17, 64})
+        {
+            test_combining_tree(participants, fan_in);
+            test_barrier(participants, fan_in);
+            test_latch(participants, fan_in);
+        }
+    }
+    test_latch(0, 4);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -280,6 +280,12 @@ void test_mutex()
     test_trylock<hpx::mutex>()();
 }
 
+void test_adaptive_mutex()
+{
+    test_lock<hpx::adaptive_mutex>()();
+    test_trylock<hpx::adaptive_mutex>()();
+}
+
 void test_timed_mutex()
 {
     test_lock<hpx::timed_mutex>()();
@@ -310,6 +316,7 @@ int hpx_main(variables_map&)
 {
     {
         test_mutex();
+        test_adaptive_mutex();
         test_timed_mutex();
         //~ test_recursive_mutex();
         //~ test_recursive_timed_mutex();
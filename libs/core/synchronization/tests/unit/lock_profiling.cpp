@@ -0,0 +1,142 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the statistics collected for hpx::mutex and hpx::spinlock if
+// hpx.lock_profiling.enable is set.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lock_registration.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::util::lock_profile find_profile(std::string const& name)
+{
+    auto const profiles = hpx::util::get_lock_profiles();
+    auto const it = std::find_if(profiles.begin(), profiles.end(),
+        [&](hpx::util::lock_profile const& p) { return p.name == name; });
+    HPX_TEST(it != profiles.end());
+    return it != profiles.end() ? *it : hpx::util::lock_profile{};
+}
+
+template <typename Mutex>
+void test_contention(std::string const& name)
+{
+    constexpr int num_threads = 8;
+    constexpr int num_iterations = 100;
+
+    {
+        Mutex mtx(name.c_str());
+
+        std::vector<hpx::future<void>> results;
+        results.reserve(num_threads);
+        for (int i = 0; i != num_threads; ++i)
+        {
+            results.push_back(hpx::async([&]() {
+                for (int j = 0; j != num_iterations; ++j)
+                {
+                    std::lock_guard<Mutex> l(mtx);
+                    if (j % 10 == 0)
+                    {
+                        // make sure other threads have to wait
+                        hpx::this_thread::sleep_for(
+                            std::chrono::microseconds(100));
+                    }
+                }
+            }));
+        }
+        hpx::wait_all(results);
+
+        hpx::util::lock_profile const p = find_profile(name);
+        HPX_TEST_EQ(p.acquisitions,
+            static_cast<std::uint64_t>(num_threads * num_iterations));
+        HPX_TEST_LT(static_cast<std::uint64_t>(0), p.contentions);
+        HPX_TEST_LTE(p.contentions, p.acquisitions);
+        HPX_TEST_LTE(p.max_wait_time, p.wait_time);
+        HPX_TEST(!p.longest_waits.empty());
+        HPX_TEST_LTE(p.longest_waits.size(), hpx::util::lock_profile_max_waits);
+        HPX_TEST_EQ(p.longest_waits.front().first, p.max_wait_time);
+        HPX_TEST(std::is_sorted(p.longest_waits.begin(),
+            p.longest_waits.end(), [](auto const& lhs, auto const& rhs) {
+                return lhs.first > rhs.first;
+            }));
+    }
+
+    // the statistics of destroyed locks are kept
+    hpx::util::lock_profile const p = find_profile(name);
+    HPX_TEST_EQ(p.acquisitions,
+        static_cast<std::uint64_t>(num_threads * num_iterations));
+    HPX_TEST(p.lock == nullptr);
+}
+
+void test_uncontended()
+{
+    hpx::mutex mtx("uncontended");
+    for (int i = 0; i != 10; ++i)
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+    }
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+
+    hpx::util::lock_profile const p = find_profile("uncontended");
+    HPX_TEST_EQ(p.acquisitions, static_cast<std::uint64_t>(11));
+    HPX_TEST_EQ(p.contentions, static_cast<std::uint64_t>(0));
+    HPX_TEST_EQ(p.wait_time, static_cast<std::uint64_t>(0));
+}
+
+void test_report()
+{
+    hpx::util::lock_profile const totals = hpx::util::get_lock_profile_totals();
+    HPX_TEST_LTE(find_profile("contended mutex").acquisitions,
+        totals.acquisitions);
+
+    std::ostringstream os;
+    hpx::util::print_lock_profiles(os, 5);
+    HPX_TEST(os.str().find("lock profile") != std::string::npos);
+
+    hpx::util::reset_lock_profiles();
+
+    auto const profiles = hpx::util::get_lock_profiles();
+    HPX_TEST(std::none_of(profiles.begin(), profiles.end(),
+        [](hpx::util::lock_profile const& p) {
+            return p.name == "contended mutex";
+        }));
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::util::lock_profiling_enabled());
+
+    test_contention<hpx::mutex>("contended mutex");
+    test_contention<hpx::spinlock>("contended spinlock");
+    test_uncontended();
+    test_report();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.lock_profiling.enable=1", "hpx.lock_profiling.report=0"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,121 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/shared_mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+using mutex_type = hpx::reader_biased_shared_mutex;
+
+void test_try_lock()
+{
+    mutex_type mtx;
+
+    {
+        std::shared_lock<mutex_type> l1(mtx);
+        std::shared_lock<mutex_type> l2(mtx, std::try_to_lock);
+        HPX_TEST(l2.owns_lock());
+
+        // readers block writers
+        HPX_TEST(!mtx.try_lock());
+    }
+
+    {
+        std::unique_lock<mutex_type> l(mtx, std::try_to_lock);
+        HPX_TEST(l.owns_lock());
+
+        // writers block readers and writers
+        HPX_TEST(!mtx.try_lock_shared());
+        HPX_TEST(!mtx.try_lock());
+    }
+
+    HPX_TEST(mtx.try_lock_shared());
+    mtx.unlock_shared();
+}
+
+void test_readers_and_writers(std::size_t num_slots)
+{
+    constexpr std::size_t num_readers = 16;
+    constexpr std::size_t num_writers = 2;
+    constexpr std::size_t num_writes = 1000;
+
+    mutex_type mtx(num_slots);
+
+    // the writers keep both values equal
+    std::uint64_t value1 = 0;
+    std::uint64_t value2 = 0;
+
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> num_reads(0);
+
+    std::vector<hpx::future<void>> readers;
+    for (std::size_t i = 0; i != num_readers; ++i)
+    {
+        readers.push_back(hpx::async([&]() {
+            while (!done.load())
+            {
+                {
+                    std::shared_lock<mutex_type> l(mtx);
+                    HPX_TEST_EQ(value1, value2);
+                }
+                ++num_reads;
+
+                // give the scheduler the chance to move this thread to a
+                // different worker thread
+                hpx::this_thread::yield();
+            }
+        }));
+    }
+
+    std::vector<hpx::future<void>> writers;
+    for (std::size_t i = 0; i != num_writers; ++i)
+    {
+        writers.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_writes; ++j)
+            {
+                std::unique_lock<mutex_type> l(mtx);
+                ++value1;
+                ++value2;
+            }
+        }));
+    }
+
+    hpx::wait_all(writers);
+    done = true;
+    hpx::wait_all(readers);
+
+    HPX_TEST_EQ(value1, num_writers * num_writes);
+    HPX_TEST_EQ(value2, num_writers * num_writes);
+    HPX_TEST_NEQ(num_reads.load(), std::size_t(0));
+}
+
+int hpx_main()
+{
+    test_try_lock();
+
+    test_readers_and_writers(1);
+    test_readers_and_writers(3);
+    test_readers_and_writers(hpx::threads::hardware_concurrency());
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -8,15 +8,46 @@
 
 #include <hpx/config.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/program_options/options_description.hpp>
+#include <hpx/program_options/variables_map.hpp>
 
 #include <cstddef>
 #include <string>
 
 namespace hpx::util {
 
+    // Add the command line options of the performance test harness:
+    //
+    //  --perftests-warmup=N      the number of untimed runs of every test
+    //                            before the timed runs (default: 1)
+    //  --perftests-json=FILE     write the report to FILE instead of stdout
+    //  --perftests-baseline=FILE compare the results with the report stored
+    //                            in FILE (written by an earlier run)
+    //  --perftests-threshold=X   the relative increase of the median (default:
+    //                            0.05) above which a result is considered a
+    //                            regression
+    HPX_CORE_EXPORT void perftests_cfg(
+        hpx::program_options::options_description& cmdline);
+
+    // Apply the options added by perftests_cfg, the name of the test is added
+    // to the report
+    HPX_CORE_EXPORT void perftests_init(
+        hpx::program_options::variables_map const& vm,
+        std::string const& test_name = "");
+
     HPX_CORE_EXPORT void perftests_report(std::string const& name,
         std::string const& exec, std::size_t const steps,
         hpx::function<void()>&& test);
 
-    HPX_CORE_EXPORT void perftests_print_times();
+    // Add a value other than a time (e.g. the number of allocations) to the
+    // report, successive values for the same name and executor form a series
+    HPX_CORE_EXPORT void perftests_report_value(
+        std::string const& name, std::string const& exec, double value);
+
+    // Print the report (including the median, minimum, maximum and standard
+    // deviation of every series) and compare it with the baseline if one was
+    // given. Returns the number of series whose median exceeds the median of
+    // the baseline by more than the threshold (smaller values are assumed to
+    // be better).
+    HPX_CORE_EXPORT int perftests_print_times();
 }    // namespace hpx::util
@@ -6,27 +6,102 @@
 
 #include <hpx/testing/performance.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <numeric>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hpx::util {
 
     namespace detail {
 
+        struct perftests_config
+        {
+            std::size_t warmup = 1;
+            std::string json_file;
+            std::string baseline_file;
+            double threshold = 0.05;
+            std::string test_name;
+        };
+
+        perftests_config& config()
+        {
+            static perftests_config cfg;
+            return cfg;
+        }
+
+        struct series_statistics
+        {
+            double average = 0.0;
+            double median = 0.0;
+            double min = 0.0;
+            double max = 0.0;
+            double stddev = 0.0;
+        };
+
+        series_statistics get_statistics(std::vector<double> values)
+        {
+            series_statistics stats;
+            if (values.empty())
+            {
+                return stats;
+            }
+
+            std::sort(values.begin(), values.end());
+
+            std::size_t const size = values.size();
+            stats.min = values.front();
+            stats.max = values.back();
+            stats.median = size % 2 != 0 ?
+                values[size / 2] :
+                (values[size / 2 - 1] + values[size / 2]) / 2;
+            stats.average = std::accumulate(values.begin(), values.end(), 0.0) /
+                static_cast<double>(size);
+
+            double variance = 0.0;
+            for (double const value : values)
+            {
+                variance += (value - stats.average) * (value - stats.average);
+            }
+            stats.stddev = std::sqrt(variance / static_cast<double>(size));
+            return stats;
+        }
+
+        std::string json_escape(std::string const& str)
+        {
+            std::string result;
+            result.reserve(str.size());
+            for (char const c : str)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result;
+        }
+
+        using perf_key_t = std::tuple<std::string, std::string>;
+        using perf_map_t = std::map<perf_key_t, std::vector<double>>;
+
         // Json output for performance reports
         class json_perf_times
         {
-            using key_t = std::tuple<std::string, std::string>;
-            using value_t = std::vector<double>;
-            using map_t = std::map<key_t, value_t>;
-
-            map_t m_map;
+            perf_map_t m_map;
 
             HPX_CORE_EXPORT friend std::ostream& operator<<(
                 std::ostream& strm, json_perf_times const& obj);
@@ -34,6 +109,11 @@ namespace hpx::util {
         public:
             HPX_CORE_EXPORT void add(std::string const& name,
                 std::string const& executor, double time);
+
+            perf_map_t const& get() const noexcept
+            {
+                return m_map;
+            }
         };
 
         json_perf_times& times()
@@ -51,6 +131,11 @@ namespace hpx::util {
         std::ostream& operator<<(std::ostream& strm, json_perf_times const& obj)
         {
             strm << "{\n";
+            if (!config().test_name.empty())
+            {
+                strm << R"(  "test" : ")" << json_escape(config().test_name)
+                     << "\",\n";
+            }
             strm << "  \"outputs\" : [";
             int outputs = 0;
             for (auto&& item : obj.m_map)
@@ -58,12 +143,11 @@ namespace hpx::util {
                 if (outputs)
                     strm << ",";
                 strm << "\n    {\n";
-                strm << R"(      "name" : ")" << std::get<0>(item.first)
-                     << "\",\n";
-                strm << R"(      "executor" : ")" << std::get<1>(item.first)
-                     << "\",\n";
+                strm << R"(      "name" : ")"
+                     << json_escape(std::get<0>(item.first)) << "\",\n";
+                strm << R"(      "executor" : ")"
+                     << json_escape(std::get<1>(item.first)) << "\",\n";
                 strm << R"(      "series" : [)";
-                double average = 0.0;
                 int series = 0;
                 for (auto const val : item.second)
                 {
@@ -71,10 +155,15 @@ namespace hpx::util {
                         strm << ", ";
                     strm << val;
                     ++series;
-                    average += val;
                 }
                 strm << "],\n";
-                strm << "      \"average\" : " << average / series << "\n";
+
+                series_statistics const stats = get_statistics(item.second);
+                strm << "      \"average\" : " << stats.average << ",\n";
+                strm << "      \"median\" : " << stats.median << ",\n";
+                strm << "      \"min\" : " << stats.min << ",\n";
+                strm << "      \"max\" : " << stats.max << ",\n";
+                strm << "      \"stddev\" : " << stats.stddev << "\n";
                 strm << "    }";
                 ++outputs;
             }
@@ -88,18 +177,312 @@ namespace hpx::util {
         void json_perf_times::add(
             std::string const& name, std::string const& executor, double time)
         {
-            m_map[key_t(name, executor)].push_back(time);
+            m_map[perf_key_t(name, executor)].push_back(time);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Minimal reader for the reports written above (and by the perftests
+        // CI scripts, which add more top-level entries), only the name, the
+        // executor and the series of the outputs are extracted.
+        class json_report_reader
+        {
+        public:
+            explicit json_report_reader(std::string data)
+              : data_(std::move(data))
+            {
+            }
+
+            bool read(perf_map_t& outputs)
+            {
+                if (!expect('{'))
+                    return false;
+
+                if (expect('}'))
+                    return true;
+
+                do
+                {
+                    std::string key;
+                    if (!read_string(key) || !expect(':'))
+                        return false;
+
+                    if (key == "outputs" ? !read_outputs(outputs) :
+                                           !skip_value())
+                    {
+                        return false;
+                    }
+                } while (expect(','));
+
+                return expect('}');
+            }
+
+        private:
+            void skip_whitespace() noexcept
+            {
+                while (pos_ != data_.size() &&
+                    std::isspace(static_cast<unsigned char>(data_[pos_])))
+                {
+                    ++pos_;
+                }
+            }
+
+            bool expect(char const c) noexcept
+            {
+                skip_whitespace();
+                if (pos_ != data_.size() && data_[pos_] == c)
+                {
+                    ++pos_;
+                    return true;
+                }
+                return false;
+            }
+
+            bool read_string(std::string& str)
+            {
+                if (!expect('"'))
+                    return false;
+
+                str.clear();
+                while (pos_ != data_.size() && data_[pos_] != '"')
+                {
+                    if (data_[pos_] == '\\' && ++pos_ == data_.size())
+                        return false;
+                    str += data_[pos_++];
+                }
+                return expect('"');
+            }
+
+            bool read_number(double& value)
+            {
+                skip_whitespace();
+                char const* begin = data_.c_str() + pos_;
+                char* end = nullptr;
+                value = std::strtod(begin, &end);
+                if (end == begin)
+                    return false;
+
+                pos_ += static_cast<std::size_t>(end - begin);
+                return true;
+            }
+
+            bool read_series(std::vector<double>& series)
+            {
+                if (!expect('['))
+                    return false;
+
+                if (expect(']'))
+                    return true;
+
+                do
+                {
+                    double value = 0.0;
+                    if (!read_number(value))
+                        return false;
+                    series.push_back(value);
+                } while (expect(','));
+
+                return expect(']');
+            }
+
+            bool read_outputs(perf_map_t& outputs)
+            {
+                if (!expect('['))
+                    return false;
+
+                if (expect(']'))
+                    return true;
+
+                do
+                {
+                    if (!expect('{'))
+                        return false;
+
+                    std::string name, executor;
+                    std::vector<double> series;
+                    do
+                    {
+                        std::string key;
+                        if (!read_string(key) || !expect(':'))
+                            return false;
+
+                        bool const success = key == "name" ?
+                            read_string(name) :
+                            key == "executor" ? read_string(executor) :
+                            key == "series"   ? read_series(series) :
+                                                skip_value();
+                        if (!success)
+                            return false;
+                    } while (expect(','));
+
+                    if (!expect('}'))
+                        return false;
+
+                    outputs[perf_key_t(name, executor)] = HPX_MOVE(series);
+                } while (expect(','));
+
+                return expect(']');
+            }
+
+            bool skip_sequence(char const close)
+            {
+                if (expect(close))
+                    return true;
+
+                do
+                {
+                    if (close == '}')
+                    {
+                        std::string key;
+                        if (!read_string(key) || !expect(':'))
+                            return false;
+                    }
+                    if (!skip_value())
+                        return false;
+                } while (expect(','));
+
+                return expect(close);
+            }
+
+            bool skip_value()
+            {
+                skip_whitespace();
+                if (pos_ == data_.size())
+                    return false;
+
+                switch (data_[pos_])
+                {
+                case '"':
+                {
+                    std::string str;
+                    return read_string(str);
+                }
+                case '{':
+                    ++pos_;
+                    return skip_sequence('}');
+                case '[':
+                    ++pos_;
+                    return skip_sequence(']');
+                default:
+                    break;
+                }
+
+                for (char const* literal : {"true", "false", "null"})
+                {
+                    if (data_.compare(pos_, std::strlen(literal), literal) == 0)
+                    {
+                        pos_ += std::strlen(literal);
+                        return true;
+                    }
+                }
+
+                double value = 0.0;
+                return read_number(value);
+            }
+
+            std::string data_;
+            std::size_t pos_ = 0;
+        };
+
+        // Compare the medians of all series with the ones of the baseline,
+        // returns the number of regressions
+        int compare_with_baseline(std::ostream& strm)
+        {
+            perftests_config const& cfg = config();
+
+            std::ifstream in(cfg.baseline_file);
+            std::stringstream buffer;
+            buffer << in.rdbuf();
+
+            perf_map_t baseline;
+            if (!in || !json_report_reader(buffer.str()).read(baseline))
+            {
+                strm << "perftests: could not read the baseline report '"
+                     << cfg.baseline_file << "'\n";
+                return 1;
+            }
+
+            strm << "perftests: comparison with the baseline '"
+                 << cfg.baseline_file << "' (threshold "
+                 << 100.0 * cfg.threshold << "%)\n";
+
+            int regressions = 0;
+            for (auto const& item : times().get())
+            {
+                strm << "  " << std::get<0>(item.first) << " ("
+                     << std::get<1>(item.first) << "): ";
+
+                auto const it = baseline.find(item.first);
+                if (it == baseline.end() || it->second.empty())
+                {
+                    strm << "not in the baseline\n";
+                    continue;
+                }
+
+                double const before = get_statistics(it->second).median;
+                double const after = get_statistics(item.second).median;
+                double const change =
+                    before != 0.0 ? (after - before) / before : 0.0;
+
+                strm << "median " << before << " -> " << after << " ("
+                     << (change >= 0.0 ? "+" : "") << 100.0 * change << "%)";
+                if (change > cfg.threshold)
+                {
+                    strm << " REGRESSION";
+                    ++regressions;
+                }
+                strm << "\n";
+            }
+            return regressions;
         }
     }    // namespace detail
 
+    void perftests_cfg(hpx::program_options::options_description& cmdline)
+    {
+        using hpx::program_options::value;
+
+        // clang-format off
+        cmdline.add_options()
+            ("perftests-warmup", value<std::size_t>()->default_value(1),
+             "number of untimed runs of every test before the timed runs")
+            ("perftests-json", value<std::string>(),
+             "write the report to the given file instead of stdout")
+            ("perftests-baseline", value<std::string>(),
+             "compare the results with the report stored in the given file")
+            ("perftests-threshold", value<double>()->default_value(0.05),
+             "relative increase of the median above which a result is "
+             "considered a regression");
+        // clang-format on
+    }
+
+    void perftests_init(hpx::program_options::variables_map const& vm,
+        std::string const& test_name)
+    {
+        detail::perftests_config& cfg = detail::config();
+
+        if (vm.count("perftests-warmup"))
+            cfg.warmup = vm["perftests-warmup"].as<std::size_t>();
+        if (vm.count("perftests-json"))
+            cfg.json_file = vm["perftests-json"].as<std::string>();
+        if (vm.count("perftests-baseline"))
+            cfg.baseline_file = vm["perftests-baseline"].as<std::string>();
+        if (vm.count("perftests-threshold"))
+            cfg.threshold = vm["perftests-threshold"].as<double>();
+
+        cfg.test_name = test_name;
+    }
+
     void perftests_report(std::string const& name, std::string const& exec,
         std::size_t const steps, hpx::function<void()>&& test)
     {
         if (steps == 0)
             return;
 
-        // First iteration to cache the data
-        test();
+        // Warmup iterations to cache the data
+        for (std::size_t i = 0; i != detail::config().warmup; ++i)
+        {
+            test();
+        }
+
         using timer = std::chrono::high_resolution_clock;
         for (size_t i = 0; i != steps; ++i)
         {
@@ -115,8 +498,33 @@ namespace hpx::util {
         }
     }
 
-    void perftests_print_times()
+    void perftests_report_value(
+        std::string const& name, std::string const& exec, double const value)
+    {
+        detail::add_time(name, exec, value);
+    }
+
+    int perftests_print_times()
     {
-        std::cout << detail::times();
+        detail::perftests_config const& cfg = detail::config();
+
+        if (cfg.json_file.empty())
+        {
+            std::cout << detail::times();
+        }
+        else
+        {
+            std::ofstream out(cfg.json_file);
+            out << detail::times();
+        }
+
+        if (cfg.baseline_file.empty())
+        {
+            return 0;
+        }
+
+        // don't mix the comparison with a report written to stdout
+        return detail::compare_with_baseline(
+            cfg.json_file.empty() ? std::cerr : std::cout);
     }
 }    // namespace hpx::util
@@ -8,21 +8,76 @@
 
 #include <hpx/config.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
 namespace hpx::threads::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // A counter that is updated by its worker thread only, but that may be
+    // read concurrently by other threads (e.g. the elasticity controller).
+    // Relaxed loads and stores are sufficient, as there is a single writer.
+    class shared_counter
+    {
+    public:
+        constexpr shared_counter(std::int64_t value = 0) noexcept
+          : value_(value)
+        {
+        }
+
+        shared_counter(shared_counter const& rhs) noexcept
+          : value_(rhs.load())
+        {
+        }
+
+        shared_counter& operator=(shared_counter const& rhs) noexcept
+        {
+            store(rhs.load());
+            return *this;
+        }
+
+        shared_counter& operator=(std::int64_t value) noexcept
+        {
+            store(value);
+            return *this;
+        }
+
+        shared_counter& operator+=(std::int64_t value) noexcept
+        {
+            store(load() + value);
+            return *this;
+        }
+
+        operator std::int64_t() const noexcept
+        {
+            return load();
+        }
+
+        [[nodiscard]] std::int64_t load() const noexcept
+        {
+            return value_.load(std::memory_order_relaxed);
+        }
+
+        void store(std::int64_t value) noexcept
+        {
+            value_.store(value, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::int64_t> value_;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
     struct scheduling_counters
     {
         scheduling_counters(std::int64_t& executed_threads,
-            std::int64_t& executed_thread_phases, std::int64_t& tfunc_time,
-            std::int64_t& exec_time, std::int64_t& idle_loop_count,
-            std::int64_t& busy_loop_count, bool& is_active,
-            std::int64_t& background_work_duration,
+            std::int64_t& executed_thread_phases, shared_counter& tfunc_time,
+            shared_counter& exec_time, std::int64_t& idle_loop_count,
+            std::int64_t& busy_loop_count, std::int64_t& missed_deadlines,
+            bool& is_active, std::int64_t& background_work_duration,
             std::int64_t& background_send_duration,
             std::int64_t& background_receive_duration) noexcept
           : executed_threads_(executed_threads)
@@ -31,6 +86,7 @@ namespace hpx::threads::detail {
           , exec_time_(exec_time)
           , idle_loop_count_(idle_loop_count)
           , busy_loop_count_(busy_loop_count)
+          , missed_deadlines_(missed_deadlines)
           , background_work_duration_(background_work_duration)
           , background_send_duration_(background_send_duration)
           , background_receive_duration_(background_receive_duration)
@@ -40,10 +96,11 @@ namespace hpx::threads::detail {
 
         std::int64_t& executed_threads_;
         std::int64_t& executed_thread_phases_;
-        std::int64_t& tfunc_time_;
-        std::int64_t& exec_time_;
+        shared_counter& tfunc_time_;
+        shared_counter& exec_time_;
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
+        std::int64_t& missed_deadlines_;
         std::int64_t& background_work_duration_;
         std::int64_t& background_send_duration_;
         std::int64_t& background_receive_duration_;
@@ -53,25 +110,28 @@ namespace hpx::threads::detail {
     struct scheduling_counters
     {
         scheduling_counters(std::int64_t& executed_threads,
-            std::int64_t& executed_thread_phases, std::int64_t& tfunc_time,
-            std::int64_t& exec_time, std::int64_t& idle_loop_count,
-            std::int64_t& busy_loop_count, bool& is_active) noexcept
+            std::int64_t& executed_thread_phases, shared_counter& tfunc_time,
+            shared_counter& exec_time, std::int64_t& idle_loop_count,
+            std::int64_t& busy_loop_count, std::int64_t& missed_deadlines,
+            bool& is_active) noexcept
           : executed_threads_(executed_threads)
           , executed_thread_phases_(executed_thread_phases)
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
           , idle_loop_count_(idle_loop_count)
           , busy_loop_count_(busy_loop_count)
+          , missed_deadlines_(missed_deadlines)
           , is_active_(is_active)
         {
         }
 
         std::int64_t& executed_threads_;
         std::int64_t& executed_thread_phases_;
-        std::int64_t& tfunc_time_;
-        std::int64_t& exec_time_;
+        shared_counter& tfunc_time_;
+        shared_counter& exec_time_;
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
+        std::int64_t& missed_deadlines_;
         bool& is_active_;
     };
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
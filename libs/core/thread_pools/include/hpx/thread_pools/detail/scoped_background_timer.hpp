@@ -7,7 +7,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/hardware/timestamp.hpp>
+#include <hpx/timing/tsc_clock.hpp>
 
 #include <cstdint>
 
@@ -31,7 +31,7 @@ namespace hpx::threads::detail {
             if (background_exec_time_ != -1)
             {
                 background_exec_time_ +=
-                    util::hardware::timestamp() - timestamp;
+                    hpx::chrono::tsc_clock::ticks() - timestamp;
             }
         }
 
@@ -43,7 +43,7 @@ namespace hpx::threads::detail {
         explicit background_exec_time_wrapper(
             background_work_duration_counter& background_work_duration) noexcept
           : timestamp_(background_work_duration.background_exec_time_ != -1 ?
-                    util::hardware::timestamp() :
+                    hpx::chrono::tsc_clock::ticks() :
                     -1)
           , background_work_duration_(background_work_duration)
         {
@@ -11,6 +11,7 @@
 #include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/thread_pools/scheduling_loop.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/topology/cpu_mask.hpp>
 
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -219,6 +221,44 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_batches(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_batches(num, reset);
+        }
+
+        std::int64_t get_num_stolen_batch_tasks(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_batch_tasks(num, reset);
+        }
+
+        std::int64_t get_num_steal_requests_remote(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_remote(
+                num, reset);
+        }
+
+        std::int64_t get_num_steal_attempts(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_attempts(num, reset);
+        }
+
+        std::int64_t get_num_steal_successes(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_successes(num, reset);
+        }
+
+        std::vector<std::int64_t> get_steal_histogram(
+            policies::steal_histogram which, std::size_t num,
+            bool reset) override
+        {
+            return sched_->Scheduler::get_steal_histogram(which, num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
@@ -284,6 +324,20 @@ namespace hpx::threads::detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+        std::int64_t get_missed_deadline_count(
+            std::size_t num, bool reset) override;
+
+        std::int64_t get_idle_park_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_count(num, reset);
+        }
+
+        std::int64_t get_idle_unpark_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_unpark_count(num, reset);
+        }
+
         std::int64_t get_scheduler_utilization() const override;
 
     protected:
@@ -298,6 +352,12 @@ namespace hpx::threads::detail {
             std::size_t thread_num, std::shared_ptr<util::barrier> startup,
             error_code& ec = hpx::throws);
 
+        // periodically suspend or resume processing units depending on the
+        // load of the pool (see hpx.elasticity)
+        void start_elasticity_controller();
+        void stop_elasticity_controller();
+        void elasticity_controller();
+
     private:
         std::vector<std::thread> threads_;    // vector of OS-threads
 
@@ -357,9 +417,10 @@ namespace hpx::threads::detail {
             std::int64_t reset_cleanup_idle_rate_time_total_;
 #endif
 #endif
-            // tfunc_impl timers
-            std::int64_t exec_times_;
-            std::int64_t tfunc_times_;
+            // tfunc_impl timers, these are read by the elasticity controller
+            // while being updated
+            detail::shared_counter exec_times_;
+            detail::shared_counter tfunc_times_;
             std::int64_t reset_tfunc_times_;
 
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
@@ -386,11 +447,18 @@ namespace hpx::threads::detail {
             std::int64_t idle_loop_counts_;
             std::int64_t busy_loop_counts_;
 
+            // number of threads which finished after their deadline
+            std::int64_t missed_deadlines_;
+            std::int64_t reset_missed_deadlines_;
+
             // scheduler utilization data
             bool tasks_active_;
         };
 
-        std::vector<scheduling_counter_data> counter_data_;
+        // the counters are updated by their worker thread in every scheduling
+        // loop iteration, pad each entry to avoid false sharing
+        std::vector<util::cache_aligned_data_derived<scheduling_counter_data>>
+            counter_data_;
 
         // support detail::manage_executor interface
         std::atomic<long> thread_count_;
@@ -401,6 +469,13 @@ namespace hpx::threads::detail {
         std::size_t max_idle_loop_count_;
         std::size_t max_busy_loop_count_;
         std::size_t shutdown_check_count_;
+
+        // automatic adaptation of the number of active processing units
+        thread_pool_elasticity_parameters elasticity_;
+        std::thread elasticity_thread_;
+        std::mutex elasticity_mtx_;
+        std::condition_variable elasticity_cond_;
+        bool elasticity_stop_;
     };
 }    // namespace hpx::threads::detail
 
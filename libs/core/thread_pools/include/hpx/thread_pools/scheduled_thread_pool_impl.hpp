@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/affinity/affinity_data.hpp>
+#include <hpx/allocator_support/numa_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
 #include <hpx/execution_base/this_thread.hpp>
@@ -17,6 +18,7 @@
 #include <hpx/modules/schedulers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/thread_pools/scheduling_loop.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/create_work.hpp>
@@ -35,6 +37,7 @@
 #ifdef HPX_HAVE_MAX_CPU_COUNT
 #include <bitset>
 #endif
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -52,6 +55,25 @@
 
 namespace hpx::threads::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Wait for worker threads to change their state. With fast suspension
+    // enabled the state changes within microseconds, spin for a while before
+    // yielding (which eventually sleeps for milliseconds).
+    template <typename Predicate>
+    void wait_for_worker_state(policies::scheduler_base const& sched,
+        Predicate&& predicate, char const* desc)
+    {
+        if (sched.has_scheduler_mode(
+                policies::scheduler_mode::enable_fast_suspend))
+        {
+            for (std::size_t k = 0; k != 16384 && predicate(); ++k)
+            {
+                HPX_SMT_PAUSE;
+            }
+        }
+        util::yield_while(HPX_FORWARD(Predicate, predicate), desc);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct manage_active_thread_count
     {
@@ -109,6 +131,8 @@ namespace hpx::threads::detail {
       , max_idle_loop_count_(init.max_idle_loop_count_)
       , max_busy_loop_count_(init.max_busy_loop_count_)
       , shutdown_check_count_(init.shutdown_check_count_)
+      , elasticity_(init.elasticity_)
+      , elasticity_stop_(false)
     {
         sched_->set_parent_pool(this);
     }
@@ -116,6 +140,8 @@ namespace hpx::threads::detail {
     template <typename Scheduler>
     scheduled_thread_pool<Scheduler>::~scheduled_thread_pool()
     {
+        stop_elasticity_controller();
+
         if (!threads_.empty())
         {
             if (!sched_->Scheduler::has_reached_state(hpx::state::suspended))
@@ -226,6 +252,9 @@ namespace hpx::threads::detail {
     {
         LTM_(info).format("stop: {} blocking({})", id_.name(), blocking);
 
+        // the controller must not suspend any cores from now on
+        stop_elasticity_controller();
+
         if (!threads_.empty())
         {
             // wait for all work to be done before requesting threads to shut
@@ -375,10 +404,196 @@ namespace hpx::threads::detail {
             return false;
         }
 
+        start_elasticity_controller();
+
         LTM_(info).format("run: {} running", id_.name());
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::start_elasticity_controller()
+    {
+        if (!elasticity_.enabled_ || elasticity_thread_.joinable())
+            return;
+
+        // work already assigned to a core is picked up by the remaining
+        // cores only if the scheduler supports stealing
+        if (!sched_->Scheduler::has_scheduler_mode(
+                policies::scheduler_mode::enable_elasticity) ||
+            !sched_->Scheduler::has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing))
+        {
+            LTM_(warning).format("run: {} the scheduler does not support "
+                                 "elasticity, not starting the controller",
+                id_.name());
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> l(elasticity_mtx_);
+            elasticity_stop_ = false;
+        }
+
+        LTM_(info).format("run: {} starting elasticity controller (interval: "
+                          "{}ms, min_threads: {}, max_threads: {})",
+            id_.name(), elasticity_.interval_.count(),
+            elasticity_.min_threads_, elasticity_.max_threads_);
+
+        elasticity_thread_ =
+            std::thread(&scheduled_thread_pool::elasticity_controller, this);
+    }
+
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::stop_elasticity_controller()
+    {
+        if (!elasticity_thread_.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> l(elasticity_mtx_);
+            elasticity_stop_ = true;
+        }
+        elasticity_cond_.notify_all();
+        elasticity_thread_.join();
+    }
+
+    // The controller samples the load of the pool once per interval. A
+    // processing unit it has suspended before is resumed as soon as there
+    // are more pending threads than 'grow_queue_length' per active
+    // processing unit. The processing unit with the highest number is
+    // suspended if there was no pending work and the active processing units
+    // were idle for at least 'shrink_idle_rate' of the time during two
+    // consecutive intervals. Processing unit zero is never suspended as it
+    // might have to run the background work.
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::elasticity_controller()
+    {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        std::size_t const num_threads = threads_.size();
+        std::size_t const min_threads =
+            (std::max)(elasticity_.min_threads_, static_cast<std::size_t>(1));
+        std::size_t const max_threads =
+            (std::max)((std::min)(elasticity_.max_threads_, num_threads),
+                min_threads);
+
+        // only cores suspended by the controller are resumed by it
+        std::vector<bool> suspended(num_threads, false);
+        std::size_t shrink_samples = 0;
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        std::vector<std::int64_t> last_exec_times(num_threads, 0);
+        std::vector<std::int64_t> last_tfunc_times(num_threads, 0);
+#endif
+
+        std::unique_lock<std::mutex> l(elasticity_mtx_);
+        while (!elasticity_cond_.wait_for(
+            l, elasticity_.interval_, [this]() { return elasticity_stop_; }))
+        {
+            unlock_guard<std::unique_lock<std::mutex>> ul(l);
+
+            // leave the pool alone while any of its cores is changing state
+            std::size_t active = 0;
+            std::size_t first_sleeping = npos;
+            std::size_t last_running = npos;
+            bool transitioning = false;
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                hpx::state const state =
+                    sched_->Scheduler::get_state(i).load();
+                if (state == hpx::state::running)
+                {
+                    ++active;
+                    last_running = i;
+                }
+                else if (state == hpx::state::sleeping)
+                {
+                    if (first_sleeping == npos && suspended[i])
+                        first_sleeping = i;
+                }
+                else
+                {
+                    transitioning = true;
+                }
+            }
+
+            std::int64_t const queue_length =
+                sched_->Scheduler::get_queue_length(npos);
+
+            double idle_rate = queue_length == 0 ? 1.0 : 0.0;
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            std::int64_t exec_times = 0;
+            std::int64_t tfunc_times = 0;
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                scheduling_counter_data const& data = counter_data_[i];
+                std::int64_t const exec_time = data.exec_times_.load();
+                std::int64_t const tfunc_time = data.tfunc_times_.load();
+                if (sched_->Scheduler::get_state(i).load() ==
+                    hpx::state::running)
+                {
+                    exec_times += exec_time - last_exec_times[i];
+                    tfunc_times += tfunc_time - last_tfunc_times[i];
+                }
+                last_exec_times[i] = exec_time;
+                last_tfunc_times[i] = tfunc_time;
+            }
+
+            if (tfunc_times > 0)
+            {
+                idle_rate = 1.0 -
+                    static_cast<double>(exec_times) /
+                        static_cast<double>(tfunc_times);
+            }
+#endif
+
+            if (transitioning || active == 0)
+            {
+                shrink_samples = 0;
+                continue;
+            }
+
+            error_code ec(throwmode::lightweight);
+            if (active < max_threads && first_sleeping != npos &&
+                static_cast<double>(queue_length) >
+                    elasticity_.grow_queue_length_ *
+                        static_cast<double>(active))
+            {
+                shrink_samples = 0;
+
+                resume_processing_unit_direct(first_sleeping, ec);
+                if (!ec)
+                    suspended[first_sleeping] = false;
+
+                LTM_(info).format("elasticity: {} resumed processing unit {} "
+                                  "(active: {}, queue length: {})",
+                    id_.name(), first_sleeping, active, queue_length);
+            }
+            else if (last_running != 0 &&
+                (active > max_threads ||
+                    (active > min_threads && queue_length == 0 &&
+                        idle_rate >= elasticity_.shrink_idle_rate_ &&
+                        ++shrink_samples >= 2)))
+            {
+                shrink_samples = 0;
+
+                suspend_processing_unit_direct(last_running, ec);
+                if (!ec)
+                    suspended[last_running] = true;
+
+                LTM_(info).format("elasticity: {} suspended processing unit "
+                                  "{} (active: {}, idle rate: {})",
+                    id_.name(), last_running, active, idle_rate);
+            }
+            else if (queue_length != 0 ||
+                idle_rate < elasticity_.shrink_idle_rate_)
+            {
+                shrink_samples = 0;
+            }
+        }
+    }
+
     template <typename Scheduler>
     void scheduled_thread_pool<Scheduler>::resume_internal(
         bool blocking, error_code& ec)
@@ -424,6 +639,7 @@ namespace hpx::threads::detail {
             sched_->Scheduler::get_state(i).compare_exchange_strong(
                 expected, hpx::state::pre_sleep);
         }
+        sched_->Scheduler::wake_idle_threads();
 
         for (std::size_t i = 0; i != threads_.size(); ++i)
         {
@@ -477,6 +693,10 @@ namespace hpx::threads::detail {
                 id_.name(), global_thread_num);
         }
 
+        // let the NUMA-aware allocators know which domain this thread uses
+        util::detail::set_thread_numa_domain(topo.get_numa_node_number(
+            affinity_data_.get_pu_num(global_thread_num)));
+
         // Setting priority of worker threads to a lower priority, this needs to
         // be done in order to give the parcel pool threads higher priority
         if (get_scheduler()->has_scheduler_mode(
@@ -530,6 +750,7 @@ namespace hpx::threads::detail {
                     counter_data.tfunc_times_, counter_data.exec_times_,
                     counter_data.idle_loop_counts_,
                     counter_data.busy_loop_counts_,
+                    counter_data.missed_deadlines_,
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
                     counter_data.tasks_active_,
@@ -1834,6 +2055,44 @@ namespace hpx::threads::detail {
         return counter_data_[num].idle_loop_counts_;
     }
 
+    template <typename Scheduler>
+    std::int64_t scheduled_thread_pool<Scheduler>::get_missed_deadline_count(
+        std::size_t num, bool reset)
+    {
+        std::int64_t missed_deadlines = 0;
+        std::int64_t reset_missed_deadlines = 0;
+
+        if (num != static_cast<std::size_t>(-1))
+        {
+            missed_deadlines = counter_data_[num].missed_deadlines_;
+            reset_missed_deadlines = counter_data_[num].reset_missed_deadlines_;
+
+            if (reset)    //-V1051
+                counter_data_[num].reset_missed_deadlines_ = missed_deadlines;
+        }
+        else
+        {
+            missed_deadlines = accumulate_projected(counter_data_.begin(),
+                counter_data_.end(), static_cast<std::int64_t>(0),
+                &scheduling_counter_data::missed_deadlines_);
+            reset_missed_deadlines = accumulate_projected(counter_data_.begin(),
+                counter_data_.end(), static_cast<std::int64_t>(0),
+                &scheduling_counter_data::reset_missed_deadlines_);
+
+            if (reset)    //-V1051
+            {
+                copy_projected(counter_data_.begin(), counter_data_.end(),
+                    counter_data_.begin(),
+                    &scheduling_counter_data::missed_deadlines_,
+                    &scheduling_counter_data::reset_missed_deadlines_);
+            }
+        }
+
+        HPX_ASSERT(missed_deadlines >= reset_missed_deadlines);
+
+        return missed_deadlines - reset_missed_deadlines;
+    }
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_busy_loop_count(
         std::size_t num, bool /* reset */)
@@ -2024,7 +2283,13 @@ namespace hpx::threads::detail {
             expected == hpx::state::pre_sleep ||
             expected == hpx::state::sleeping);
 
-        util::yield_while(
+        if (expected == hpx::state::running)
+        {
+            sched_->Scheduler::wake_idle_threads();
+        }
+
+        wait_for_worker_state(
+            *sched_,
             [&state]() { return state.load() == hpx::state::pre_sleep; },
             "scheduled_thread_pool::suspend_processing_unit_direct");
     }
@@ -2055,7 +2320,8 @@ namespace hpx::threads::detail {
         std::atomic<hpx::state>& state =
             sched_->Scheduler::get_state(virt_core);
 
-        util::yield_while(
+        wait_for_worker_state(
+            *sched_,
             [this, &state, virt_core]() {
                 this->sched_->Scheduler::resume(virt_core);
                 return state.load() == hpx::state::sleeping;
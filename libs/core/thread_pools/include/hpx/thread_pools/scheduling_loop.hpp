@@ -8,23 +8,32 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/epoch.hpp>
 #include <hpx/execution_base/this_thread.hpp>
-#include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/thread_pools/detail/background_thread.hpp>
 #include <hpx/thread_pools/detail/scheduling_callbacks.hpp>
 #include <hpx/thread_pools/detail/scheduling_counters.hpp>
 #include <hpx/thread_pools/detail/scheduling_log.hpp>
 #include <hpx/threading_base/detail/switch_status.hpp>
+#include <hpx/threading_base/preemption.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/tsc_clock.hpp>
 
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+#include <hpx/threading_base/task_counter_hooks.hpp>
+#endif
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/task_tracer.hpp>
+#endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -37,8 +46,8 @@ namespace hpx::threads::detail {
     struct idle_collect_rate
     {
         idle_collect_rate(
-            std::int64_t& tfunc_time, std::int64_t& exec_time) noexcept
-          : start_timestamp_(util::hardware::timestamp())
+            shared_counter& tfunc_time, shared_counter& exec_time) noexcept
+          : start_timestamp_(hpx::chrono::tsc_clock::ticks())
           , tfunc_time_(tfunc_time)
           , exec_time_(exec_time)
         {
@@ -46,33 +55,34 @@ namespace hpx::threads::detail {
 
         void collect_exec_time(std::int64_t timestamp) const noexcept
         {
-            exec_time_ += util::hardware::timestamp() - timestamp;
+            exec_time_ += hpx::chrono::tsc_clock::ticks() - timestamp;
         }
 
         void take_snapshot() noexcept
         {
             if (tfunc_time_ == static_cast<std::int64_t>(-1))
             {
-                start_timestamp_ = util::hardware::timestamp();
+                start_timestamp_ = hpx::chrono::tsc_clock::ticks();
                 tfunc_time_ = 0;
                 exec_time_ = 0;
             }
             else
             {
-                tfunc_time_ = util::hardware::timestamp() - start_timestamp_;
+                tfunc_time_ =
+                    hpx::chrono::tsc_clock::ticks() - start_timestamp_;
             }
         }
 
         std::int64_t start_timestamp_;
 
-        std::int64_t& tfunc_time_;
-        std::int64_t& exec_time_;
+        shared_counter& tfunc_time_;
+        shared_counter& exec_time_;
     };
 
     struct exec_time_wrapper
     {
         explicit exec_time_wrapper(idle_collect_rate& idle_rate) noexcept
-          : timestamp_(util::hardware::timestamp())
+          : timestamp_(hpx::chrono::tsc_clock::ticks())
           , idle_rate_(idle_rate)
         {
         }
@@ -117,7 +127,7 @@ namespace hpx::threads::detail {
     struct idle_collect_rate
     {
         explicit constexpr idle_collect_rate(
-            std::int64_t&, std::int64_t&) noexcept
+            shared_counter&, shared_counter&) noexcept
         {
         }
     };
@@ -275,6 +285,11 @@ namespace hpx::threads::detail {
                             {
                                 is_active_wrapper utilization(
                                     counters.is_active_);
+
+                                // restart the time slice used for cooperative
+                                // preemption
+                                threads::detail::begin_time_slice();
+
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
                                 util::itt::caller_context cctx(ctx);
                                 // util::itt::undo_frame_context undoframe(fctx);
@@ -290,6 +305,19 @@ namespace hpx::threads::detail {
                                 [[maybe_unused]] exec_time_wrapper
                                     exec_time_collector(idle_rate);
 
+#if defined(HPX_HAVE_TASK_TRACING)
+                                tracing::task_begin(thrdptr);
+#endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+                                std::int64_t const phase_started =
+                                    thrdptr->begin_annotation_phase();
+#endif
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+                                // read the counters as close as possible to
+                                // the execution of the thread
+                                task_counter_hooks const* counter_hooks =
+                                    threads::begin_task_counters();
+#endif
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -317,6 +345,18 @@ namespace hpx::threads::detail {
                                 }
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
+#endif
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+                                threads::end_task_counters(counter_hooks,
+                                    thrdptr, thrd_stat.get_previous());
+#endif
+#if defined(HPX_HAVE_TASK_TRACING)
+                                tracing::task_end(
+                                    thrdptr, thrd_stat.get_previous());
+#endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+                                thrdptr->end_annotation_phase(
+                                    phase_started, thrd_stat.get_previous());
 #endif
                             }
 
@@ -454,6 +494,12 @@ namespace hpx::threads::detail {
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
                     ++counters.executed_threads_;
 #endif
+                    if (thrdptr->has_deadline() &&
+                        std::chrono::steady_clock::now() >
+                            thrdptr->get_deadline())
+                    {
+                        ++counters.missed_deadlines_;
+                    }
                     HPX_ASSERT(!thrdptr->runs_as_child());
                     thrd = thread_id_type();
                 }
@@ -572,6 +618,18 @@ namespace hpx::threads::detail {
                 idle_loop_count = 0;
             }
 
+            // expire the timers of the scheduler that are due, this makes the
+            // threads waiting for them pending
+            if (scheduler.poll_timers())
+            {
+                idle_loop_count = 0;
+            }
+
+            // no HPX thread is running on this worker thread, which allows
+            // to advance the epoch used for reclaiming the nodes of lock-free
+            // data structures
+            hpx::lockfree::epoch::quiescent_state();
+
             // something went badly wrong, give up
             if (HPX_UNLIKELY(this_state.load(std::memory_order_relaxed) ==
                     hpx::state::terminating))
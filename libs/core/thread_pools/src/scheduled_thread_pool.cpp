@@ -6,9 +6,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/deadline_queue_backends.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
 #include <hpx/schedulers/local_workrequesting_scheduler.hpp>
+#include <hpx/schedulers/priority_queue_backends.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
@@ -35,6 +37,13 @@ template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
         hpx::threads::policies::lockfree_fifo>>;
 
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::deadline_fifo>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::deadline_fifo>>;
+
 template class HPX_CORE_EXPORT
     hpx::threads::policies::static_priority_queue_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
@@ -68,6 +77,13 @@ template class HPX_CORE_EXPORT
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
 
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::shared_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::multiqueue_priority<>>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::shared_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::multiqueue_priority<>>>;
+
 template class HPX_CORE_EXPORT
     hpx::threads::policies::local_workrequesting_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
@@ -119,9 +119,12 @@ namespace hpx {
         using result_type = detail::annotated_function<std::decay_t<F>>;
 
         // Store string in a set to ensure it lives for the entire duration of
-        // the task.
-        char const* name_c_str =
-            hpx::detail::store_function_annotation(HPX_MOVE(name));
+        // the task. This is skipped if annotations are currently disabled
+        // (see hpx::register_annotation for annotating many tasks with the
+        // same dynamically created name).
+        char const* name_c_str = annotations_enabled() ?
+            hpx::detail::store_function_annotation(HPX_MOVE(name)) :
+            nullptr;
         return result_type(HPX_FORWARD(F, f), name_c_str);
     }
 
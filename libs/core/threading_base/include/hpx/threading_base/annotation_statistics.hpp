@@ -0,0 +1,123 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx::threads {
+
+    // The histograms recorded for every thread annotation (description)
+    enum class annotation_histogram : std::uint8_t
+    {
+        // overall time spent executing the thread, summed over all of its
+        // phases [ns]
+        execution_time = 0,
+
+        // time between creating the thread and running it for the first
+        // time [ns]
+        wait_time = 1,
+
+        // number of times the thread was suspended before it terminated
+        suspensions = 2
+    };
+
+    // The histograms use HDR-style logarithmic buckets: every power of two
+    // range is split into 2^annotation_histogram_sub_bucket_bits buckets of
+    // equal size, which bounds the relative error of percentiles derived from
+    // the histogram to 1/2^annotation_histogram_sub_bucket_bits (12.5%).
+    // Values below 2^(annotation_histogram_sub_bucket_bits + 1) are counted
+    // exactly.
+    inline constexpr std::size_t annotation_histogram_sub_bucket_bits = 3;
+    inline constexpr std::size_t annotation_histogram_sub_buckets =
+        std::size_t(1) << annotation_histogram_sub_bucket_bits;
+    inline constexpr std::size_t annotation_histogram_num_buckets =
+        (64 - annotation_histogram_sub_bucket_bits + 1) *
+        annotation_histogram_sub_buckets;
+
+    // Return the index of the bucket counting the given value
+    constexpr std::size_t get_annotation_histogram_bucket(
+        std::uint64_t value) noexcept
+    {
+        if (value < annotation_histogram_sub_buckets)
+        {
+            return static_cast<std::size_t>(value);
+        }
+
+        // find the position of the most significant bit
+        std::size_t msb = 0;
+        for (std::size_t shift = 32; shift != 0; shift /= 2)
+        {
+            if ((value >> (msb + shift)) != 0)
+            {
+                msb += shift;
+            }
+        }
+
+        std::size_t const sub_bucket =
+            static_cast<std::size_t>(
+                value >> (msb - annotation_histogram_sub_bucket_bits)) &
+            (annotation_histogram_sub_buckets - 1);
+        return (msb - annotation_histogram_sub_bucket_bits + 1) *
+            annotation_histogram_sub_buckets +
+            sub_bucket;
+    }
+
+    // Return the smallest value counted by the given bucket
+    constexpr std::uint64_t get_annotation_histogram_lower_bound(
+        std::size_t bucket) noexcept
+    {
+        if (bucket < annotation_histogram_sub_buckets)
+        {
+            return bucket;
+        }
+
+        std::size_t const msb = bucket / annotation_histogram_sub_buckets +
+            annotation_histogram_sub_bucket_bits - 1;
+        std::uint64_t const sub_bucket =
+            bucket % annotation_histogram_sub_buckets;
+        return (annotation_histogram_sub_buckets + sub_bucket)
+            << (msb - annotation_histogram_sub_bucket_bits);
+    }
+
+    // Return the largest value counted by the given bucket
+    constexpr std::uint64_t get_annotation_histogram_upper_bound(
+        std::size_t bucket) noexcept
+    {
+        return bucket + 1 == annotation_histogram_num_buckets ?
+            ~std::uint64_t(0) :
+            get_annotation_histogram_lower_bound(bucket + 1) - 1;
+    }
+
+    // Return the value below which the given percentage of the values
+    // counted by the histogram (as returned by get_annotation_histogram)
+    // fall. The result is the upper bound of the corresponding bucket, zero
+    // is returned for an empty histogram.
+    HPX_CORE_EXPORT std::int64_t get_annotation_histogram_percentile(
+        std::vector<std::int64_t> const& buckets, double percentile) noexcept;
+
+    // Record the statistics of a terminated thread with the given
+    // annotation
+    HPX_CORE_EXPORT void record_annotation_statistics(char const* annotation,
+        std::int64_t execution_time, std::int64_t wait_time,
+        std::int64_t suspensions) noexcept;
+
+    // Return the histogram for the given annotation, the result is empty if
+    // no thread with this annotation has terminated so far
+    HPX_CORE_EXPORT std::vector<std::int64_t> get_annotation_histogram(
+        std::string const& annotation, annotation_histogram which, bool reset);
+
+    // Return the annotations of all threads which have terminated so far
+    HPX_CORE_EXPORT std::vector<std::string> get_recorded_annotations();
+}    // namespace hpx::threads
+
+#endif
@@ -0,0 +1,33 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+
+namespace hpx::threads::detail {
+
+    // Install the pools used for the quality of service mode of the
+    // resource partitioner (see hpx.qos.enabled). Latency-class work
+    // (high priority threads) created on either of the pools is routed
+    // to the latency pool, all other work is routed to the bulk pool.
+    // If lending is enabled, new work is placed on the other pool if
+    // its own pool has no idle cores but the other one has (the latency
+    // pool keeps at least lend_reserve cores for latency-class work).
+    HPX_CORE_EXPORT void set_qos_pools(thread_pool_base* latency_pool,
+        thread_pool_base* bulk_pool, bool lending,
+        std::size_t lend_reserve) noexcept;
+    HPX_CORE_EXPORT void reset_qos_pools() noexcept;
+
+    // Return the pool the given work should be created on, adjusts the
+    // scheduling hint of work which is moved to another pool
+    HPX_CORE_EXPORT thread_pool_base* route_qos(
+        thread_init_data& data, thread_pool_base* pool) noexcept;
+}    // namespace hpx::threads::detail
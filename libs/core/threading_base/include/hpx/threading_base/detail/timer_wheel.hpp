@@ -0,0 +1,163 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A timer registered with a timer_wheel. The node is owned by the code
+    // registering it, it has to stay alive until it has either been removed
+    // from the wheel or until its expire function has been called.
+    struct timer_wheel_node
+    {
+        // expired is false if the wheel is destroyed before the timer
+        // expired
+        using expire_function = void (*)(
+            timer_wheel_node*, bool expired) noexcept;
+
+        explicit constexpr timer_wheel_node(expire_function f) noexcept
+          : expire(f)
+        {
+        }
+
+        timer_wheel_node* next = nullptr;
+        timer_wheel_node** pprev = nullptr;    // nullptr if not linked
+        std::uint64_t expiry = 0;              // in ticks of the wheel
+        std::uint32_t slot = 0;
+        expire_function expire;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical timing wheel (see G. Varghese and T. Lauck, "Hashed and
+    // Hierarchical Timing Wheels"). Each level has 64 slots, a slot on level
+    // n covers 64^n ticks. Adding and removing a timer is O(1), timers are
+    // moved to the next lower level once the time covered by their slot has
+    // been reached. Timers further in the future than covered by the wheel
+    // are added to the last slot of the top level and are re-inserted once
+    // that slot is reached.
+    //
+    // The wheel does not use a thread of its own. Expired timers are
+    // collected in batches by whoever advances the wheel, usually the
+    // scheduling loop of the worker threads (see poll). Only one thread
+    // advances the wheel at any point in time, others skip it.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        static constexpr std::uint32_t slot_bits = 6;
+        static constexpr std::uint32_t num_slots = 1 << slot_bits;
+        static constexpr std::uint32_t num_levels = 4;
+
+        explicit timer_wheel(clock_type::duration resolution =
+                                 std::chrono::microseconds(100),
+            clock_type::time_point start = clock_type::now()) noexcept;
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        // calls the expire function of all remaining timers with
+        // expired == false
+        ~timer_wheel();
+
+        // Add the given timer, it will expire once the wheel has been
+        // advanced past the given point in time (which may have passed
+        // already). Returns whether the timer is due before any other timer
+        // in the wheel, in which case threads waiting for the wheel to
+        // become due might have to be woken up.
+        bool add(timer_wheel_node* node, clock_type::time_point expiry);
+
+        // Remove the given timer, returns false if the timer has expired
+        // already (or is about to expire), in which case its expire function
+        // is or will be called.
+        bool remove(timer_wheel_node* node);
+
+        // Expire all timers due at the given point in time. Returns the
+        // number of expired timers, returns zero without doing anything if
+        // another thread is advancing the wheel concurrently.
+        std::size_t advance(clock_type::time_point now);
+
+        // Advance the wheel to the current time if any of the timers might
+        // be due, returns whether timers have expired.
+        bool poll()
+        {
+            if (count_.load(std::memory_order_relaxed) == 0)
+            {
+                return false;
+            }
+
+            clock_type::time_point const now = clock_type::now();
+            if (to_ticks(now) < next_due_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            return advance(now) != 0;
+        }
+
+        // Returns a point in time before or at which the next timer will be
+        // due, or time_point::max() if the wheel is empty.
+        clock_type::time_point next_due() const noexcept;
+
+        std::size_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        std::uint64_t to_ticks(clock_type::time_point t) const noexcept
+        {
+            return t <= start_ ?
+                0 :
+                static_cast<std::uint64_t>((t - start_) / resolution_);
+        }
+
+        // all functions below have to be called while holding the lock
+        std::uint64_t insert(timer_wheel_node* node) noexcept;
+        void unlink(timer_wheel_node* node) noexcept;
+        timer_wheel_node* take_slot(std::uint32_t slot) noexcept;
+        std::uint64_t next_event() const noexcept;
+
+        using mutex_type = hpx::util::detail::spinlock;
+
+        clock_type::time_point const start_;
+        clock_type::duration const resolution_;
+
+        std::atomic<std::size_t> count_{0};
+
+        // lower bound of the tick at which the next timer has to be
+        // expired or moved to a lower level
+        std::atomic<std::uint64_t> next_due_;
+
+        mutex_type mtx_;
+
+        // all timers expiring at or before this tick have been expired
+        std::uint64_t current_ = 0;
+
+        // bitmask of non-empty slots per level
+        std::uint64_t occupied_[num_levels] = {};
+        timer_wheel_node* slots_[num_levels * num_slots] = {};
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,42 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <chrono>
+
+namespace hpx::threads {
+
+    /// Set the time slice after which long running threads calling
+    /// hpx::this_thread::check_preempt yield to other work (see
+    /// hpx.preemption_time_slice). A time slice of zero disables cooperative
+    /// preemption.
+    HPX_CORE_EXPORT void set_preemption_time_slice(
+        std::chrono::microseconds slice) noexcept;
+    HPX_CORE_EXPORT std::chrono::microseconds
+    get_preemption_time_slice() noexcept;
+
+    namespace detail {
+
+        // Called by the scheduling loop whenever a thread is (re-)activated,
+        // restarts the time slice of the running thread.
+        HPX_CORE_EXPORT void begin_time_slice() noexcept;
+    }    // namespace detail
+}    // namespace hpx::threads
+
+namespace hpx::this_thread {
+
+    /// Cooperative preemption point for long running computations. The
+    /// calling HPX thread yields if work with a higher priority is waiting on
+    /// the current core or if the thread has been running for longer than
+    /// the configured time slice. This function does nothing if called
+    /// outside of an HPX thread or if cooperative preemption is disabled.
+    ///
+    /// \returns Whether the calling thread was suspended.
+    HPX_CORE_EXPORT bool check_preempt();
+}    // namespace hpx::this_thread
@@ -12,8 +12,10 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_telemetry.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -106,12 +108,77 @@ namespace hpx::threads::policies {
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        // return the number of times the given worker thread (or all worker
+        // threads, if num_thread == -1) was parked and explicitly woken up
+        // while idling (see scheduler_mode::enable_idle_parking)
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_unpark_count(std::size_t num_thread, bool reset);
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // return the number of steal attempts and of successful steals of the
+        // given worker thread (or all worker threads, if num_thread == -1)
+        std::int64_t get_num_steal_attempts(std::size_t num_thread, bool reset);
+        std::int64_t get_num_steal_successes(
+            std::size_t num_thread, bool reset);
+
+        // return the bucket counts of the given steal histogram of the given
+        // worker thread (or all worker threads, if num_thread == -1), see
+        // steal_telemetry.hpp
+        std::vector<std::int64_t> get_steal_histogram(
+            steal_histogram which, std::size_t num_thread, bool reset);
+#endif
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
+        // wake up all worker threads which are idling (backing off or being
+        // parked) to make them notice a change of their state early
+        void wake_idle_threads() noexcept;
+
         std::size_t select_active_pu(
             std::size_t num_thread, bool allow_fallback = false);
 
+        // Remember the NUMA domain of the processing unit the given worker
+        // thread runs on, this is used to resolve NUMA scheduling hints.
+        void set_numa_domain(std::size_t num_thread, std::size_t domain);
+
+        // Select a worker thread that runs on the given NUMA domain (see
+        // thread_schedule_hint_mode::numa). The calling worker thread is
+        // preferred if it belongs to that domain. Returns -1 if none of the
+        // worker threads of this scheduler runs on the given domain.
+        std::size_t select_numa_thread(std::size_t domain) noexcept;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // Determine the topological distance between the given worker thread
+        // and all other worker threads of this scheduler.
+        void init_steal_telemetry(std::size_t num_thread,
+            detail::affinity_data const& affinity_data);
+
+        // Record that the given worker thread looks for work on other worker
+        // threads. Only the first call after the worker thread has run out of
+        // work starts (and counts) a new steal attempt.
+        void record_steal_attempt(std::size_t num_thread) noexcept;
+
+        // Record that the given worker thread has found work in its own
+        // queues, which ends its current steal attempt (if any).
+        void end_steal_attempt(std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT(num_thread < steal_telemetry_.size());
+
+            auto& data = steal_telemetry_[num_thread].data_;
+            if (data.attempt_started_ != 0)
+            {
+                data.attempt_started_ = 0;
+            }
+        }
+
+        // Record that the given worker thread has received num_tasks
+        // HPX-threads from the worker thread victim as the result of its last
+        // steal attempt.
+        void record_steal(std::size_t num_thread, std::size_t victim,
+            std::size_t num_tasks) noexcept;
+#endif
+
         // allow to access/manipulate states
         std::atomic<hpx::state>& get_state(std::size_t num_thread);
         std::atomic<hpx::state> const& get_state(std::size_t num_thread) const;
@@ -158,8 +225,8 @@ namespace hpx::threads::policies {
 
         pu_mutex_type& get_pu_mutex(std::size_t num_thread) noexcept
         {
-            HPX_ASSERT(num_thread < pu_mtxs_.size());
-            return pu_mtxs_[num_thread];
+            HPX_ASSERT(num_thread < workers_.size());
+            return workers_[num_thread].data_.pu_mtx_;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -182,6 +249,27 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // only schedulers that hand over several tasks at once in response
+        // to a single steal request report these
+        virtual std::int64_t get_num_stolen_batches(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_batch_tasks(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+
+        // only schedulers selecting victims based on the NUMA topology report
+        // this
+        virtual std::int64_t get_num_steal_requests_remote(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -196,6 +284,15 @@ namespace hpx::threads::policies {
         // Queries whether a given core is idle
         virtual bool is_core_idle(std::size_t num_thread) const = 0;
 
+        // Queries whether work with a higher priority than the given one is
+        // waiting in the queues of the given core (used for cooperative
+        // preemption, see hpx::this_thread::check_preempt)
+        virtual bool has_higher_priority_work(std::size_t /* num_thread */,
+            thread_priority /* priority */) const noexcept
+        {
+            return false;
+        }
+
         // count active background threads
         std::int64_t get_background_thread_count() const noexcept;
         void increment_background_thread_count() noexcept;
@@ -245,6 +342,12 @@ namespace hpx::threads::policies {
         std::ptrdiff_t get_stack_size(
             threads::thread_stacksize stacksize) const noexcept;
 
+        // Replace the default stack size requested for a new thread with the
+        // smallest stack size class that has been sufficient for earlier
+        // threads with the same description (if hpx.stacks.auto_select is
+        // enabled).
+        void select_stack_size(thread_init_data& data) const noexcept;
+
         using polling_function_ptr = detail::polling_status (*)();
         using polling_work_count_function_ptr = std::size_t (*)();
 
@@ -267,10 +370,28 @@ namespace hpx::threads::policies {
         void set_sycl_polling_functions(polling_function_ptr sycl_func,
             polling_work_count_function_ptr sycl_work_count_func);
         void clear_sycl_polling_function();
+        void set_io_uring_polling_functions(polling_function_ptr io_uring_func,
+            polling_work_count_function_ptr io_uring_work_count_func);
+        void clear_io_uring_polling_function();
 
         detail::polling_status custom_polling_function() const;
         std::size_t get_polling_work_count() const;
 
+        // The timers used for timed thread state changes (if
+        // scheduler_mode::enable_timer_wheel is set), they are expired by the
+        // scheduling loop of the worker threads.
+        threads::detail::timer_wheel& get_timer_wheel() noexcept
+        {
+            return timers_;
+        }
+
+        // expire the timers that are due, returns whether any timers have
+        // expired
+        bool poll_timers()
+        {
+            return timers_.poll();
+        }
+
         // almost all schedulers support direct execution
         virtual bool supports_direct_execution() const noexcept
         {
@@ -291,15 +412,58 @@ namespace hpx::threads::policies {
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for parking idle worker threads
+        void park_idle_thread(std::size_t num_thread);
+        bool unpark_idle_thread(std::size_t num_thread) noexcept;
+        void unpark_all_idle_threads() noexcept;
+
+        struct idle_parking_data
+        {
+            // a parked thread waits for this to become zero
+            std::atomic<std::uint32_t> parked_{0};
+#if !defined(__linux__)
+            pu_mutex_type mtx_;
+            std::condition_variable cond_;
+#endif
+            std::atomic<std::int64_t> parks_{0};
+            std::atomic<std::int64_t> unparks_{0};
+        };
+        std::vector<util::cache_line_data<idle_parking_data>> parking_data_;
+        util::cache_line_data<std::atomic<std::uint32_t>> num_parked_;
 #endif
 
-        // support for suspension of pus
-        std::vector<pu_mutex_type> suspend_mtxs_;
-        std::vector<std::condition_variable> suspend_conds_;
+        // state of a single worker thread, the entries for different worker
+        // threads never share a cache line
+        struct worker_data
+        {
+            std::atomic<hpx::state> state_{hpx::state::initialized};
+
+            // NUMA domain of the worker thread (-1 if not known yet)
+            std::atomic<std::size_t> numa_domain_{
+                static_cast<std::size_t>(-1)};
+
+            pu_mutex_type pu_mtx_;
+
+            // support for suspension of pus
+            pu_mutex_type suspend_mtx_;
+            std::condition_variable suspend_cond_;
+
+            // a suspended thread waits for this to become zero (see
+            // scheduler_mode::enable_fast_suspend)
+            std::atomic<std::uint32_t> suspended_{0};
+        };
+        std::vector<util::cache_line_data<worker_data>> workers_;
 
-        std::vector<pu_mutex_type> pu_mtxs_;
+        void resume_worker(worker_data& worker) noexcept;
+
+        std::atomic<std::size_t> numa_next_thread_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        std::vector<util::cache_line_data<detail::steal_telemetry_data>>
+            steal_telemetry_;
+#endif
 
-        std::vector<util::cache_line_data<std::atomic<hpx::state>>> states_;
         char const* description_;
 
         thread_queue_init_parameters thread_queue_init_;
@@ -309,15 +473,20 @@ namespace hpx::threads::policies {
 
         std::atomic<std::int64_t> background_thread_count_;
 
+        threads::detail::timer_wheel timers_;
+
         std::atomic<polling_function_ptr> polling_function_mpi_;
         std::atomic<polling_function_ptr> polling_function_cuda_;
         std::atomic<polling_function_ptr> polling_function_sycl_;
+        std::atomic<polling_function_ptr> polling_function_io_uring_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_mpi_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_cuda_;
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_sycl_;
+        std::atomic<polling_work_count_function_ptr>
+            polling_work_count_function_io_uring_;
 
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
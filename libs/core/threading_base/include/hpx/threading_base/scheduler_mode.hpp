@@ -80,6 +80,25 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// This option makes idling worker threads park themselves (sleep
+        /// until woken up) once they ran out of work for some time instead of
+        /// using exponential idle-back off. Parked threads are woken up one at
+        /// a time whenever new work is added.
+        enable_idle_parking = 0x2000,
+
+        /// This option makes timed thread state changes (e.g. sleep_for or
+        /// timed waits) use a timing wheel owned by the scheduler whose
+        /// expired timers are handled by the scheduling loop of the worker
+        /// threads instead of one timer per timed wait on the timer service.
+        enable_timer_wheel = 0x4000,
+
+        /// This option makes suspended worker threads briefly spin and then
+        /// park themselves on an atomic flag (a futex on Linux) instead of
+        /// waiting on a condition variable, which allows to resume them with
+        /// a latency of a few microseconds. The worker threads keep their
+        /// thread local storage and stacks while being suspended.
+        enable_fast_suspend = 0x8000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -106,7 +125,10 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            enable_idle_parking |
+            enable_timer_wheel |
+            enable_fast_suspend
         // clang-format on
     };
 
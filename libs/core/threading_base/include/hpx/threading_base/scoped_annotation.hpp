@@ -22,6 +22,9 @@
 #endif
 #endif
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+#include <atomic>
+#endif
 #include <string>
 #include <type_traits>
 
@@ -30,8 +33,52 @@ namespace hpx {
     namespace detail {
 
         HPX_CORE_EXPORT char const* store_function_annotation(std::string name);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+        HPX_CORE_EXPORT extern std::atomic<bool> annotations_enabled;
+#endif
     }    // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Return whether annotations (see \a scoped_annotation and
+    ///        \a annotated_function) are currently being recorded.
+    ///
+    /// If HPX was configured with HPX_WITH_THREAD_DESCRIPTION_RUNTIME_SWITCH,
+    /// annotations are recorded only while they are enabled at runtime, they
+    /// don't cost more than checking this flag otherwise. Without the runtime
+    /// switch, annotations are recorded if HPX was configured to support
+    /// thread descriptions (e.g. HPX_WITH_THREAD_DEBUG_INFO or
+    /// HPX_WITH_APEX) and are compiled out otherwise.
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+    HPX_FORCEINLINE bool annotations_enabled() noexcept
+    {
+        return detail::annotations_enabled.load(std::memory_order_relaxed);
+    }
+#else
+    constexpr bool annotations_enabled() noexcept
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return true;
+#else
+        return false;
+#endif
+    }
+#endif
+
+    /// \brief Enable or disable recording annotations at runtime, returns
+    ///        whether annotations were enabled before. This has no effect
+    ///        unless HPX was configured with
+    ///        HPX_WITH_THREAD_DESCRIPTION_RUNTIME_SWITCH.
+    HPX_CORE_EXPORT bool set_annotations_enabled(bool enable) noexcept;
+
+    /// \brief Intern the given annotation, returns a string which stays valid
+    ///        for the lifetime of the process and which can be used as a
+    ///        (cheap to copy) annotation of any number of tasks.
+    ///
+    /// Registering dynamically created annotations once avoids storing the
+    /// string each time a task is annotated.
+    HPX_CORE_EXPORT char const* register_annotation(std::string name);
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_COMPUTE_DEVICE_CODE)
@@ -119,11 +166,15 @@ namespace hpx {
 
         explicit scoped_annotation(char const* name)
         {
-            auto const* self = hpx::threads::get_self_ptr();
-            if (self != nullptr)
+            if (!annotations_enabled())
             {
-                desc_ = threads::get_thread_id_data(self->get_thread_id())
-                            ->set_description(name);
+                return;
+            }
+
+            thrd_ = get_self_thread_data();
+            if (thrd_ != nullptr)
+            {
+                desc_ = thrd_->set_description(name);
             }
 
 #if defined(HPX_HAVE_APEX)
@@ -135,8 +186,13 @@ namespace hpx {
 
         explicit scoped_annotation(std::string name)
         {
-            auto const* self = hpx::threads::get_self_ptr();
-            if (self != nullptr)
+            if (!annotations_enabled())
+            {
+                return;
+            }
+
+            thrd_ = get_self_thread_data();
+            if (thrd_ != nullptr)
             {
                 char const* name_c_str =
 #if defined(HPX_HAVE_APEX)
@@ -144,8 +200,7 @@ namespace hpx {
 #else
                     detail::store_function_annotation(HPX_MOVE(name));
 #endif
-                desc_ = threads::get_thread_id_data(self->get_thread_id())
-                            ->set_description(name_c_str);
+                desc_ = thrd_->set_description(name_c_str);
             }
 
 #if defined(HPX_HAVE_APEX)
@@ -160,12 +215,16 @@ namespace hpx {
                 std::enable_if_t<!std::is_same_v<std::decay_t<F>, std::string>>>
         explicit scoped_annotation(F&& f)
         {
-            auto const* self = hpx::threads::get_self_ptr();
-            if (self != nullptr)
+            if (!annotations_enabled())
             {
-                desc_ =
-                    threads::get_thread_id_data(self->get_thread_id())
-                        ->set_description(hpx::threads::thread_description(f));
+                return;
+            }
+
+            thrd_ = get_self_thread_data();
+            if (thrd_ != nullptr)
+            {
+                desc_ = thrd_->set_description(
+                    hpx::threads::thread_description(f));
             }
 
 #if defined(HPX_HAVE_APEX)
@@ -176,14 +235,23 @@ namespace hpx {
 
         ~scoped_annotation()
         {
-            auto const* self = hpx::threads::get_self_ptr();
-            if (self != nullptr)
+            if (thrd_ != nullptr)
             {
-                threads::get_thread_id_data(self->get_thread_id())
-                    ->set_description(desc_);
+                thrd_->set_description(desc_);
             }
         }
 
+    private:
+        static threads::thread_data* get_self_thread_data() noexcept
+        {
+            auto const* self = hpx::threads::get_self_ptr();
+            return self != nullptr ?
+                threads::get_thread_id_data(self->get_thread_id()) :
+                nullptr;
+        }
+
+        // the annotated thread, nullptr if no annotation was recorded
+        threads::thread_data* thrd_ = nullptr;
         hpx::threads::thread_description desc_;
     };
 #endif
@@ -0,0 +1,83 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::threads::policies {
+
+    // Topological distance between a worker thread and the victim it took
+    // work from
+    enum class steal_distance : std::uint8_t
+    {
+        core = 0,           // the victim runs on the same physical core
+        numa_domain = 1,    // the victim runs in the same NUMA domain
+        remote = 2          // the victim runs in a different NUMA domain
+    };
+
+    // The histograms recorded for successful steals
+    enum class steal_histogram : std::uint8_t
+    {
+        // one bucket per steal_distance
+        victim_distance = 0,
+
+        // number of HPX-threads taken by a single steal
+        stolen_tasks = 1,
+
+        // time between starting a steal attempt and receiving the stolen
+        // work [ns]
+        time_to_steal = 2
+    };
+
+    // The histograms of the number of stolen tasks and of the time to steal
+    // use buckets of exponentially growing size: bucket zero counts values of
+    // zero, bucket i counts values v with 2^(i-1) <= v < 2^i. The last bucket
+    // counts all values that do not fit any of the other buckets.
+    inline constexpr std::size_t steal_histogram_num_buckets = 32;
+
+    // Return the number of buckets of the given histogram
+    constexpr std::size_t get_steal_histogram_size(
+        steal_histogram which) noexcept
+    {
+        return which == steal_histogram::victim_distance ?
+            3 :
+            steal_histogram_num_buckets;
+    }
+
+    namespace detail {
+
+        // Steal statistics of a single worker thread. The values are updated
+        // by the owning worker thread only, but may be read (and reset) by any
+        // thread.
+        struct steal_telemetry_data
+        {
+            using bucket_type = std::atomic<std::int64_t>;
+
+            std::atomic<std::int64_t> attempts_{0};
+            std::atomic<std::int64_t> successes_{0};
+
+            std::array<bucket_type, 3> victim_distance_{};
+            std::array<bucket_type, steal_histogram_num_buckets>
+                stolen_tasks_{};
+            std::array<bucket_type, steal_histogram_num_buckets>
+                time_to_steal_{};
+
+            // start of the current steal attempt, i.e. the time the worker
+            // thread ran out of work (zero if it is not looking for work)
+            std::int64_t attempt_started_ = 0;
+
+            // distance to all other worker threads of the scheduler
+            std::vector<steal_distance> distances_;
+        };
+    }    // namespace detail
+}    // namespace hpx::threads::policies
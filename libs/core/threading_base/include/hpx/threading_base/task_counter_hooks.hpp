@@ -0,0 +1,76 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::threads {
+
+    // Callbacks invoked by the worker threads around the execution of the
+    // sampled HPX threads, allows reading (hardware) counters for attributing
+    // them to the annotation of the executed thread.
+    struct task_counter_hooks
+    {
+        // called right before a sampled HPX thread is executed (or resumed)
+        void (*begin)() noexcept;
+
+        // called right after the sampled HPX thread has returned control to
+        // the scheduler, the annotation is nullptr for threads without one
+        void (*end)(
+            char const* annotation, thread_schedule_state state) noexcept;
+    };
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<task_counter_hooks const*>
+            task_counter_hooks_ptr;
+
+        // Decide whether the next execution phase is sampled, calls the
+        // begin hook if it is
+        HPX_CORE_EXPORT task_counter_hooks const*
+        sample_task_counters() noexcept;
+
+        HPX_CORE_EXPORT void end_task_counters(task_counter_hooks const* hooks,
+            thread_data const* thrd, thread_schedule_state state) noexcept;
+    }    // namespace detail
+
+    // Install the hooks which are invoked around every sampling_rate'th
+    // execution phase of the HPX threads run by each worker thread. Passing
+    // nullptr removes the hooks. The hooks have to stay valid for as long as
+    // the runtime is running.
+    HPX_CORE_EXPORT void set_task_counter_hooks(
+        task_counter_hooks const* hooks, std::size_t sampling_rate = 1);
+
+    // hooks used by the scheduling loop, the result of begin_task_counters
+    // has to be passed to end_task_counters
+    HPX_FORCEINLINE task_counter_hooks const* begin_task_counters() noexcept
+    {
+        if (detail::task_counter_hooks_ptr.load(std::memory_order_relaxed) ==
+            nullptr)
+        {
+            return nullptr;
+        }
+        return detail::sample_task_counters();
+    }
+
+    HPX_FORCEINLINE void end_task_counters(task_counter_hooks const* hooks,
+        thread_data const* thrd, thread_schedule_state state) noexcept
+    {
+        if (hooks != nullptr)
+        {
+            detail::end_task_counters(hooks, thrd, state);
+        }
+    }
+}    // namespace hpx::threads
+
+#endif
@@ -0,0 +1,89 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_trace_analysis.hpp
+/// \page hpx::threads::tracing::analyze_trace
+/// \headerfile hpx/modules/threading_base.hpp
+///
+/// Analyze the events recorded by the task tracer: rebuild the graph of
+/// dependencies between the executed HPX threads, determine its critical
+/// path, the parallelism over time, and the reasons the worker threads were
+/// idle.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    /// The result of analyzing the recorded events, all times are given in
+    /// nanoseconds
+    struct task_trace_analysis
+    {
+        /// The time between the first and the last recorded task execution
+        std::uint64_t duration = 0;
+
+        /// The accumulated execution time of all tasks
+        std::uint64_t work = 0;
+
+        /// The execution time along the longest chain of dependent tasks
+        std::uint64_t critical_path = 0;
+
+        /// The number of recorded task executions (a task which suspends
+        /// executes more than once) and dependencies between them
+        std::size_t num_executions = 0;
+        std::size_t num_dependencies = 0;
+
+        /// The accumulated time the worker threads were idle, split by the
+        /// reason. A worker is idle waiting on a lock if any task waits for
+        /// an hpx::mutex at the time, waiting on the network if any task
+        /// waits for a future made ready by a parcel (or outside of an HPX
+        /// thread), and idle due to a lack of work otherwise.
+        std::uint64_t idle_no_work = 0;
+        std::uint64_t idle_network = 0;
+        std::uint64_t idle_lock = 0;
+
+        /// The average number of tasks executing at once during each
+        /// interval of the given length, starting at the first execution
+        std::uint64_t interval = 0;
+        std::vector<double> parallelism;
+
+        /// The execution time spent on the critical path by the tasks of a
+        /// given name, the longest first
+        std::vector<std::pair<std::string, std::uint64_t>> critical_path_tasks;
+
+        /// The speedup over running all tasks sequentially which is possible
+        /// at best given the dependencies between the tasks
+        double average_parallelism() const noexcept
+        {
+            return critical_path != 0 ? static_cast<double>(work) /
+                    static_cast<double>(critical_path) :
+                                        0.0;
+        }
+    };
+
+    /// Analyze all events recorded by the tracer so far. This can be done
+    /// while tracing is still active, tasks which are still executing are
+    /// taken into account up to their last recorded event. The
+    /// parallelism is computed for intervals of the given length (in
+    /// nanoseconds), at most \a max_intervals intervals are reported.
+    HPX_CORE_EXPORT task_trace_analysis analyze_trace(
+        std::uint64_t interval = 1000000, std::size_t max_intervals = 10000);
+
+    /// Write a human readable summary of the given analysis
+    HPX_CORE_EXPORT void write_trace_analysis(
+        std::ostream& os, task_trace_analysis const& analysis);
+}    // namespace hpx::threads::tracing
+
+#endif
@@ -0,0 +1,215 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_tracer.hpp
+/// \page hpx::threads::tracing::start, hpx::threads::tracing::stop
+/// \headerfile hpx/modules/threading_base.hpp
+///
+/// A low overhead timeline tracer recording when HPX threads start, suspend,
+/// and terminate, when work is stolen, and when parcels are sent and
+/// received. The events are kept in thread-local buffers which are written
+/// without any synchronization and can be exported in the Chrome trace event
+/// format (which can be loaded into chrome://tracing or
+/// https://ui.perfetto.dev).
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    /// The kinds of events recorded by the tracer
+    enum class event_type : std::uint8_t
+    {
+        task_begin = 0,     ///< an HPX thread starts or resumes executing
+        task_end = 1,       ///< an HPX thread has terminated
+        task_suspend = 2,   ///< an HPX thread has suspended or yielded
+        task_steal = 3,     ///< a worker has stolen tasks from another one
+        parcel_send = 4,    ///< a parcel has been sent
+        parcel_receive = 5, ///< a parcel has been received
+        task_create = 6,    ///< an HPX thread has been created
+        future_ready = 7,   ///< the shared state of a future became ready
+        future_wait = 8,    ///< an HPX thread suspends waiting on a future
+        lock_wait = 9       ///< an HPX thread suspends waiting on a mutex
+    };
+
+    namespace detail {
+
+        struct event
+        {
+            std::uint64_t timestamp;
+            char const* name;
+            std::uint64_t id;
+            std::uint64_t arg;
+            event_type type;
+        };
+
+        // The events recorded by one OS thread, in the order they were
+        // recorded
+        struct thread_events
+        {
+            std::uint32_t tid;
+            bool is_worker;
+            std::vector<event> events;
+        };
+
+        // Return a copy of all currently buffered events
+        HPX_CORE_EXPORT std::vector<thread_events> get_recorded_events();
+
+        HPX_CORE_EXPORT extern std::atomic<bool> tracing_enabled;
+
+        // Append an event to the buffer of the calling OS thread
+        HPX_CORE_EXPORT void record_event(event_type type, char const* name,
+            std::uint64_t id, std::uint64_t arg) noexcept;
+
+        HPX_CORE_EXPORT void record_task_begin(
+            thread_data const* thrd) noexcept;
+
+        // Combine the locality id and the (saturated) size of a parcel
+        constexpr std::uint64_t parcel_arg(
+            std::uint32_t locality, std::size_t size) noexcept
+        {
+            return (static_cast<std::uint64_t>(locality) << 32) |
+                (size < 0xffffffff ? size : 0xffffffff);
+        }
+    }    // namespace detail
+
+    /// Return whether events are currently being recorded
+    HPX_FORCEINLINE bool is_enabled() noexcept
+    {
+        return detail::tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Start recording events. At most \a max_events events are kept for
+    /// each OS thread, further events are dropped.
+    HPX_CORE_EXPORT void start(std::size_t max_events = 1024 * 1024);
+
+    /// Stop recording events, the recorded events are kept
+    HPX_CORE_EXPORT void stop();
+
+    /// Discard all recorded events, should be called while tracing is
+    /// stopped
+    HPX_CORE_EXPORT void clear();
+
+    /// Return the number of recorded and currently buffered events
+    HPX_CORE_EXPORT std::size_t num_events();
+
+    /// Return the number of events dropped as the buffers were full
+    HPX_CORE_EXPORT std::size_t num_dropped_events();
+
+    /// Write all recorded events in the Chrome trace event (JSON) format to
+    /// the given stream, should be called while tracing is stopped. \a pid
+    /// is used as the process id of all events, which allows merging the
+    /// traces of several localities.
+    HPX_CORE_EXPORT void write_chrome_trace(
+        std::ostream& os, std::uint32_t pid = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // hooks used by the scheduling loop and the parcel layer
+    HPX_FORCEINLINE void task_begin(thread_data const* thrd) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_task_begin(thrd);
+        }
+    }
+
+    HPX_FORCEINLINE void task_end(
+        thread_data const* thrd, thread_schedule_state state) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(state == thread_schedule_state::terminated ||
+                        state == thread_schedule_state::deleted ?
+                    event_type::task_end :
+                    event_type::task_suspend,
+                nullptr, reinterpret_cast<std::uint64_t>(thrd),
+                static_cast<std::uint64_t>(state));
+        }
+    }
+
+    HPX_FORCEINLINE void task_steal(
+        std::size_t victim, std::size_t num_tasks) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::task_steal, nullptr, victim,
+                static_cast<std::uint64_t>(num_tasks));
+        }
+    }
+
+    // The parcel id is zero if parcel profiling is disabled, in which case
+    // no flow events connecting sender and receiver are written
+    HPX_FORCEINLINE void parcel_send(std::uint64_t parcel_id,
+        std::size_t size, std::uint32_t destination) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::parcel_send, nullptr, parcel_id,
+                detail::parcel_arg(destination, size));
+        }
+    }
+
+    HPX_FORCEINLINE void parcel_receive(std::uint64_t parcel_id,
+        std::size_t size, std::uint32_t source) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::parcel_receive, nullptr,
+                parcel_id, detail::parcel_arg(source, size));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // hooks recording the dependencies between HPX threads, used by
+    // create_thread, the shared state of futures, and hpx::mutex
+    HPX_FORCEINLINE void task_create(thread_data const* thrd) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::task_create, nullptr,
+                reinterpret_cast<std::uint64_t>(thrd), 0);
+        }
+    }
+
+    HPX_FORCEINLINE void future_ready(void const* state) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::future_ready, nullptr,
+                reinterpret_cast<std::uint64_t>(state), 0);
+        }
+    }
+
+    HPX_FORCEINLINE void future_wait(void const* state) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::future_wait, nullptr,
+                reinterpret_cast<std::uint64_t>(state), 0);
+        }
+    }
+
+    HPX_FORCEINLINE void lock_wait(void const* lock) noexcept
+    {
+        if (is_enabled())
+        {
+            detail::record_event(event_type::lock_wait, nullptr,
+                reinterpret_cast<std::uint64_t>(lock), 0);
+        }
+    }
+}    // namespace hpx::threads::tracing
+
+#endif
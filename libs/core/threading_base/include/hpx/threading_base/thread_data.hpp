@@ -26,8 +26,12 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+#include <hpx/timing/tsc_clock.hpp>
+#endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <forward_list>
@@ -516,6 +520,65 @@ namespace hpx::threads {
             last_worker_thread_num_ = last_worker_thread_num;
         }
 
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+        // Called by the scheduling loop before running a phase of this
+        // thread, returns the start time of the phase
+        std::int64_t begin_annotation_phase() noexcept
+        {
+            auto const now =
+                static_cast<std::int64_t>(hpx::chrono::tsc_clock::now());
+            if (wait_time_ < 0)
+            {
+                wait_time_ = now - creation_time_;
+            }
+            return now;
+        }
+
+        // Called by the scheduling loop after a phase of this thread has
+        // finished, records the statistics of its annotation once the thread
+        // has terminated
+        void end_annotation_phase(
+            std::int64_t started, thread_schedule_state state) noexcept;
+#endif
+
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+        // Access to the fixed thread local storage slots (see
+        // thread_local_slot.hpp). A slot which has not been set since the
+        // thread was created (or recycled) holds a nullptr.
+        void* get_local_slot(std::size_t slot) const noexcept
+        {
+            HPX_ASSERT(slot < HPX_HAVE_THREAD_LOCAL_SLOTS);
+            return (used_local_slots_ & (std::uint64_t(1) << slot)) != 0 ?
+                local_slots_[slot] :
+                nullptr;
+        }
+
+        // Store the given value in the slot, returns the previous value
+        void* exchange_local_slot(std::size_t slot, void* value) noexcept
+        {
+            void* const old_value = get_local_slot(slot);
+            local_slots_[slot] = value;
+            if (value != nullptr)
+            {
+                used_local_slots_ |= std::uint64_t(1) << slot;
+            }
+            else
+            {
+                used_local_slots_ &= ~(std::uint64_t(1) << slot);
+            }
+            return old_value;
+        }
+
+        // Run the cleanup functions for all slots which hold a value
+        void cleanup_local_slots() noexcept
+        {
+            if (used_local_slots_ != 0)
+            {
+                cleanup_used_local_slots();
+            }
+        }
+#endif
+
         constexpr std::ptrdiff_t get_stack_size() const noexcept
         {
             return stacksize_;
@@ -526,6 +589,25 @@ namespace hpx::threads {
             return stacksize_enum_;
         }
 
+        // the deadline this thread was created with, see thread_init_data
+        constexpr std::chrono::steady_clock::time_point get_deadline()
+            const noexcept
+        {
+            return deadline_;
+        }
+
+        constexpr bool has_deadline() const noexcept
+        {
+            return deadline_ != thread_init_data::no_deadline();
+        }
+
+        // the priority value this thread was created with, see
+        // thread_init_data
+        constexpr std::int64_t get_priority_value() const noexcept
+        {
+            return priority_value_;
+        }
+
         template <typename ThreadQueue>
         constexpr ThreadQueue& get_queue() noexcept
         {
@@ -605,6 +687,10 @@ namespace hpx::threads {
         void rebind_base(thread_init_data& init_data);
 
     private:
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+        void cleanup_used_local_slots() noexcept;
+#endif
+
         mutable std::atomic<thread_state> current_state_;
 
         ///////////////////////////////////////////////////////////////////////
@@ -652,8 +738,25 @@ namespace hpx::threads {
         std::ptrdiff_t stacksize_;
         thread_stacksize stacksize_enum_;
 
+        std::chrono::steady_clock::time_point deadline_;
+        std::int64_t priority_value_;
+
         void* queue_;
 
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+        // the values of the slots are valid only if the corresponding bit is
+        // set, which avoids initializing them for every new thread
+        std::uint64_t used_local_slots_ = 0;
+        void* local_slots_[HPX_HAVE_THREAD_LOCAL_SLOTS];
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+        std::int64_t creation_time_;
+        std::int64_t wait_time_;    // negative until the thread first ran
+        std::int64_t execution_time_;
+        std::int64_t num_suspensions_;
+#endif
+
     public:
 #if defined(HPX_HAVE_APEX)
         std::shared_ptr<util::external_timer::task_wrapper> timer_data_;
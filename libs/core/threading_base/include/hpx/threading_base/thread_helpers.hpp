@@ -436,6 +436,21 @@ namespace hpx::threads {
     ///         \a hpx#error#invalid_status.
     HPX_CORE_EXPORT threads::thread_pool_base* get_pool(
         thread_id_type const& id, error_code& ec = throws);
+
+    /// Returns a scheduling hint referring to the NUMA domain that holds the
+    /// memory at the given address
+    ///
+    /// \param addr [in] The address of the data the new thread will operate
+    ///             on. The memory has to be touched (i.e. physically
+    ///             allocated) already.
+    ///
+    /// Threads created using the returned hint (of mode
+    ///  thread_schedule_hint_mode::numa) will preferably run on a worker
+    /// thread belonging to the NUMA domain the data is located in. If the
+    /// NUMA domain can't be determined, a default constructed hint is
+    /// returned, leaving the placement to the scheduler.
+    HPX_CORE_EXPORT thread_schedule_hint get_numa_domain_hint(
+        void const* addr) noexcept;
 }    // namespace hpx::threads
 
 namespace hpx::this_thread {
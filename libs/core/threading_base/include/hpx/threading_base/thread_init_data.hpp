@@ -15,8 +15,10 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <utility>
 #ifdef HPX_HAVE_APEX
 #include <memory>
@@ -47,6 +49,8 @@ namespace hpx::threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , deadline(no_deadline())
+          , priority_value(no_priority_value())
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -66,6 +70,8 @@ namespace hpx::threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            deadline = rhs.deadline;
+            priority_value = rhs.priority_value;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
 #endif
@@ -105,6 +111,8 @@ namespace hpx::threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , deadline(rhs.deadline)
+          , priority_value(rhs.priority_value)
         {
         }
 
@@ -139,6 +147,8 @@ namespace hpx::threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , deadline(no_deadline())
+          , priority_value(no_priority_value())
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -171,5 +181,27 @@ namespace hpx::threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // The point in time this thread should have finished executing by.
+        // Deadline aware schedulers (local-priority-edf) order the pending
+        // threads based on this value, all other schedulers ignore it.
+        std::chrono::steady_clock::time_point deadline;
+
+        static constexpr std::chrono::steady_clock::time_point
+        no_deadline() noexcept
+        {
+            return (std::chrono::steady_clock::time_point::max)();
+        }
+
+        // The fine-grained priority of this thread, smaller values are more
+        // urgent. Priority aware queue backends (multiqueue_priority, used by
+        // shared-priority-multiqueue) order the pending threads based on this
+        // value, all other backends ignore it.
+        std::int64_t priority_value;
+
+        static constexpr std::int64_t no_priority_value() noexcept
+        {
+            return (std::numeric_limits<std::int64_t>::max)();
+        }
     };
 }    // namespace hpx::threads
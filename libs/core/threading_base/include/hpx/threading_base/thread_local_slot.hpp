@@ -0,0 +1,129 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <cstddef>
+
+namespace hpx::threads {
+
+    static_assert(HPX_HAVE_THREAD_LOCAL_SLOTS <= 64,
+        "HPX_WITH_THREAD_LOCAL_SLOTS must not exceed 64");
+
+    namespace detail {
+
+        using thread_local_slot_cleanup_type = void (*)(void*);
+
+        // Reserve the next free slot, the cleanup function (which may be
+        // nullptr) is invoked for the value stored in the slot when an HPX
+        // thread exits. Throws if all slots are in use.
+        HPX_CORE_EXPORT std::size_t allocate_thread_local_slot(
+            thread_local_slot_cleanup_type cleanup);
+
+        HPX_CORE_EXPORT thread_local_slot_cleanup_type
+        get_thread_local_slot_cleanup(std::size_t slot) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pointer local to each HPX thread, similar to thread_specific_ptr, but
+    // stored in one of a fixed number (HPX_WITH_THREAD_LOCAL_SLOTS) of slots
+    // embedded in the thread_data of every HPX thread. Accessing the value
+    // does not require any lookup and creating an HPX thread does not
+    // require any initialization of the slots. The value is cleaned up when
+    // the HPX thread exits.
+    //
+    // A slot is reserved when a thread_local_slot is constructed and is never
+    // released, thread_local_slot objects are meant to be namespace scope
+    // (or static) variables, e.g. constructed during static initialization.
+    template <typename T>
+    class thread_local_slot
+    {
+    private:
+        static void delete_data(void* data)
+        {
+            delete static_cast<T*>(data);
+        }
+
+    public:
+        using element_type = T;
+
+        // The value stored in the slot is deleted when an HPX thread exits
+        thread_local_slot()
+          : slot_(detail::allocate_thread_local_slot(&delete_data))
+          , cleanup_(&delete_data)
+        {
+        }
+
+        // The value stored in the slot is not owned by the slot (it is not
+        // cleaned up when an HPX thread exits)
+        explicit thread_local_slot(std::nullptr_t)
+          : slot_(detail::allocate_thread_local_slot(nullptr))
+          , cleanup_(nullptr)
+        {
+        }
+
+        thread_local_slot(thread_local_slot const&) = delete;
+        thread_local_slot& operator=(thread_local_slot const&) = delete;
+
+        // Returns nullptr if not called on an HPX thread
+        T* get() const noexcept
+        {
+            thread_data const* thrd = get_self_id_data();
+            return thrd != nullptr ?
+                static_cast<T*>(thrd->get_local_slot(slot_)) :
+                nullptr;
+        }
+
+        T* operator->() const noexcept
+        {
+            return get();
+        }
+
+        T& operator*() const noexcept
+        {
+            return *get();
+        }
+
+        // Clear the slot without cleaning up the stored value
+        T* release()
+        {
+            return static_cast<T*>(self().exchange_local_slot(slot_, nullptr));
+        }
+
+        // Store a new value, the previous value is cleaned up
+        void reset(T* new_value = nullptr)
+        {
+            void* const old_value =
+                self().exchange_local_slot(slot_, new_value);
+            if (old_value != nullptr && old_value != new_value &&
+                cleanup_ != nullptr)
+            {
+                cleanup_(old_value);
+            }
+        }
+
+        constexpr std::size_t slot() const noexcept
+        {
+            return slot_;
+        }
+
+    private:
+        static thread_data& self()
+        {
+            return *get_thread_id_data(get_self_ptr_checked()->get_thread_id());
+        }
+
+        std::size_t const slot_;
+        detail::thread_local_slot_cleanup_type const cleanup_;
+    };
+}    // namespace hpx::threads
+
+#endif
@@ -16,11 +16,13 @@
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_telemetry.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -29,6 +31,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -60,6 +63,29 @@ namespace hpx::threads {
     };
     /// \endcond
 
+    /// Parameters controlling the automatic adaptation of the number of
+    /// active processing units of a thread pool (see hpx.elasticity)
+    struct thread_pool_elasticity_parameters
+    {
+        // run the controller for this pool
+        bool enabled_ = false;
+
+        // bounds for the number of active processing units
+        std::size_t min_threads_ = 1;
+        std::size_t max_threads_ = static_cast<std::size_t>(-1);
+
+        // time between two consecutive decisions of the controller
+        std::chrono::milliseconds interval_{100};
+
+        // resume one processing unit if there are more pending threads than
+        // this per active processing unit
+        double grow_queue_length_ = 2.0;
+
+        // suspend one processing unit if the idle rate of the active
+        // processing units is above this value and there is no pending work
+        double shrink_idle_rate_ = 0.9;
+    };
+
     struct thread_pool_init_parameters
     {
         std::string const& name_;
@@ -75,6 +101,7 @@ namespace hpx::threads {
         std::size_t max_idle_loop_count_;
         std::size_t max_busy_loop_count_;
         std::size_t shutdown_check_count_;
+        thread_pool_elasticity_parameters elasticity_;
 
         thread_pool_init_parameters(std::string const& name, std::size_t index,
             policies::scheduler_mode mode, std::size_t num_threads,
@@ -397,6 +424,39 @@ namespace hpx::threads {
         {
             return 0;
         }
+        virtual std::int64_t get_num_stolen_batches(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_batch_tasks(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_remote(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_num_steal_attempts(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_successes(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::vector<std::int64_t> get_steal_histogram(
+            policies::steal_histogram which, std::size_t /*thread_num*/,
+            bool /*reset*/)
+        {
+            return std::vector<std::int64_t>(
+                policies::get_steal_histogram_size(which), 0);
+        }
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
@@ -459,6 +519,23 @@ namespace hpx::threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+        virtual std::int64_t get_idle_park_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_unpark_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_missed_deadline_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             hpx::function<bool(thread_id_type)> const& /*f*/,
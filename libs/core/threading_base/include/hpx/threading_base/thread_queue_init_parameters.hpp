@@ -42,7 +42,10 @@ namespace hpx::threads::policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE) noexcept
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            bool auto_select_stacksize = false,
+            std::int64_t trim_interval = static_cast<std::int64_t>(
+                HPX_THREAD_QUEUE_TRIM_INTERVAL)) noexcept
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -58,6 +61,8 @@ namespace hpx::threads::policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , auto_select_stacksize_(auto_select_stacksize)
+          , trim_interval_(trim_interval)
         {
         }
 
@@ -76,5 +81,14 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+
+        // pick the stack size for threads requesting the default (small)
+        // stack size based on the recorded stack usage of earlier threads
+        // with the same description
+        bool const auto_select_stacksize_;
+
+        // interval [ms] at which the lists of recycled threads are trimmed
+        // back to the recent working set of the queue (0: never)
+        std::int64_t trim_interval_;
     };
 }    // namespace hpx::threads::policies
@@ -0,0 +1,53 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx::threads {
+
+    /// The stack usage recorded for all threads sharing the same description
+    struct stack_usage_data
+    {
+        std::string description;
+
+        // number of threads that have terminated
+        std::uint64_t count = 0;
+
+        // largest number of bytes of stack used by any of those threads
+        std::size_t max_used = 0;
+
+        // stack size of the thread that has used the most stack
+        std::size_t stacksize = 0;
+    };
+
+    /// Enable or disable recording the stack high-water mark of all
+    /// terminating HPX threads (see hpx.stacks.track_usage). Only stacks of
+    /// threads created after enabling the tracking are measured. If
+    /// \a deep_only is set, only the lower end of the stacks is filled and
+    /// only threads using more than 80% of their stack are recorded, which
+    /// is sufficient for selecting stack sizes (see hpx.stacks.auto_select).
+    HPX_CORE_EXPORT void enable_stack_usage_tracking(
+        bool enable, bool deep_only = false) noexcept;
+    HPX_CORE_EXPORT bool stack_usage_tracking_enabled() noexcept;
+
+    /// Return the stack usage recorded so far, one entry per thread
+    /// description
+    HPX_CORE_EXPORT std::vector<stack_usage_data> get_stack_usage(
+        bool reset = false);
+
+    /// Return the largest number of bytes of stack used by any terminated
+    /// thread with the given description, zero if none was recorded
+    HPX_CORE_EXPORT std::size_t get_max_stack_usage(
+        thread_description const& desc) noexcept;
+}    // namespace hpx::threads
@@ -9,6 +9,8 @@
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
 #include <hpx/threading_base/annotated_function.hpp>
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -21,10 +23,44 @@ namespace hpx::detail {
         auto const r = names.emplace(HPX_MOVE(name));
         return (*std::get<0>(r)).c_str();
     }
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+    // annotations are recorded by default only if a profiler is attached
+#if defined(HPX_HAVE_APEX)
+    std::atomic<bool> annotations_enabled(true);
+#else
+    std::atomic<bool> annotations_enabled(false);
+#endif
+#endif
 }    // namespace hpx::detail
 
+namespace hpx {
+
+    bool set_annotations_enabled([[maybe_unused]] bool enable) noexcept
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+        return detail::annotations_enabled.exchange(
+            enable, std::memory_order_relaxed);
+#else
+        return annotations_enabled();
+#endif
+    }
+
+    char const* register_annotation(std::string name)
+    {
+        // the elements of an unordered_set are never moved
+        static std::mutex mtx;
+        static std::unordered_set<std::string> names;
+
+        std::lock_guard<std::mutex> l(mtx);
+        auto const r = names.emplace(HPX_MOVE(name));
+        return (*std::get<0>(r)).c_str();
+    }
+}    // namespace hpx
+
 #else
 
+#include <hpx/threading_base/scoped_annotation.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 
 #include <string>
@@ -37,4 +73,17 @@ namespace hpx::detail {
     }
 }    // namespace hpx::detail
 
+namespace hpx {
+
+    bool set_annotations_enabled(bool) noexcept
+    {
+        return false;
+    }
+
+    char const* register_annotation(std::string)
+    {
+        return "<unknown>";
+    }
+}    // namespace hpx
+
 #endif
@@ -0,0 +1,211 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+#include <hpx/threading_base/annotation_statistics.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hpx::threads {
+
+    namespace {
+
+        struct annotation_data
+        {
+            using histogram_type = std::array<std::atomic<std::int64_t>,
+                annotation_histogram_num_buckets>;
+
+            void record(histogram_type& histogram, std::int64_t value) noexcept
+            {
+                std::size_t const bucket = get_annotation_histogram_bucket(
+                    value > 0 ? static_cast<std::uint64_t>(value) : 0);
+                histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            histogram_type execution_time_{};
+            histogram_type wait_time_{};
+            histogram_type suspensions_{};
+        };
+
+        // The data of all annotations, the entries are never removed
+        struct annotation_registry
+        {
+            annotation_data* get(char const* annotation)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                auto& data = annotations_[annotation];
+                if (!data)
+                {
+                    data = std::make_unique<annotation_data>();
+                }
+                return data.get();
+            }
+
+            annotation_data* find(std::string const& annotation)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                auto const it = annotations_.find(annotation);
+                return it != annotations_.end() ? it->second.get() : nullptr;
+            }
+
+            std::vector<std::string> get_annotations()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                std::vector<std::string> result;
+                result.reserve(annotations_.size());
+                for (auto const& e : annotations_)
+                {
+                    result.push_back(e.first);
+                }
+                return result;
+            }
+
+            std::mutex mtx_;
+            std::map<std::string, std::unique_ptr<annotation_data>>
+                annotations_;
+        };
+
+        annotation_registry& get_annotation_registry()
+        {
+            static annotation_registry registry;
+            return registry;
+        }
+
+        // Annotations are (almost always) string literals or interned
+        // strings, every OS thread caches the data for the annotation
+        // pointers it has seen to avoid locking the registry
+        annotation_data* get_annotation_data(char const* annotation)
+        {
+            static thread_local std::unordered_map<char const*,
+                annotation_data*>
+                cache;
+
+            auto it = cache.find(annotation);
+            if (it == cache.end())
+            {
+                it = cache
+                         .emplace(annotation,
+                             get_annotation_registry().get(annotation))
+                         .first;
+            }
+            return it->second;
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    std::int64_t get_annotation_histogram_percentile(
+        std::vector<std::int64_t> const& buckets, double percentile) noexcept
+    {
+        std::int64_t total = 0;
+        for (std::int64_t const count : buckets)
+        {
+            total += count;
+        }
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        // the number of values at or below the requested percentile
+        auto const rank = static_cast<std::int64_t>(
+            static_cast<double>(total) * percentile / 100.0 + 0.5);
+
+        std::int64_t count = 0;
+        for (std::size_t i = 0; i != buckets.size(); ++i)
+        {
+            count += buckets[i];
+            if (count != 0 && count >= rank)
+            {
+                return static_cast<std::int64_t>(
+                    get_annotation_histogram_upper_bound(i));
+            }
+        }
+        return static_cast<std::int64_t>(
+            get_annotation_histogram_upper_bound(buckets.size() - 1));
+    }
+
+    void record_annotation_statistics(char const* annotation,
+        std::int64_t execution_time, std::int64_t wait_time,
+        std::int64_t suspensions) noexcept
+    {
+        try
+        {
+            annotation_data* data = get_annotation_data(
+                annotation != nullptr ? annotation : "<unknown>");
+
+            data->record(data->execution_time_, execution_time);
+            data->record(data->wait_time_, wait_time);
+            data->record(data->suspensions_, suspensions);
+        }
+        catch (...)
+        {
+            // ignore allocation failures, the statistics are incomplete then
+        }
+    }
+
+    std::vector<std::int64_t> get_annotation_histogram(
+        std::string const& annotation, annotation_histogram which, bool reset)
+    {
+        annotation_data* data = get_annotation_registry().find(annotation);
+        if (data == nullptr)
+        {
+            return {};
+        }
+
+        annotation_data::histogram_type* histogram = nullptr;
+        switch (which)
+        {
+        case annotation_histogram::execution_time:
+            histogram = &data->execution_time_;
+            break;
+
+        case annotation_histogram::wait_time:
+            histogram = &data->wait_time_;
+            break;
+
+        case annotation_histogram::suspensions:
+            [[fallthrough]];
+        default:
+            histogram = &data->suspensions_;
+            break;
+        }
+
+        std::vector<std::int64_t> result;
+        result.reserve(annotation_histogram_num_buckets);
+        for (auto& bucket : *histogram)
+        {
+            result.push_back(get_and_reset(bucket, reset));
+        }
+        return result;
+    }
+
+    std::vector<std::string> get_recorded_annotations()
+    {
+        return get_annotation_registry().get_annotations();
+    }
+}    // namespace hpx::threads
+
+#endif
@@ -10,6 +10,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -83,9 +84,18 @@ namespace hpx::threads::detail {
         if (data.priority == thread_priority::default_)
             data.priority = thread_priority::normal;
 
+        scheduler->select_stack_size(data);
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
+#if defined(HPX_HAVE_TASK_TRACING)
+        if (id)
+        {
+            tracing::task_create(get_thread_id_data(id));
+        }
+#endif
+
         LTM_(info)
             .format("create_thread: pool({}), scheduler({}), thread({}), "
                     "initial_state({}), run_now({})",
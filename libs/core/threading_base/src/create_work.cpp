@@ -102,6 +102,8 @@ namespace hpx::threads::detail {
             thread_priority::bound == data.priority ||
             thread_priority::boost == data.priority);
 
+        scheduler->select_stack_size(data);
+
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
@@ -0,0 +1,314 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        constexpr std::uint64_t no_timer =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        // number of ticks covered by the whole wheel
+        constexpr std::uint64_t wheel_range = std::uint64_t(1)
+            << (timer_wheel::slot_bits * timer_wheel::num_levels);
+
+        constexpr std::uint32_t level_shift(std::uint32_t level) noexcept
+        {
+            return level * timer_wheel::slot_bits;
+        }
+
+        // distance (1...64) from the given slot index to the next non-empty
+        // slot, wrapping around, 0 if all slots are empty
+        std::uint64_t distance_to_next(
+            std::uint64_t occupied, std::uint64_t index) noexcept
+        {
+            if (occupied == 0)
+            {
+                return 0;
+            }
+
+            for (std::uint64_t d = 1; d <= timer_wheel::num_slots; ++d)
+            {
+                if (occupied & (std::uint64_t(1) << ((index + d) & slot_mask)))
+                {
+                    return d;
+                }
+            }
+
+            HPX_ASSERT(false);
+            return 0;
+        }
+    }    // namespace
+
+    timer_wheel::timer_wheel(clock_type::duration resolution,
+        clock_type::time_point start) noexcept
+      : start_(start)
+      , resolution_(resolution)
+      , next_due_(no_timer)
+    {
+        HPX_ASSERT(resolution_.count() > 0);
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        for (timer_wheel_node*& head : slots_)
+        {
+            timer_wheel_node* node = head;
+            head = nullptr;
+
+            while (node != nullptr)
+            {
+                timer_wheel_node* next = node->next;
+                node->next = nullptr;
+                node->pprev = nullptr;
+                node->expire(node, false);
+                node = next;
+            }
+        }
+    }
+
+    bool timer_wheel::add(
+        timer_wheel_node* node, clock_type::time_point expiry)
+    {
+        HPX_ASSERT(node->pprev == nullptr);
+
+        // round up, timers must not expire early
+        std::uint64_t ticks = to_ticks(expiry);
+        if (start_ + resolution_ * static_cast<clock_type::rep>(ticks) <
+            expiry)
+        {
+            ++ticks;
+        }
+
+        std::unique_lock<mutex_type> l(mtx_);
+
+        // timers that are due already expire the next time the wheel is
+        // advanced
+        node->expiry = (std::max)(ticks, current_ + 1);
+
+        std::uint64_t const due = insert(node);
+        count_.fetch_add(1, std::memory_order_relaxed);
+
+        if (due < next_due_.load(std::memory_order_relaxed))
+        {
+            next_due_.store(due, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    bool timer_wheel::remove(timer_wheel_node* node)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        if (node->pprev == nullptr)
+        {
+            return false;
+        }
+
+        unlink(node);
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t timer_wheel::advance(clock_type::time_point now)
+    {
+        std::uint64_t const now_ticks = to_ticks(now);
+
+        timer_wheel_node* expired = nullptr;
+        std::size_t num_expired = 0;
+
+        {
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return 0;
+            }
+
+            while (current_ < now_ticks)
+            {
+                // skip all ticks at which nothing has to be done
+                std::uint64_t const next = next_event();
+                if (next > now_ticks)
+                {
+                    break;
+                }
+                current_ = next;
+
+                // move the timers of the slots reached on the higher levels
+                // to the lower levels
+                for (std::uint32_t level = 1; level != num_levels; ++level)
+                {
+                    std::uint64_t const mask =
+                        (std::uint64_t(1) << level_shift(level)) - 1;
+                    if ((current_ & mask) != 0)
+                    {
+                        break;
+                    }
+
+                    std::uint64_t const index =
+                        (current_ >> level_shift(level)) & slot_mask;
+                    timer_wheel_node* node = take_slot(static_cast<
+                        std::uint32_t>(level * num_slots + index));
+                    while (node != nullptr)
+                    {
+                        timer_wheel_node* next_node = node->next;
+                        insert(node);
+                        node = next_node;
+                    }
+                }
+
+                // expire all timers of the current slot of the lowest level
+                timer_wheel_node* node = take_slot(
+                    static_cast<std::uint32_t>(current_ & slot_mask));
+                while (node != nullptr)
+                {
+                    timer_wheel_node* next_node = node->next;
+                    HPX_ASSERT(node->expiry <= current_);
+
+                    node->next = expired;
+                    expired = node;
+                    ++num_expired;
+
+                    node = next_node;
+                }
+            }
+
+            current_ = (std::max)(current_, now_ticks);
+            count_.fetch_sub(num_expired, std::memory_order_relaxed);
+            next_due_.store(next_event(), std::memory_order_relaxed);
+        }
+
+        // the expire functions may destroy the nodes
+        while (expired != nullptr)
+        {
+            timer_wheel_node* next = expired->next;
+            expired->next = nullptr;
+            expired->expire(expired, true);
+            expired = next;
+        }
+
+        return num_expired;
+    }
+
+    timer_wheel::clock_type::time_point timer_wheel::next_due() const noexcept
+    {
+        std::uint64_t const due = next_due_.load(std::memory_order_relaxed);
+        if (due == no_timer)
+        {
+            return (clock_type::time_point::max)();
+        }
+        return start_ + resolution_ * static_cast<clock_type::rep>(due);
+    }
+
+    std::uint64_t timer_wheel::insert(timer_wheel_node* node) noexcept
+    {
+        HPX_ASSERT(node->expiry >= current_);
+
+        // timers further in the future than covered by the wheel are
+        // re-inserted once the last slot of the top level has been reached
+        std::uint64_t const delta = node->expiry - current_;
+        std::uint64_t const expiry = delta < wheel_range ?
+            node->expiry :
+            current_ + wheel_range - 1;
+
+        std::uint32_t level = 0;
+        while (level != num_levels - 1 &&
+            delta >= (std::uint64_t(1) << level_shift(level + 1)))
+        {
+            ++level;
+        }
+
+        std::uint64_t const index = (expiry >> level_shift(level)) & slot_mask;
+        std::uint32_t const slot =
+            static_cast<std::uint32_t>(level * num_slots + index);
+
+        timer_wheel_node*& head = slots_[slot];
+        node->next = head;
+        if (head != nullptr)
+        {
+            head->pprev = &node->next;
+        }
+        head = node;
+        node->pprev = &head;
+        node->slot = slot;
+        occupied_[level] |= std::uint64_t(1) << index;
+
+        // the timer has to be looked at once its slot is reached
+        std::uint64_t const current_index =
+            (current_ >> level_shift(level)) & slot_mask;
+        std::uint64_t const distance = level == 0 && delta == 0 ?
+            0 :
+            ((index - current_index - 1) & slot_mask) + 1;
+
+        return ((current_ >> level_shift(level)) + distance)
+            << level_shift(level);
+    }
+
+    void timer_wheel::unlink(timer_wheel_node* node) noexcept
+    {
+        HPX_ASSERT(node->pprev != nullptr);
+
+        *node->pprev = node->next;
+        if (node->next != nullptr)
+        {
+            node->next->pprev = node->pprev;
+        }
+        node->next = nullptr;
+        node->pprev = nullptr;
+
+        std::uint32_t const slot = node->slot;
+        if (slots_[slot] == nullptr)
+        {
+            occupied_[slot / num_slots] &=
+                ~(std::uint64_t(1) << (slot & slot_mask));
+        }
+    }
+
+    timer_wheel_node* timer_wheel::take_slot(std::uint32_t slot) noexcept
+    {
+        timer_wheel_node* head = slots_[slot];
+        slots_[slot] = nullptr;
+        occupied_[slot / num_slots] &=
+            ~(std::uint64_t(1) << (slot & slot_mask));
+
+        for (timer_wheel_node* node = head; node != nullptr; node = node->next)
+        {
+            node->pprev = nullptr;
+        }
+        return head;
+    }
+
+    std::uint64_t timer_wheel::next_event() const noexcept
+    {
+        std::uint64_t next = no_timer;
+        for (std::uint32_t level = 0; level != num_levels; ++level)
+        {
+            std::uint64_t const block = current_ >> level_shift(level);
+            std::uint64_t const distance =
+                distance_to_next(occupied_[level], block & slot_mask);
+            if (distance != 0)
+            {
+                next = (std::min)(
+                    next, (block + distance) << level_shift(level));
+            }
+        }
+        return next;
+    }
+}    // namespace hpx::threads::detail
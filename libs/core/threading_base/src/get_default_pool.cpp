@@ -41,9 +41,21 @@ namespace hpx::threads::detail {
     thread_pool_base* get_self_or_default_pool()
     {
         thread_pool_base* pool = nullptr;
-        if (auto const* thrd_data = get_self_id_data())
+        auto const* thrd_data = get_self_id_data();
+        if (thrd_data != nullptr)
         {
             pool = thrd_data->get_scheduler_base()->get_parent_pool();
+
+            // pools that do background work only (e.g. a dedicated parcelport
+            // progress pool) can't run any HPX threads, hand off new work to
+            // the default pool instead
+            if (detail::get_default_pool &&
+                thrd_data->get_scheduler_base()->has_scheduler_mode(
+                    policies::scheduler_mode::do_background_work_only))
+            {
+                pool = detail::get_default_pool();
+                HPX_ASSERT(pool);
+            }
         }
         else if (detail::get_default_pool)
         {
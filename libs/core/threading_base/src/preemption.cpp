@@ -0,0 +1,111 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/preemption.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    namespace {
+
+        std::atomic<std::int64_t> preemption_time_slice(0);
+
+        struct time_slice_data
+        {
+            bool started = false;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        time_slice_data& get_time_slice_data() noexcept
+        {
+            static thread_local time_slice_data data;
+            return data;
+        }
+    }    // namespace
+
+    void set_preemption_time_slice(std::chrono::microseconds slice) noexcept
+    {
+        preemption_time_slice.store(slice.count(), std::memory_order_relaxed);
+    }
+
+    std::chrono::microseconds get_preemption_time_slice() noexcept
+    {
+        return std::chrono::microseconds(
+            preemption_time_slice.load(std::memory_order_relaxed));
+    }
+
+    namespace detail {
+
+        void begin_time_slice() noexcept
+        {
+            // the time slice is started lazily by the first preemption check
+            get_time_slice_data().started = false;
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
+
+namespace hpx::this_thread {
+
+    bool check_preempt()
+    {
+        std::int64_t const slice =
+            threads::preemption_time_slice.load(std::memory_order_relaxed);
+        if (slice == 0)
+        {
+            return false;
+        }
+
+        threads::thread_data* thrd = threads::get_self_id_data();
+        if (thrd == nullptr)
+        {
+            return false;
+        }
+
+        // stackless threads run on the stack of their worker thread and can't
+        // be suspended
+        if (thrd->is_stackless())
+        {
+            return false;
+        }
+
+        auto const now = std::chrono::steady_clock::now();
+
+        threads::time_slice_data& data = threads::get_time_slice_data();
+        if (!data.started)
+        {
+            data.started = true;
+            data.start = now;
+            return false;
+        }
+
+        if (now - data.start < std::chrono::microseconds(slice))
+        {
+            threads::policies::scheduler_base const* scheduler =
+                thrd->get_scheduler_base();
+            if (scheduler == nullptr ||
+                !scheduler->has_higher_priority_work(
+                    threads::detail::get_local_thread_num_tss(),
+                    thrd->get_priority()))
+            {
+                return false;
+            }
+        }
+
+        // the time slice is restarted once this thread is resumed
+        this_thread::suspend(threads::thread_schedule_state::pending,
+            "this_thread::check_preempt");
+        return true;
+    }
+}    // namespace hpx::this_thread
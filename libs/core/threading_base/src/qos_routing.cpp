@@ -0,0 +1,94 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/qos_routing.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        std::atomic<thread_pool_base*> latency_pool(nullptr);
+        std::atomic<thread_pool_base*> bulk_pool(nullptr);
+        bool lending = false;
+        std::int64_t lend_reserve = 0;
+
+        constexpr bool is_latency_class(thread_priority priority) noexcept
+        {
+            return priority == thread_priority::high ||
+                priority == thread_priority::high_recursive ||
+                priority == thread_priority::boost;
+        }
+    }    // namespace
+
+    void set_qos_pools(thread_pool_base* latency, thread_pool_base* bulk,
+        bool lend, std::size_t reserve) noexcept
+    {
+        lending = lend;
+        lend_reserve = static_cast<std::int64_t>(reserve);
+        bulk_pool.store(bulk, std::memory_order_relaxed);
+        latency_pool.store(latency, std::memory_order_release);
+    }
+
+    void reset_qos_pools() noexcept
+    {
+        latency_pool.store(nullptr, std::memory_order_relaxed);
+        bulk_pool.store(nullptr, std::memory_order_relaxed);
+    }
+
+    thread_pool_base* route_qos(
+        thread_init_data& data, thread_pool_base* pool) noexcept
+    {
+        thread_pool_base* latency =
+            latency_pool.load(std::memory_order_acquire);
+        if (latency == nullptr)
+        {
+            return pool;    // QoS mode is not enabled
+        }
+
+        // work explicitly created on any other pool is left alone
+        thread_pool_base* bulk = bulk_pool.load(std::memory_order_relaxed);
+        if (pool != latency && pool != bulk)
+        {
+            return pool;
+        }
+
+        thread_pool_base* target = bulk;
+        if (is_latency_class(data.priority))
+        {
+            target = latency;
+
+            // a saturated latency pool borrows an idle core of the bulk pool,
+            // the work keeps its high priority there
+            if (lending && latency->get_idle_core_count() == 0 &&
+                bulk->get_idle_core_count() != 0)
+            {
+                target = bulk;
+            }
+        }
+        else if (lending && latency->get_idle_core_count() > lend_reserve &&
+            bulk->get_idle_core_count() == 0)
+        {
+            // an idle latency core takes on bulk work, which runs to
+            // completion there
+            target = latency;
+        }
+
+        // the worker numbers of the hint refer to the requested pool
+        if (target != pool &&
+            data.schedulehint.mode == thread_schedule_hint_mode::thread)
+        {
+            data.schedulehint = thread_schedule_hint();
+        }
+        return target;
+    }
+}    // namespace hpx::threads::detail
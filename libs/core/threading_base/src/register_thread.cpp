@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/detail/qos_routing.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -31,6 +32,9 @@ namespace hpx::threads {
 
             p->run_thread_exit_callbacks();
             p->free_thread_exit_callbacks();
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+            p->cleanup_local_slots();
+#endif
 
             return threads::thread_result_type(
                 threads::thread_schedule_state::terminated,
@@ -43,6 +47,7 @@ namespace hpx::threads {
         threads::thread_pool_base* pool, error_code& ec)
     {
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
 
         threads::thread_id_ref_type id = threads::invalid_thread_id;
         data.run_now = true;
@@ -55,6 +60,7 @@ namespace hpx::threads {
         error_code& ec)
     {
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
 
         data.run_now = true;
         pool->create_thread(data, id, ec);
@@ -65,6 +71,7 @@ namespace hpx::threads {
     {
         auto* pool = detail::get_self_or_default_pool();
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
 
         data.run_now = true;
         pool->create_thread(data, id, ec);
@@ -75,6 +82,7 @@ namespace hpx::threads {
     {
         auto* pool = detail::get_self_or_default_pool();
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
 
         threads::thread_id_ref_type id = threads::invalid_thread_id;
         data.run_now = true;
@@ -87,6 +95,8 @@ namespace hpx::threads {
         threads::thread_pool_base* pool, error_code& ec)
     {
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
+
         data.run_now = false;
         return pool->create_work(data, ec);
     }
@@ -96,6 +106,7 @@ namespace hpx::threads {
     {
         auto* pool = detail::get_self_or_default_pool();
         HPX_ASSERT(pool);
+        pool = detail::route_qos(data, pool);
 
         data.run_now = false;
         return pool->create_work(data, ec);
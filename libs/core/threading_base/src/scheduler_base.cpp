@@ -5,17 +5,30 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+#include <hpx/timing/tsc_clock.hpp>
+#include <hpx/topology/topology.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -35,14 +48,80 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads::policies {
 
+#if defined(__linux__)
+    namespace {
+
+        static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                sizeof(std::uint32_t),
+            "futex operations require std::atomic<std::uint32_t> to have the "
+            "same layout as std::uint32_t");
+
+        // wait until the value changes from 'expected' (or the timeout
+        // expires)
+        void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+            std::chrono::milliseconds timeout) noexcept
+        {
+            timespec ts{};
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+            ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+        }
+
+        // wake up at most one thread waiting on the given word
+        void futex_wake(std::atomic<std::uint32_t>& word) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+    }    // namespace
+#endif
+
+    namespace {
+
+        // the number of iterations a worker thread spins before parking
+        // itself when being suspended in scheduler_mode::enable_fast_suspend
+        constexpr std::size_t fast_suspend_spin_count = 4096;
+    }    // namespace
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+        // idling worker threads wake up in time for the next timer to expire
+        std::chrono::milliseconds limit_idle_time(
+            threads::detail::timer_wheel const& timers,
+            std::chrono::milliseconds timeout) noexcept
+        {
+            using clock_type = threads::detail::timer_wheel::clock_type;
+
+            clock_type::time_point const due = timers.next_due();
+            if (due == (clock_type::time_point::max)())
+            {
+                return timeout;
+            }
+
+            clock_type::time_point const now = clock_type::now();
+            if (due <= now)
+            {
+                return std::chrono::milliseconds(0);
+            }
+            return (std::min)(timeout,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    due - now));
+        }
+    }    // namespace
+#endif
+
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description,
         thread_queue_init_parameters const& thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
-      , suspend_conds_(num_threads)
-      , pu_mtxs_(num_threads)
-      , states_(num_threads)
+      : workers_(num_threads)
+      , numa_next_thread_(0)
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+      , steal_telemetry_(num_threads)
+#endif
       , description_(description)
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
@@ -50,9 +129,12 @@ namespace hpx::threads::policies {
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
       , polling_function_sycl_(&null_polling_function)
+      , polling_function_io_uring_(&null_polling_function)
       , polling_work_count_function_mpi_(&null_polling_work_count_function)
       , polling_work_count_function_cuda_(&null_polling_work_count_function)
       , polling_work_count_function_sycl_(&null_polling_work_count_function)
+      , polling_work_count_function_io_uring_(
+            &null_polling_work_count_function)
     {
         scheduler_base::set_scheduler_mode(mode);
 
@@ -65,16 +147,22 @@ namespace hpx::threads::policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
-#endif
 
-        for (std::size_t i = 0; i != num_threads; ++i)
-            states_[i].data_.store(hpx::state::initialized);
+        parking_data_ =
+            std::vector<util::cache_line_data<idle_parking_data>>(num_threads);
+#endif
     }
 
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_idle_parking)
+        {
+            // Park this thread until new work arrives.
+            park_idle_thread(num_thread);
+        }
+        else if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
@@ -89,8 +177,11 @@ namespace hpx::threads::policies {
                 (std::min)(static_cast<double>(data.wait_count_),
                     static_cast<double>(max_exponent - 1));
 
-            std::chrono::milliseconds const period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::milliseconds const period =
+                limit_idle_time(timers_,
+                    std::chrono::milliseconds(std::lround((std::min)(
+                        data.max_idle_backoff_time_,
+                        std::pow(2.0, exponent)))));
 
             ++data.wait_count_;
 
@@ -108,10 +199,46 @@ namespace hpx::threads::policies {
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_idle_parking)
+        {
+            // Make sure the new work is visible to threads that are about to
+            // be parked before checking whether any thread has been parked
+            // (this pairs with the fetch_add in park_idle_thread).
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (num_parked_.data_.load(std::memory_order_acquire) == 0)
+            {
+                return;
+            }
+
+            std::size_t const num_threads = parking_data_.size();
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                // Without stealing only the thread owning the queue the work
+                // was added to is able to pick it up, which is unknown here.
+                if (!has_scheduler_mode(
+                        policies::scheduler_mode::enable_stealing))
+                {
+                    unpark_all_idle_threads();
+                    return;
+                }
+                num_thread = 0;
+            }
+
+            // wake up exactly one parked thread, preferably the one the work
+            // was added for
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                if (unpark_idle_thread((num_thread + i) % num_threads))
+                {
+                    break;
+                }
+            }
+        }
+        else if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
             cond_.notify_all();
@@ -119,20 +246,180 @@ namespace hpx::threads::policies {
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    void scheduler_base::park_idle_thread(std::size_t num_thread)
+    {
+        HPX_ASSERT(num_thread < parking_data_.size());
+        idle_parking_data& data = parking_data_[num_thread].data_;
+
+        // Announce that this thread is about to be parked before looking for
+        // work one last time. Either this thread sees work added concurrently
+        // or the thread adding the work sees this thread as being parked.
+        data.parked_.store(1, std::memory_order_seq_cst);
+        num_parked_.data_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::size_t const queue_num =
+            has_scheduler_mode(policies::scheduler_mode::enable_stealing) ?
+            static_cast<std::size_t>(-1) :
+            num_thread;
+
+        if (workers_[num_thread].data_.state_.load(std::memory_order_relaxed) ==
+                hpx::state::running &&
+            get_queue_length(queue_num) == 0)
+        {
+            ++data.parks_;
+
+            // Parked threads wake up regularly nevertheless to allow for
+            // background work to be performed.
+            double const max_idle_backoff_time =
+                wait_counts_[num_thread].data_.max_idle_backoff_time_;
+            std::chrono::milliseconds const timeout = limit_idle_time(timers_,
+                std::chrono::milliseconds(std::lround(max_idle_backoff_time)));
+
+#if defined(__linux__)
+            futex_wait(data.parked_, 1, timeout);
+#else
+            std::unique_lock<pu_mutex_type> l(data.mtx_);
+            data.cond_.wait_for(l, timeout, [&] {
+                return data.parked_.load(std::memory_order_relaxed) == 0;
+            });
+#endif
+        }
+
+        // reset the flag if this thread woke up on its own
+        data.parked_.store(0, std::memory_order_relaxed);
+        num_parked_.data_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void scheduler_base::unpark_all_idle_threads() noexcept
+    {
+        if (num_parked_.data_.load(std::memory_order_acquire) != 0)
+        {
+            for (std::size_t i = 0; i != parking_data_.size(); ++i)
+            {
+                unpark_idle_thread(i);
+            }
+        }
+    }
+
+    bool scheduler_base::unpark_idle_thread(std::size_t num_thread) noexcept
+    {
+        idle_parking_data& data = parking_data_[num_thread].data_;
+
+        std::uint32_t expected = 1;
+        if (!data.parked_.compare_exchange_strong(expected, 0))
+        {
+            return false;
+        }
+
+        ++data.unparks_;
+
+#if defined(__linux__)
+        futex_wake(data.parked_);
+#else
+        {
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+        }
+        data.cond_.notify_one();
+#endif
+        return true;
+    }
+#endif
+
+    std::int64_t scheduler_base::get_idle_park_count(
+        [[maybe_unused]] std::size_t num_thread, [[maybe_unused]] bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < parking_data_.size());
+            auto& value = parking_data_[num_thread].data_.parks_;
+            return reset ? value.exchange(0) : value.load();
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : parking_data_)
+        {
+            result += reset ? data.data_.parks_.exchange(0) :
+                              data.data_.parks_.load();
+        }
+        return result;
+#else
+        return 0;
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_unpark_count(
+        [[maybe_unused]] std::size_t num_thread, [[maybe_unused]] bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < parking_data_.size());
+            auto& value = parking_data_[num_thread].data_.unparks_;
+            return reset ? value.exchange(0) : value.load();
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : parking_data_)
+        {
+            result += reset ? data.data_.unparks_.exchange(0) :
+                              data.data_.unparks_.load();
+        }
+        return result;
+#else
+        return 0;
+#endif
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
-        HPX_ASSERT(num_thread < suspend_conds_.size());
+        HPX_ASSERT(num_thread < workers_.size());
 
-        states_[num_thread].data_.store(hpx::state::sleeping);
-        std::unique_lock<pu_mutex_type> l(suspend_mtxs_[num_thread]);
-        suspend_conds_[num_thread].wait(l);    //-V1089
+        worker_data& worker = workers_[num_thread].data_;
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_fast_suspend)
+        {
+            // Announce the suspension before changing the state, resume()
+            // is invoked only once the state is hpx::state::sleeping.
+            worker.suspended_.store(1, std::memory_order_seq_cst);
+            worker.state_.store(hpx::state::sleeping);
+
+            // Spin for a short while to be able to resume with minimal
+            // latency if the suspension is brief, then park on the flag
+            // without giving up the OS thread.
+            for (std::size_t k = 0; k != fast_suspend_spin_count &&
+                 worker.suspended_.load(std::memory_order_acquire) != 0;
+                 ++k)
+            {
+                HPX_SMT_PAUSE;
+            }
+
+            while (worker.suspended_.load(std::memory_order_acquire) != 0)
+            {
+#if defined(__linux__)
+                futex_wait(
+                    worker.suspended_, 1, std::chrono::milliseconds(100));
+#else
+                std::unique_lock<pu_mutex_type> l(worker.suspend_mtx_);
+                worker.suspend_cond_.wait_for(l, std::chrono::milliseconds(100),
+                    [&] { return worker.suspended_.load() == 0; });
+#endif
+            }
+        }
+        else
+        {
+            worker.state_.store(hpx::state::sleeping);
+            std::unique_lock<pu_mutex_type> l(worker.suspend_mtx_);
+            worker.suspend_cond_.wait(l);    //-V1089
+        }
 
         // Only set running if still in hpx::state::sleeping. Can be set with
         // non-blocking/locking functions to stopping or terminating, in which
         // case the state is left untouched.
         hpx::state expected = hpx::state::sleeping;
-        states_[num_thread].data_.compare_exchange_strong(
-            expected, hpx::state::running);
+        worker.state_.compare_exchange_strong(expected, hpx::state::running);
 
         HPX_ASSERT(expected == hpx::state::sleeping ||
             expected == hpx::state::stopping ||
@@ -143,25 +430,65 @@ namespace hpx::threads::policies {
     {
         if (num_thread == static_cast<std::size_t>(-1))
         {
-            for (std::condition_variable& c : suspend_conds_)
+            for (auto& worker : workers_)
             {
-                c.notify_one();
+                resume_worker(worker.data_);
+            }
+        }
+        else
+        {
+            HPX_ASSERT(num_thread < workers_.size());
+            resume_worker(workers_[num_thread].data_);
+        }
+    }
+
+    void scheduler_base::resume_worker(worker_data& worker) noexcept
+    {
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_fast_suspend)
+        {
+            std::uint32_t expected = 1;
+            if (worker.suspended_.compare_exchange_strong(expected, 0))
+            {
+#if defined(__linux__)
+                futex_wake(worker.suspended_);
+#else
+                {
+                    std::lock_guard<pu_mutex_type> l(worker.suspend_mtx_);
+                }
+                worker.suspend_cond_.notify_one();
+#endif
             }
         }
         else
         {
-            HPX_ASSERT(num_thread < suspend_conds_.size());
-            suspend_conds_[num_thread].notify_one();
+            worker.suspend_cond_.notify_one();
         }
     }
 
+    void scheduler_base::wake_idle_threads() noexcept
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_idle_parking)
+        {
+            unpark_all_idle_threads();
+        }
+        else if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::scheduler_mode::enable_idle_backoff)
+        {
+            cond_.notify_all();
+        }
+#endif
+    }
+
     std::size_t scheduler_base::select_active_pu(
         std::size_t num_thread, bool allow_fallback)
     {
         if (mode_.data_.load(std::memory_order_relaxed) &
             threads::policies::scheduler_mode::enable_elasticity)
         {
-            std::size_t states_size = states_.size();
+            std::size_t states_size = workers_.size();
 
             if (!allow_fallback)
             {
@@ -178,14 +505,15 @@ namespace hpx::threads::policies {
                     {
                         std::size_t const num_thread_local =
                             (num_thread + offset) % states_size;
+                        worker_data& worker = workers_[num_thread_local].data_;
 
                         {
                             std::unique_lock<pu_mutex_type> l(
-                                pu_mtxs_[num_thread_local], std::try_to_lock);
+                                worker.pu_mtx_, std::try_to_lock);
 
                             if (l.owns_lock())
                             {
-                                if (states_[num_thread_local].data_.load(
+                                if (worker.state_.load(
                                         std::memory_order_relaxed) <=
                                     max_allowed_state)
                                 {
@@ -195,8 +523,8 @@ namespace hpx::threads::policies {
                             }
                         }
 
-                        if (states_[num_thread_local].data_.load(
-                                std::memory_order_relaxed) <= max_allowed_state)
+                        if (worker.state_.load(std::memory_order_relaxed) <=
+                            max_allowed_state)
                         {
                             ++num_allowed_threads;
                         }
@@ -233,13 +561,14 @@ namespace hpx::threads::policies {
             {
                 std::size_t const num_thread_local =
                     (num_thread + offset) % states_size;
+                worker_data& worker = workers_[num_thread_local].data_;
 
                 std::unique_lock<pu_mutex_type> l(
-                    pu_mtxs_[num_thread_local], std::try_to_lock);
+                    worker.pu_mtx_, std::try_to_lock);
 
                 if (l.owns_lock() &&
-                    states_[num_thread_local].data_.load(
-                        std::memory_order_relaxed) <= hpx::state::suspended)
+                    worker.state_.load(std::memory_order_relaxed) <=
+                        hpx::state::suspended)
                 {
                     return num_thread_local;
                 }
@@ -249,45 +578,292 @@ namespace hpx::threads::policies {
         return num_thread;
     }
 
+    void scheduler_base::set_numa_domain(
+        std::size_t num_thread, std::size_t domain)
+    {
+        HPX_ASSERT(num_thread < workers_.size());
+        workers_[num_thread].data_.numa_domain_.store(
+            domain, std::memory_order_relaxed);
+    }
+
+    std::size_t scheduler_base::select_numa_thread(std::size_t domain) noexcept
+    {
+        std::size_t const num_threads = workers_.size();
+
+        // prefer the calling worker thread, this keeps data touched by a
+        // thread on the core that created the work
+        if (parent_pool_ != nullptr &&
+            threads::detail::get_thread_pool_num_tss() ==
+                parent_pool_->get_pool_index())
+        {
+            std::size_t const local_num =
+                threads::detail::get_local_thread_num_tss();
+            if (local_num < num_threads &&
+                workers_[local_num].data_.numa_domain_.load(
+                    std::memory_order_relaxed) == domain)
+            {
+                return local_num;
+            }
+        }
+
+        // otherwise distribute the work over the worker threads of the domain
+        std::size_t const start =
+            numa_next_thread_.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t offset = 0; offset != num_threads; ++offset)
+        {
+            std::size_t const num_thread = (start + offset) % num_threads;
+            if (workers_[num_thread].data_.numa_domain_.load(
+                    std::memory_order_relaxed) == domain)
+            {
+                return num_thread;
+            }
+        }
+        return static_cast<std::size_t>(-1);
+    }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    namespace {
+
+        // bucket zero counts zero values, bucket i counts v < 2^i
+        constexpr std::size_t get_steal_histogram_bucket(
+            std::uint64_t value) noexcept
+        {
+            std::size_t bucket = 0;
+            while (value != 0 && bucket != steal_histogram_num_buckets - 1)
+            {
+                value >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        template <std::size_t N>
+        void add_buckets(std::vector<std::int64_t>& result,
+            std::array<std::atomic<std::int64_t>, N>& buckets, bool reset)
+        {
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result[i] += get_and_reset(buckets[i], reset);
+            }
+        }
+    }    // namespace
+
+    void scheduler_base::init_steal_telemetry(
+        std::size_t num_thread, detail::affinity_data const& affinity_data)
+    {
+        HPX_ASSERT(num_thread < steal_telemetry_.size());
+
+        auto const& topo = create_topology();
+
+        std::size_t const num_pu = affinity_data.get_pu_num(num_thread);
+        mask_type const core_mask = topo.get_core_affinity_mask(num_pu);
+        mask_type const numa_mask = topo.get_numa_node_affinity_mask(num_pu);
+
+        std::size_t const num_threads = steal_telemetry_.size();
+        std::vector<steal_distance> distances(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            std::size_t const other_pu = affinity_data.get_pu_num(i);
+            mask_type const other_numa_mask =
+                topo.get_numa_node_affinity_mask(other_pu);
+            if (any(core_mask & topo.get_core_affinity_mask(other_pu)))
+            {
+                distances[i] = steal_distance::core;
+            }
+            else if (any(numa_mask & other_numa_mask))
+            {
+                distances[i] = steal_distance::numa_domain;
+            }
+            else
+            {
+                distances[i] = steal_distance::remote;
+            }
+        }
+
+        auto& data = steal_telemetry_[num_thread].data_;
+        data.distances_ = HPX_MOVE(distances);
+        data.attempt_started_ = 0;
+    }
+
+    void scheduler_base::record_steal_attempt(std::size_t num_thread) noexcept
+    {
+        HPX_ASSERT(num_thread < steal_telemetry_.size());
+
+        // repeated searches (or steal requests) are part of the same attempt
+        // until the worker thread has found work again
+        auto& data = steal_telemetry_[num_thread].data_;
+        if (data.attempt_started_ == 0)
+        {
+            data.attempts_.fetch_add(1, std::memory_order_relaxed);
+            data.attempt_started_ =
+                static_cast<std::int64_t>(hpx::chrono::tsc_clock::now());
+        }
+    }
+
+    void scheduler_base::record_steal(std::size_t num_thread,
+        std::size_t victim, std::size_t num_tasks) noexcept
+    {
+        HPX_ASSERT(num_thread < steal_telemetry_.size());
+
+#if defined(HPX_HAVE_TASK_TRACING)
+        tracing::task_steal(victim, num_tasks);
+#endif
+
+        auto& data = steal_telemetry_[num_thread].data_;
+        data.successes_.fetch_add(1, std::memory_order_relaxed);
+
+        // the distances are not known before the worker thread has started
+        if (victim < data.distances_.size())
+        {
+            data.victim_distance_[static_cast<std::size_t>(
+                                      data.distances_[victim])]
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+
+        data.stolen_tasks_[get_steal_histogram_bucket(num_tasks)].fetch_add(
+            1, std::memory_order_relaxed);
+
+        if (data.attempt_started_ != 0)
+        {
+            std::int64_t const elapsed =
+                static_cast<std::int64_t>(hpx::chrono::tsc_clock::now()) -
+                data.attempt_started_;
+            std::size_t const bucket = get_steal_histogram_bucket(
+                elapsed > 0 ? static_cast<std::uint64_t>(elapsed) : 0);
+            data.time_to_steal_[bucket].fetch_add(
+                1, std::memory_order_relaxed);
+            data.attempt_started_ = 0;
+        }
+    }
+
+    std::int64_t scheduler_base::get_num_steal_attempts(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < steal_telemetry_.size());
+            return get_and_reset(
+                steal_telemetry_[num_thread].data_.attempts_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : steal_telemetry_)
+        {
+            result += get_and_reset(data.data_.attempts_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_num_steal_successes(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < steal_telemetry_.size());
+            return get_and_reset(
+                steal_telemetry_[num_thread].data_.successes_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : steal_telemetry_)
+        {
+            result += get_and_reset(data.data_.successes_, reset);
+        }
+        return result;
+    }
+
+    std::vector<std::int64_t> scheduler_base::get_steal_histogram(
+        steal_histogram which, std::size_t num_thread, bool reset)
+    {
+        std::vector<std::int64_t> result(get_steal_histogram_size(which), 0);
+
+        std::size_t first = 0;
+        std::size_t last = steal_telemetry_.size();
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            HPX_ASSERT(num_thread < steal_telemetry_.size());
+            first = num_thread;
+            last = num_thread + 1;
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            auto& data = steal_telemetry_[i].data_;
+            switch (which)
+            {
+            case steal_histogram::victim_distance:
+                add_buckets(result, data.victim_distance_, reset);
+                break;
+
+            case steal_histogram::stolen_tasks:
+                add_buckets(result, data.stolen_tasks_, reset);
+                break;
+
+            case steal_histogram::time_to_steal:
+                add_buckets(result, data.time_to_steal_, reset);
+                break;
+            }
+        }
+        return result;
+    }
+#endif
+
     // allow to access/manipulate states
     std::atomic<hpx::state>& scheduler_base::get_state(std::size_t num_thread)
     {
-        HPX_ASSERT(num_thread < states_.size());
-        return states_[num_thread].data_;
+        HPX_ASSERT(num_thread < workers_.size());
+        return workers_[num_thread].data_.state_;
     }
 
     std::atomic<hpx::state> const& scheduler_base::get_state(
         std::size_t num_thread) const
     {
-        HPX_ASSERT(num_thread < states_.size());
-        return states_[num_thread].data_;
+        HPX_ASSERT(num_thread < workers_.size());
+        return workers_[num_thread].data_.state_;
     }
 
     void scheduler_base::set_all_states(hpx::state s)
     {
-        for (auto& state : states_)
+        for (auto& worker : workers_)
         {
-            state.data_.store(s);
+            worker.data_.state_.store(s);
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads notice the state change
+        unpark_all_idle_threads();
+#endif
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
     {
-        for (auto& state : states_)
+        for (auto& worker : workers_)
         {
-            if (state.data_.load(std::memory_order_relaxed) < s)
+            if (worker.data_.state_.load(std::memory_order_relaxed) < s)
             {
-                state.data_.store(s, std::memory_order_release);
+                worker.data_.state_.store(s, std::memory_order_release);
             }
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads notice the state change
+        unpark_all_idle_threads();
+#endif
     }
 
     // return whether all states are at least at the given one
     bool scheduler_base::has_reached_state(hpx::state s) const
     {
-        for (auto const& state : states_)
+        for (auto const& worker : workers_)
         {
-            if (state.data_.load(std::memory_order_relaxed) < s)
+            if (worker.data_.state_.load(std::memory_order_relaxed) < s)
                 return false;
         }
         return true;
@@ -295,9 +871,9 @@ namespace hpx::threads::policies {
 
     bool scheduler_base::is_state(hpx::state s) const
     {
-        for (auto const& state : states_)
+        for (auto const& worker : workers_)
         {
-            if (state.data_.load(std::memory_order_relaxed) != s)
+            if (worker.data_.state_.load(std::memory_order_relaxed) != s)
                 return false;
         }
         return true;
@@ -309,9 +885,9 @@ namespace hpx::threads::policies {
             hpx::state::last_valid_runtime_state,
             hpx::state::first_valid_runtime_state);
 
-        for (auto const& state_iter : states_)
+        for (auto const& worker : workers_)
         {
-            hpx::state s = state_iter.data_.load(std::memory_order_relaxed);
+            hpx::state s = worker.data_.state_.load(std::memory_order_relaxed);
             result.first = (std::min)(result.first, s);
             result.second = (std::max)(result.second, s);
         }
@@ -467,6 +1043,50 @@ namespace hpx::threads::policies {
         return thread_queue_init_.small_stacksize_;
     }
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    void scheduler_base::select_stack_size(
+        thread_init_data& data) const noexcept
+    {
+        // explicitly requested stack sizes are always honored
+        if (!thread_queue_init_.auto_select_stacksize_ ||
+            data.stacksize != thread_stacksize::small_)
+        {
+            return;
+        }
+
+        std::size_t const used = get_max_stack_usage(data.description);
+        if (used == 0)
+        {
+            return;
+        }
+
+        // leave a safety margin of 25% on top of the observed usage
+        auto const required = static_cast<std::ptrdiff_t>(used + used / 4);
+        if (required <= thread_queue_init_.small_stacksize_)
+        {
+            return;
+        }
+
+        if (required <= thread_queue_init_.medium_stacksize_)
+        {
+            data.stacksize = thread_stacksize::medium;
+        }
+        else if (required <= thread_queue_init_.large_stacksize_)
+        {
+            data.stacksize = thread_stacksize::large;
+        }
+        else
+        {
+            data.stacksize = thread_stacksize::huge;
+        }
+    }
+#else
+    void scheduler_base::select_stack_size(thread_init_data&) const noexcept
+    {
+        // the stack usage can't be attributed to threads without descriptions
+    }
+#endif
+
     void scheduler_base::set_mpi_polling_functions(
         polling_function_ptr mpi_func,
         polling_work_count_function_ptr mpi_work_count_func)
@@ -518,6 +1138,24 @@ namespace hpx::threads::policies {
             &null_polling_work_count_function, std::memory_order_relaxed);
     }
 
+    void scheduler_base::set_io_uring_polling_functions(
+        polling_function_ptr io_uring_func,
+        polling_work_count_function_ptr io_uring_work_count_func)
+    {
+        polling_function_io_uring_.store(
+            io_uring_func, std::memory_order_relaxed);
+        polling_work_count_function_io_uring_.store(
+            io_uring_work_count_func, std::memory_order_relaxed);
+    }
+
+    void scheduler_base::clear_io_uring_polling_function()
+    {
+        polling_function_io_uring_.store(
+            &null_polling_function, std::memory_order_relaxed);
+        polling_work_count_function_io_uring_.store(
+            &null_polling_work_count_function, std::memory_order_relaxed);
+    }
+
     detail::polling_status scheduler_base::custom_polling_function() const
     {
         detail::polling_status status = detail::polling_status::idle;
@@ -541,6 +1179,13 @@ namespace hpx::threads::policies {
         {
             status = detail::polling_status::busy;
         }
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO_URING)
+        if ((*polling_function_io_uring_.load(std::memory_order_relaxed))() ==
+            detail::polling_status::busy)
+        {
+            status = detail::polling_status::busy;
+        }
 #endif
         return status;
     }
@@ -559,6 +1204,10 @@ namespace hpx::threads::policies {
 #if defined(HPX_HAVE_MODULE_ASYNC_SYCL)
         work_count +=
             polling_work_count_function_sycl_.load(std::memory_order_relaxed)();
+#endif
+#if defined(HPX_HAVE_MODULE_ASYNC_IO_URING)
+        work_count += polling_work_count_function_io_uring_.load(
+            std::memory_order_relaxed)();
 #endif
         return work_count;
     }
@@ -12,7 +12,11 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
@@ -151,6 +155,121 @@ namespace hpx::threads::detail {
         return {thread_schedule_state::terminated, invalid_thread_id};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // A timed state change registered with the timer wheel of the scheduler.
+    // The timer thread (a suspended stackless thread) is made pending by the
+    // wheel once the timer expired, or by whoever aborts the timed state
+    // change. The state is kept alive by the timer thread and, while the
+    // timer is registered, by the wheel.
+    struct timed_thread_state final : timer_wheel_node
+    {
+        timed_thread_state(policies::scheduler_base* scheduler,
+            thread_id_type const& thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority,
+            bool retry_on_active) noexcept
+          : timer_wheel_node(&timed_thread_state::expire)
+          , scheduler(scheduler)
+          , thrd(thrd)
+          , newstate(newstate)
+          , newstate_ex(newstate_ex)
+          , priority(priority)
+          , retry_on_active(retry_on_active)
+        {
+        }
+
+        static void expire(timer_wheel_node* node, bool expired) noexcept
+        {
+            auto* this_ = static_cast<timed_thread_state*>(node);
+
+            // release the references held on behalf of the wheel
+            std::shared_ptr<timed_thread_state> const self =
+                HPX_MOVE(this_->self);
+            thread_id_ref_type const timer_id = HPX_MOVE(this_->timer_id);
+
+            if (expired)
+            {
+                error_code ec(throwmode::lightweight);    // do not throw
+                set_thread_state(timer_id.noref(),
+                    thread_schedule_state::pending,
+                    thread_restart_state::timeout, this_->priority,
+                    thread_schedule_hint(), this_->retry_on_active, ec);
+            }
+        }
+
+        policies::scheduler_base* scheduler;
+        thread_id_ref_type thrd;
+        thread_schedule_state newstate;
+        thread_restart_state newstate_ex;
+        thread_priority priority;
+        bool retry_on_active;
+
+        thread_id_ref_type timer_id;
+        std::shared_ptr<timed_thread_state> self;
+    };
+
+    thread_result_type timed_thread_state_thread(
+        std::shared_ptr<timed_thread_state> const& state,
+        thread_restart_state statex)
+    {
+        HPX_ASSERT(statex == thread_restart_state::abort ||
+            statex == thread_restart_state::timeout);
+
+        if (statex == thread_restart_state::timeout)
+        {
+            detail::set_thread_state(state->thrd.noref(), state->newstate,
+                state->newstate_ex, state->priority);
+        }
+        else if (state->scheduler->get_timer_wheel().remove(state.get()))
+        {
+            // the timed state change was aborted before the timer expired
+            state->timer_id = thread_id_ref_type();
+            state->self.reset();
+        }
+
+        return {thread_schedule_state::terminated, invalid_thread_id};
+    }
+
+    thread_id_ref_type set_thread_state_timer_wheel(
+        policies::scheduler_base* scheduler,
+        hpx::chrono::steady_time_point const& abs_time,
+        thread_id_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        thread_schedule_hint schedulehint, std::atomic<bool>* started,
+        bool retry_on_active, error_code& ec)
+    {
+        auto state = std::make_shared<timed_thread_state>(
+            scheduler, thrd, newstate, newstate_ex, priority, retry_on_active);
+
+        // the timer thread never suspends, it can run stackless
+        thread_init_data data(
+            hpx::bind_front(&timed_thread_state_thread, state),
+            "timed_thread_state", priority, schedulehint,
+            thread_stacksize::nostack, thread_schedule_state::suspended, true);
+
+        thread_id_ref_type newid = invalid_thread_id;
+        create_thread(scheduler, data, newid, ec);    //-V601
+        if (ec)
+        {
+            return invalid_thread_id;
+        }
+
+        state->timer_id = newid;
+        state->self = state;
+
+        if (scheduler->get_timer_wheel().add(state.get(), abs_time.value()))
+        {
+            // make sure idling worker threads wake up in time for the new
+            // timer
+            scheduler->do_some_work(static_cast<std::size_t>(-1));
+        }
+
+        if (started != nullptr)
+        {
+            started->store(true);
+        }
+        return newid;
+    }
+
     // Set a timer to set the state of the given \a thread to the given new
     // value after it expired (at the given time)
     thread_id_ref_type set_thread_state_timed(
@@ -169,6 +288,15 @@ namespace hpx::threads::detail {
             return invalid_thread_id;
         }
 
+        if (scheduler != nullptr &&
+            scheduler->has_scheduler_mode(
+                policies::scheduler_mode::enable_timer_wheel))
+        {
+            return set_thread_state_timer_wheel(scheduler, abs_time, thrd,
+                newstate, newstate_ex, priority, schedulehint, started,
+                retry_on_active, ec);
+        }
+
         // this creates a new thread that creates the timer and handles the
         // requested actions
         thread_init_data data(
@@ -0,0 +1,70 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+#include <hpx/threading_base/task_counter_hooks.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::threads {
+
+    namespace detail {
+
+        std::atomic<task_counter_hooks const*> task_counter_hooks_ptr(nullptr);
+
+        namespace {
+
+            std::atomic<std::size_t> task_counter_sampling_rate(1);
+        }    // namespace
+
+        task_counter_hooks const* sample_task_counters() noexcept
+        {
+            // every worker thread samples its own execution phases, which
+            // avoids any contention
+            static thread_local std::size_t phases = 0;
+            if (++phases <
+                task_counter_sampling_rate.load(std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            phases = 0;
+
+            task_counter_hooks const* hooks =
+                task_counter_hooks_ptr.load(std::memory_order_acquire);
+            if (hooks != nullptr)
+            {
+                hooks->begin();
+            }
+            return hooks;
+        }
+
+        void end_task_counters(task_counter_hooks const* hooks,
+            thread_data const* thrd, thread_schedule_state state) noexcept
+        {
+            thread_description const desc = thrd->get_description();
+            hooks->end(
+                desc.kind() == thread_description::data_type_description ?
+                    desc.get_description() :
+                    nullptr,
+                state);
+        }
+    }    // namespace detail
+
+    void set_task_counter_hooks(
+        task_counter_hooks const* hooks, std::size_t sampling_rate)
+    {
+        detail::task_counter_sampling_rate.store(
+            sampling_rate != 0 ? sampling_rate : 1, std::memory_order_relaxed);
+        detail::task_counter_hooks_ptr.store(hooks, std::memory_order_release);
+    }
+}    // namespace hpx::threads
+
+#endif
@@ -0,0 +1,613 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/task_trace_analysis.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace {
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // One execution of an HPX thread, from being started or resumed until
+        // it suspends or terminates
+        struct execution
+        {
+            std::uint64_t begin;
+            std::uint64_t end;
+            std::uint64_t thread;
+            char const* name;
+            bool suspended;
+        };
+
+        // A dependency of an execution on another one, the dependency is
+        // satisfied after the other execution has run for the given time
+        struct dependency
+        {
+            std::size_t from;
+            std::uint64_t offset;
+        };
+
+        // An event recorded during an execution (npos if the event was
+        // recorded outside of any HPX thread)
+        struct located_event
+        {
+            std::uint64_t timestamp;
+            std::uint64_t id;
+            std::size_t execution;
+        };
+
+        // A time interval during which a task was blocked or a worker was
+        // idle, encoded as the change of the number of blocked tasks (or
+        // idle workers) at the given time
+        struct interval_change
+        {
+            std::uint64_t timestamp;
+            int idle;
+            int lock;
+            int network;
+        };
+
+        class trace_analyzer
+        {
+        public:
+            explicit trace_analyzer(
+                std::vector<detail::thread_events> const& threads)
+            {
+                for (auto const& thread : threads)
+                {
+                    collect_executions(thread);
+                }
+            }
+
+            task_trace_analysis analyze(
+                std::uint64_t interval, std::size_t max_intervals)
+            {
+                task_trace_analysis result;
+                if (executions_.empty())
+                {
+                    return result;
+                }
+
+                for (execution const& e : executions_)
+                {
+                    start_ = (std::min)(start_, e.begin);
+                    end_ = (std::max)(end_, e.end);
+                    result.work += e.end - e.begin;
+                }
+                result.duration = end_ - start_;
+                result.num_executions = executions_.size();
+
+                index_executions();
+                result.num_dependencies = add_dependencies();
+
+                compute_critical_path(result);
+                compute_parallelism(result, interval, max_intervals);
+                compute_idle_times(result);
+
+                return result;
+            }
+
+        private:
+            void collect_executions(detail::thread_events const& thread)
+            {
+                std::size_t current = npos;
+                std::size_t const first = executions_.size();
+
+                for (detail::event const& e : thread.events)
+                {
+                    switch (e.type)
+                    {
+                    case event_type::task_begin:
+                        current = executions_.size();
+                        executions_.push_back(execution{e.timestamp, 0, e.id,
+                            e.name != nullptr ? e.name : "<unknown>", false});
+                        break;
+
+                    case event_type::task_end:
+                        [[fallthrough]];
+                    case event_type::task_suspend:
+                        if (current != npos)
+                        {
+                            executions_[current].end = e.timestamp;
+                            executions_[current].suspended =
+                                e.type == event_type::task_suspend;
+                            current = npos;
+                        }
+                        break;
+
+                    case event_type::task_create:
+                        creates_.push_back({e.timestamp, e.id, current});
+                        break;
+
+                    case event_type::future_ready:
+                        readies_[e.id].push_back({e.timestamp, e.id, current});
+                        break;
+
+                    case event_type::future_wait:
+                        if (current != npos)
+                        {
+                            waits_.push_back({e.timestamp, e.id, current});
+                        }
+                        break;
+
+                    case event_type::lock_wait:
+                        if (current != npos)
+                        {
+                            lock_waits_.push_back({e.timestamp, e.id, current});
+                        }
+                        break;
+
+                    case event_type::parcel_receive:
+                        receives_.push_back(e.timestamp);
+                        break;
+
+                    default:
+                        break;
+                    }
+                }
+
+                // an execution which has not finished yet is taken into
+                // account up to the last event recorded by this thread
+                if (current != npos)
+                {
+                    executions_[current].end = thread.events.back().timestamp;
+                }
+
+                if (thread.is_worker && executions_.size() != first)
+                {
+                    workers_.emplace_back(first, executions_.size());
+                }
+            }
+
+            void index_executions()
+            {
+                for (std::size_t i = 0; i != executions_.size(); ++i)
+                {
+                    by_thread_[executions_[i].thread].push_back(i);
+                }
+
+                auto const earlier = [this](std::size_t lhs, std::size_t rhs) {
+                    return executions_[lhs].begin < executions_[rhs].begin;
+                };
+                for (auto& e : by_thread_)
+                {
+                    std::sort(e.second.begin(), e.second.end(), earlier);
+                }
+
+                for (auto& e : readies_)
+                {
+                    std::sort(e.second.begin(), e.second.end(),
+                        [](located_event const& lhs, located_event const& rhs) {
+                            return lhs.timestamp < rhs.timestamp;
+                        });
+                }
+                std::sort(receives_.begin(), receives_.end());
+            }
+
+            // Return the first execution of the given thread starting at or
+            // after the given time
+            std::size_t next_execution(
+                std::uint64_t thread, std::uint64_t timestamp) const
+            {
+                auto const it = by_thread_.find(thread);
+                if (it == by_thread_.end())
+                {
+                    return npos;
+                }
+
+                auto const pos = std::lower_bound(it->second.begin(),
+                    it->second.end(), timestamp,
+                    [this](std::size_t lhs, std::uint64_t t) {
+                        return executions_[lhs].begin < t;
+                    });
+                return pos != it->second.end() ? *pos : npos;
+            }
+
+            void add_dependency(std::size_t to, std::size_t from,
+                std::uint64_t timestamp)
+            {
+                execution const& e = executions_[from];
+                std::uint64_t const offset = timestamp > e.begin ?
+                    (std::min)(timestamp, e.end) - e.begin :
+                    0;
+                dependencies_[to].push_back(dependency{from, offset});
+            }
+
+            // Add an interval during which a task was blocked
+            void add_blocked(std::uint64_t begin, std::size_t resumed,
+                bool lock, bool network)
+            {
+                std::uint64_t const end =
+                    resumed != npos ? executions_[resumed].begin : end_;
+                if (begin < end)
+                {
+                    changes_.push_back(interval_change{
+                        begin, 0, lock ? 1 : 0, network ? 1 : 0});
+                    changes_.push_back(interval_change{
+                        end, 0, lock ? -1 : 0, network ? -1 : 0});
+                }
+            }
+
+            bool received_parcel(
+                std::uint64_t begin, std::uint64_t end) const noexcept
+            {
+                auto const it =
+                    std::lower_bound(receives_.begin(), receives_.end(), begin);
+                return it != receives_.end() && *it <= end;
+            }
+
+            std::size_t add_dependencies()
+            {
+                dependencies_.resize(executions_.size());
+
+                // a suspended thread continues where it left off
+                for (auto const& e : by_thread_)
+                {
+                    for (std::size_t i = 1; i < e.second.size(); ++i)
+                    {
+                        std::size_t const prev = e.second[i - 1];
+                        if (executions_[prev].suspended)
+                        {
+                            add_dependency(
+                                e.second[i], prev, executions_[prev].end);
+                        }
+                    }
+                }
+
+                // a new thread depends on the execution creating it, the new
+                // thread may start running before the creation was recorded
+                for (located_event const& c : creates_)
+                {
+                    if (c.execution == npos)
+                    {
+                        continue;
+                    }
+
+                    std::size_t const child = next_execution(
+                        c.id, executions_[c.execution].begin);
+                    if (child != npos && child != c.execution)
+                    {
+                        add_dependency(child, c.execution, c.timestamp);
+                    }
+                }
+
+                // a thread waiting on a future depends on the execution which
+                // made the future ready
+                for (located_event const& w : waits_)
+                {
+                    std::size_t const resumed =
+                        next_execution(executions_[w.execution].thread,
+                            executions_[w.execution].end);
+
+                    located_event const* ready = nullptr;
+                    if (auto const it = readies_.find(w.id);
+                        it != readies_.end())
+                    {
+                        auto const pos = std::lower_bound(it->second.begin(),
+                            it->second.end(), w.timestamp,
+                            [](located_event const& lhs, std::uint64_t t) {
+                                return lhs.timestamp < t;
+                            });
+                        if (pos != it->second.end())
+                        {
+                            ready = &*pos;
+                        }
+                    }
+
+                    bool network = false;
+                    if (ready != nullptr)
+                    {
+                        network = ready->execution == npos ||
+                            received_parcel(w.timestamp, ready->timestamp);
+                        if (resumed != npos && ready->execution != npos)
+                        {
+                            add_dependency(
+                                resumed, ready->execution, ready->timestamp);
+                        }
+                    }
+                    add_blocked(w.timestamp, resumed, false, network);
+                }
+
+                for (located_event const& w : lock_waits_)
+                {
+                    add_blocked(w.timestamp,
+                        next_execution(executions_[w.execution].thread,
+                            executions_[w.execution].end),
+                        true, false);
+                }
+
+                std::size_t result = 0;
+                for (auto const& d : dependencies_)
+                {
+                    result += d.size();
+                }
+                return result;
+            }
+
+            void compute_critical_path(task_trace_analysis& result) const
+            {
+                std::vector<std::size_t> order(executions_.size());
+                for (std::size_t i = 0; i != order.size(); ++i)
+                {
+                    order[i] = i;
+                }
+                std::stable_sort(order.begin(), order.end(),
+                    [this](std::size_t lhs, std::size_t rhs) {
+                        return executions_[lhs].begin < executions_[rhs].begin;
+                    });
+
+                // the length of the longest chain of executions ending with
+                // a given execution, and the dependency it was reached by
+                std::vector<std::uint64_t> length(executions_.size(), 0);
+                std::vector<bool> done(executions_.size(), false);
+                std::vector<dependency> best(
+                    executions_.size(), dependency{npos, 0});
+
+                std::size_t last = npos;
+                for (std::size_t const i : order)
+                {
+                    execution const& e = executions_[i];
+
+                    std::uint64_t before = 0;
+                    for (dependency const& d : dependencies_[i])
+                    {
+                        if (!done[d.from])
+                        {
+                            continue;
+                        }
+
+                        execution const& from = executions_[d.from];
+                        std::uint64_t const l =
+                            length[d.from] - (from.end - from.begin) + d.offset;
+                        if (l > before || best[i].from == npos)
+                        {
+                            before = l;
+                            best[i] = d;
+                        }
+                    }
+
+                    length[i] = before + (e.end - e.begin);
+                    done[i] = true;
+
+                    if (last == npos || length[i] > length[last])
+                    {
+                        last = i;
+                    }
+                }
+
+                result.critical_path = length[last];
+
+                // accumulate the time spent on the critical path by name
+                std::map<std::string, std::uint64_t> times;
+                std::uint64_t time = executions_[last].end -
+                    executions_[last].begin;
+                for (std::size_t i = last; i != npos; /**/)
+                {
+                    times[executions_[i].name] += time;
+                    time = best[i].offset;
+                    i = best[i].from;
+                }
+
+                result.critical_path_tasks.assign(times.begin(), times.end());
+                std::stable_sort(result.critical_path_tasks.begin(),
+                    result.critical_path_tasks.end(),
+                    [](auto const& lhs, auto const& rhs) {
+                        return lhs.second > rhs.second;
+                    });
+            }
+
+            void compute_parallelism(task_trace_analysis& result,
+                std::uint64_t interval, std::size_t max_intervals) const
+            {
+                result.interval = interval;
+                if (interval == 0 || max_intervals == 0)
+                {
+                    return;
+                }
+
+                std::size_t const num_intervals =
+                    (std::min)(static_cast<std::size_t>(
+                                   (end_ - start_ + interval - 1) / interval),
+                        max_intervals);
+
+                std::vector<std::uint64_t> busy(
+                    (std::max)(num_intervals, std::size_t(1)), 0);
+                std::uint64_t const limit =
+                    start_ + interval * static_cast<std::uint64_t>(busy.size());
+
+                for (execution const& e : executions_)
+                {
+                    std::uint64_t begin = e.begin;
+                    std::uint64_t const end = (std::min)(e.end, limit);
+                    while (begin < end)
+                    {
+                        auto const i = static_cast<std::size_t>(
+                            (begin - start_) / interval);
+                        std::uint64_t const next = (std::min)(
+                            end, start_ + (i + 1) * interval);
+                        busy[i] += next - begin;
+                        begin = next;
+                    }
+                }
+
+                result.parallelism.reserve(busy.size());
+                for (std::uint64_t const b : busy)
+                {
+                    result.parallelism.push_back(static_cast<double>(b) /
+                        static_cast<double>(interval));
+                }
+            }
+
+            void compute_idle_times(task_trace_analysis& result)
+            {
+                // the gaps between the executions of every worker thread
+                for (auto const& w : workers_)
+                {
+                    std::uint64_t idle_since = start_;
+                    for (std::size_t i = w.first; i != w.second; ++i)
+                    {
+                        if (idle_since < executions_[i].begin)
+                        {
+                            changes_.push_back(
+                                interval_change{idle_since, 1, 0, 0});
+                            changes_.push_back(interval_change{
+                                executions_[i].begin, -1, 0, 0});
+                        }
+                        idle_since = (std::max)(idle_since, executions_[i].end);
+                    }
+                    if (idle_since < end_)
+                    {
+                        changes_.push_back(
+                            interval_change{idle_since, 1, 0, 0});
+                        changes_.push_back(interval_change{end_, -1, 0, 0});
+                    }
+                }
+
+                std::sort(changes_.begin(), changes_.end(),
+                    [](interval_change const& lhs, interval_change const& rhs) {
+                        return lhs.timestamp < rhs.timestamp;
+                    });
+
+                // attribute the idle time to the reason which applies at a
+                // given point in time
+                int idle = 0;
+                int lock = 0;
+                int network = 0;
+                std::uint64_t last = start_;
+                for (interval_change const& c : changes_)
+                {
+                    if (c.timestamp > last && idle > 0)
+                    {
+                        std::uint64_t const time =
+                            static_cast<std::uint64_t>(idle) *
+                            (c.timestamp - last);
+                        if (lock > 0)
+                        {
+                            result.idle_lock += time;
+                        }
+                        else if (network > 0)
+                        {
+                            result.idle_network += time;
+                        }
+                        else
+                        {
+                            result.idle_no_work += time;
+                        }
+                    }
+
+                    last = (std::max)(last, c.timestamp);
+                    idle += c.idle;
+                    lock += c.lock;
+                    network += c.network;
+                }
+            }
+
+            std::vector<execution> executions_;
+            std::vector<std::vector<dependency>> dependencies_;
+            std::unordered_map<std::uint64_t, std::vector<std::size_t>>
+                by_thread_;
+
+            // the ranges of executions recorded by the worker threads
+            std::vector<std::pair<std::size_t, std::size_t>> workers_;
+
+            std::vector<located_event> creates_;
+            std::unordered_map<std::uint64_t, std::vector<located_event>>
+                readies_;
+            std::vector<located_event> waits_;
+            std::vector<located_event> lock_waits_;
+            std::vector<std::uint64_t> receives_;
+
+            std::vector<interval_change> changes_;
+
+            std::uint64_t start_ = static_cast<std::uint64_t>(-1);
+            std::uint64_t end_ = 0;
+        };
+
+        void write_time(std::ostream& os, std::uint64_t ns)
+        {
+            os << std::fixed << std::setprecision(3)
+               << static_cast<double>(ns) / 1e6 << " [ms]";
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_trace_analysis analyze_trace(
+        std::uint64_t interval, std::size_t max_intervals)
+    {
+        return trace_analyzer(detail::get_recorded_events())
+            .analyze(interval, max_intervals);
+    }
+
+    void write_trace_analysis(
+        std::ostream& os, task_trace_analysis const& analysis)
+    {
+        std::ios_base::fmtflags const flags = os.flags();
+        std::streamsize const precision = os.precision();
+
+        os << "task executions:     " << analysis.num_executions << "\n";
+        os << "dependencies:        " << analysis.num_dependencies << "\n";
+        os << "duration:            ";
+        write_time(os, analysis.duration);
+        os << "\nwork:                ";
+        write_time(os, analysis.work);
+        os << "\ncritical path:       ";
+        write_time(os, analysis.critical_path);
+        os << "\naverage parallelism: " << std::setprecision(2)
+           << analysis.average_parallelism() << "\n";
+
+        os << "idle (no work):      ";
+        write_time(os, analysis.idle_no_work);
+        os << "\nidle (network):      ";
+        write_time(os, analysis.idle_network);
+        os << "\nidle (lock):         ";
+        write_time(os, analysis.idle_lock);
+        os << "\n";
+
+        if (!analysis.critical_path_tasks.empty())
+        {
+            os << "critical path tasks:\n";
+            for (auto const& e : analysis.critical_path_tasks)
+            {
+                os << "  ";
+                write_time(os, e.second);
+                os << "  " << e.first << "\n";
+            }
+        }
+
+        if (!analysis.parallelism.empty())
+        {
+            os << "parallelism (per ";
+            write_time(os, analysis.interval);
+            os << "):\n";
+            for (std::size_t i = 0; i != analysis.parallelism.size(); ++i)
+            {
+                os << "  " << std::setw(6) << i << ": " << std::setprecision(2)
+                   << analysis.parallelism[i] << "\n";
+            }
+        }
+
+        os.flags(flags);
+        os.precision(precision);
+    }
+}    // namespace hpx::threads::tracing
+
+#endif
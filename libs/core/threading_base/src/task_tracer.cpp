@@ -0,0 +1,562 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/scoped_annotation.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace detail {
+
+        std::atomic<bool> tracing_enabled(false);
+
+        // whether annotations were enabled before tracing was started
+        std::atomic<bool> annotations_were_enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        using detail::event;
+
+        // The events of an OS thread are stored in a list of fixed size
+        // chunks. Only the owning thread appends events, the number of
+        // valid events of a chunk is published with release semantics to
+        // allow for reading the events without any locking.
+        struct chunk
+        {
+            static constexpr std::size_t capacity = 4096;
+
+            std::atomic<std::size_t> count{0};
+            std::atomic<chunk*> next{nullptr};
+            event events[capacity];
+        };
+
+        struct thread_buffer
+        {
+            explicit thread_buffer(
+                std::uint32_t tid, std::string name, std::size_t generation)
+              : first(new chunk)
+              , current(first)
+              , size(0)
+              , generation(generation)
+              , dropped(0)
+              , tid(tid)
+              , name(HPX_MOVE(name))
+            {
+            }
+
+            thread_buffer(thread_buffer const&) = delete;
+            thread_buffer& operator=(thread_buffer const&) = delete;
+
+            ~thread_buffer()
+            {
+                chunk* c = first;
+                while (c != nullptr)
+                {
+                    chunk* next = c->next.load(std::memory_order_relaxed);
+                    delete c;
+                    c = next;
+                }
+            }
+
+            void push(event_type type, char const* name, std::uint64_t id,
+                std::uint64_t arg, std::size_t current_generation,
+                std::size_t max_events) noexcept
+            {
+                // the buffer was cleared, reuse the existing chunks
+                if (generation.load(std::memory_order_relaxed) !=
+                    current_generation)
+                {
+                    for (chunk* c = first; c != nullptr;
+                         c = c->next.load(std::memory_order_relaxed))
+                    {
+                        c->count.store(0, std::memory_order_relaxed);
+                    }
+                    current = first;
+                    size = 0;
+                    generation.store(
+                        current_generation, std::memory_order_release);
+                }
+
+                if (size >= max_events)
+                {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                std::size_t n = current->count.load(std::memory_order_relaxed);
+                if (n == chunk::capacity)
+                {
+                    chunk* next = current->next.load(std::memory_order_relaxed);
+                    if (next == nullptr)
+                    {
+                        next = new (std::nothrow) chunk;
+                        if (next == nullptr)
+                        {
+                            dropped.fetch_add(1, std::memory_order_relaxed);
+                            return;
+                        }
+                        current->next.store(next, std::memory_order_release);
+                    }
+                    current = next;
+                    n = 0;
+                }
+
+                current->events[n] =
+                    event{hpx::chrono::high_resolution_clock::now(), name, id,
+                        arg, type};
+                current->count.store(n + 1, std::memory_order_release);
+                ++size;
+            }
+
+            template <typename F>
+            void for_each(std::size_t current_generation, F&& f) const
+            {
+                if (generation.load(std::memory_order_acquire) !=
+                    current_generation)
+                {
+                    return;    // no events since the buffer was cleared
+                }
+
+                for (chunk const* c = first; c != nullptr;
+                     c = c->next.load(std::memory_order_acquire))
+                {
+                    std::size_t const n =
+                        c->count.load(std::memory_order_acquire);
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        f(c->events[i]);
+                    }
+                    if (n != chunk::capacity)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            chunk* const first;
+
+            // accessed by the owning thread only
+            chunk* current;
+            std::size_t size;
+
+            std::atomic<std::size_t> generation;
+            std::atomic<std::size_t> dropped;
+
+            std::uint32_t const tid;
+            std::string const name;
+        };
+
+        // The thread ids of OS threads which are not HPX worker threads start
+        // at this offset
+        constexpr std::uint32_t os_thread_base_tid = 100000;
+
+        struct registry
+        {
+            std::shared_ptr<thread_buffer> create_buffer()
+            {
+                std::size_t const worker =
+                    threads::detail::get_global_thread_num_tss();
+
+                std::lock_guard<std::mutex> l(mtx);
+
+                std::uint32_t tid = 0;
+                std::string name;
+                if (worker != static_cast<std::size_t>(-1))
+                {
+                    tid = static_cast<std::uint32_t>(worker);
+                    name = "worker-thread#" + std::to_string(worker);
+                }
+                else
+                {
+                    tid = os_thread_base_tid + next_os_thread++;
+                    name = "os-thread#" + std::to_string(tid);
+                }
+
+                auto buffer = std::make_shared<thread_buffer>(tid,
+                    HPX_MOVE(name), generation.load(std::memory_order_relaxed));
+                buffers.push_back(buffer);
+                return buffer;
+            }
+
+            // the buffers are kept alive after their threads have exited
+            std::mutex mtx;
+            std::vector<std::shared_ptr<thread_buffer>> buffers;
+            std::uint32_t next_os_thread = 0;
+
+            std::atomic<std::size_t> generation{0};
+            std::atomic<std::size_t> max_events{0};
+        };
+
+        registry& get_registry()
+        {
+            static registry r;
+            return r;
+        }
+
+        thread_buffer* get_thread_buffer() noexcept
+        {
+            static thread_local std::shared_ptr<thread_buffer> buffer;
+            if (HPX_UNLIKELY(!buffer))
+            {
+                try
+                {
+                    buffer = get_registry().create_buffer();
+                }
+                catch (...)
+                {
+                    return nullptr;
+                }
+            }
+            return buffer.get();
+        }
+
+        std::vector<std::shared_ptr<thread_buffer>> get_buffers()
+        {
+            registry& r = get_registry();
+            std::lock_guard<std::mutex> l(r.mtx);
+            return r.buffers;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_string(std::ostream& os, char const* str)
+        {
+            os << '"';
+            for (/**/; *str != '\0'; ++str)
+            {
+                char const c = *str;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    os << "\\u" << std::hex << std::setw(4)
+                       << std::setfill('0')
+                       << static_cast<unsigned>(static_cast<unsigned char>(c))
+                       << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+            os << '"';
+        }
+
+        // The trace event format expects time stamps in microseconds
+        void write_timestamp(std::ostream& os, std::uint64_t ns)
+        {
+            os << ns / 1000 << '.' << std::setw(3) << std::setfill('0')
+               << ns % 1000 << std::setfill(' ');
+        }
+
+        void write_hex(std::ostream& os, std::uint64_t value)
+        {
+            os << "\"0x" << std::hex << value << std::dec << '"';
+        }
+
+        struct chrome_trace_writer
+        {
+            void begin_event(char const* name, char const* cat, char ph,
+                std::uint64_t timestamp)
+            {
+                os << (first ? "\n" : ",\n") << "{\"name\":";
+                write_string(os, name);
+                os << ",\"cat\":\"" << cat << "\",\"ph\":\"" << ph
+                   << "\",\"ts\":";
+                write_timestamp(os, timestamp);
+                os << ",\"pid\":" << pid << ",\"tid\":" << tid;
+                first = false;
+            }
+
+            void write_flow(char const* name, char ph, event const& e)
+            {
+                begin_event(name, "parcel", ph, e.timestamp);
+                os << ",\"id\":";
+                write_hex(os, e.id);
+                if (ph == 'f')
+                {
+                    os << ",\"bp\":\"e\"";
+                }
+                os << '}';
+            }
+
+            void operator()(event const& e)
+            {
+                switch (e.type)
+                {
+                case event_type::task_begin:
+                {
+                    // descriptions given as an address don't have a name
+                    if (e.name != nullptr)
+                    {
+                        begin_event(e.name, "task", 'B', e.timestamp);
+                    }
+                    else
+                    {
+                        std::string const name =
+                            "<address 0x" + to_hex(e.arg) + ">";
+                        begin_event(name.c_str(), "task", 'B', e.timestamp);
+                    }
+                    os << ",\"args\":{\"thread\":";
+                    write_hex(os, e.id);
+                    if (e.name != nullptr)
+                    {
+                        os << ",\"phase\":" << e.arg;
+                    }
+                    os << "}}";
+                    ++depth;
+                    break;
+                }
+
+                case event_type::task_end:
+                case event_type::task_suspend:
+                {
+                    // skip the end of tasks which started running before
+                    // the tracing was started
+                    if (depth == 0)
+                    {
+                        break;
+                    }
+                    --depth;
+                    begin_event("", "task", 'E', e.timestamp);
+                    os << ",\"args\":{\"state\":\""
+                       << (e.type == event_type::task_end ? "terminated" :
+                                                            "suspended")
+                       << "\"}}";
+                    break;
+                }
+
+                case event_type::task_steal:
+                    begin_event("steal", "scheduler", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"victim\":" << e.id
+                       << ",\"tasks\":" << e.arg << "}}";
+                    break;
+
+                case event_type::parcel_send:
+                    begin_event("parcel send", "parcel", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"destination\":"
+                       << (e.arg >> 32) << ",\"size\":" << (e.arg & 0xffffffff)
+                       << "}}";
+                    if (e.id != 0)
+                    {
+                        write_flow("parcel", 's', e);
+                    }
+                    break;
+
+                case event_type::parcel_receive:
+                    begin_event("parcel receive", "parcel", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"source\":" << (e.arg >> 32)
+                       << ",\"size\":" << (e.arg & 0xffffffff) << "}}";
+                    if (e.id != 0)
+                    {
+                        write_flow("parcel", 'f', e);
+                    }
+                    break;
+
+                case event_type::task_create:
+                    begin_event("task create", "dependency", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"thread\":";
+                    write_hex(os, e.id);
+                    os << "}}";
+                    break;
+
+                case event_type::future_ready:
+                    [[fallthrough]];
+                case event_type::future_wait:
+                    begin_event(e.type == event_type::future_ready ?
+                            "future ready" :
+                            "future wait",
+                        "dependency", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"future\":";
+                    write_hex(os, e.id);
+                    os << "}}";
+                    break;
+
+                case event_type::lock_wait:
+                    begin_event("lock wait", "dependency", 'i', e.timestamp);
+                    os << ",\"s\":\"t\",\"args\":{\"lock\":";
+                    write_hex(os, e.id);
+                    os << "}}";
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            static std::string to_hex(std::uint64_t value)
+            {
+                static constexpr char digits[] = "0123456789abcdef";
+
+                std::string result;
+                do
+                {
+                    result.insert(result.begin(), digits[value & 0xf]);
+                    value >>= 4;
+                } while (value != 0);
+                return result;
+            }
+
+            std::ostream& os;
+            std::uint32_t pid;
+            std::uint32_t tid = 0;
+            std::size_t depth = 0;
+            bool first = true;
+        };
+    }    // namespace
+
+    namespace detail {
+
+        void record_event(event_type type, char const* name,
+            std::uint64_t id, std::uint64_t arg) noexcept
+        {
+            if (thread_buffer* buffer = get_thread_buffer(); buffer != nullptr)
+            {
+                registry const& r = get_registry();
+                buffer->push(type, name, id, arg,
+                    r.generation.load(std::memory_order_relaxed),
+                    r.max_events.load(std::memory_order_relaxed));
+            }
+        }
+
+        std::vector<thread_events> get_recorded_events()
+        {
+            std::size_t const generation =
+                get_registry().generation.load(std::memory_order_relaxed);
+
+            std::vector<thread_events> result;
+            for (auto const& buffer : get_buffers())
+            {
+                thread_events events{buffer->tid,
+                    buffer->tid < os_thread_base_tid, std::vector<event>()};
+                buffer->for_each(generation,
+                    [&](event const& e) { events.events.push_back(e); });
+                result.push_back(HPX_MOVE(events));
+            }
+            return result;
+        }
+
+        void record_task_begin(thread_data const* thrd) noexcept
+        {
+            threads::thread_description const desc = thrd->get_description();
+            if (desc.kind() == threads::thread_description::data_type_address)
+            {
+                record_event(event_type::task_begin, nullptr,
+                    reinterpret_cast<std::uint64_t>(thrd),
+                    static_cast<std::uint64_t>(desc.get_address()));
+            }
+            else
+            {
+                record_event(event_type::task_begin, desc.get_description(),
+                    reinterpret_cast<std::uint64_t>(thrd),
+                    static_cast<std::uint64_t>(thrd->get_thread_phase()));
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start(std::size_t max_events)
+    {
+        get_registry().max_events.store(max_events, std::memory_order_relaxed);
+
+        // the recorded tasks are named by their annotations
+        detail::annotations_were_enabled.store(
+            hpx::set_annotations_enabled(true), std::memory_order_relaxed);
+        detail::tracing_enabled.store(true, std::memory_order_release);
+    }
+
+    void stop()
+    {
+        detail::tracing_enabled.store(false, std::memory_order_release);
+        hpx::set_annotations_enabled(detail::annotations_were_enabled.load(
+            std::memory_order_relaxed));
+    }
+
+    void clear()
+    {
+        registry& r = get_registry();
+
+        std::lock_guard<std::mutex> l(r.mtx);
+        r.generation.fetch_add(1, std::memory_order_relaxed);
+        for (auto const& buffer : r.buffers)
+        {
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t num_events()
+    {
+        std::size_t const generation =
+            get_registry().generation.load(std::memory_order_relaxed);
+
+        std::size_t result = 0;
+        for (auto const& buffer : get_buffers())
+        {
+            buffer->for_each(generation, [&](event const&) { ++result; });
+        }
+        return result;
+    }
+
+    std::size_t num_dropped_events()
+    {
+        std::size_t result = 0;
+        for (auto const& buffer : get_buffers())
+        {
+            result += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    void write_chrome_trace(std::ostream& os, std::uint32_t pid)
+    {
+        std::size_t const generation =
+            get_registry().generation.load(std::memory_order_relaxed);
+        std::vector<std::shared_ptr<thread_buffer>> const buffers =
+            get_buffers();
+
+        chrome_trace_writer writer{os, pid};
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (auto const& buffer : buffers)
+        {
+            writer.tid = buffer->tid;
+            writer.depth = 0;
+
+            os << (writer.first ? "\n" : ",\n")
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+               << ",\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+            write_string(os, buffer->name.c_str());
+            os << "}}";
+            writer.first = false;
+
+            buffer->for_each(generation, writer);
+        }
+        os << "\n]}\n";
+    }
+}    // namespace hpx::threads::tracing
+
+#endif
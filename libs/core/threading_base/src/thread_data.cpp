@@ -18,6 +18,10 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+#include <hpx/threading_base/annotation_statistics.hpp>
+#include <hpx/timing/tsc_clock.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
@@ -78,7 +82,16 @@ namespace hpx::threads {
       , last_worker_thread_num_(static_cast<std::size_t>(-1))
       , stacksize_(stacksize)
       , stacksize_enum_(init_data.stacksize)
+      , deadline_(init_data.deadline)
+      , priority_value_(init_data.priority_value)
       , queue_(queue)
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+      , creation_time_(static_cast<std::int64_t>(
+            hpx::chrono::tsc_clock::now()))
+      , wait_time_(-1)
+      , execution_time_(0)
+      , num_suspensions_(0)
+#endif
     {
         LTM_(debug).format(
             "thread::thread({}), description({})", this, get_description());
@@ -108,6 +121,9 @@ namespace hpx::threads {
     {
         LTM_(debug).format("thread_data::~thread_data({})", this);
         free_thread_exit_callbacks();
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+        cleanup_local_slots();
+#endif
     }
 
     void thread_data::destroy_thread()
@@ -190,6 +206,29 @@ namespace hpx::threads {
         return false;
     }
 
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+    void thread_data::end_annotation_phase(
+        std::int64_t started, thread_schedule_state state) noexcept
+    {
+        execution_time_ +=
+            static_cast<std::int64_t>(hpx::chrono::tsc_clock::now()) - started;
+
+        if (state != thread_schedule_state::terminated &&
+            state != thread_schedule_state::deleted)
+        {
+            ++num_suspensions_;
+            return;
+        }
+
+        threads::thread_description const desc = get_description();
+        record_annotation_statistics(
+            desc.kind() == threads::thread_description::data_type_description ?
+                desc.get_description() :
+                nullptr,
+            execution_time_, wait_time_, num_suspensions_);
+    }
+#endif
+
     void thread_data::rebind_base(thread_init_data& init_data)
     {
         LTM_(debug).format(
@@ -197,6 +236,9 @@ namespace hpx::threads {
             this, get_description(), get_thread_phase());
 
         free_thread_exit_callbacks();
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+        cleanup_local_slots();
+#endif
 
         current_state_.store(thread_state(
             init_data.initial_state, thread_restart_state::signaled));
@@ -234,8 +276,18 @@ namespace hpx::threads {
         // must be the same as before.
         stacksize_enum_ = init_data.stacksize;
         HPX_ASSERT(stacksize_ == get_stack_size());
+        deadline_ = init_data.deadline;
+        priority_value_ = init_data.priority_value;
         HPX_ASSERT(stacksize_ != 0);
 
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+        creation_time_ = static_cast<std::int64_t>(
+            hpx::chrono::tsc_clock::now());
+        wait_time_ = -1;
+        execution_time_ = 0;
+        num_suspensions_ = 0;
+#endif
+
         LTM_(debug).format("thread::thread({}), description({}), rebind", this,
             get_description());
 
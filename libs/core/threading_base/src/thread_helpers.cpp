@@ -18,6 +18,7 @@
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
+#include <hpx/topology/topology.hpp>
 
 #ifdef HPX_HAVE_VERIFY_LOCKS
 #include <hpx/lock_registration/detail/register_locks.hpp>
@@ -32,8 +33,10 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <thread>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -419,6 +422,27 @@ namespace hpx::threads {
 
         return get_thread_id_data(id)->get_scheduler_base()->get_parent_pool();
     }
+
+    thread_schedule_hint get_numa_domain_hint(void const* addr) noexcept
+    {
+        int domain = -1;
+        try
+        {
+            domain = create_topology().get_numa_domain(addr);
+        }
+        catch (...)
+        {
+            // fall back to letting the scheduler decide
+            domain = -1;
+        }
+
+        if (domain < 0 || domain > (std::numeric_limits<std::int16_t>::max)())
+        {
+            return {};
+        }
+        return {thread_schedule_hint_mode::numa,
+            static_cast<std::int16_t>(domain)};
+    }
 }    // namespace hpx::threads
 
 namespace hpx::this_thread {
@@ -445,6 +469,21 @@ namespace hpx::this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        // stackless threads run on the stack of the OS thread, they can
+        // only yield (which is a no-op), but can't be suspended
+        bool const is_stackless = get_thread_id_data(id)->is_stackless();
+        if (is_stackless &&
+            state != threads::thread_schedule_state::pending &&
+            state != threads::thread_schedule_state::pending_boost &&
+            state != threads::thread_schedule_state::pending_do_not_schedule)
+        {
+            HPX_THROWS_IF(ec, hpx::error::invalid_status, "suspend",
+                "stackless thread({}, {}) can't be suspended, use a thread "
+                "with a stack instead",
+                id.noref(), threads::get_thread_description(id.noref()));
+            return threads::thread_restart_state::unknown;
+        }
+
         threads::thread_restart_state statex;
 
         {
@@ -460,10 +499,13 @@ namespace hpx::this_thread {
             threads::detail::reset_backtrace bt(id, ec);
 #endif
             // We might need to dispatch 'nextid' to it's correct scheduler only
-            // if our current scheduler is the same, we should yield to the id
+            // if our current scheduler is the same, we should yield to the id.
+            // Stackless threads never return to the scheduling loop while
+            // yielding, thus 'nextid' has to be scheduled explicitly.
             if (nextid &&
-                get_thread_id_data(nextid)->get_scheduler_base() !=
-                    get_thread_id_data(id)->get_scheduler_base())
+                (is_stackless ||
+                    get_thread_id_data(nextid)->get_scheduler_base() !=
+                        get_thread_id_data(id)->get_scheduler_base()))
             {
                 auto* scheduler =
                     get_thread_id_data(nextid)->get_scheduler_base();
@@ -516,6 +558,26 @@ namespace hpx::this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        // stackless threads can't be suspended, they block the underlying OS
+        // thread instead
+        if (get_thread_id_data(id)->is_stackless())
+        {
+            if (nextid)
+            {
+                auto* scheduler =
+                    get_thread_id_data(nextid)->get_scheduler_base();
+                scheduler->schedule_thread(
+                    HPX_MOVE(nextid), threads::thread_schedule_hint());
+            }
+
+            std::this_thread::sleep_until(abs_time.value());
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return threads::thread_restart_state::timeout;
+        }
+
         // let the thread manager do other things while waiting
         threads::thread_restart_state statex;
 
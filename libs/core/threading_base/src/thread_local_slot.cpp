@@ -0,0 +1,87 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_local_slot.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    namespace detail {
+
+        namespace {
+
+            // both are constant initialized, which allows to allocate slots
+            // during static initialization
+            std::atomic<std::size_t> next_thread_local_slot(0);
+            std::atomic<thread_local_slot_cleanup_type>
+                thread_local_slot_cleanups[HPX_HAVE_THREAD_LOCAL_SLOTS] = {};
+        }    // namespace
+
+        std::size_t allocate_thread_local_slot(
+            thread_local_slot_cleanup_type cleanup)
+        {
+            std::size_t const slot = next_thread_local_slot++;
+            if (slot >= HPX_HAVE_THREAD_LOCAL_SLOTS)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                    "hpx::threads::detail::allocate_thread_local_slot",
+                    "all {} thread local slots are in use (see "
+                    "HPX_WITH_THREAD_LOCAL_SLOTS)",
+                    HPX_HAVE_THREAD_LOCAL_SLOTS);
+            }
+
+            thread_local_slot_cleanups[slot].store(
+                cleanup, std::memory_order_release);
+            return slot;
+        }
+
+        thread_local_slot_cleanup_type get_thread_local_slot_cleanup(
+            std::size_t slot) noexcept
+        {
+            HPX_ASSERT(slot < HPX_HAVE_THREAD_LOCAL_SLOTS);
+            return thread_local_slot_cleanups[slot].load(
+                std::memory_order_acquire);
+        }
+    }    // namespace detail
+
+    void thread_data::cleanup_used_local_slots() noexcept
+    {
+        // the cleanup functions may store new values, those are cleaned up as
+        // well (up to a fixed number of rounds, similar to pthread_key_create)
+        for (int round = 0; round != 4 && used_local_slots_ != 0; ++round)
+        {
+            std::uint64_t used = used_local_slots_;
+            used_local_slots_ = 0;
+
+            for (std::size_t slot = 0; used != 0; ++slot, used >>= 1)
+            {
+                if ((used & 1) == 0)
+                {
+                    continue;
+                }
+
+                auto const cleanup =
+                    detail::get_thread_local_slot_cleanup(slot);
+                if (cleanup != nullptr && local_slots_[slot] != nullptr)
+                {
+                    cleanup(local_slots_[slot]);
+                }
+            }
+        }
+        used_local_slots_ = 0;
+    }
+}    // namespace hpx::threads
+
+#endif
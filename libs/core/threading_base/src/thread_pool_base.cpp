@@ -5,11 +5,10 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/affinity/affinity_data.hpp>
-#include <hpx/hardware/timestamp.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
-#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/tsc_clock.hpp>
 #include <hpx/topology/topology.hpp>
 
 #include <cstddef>
@@ -107,24 +106,9 @@ namespace hpx::threads {
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
-        // scale timestamps to nanoseconds
-        std::uint64_t const base_timestamp = util::hardware::timestamp();
-        std::uint64_t const base_time =
-            hpx::chrono::high_resolution_clock::now();
-        std::uint64_t curr_timestamp = util::hardware::timestamp();
-        std::uint64_t curr_time = hpx::chrono::high_resolution_clock::now();
-
-        while ((curr_time - base_time) <= 100000)
-        {
-            curr_timestamp = util::hardware::timestamp();
-            curr_time = hpx::chrono::high_resolution_clock::now();
-        }
-
-        if (curr_timestamp - base_timestamp != 0)
-        {
-            timestamp_scale_ = static_cast<double>(curr_time - base_time) /
-                static_cast<double>(curr_timestamp - base_timestamp);
-        }
+        // scale timestamps to nanoseconds, the timestamps taken by the
+        // scheduling loop are ticks of the (calibrated) tsc_clock
+        timestamp_scale_ = hpx::chrono::tsc_clock::nanoseconds_per_tick();
     }
 
     void thread_pool_base::init(
@@ -0,0 +1,145 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_usage.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads {
+
+    namespace {
+
+        struct stack_usage_entry
+        {
+            thread_description desc;
+            std::uint64_t count = 0;
+            std::size_t max_used = 0;
+            std::size_t stacksize = 0;
+        };
+
+        struct stack_usage_registry
+        {
+            hpx::util::detail::spinlock mtx_;
+            std::unordered_map<std::uintptr_t, stack_usage_entry> entries_;
+        };
+
+        stack_usage_registry& get_registry()
+        {
+            static stack_usage_registry registry;
+            return registry;
+        }
+
+        // The string used as a description has static storage duration (or
+        // is kept alive by the annotation machinery), use its address as the
+        // key instead of comparing the strings.
+        std::uintptr_t get_key(thread_description const& desc) noexcept
+        {
+            if (desc.kind() == thread_description::data_type_address)
+            {
+                return static_cast<std::uintptr_t>(desc.get_address());
+            }
+            return reinterpret_cast<std::uintptr_t>(desc.get_description());
+        }
+
+        void record_stack_usage(thread_id const& id, std::size_t used,
+            std::size_t stacksize) noexcept
+        {
+            thread_description const desc =
+                get_thread_id_data(id)->get_description();
+
+            stack_usage_registry& registry = get_registry();
+            try
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx_);
+
+                auto& entry = registry.entries_[get_key(desc)];
+                if (entry.count++ == 0)
+                {
+                    entry.desc = desc;
+                }
+                if (used > entry.max_used)
+                {
+                    entry.max_used = used;
+                    entry.stacksize = stacksize;
+                }
+            }
+            catch (...)
+            {
+                // statistics are best effort only
+            }
+        }
+    }    // namespace
+
+    void enable_stack_usage_tracking(bool enable, bool deep_only) noexcept
+    {
+        // threads using more than 80% of their stack are the ones that need
+        // a larger stack once the safety margin of 25% is added (see
+        // scheduler_base::select_stack_size)
+        coroutines::detail::set_stack_fill_percentage(deep_only ? 20 : 100);
+        coroutines::detail::set_stack_usage_handler(
+            enable ? &record_stack_usage : nullptr);
+    }
+
+    bool stack_usage_tracking_enabled() noexcept
+    {
+        return coroutines::detail::get_stack_usage_handler() != nullptr;
+    }
+
+    std::vector<stack_usage_data> get_stack_usage(bool reset)
+    {
+        std::vector<stack_usage_data> result;
+
+        stack_usage_registry& registry = get_registry();
+        std::unordered_map<std::uintptr_t, stack_usage_entry> entries;
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx_);
+            if (reset)
+            {
+                std::swap(entries, registry.entries_);
+            }
+            else
+            {
+                entries = registry.entries_;
+            }
+        }
+
+        result.reserve(entries.size());
+        for (auto const& [key, entry] : entries)
+        {
+            result.push_back(stack_usage_data{as_string(entry.desc),
+                entry.count, entry.max_used, entry.stacksize});
+        }
+
+        // report the most demanding threads first
+        std::sort(result.begin(), result.end(),
+            [](stack_usage_data const& lhs, stack_usage_data const& rhs) {
+                return lhs.max_used > rhs.max_used;
+            });
+
+        return result;
+    }
+
+    std::size_t get_max_stack_usage(thread_description const& desc) noexcept
+    {
+        stack_usage_registry& registry = get_registry();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx_);
+        auto const it = registry.entries_.find(get_key(desc));
+        return it != registry.entries_.end() ? it->second.max_used : 0;
+    }
+}    // namespace hpx::threads
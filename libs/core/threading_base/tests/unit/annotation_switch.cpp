@@ -0,0 +1,107 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that annotations are recorded only while they are enabled at
+// runtime.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION_RUNTIME_SWITCH)
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/scoped_annotation.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <string>
+
+std::string current_description()
+{
+    return hpx::threads::get_thread_description(hpx::threads::get_self_id())
+        .get_description();
+}
+
+void test_scoped_annotation()
+{
+    std::string const outer = current_description();
+
+    hpx::set_annotations_enabled(false);
+    HPX_TEST(!hpx::annotations_enabled());
+    {
+        hpx::scoped_annotation ann("disabled_annotation");
+        HPX_TEST_EQ(current_description(), outer);
+    }
+    {
+        hpx::scoped_annotation ann(std::string("disabled_string_annotation"));
+        HPX_TEST_EQ(current_description(), outer);
+    }
+
+    HPX_TEST(!hpx::set_annotations_enabled(true));
+    HPX_TEST(hpx::annotations_enabled());
+    {
+        hpx::scoped_annotation ann("enabled_annotation");
+        HPX_TEST_EQ(current_description(), std::string("enabled_annotation"));
+
+        // the annotation is restored even if annotations are disabled in
+        // the meantime
+        hpx::set_annotations_enabled(false);
+    }
+    HPX_TEST_EQ(current_description(), outer);
+}
+
+void test_annotated_function()
+{
+    auto f = hpx::annotated_function(
+        [] { return current_description(); }, "annotated_task");
+
+    hpx::set_annotations_enabled(false);
+    HPX_TEST_NEQ(f(), std::string("annotated_task"));
+
+    hpx::set_annotations_enabled(true);
+    HPX_TEST_EQ(f(), std::string("annotated_task"));
+    HPX_TEST_EQ(hpx::async(f).get(), std::string("annotated_task"));
+
+    hpx::set_annotations_enabled(false);
+}
+
+void test_register_annotation()
+{
+    char const* name = hpx::register_annotation("registered_annotation");
+    HPX_TEST_EQ(std::string(name), std::string("registered_annotation"));
+
+    // the same name is interned only once
+    HPX_TEST_EQ(hpx::register_annotation(std::string(name)), name);
+
+    hpx::set_annotations_enabled(true);
+    {
+        hpx::scoped_annotation ann(name);
+        HPX_TEST_EQ(current_description(), std::string(name));
+    }
+    hpx::set_annotations_enabled(false);
+}
+
+int hpx_main()
+{
+    test_scoped_annotation();
+    test_annotated_function();
+    test_register_annotation();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that hpx::this_thread::check_preempt yields once the time slice has
+// expired and whenever work with a higher priority is waiting. The test runs
+// on a single worker thread, without preemption the spinning threads would
+// never give the other threads a chance to run. Stackless threads can't be
+// suspended and are never preempted.
+
+#include <hpx/future.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/preemption.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+void test_time_slice()
+{
+    hpx::threads::set_preemption_time_slice(std::chrono::milliseconds(1));
+
+    std::atomic<bool> done(false);
+    hpx::future<void> f = hpx::async([&]() { done = true; });
+
+    // spin until the other thread has run
+    auto const start = std::chrono::steady_clock::now();
+    bool yielded = false;
+    while (!done.load())
+    {
+        yielded = hpx::this_thread::check_preempt() || yielded;
+    }
+    HPX_TEST(yielded);
+    HPX_TEST(std::chrono::steady_clock::now() - start >=
+        std::chrono::milliseconds(1));
+
+    f.get();
+}
+
+void test_higher_priority()
+{
+    // the time slice will not expire during this test
+    hpx::threads::set_preemption_time_slice(std::chrono::hours(1));
+
+    std::atomic<bool> done(false);
+    hpx::launch policy = hpx::launch::async;
+    policy.set_priority(hpx::threads::thread_priority::high);
+    hpx::future<void> f = hpx::async(policy, [&]() { done = true; });
+
+    while (!done.load())
+    {
+        hpx::this_thread::check_preempt();
+    }
+
+    f.get();
+}
+
+void test_disabled()
+{
+    hpx::threads::set_preemption_time_slice(std::chrono::microseconds(0));
+
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+        std::chrono::milliseconds(10))
+    {
+        HPX_TEST(!hpx::this_thread::check_preempt());
+    }
+}
+
+void test_stackless()
+{
+    hpx::threads::set_preemption_time_slice(std::chrono::microseconds(1));
+
+    hpx::launch policy = hpx::launch::async;
+    policy.set_stacksize(hpx::threads::thread_stacksize::nostack);
+    hpx::async(policy, []() {
+        HPX_TEST(hpx::threads::get_self_id_data()->is_stackless());
+
+        auto const start = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - start <
+            std::chrono::milliseconds(10))
+        {
+            HPX_TEST(!hpx::this_thread::check_preempt());
+        }
+
+        // a parallel loop checks for preemption between its chunks
+        constexpr std::size_t num = 16 * HPX_PREEMPTION_CHECK_INTERVAL;
+        std::size_t count = 0;
+        std::size_t const last = hpx::parallel::util::detail::
+            preemptible_loop_n<hpx::execution::parallel_policy>(
+                std::size_t(0), num, [&](std::size_t it, std::size_t n) {
+                    for (/**/; n != 0; --n, ++it)
+                    {
+                        // let the time slice expire
+                        (void) std::chrono::steady_clock::now();
+                        ++count;
+                    }
+                    return it;
+                });
+        HPX_TEST_EQ(last, num);
+        HPX_TEST_EQ(count, num);
+    }).get();
+}
+
+int hpx_main()
+{
+    // all tests are run on a normal priority thread
+    hpx::async([]() {
+        test_time_slice();
+        test_higher_priority();
+        test_disabled();
+        test_stackless();
+    }).get();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    // preemption checks outside of HPX threads do nothing
+    hpx::threads::set_preemption_time_slice(std::chrono::microseconds(1));
+    HPX_TEST(!hpx::this_thread::check_preempt());
+
+    return hpx::util::report_errors();
+}
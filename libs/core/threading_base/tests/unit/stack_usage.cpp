@@ -0,0 +1,121 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the stack usage of terminated threads is recorded if
+// hpx.stacks.track_usage is enabled and that threads exceeding the small stack
+// size get a larger stack assigned if hpx.stacks.auto_select is enabled. With
+// hpx.stacks.auto_select only, threads using little stack are not recorded.
+
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+// use more than 80% of the small stack, which exceeds the small stack size
+// once the safety margin is added
+constexpr std::size_t buffer_size = HPX_SMALL_STACK_SIZE * 13 / 16;
+
+std::vector<std::ptrdiff_t> stacksizes;
+
+void use_stack(hpx::latch& l)
+{
+    volatile char buffer[buffer_size];
+    for (std::size_t i = 0; i != buffer_size; ++i)
+    {
+        buffer[i] = static_cast<char>(i);
+    }
+
+    stacksizes.push_back(hpx::threads::get_self_stacksize());
+    l.count_down(1);
+}
+
+void use_little_stack(hpx::latch& l)
+{
+    l.count_down(1);
+}
+
+char const* const description = "stack_usage_test";
+char const* const shallow_description = "stack_usage_shallow_test";
+
+void run_thread(void (*f)(hpx::latch&) = &use_stack,
+    char const* desc = description)
+{
+    hpx::latch l(2);
+    thread_init_data data(
+        make_thread_function_nullary(hpx::bind(f, std::ref(l))), desc);
+    register_work(data);
+    l.arrive_and_wait();
+
+    // give the thread a chance to terminate
+    hpx::this_thread::yield();
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::stack_usage_tracking_enabled());
+
+    run_thread();
+    run_thread(&use_little_stack, shallow_description);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION) &&                                    \
+    (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    (defined(__x86_64__) || defined(__amd64__)) &&                             \
+    !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
+    bool const track_usage =
+        hpx::get_config_entry("hpx.stacks.track_usage", "0") != "0";
+
+    bool found = false;
+    bool found_shallow = false;
+    for (auto const& usage : hpx::threads::get_stack_usage())
+    {
+        if (usage.description == description)
+        {
+            found = true;
+            HPX_TEST_LTE(buffer_size, usage.max_used);
+        }
+        else if (usage.description == shallow_description)
+        {
+            found_shallow = true;
+        }
+    }
+    HPX_TEST(found);
+
+    // without hpx.stacks.track_usage only the lower end of the stacks is
+    // filled, threads not getting close to it are not recorded
+    HPX_TEST_EQ(found_shallow, track_usage);
+
+    // the next thread with the same description uses a larger stack
+    run_thread();
+
+    HPX_TEST_EQ(stacksizes.size(), static_cast<std::size_t>(2));
+    HPX_TEST_LT(stacksizes[0], stacksizes[1]);
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // a single worker thread ensures that the threads are run in sequence
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.stacks.auto_select=1", "hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,79 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that threads explicitly requesting thread_stacksize::nostack run
+// stackless and may still yield, sleep, and wait for other threads, and that
+// threads requesting the default stack size keep their stacks.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+bool is_stackless()
+{
+    return hpx::threads::get_self_id_data()->is_stackless();
+}
+
+void leaf()
+{
+    HPX_TEST(is_stackless());
+
+    // yielding is a no-op for stackless threads
+    hpx::this_thread::yield();
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    ++count;
+}
+
+int hpx_main()
+{
+    // hpx_main itself runs with a large stack
+    HPX_TEST(!is_stackless());
+
+    hpx::launch nostack = hpx::launch::async;
+    nostack.set_stacksize(hpx::threads::thread_stacksize::nostack);
+
+    std::vector<hpx::future<void>> leaves;
+    leaves.reserve(100);
+    for (int i = 0; i != 100; ++i)
+    {
+        leaves.push_back(hpx::async(nostack, &leaf));
+    }
+    hpx::wait_all(leaves);
+    HPX_TEST_EQ(count.load(), static_cast<std::size_t>(100));
+
+    // a stackless thread blocks its worker thread while waiting, the thread
+    // it waits for has a stack and runs on one of the other workers
+    hpx::async(nostack, []() {
+        HPX_TEST(is_stackless());
+        hpx::async([]() {
+            HPX_TEST(!is_stackless());
+            hpx::this_thread::yield();
+            ++count;
+        }).get();
+    }).get();
+    HPX_TEST_EQ(count.load(), static_cast<std::size_t>(101));
+
+    // threads requesting the default stack size are not run stackless
+    hpx::async([]() { HPX_TEST(!is_stackless()); }).get();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the task counter hooks are invoked around the sampled execution
+// phases of HPX threads and receive the annotation of the executed thread.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_COUNTER_HOOKS)
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/task_counter_hooks.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+std::atomic<std::size_t> num_begin(0);
+std::atomic<std::size_t> num_end(0);
+std::atomic<std::size_t> num_annotated(0);
+std::atomic<std::size_t> num_terminated(0);
+
+void begin_hook() noexcept
+{
+    ++num_begin;
+}
+
+void end_hook(char const* annotation,
+    hpx::threads::thread_schedule_state state) noexcept
+{
+    ++num_end;
+    if (annotation != nullptr && std::strcmp(annotation, "counted_task") == 0)
+    {
+        ++num_annotated;
+    }
+    if (state == hpx::threads::thread_schedule_state::terminated)
+    {
+        ++num_terminated;
+    }
+}
+
+hpx::threads::task_counter_hooks const hooks = {&begin_hook, &end_hook};
+
+// Run the given number of tasks, the tasks are scheduled instead of possibly
+// being run inline by the waiting thread
+void run_tasks(std::ptrdiff_t num_tasks)
+{
+    hpx::latch l(num_tasks + 1);
+    for (std::ptrdiff_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::post(hpx::annotated_function(
+            [&l]() {
+                hpx::this_thread::yield();
+                l.count_down(1);
+            },
+            "counted_task"));
+    }
+    l.arrive_and_wait();
+}
+
+void reset()
+{
+    num_begin = 0;
+    num_end = 0;
+    num_annotated = 0;
+    num_terminated = 0;
+}
+
+void test_all_phases()
+{
+    reset();
+    hpx::threads::set_task_counter_hooks(&hooks);
+    run_tasks(10);
+    hpx::threads::set_task_counter_hooks(nullptr);
+
+    // the hooks are invoked at least twice for every task as it has yielded
+    // once, the phase of the current thread has not ended yet
+    HPX_TEST(num_begin.load() >= num_end.load());
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST(num_annotated.load() >= std::size_t(20));
+#endif
+    HPX_TEST(num_terminated.load() >= std::size_t(10));
+
+    // no further phases are sampled after the hooks have been removed
+    std::size_t const count = num_begin.load();
+    run_tasks(10);
+    HPX_TEST_EQ(num_begin.load(), count);
+}
+
+void test_sampling()
+{
+    reset();
+    hpx::threads::set_task_counter_hooks(&hooks, 1000000);
+    run_tasks(100);
+    hpx::threads::set_task_counter_hooks(nullptr);
+
+    // far fewer phases than the sampling rate were executed by each worker
+    HPX_TEST_EQ(num_begin.load(), std::size_t(0));
+}
+
+int hpx_main()
+{
+    test_all_phases();
+    test_sampling();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
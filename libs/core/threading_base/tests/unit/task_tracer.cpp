@@ -0,0 +1,167 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the task tracer records the execution of annotated HPX threads
+// and that the recorded events are written as a Chrome trace.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/task_trace_analysis.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace tracing = hpx::threads::tracing;
+
+std::size_t count(std::string const& str, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = str.find(what); pos != std::string::npos;
+         pos = str.find(what, pos + what.size()))
+    {
+        ++result;
+    }
+    return result;
+}
+
+// Run the given number of tasks, the tasks are scheduled instead of possibly
+// being run inline by the waiting thread
+void run_tasks(std::ptrdiff_t num_tasks)
+{
+    hpx::latch l(num_tasks + 1);
+    for (std::ptrdiff_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::post(hpx::annotated_function(
+            [&l]() {
+                hpx::this_thread::yield();
+                l.count_down(1);
+            },
+            "traced_task"));
+    }
+    l.arrive_and_wait();
+}
+
+void test_trace()
+{
+    tracing::clear();
+    tracing::start();
+
+    run_tasks(10);
+
+    tracing::stop();
+    HPX_TEST(tracing::num_events() != 0);
+
+    std::stringstream strm;
+    tracing::write_chrome_trace(strm, 1);
+    std::string const trace = strm.str();
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // every task has been started twice, as it has yielded once
+    HPX_TEST_EQ(count(trace, "\"name\":\"traced_task\""), std::size_t(20));
+#endif
+    HPX_TEST(count(trace, "\"state\":\"suspended\"") >= std::size_t(10));
+    HPX_TEST(count(trace, "\"state\":\"terminated\"") >= std::size_t(10));
+    HPX_TEST(trace.find("\"ph\":\"M\"") != std::string::npos);
+
+    // nothing is recorded while the tracer is stopped
+    std::size_t const num_events = tracing::num_events();
+    run_tasks(1);
+    HPX_TEST_EQ(tracing::num_events(), num_events);
+
+    tracing::clear();
+    HPX_TEST_EQ(tracing::num_events(), std::size_t(0));
+}
+
+void test_dropped_events()
+{
+    tracing::clear();
+    tracing::start(8);
+
+    run_tasks(100);
+
+    tracing::stop();
+    HPX_TEST(tracing::num_dropped_events() != 0);
+
+    tracing::clear();
+    HPX_TEST_EQ(tracing::num_dropped_events(), std::size_t(0));
+}
+
+void busy_wait(std::uint64_t ns)
+{
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+    while (hpx::chrono::high_resolution_clock::now() - start < ns)
+    {
+    }
+}
+
+void test_analysis()
+{
+    tracing::clear();
+    tracing::start();
+
+    // a chain of ten dependent tasks, each running for a millisecond
+    hpx::future<void> f = hpx::make_ready_future();
+    for (int i = 0; i != 10; ++i)
+    {
+        f = f.then(hpx::launch::async,
+            hpx::annotated_function(
+                [](hpx::future<void>&&) { busy_wait(1000000); },
+                "chain_task"));
+    }
+    f.get();
+
+    tracing::stop();
+
+    tracing::task_trace_analysis const analysis = tracing::analyze_trace();
+
+    HPX_TEST(analysis.num_executions >= std::size_t(10));
+    HPX_TEST(analysis.num_dependencies >= std::size_t(10));
+    HPX_TEST(analysis.work >= analysis.critical_path);
+    HPX_TEST(analysis.critical_path >= std::uint64_t(10000000));
+    HPX_TEST(!analysis.parallelism.empty());
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST(!analysis.critical_path_tasks.empty() &&
+        analysis.critical_path_tasks.front().first == "chain_task");
+#endif
+
+    std::stringstream strm;
+    tracing::write_trace_analysis(strm, analysis);
+    HPX_TEST(strm.str().find("critical path") != std::string::npos);
+
+    tracing::clear();
+}
+
+int hpx_main()
+{
+    test_trace();
+    test_dropped_events();
+    test_analysis();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,151 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the values stored in thread local slots are private to each HPX
+// thread and are cleaned up when the HPX thread exits.
+
+#include <hpx/config.hpp>
+
+#if HPX_HAVE_THREAD_LOCAL_SLOTS > 0
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/thread_local_slot.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+std::atomic<std::size_t> num_destroyed(0);
+
+struct counted
+{
+    explicit counted(std::size_t value)
+      : value_(value)
+    {
+    }
+
+    ~counted()
+    {
+        ++num_destroyed;
+    }
+
+    std::size_t value_;
+};
+
+// the slots are allocated during static initialization
+hpx::threads::thread_local_slot<counted> owning_slot;
+hpx::threads::thread_local_slot<counted> non_owning_slot(nullptr);
+
+constexpr std::size_t num_tasks = 100;
+
+// the slots are cleaned up after the futures returned by the tasks have
+// become ready, wait for the tasks to exit
+bool wait_for_destroyed(std::size_t expected)
+{
+    for (int i = 0; i != 10000 && num_destroyed.load() < expected; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return num_destroyed.load() == expected;
+}
+
+void test_distinct_slots()
+{
+    HPX_TEST_NEQ(owning_slot.slot(), non_owning_slot.slot());
+}
+
+void test_thread_private_values()
+{
+    num_destroyed = 0;
+
+    std::vector<hpx::future<bool>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([i]() {
+            // a new (or recycled) thread starts with empty slots
+            bool result = owning_slot.get() == nullptr;
+
+            owning_slot.reset(new counted(i));
+            hpx::this_thread::yield();
+
+            result = result && owning_slot->value_ == i;
+
+            // replacing the value cleans up the previous one
+            owning_slot.reset(new counted(i + 1));
+            hpx::this_thread::yield();
+
+            return result && (*owning_slot).value_ == i + 1;
+        }));
+    }
+
+    for (auto& f : tasks)
+    {
+        HPX_TEST(f.get());
+    }
+
+    // the replaced values and the values left at thread exit are destroyed
+    HPX_TEST(wait_for_destroyed(2 * num_tasks));
+}
+
+void test_release()
+{
+    num_destroyed = 0;
+
+    counted* released = hpx::async([]() {
+        owning_slot.reset(new counted(42));
+        counted* value = owning_slot.release();
+        HPX_TEST(owning_slot.get() == nullptr);
+        return value;
+    }).get();
+
+    HPX_TEST_EQ(num_destroyed.load(), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(released->value_, static_cast<std::size_t>(42));
+    delete released;
+}
+
+void test_non_owning()
+{
+    num_destroyed = 0;
+
+    counted value(42);
+    hpx::async([&value]() {
+        non_owning_slot.reset(&value);
+        HPX_TEST_EQ(non_owning_slot.get(), &value);
+    }).get();
+
+    HPX_TEST_EQ(num_destroyed.load(), static_cast<std::size_t>(0));
+}
+
+int hpx_main()
+{
+    test_distinct_slots();
+    test_thread_private_values();
+    test_release();
+    test_non_owning();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // not running on an HPX thread
+    HPX_TEST(owning_slot.get() == nullptr);
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+#include <hpx/modules/testing.hpp>
+
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
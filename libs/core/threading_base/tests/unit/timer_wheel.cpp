@@ -0,0 +1,190 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the expiry of timers registered with a timer_wheel, and that timed
+// waits of HPX threads are handled by the timer wheel of the scheduler if
+// hpx.timer_wheel is enabled.
+
+#include <hpx/condition_variable.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_node;
+
+using clock_type = timer_wheel::clock_type;
+
+struct test_timer : timer_wheel_node
+{
+    test_timer() noexcept
+      : timer_wheel_node(&test_timer::expire)
+    {
+    }
+
+    static void expire(timer_wheel_node* node, bool expired) noexcept
+    {
+        auto* this_ = static_cast<test_timer*>(node);
+        ++this_->count;
+        this_->expired = expired;
+    }
+
+    int count = 0;
+    bool expired = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_timer_wheel_expiry()
+{
+    clock_type::time_point const start = clock_type::now();
+    auto const at = [&](std::int64_t ms) {
+        return start + std::chrono::milliseconds(ms);
+    };
+
+    // timers on all levels of the wheel (and beyond its range)
+    std::vector<std::int64_t> const expiries = {
+        1, 2, 63, 64, 65, 4095, 4096, 300000, 16777216, 100000000};
+
+    timer_wheel wheel(std::chrono::milliseconds(1), start);
+    std::vector<test_timer> timers(expiries.size());
+    for (std::size_t i = 0; i != expiries.size(); ++i)
+    {
+        wheel.add(&timers[i], at(expiries[i]));
+    }
+    HPX_TEST_EQ(wheel.size(), expiries.size());
+
+    for (std::size_t i = 0; i != expiries.size(); ++i)
+    {
+        // no timer expires early
+        wheel.advance(at(expiries[i] - 1));
+        HPX_TEST_EQ(timers[i].count, 0);
+
+        wheel.advance(at(expiries[i]));
+        HPX_TEST_EQ(timers[i].count, 1);
+        HPX_TEST(timers[i].expired);
+
+        // the wheel becomes due not later than the next timer
+        if (i + 1 != expiries.size())
+        {
+            HPX_TEST(wheel.next_due() <= at(expiries[i + 1]));
+        }
+    }
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_due() == (clock_type::time_point::max)());
+
+    // removed timers do not expire
+    test_timer removed, kept;
+    wheel.add(&removed, at(100000010));
+    HPX_TEST(!wheel.add(&kept, at(100000020)));
+    HPX_TEST(wheel.remove(&removed));
+    HPX_TEST(!wheel.remove(&removed));
+
+    wheel.advance(at(200000000));
+    HPX_TEST_EQ(removed.count, 0);
+    HPX_TEST_EQ(kept.count, 1);
+    HPX_TEST(!wheel.remove(&kept));
+
+    // remaining timers are notified when the wheel is destroyed
+    test_timer abandoned;
+    {
+        timer_wheel w(std::chrono::milliseconds(1), start);
+        w.add(&abandoned, at(1000));
+    }
+    HPX_TEST_EQ(abandoned.count, 1);
+    HPX_TEST(!abandoned.expired);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+timer_wheel& get_timer_wheel()
+{
+    return hpx::threads::get_self_id_data()
+        ->get_scheduler_base()
+        ->get_timer_wheel();
+}
+
+void test_sleep()
+{
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async([i]() {
+            auto const duration = std::chrono::microseconds(100 * (i % 50));
+            auto const start = clock_type::now();
+
+            hpx::this_thread::sleep_for(duration);
+
+            HPX_TEST(clock_type::now() - start >= duration);
+        }));
+    }
+    hpx::wait_all(futures);
+}
+
+void test_abort()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    bool ready = false;
+
+    hpx::future<void> f = hpx::async([&]() {
+        std::unique_lock<hpx::mutex> l(mtx);
+        bool const notified = cond.wait_for(
+            l, std::chrono::seconds(100), [&]() { return ready; });
+        HPX_TEST(notified);
+    });
+
+    while (get_timer_wheel().empty())
+    {
+        hpx::this_thread::yield();
+    }
+
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        ready = true;
+    }
+    cond.notify_one();
+    f.get();
+
+    // the aborted timer is removed from the wheel
+    while (!get_timer_wheel().empty())
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+int hpx_main()
+{
+    test_timer_wheel_expiry();
+
+    using hpx::threads::policies::scheduler_mode;
+    HPX_TEST(hpx::threads::get_self_id_data()
+                 ->get_scheduler_base()
+                 ->has_scheduler_mode(scheduler_mode::enable_timer_wheel));
+
+    test_sleep();
+    test_abort();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.timer_wheel=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -395,8 +395,19 @@ namespace hpx { namespace threads {
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+        std::int64_t get_num_stolen_batches(bool reset);
+        std::int64_t get_num_stolen_batch_tasks(bool reset);
+        std::int64_t get_num_steal_requests_remote(bool reset);
+        std::int64_t get_num_steal_attempts(bool reset);
+        std::int64_t get_num_steal_successes(bool reset);
+        std::vector<std::int64_t> get_steal_histogram(
+            policies::steal_histogram which, bool reset);
 #endif
 
+        std::int64_t get_idle_park_count(bool reset);
+        std::int64_t get_idle_unpark_count(bool reset);
+        std::int64_t get_missed_deadline_count(bool reset);
+
     private:
         policies::thread_queue_init_parameters get_init_parameters() const;
         void create_scheduler_user_defined(
@@ -425,12 +436,18 @@ namespace hpx { namespace threads {
         void create_scheduler_shared_priority(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_shared_priority_multiqueue(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_local_workrequesting_fifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_local_workrequesting_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_edf(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
@@ -444,6 +461,9 @@ namespace hpx { namespace threads {
 
         notification_policy_type& notifier_;
         detail::network_background_callback_type network_background_callback_;
+
+        // new work is routed between the pools of the quality of service mode
+        bool qos_routing_ = false;
     };
 }}    // namespace hpx::threads
 
@@ -23,6 +23,7 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/detail/qos_routing.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -33,6 +34,7 @@
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/get_entry_as.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -141,13 +143,21 @@ namespace hpx { namespace threads {
             rtcfg_.get_stack_size(thread_stacksize::large);
         std::ptrdiff_t huge_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::huge);
+        bool const auto_select_stacksize =
+            hpx::util::get_entry_as<int>(
+                rtcfg_, "hpx.stacks.auto_select", 0) != 0;
+        std::int64_t const trim_interval =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.trim_interval",
+                HPX_THREAD_QUEUE_TRIM_INTERVAL);
 
         return policies::thread_queue_init_parameters(max_thread_count,
             min_tasks_to_steal_pending, min_tasks_to_steal_staged,
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, auto_select_stacksize,
+            trim_interval);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -281,6 +291,49 @@ namespace hpx { namespace threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_priority_edf(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler, the pending queues are ordered by the
+        // deadlines of the threads
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::deadline_fifo>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_edf_scheduler");
+
+        std::unique_ptr<local_sched_type> sched =
+            std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_static(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -502,6 +555,39 @@ namespace hpx { namespace threads {
         pools_.push_back(HPX_MOVE(pool));
     }
 
+    void threadmanager::create_scheduler_shared_priority_multiqueue(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // instantiate the scheduler, the pending queues are relaxed priority
+        // queues ordered by the priority values of the threads
+        using local_sched_type =
+            hpx::threads::policies::shared_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::multiqueue_priority<>>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, {1, 1, 1},
+            thread_pool_init.affinity_data_, thread_queue_init,
+            "core-shared_priority_multiqueue_scheduler");
+
+        std::unique_ptr<local_sched_type> sched =
+            std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_local_workrequesting_fifo(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -524,6 +610,16 @@ namespace hpx { namespace threads {
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
             "core-local_workrequesting_scheduler");
+        init.numa_hierarchical_ = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.workrequesting_numa_hierarchical", 0) != 0;
+        init.numa_remote_backoff_ = hpx::util::get_entry_as<std::uint16_t>(
+            rtcfg_, "hpx.thread_queue.workrequesting_numa_remote_backoff",
+            HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF);
+        init.steal_half_ = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.workrequesting_steal_half", 0) != 0;
+        init.max_steal_batch_ = hpx::util::get_entry_as<std::size_t>(rtcfg_,
+            "hpx.thread_queue.workrequesting_max_steal_batch",
+            HPX_WORKREQUESTING_MAX_STEAL_BATCH);
 
         std::unique_ptr<local_sched_type> sched(new local_sched_type(init));
 
@@ -564,6 +660,16 @@ namespace hpx { namespace threads {
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
             "core-local_workrequesting_scheduler");
+        init.numa_hierarchical_ = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.workrequesting_numa_hierarchical", 0) != 0;
+        init.numa_remote_backoff_ = hpx::util::get_entry_as<std::uint16_t>(
+            rtcfg_, "hpx.thread_queue.workrequesting_numa_remote_backoff",
+            HPX_WORKREQUESTING_NUMA_REMOTE_BACKOFF);
+        init.steal_half_ = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.workrequesting_steal_half", 0) != 0;
+        init.max_steal_batch_ = hpx::util::get_entry_as<std::size_t>(rtcfg_,
+            "hpx.thread_queue.workrequesting_max_steal_batch",
+            HPX_WORKREQUESTING_MAX_STEAL_BATCH);
 
         std::unique_ptr<local_sched_type> sched(new local_sched_type(init));
 
@@ -596,6 +702,35 @@ namespace hpx { namespace threads {
         std::size_t numa_sensitive = hpx::util::get_entry_as<std::size_t>(
             rtcfg_, "hpx.numa_sensitive", 0);
 
+        bool const idle_parking =
+            hpx::util::get_entry_as<int>(rtcfg_, "hpx.idle_parking", 0) != 0;
+        bool const timer_wheel =
+            hpx::util::get_entry_as<int>(rtcfg_, "hpx.timer_wheel", 0) != 0;
+        bool const fast_suspend =
+            hpx::util::get_entry_as<int>(rtcfg_, "hpx.fast_suspend", 0) != 0;
+
+        thread_pool_elasticity_parameters elasticity;
+        elasticity.enabled_ = hpx::util::get_entry_as<int>(
+                                  rtcfg_, "hpx.elasticity.enabled", 0) != 0;
+        elasticity.min_threads_ = hpx::util::get_entry_as<std::size_t>(
+            rtcfg_, "hpx.elasticity.min_threads", elasticity.min_threads_);
+        // a value of zero does not limit the number of active threads
+        if (std::size_t const max_threads =
+                hpx::util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.elasticity.max_threads", 0);
+            max_threads != 0)
+        {
+            elasticity.max_threads_ = max_threads;
+        }
+        elasticity.interval_ =
+            std::chrono::milliseconds(hpx::util::get_entry_as<std::int64_t>(
+                rtcfg_, "hpx.elasticity.interval",
+                elasticity.interval_.count()));
+        elasticity.grow_queue_length_ = hpx::util::get_entry_as<double>(rtcfg_,
+            "hpx.elasticity.grow_queue_length", elasticity.grow_queue_length_);
+        elasticity.shrink_idle_rate_ = hpx::util::get_entry_as<double>(rtcfg_,
+            "hpx.elasticity.shrink_idle_rate", elasticity.shrink_idle_rate_);
+
         policies::thread_queue_init_parameters thread_queue_init =
             get_init_parameters();
 
@@ -609,6 +744,28 @@ namespace hpx { namespace threads {
             max_background_threads = 0;
         }
 
+        // if a dedicated parcelport progress pool was created, all network
+        // progress is done by that pool only (the pool is created by the
+        // parcelhandler if hpx.parcel.progress_threads > 0)
+        std::size_t progress_pool_index = static_cast<std::size_t>(-1);
+        if (rtcfg_.enable_networking() &&
+            hpx::util::get_entry_as<std::size_t>(
+                rtcfg_, "hpx.parcel.progress_threads", 0) != 0)
+        {
+            std::string const progress_pool = rtcfg_.get_entry(
+                "hpx.parcel.progress_pool", "parcel-progress-pool");
+            for (std::size_t i = 0; i != num_pools; ++i)
+            {
+                if (rp.get_pool_name(i) == progress_pool &&
+                    (rp.get_scheduler_mode(i) &
+                        policies::scheduler_mode::do_background_work_only))
+                {
+                    progress_pool_index = i;
+                    break;
+                }
+            }
+        }
+
         // instantiate the pools
         for (size_t i = 0; i != num_pools; i++)
         {
@@ -633,29 +790,62 @@ namespace hpx { namespace threads {
                 }
             }
 
+            std::size_t pool_max_background_threads = max_background_threads;
+
+            threads::detail::network_background_callback_type
+                network_background_work;
+            if (progress_pool_index == i)
+            {
+                // the first thread of the progress pool takes over the duties
+                // of the first worker thread (flushing the parcel buffers,
+                // AGAS garbage collection)
+                if (!network_background_callback_.empty())
+                {
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+                    network_background_work =
+                        [this, thread_offset](std::size_t num_thread,
+                            std::int64_t& t1, std::int64_t& t2) -> bool {
+                        return network_background_callback_(
+                            num_thread - thread_offset, t1, t2);
+                    };
+#else
+                    network_background_work =
+                        [this, thread_offset](std::size_t num_thread) -> bool {
+                        return network_background_callback_(
+                            num_thread - thread_offset);
+                    };
+#endif
+                }
+                pool_max_background_threads = num_threads_in_pool;
+            }
+            else if (progress_pool_index == static_cast<std::size_t>(-1))
+            {
+                network_background_work = network_background_callback_;
+            }
+
             threads::detail::network_background_callback_type
                 overall_background_work;
             if (!background_work.empty())
             {
-                if (!network_background_callback_.empty())
+                if (!network_background_work.empty())
                 {
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
                     overall_background_work =
-                        [this, background_work](std::size_t num_thread,
-                            std::int64_t& t1, std::int64_t& t2) -> bool {
+                        [network_background_work, background_work](
+                            std::size_t num_thread, std::int64_t& t1,
+                            std::int64_t& t2) -> bool {
                         bool result = background_work(num_thread);
-                        return network_background_callback_(
-                                   num_thread, t1, t2) ||
+                        return network_background_work(num_thread, t1, t2) ||
                             result;
                     };
 #else
                     overall_background_work =
-                        [this, background_work](
+                        [network_background_work, background_work](
                             std::size_t num_thread) -> bool {
                         bool result = background_work(num_thread);
-                        return network_background_callback_(num_thread) ||
-                            result;
+                        return network_background_work(num_thread) || result;
                     };
 #endif
                 }
@@ -675,17 +865,46 @@ namespace hpx { namespace threads {
 
                 max_background_threads =
                     (std::max)(num_threads_in_pool, max_background_threads);
+                pool_max_background_threads = (std::max)(
+                    num_threads_in_pool, pool_max_background_threads);
             }
             else
             {
-                overall_background_work = network_background_callback_;
+                overall_background_work = network_background_work;
+            }
+
+            if (idle_parking)
+            {
+                scheduler_mode = scheduler_mode |
+                    policies::scheduler_mode::enable_idle_parking;
+            }
+
+            if (timer_wheel)
+            {
+                scheduler_mode = scheduler_mode |
+                    policies::scheduler_mode::enable_timer_wheel;
+            }
+
+            if (fast_suspend)
+            {
+                scheduler_mode = scheduler_mode |
+                    policies::scheduler_mode::enable_fast_suspend;
+            }
+
+            // the controller suspends cores, new work must not be assigned
+            // to those
+            if (elasticity.enabled_)
+            {
+                scheduler_mode = scheduler_mode |
+                    policies::scheduler_mode::enable_elasticity;
             }
 
             thread_pool_init_parameters thread_pool_init(name, i,
                 scheduler_mode, num_threads_in_pool, thread_offset, notifier_,
                 rp.get_affinity_data(), overall_background_work,
-                max_background_threads, max_idle_loop_count,
+                pool_max_background_threads, max_idle_loop_count,
                 max_busy_loop_count);
+            thread_pool_init.elasticity_ = elasticity;
 
             switch (sched_type)
             {
@@ -729,6 +948,11 @@ namespace hpx { namespace threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_priority_edf:
+                create_scheduler_local_priority_edf(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::abp_priority_fifo:
                 create_scheduler_abp_priority_fifo(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -744,6 +968,11 @@ namespace hpx { namespace threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::shared_priority_multiqueue:
+                create_scheduler_shared_priority_multiqueue(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             default:
                 [[fallthrough]];
             case resource::scheduling_policy::unspecified:
@@ -768,7 +997,13 @@ namespace hpx { namespace threads {
         }
     }
 
-    threadmanager::~threadmanager() = default;
+    threadmanager::~threadmanager()
+    {
+        if (qos_routing_)
+        {
+            detail::reset_qos_pools();
+        }
+    }
 
     void threadmanager::init()
     {
@@ -783,6 +1018,14 @@ namespace hpx { namespace threads {
             pool_iter->init(num_threads_in_pool, threads_offset);
             threads_offset += num_threads_in_pool;
         }
+
+        // route new work between the pools of the quality of service mode
+        if (auto const* qos = rp.get_qos_parameters())
+        {
+            detail::set_qos_pools(&get_pool(qos->latency_pool),
+                &default_pool(), qos->lending, qos->lend_reserve);
+            qos_routing_ = true;
+        }
     }
 
     void threadmanager::print_pools(std::ostream& os)
@@ -1250,8 +1493,88 @@ namespace hpx { namespace threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_batches(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_batches(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_batch_tasks(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_batch_tasks(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_remote(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_steal_requests_remote(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_attempts(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_attempts(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_successes(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_successes(all_threads, reset);
+        return result;
+    }
+
+    std::vector<std::int64_t> threadmanager::get_steal_histogram(
+        policies::steal_histogram which, bool reset)
+    {
+        std::vector<std::int64_t> result(
+            policies::get_steal_histogram_size(which), 0);
+        for (auto const& pool_iter : pools_)
+        {
+            std::vector<std::int64_t> const buckets =
+                pool_iter->get_steal_histogram(which, all_threads, reset);
+            for (std::size_t i = 0; i != result.size(); ++i)
+                result[i] += buckets[i];
+        }
+        return result;
+    }
 #endif
 
+    std::int64_t threadmanager::get_idle_park_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_park_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_unpark_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_unpark_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_missed_deadline_count(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_missed_deadline_count(all_threads, reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool threadmanager::run()
     {
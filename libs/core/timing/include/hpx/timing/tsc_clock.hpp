@@ -0,0 +1,141 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file tsc_clock.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// clang-format off
+#if (defined(__amd64__) || defined(__amd64) || defined(__x86_64__) ||          \
+    defined(__x86_64) || defined(_M_X64)) && !defined(HPX_COMPUTE_DEVICE_CODE)
+    #define HPX_TSC_CLOCK_HAVE_RDTSC
+    #if defined(HPX_MSVC)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+// clang-format on
+
+namespace hpx::chrono {
+
+    namespace detail {
+
+        struct tsc_calibration
+        {
+            bool uses_tsc;
+            double nanoseconds_per_tick;
+            std::uint64_t base_ticks;
+            std::uint64_t base_nanoseconds;
+        };
+
+        // The calibration is constant initialized to use the steady clock,
+        // the clock is calibrated when it is used for the first time.
+        HPX_CORE_EXPORT extern tsc_calibration tsc_calibration_data;
+        HPX_CORE_EXPORT extern std::atomic<bool> tsc_calibrated;
+
+        // Calibrate the clock unless that has been done already.
+        HPX_CORE_EXPORT tsc_calibration const&
+        calibrate_tsc_clock() noexcept;
+
+        [[nodiscard]] inline tsc_calibration const&
+        get_tsc_calibration() noexcept
+        {
+            if (HPX_LIKELY(tsc_calibrated.load(std::memory_order_acquire)))
+            {
+                return tsc_calibration_data;
+            }
+            return calibrate_tsc_clock();
+        }
+
+        [[nodiscard]] inline std::uint64_t steady_nanoseconds() noexcept
+        {
+            std::chrono::nanoseconds const ns =
+                std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::uint64_t>(ns.count());
+        }
+    }    // namespace detail
+
+    /// \brief Class \c hpx::chrono::tsc_clock is a clock based on the
+    ///        invariant time stamp counter of the processor, which is
+    ///        considerably cheaper to read than the steady clock. It is
+    ///        calibrated against the steady clock when it is used for the
+    ///        first time, the values
+    ///        returned by \c now() are therefore comparable with the values
+    ///        returned by \c hpx::chrono::high_resolution_clock::now().
+    ///
+    /// The time stamp counter is used only if the processor reports an
+    /// invariant counter (i.e., one that runs at a constant rate regardless
+    /// of frequency scaling and sleep states) and, on Linux, if the kernel
+    /// uses it as its clock source (which it does only after having verified
+    /// that the counters of all cores are synchronized). Otherwise the clock
+    /// falls back to the steady clock.
+    struct tsc_clock
+    {
+        /// Returns the current raw tick count, the duration of a tick is
+        /// given by \c nanoseconds_per_tick(). This is the cheapest way to
+        /// measure durations.
+        [[nodiscard]] static std::uint64_t ticks() noexcept
+        {
+#if defined(HPX_TSC_CLOCK_HAVE_RDTSC)
+            if (HPX_LIKELY(detail::get_tsc_calibration().uses_tsc))
+            {
+                return __rdtsc();
+            }
+#endif
+            return detail::steady_nanoseconds();
+        }
+
+        /// Returns the duration of a tick as returned by \c ticks() in
+        /// nanoseconds.
+        [[nodiscard]] static double nanoseconds_per_tick() noexcept
+        {
+            auto const& data = detail::get_tsc_calibration();
+            return data.uses_tsc ? data.nanoseconds_per_tick : 1.0;
+        }
+
+        /// Returns whether the clock uses the time stamp counter (or falls
+        /// back to the steady clock).
+        [[nodiscard]] static bool uses_tsc() noexcept
+        {
+            return detail::get_tsc_calibration().uses_tsc;
+        }
+
+        /// Returns the current time in nanoseconds (on the same epoch as
+        /// \c hpx::chrono::high_resolution_clock::now()).
+        [[nodiscard]] static std::uint64_t now() noexcept
+        {
+#if defined(HPX_TSC_CLOCK_HAVE_RDTSC)
+            auto const& data = detail::get_tsc_calibration();
+            if (HPX_LIKELY(data.uses_tsc))
+            {
+                // the counters of different cores may differ slightly,
+                // values read shortly after the calibration can be smaller
+                // than the base value
+                auto const elapsed = static_cast<std::int64_t>(
+                    __rdtsc() - data.base_ticks);
+                return data.base_nanoseconds +
+                    static_cast<std::uint64_t>(static_cast<std::int64_t>(
+                        static_cast<double>(elapsed) *
+                        data.nanoseconds_per_tick));
+            }
+#endif
+            return detail::steady_nanoseconds();
+        }
+
+        /// Calibrate the clock again. This is done automatically when the
+        /// clock is used for the first time and must not be done while other
+        /// threads use the clock. If \a allow_tsc is false the clock falls
+        /// back to the steady clock.
+        HPX_CORE_EXPORT static void calibrate(bool allow_tsc = true) noexcept;
+    };
+}    // namespace hpx::chrono
@@ -0,0 +1,180 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/timing/tsc_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#if defined(HPX_TSC_CLOCK_HAVE_RDTSC) && !defined(HPX_MSVC)
+#include <cpuid.h>
+#endif
+
+namespace hpx::chrono {
+
+    namespace detail {
+
+        tsc_calibration tsc_calibration_data = {false, 1.0, 0, 0};
+        std::atomic<bool> tsc_calibrated(false);
+
+        namespace {
+
+#if defined(HPX_TSC_CLOCK_HAVE_RDTSC)
+            // The time stamp counter is invariant if CPUID leaf 0x80000007
+            // reports bit 8 of edx
+            bool has_invariant_tsc() noexcept
+            {
+#if defined(HPX_MSVC)
+                int regs[4] = {};
+                __cpuid(regs, 0x80000000);
+                if (static_cast<unsigned>(regs[0]) < 0x80000007u)
+                {
+                    return false;
+                }
+                __cpuid(regs, 0x80000007);
+                return (regs[3] & (1 << 8)) != 0;
+#else
+                unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+                {
+                    return false;
+                }
+                return (edx & (1u << 8)) != 0;
+#endif
+            }
+
+            // The Linux kernel uses the time stamp counter as its clock source
+            // only if it has verified that the counters of all cores are
+            // synchronized, and it switches to a different clock source if
+            // they drift apart later.
+            bool tsc_is_synchronized()
+            {
+#if defined(__linux) || defined(__linux__) || defined(linux)
+                std::ifstream in("/sys/devices/system/clocksource/"
+                                 "clocksource0/current_clocksource");
+                std::string clocksource;
+                if (in >> clocksource)
+                {
+                    return clocksource == "tsc";
+                }
+                return false;
+#else
+                return true;
+#endif
+            }
+
+            // Read the time stamp counter and the steady clock as closely
+            // together as possible: the counter is read before and after the
+            // steady clock, the midpoint of the two readings corresponds to
+            // the steady clock value. The reading with the smallest distance
+            // of the two counter values out of several attempts is used,
+            // which discards the readings interrupted by the system.
+            void read_both(std::uint64_t& ticks, std::uint64_t& ns) noexcept
+            {
+                std::uint64_t best = ~std::uint64_t(0);
+                for (int i = 0; i != 8; ++i)
+                {
+                    std::uint64_t const before = __rdtsc();
+                    std::uint64_t const curr_ns = steady_nanoseconds();
+                    std::uint64_t const after = __rdtsc();
+                    if (after - before < best)
+                    {
+                        best = after - before;
+                        ticks = before + best / 2;
+                        ns = curr_ns;
+                    }
+                }
+            }
+
+            // the duration of the calibration in nanoseconds
+            constexpr std::uint64_t calibration_interval = 1000000;
+#endif
+
+            // the calibration falls back to the steady clock if the time
+            // stamp counter can't be used
+            tsc_calibration measure_calibration(bool allow_tsc) noexcept
+            {
+                tsc_calibration const fallback = {false, 1.0, 0, 0};
+#if defined(HPX_TSC_CLOCK_HAVE_RDTSC)
+                if (!allow_tsc)
+                {
+                    return fallback;
+                }
+
+                try
+                {
+                    if (!has_invariant_tsc() || !tsc_is_synchronized())
+                    {
+                        return fallback;
+                    }
+                }
+                catch (...)
+                {
+                    return fallback;
+                }
+
+                // the first reads of the steady clock are considerably
+                // slower than the later ones (the code and data of the clock
+                // are not cached yet), which would skew the calibration
+                std::uint64_t base_ticks = 0, base_ns = 0;
+                for (int i = 0; i != 4; ++i)
+                {
+                    read_both(base_ticks, base_ns);
+                }
+
+                std::uint64_t ticks = base_ticks, ns = base_ns;
+                while (steady_nanoseconds() - base_ns < calibration_interval)
+                {
+                }
+                read_both(ticks, ns);
+
+                if (ticks <= base_ticks)
+                {
+                    return fallback;
+                }
+
+                return {true,
+                    static_cast<double>(ns - base_ns) /
+                        static_cast<double>(ticks - base_ticks),
+                    ticks, ns};
+#else
+                (void) allow_tsc;
+                return fallback;
+#endif
+            }
+
+            std::mutex& calibration_mutex() noexcept
+            {
+                static std::mutex mtx;
+                return mtx;
+            }
+        }    // namespace
+
+        // The calibration busy waits for a millisecond, it is therefore not
+        // done before the clock is actually used.
+        tsc_calibration const& calibrate_tsc_clock() noexcept
+        {
+            std::lock_guard<std::mutex> l(calibration_mutex());
+            if (!tsc_calibrated.load(std::memory_order_relaxed))
+            {
+                tsc_calibration_data = measure_calibration(true);
+                tsc_calibrated.store(true, std::memory_order_release);
+            }
+            return tsc_calibration_data;
+        }
+    }    // namespace detail
+
+    void tsc_clock::calibrate(bool allow_tsc) noexcept
+    {
+        std::lock_guard<std::mutex> l(detail::calibration_mutex());
+        detail::tsc_calibration_data = detail::measure_calibration(allow_tsc);
+        detail::tsc_calibrated.store(true, std::memory_order_release);
+    }
+}    // namespace hpx::chrono
@@ -0,0 +1,101 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/tsc_clock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// the values of both clocks are compared with a generous tolerance, the
+// calibration is reasonably accurate, but the test may be interrupted
+constexpr std::uint64_t tolerance = 1000000;    // 1ms
+
+///////////////////////////////////////////////////////////////////////////////
+void test_monotonic()
+{
+    std::uint64_t prev_now = hpx::chrono::tsc_clock::now();
+    std::uint64_t prev_ticks = hpx::chrono::tsc_clock::ticks();
+    for (std::size_t i = 0; i != 100000; ++i)
+    {
+        std::uint64_t const now = hpx::chrono::tsc_clock::now();
+        std::uint64_t const ticks = hpx::chrono::tsc_clock::ticks();
+        HPX_TEST_LTE(prev_now, now);
+        HPX_TEST_LTE(prev_ticks, ticks);
+        prev_now = now;
+        prev_ticks = ticks;
+    }
+}
+
+void test_agreement()
+{
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::uint64_t const before = hpx::chrono::high_resolution_clock::now();
+        std::uint64_t const now = hpx::chrono::tsc_clock::now();
+        std::uint64_t const after = hpx::chrono::high_resolution_clock::now();
+
+        HPX_TEST_LTE(before, now + tolerance);
+        HPX_TEST_LTE(now, after + tolerance);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // durations measured using the ticks agree with the steady clock
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+    std::uint64_t const start_ticks = hpx::chrono::tsc_clock::ticks();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::uint64_t const stop_ticks = hpx::chrono::tsc_clock::ticks();
+    std::uint64_t const stop = hpx::chrono::high_resolution_clock::now();
+
+    double const elapsed = static_cast<double>(stop - start);
+    double const elapsed_ticks = static_cast<double>(stop_ticks - start_ticks) *
+        hpx::chrono::tsc_clock::nanoseconds_per_tick();
+
+    HPX_TEST_LTE(elapsed_ticks, elapsed + static_cast<double>(tolerance));
+    HPX_TEST_LTE(elapsed, elapsed_ticks + static_cast<double>(tolerance));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fallback()
+{
+    hpx::chrono::tsc_clock::calibrate(false);
+
+    HPX_TEST(!hpx::chrono::tsc_clock::uses_tsc());
+    HPX_TEST_EQ(hpx::chrono::tsc_clock::nanoseconds_per_tick(), 1.0);
+
+    // the ticks are the nanoseconds of the steady clock
+    std::uint64_t const before = hpx::chrono::high_resolution_clock::now();
+    std::uint64_t const ticks = hpx::chrono::tsc_clock::ticks();
+    std::uint64_t const after = hpx::chrono::high_resolution_clock::now();
+    HPX_TEST_LTE(before, ticks);
+    HPX_TEST_LTE(ticks, after);
+
+    test_monotonic();
+    test_agreement();
+
+    // switch back to the time stamp counter, if available
+    hpx::chrono::tsc_clock::calibrate();
+}
+
+int main()
+{
+    // the first use of the clock calibrates it
+    test_monotonic();
+    test_agreement();
+
+    test_fallback();
+
+    test_monotonic();
+    test_agreement();
+
+    return hpx::util::report_errors();
+}
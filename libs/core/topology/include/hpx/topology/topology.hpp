@@ -157,6 +157,17 @@ namespace hpx::threads {
             mask_cref_type used_processing_units,
             error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit close to (i.e. sharing the locality of) one
+        ///        of the network adapters of the machine. The mask is empty
+        ///        if no network adapter was discovered.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_network_affinity_mask(
+            error_code& ec = throws) const noexcept;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread inside
         ///        the socket it is running on.
@@ -299,6 +310,12 @@ namespace hpx::threads {
         bool set_area_membind_nodeset(
             void const* addr, std::size_t len, void* nodeset) const;
 
+        /// bind already allocated memory to a numa node set as specified by
+        /// the policy and flags (see hwloc docs)
+        bool set_area_membind(void const* addr, std::size_t len,
+            hwloc_bitmap_ptr const& bitmap, hpx_hwloc_membind_policy policy,
+            int flags) const;
+
         int get_numa_domain(void const* addr) const;
 
         /// Free memory that was previously allocated by allocate
@@ -356,6 +373,7 @@ namespace hpx::threads {
             hwloc_obj_t parent, hwloc_obj_type_t type, std::size_t count) const;
 
         mask_type init_machine_affinity_mask() const;
+        mask_type init_network_affinity_mask() const;
         mask_type init_socket_affinity_mask(std::size_t num_thread) const
         {
             return init_socket_affinity_mask_from_socket(
@@ -417,6 +435,7 @@ namespace hpx::threads {
         // elements = 1 indicate the PUs that belong to the core on which
         // PU #0 (zero-based index) lies.
         mask_type machine_affinity_mask_{};
+        mask_type network_affinity_mask_{};
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
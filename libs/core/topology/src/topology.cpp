@@ -161,9 +161,12 @@ namespace hpx::threads {
     mask_type topology::get_service_affinity_mask(
         mask_cref_type used_processing_units, error_code& ec) const
     {
-        // We bind the service threads to the first NUMA domain. This is useful
-        // as the first NUMA domain is likely to have the PCI controllers etc.
-        mask_cref_type machine_mask = this->get_numa_node_affinity_mask(0, ec);
+        // We bind the service threads to the processing units close to the
+        // network adapters, if those are known. Otherwise we bind them to the
+        // first NUMA domain, which is likely to have the PCI controllers etc.
+        mask_cref_type machine_mask = any(network_affinity_mask_) ?
+            network_affinity_mask_ :
+            this->get_numa_node_affinity_mask(0, ec);
         if (ec || !any(machine_mask))
             return {};
 
@@ -234,6 +237,17 @@ namespace hpx::threads {
                 "Failed to set core filter for hwloc topology");
         }
 #endif
+#if defined(HPX_TOPOLOGY_HAVE_NETWORK_LOCALITY)
+        // Discover the PCI devices to be able to place the service threads
+        // close to the network adapters.
+        err = hwloc_topology_set_io_types_filter(
+            topo, HWLOC_TYPE_FILTER_KEEP_IMPORTANT);
+        if (err != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
+                "Failed to set io filter for hwloc topology");
+        }
+#endif
 #endif
 
         err = hwloc_topology_load(topo);
@@ -287,6 +301,7 @@ namespace hpx::threads {
         }
 
         machine_affinity_mask_ = init_machine_affinity_mask();
+        network_affinity_mask_ = init_network_affinity_mask();
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
@@ -409,6 +424,15 @@ namespace hpx::threads {
         return machine_affinity_mask_;
     }
 
+    mask_cref_type topology::get_network_affinity_mask(
+        error_code& ec) const noexcept
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return network_affinity_mask_;
+    }
+
     mask_cref_type topology::get_socket_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -1020,6 +1044,43 @@ namespace hpx::threads {
             "failed to initialize machine affinity mask");
     }
 
+    mask_type topology::init_network_affinity_mask() const
+    {
+        auto network_affinity_mask = mask_type();
+        resize(network_affinity_mask, get_number_of_pus());
+
+#if defined(HPX_TOPOLOGY_HAVE_NETWORK_LOCALITY) &&                             \
+    HWLOC_API_VERSION >= 0x00020000
+        // combine the localities of all network and OpenFabrics (InfiniBand,
+        // Omni-Path, etc.) devices
+        std::unique_lock<mutex_type> lk(topo_mtx);
+        for (hwloc_obj_t osdev = hwloc_get_next_osdev(topo, nullptr);
+             osdev != nullptr; osdev = hwloc_get_next_osdev(topo, osdev))
+        {
+            if (osdev->attr->osdev.type != HWLOC_OBJ_OSDEV_NETWORK &&
+                osdev->attr->osdev.type != HWLOC_OBJ_OSDEV_OPENFABRICS)
+            {
+                continue;
+            }
+
+            // devices attached to the machine as a whole don't provide any
+            // useful locality information
+            hwloc_obj_t const parent =
+                hwloc_get_non_io_ancestor_obj(topo, osdev);
+            if (parent == nullptr || parent->cpuset == nullptr ||
+                hwloc_bitmap_isequal(parent->cpuset,
+                    hwloc_topology_get_topology_cpuset(topo)))
+            {
+                continue;
+            }
+
+            network_affinity_mask |=
+                bitmap_to_mask(parent->cpuset, HWLOC_OBJ_PU);
+        }
+#endif
+        return network_affinity_mask;
+    }
+
     mask_type topology::init_socket_affinity_mask_from_socket(
         std::size_t num_socket) const
     {
@@ -1366,6 +1427,39 @@ namespace hpx::threads {
         return true;
     }
 
+    bool topology::set_area_membind([[maybe_unused]] void const* addr,
+        [[maybe_unused]] std::size_t len,
+        [[maybe_unused]] hwloc_bitmap_ptr const& bitmap,
+        [[maybe_unused]] hpx_hwloc_membind_policy policy,
+        [[maybe_unused]] int flags) const
+    {
+#if !defined(__APPLE__)
+#if HWLOC_API_VERSION >= 0x00010b06
+        int ret = hwloc_set_area_membind(topo, addr, len, bitmap->get_bmp(),
+            static_cast<hwloc_membind_policy_t>(policy),
+            flags | HWLOC_MEMBIND_BYNODESET);
+#else
+        int ret = hwloc_set_area_membind_nodeset(topo, addr, len,
+            bitmap->get_bmp(), static_cast<hwloc_membind_policy_t>(policy),
+            flags);
+#endif
+
+        if (ret < 0)
+        {
+            std::string msg = std::strerror(errno);
+            if (errno == ENOSYS)
+                msg = "the action is not supported";
+            else if (errno == EXDEV)
+                msg = "the binding cannot be enforced";
+
+            HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                "hpx::threads::topology::set_area_membind",
+                "hwloc_set_area_membind failed : {}", msg);
+        }
+#endif
+        return true;
+    }
+
     static hpx_hwloc_bitmap_wrapper& bitmap_storage()
     {
         static thread_local hpx_hwloc_bitmap_wrapper bitmap_storage_(nullptr);
@@ -20,6 +20,7 @@ namespace hpx::actions {
     {
         register_worker_action_id = 0,
         notify_worker_action_id,
+        notify_worker_tree_action_id,
         allocate_action_id,
         base_connect_action_id,
         base_disconnect_action_id,
@@ -77,11 +78,14 @@ namespace hpx::actions {
         primary_namespace_allocate_action_id,
         primary_namespace_begin_migration_action_id,
         primary_namespace_bind_gid_action_id,
+        primary_namespace_bind_gids_action_id,
         primary_namespace_colocate_action_id,
         primary_namespace_decrement_credit_action_id,
         primary_namespace_end_migration_action_id,
         primary_namespace_increment_credit_action_id,
         primary_namespace_resolve_gid_action_id,
+        primary_namespace_resolve_gid_subscribe_action_id,
+        primary_namespace_resolve_gids_action_id,
         primary_namespace_route_action_id,
         primary_namespace_unbind_gid_action_id,
         primary_namespace_statistics_counter_action_id,
@@ -96,7 +100,9 @@ namespace hpx::actions {
         store64_action_id,
         store8_action_id,
         symbol_namespace_bind_action_id,
+        symbol_namespace_bind_names_action_id,
         symbol_namespace_resolve_action_id,
+        symbol_namespace_resolve_subscribe_action_id,
         symbol_namespace_unbind_action_id,
         symbol_namespace_iterate_action_id,
         symbol_namespace_on_event_action_id,
@@ -104,6 +110,8 @@ namespace hpx::actions {
         terminate_action_id,
         terminate_all_action_id,
         update_agas_cache_action_id,
+        invalidate_agas_cache_action_id,
+        invalidate_symbol_cache_action_id,
 
         base_lco_with_value_gid_get,
         base_lco_with_value_gid_set,
@@ -159,6 +167,8 @@ namespace hpx::actions {
         base_lco_with_value_naming_address_set,
         base_lco_with_value_gva_tuple_get,
         base_lco_with_value_gva_tuple_set,
+        base_lco_with_value_vector_gva_tuple_get,
+        base_lco_with_value_vector_gva_tuple_set,
         base_lco_with_value_std_pair_address_id_type_get,
         base_lco_with_value_std_pair_address_id_type_set,
         base_lco_with_value_std_pair_gid_type_get,
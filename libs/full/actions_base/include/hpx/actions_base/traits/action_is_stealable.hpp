@@ -0,0 +1,27 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <type_traits>
+
+namespace hpx::traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point marking (plain) actions whose invocations may be
+    // executed on any locality, i.e. which can be stolen by other localities
+    // (see hpx::distributed::post_stealable)
+    template <typename Action, typename Enable = void>
+    struct action_is_stealable : std::false_type
+    {
+    };
+
+    template <typename Action>
+    inline constexpr bool action_is_stealable_v =
+        action_is_stealable<Action>::value;
+}    // namespace hpx::traits
@@ -28,6 +28,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -70,8 +71,15 @@ namespace hpx { namespace agas {
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
-        std::shared_ptr<gva_cache_type> gva_cache_;
+        // The gva cache is split into shards, each of which is protected by
+        // its own lock. Single GIDs are distributed over the shards based on
+        // their hash value, while ranges of GIDs are kept in an additional
+        // shard which is consulted only if the shard of a GID does not know
+        // about it.
+        struct gva_cache_shard;
+
+        std::size_t const gva_cache_num_shards_;
+        std::shared_ptr<gva_cache_shard[]> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -79,19 +87,40 @@ namespace hpx { namespace agas {
         mutable mutex_type console_cache_mtx_;
         std::uint32_t console_cache_;
 
+        // the ids bound to the names resolved by this locality, see
+        // hpx.agas.use_symbol_caching
+        mutable mutex_type symbol_cache_mtx_;
+        mutable std::map<std::string, hpx::id_type, std::less<>> symbol_cache_;
+
         std::size_t const max_refcnt_requests_;
 
         mutex_type refcnt_requests_mtx_;
         std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
 
+        // pending decrefs are sent at the latest after this interval [us]
+        std::int64_t const refcnt_flush_interval_;
+        bool refcnt_flush_scheduled_;
+
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // number of credit requests and of the messages to AGAS avoided by
+        // aggregating them
+        std::atomic<std::int64_t> refcnt_requests_issued_;
+        std::atomic<std::int64_t> refcnt_messages_saved_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
         bool const caching_;
         bool const range_caching_;
+
+        // notify other localities if cached addresses become stale
+        bool const cache_invalidation_;
+
+        // cache the ids bound to names
+        bool const symbol_caching_;
+
         threads::thread_priority const action_priority_;
 
         std::uint64_t rts_lva_;
@@ -223,6 +252,11 @@ namespace hpx { namespace agas {
 
         naming::address resolve_full_postproc(naming::gid_type const& id,
             primary_namespace::resolved_type const&);
+
+        /// Resolve the given global addresses using one request for each of
+        /// the AGAS service instances managing them
+        hpx::future<std::vector<primary_namespace::resolved_type>>
+        resolve_full_bulk(std::vector<naming::gid_type> const& gids);
         bool bind_postproc(
             naming::gid_type const& id, gva const& g, future<bool> f);
 
@@ -230,10 +264,30 @@ namespace hpx { namespace agas {
         bool was_object_migrated_locked(naming::gid_type const& id);
 
     private:
+        /// Return the cache shard responsible for the given GID (range)
+        gva_cache_shard& get_gva_cache_shard(
+            naming::gid_type const& gid, std::uint64_t count = 1) const;
+
+        /// Distribute the given cache size over all cache shards
+        void reserve_gva_cache(std::size_t cache_size) const;
+
+        /// Sum up the value returned by \a f for all cache shards
+        template <typename F>
+        std::uint64_t accumulate_gva_cache(F&& f) const;
+
+        /// Access the cache of the ids bound to names
+        void add_symbol_cache_entry(
+            std::string const& name, hpx::id_type const& id) const;
+        bool get_symbol_cache_entry(
+            std::string const& name, hpx::id_type& id) const;
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests(
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
 
+        /// Assumes that \a refcnt_requests_mtx_ is locked.
+        void schedule_refcnt_flush(std::unique_lock<mutex_type>& l);
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
             std::unique_lock<mutex_type>& l, error_code& ec);
@@ -264,6 +318,10 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+        // Helper functions to access the reference counting statistics
+        std::int64_t get_refcnt_requests(bool reset);
+        std::int64_t get_refcnt_messages_saved(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
@@ -544,6 +602,19 @@ namespace hpx { namespace agas {
             return bind_range_async(id, 1, addr, 0, locality);
         }
 
+        /// \brief Asynchronously bind all given global ids to the given
+        ///        addresses
+        ///
+        /// The ids are bound using a single request to each of the AGAS
+        /// service instances managing them.
+        ///
+        /// \returns         A future referring to true if all ids were
+        ///                  bound.
+        hpx::future<bool> bind_async_bulk(
+            std::vector<naming::gid_type> const& ids,
+            std::vector<naming::address> const& addrs,
+            naming::gid_type const& locality);
+
         /// \brief Bind unique range of global ids to given base address
         ///
         /// Every locality needs to be able to bind global ids to different
@@ -942,6 +1013,30 @@ namespace hpx { namespace agas {
             naming::address* addrs, std::size_t size,
             hpx::detail::dynamic_bitset<>& locals, error_code& ec = throws);
 
+        /// \brief Asynchronously resolve all given global addresses
+        ///
+        /// All addresses not found in the local cache are resolved using a
+        /// single request to each of the AGAS service instances managing
+        /// them.
+        ///
+        /// \returns         A future referring to the resolved addresses, in
+        ///                  the order of the given global addresses.
+        hpx::future<std::vector<naming::address>> resolve_async_bulk(
+            std::vector<naming::gid_type> const& gids);
+
+        /// \brief Fill the local cache with the given global addresses
+        ///
+        /// All addresses not yet in the local cache (and not managed by this
+        /// locality) are resolved using a single request to each of the AGAS
+        /// service instances managing them. Addresses which can't be resolved
+        /// are silently skipped. Note that prefetching more addresses than
+        /// the cache can hold (see hpx.agas.local_cache_size) evicts some of
+        /// the prefetched entries.
+        ///
+        /// \returns         A future which becomes ready once all addresses
+        ///                  have been stored in the cache.
+        hpx::future<void> prefetch(std::vector<naming::gid_type> const& gids);
+
 #if defined(HPX_HAVE_NETWORKING)
         /// \brief Route the given parcel to the appropriate AGAS service instance
         ///
@@ -1074,6 +1169,21 @@ namespace hpx { namespace agas {
         bool register_name(std::string const& name, hpx::id_type const& id,
             error_code& ec = throws) const;
 
+        /// \brief Register many global names with global addresses at once
+        ///
+        /// The names are registered using one request per locality managing
+        /// any of them.
+        ///
+        /// \param entries    [in] The global names (strings) to register
+        ///                   together with the global addresses (ids) to
+        ///                   associate them with.
+        ///
+        /// \returns          A future holding whether each of the global
+        ///                   names was registered.
+        hpx::future<std::vector<bool>> register_names_async(
+            std::vector<std::pair<std::string, hpx::id_type>> const& entries)
+            const;
+
         /// \brief Unregister a global name (release any existing association)
         ///
         /// This function releases any existing association of the given global
@@ -1157,6 +1267,10 @@ namespace hpx { namespace agas {
         future<hpx::id_type> on_symbol_namespace_event(
             std::string const& name, bool call_for_past_events = false) const;
 
+        /// \warning This function is for internal use only. It is dangerous and
+        ///          may break your code if you use it.
+        void remove_symbol_cache_entry(std::string const& name) const;
+
         /// \warning This function is for internal use only. It is dangerous and
         ///          may break your code if you use it.
         void update_cache_entry(naming::gid_type const& gid, gva const& gva,
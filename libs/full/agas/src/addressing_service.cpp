@@ -16,6 +16,8 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -27,6 +29,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/futures.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/modules/threading.hpp>
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
@@ -34,11 +37,15 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -113,24 +120,89 @@ namespace hpx::agas {
         }
     };
 
+    // Each shard occupies its own cache lines to avoid false sharing between
+    // threads accessing different shards.
+    struct alignas(threads::get_cache_line_size())
+        addressing_service::gva_cache_shard
+    {
+        mutable mutex_type mtx_;
+        gva_cache_type cache_;
+    };
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_cache_num_shards_(ini_.get_agas_local_cache_shards())
+      , gva_cache_(new gva_cache_shard[gva_cache_num_shards_ + 1])
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
+      , refcnt_flush_interval_(ini_.get_agas_refcnt_flush_interval())
+      , refcnt_flush_scheduled_(false)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_requests_issued_(0)
+      , refcnt_messages_saved_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
       , range_caching_(caching_ ? ini_.get_agas_range_caching_mode() : false)
+      , cache_invalidation_(ini_.get_agas_cache_invalidation_mode())
+      , symbol_caching_(ini_.get_agas_symbol_caching_mode())
       , action_priority_(threads::thread_priority::boost)
       , rts_lva_(0)
       , state_(hpx::state::starting)
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+            reserve_gva_cache(ini_.get_agas_local_cache_size());
+
+        primary_ns_.get_service().enable_cache_invalidation(
+            cache_invalidation_);
+        symbol_ns_.get_service().enable_symbol_caching(symbol_caching_);
+    }
+
+    addressing_service::gva_cache_shard&
+    addressing_service::get_gva_cache_shard(
+        naming::gid_type const& gid, std::uint64_t count) const
+    {
+        // ranges of GIDs are kept in the last shard
+        if (count != 1)
+        {
+            return gva_cache_[gva_cache_num_shards_];
+        }
+
+        std::size_t const hash = std::hash<naming::gid_type>()(
+            naming::detail::get_stripped_gid(gid));
+        return gva_cache_[hash % gva_cache_num_shards_];
+    }
+
+    void addressing_service::reserve_gva_cache(std::size_t cache_size) const
+    {
+        // every shard (including the one holding the ranges) is allowed to
+        // store its share of the overall number of entries
+        std::size_t shard_size = cache_size;
+        if (cache_size != static_cast<std::size_t>(~0x0ul))
+        {
+            shard_size = (cache_size + gva_cache_num_shards_ - 1) /
+                gva_cache_num_shards_;
+        }
+
+        for (std::size_t i = 0; i != gva_cache_num_shards_ + 1; ++i)
+        {
+            std::lock_guard<mutex_type> lock(gva_cache_[i].mtx_);
+            gva_cache_[i].cache_.reserve(shard_size);
+        }
+    }
+
+    template <typename F>
+    std::uint64_t addressing_service::accumulate_gva_cache(F&& f) const
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != gva_cache_num_shards_ + 1; ++i)
+        {
+            std::lock_guard<mutex_type> lock(gva_cache_[i].mtx_);
+            result += f(gva_cache_[i].cache_);
+        }
+        return result;
     }
 
     void addressing_service::bootstrap(
@@ -188,8 +260,9 @@ namespace hpx::agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t const previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+            std::size_t const previous = accumulate_gva_cache(
+                [](gva_cache_type const& cache) { return cache.size(); });
+            reserve_gva_cache(cache_size);
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -703,6 +776,62 @@ namespace hpx::agas {
                 &addressing_service::bind_postproc, this, id, g)));
     }
 
+    hpx::future<bool> addressing_service::bind_async_bulk(
+        std::vector<naming::gid_type> const& ids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality)
+    {
+        HPX_ASSERT(ids.size() == addrs.size());
+
+        // collect the ids managed by each service instance
+        std::map<naming::gid_type,
+            std::pair<std::vector<gva>, std::vector<naming::gid_type>>>
+            requests;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            auto& request =
+                requests[primary_namespace::get_service_instance(ids[i])];
+            request.first.emplace_back(addrs[i].locality_, addrs[i].type_, 1,
+                addrs[i].address_, 0);
+            request.second.push_back(
+                naming::detail::get_stripped_gid_except_dont_cache(ids[i]));
+        }
+
+        std::vector<hpx::future<bool>> replies;
+        replies.reserve(requests.size());
+
+        for (auto& request : requests)
+        {
+            // the ids are put into the cache once they are bound
+            replies.push_back(
+                primary_ns_
+                    .bind_gids_async(request.second.first,
+                        request.second.second, locality)
+                    .then(hpx::launch::sync,
+                        [this, gvas = request.second.first,
+                            ids = request.second.second](
+                            hpx::future<bool>&& f) {
+                            bool const result = f.get();
+                            for (std::size_t i = 0; i != ids.size(); ++i)
+                            {
+                                update_cache_entry(ids[i], gvas[i]);
+                            }
+                            return result;
+                        }));
+        }
+
+        return hpx::when_all(HPX_MOVE(replies))
+            .then(hpx::launch::sync, [](auto&& f) {
+                bool result = true;
+                for (auto& reply : f.get())
+                {
+                    // rethrows any exception reported by AGAS
+                    result = reply.get() && result;
+                }
+                return result;
+            });
+    }
+
     hpx::future<naming::address> addressing_service::unbind_range_async(
         naming::gid_type const& lower_id, std::uint64_t count)
     {
@@ -1159,7 +1288,8 @@ namespace hpx::agas {
         }
 
         // ask server
-        auto result = primary_ns_.resolve_full(gid);
+        auto result =
+            primary_ns_.resolve_full(gid, caching_ && cache_invalidation_);
 
         if (result.has_value())
         {
@@ -1281,6 +1411,191 @@ namespace hpx::agas {
         return resolved == count;    // returns whether all have been resolved
     }
 
+    hpx::future<std::vector<primary_namespace::resolved_type>>
+    addressing_service::resolve_full_bulk(
+        std::vector<naming::gid_type> const& gids)
+    {
+        using resolved_type = primary_namespace::resolved_type;
+
+        // collect the indices of the gids managed by each service instance
+        std::map<naming::gid_type, std::vector<std::size_t>> requests;
+        for (std::size_t i = 0; i != gids.size(); ++i)
+        {
+            requests[primary_namespace::get_service_instance(gids[i])]
+                .push_back(i);
+        }
+
+        std::vector<hpx::future<std::vector<resolved_type>>> replies;
+        replies.reserve(requests.size());
+
+        for (auto const& request : requests)
+        {
+            std::vector<naming::gid_type> ids;
+            ids.reserve(request.second.size());
+            for (std::size_t const i : request.second)
+            {
+                ids.push_back(gids[i]);
+            }
+
+            auto result = primary_ns_.resolve_full(
+                HPX_MOVE(ids), caching_ && cache_invalidation_);
+            if (result.has_value())
+            {
+                replies.push_back(
+                    hpx::make_ready_future(HPX_MOVE(result).get_value()));
+            }
+            else
+            {
+                replies.push_back(HPX_MOVE(result).get_future());
+            }
+        }
+
+        return hpx::when_all(HPX_MOVE(replies))
+            .then(hpx::launch::sync,
+                [requests = HPX_MOVE(requests), count = gids.size()](
+                    auto&& f) -> std::vector<resolved_type> {
+                    std::vector<resolved_type> result(count);
+
+                    auto replies = f.get();
+                    auto it = requests.begin();
+                    for (auto& reply : replies)
+                    {
+                        // rethrows any exception reported by AGAS
+                        std::vector<resolved_type> entries = reply.get();
+                        HPX_ASSERT(entries.size() == it->second.size());
+
+                        for (std::size_t i = 0; i != entries.size(); ++i)
+                        {
+                            result[it->second[i]] = HPX_MOVE(entries[i]);
+                        }
+                        ++it;
+                    }
+                    return result;
+                });
+    }
+
+    hpx::future<std::vector<naming::address>>
+    addressing_service::resolve_async_bulk(
+        std::vector<naming::gid_type> const& gids)
+    {
+        std::vector<naming::address> addrs(gids.size());
+
+        // try the cache first
+        std::vector<naming::gid_type> missing;
+        std::vector<std::size_t> missing_indices;
+
+        for (std::size_t i = 0; i != gids.size(); ++i)
+        {
+            if (!gids[i])
+            {
+                return hpx::make_exceptional_future<
+                    std::vector<naming::address>>(
+                    HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                        "addressing_service::resolve_async_bulk",
+                        "invalid reference id"));
+            }
+
+            if (caching_)
+            {
+                error_code ec;
+                if (resolve_cached(gids[i], addrs[i], ec))
+                {
+                    continue;
+                }
+
+                if (ec)
+                {
+                    return hpx::make_exceptional_future<
+                        std::vector<naming::address>>(
+                        hpx::detail::access_exception(ec));
+                }
+            }
+
+            missing.push_back(gids[i]);
+            missing_indices.push_back(i);
+        }
+
+        if (missing.empty())
+        {
+            return hpx::make_ready_future(HPX_MOVE(addrs));
+        }
+
+        // now ask the AGAS service instances for the remaining addresses
+        auto f = resolve_full_bulk(missing);
+        return f.then(hpx::launch::sync,
+            [this, addrs = HPX_MOVE(addrs), missing = HPX_MOVE(missing),
+                missing_indices = HPX_MOVE(missing_indices)](
+                auto&& f) mutable -> std::vector<naming::address> {
+                std::vector<primary_namespace::resolved_type> const entries =
+                    f.get();
+
+                for (std::size_t i = 0; i != entries.size(); ++i)
+                {
+                    addrs[missing_indices[i]] =
+                        resolve_full_postproc(missing[i], entries[i]);
+                }
+                return HPX_MOVE(addrs);
+            });
+    }
+
+    hpx::future<void> addressing_service::prefetch(
+        std::vector<naming::gid_type> const& gids)
+    {
+        if (!caching_)
+        {
+            return hpx::make_ready_future();
+        }
+
+        std::vector<naming::gid_type> missing;
+        missing.reserve(gids.size());
+
+        for (naming::gid_type const& gid : gids)
+        {
+            // locally managed and non-cacheable ids are never cached
+            if (!gid || !naming::detail::store_in_cache(gid) ||
+                naming::get_locality_id_from_gid(gid) ==
+                    naming::get_locality_id_from_gid(locality_))
+            {
+                continue;
+            }
+
+            naming::address addr;
+            if (error_code ec(throwmode::lightweight);
+                !resolve_cached(gid, addr, ec) && !ec)
+            {
+                missing.push_back(gid);
+            }
+        }
+
+        if (missing.empty())
+        {
+            return hpx::make_ready_future();
+        }
+
+        auto f = resolve_full_bulk(missing);
+        return f.then(hpx::launch::sync,
+            [this, missing = HPX_MOVE(missing)](auto&& f) -> void {
+                // failing to prefetch is not an error, the addresses will be
+                // resolved once they are used
+                if (f.has_exception())
+                {
+                    return;
+                }
+
+                std::vector<primary_namespace::resolved_type> const entries =
+                    f.get();
+
+                for (std::size_t i = 0; i != entries.size(); ++i)
+                {
+                    if (hpx::get<0>(entries[i]) != naming::invalid_gid &&
+                        hpx::get<2>(entries[i]) != naming::invalid_gid)
+                    {
+                        resolve_full_postproc(missing[i], entries[i]);
+                    }
+                }
+            });
+    }
+
 #if defined(HPX_HAVE_NETWORKING)
     ///////////////////////////////////////////////////////////////////////////
     void addressing_service::route(parcelset::parcel p,
@@ -1420,9 +1735,12 @@ namespace hpx::agas {
             }
         }
 
+        ++refcnt_requests_issued_;
+
         // no need to talk to AGAS, acknowledge the incref immediately
         if (!has_pending_incref)
         {
+            ++refcnt_messages_saved_;
             return pending_decrefs;
         }
 
@@ -1476,6 +1794,11 @@ namespace hpx::agas {
 
         try
         {
+            // every decref is accounted for as saved message, sending the
+            // aggregated requests subtracts the messages actually sent
+            ++refcnt_requests_issued_;
+            ++refcnt_messages_saved_;
+
             std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
 
             // Match the decref request with entries in the incref table
@@ -1585,12 +1908,102 @@ namespace hpx::agas {
         return f;
     }
 
+    hpx::future<std::vector<bool>> addressing_service::register_names_async(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries) const
+    {
+        std::vector<std::pair<std::string, naming::gid_type>> requests;
+        requests.reserve(entries.size());
+
+        std::vector<std::int64_t> new_credits;
+        new_credits.reserve(entries.size());
+
+        for (auto const& [name, id] : entries)
+        {
+            // We need to modify the reference count.
+            naming::gid_type& mutable_gid =
+                const_cast<hpx::id_type&>(id).get_gid();
+            naming::gid_type const new_gid =
+                naming::detail::split_gid_if_needed(
+                    hpx::launch::sync, mutable_gid);
+
+            new_credits.push_back(naming::detail::get_credit_from_gid(new_gid));
+            requests.emplace_back(name, new_gid);
+        }
+
+        return symbol_ns_.bind_names_async(HPX_MOVE(requests))
+            .then(hpx::launch::sync,
+                [entries, new_credits = HPX_MOVE(new_credits)](
+                    hpx::future<std::vector<bool>>&& f) {
+                    // Return the credit to the GIDs if the operation failed
+                    std::vector<bool> result;
+                    if (f.has_exception())
+                    {
+                        result.resize(entries.size(), false);
+                    }
+                    else
+                    {
+                        result = f.get();
+                    }
+
+                    for (std::size_t i = 0; i != entries.size(); ++i)
+                    {
+                        if (!result[i] && new_credits[i] != 0)
+                        {
+                            naming::detail::add_credit_to_gid(
+                                const_cast<hpx::id_type&>(entries[i].second)
+                                    .get_gid(),
+                                new_credits[i]);
+                        }
+                    }
+                    return result;
+                });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void addressing_service::remove_symbol_cache_entry(
+        std::string const& name) const
+    {
+        // the id is released outside of the lock as this may send a decref
+        // request
+        hpx::id_type id;
+
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        if (auto const it = symbol_cache_.find(name); it != symbol_cache_.end())
+        {
+            id = HPX_MOVE(it->second);
+            symbol_cache_.erase(it);
+        }
+    }
+
+    void addressing_service::add_symbol_cache_entry(
+        std::string const& name, hpx::id_type const& id) const
+    {
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        symbol_cache_.emplace(name, id);
+    }
+
+    bool addressing_service::get_symbol_cache_entry(
+        std::string const& name, hpx::id_type& id) const
+    {
+        std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+        if (auto const it = symbol_cache_.find(name); it != symbol_cache_.end())
+        {
+            id = it->second;
+            return true;
+        }
+        return false;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::id_type addressing_service::unregister_name(
         std::string const& name, error_code& ec) const
     {
         try
         {
+            if (symbol_caching_)
+            {
+                remove_symbol_cache_entry(name);
+            }
             return symbol_ns_.unbind(name);
         }
         catch (hpx::exception const& e)
@@ -1603,6 +2016,10 @@ namespace hpx::agas {
     hpx::future<hpx::id_type> addressing_service::unregister_name_async(
         std::string const& name) const
     {
+        if (symbol_caching_)
+        {
+            remove_symbol_cache_entry(name);
+        }
         return symbol_ns_.unbind_async(name);
     }
 
@@ -1612,7 +2029,7 @@ namespace hpx::agas {
     {
         try
         {
-            return symbol_ns_.resolve(name);
+            return resolve_name_async(name).get();
         }
         catch (hpx::exception const& e)
         {
@@ -1624,7 +2041,26 @@ namespace hpx::agas {
     hpx::future<hpx::id_type> addressing_service::resolve_name_async(
         std::string const& name) const
     {
-        return symbol_ns_.resolve_async(name);
+        if (!symbol_caching_)
+        {
+            return symbol_ns_.resolve_async(name);
+        }
+
+        if (hpx::id_type id; get_symbol_cache_entry(name, id))
+        {
+            return hpx::make_ready_future(HPX_MOVE(id));
+        }
+
+        return symbol_ns_.resolve_async(name, true)
+            .then(hpx::launch::sync,
+                [this, name](hpx::future<hpx::id_type>&& f) {
+                    hpx::id_type id = f.get();
+                    if (id)
+                    {
+                        add_symbol_cache_entry(name, id);
+                    }
+                    return id;
+                });
     }
 
     namespace detail {
@@ -1645,9 +2081,30 @@ namespace hpx::agas {
     future<hpx::id_type> addressing_service::on_symbol_namespace_event(
         std::string const& name, bool call_for_past_events) const
     {
+        if (symbol_caching_ && call_for_past_events)
+        {
+            if (hpx::id_type id; get_symbol_cache_entry(name, id))
+            {
+                return hpx::make_ready_future(HPX_MOVE(id));
+            }
+        }
+
         hpx::distributed::promise<hpx::id_type, naming::gid_type> p;
         auto result_f = p.get_future();
 
+        if (symbol_caching_)
+        {
+            result_f = result_f.then(hpx::launch::sync,
+                [this, name](hpx::future<hpx::id_type>&& f) {
+                    hpx::id_type id = f.get();
+                    if (id)
+                    {
+                        add_symbol_cache_entry(name, id);
+                    }
+                    return id;
+                });
+        }
+
         hpx::future<bool> f =
             symbol_ns_.on_event(name, call_for_past_events, p.get_id());
 
@@ -1734,10 +2191,11 @@ namespace hpx::agas {
                 gid, count);
 
             gva_cache_key const key(gid, count);
+            gva_cache_shard& shard = get_gva_cache_shard(gid, count);
 
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
+                std::unique_lock<mutex_type> lock(shard.mtx_);
+                if (!shard.cache_.update_if(key, g, check_for_collisions))
                 {
                     if (LAGAS_ENABLED(warning))
                     {
@@ -1745,7 +2203,7 @@ namespace hpx::agas {
                         addressing_service::gva_cache_key idbase;
                         addressing_service::gva_cache_type::entry_type e;
 
-                        if (!gva_cache_->get_entry(key, idbase, e))
+                        if (!shard.cache_.get_entry(key, idbase, e))
                         {
                             // This is impossible under sane conditions.
                             lock.unlock();
@@ -1785,16 +2243,30 @@ namespace hpx::agas {
         }
 
         gva_cache_key const k(gid);
+        gva_cache_key idbase_key;
 
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-        if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
+        bool found = false;
+        {
+            gva_cache_shard& shard = get_gva_cache_shard(gid);
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            found = shard.cache_.get_entry(k, idbase_key, gva);
+        }
+
+        if (!found)
+        {
+            // the GID might be part of a cached range
+            gva_cache_shard& shard = get_gva_cache_shard(gid, 0);
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            found = shard.cache_.get_entry(k, idbase_key, gva);
+        }
+
+        if (found)
         {
             std::uint64_t const id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
             if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1824,9 +2296,11 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-            gva_cache_->clear();
+            for (std::size_t i = 0; i != gva_cache_num_shards_ + 1; ++i)
+            {
+                std::lock_guard<mutex_type> lock(gva_cache_[i].mtx_);
+                gva_cache_[i].cache_.clear();
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1871,11 +2345,18 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+            auto const erase_policy =
+                [&gid](std::pair<gva_cache_key, gva> const& p) {
+                    return gid == p.first.get_gid();
+                };
 
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            // the entry is either cached as a single GID or as a range
+            for (std::uint64_t const count : {1, 0})
+            {
+                gva_cache_shard& shard = get_gva_cache_shard(gid, count);
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                shard.cache_.erase(erase_policy);
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1889,6 +2370,14 @@ namespace hpx::agas {
     // Disable refcnt caching during shutdown
     void addressing_service::start_shutdown(error_code& ec)
     {
+        // release the cached ids before the last decref requests are sent
+        std::map<std::string, hpx::id_type, std::less<>> symbol_cache;
+        {
+            std::lock_guard<mutex_type> l(symbol_cache_mtx_);
+            std::swap(symbol_cache, symbol_cache_);
+        }
+        symbol_cache.clear();
+
         // If caching is disabled, we silently pretend success.
         if (!caching_)
             return;
@@ -1902,88 +2391,111 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        return accumulate_gva_cache(
+            [](gva_cache_type const& cache) { return cache.size(); });
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().hits(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().misses(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().evictions(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().insertions(reset);
+        });
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return accumulate_gva_cache([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_time(reset);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t addressing_service::get_refcnt_requests(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_requests_issued_, reset);
+    }
+
+    std::int64_t addressing_service::get_refcnt_messages_saved(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_messages_saved_, reset);
     }
 
     void addressing_service::register_server_instances()
@@ -2028,12 +2540,52 @@ namespace hpx::agas {
 
         if (!enable_refcnt_caching_ ||
             max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        schedule_refcnt_flush(l);
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
+    // Make sure pending decref requests are not held back for longer than the
+    // configured interval, the requests arriving in the meantime are sent
+    // together with the first one.
+    void addressing_service::schedule_refcnt_flush(
+        std::unique_lock<addressing_service::mutex_type>& l)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        if (refcnt_flush_interval_ <= 0 || refcnt_flush_scheduled_)
+        {
+            return;
+        }
+
+        refcnt_flush_scheduled_ = true;
+        l.unlock();
+
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary(
+                [HPX_CXX20_CAPTURE_THIS(=)]() -> void {
+                    hpx::this_thread::sleep_for(
+                        std::chrono::microseconds(refcnt_flush_interval_));
+
+                    std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+                    refcnt_flush_scheduled_ = false;
+
+                    error_code ec(throwmode::lightweight);
+                    send_refcnt_requests_non_blocking(l, ec);
+                }),
+            "addressing_service::schedule_refcnt_flush",
+            threads::thread_priority::normal, threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+        threads::register_thread(data, throws);
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -2113,6 +2665,9 @@ namespace hpx::agas {
                 requests[target].emplace_back(e.second, raw, raw);
             }
 
+            refcnt_messages_saved_ -=
+                static_cast<std::int64_t>(requests.size());
+
             // send requests to all locality
             auto const end = requests.end();
             for (auto it = requests.begin(); it != end; ++it)
@@ -2184,6 +2739,8 @@ namespace hpx::agas {
             requests[target].emplace_back(e.second, raw, raw);
         }
 
+        refcnt_messages_saved_ -= static_cast<std::int64_t>(requests.size());
+
         // send requests to all locality
         auto const end = requests.end();
         for (auto it = requests.begin(); it != end; ++it)
@@ -43,6 +43,12 @@ namespace hpx::agas::detail::impl {
         return naming::get_agas_client().register_name_async(name, id);
     }
 
+    future<std::vector<bool>> register_names_async(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries)
+    {
+        return naming::get_agas_client().register_names_async(entries);
+    }
+
     bool register_name_id(
         std::string const& name, hpx::id_type const& id, error_code& ec)
     {
@@ -182,6 +188,28 @@ namespace hpx::agas::detail::impl {
         return (agas_ != nullptr) ? agas_->resolve_cached(gid, addr) : false;
     }
 
+    std::vector<naming::gid_type> get_gids(std::vector<hpx::id_type> const& ids)
+    {
+        std::vector<naming::gid_type> gids;
+        gids.reserve(ids.size());
+        for (hpx::id_type const& id : ids)
+        {
+            gids.push_back(id.get_gid());
+        }
+        return gids;
+    }
+
+    hpx::future<std::vector<naming::address>> resolve_async_bulk(
+        std::vector<hpx::id_type> const& ids)
+    {
+        return naming::get_agas_client().resolve_async_bulk(get_gids(ids));
+    }
+
+    hpx::future<void> prefetch(std::vector<hpx::id_type> const& ids)
+    {
+        return naming::get_agas_client().prefetch(get_gids(ids));
+    }
+
     hpx::future<bool> bind_async(naming::gid_type const& gid,
         naming::address const& addr, std::uint32_t locality_id)
     {
@@ -210,6 +238,14 @@ namespace hpx::agas::detail::impl {
             .get(ec);
     }
 
+    hpx::future<bool> bind_async_bulk(std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality_)
+    {
+        return naming::get_agas_client().bind_async_bulk(
+            gids, addrs, locality_);
+    }
+
     hpx::future<naming::address> unbind_async(
         naming::gid_type const& id, std::uint64_t)
     {
@@ -538,6 +574,7 @@ namespace hpx::agas {
 
             detail::register_name = &detail::impl::register_name;
             detail::register_name_async = &detail::impl::register_name_async;
+            detail::register_names_async = &detail::impl::register_names_async;
             detail::register_name_id = &detail::impl::register_name_id;
 
             detail::unregister_name_async =
@@ -578,10 +615,13 @@ namespace hpx::agas {
             detail::resolve = &detail::impl::resolve;
             detail::resolve_cached = &detail::impl::resolve_cached;
             detail::resolve_local = &detail::impl::resolve_local;
+            detail::resolve_async_bulk = &detail::impl::resolve_async_bulk;
+            detail::prefetch = &detail::impl::prefetch;
 
             detail::bind_async = &detail::impl::bind_async;
             detail::bind = &detail::impl::bind;
             detail::bind_async_locality = &detail::impl::bind_async_locality;
+            detail::bind_async_bulk = &detail::impl::bind_async_bulk;
             detail::bind_locality = &detail::impl::bind_locality;
 
             detail::unbind_async = &detail::impl::unbind_async;
@@ -25,7 +25,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace hpx::detail {
 
@@ -35,11 +37,28 @@ namespace hpx::detail {
     {
         hpx::agas::update_cache_entry(gid, addr, count, offset);
     }
+
+    void invalidate_agas_cache(hpx::naming::gid_type const& gid)
+    {
+        hpx::naming::get_agas_client().remove_cache_entry(gid);
+    }
+
+    void invalidate_symbol_cache(std::string const& name)
+    {
+        hpx::naming::get_agas_client().remove_symbol_cache_entry(name);
+    }
 }    // namespace hpx::detail
 
 HPX_PLAIN_ACTION_ID(hpx::detail::update_agas_cache, update_agas_cache_action,
     hpx::actions::update_agas_cache_action_id)
 
+HPX_PLAIN_ACTION_ID(hpx::detail::invalidate_agas_cache,
+    invalidate_agas_cache_action, hpx::actions::invalidate_agas_cache_action_id)
+
+HPX_PLAIN_ACTION_ID(hpx::detail::invalidate_symbol_cache,
+    invalidate_symbol_cache_action,
+    hpx::actions::invalidate_symbol_cache_action_id)
+
 namespace hpx::agas::server {
 
     void route_impl(primary_namespace& server, parcelset::parcel&& p)
@@ -82,6 +101,13 @@ namespace hpx::agas::server {
                 naming::detail::set_dont_store_in_cache(
                     hpx::get<0>(cache_address));
             }
+            else
+            {
+                // the source locality will cache the resolved address
+                server.add_cache_subscriber_locked(l,
+                    hpx::get<0>(cache_address),
+                    naming::get_locality_id_from_id(p.source_id()));
+            }
 
             gva const g = hpx::get<1>(cache_address)
                               .resolve(gid, hpx::get<0>(cache_address));
@@ -131,12 +157,45 @@ namespace hpx::agas::server {
         }
     }
 
+    void invalidate_cache_entries_impl(naming::gid_type const& id,
+        std::vector<std::uint32_t> const& localities)
+    {
+        if (get_runtime().get_state() >= hpx::state::pre_shutdown)
+        {
+            return;
+        }
+
+        for (std::uint32_t const locality_id : localities)
+        {
+            hpx::post<invalidate_agas_cache_action>(
+                naming::get_id_from_locality_id(locality_id), id);
+        }
+    }
+
+    void invalidate_symbol_cache_entries_impl(
+        std::string const& name, std::vector<std::uint32_t> const& localities)
+    {
+        if (get_runtime().get_state() >= hpx::state::pre_shutdown)
+        {
+            return;
+        }
+
+        for (std::uint32_t const locality_id : localities)
+        {
+            hpx::post<invalidate_symbol_cache_action>(
+                naming::get_id_from_locality_id(locality_id), name);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct init_route_function
     {
         init_route_function()
         {
             server::route = &route_impl;
+            server::invalidate_cache_entries = &invalidate_cache_entries_impl;
+            server::invalidate_symbol_cache_entries =
+                &invalidate_symbol_cache_entries_impl;
         }
     };
 
@@ -66,14 +66,25 @@ namespace hpx { namespace agas {
         future<bool> bind_gid_async(
             gva g, naming::gid_type id, naming::gid_type locality);
 
+        // All given ids have to be managed by the same service instance
+        future<bool> bind_gids_async(std::vector<gva> gvas,
+            std::vector<naming::gid_type> ids, naming::gid_type locality);
+
 #if defined(HPX_HAVE_NETWORKING)
         void route(parcelset::parcel&& p,
             hpx::function<void(
                 std::error_code const&, parcelset::parcel const&)>&& f);
 #endif
 
+        // If subscribe is true, this locality is notified whenever the
+        // resolved address of a remotely managed id becomes stale.
         resolved_type resolve_gid(naming::gid_type const& id);
-        hpx::future_or_value<resolved_type> resolve_full(naming::gid_type id);
+        hpx::future_or_value<resolved_type> resolve_full(
+            naming::gid_type id, bool subscribe = false);
+
+        // All given ids have to be managed by the same service instance
+        hpx::future_or_value<std::vector<resolved_type>> resolve_full(
+            std::vector<naming::gid_type> ids, bool subscribe = false);
 
         hpx::future_or_value<id_type> colocate(naming::gid_type id);
 
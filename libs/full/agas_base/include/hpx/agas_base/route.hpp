@@ -10,12 +10,28 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/agas_base/agas_fwd.hpp>
+#include <hpx/naming_base/gid_type.hpp>
 #include <hpx/parcelset/parcel.hpp>
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace hpx::agas::server {
 
     extern HPX_EXPORT void (*route)(
         primary_namespace& server, parcelset::parcel&& p);
+
+    // Notify the given localities that their cached address of the given gid
+    // has become stale.
+    extern HPX_EXPORT void (*invalidate_cache_entries)(
+        naming::gid_type const& id,
+        std::vector<std::uint32_t> const& localities);
+
+    // Notify the given localities that their cached id bound to the given
+    // name has become stale.
+    extern HPX_EXPORT void (*invalidate_symbol_cache_entries)(
+        std::string const& name, std::vector<std::uint32_t> const& localities);
 }    // namespace hpx::agas::server
 
 #endif
@@ -143,10 +143,17 @@ namespace hpx::agas::server {
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        // the localities which have cached the address of a bound gid, they
+        // are notified whenever the binding changes
+        using cache_subscribers_type =
+            std::map<naming::gid_type, std::vector<std::uint32_t>>;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
         migration_table_type migrating_objects_;
+        cache_subscribers_type cache_subscribers_;
+        bool cache_invalidation_ = false;
 
     public:
         // data structure holding all counters for the component_namespace
@@ -265,6 +272,18 @@ namespace hpx::agas::server {
             next_id_ = naming::gid_type(g.get_msb() + 1, 0x1000);
         }
 
+        // enable keeping track of the localities which have cached resolved
+        // addresses, see hpx.agas.use_cache_invalidation
+        void enable_cache_invalidation(bool enable) noexcept
+        {
+            cache_invalidation_ = enable;
+        }
+
+        // record that the given locality has cached the address of the
+        // given (base) gid
+        void add_cache_subscriber_locked(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& id, std::uint32_t locality_id);
+
         void register_server_instance(char const* servicename,
             std::uint32_t locality_id = naming::invalid_locality_id,
             error_code& ec = throws);
@@ -278,6 +297,11 @@ namespace hpx::agas::server {
         bool bind_gid(gva const& g, naming::gid_type id,
             naming::gid_type const& locality);
 
+        // bind all given ids, returns true if all ids were bound
+        bool bind_gids(std::vector<gva> const& gvas,
+            std::vector<naming::gid_type> const& ids,
+            naming::gid_type const& locality);
+
         // API
         std::pair<hpx::id_type, naming::address> begin_migration(
             naming::gid_type id);
@@ -285,6 +309,18 @@ namespace hpx::agas::server {
 
         resolved_type resolve_gid(naming::gid_type const& id);
 
+        // resolve the given id and notify the given locality once the
+        // resolved address becomes stale
+        resolved_type resolve_gid_subscribe(
+            naming::gid_type const& id, std::uint32_t locality_id);
+
+        // resolve all given ids, the results are returned in the same order;
+        // a valid locality id subscribes this locality to all resolved
+        // addresses
+        std::vector<resolved_type> resolve_gids(
+            std::vector<naming::gid_type> const& ids,
+            std::uint32_t locality_id);
+
         hpx::id_type colocate(naming::gid_type const& id);
 
         naming::address unbind_gid(std::uint64_t count, naming::gid_type id);
@@ -303,6 +339,15 @@ namespace hpx::agas::server {
             naming::gid_type const& gid, error_code& ec);
 
     private:
+        resolved_type resolve_gid_impl(
+            naming::gid_type const& id, std::uint32_t locality_id);
+
+        // notify all localities which have cached the address of the given
+        // (base) gid that it has become stale, expects that l is locked,
+        // returns with l unlocked
+        void notify_cache_subscribers(
+            std::unique_lock<mutex_type>& l, naming::gid_type const& id);
+
         resolved_type resolve_gid_locked_non_local(
             std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
             error_code& ec);
@@ -348,12 +393,15 @@ namespace hpx::agas::server {
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gids)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, colocate)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, begin_migration)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid_subscribe)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gids)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid)
 #if defined(HPX_HAVE_NETWORKING)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route)
@@ -375,6 +423,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::bind_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::begin_migration_action)
 
@@ -410,6 +465,20 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gid_subscribe_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gid_subscribe_action,
+    primary_namespace_resolve_gid_subscribe_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -437,6 +506,9 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
 typedef hpx::tuple<hpx::naming::gid_type, hpx::agas::gva, hpx::naming::gid_type>
     gva_tuple_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(gva_tuple_type, gva_tuple)
+typedef std::vector<gva_tuple_type> vector_gva_tuple_type;
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    vector_gva_tuple_type, vector_gva_tuple_type)
 typedef std::pair<hpx::id_type, hpx::naming::address> std_pair_address_id_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     std_pair_address_id_type, std_pair_address_id_type)
@@ -23,8 +23,10 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -53,11 +55,18 @@ namespace hpx::agas::server {
 
         using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
 
+        // the localities which have cached the id bound to a name, they are
+        // notified once the name is unbound
+        using cache_subscribers_type =
+            std::map<std::string, std::vector<std::uint32_t>>;
+
     private:
         mutex_type mutex_;
         gid_table_type gids_;
         std::string instance_name_;
         on_event_data_map_type on_event_data_;
+        cache_subscribers_type cache_subscribers_;
+        bool symbol_caching_ = false;
 
     public:
         // data structure holding all counters for the component_namespace component
@@ -133,10 +142,27 @@ namespace hpx::agas::server {
 
         void unregister_server_instance(error_code& ec = throws) const;
 
+        // enable keeping track of the localities which have cached resolved
+        // names, see hpx.agas.use_symbol_caching
+        void enable_symbol_caching(bool enable) noexcept
+        {
+            symbol_caching_ = enable;
+        }
+
         bool bind(std::string const& key, naming::gid_type const& gid);
 
+        // bind all given names, returns whether each of the names was bound
+        std::vector<bool> bind_names(
+            std::vector<std::pair<std::string, naming::gid_type>> const&
+                entries);
+
         naming::gid_type resolve(std::string const& key);
 
+        // resolve the given name and notify the given locality once the name
+        // is unbound
+        naming::gid_type resolve_subscribe(
+            std::string const& key, std::uint32_t locality_id);
+
         naming::gid_type unbind(std::string const& key);
 
         iterate_names_return_type iterate(std::string const& pattern);
@@ -144,8 +170,15 @@ namespace hpx::agas::server {
         bool on_event(std::string const& name, bool call_for_past_events,
             hpx::id_type const& lco);
 
+    private:
+        void add_cache_subscriber_locked(std::unique_lock<mutex_type>& l,
+            std::string const& key, std::uint32_t locality_id);
+
+    public:
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind_names)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve_subscribe)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event)
@@ -158,6 +191,20 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::bind_action,
     symbol_namespace_bind_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::bind_names_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::resolve_subscribe_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::resolve_subscribe_action,
+    symbol_namespace_resolve_subscribe_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::symbol_namespace::resolve_action)
 
@@ -21,6 +21,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -62,7 +64,16 @@ namespace hpx::agas {
             std::string const& key, naming::gid_type const& gid) const;
         bool bind(std::string const& key, naming::gid_type const& gid) const;
 
-        hpx::future<hpx::id_type> resolve_async(std::string const& key) const;
+        // bind all given names using one request per service instance,
+        // returns whether each of the names was bound
+        hpx::future<std::vector<bool>> bind_names_async(
+            std::vector<std::pair<std::string, naming::gid_type>> entries)
+            const;
+
+        // If subscribe is true, this locality is notified once the resolved
+        // name is unbound.
+        hpx::future<hpx::id_type> resolve_async(
+            std::string const& key, bool subscribe = false) const;
         hpx::id_type resolve(std::string const& key) const;
 
         hpx::future<hpx::id_type> unbind_async(std::string key) const;
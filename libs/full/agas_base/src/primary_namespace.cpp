@@ -43,6 +43,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action,
     hpx::actions::primary_namespace_bind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action,
+    hpx::actions::primary_namespace_bind_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::begin_migration_action,
     primary_namespace_begin_migration_action,
     hpx::actions::primary_namespace_begin_migration_action_id)
@@ -63,6 +67,14 @@ HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_subscribe_action,
+    primary_namespace_resolve_gid_subscribe_action,
+    hpx::actions::primary_namespace_resolve_gid_subscribe_action_id)
+
+HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action,
+    hpx::actions::primary_namespace_resolve_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::colocate_action,
     primary_namespace_colocate_action,
     hpx::actions::primary_namespace_colocate_action_id)
@@ -83,6 +95,10 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(hpx::naming::address, naming_address,
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(gva_tuple_type, gva_tuple,
     hpx::actions::base_lco_with_value_gva_tuple_get,
     hpx::actions::base_lco_with_value_gva_tuple_set)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(vector_gva_tuple_type,
+    vector_gva_tuple_type,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_get,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_set)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std_pair_address_id_type,
     std_pair_address_id_type,
     hpx::actions::base_lco_with_value_std_pair_address_id_type_get,
@@ -207,6 +223,32 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    future<bool> primary_namespace::bind_gids_async(std::vector<gva> gvas,
+        std::vector<naming::gid_type> ids, naming::gid_type locality)
+    {
+        if (ids.empty())
+        {
+            return hpx::make_ready_future(true);
+        }
+
+        hpx::id_type dest = hpx::id_type(get_service_instance(ids.front()),
+            hpx::id_type::management_type::unmanaged);
+        if (naming::get_locality_id_from_gid(dest.get_gid()) ==
+            agas::get_locality_id())
+        {
+            return hpx::make_ready_future(
+                server_->bind_gids(gvas, ids, locality));
+        }
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::bind_gids_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(gvas),
+            HPX_MOVE(ids), HPX_MOVE(locality));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(true);
+#endif
+    }
+
 #if defined(HPX_HAVE_NETWORKING)
     void primary_namespace::route(parcelset::parcel&& p,
         hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
@@ -241,17 +283,24 @@ namespace hpx { namespace agas {
     }
 
     hpx::future_or_value<primary_namespace::resolved_type>
-    primary_namespace::resolve_full(naming::gid_type id)
+    primary_namespace::resolve_full(naming::gid_type id, bool subscribe)
     {
         hpx::id_type dest = hpx::id_type(
             get_service_instance(id), hpx::id_type::management_type::unmanaged);
 
-        if (naming::get_locality_id_from_id(dest) == agas::get_locality_id())
+        std::uint32_t const locality_id = agas::get_locality_id();
+        if (naming::get_locality_id_from_id(dest) == locality_id)
         {
             return server_->resolve_gid(id);
         }
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
+        if (subscribe)
+        {
+            server::primary_namespace::resolve_gid_subscribe_action action;
+            return hpx::async(action, HPX_MOVE(dest), id, locality_id);
+        }
+
         server::primary_namespace::resolve_gid_action action;
         return hpx::async(action, HPX_MOVE(dest), id);
 #else
@@ -260,6 +309,34 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    hpx::future_or_value<std::vector<primary_namespace::resolved_type>>
+    primary_namespace::resolve_full(
+        std::vector<naming::gid_type> ids, bool subscribe)
+    {
+        if (ids.empty())
+        {
+            return std::vector<resolved_type>();
+        }
+
+        hpx::id_type dest = hpx::id_type(get_service_instance(ids.front()),
+            hpx::id_type::management_type::unmanaged);
+
+        std::uint32_t const locality_id = agas::get_locality_id();
+        if (naming::get_locality_id_from_id(dest) == locality_id)
+        {
+            return server_->resolve_gids(ids, naming::invalid_locality_id);
+        }
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        server::primary_namespace::resolve_gids_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(ids),
+            subscribe ? locality_id : naming::invalid_locality_id);
+#else
+        HPX_ASSERT(false);
+        return std::vector<resolved_type>();
+#endif
+    }
+
     hpx::future_or_value<id_type> primary_namespace::colocate(
         naming::gid_type id)
     {
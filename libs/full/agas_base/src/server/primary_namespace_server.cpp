@@ -21,6 +21,7 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <list>
@@ -272,7 +273,9 @@ namespace hpx::agas::server {
                 gaddr.offset = g.offset;
                 loc = locality;
 
-                l.unlock();
+                // the object was migrated, notify all localities which have
+                // cached its old address
+                notify_cache_subscribers(l, id);
 
                 LAGAS_(info).format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -373,6 +376,20 @@ namespace hpx::agas::server {
         return true;
     }    // }}}
 
+    bool primary_namespace::bind_gids(std::vector<gva> const& gvas,
+        std::vector<naming::gid_type> const& ids,
+        naming::gid_type const& locality)
+    {
+        HPX_ASSERT(gvas.size() == ids.size());
+
+        bool result = true;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            result = bind_gid(gvas[i], ids[i], locality) && result;
+        }
+        return result;
+    }
+
     inline primary_namespace::resolved_type resolve_local_id(
         naming::gid_type const& id) noexcept
     {
@@ -386,6 +403,18 @@ namespace hpx::agas::server {
 
     primary_namespace::resolved_type primary_namespace::resolve_gid(
         naming::gid_type const& id)
+    {
+        return resolve_gid_impl(id, naming::invalid_locality_id);
+    }
+
+    primary_namespace::resolved_type primary_namespace::resolve_gid_subscribe(
+        naming::gid_type const& id, std::uint32_t locality_id)
+    {
+        return resolve_gid_impl(id, locality_id);
+    }
+
+    primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+        naming::gid_type const& id, std::uint32_t locality_id)
     {    // {{{ resolve_gid implementation
         util::scoped_timer<std::atomic<std::int64_t>> update(
             counter_data_.resolve_gid_.time_,
@@ -413,6 +442,13 @@ namespace hpx::agas::server {
 
             // now, resolve the id
             r = resolve_gid_locked_non_local(l, id, hpx::throws);
+
+            if (locality_id != naming::invalid_locality_id &&
+                get<0>(r) != naming::invalid_gid &&
+                naming::detail::store_in_cache(id))
+            {
+                add_cache_subscriber_locked(l, get<0>(r), locality_id);
+            }
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -433,6 +469,68 @@ namespace hpx::agas::server {
         return r;
     }    // }}}
 
+    std::vector<primary_namespace::resolved_type>
+    primary_namespace::resolve_gids(
+        std::vector<naming::gid_type> const& ids, std::uint32_t locality_id)
+    {
+        std::vector<resolved_type> result;
+        result.reserve(ids.size());
+
+        for (naming::gid_type const& id : ids)
+        {
+            result.push_back(resolve_gid_impl(id, locality_id));
+        }
+
+        return result;
+    }
+
+    void primary_namespace::add_cache_subscriber_locked(
+        [[maybe_unused]] std::unique_lock<mutex_type>& l,
+        naming::gid_type const& id, std::uint32_t locality_id)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        // the entries of this locality are not cached
+        if (!cache_invalidation_ ||
+            locality_id == naming::get_locality_id_from_gid(locality_))
+        {
+            return;
+        }
+
+        std::vector<std::uint32_t>& subscribers = cache_subscribers_[id];
+        if (std::find(subscribers.begin(), subscribers.end(), locality_id) ==
+            subscribers.end())
+        {
+            subscribers.push_back(locality_id);
+        }
+    }
+
+    void primary_namespace::notify_cache_subscribers(
+        std::unique_lock<mutex_type>& l, naming::gid_type const& id)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        auto const it = cache_subscribers_.find(id);
+        if (it == cache_subscribers_.end())
+        {
+            l.unlock();
+            return;
+        }
+
+        // the localities have to subscribe again when resolving the id
+        std::vector<std::uint32_t> const subscribers = HPX_MOVE(it->second);
+        cache_subscribers_.erase(it);
+
+        l.unlock();
+
+#if defined(HPX_HAVE_NETWORKING)
+        if (server::invalidate_cache_entries != nullptr)
+        {
+            (*server::invalidate_cache_entries)(id, subscribers);
+        }
+#endif
+    }
+
     hpx::id_type primary_namespace::colocate(naming::gid_type const& id)
     {
         return {hpx::get<2>(resolve_gid(id)),
@@ -466,7 +564,7 @@ namespace hpx::agas::server {
 
             gvas_.erase(it);
 
-            l.unlock();
+            notify_cache_subscribers(l, id);
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -1123,6 +1221,9 @@ namespace hpx::agas::server {
 #if defined(HPX_HAVE_NETWORKING)
     void (*route)(primary_namespace& server, parcelset::parcel&& p) = nullptr;
 
+    void (*invalidate_cache_entries)(naming::gid_type const& id,
+        std::vector<std::uint32_t> const& localities) = nullptr;
+
     void primary_namespace::route(parcelset::parcel&& p)
     {
         util::scoped_timer<std::atomic<std::int64_t>> update(
@@ -7,18 +7,21 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/agas_base/route.hpp>
 #include <hpx/agas_base/server/symbol_namespace.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/format.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming/credit_handling.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/scoped_timer.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -209,7 +212,46 @@ namespace hpx::agas::server {
         return true;
     }
 
+    std::vector<bool> symbol_namespace::bind_names(
+        std::vector<std::pair<std::string, naming::gid_type>> const& entries)
+    {
+        std::vector<bool> result;
+        result.reserve(entries.size());
+
+        for (auto const& [key, gid] : entries)
+        {
+            result.push_back(bind(key, gid));
+        }
+
+        return result;
+    }
+
     naming::gid_type symbol_namespace::resolve(std::string const& key)
+    {
+        return resolve_subscribe(key, naming::invalid_locality_id);
+    }
+
+    void symbol_namespace::add_cache_subscriber_locked(
+        [[maybe_unused]] std::unique_lock<mutex_type>& l,
+        std::string const& key, std::uint32_t locality_id)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        if (!symbol_caching_ || locality_id == naming::invalid_locality_id)
+        {
+            return;
+        }
+
+        std::vector<std::uint32_t>& subscribers = cache_subscribers_[key];
+        if (std::find(subscribers.begin(), subscribers.end(), locality_id) ==
+            subscribers.end())
+        {
+            subscribers.push_back(locality_id);
+        }
+    }
+
+    naming::gid_type symbol_namespace::resolve_subscribe(
+        std::string const& key, std::uint32_t locality_id)
     {
         util::scoped_timer<std::atomic<std::int64_t>> update(
             counter_data_.resolve_.time_, counter_data_.resolve_.enabled_);
@@ -229,6 +271,8 @@ namespace hpx::agas::server {
             return naming::invalid_gid;
         }
 
+        add_cache_subscriber_locked(l, key, locality_id);
+
         // hold on to gid before unlocking the map
         std::shared_ptr<naming::gid_type> const current_gid(it->second);
 
@@ -244,6 +288,11 @@ namespace hpx::agas::server {
         return gid;
     }
 
+#if defined(HPX_HAVE_NETWORKING)
+    void (*invalidate_symbol_cache_entries)(std::string const& name,
+        std::vector<std::uint32_t> const& localities) = nullptr;
+#endif
+
     naming::gid_type symbol_namespace::unbind(std::string const& key)
     {
         util::scoped_timer<std::atomic<std::int64_t>> update(
@@ -268,8 +317,25 @@ namespace hpx::agas::server {
 
         gids_.erase(it);
 
+        // the localities have to subscribe again when resolving the name
+        std::vector<std::uint32_t> subscribers;
+        if (auto const sit = cache_subscribers_.find(key);
+            sit != cache_subscribers_.end())
+        {
+            subscribers = HPX_MOVE(sit->second);
+            cache_subscribers_.erase(sit);
+        }
+
         l.unlock();
 
+#if defined(HPX_HAVE_NETWORKING)
+        if (!subscribers.empty() &&
+            server::invalidate_symbol_cache_entries != nullptr)
+        {
+            (*server::invalidate_symbol_cache_entries)(key, subscribers);
+        }
+#endif
+
         LAGAS_(info).format(
             "symbol_namespace::unbind, key({1}), gid({2})", key, gid);
 
@@ -337,6 +403,10 @@ namespace hpx::agas::server {
 
         std::unique_lock<mutex_type> l(mutex_);
 
+        // the locality of the LCO will cache the id bound to the name
+        add_cache_subscriber_locked(
+            l, name, naming::get_locality_id_from_id(lco));
+
         bool handled = false;
 
         if (call_for_past_events)
@@ -17,9 +17,13 @@
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/hashing/jenkins_hash.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/util/from_string.hpp>
 
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -37,10 +41,18 @@ HPX_DEFINE_GET_COMPONENT_TYPE_STATIC(
 HPX_REGISTER_ACTION_ID(symbol_namespace::bind_action,
     symbol_namespace_bind_action, hpx::actions::symbol_namespace_bind_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action,
+    hpx::actions::symbol_namespace_bind_names_action_id)
+
 HPX_REGISTER_ACTION_ID(symbol_namespace::resolve_action,
     symbol_namespace_resolve_action,
     hpx::actions::symbol_namespace_resolve_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::resolve_subscribe_action,
+    symbol_namespace_resolve_subscribe_action,
+    hpx::actions::symbol_namespace_resolve_subscribe_action_id)
+
 HPX_REGISTER_ACTION_ID(symbol_namespace::unbind_action,
     symbol_namespace_unbind_action,
     hpx::actions::symbol_namespace_unbind_action_id)
@@ -180,14 +192,81 @@ namespace hpx::agas {
 #endif
     }
 
+    hpx::future<std::vector<bool>> symbol_namespace::bind_names_async(
+        [[maybe_unused]] std::vector<std::pair<std::string, naming::gid_type>>
+            entries) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        using entries_type =
+            std::vector<std::pair<std::string, naming::gid_type>>;
+
+        // group the names by the locality responsible for them
+        std::map<std::uint32_t, std::pair<std::vector<std::size_t>,
+                                    entries_type>>
+            requests;
+        for (std::size_t i = 0; i != entries.size(); ++i)
+        {
+            auto& request = requests[naming::get_locality_id_from_id(
+                symbol_namespace_locality(entries[i].first))];
+            request.first.push_back(i);
+            request.second.push_back(HPX_MOVE(entries[i]));
+        }
+
+        std::vector<std::vector<std::size_t>> indices;
+        indices.reserve(requests.size());
+
+        std::vector<hpx::future<std::vector<bool>>> results;
+        results.reserve(requests.size());
+
+        for (auto& [locality_id, request] : requests)
+        {
+            indices.push_back(HPX_MOVE(request.first));
+            if (locality_id == agas::get_locality_id())
+            {
+                results.push_back(hpx::make_ready_future(
+                    server_->bind_names(request.second)));
+                continue;
+            }
+
+            hpx::id_type target(get_service_instance(locality_id),
+                hpx::id_type::management_type::unmanaged);
+
+            constexpr server::symbol_namespace::bind_names_action action;
+            results.push_back(hpx::async(
+                action, HPX_MOVE(target), HPX_MOVE(request.second)));
+        }
+
+        return hpx::dataflow(
+            hpx::unwrapping(
+                [size = entries.size(), indices = HPX_MOVE(indices)](
+                    std::vector<std::vector<bool>>&& data) {
+                    std::vector<bool> result(size, false);
+                    for (std::size_t i = 0; i != data.size(); ++i)
+                    {
+                        for (std::size_t j = 0; j != data[i].size(); ++j)
+                        {
+                            result[indices[i][j]] = data[i][j];
+                        }
+                    }
+                    return result;
+                }),
+            results);
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>{});
+#endif
+    }
+
     hpx::future<hpx::id_type> symbol_namespace::resolve_async(
-        std::string const& key) const
+        std::string const& key, [[maybe_unused]] bool subscribe) const
     {
         hpx::id_type dest = symbol_namespace_locality(key);
 
         if (naming::get_locality_id_from_id(dest) == agas::get_locality_id())
         {
-            naming::gid_type const raw_gid = server_->resolve(key);
+            naming::gid_type const raw_gid = server_->resolve_subscribe(key,
+                subscribe ? agas::get_locality_id() :
+                            naming::invalid_locality_id);
 
             if (naming::detail::has_credits(raw_gid))
             {
@@ -200,6 +279,14 @@ namespace hpx::agas {
         }
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
+        if (subscribe)
+        {
+            constexpr server::symbol_namespace::resolve_subscribe_action
+                action;
+            return hpx::async(
+                action, HPX_MOVE(dest), key, agas::get_locality_id());
+        }
+
         constexpr server::symbol_namespace::resolve_action action;
         return hpx::async(action, HPX_MOVE(dest), key);
 #else
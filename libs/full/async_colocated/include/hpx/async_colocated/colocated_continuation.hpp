@@ -0,0 +1,169 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_distributed/detail/post.hpp>
+#include <hpx/async_distributed/detail/post_continue_fwd.hpp>
+#include <hpx/async_distributed/detail/post_implementations_fwd.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/functional/bind.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/access.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx::actions {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Continuations which invoke the given action on the locality the
+    // preceding action was executed on, as opposed to sending the result of
+    // the preceding action back to the locality that created the continuation
+    // first (see continuation_impl and continuation2_impl).
+    template <typename Cont>
+    struct colocated_continuation_impl
+    {
+    private:
+        using cont_type = std::decay_t<Cont>;
+
+    public:
+        colocated_continuation_impl() = default;
+
+        template <typename Cont_,
+            typename Enable = std::enable_if_t<!std::is_same_v<
+                std::decay_t<Cont_>, colocated_continuation_impl>>>
+        explicit colocated_continuation_impl(Cont_&& cont)
+          : cont_(HPX_FORWARD(Cont_, cont))
+        {
+        }
+
+        virtual ~colocated_continuation_impl() = default;
+
+        template <typename T>
+        util::invoke_result_t<cont_type, hpx::id_type, T> operator()(
+            hpx::id_type const& lco, T&& t) const
+        {
+            // this is executed on the locality the preceding action was run
+            // on, the value never leaves this locality
+            hpx::post_c(cont_, lco,
+                naming::get_id_from_locality_id(agas::get_locality_id()),
+                HPX_FORWARD(T, t));
+
+            // Unfortunately we need to default construct the return value,
+            // this possibly imposes an additional restriction of return types.
+            using result_type =
+                util::invoke_result_t<cont_type, hpx::id_type, T>;
+            return result_type();
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & cont_;
+            // clang-format on
+        }
+
+        cont_type cont_;
+    };
+
+    template <typename Cont, typename F>
+    struct colocated_continuation2_impl
+    {
+    private:
+        using cont_type = std::decay_t<Cont>;
+        using function_type = std::decay_t<F>;
+
+    public:
+        colocated_continuation2_impl() = default;
+
+        template <typename Cont_, typename F_>
+        colocated_continuation2_impl(Cont_&& cont, F_&& f)
+          : cont_(HPX_FORWARD(Cont_, cont))
+          , f_(HPX_FORWARD(F_, f))
+        {
+        }
+
+        virtual ~colocated_continuation2_impl() = default;
+
+        template <typename T>
+        util::invoke_result_t<function_type, hpx::id_type,
+            util::invoke_result_t<cont_type, hpx::id_type, T>>
+        operator()(hpx::id_type const& lco, T&& t) const
+        {
+            // the next continuation (f_) is invoked with the result of the
+            // action on this locality as well, which allows to build chains
+            // of colocated continuations
+            using hpx::placeholders::_2;
+            hpx::post_continue(cont_, hpx::bind(f_, lco, _2),
+                naming::get_id_from_locality_id(agas::get_locality_id()),
+                HPX_FORWARD(T, t));
+
+            // Unfortunately we need to default construct the return value,
+            // this possibly imposes an additional restriction of return types.
+            using result_type = util::invoke_result_t<function_type,
+                hpx::id_type,
+                util::invoke_result_t<cont_type, hpx::id_type, T>>;
+            return result_type();
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & cont_ & f_;
+            // clang-format on
+        }
+
+        cont_type cont_;     // continuation type
+        function_type f_;    // next continuation
+    };
+}    // namespace hpx::actions
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Create a continuation invoking the action 'cont' with the result of the
+    // preceding action on the locality the preceding action was executed on.
+    // The result of 'cont' is sent to the future returned by async_continue.
+    //
+    //     // f and g are both executed on the locality of 'target', only the
+    //     // result of g is sent back
+    //     hpx::future<int> r = hpx::async_continue(f_action(),
+    //         hpx::make_colocated_continuation(g_action()), target, 42);
+    //
+    template <typename Cont>
+    hpx::actions::colocated_continuation_impl<std::decay_t<Cont>>
+    make_colocated_continuation(Cont&& cont)
+    {
+        return hpx::actions::colocated_continuation_impl<std::decay_t<Cont>>(
+            HPX_FORWARD(Cont, cont));
+    }
+
+    // Create a continuation invoking the action 'cont' on the locality the
+    // preceding action was executed on. The result of 'cont' is passed on to
+    // the continuation 'f', which allows to run whole chains of actions where
+    // their input data lives.
+    template <typename Cont, typename F>
+    hpx::actions::colocated_continuation2_impl<std::decay_t<Cont>,
+        std::decay_t<F>>
+    make_colocated_continuation(Cont&& cont, F&& f)
+    {
+        return hpx::actions::colocated_continuation2_impl<std::decay_t<Cont>,
+            std::decay_t<F>>(HPX_FORWARD(Cont, cont), HPX_FORWARD(F, f));
+    }
+}    // namespace hpx
@@ -0,0 +1,106 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_colocated/colocated_continuation.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int32_t increment(std::int32_t i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(increment)    // defines increment_action
+
+std::int32_t mult2(std::int32_t i)
+{
+    return i * 2;
+}
+HPX_PLAIN_ACTION(mult2)    // defines mult2_action
+
+// returns the id of the locality this action was executed on
+std::uint32_t locality_of(std::int32_t)
+{
+    return hpx::get_locality_id();
+}
+HPX_PLAIN_ACTION(locality_of)    // defines locality_of_action
+
+///////////////////////////////////////////////////////////////////////////////
+void test_colocated_continuation(hpx::id_type const& target)
+{
+    using hpx::make_colocated_continuation;
+    using hpx::make_continuation;
+
+    increment_action inc;
+    mult2_action mult;
+    locality_of_action loc;
+
+    std::uint32_t const target_locality =
+        hpx::naming::get_locality_id_from_id(target);
+
+    // the continuation runs where the preceding action was executed
+    {
+        hpx::future<std::uint32_t> f = hpx::async_continue(
+            inc, make_colocated_continuation(loc), target, 42);
+        HPX_TEST_EQ(f.get(), target_locality);
+
+        // plain continuations run on the calling locality
+        f = hpx::async_continue(inc, make_continuation(loc), target, 42);
+        HPX_TEST_EQ(f.get(), hpx::get_locality_id());
+    }
+
+    // test chaining
+    {
+        hpx::future<std::int32_t> f = hpx::async_continue(
+            inc, make_colocated_continuation(mult), target, 42);
+        HPX_TEST_EQ(f.get(), 86);
+
+        f = hpx::async_continue(inc,
+            make_colocated_continuation(mult, make_continuation()), target,
+            42);
+        HPX_TEST_EQ(f.get(), 86);
+
+        f = hpx::async_continue(inc,
+            make_colocated_continuation(
+                mult, make_colocated_continuation(inc)),
+            target, 42);
+        HPX_TEST_EQ(f.get(), 87);
+
+        hpx::future<std::uint32_t> l = hpx::async_continue(inc,
+            make_colocated_continuation(
+                mult, make_colocated_continuation(loc)),
+            target, 42);
+        HPX_TEST_EQ(l.get(), target_locality);
+    }
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        test_colocated_continuation(id);
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -24,6 +24,7 @@
 #include <hpx/functional/traits/is_action.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/type_support/lazy_enable_if.hpp>
 
@@ -34,6 +35,27 @@
 namespace hpx::detail {
 
     ///////////////////////////////////////////////////////////////////////////
+    // use the address cached by a pinned client, if available
+    template <typename Action, typename Policy, typename Client, typename Stub,
+        typename Data, typename... Ts>
+    HPX_FORCEINLINE hpx::future<
+        typename hpx::traits::extract_action_t<Action>::local_result_type>
+    async_client_impl(Policy&& launch_policy,
+        components::client_base<Client, Stub, Data> const& c, Ts&&... ts)
+    {
+        HPX_ASSERT(c.is_ready());
+        if (naming::address const* addr = c.get_pinned_address())
+        {
+            return hpx::detail::async_pinned_impl<Action>(
+                HPX_FORWARD(Policy, launch_policy), c.get_id(), *addr,
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        return hpx::detail::async_impl<Action>(
+            HPX_FORWARD(Policy, launch_policy), c.get_id(),
+            HPX_FORWARD(Ts, ts)...);
+    }
+
     template <typename Action>
     struct async_action_client_dispatch
     {
@@ -45,9 +67,8 @@ namespace hpx::detail {
         operator()(components::client_base<Client, Stub, Data> const& c,
             Policy const& launch_policy, Ts&&... ts) const
         {
-            HPX_ASSERT(c.is_ready());
-            return hpx::detail::async_impl<Action>(
-                launch_policy, c.get_id(), HPX_FORWARD(Ts, ts)...);
+            return hpx::detail::async_client_impl<Action>(
+                launch_policy, c, HPX_FORWARD(Ts, ts)...);
         }
     };
 
@@ -86,8 +107,8 @@ namespace hpx::detail {
             // invoke directly if client is ready
             if (c.is_ready())
             {
-                return hpx::detail::async_impl<Action>(
-                    HPX_FORWARD(Policy_, launch_policy), c.get_id(),
+                return hpx::detail::async_client_impl<Action>(
+                    HPX_FORWARD(Policy_, launch_policy), c,
                     HPX_FORWARD(Ts, ts)...);
             }
 
@@ -234,8 +255,8 @@ namespace hpx::detail {
 
             constexpr auto priority = traits::action_priority_v<Derived>;
             constexpr auto stacksize = traits::action_stacksize_v<Derived>;
-            return async<Derived>(launch::async_policy(priority, stacksize),
-                c.get_id(), HPX_FORWARD(Ts, vs)...);
+            return async<Derived>(launch::async_policy(priority, stacksize), c,
+                HPX_FORWARD(Ts, vs)...);
         }
 
         template <typename Component, typename Signature, typename Derived,
@@ -281,8 +302,8 @@ namespace hpx::detail {
             static_assert(traits::is_valid_action_v<Derived, component_type>,
                 "The action to invoke is not supported by the target");
 
-            return async<Derived>(HPX_FORWARD(Policy_, launch_policy),
-                c.get_id(), HPX_FORWARD(Ts, ts)...);
+            return async<Derived>(
+                HPX_FORWARD(Policy_, launch_policy), c, HPX_FORWARD(Ts, ts)...);
         }
 
         template <typename Policy_, typename Component, typename Signature,
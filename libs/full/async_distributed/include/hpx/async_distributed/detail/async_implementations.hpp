@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/detail/async_implementations_fwd.hpp>
+#include <hpx/async_distributed/detail/post_implementations_fwd.hpp>
 #include <hpx/async_distributed/packaged_action.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/components_base/traits/action_decorate_function.hpp>
@@ -191,33 +192,6 @@ namespace hpx::detail {
         }
     };
 
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename Action, typename Result>
-    struct sync_local_invoke_cb
-    {
-        template <typename Callback, typename... Ts>
-        static hpx::future<Result> call(hpx::id_type const& id,
-            naming::address&& addr, Callback&& cb, Ts&&... vs)
-        {
-            future<Result> f;
-            {
-                handle_managed_target<Result> hmt(id, f);
-
-                using allocator_type =
-                    hpx::util::thread_local_caching_allocator<char,
-                        hpx::util::internal_allocator<>>;
-                lcos::packaged_action<Action, Result> p(
-                    std::allocator_arg, allocator_type{});
-
-                f = p.get_future();
-                p.post_cb(HPX_MOVE(addr), hmt.get_id(),
-                    HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
-                f.wait();
-            }
-            return f;
-        }
-    };
-
     ///////////////////////////////////////////////////////////////////////////
     template <typename Action, typename... Ts>
     hpx::future<
@@ -474,6 +448,35 @@ namespace hpx::detail {
             HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke the action on a local object whose address is known and which
+    // is pinned by the caller (see client_base::pin), this skips resolving
+    // the address of the target.
+    template <typename Action, typename Launch, typename... Ts>
+    hpx::future<
+        typename hpx::traits::extract_action_t<Action>::local_result_type>
+    async_pinned_impl(Launch&& policy, hpx::id_type const& id,
+        naming::address const& pinned_addr, Ts&&... vs)
+    {
+        using action_type = hpx::traits::extract_action_t<Action>;
+
+        naming::address addr(pinned_addr);
+        if (can_invoke_locally<action_type>())
+        {
+            // route launch policy through component
+            launch const adapted_policy =
+                traits::action_select_direct_execution<Action>::call(
+                    policy, addr.address_);
+
+            std::pair<bool, components::pinned_ptr> r;
+            return async_local_impl<Action>(
+                adapted_policy, id, addr, r, HPX_FORWARD(Ts, vs)...);
+        }
+
+        return async_remote_impl<Action>(HPX_FORWARD(Launch, policy), id,
+            HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// \note This function is part of the invocation policy implemented by
     ///       this class
@@ -502,17 +505,15 @@ namespace hpx::detail {
                 can_invoke_locally<action_type>() && !r.first)
             {
                 // route launch policy through component
-                policy =
+                launch const adapted_policy =
                     traits::action_select_direct_execution<action_type>::call(
                         policy, addr.address_);
 
-                if (policy == launch::sync ||
-                    action_type::direct_execution::value)
-                {
-                    return sync_local_invoke_cb<action_type, result_type>::call(
-                        id, HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                        HPX_FORWARD(Ts, vs)...);
-                }
+                auto result = async_local_impl<Action>(
+                    adapted_policy, id, addr, r, HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -524,17 +525,15 @@ namespace hpx::detail {
                 can_invoke_locally<action_type>())
             {
                 // route launch policy through component
-                policy =
+                launch const adapted_policy =
                     traits::action_select_direct_execution<action_type>::call(
                         policy, addr.address_);
 
-                if (policy == launch::sync ||
-                    action_type::direct_execution::value)
-                {
-                    return sync_local_invoke_cb<action_type, result_type>::call(
-                        id, HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                        HPX_FORWARD(Ts, vs)...);
-                }
+                auto result = async_local_impl<Action>(
+                    adapted_policy, id, addr, r, HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -604,9 +603,12 @@ namespace hpx::detail {
             if (agas::is_local_address_cached(id, addr, r, HPX_MOVE(f)) &&
                 can_invoke_locally<action_type>() && !r.first)
             {
-                return sync_local_invoke_cb<action_type, result_type>::call(id,
-                    HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                    HPX_FORWARD(Ts, vs)...);
+                auto result =
+                    sync_local_invoke<action_type, result_type>::call(
+                        id, HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -617,9 +619,12 @@ namespace hpx::detail {
             if (agas::is_local_address_cached(id, addr) &&
                 can_invoke_locally<action_type>())
             {
-                return sync_local_invoke_cb<action_type, result_type>::call(id,
-                    HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                    HPX_FORWARD(Ts, vs)...);
+                auto result =
+                    sync_local_invoke<action_type, result_type>::call(
+                        id, HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -672,13 +677,11 @@ namespace hpx::detail {
                     traits::action_select_direct_execution<Action>::call(
                         async_policy, addr.address_);
 
-                if (policy == launch::sync ||
-                    action_type::direct_execution::value)
-                {
-                    return sync_local_invoke_cb<action_type, result_type>::call(
-                        id, HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                        HPX_FORWARD(Ts, vs)...);
-                }
+                auto result = async_local_impl<Action>(
+                    policy, id, addr, r, HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -693,13 +696,11 @@ namespace hpx::detail {
                     traits::action_select_direct_execution<Action>::call(
                         async_policy, addr.address_);
 
-                if (policy == launch::sync ||
-                    action_type::direct_execution::value)
-                {
-                    return sync_local_invoke_cb<action_type, result_type>::call(
-                        id, HPX_MOVE(addr), HPX_FORWARD(Callback, cb),
-                        HPX_FORWARD(Ts, vs)...);
-                }
+                auto result = async_local_impl<Action>(
+                    policy, id, addr, r, HPX_FORWARD(Ts, vs)...);
+
+                invoke_callback(HPX_FORWARD(Callback, cb));
+                return result;
             }
 
             // fall through
@@ -86,6 +86,34 @@ void test_remote_async(hpx::id_type const& target)
             hpx::async<call_action>(hpx::launch::all, dec_f, 42);
         HPX_TEST_EQ(f2.get(), 41);
     }
+
+    {
+        decrement_client dec_f =
+            hpx::components::new_<decrement_client>(target);
+
+        // only local objects can be pinned
+        bool const is_local = target == hpx::find_here();
+        HPX_TEST_EQ(dec_f.pin(), is_local);
+        HPX_TEST_EQ(dec_f.get_pinned_address() != nullptr, is_local);
+
+        call_action call;
+        hpx::future<std::int32_t> f1 = hpx::async(call, dec_f, 42);
+        HPX_TEST_EQ(f1.get(), 41);
+
+        hpx::future<std::int32_t> f2 =
+            hpx::async<call_action>(hpx::launch::sync, dec_f, 42);
+        HPX_TEST_EQ(f2.get(), 41);
+
+        hpx::future<std::int32_t> f3 =
+            hpx::async<call_action>(hpx::launch::deferred, dec_f, 42);
+        HPX_TEST_EQ(f3.get(), 41);
+
+        dec_f.unpin();
+        HPX_TEST(dec_f.get_pinned_address() == nullptr);
+
+        hpx::future<std::int32_t> f4 = hpx::async<call_action>(dec_f, 42);
+        HPX_TEST_EQ(f4.get(), 41);
+    }
 }
 
 int hpx_main()
@@ -0,0 +1,169 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file checkpoint_file.hpp
+/// \page hpx::util::save_checkpoint_file, hpx::util::restore_checkpoint_file
+/// \headerfile hpx/checkpoint.hpp
+///
+/// This header defines functions writing checkpoints directly to a file and
+/// reading them back. Every object is serialized into a buffer of its own,
+/// the buffers are written to the file in stripes by several I/O tasks in
+/// parallel. An index stored at the beginning of the file allows to read
+/// all or only some of the objects back, again in parallel.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_client.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    /// Parameters controlling how checkpoint files are written and read
+    struct checkpoint_file_params
+    {
+        /// The largest amount of data transferred by a single write or read
+        /// operation
+        std::size_t stripe_size = 4 * 1024 * 1024;
+
+        /// The number of I/O tasks operating on the file concurrently, zero
+        /// selects the number of threads of the I/O thread pool (see
+        /// hpx.threadpools.io_pool_size)
+        std::size_t num_io_tasks = 0;
+    };
+
+    namespace detail {
+
+        // Write the given buffers to a new file, replacing an existing one
+        HPX_EXPORT hpx::future<void> write_checkpoint_file(std::string path,
+            std::vector<std::vector<char>>&& objects,
+            checkpoint_file_params const& params);
+
+        // Read the objects with the given indices from the file, all objects
+        // are read if no indices are given
+        HPX_EXPORT hpx::future<std::vector<std::vector<char>>>
+        read_checkpoint_file(std::string path,
+            std::vector<std::size_t> indices,
+            checkpoint_file_params const& params);
+
+        template <typename T>
+        std::vector<char> serialize_checkpoint_file_object(T const& t)
+        {
+            static_assert(!hpx::traits::is_client_v<T>,
+                "checkpoint files do not support clients, pass the "
+                "component's server object instead");
+
+            std::vector<char> data;
+            hpx::util::save_checkpoint_data(data, t);
+            return data;
+        }
+    }    // namespace detail
+
+    /// Return the number of objects stored in the given checkpoint file
+    HPX_EXPORT std::size_t checkpoint_file_num_objects(std::string const& path);
+
+    /// Save the given objects to the file \a path. The objects are serialized
+    /// on the calling thread and may be modified once the function returns.
+    /// The returned future becomes ready once all data has been written.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(
+        checkpoint_file_params const& params, std::string path, Ts const&... ts)
+    {
+        std::vector<std::vector<char>> objects;
+        objects.reserve(sizeof...(Ts));
+        (objects.push_back(detail::serialize_checkpoint_file_object(ts)), ...);
+
+        return detail::write_checkpoint_file(
+            HPX_MOVE(path), HPX_MOVE(objects), params);
+    }
+
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(std::string path, Ts const&... ts)
+    {
+        return save_checkpoint_file(
+            checkpoint_file_params{}, HPX_MOVE(path), ts...);
+    }
+
+    template <typename... Ts>
+    void save_checkpoint_file(
+        launch::sync_policy, std::string path, Ts const&... ts)
+    {
+        save_checkpoint_file(HPX_MOVE(path), ts...).get();
+    }
+
+    /// Restore the given objects from the file \a path, in the same order
+    /// they were passed to save_checkpoint_file. The objects must stay alive
+    /// until the returned future has become ready.
+    template <typename... Ts>
+    hpx::future<void> restore_checkpoint_file(
+        checkpoint_file_params const& params, std::string path, Ts&... ts)
+    {
+        return detail::read_checkpoint_file(HPX_MOVE(path), {}, params)
+            .then(hpx::launch::sync,
+                [&ts...](
+                    hpx::future<std::vector<std::vector<char>>>&& f) -> void {
+                    std::vector<std::vector<char>> const objects = f.get();
+                    if (objects.size() != sizeof...(Ts))
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::util::restore_checkpoint_file",
+                            "the checkpoint file holds {} objects, {} were "
+                            "given",
+                            objects.size(), sizeof...(Ts));
+                    }
+
+                    std::size_t i = 0;
+                    (hpx::util::restore_checkpoint_data(objects[i++], ts),
+                        ...);
+                });
+    }
+
+    template <typename... Ts>
+    hpx::future<void> restore_checkpoint_file(std::string path, Ts&... ts)
+    {
+        return restore_checkpoint_file(
+            checkpoint_file_params{}, HPX_MOVE(path), ts...);
+    }
+
+    template <typename... Ts>
+    void restore_checkpoint_file(
+        launch::sync_policy, std::string path, Ts&... ts)
+    {
+        restore_checkpoint_file(HPX_MOVE(path), ts...).get();
+    }
+
+    /// Restore a single object from the file \a path, \a index is the
+    /// position of the object in the call to save_checkpoint_file. Only the
+    /// data of this object is read from the file.
+    template <typename T>
+    hpx::future<void> restore_checkpoint_file_object(
+        std::string path, std::size_t index, T& t)
+    {
+        return detail::read_checkpoint_file(
+            HPX_MOVE(path), {index}, checkpoint_file_params{})
+            .then(hpx::launch::sync,
+                [&t](hpx::future<std::vector<std::vector<char>>>&& f) {
+                    std::vector<std::vector<char>> const objects = f.get();
+                    hpx::util::restore_checkpoint_data(objects[0], t);
+                });
+    }
+
+    template <typename T>
+    void restore_checkpoint_file_object(
+        launch::sync_policy, std::string path, std::size_t index, T& t)
+    {
+        restore_checkpoint_file_object(HPX_MOVE(path), index, t).get();
+    }
+}    // namespace hpx::util
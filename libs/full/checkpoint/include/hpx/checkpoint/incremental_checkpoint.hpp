@@ -0,0 +1,489 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file incremental_checkpoint.hpp
+/// \page hpx::util::incremental_checkpoint
+/// \headerfile hpx/checkpoint.hpp
+///
+/// This header defines an incremental, deduplicating checkpoint store. Each
+/// call to save serializes the given objects, splits the serialized data into
+/// fixed size chunks and stores only those chunks which are not already held
+/// by the store.
+
+#pragma once
+
+#include <hpx/actions_base/traits/is_client.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/unordered_map.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        // 64 bit hash of a chunk of serialized data, processes eight bytes
+        // at a time
+        inline std::uint64_t hash_chunk(
+            char const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t prime = 0x100000001b3;
+            std::uint64_t result = 0xcbf29ce484222325 ^ size;
+
+            std::size_t i = 0;
+            for (/**/; i + sizeof(std::uint64_t) <= size;
+                i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                result = (result ^ word) * prime;
+                result ^= result >> 29;
+            }
+            for (/**/; i != size; ++i)
+            {
+                result = (result ^ static_cast<unsigned char>(data[i])) * prime;
+            }
+            return result;
+        }
+
+        struct incremental_checkpoint_state
+        {
+            struct chunk
+            {
+                std::vector<char> data_;
+                std::size_t refcount_ = 0;
+
+                template <typename Archive>
+                void serialize(Archive& ar, unsigned)
+                {
+                    // clang-format off
+                    ar & data_ & refcount_;
+                    // clang-format on
+                }
+            };
+
+            // the chunks making up the serialized data of one object
+            struct object
+            {
+                std::size_t size_ = 0;
+                std::vector<std::uint64_t> chunks_;
+
+                template <typename Archive>
+                void serialize(Archive& ar, unsigned)
+                {
+                    // clang-format off
+                    ar & size_ & chunks_;
+                    // clang-format on
+                }
+            };
+
+            using version = std::vector<object>;
+
+            explicit incremental_checkpoint_state(std::size_t chunk_size)
+              : chunk_size_(chunk_size)
+            {
+            }
+
+            // Add the serialized data of all objects of a new version to the
+            // store. Returns the number of bytes which had to be stored.
+            std::size_t store(std::size_t version_id,
+                std::vector<std::vector<char>> const& objects)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+
+                // unchanged chunks are found by comparing against the chunk
+                // at the same position of the previous version first
+                version const* previous = nullptr;
+                if (!versions_.empty())
+                {
+                    previous = &std::prev(versions_.end())->second;
+                }
+
+                std::size_t written = 0;
+                version v(objects.size());
+                for (std::size_t i = 0; i != objects.size(); ++i)
+                {
+                    std::vector<char> const& data = objects[i];
+                    object& obj = v[i];
+                    obj.size_ = data.size();
+                    obj.chunks_.reserve(
+                        (data.size() + chunk_size_ - 1) / chunk_size_);
+
+                    for (std::size_t offset = 0; offset < data.size();
+                        offset += chunk_size_)
+                    {
+                        std::size_t const size =
+                            (std::min)(chunk_size_, data.size() - offset);
+                        std::uint64_t const* hint = nullptr;
+                        if (previous != nullptr && i < previous->size())
+                        {
+                            auto const& chunks = (*previous)[i].chunks_;
+                            std::size_t const pos = offset / chunk_size_;
+                            if (pos < chunks.size())
+                                hint = &chunks[pos];
+                        }
+
+                        obj.chunks_.push_back(
+                            add_chunk(data.data() + offset, size, hint,
+                                written));
+                    }
+                }
+
+                versions_.emplace_back(version_id, HPX_MOVE(v));
+                stored_bytes_ += written;
+                return written;
+            }
+
+            std::uint64_t add_chunk(char const* data, std::size_t size,
+                std::uint64_t const* hint, std::size_t& written)
+            {
+                if (hint != nullptr && matches(*hint, data, size))
+                {
+                    ++chunks_[*hint].refcount_;
+                    return *hint;
+                }
+
+                // deduplicate against all stored chunks, hash collisions are
+                // resolved by probing the subsequent keys
+                std::uint64_t key = hash_chunk(data, size);
+                for (auto it = chunks_.find(key); it != chunks_.end();
+                    it = chunks_.find(++key))
+                {
+                    if (matches(it->second, data, size))
+                    {
+                        ++it->second.refcount_;
+                        return key;
+                    }
+                }
+
+                chunk& c = chunks_[key];
+                c.data_.assign(data, data + size);
+                c.refcount_ = 1;
+                written += size;
+                return key;
+            }
+
+            bool matches(std::uint64_t key, char const* data,
+                std::size_t size) const
+            {
+                auto const it = chunks_.find(key);
+                return it != chunks_.end() && matches(it->second, data, size);
+            }
+
+            static bool matches(
+                chunk const& c, char const* data, std::size_t size) noexcept
+            {
+                return c.data_.size() == size &&
+                    std::memcmp(c.data_.data(), data, size) == 0;
+            }
+
+            // reassemble the serialized data of all objects of a version
+            std::vector<std::vector<char>> load(std::size_t version_id) const
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+
+                version const& v = find_version(version_id);
+
+                std::vector<std::vector<char>> result(v.size());
+                for (std::size_t i = 0; i != v.size(); ++i)
+                {
+                    result[i].reserve(v[i].size_);
+                    for (std::uint64_t key : v[i].chunks_)
+                    {
+                        auto const it = chunks_.find(key);
+                        HPX_ASSERT(it != chunks_.end());
+                        result[i].insert(result[i].end(),
+                            it->second.data_.begin(), it->second.data_.end());
+                    }
+                    HPX_ASSERT(result[i].size() == v[i].size_);
+                }
+                return result;
+            }
+
+            version const& find_version(std::size_t version_id) const
+            {
+                auto const it = std::find_if(versions_.begin(),
+                    versions_.end(),
+                    [&](auto const& p) { return p.first == version_id; });
+                if (it == versions_.end())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "incremental_checkpoint::restore",
+                        "checkpoint version {} is not available", version_id);
+                }
+                return it->second;
+            }
+
+            void discard(std::size_t version_id)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+
+                auto const it = std::find_if(versions_.begin(),
+                    versions_.end(),
+                    [&](auto const& p) { return p.first == version_id; });
+                if (it == versions_.end())
+                    return;
+
+                // release all chunks which are no longer referenced
+                for (object const& obj : it->second)
+                {
+                    for (std::uint64_t key : obj.chunks_)
+                    {
+                        auto const c = chunks_.find(key);
+                        HPX_ASSERT(c != chunks_.end());
+                        if (--c->second.refcount_ == 0)
+                        {
+                            stored_bytes_ -= c->second.data_.size();
+                            chunks_.erase(c);
+                        }
+                    }
+                }
+                versions_.erase(it);
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & chunk_size_ & stored_bytes_ & chunks_ & versions_;
+                // clang-format on
+            }
+
+            mutable hpx::spinlock mtx_;
+            std::size_t chunk_size_;
+            std::size_t stored_bytes_ = 0;
+            std::unordered_map<std::uint64_t, chunk> chunks_;
+            std::vector<std::pair<std::size_t, version>> versions_;
+        };
+
+        template <typename T>
+        std::vector<char> serialize_checkpoint_object(T const& t)
+        {
+            static_assert(!hpx::traits::is_client_v<T>,
+                "incremental checkpoints do not support clients, pass the "
+                "component's server object instead");
+
+            std::vector<char> data;
+            hpx::util::save_checkpoint_data(data, t);
+            return data;
+        }
+    }    // namespace detail
+
+    /// An incremental_checkpoint holds a series of checkpoints (versions) of
+    /// a set of objects. The serialized data of every object is split into
+    /// chunks of a fixed size, each chunk is kept only once regardless of how
+    /// many versions or objects refer to it. Saving a new version therefore
+    /// only stores the chunks which have changed since any earlier version.
+    ///
+    /// The objects are serialized on the calling thread, detecting the
+    /// changed chunks and storing them happens in the background. The
+    /// objects may be modified as soon as save returns.
+    ///
+    /// \note Unchanged parts of an object are only detected if they keep
+    ///       their offset in the serialized data, i.e. if the preceding
+    ///       parts of the object did not change their size.
+    class incremental_checkpoint
+    {
+    public:
+        using version_type = std::size_t;
+
+        /// Create an empty store splitting the serialized data into chunks
+        /// of \a chunk_size bytes
+        explicit incremental_checkpoint(std::size_t chunk_size = 4096)
+          : state_(std::make_shared<detail::incremental_checkpoint_state>(
+                chunk_size))
+          , pending_(hpx::make_ready_future())
+        {
+            if (chunk_size == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "incremental_checkpoint::incremental_checkpoint",
+                    "the chunk size must be non-zero");
+            }
+        }
+
+        incremental_checkpoint(incremental_checkpoint&&) noexcept = default;
+        incremental_checkpoint& operator=(
+            incremental_checkpoint&&) noexcept = default;
+
+        ~incremental_checkpoint()
+        {
+            if (pending_.valid())
+                pending_.wait();
+        }
+
+        /// Save a new version of the given objects. The returned future
+        /// gets ready once the version has been stored and holds the number
+        /// of bytes which had to be added to the store.
+        template <typename... Ts>
+        hpx::future<std::size_t> save(Ts const&... ts)
+        {
+            std::vector<std::vector<char>> objects;
+            objects.reserve(sizeof...(Ts));
+            (objects.push_back(detail::serialize_checkpoint_object(ts)), ...);
+
+            version_type const version = next_version_++;
+            latest_version_ = version;
+
+            // versions are stored in order
+            hpx::future<std::size_t> f = pending_.then(hpx::launch::async,
+                [state = state_, version, objects = HPX_MOVE(objects)](
+                    hpx::shared_future<void> const&) {
+                    return state->store(version, objects);
+                });
+
+            hpx::shared_future<std::size_t> result = f.share();
+            pending_ = result.then(hpx::launch::sync,
+                [](hpx::shared_future<std::size_t> const&) {});
+            return result.then(hpx::launch::sync,
+                [](hpx::shared_future<std::size_t> const& r) {
+                    return r.get();
+                });
+        }
+
+        template <typename... Ts>
+        std::size_t save(launch::sync_policy, Ts const&... ts)
+        {
+            return save(ts...).get();
+        }
+
+        /// Return the number of the version stored by the last call to save
+        [[nodiscard]] version_type latest_version() const noexcept
+        {
+            return latest_version_;
+        }
+
+        /// Restore the given objects from the given version, in the same
+        /// order they were passed to save
+        template <typename... Ts>
+        void restore(version_type version, Ts&... ts) const
+        {
+            wait();
+
+            std::vector<std::vector<char>> const objects =
+                state_->load(version);
+            if (objects.size() != sizeof...(Ts))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "incremental_checkpoint::restore",
+                    "checkpoint version {} holds {} objects, {} were given",
+                    version, objects.size(), sizeof...(Ts));
+            }
+
+            std::size_t i = 0;
+            (hpx::util::restore_checkpoint_data(objects[i++], ts), ...);
+        }
+
+        /// Restore the given objects from the latest version
+        template <typename... Ts>
+        void restore_latest(Ts&... ts) const
+        {
+            restore(latest_version_, ts...);
+        }
+
+        /// Drop the given version and all chunks only it refers to
+        void discard(version_type version)
+        {
+            wait();
+            state_->discard(version);
+        }
+
+        /// Wait for all pending saves to complete
+        void wait() const
+        {
+            pending_.wait();
+        }
+
+        /// Return the overall number of bytes held by the store
+        [[nodiscard]] std::size_t stored_bytes() const
+        {
+            wait();
+            std::lock_guard<hpx::spinlock> l(state_->mtx_);
+            return state_->stored_bytes_;
+        }
+
+        /// Return the number of versions held by the store
+        [[nodiscard]] std::size_t num_versions() const
+        {
+            wait();
+            std::lock_guard<hpx::spinlock> l(state_->mtx_);
+            return state_->versions_.size();
+        }
+
+    private:
+        friend std::ostream& operator<<(
+            std::ostream& ost, incremental_checkpoint const& ckp);
+        friend std::istream& operator>>(
+            std::istream& ist, incremental_checkpoint& ckp);
+
+        std::shared_ptr<detail::incremental_checkpoint_state> state_;
+        hpx::shared_future<void> pending_;
+        version_type next_version_ = 0;
+        version_type latest_version_ = 0;
+    };
+
+    /// Write all versions held by the store to the given stream
+    inline std::ostream& operator<<(
+        std::ostream& ost, incremental_checkpoint const& ckp)
+    {
+        ckp.wait();
+
+        std::vector<char> data;
+        {
+            std::lock_guard<hpx::spinlock> l(ckp.state_->mtx_);
+            hpx::serialization::output_archive ar(data);
+            ar << *ckp.state_ << ckp.next_version_ << ckp.latest_version_;
+        }
+
+        std::int64_t const size = static_cast<std::int64_t>(data.size());
+        ost.write(reinterpret_cast<char const*>(&size), sizeof(std::int64_t));
+        ost.write(data.data(), static_cast<std::streamsize>(data.size()));
+        return ost;
+    }
+
+    /// Replace the contents of the store with the versions read from the
+    /// given stream
+    inline std::istream& operator>>(
+        std::istream& ist, incremental_checkpoint& ckp)
+    {
+        ckp.wait();
+
+        std::int64_t length = 0;
+        ist.read(reinterpret_cast<char*>(&length), sizeof(std::int64_t));
+
+        std::vector<char> data(static_cast<std::size_t>(length));
+        ist.read(data.data(), static_cast<std::streamsize>(length));
+
+        {
+            std::lock_guard<hpx::spinlock> l(ckp.state_->mtx_);
+            hpx::serialization::input_archive ar(data, data.size());
+            ar >> *ckp.state_ >> ckp.next_version_ >> ckp.latest_version_;
+        }
+        return ist;
+    }
+}    // namespace hpx::util
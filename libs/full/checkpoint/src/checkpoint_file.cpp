@@ -0,0 +1,452 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/io_service/io_service_pool.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::util::detail {
+
+    namespace {
+
+        // The file starts with a header followed by the index holding the
+        // offset and the size of every object. The data of each object is
+        // aligned to a multiple of the alignment below.
+        constexpr std::uint64_t checkpoint_file_magic = 0x3154504b43585048;
+        constexpr std::uint64_t checkpoint_file_alignment = 4096;
+
+        struct file_header
+        {
+            std::uint64_t magic_;
+            std::uint64_t num_objects_;
+        };
+
+        struct index_entry
+        {
+            std::uint64_t offset_;
+            std::uint64_t size_;
+        };
+
+        constexpr std::uint64_t align(std::uint64_t offset) noexcept
+        {
+            return (offset + checkpoint_file_alignment - 1) &
+                ~(checkpoint_file_alignment - 1);
+        }
+
+        [[noreturn]] void throw_file_error(
+            char const* function, std::string const& path)
+        {
+#if defined(HPX_WINDOWS)
+            auto const code = static_cast<unsigned long>(::GetLastError());
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error, function,
+                "could not access checkpoint file '{}' (error {})", path,
+                code);
+#else
+            std::string const errstr = std::strerror(errno);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error, function,
+                "could not access checkpoint file '{}': {}", path, errstr);
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A file supporting concurrent positioned reads and writes
+        class checkpoint_file
+        {
+        public:
+            checkpoint_file(std::string path, bool write)
+              : path_(HPX_MOVE(path))
+            {
+#if defined(HPX_WINDOWS)
+                file_ = ::CreateFileA(path_.c_str(),
+                    write ? GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ,
+                    nullptr, write ? CREATE_ALWAYS : OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file_ == INVALID_HANDLE_VALUE)
+                {
+                    throw_file_error("checkpoint_file::checkpoint_file", path_);
+                }
+#else
+                int const flags =
+                    write ? O_WRONLY | O_CREAT | O_TRUNC : O_RDONLY;
+                fd_ = ::open(path_.c_str(), flags, S_IRUSR | S_IWUSR);
+                if (fd_ == -1)
+                {
+                    throw_file_error("checkpoint_file::checkpoint_file", path_);
+                }
+#endif
+            }
+
+            checkpoint_file(checkpoint_file const&) = delete;
+            checkpoint_file& operator=(checkpoint_file const&) = delete;
+
+            ~checkpoint_file()
+            {
+#if defined(HPX_WINDOWS)
+                ::CloseHandle(file_);
+#else
+                ::close(fd_);
+#endif
+            }
+
+            void write(
+                char const* data, std::size_t size, std::uint64_t offset) const
+            {
+                while (size != 0)
+                {
+#if defined(HPX_WINDOWS)
+                    OVERLAPPED overlapped = {};
+                    overlapped.Offset = static_cast<DWORD>(offset);
+                    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+                    DWORD bytes = 0;
+                    DWORD const count = static_cast<DWORD>(
+                        (std::min)(size, std::size_t(0x40000000)));
+                    if (!::WriteFile(file_, data, count, &bytes, &overlapped))
+                    {
+                        throw_file_error("checkpoint_file::write", path_);
+                    }
+#else
+                    ::ssize_t const bytes = ::pwrite(
+                        fd_, data, size, static_cast<::off_t>(offset));
+                    if (bytes == -1)
+                    {
+                        if (errno == EINTR)
+                            continue;
+                        throw_file_error("checkpoint_file::write", path_);
+                    }
+#endif
+                    data += bytes;
+                    size -= static_cast<std::size_t>(bytes);
+                    offset += static_cast<std::uint64_t>(bytes);
+                }
+            }
+
+            void read(char* data, std::size_t size, std::uint64_t offset) const
+            {
+                while (size != 0)
+                {
+#if defined(HPX_WINDOWS)
+                    OVERLAPPED overlapped = {};
+                    overlapped.Offset = static_cast<DWORD>(offset);
+                    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+                    DWORD bytes = 0;
+                    DWORD const count = static_cast<DWORD>(
+                        (std::min)(size, std::size_t(0x40000000)));
+                    if (!::ReadFile(file_, data, count, &bytes, &overlapped))
+                    {
+                        throw_file_error("checkpoint_file::read", path_);
+                    }
+#else
+                    ::ssize_t const bytes =
+                        ::pread(fd_, data, size, static_cast<::off_t>(offset));
+                    if (bytes == -1)
+                    {
+                        if (errno == EINTR)
+                            continue;
+                        throw_file_error("checkpoint_file::read", path_);
+                    }
+#endif
+                    if (bytes == 0)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                            "checkpoint_file::read",
+                            "the checkpoint file '{}' is truncated", path_);
+                    }
+
+                    data += bytes;
+                    size -= static_cast<std::size_t>(bytes);
+                    offset += static_cast<std::uint64_t>(bytes);
+                }
+            }
+
+            void flush() const
+            {
+#if defined(HPX_WINDOWS)
+                if (!::FlushFileBuffers(file_))
+#else
+                if (::fsync(fd_) != 0)
+#endif
+                {
+                    throw_file_error("checkpoint_file::flush", path_);
+                }
+            }
+
+            std::vector<index_entry> read_index() const
+            {
+                file_header header = {};
+                read(reinterpret_cast<char*>(&header), sizeof(header), 0);
+                if (header.magic_ != checkpoint_file_magic)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                        "checkpoint_file::read_index",
+                        "'{}' is not a checkpoint file", path_);
+                }
+
+                std::vector<index_entry> index(header.num_objects_);
+                if (!index.empty())
+                {
+                    read(reinterpret_cast<char*>(index.data()),
+                        index.size() * sizeof(index_entry), sizeof(header));
+                }
+                return index;
+            }
+
+        private:
+            std::string path_;
+#if defined(HPX_WINDOWS)
+            HANDLE file_ = INVALID_HANDLE_VALUE;
+#else
+            int fd_ = -1;
+#endif
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // One contiguous part of an object transferred by a single operation
+        struct stripe
+        {
+            char* data_;
+            std::size_t size_;
+            std::uint64_t offset_;
+        };
+
+        std::vector<stripe> make_stripes(
+            std::vector<std::vector<char>>& objects,
+            std::vector<index_entry> const& index, std::size_t stripe_size)
+        {
+            std::vector<stripe> stripes;
+            for (std::size_t i = 0; i != objects.size(); ++i)
+            {
+                std::vector<char>& data = objects[i];
+                for (std::size_t offset = 0; offset < data.size();
+                    offset += stripe_size)
+                {
+                    stripes.push_back(stripe{data.data() + offset,
+                        (std::min)(stripe_size, data.size() - offset),
+                        index[i].offset_ + offset});
+                }
+            }
+            return stripes;
+        }
+
+        std::size_t num_io_tasks(
+            checkpoint_file_params const& params, std::size_t num_stripes)
+        {
+            std::size_t tasks = params.num_io_tasks;
+            if (tasks == 0)
+            {
+                hpx::util::io_service_pool* pool =
+                    hpx::get_thread_pool("io-pool");
+                tasks = pool != nullptr ? pool->size() : 1;
+            }
+            return (std::max)(
+                std::size_t(1), (std::min)(tasks, num_stripes));
+        }
+
+        // Distribute the stripes round robin over the I/O tasks, stripes
+        // are interleaved such that the tasks operate on neighboring parts
+        // of the file at the same time.
+        template <typename F>
+        hpx::future<void> run_io_tasks(std::shared_ptr<checkpoint_file> file,
+            std::shared_ptr<std::vector<stripe>> stripes, std::size_t tasks,
+            F f)
+        {
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(tasks);
+            for (std::size_t task = 0; task != tasks; ++task)
+            {
+                futures.push_back(
+                    hpx::run_as_os_thread([file, stripes, tasks, task, f]() {
+                        for (std::size_t i = task; i < stripes->size();
+                            i += tasks)
+                        {
+                            f(*file, (*stripes)[i]);
+                        }
+                    }));
+            }
+
+            return hpx::when_all(futures).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<void>>>&& f) {
+                    // propagate the first error, if any
+                    for (hpx::future<void>& io : f.get())
+                    {
+                        io.get();
+                    }
+                });
+        }
+
+        void check_stripe_size(checkpoint_file_params const& params)
+        {
+            if (params.stripe_size == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::util::checkpoint_file",
+                    "the stripe size must be non-zero");
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<void> write_checkpoint_file(std::string path,
+        std::vector<std::vector<char>>&& objects,
+        checkpoint_file_params const& params)
+    {
+        check_stripe_size(params);
+
+        // the header and the index make up the first buffer written
+        std::size_t const num_objects = objects.size();
+        std::uint64_t const header_size =
+            sizeof(file_header) + num_objects * sizeof(index_entry);
+
+        std::vector<index_entry> index(num_objects);
+        std::uint64_t offset = align(header_size);
+        for (std::size_t i = 0; i != num_objects; ++i)
+        {
+            index[i] = index_entry{offset, objects[i].size()};
+            offset = align(offset + objects[i].size());
+        }
+
+        file_header const header = {checkpoint_file_magic, num_objects};
+        std::vector<char> head(header_size);
+        std::memcpy(head.data(), &header, sizeof(header));
+        if (num_objects != 0)
+        {
+            std::memcpy(head.data() + sizeof(header), index.data(),
+                num_objects * sizeof(index_entry));
+        }
+
+        objects.insert(objects.begin(), HPX_MOVE(head));
+        index.insert(index.begin(), index_entry{0, header_size});
+
+        auto buffers = std::make_shared<std::vector<std::vector<char>>>(
+            HPX_MOVE(objects));
+        auto stripes = std::make_shared<std::vector<stripe>>(
+            make_stripes(*buffers, index, params.stripe_size));
+        std::size_t const tasks = num_io_tasks(params, stripes->size());
+
+        return hpx::run_as_os_thread([path = HPX_MOVE(path)]() {
+            return std::make_shared<checkpoint_file>(path, true);
+        })
+            .then(hpx::launch::sync,
+                [buffers, stripes, tasks](
+                    hpx::future<std::shared_ptr<checkpoint_file>>&& f)
+                    -> hpx::future<void> {
+                    std::shared_ptr<checkpoint_file> file = f.get();
+                    return run_io_tasks(file, stripes, tasks,
+                        [](checkpoint_file const& file, stripe const& s) {
+                            file.write(s.data_, s.size_, s.offset_);
+                        })
+                        .then(hpx::launch::sync,
+                            [file, buffers](
+                                hpx::future<void>&& f) -> hpx::future<void> {
+                                f.get();
+                                return hpx::run_as_os_thread(
+                                    [file]() { file->flush(); });
+                            });
+                });
+    }
+
+    hpx::future<std::vector<std::vector<char>>> read_checkpoint_file(
+        std::string path, std::vector<std::size_t> indices,
+        checkpoint_file_params const& params)
+    {
+        check_stripe_size(params);
+
+        using index_type = std::pair<std::shared_ptr<checkpoint_file>,
+            std::vector<index_entry>>;
+
+        return hpx::run_as_os_thread([path = HPX_MOVE(path)]() {
+            auto file = std::make_shared<checkpoint_file>(path, false);
+            std::vector<index_entry> index = file->read_index();
+            return index_type(HPX_MOVE(file), HPX_MOVE(index));
+        })
+            .then(hpx::launch::sync,
+                [indices = HPX_MOVE(indices), params](
+                    hpx::future<index_type>&& f) mutable
+                -> hpx::future<std::vector<std::vector<char>>> {
+                    auto [file, index] = f.get();
+
+                    if (indices.empty())
+                    {
+                        indices.resize(index.size());
+                        for (std::size_t i = 0; i != indices.size(); ++i)
+                        {
+                            indices[i] = i;
+                        }
+                    }
+
+                    // only the selected objects are read
+                    std::vector<index_entry> selected;
+                    selected.reserve(indices.size());
+                    for (std::size_t i : indices)
+                    {
+                        if (i >= index.size())
+                        {
+                            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                                "hpx::util::restore_checkpoint_file",
+                                "the checkpoint file holds {} objects, object "
+                                "{} was requested",
+                                index.size(), i);
+                        }
+                        selected.push_back(index[i]);
+                    }
+
+                    auto buffers =
+                        std::make_shared<std::vector<std::vector<char>>>(
+                            selected.size());
+                    for (std::size_t i = 0; i != selected.size(); ++i)
+                    {
+                        (*buffers)[i].resize(selected[i].size_);
+                    }
+
+                    auto stripes = std::make_shared<std::vector<stripe>>(
+                        make_stripes(*buffers, selected, params.stripe_size));
+                    std::size_t const tasks =
+                        num_io_tasks(params, stripes->size());
+
+                    return run_io_tasks(file, stripes, tasks,
+                        [](checkpoint_file const& file, stripe const& s) {
+                            file.read(s.data_, s.size_, s.offset_);
+                        })
+                        .then(hpx::launch::sync,
+                            [buffers](hpx::future<void>&& f) {
+                                f.get();
+                                return HPX_MOVE(*buffers);
+                            });
+                });
+    }
+}    // namespace hpx::util::detail
+
+namespace hpx::util {
+
+    std::size_t checkpoint_file_num_objects(std::string const& path)
+    {
+        return detail::checkpoint_file(path, false).read_index().size();
+    }
+}    // namespace hpx::util
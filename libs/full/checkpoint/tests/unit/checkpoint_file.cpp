@@ -0,0 +1,109 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests writing checkpoints to and reading them from files.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+using hpx::util::checkpoint_file_params;
+using hpx::util::restore_checkpoint_file;
+using hpx::util::restore_checkpoint_file_object;
+using hpx::util::save_checkpoint_file;
+
+int main()
+{
+    std::string const path =
+        (hpx::filesystem::temp_directory_path() / "hpx_checkpoint_file.bin")
+            .string();
+
+    std::vector<double> values(1000000);
+    std::iota(values.begin(), values.end(), 0.0);
+    std::string const name = "checkpoint_file";
+    std::map<int, std::string> const map = {{1, "one"}, {2, "two"}};
+    std::vector<int> const empty;
+
+    // small stripes to have several I/O tasks operate on each object
+    checkpoint_file_params params;
+    params.stripe_size = 64 * 1024;
+    params.num_io_tasks = 4;
+
+    hpx::future<void> f =
+        save_checkpoint_file(params, path, values, name, empty, map);
+    f.get();
+    HPX_TEST_EQ(hpx::util::checkpoint_file_num_objects(path), std::size_t(4));
+
+    {
+        std::vector<double> restored_values;
+        std::string restored_name;
+        std::vector<int> restored_empty = {1};
+        std::map<int, std::string> restored_map;
+
+        restore_checkpoint_file(params, path, restored_values, restored_name,
+            restored_empty, restored_map)
+            .get();
+
+        HPX_TEST(restored_values == values);
+        HPX_TEST_EQ(restored_name, name);
+        HPX_TEST(restored_empty.empty());
+        HPX_TEST(restored_map == map);
+    }
+
+    // objects can be loaded selectively
+    {
+        std::string restored_name;
+        restore_checkpoint_file_object(
+            hpx::launch::sync, path, 1, restored_name);
+        HPX_TEST_EQ(restored_name, name);
+
+        std::map<int, std::string> restored_map;
+        restore_checkpoint_file_object(path, 3, restored_map).get();
+        HPX_TEST(restored_map == map);
+    }
+
+    // overwriting an existing file
+    save_checkpoint_file(hpx::launch::sync, path, name);
+    HPX_TEST_EQ(hpx::util::checkpoint_file_num_objects(path), std::size_t(1));
+    {
+        std::string restored_name;
+        restore_checkpoint_file(hpx::launch::sync, path, restored_name);
+        HPX_TEST_EQ(restored_name, name);
+    }
+
+    // errors are reported through the returned future
+    {
+        std::string restored_name;
+        bool caught_exception = false;
+        try
+        {
+            restore_checkpoint_file_object(path, 1, restored_name).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    hpx::filesystem::remove(path);
+
+    return hpx::util::report_errors();
+}
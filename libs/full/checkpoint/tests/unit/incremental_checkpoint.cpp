@@ -0,0 +1,94 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of incremental_checkpoint.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::util::incremental_checkpoint;
+
+int main()
+{
+    std::vector<double> values(100000);
+    std::iota(values.begin(), values.end(), 0.0);
+    std::string name = "incremental";
+
+    incremental_checkpoint store(1024);
+
+    // the first version has to store everything
+    std::size_t const full = store.save(hpx::launch::sync, values, name);
+    HPX_TEST(full >= values.size() * sizeof(double));
+    auto const first = store.latest_version();
+
+    // only the modified chunk is stored, computation continues while the
+    // version is stored
+    values[500] = -1.0;
+    hpx::future<std::size_t> f = store.save(values, name);
+    values[600] = -2.0;
+    std::size_t const incremental = f.get();
+    HPX_TEST(incremental != 0);
+    HPX_TEST(incremental <= 1024);
+    auto const second = store.latest_version();
+
+    // unmodified objects don't take any space
+    HPX_TEST_EQ(store.save(hpx::launch::sync, values, name), 1024u);
+    HPX_TEST_EQ(store.save(hpx::launch::sync, values, name), 0u);
+    HPX_TEST_EQ(store.num_versions(), std::size_t(4));
+
+    std::vector<double> restored;
+    std::string restored_name;
+    store.restore(first, restored, restored_name);
+    HPX_TEST_EQ(restored.size(), values.size());
+    HPX_TEST_EQ(restored[500], 500.0);
+    HPX_TEST_EQ(restored_name, name);
+
+    store.restore(second, restored, restored_name);
+    HPX_TEST_EQ(restored[500], -1.0);
+    HPX_TEST_EQ(restored[600], 600.0);
+
+    // discarding a version keeps the chunks used by other versions
+    std::size_t const stored = store.stored_bytes();
+    store.discard(second);
+    HPX_TEST_EQ(store.num_versions(), std::size_t(3));
+    HPX_TEST_EQ(store.stored_bytes(), stored);
+
+    store.restore(first, restored, restored_name);
+    HPX_TEST_EQ(restored[500], 500.0);
+
+    // the original contents of the two modified chunks are released
+    store.discard(first);
+    HPX_TEST_EQ(store.stored_bytes(), stored - 2048);
+
+    store.restore_latest(restored, restored_name);
+    HPX_TEST(restored == values);
+
+    // round trip through a stream
+    std::stringstream stream;
+    stream << store;
+
+    incremental_checkpoint copy;
+    stream >> copy;
+    HPX_TEST_EQ(copy.num_versions(), store.num_versions());
+    HPX_TEST_EQ(copy.stored_bytes(), store.stored_bytes());
+    HPX_TEST_EQ(copy.latest_version(), store.latest_version());
+
+    restored.clear();
+    copy.restore_latest(restored, restored_name);
+    HPX_TEST(restored == values);
+    HPX_TEST_EQ(restored_name, name);
+
+    return hpx::util::report_errors();
+}
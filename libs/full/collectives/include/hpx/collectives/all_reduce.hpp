@@ -110,6 +110,45 @@ namespace hpx { namespace collectives {
     all_reduce(communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a vector of values element-wise from different call sites
+    ///
+    /// This function combines the vectors supplied by all call sites
+    /// operating on the given channel communicator using point-to-point
+    /// messages only. Depending on the size of the data and on the number
+    /// of participating sites it uses recursive doubling (small messages),
+    /// Rabenseifner's algorithm (large messages, power of two number of
+    /// sites), or a ring based reduce-scatter followed by a ring based
+    /// all-gather (large messages).
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The vector to combine with the vectors of all
+    ///                     participating sites. All sites have to supply
+    ///                     vectors of the same size.
+    /// \param  op          Associative and commutative reduction operation
+    ///                     to apply to the corresponding elements of the
+    ///                     vectors supplied from all participating sites
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. It must be a positive number
+    ///                     greater than zero and has to be different for each
+    ///                     operation performed on the communicator.
+    /// \param  algorithm   The algorithm to use. This value is optional and
+    ///                     defaults to selecting the algorithm based on the
+    ///                     size of the data (see
+    ///                     HPX_COLLECTIVES_ALL_REDUCE_SMALL_MESSAGE_SIZE) and
+    ///                     the number of participating sites.
+    ///
+    /// \returns    This function returns a future holding the combined
+    ///             vector. It will become ready once the all_reduce operation
+    ///             has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>>
+    all_reduce(channel_communicator comm,
+        std::vector<T> local_result, F&& op, generation_arg generation,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -123,7 +162,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/all_reduce_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -132,6 +173,7 @@ namespace hpx { namespace collectives {
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -248,6 +290,32 @@ namespace hpx::collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site);
     }
+
+    // all_reduce vectors using point-to-point messages
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(channel_communicator comm,
+        std::vector<T> local_result, F&& op, generation_arg generation,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic)
+    {
+        if (generation == 0 || generation == static_cast<std::size_t>(-1))
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_reduce",
+                    "the generation number must be given and shouldn't be "
+                    "zero"));
+        }
+
+        // the algorithms exchange messages synchronously, run them on a
+        // separate thread
+        return hpx::async([comm = HPX_MOVE(comm),
+                              data = HPX_MOVE(local_result),
+                              op = HPX_FORWARD(F, op), generation,
+                              algorithm]() mutable -> std::vector<T> {
+            detail::all_reduce_vector(comm, data, op, generation, algorithm);
+            return HPX_MOVE(data);
+        });
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
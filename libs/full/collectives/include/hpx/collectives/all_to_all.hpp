@@ -105,6 +105,68 @@ namespace hpx { namespace collectives {
     all_to_all(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllToAll a set of values from different call sites
+    ///
+    /// This function sends one value to each of the call sites operating on
+    /// the given channel communicator and receives one value from each of
+    /// them. All sites exchange their data directly with their peers, either
+    /// using a pairwise exchange or the Bruck algorithm.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The values to transmit to the participating
+    ///                     sites, the value at index i is sent to site i.
+    ///                     It has to hold one value per participating site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_to_all operation performed on the
+    ///                     given communicator. It must be a positive number
+    ///                     greater than zero and has to be different for each
+    ///                     operation performed on the communicator.
+    /// \param  algorithm   The algorithm to use. This value is optional and
+    ///                     defaults to using the Bruck algorithm for small
+    ///                     values (see
+    ///                     HPX_COLLECTIVES_ALL_TO_ALL_SMALL_MESSAGE_SIZE) and
+    ///                     the pairwise exchange otherwise.
+    ///
+    /// \returns    This function returns a future holding a vector with the
+    ///             values sent to this site, the value at index i was sent
+    ///             by site i. It will become ready once the all_to_all
+    ///             operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<T>>
+    all_to_all(channel_communicator comm,
+        std::vector<T> local_result, generation_arg generation,
+        all_to_all_algorithm algorithm = all_to_all_algorithm::automatic);
+
+    /// AllToAll sets of values of different size from different call sites
+    ///
+    /// This function sends a (possibly differently sized) set of values to
+    /// each of the call sites operating on the given channel communicator
+    /// and receives one set of values from each of them. All sites exchange
+    /// their data directly with their peers using a pairwise exchange.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The values to transmit to the participating
+    ///                     sites, the values at index i are sent to site i.
+    ///                     It has to hold one vector per participating site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_to_allv operation performed on
+    ///                     the given communicator. It must be a positive number
+    ///                     greater than zero and has to be different for each
+    ///                     operation performed on the communicator.
+    ///
+    /// \returns    This function returns a future holding the values sent to
+    ///             this site, the values at index i were sent by site i. It
+    ///             will become ready once the all_to_allv operation has been
+    ///             completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::vector<T>>>
+    all_to_allv(channel_communicator comm,
+        std::vector<std::vector<T>> local_result, generation_arg generation);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -118,7 +180,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/sync.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/all_to_all_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -241,6 +305,64 @@ namespace hpx::collectives {
                               generation, root_site),
             HPX_MOVE(local_result), this_site);
     }
+
+    namespace detail {
+
+        template <typename T>
+        hpx::future<std::vector<T>> all_to_all_channel(
+            hpx::collectives::channel_communicator&& comm,
+            std::vector<T>&& local_result,
+            generation_arg generation, all_to_all_algorithm algorithm,
+            char const* name)
+        {
+            if (generation == 0 || generation == static_cast<std::size_t>(-1))
+            {
+                return hpx::make_exceptional_future<std::vector<T>>(
+                    HPX_GET_EXCEPTION(hpx::error::bad_parameter, name,
+                        "the generation number must be given and shouldn't "
+                        "be zero"));
+            }
+            if (local_result.size() != comm.get_info().first)
+            {
+                return hpx::make_exceptional_future<std::vector<T>>(
+                    HPX_GET_EXCEPTION(hpx::error::bad_parameter, name,
+                        "the number of values must match the number of "
+                        "participating sites"));
+            }
+
+            // the algorithms exchange messages synchronously, run them on a
+            // separate thread
+            return hpx::async(
+                [comm = HPX_MOVE(comm), data = HPX_MOVE(local_result),
+                    generation, algorithm]() mutable -> std::vector<T> {
+                    return detail::all_to_all_exchange(
+                        comm, HPX_MOVE(data), generation, algorithm);
+                });
+        }
+    }    // namespace detail
+
+    // all_to_all using point-to-point messages
+    template <typename T>
+    hpx::future<std::vector<T>> all_to_all(channel_communicator comm,
+        std::vector<T> local_result, generation_arg generation,
+        all_to_all_algorithm algorithm = all_to_all_algorithm::automatic)
+    {
+        return detail::all_to_all_channel(HPX_MOVE(comm),
+            HPX_MOVE(local_result), generation, algorithm,
+            "hpx::collectives::all_to_all");
+    }
+
+    // all_to_all with per-destination sizes using point-to-point messages,
+    // the blocks are exchanged directly as their sizes are not known up front
+    template <typename T>
+    hpx::future<std::vector<std::vector<T>>> all_to_allv(
+        channel_communicator comm, std::vector<std::vector<T>> local_result,
+        generation_arg generation)
+    {
+        return detail::all_to_all_channel(HPX_MOVE(comm),
+            HPX_MOVE(local_result), generation, all_to_all_algorithm::pairwise,
+            "hpx::collectives::all_to_allv");
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +48,7 @@ namespace hpx::collectives {
         struct root_site_tag;
         struct tag_tag;
         struct arity_tag;
+        struct segment_size_tag;
     }    // namespace detail
 
     /// The number of participating sites (default: all localities)
@@ -75,4 +76,8 @@ namespace hpx::collectives {
     /// The number of children each of the communication nodes is connected
     /// to (default: picked based on num_sites).
     using arity_arg = detail::argument_type<detail::arity_tag>;
+
+    /// The size [bytes] of the segments large values are split into (default:
+    /// HPX_COLLECTIVES_BROADCAST_SEGMENT_SIZE).
+    using segment_size_arg = detail::argument_type<detail::segment_size_tag>;
 }    // namespace hpx::collectives
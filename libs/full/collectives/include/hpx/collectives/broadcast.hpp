@@ -185,6 +185,64 @@ namespace hpx { namespace collectives {
     hpx::future<T> broadcast_from(communicator comm,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// Broadcast a vector of values to different call sites using segmented
+    /// pipelining
+    ///
+    /// This function sends the given vector to all call sites operating on
+    /// the given channel communicator. The vector is split into segments
+    /// which are passed along a chain of sites, each site forwards a segment
+    /// as soon as it was received. The overall time of the broadcast of large
+    /// vectors approaches the time needed for a single transfer of the
+    /// vector. Vectors consisting of a single segment are sent down a binomial
+    /// tree instead.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The vector to transmit to all participating
+    ///                     sites from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. It must be a positive number
+    ///                     greater than zero and has to be different for each
+    ///                     operation performed on the communicator.
+    /// \param  segment_size The size [bytes] of the segments the vector is
+    ///                     split into. This value is optional and defaults to
+    ///                     HPX_COLLECTIVES_BROADCAST_SEGMENT_SIZE.
+    ///
+    /// \note       The generation values from corresponding \a broadcast_to and
+    ///             \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the vector that was
+    ///             sent to all participating sites. It will become ready once
+    ///             all segments have been passed on to the next site.
+    ///
+    template <typename T>
+    hpx::future<std::vector<T>> broadcast_to(channel_communicator comm,
+        std::vector<T> local_result, generation_arg generation,
+        segment_size_arg segment_size = segment_size_arg());
+
+    /// Receive a vector of values that was broadcast to different call sites
+    /// using segmented pipelining
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator.
+    /// \param  root_site   The site that has invoked \a broadcast_to. This
+    ///                     value is optional and defaults to '0' (zero).
+    ///
+    /// \note       The generation values from corresponding \a broadcast_to and
+    ///             \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the vector that was
+    ///             sent to all participating sites. It will become ready once
+    ///             the vector has been received completely.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        generation_arg generation, root_site_arg root_site = root_site_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -199,7 +257,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/segmented_broadcast.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -207,6 +267,7 @@ namespace hpx { namespace collectives {
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -385,6 +446,57 @@ namespace hpx::collectives {
                                      this_site, generation, root_site),
             this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast vectors using point-to-point messages
+    template <typename T>
+    hpx::future<std::vector<T>> broadcast_to(channel_communicator comm,
+        std::vector<T> local_result, generation_arg generation,
+        segment_size_arg segment_size = segment_size_arg())
+    {
+        if (generation == 0 || generation == static_cast<std::size_t>(-1))
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::broadcast_to",
+                    "the generation number must be given and shouldn't be "
+                    "zero"));
+        }
+
+        // the segments are exchanged synchronously, run this on a separate
+        // thread
+        return hpx::async([comm = HPX_MOVE(comm), data = HPX_MOVE(local_result),
+                              generation,
+                              segment_size]() mutable -> std::vector<T> {
+            detail::segmented_broadcast(
+                comm, comm.get_info().second, data, segment_size, generation);
+            return HPX_MOVE(data);
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        generation_arg generation, root_site_arg root_site = root_site_arg())
+    {
+        static_assert(std::is_same_v<T, std::vector<typename T::value_type>>,
+            "broadcast_from on a channel_communicator supports std::vector "
+            "only");
+
+        if (generation == 0 || generation == static_cast<std::size_t>(-1))
+        {
+            return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_from",
+                "the generation number must be given and shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), generation, root_site]() mutable -> T {
+                T data;
+                detail::segmented_broadcast(comm, root_site, data,
+                    static_cast<std::size_t>(-1), generation);
+                return data;
+            });
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file bulk_async.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx::lcos {
+
+    /// \brief Invoke an action on many targets using one parcel per locality
+    ///
+    /// The function hpx::lcos::bulk_async invokes the given action on all
+    /// given global identifiers. The targets are grouped by the locality they
+    /// live on, and a single parcel holding the list of targets is sent to
+    /// each of those localities. The action invocations are executed in
+    /// parallel on the locality of their targets. The action can be either a
+    /// plain action (in which case the global identifiers have to refer to
+    /// localities) or a component action (in which case the global
+    /// identifiers have to refer to instances of a component type which
+    /// exposes the action).
+    ///
+    /// \param ids       [in] A list of global identifiers identifying the
+    ///                  target objects for which the given action will be
+    ///                  invoked.
+    /// \param argN      [in] Any number of arbitrary arguments (passed
+    ///                  by const reference) which will be forwarded to all
+    ///                  action invocations.
+    ///
+    /// \returns         This function returns a future representing the
+    ///                  results of all action invocations, ordered in the
+    ///                  same way as the given list of targets.
+    ///
+    /// \note            If decltype(Action(...)) is void, then the result of
+    ///                  this function is future<void>.
+    ///
+    /// \note            The targets are grouped using the locality encoded in
+    ///                  their global identifiers. Invocations on objects
+    ///                  that were migrated are forwarded to the current
+    ///                  location of the object.
+    ///
+    template <typename Action, typename ArgN, ...>
+    hpx::future<std::vector<decltype(Action(hpx::id_type, ArgN, ...))>>
+    bulk_async(std::vector<hpx::id_type> const& ids, ArgN argN, ...);
+}    // namespace hpx::lcos
+#else
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/preprocessor/cat.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/nargs.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lcos {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action>
+        struct bulk_async_result
+        {
+            using action_result =
+                traits::promise_local_result_t<typename hpx::traits::
+                        extract_action<Action>::remote_result_type>;
+            using type = std::conditional_t<std::is_void_v<action_result>,
+                void, std::vector<action_result>>;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // This is executed on the locality of the given targets, all action
+        // invocations are local and run concurrently.
+        template <typename Action, typename... Ts>
+        struct bulk_async_invoker
+        {
+            using action_result =
+                typename bulk_async_result<Action>::action_result;
+
+            static typename bulk_async_result<Action>::type call(
+                Action const&, std::vector<hpx::id_type> const& ids,
+                Ts const&... vs)
+            {
+                std::vector<hpx::future<action_result>> futures;
+                futures.reserve(ids.size());
+                for (hpx::id_type const& id : ids)
+                {
+                    futures.push_back(hpx::async<Action>(id, vs...));
+                }
+
+                hpx::wait_all(futures);
+
+                if constexpr (std::is_void_v<action_result>)
+                {
+                    for (auto& f : futures)
+                    {
+                        f.get();    // rethrow exceptions, if any
+                    }
+                }
+                else
+                {
+                    std::vector<action_result> results;
+                    results.reserve(futures.size());
+                    for (auto& f : futures)
+                    {
+                        results.push_back(f.get());
+                    }
+                    return results;
+                }
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action, typename Is>
+        struct make_bulk_async_action_impl;
+
+        template <typename Action, std::size_t... Is>
+        struct make_bulk_async_action_impl<Action, util::index_pack<Is...>>
+        {
+            using bulk_async_invoker_type = detail::bulk_async_invoker<Action,
+                hpx::tuple_element_t<Is, typename Action::arguments_type>...>;
+
+            using type =
+                typename HPX_MAKE_ACTION(bulk_async_invoker_type::call)::type;
+        };
+
+        template <typename Action>
+        struct make_bulk_async_action
+          : make_bulk_async_action_impl<Action,
+                util::make_index_pack_t<Action::arity>>
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // the targets (and their position in the list of all targets) living
+        // on the same locality
+        struct bulk_async_targets
+        {
+            std::vector<hpx::id_type> ids_;
+            std::vector<std::size_t> indices_;
+        };
+
+        inline std::map<std::uint32_t, bulk_async_targets>
+        group_bulk_async_targets(std::vector<hpx::id_type> const& ids)
+        {
+            std::map<std::uint32_t, bulk_async_targets> targets;
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                auto& t = targets[naming::get_locality_id_from_id(ids[i])];
+                t.ids_.push_back(ids[i]);
+                t.indices_.push_back(i);
+            }
+            return targets;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Action, typename... Ts>
+    hpx::future<typename detail::bulk_async_result<Action>::type> bulk_async(
+        std::vector<hpx::id_type> const& ids, Ts const&... vs)
+    {
+        using action_result =
+            typename detail::bulk_async_result<Action>::action_result;
+        using bulk_async_action =
+            typename detail::make_bulk_async_action<Action>::type;
+        using result_type = typename detail::bulk_async_result<Action>::type;
+
+        if (ids.empty())
+        {
+            return hpx::make_exceptional_future<result_type>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::lcos::bulk_async",
+                    "empty list of targets for bulk_async operation"));
+        }
+
+        auto targets = detail::group_bulk_async_targets(ids);
+
+        std::vector<hpx::future<result_type>> futures;
+        std::vector<std::vector<std::size_t>> indices;
+        futures.reserve(targets.size());
+        indices.reserve(targets.size());
+
+        for (auto& [locality_id, t] : targets)
+        {
+            futures.push_back(hpx::async<bulk_async_action>(
+                naming::get_id_from_locality_id(locality_id), Action(),
+                HPX_MOVE(t.ids_), vs...));
+            indices.push_back(HPX_MOVE(t.indices_));
+        }
+
+        return hpx::when_all(futures).then(hpx::launch::sync,
+            [indices = HPX_MOVE(indices), size = ids.size()](
+                hpx::future<std::vector<hpx::future<result_type>>>&& f)
+                -> result_type {
+                std::vector<hpx::future<result_type>> futures = f.get();
+
+                if constexpr (std::is_void_v<action_result>)
+                {
+                    for (auto& f : futures)
+                    {
+                        f.get();    // rethrow exceptions, if any
+                    }
+                }
+                else
+                {
+                    // put the results into the order of the targets
+                    std::vector<action_result> results(size);
+                    for (std::size_t i = 0; i != futures.size(); ++i)
+                    {
+                        std::vector<action_result> r = futures[i].get();
+                        HPX_ASSERT(r.size() == indices[i].size());
+                        for (std::size_t j = 0; j != r.size(); ++j)
+                        {
+                            results[indices[i][j]] = HPX_MOVE(r[j]);
+                        }
+                    }
+                    return results;
+                }
+            });
+    }
+
+    template <typename Component, typename Signature, typename Derived,
+        typename... Ts>
+    hpx::future<typename detail::bulk_async_result<Derived>::type> bulk_async(
+        hpx::actions::basic_action<Component, Signature, Derived> /* act */,
+        std::vector<hpx::id_type> const& ids, Ts const&... vs)
+    {
+        return bulk_async<Derived>(ids, vs...);
+    }
+}    // namespace hpx::lcos
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(...)                        \
+    HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(__VA_ARGS__)                   \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(...)                       \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_,      \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_1(Action)                   \
+    HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Action)               \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Name)             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        ::hpx::lcos::detail::make_bulk_async_action<Action>::type,             \
+        HPX_PP_CAT(bulk_async_, Name))                                         \
+/**/
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_BULK_ASYNC_ACTION(...)                                    \
+    HPX_REGISTER_BULK_ASYNC_ACTION_(__VA_ARGS__)                               \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_(...)                                   \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_BULK_ASYNC_ACTION_,                  \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_1(Action)                               \
+    HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Action)                           \
+/**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Name)                         \
+    HPX_REGISTER_ACTION(                                                       \
+        ::hpx::lcos::detail::make_bulk_async_action<Action>::type,             \
+        HPX_PP_CAT(bulk_async_, Name))                                         \
+/**/
+
+#else
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(...)  /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_(...) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_1(Action)       /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION_2(Action, Name) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION(...)  /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_(...) /**/
+
+#define HPX_REGISTER_BULK_ASYNC_ACTION_1(Action)       /**/
+#define HPX_REGISTER_BULK_ASYNC_ACTION_2(Action, Name) /**/
+
+#endif    // COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
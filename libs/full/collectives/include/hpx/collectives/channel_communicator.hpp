@@ -163,6 +163,11 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        // return the number of participating sites and the index of this
+        // site
+        [[nodiscard]] HPX_EXPORT std::pair<num_sites_arg, this_site_arg>
+        get_info() const noexcept;
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
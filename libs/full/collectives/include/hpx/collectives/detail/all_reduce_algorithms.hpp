@@ -0,0 +1,341 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/parallel/util/reduction_operators.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    /// The algorithms available for all_reduce operations performed on a
+    /// channel_communicator
+    enum class all_reduce_algorithm : std::uint8_t
+    {
+        /// select the algorithm based on the size of the data and the number
+        /// of participating sites
+        automatic = 0,
+        /// exchange the full data with log(P) partners (latency-optimal)
+        recursive_doubling = 1,
+        /// ring based reduce-scatter followed by a ring based all-gather
+        /// (bandwidth-optimal for any number of sites)
+        ring = 2,
+        /// recursive halving reduce-scatter followed by a recursive
+        /// doubling all-gather (bandwidth-optimal with log(P) steps, falls
+        /// back to the ring algorithm if the number of sites is not a power
+        /// of two)
+        rabenseifner = 3
+    };
+}    // namespace hpx::collectives
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // None of the algorithms needs more than 2 * num_sites steps, each step
+    // uses its own tag.
+    constexpr std::size_t all_reduce_base_tag(
+        std::size_t num_sites, std::size_t generation) noexcept
+    {
+        return (generation - 1) * 2 * num_sites;
+    }
+
+    constexpr bool is_power_of_two(std::size_t value) noexcept
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    inline all_reduce_algorithm select_all_reduce_algorithm(
+        all_reduce_algorithm algorithm, std::size_t num_sites,
+        std::size_t count, std::size_t size) noexcept
+    {
+        if (algorithm == all_reduce_algorithm::automatic)
+        {
+            // the bandwidth-optimal algorithms split the data into (at least)
+            // one part per site, this pays off for large messages only
+            if (count < num_sites ||
+                size < HPX_COLLECTIVES_ALL_REDUCE_SMALL_MESSAGE_SIZE)
+            {
+                return all_reduce_algorithm::recursive_doubling;
+            }
+            algorithm = all_reduce_algorithm::rabenseifner;
+        }
+
+        if (algorithm == all_reduce_algorithm::rabenseifner &&
+            !is_power_of_two(num_sites))
+        {
+            return all_reduce_algorithm::ring;
+        }
+        return algorithm;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    std::vector<T> all_reduce_slice(
+        std::vector<T> const& data, std::size_t begin, std::size_t end)
+    {
+        HPX_ASSERT(begin <= end && end <= data.size());
+        return std::vector<T>(data.begin() + begin, data.begin() + end);
+    }
+
+    template <typename T, typename F>
+    void all_reduce_combine(std::vector<T>& data, std::size_t offset,
+        std::vector<T> const& received, F& op)
+    {
+        HPX_ASSERT(offset + received.size() <= data.size());
+#if defined(HPX_HAVE_DATAPAR)
+        if constexpr (hpx::experimental::reduction_operators::
+                          is_vectorizable_v<F, T>)
+        {
+            auto const first = data.begin() + offset;
+            hpx::transform(hpx::execution::simd, first,
+                first + received.size(), received.begin(), first, op);
+            return;
+        }
+#endif
+        for (std::size_t i = 0; i != received.size(); ++i)
+        {
+            data[offset + i] =
+                HPX_INVOKE(op, HPX_MOVE(data[offset + i]), received[i]);
+        }
+    }
+
+    // send the given data to site 'to' while receiving data from site 'from'
+    template <typename T>
+    std::vector<T> all_reduce_exchange(
+        hpx::collectives::channel_communicator const& comm, std::size_t to,
+        std::size_t from, std::vector<T>&& data, std::size_t tag)
+    {
+        hpx::future<void> sent =
+            set(comm, that_site_arg(to), HPX_MOVE(data), tag_arg(tag));
+        std::vector<T> result =
+            get<std::vector<T>>(comm, that_site_arg(from), tag_arg(tag)).get();
+        sent.get();
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each site exchanges its full data with the sites whose index differs in
+    // exactly one bit. Sites exceeding the largest power of two are folded
+    // into their neighbor before and receive the result after the exchange.
+    template <typename T, typename F>
+    void all_reduce_recursive_doubling(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::vector<T>& data,
+        F& op, std::size_t tag)
+    {
+        std::size_t num_active = 1;
+        while (num_active * 2 <= num_sites)
+        {
+            num_active *= 2;
+        }
+        std::size_t const remaining = num_sites - num_active;
+
+        if (this_site < 2 * remaining)
+        {
+            if (this_site % 2 == 0)
+            {
+                // hand the data to the neighbor and wait for the result
+                hpx::future<void> sent = set(comm, that_site_arg(this_site + 1),
+                    HPX_MOVE(data), tag_arg(tag));
+                data = get<std::vector<T>>(
+                    comm, that_site_arg(this_site + 1), tag_arg(tag + 1))
+                           .get();
+                sent.get();
+                return;
+            }
+
+            all_reduce_combine(data, 0,
+                get<std::vector<T>>(
+                    comm, that_site_arg(this_site - 1), tag_arg(tag))
+                    .get(),
+                op);
+        }
+
+        std::size_t const rank = this_site < 2 * remaining ?
+            this_site / 2 :
+            this_site - remaining;
+        auto const site_of_rank = [remaining](std::size_t r) {
+            return r < remaining ? 2 * r + 1 : r + remaining;
+        };
+
+        std::size_t step = tag + 2;
+        for (std::size_t mask = 1; mask != num_active; mask *= 2, ++step)
+        {
+            std::size_t const partner = site_of_rank(rank ^ mask);
+            all_reduce_combine(data, 0,
+                all_reduce_exchange(comm, partner, partner,
+                    all_reduce_slice(data, 0, data.size()), step),
+                op);
+        }
+
+        if (this_site < 2 * remaining)
+        {
+            set(comm, that_site_arg(this_site - 1), data, tag_arg(tag + 1))
+                .get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The data is split into one chunk per site. In num_sites - 1 steps each
+    // site passes one chunk to its right neighbor while combining the chunk
+    // received from its left neighbor (reduce-scatter). Afterwards, each site
+    // holds one fully reduced chunk which is circulated in another
+    // num_sites - 1 steps (all-gather).
+    template <typename T, typename F>
+    void all_reduce_ring(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::vector<T>& data,
+        F& op, std::size_t tag)
+    {
+        std::size_t const count = data.size();
+        auto const chunk = [&](std::size_t i) {
+            return std::make_pair(
+                i * count / num_sites, (i + 1) * count / num_sites);
+        };
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        for (std::size_t s = 0; s != num_sites - 1; ++s)
+        {
+            auto const [begin, end] =
+                chunk((this_site + num_sites - s) % num_sites);
+            std::size_t const offset =
+                chunk((this_site + 2 * num_sites - s - 1) % num_sites).first;
+
+            all_reduce_combine(data, offset,
+                all_reduce_exchange(comm, right, left,
+                    all_reduce_slice(data, begin, end), tag + s),
+                op);
+        }
+
+        tag += num_sites - 1;
+        for (std::size_t s = 0; s != num_sites - 1; ++s)
+        {
+            auto const [begin, end] =
+                chunk((this_site + num_sites + 1 - s) % num_sites);
+            std::size_t const offset =
+                chunk((this_site + num_sites - s) % num_sites).first;
+
+            std::vector<T> received = all_reduce_exchange(comm, right, left,
+                all_reduce_slice(data, begin, end), tag + s);
+            std::move(received.begin(), received.end(), data.begin() + offset);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive halving reduce-scatter: in each step the sites exchange half
+    // of their current part of the data with a partner and continue with the
+    // other (now combined) half. The all-gather reverses these steps using
+    // recursive doubling. The number of sites has to be a power of two.
+    template <typename T, typename F>
+    void all_reduce_rabenseifner(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::vector<T>& data,
+        F& op, std::size_t tag)
+    {
+        HPX_ASSERT(is_power_of_two(num_sites));
+
+        std::vector<std::pair<std::size_t, std::size_t>> parts;
+        std::size_t lo = 0;
+        std::size_t hi = data.size();
+
+        for (std::size_t mask = num_sites / 2; mask != 0; mask /= 2, ++tag)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const mid = lo + (hi - lo) / 2;
+            bool const lower = (this_site & mask) == 0;
+
+            parts.emplace_back(lo, hi);
+            std::vector<T> received = all_reduce_exchange(comm, partner,
+                partner,
+                lower ? all_reduce_slice(data, mid, hi) :
+                        all_reduce_slice(data, lo, mid),
+                tag);
+
+            if (lower)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid;
+            }
+            all_reduce_combine(data, lo, received, op);
+        }
+
+        for (std::size_t mask = 1; mask != num_sites; mask *= 2, ++tag)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::vector<T> received = all_reduce_exchange(
+                comm, partner, partner, all_reduce_slice(data, lo, hi), tag);
+
+            // the partner holds the other half of the enclosing part
+            auto const [part_lo, part_hi] = parts.back();
+            parts.pop_back();
+
+            std::size_t const offset = lo == part_lo ? hi : part_lo;
+            HPX_ASSERT(received.size() == part_hi - part_lo - (hi - lo));
+            std::move(received.begin(), received.end(), data.begin() + offset);
+
+            lo = part_lo;
+            hi = part_hi;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    void all_reduce_vector(hpx::collectives::channel_communicator const& comm,
+        std::vector<T>& data, F& op, std::size_t generation,
+        all_reduce_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return;
+        }
+
+        std::size_t const tag = all_reduce_base_tag(num_sites, generation);
+        switch (select_all_reduce_algorithm(algorithm, num_sites, data.size(),
+            data.size() * sizeof(T)))
+        {
+        case all_reduce_algorithm::ring:
+            all_reduce_ring(comm, num_sites, this_site, data, op, tag);
+            break;
+
+        case all_reduce_algorithm::rabenseifner:
+            all_reduce_rabenseifner(comm, num_sites, this_site, data, op, tag);
+            break;
+
+        default:
+            all_reduce_recursive_doubling(
+                comm, num_sites, this_site, data, op, tag);
+            break;
+        }
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -0,0 +1,190 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    /// The algorithms available for all_to_all operations performed on a
+    /// channel_communicator
+    enum class all_to_all_algorithm : std::uint8_t
+    {
+        /// select the algorithm based on the size of the data sent to each
+        /// of the participating sites
+        automatic = 0,
+        /// in num_sites - 1 steps each site exchanges the data directly with
+        /// one of its peers (bandwidth-optimal)
+        pairwise = 1,
+        /// in log(num_sites) steps each site sends the blocks whose index
+        /// has a certain bit set to one of its peers (latency-optimal, the
+        /// blocks are forwarded up to log(num_sites) times)
+        bruck = 2
+    };
+}    // namespace hpx::collectives
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // None of the algorithms needs more than num_sites - 1 steps, each step
+    // uses its own tag. The tags are laid out like those of all_reduce.
+    constexpr std::size_t all_to_all_base_tag(
+        std::size_t num_sites, std::size_t generation) noexcept
+    {
+        return (generation - 1) * 2 * num_sites;
+    }
+
+    template <typename T>
+    all_to_all_algorithm select_all_to_all_algorithm(
+        all_to_all_algorithm algorithm) noexcept
+    {
+        if (algorithm == all_to_all_algorithm::automatic)
+        {
+            // forwarding the blocks pays off only if they are small, the
+            // size of other types is not known up front
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (sizeof(T) <= HPX_COLLECTIVES_ALL_TO_ALL_SMALL_MESSAGE_SIZE)
+                {
+                    return all_to_all_algorithm::bruck;
+                }
+            }
+            return all_to_all_algorithm::pairwise;
+        }
+        return algorithm;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // In step s each site sends the block destined for site this_site + s
+    // and receives the block from site this_site - s.
+    template <typename T>
+    std::vector<T> all_to_all_pairwise(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::vector<T>&& data,
+        std::size_t tag)
+    {
+        HPX_ASSERT(data.size() == num_sites);
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(data[this_site]);
+
+        for (std::size_t s = 1; s != num_sites; ++s)
+        {
+            std::size_t const to = (this_site + s) % num_sites;
+            std::size_t const from = (this_site + num_sites - s) % num_sites;
+
+            hpx::future<void> sent = set(
+                comm, that_site_arg(to), HPX_MOVE(data[to]), tag_arg(tag + s));
+            result[from] =
+                get<T>(comm, that_site_arg(from), tag_arg(tag + s)).get();
+            sent.get();
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The blocks are rotated such that block i is destined for site
+    // this_site + i. In step k each site sends all blocks whose index has
+    // bit k set to site this_site + 2^k and replaces them with the blocks
+    // received from site this_site - 2^k. Afterwards, block i was sent by
+    // site this_site - i.
+    template <typename T>
+    std::vector<T> all_to_all_bruck(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::vector<T>&& data,
+        std::size_t tag)
+    {
+        HPX_ASSERT(data.size() == num_sites);
+
+        std::vector<T> blocks;
+        blocks.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            blocks.push_back(HPX_MOVE(data[(this_site + i) % num_sites]));
+        }
+
+        std::vector<T> outgoing;
+        outgoing.reserve(num_sites / 2 + 1);
+        for (std::size_t k = 1; k < num_sites; k *= 2, ++tag)
+        {
+            outgoing.clear();
+            for (std::size_t i = k; i < num_sites; ++i)
+            {
+                if ((i & k) != 0)
+                {
+                    outgoing.push_back(HPX_MOVE(blocks[i]));
+                }
+            }
+
+            hpx::future<void> sent =
+                set(comm, that_site_arg((this_site + k) % num_sites),
+                    HPX_MOVE(outgoing), tag_arg(tag));
+            std::vector<T> incoming = get<std::vector<T>>(comm,
+                that_site_arg((this_site + num_sites - k) % num_sites),
+                tag_arg(tag))
+                                          .get();
+
+            auto it = incoming.begin();
+            for (std::size_t i = k; i < num_sites; ++i)
+            {
+                if ((i & k) != 0)
+                {
+                    HPX_ASSERT(it != incoming.end());
+                    blocks[i] = HPX_MOVE(*it++);
+                }
+            }
+            sent.get();
+        }
+
+        std::vector<T> result(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            result[(this_site + num_sites - i) % num_sites] =
+                HPX_MOVE(blocks[i]);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    std::vector<T> all_to_all_exchange(
+        hpx::collectives::channel_communicator const& comm,
+        std::vector<T>&& data, std::size_t generation,
+        all_to_all_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return HPX_MOVE(data);
+        }
+
+        std::size_t const tag = all_to_all_base_tag(num_sites, generation);
+        if (select_all_to_all_algorithm<T>(algorithm) ==
+            all_to_all_algorithm::bruck)
+        {
+            return all_to_all_bruck(
+                comm, num_sites, this_site, HPX_MOVE(data), tag);
+        }
+        return all_to_all_pairwise(
+            comm, num_sites, this_site, HPX_MOVE(data), tag);
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -0,0 +1,199 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/std_tuple.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of segments each site keeps in flight while forwarding them to
+    // the next site of the pipeline.
+    inline constexpr std::size_t broadcast_pipeline_depth = 4;
+
+    // Each broadcast uses one tag for its header and one tag per segment.
+    constexpr std::size_t broadcast_base_tag(std::size_t generation) noexcept
+    {
+        return generation << 32;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pass the given value down a binomial tree rooted at the given site. The
+    // root supplies the value, all other sites receive it from their parent
+    // and return it.
+    template <typename T>
+    T binomial_broadcast(hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::size_t root,
+        T value, std::size_t tag)
+    {
+        std::size_t const rank = (this_site + num_sites - root) % num_sites;
+
+        std::size_t mask = 1;
+        for (/**/; mask < num_sites; mask *= 2)
+        {
+            if ((rank & mask) != 0)
+            {
+                value = get<T>(comm,
+                    that_site_arg((this_site + num_sites - mask) % num_sites),
+                    tag_arg(tag))
+                            .get();
+                break;
+            }
+        }
+
+        std::vector<hpx::future<void>> sent;
+        for (mask /= 2; mask != 0; mask /= 2)
+        {
+            if (rank + mask < num_sites)
+            {
+                sent.push_back(set(comm,
+                    that_site_arg((this_site + mask) % num_sites), value,
+                    tag_arg(tag)));
+            }
+        }
+
+        for (auto& f : sent)
+        {
+            f.get();    // rethrow exceptions, if any
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pass the segments of the given data along a chain of sites starting at
+    // the root. Each site forwards a segment as soon as it was received,
+    // which overlaps the transfers between all consecutive sites of the
+    // chain.
+    template <typename T>
+    void chain_broadcast(hpx::collectives::channel_communicator const& comm,
+        std::size_t num_sites, std::size_t this_site, std::size_t root,
+        std::vector<T>& data, std::size_t segment_count, std::size_t tag)
+    {
+        using buffer_type = serialization::serialize_buffer<T>;
+
+        std::size_t const rank = (this_site + num_sites - root) % num_sites;
+        std::size_t const prev = (this_site + num_sites - 1) % num_sites;
+        std::size_t const next = (this_site + 1) % num_sites;
+        bool const forward = rank + 1 != num_sites;
+
+        std::size_t const count = data.size();
+        std::size_t const num_segments =
+            (count + segment_count - 1) / segment_count;
+
+        std::vector<hpx::future<void>> pending(broadcast_pipeline_depth);
+        for (std::size_t i = 0; i != num_segments; ++i)
+        {
+            std::size_t const begin = i * segment_count;
+            std::size_t const size = (std::min)(segment_count, count - begin);
+
+            // the root copies the segments as they might still be referenced
+            // by the receiving channels of sites on this locality after the
+            // broadcast has returned
+            buffer_type segment = rank == 0 ?
+                buffer_type(data.data() + begin, size, buffer_type::copy) :
+                get<buffer_type>(comm, that_site_arg(prev), tag_arg(tag + i))
+                    .get();
+            HPX_ASSERT(segment.size() == size);
+
+            if (forward)
+            {
+                // limit the number of segments in flight
+                auto& f = pending[i % broadcast_pipeline_depth];
+                if (f.valid())
+                {
+                    f.get();
+                }
+                f = set(comm, that_site_arg(next), segment, tag_arg(tag + i));
+            }
+
+            if (rank != 0)
+            {
+                std::copy(segment.data(), segment.data() + size,
+                    data.begin() + begin);
+            }
+        }
+
+        for (auto& f : pending)
+        {
+            if (f.valid())
+            {
+                f.get();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void segmented_broadcast(hpx::collectives::channel_communicator const& comm,
+        std::size_t root, std::vector<T>& data, std::size_t segment_size,
+        std::size_t generation)
+    {
+        using buffer_type = serialization::serialize_buffer<T>;
+
+        auto const [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return;
+        }
+
+        std::size_t const tag = broadcast_base_tag(generation);
+
+        // the root decides on the segmentation of the data, the other sites
+        // receive it together with the size of the data
+        if (segment_size == static_cast<std::size_t>(-1))
+        {
+            segment_size = HPX_COLLECTIVES_BROADCAST_SEGMENT_SIZE;
+        }
+        auto const [count, segment_count] = binomial_broadcast(comm, num_sites,
+            this_site, root,
+            std::make_tuple(data.size(),
+                (std::max)(segment_size / sizeof(T), std::size_t(1))),
+            tag);
+
+        if (this_site != root)
+        {
+            data.resize(count);
+        }
+
+        if (count <= segment_count)
+        {
+            // a single segment is passed down a binomial tree
+            buffer_type segment = binomial_broadcast(comm, num_sites, this_site,
+                root,
+                this_site == root ?
+                    buffer_type(data.data(), count, buffer_type::copy) :
+                    buffer_type(),
+                tag + 1);
+
+            if (this_site != root)
+            {
+                HPX_ASSERT(segment.size() == count);
+                std::copy(segment.data(), segment.data() + count, data.begin());
+            }
+            return;
+        }
+
+        chain_broadcast(
+            comm, num_sites, this_site, root, data, segment_count, tag + 1);
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
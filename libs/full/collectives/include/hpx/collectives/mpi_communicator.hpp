@@ -0,0 +1,415 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file mpi_communicator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ASYNC_MPI) && !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_mpi/mpi_executor.hpp>
+#include <hpx/async_mpi/mpi_future.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/execution/detail/future_exec.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/mpi_base/mpi.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    /// A communicator which maps the collective operations directly onto the
+    /// non-blocking collective operations of an MPI communicator. The
+    /// operations are completed by the MPI polling of the async_mpi module,
+    /// which has to be enabled (see hpx::mpi::experimental::
+    /// enable_user_polling) while any of the operations is in flight.
+    ///
+    /// \note All sites have to invoke the operations on a given communicator
+    ///       in the same order (as required by MPI). Only arithmetic types
+    ///       (and std::vector's of those) are supported.
+    class mpi_communicator
+    {
+    public:
+        mpi_communicator() = default;
+
+        /// Take ownership of the given MPI communicator, it is freed once the
+        /// last copy of this mpi_communicator goes out of scope
+        explicit mpi_communicator(MPI_Comm comm)
+          : comm_(new MPI_Comm(comm), [](MPI_Comm* c) {
+              int finalized = 0;
+              MPI_Finalized(&finalized);
+              if (!finalized && *c != MPI_COMM_NULL)
+              {
+                  MPI_Comm_free(c);
+              }
+              delete c;
+          })
+        {
+            int num_sites = 0;
+            int this_site = 0;
+            MPI_Comm_size(comm, &num_sites);
+            MPI_Comm_rank(comm, &this_site);
+
+            num_sites_ = static_cast<std::size_t>(num_sites);
+            this_site_ = static_cast<std::size_t>(this_site);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !!comm_;
+        }
+
+        [[nodiscard]] std::pair<num_sites_arg, this_site_arg> get_info()
+            const noexcept
+        {
+            return std::make_pair(
+                num_sites_arg(num_sites_), this_site_arg(this_site_));
+        }
+
+        /// Return the underlying MPI communicator
+        [[nodiscard]] MPI_Comm get() const noexcept
+        {
+            HPX_ASSERT(comm_);
+            return *comm_;
+        }
+
+        [[nodiscard]] hpx::mpi::experimental::executor get_executor()
+            const noexcept
+        {
+            return hpx::mpi::experimental::executor(get());
+        }
+
+    private:
+        std::shared_ptr<MPI_Comm> comm_;
+        std::size_t num_sites_ = 0;
+        std::size_t this_site_ = 0;
+    };
+
+    /// Create a new mpi_communicator holding a dedicated MPI communicator
+    /// which spans all ranks of the given parent communicator. The sites are
+    /// ordered by the given index of this site (defaults to the rank in the
+    /// parent communicator). All ranks of the parent communicator have to
+    /// invoke this function.
+    inline mpi_communicator create_mpi_communicator(
+        this_site_arg this_site = this_site_arg(),
+        MPI_Comm parent = MPI_COMM_WORLD)
+    {
+        int key = 0;
+        if (this_site == static_cast<std::size_t>(-1))
+        {
+            MPI_Comm_rank(parent, &key);
+        }
+        else
+        {
+            key = static_cast<int>(this_site);
+        }
+
+        MPI_Comm comm = MPI_COMM_NULL;
+        if (int const result = MPI_Comm_split(parent, 0, key, &comm);
+            result != MPI_SUCCESS)
+        {
+            throw hpx::mpi::experimental::mpi_exception(
+                result, "hpx::collectives::create_mpi_communicator");
+        }
+        return mpi_communicator(comm);
+    }
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        MPI_Datatype get_mpi_datatype() noexcept
+        {
+            // clang-format off
+            if constexpr (std::is_same_v<T, bool>) return MPI_CXX_BOOL;
+            else if constexpr (std::is_same_v<T, char>) return MPI_CHAR;
+            else if constexpr (std::is_same_v<T, signed char>)
+                return MPI_SIGNED_CHAR;
+            else if constexpr (std::is_same_v<T, unsigned char>)
+                return MPI_UNSIGNED_CHAR;
+            else if constexpr (std::is_same_v<T, short>) return MPI_SHORT;
+            else if constexpr (std::is_same_v<T, unsigned short>)
+                return MPI_UNSIGNED_SHORT;
+            else if constexpr (std::is_same_v<T, int>) return MPI_INT;
+            else if constexpr (std::is_same_v<T, unsigned>) return MPI_UNSIGNED;
+            else if constexpr (std::is_same_v<T, long>) return MPI_LONG;
+            else if constexpr (std::is_same_v<T, unsigned long>)
+                return MPI_UNSIGNED_LONG;
+            else if constexpr (std::is_same_v<T, long long>)
+                return MPI_LONG_LONG;
+            else if constexpr (std::is_same_v<T, unsigned long long>)
+                return MPI_UNSIGNED_LONG_LONG;
+            else if constexpr (std::is_same_v<T, float>) return MPI_FLOAT;
+            else if constexpr (std::is_same_v<T, double>) return MPI_DOUBLE;
+            else if constexpr (std::is_same_v<T, long double>)
+                return MPI_LONG_DOUBLE;
+            // clang-format on
+            else
+            {
+                static_assert(!std::is_same_v<T, T>,
+                    "the mpi_communicator supports arithmetic types only");
+                return MPI_DATATYPE_NULL;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // map the standard function objects onto the predefined MPI operations
+        template <typename F>
+        struct mpi_operation : std::false_type
+        {
+        };
+
+#define HPX_COLLECTIVES_MPI_OPERATION(F, Op)                                   \
+    template <typename T>                                                      \
+    struct mpi_operation<F<T>> : std::true_type                                \
+    {                                                                          \
+        static MPI_Op call() noexcept                                          \
+        {                                                                      \
+            return Op;                                                         \
+        }                                                                      \
+    } /**/
+
+        HPX_COLLECTIVES_MPI_OPERATION(std::plus, MPI_SUM);
+        HPX_COLLECTIVES_MPI_OPERATION(std::multiplies, MPI_PROD);
+        HPX_COLLECTIVES_MPI_OPERATION(std::logical_and, MPI_LAND);
+        HPX_COLLECTIVES_MPI_OPERATION(std::logical_or, MPI_LOR);
+        HPX_COLLECTIVES_MPI_OPERATION(std::bit_and, MPI_BAND);
+        HPX_COLLECTIVES_MPI_OPERATION(std::bit_or, MPI_BOR);
+        HPX_COLLECTIVES_MPI_OPERATION(std::bit_xor, MPI_BXOR);
+
+#undef HPX_COLLECTIVES_MPI_OPERATION
+
+        inline MPI_Op get_mpi_operation(MPI_Op op) noexcept
+        {
+            return op;
+        }
+
+        template <typename F>
+        MPI_Op get_mpi_operation(F const&) noexcept
+        {
+            static_assert(mpi_operation<F>::value,
+                "the mpi_communicator supports the standard arithmetic, "
+                "logical, and bitwise function objects or an explicit MPI_Op "
+                "only");
+            return mpi_operation<F>::call();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Launch the given non-blocking MPI operation on the communicator. The
+        // returned future becomes ready once the operation has completed, its
+        // value is produced by the given function. The function has to keep
+        // the buffers used by the operation alive.
+        template <typename Result, typename F, typename... Ts>
+        auto mpi_async(mpi_communicator const& comm, Result&& result, F&& f,
+            Ts&&... ts)
+        {
+            return hpx::parallel::execution::async_execute(comm.get_executor(),
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)
+                .then(hpx::launch::sync,
+                    [comm, result = HPX_FORWARD(Result, result)](
+                        hpx::future<int>&& r) mutable {
+                        r.get();    // rethrow exceptions, if any
+                        return result();
+                    });
+        }
+
+        inline int mpi_root(
+            [[maybe_unused]] mpi_communicator const& comm, root_site_arg root)
+        {
+            HPX_ASSERT(root < comm.get_info().first);
+            return static_cast<int>(root);
+        }
+
+        template <typename T>
+        struct is_mpi_vector : std::false_type
+        {
+        };
+
+        template <typename T, typename Allocator>
+        struct is_mpi_vector<std::vector<T, Allocator>> : std::true_type
+        {
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// All-reduce the given value over all sites of the communicator using
+    /// MPI_Iallreduce. The operation is either one of the standard function
+    /// objects (std::plus etc.) or a predefined MPI_Op (e.g. MPI_MAX).
+    template <typename T, typename F>
+    hpx::future<T> all_reduce(mpi_communicator const& comm, T value, F&& op)
+    {
+        auto data = std::make_shared<T>(HPX_MOVE(value));
+        T* ptr = data.get();
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+            MPI_Iallreduce, MPI_IN_PLACE, ptr, 1, detail::get_mpi_datatype<T>(),
+            detail::get_mpi_operation(op));
+    }
+
+    /// All-reduce the given data element-wise over all sites of the
+    /// communicator using MPI_Iallreduce.
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(
+        mpi_communicator const& comm, std::vector<T> values, F&& op)
+    {
+        auto data = std::make_shared<std::vector<T>>(HPX_MOVE(values));
+        T* ptr = data->data();
+        int const count = static_cast<int>(data->size());
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+            MPI_Iallreduce, MPI_IN_PLACE, ptr, count,
+            detail::get_mpi_datatype<T>(), detail::get_mpi_operation(op));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Broadcast the given value from this site to all other sites of the
+    /// communicator using MPI_Ibcast.
+    template <typename T>
+    hpx::future<void> broadcast_to(mpi_communicator const& comm, T value)
+    {
+        auto data = std::make_shared<T>(HPX_MOVE(value));
+        T* ptr = data.get();
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() {}, MPI_Ibcast, ptr, 1,
+            detail::get_mpi_datatype<T>(),
+            static_cast<int>(comm.get_info().second));
+    }
+
+    /// Broadcast the given data from this site to all other sites of the
+    /// communicator. The size of the data is broadcast first.
+    template <typename T>
+    hpx::future<void> broadcast_to(
+        mpi_communicator const& comm, std::vector<T> values)
+    {
+        int const root = static_cast<int>(comm.get_info().second);
+
+        auto size = std::make_shared<std::uint64_t>(values.size());
+        std::uint64_t* size_ptr = size.get();
+        hpx::future<void> size_sent = detail::mpi_async(
+            comm, [size = HPX_MOVE(size)]() {}, MPI_Ibcast, size_ptr, 1,
+            MPI_UINT64_T, root);
+
+        auto data = std::make_shared<std::vector<T>>(HPX_MOVE(values));
+        T* ptr = data->data();
+        int const count = static_cast<int>(data->size());
+        return detail::mpi_async(
+            comm,
+            [data = HPX_MOVE(data), size_sent = HPX_MOVE(size_sent)]() mutable {
+                size_sent.get();
+            },
+            MPI_Ibcast, ptr, count, detail::get_mpi_datatype<T>(), root);
+    }
+
+    /// Receive the value broadcast by the given root site using MPI_Ibcast.
+    /// For std::vector's the size of the data is received before this
+    /// function returns, this keeps the order of the MPI operations the
+    /// same on all sites.
+    template <typename T>
+    hpx::future<T> broadcast_from(
+        mpi_communicator const& comm, root_site_arg root = root_site_arg())
+    {
+        int const root_site = detail::mpi_root(comm, root);
+
+        if constexpr (detail::is_mpi_vector<T>::value)
+        {
+            using value_type = typename T::value_type;
+
+            auto size = std::make_shared<std::uint64_t>(0);
+            std::uint64_t* size_ptr = size.get();
+            std::uint64_t const count =
+                detail::mpi_async(
+                    comm, [size = HPX_MOVE(size)]() { return *size; },
+                    MPI_Ibcast, size_ptr, 1, MPI_UINT64_T, root_site)
+                    .get();
+
+            auto data = std::make_shared<T>(count);
+            value_type* ptr = data->data();
+            return detail::mpi_async(
+                comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+                MPI_Ibcast, ptr, static_cast<int>(count),
+                detail::get_mpi_datatype<value_type>(), root_site);
+        }
+        else
+        {
+            auto data = std::make_shared<T>();
+            T* ptr = data.get();
+            return detail::mpi_async(
+                comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+                MPI_Ibcast, ptr, 1, detail::get_mpi_datatype<T>(), root_site);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Gather the values of all sites on this site using MPI_Igather.
+    template <typename T>
+    hpx::future<std::vector<T>> gather_here(
+        mpi_communicator const& comm, T value)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        auto data = std::make_shared<std::vector<T>>(num_sites);
+        T* ptr = data->data();
+        (*data)[this_site] = HPX_MOVE(value);
+
+        MPI_Datatype const type = detail::get_mpi_datatype<T>();
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+            MPI_Igather, MPI_IN_PLACE, 1, type, ptr, 1, type,
+            static_cast<int>(this_site));
+    }
+
+    /// Send the value of this site to the given root site using MPI_Igather.
+    template <typename T>
+    hpx::future<void> gather_there(mpi_communicator const& comm, T value,
+        root_site_arg root = root_site_arg())
+    {
+        auto data = std::make_shared<T>(HPX_MOVE(value));
+        T* ptr = data.get();
+
+        MPI_Datatype const type = detail::get_mpi_datatype<T>();
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() {}, MPI_Igather, ptr, 1, type,
+            nullptr, 0, type, detail::mpi_root(comm, root));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Gather the values of all sites on all sites using MPI_Iallgather.
+    template <typename T>
+    hpx::future<std::vector<T>> all_gather(
+        mpi_communicator const& comm, T value)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        auto data = std::make_shared<std::vector<T>>(num_sites);
+        T* ptr = data->data();
+        (*data)[this_site] = HPX_MOVE(value);
+
+        MPI_Datatype const type = detail::get_mpi_datatype<T>();
+        return detail::mpi_async(
+            comm, [data = HPX_MOVE(data)]() { return HPX_MOVE(*data); },
+            MPI_Iallgather, MPI_IN_PLACE, 1, type, ptr, 1, type);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Wait for all sites of the communicator using MPI_Ibarrier.
+    inline hpx::future<void> barrier(mpi_communicator const& comm)
+    {
+        return detail::mpi_async(comm, []() {}, MPI_Ibarrier);
+    }
+}    // namespace hpx::collectives
+
+#endif
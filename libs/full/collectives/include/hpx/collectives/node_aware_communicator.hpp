@@ -0,0 +1,571 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file node_aware_communicator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// A communicator for two-level collective operations. The participating
+    /// sites are grouped by the node they run on. The sites on the same node
+    /// exchange data through a node-local communicator, only one site per
+    /// node (the node leader, the site with the smallest index on the node)
+    /// takes part in the exchanges between nodes.
+    ///
+    /// All operations on a node_aware_communicator have to be invoked in the
+    /// same order on all participating sites.
+    class node_aware_communicator
+    {
+    public:
+        /// Return the number of participating sites and the index of this
+        /// site
+        std::pair<num_sites_arg, this_site_arg> get_info() const noexcept;
+
+        /// Return the number of nodes the participating sites run on
+        std::size_t get_num_nodes() const noexcept;
+
+        /// Return whether this site is the leader of its node
+        bool is_node_leader() const noexcept;
+    };
+
+    /// Create a new communicator object usable with two-level collective
+    /// operations
+    ///
+    /// This function creates a communicator object for the given base name
+    /// that can be used with the node-aware overloads of all_reduce,
+    /// broadcast_to, broadcast_from, gather_here, gather_there, all_gather,
+    /// and barrier. It has to be called on all participating sites.
+    ///
+    /// \param basename     The base name identifying the collective operation
+    /// \param num_sites    The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param node_name    The name of the node this site runs on. This value
+    ///                     is optional and defaults to the name of the
+    ///                     locality as reported by the parcelport (usually
+    ///                     the host name).
+    ///
+    /// \returns    This function returns a new communicator object usable
+    ///             with the node-aware collective operations.
+    ///
+    node_aware_communicator create_node_aware_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::string const& node_name = std::string());
+
+    /// AllReduce a set of values from all sites of a node_aware_communicator
+    ///
+    /// The values are reduced on each node first, the node results are
+    /// combined between the node leaders, and the overall result is sent to
+    /// all sites of each node.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        node_aware_communicator const& comm, T&& local_result, F&& op);
+
+    /// Broadcast a value from the first site (site zero) of a
+    /// node_aware_communicator to all other sites
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        node_aware_communicator const& comm, T&& local_result);
+
+    /// Receive the value broadcast from the first site (site zero) of a
+    /// node_aware_communicator
+    template <typename T>
+    hpx::future<T> broadcast_from(node_aware_communicator const& comm);
+
+    /// Gather the values of all sites of a node_aware_communicator on the
+    /// first site (site zero). The returned values are ordered by the site
+    /// they were sent from.
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        node_aware_communicator const& comm, T&& local_result);
+
+    /// Send a value to the first site (site zero) of a
+    /// node_aware_communicator
+    template <typename T>
+    hpx::future<void> gather_there(
+        node_aware_communicator const& comm, T&& local_result);
+
+    /// Gather the values of all sites of a node_aware_communicator on all
+    /// sites. The returned values are ordered by the site they were sent
+    /// from.
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        node_aware_communicator const& comm, T&& local_result);
+
+    /// Wait for all sites of a node_aware_communicator to arrive
+    hpx::future<void> barrier(node_aware_communicator const& comm);
+}}    // namespace hpx::collectives
+
+// clang-format on
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/gather.hpp>
+#include <hpx/collectives/reduce.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        struct node_aware_communicator_data
+        {
+            std::size_t num_sites_ = 0;
+            std::size_t this_site_ = 0;
+
+            std::size_t num_nodes_ = 0;
+            std::size_t this_node_ = 0;
+
+            // index of this site on its node, the leader has index zero
+            std::size_t node_site_ = 0;
+
+            // the (global) sites running on each of the nodes
+            std::vector<std::vector<std::size_t>> node_sites_;
+
+            // all sites on this node, its root is the node leader
+            communicator node_;
+
+            // all node leaders (valid on node leaders only), its root is the
+            // leader of the first node (site zero)
+            communicator leaders_;
+
+            // the generations used for the next operation on node_ and
+            // leaders_, these are kept in sync as all sites invoke the same
+            // operations in the same order
+            std::atomic<std::size_t> node_generation_ = 0;
+            std::atomic<std::size_t> leaders_generation_ = 0;
+
+            [[nodiscard]] bool is_node_leader() const noexcept
+            {
+                return node_site_ == 0;
+            }
+
+            [[nodiscard]] std::size_t num_node_sites() const noexcept
+            {
+                return node_sites_[this_node_].size();
+            }
+
+            // reserve the given number of generations on the node
+            // communicator, returns the first of those
+            std::size_t next_node_generation(std::size_t count = 1) noexcept
+            {
+                if (num_node_sites() == 1)
+                {
+                    return 0;    // node communicator is not used
+                }
+                return node_generation_.fetch_add(count) + 1;
+            }
+
+            std::size_t next_leaders_generation() noexcept
+            {
+                if (num_nodes_ == 1 || !is_node_leader())
+                {
+                    return 0;    // leaders communicator is not used
+                }
+                return leaders_generation_.fetch_add(1) + 1;
+            }
+
+            // put the values gathered from all nodes into the order of the
+            // sites they were sent from
+            template <typename T>
+            std::vector<T> order_by_site(
+                std::vector<std::vector<T>>&& values) const
+            {
+                HPX_ASSERT(values.size() == num_nodes_);
+
+                std::vector<T> result(num_sites_);
+                for (std::size_t node = 0; node != num_nodes_; ++node)
+                {
+                    auto const& sites = node_sites_[node];
+                    HPX_ASSERT(values[node].size() == sites.size());
+                    for (std::size_t i = 0; i != sites.size(); ++i)
+                    {
+                        result[sites[i]] = HPX_MOVE(values[node][i]);
+                    }
+                }
+                return result;
+            }
+        };
+
+        struct node_aware_operations;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    class node_aware_communicator
+    {
+    private:
+        friend struct detail::node_aware_operations;
+
+        friend HPX_EXPORT node_aware_communicator
+        create_node_aware_communicator(char const* basename,
+            num_sites_arg num_sites, this_site_arg this_site,
+            std::string const& node_name);
+
+        explicit node_aware_communicator(
+            std::shared_ptr<detail::node_aware_communicator_data> data) noexcept
+          : data_(HPX_MOVE(data))
+        {
+        }
+
+    public:
+        node_aware_communicator() = default;
+
+        [[nodiscard]] std::pair<num_sites_arg, this_site_arg>
+        get_info() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return std::make_pair(num_sites_arg(data_->num_sites_),
+                this_site_arg(data_->this_site_));
+        }
+
+        [[nodiscard]] std::size_t get_num_nodes() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return data_->num_nodes_;
+        }
+
+        [[nodiscard]] bool is_node_leader() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return data_->is_node_leader();
+        }
+
+    private:
+        std::shared_ptr<detail::node_aware_communicator_data> data_;
+    };
+
+    HPX_EXPORT node_aware_communicator create_node_aware_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::string const& node_name = std::string());
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        struct node_aware_operations
+        {
+            template <typename T, typename F>
+            static hpx::future<std::decay_t<T>> all_reduce(
+                node_aware_communicator const& comm, T&& local_result, F&& op)
+            {
+                using arg_type = std::decay_t<T>;
+
+                auto data = comm.data_;
+                std::size_t const node_gen = data->next_node_generation(2);
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                return hpx::async([data = HPX_MOVE(data),
+                                      value = HPX_FORWARD(T, local_result),
+                                      op = HPX_FORWARD(F, op), node_gen,
+                                      leaders_gen]() mutable -> arg_type {
+                    if (!data->is_node_leader())
+                    {
+                        reduce_there(data->node_, HPX_MOVE(value),
+                            this_site_arg(data->node_site_),
+                            generation_arg(node_gen))
+                            .get();
+                        return hpx::collectives::broadcast_from<arg_type>(
+                            data->node_, this_site_arg(data->node_site_),
+                            generation_arg(node_gen + 1))
+                            .get();
+                    }
+
+                    if (node_gen != 0)
+                    {
+                        value = reduce_here(data->node_, HPX_MOVE(value), op,
+                            this_site_arg(0), generation_arg(node_gen))
+                                    .get();
+                    }
+                    if (leaders_gen != 0)
+                    {
+                        value = hpx::collectives::all_reduce(data->leaders_,
+                            HPX_MOVE(value), op,
+                            this_site_arg(data->this_node_),
+                            generation_arg(leaders_gen))
+                                    .get();
+                    }
+                    if (node_gen != 0)
+                    {
+                        hpx::collectives::broadcast_to(data->node_, value,
+                            this_site_arg(0), generation_arg(node_gen + 1))
+                            .get();
+                    }
+                    return value;
+                });
+            }
+
+            template <typename T>
+            static hpx::future<std::decay_t<T>> broadcast_to(
+                node_aware_communicator const& comm, T&& local_result)
+            {
+                using arg_type = std::decay_t<T>;
+
+                auto data = comm.data_;
+                HPX_ASSERT(data->this_site_ == 0);
+
+                std::size_t const node_gen = data->next_node_generation();
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                return hpx::async([data = HPX_MOVE(data),
+                                      value = HPX_FORWARD(T, local_result),
+                                      node_gen,
+                                      leaders_gen]() mutable -> arg_type {
+                    if (leaders_gen != 0)
+                    {
+                        hpx::collectives::broadcast_to(data->leaders_, value,
+                            this_site_arg(0), generation_arg(leaders_gen))
+                            .get();
+                    }
+                    if (node_gen != 0)
+                    {
+                        hpx::collectives::broadcast_to(data->node_, value,
+                            this_site_arg(0), generation_arg(node_gen))
+                            .get();
+                    }
+                    return value;
+                });
+            }
+
+            template <typename T>
+            static hpx::future<T> broadcast_from(
+                node_aware_communicator const& comm)
+            {
+                auto data = comm.data_;
+                HPX_ASSERT(data->this_site_ != 0);
+
+                std::size_t const node_gen = data->next_node_generation();
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                if (!data->is_node_leader())
+                {
+                    return hpx::collectives::broadcast_from<T>(data->node_,
+                        this_site_arg(data->node_site_),
+                        generation_arg(node_gen));
+                }
+
+                return hpx::async(
+                    [data = HPX_MOVE(data), node_gen, leaders_gen]() -> T {
+                        T value = hpx::collectives::broadcast_from<T>(
+                            data->leaders_, this_site_arg(data->this_node_),
+                            generation_arg(leaders_gen))
+                                      .get();
+                        if (node_gen != 0)
+                        {
+                            hpx::collectives::broadcast_to(data->node_, value,
+                                this_site_arg(0), generation_arg(node_gen))
+                                .get();
+                        }
+                        return value;
+                    });
+            }
+
+            // gather the values of all sites of the node on the node leader
+            template <typename T>
+            static std::vector<T> gather_node(
+                node_aware_communicator_data& data, T&& value,
+                std::size_t node_gen)
+            {
+                HPX_ASSERT(data.is_node_leader());
+                if (node_gen == 0)
+                {
+                    return std::vector<T>{HPX_MOVE(value)};
+                }
+                return hpx::collectives::gather_here(data.node_,
+                    HPX_MOVE(value), this_site_arg(0), generation_arg(node_gen))
+                    .get();
+            }
+
+            template <typename T>
+            static hpx::future<std::vector<std::decay_t<T>>> gather_here(
+                node_aware_communicator const& comm, T&& local_result)
+            {
+                using arg_type = std::decay_t<T>;
+
+                auto data = comm.data_;
+                HPX_ASSERT(data->this_site_ == 0);
+
+                std::size_t const node_gen = data->next_node_generation();
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                return hpx::async([data = HPX_MOVE(data),
+                                      value = HPX_FORWARD(T, local_result),
+                                      node_gen, leaders_gen]() mutable {
+                    std::vector<arg_type> values =
+                        gather_node(*data, HPX_MOVE(value), node_gen);
+                    if (leaders_gen == 0)
+                    {
+                        return values;
+                    }
+                    return data->order_by_site(
+                        hpx::collectives::gather_here(data->leaders_,
+                            HPX_MOVE(values), this_site_arg(0),
+                            generation_arg(leaders_gen))
+                            .get());
+                });
+            }
+
+            template <typename T>
+            static hpx::future<void> gather_there(
+                node_aware_communicator const& comm, T&& local_result)
+            {
+                auto data = comm.data_;
+                HPX_ASSERT(data->this_site_ != 0);
+
+                std::size_t const node_gen = data->next_node_generation();
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                if (!data->is_node_leader())
+                {
+                    return hpx::collectives::gather_there(data->node_,
+                        HPX_FORWARD(T, local_result),
+                        this_site_arg(data->node_site_),
+                        generation_arg(node_gen));
+                }
+
+                return hpx::async([data = HPX_MOVE(data),
+                                      value = HPX_FORWARD(T, local_result),
+                                      node_gen, leaders_gen]() mutable {
+                    hpx::collectives::gather_there(data->leaders_,
+                        gather_node(*data, HPX_MOVE(value), node_gen),
+                        this_site_arg(data->this_node_),
+                        generation_arg(leaders_gen))
+                        .get();
+                });
+            }
+
+            template <typename T>
+            static hpx::future<std::vector<std::decay_t<T>>> all_gather(
+                node_aware_communicator const& comm, T&& local_result)
+            {
+                using arg_type = std::decay_t<T>;
+                using result_type = std::vector<arg_type>;
+
+                auto data = comm.data_;
+                std::size_t const node_gen = data->next_node_generation(2);
+                std::size_t const leaders_gen = data->next_leaders_generation();
+
+                return hpx::async([data = HPX_MOVE(data),
+                                      value = HPX_FORWARD(T, local_result),
+                                      node_gen,
+                                      leaders_gen]() mutable -> result_type {
+                    if (!data->is_node_leader())
+                    {
+                        hpx::collectives::gather_there(data->node_,
+                            HPX_MOVE(value), this_site_arg(data->node_site_),
+                            generation_arg(node_gen))
+                            .get();
+                        return hpx::collectives::broadcast_from<result_type>(
+                            data->node_, this_site_arg(data->node_site_),
+                            generation_arg(node_gen + 1))
+                            .get();
+                    }
+
+                    result_type values =
+                        gather_node(*data, HPX_MOVE(value), node_gen);
+                    if (leaders_gen != 0)
+                    {
+                        values = data->order_by_site(
+                            hpx::collectives::all_gather(data->leaders_,
+                                HPX_MOVE(values),
+                                this_site_arg(data->this_node_),
+                                generation_arg(leaders_gen))
+                                .get());
+                    }
+                    if (node_gen != 0)
+                    {
+                        hpx::collectives::broadcast_to(data->node_, values,
+                            this_site_arg(0), generation_arg(node_gen + 1))
+                            .get();
+                    }
+                    return values;
+                });
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        node_aware_communicator const& comm, T&& local_result, F&& op)
+    {
+        return detail::node_aware_operations::all_reduce(
+            comm, HPX_FORWARD(T, local_result), HPX_FORWARD(F, op));
+    }
+
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        node_aware_communicator const& comm, T&& local_result)
+    {
+        return detail::node_aware_operations::broadcast_to(
+            comm, HPX_FORWARD(T, local_result));
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(node_aware_communicator const& comm)
+    {
+        return detail::node_aware_operations::broadcast_from<T>(comm);
+    }
+
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        node_aware_communicator const& comm, T&& local_result)
+    {
+        return detail::node_aware_operations::gather_here(
+            comm, HPX_FORWARD(T, local_result));
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(
+        node_aware_communicator const& comm, T&& local_result)
+    {
+        return detail::node_aware_operations::gather_there(
+            comm, HPX_FORWARD(T, local_result));
+    }
+
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        node_aware_communicator const& comm, T&& local_result)
+    {
+        return detail::node_aware_operations::all_gather(
+            comm, HPX_FORWARD(T, local_result));
+    }
+
+    HPX_EXPORT hpx::future<void> barrier(node_aware_communicator const& comm);
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
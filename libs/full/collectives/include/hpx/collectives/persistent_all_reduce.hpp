@@ -0,0 +1,174 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file persistent_all_reduce.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/detail/all_reduce_algorithms.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    namespace detail {
+
+        template <typename T, typename F>
+        struct persistent_all_reduce_data
+        {
+            persistent_all_reduce_data(
+                hpx::collectives::channel_communicator&& comm,
+                std::vector<T>&& data, F&& op, all_reduce_algorithm algorithm)
+              : comm_(HPX_MOVE(comm))
+              , data_(HPX_MOVE(data))
+              , op_(HPX_MOVE(op))
+              , algorithm_(algorithm)
+            {
+            }
+
+            hpx::collectives::channel_communicator comm_;
+            std::vector<T> data_;
+            F op_;
+            all_reduce_algorithm algorithm_;
+            std::size_t generation_ = 0;
+            hpx::future<void> active_;
+        };
+    }    // namespace detail
+
+    /// A persistent all_reduce operation repeatedly combining the elements of
+    /// a buffer of fixed size over all sites of a channel communicator. The
+    /// buffer and the algorithm are set up once by
+    /// \a create_persistent_all_reduce, each iteration then consists of
+    /// filling the buffer, calling \a start, and calling \a wait.
+    template <typename T, typename F>
+    class persistent_all_reduce
+    {
+        using data_type = detail::persistent_all_reduce_data<T, F>;
+
+    public:
+        persistent_all_reduce() = default;
+
+        explicit persistent_all_reduce(
+            std::shared_ptr<data_type> data) noexcept
+          : data_(HPX_MOVE(data))
+        {
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !!data_;
+        }
+
+        /// The buffer holding the values to combine before \a start was
+        /// called and the combined values after \a wait has returned. It must
+        /// not be accessed while the operation is in flight.
+        [[nodiscard]] std::vector<T>& data() noexcept
+        {
+            HPX_ASSERT(data_ && !data_->active_.valid());
+            return data_->data_;
+        }
+
+        [[nodiscard]] std::vector<T> const& data() const noexcept
+        {
+            HPX_ASSERT(data_ && !data_->active_.valid());
+            return data_->data_;
+        }
+
+        /// The algorithm selected when the operation was set up
+        [[nodiscard]] all_reduce_algorithm get_algorithm() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return data_->algorithm_;
+        }
+
+        /// Start combining the values of the buffer with the values supplied
+        /// by all other sites. All sites have to start the operation the same
+        /// number of times.
+        void start()
+        {
+            HPX_ASSERT(data_ && !data_->active_.valid());
+
+            std::size_t const generation = ++data_->generation_;
+
+            // the algorithms exchange messages synchronously, run them on a
+            // separate thread
+            data_->active_ = hpx::async([data = data_, generation]() {
+                detail::all_reduce_vector(data->comm_, data->data_, data->op_,
+                    generation, data->algorithm_);
+            });
+        }
+
+        /// Wait for the operation started last to complete, rethrows any
+        /// exception that occurred while performing the operation
+        void wait()
+        {
+            HPX_ASSERT(data_ && data_->active_.valid());
+            data_->active_.get();
+        }
+
+        /// Return whether the operation started last has completed
+        [[nodiscard]] bool is_ready() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return !data_->active_.valid() || data_->active_.is_ready();
+        }
+
+    private:
+        std::shared_ptr<data_type> data_;
+    };
+
+    /// Set up a persistent all_reduce operation on the given channel
+    /// communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator. It must be used for
+    ///                     this persistent operation only.
+    /// \param  data        The buffer to combine with the buffers of all
+    ///                     participating sites. All sites have to supply
+    ///                     buffers of the same size, which must not change
+    ///                     between iterations.
+    /// \param  op          Associative and commutative reduction operation
+    ///                     to apply to the corresponding elements of the
+    ///                     buffers supplied from all participating sites
+    /// \param  algorithm   The algorithm to use. This value is optional and
+    ///                     defaults to selecting the algorithm based on the
+    ///                     size of the buffer and the number of participating
+    ///                     sites once, when the operation is set up.
+    ///
+    /// \returns    This function returns the handle of the persistent
+    ///             operation.
+    ///
+    template <typename T, typename F>
+    persistent_all_reduce<T, std::decay_t<F>> create_persistent_all_reduce(
+        channel_communicator comm, std::vector<T> data, F&& op,
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic)
+    {
+        using data_type =
+            detail::persistent_all_reduce_data<T, std::decay_t<F>>;
+
+        std::size_t const num_sites = comm.get_info().first;
+        algorithm = detail::select_all_reduce_algorithm(
+            algorithm, num_sites, data.size(), data.size() * sizeof(T));
+
+        return persistent_all_reduce<T, std::decay_t<F>>(
+            std::make_shared<data_type>(HPX_MOVE(comm), HPX_MOVE(data),
+                std::decay_t<F>(HPX_FORWARD(F, op)), algorithm));
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
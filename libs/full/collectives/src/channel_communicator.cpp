@@ -43,6 +43,15 @@ namespace hpx::collectives {
         comm_.reset();
     }
 
+    std::pair<num_sites_arg, this_site_arg> channel_communicator::get_info()
+        const noexcept
+    {
+        HPX_ASSERT(comm_);
+        auto const [num_sites, this_site] = comm_->get_info();
+        return std::make_pair(
+            num_sites_arg(num_sites), this_site_arg(this_site));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<channel_communicator> create_channel_communicator(
         char const* basename, num_sites_arg num_sites, this_site_arg this_site)
@@ -0,0 +1,122 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/node_aware_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/runtime_local/get_locality_name.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    node_aware_communicator create_node_aware_communicator(char const* basename,
+        num_sites_arg num_sites, this_site_arg this_site,
+        std::string const& node_name)
+    {
+        if (num_sites == static_cast<std::size_t>(-1))
+        {
+            num_sites = agas::get_num_localities(hpx::launch::sync);
+        }
+        if (this_site == static_cast<std::size_t>(-1))
+        {
+            this_site = agas::get_locality_id();
+        }
+
+        HPX_ASSERT(this_site < num_sites);
+        HPX_ASSERT(basename != nullptr && basename[0] != '\0');
+
+        std::string name = node_name;
+        if (name.empty())
+        {
+            // strip the locality id from the name of this locality
+            name = hpx::get_locality_name();
+            if (auto const pos = name.rfind('#'); pos != std::string::npos)
+            {
+                name.erase(pos);
+            }
+        }
+
+        // find out which sites run on the same node
+        std::string const base(basename);
+        std::vector<std::string> const node_names =
+            all_gather(create_communicator((base + "/nodes/").c_str(),
+                           num_sites, this_site),
+                HPX_MOVE(name), this_site)
+                .get();
+
+        HPX_ASSERT(node_names.size() == num_sites);
+
+        auto data = std::make_shared<detail::node_aware_communicator_data>();
+        data->num_sites_ = num_sites;
+        data->this_site_ = this_site;
+
+        // the nodes are numbered in the order of the first site running on
+        // them, which makes the first site the leader of the first node
+        std::map<std::string, std::size_t, std::less<>> nodes;
+        for (std::size_t site = 0; site != node_names.size(); ++site)
+        {
+            auto const [it, inserted] =
+                nodes.emplace(node_names[site], data->node_sites_.size());
+            if (inserted)
+            {
+                data->node_sites_.emplace_back();
+            }
+
+            auto& sites = data->node_sites_[it->second];
+            if (site == this_site)
+            {
+                data->this_node_ = it->second;
+                data->node_site_ = sites.size();
+            }
+            sites.push_back(site);
+        }
+        data->num_nodes_ = data->node_sites_.size();
+
+        if (data->num_node_sites() > 1)
+        {
+            data->node_ = create_communicator(
+                (base + "/node/" + std::to_string(data->this_node_) + "/")
+                    .c_str(),
+                num_sites_arg(data->num_node_sites()),
+                this_site_arg(data->node_site_));
+        }
+
+        if (data->num_nodes_ > 1 && data->is_node_leader())
+        {
+            data->leaders_ = create_communicator((base + "/leaders/").c_str(),
+                num_sites_arg(data->num_nodes_),
+                this_site_arg(data->this_node_));
+        }
+
+        return node_aware_communicator(HPX_MOVE(data));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<void> barrier(node_aware_communicator const& comm)
+    {
+        return all_reduce(comm, std::size_t(0), std::plus<>())
+            .then(hpx::launch::sync,
+                [](hpx::future<std::size_t>&& f) { f.get(); });
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
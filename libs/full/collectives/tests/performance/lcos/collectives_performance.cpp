@@ -0,0 +1,236 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Latency and bandwidth of the collective operations across all localities.
+// For every operation (all_reduce, broadcast, all_to_all) and every message
+// size (doubling from --min-size to --max-size bytes per locality) the
+// average time per operation is measured, the barrier is measured on its own.
+// Locality 0 prints one CSV line per operation and message size:
+//
+//   operation,localities,bytes,latency [us],bandwidth [MB/s]
+//
+// where the bandwidth is based on the number of bytes contributed by a single
+// locality per operation.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t iterations = 100;
+std::size_t warmup = 10;
+
+struct vector_plus
+{
+    std::vector<double> operator()(
+        std::vector<double> lhs, std::vector<double> const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+void print_result(char const* operation, std::uint32_t num_localities,
+    std::size_t bytes, double elapsed)
+{
+    if (hpx::get_locality_id() != 0)
+    {
+        return;
+    }
+
+    double const latency = elapsed / static_cast<double>(iterations);
+    std::cout << operation << "," << num_localities << "," << bytes << ","
+              << latency * 1e6 << ","
+              << (latency > 0 ? static_cast<double>(bytes) / latency / 1e6 : 0)
+              << std::endl;
+}
+
+// Run the given operation warmup + iterations times, the timed iterations
+// start synchronized on all localities.
+template <typename F>
+double run_timed(F&& f)
+{
+    for (std::size_t i = 0; i != warmup; ++i)
+    {
+        f();
+    }
+
+    hpx::distributed::barrier::synchronize();
+
+    hpx::chrono::high_resolution_timer const t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void all_reduce_benchmark(std::size_t bytes)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::string const basename =
+        "/perf/all_reduce/" + std::to_string(bytes) + "/";
+    auto const comm = create_communicator(basename.c_str(),
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    std::size_t const count = bytes / sizeof(double);
+    double const elapsed = run_timed([&]() {
+        all_reduce(comm, std::vector<double>(count, here), vector_plus{})
+            .get();
+    });
+
+    print_result("all_reduce", num_localities, count * sizeof(double), elapsed);
+}
+
+void broadcast_benchmark(std::size_t bytes)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::string const basename =
+        "/perf/broadcast/" + std::to_string(bytes) + "/";
+    auto const comm = create_communicator(basename.c_str(),
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    std::size_t const count = bytes / sizeof(double);
+    double const elapsed = run_timed([&]() {
+        if (here == 0)
+        {
+            broadcast_to(comm, std::vector<double>(count, 42.0)).get();
+        }
+        else
+        {
+            broadcast_from<std::vector<double>>(comm).get();
+        }
+    });
+
+    print_result("broadcast", num_localities, count * sizeof(double), elapsed);
+}
+
+void all_to_all_benchmark(std::size_t bytes)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::string const basename =
+        "/perf/all_to_all/" + std::to_string(bytes) + "/";
+    auto const comm = create_communicator(basename.c_str(),
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    // every locality sends bytes / num_localities to every other locality
+    std::size_t const count = (std::max)(
+        bytes / sizeof(double) / num_localities, static_cast<std::size_t>(1));
+    double const elapsed = run_timed([&]() {
+        std::vector<std::vector<double>> data(
+            num_localities, std::vector<double>(count, here));
+        all_to_all(comm, std::move(data)).get();
+    });
+
+    print_result("all_to_all", num_localities,
+        count * num_localities * sizeof(double), elapsed);
+}
+
+void barrier_benchmark()
+{
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    hpx::distributed::barrier b("/perf/barrier");
+    double const elapsed = run_timed([&]() { b.wait(); });
+
+    print_result("barrier", num_localities, 0, elapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    iterations = vm["iterations"].as<std::size_t>();
+    warmup = vm["warmup"].as<std::size_t>();
+
+    std::size_t const min_size =
+        (std::max)(vm["min-size"].as<std::size_t>(), sizeof(double));
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << "operation,localities,bytes,latency [us],"
+                     "bandwidth [MB/s]"
+                  << std::endl;
+    }
+
+    for (std::size_t bytes = min_size; bytes <= max_size; bytes *= 2)
+    {
+        all_reduce_benchmark(bytes);
+    }
+    for (std::size_t bytes = min_size; bytes <= max_size; bytes *= 2)
+    {
+        broadcast_benchmark(bytes);
+    }
+    for (std::size_t bytes = min_size; bytes <= max_size; bytes *= 2)
+    {
+        all_to_all_benchmark(bytes);
+    }
+    barrier_benchmark();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "number of timed iterations per operation and message size "
+         "(default: 100)")
+        ("warmup",
+         hpx::program_options::value<std::size_t>()->default_value(10),
+         "number of untimed iterations per operation and message size "
+         "(default: 10)")
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(8),
+         "smallest message size in bytes per locality (default: 8)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(1 << 20),
+         "largest message size in bytes per locality (default: 1MB)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1", "hpx.os_threads!=all"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
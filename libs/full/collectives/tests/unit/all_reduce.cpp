@@ -12,7 +12,9 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -158,6 +160,73 @@ void test_local_use()
     hpx::wait_all(std::move(sites));
 }
 
+void test_channel_use(
+    std::size_t num_sites, std::size_t count, all_reduce_algorithm algorithm)
+{
+    std::string const basename = "/test/all_reduce_channel/" +
+        std::to_string(num_sites) + "/" + std::to_string(count) + "/" +
+        std::to_string(static_cast<int>(algorithm)) + "/";
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            for (std::size_t i = 0; i != 10; ++i)
+            {
+                std::vector<std::size_t> values(count);
+                for (std::size_t j = 0; j != count; ++j)
+                {
+                    values[j] = site * j + i;
+                }
+
+                hpx::future<std::vector<std::size_t>> result =
+                    all_reduce(comm, std::move(values), std::plus<>{},
+                        generation_arg(i + 1), algorithm);
+
+                std::vector<std::size_t> const data = result.get();
+                HPX_TEST_EQ(data.size(), count);
+                for (std::size_t j = 0; j != data.size(); ++j)
+                {
+                    HPX_TEST_EQ(data[j],
+                        j * num_sites * (num_sites - 1) / 2 + num_sites * i);
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_channel_use()
+{
+    for (std::size_t num_sites : {1, 2, 3, 4, 5, 7, 8})
+    {
+        for (all_reduce_algorithm algorithm :
+            {all_reduce_algorithm::recursive_doubling,
+                all_reduce_algorithm::ring, all_reduce_algorithm::rabenseifner})
+        {
+            // less, equal, and more elements than sites
+            test_channel_use(num_sites, 3, algorithm);
+            test_channel_use(num_sites, 8, algorithm);
+            test_channel_use(num_sites, 37, algorithm);
+        }
+
+        // large enough for automatically selecting a bandwidth-optimal
+        // algorithm
+        test_channel_use(num_sites,
+            2 * HPX_COLLECTIVES_ALL_REDUCE_SMALL_MESSAGE_SIZE /
+                sizeof(std::size_t),
+            all_reduce_algorithm::automatic);
+    }
+}
+
 int hpx_main()
 {
 #if defined(HPX_HAVE_NETWORKING)
@@ -172,6 +241,7 @@ int hpx_main()
     if (hpx::get_locality_id() == 0)
     {
         test_local_use();
+        test_channel_use();
     }
 
     return hpx::finalize();
@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <string>
@@ -170,6 +171,82 @@ void test_local_use()
     hpx::wait_all(std::move(sites));
 }
 
+void test_channel_use(std::size_t num_sites, all_to_all_algorithm algorithm)
+{
+    std::string const basename = "/test/all_to_all_channel/" +
+        std::to_string(num_sites) + "/" +
+        std::to_string(static_cast<int>(algorithm)) + "/";
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            for (std::size_t i = 0; i != 10; ++i)
+            {
+                // the value sent from site s to site d encodes both
+                std::vector<std::size_t> values(num_sites);
+                for (std::size_t d = 0; d != num_sites; ++d)
+                {
+                    values[d] = (site * num_sites + d) * 10 + i;
+                }
+
+                std::vector<std::size_t> const r =
+                    all_to_all(comm, std::move(values),
+                        generation_arg(2 * i + 1), algorithm)
+                        .get();
+                HPX_TEST_EQ(r.size(), num_sites);
+                for (std::size_t s = 0; s != r.size(); ++s)
+                {
+                    HPX_TEST_EQ(r[s], (s * num_sites + site) * 10 + i);
+                }
+
+                // site s sends s + d values to site d
+                std::vector<std::vector<std::size_t>> blocks(num_sites);
+                for (std::size_t d = 0; d != num_sites; ++d)
+                {
+                    blocks[d].assign(site + d, site * num_sites + d + i);
+                }
+
+                std::vector<std::vector<std::size_t>> const rv =
+                    all_to_allv(comm, std::move(blocks),
+                        generation_arg(2 * i + 2))
+                        .get();
+                HPX_TEST_EQ(rv.size(), num_sites);
+                for (std::size_t s = 0; s != rv.size(); ++s)
+                {
+                    HPX_TEST_EQ(rv[s].size(), s + site);
+                    for (std::size_t v : rv[s])
+                    {
+                        HPX_TEST_EQ(v, s * num_sites + site + i);
+                    }
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_channel_use()
+{
+    for (std::size_t num_sites : {1, 2, 3, 4, 5, 7, 8})
+    {
+        for (all_to_all_algorithm algorithm :
+            {all_to_all_algorithm::automatic, all_to_all_algorithm::pairwise,
+                all_to_all_algorithm::bruck})
+        {
+            test_channel_use(num_sites, algorithm);
+        }
+    }
+}
+
 int hpx_main()
 {
 #if defined(HPX_HAVE_NETWORKING)
@@ -184,6 +261,7 @@ int hpx_main()
     if (hpx::get_locality_id() == 0)
     {
         test_local_use();
+        test_channel_use();
     }
 
     return hpx::finalize();
@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <string>
@@ -179,6 +180,72 @@ void test_local_use()
     hpx::wait_all(std::move(sites));
 }
 
+void test_channel_use(
+    std::size_t num_sites, std::size_t count, std::size_t root)
+{
+    std::string const basename = "/test/broadcast_channel/" +
+        std::to_string(num_sites) + "/" + std::to_string(count) + "/" +
+        std::to_string(root) + "/";
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            for (std::size_t i = 0; i != 10; ++i)
+            {
+                std::vector<std::uint32_t> data;
+                if (site == root)
+                {
+                    data.resize(count);
+                    for (std::size_t j = 0; j != count; ++j)
+                    {
+                        data[j] = static_cast<std::uint32_t>(j + i);
+                    }
+
+                    // use small segments to exercise the pipeline
+                    data = broadcast_to(comm, std::move(data),
+                        generation_arg(i + 1), segment_size_arg(64))
+                               .get();
+                }
+                else
+                {
+                    data = broadcast_from<std::vector<std::uint32_t>>(
+                        comm, generation_arg(i + 1), root_site_arg(root))
+                               .get();
+                }
+
+                HPX_TEST_EQ(data.size(), count);
+                for (std::size_t j = 0; j != data.size(); ++j)
+                {
+                    HPX_TEST_EQ(data[j], static_cast<std::uint32_t>(j + i));
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_channel_use()
+{
+    for (std::size_t num_sites : {1, 2, 3, 5, 8})
+    {
+        // single segment (binomial tree) and pipelined segments (chain)
+        for (std::size_t count : {0, 7, 1000})
+        {
+            test_channel_use(num_sites, count, 0);
+            test_channel_use(num_sites, count, num_sites - 1);
+        }
+    }
+}
+
 int hpx_main()
 {
 #if defined(HPX_HAVE_NETWORKING)
@@ -193,6 +260,7 @@ int hpx_main()
     if (hpx::get_locality_id() == 0)
     {
         test_local_use();
+        test_channel_use();
     }
 
     return hpx::finalize();
@@ -0,0 +1,165 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> f2_count(0);
+
+struct test_component : hpx::components::component_base<test_component>
+{
+    explicit test_component(std::uint32_t value = 0)
+      : value_(value)
+    {
+    }
+
+    std::uint32_t f1(std::uint32_t i) const
+    {
+        return value_ + i;
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_component, f1)
+
+    void f2() const
+    {
+        ++f2_count;
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_component, f2)
+
+    std::uint32_t value_;
+};
+
+using test_component_type = hpx::components::component<test_component>;
+HPX_REGISTER_COMPONENT(test_component_type, test_component)
+
+using f1_action = test_component::f1_action;
+HPX_REGISTER_ACTION_DECLARATION(f1_action)
+HPX_REGISTER_ACTION(f1_action)
+
+using f2_action = test_component::f2_action;
+HPX_REGISTER_ACTION_DECLARATION(f2_action)
+HPX_REGISTER_ACTION(f2_action)
+
+HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(f1_action)
+HPX_REGISTER_BULK_ASYNC_ACTION(f1_action)
+
+HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(f2_action)
+HPX_REGISTER_BULK_ASYNC_ACTION(f2_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t f3(std::uint32_t i)
+{
+    return hpx::get_locality_id() + i;
+}
+HPX_PLAIN_ACTION(f3)
+
+HPX_REGISTER_BULK_ASYNC_ACTION_DECLARATION(f3_action)
+HPX_REGISTER_BULK_ASYNC_ACTION(f3_action)
+
+std::size_t get_f2_count()
+{
+    return f2_count.exchange(0);
+}
+HPX_PLAIN_ACTION(get_f2_count)
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::uint32_t num_components = 100;
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    // interleave the components created on the localities
+    std::vector<hpx::id_type> ids;
+    for (std::uint32_t i = 0; i != num_components; ++i)
+    {
+        ids.push_back(
+            hpx::new_<test_component>(localities[i % localities.size()], i)
+                .get());
+    }
+
+    {
+        std::vector<std::uint32_t> const result =
+            hpx::lcos::bulk_async<f1_action>(ids, 42u).get();
+
+        HPX_TEST_EQ(result.size(), ids.size());
+        for (std::uint32_t i = 0; i != num_components; ++i)
+        {
+            HPX_TEST_EQ(result[i], i + 42u);
+        }
+    }
+
+    {
+        f1_action act;
+        std::vector<std::uint32_t> const result =
+            hpx::lcos::bulk_async(act, ids, 0u).get();
+
+        HPX_TEST_EQ(result.size(), ids.size());
+        for (std::uint32_t i = 0; i != num_components; ++i)
+        {
+            HPX_TEST_EQ(result[i], i);
+        }
+    }
+
+    {
+        hpx::lcos::bulk_async<f2_action>(ids).get();
+
+        std::size_t count = 0;
+        for (hpx::id_type const& id : localities)
+        {
+            count += hpx::async<get_f2_count_action>(id).get();
+        }
+        HPX_TEST_EQ(count, static_cast<std::size_t>(num_components));
+    }
+
+    {
+        std::vector<std::uint32_t> const result =
+            hpx::lcos::bulk_async<f3_action>(localities, 1u).get();
+
+        HPX_TEST_EQ(result.size(), localities.size());
+        for (std::size_t i = 0; i != localities.size(); ++i)
+        {
+            HPX_TEST_EQ(result[i],
+                hpx::naming::get_locality_id_from_id(localities[i]) + 1);
+        }
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::lcos::bulk_async<f1_action>(std::vector<hpx::id_type>(), 0u)
+                .get();
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,140 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_MODULE_ASYNC_MPI) && !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/async_mpi.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr int ITERATIONS = 10;
+
+void test_mpi_communicator()
+{
+    auto const comm = create_mpi_communicator();
+    auto const [num_sites, this_site] = comm.get_info();
+
+    HPX_TEST_EQ(static_cast<std::size_t>(this_site),
+        static_cast<std::size_t>(hpx::get_locality_id()));
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        // all_reduce
+        std::uint64_t const sum =
+            all_reduce(comm, std::uint64_t(this_site + i), std::plus<>())
+                .get();
+        HPX_TEST_EQ(sum, num_sites * (num_sites - 1) / 2 + num_sites * i);
+
+        int const max = all_reduce(comm, int(this_site), MPI_MAX).get();
+        HPX_TEST_EQ(max, int(num_sites - 1));
+
+        std::vector<double> const values =
+            all_reduce(comm, std::vector<double>(37, double(this_site + 1)),
+                std::multiplies<>())
+                .get();
+        double product = 1.0;
+        for (std::size_t s = 0; s != num_sites; ++s)
+        {
+            product *= double(s + 1);
+        }
+        HPX_TEST_EQ(values.size(), std::size_t(37));
+        for (double v : values)
+        {
+            HPX_TEST_EQ(v, product);
+        }
+
+        // broadcast
+        std::size_t const root = i % num_sites;
+        if (this_site == root)
+        {
+            broadcast_to(comm, 42 + i).get();
+            broadcast_to(comm, std::vector<int>(i + 1, i)).get();
+        }
+        else
+        {
+            HPX_TEST_EQ(
+                broadcast_from<int>(comm, root_site_arg(root)).get(), 42 + i);
+
+            std::vector<int> const data =
+                broadcast_from<std::vector<int>>(comm, root_site_arg(root))
+                    .get();
+            HPX_TEST_EQ(data.size(), std::size_t(i + 1));
+            for (int v : data)
+            {
+                HPX_TEST_EQ(v, i);
+            }
+        }
+
+        // gather
+        if (this_site == root)
+        {
+            std::vector<int> const data =
+                gather_here(comm, int(this_site + i)).get();
+            HPX_TEST_EQ(data.size(), std::size_t(num_sites));
+            for (std::size_t s = 0; s != data.size(); ++s)
+            {
+                HPX_TEST_EQ(data[s], int(s + i));
+            }
+        }
+        else
+        {
+            gather_there(comm, int(this_site + i), root_site_arg(root)).get();
+        }
+
+        // all_gather
+        std::vector<std::uint32_t> const sites =
+            all_gather(comm, std::uint32_t(this_site)).get();
+        HPX_TEST_EQ(sites.size(), std::size_t(num_sites));
+        for (std::size_t s = 0; s != sites.size(); ++s)
+        {
+            HPX_TEST_EQ(sites[s], std::uint32_t(s));
+        }
+
+        barrier(comm).get();
+    }
+}
+
+int hpx_main()
+{
+    {
+        // the MPI requests are completed by the scheduler's polling
+        hpx::mpi::experimental::enable_user_polling enable_polling;
+        test_mpi_communicator();
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,150 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* node_aware_basename = "/test/node_aware_communicator/";
+constexpr int ITERATIONS = 10;
+
+void test_node_aware_operations(
+    node_aware_communicator const& comm, std::size_t num_sites)
+{
+    std::size_t const this_site = comm.get_info().second;
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        // all_reduce
+        std::size_t const sum =
+            all_reduce(comm, this_site + i, std::plus<>()).get();
+        HPX_TEST_EQ(sum, num_sites * (num_sites - 1) / 2 + num_sites * i);
+
+        // broadcast
+        if (this_site == 0)
+        {
+            HPX_TEST_EQ(broadcast_to(comm, std::size_t(42 + i)).get(),
+                std::size_t(42 + i));
+        }
+        else
+        {
+            HPX_TEST_EQ(
+                broadcast_from<std::size_t>(comm).get(), std::size_t(42 + i));
+        }
+
+        // gather
+        if (this_site == 0)
+        {
+            std::vector<std::size_t> const values =
+                gather_here(comm, this_site + i).get();
+            HPX_TEST_EQ(values.size(), num_sites);
+            for (std::size_t j = 0; j != values.size(); ++j)
+            {
+                HPX_TEST_EQ(values[j], j + i);
+            }
+        }
+        else
+        {
+            gather_there(comm, this_site + i).get();
+        }
+
+        // all_gather
+        std::vector<std::size_t> const values =
+            all_gather(comm, this_site + i).get();
+        HPX_TEST_EQ(values.size(), num_sites);
+        for (std::size_t j = 0; j != values.size(); ++j)
+        {
+            HPX_TEST_EQ(values[j], j + i);
+        }
+
+        // barrier
+        barrier(comm).get();
+    }
+}
+
+void test_local_use()
+{
+    constexpr std::size_t num_sites = 8;
+    constexpr std::size_t num_nodes = 3;
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites, the sites are
+    // assigned to the (simulated) nodes in a round-robin fashion
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto const comm = create_node_aware_communicator(
+                node_aware_basename, num_sites_arg(num_sites),
+                this_site_arg(site),
+                "node" + std::to_string(site % num_nodes));
+
+            HPX_TEST_EQ(comm.get_num_nodes(), num_nodes);
+            HPX_TEST_EQ(comm.is_node_leader(), site < num_nodes);
+
+            test_node_aware_operations(comm, num_sites);
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_remote_use()
+{
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    // group the localities by the node they run on
+    auto const comm = create_node_aware_communicator(
+        "/test/node_aware_communicator/remote/");
+
+    HPX_TEST_LTE(comm.get_num_nodes(), num_localities);
+
+    test_node_aware_operations(comm, num_localities);
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_NETWORKING)
+    if (hpx::get_num_localities(hpx::launch::sync) > 1)
+    {
+        test_remote_use();
+    }
+#endif
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_local_use();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,109 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr int ITERATIONS = 20;
+
+void test_persistent_all_reduce(
+    std::size_t num_sites, std::size_t count, all_reduce_algorithm algorithm)
+{
+    std::string const basename = "/test/persistent_all_reduce/" +
+        std::to_string(num_sites) + "/" + std::to_string(count) + "/" +
+        std::to_string(static_cast<int>(algorithm)) + "/";
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            auto op = create_persistent_all_reduce(comm,
+                std::vector<std::size_t>(count), std::plus<>(), algorithm);
+
+            HPX_TEST(op.is_ready());
+            if (algorithm != all_reduce_algorithm::automatic)
+            {
+                HPX_TEST(op.get_algorithm() != all_reduce_algorithm::automatic);
+            }
+
+            for (std::size_t i = 0; i != ITERATIONS; ++i)
+            {
+                std::vector<std::size_t>& values = op.data();
+                HPX_TEST_EQ(values.size(), count);
+                for (std::size_t j = 0; j != count; ++j)
+                {
+                    values[j] = site * j + i;
+                }
+
+                op.start();
+                op.wait();
+
+                std::vector<std::size_t> const& data = op.data();
+                HPX_TEST_EQ(data.size(), count);
+                for (std::size_t j = 0; j != data.size(); ++j)
+                {
+                    HPX_TEST_EQ(data[j],
+                        j * num_sites * (num_sites - 1) / 2 + num_sites * i);
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+int hpx_main()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t num_sites : {1, 2, 3, 4, 6})
+        {
+            for (all_reduce_algorithm algorithm :
+                {all_reduce_algorithm::automatic,
+                    all_reduce_algorithm::recursive_doubling,
+                    all_reduce_algorithm::ring,
+                    all_reduce_algorithm::rabenseifner})
+            {
+                test_persistent_all_reduce(num_sites, 17, algorithm);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
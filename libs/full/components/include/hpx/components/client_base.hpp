@@ -13,7 +13,9 @@
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components/components_fwd.hpp>
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/components_base/stub_base.hpp>
+#include <hpx/components_base/traits/component_supports_migration.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -22,6 +24,7 @@
 #include <hpx/memory/intrusive_ptr.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/naming_base/address.hpp>
 #include <hpx/serialization/serialize.hpp>
 
 #include <exception>
@@ -175,6 +178,14 @@ namespace hpx::lcos::detail {
 
     // default extra data stored in the shared state for a client
     using registered_name_tracker = std::string;
+
+    // extra data stored in the shared state of a client which has cached the
+    // local address of the object it refers to (see client_base::pin)
+    struct pinned_address_tracker
+    {
+        naming::address addr_;
+        components::pinned_ptr pin_;
+    };
 }    // namespace hpx::lcos::detail
 
 // This is explicitly instantiated to ensure that the id is stable across shared
@@ -187,6 +198,14 @@ struct hpx::util::extra_data_helper<hpx::lcos::detail::registered_name_tracker>
         lcos::detail::registered_name_tracker*) noexcept;
 };    // namespace hpx::util
 
+template <>
+struct hpx::util::extra_data_helper<hpx::lcos::detail::pinned_address_tracker>
+{
+    HPX_EXPORT static extra_data_id_type id() noexcept;
+    HPX_EXPORT static void reset(
+        lcos::detail::pinned_address_tracker*) noexcept;
+};    // namespace hpx::util
+
 // Specialization for shared state of id_type, additionally (optionally) holds a
 // registered name for the object it refers to.
 template <>
@@ -629,6 +648,88 @@ namespace hpx::components {
                 *this, HPX_MOVE(symbolic_name), manage_lifetime);
         }
 
+        // Cache the local address of the object this client refers to and
+        // pin the object, if needed, to prevent it from being migrated. All
+        // actions invoked through this client (and its copies) are invoked
+        // directly using the cached address until unpin() is called. Returns
+        // false if the object is not local (in which case nothing is cached).
+        // This must not be called concurrently with invoking actions through
+        // this client.
+        bool pin()
+        {
+            if (!shared_state_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_state, "client_base::pin",
+                    "this client_base has no valid shared state");
+            }
+
+            auto& tracker =
+                get_extra_data<lcos::detail::pinned_address_tracker>();
+            if (tracker.addr_)
+            {
+                return true;    // already pinned
+            }
+
+            hpx::id_type const& id = get_id();
+            naming::address addr;
+
+            if constexpr (traits::component_supports_migration<
+                              server_component_type>::call())
+            {
+                std::pair<bool, components::pinned_ptr> r;
+                auto f = [&id](naming::address const& addr) {
+                    return server_component_type::was_object_migrated(
+                        id.get_gid(), addr.address_);
+                };
+
+                if (!agas::is_local_address_cached(id, addr, r, HPX_MOVE(f)) ||
+                    r.first)
+                {
+                    return false;
+                }
+                tracker.pin_ = HPX_MOVE(r.second);
+            }
+            else
+            {
+                // the address of non-migratable objects is stable as long as
+                // the object is alive
+                if (!agas::is_local_address_cached(id, addr))
+                {
+                    return false;
+                }
+            }
+
+            tracker.addr_ = HPX_MOVE(addr);
+            return true;
+        }
+
+        // Release the pin acquired by pin() and drop the cached address
+        void unpin() noexcept
+        {
+            if (shared_state_)
+            {
+                hpx::util::reset_extra_data(
+                    try_get_extra_data<lcos::detail::pinned_address_tracker>());
+            }
+        }
+
+        // Return the cached local address of the object this client refers
+        // to, might return nullptr if the client was not pinned
+        [[nodiscard]] naming::address const* get_pinned_address()
+            const noexcept
+        {
+            if (shared_state_)
+            {
+                if (auto const* tracker = try_get_extra_data<
+                        lcos::detail::pinned_address_tracker>();
+                    tracker != nullptr && tracker->addr_)
+                {
+                    return &tracker->addr_;
+                }
+            }
+            return nullptr;
+        }
+
         // Retrieve the id associated with the given name and use it to
         // initialize this client_base instance.
         void connect_to(std::string const& symbolic_name)
@@ -39,6 +39,23 @@ namespace hpx::util {
             agas::unregister_name(launch::sync, name, ec);
         }
     }
+
+    extra_data_id_type
+    extra_data_helper<lcos::detail::pinned_address_tracker>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+
+    void extra_data_helper<lcos::detail::pinned_address_tracker>::reset(
+        lcos::detail::pinned_address_tracker* tracker) noexcept
+    {
+        if (tracker != nullptr)
+        {
+            tracker->addr_ = naming::address();
+            tracker->pin_ = components::pinned_ptr();
+        }
+    }
 }    // namespace hpx::util
 
 namespace hpx::lcos::detail {
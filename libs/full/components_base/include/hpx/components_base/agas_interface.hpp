@@ -49,6 +49,12 @@ namespace hpx::agas {
     HPX_EXPORT hpx::future<bool> register_name(
         std::string const& name, hpx::id_type const& id);
 
+    /// Register all given names using one request for each of the localities
+    /// managing any of them. The returned future holds whether each of the
+    /// names was registered.
+    HPX_EXPORT hpx::future<std::vector<bool>> register_names(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries);
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_EXPORT hpx::id_type unregister_name(
         launch::sync_policy, std::string const& name, error_code& ec = throws);
@@ -179,6 +185,16 @@ namespace hpx::agas {
     HPX_EXPORT bool resolve_cached(
         naming::gid_type const& gid, naming::address& addr);
 
+    /// Resolve all given ids using a single request to each of the AGAS
+    /// service instances managing the ids not found in the local cache.
+    HPX_EXPORT hpx::future<std::vector<naming::address>> resolve(
+        std::vector<hpx::id_type> const& ids);
+
+    /// Store the addresses of all given ids in the local AGAS cache using a
+    /// single request to each of the AGAS service instances managing them.
+    /// Ids which can't be resolved are skipped.
+    HPX_EXPORT hpx::future<void> prefetch(std::vector<hpx::id_type> const& ids);
+
     HPX_EXPORT hpx::future<bool> bind(naming::gid_type const& gid,
         naming::address const& addr, std::uint32_t locality_id);
 
@@ -193,6 +209,13 @@ namespace hpx::agas {
         naming::address const& addr, naming::gid_type const& locality_,
         error_code& ec = throws);
 
+    /// Bind all given gids to the corresponding addresses using a single
+    /// request to each of the AGAS service instances managing them. The
+    /// future refers to true if all gids were bound.
+    HPX_EXPORT hpx::future<bool> bind(std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality_);
+
     HPX_EXPORT hpx::future<naming::address> unbind(
         naming::gid_type const& gid, std::uint64_t count = 1);
 
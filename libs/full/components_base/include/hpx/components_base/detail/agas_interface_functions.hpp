@@ -40,6 +40,9 @@ namespace hpx::agas::detail {
     extern HPX_EXPORT future<bool> (*register_name_async)(
         std::string const& name, hpx::id_type const& id);
 
+    extern HPX_EXPORT future<std::vector<bool>> (*register_names_async)(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT hpx::id_type (*unregister_name)(
         std::string const& name, error_code& ec);
@@ -127,6 +130,12 @@ namespace hpx::agas::detail {
     extern HPX_EXPORT bool (*resolve_cached)(
         naming::gid_type const& gid, naming::address& addr);
 
+    extern HPX_EXPORT hpx::future<std::vector<naming::address>> (
+        *resolve_async_bulk)(std::vector<hpx::id_type> const& ids);
+
+    extern HPX_EXPORT hpx::future<void> (*prefetch)(
+        std::vector<hpx::id_type> const& ids);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT hpx::future<bool> (*bind_async)(
         naming::gid_type const& gid, naming::address const& addr,
@@ -143,6 +152,11 @@ namespace hpx::agas::detail {
         naming::address const& addr, naming::gid_type const& locality_,
         error_code& ec);
 
+    extern HPX_EXPORT hpx::future<bool> (*bind_async_bulk)(
+        std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality_);
+
     extern HPX_EXPORT hpx::future<naming::address> (*unbind_async)(
         naming::gid_type const& gid, std::uint64_t count);
 
@@ -102,6 +102,7 @@ namespace hpx::components {
         {
             if (this != &rhs)
             {
+                delete data_;
                 data_ = rhs.data_;
                 rhs.data_ = nullptr;
             }
@@ -121,6 +121,13 @@ namespace hpx { namespace components { namespace server {
 
     ///////////////////////////////////////////////////////////////////////////
     /// Create count components and forward the passed parameters
+    ///
+    /// The component type is checked and the instance count is updated only
+    /// once for all created components. The components are allocated one by
+    /// one from the component heap as not all heaps support allocating
+    /// arbitrary numbers of objects at once (the heaps of managed components
+    /// hand out consecutive elements of their memory pools and bind the whole
+    /// pool as a single range of global ids).
     template <typename Component, typename... Ts>
     std::vector<naming::gid_type> bulk_create(std::size_t count, Ts&&... ts)
     {
@@ -138,44 +145,56 @@ namespace hpx { namespace components { namespace server {
 
         gids.reserve(count);
 
-        Component* storage =
-            static_cast<Component*>(component_heap<Component>().alloc(count));
-        Component* storage_it = storage;
-        std::size_t succeeded = 0;
+        auto& heap = component_heap<Component>();
+        std::vector<Component*> components;
+        components.reserve(count);
+
         try
         {
             // Call constructors and try to get the GID...
-            for (std::size_t i = 0; i != count; ++i, ++storage_it)
+            for (std::size_t i = 0; i != count; ++i)
             {
+                void* storage = heap.alloc(1);
+
                 Component* c = nullptr;
-                c = new (storage_it) Component(ts...);
+                try
+                {
+                    c = new (storage) Component(ts...);
+                }
+                catch (...)
+                {
+                    heap.free(storage, 1);
+                    throw;
+                }
+
                 naming::gid_type gid = c->get_base_gid();
                 if (!gid)
                 {
                     c->finalize();
                     std::destroy_at(c);
+                    heap.free(c, 1);
+
                     HPX_THROW_EXCEPTION(hpx::error::unknown_component_address,
                         "bulk_create<Component>", "can't assign global id");
                 }
+
                 gids.emplace_back(HPX_MOVE(gid));
-                ++instance_count(type);
-                ++succeeded;
+                components.push_back(c);
             }
         }
         catch (...)
         {
             // If an exception was thrown, roll back
-            storage_it = storage;
-            for (std::size_t i = 0; i != succeeded; ++i, ++storage_it)
+            for (Component* c : components)
             {
-                storage_it->finalize();
-                std::destroy_at(storage_it);
-                --instance_count(type);
+                c->finalize();
+                std::destroy_at(c);
+                heap.free(c, 1);
             }
-            component_heap<Component>().free(storage, count);
             throw;
         }
 
+        instance_count(type) += static_cast<long>(count);
         return gids;
     }
 }}}    // namespace hpx::components::server
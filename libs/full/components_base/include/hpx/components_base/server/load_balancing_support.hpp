@@ -0,0 +1,185 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/get_lva.hpp>
+#include <hpx/components_base/traits/action_decorate_function.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/one_shot.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace hpx::components {
+
+    /// This hook can be inserted into the derivation chain of any component
+    /// to make it visible to the load balancer (see
+    /// hpx::components::load_balancer). It measures the time spent executing
+    /// actions on each instance and keeps a registry of all instances of the
+    /// component type living on this locality.
+    ///
+    /// As the load balancer migrates the component instances, this hook is
+    /// usually layered on top of migration_support:
+    ///
+    ///     struct server
+    ///       : load_balancing_support<
+    ///             migration_support<component_base<server>>>
+    ///
+    /// The measured time is the wall clock time between starting and
+    /// finishing the execution of an action, including the time the HPX
+    /// thread executing the action was suspended.
+    template <typename BaseComponent>
+    struct load_balancing_support : BaseComponent
+    {
+    private:
+        using base_type = BaseComponent;
+
+    public:
+        using this_component_type = typename base_type::this_component_type;
+
+    private:
+        struct registry
+        {
+            hpx::spinlock mtx_;
+            std::unordered_set<load_balancing_support*> instances_;
+        };
+
+        static registry& get_registry()
+        {
+            static registry r;
+            return r;
+        }
+
+        void register_instance()
+        {
+            registry& r = get_registry();
+            std::lock_guard<hpx::spinlock> l(r.mtx_);
+            r.instances_.insert(this);
+        }
+
+        void unregister_instance()
+        {
+            registry& r = get_registry();
+            std::lock_guard<hpx::spinlock> l(r.mtx_);
+            r.instances_.erase(this);
+        }
+
+    public:
+        load_balancing_support()
+        {
+            register_instance();
+        }
+
+        template <typename T, typename... Ts,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<T>, load_balancing_support>>>
+        explicit load_balancing_support(T&& t, Ts&&... ts)
+          : base_type(HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...)
+        {
+            register_instance();
+        }
+
+        // the measured load is not carried over to copies (or migrated
+        // instances)
+        load_balancing_support(load_balancing_support const& rhs)
+          : base_type(static_cast<base_type const&>(rhs))
+        {
+            register_instance();
+        }
+        load_balancing_support(load_balancing_support&& rhs)
+          : base_type(static_cast<base_type&&>(rhs))
+        {
+            register_instance();
+        }
+
+        load_balancing_support& operator=(load_balancing_support const& rhs)
+        {
+            base_type::operator=(static_cast<base_type const&>(rhs));
+            return *this;
+        }
+        load_balancing_support& operator=(load_balancing_support&& rhs)
+        {
+            base_type::operator=(static_cast<base_type&&>(rhs));
+            return *this;
+        }
+
+        ~load_balancing_support()
+        {
+            unregister_instance();
+        }
+
+        // Return the time (in nanoseconds) spent executing actions on this
+        // instance since the last call to reset_busy_time()
+        [[nodiscard]] std::uint64_t busy_time() const noexcept
+        {
+            return busy_time_.load(std::memory_order_relaxed);
+        }
+
+        // Return the time (in nanoseconds) spent executing actions on this
+        // instance and restart the measurement
+        std::uint64_t reset_busy_time() noexcept
+        {
+            return busy_time_.exchange(0, std::memory_order_relaxed);
+        }
+
+        // Invoke the given function for all instances of this component type
+        // which currently live on this locality. The function is invoked
+        // while holding a spinlock, it must not suspend.
+        template <typename F>
+        static void for_each_instance(F&& f)
+        {
+            registry& r = get_registry();
+            std::lock_guard<hpx::spinlock> l(r.mtx_);
+            for (load_balancing_support* instance : r.instances_)
+            {
+                f(static_cast<this_component_type&>(*instance));
+            }
+        }
+
+        using decorates_action = void;
+
+        // This is the hook implementation for decorate_action which measures
+        // the time spent executing the action on this instance.
+        template <typename F>
+        static threads::thread_function_type decorate_action(
+            naming::address_type lva, F&& f)
+        {
+            return util::one_shot(
+                hpx::bind_front(&load_balancing_support::thread_function,
+                    get_lva<this_component_type>::call(lva),
+                    traits::component_decorate_function<base_type>::call(
+                        lva, HPX_FORWARD(F, f))));
+        }
+
+    protected:
+        // Execute the wrapped action. This function is bound in
+        // decorate_action above.
+        threads::thread_result_type thread_function(
+            threads::thread_function_type&& f,
+            threads::thread_restart_state state)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            threads::thread_result_type result = f(state);
+            busy_time_.fetch_add(
+                hpx::chrono::high_resolution_clock::now() - start,
+                std::memory_order_relaxed);
+            return result;
+        }
+
+    private:
+        std::atomic<std::uint64_t> busy_time_{0};
+    };
+}    // namespace hpx::components
@@ -81,9 +81,11 @@ namespace hpx::components {
     {
     private:
         using base_type = BaseComponent;
-        using this_component_type = typename base_type::this_component_type;
 
     public:
+        // exposed to allow for other hooks to be layered on top of this one
+        using this_component_type = typename base_type::this_component_type;
+
         migration_support() noexcept
           : data_(new detail::migration_support_data<Mutex>(), false)
         {
@@ -10,9 +10,11 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/server/wrapper_heap_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -59,6 +61,7 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(nullptr)
           , parameters_({0, 0, 0})
+          , num_thread_caches_(0)
         {
             HPX_ASSERT(false);    // shouldn't ever be called
         }
@@ -75,6 +78,7 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , num_thread_caches_(0)
         {
         }
 
@@ -90,6 +94,7 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , num_thread_caches_(0)
         {
         }
 
@@ -125,6 +130,26 @@ namespace hpx { namespace util {
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        // Each worker thread allocates from its own heap and keeps the
+        // elements it has freed for reuse, neither requires acquiring the
+        // lock protecting the list of heaps. The elements stay part of the
+        // heap which allocated them, the AGAS registration of the heaps is
+        // not affected.
+        struct thread_cache
+        {
+            std::shared_ptr<util::wrapper_heap_base> heap;
+            void* free_list = nullptr;
+            std::size_t free_count = 0;
+        };
+
+        thread_cache* get_thread_cache() const noexcept;
+        void init_thread_caches();
+
+        std::unique_ptr<util::cache_aligned_data<thread_cache>[]>
+            thread_caches_;
+        std::atomic<std::size_t> num_thread_caches_;
     };
 }}    // namespace hpx::util
 
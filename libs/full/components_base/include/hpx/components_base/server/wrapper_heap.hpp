@@ -9,6 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/memory_statistics.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/server/wrapper_heap_base.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
@@ -42,11 +43,16 @@ namespace hpx::components::detail {
         {
             static void* alloc(std::size_t size)
             {
-                return alloc_.allocate(size);
+                void* p = alloc_.allocate(size);
+                util::record_allocation(
+                    util::memory_category::component_heaps, size);
+                return p;
             }
             static void free(void* p, std::size_t count) noexcept
             {
                 alloc_.deallocate(static_cast<char*>(p), count);
+                util::record_deallocation(
+                    util::memory_category::component_heaps, count);
             }
             static void* realloc(std::size_t&, void*) noexcept
             {
@@ -53,6 +53,12 @@ namespace hpx::agas {
         return detail::register_name_async(name, id);
     }
 
+    hpx::future<std::vector<bool>> register_names(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries)
+    {
+        return detail::register_names_async(entries);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::id_type unregister_name(
         launch::sync_policy, std::string const& name, error_code& ec)
@@ -185,6 +191,17 @@ namespace hpx::agas {
         return detail::resolve_cached(gid, addr);
     }
 
+    hpx::future<std::vector<naming::address>> resolve(
+        std::vector<hpx::id_type> const& ids)
+    {
+        return detail::resolve_async_bulk(ids);
+    }
+
+    hpx::future<void> prefetch(std::vector<hpx::id_type> const& ids)
+    {
+        return detail::prefetch(ids);
+    }
+
     hpx::future<bool> bind(naming::gid_type const& gid,
         naming::address const& addr, std::uint32_t locality_id)
     {
@@ -210,6 +227,13 @@ namespace hpx::agas {
         return detail::bind_locality(gid, addr, locality_, ec);
     }
 
+    hpx::future<bool> bind(std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality_)
+    {
+        return detail::bind_async_bulk(gids, addrs, locality_);
+    }
+
     hpx::future<naming::address> unbind(
         naming::gid_type const& id, std::uint64_t t)
     {
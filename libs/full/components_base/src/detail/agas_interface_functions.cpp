@@ -40,6 +40,10 @@ namespace hpx::agas::detail {
     future<bool> (*register_name_async)(
         std::string const& name, hpx::id_type const& id) = nullptr;
 
+    future<std::vector<bool>> (*register_names_async)(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries) =
+        nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::id_type (*unregister_name)(
         std::string const& name, error_code& ec) = nullptr;
@@ -122,6 +126,12 @@ namespace hpx::agas::detail {
     bool (*resolve_cached)(
         naming::gid_type const& gid, naming::address& addr) = nullptr;
 
+    hpx::future<std::vector<naming::address>> (*resolve_async_bulk)(
+        std::vector<hpx::id_type> const& ids) = nullptr;
+
+    hpx::future<void> (*prefetch)(
+        std::vector<hpx::id_type> const& ids) = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<bool> (*bind_async)(naming::gid_type const& gid,
         naming::address const& addr, std::uint32_t locality_id) = nullptr;
@@ -137,6 +147,11 @@ namespace hpx::agas::detail {
         naming::address const& addr, naming::gid_type const& locality_,
         error_code& ec) = nullptr;
 
+    hpx::future<bool> (*bind_async_bulk)(
+        std::vector<naming::gid_type> const& gids,
+        std::vector<naming::address> const& addrs,
+        naming::gid_type const& locality_) = nullptr;
+
     hpx::future<naming::address> (*unbind_async)(
         naming::gid_type const& gid, std::uint64_t count) = nullptr;
 
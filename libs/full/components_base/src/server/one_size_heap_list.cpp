@@ -13,15 +13,19 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/synchronization.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #if defined(HPX_DEBUG)
 #include <hpx/modules/logging.hpp>
 #endif
 
 #include <cstddef>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -47,6 +51,36 @@ namespace hpx { namespace util {
 #endif
     }
 
+    one_size_heap_list::thread_cache*
+    one_size_heap_list::get_thread_cache() const noexcept
+    {
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread < num_thread_caches_.load(std::memory_order_acquire))
+        {
+            return &thread_caches_[num_thread].data_;
+        }
+        return nullptr;
+    }
+
+    // this is called while holding the exclusive lock on the list of heaps
+    void one_size_heap_list::init_thread_caches()
+    {
+        if (num_thread_caches_.load(std::memory_order_relaxed) != 0)
+        {
+            return;
+        }
+
+        if (get_runtime_ptr() == nullptr)
+        {
+            return;
+        }
+
+        std::size_t const num_threads = hpx::get_os_thread_count();
+        thread_caches_.reset(
+            new util::cache_aligned_data<thread_cache>[num_threads]);
+        num_thread_caches_.store(num_threads, std::memory_order_release);
+    }
+
     void* one_size_heap_list::alloc(std::size_t count)
     {
         if (HPX_UNLIKELY(0 == count))
@@ -57,6 +91,33 @@ namespace hpx { namespace util {
 
         void* p = nullptr;
 
+        // try to allocate from the cache of the calling worker thread first
+        thread_cache* cache = count == 1 ? get_thread_cache() : nullptr;
+        if (cache != nullptr)
+        {
+            if (cache->free_list != nullptr)
+            {
+                p = cache->free_list;
+                std::memcpy(&cache->free_list, p, sizeof(void*));
+                --cache->free_count;
+#if defined(HPX_DEBUG)
+                ++alloc_count_;
+#endif
+                return p;
+            }
+
+            if (cache->heap && cache->heap->alloc(&p, count))
+            {
+#if defined(HPX_DEBUG)
+                ++alloc_count_;
+#endif
+                return p;
+            }
+        }
+
+        // worker threads don't share heaps with other threads, they always
+        // create a new heap once their current heap is exhausted
+        if (cache == nullptr)
         {
             std::shared_lock<hpx::shared_mutex> sl(rwlock_);
 
@@ -101,6 +162,18 @@ namespace hpx { namespace util {
         {
             std::unique_lock<hpx::shared_mutex> ul(rwlock_);
             heap_list_.push_front(heap);
+            init_thread_caches();
+        }
+
+        // the calling thread may have been resumed on a different worker
+        // thread while waiting for the lock
+        if (count == 1)
+        {
+            cache = get_thread_cache();
+            if (cache != nullptr)
+            {
+                cache->heap = heap;
+            }
         }
 
         if (HPX_UNLIKELY(!result || nullptr == p))
@@ -148,6 +221,25 @@ namespace hpx { namespace util {
         if (reschedule(p, count))
             return;
 
+        // keep the element for reuse by the calling worker thread, the
+        // linked list of free elements is stored in the elements themselves
+        if (count == 1 && parameters_.element_size >= sizeof(void*))
+        {
+            thread_cache* cache = get_thread_cache();
+            if (cache != nullptr && cache->free_count < parameters_.capacity)
+            {
+                HPX_ASSERT(did_alloc(p));
+
+                std::memcpy(p, &cache->free_list, sizeof(void*));
+                cache->free_list = p;
+                ++cache->free_count;
+#if defined(HPX_DEBUG)
+                ++free_count_;
+#endif
+                return;
+            }
+        }
+
         {
             std::shared_lock<hpx::shared_mutex> sl(rwlock_);
 
@@ -8,3 +8,4 @@
 
 #include <hpx/collectives/barrier.hpp>
 #include <hpx/synchronization/barrier.hpp>
+#include <hpx/synchronization/combining_tree_barrier.hpp>
@@ -17,5 +17,8 @@
 #include <hpx/collectives/exclusive_scan.hpp>
 #include <hpx/collectives/gather.hpp>
 #include <hpx/collectives/inclusive_scan.hpp>
+#include <hpx/collectives/mpi_communicator.hpp>
+#include <hpx/collectives/node_aware_communicator.hpp>
+#include <hpx/collectives/persistent_all_reduce.hpp>
 #include <hpx/collectives/reduce.hpp>
 #include <hpx/collectives/scatter.hpp>
@@ -34,11 +34,13 @@
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/server/create_component.hpp>
+#include <hpx/components_base/server/load_balancing_support.hpp>
 #include <hpx/components_base/server/locking_hook.hpp>
 #include <hpx/components_base/server/managed_component_base.hpp>
 #include <hpx/components_base/server/migration_support.hpp>
 
 #include <hpx/runtime_distributed/copy_component.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
 #include <hpx/runtime_distributed/migrate_component.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #include <hpx/runtime_distributed/stubs/runtime_support.hpp>
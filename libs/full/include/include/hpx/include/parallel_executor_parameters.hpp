@@ -9,8 +9,10 @@
 #include <hpx/execution/executors/execution_parameters.hpp>
 
 #include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/cache_aware_chunk_size.hpp>
 #include <hpx/execution/executors/default_parameters.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
+#include <hpx/execution/executors/feedback_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
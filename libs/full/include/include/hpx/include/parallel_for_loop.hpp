@@ -7,3 +7,4 @@
 #pragma once
 
 #include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/for_loop_nd.hpp>
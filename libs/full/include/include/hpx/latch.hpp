@@ -7,4 +7,5 @@
 #pragma once
 
 #include <hpx/collectives/latch.hpp>
+#include <hpx/synchronization/combining_tree_barrier.hpp>
 #include <hpx/synchronization/latch.hpp>
@@ -52,6 +52,8 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/preemption.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -78,8 +80,10 @@
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #endif
 
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <functional>
@@ -431,7 +435,18 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::configure_stack_pool(
+                cmdline.rtcfg_.get_stack_pool_parameters());
 #endif
+            // the stack size selection relies on the recorded stack usage, it
+            // only needs to know about threads coming close to exhausting their
+            // stacks though
+            bool const track_usage = hpx::util::get_entry_as<int>(
+                cmdline.rtcfg_, "hpx.stacks.track_usage", 0) != 0;
+            bool const auto_select = hpx::util::get_entry_as<int>(
+                cmdline.rtcfg_, "hpx.stacks.auto_select", 0) != 0;
+            threads::enable_stack_usage_tracking(
+                track_usage || auto_select, !track_usage);
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
@@ -443,6 +458,9 @@ namespace hpx {
                 util::disable_lock_detection();
             }
 #endif
+#ifdef HPX_HAVE_LOCK_PROFILING
+            hpx::local::detail::activate_lock_profiling(cmdline.rtcfg_);
+#endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
             threads::policies::set_minimal_deadlock_detection_enabled(
                 cmdline.rtcfg_.enable_minimal_deadlock_detection());
@@ -674,6 +692,10 @@ namespace hpx {
             if (!!shutdown)
                 rt.add_shutdown_function(HPX_MOVE(shutdown));
 
+#if defined(HPX_HAVE_LOCK_PROFILING)
+            hpx::local::detail::add_lock_profiling_report(rt);
+#endif
+
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
             // Add startup function related to listing counter names or counter
             // infos (on console only).
@@ -786,6 +808,16 @@ namespace hpx {
                 [](std::exception_ptr const& e) {
                     report_exception_and_terminate(e);
                 });
+            hpx::lcos::detail::set_inline_continuation_depth(
+                hpx::util::get_entry_as<std::size_t>(
+                    cfg, "hpx.inline_continuation_depth", 0));
+            hpx::lcos::detail::set_fused_continuation_depth(
+                hpx::util::get_entry_as<std::size_t>(cfg,
+                    "hpx.fused_continuation_depth",
+                    HPX_FUSED_CONTINUATION_MAX_DEPTH));
+            hpx::threads::set_preemption_time_slice(std::chrono::microseconds(
+                hpx::util::get_entry_as<std::int64_t>(
+                    cfg, "hpx.preemption_time_slice", 0)));
 #if defined(HPX_HAVE_VERIFY_LOCKS)
             hpx::util::set_registered_locks_error_handler(
                 &detail::registered_locks_error_handler);
@@ -947,7 +979,7 @@ namespace hpx {
                     if (cmdline.num_localities_ != 1 || cmdline.node_ != 0 ||
                         cmdline.rtcfg_.enable_networking())
                     {
-                        parcelset::parcelhandler::init(rp);
+                        parcelset::parcelhandler::init(rp, cmdline.rtcfg_);
                     }
 #endif
                     // Setup all internal parameters of the resource_partitioner
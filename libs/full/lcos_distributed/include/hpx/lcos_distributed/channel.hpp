@@ -20,6 +20,7 @@
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::lcos {
 
@@ -220,6 +221,30 @@ namespace hpx::lcos {
             return get(launch::sync, generation, ec);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Retrieve the next count values at once (using a single action)
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<std::vector<U>>>
+        get_values(launch::async_policy, std::size_t count) const
+        {
+            using action_type =
+                typename lcos::server::channel<T>::get_values_action;
+            return hpx::async(action_type(), this->get_id(), count);
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<std::vector<U>>>
+        get_values(std::size_t count) const
+        {
+            return get_values(launch::async, count);
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, std::vector<U>> get_values(
+            launch::sync_policy, std::size_t count,
+            hpx::error_code& ec = hpx::throws) const
+        {
+            return get_values(launch::async, count).get(ec);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename U, typename U2 = T>
         std::enable_if_t<!std::is_void<U2>::value, bool> set(
@@ -293,6 +318,38 @@ namespace hpx::lcos {
             set(launch::sync, generation);
         }
 
+        // Push a batch of values (using a single action)
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, bool> set_values(
+            launch::apply_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            return hpx::post(action_type(), this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<void>>
+        set_values(launch::async_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            return hpx::async(action_type(), this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value> set_values(
+            launch::sync_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            action_type()(this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value> set_values(
+            std::vector<U> values)
+        {
+            set_values(launch::sync, HPX_MOVE(values));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void close(launch::apply_policy, bool force_delete_entries = false)
         {
@@ -317,6 +374,30 @@ namespace hpx::lcos {
             return close(launch::sync, force_delete_entries);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Register the given channel (usually created on the locality of the
+        // consumer) as the receiver of all values set from now on. The values
+        // are pushed to the receiver eagerly, which saves the round-trip of a
+        // remote get for every value. Closing this channel closes the
+        // receiver as well.
+        hpx::future<void> set_receiver(
+            launch::async_policy, channel<T> const& receiver)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_receiver_action;
+            return hpx::async(action_type(), this->get_id(), receiver.get_id());
+        }
+        void set_receiver(launch::sync_policy, channel<T> const& receiver)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_receiver_action;
+            action_type()(this->get_id(), receiver.get_id());
+        }
+        void set_receiver(channel<T> const& receiver)
+        {
+            set_receiver(launch::sync, receiver);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         channel_iterator<T, channel<T>> begin() const
         {
@@ -400,6 +481,30 @@ namespace hpx::lcos {
             return get(launch::sync, generation, ec);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Retrieve the next count values at once (using a single action)
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<std::vector<U>>>
+        get_values(launch::async_policy, std::size_t count) const
+        {
+            using action_type =
+                typename lcos::server::channel<T>::get_values_action;
+            return hpx::async(action_type(), this->get_id(), count);
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<std::vector<U>>>
+        get_values(std::size_t count) const
+        {
+            return get_values(launch::async, count);
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, std::vector<U>> get_values(
+            launch::sync_policy, std::size_t count,
+            hpx::error_code& ec = hpx::throws) const
+        {
+            return get_values(launch::async, count).get(ec);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         channel_iterator<T, channel<T>> begin() const
         {
@@ -533,6 +638,38 @@ namespace hpx::lcos {
             set(launch::sync, generation);
         }
 
+        // Push a batch of values (using a single action)
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, bool> set_values(
+            launch::apply_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            return hpx::post(action_type(), this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value, hpx::future<void>>
+        set_values(launch::async_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            return hpx::async(action_type(), this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value> set_values(
+            launch::sync_policy, std::vector<U> values)
+        {
+            using action_type =
+                typename lcos::server::channel<T>::set_values_action;
+            action_type()(this->get_id(), HPX_MOVE(values));
+        }
+        template <typename U = T>
+        std::enable_if_t<!std::is_void<U>::value> set_values(
+            std::vector<U> values)
+        {
+            set_values(launch::sync, HPX_MOVE(values));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void close(launch::apply_policy, bool force_delete_entries = false)
         {
@@ -9,7 +9,9 @@
 #include <hpx/config.hpp>
 #include <hpx/actions/transfer_action.hpp>
 #include <hpx/actions_base/component_action.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/base_lco_with_value.hpp>
+#include <hpx/async_distributed/post.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/server/component_base.hpp>
@@ -17,15 +19,20 @@
 #include <hpx/futures/traits/get_remote_result.hpp>
 #include <hpx/futures/traits/promise_remote_result.hpp>
 #include <hpx/lcos_local/channel.hpp>
+#include <hpx/naming_base/id_type.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <cstddef>
 #include <exception>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace server {
@@ -80,13 +87,13 @@ namespace hpx { namespace lcos { namespace server {
         // Push a value to the channel.
         void set_value(RemoteType&& result)
         {
-            channel_.set(HPX_MOVE(result));
+            set_generation(HPX_MOVE(result), std::size_t(-1));
         }
 
         // Close the channel
         void set_exception(std::exception_ptr const& /*e*/)
         {
-            channel_.close();
+            close(false);
         }
 
         // Retrieve the next value from the channel
@@ -108,18 +115,95 @@ namespace hpx { namespace lcos { namespace server {
 
         void set_generation(RemoteType&& value, std::size_t generation)
         {
+            if (hpx::id_type const receiver = get_receiver())
+            {
+                hpx::post(set_generation_action(), receiver, HPX_MOVE(value),
+                    generation);
+                return;
+            }
             channel_.set(HPX_MOVE(value), generation);
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_generation)
 
+        // Push a batch of values to the channel (using consecutive
+        // generations), a batch is transferred by a single action and is
+        // forwarded as a whole to a registered receiver.
+        void set_values(std::vector<RemoteType>&& values)
+        {
+            if (hpx::id_type const receiver = get_receiver())
+            {
+                hpx::post(set_values_action(), receiver, HPX_MOVE(values));
+                return;
+            }
+            for (RemoteType& value : values)
+            {
+                channel_.set(HPX_MOVE(value));
+            }
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_values)
+
+        // Retrieve the next count values from the channel at once, the
+        // returned future becomes ready once all of them have been set.
+        hpx::future<std::vector<result_type>> get_values(std::size_t count)
+        {
+            std::vector<hpx::future<result_type>> values;
+            values.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                values.push_back(channel_.get());
+            }
+
+            return hpx::when_all(HPX_MOVE(values))
+                .then(hpx::launch::sync,
+                    [](hpx::future<std::vector<hpx::future<result_type>>>&&
+                            f) {
+                        std::vector<hpx::future<result_type>> ready = f.get();
+
+                        std::vector<result_type> result;
+                        result.reserve(ready.size());
+                        for (hpx::future<result_type>& value : ready)
+                        {
+                            result.push_back(value.get());
+                        }
+                        return result;
+                    });
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, get_values)
+
+        // Register a channel (usually located on the locality of the
+        // consumer) all values set from now on are eagerly pushed to instead
+        // of being stored in this channel. This saves the round-trip of a
+        // remote get for every value. Closing this channel closes the
+        // receiver as well. Values stored before the receiver has been
+        // registered have to be retrieved from this channel.
+        void set_receiver(hpx::id_type const& receiver)
+        {
+            std::lock_guard<hpx::spinlock> l(receiver_mtx_);
+            receiver_ = receiver;
+        }
+        HPX_DEFINE_COMPONENT_ACTION(channel, set_receiver)
+
         std::size_t close(bool force_delete_entries)
         {
+            if (hpx::id_type const receiver = get_receiver())
+            {
+                hpx::post(close_action(), receiver, force_delete_entries);
+            }
             return channel_.close(force_delete_entries);
         }
         HPX_DEFINE_COMPONENT_ACTION(channel, close)
 
     private:
+        hpx::id_type get_receiver()
+        {
+            std::lock_guard<hpx::spinlock> l(receiver_mtx_);
+            return receiver_;
+        }
+
         lcos::local::channel<result_type> channel_;
+
+        hpx::spinlock receiver_mtx_;
+        hpx::id_type receiver_;
     };
 }}}    // namespace hpx::lcos::server
 
@@ -143,6 +227,15 @@ namespace hpx { namespace lcos { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         hpx::lcos::server::channel<type>::set_generation_action,               \
         HPX_PP_CAT(__channel_set_generation_action, HPX_PP_CAT(type, name)))   \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::set_values_action,                   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::get_values_action,                   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::set_receiver_action,                 \
+        HPX_PP_CAT(__channel_set_receiver_action, HPX_PP_CAT(type, name)))     \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         hpx::lcos::server::channel<type>::close_action,                        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
@@ -175,6 +268,15 @@ namespace hpx { namespace lcos { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         hpx::lcos::server::channel<type>::set_generation_action,               \
         HPX_PP_CAT(__channel_set_generation_action, HPX_PP_CAT(type, name)))   \
+    HPX_REGISTER_ACTION(                                                       \
+        hpx::lcos::server::channel<type>::set_values_action,                   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION(                                                       \
+        hpx::lcos::server::channel<type>::get_values_action,                   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION(                                                       \
+        hpx::lcos::server::channel<type>::set_receiver_action,                 \
+        HPX_PP_CAT(__channel_set_receiver_action, HPX_PP_CAT(type, name)))     \
     HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::close_action,        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
     /**/
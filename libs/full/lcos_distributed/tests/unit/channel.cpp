@@ -13,17 +13,22 @@
 #include <hpx/include/post.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
 typedef std::string string_type;
+typedef hpx::serialization::serialize_buffer<double> buffer_type;
 
 HPX_REGISTER_CHANNEL(int)
 HPX_REGISTER_CHANNEL(string_type)
+HPX_REGISTER_CHANNEL(buffer_type)
 HPX_REGISTER_CHANNEL(void)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -284,6 +289,91 @@ void channel_as_lco(hpx::id_type const& here, hpx::id_type const& there)
     HPX_TEST_EQ(lco.get(hpx::launch::sync), 42);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void batched_set_get(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+    hpx::lcos::send_channel<int> send(c);
+    hpx::lcos::receive_channel<int> receive(c);
+
+    send.set_values(std::vector<int>{1, 2, 3});
+    c.set_values(hpx::launch::async, std::vector<int>{4, 5}).get();
+
+    HPX_TEST(c.get_values(hpx::launch::sync, 2) == std::vector<int>({1, 2}));
+
+    hpx::future<std::vector<int>> f = receive.get_values(4);
+    c.set(6);
+    HPX_TEST(f.get() == std::vector<int>({3, 4, 5, 6}));
+
+    HPX_TEST(c.get_values(hpx::launch::sync, 0).empty());
+}
+
+void channel_receiver(hpx::id_type const& here, hpx::id_type const& there)
+{
+    hpx::lcos::channel<int> remote(there);
+    hpx::lcos::channel<int> local(here);
+
+    // values set before the receiver is registered stay in the channel
+    remote.set(1);
+    remote.set_receiver(local);
+
+    remote.set(2);
+    remote.set_values(std::vector<int>{3, 4});
+
+    HPX_TEST_EQ(remote.get(hpx::launch::sync), 1);
+    HPX_TEST_EQ(local.get(hpx::launch::sync), 2);
+    HPX_TEST(
+        local.get_values(hpx::launch::sync, 2) == std::vector<int>({3, 4}));
+
+    // closing the channel closes the receiver as well
+    remote.close();
+
+    bool caught_exception = false;
+    try
+    {
+        local.get(hpx::launch::sync);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void channel_buffers(hpx::id_type const& here, hpx::id_type const& there)
+{
+    constexpr std::size_t size = 4 * HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+
+    hpx::lcos::channel<buffer_type> remote(there);
+    hpx::lcos::channel<buffer_type> local(here);
+    remote.set_receiver(local);
+
+    std::vector<buffer_type> buffers;
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        buffer_type buffer(size);
+        for (std::size_t j = 0; j != size; ++j)
+        {
+            buffer[j] = static_cast<double>(i + j);
+        }
+        buffers.push_back(buffer);
+    }
+    remote.set(buffers[0]);
+    remote.set_values(
+        std::vector<buffer_type>(buffers.begin() + 1, buffers.end()));
+
+    std::vector<buffer_type> received =
+        local.get_values(hpx::launch::sync, buffers.size());
+    HPX_TEST_EQ(received.size(), buffers.size());
+    for (std::size_t i = 0; i != received.size(); ++i)
+    {
+        HPX_TEST_EQ(received[i].size(), size);
+        HPX_TEST(std::equal(received[i].data(), received[i].data() + size,
+            buffers[i].data()));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
@@ -303,6 +393,10 @@ int main()
 
     channel_as_lco(here, here);
 
+    batched_set_get(here);
+    channel_receiver(here, here);
+    channel_buffers(here, here);
+
     std::vector<hpx::id_type> remote_localities = hpx::find_remote_localities();
     for (hpx::id_type id : remote_localities)
     {
@@ -313,6 +407,10 @@ int main()
 
         channel_as_lco(id, here);
         channel_as_lco(here, id);
+
+        batched_set_get(id);
+        channel_receiver(here, id);
+        channel_buffers(here, id);
     }
 
     return hpx::util::report_errors();
@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/spinlock_pool.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/hashing/wyhash.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/naming_base/naming_base.hpp>
@@ -739,11 +740,10 @@ namespace std {
     {
         std::size_t operator()(::hpx::naming::gid_type const& gid) const
         {
-            std::size_t const h1(std::hash<std::uint64_t>()(gid.get_lsb()));
-            std::size_t const h2(std::hash<std::uint64_t>()(
+            return static_cast<std::size_t>(hpx::util::wyhash64(
                 hpx::naming::detail::strip_internal_bits_from_gid(
-                    gid.get_msb())));
-            return h1 ^ (h2 << 1);
+                    gid.get_msb()),
+                gid.get_lsb()));
         }
     };
 }    // namespace std
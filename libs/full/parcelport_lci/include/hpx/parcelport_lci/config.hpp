@@ -53,6 +53,10 @@ namespace hpx::parcelset::policies::lci {
         static int ncomps;
         // Whether to enable in-buffer assembly for the header messages.
         static bool enable_in_buffer_assembly;
+        // After how many consecutive send retries (i.e. the device is out of
+        // resources or contended) a thread switches to the next device for
+        // its subsequent messages (0 disables switching devices).
+        static int device_retry_threshold;
 
         static void init_config(util::runtime_configuration const& rtcfg);
     };
@@ -14,6 +14,7 @@
 
 #include <hpx/parcelport_lci/config.hpp>
 #include <hpx/modules/lci_base.hpp>
+#include <hpx/modules/serialization.hpp>
 #include <hpx/parcelport_lci/backlog_queue.hpp>
 #include <hpx/parcelport_lci/completion_manager_base.hpp>
 #include <hpx/parcelport_lci/header.hpp>
@@ -25,6 +26,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -40,6 +42,7 @@ namespace hpx::parcelset {
         using send_early_parcel = std::true_type;
         using do_background_work = std::true_type;
         using send_immediate_parcels = std::true_type;
+        using send_streaming_parcels = std::false_type;
         using is_connectionless = std::true_type;
 
         static constexpr const char* type() noexcept
@@ -136,9 +139,28 @@ namespace hpx::parcelset {
             };
             std::vector<device_t> devices;
 
+            // Registers the memory allocated by
+            // serialization::registered_allocator with all devices once, the
+            // handle is the array of the segments (one per device).
+            struct memory_registrar final : serialization::memory_registrar
+            {
+                explicit memory_registrar(
+                    std::vector<device_t> const& devices) noexcept
+                  : devices_(devices)
+                {
+                }
+
+                void* register_memory(
+                    void* address, std::size_t size) override;
+                void unregister_memory(void* handle) noexcept override;
+
+                std::vector<device_t> const& devices_;
+            };
+            memory_registrar memory_registrar_{devices};
+
             // Parcelport objects
             static std::atomic<bool> prg_thread_flag;
-            std::unique_ptr<std::thread> prg_thread_p;
+            std::vector<std::thread> prg_threads;
             struct completion_manager_t
             {
                 std::shared_ptr<completion_manager_base> send;
@@ -150,6 +172,12 @@ namespace hpx::parcelset {
             bool do_progress_local();
             device_t& get_tls_device();
 
+            // Track the send retries on the device of the calling thread, the
+            // thread switches to the next device if the device is contended
+            // (see config_t::device_retry_threshold).
+            void record_device_retry(device_t const& device) noexcept;
+            void record_device_success() noexcept;
+
         private:
             static void progress_thread_fn(
                 const std::vector<device_t>& devices);
@@ -267,7 +295,8 @@ namespace hpx::traits {
                 "reg_mem = 1\n"
                 "ndevices = 1\n"
                 "ncomps = 1\n"
-                "enable_in_buffer_assembly = 1\n";
+                "enable_in_buffer_assembly = 1\n"
+                "device_retry_threshold = 0\n";
         }
     };
 }    // namespace hpx::traits
@@ -52,6 +52,8 @@ namespace hpx::parcelset::policies::lci {
         bool is_eager;
         LCI_mbuffer_t mbuffer;
         LCI_iovec_t iovec;
+        // the segments of registered memory must not be deregistered
+        std::vector<bool> is_registered_memory;
         std::shared_ptr<sender_connection_putva>*
             sharedPtr_p;    // for LCI_putva
         // for profiling
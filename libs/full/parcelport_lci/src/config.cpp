@@ -29,6 +29,7 @@ namespace hpx::parcelset::policies::lci {
     int config_t::ndevices;
     int config_t::ncomps;
     bool config_t::enable_in_buffer_assembly;
+    int config_t::device_retry_threshold;
 
     void config_t::init_config(util::runtime_configuration const& rtcfg)
     {
@@ -108,6 +109,8 @@ namespace hpx::parcelset::policies::lci {
         ncomps = util::get_entry_as(rtcfg, "hpx.parcel.lci.ncomps", 1);
         enable_in_buffer_assembly = util::get_entry_as(
             rtcfg, "hpx.parcel.lci.enable_in_buffer_assembly", 1);
+        device_retry_threshold = util::get_entry_as(
+            rtcfg, "hpx.parcel.lci.device_retry_threshold", 0);
 
         if (!enable_send_immediate && enable_lci_backlog_queue)
         {
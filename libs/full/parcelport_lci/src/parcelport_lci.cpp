@@ -30,6 +30,7 @@
 
 #include <hpx/assert.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -393,12 +394,28 @@ namespace hpx::parcelset::policies::lci {
             LCI_plist_free(&plist_);
         }
 
-        // Create progress threads
+        // Register the memory used by registered_allocator once
+        if (config_t::reg_mem)
+        {
+            serialization::add_memory_registrar(memory_registrar_);
+        }
+
+        // Create progress threads, each of them progresses a distinct subset
+        // of the devices
         HPX_ASSERT(prg_thread_flag == false);
-        HPX_ASSERT(prg_thread_p == nullptr);
+        HPX_ASSERT(prg_threads.empty());
         prg_thread_flag = true;
-        prg_thread_p =
-            std::make_unique<std::thread>(progress_thread_fn, devices);
+        int const num_prg_threads = (std::max)(
+            (std::min)(config_t::progress_thread_num, config_t::ndevices), 1);
+        prg_threads.reserve(num_prg_threads);
+        for (int i = 0; i < num_prg_threads; ++i)
+        {
+            int const begin = i * config_t::ndevices / num_prg_threads;
+            int const end = (i + 1) * config_t::ndevices / num_prg_threads;
+            std::vector<device_t> const devices_to_progress(
+                devices.begin() + begin, devices.begin() + end);
+            prg_threads.emplace_back(progress_thread_fn, devices_to_progress);
+        }
 
         // Create the sender and receiver
         switch (config_t::protocol)
@@ -420,6 +437,10 @@ namespace hpx::parcelset::policies::lci {
     void parcelport::cleanup()
     {
         join_prg_thread_if_running();
+        if (config_t::reg_mem)
+        {
+            serialization::remove_memory_registrar(memory_registrar_);
+        }
         // Free devices
         for (auto& device : devices)
         {
@@ -432,16 +453,39 @@ namespace hpx::parcelset::policies::lci {
         }
     }
 
+    void* parcelport::memory_registrar::register_memory(
+        void* address, std::size_t size)
+    {
+        auto* segments = new LCI_segment_t[devices_.size()];
+        for (auto const& device : devices_)
+        {
+            LCI_memory_register(
+                device.device, address, size, &segments[device.idx]);
+        }
+        return segments;
+    }
+
+    void parcelport::memory_registrar::unregister_memory(
+        void* handle) noexcept
+    {
+        auto* segments = static_cast<LCI_segment_t*>(handle);
+        for (std::size_t i = 0; i != devices_.size(); ++i)
+        {
+            LCI_memory_deregister(&segments[i]);
+        }
+        delete[] segments;
+    }
+
     void parcelport::join_prg_thread_if_running()
     {
-        if (prg_thread_p)
+        if (!prg_threads.empty())
         {
             prg_thread_flag = false;
-            if (prg_thread_p)
+            for (auto& prg_thread : prg_threads)
             {
-                prg_thread_p->join();
-                prg_thread_p.reset();
+                prg_thread.join();
             }
+            prg_threads.clear();
         }
     }
 
@@ -453,10 +497,14 @@ namespace hpx::parcelset::policies::lci {
         return ret;
     }
 
+    namespace {
+
+        thread_local std::size_t tls_device_idx = -1;
+        thread_local int tls_device_retries = 0;
+    }    // namespace
+
     parcelport::device_t& parcelport::get_tls_device()
     {
-        static thread_local std::size_t tls_device_idx = -1;
-
         if (HPX_UNLIKELY(!is_initialized ||
                 hpx::threads::get_self_id() == hpx::threads::invalid_thread_id))
         {
@@ -485,6 +533,34 @@ namespace hpx::parcelset::policies::lci {
         }
         return devices[tls_device_idx];
     }
+
+    void parcelport::record_device_retry(device_t const& device) noexcept
+    {
+        if (config_t::device_retry_threshold <= 0 || devices.size() == 1 ||
+            ++tls_device_retries < config_t::device_retry_threshold)
+        {
+            return;
+        }
+        tls_device_retries = 0;
+
+        // Only threads with an assigned device switch devices, the other
+        // threads pick a random device for every message anyways. The
+        // receiver finds the device to use in the message header.
+        if (tls_device_idx != std::size_t(-1) &&
+            devices[tls_device_idx].idx == device.idx)
+        {
+            tls_device_idx = (tls_device_idx + 1) % devices.size();
+            util::lci_environment::log(
+                util::lci_environment::log_level_t::debug, "device",
+                "Rank %d device %d is contended, switching to device %lu\n",
+                LCI_RANK, device.idx, tls_device_idx);
+        }
+    }
+
+    void parcelport::record_device_success() noexcept
+    {
+        tls_device_retries = 0;
+    }
 }    // namespace hpx::parcelset::policies::lci
 
 HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::lci::parcelport, lci)
@@ -92,6 +92,7 @@ namespace hpx::parcelset::policies::lci {
             int i = 0;
             iovec.lbuffers =
                 (LCI_lbuffer_t*) malloc(iovec.count * sizeof(LCI_lbuffer_t));
+            is_registered_memory.assign(iovec.count, false);
             if (!header_.piggy_back_data())
             {
                 // data (non-zero-copy chunks)
@@ -144,7 +145,20 @@ namespace hpx::parcelset::policies::lci {
                         iovec.lbuffers[i].address =
                             const_cast<void*>(c.data_.cpos_);
                         iovec.lbuffers[i].length = c.size_;
-                        if (config_t::reg_mem)
+                        void* registration = config_t::reg_mem ?
+                            serialization::get_memory_registration(
+                                pp_->memory_registrar_, c.data_.cpos_,
+                                c.size_) :
+                            nullptr;
+                        if (registration != nullptr)
+                        {
+                            // registered_allocator memory, registered once
+                            iovec.lbuffers[i].segment =
+                                static_cast<LCI_segment_t*>(
+                                    registration)[device_p->idx];
+                            is_registered_memory[i] = true;
+                        }
+                        else if (config_t::reg_mem)
                         {
                             LCI_memory_register(device_p->device,
                                 iovec.lbuffers[i].address,
@@ -245,7 +259,8 @@ namespace hpx::parcelset::policies::lci {
             HPX_ASSERT(iovec.count > 0);
             for (int i = 0; i < iovec.count; ++i)
             {
-                if (iovec.lbuffers[i].segment != LCI_SEGMENT_ALL)
+                if (iovec.lbuffers[i].segment != LCI_SEGMENT_ALL &&
+                    !is_registered_memory[i])
                 {
                     LCI_memory_deregister(&iovec.lbuffers[i].segment);
                 }
@@ -255,6 +270,7 @@ namespace hpx::parcelset::policies::lci {
         error_code ec;
         handler_(ec);
         handler_.reset();
+        pp_->release_send_buffer(HPX_MOVE(buffer_.data_));
         buffer_.clear();
     }
 
@@ -66,6 +66,7 @@ namespace hpx::parcelset::policies::lci {
                 ret = send_nb();
                 if (ret.status == return_status_t::retry)
                 {
+                    pp_->record_device_retry(*device_p);
                     //                    ++retry_count;
                     //                    if (retry_count > retry_max_spin)
                     //                    {
@@ -85,6 +86,7 @@ namespace hpx::parcelset::policies::lci {
                             continue;
                 }
             } while (ret.status == return_status_t::retry);
+            pp_->record_device_success();
         }
         else
         {
@@ -98,8 +100,13 @@ namespace hpx::parcelset::policies::lci {
                 ret = send_nb();
                 if (ret.status == return_status_t::retry)
                 {
+                    pp_->record_device_retry(*device_p);
                     backlog_queue::push(shared_from_this());
                 }
+                else
+                {
+                    pp_->record_device_success();
+                }
             }
         }
         util::lci_environment::pcounter_add(util::lci_environment::send_timer,
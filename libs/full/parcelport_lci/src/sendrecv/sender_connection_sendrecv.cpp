@@ -392,6 +392,7 @@ namespace hpx::parcelset::policies::lci {
         }
         HPX_ASSERT(completion == nullptr);
         HPX_ASSERT(segment_to_use == LCI_SEGMENT_ALL);
+        pp_->release_send_buffer(HPX_MOVE(buffer_.data_));
         buffer_.clear();
         util::lci_environment::pcounter_add(
             util::lci_environment::send_conn_timer,
@@ -15,6 +15,7 @@
 #include <hpx/modules/resource_partitioner.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/serialization.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/plugin/traits/plugin_config_data.hpp>
@@ -66,6 +67,7 @@
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -134,6 +136,32 @@ namespace hpx { namespace parcelset { namespace policies { namespace libfabric {
 
         memory_pool_type* chunk_pool_;
 
+        // Registers the memory allocated by serialization::registered_allocator
+        // once, zero-copy chunks referring to it are sent without creating a
+        // memory region for each message.
+        struct memory_registrar final : serialization::memory_registrar
+        {
+            void* register_memory(void* address, std::size_t size) override
+            {
+                try
+                {
+                    return new region_type(domain_, address, size);
+                }
+                catch (std::runtime_error const&)
+                {
+                    return nullptr;
+                }
+            }
+
+            void unregister_memory(void* handle) noexcept override
+            {
+                delete static_cast<region_type*>(handle);
+            }
+
+            libfabric_region_provider::provider_domain* domain_ = nullptr;
+        };
+        memory_registrar memory_registrar_;
+
         // parcelset::gatherer& parcels_sent_;
 
         // for debugging/performance measurement
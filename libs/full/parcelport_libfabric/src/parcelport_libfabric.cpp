@@ -152,6 +152,10 @@ namespace hpx::parcelset::policies::libfabric {
         LOG_DEBUG_MSG("Fetching memory pool");
         chunk_pool_ = &libfabric_controller_->get_memory_pool();
 
+        // register the memory used by registered_allocator once
+        memory_registrar_.domain_ = libfabric_controller_->get_domain();
+        serialization::add_memory_registrar(memory_registrar_);
+
         for (std::size_t i = 0; i < HPX_PARCELPORT_LIBFABRIC_THROTTLE_SENDS;
              ++i)
         {
@@ -254,6 +258,7 @@ namespace hpx::parcelset::policies::libfabric {
             << decnumber(acks_received) << "non_rma-send "
             << decnumber(sends_posted - acks_received));
         //
+        serialization::remove_memory_registrar(memory_registrar_);
         libfabric_controller_ = nullptr;
         FUNC_END_DEBUG_MSG;
     }
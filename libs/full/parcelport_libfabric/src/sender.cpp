@@ -51,6 +51,21 @@ namespace hpx::parcelset::policies::libfabric {
                 << " index " << decnumber(c.data_.index_));
             if (c.type_ == serialization::chunk_type::chunk_type_pointer)
             {
+                // memory allocated by serialization::registered_allocator
+                // has been registered already
+                if (auto* registered = static_cast<region_type*>(
+                        serialization::get_memory_registration(
+                            parcelport_->memory_registrar_, c.data_.cpos_,
+                            c.size_)))
+                {
+                    c.rkey_ = registered->get_remote_key();
+                    LOG_DEBUG_MSG("Using registered memory region "
+                        << decnumber(index) << *registered << "for rkey "
+                        << hexpointer(c.rkey_));
+                    ++index;
+                    continue;
+                }
+
                 LOG_EXCLUSIVE(chrono::high_resolution_timer regtimer);
 
                 // create a new memory region from the user supplied pointer
@@ -113,7 +128,7 @@ namespace hpx::parcelset::policies::libfabric {
 
         desc_[0] = header_region_->get_desc();
         desc_[1] = message_region_->get_desc();
-        if (rma_regions_.size() > 0 || !header_->message_piggy_back())
+        if (buffer_.num_chunks_.first > 0 || !header_->message_piggy_back())
         {
             completion_count_ = 2;
         }
@@ -126,7 +141,8 @@ namespace hpx::parcelset::policies::libfabric {
         else
         {
             LOG_DEBUG_MSG("Setting up header-chunk rma data with "
-                << "zero-copy chunks " << decnumber(rma_regions_.size()));
+                << "zero-copy chunks "
+                << decnumber(buffer_.num_chunks_.first));
             auto& cb = header_->chunk_header_ptr()->chunk_rma;
             chunk_region_ = memory_pool_->allocate_region(cb.size_);
             cb.data_.pos_ = chunk_region_->get_address();
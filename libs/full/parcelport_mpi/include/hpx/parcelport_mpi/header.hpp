@@ -45,13 +45,35 @@ namespace hpx::parcelset::policies::mpi {
             pos_piggy_back_flag_data = 7 * sizeof(value_type),
             // whether piggyback transmission chunk
             pos_piggy_back_flag_tchunk = 7 * sizeof(value_type) + 1,
-            pos_piggy_back_address = 7 * sizeof(value_type) + 2
+            // whether the zero-copy chunks are read using MPI RMA
+            pos_rma_flag = 7 * sizeof(value_type) + 2,
+            // whether piggyback zero-copy chunks
+            pos_piggy_back_flag_chunks = 7 * sizeof(value_type) + 3,
+            pos_piggy_back_address = 7 * sizeof(value_type) + 4
         };
 
+        // The zero-copy chunks are sent as part of the header only if the
+        // transmission chunks describing them are sent as well, and if they
+        // can be copied (i.e. they are not located in device memory).
+        template <typename buffer_type, typename ChunkType>
+        static size_t get_zero_copy_chunks_size(
+            parcel_buffer<buffer_type, ChunkType> const& buffer) noexcept
+        {
+            size_t result = 0;
+            for (auto const& c : buffer.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    result += c.size_;
+                }
+            }
+            return result;
+        }
+
         template <typename buffer_type, typename ChunkType>
         static size_t get_header_size(
             parcel_buffer<buffer_type, ChunkType> const& buffer,
-            size_t max_header_size) noexcept
+            size_t max_header_size, bool pack_chunks = true) noexcept
         {
             HPX_ASSERT(max_header_size >= pos_piggy_back_address);
 
@@ -74,6 +96,14 @@ namespace hpx::parcelset::policies::mpi {
                 if (tchunk_size <= int(max_header_size - current_header_size))
                 {
                     current_header_size += tchunk_size;
+
+                    size_t const chunks_size =
+                        get_zero_copy_chunks_size(buffer);
+                    if (pack_chunks &&
+                        chunks_size <= max_header_size - current_header_size)
+                    {
+                        current_header_size += chunks_size;
+                    }
                 }
             }
             return current_header_size;
@@ -81,7 +111,8 @@ namespace hpx::parcelset::policies::mpi {
 
         template <typename buffer_type, typename ChunkType>
         header(parcel_buffer<buffer_type, ChunkType> const& buffer,
-            char* header_buffer, size_t max_header_size) noexcept
+            char* header_buffer, size_t max_header_size,
+            bool pack_chunks = true) noexcept
         {
             HPX_ASSERT(max_header_size >= pos_piggy_back_address);
             data_ = header_buffer;
@@ -103,6 +134,8 @@ namespace hpx::parcelset::policies::mpi {
                 static_cast<value_type>(num_non_zero_copy_chunks));
             data_[pos_piggy_back_flag_data] = 0;
             data_[pos_piggy_back_flag_tchunk] = 0;
+            data_[pos_rma_flag] = 0;
+            data_[pos_piggy_back_flag_chunks] = 0;
 
             size_t current_header_size = pos_piggy_back_address;
             if (buffer.data_.size() <= (max_header_size - current_header_size))
@@ -126,6 +159,26 @@ namespace hpx::parcelset::policies::mpi {
                     data_[pos_piggy_back_flag_tchunk] = 1;
                     std::memcpy(&data_[current_header_size],
                         buffer.transmission_chunks_.data(), tchunk_size);
+                    current_header_size += tchunk_size;
+
+                    // small zero-copy chunks are packed into the header in
+                    // the order they appear in the chunks array
+                    if (pack_chunks &&
+                        get_zero_copy_chunks_size(buffer) <=
+                            max_header_size - current_header_size)
+                    {
+                        data_[pos_piggy_back_flag_chunks] = 1;
+                        for (auto const& c : buffer.chunks_)
+                        {
+                            if (c.type_ ==
+                                serialization::chunk_type::chunk_type_pointer)
+                            {
+                                std::memcpy(&data_[current_header_size],
+                                    c.data_.cpos_, c.size_);
+                                current_header_size += c.size_;
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -180,6 +233,17 @@ namespace hpx::parcelset::policies::mpi {
             return get(pos_tag);
         }
 
+        void set_rma(bool rma) noexcept
+        {
+            HPX_ASSERT(!rma || !data_[pos_piggy_back_flag_chunks]);
+            data_[pos_rma_flag] = rma ? 1 : 0;
+        }
+
+        [[nodiscard]] bool rma() const noexcept
+        {
+            return data_[pos_rma_flag] != 0;
+        }
+
         [[nodiscard]] value_type numbytes_nonzero_copy() const noexcept
         {
             return get(pos_numbytes_nonzero_copy);
@@ -220,6 +284,8 @@ namespace hpx::parcelset::policies::mpi {
                 result += numbytes_nonzero_copy();
             if (data_[pos_piggy_back_flag_tchunk])
                 result += numbytes_tchunk();
+            if (data_[pos_piggy_back_flag_chunks])
+                result += numbytes_chunks();
             return result;
         }
 
@@ -240,11 +306,43 @@ namespace hpx::parcelset::policies::mpi {
             return &data_[current_header_size];
         }
 
+        // The zero-copy chunks follow the transmission chunks, the sizes of
+        // the individual chunks are taken from the transmission chunks.
+        [[nodiscard]] constexpr char* piggy_back_chunks() noexcept
+        {
+            if (!data_[pos_piggy_back_flag_chunks])
+                return nullptr;
+            HPX_ASSERT(data_[pos_piggy_back_flag_tchunk]);
+            return piggy_back_tchunk() + numbytes_tchunk();
+        }
+
     private:
         // random magic number for assert_valid
         static constexpr int MAGIC_SIGNATURE = 19527;
         char* data_;
 
+        // the sizes of the zero-copy chunks are stored in the first entries
+        // of the transmission chunks
+        [[nodiscard]] int numbytes_chunks() noexcept
+        {
+            using transmission_chunk_type =
+                std::pair<std::uint64_t, std::uint64_t>;
+
+            char const* tchunks = piggy_back_tchunk();
+            HPX_ASSERT(tchunks != nullptr);
+
+            std::uint64_t result = 0;
+            for (value_type i = 0; i != num_zero_copy_chunks(); ++i)
+            {
+                transmission_chunk_type tchunk;
+                std::memcpy(static_cast<void*>(&tchunk),
+                    tchunks + i * sizeof(transmission_chunk_type),
+                    sizeof(transmission_chunk_type));
+                result += tchunk.second;
+            }
+            return static_cast<int>(result);
+        }
+
         constexpr void set(std::size_t Pos, value_type const& t) noexcept
         {
             *hpx::bit_cast<value_type*>(&data_[Pos]) = t;
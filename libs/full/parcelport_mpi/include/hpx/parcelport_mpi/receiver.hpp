@@ -18,7 +18,9 @@
 #include <hpx/parcelport_mpi/receiver_connection.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <deque>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -35,23 +37,65 @@ namespace hpx::parcelset::policies::mpi {
         using connection_ptr = std::shared_ptr<connection_type>;
         using connection_list = std::deque<connection_ptr>;
 
-        explicit constexpr receiver(Parcelport& pp) noexcept
+        // Several header messages can be received at the same time, each
+        // into its own buffer using a persistent request.
+        receiver(Parcelport& pp, std::size_t num_header_receives)
           : pp_(pp)
-          , hdr_request_(0)
-          , header_buffer_(pp.get_zero_copy_serialization_threshold())
+          , header_buffers_((std::max)(
+                num_header_receives, static_cast<std::size_t>(1)))
+          , hdr_requests_(header_buffers_.size(), MPI_REQUEST_NULL)
+          , completed_indices_(header_buffers_.size())
+          , completed_statuses_(header_buffers_.size())
         {
+            for (auto& buffer : header_buffers_)
+            {
+                buffer.resize(pp.get_eager_threshold());
+            }
         }
 
         void run() noexcept
         {
             util::mpi_environment::scoped_lock l;
-            post_new_header(l);
+            for (std::size_t i = 0; i != header_buffers_.size(); ++i)
+            {
+                std::vector<char>& buffer = header_buffers_[i];
+                [[maybe_unused]] int const ret = MPI_Recv_init(buffer.data(),
+                    static_cast<int>(buffer.size()), MPI_BYTE, MPI_ANY_SOURCE,
+                    0, util::mpi_environment::communicator(),
+                    &hdr_requests_[i]);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+            }
+
+            [[maybe_unused]] int const ret =
+                MPI_Startall(static_cast<int>(hdr_requests_.size()),
+                    hdr_requests_.data());
+            HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+        }
+
+        // Cancel and release the outstanding header receives, called after
+        // all localities have stopped sending.
+        void stop() noexcept
+        {
+            std::unique_lock hl(headers_mtx_);
+            util::mpi_environment::scoped_lock l;
+            for (MPI_Request& r : hdr_requests_)
+            {
+                if (r != MPI_REQUEST_NULL)
+                {
+                    MPI_Cancel(&r);
+                    MPI_Wait(&r, MPI_STATUS_IGNORE);
+                    MPI_Request_free(&r);
+                }
+            }
         }
 
         bool background_work() noexcept
         {
-            // We first try to accept a new connection
-            connection_ptr connection = accept();
+            // We first try to accept a new connection, unless this
+            // locality is overloaded. Not posting any new header receives
+            // holds back the senders.
+            connection_ptr connection =
+                pp_.receive_backpressure() ? connection_ptr() : accept();
 
             // If we don't have a new connection, try to handle one of the
             // already accepted ones.
@@ -108,24 +152,54 @@ namespace hpx::parcelset::policies::mpi {
 
             if (l.locked)
             {
-                MPI_Status status;
-                if (request_done_locked(l, hdr_request_, &status))
+                // test all header receives at once
+                int num_completed = 0;
+                [[maybe_unused]] int ret =
+                    MPI_Testsome(static_cast<int>(hdr_requests_.size()),
+                        hdr_requests_.data(), &num_completed,
+                        completed_indices_.data(), completed_statuses_.data());
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                if (num_completed == MPI_UNDEFINED || num_completed == 0)
+                {
+                    return {};
+                }
+
+                std::vector<connection_ptr> accepted;
+                accepted.reserve(num_completed);
+                for (int i = 0; i != num_completed; ++i)
                 {
+                    auto const idx =
+                        static_cast<std::size_t>(completed_indices_[i]);
+                    MPI_Status const& status = completed_statuses_[i];
+
                     int recv_size = 0;
-                    [[maybe_unused]] int const ret =
-                        MPI_Get_count(&status, MPI_CHAR, &recv_size);
-                    HPX_ASSERT(ret == MPI_SUCCESS);
-                    std::vector<char> recv_header(header_buffer_.begin(),
-                        header_buffer_.begin() + recv_size);
+                    ret = MPI_Get_count(&status, MPI_CHAR, &recv_size);
+                    HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                    std::vector<char> const& buffer = header_buffers_[idx];
+                    std::vector<char> recv_header(
+                        buffer.begin(), buffer.begin() + recv_size);
 
-                    post_new_header(l);
+                    // the persistent request is restarted right away
+                    ret = MPI_Start(&hdr_requests_[idx]);
+                    HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
 
-                    l.unlock();
-                    header_lock.unlock();
+                    accepted.push_back(std::make_shared<connection_type>(
+                        status.MPI_SOURCE, HPX_MOVE(recv_header), pp_));
+                }
 
-                    return std::make_shared<connection_type>(
-                        status.MPI_SOURCE, HPX_MOVE(recv_header), pp_);
+                l.unlock();
+                header_lock.unlock();
+
+                // all but the first connection are handled later on
+                if (accepted.size() > 1)
+                {
+                    std::unique_lock const cl(connections_mtx_);
+                    std::move(std::next(accepted.begin()), accepted.end(),
+                        std::back_inserter(connections_));
                 }
+                return HPX_MOVE(accepted.front());
             }
 
 #if defined(HPX_MSVC)
@@ -135,41 +209,19 @@ namespace hpx::parcelset::policies::mpi {
             return {};
         }
 
-        template <typename Lock>
-        void post_new_header([[maybe_unused]] Lock& l) noexcept
-        {
-            HPX_ASSERT_OWNS_LOCK(l);
-            [[maybe_unused]] int const ret = MPI_Irecv(header_buffer_.data(),
-                static_cast<int>(header_buffer_.size()), MPI_BYTE,
-                MPI_ANY_SOURCE, 0, util::mpi_environment::communicator(),
-                &hdr_request_);
-            HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
-        }
-
         Parcelport& pp_;
 
         hpx::spinlock headers_mtx_;
-        MPI_Request hdr_request_;
-        std::vector<char> header_buffer_;
+        std::vector<std::vector<char>> header_buffers_;
+        std::vector<MPI_Request> hdr_requests_;
+        std::vector<int> completed_indices_;
+        std::vector<MPI_Status> completed_statuses_;
 
         hpx::spinlock handles_header_mtx_;
         handles_header_type handles_header_;
 
         hpx::spinlock connections_mtx_;
         connection_list connections_;
-
-        template <typename Lock>
-        static bool request_done_locked([[maybe_unused]] Lock& l,
-            MPI_Request& r, MPI_Status* status) noexcept
-        {
-            HPX_ASSERT_OWNS_LOCK(l);
-
-            int completed = 0;
-            [[maybe_unused]] int const ret = MPI_Test(&r, &completed, status);
-            HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
-
-            return completed ? true : false;
-        }
     };
 }    // namespace hpx::parcelset::policies::mpi
 
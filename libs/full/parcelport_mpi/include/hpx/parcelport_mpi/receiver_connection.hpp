@@ -14,6 +14,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/mpi_base.hpp>
 #include <hpx/parcelport_mpi/header.hpp>
+#include <hpx/parcelport_mpi/rma_window.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcel_buffer.hpp>
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
@@ -37,6 +38,8 @@ namespace hpx::parcelset::policies::mpi {
             initialized,
             rcvd_transmission_chunks,
             rcvd_data,
+            rcvd_rma_addresses,
+            read_rma_chunks,
             rcvd_chunks,
         };
 
@@ -53,6 +56,7 @@ namespace hpx::parcelset::policies::mpi {
           , request_ptr_(nullptr)
           , chunks_idx_(0)
           , zero_copy_chunks_idx_(0)
+          , ack_(0)
           , pp_(pp)
         {
             header header_ = header(header_buffer.data());
@@ -63,6 +67,7 @@ namespace hpx::parcelset::policies::mpi {
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 #endif
             tag_ = header_.get_tag();
+            rma_ = header_.rma();
             // decode data
             buffer_.data_.resize(header_.numbytes_nonzero_copy());
             char* piggy_back_data = header_.piggy_back_data();
@@ -77,6 +82,7 @@ namespace hpx::parcelset::policies::mpi {
                 need_recv_data = true;
             }
             need_recv_tchunks = false;
+            need_recv_chunks = false;
             if (header_.num_zero_copy_chunks() != 0)
             {
                 // decode transmission chunk
@@ -101,9 +107,32 @@ namespace hpx::parcelset::policies::mpi {
                 }
                 // zero-copy chunks
                 buffer_.chunks_.resize(num_zero_copy_chunks);
-                if (!pp_.allow_zero_copy_receive_optimizations())
+                char const* piggy_back_chunks = header_.piggy_back_chunks();
+                if (piggy_back_chunks)
                 {
+                    // the chunks are small, copying them is cheaper than
+                    // de-serializing the parcels twice
                     chunk_buffers_.resize(num_zero_copy_chunks);
+                    for (int i = 0; i != num_zero_copy_chunks; ++i)
+                    {
+                        auto& c = chunk_buffers_[i];
+                        c.assign(piggy_back_chunks,
+                            piggy_back_chunks + tchunks[i].second);
+                        piggy_back_chunks += tchunks[i].second;
+
+                        // store buffer for decode_parcels below
+                        buffer_.chunks_[i] =
+                            serialization::create_pointer_chunk(
+                                c.data(), c.size());
+                    }
+                }
+                else
+                {
+                    need_recv_chunks = true;
+                    if (!pp_.allow_zero_copy_receive_optimizations())
+                    {
+                        chunk_buffers_.resize(num_zero_copy_chunks);
+                    }
                 }
             }
         }
@@ -121,6 +150,12 @@ namespace hpx::parcelset::policies::mpi {
             case rcvd_data:
                 return receive_chunks(num_thread);
 
+            case rcvd_rma_addresses:
+                return read_chunks_rma(num_thread);
+
+            case read_rma_chunks:
+                return send_rma_ack(num_thread);
+
             case rcvd_chunks:
                 return done(num_thread);
 
@@ -178,6 +213,17 @@ namespace hpx::parcelset::policies::mpi {
 
         bool receive_chunks(std::size_t num_thread = -1)
         {
+            if (!need_recv_chunks)
+            {
+                state_ = rcvd_chunks;
+                return done(num_thread);
+            }
+
+            if (rma_)
+            {
+                return receive_rma_addresses(num_thread);
+            }
+
             if (pp_.allow_zero_copy_receive_optimizations())
             {
                 if (!request_done())
@@ -189,39 +235,7 @@ namespace hpx::parcelset::policies::mpi {
                 // to receive_chunks only
                 if (parcels_.empty())
                 {
-                    HPX_ASSERT(zero_copy_chunks_idx_ == 0);
-
-                    auto const num_zero_copy_chunks = static_cast<std::size_t>(
-                        static_cast<std::uint32_t>(buffer_.num_chunks_.first));
-                    if (num_zero_copy_chunks != 0)
-                    {
-                        HPX_ASSERT(
-                            buffer_.chunks_.size() == num_zero_copy_chunks);
-
-                        // De-serialize the parcels such that all data but the
-                        // zero-copy chunks are in place. This de-serialization also
-                        // allocates all zero-chunk buffers and stores those in the
-                        // chunks array for the subsequent networking to place the
-                        // received data directly.
-                        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
-                        {
-                            auto const chunk_size = static_cast<std::size_t>(
-                                buffer_.transmission_chunks_[i].second);
-                            buffer_.chunks_[i] =
-                                serialization::create_pointer_chunk(
-                                    nullptr, chunk_size);
-                        }
-
-                        parcels_ =
-                            decode_parcels_zero_copy(pp_, buffer_, num_thread);
-
-                        // note that at this point, buffer_.chunks_ will have
-                        // entries for all chunks, including the non-zero-copy ones
-                    }
-
-                    // we should have received at least one parcel if there are
-                    // zero-copy chunks to be received
-                    HPX_ASSERT(parcels_.empty() || !buffer_.chunks_.empty());
+                    decode_zero_copy_parcels(num_thread);
                 }
 
                 while (chunks_idx_ != buffer_.chunks_.size())
@@ -304,6 +318,154 @@ namespace hpx::parcelset::policies::mpi {
             return done(num_thread);
         }
 
+        void decode_zero_copy_parcels(std::size_t num_thread)
+        {
+            HPX_ASSERT(zero_copy_chunks_idx_ == 0);
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            if (num_zero_copy_chunks != 0)
+            {
+                HPX_ASSERT(buffer_.chunks_.size() == num_zero_copy_chunks);
+
+                // De-serialize the parcels such that all data but the
+                // zero-copy chunks are in place. This de-serialization also
+                // allocates all zero-chunk buffers and stores those in the
+                // chunks array for the subsequent networking to place the
+                // received data directly.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        nullptr, chunk_size);
+                }
+
+                parcels_ = decode_parcels_zero_copy(pp_, buffer_, num_thread);
+
+                // note that at this point, buffer_.chunks_ will have entries
+                // for all chunks, including the non-zero-copy ones
+            }
+
+            // we should have received at least one parcel if there are
+            // zero-copy chunks to be received
+            HPX_ASSERT(parcels_.empty() || !buffer_.chunks_.empty());
+        }
+
+        // The sender has exposed the zero-copy chunks in its RMA window, we
+        // set up the buffers for them and receive their addresses.
+        bool receive_rma_addresses(std::size_t num_thread)
+        {
+            if (!request_done())
+            {
+                return false;
+            }
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            HPX_ASSERT(num_zero_copy_chunks != 0);
+
+            if (pp_.allow_zero_copy_receive_optimizations())
+            {
+                decode_zero_copy_parcels(num_thread);
+            }
+            else
+            {
+                HPX_ASSERT(chunk_buffers_.size() == num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto& c = chunk_buffers_[i];
+                    c.resize(buffer_.transmission_chunks_[i].second);
+
+                    // store buffer for decode_parcels below
+                    buffer_.chunks_[i] =
+                        serialization::create_pointer_chunk(c.data(), c.size());
+                }
+            }
+
+            rma_addresses_.resize(num_zero_copy_chunks);
+            {
+                util::mpi_environment::scoped_lock l;
+
+                [[maybe_unused]] int const ret = MPI_Irecv(
+                    rma_addresses_.data(),
+                    static_cast<int>(rma_addresses_.size() * sizeof(MPI_Aint)),
+                    MPI_BYTE, src_, tag_, util::mpi_environment::communicator(),
+                    &request_);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                request_ptr_ = &request_;
+            }
+
+            state_ = rcvd_rma_addresses;
+            return read_chunks_rma(num_thread);
+        }
+
+        // Read all zero-copy chunks directly into their final buffers.
+        bool read_chunks_rma(std::size_t num_thread = -1)
+        {
+            if (!request_done())
+            {
+                return false;
+            }
+
+            rma_requests_.assign(rma_addresses_.size(), MPI_REQUEST_NULL);
+            {
+                util::mpi_environment::scoped_lock l;
+
+                rma_window& window = pp_.get_rma_window();
+                std::size_t idx = 0;
+                for (auto& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        continue;    // skip non-zero-copy chunks
+                    }
+
+                    HPX_ASSERT(idx != rma_addresses_.size());
+                    window.get(c.data(), c.size(), src_, rma_addresses_[idx],
+                        &rma_requests_[idx]);
+                    ++idx;
+                }
+                HPX_ASSERT(idx == rma_addresses_.size());
+            }
+
+            state_ = read_rma_chunks;
+            return send_rma_ack(num_thread);
+        }
+
+        // Let the sender know that it may release the zero-copy chunks.
+        bool send_rma_ack(std::size_t num_thread)
+        {
+            {
+                util::mpi_environment::scoped_try_lock l;
+                if (!l.locked)
+                {
+                    return false;
+                }
+
+                int completed = 0;
+                [[maybe_unused]] int ret =
+                    MPI_Testall(static_cast<int>(rma_requests_.size()),
+                        rma_requests_.data(), &completed, MPI_STATUSES_IGNORE);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+                if (!completed)
+                {
+                    return false;
+                }
+
+                ret = MPI_Isend(&ack_, 1, MPI_BYTE, src_, tag_,
+                    util::mpi_environment::communicator(), &request_);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                request_ptr_ = &request_;
+            }
+
+            rma_requests_.clear();
+            state_ = rcvd_chunks;
+            return done(num_thread);
+        }
+
         bool done(std::size_t num_thread = -1) noexcept
         {
             if (!request_done())
@@ -319,10 +481,9 @@ namespace hpx::parcelset::policies::mpi {
             {
                 // decode and handle received data
                 HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
+                    !need_recv_chunks ||
                     !pp_.allow_zero_copy_receive_optimizations());
-                handle_received_parcels(
-                    decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
-                    num_thread);
+                decode_and_handle_parcels(pp_, HPX_MOVE(buffer_), num_thread);
                 chunk_buffers_.clear();
             }
             else
@@ -369,8 +530,10 @@ namespace hpx::parcelset::policies::mpi {
 
         int src_;
         int tag_;
+        bool rma_;
         bool need_recv_data;
         bool need_recv_tchunks;
+        bool need_recv_chunks;
         buffer_type buffer_;
 
         MPI_Request request_;
@@ -378,6 +541,10 @@ namespace hpx::parcelset::policies::mpi {
         std::size_t chunks_idx_;
         std::size_t zero_copy_chunks_idx_;
 
+        std::vector<MPI_Aint> rma_addresses_;
+        std::vector<MPI_Request> rma_requests_;
+        char ack_;
+
         Parcelport& pp_;
 
         std::vector<parcelset::parcel> parcels_;
@@ -0,0 +1,112 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_MPI)
+#include <hpx/assert.hpp>
+#include <hpx/modules/mpi_base.hpp>
+
+#include <cstddef>
+
+namespace hpx::parcelset::policies::mpi {
+
+    // A dynamic MPI window used for the rendezvous protocol of large
+    // messages: the sender attaches the zero-copy chunks of a message to the
+    // window and the receiver reads them directly into its own buffers.
+    //
+    // All functions but enabled() have to be called while holding the lock
+    // of the MPI environment.
+    struct rma_window
+    {
+        rma_window() noexcept
+          : win_(MPI_WIN_NULL)
+        {
+        }
+
+        rma_window(rma_window const&) = delete;
+        rma_window(rma_window&&) = delete;
+        rma_window& operator=(rma_window const&) = delete;
+        rma_window& operator=(rma_window&&) = delete;
+
+        [[nodiscard]] bool enabled() const noexcept
+        {
+            return win_ != MPI_WIN_NULL;
+        }
+
+        // Collectively create the window, this has to be called by all
+        // localities.
+        void create()
+        {
+            HPX_ASSERT(!enabled());
+
+            [[maybe_unused]] int ret = MPI_Win_create_dynamic(MPI_INFO_NULL,
+                util::mpi_environment::communicator(), &win_);
+            HPX_ASSERT(ret == MPI_SUCCESS);
+
+            // all reads are performed in a single passive target epoch
+            ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+            HPX_ASSERT(ret == MPI_SUCCESS);
+        }
+
+        // Collectively free the window.
+        void free()
+        {
+            if (enabled())
+            {
+                MPI_Win_unlock_all(win_);
+                MPI_Win_free(&win_);
+            }
+        }
+
+        // Expose the given memory, returns the address the remote side has
+        // to use to read from it.
+        [[nodiscard]] MPI_Aint attach(void const* data, std::size_t size)
+        {
+            HPX_ASSERT(enabled());
+
+            void* base = const_cast<void*>(data);
+            [[maybe_unused]] int ret = MPI_Win_attach(
+                win_, base, static_cast<MPI_Aint>(size));
+            HPX_ASSERT(ret == MPI_SUCCESS);
+
+            MPI_Aint address = 0;
+            ret = MPI_Get_address(base, &address);
+            HPX_ASSERT(ret == MPI_SUCCESS);
+
+            return address;
+        }
+
+        void detach(void const* data)
+        {
+            HPX_ASSERT(enabled());
+
+            [[maybe_unused]] int const ret =
+                MPI_Win_detach(win_, const_cast<void*>(data));
+            HPX_ASSERT(ret == MPI_SUCCESS);
+        }
+
+        // Start reading the given number of bytes from the memory exposed
+        // by locality rank at the given address.
+        void get(void* data, std::size_t size, int rank, MPI_Aint address,
+            MPI_Request* request)
+        {
+            HPX_ASSERT(enabled());
+
+            [[maybe_unused]] int const ret = MPI_Rget(data,
+                static_cast<int>(size), MPI_BYTE, rank, address,
+                static_cast<int>(size), MPI_BYTE, win_, request);
+            HPX_ASSERT(ret == MPI_SUCCESS);
+        }
+
+    private:
+        MPI_Win win_;
+    };
+}    // namespace hpx::parcelset::policies::mpi
+
+#endif
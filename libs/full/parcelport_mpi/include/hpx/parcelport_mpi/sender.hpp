@@ -16,10 +16,14 @@
 #include <hpx/modules/mpi_base.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/parcelport_mpi/rma_window.hpp>
 #include <hpx/parcelport_mpi/sender_connection.hpp>
 #include <hpx/parcelport_mpi/tag_provider.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <deque>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -35,11 +39,24 @@ namespace hpx::parcelset::policies::mpi {
         using connection_ptr = std::shared_ptr<connection_type>;
         using connection_list = std::deque<connection_ptr>;
 
+        // Messages up to the given size (including the header) are sent as
+        // a single MPI message.
+        explicit sender(std::size_t eager_threshold) noexcept
+          : eager_threshold_(eager_threshold)
+        {
+        }
+
         void run() noexcept {}
 
         connection_ptr create_connection(int dest, parcelset::parcelport* pp)
         {
-            return std::make_shared<connection_type>(this, dest, pp);
+            return std::make_shared<connection_type>(
+                this, dest, pp, eager_threshold_);
+        }
+
+        [[nodiscard]] std::size_t eager_threshold() const noexcept
+        {
+            return eager_threshold_;
         }
 
         void add(connection_ptr const& ptr)
@@ -53,6 +70,11 @@ namespace hpx::parcelset::policies::mpi {
             return tag_provider_.get_next_tag();
         }
 
+        rma_window& get_rma_window() noexcept
+        {
+            return rma_window_;
+        }
+
         void send_messages(connection_ptr connection)
         {
             // Check if sending has been completed....
@@ -77,21 +99,88 @@ namespace hpx::parcelset::policies::mpi {
 
         bool background_work() noexcept
         {
-            connection_ptr connection;
+            // take a batch of connections to make progress on
+            connection_list connections;
             {
                 std::unique_lock const l(connections_mtx_, std::try_to_lock);
                 if (l && !connections_.empty())
                 {
-                    connection = HPX_MOVE(connections_.front());
-                    connections_.pop_front();
+                    std::size_t const count =
+                        (std::min)(connections_.size(), max_batch_size);
+                    std::move(connections_.begin(),
+                        std::next(connections_.begin(),
+                            static_cast<std::ptrdiff_t>(count)),
+                        std::back_inserter(connections));
+                    connections_.erase(connections_.begin(),
+                        std::next(connections_.begin(),
+                            static_cast<std::ptrdiff_t>(count)));
+                }
+            }
+
+            if (connections.empty())
+            {
+                return false;
+            }
+
+            // test the outstanding requests of all connections at once
+            std::array<MPI_Request, max_batch_size> requests;
+            std::array<int, max_batch_size> indices;
+            std::array<bool, max_batch_size> ready{};
+
+            int num_requests = 0;
+            for (std::size_t i = 0; i != connections.size(); ++i)
+            {
+                MPI_Request const* request = connections[i]->pending_request();
+                if (request == nullptr)
+                {
+                    ready[i] = true;
+                }
+                else
+                {
+                    indices[num_requests] = static_cast<int>(i);
+                    requests[num_requests++] = *request;
                 }
             }
 
+            if (num_requests != 0)
+            {
+                util::mpi_environment::scoped_try_lock l;
+                if (l.locked)
+                {
+                    std::array<int, max_batch_size> completed;
+                    int num_completed = 0;
+                    [[maybe_unused]] int const ret = MPI_Testsome(num_requests,
+                        requests.data(), &num_completed, completed.data(),
+                        MPI_STATUSES_IGNORE);
+                    HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                    for (int i = 0;
+                         num_completed != MPI_UNDEFINED && i != num_completed;
+                         ++i)
+                    {
+                        auto const idx = static_cast<std::size_t>(
+                            indices[completed[i]]);
+                        connections[idx]->request_completed();
+                        ready[idx] = true;
+                    }
+                }
+            }
+
+            // continue sending on connections whose request has completed,
+            // the others are tested again later on
             bool has_work = false;
-            if (connection)
+            for (std::size_t i = 0; i != connections.size(); ++i)
             {
-                send_messages(HPX_MOVE(connection));
-                has_work = true;
+                if (ready[i])
+                {
+                    send_messages(HPX_MOVE(connections[i]));
+                    has_work = true;
+                }
+                else
+                {
+                    std::unique_lock l(connections_mtx_);
+                    connections_.push_back(HPX_MOVE(connections[i]));
+                }
             }
             return has_work;
         }
@@ -113,7 +202,11 @@ namespace hpx::parcelset::policies::mpi {
         }
 
     private:
+        static constexpr std::size_t max_batch_size = 16;
+
+        std::size_t eager_threshold_;
         tag_provider tag_provider_;
+        rma_window rma_window_;
         hpx::spinlock connections_mtx_;
         connection_list connections_;
     };
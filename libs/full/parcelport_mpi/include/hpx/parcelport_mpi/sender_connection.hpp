@@ -16,6 +16,7 @@
 #include <hpx/modules/mpi_base.hpp>
 #include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelport_mpi/locality.hpp>
+#include <hpx/parcelport_mpi/rma_window.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
@@ -37,6 +38,7 @@ namespace hpx::parcelset::policies::mpi {
     struct sender_connection;
 
     int acquire_tag(sender*) noexcept;
+    rma_window& get_rma_window(sender*) noexcept;
     void add_connection(sender*, std::shared_ptr<sender_connection> const&);
 
     struct sender_connection
@@ -56,6 +58,7 @@ namespace hpx::parcelset::policies::mpi {
             sent_header,
             sent_transmission_chunks,
             sent_data,
+            sent_rma_addresses,
             sent_chunks
         };
 
@@ -63,7 +66,8 @@ namespace hpx::parcelset::policies::mpi {
             parcelset::parcelport_connection<sender_connection, data_type>;
 
     public:
-        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp)
+        sender_connection(sender_type* s, int dst, parcelset::parcelport* pp,
+            std::size_t eager_threshold)
           : state_(initialized)
           , sender_(s)
           , tag_(-1)
@@ -72,6 +76,8 @@ namespace hpx::parcelset::policies::mpi {
           , request_ptr_(nullptr)
           , chunks_idx_(0)
           , ack_(0)
+          , rma_(false)
+          , eager_threshold_(eager_threshold)
           , pp_(pp)
           , there_(parcelset::locality(locality(dst_)))
         {
@@ -103,12 +109,24 @@ namespace hpx::parcelset::policies::mpi {
 #endif
             request_ptr_ = nullptr;
             chunks_idx_ = 0;
-            tag_ = acquire_tag(sender_);
+            // chunks in device memory can't be copied into the header
+            bool const pack_chunks = !pp_->allow_device_memory();
             header_buffer.resize(header::get_header_size(
-                buffer_, pp_->get_zero_copy_serialization_threshold()));
+                buffer_, eager_threshold_, pack_chunks));
             header_ = header(buffer_, static_cast<char*>(header_buffer.data()),
-                header_buffer.size());
+                header_buffer.size(), pack_chunks);
+
+            // Eager messages are sent completely as part of the header (tag
+            // 0), only rendezvous messages need a tag for the remaining data.
+            tag_ = is_eager() ? 0 : acquire_tag(sender_);
             header_.set_tag(tag_);
+
+            // the receiver reads the zero-copy chunks directly from our
+            // memory if possible
+            rma_ = buffer_.num_chunks_.first != 0 &&
+                !header_.piggy_back_chunks() &&
+                get_rma_window(sender_).enabled();
+            header_.set_rma(rma_);
             header_.assert_valid();
 
             state_ = initialized;
@@ -145,6 +163,9 @@ namespace hpx::parcelset::policies::mpi {
             case sent_data:
                 return send_chunks();
 
+            case sent_rma_addresses:
+                return receive_rma_ack();
+
             case sent_chunks:
                 return done();
 
@@ -231,6 +252,17 @@ namespace hpx::parcelset::policies::mpi {
         {
             HPX_ASSERT(state_ == sent_data);
 
+            if (rma_)
+            {
+                return send_rma_addresses();
+            }
+
+            if (header_.piggy_back_chunks())
+            {
+                state_ = sent_chunks;
+                return done();
+            }
+
             while (chunks_idx_ < buffer_.chunks_.size())
             {
                 auto const& c = buffer_.chunks_[chunks_idx_];
@@ -260,6 +292,69 @@ namespace hpx::parcelset::policies::mpi {
             return done();
         }
 
+        // Expose all zero-copy chunks through the RMA window and send their
+        // addresses instead of the chunks themselves.
+        bool send_rma_addresses()
+        {
+            HPX_ASSERT(state_ == sent_data);
+            if (!request_done())
+            {
+                return false;
+            }
+
+            {
+                util::mpi_environment::scoped_lock l;
+
+                rma_window& window = get_rma_window(sender_);
+                rma_addresses_.clear();
+                for (auto const& c : buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                        serialization::chunk_type::chunk_type_pointer)
+                    {
+                        rma_addresses_.push_back(
+                            window.attach(c.data_.cpos_, c.size_));
+                    }
+                }
+
+                [[maybe_unused]] int const ret = MPI_Isend(
+                    rma_addresses_.data(),
+                    static_cast<int>(rma_addresses_.size() * sizeof(MPI_Aint)),
+                    MPI_BYTE, dst_, tag_, util::mpi_environment::communicator(),
+                    &request_);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                request_ptr_ = &request_;
+            }
+
+            state_ = sent_rma_addresses;
+            return receive_rma_ack();
+        }
+
+        // The chunks have to stay exposed until the receiver has read them.
+        bool receive_rma_ack()
+        {
+            HPX_ASSERT(state_ == sent_rma_addresses);
+            if (!request_done())
+            {
+                return false;
+            }
+
+            {
+                util::mpi_environment::scoped_lock l;
+
+                [[maybe_unused]] int const ret = MPI_Irecv(&ack_, 1, MPI_BYTE,
+                    dst_, tag_, util::mpi_environment::communicator(),
+                    &request_);
+                HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+
+                request_ptr_ = &request_;
+            }
+
+            state_ = sent_chunks;
+            return done();
+        }
+
         bool done()
         {
             if (!request_done())
@@ -267,6 +362,22 @@ namespace hpx::parcelset::policies::mpi {
                 return false;
             }
 
+            if (rma_)
+            {
+                util::mpi_environment::scoped_lock l;
+
+                rma_window& window = get_rma_window(sender_);
+                for (auto const& c : buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                        serialization::chunk_type::chunk_type_pointer)
+                    {
+                        window.detach(c.data_.cpos_);
+                    }
+                }
+                rma_ = false;
+            }
+
             error_code const ec(throwmode::lightweight);
             handler_(ec);
             handler_.reset();
@@ -277,6 +388,7 @@ namespace hpx::parcelset::policies::mpi {
                 buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 #endif
+            pp_->release_send_buffer(HPX_MOVE(buffer_.data_));
             buffer_.clear();
 
             state_ = initialized;
@@ -284,6 +396,28 @@ namespace hpx::parcelset::policies::mpi {
             return true;
         }
 
+        // The request of the currently outstanding MPI operation, if any.
+        // This allows the sender to test the requests of many connections
+        // at once.
+        [[nodiscard]] MPI_Request* pending_request() const noexcept
+        {
+            return request_ptr_;
+        }
+
+        void request_completed() noexcept
+        {
+            request_ptr_ = nullptr;
+        }
+
+        [[nodiscard]] bool is_eager() noexcept
+        {
+            return header_.piggy_back_data() != nullptr &&
+                (buffer_.transmission_chunks_.empty() ||
+                    header_.piggy_back_tchunk() != nullptr) &&
+                (buffer_.num_chunks_.first == 0 ||
+                    header_.piggy_back_chunks() != nullptr);
+        }
+
         bool request_done()
         {
             if (request_ptr_ == nullptr)
@@ -325,6 +459,11 @@ namespace hpx::parcelset::policies::mpi {
         std::size_t chunks_idx_;
         char ack_;
 
+        bool rma_;
+        std::vector<MPI_Aint> rma_addresses_;
+
+        std::size_t eager_threshold_;
+
         parcelset::parcelport* pp_;
 
         parcelset::locality there_;
@@ -21,6 +21,7 @@
 #include <hpx/plugin/traits/plugin_config_data.hpp>
 
 #include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelport_mpi/locality.hpp>
 #include <hpx/parcelport_mpi/receiver.hpp>
 #include <hpx/parcelport_mpi/sender.hpp>
@@ -28,6 +29,7 @@
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/plugin_factories/parcelport_factory.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -50,6 +52,7 @@ namespace hpx::parcelset {
         using send_early_parcel = std::true_type;
         using do_background_work = std::true_type;
         using send_immediate_parcels = std::true_type;
+        using send_streaming_parcels = std::false_type;
         using is_connectionless = std::true_type;
 
         static constexpr const char* type() noexcept
@@ -75,6 +78,11 @@ namespace hpx::parcelset {
             return s->acquire_tag();
         }
 
+        rma_window& get_rma_window(sender* s) noexcept
+        {
+            return s->get_rma_window();
+        }
+
         void add_connection(
             sender* s, std::shared_ptr<sender_connection> const& ptr)
         {
@@ -138,16 +146,52 @@ namespace hpx::parcelset {
                 return false;
             }
 
+            static std::size_t header_receives(
+                util::runtime_configuration const& ini)
+            {
+                return (std::max)(hpx::util::get_entry_as<std::size_t>(
+                                      ini, "hpx.parcel.mpi.header_receives", 4),
+                    static_cast<std::size_t>(1));
+            }
+
+            // The maximal size of messages sent eagerly, i.e. as part of the
+            // header. This has to be the same on all localities.
+            static std::size_t eager_threshold(
+                util::runtime_configuration const& ini,
+                std::size_t zero_copy_serialization_threshold)
+            {
+                return (std::max)(hpx::util::get_entry_as<std::size_t>(ini,
+                                      "hpx.parcel.mpi.eager_threshold",
+                                      zero_copy_serialization_threshold),
+                    static_cast<std::size_t>(header::pos_piggy_back_address));
+            }
+
+            static bool enable_rma_rendezvous(
+                util::runtime_configuration const& ini)
+            {
+                if (hpx::util::get_entry_as<std::size_t>(
+                        ini, "hpx.parcel.mpi.rma_rendezvous", 0) != 0)
+                {
+                    return true;
+                }
+                return false;
+            }
+
         public:
             using sender_type = sender;
             parcelport(util::runtime_configuration const& ini,
                 threads::policies::callback_notifier const& notifier)
               : base_type(ini, here(), notifier)
               , stopped_(false)
-              , receiver_(*this)
+              , sender_(eager_threshold(
+                    ini, get_zero_copy_serialization_threshold()))
+              , receiver_(*this, header_receives(ini))
               , background_threads_(background_threads(ini))
               , multi_threaded_mpi_(multi_threaded_mpi(ini))
               , enable_send_immediate_(enable_send_immediate(ini))
+              // device memory can't portably be attached to an RMA window
+              , enable_rma_rendezvous_(
+                    enable_rma_rendezvous(ini) && !allow_device_memory())
             {
             }
 
@@ -164,6 +208,12 @@ namespace hpx::parcelset {
             // Start the handling of connections.
             bool do_run()
             {
+                if (enable_rma_rendezvous_)
+                {
+                    util::mpi_environment::scoped_lock l;
+                    sender_.get_rma_window().create();
+                }
+
                 receiver_.run();
                 sender_.run();
 
@@ -191,11 +241,19 @@ namespace hpx::parcelset {
                 bool expected = false;
                 if (stopped_.compare_exchange_strong(expected, true))
                 {
-                    util::mpi_environment::scoped_lock l;
+                    {
+                        util::mpi_environment::scoped_lock l;
 
-                    [[maybe_unused]] int const ret =
-                        MPI_Barrier(util::mpi_environment::communicator());
-                    HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+                        [[maybe_unused]] int const ret =
+                            MPI_Barrier(util::mpi_environment::communicator());
+                        HPX_ASSERT_LOCKED(l, ret == MPI_SUCCESS);
+                    }
+
+                    // no more headers will arrive
+                    receiver_.stop();
+
+                    util::mpi_environment::scoped_lock l;
+                    sender_.get_rma_window().free();
                 }
             }
 
@@ -245,6 +303,18 @@ namespace hpx::parcelset {
                 return has_work;
             }
 
+            // used by the receivers to read the zero-copy chunks exposed by
+            // the sending locality
+            rma_window& get_rma_window() noexcept
+            {
+                return sender_.get_rma_window();
+            }
+
+            std::size_t get_eager_threshold() const noexcept
+            {
+                return sender_.eager_threshold();
+            }
+
             bool can_send_immediate()
             {
                 return enable_send_immediate_;
@@ -326,6 +396,7 @@ namespace hpx::parcelset {
             std::size_t background_threads_;
             bool multi_threaded_mpi_;
             bool enable_send_immediate_;
+            bool enable_rma_rendezvous_;
         };
     }    // namespace policies::mpi
 }    // namespace hpx::parcelset
@@ -388,6 +459,25 @@ struct hpx::traits::plugin_config_data<
             // number of cores that do background work, default: all
             "background_threads = "
             "${HPX_HAVE_PARCELPORT_MPI_BACKGROUND_THREADS:-1}\n"
+
+            // number of concurrently posted receives for message headers
+            "header_receives = "
+            "${HPX_HAVE_PARCELPORT_MPI_HEADER_RECEIVES:4}\n"
+
+            // maximal size of messages sent as a single MPI message,
+            // default: the zero-copy serialization threshold
+            "eager_threshold = "
+            "${HPX_HAVE_PARCELPORT_MPI_EAGER_THRESHOLD:"
+            "$[hpx.parcel.mpi.zero_copy_serialization_threshold]}\n"
+
+            // send zero-copy chunks from device memory, this requires a
+            // CUDA-aware MPI implementation, default: off
+            "device_memory = "
+            "${HPX_HAVE_PARCELPORT_MPI_DEVICE_MEMORY:0}\n"
+
+            // read zero-copy chunks using MPI RMA, default: off
+            "rma_rendezvous = "
+            "${HPX_HAVE_PARCELPORT_MPI_RMA_RENDEZVOUS:0}\n"
             "sendimm = 0\n";
     }
 };    // namespace hpx::traits
@@ -0,0 +1,96 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The shared memory endpoint of a locality: the node it runs on, its
+    // process id, and the (random) id of the shared memory segment it
+    // receives parcels through.
+    class locality
+    {
+    public:
+        constexpr locality() noexcept
+          : node_(0)
+          , segment_(0)
+          , pid_(-1)
+        {
+        }
+
+        constexpr locality(std::uint64_t node, std::uint64_t segment,
+            std::int32_t pid) noexcept
+          : node_(node)
+          , segment_(segment)
+          , pid_(pid)
+        {
+        }
+
+        [[nodiscard]] constexpr std::uint64_t node() const noexcept
+        {
+            return node_;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t segment() const noexcept
+        {
+            return segment_;
+        }
+
+        [[nodiscard]] constexpr std::int32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        // a locality without a segment can't receive any parcels
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return segment_ != 0;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend constexpr bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.node_ == rhs.node_ && lhs.segment_ == rhs.segment_ &&
+                lhs.pid_ == rhs.pid_;
+        }
+
+        friend constexpr bool operator<(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            if (lhs.node_ != rhs.node_)
+                return lhs.node_ < rhs.node_;
+            if (lhs.segment_ != rhs.segment_)
+                return lhs.segment_ < rhs.segment_;
+            return lhs.pid_ < rhs.pid_;
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::uint64_t node_;
+        std::uint64_t segment_;
+        std::int32_t pid_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,80 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/receiver_connection.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    struct receiver
+    {
+        using connection_type = receiver_connection<Parcelport>;
+
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+        {
+        }
+
+        // Start receiving from all channels of the given segment.
+        void run(segment const& s)
+        {
+            std::uint32_t const num_channels = s.num_channels();
+
+            connections_.reserve(num_channels);
+            for (std::uint32_t i = 0; i != num_channels; ++i)
+            {
+                connections_.push_back(
+                    std::make_unique<entry>(s.get_channel(i), pp_));
+            }
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            // each channel is handled by one thread at a time
+            bool has_work = false;
+            for (auto& e : connections_)
+            {
+                std::unique_lock l(e->mtx_, std::try_to_lock);
+                if (l.owns_lock())
+                {
+                    has_work = e->connection_.receive(num_thread) || has_work;
+                }
+            }
+            return has_work;
+        }
+
+    private:
+        struct entry
+        {
+            entry(channel ch, Parcelport& pp) noexcept
+              : connection_(ch, pp)
+            {
+            }
+
+            hpx::spinlock mtx_;
+            connection_type connection_;
+        };
+
+        Parcelport& pp_;
+        std::vector<std::unique_ptr<entry>> connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,354 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Receives the messages written to one of the channels of the segment
+    // owned by this locality.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            initialized,
+            rcvd_header,
+            rcvd_transmission_chunks,
+            rcvd_data
+        };
+
+        using data_type = std::vector<char>;
+        using buffer_type =
+            parcel_buffer<data_type, serialization::serialization_chunk>;
+
+    public:
+        receiver_connection(channel ch, Parcelport& pp) noexcept
+          : channel_(ch)
+          , state_(initialized)
+          , header_()
+          , offset_(0)
+          , chunks_idx_(0)
+          , has_address_(false)
+          , address_(0)
+          , pp_(pp)
+        {
+        }
+
+        // Make progress receiving the current message, returns whether any
+        // data was consumed.
+        bool receive(std::size_t num_thread = -1)
+        {
+            channel_header& header = channel_.header();
+
+            channel_state const state =
+                header.state.load(std::memory_order_acquire);
+            if (state == channel_state::free ||
+                state == channel_state::claimed)
+            {
+                return false;
+            }
+
+            // decide whether the memory of a new sender can be read directly
+            if (header.zero_copy.load(std::memory_order_relaxed) ==
+                zero_copy_state::unknown)
+            {
+                header.zero_copy.store(
+                    probe_remote_memory(
+                        header.sender_pid, header.probe_address) ?
+                        zero_copy_state::available :
+                        zero_copy_state::unavailable,
+                    std::memory_order_release);
+            }
+
+            if (state_ == initialized && channel_.empty())
+            {
+                if (state == channel_state::closed)
+                {
+                    // all data of the previous sender has been consumed
+                    free_channel();
+                    return true;
+                }
+                return false;
+            }
+
+            std::uint64_t const tail =
+                header.tail.load(std::memory_order_relaxed);
+
+            bool const completed = receive_message(num_thread);
+            return completed ||
+                tail != header.tail.load(std::memory_order_relaxed);
+        }
+
+    private:
+        bool receive_message(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+            case initialized:
+                return receive_header(num_thread);
+
+            case rcvd_header:
+                return receive_transmission_chunks(num_thread);
+
+            case rcvd_transmission_chunks:
+                return receive_data(num_thread);
+
+            case rcvd_data:
+                return receive_chunks(num_thread);
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool receive_header(std::size_t num_thread)
+        {
+            if (!read(&header_, sizeof(header_)))
+            {
+                return false;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_.data_size);
+#endif
+            auto const num_zero_copy_chunks =
+                static_cast<std::size_t>(header_.num_zero_copy_chunks);
+
+            buffer_.data_.resize(static_cast<std::size_t>(header_.data_size));
+            buffer_.num_chunks_.first = header_.num_zero_copy_chunks;
+            buffer_.num_chunks_.second = header_.num_non_zero_copy_chunks;
+            buffer_.transmission_chunks_.resize(
+                static_cast<std::size_t>(header_.num_transmission_chunks));
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+
+            state_ = rcvd_header;
+            return receive_transmission_chunks(num_thread);
+        }
+
+        bool receive_transmission_chunks(std::size_t num_thread)
+        {
+            auto& tchunks = buffer_.transmission_chunks_;
+            if (!read(tchunks.data(),
+                    tchunks.size() *
+                        sizeof(buffer_type::transmission_chunk_type)))
+            {
+                return false;
+            }
+
+            state_ = rcvd_transmission_chunks;
+            return receive_data(num_thread);
+        }
+
+        bool receive_data(std::size_t num_thread)
+        {
+            if (!read(buffer_.data_.data(), buffer_.data_.size()))
+            {
+                return false;
+            }
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            if (num_zero_copy_chunks != 0)
+            {
+                if (pp_.allow_zero_copy_receive_optimizations())
+                {
+                    // De-serialize the parcels such that all data but the
+                    // zero-copy chunks are in place. This also allocates the
+                    // buffers for the zero-copy chunks the data is received
+                    // into.
+                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                    {
+                        auto const chunk_size = static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[i].second);
+                        buffer_.chunks_[i] =
+                            serialization::create_pointer_chunk(
+                                nullptr, chunk_size);
+                    }
+
+                    parcels_ =
+                        decode_parcels_zero_copy(pp_, buffer_, num_thread);
+
+                    // note that at this point, buffer_.chunks_ will have
+                    // entries for all chunks, including the non-zero-copy
+                    // ones
+                    HPX_ASSERT(!parcels_.empty());
+                }
+                else
+                {
+                    chunk_buffers_.resize(num_zero_copy_chunks);
+                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                    {
+                        auto& c = chunk_buffers_[i];
+                        c.resize(static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[i].second));
+
+                        // store buffer for decode_parcels below
+                        buffer_.chunks_[i] =
+                            serialization::create_pointer_chunk(
+                                c.data(), c.size());
+                    }
+                }
+            }
+
+            state_ = rcvd_data;
+            return receive_chunks(num_thread);
+        }
+
+        bool receive_chunks(std::size_t num_thread)
+        {
+            // the zero-copy chunks are received into the buffers set up in
+            // receive_data, the non-zero-copy chunks are skipped
+            while (chunks_idx_ != buffer_.chunks_.size())
+            {
+                auto& c = buffer_.chunks_[chunks_idx_];
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer &&
+                    !receive_chunk(c.data(), c.size()))
+                {
+                    return false;
+                }
+                ++chunks_idx_;
+            }
+
+            return done(num_thread);
+        }
+
+        bool receive_chunk(void* data, std::size_t size)
+        {
+            if (!has_address_)
+            {
+                if (!read(&address_, sizeof(address_)))
+                {
+                    return false;
+                }
+                has_address_ = true;
+            }
+
+            if (address_ == 0)
+            {
+                // the chunk was copied into the ring
+                if (!read(data, size))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                std::int32_t const pid = channel_.header().sender_pid;
+                if (!read_remote_memory(pid, data, address_, size))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::network_error,
+                        "shmem::receiver_connection::receive_chunk",
+                        "reading {} bytes from process {} failed", size, pid);
+                }
+            }
+
+            has_address_ = false;
+            return true;
+        }
+
+        bool done(std::size_t num_thread)
+        {
+            // the sender may now release the memory referenced by the message
+            channel_.header().acked.fetch_add(1, std::memory_order_release);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+#endif
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                decode_and_handle_parcels(pp_, HPX_MOVE(buffer_), num_thread);
+                chunk_buffers_.clear();
+            }
+            else
+            {
+                // handle the received zero-copy parcels.
+                handle_received_parcels(HPX_MOVE(parcels_));
+                parcels_.clear();
+            }
+
+            buffer_ = buffer_type{};
+            chunks_idx_ = 0;
+            state_ = initialized;
+
+            return true;
+        }
+
+        // Read the remaining part of the given object, returns whether it
+        // has been read completely.
+        bool read(void* data, std::size_t size) noexcept
+        {
+            offset_ += channel_.read(
+                static_cast<char*>(data) + offset_, size - offset_);
+            if (offset_ != size)
+            {
+                return false;
+            }
+
+            offset_ = 0;
+            return true;
+        }
+
+        void free_channel() noexcept
+        {
+            channel_header& header = channel_.header();
+
+            header.head.store(0, std::memory_order_relaxed);
+            header.tail.store(0, std::memory_order_relaxed);
+            header.acked.store(0, std::memory_order_relaxed);
+            header.zero_copy.store(
+                zero_copy_state::unknown, std::memory_order_relaxed);
+
+            header.state.store(channel_state::free, std::memory_order_release);
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+        channel channel_;
+        connection_state state_;
+
+        message_header header_;
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+        bool has_address_;
+        std::uint64_t address_;
+
+        buffer_type buffer_;
+
+        Parcelport& pp_;
+
+        std::vector<parcelset::parcel> parcels_;
+        std::vector<std::vector<char>> chunk_buffers_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
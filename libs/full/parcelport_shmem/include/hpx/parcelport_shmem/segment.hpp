@@ -0,0 +1,247 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Each locality owns one shared memory segment through which it receives
+    // the parcels sent by co-located localities. The segment is divided into
+    // channels, each of which is a single-producer/single-consumer ring
+    // buffer. A sender claims a channel for the lifetime of its connection,
+    // the owner of the segment is the only consumer.
+    enum class channel_state : std::uint32_t
+    {
+        free = 0,       // not used by any sender
+        claimed = 1,    // a sender is initializing the channel
+        ready = 2,      // the channel is used by a sender
+        closed = 3      // the sender is done, the receiver frees the channel
+                        // once it has consumed all data
+    };
+
+    // Whether the receiver is able to read the memory of the sender directly
+    // (using process_vm_readv), which is decided by the receiver once a
+    // channel has been claimed.
+    enum class zero_copy_state : std::uint32_t
+    {
+        unknown = 0,
+        available = 1,
+        unavailable = 2
+    };
+
+    struct channel_header
+    {
+        std::atomic<channel_state> state;
+        std::atomic<zero_copy_state> zero_copy;
+        std::int32_t sender_pid;
+        std::uint64_t probe_address;
+
+        // number of bytes written by the sender
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> head;
+
+        // number of bytes consumed and of messages completely received by
+        // the receiver
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> tail;
+        std::atomic<std::uint64_t> acked;
+    };
+
+    // the segment is accessed by several processes, locking is not an option
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+        std::atomic<channel_state>::is_always_lock_free &&
+        std::atomic<zero_copy_state>::is_always_lock_free);
+
+    struct segment_header
+    {
+        std::atomic<std::uint64_t> magic;    // written last by the owner
+        std::uint32_t version;
+        std::uint32_t num_channels;
+        std::uint64_t ring_size;
+        std::int32_t owner_pid;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single-producer/single-consumer byte ring located in shared memory.
+    // Its size is a power of two, head and tail are never wrapped.
+    class channel
+    {
+    public:
+        constexpr channel() noexcept = default;
+
+        channel(channel_header* header, char* data, std::uint64_t size) noexcept
+          : header_(header)
+          , data_(data)
+          , size_(size)
+        {
+            HPX_ASSERT((size_ & (size_ - 1)) == 0);
+        }
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        [[nodiscard]] channel_header& header() const noexcept
+        {
+            HPX_ASSERT(header_ != nullptr);
+            return *header_;
+        }
+
+        // Copy as many of the given bytes into the ring as currently fit,
+        // returns the number of bytes copied (producer only).
+        std::size_t write(void const* data, std::size_t size) noexcept
+        {
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_acquire);
+
+            std::size_t const n = (std::min)(
+                size, static_cast<std::size_t>(size_ - (head - tail)));
+            if (n != 0)
+            {
+                auto const pos = static_cast<std::size_t>(head & (size_ - 1));
+                std::size_t const first =
+                    (std::min)(n, static_cast<std::size_t>(size_ - pos));
+
+                std::memcpy(data_ + pos, data, first);
+                std::memcpy(
+                    data_, static_cast<char const*>(data) + first, n - first);
+
+                header_->head.store(head + n, std::memory_order_release);
+            }
+            return n;
+        }
+
+        // Copy as many of the available bytes into the given buffer as fit,
+        // returns the number of bytes copied (consumer only).
+        std::size_t read(void* data, std::size_t size) noexcept
+        {
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_acquire);
+
+            std::size_t const n =
+                (std::min)(size, static_cast<std::size_t>(head - tail));
+            if (n != 0)
+            {
+                auto const pos = static_cast<std::size_t>(tail & (size_ - 1));
+                std::size_t const first =
+                    (std::min)(n, static_cast<std::size_t>(size_ - pos));
+
+                std::memcpy(data, data_ + pos, first);
+                std::memcpy(static_cast<char*>(data) + first, data_, n - first);
+
+                header_->tail.store(tail + n, std::memory_order_release);
+            }
+            return n;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return header_->head.load(std::memory_order_acquire) ==
+                header_->tail.load(std::memory_order_relaxed);
+        }
+
+    private:
+        channel_header* header_ = nullptr;
+        char* data_ = nullptr;
+        std::uint64_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mapping of a shared memory segment, either the one owned by this
+    // locality or the one of a co-located locality.
+    class HPX_EXPORT segment
+    {
+    public:
+        segment() = default;
+
+        segment(segment const&) = delete;
+        segment(segment&& rhs) noexcept;
+        segment& operator=(segment const&) = delete;
+        segment& operator=(segment&& rhs) noexcept;
+
+        ~segment();
+
+        // Create (and own) a new segment, returns false if the segment could
+        // not be created.
+        [[nodiscard]] bool create(std::string name, std::uint32_t num_channels,
+            std::uint64_t ring_size);
+
+        // Map the segment created by another locality, returns false if the
+        // segment is not accessible.
+        [[nodiscard]] bool open(std::string name);
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        [[nodiscard]] std::uint32_t num_channels() const noexcept
+        {
+            return header_ != nullptr ? header_->num_channels : 0;
+        }
+
+        [[nodiscard]] channel get_channel(std::uint32_t idx) const noexcept;
+
+        // Claim a free channel for sending, returns num_channels() if all
+        // channels are in use.
+        std::uint32_t claim_channel(std::int32_t pid) const noexcept;
+
+        // Give a channel back, the receiver frees it once it has consumed
+        // all data written to it.
+        void release_channel(std::uint32_t idx) const noexcept;
+
+    private:
+        void unmap() noexcept;
+
+        std::string name_;
+        segment_header* header_ = nullptr;
+        std::size_t size_ = 0;
+        bool owner_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The id of the node this process runs on, derived from the host name
+    // and the boot id of the running kernel.
+    HPX_EXPORT std::uint64_t get_node_id();
+
+    // A random, non-zero id for the segment owned by this locality.
+    HPX_EXPORT std::uint64_t generate_segment_id();
+
+    // The name of the shared memory segment of the given locality.
+    HPX_EXPORT std::string get_segment_name(locality const& loc);
+
+    // Check whether the memory of the given sender can be read directly.
+    HPX_EXPORT bool probe_remote_memory(
+        std::int32_t pid, std::uint64_t probe_address) noexcept;
+
+    // Copy size bytes from the given address in the memory of process pid,
+    // returns false on failure.
+    HPX_EXPORT bool read_remote_memory(std::int32_t pid, void* data,
+        std::uint64_t address, std::size_t size) noexcept;
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
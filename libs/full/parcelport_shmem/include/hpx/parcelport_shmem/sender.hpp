@@ -0,0 +1,140 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        explicit sender(std::size_t zero_copy_threshold) noexcept
+          : zero_copy_threshold_(zero_copy_threshold)
+        {
+        }
+
+        void run() noexcept {}
+
+        // Return the mapping of the segment of the given locality, or nullptr
+        // if that segment is not accessible from this process.
+        std::shared_ptr<segment> get_segment(locality const& loc)
+        {
+            std::unique_lock l(segments_mtx_);
+
+            auto it = segments_.find(loc.segment());
+            if (it == segments_.end())
+            {
+                auto s = std::make_shared<segment>();
+                if (!s->open(get_segment_name(loc)))
+                {
+                    s.reset();
+                }
+                it = segments_.emplace(loc.segment(), HPX_MOVE(s)).first;
+            }
+            return it->second;
+        }
+
+        connection_ptr create_connection(
+            parcelset::locality const& dest, parcelset::parcelport* pp)
+        {
+            std::shared_ptr<segment> s = get_segment(dest.get<locality>());
+            HPX_ASSERT(s);
+
+            return std::make_shared<connection_type>(
+                this, HPX_MOVE(s), dest, pp, zero_copy_threshold_);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code const ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+        void clear() noexcept
+        {
+            std::unique_lock l(segments_mtx_);
+            segments_.clear();
+        }
+
+    private:
+        std::size_t zero_copy_threshold_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+
+        // the mappings of the segments of all destinations (nullptr if the
+        // segment couldn't be mapped), keyed by the segment id
+        hpx::spinlock segments_mtx_;
+        std::map<std::uint64_t, std::shared_ptr<segment>> segments_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,287 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+
+    // The header of each message written to a channel. It is followed by the
+    // transmission chunks, the non-zero-copy data, and the zero-copy chunks.
+    // Each zero-copy chunk is preceded by its address in the memory of the
+    // sender if the receiver reads it directly, or by zero if the chunk was
+    // copied into the ring.
+    struct message_header
+    {
+        std::uint64_t data_size;
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint64_t num_transmission_chunks;
+    };
+
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection, std::vector<char>>
+    {
+    private:
+        using sender_type = sender;
+
+        using data_type = std::vector<char>;
+
+        using base_type =
+            parcelset::parcelport_connection<sender_connection, data_type>;
+
+    public:
+        sender_connection(sender_type* s, std::shared_ptr<segment> seg,
+            parcelset::locality there, parcelset::parcelport* pp,
+            std::size_t zero_copy_threshold) noexcept
+          : sender_(s)
+          , segment_(HPX_MOVE(seg))
+          , channel_idx_(segment_->num_channels())
+          , header_()
+          , piece_idx_(0)
+          , offset_(0)
+          , messages_(0)
+          , by_reference_(false)
+          , zero_copy_threshold_(zero_copy_threshold)
+          , pp_(pp)
+          , there_(HPX_MOVE(there))
+        {
+        }
+
+        sender_connection(sender_connection const&) = delete;
+        sender_connection(sender_connection&&) = delete;
+        sender_connection& operator=(sender_connection const&) = delete;
+        sender_connection& operator=(sender_connection&&) = delete;
+
+        ~sender_connection()
+        {
+            if (channel_)
+            {
+                segment_->release_channel(channel_idx_);
+            }
+        }
+
+        constexpr parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender_connection>)>;
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+#endif
+            handler_ = HPX_MOVE(handler);
+            pieces_.clear();
+            piece_idx_ = 0;
+            offset_ = 0;
+
+            if (!send())
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        bool send()
+        {
+            // the channel is claimed when the first message is sent, all
+            // channels of the destination might be in use for now
+            if (!channel_ && !claim_channel())
+            {
+                return false;
+            }
+
+            if (pieces_.empty())
+            {
+                prepare_message();
+            }
+
+            while (piece_idx_ != pieces_.size())
+            {
+                auto const& [data, size] = pieces_[piece_idx_];
+                offset_ += channel_.write(data + offset_, size - offset_);
+                if (offset_ != size)
+                {
+                    return false;
+                }
+
+                offset_ = 0;
+                ++piece_idx_;
+            }
+
+            // the data referenced by the message has to be kept alive until
+            // the receiver has read it
+            if (by_reference_ &&
+                channel_.header().acked.load(std::memory_order_acquire) <
+                    messages_)
+            {
+                return false;
+            }
+
+            return done();
+        }
+
+        bool done()
+        {
+            error_code const ec(throwmode::lightweight);
+            handler_(ec);
+            handler_.reset();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            pp_->release_send_buffer(HPX_MOVE(buffer_.data_));
+            buffer_.clear();
+
+            pieces_.clear();
+            addresses_.clear();
+
+            return true;
+        }
+
+        handler_type handler_;
+        post_handler_type postprocess_handler_;
+
+    private:
+        bool claim_channel() noexcept
+        {
+            channel_idx_ = segment_->claim_channel(
+                static_cast<std::int32_t>(::getpid()));
+            if (channel_idx_ == segment_->num_channels())
+            {
+                return false;
+            }
+
+            channel_ = segment_->get_channel(channel_idx_);
+            return true;
+        }
+
+        void prepare_message()
+        {
+            auto const& tchunks = buffer_.transmission_chunks_;
+
+            header_.data_size = buffer_.data_.size();
+            header_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+            header_.num_transmission_chunks = tchunks.size();
+
+            pieces_.emplace_back(
+                reinterpret_cast<char const*>(&header_), sizeof(header_));
+            pieces_.emplace_back(reinterpret_cast<char const*>(tchunks.data()),
+                tchunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type));
+            pieces_.emplace_back(buffer_.data_.data(), buffer_.data_.size());
+
+            // large chunks are read directly from our memory by the receiver
+            // if it is able to
+            bool const zero_copy =
+                channel_.header().zero_copy.load(std::memory_order_acquire) ==
+                zero_copy_state::available;
+
+            by_reference_ = false;
+            addresses_.reserve(buffer_.chunks_.size());
+            for (auto const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type::chunk_type_pointer)
+                {
+                    continue;
+                }
+
+                auto const* data = static_cast<char const*>(c.data_.cpos_);
+                bool const by_reference =
+                    zero_copy && c.size_ >= zero_copy_threshold_;
+
+                addresses_.push_back(
+                    by_reference ? reinterpret_cast<std::uint64_t>(data) : 0);
+                pieces_.emplace_back(
+                    reinterpret_cast<char const*>(&addresses_.back()),
+                    sizeof(std::uint64_t));
+
+                if (!by_reference)
+                {
+                    pieces_.emplace_back(data, c.size_);
+                }
+                by_reference_ = by_reference_ || by_reference;
+            }
+
+            ++messages_;
+        }
+
+        sender_type* sender_;
+        std::shared_ptr<segment> segment_;
+        std::uint32_t channel_idx_;
+        channel channel_;
+
+        message_header header_;
+        std::vector<std::pair<char const*, std::size_t>> pieces_;
+        std::vector<std::uint64_t> addresses_;
+        std::size_t piece_idx_;
+        std::size_t offset_;
+
+        std::uint64_t messages_;
+        bool by_reference_;
+        std::size_t zero_copy_threshold_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,348 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <sys/prctl.h>
+#include <unistd.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    // The shared memory parcelport is used for co-located localities only,
+    // the runtime is always bootstrapped using another parcelport.
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using send_streaming_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            // the segment owned by this locality and the corresponding
+            // endpoint
+            struct inbound_segment
+            {
+                locality here;
+                segment mapping;
+            };
+
+            static std::uint32_t num_channels(
+                util::runtime_configuration const& ini)
+            {
+                return (std::max)(hpx::util::get_entry_as<std::uint32_t>(ini,
+                                      "hpx.parcel.shmem.num_channels", 64),
+                    static_cast<std::uint32_t>(1));
+            }
+
+            static std::uint64_t ring_size(
+                util::runtime_configuration const& ini)
+            {
+                auto const size = hpx::util::get_entry_as<std::uint64_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 262144);
+
+                // the ring size has to be a power of two
+                std::uint64_t result = 4096;
+                while (result < size)
+                {
+                    result *= 2;
+                }
+                return result;
+            }
+
+            static std::size_t zero_copy_threshold(
+                util::runtime_configuration const& ini)
+            {
+                if (hpx::util::get_entry_as<int>(
+                        ini, "hpx.parcel.shmem.zero_copy", 1) == 0)
+                {
+                    return (std::numeric_limits<std::size_t>::max)();
+                }
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.zero_copy_threshold", 65536);
+            }
+
+            static bool allow_ptrace(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<int>(
+                           ini, "hpx.parcel.shmem.allow_ptrace", 0) != 0;
+            }
+
+            static inbound_segment create_segment(
+                util::runtime_configuration const& ini)
+            {
+                inbound_segment result{
+                    locality(get_node_id(), generate_segment_id(),
+                        static_cast<std::int32_t>(::getpid())),
+                    segment()};
+
+                if (ini.get_entry("hpx.parcel.shmem.enable", "1") == "0")
+                {
+                    return result;
+                }
+
+                std::string const name = get_segment_name(result.here);
+                if (!result.mapping.create(
+                        name, num_channels(ini), ring_size(ini)))
+                {
+                    // no other locality will be able to connect to us
+                    LPT_(error).format(
+                        "shmem: could not create shared memory segment {}",
+                        name);
+                    result.here = locality(
+                        result.here.node(), 0, result.here.pid());
+                }
+                return result;
+            }
+
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier,
+                inbound_segment&& inbound)
+              : base_type(ini, parcelset::locality(inbound.here), notifier)
+              , stopped_(false)
+              , segment_(HPX_MOVE(inbound.mapping))
+              , sender_(zero_copy_threshold(ini))
+              , receiver_(*this)
+              , allow_ptrace_(allow_ptrace(ini))
+            {
+            }
+
+        public:
+            using sender_type = sender;
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : parcelport(ini, notifier, create_segment(ini))
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                // co-located localities may read the zero-copy chunks
+                // directly from our memory even if ptrace is restricted
+                // (e.g. by the Yama security module)
+                if (allow_ptrace_)
+                {
+                    ::prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0);
+                }
+
+                if (segment_)
+                {
+                    receiver_.run(segment_);
+                }
+                sender_.run();
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode_all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+                stopped_.store(true, std::memory_order_release);
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                std::string name(256, '\0');
+                if (::gethostname(name.data(), name.size()) != 0)
+                {
+                    return "<unknown>";
+                }
+                name.resize(name.find('\0'));
+                return name;
+            }
+
+            // Shared memory can be used only after the runtime has been
+            // bootstrapped, and only for localities on the same node whose
+            // segment is accessible from this process.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override
+            {
+                if (!use_alternative_parcelport || !segment_)
+                {
+                    return false;
+                }
+
+                locality const& l = dest.get<locality>();
+                return l && l.node() == here().get<locality>().node() &&
+                    sender_.get_segment(l) != nullptr;
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code&)
+            {
+                return sender_.create_connection(l, this);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            segment segment_;
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            bool allow_ptrace_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 200
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // co-located localities prefer shared memory over any network
+    static constexpr char const* priority() noexcept
+    {
+        return "200";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return "num_channels = ${HPX_HAVE_PARCELPORT_SHMEM_NUM_CHANNELS:64}\n"
+               "ring_size = ${HPX_HAVE_PARCELPORT_SHMEM_RING_SIZE:262144}\n"
+               "zero_copy = ${HPX_HAVE_PARCELPORT_SHMEM_ZERO_COPY:1}\n"
+               "zero_copy_threshold = "
+               "${HPX_HAVE_PARCELPORT_SHMEM_ZERO_COPY_THRESHOLD:65536}\n"
+               "allow_ptrace = ${HPX_HAVE_PARCELPORT_SHMEM_ALLOW_PTRACE:0}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
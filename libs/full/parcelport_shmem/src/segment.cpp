@@ -0,0 +1,325 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        constexpr std::uint64_t segment_magic = 0x316d68732d787068;  // hpx-shm1
+        constexpr std::uint32_t segment_version = 1;
+
+        // the value read by the receiver to decide whether it can access
+        // the memory of a sender
+        std::uint64_t const probe_value = segment_magic;
+
+        constexpr std::size_t align_to(
+            std::size_t value, std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        constexpr std::size_t channels_offset() noexcept
+        {
+            return align_to(
+                sizeof(segment_header), threads::get_cache_line_size());
+        }
+
+        constexpr std::size_t data_offset(std::uint32_t num_channels) noexcept
+        {
+            return align_to(
+                channels_offset() + num_channels * sizeof(channel_header),
+                4096);
+        }
+
+        constexpr std::size_t segment_size(
+            std::uint32_t num_channels, std::uint64_t ring_size) noexcept
+        {
+            return data_offset(num_channels) +
+                num_channels * static_cast<std::size_t>(ring_size);
+        }
+
+        // FNV-1a
+        std::uint64_t hash(std::string const& s) noexcept
+        {
+            std::uint64_t result = 0xcbf29ce484222325;
+            for (char const c : s)
+            {
+                result ^= static_cast<unsigned char>(c);
+                result *= 0x100000001b3;
+            }
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment::segment(segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , header_(std::exchange(rhs.header_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+      , owner_(std::exchange(rhs.owner_, false))
+    {
+    }
+
+    segment& segment::operator=(segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            name_ = HPX_MOVE(rhs.name_);
+            header_ = std::exchange(rhs.header_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            owner_ = std::exchange(rhs.owner_, false);
+        }
+        return *this;
+    }
+
+    segment::~segment()
+    {
+        unmap();
+    }
+
+    void segment::unmap() noexcept
+    {
+        if (header_ != nullptr)
+        {
+            ::munmap(header_, size_);
+            header_ = nullptr;
+        }
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    bool segment::create(
+        std::string name, std::uint32_t num_channels, std::uint64_t ring_size)
+    {
+        HPX_ASSERT(header_ == nullptr);
+        HPX_ASSERT(num_channels != 0 && (ring_size & (ring_size - 1)) == 0);
+
+        int const fd = ::shm_open(
+            name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        std::size_t const size = segment_size(num_channels, ring_size);
+        void* address = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+        {
+            address = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+
+        if (address == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        auto* header = new (address) segment_header{};
+        header->version = segment_version;
+        header->num_channels = num_channels;
+        header->ring_size = ring_size;
+        header->owner_pid = static_cast<std::int32_t>(::getpid());
+
+        char* channels = static_cast<char*>(address) + channels_offset();
+        for (std::uint32_t i = 0; i != num_channels; ++i)
+        {
+            new (channels + i * sizeof(channel_header)) channel_header{};
+        }
+
+        // the segment can be used by others only once the magic is visible
+        header->magic.store(segment_magic, std::memory_order_release);
+
+        name_ = HPX_MOVE(name);
+        header_ = header;
+        size_ = size;
+        owner_ = true;
+        return true;
+    }
+
+    bool segment::open(std::string name)
+    {
+        HPX_ASSERT(header_ == nullptr);
+
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat st = {};
+        void* address = MAP_FAILED;
+        if (::fstat(fd, &st) == 0 &&
+            static_cast<std::size_t>(st.st_size) >= data_offset(0))
+        {
+            address = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        auto* header = static_cast<segment_header*>(address);
+        if (header->magic.load(std::memory_order_acquire) != segment_magic ||
+            header->version != segment_version ||
+            segment_size(header->num_channels, header->ring_size) !=
+                static_cast<std::size_t>(st.st_size))
+        {
+            ::munmap(address, static_cast<std::size_t>(st.st_size));
+            return false;
+        }
+
+        name_ = HPX_MOVE(name);
+        header_ = header;
+        size_ = static_cast<std::size_t>(st.st_size);
+        owner_ = false;
+        return true;
+    }
+
+    channel segment::get_channel(std::uint32_t idx) const noexcept
+    {
+        HPX_ASSERT(header_ != nullptr && idx < header_->num_channels);
+
+        char* base = reinterpret_cast<char*>(header_);
+        auto* header = reinterpret_cast<channel_header*>(
+            base + channels_offset() + idx * sizeof(channel_header));
+        char* data = base + data_offset(header_->num_channels) +
+            idx * static_cast<std::size_t>(header_->ring_size);
+
+        return {header, data, header_->ring_size};
+    }
+
+    std::uint32_t segment::claim_channel(std::int32_t pid) const noexcept
+    {
+        std::uint32_t const num = num_channels();
+        for (std::uint32_t i = 0; i != num; ++i)
+        {
+            channel_header& header = get_channel(i).header();
+
+            channel_state expected = channel_state::free;
+            if (header.state.compare_exchange_strong(expected,
+                    channel_state::claimed, std::memory_order_acq_rel))
+            {
+                header.sender_pid = pid;
+                header.probe_address =
+                    reinterpret_cast<std::uint64_t>(&probe_value);
+                header.state.store(
+                    channel_state::ready, std::memory_order_release);
+                return i;
+            }
+        }
+        return num;
+    }
+
+    void segment::release_channel(std::uint32_t idx) const noexcept
+    {
+        get_channel(idx).header().state.store(
+            channel_state::closed, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t get_node_id()
+    {
+        std::string id(256, '\0');
+        if (::gethostname(id.data(), id.size()) != 0)
+        {
+            id.clear();
+        }
+        id.resize(id.find('\0'));
+
+        // distinguishes nodes sharing a host name (e.g. containers)
+        std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+        std::string line;
+        if (std::getline(boot_id, line))
+        {
+            id += line;
+        }
+        return hash(id);
+    }
+
+    std::uint64_t generate_segment_id()
+    {
+        std::random_device rd;
+        std::uint64_t id = 0;
+        while (id == 0)
+        {
+            id = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+        }
+        return id;
+    }
+
+    std::string get_segment_name(locality const& loc)
+    {
+        return hpx::util::format("/hpx.shmem.{}.{:016llx}", loc.pid(),
+            loc.segment());
+    }
+
+    bool probe_remote_memory(
+        std::int32_t pid, std::uint64_t probe_address) noexcept
+    {
+        std::uint64_t value = 0;
+        return read_remote_memory(
+                   pid, &value, probe_address, sizeof(value)) &&
+            value == probe_value;
+    }
+
+    bool read_remote_memory(std::int32_t pid, void* data, std::uint64_t address,
+        std::size_t size) noexcept
+    {
+        auto* local = static_cast<char*>(data);
+        while (size != 0)
+        {
+            iovec local_iov = {local, size};
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            iovec remote_iov = {reinterpret_cast<void*>(address), size};
+
+            ssize_t const n = ::process_vm_readv(
+                static_cast<pid_t>(pid), &local_iov, 1, &remote_iov, 1, 0);
+            if (n <= 0)
+            {
+                return false;
+            }
+
+            local += n;
+            address += static_cast<std::uint64_t>(n);
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
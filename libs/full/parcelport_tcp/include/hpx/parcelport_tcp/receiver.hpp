@@ -17,7 +17,10 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/assert.hpp>
 #include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
@@ -32,6 +35,7 @@
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
 #include <asio/read.hpp>
+#include <asio/steady_timer.hpp>
 #include <asio/write.hpp>
 
 // The asio support includes termios.h.
@@ -41,8 +45,12 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <system_error>
@@ -61,6 +69,7 @@ namespace hpx::parcelset::policies::tcp {
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
             connection_handler& parcelport)
           : socket_(io_service)
+          , backpressure_timer_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(false)
           , parcelport_(parcelport)
@@ -142,6 +151,9 @@ namespace hpx::parcelset::policies::tcp {
         {
             std::lock_guard lk(mtx_);
 
+            // don't hold back the acknowledgment of a received message
+            backpressure_timer_.cancel();
+
             // gracefully and portably shutdown the socket
             if (socket_.is_open())
             {
@@ -172,6 +184,14 @@ namespace hpx::parcelset::policies::tcp {
             {
                 ++operation_in_flight_;
 
+                if (buffer_.num_chunks_.first == streaming_message_chunks &&
+                    buffer_.num_chunks_.second == streaming_message_chunks)
+                {
+                    // the message is de-serialized while it is received
+                    handle_read_streaming(handler);
+                    return;
+                }
+
                 // Determine the length of the serialized data.
                 std::uint64_t const inbound_size = buffer_.size_;
 
@@ -397,17 +417,12 @@ namespace hpx::parcelset::policies::tcp {
                 buffer_.data_point_.time_ =
                     timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
 #endif
-                // now send acknowledgment byte
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_write_ack<Handler>;
-
                 if (parcels_.empty())
                 {
                     // decode and handle received data
                     HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                         !parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(
-                        decode_parcels(parcelport_, HPX_MOVE(buffer_)));
+                    decode_and_handle_parcels(parcelport_, HPX_MOVE(buffer_));
                 }
                 else
                 {
@@ -417,28 +432,361 @@ namespace hpx::parcelset::policies::tcp {
                     handle_received_parcels(HPX_MOVE(parcels_));
                 }
 
-                ack_ = true;
+                acknowledge(handler);
+            }
+        }
+
+        // Delay the acknowledgment of the received message while this
+        // locality is overloaded (see parcelport::receive_backpressure). The
+        // sender does not send any further messages over this connection
+        // before it has been acknowledged, it coalesces or buffers the
+        // parcels instead.
+        template <typename Handler>
+        void acknowledge(Handler handler)
+        {
+            if (!parcelport_.receive_backpressure())
+            {
+                write_ack(handler);
+                return;
+            }
+
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_backpressure_delay<Handler>;
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            backpressure_timer_.expires_after(std::chrono::microseconds(
+                parcelport_.get_backpressure_delay()));
+            backpressure_timer_.async_wait(hpx::bind(f, shared_from_this(),
+                placeholders::_1,    // error
+                util::protect(handler)));
+        }
+
+        template <typename Handler>
+        void handle_backpressure_delay(
+            std::error_code const& e, Handler handler)
+        {
+            if (e)
+            {
+                // the timer was canceled during shutdown
+                handler(e);
+                --operation_in_flight_;
+                buffer_ = parcel_buffer_type();
+                parcels_.clear();
+                chunk_buffers_.clear();
+                return;
+            }
+
+            acknowledge(handler);
+        }
+
+        // now send acknowledgment byte
+        template <typename Handler>
+        void write_ack(Handler handler)
+        {
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_write_ack<Handler>;
+
+            ack_ = true;
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            asio::async_write(socket_, asio::buffer(&ack_, sizeof(ack_)),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error,
+                    util::protect(handler)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The pieces of a streamed message are received into a bounded queue
+        // while an HPX thread de-serializes the parcels from it.
+        class stream_reader final : public serialization::input_stream
+        {
+        public:
+            // the maximal number of received pieces waiting to be consumed
+            static constexpr std::size_t max_pending_chunks = 4;
+
+            explicit stream_reader(receiver& r) noexcept
+              : receiver_(r)
+              , chunk_size_(0)
+              , pos_(0)
+              , reading_(true)
+              , done_(false)
+            {
+            }
+
+            void read(void* data, std::size_t size) override
+            {
+                auto* dst = static_cast<char*>(data);
+                while (size != 0)
                 {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
+                    if (pos_ == current_.size())
                     {
-                        lk.unlock();
+                        next_chunk();
+                    }
 
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
+                    std::size_t const n =
+                        (std::min)(size, current_.size() - pos_);
+                    std::memcpy(dst, &current_[pos_], n);
+
+                    pos_ += n;
+                    dst += n;
+                    size -= n;
+                }
+            }
+
+            // Wait for the end of the message, returns the first error
+            // which occurred while receiving it.
+            std::error_code finish()
+            {
+                {
+                    std::lock_guard l(mtx_);
+                    if (!ec_ && (pos_ != current_.size() || !chunks_.empty()))
+                    {
+                        // not all of the data was consumed, don't wait for
+                        // the remaining pieces
+                        ec_ = asio::error::make_error_code(
+                            asio::error::invalid_argument);
+                        return ec_;
                     }
+                }
 
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
+                hpx::util::yield_while(
+                    [this]() {
+                        std::lock_guard l(mtx_);
+                        return !done_ && !ec_;
+                    },
+                    "tcp::receiver::stream_reader::finish");
+
+                std::lock_guard l(mtx_);
+                return ec_;
+            }
+
+            // the functions below are invoked by the networking layer
+            std::uint64_t& chunk_size() noexcept
+            {
+                return chunk_size_;
+            }
+
+            std::vector<char>& receive_buffer()
+            {
+                std::lock_guard l(mtx_);
+                if (free_.empty())
+                {
+                    receiving_.clear();
                 }
+                else
+                {
+                    receiving_ = HPX_MOVE(free_.back());
+                    free_.pop_back();
+                }
+                receiving_.resize(static_cast<std::size_t>(chunk_size_));
+                return receiving_;
+            }
+
+            // returns whether the next piece should be received right away
+            bool received_chunk()
+            {
+                std::lock_guard l(mtx_);
+                chunks_.emplace_back(HPX_MOVE(receiving_));
+                if (chunks_.size() >= max_pending_chunks)
+                {
+                    reading_ = false;
+                }
+                return reading_;
+            }
+
+            void set_done()
+            {
+                std::lock_guard l(mtx_);
+                reading_ = false;
+                done_ = true;
+            }
+
+            void set_error(std::error_code const& e)
+            {
+                std::lock_guard l(mtx_);
+                reading_ = false;
+                if (!ec_)
+                    ec_ = e;
+            }
+
+        private:
+            void next_chunk()
+            {
+                hpx::util::yield_while(
+                    [this]() {
+                        std::lock_guard l(mtx_);
+                        return chunks_.empty() && !done_ && !ec_;
+                    },
+                    "tcp::receiver::stream_reader::read");
+
+                std::unique_lock l(mtx_);
+                if (chunks_.empty())
+                {
+                    l.unlock();
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "tcp::receiver::stream_reader::read",
+                        "archive data bstream is too short");
+                }
+
+                // recycle the consumed buffer
+                free_.emplace_back(HPX_MOVE(current_));
+                current_ = HPX_MOVE(chunks_.front());
+                chunks_.pop_front();
+                pos_ = 0;
+
+                // resume receiving if it was suspended as the queue was full
+                if (!reading_ && !done_ && !ec_)
+                {
+                    reading_ = true;
+                    l.unlock();
+                    receiver_.read_stream_chunk_header();
+                }
+            }
+
+            receiver& receiver_;
+            hpx::spinlock mtx_;
+
+            std::uint64_t chunk_size_;    // size of the piece being received
+            std::vector<char> receiving_;
+            std::deque<std::vector<char>> chunks_;
+            std::vector<std::vector<char>> free_;
+
+            std::vector<char> current_;    // piece being consumed
+            std::size_t pos_;
+
+            bool reading_;
+            bool done_;
+            std::error_code ec_;
+        };
+
+        template <typename Handler>
+        void handle_read_streaming(Handler handler)
+        {
+            stream_ = std::make_unique<stream_reader>(*this);
+            read_stream_chunk_header();
+
+            // de-serialize the parcels on a new HPX thread while the data
+            // is being received
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary(util::deferred_call(
+                    &receiver::decode_stream<Handler>, shared_from_this(),
+                    HPX_MOVE(handler))),
+                "tcp::receiver::decode_stream");
+            threads::register_thread(data);
+        }
+
+        void read_stream_chunk_header()
+        {
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+                stream_->set_error(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            void (receiver::*f)(std::error_code const&) =
+                &receiver::handle_read_stream_chunk_header;
+
+            asio::async_read(socket_,
+                asio::buffer(&stream_->chunk_size(), sizeof(std::uint64_t)),
+                hpx::bind(f, shared_from_this(), placeholders::_1));
+        }
+
+        void handle_read_stream_chunk_header(std::error_code const& e)
+        {
+            if (e)
+            {
+                stream_->set_error(e);
+                return;
+            }
+
+            std::uint64_t const chunk_size = stream_->chunk_size();
+            if (chunk_size == 0)
+            {
+                // end of message
+                stream_->set_done();
+                return;
+            }
+            if (chunk_size > max_inbound_size_)
+            {
+                stream_->set_error(asio::error::make_error_code(
+                    asio::error::operation_not_supported));
+                return;
+            }
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+                stream_->set_error(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            void (receiver::*f)(std::error_code const&) =
+                &receiver::handle_read_stream_chunk;
+
+            asio::async_read(socket_, asio::buffer(stream_->receive_buffer()),
+                hpx::bind(f, shared_from_this(), placeholders::_1));
+        }
+
+        void handle_read_stream_chunk(std::error_code const& e)
+        {
+            if (e)
+            {
+                stream_->set_error(e);
+            }
+            else if (stream_->received_chunk())
+            {
+                read_stream_chunk_header();
             }
         }
 
+        template <typename Handler>
+        void decode_stream(Handler handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            // the time needed for receiving the data overlaps with the
+            // de-serialization, only the latter is measured
+            buffer_.data_point_.time_ = 0;
+#endif
+            std::vector<parcelset::parcel> parcels =
+                decode_parcels_streaming(parcelport_, *stream_, buffer_);
+
+            if (std::error_code const e = stream_->finish())
+            {
+                handler(e);
+                --operation_in_flight_;
+                buffer_ = parcel_buffer_type();
+                return;
+            }
+
+            handle_received_parcels(HPX_MOVE(parcels));
+            acknowledge(handler);
+        }
+
         template <typename Handler>
         void handle_write_ack(std::error_code const& e, Handler handler)
         {
@@ -462,6 +810,9 @@ namespace hpx::parcelset::policies::tcp {
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
+        // delays the acknowledgment of received messages while overloaded
+        asio::steady_timer backpressure_timer_;
+
         std::uint64_t max_inbound_size_;
 
         bool ack_;
@@ -478,6 +829,9 @@ namespace hpx::parcelset::policies::tcp {
 
         std::vector<parcelset::parcel> parcels_;
         std::vector<std::vector<char>> chunk_buffers_;
+
+        // state of the streamed message being received (if any)
+        std::unique_ptr<stream_reader> stream_;
     };
 }    // namespace hpx::parcelset::policies::tcp
 
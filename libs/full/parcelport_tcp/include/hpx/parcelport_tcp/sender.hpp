@@ -14,9 +14,11 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/assert.hpp>
 #include <hpx/modules/asio.hpp>
+#include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/serialization.hpp>
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/parcelport_tcp/locality.hpp>
@@ -42,7 +44,10 @@
 #undef VT1
 #undef VT2
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -50,6 +55,12 @@
 
 namespace hpx::parcelset::policies::tcp {
 
+    // Messages which are sent while they are being serialized are announced
+    // by using this value for both chunk counts in the message header. The
+    // header is followed by the serialized data in pieces of bounded size,
+    // each prefixed with its size, and a terminating empty piece.
+    inline constexpr std::uint32_t streaming_message_chunks = ~0u;
+
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char>>
     {
@@ -189,7 +200,164 @@ namespace hpx::parcelset::policies::tcp {
                     hpx::placeholders::_2));
         }
 
+        // Serialize the parcels while sending them. The given function is
+        // invoked with an output stream as its argument and is expected to
+        // serialize the parcels into it, returning the number of bytes
+        // written (zero on failure). At most two pieces of the serialized
+        // data are held in memory at any point in time. This function
+        // returns only after all of the data has been handed to the network.
+        template <typename Encode, typename Handler,
+            typename ParcelPostprocess>
+        void write_streaming(Encode&& encode, Handler&& handler,
+            ParcelPostprocess&& parcel_postprocess)
+        {
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            HPX_ASSERT(state_ == state_send_pending);
+#endif
+            HPX_ASSERT(buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_async_write;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // the size of the message is not known in advance
+            buffer_.size_ = 0;
+            buffer_.data_size_ = 0;
+            buffer_.num_chunks_ = parcel_buffer_type::count_chunks_type(
+                streaming_message_chunks, streaming_message_chunks);
+
+            std::size_t written = 0;
+            std::error_code ec;
+            {
+                stream_writer stream(socket_);
+                stream.write_header(buffer_);
+
+                written = HPX_FORWARD(Encode, encode)(stream, buffer_);
+                ec = stream.finish(written != 0);
+            }
+
+            handle_write(ec, written);
+        }
+
     private:
+        // Send the pieces of a streamed message. Only one write operation is
+        // in flight at any point in time, each call to write() waits for the
+        // previous one to complete.
+        class stream_writer final : public serialization::output_stream
+        {
+        public:
+            explicit stream_writer(asio::ip::tcp::socket& socket) noexcept
+              : socket_(socket)
+              , size_(0)
+              , pending_(false)
+            {
+            }
+
+            stream_writer(stream_writer const&) = delete;
+            stream_writer(stream_writer&&) = delete;
+            stream_writer& operator=(stream_writer const&) = delete;
+            stream_writer& operator=(stream_writer&&) = delete;
+
+            ~stream_writer() override
+            {
+                wait();
+            }
+
+            void write_header(parcel_buffer_type& buffer)
+            {
+                std::array<asio::const_buffer, 3> const buffers = {
+                    asio::buffer(&buffer.size_, sizeof(buffer.size_)),
+                    asio::buffer(&buffer.data_size_, sizeof(buffer.data_size_)),
+                    asio::buffer(
+                        &buffer.num_chunks_, sizeof(buffer.num_chunks_))};
+                async_write(buffers);
+            }
+
+            void write(void const* data, std::size_t size) override
+            {
+                // the size of the previous piece is in use until its write
+                // operation has completed
+                wait();
+
+                size_ = size;
+                std::array<asio::const_buffer, 2> const buffers = {
+                    asio::buffer(&size_, sizeof(size_)),
+                    asio::buffer(data, size)};
+                async_write(buffers);
+            }
+
+            void flush() override
+            {
+                wait();
+            }
+
+            std::error_code finish(bool succeeded)
+            {
+                wait();
+                if (!succeeded)
+                {
+                    // the receiving end detects the aborted message once
+                    // the connection is closed
+                    if (!ec_)
+                    {
+                        ec_ = asio::error::make_error_code(
+                            asio::error::operation_aborted);
+                    }
+                    return ec_;
+                }
+
+                // terminate the message with an empty piece
+                size_ = 0;
+                async_write(asio::buffer(&size_, sizeof(size_)));
+                wait();
+                return ec_;
+            }
+
+        private:
+            template <typename Buffers>
+            void async_write(Buffers const& buffers)
+            {
+                wait();
+
+                // drop all data once an error occurred, the serialization of
+                // the parcels is completed regardless
+                if (ec_)
+                    return;
+
+                pending_.store(true, std::memory_order_relaxed);
+                asio::async_write(socket_, buffers,
+                    [this](std::error_code const& e, std::size_t) {
+                        if (e)
+                            ec_ = e;
+                        pending_.store(false, std::memory_order_release);
+                    });
+            }
+
+            void wait() const
+            {
+                hpx::util::yield_while(
+                    [this]() {
+                        return pending_.load(std::memory_order_acquire);
+                    },
+                    "tcp::sender::stream_writer::wait");
+            }
+
+            asio::ip::tcp::socket& socket_;
+            std::uint64_t size_;
+            std::atomic<bool> pending_;
+            std::error_code ec_;
+        };
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
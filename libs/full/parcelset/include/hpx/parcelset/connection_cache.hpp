@@ -56,7 +56,8 @@ namespace hpx::util {
             value_type,     // cached (available) connections
             std::size_t,    // number of existing connections
             std::size_t,    // max number of cached connections
-            typename key_tracker_type::iterator>;    // reference into LRU list
+            typename key_tracker_type::iterator,    // reference into LRU list
+            std::size_t>;    // number of connections used for bulk transfers
 
         using cache_type = std::map<key_type, cache_value_type>;
         using size_type = typename cache_type::size_type;
@@ -131,6 +132,16 @@ namespace hpx::util {
             return hpx::get<3>(entry);
         }
 
+        static std::size_t& num_bulk_connections(cache_value_type& entry)
+        {
+            return hpx::get<4>(entry);
+        }
+        static std::size_t const& num_bulk_connections(
+            cache_value_type const& entry)
+        {
+            return hpx::get<4>(entry);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Increase the per-locality and overall connection counts.
         void increment_connection_count(cache_value_type& e)
@@ -323,7 +334,7 @@ namespace hpx::util {
 
             cache_.emplace(l,
                 hpx::make_tuple(
-                    value_type(), 1, max_connections_per_locality_, kt));
+                    value_type(), 1, max_connections_per_locality_, kt, 0));
 
             // Make sure the input connection shared_ptr doesn't hold anything.
             conn.reset();
@@ -387,6 +398,45 @@ namespace hpx::util {
             }
         }
 
+        /// Try to mark one of the connections to \a l which are checked out of
+        /// the cache as being used for a bulk transfer. All but one of the
+        /// connections to a locality may be used for bulk transfers at the
+        /// same time, which leaves room for small messages that would
+        /// otherwise have to wait for those to complete.
+        ///
+        /// \returns true if the connection may be used for a bulk transfer,
+        ///          in this case \a release_bulk() must be called once the
+        ///          transfer has completed.
+        bool reserve_bulk(key_type const& l)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            typename cache_type::iterator const it = cache_.find(l);
+            if (it == cache_.end() ||
+                num_bulk_connections(it->second) + 1 >=
+                    max_num_connections(it->second))
+            {
+                return false;
+            }
+
+            ++num_bulk_connections(it->second);
+            return true;
+        }
+
+        /// Signal that a bulk transfer to \a l reserved using \a
+        /// reserve_bulk() has completed.
+        void release_bulk(key_type const& l)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            // the entry may have been removed in the meantime
+            typename cache_type::iterator const it = cache_.find(l);
+            if (it != cache_.end() && num_bulk_connections(it->second) != 0)
+            {
+                --num_bulk_connections(it->second);
+            }
+        }
+
         /// Returns true if the overall connection count is equal to or larger
         /// than the maximum number of overall connections, and false otherwise.
         bool full() const
@@ -19,6 +19,7 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -27,10 +28,13 @@
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -219,6 +223,15 @@ namespace hpx::parcelset {
             return;
         }
 
+        // schedule the high priority parcels first
+        if (deferred_parcels.size() > 1)
+        {
+            std::stable_partition(deferred_parcels.begin(),
+                deferred_parcels.end(), [](parcelset::parcel const& p) {
+                    return p.has_high_priority();
+                });
+        }
+
         for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
         {
             LPT_(debug).format("handle_received_parcels: received: {}",
@@ -232,7 +245,11 @@ namespace hpx::parcelset {
                     agas::route(HPX_MOVE(p),
                         &parcelset::detail::parcel_route_handler,
                         threads::thread_priority::normal);
+                    return;
                 }
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                detail::parcel_tracer::instance().scheduled(p);
+#endif
             };
 
             // schedule all but the first parcel on a new thread.
@@ -258,13 +275,17 @@ namespace hpx::parcelset {
             agas::route(HPX_MOVE(deferred_parcels[0]),
                 &parcelset::detail::parcel_route_handler,
                 threads::thread_priority::normal);
+            return;
         }
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        detail::parcel_tracer::instance().scheduled(deferred_parcels[0]);
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks(
-        serialization::input_archive& archive, [[maybe_unused]] Parcelport& pp,
+        serialization::input_archive& archive, Parcelport& pp,
         [[maybe_unused]] Buffer& buffer, std::size_t parcel_count,
         std::size_t num_thread = -1)
     {
@@ -272,6 +293,10 @@ namespace hpx::parcelset {
             archive.try_get_extra_data<
                 serialization::detail::allow_zero_copy_receive>() != nullptr;
 
+        // direct actions may be executed right away even if they are part of
+        // a message containing several parcels
+        bool const inline_direct_actions = pp.inline_direct_actions();
+
         // protect from unhandled exceptions bubbling up
         try
         {
@@ -285,6 +310,12 @@ namespace hpx::parcelset {
 #endif
                 std::vector<parcelset::parcel> deferred_parcels;
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                auto& tracer = detail::parcel_tracer::instance();
+                std::uint64_t const receive_time = tracer.enabled() ?
+                    chrono::high_resolution_clock::now() :
+                    0;
+#endif
                 // De-serialize the parcel data
                 if (parcel_count == 0)
                 {
@@ -297,7 +328,8 @@ namespace hpx::parcelset {
 
                 for (std::size_t i = 0; i != parcel_count; ++i)
                 {
-                    bool deferred_schedule = parcel_count > 1;
+                    bool deferred_schedule =
+                        parcel_count > 1 && !inline_direct_actions;
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -315,6 +347,23 @@ namespace hpx::parcelset {
                     bool const migrated =
                         p.load_schedule(archive, num_thread, deferred_schedule);
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                    if (tracer.enabled())
+                    {
+                        p.set_trace_stamp(
+                            parcel_trace_stage::receive, receive_time);
+                        detail::parcel_tracer::stamp(
+                            p, parcel_trace_stage::decode);
+
+                        // the action thread of all parcels which are not
+                        // deferred has been created already
+                        if (!migrated && !deferred_schedule &&
+                            !allow_zero_copy_receive)
+                        {
+                            tracer.scheduled(p);
+                        }
+                    }
+#endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                     std::int64_t const add_parcel_time =
                         timer.elapsed_nanoseconds();
@@ -423,11 +472,30 @@ namespace hpx::parcelset {
     {
         auto const inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
-        serialization::input_archive archive(
-            buffer.data_, inbound_data_size, &chunks);
 
-        return decode_message_with_chunks(
-            archive, pp, buffer, parcel_count, num_thread);
+        using data_type = std::decay_t<decltype(buffer.data_)>;
+        if constexpr (std::is_same_v<data_type, std::vector<char>>)
+        {
+            // the de-serialized action arguments may reference the received
+            // data in place (see serialization::buffer_view), they keep it
+            // alive as long as they need it
+            auto data = std::make_shared<data_type>(HPX_MOVE(buffer.data_));
+            serialization::input_archive archive(
+                *data, inbound_data_size, &chunks);
+            archive.get_extra_data<serialization::detail::input_buffer_owner>()
+                .owner = HPX_MOVE(data);
+
+            return decode_message_with_chunks(
+                archive, pp, buffer, parcel_count, num_thread);
+        }
+        else
+        {
+            serialization::input_archive archive(
+                buffer.data_, inbound_data_size, &chunks);
+
+            return decode_message_with_chunks(
+                archive, pp, buffer, parcel_count, num_thread);
+        }
     }
 
     template <typename Parcelport, typename Buffer>
@@ -454,10 +522,60 @@ namespace hpx::parcelset {
         return decode_message(parcelport, HPX_MOVE(buffer), 0, num_thread);
     }
 
+    // Decode the parcels of a received message and schedule their actions.
+    // Large messages which do not reference any memory owned by the
+    // connection are decoded on a new thread, which allows to decode several
+    // messages in parallel while the receiving thread goes on with making
+    // progress on the network.
+    template <typename Parcelport, typename Buffer>
+    void decode_and_handle_parcels(
+        Parcelport& parcelport, Buffer buffer, std::size_t num_thread = -1)
+    {
+        std::size_t const threshold =
+            parcelport.get_parallel_decode_threshold();
+        if (threshold != 0 && buffer.num_chunks_.first == 0 &&
+            buffer.data_.size() >= threshold &&
+            threads::threadmanager_is(hpx::state::running))
+        {
+            auto f = [&parcelport, num_thread](Buffer&& buffer) {
+                handle_received_parcels(
+                    decode_parcels(parcelport, HPX_MOVE(buffer), num_thread),
+                    num_thread);
+            };
+
+            // let the scheduler place the new thread on any core
+            hpx::threads::thread_init_data init_data(
+                hpx::threads::make_thread_function_nullary(
+                    util::deferred_call(HPX_MOVE(f), HPX_MOVE(buffer))),
+                "decode_parcels", threads::thread_priority::boost,
+                threads::thread_schedule_hint(),
+                threads::thread_stacksize::default_,
+                threads::thread_schedule_state::pending, true);
+            hpx::threads::register_thread(init_data);
+            return;
+        }
+
+        handle_received_parcels(
+            decode_parcels(parcelport, HPX_MOVE(buffer), num_thread),
+            num_thread);
+    }
+
+    // De-serialize the parcels of a message while it is being received, the
+    // buffer is used for collecting the performance data only.
+    template <typename Parcelport, typename Buffer>
+    std::vector<parcelset::parcel> decode_parcels_streaming(
+        Parcelport& parcelport, serialization::input_stream& stream,
+        Buffer& buffer, std::size_t num_thread = -1)
+    {
+        serialization::input_archive archive(stream);
+        return decode_message_with_chunks(
+            archive, parcelport, buffer, 0, num_thread);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks_zero_copy(
-        [[maybe_unused]] Parcelport& pp, Buffer& buffer,
+        Parcelport& pp, Buffer& buffer,
         std::size_t parcel_count,
         std::vector<serialization::serialization_chunk>& chunks,
         std::size_t num_thread = -1)
@@ -471,6 +589,14 @@ namespace hpx::parcelset {
         archive
             .get_extra_data<serialization::detail::allow_zero_copy_receive>();
 
+        // the zero-copy chunks are received directly into their final
+        // buffers, which may be located in device memory
+        if (pp.allow_device_memory())
+        {
+            archive
+                .get_extra_data<serialization::detail::allow_device_memory>();
+        }
+
         return decode_message_with_chunks(
             archive, pp, buffer, parcel_count, num_thread);
     }
@@ -0,0 +1,158 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset_base/detail/parcel_trace_stage.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    /// The time spans between the stages of the lifecycle of a parcel for
+    /// which latency histograms are collected. The spans are measured using
+    /// the clock of a single locality only.
+    enum class parcel_trace_interval : std::uint8_t
+    {
+        queue = 0,            // enqueue -> serialize_begin
+        serialization = 1,    // serialize_begin -> serialize_end
+        post = 2,             // serialize_end -> send_posted
+        send = 3,             // send_posted -> send_complete
+        decode = 4,           // receive -> decode
+        schedule = 5          // decode -> schedule
+    };
+
+    inline constexpr std::size_t num_parcel_trace_intervals = 6;
+
+    // The latency histograms use buckets of exponentially growing size:
+    // bucket zero counts values of zero, bucket i counts values v with
+    // 2^(i-1) <= v < 2^i [ns]. The last bucket counts all values that do not
+    // fit any of the other buckets.
+    inline constexpr std::size_t parcel_trace_histogram_num_buckets = 40;
+}    // namespace hpx::parcelset
+
+namespace hpx::parcelset::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collects the time stamps of the lifecycle of all parcels sent and
+    // received by this locality if enabled by hpx.parcel.tracing. The time
+    // stamps of a parcel are kept in the parcel itself until it was either
+    // sent or its action was scheduled. At this point the parcel is added to
+    // the per-action latency histograms and, if hpx.parcel.tracing_file is
+    // set, to the list of trace events which is written when the
+    // parcelhandler is stopped. The trace events of the sending and the
+    // receiving locality of a parcel can be correlated using the parcel id.
+    class HPX_EXPORT parcel_tracer
+    {
+    public:
+        using histogram_type =
+            std::array<std::int64_t, parcel_trace_histogram_num_buckets>;
+
+        parcel_tracer() = default;
+
+        parcel_tracer(parcel_tracer const&) = delete;
+        parcel_tracer(parcel_tracer&&) = delete;
+        parcel_tracer& operator=(parcel_tracer const&) = delete;
+        parcel_tracer& operator=(parcel_tracer&&) = delete;
+
+        static parcel_tracer& instance();
+
+        void init(util::runtime_configuration const& cfg);
+
+        [[nodiscard]] bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        // record the current time for the given stage of the parcel
+        static void stamp(parcel const& p, parcel_trace_stage stage)
+        {
+            if (instance().enabled())
+            {
+                p.set_trace_stamp(stage, chrono::high_resolution_clock::now());
+            }
+        }
+
+        static void stamp(
+            parcel const* ps, std::size_t num_parcels, parcel_trace_stage stage)
+        {
+            if (instance().enabled())
+            {
+                std::uint64_t const now = chrono::high_resolution_clock::now();
+                for (std::size_t i = 0; i != num_parcels; ++i)
+                {
+                    ps[i].set_trace_stamp(stage, now);
+                }
+            }
+        }
+
+        // the write handler of the given parcel was called
+        void sent(parcel const& p);
+
+        // the thread running the action of the given parcel was created
+        void scheduled(parcel const& p);
+
+        // Return the histogram of the given interval in the layout used by
+        // histogram performance counters (lower boundary, upper boundary,
+        // number of buckets, bucket values). An empty action name refers to
+        // all actions.
+        std::vector<std::int64_t> get_histogram(parcel_trace_interval which,
+            std::string const& action, bool reset);
+
+        // write all collected trace events to the configured file
+        void write_trace_events(std::uint32_t locality_id);
+
+    private:
+        using histograms_type =
+            std::array<histogram_type, num_parcel_trace_intervals>;
+
+        struct trace_event
+        {
+            naming::gid_type parcel_id_;
+            char const* action_;
+            std::uint32_t peer_;
+            bool sent_;
+            parcel_trace_stamps stamps_;
+        };
+
+        void record(parcel const& p, bool sent);
+
+        using mutex_type = hpx::spinlock;
+
+        std::atomic<bool> enabled_ = false;
+        std::string file_;
+        std::size_t max_events_ = 0;
+
+        mutex_type mtx_;
+        histograms_type total_{};
+        std::map<std::string, std::unique_ptr<histograms_type>, std::less<>>
+            per_action_;
+        std::vector<trace_event> events_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
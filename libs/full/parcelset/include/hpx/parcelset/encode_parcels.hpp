@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -37,6 +38,7 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -86,6 +88,7 @@ namespace hpx::parcelset {
         {
             buffer.size_ = buffer.data_.size();
             buffer.data_size_ = arg_size;
+            buffer.account_memory();
 
 #if defined(HPX_HAVE_LOGGING)
             LPT_(debug) << binary_archive_content(buffer);
@@ -192,7 +195,18 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
-                buffer.data_.reserve(arg_size);
+                // the parcel sizes were determined by the preprocessing
+                // pass, reuse the buffer of a completed send if possible
+                if constexpr (std::is_same_v<std::decay_t<decltype(
+                                                 buffer.data_)>,
+                                  std::vector<char>>)
+                {
+                    pp.get_send_buffer(buffer.data_, arg_size);
+                }
+                else
+                {
+                    buffer.data_.reserve(arg_size);
+                }
                 buffer.chunks_.reserve(num_chunks);
 
                 // mark start of serialization
@@ -210,6 +224,18 @@ namespace hpx::parcelset {
                         archive_flags, &buffer.chunks_, filter.get(),
                         pp.get_zero_copy_serialization_threshold());
 
+                    // zero-copy chunks are never touched by the parcelport,
+                    // thus they may refer to device memory if the transport
+                    // supports it
+                    if (pp.allow_device_memory() && filter.get() == nullptr)
+                    {
+                        archive
+                            .get_extra_data<
+                                serialization::detail::allow_device_memory>()
+                            .zero_copy_serialization_threshold =
+                            pp.get_zero_copy_serialization_threshold();
+                    }
+
                     if (num_parcels != static_cast<std::size_t>(-1))
                         archive << parcels_sent;    //-V128
 
@@ -231,8 +257,16 @@ namespace hpx::parcelset {
                             split_gids.set_split_gids(HPX_MOVE(split_gids_map));
                         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        detail::parcel_tracer::stamp(
+                            ps[i], parcel_trace_stage::serialize_begin);
+#endif
                         archive << ps[i];
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        detail::parcel_tracer::stamp(
+                            ps[i], parcel_trace_stage::serialize_end);
+#endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         parcelset::data_point action_data;
@@ -299,6 +333,130 @@ namespace hpx::parcelset {
 
         return parcels_sent;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decide whether the given parcels should be sent while they are being
+    // serialized. Parcels which use a serialization filter are always
+    // serialized completely, as the filter needs to see all of the data.
+    inline bool stream_parcels(
+        parcelport const& pp, parcel const* ps, std::size_t num_parcels)
+    {
+        std::size_t const threshold = pp.get_streaming_threshold();
+        if (threshold == 0 || num_parcels == 0)
+        {
+            return false;
+        }
+
+        std::unique_ptr<serialization::binary_filter> const filter(
+            ps[0].get_serialization_filter());
+        if (filter)
+        {
+            return false;
+        }
+
+        // the parcel sizes were determined by the preprocessing pass
+        std::size_t size = 0;
+        for (std::size_t i = 0; i != num_parcels; ++i)
+        {
+            size += ps[i].size();
+        }
+        return size >= threshold;
+    }
+
+    // Serialize the given parcels into an output stream which passes the data
+    // on in pieces of bounded size while the serialization is in progress.
+    // Returns the number of bytes written or zero if the serialization failed.
+    template <typename Buffer>
+    std::size_t encode_parcels_streaming(parcelport& pp, parcel const* ps,
+        std::size_t num_parcels, serialization::output_stream& stream,
+        Buffer& buffer, int archive_flags)
+    {
+        std::size_t arg_size = 0;
+
+        // guard against serialization errors
+        try
+        {
+            try
+            {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                hpx::chrono::high_resolution_timer const timer;
+#endif
+                serialization::output_archive archive(stream,
+                    pp.get_streaming_chunk_size(), archive_flags,
+                    pp.get_zero_copy_serialization_threshold());
+
+                archive << num_parcels;    //-V128
+                for (std::size_t i = 0; i != num_parcels; ++i)
+                {
+                    LPT_(debug) << ps[i];
+
+                    auto split_gids_map = ps[i].move_split_gids();
+                    if (!split_gids_map.empty())
+                    {
+                        auto& split_gids = archive.get_extra_data<
+                            serialization::detail::preprocess_gid_types>();
+                        split_gids.set_split_gids(HPX_MOVE(split_gids_map));
+                    }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                    detail::parcel_tracer::stamp(
+                        ps[i], parcel_trace_stage::serialize_begin);
+#endif
+                    archive << ps[i];
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                    detail::parcel_tracer::stamp(
+                        ps[i], parcel_trace_stage::serialize_end);
+#endif
+                }
+                archive.flush();
+                arg_size = archive.bytes_written();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                // the serialization time includes waiting for the network
+                parcelset::data_point& data = buffer.data_point_;
+                data.serialization_time_ = timer.elapsed_nanoseconds();
+                data.bytes_ = arg_size;
+                data.raw_bytes_ = arg_size;
+                data.num_parcels_ = num_parcels;
+#else
+                HPX_UNUSED(buffer);
+#endif
+            }
+            catch (hpx::exception const& e)
+            {
+                LPT_(fatal).format(
+                    "encode_parcels_streaming: caught hpx::exception: {}",
+                    e.what());
+                hpx::report_error(std::current_exception());
+                return 0;
+            }
+            catch (std::system_error const& e)
+            {
+                LPT_(fatal).format(
+                    "encode_parcels_streaming: caught std::system_error: {}",
+                    e.what());
+                hpx::report_error(std::current_exception());
+                return 0;
+            }
+            catch (std::exception const& e)
+            {
+                // We have to repackage all exceptions thrown by the
+                // serialization library as otherwise we will loose the e.what()
+                // description of the problem, due to slicing.
+                hpx::throw_with_info(
+                    hpx::exception(hpx::error::serialization_error, e.what()));
+            }
+        }
+        catch (...)
+        {
+            LPT_(fatal).format(
+                "encode_parcels_streaming: caught unknown exception");
+            hpx::report_error(std::current_exception());
+            return 0;
+        }
+
+        return arg_size;
+    }
 }    // namespace hpx::parcelset
 
 #endif
@@ -51,6 +51,9 @@ namespace hpx::parcelset::detail {
         naming::gid_type parcel_id_;
         double start_time_;
         double creation_time_;
+
+        // recorded by the parcel tracer, not serialized
+        parcelset::parcel_trace_stamps trace_stamps_;
 #endif
 
         bool has_continuation_;
@@ -137,6 +140,10 @@ namespace hpx::parcelset::detail {
         // generate unique parcel id
         naming::gid_type const& parcel_id() const override;
         naming::gid_type& parcel_id() override;
+
+        std::uint64_t trace_stamp(parcel_trace_stage stage) const override;
+        void set_trace_stamp(
+            parcel_trace_stage stage, std::uint64_t time) override;
 #endif
 
     private:
@@ -10,10 +10,12 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/allocator_support/memory_statistics.hpp>
 #include <hpx/modules/serialization.hpp>
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -58,11 +60,69 @@ namespace hpx::parcelset {
         {
         }
 
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+        parcel_buffer(parcel_buffer&& other) noexcept
+          : data_(HPX_MOVE(other.data_))
+          , chunks_(HPX_MOVE(other.chunks_))
+          , transmission_chunks_(HPX_MOVE(other.transmission_chunks_))
+          , num_chunks_(other.num_chunks_)
+          , size_(other.size_)
+          , data_size_(other.data_size_)
+          , header_size_(other.header_size_)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , data_point_(HPX_MOVE(other.data_point_))
+#endif
+          , accounted_(std::exchange(other.accounted_, 0))
+        {
+        }
+
+        parcel_buffer& operator=(parcel_buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release_memory();
+
+                data_ = HPX_MOVE(other.data_);
+                chunks_ = HPX_MOVE(other.chunks_);
+                transmission_chunks_ = HPX_MOVE(other.transmission_chunks_);
+                num_chunks_ = other.num_chunks_;
+                size_ = other.size_;
+                data_size_ = other.data_size_;
+                header_size_ = other.header_size_;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                data_point_ = HPX_MOVE(other.data_point_);
+#endif
+                accounted_ = std::exchange(other.accounted_, 0);
+            }
+            return *this;
+        }
+
+        ~parcel_buffer()
+        {
+            release_memory();
+        }
+#else
         parcel_buffer(parcel_buffer&& other) = default;
         parcel_buffer& operator=(parcel_buffer&& other) = default;
+#endif
+
+        // Attribute the memory currently held by the (encoded) non-zero-copy
+        // data to the parcel_buffers memory category
+        void account_memory() noexcept
+        {
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+            release_memory();
+            accounted_ = data_.capacity();
+            util::record_allocation(
+                util::memory_category::parcel_buffers, accounted_);
+#endif
+        }
 
         void clear()
         {
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+            release_memory();
+#endif
             data_.clear();
             chunks_.clear();
             transmission_chunks_.clear();
@@ -94,6 +154,18 @@ namespace hpx::parcelset {
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         parcelset::data_point data_point_;
 #endif
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+    private:
+        void release_memory() noexcept
+        {
+            util::record_deallocation(
+                util::memory_category::parcel_buffers, accounted_);
+            accounted_ = 0;
+        }
+
+        std::size_t accounted_ = 0;
+#endif
     };
 }    // namespace hpx::parcelset
 
@@ -383,6 +383,11 @@ namespace hpx::parcelset {
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        // send buffer pool statistics
+        std::int64_t get_send_buffer_pool_statistics(std::string const& pp_type,
+            parcelport::send_buffer_pool_statistics_type stat_type,
+            bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -407,6 +412,14 @@ namespace hpx::parcelset {
 
         std::int64_t get_outgoing_queue_length(bool reset) const;
 
+        /// Return whether any of the parcelports currently holds back
+        /// receiving messages because too many HPX threads are queued on
+        /// this locality (see hpx.parcel.backpressure_threshold)
+        bool is_receive_throttled() const;
+
+        // number of times receiving was throttled by all parcelports
+        std::int64_t get_receive_throttled_count(bool reset) const;
+
     protected:
         std::pair<std::shared_ptr<parcelport>, locality>
         find_appropriate_destination(naming::gid_type const& dest_gid);
@@ -469,6 +482,11 @@ namespace hpx::parcelset {
         static void init(
             int* argc, char*** argv, util::command_line_handling& cfg);
         static void init(hpx::resource::partitioner& rp);
+
+        // Create a dedicated pool running all parcelport progress (if
+        // requested by hpx.parcel.progress_threads)
+        static void init(hpx::resource::partitioner& rp,
+            util::runtime_configuration const& cfg);
     };
 
     std::vector<std::string> load_runtime_configuration();
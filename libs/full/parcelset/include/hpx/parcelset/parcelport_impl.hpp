@@ -29,15 +29,18 @@
 #include <hpx/parcelset/connection_cache.hpp>
 #include <hpx/parcelset/detail/call_for_each.hpp>
 #include <hpx/parcelset/detail/parcel_await.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/parcelset/encode_parcels.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -129,6 +132,25 @@ namespace hpx::parcelset {
                 (std::numeric_limits<std::size_t>::max)());
         }
 
+        static bool priority_lanes(util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<int>(
+                       ini, key + ".priority_lanes", 1) != 0;
+        }
+
+        static std::size_t bulk_message_threshold(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, key + ".bulk_message_threshold", 0);
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -144,6 +166,8 @@ namespace hpx::parcelset {
           , operations_in_flight_(0)
           , num_thread_(0)
           , max_background_thread_(max_background_threads(ini))
+          , bulk_message_threshold_(bulk_message_threshold(ini))
+          , priority_lanes_(priority_lanes(ini))
         {
             std::string const endian_out =
                 get_config_entry("hpx.parcel.endian_out",
@@ -184,6 +208,17 @@ namespace hpx::parcelset {
                 archive_flags_ = archive_flags_ |
                     serialization::archive_flags::disable_receive_data_chunking;
             }
+
+            // the compact format can be used only if the data is sent using
+            // the native endianness, the receiving end detects the format of
+            // each message
+            if (this->trusted_peers() &&
+                (endian::native == endian::big ? endian_out == "big" :
+                                                 endian_out == "little"))
+            {
+                archive_flags_ =
+                    archive_flags_ | serialization::archive_flags::trusted_peer;
+            }
         }
 
         parcelport_impl(parcelport_impl const&) = delete;
@@ -525,7 +560,9 @@ namespace hpx::parcelset {
                 HPX_ASSERT(ps == nullptr);
                 HPX_ASSERT(num_parcels == 0u);
 
-                if (!dequeue_parcels(dest_, parcels, handlers))
+                // there are no connections to spread large parcels over
+                bool bulk = true;
+                if (!dequeue_parcels(dest_, parcels, handlers, bulk))
                 {
                     return;
                 }
@@ -542,6 +579,10 @@ namespace hpx::parcelset {
                 encode_parcels(*this, ps, num_parcels, buffer, archive_flags_,
                     get_max_outbound_message_size());
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            detail::parcel_tracer::stamp(
+                ps, encoded_parcels, parcel_trace_stage::send_posted);
+#endif
             typename ConnectionHandler::sender_type::callback_fn_type
                 callback_fn = detail::call_for_each(
                     detail::call_for_each::handlers_type(
@@ -595,7 +636,8 @@ namespace hpx::parcelset {
                     HPX_ASSERT(ps == nullptr);
                     HPX_ASSERT(num_parcels == 0u);
 
-                    if (!dequeue_parcels(dest_, parcels, handlers))
+                    bool bulk = true;
+                    if (!dequeue_parcels(dest_, parcels, handlers, bulk))
                     {
                         // Give this connection back to the connection
                         // handler as we couldn't dequeue parcels.
@@ -615,6 +657,10 @@ namespace hpx::parcelset {
                     encode_parcels(*this, ps, num_parcels, encoded_buffer,
                         archive_flags_, get_max_outbound_message_size());
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                detail::parcel_tracer::stamp(
+                    ps, encoded_parcels, parcel_trace_stage::send_posted);
+#endif
                 using handler_type = detail::call_for_each;
 
                 if (sender->parcelport_->async_write(
@@ -710,6 +756,8 @@ namespace hpx::parcelset {
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
+            bool const high_priority = priority_lanes_ && p.has_high_priority();
+
             std::unique_lock const l(mtx_);
 
             // We ignore the lock here. It might happen that while enqueuing,
@@ -721,6 +769,11 @@ namespace hpx::parcelset {
             hpx::get<0>(e).push_back(HPX_MOVE(p));
             hpx::get<1>(e).push_back(HPX_MOVE(f));
 
+            if (high_priority)
+            {
+                ++pending_high_priority_parcels_[locality_id];
+            }
+
             ++num_parcel_destinations_;
             if (!parcel_destinations_.insert(locality_id).second)
             {
@@ -734,6 +787,9 @@ namespace hpx::parcelset {
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
+            std::size_t const num_high_priority =
+                count_high_priority_parcels(parcels);
+
             std::unique_lock const l(mtx_);
 
             // We ignore the lock here. It might happen that while enqueuing,
@@ -743,6 +799,12 @@ namespace hpx::parcelset {
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
+            if (num_high_priority != 0)
+            {
+                pending_high_priority_parcels_[locality_id] +=
+                    num_high_priority;
+            }
+
             mapped_type& e = pending_parcels_[locality_id];
             if (hpx::get<0>(e).empty())
             {
@@ -771,9 +833,15 @@ namespace hpx::parcelset {
             }
         }
 
+        // Dequeue the parcels pending for the given destination. If priority
+        // lanes are enabled, pending high priority parcels are dequeued on
+        // their own. If bulk transfers are enabled, the large parcels are sent
+        // only if \a bulk is true, at most one of them (or as many as fit the
+        // threshold) at a time, and \a bulk is set to whether any of them was
+        // dequeued. All small parcels are dequeued in any case.
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
-            std::vector<write_handler_type>& handlers)
+            std::vector<write_handler_type>& handlers, bool& bulk)
         {
             std::unique_lock const l(mtx_, std::try_to_lock);
             if (!l.owns_lock())
@@ -783,10 +851,98 @@ namespace hpx::parcelset {
 
             // do nothing if parcels have already been picked up by another
             // thread
-            if (it != pending_parcels_.end() &&
-                !hpx::get<0>(it->second).empty())
+            bool const found = it != pending_parcels_.end() &&
+                !hpx::get<0>(it->second).empty();
+
+            auto const hp = found && priority_lanes_ ?
+                pending_high_priority_parcels_.find(locality_id) :
+                pending_high_priority_parcels_.end();
+            bool const high_priority =
+                hp != pending_high_priority_parcels_.end();
+
+            if (found && (high_priority || bulk_message_threshold_ != 0))
             {
                 HPX_ASSERT(it->first == locality_id);
+                HPX_ASSERT(handlers.empty() && parcels.empty());
+
+                auto& pending_parcels = hpx::get<0>(it->second);
+                auto& pending_handlers = hpx::get<1>(it->second);
+                HPX_ASSERT(pending_parcels.size() == pending_handlers.size());
+
+                // move the parcels to send, compacting the ones left behind
+                std::size_t bulk_size = 0;
+                std::size_t num_pending = 0;
+                for (std::size_t i = 0; i != pending_parcels.size(); ++i)
+                {
+                    std::size_t const size = pending_parcels[i].size();
+                    bool const is_bulk = !high_priority &&
+                        bulk_message_threshold_ != 0 &&
+                        size >= bulk_message_threshold_;
+
+                    bool take = true;
+                    if (high_priority)
+                    {
+                        take = pending_parcels[i].has_high_priority();
+                    }
+                    else if (is_bulk)
+                    {
+                        take = bulk && bulk_size < bulk_message_threshold_;
+                    }
+
+                    if (take)
+                    {
+                        if (is_bulk)
+                            bulk_size += size;
+
+                        parcels.push_back(HPX_MOVE(pending_parcels[i]));
+                        handlers.push_back(HPX_MOVE(pending_handlers[i]));
+                    }
+                    else
+                    {
+                        if (num_pending != i)
+                        {
+                            pending_parcels[num_pending] =
+                                HPX_MOVE(pending_parcels[i]);
+                            pending_handlers[num_pending] =
+                                HPX_MOVE(pending_handlers[i]);
+                        }
+                        ++num_pending;
+                    }
+                }
+
+                pending_parcels.erase(
+                    pending_parcels.begin() + num_pending,
+                    pending_parcels.end());
+                pending_handlers.erase(
+                    pending_handlers.begin() + num_pending,
+                    pending_handlers.end());
+
+                // all pending high priority parcels have been dequeued
+                if (high_priority)
+                {
+                    HPX_ASSERT(parcels.size() == hp->second);
+                    pending_high_priority_parcels_.erase(hp);
+                }
+
+                bulk = bulk_size != 0;
+                if (parcels.empty())
+                {
+                    // only large parcels are pending but no bulk transfer
+                    // is possible right now
+                    HPX_ASSERT(!high_priority);
+                    return false;
+                }
+
+                if (num_pending != 0)
+                {
+                    // the destination still has parcels pending
+                    return true;
+                }
+            }
+            else if (found)
+            {
+                HPX_ASSERT(it->first == locality_id);
+                bulk = false;
                 HPX_ASSERT(handlers.empty());
                 HPX_ASSERT(handlers.size() == parcels.size());
                 std::swap(parcels, hpx::get<0>(it->second));
@@ -795,6 +951,7 @@ namespace hpx::parcelset {
                 HPX_ASSERT(handlers.size() == parcels.size());
 
                 HPX_ASSERT(!handlers.empty());
+                HPX_ASSERT(!high_priority);
             }
             else
             {
@@ -831,6 +988,17 @@ namespace hpx::parcelset {
                     handler = HPX_MOVE(handlers.back());
                     handlers.pop_back();
 
+                    if (priority_lanes_ && p.has_high_priority())
+                    {
+                        auto const hp =
+                            pending_high_priority_parcels_.find(dest);
+                        HPX_ASSERT(hp != pending_high_priority_parcels_.end());
+                        if (--hp->second == 0)
+                        {
+                            pending_high_priority_parcels_.erase(hp);
+                        }
+                    }
+
                     if (parcels.empty())
                     {
                         pending_parcels_.erase(dest);
@@ -890,43 +1058,76 @@ namespace hpx::parcelset {
             // force a new connection to avoid deadlocks.
             constexpr bool force_connection = true;
 
-            error_code ec;
-            std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
-
-            if (!sender_connection)
+            // Large parcels left pending while others are being sent are
+            // spread over the remaining connections to the destination.
+            bool more_pending = true;
+            while (more_pending)
             {
-                // We can safely return if no connection is available at this
-                // point. As soon as a connection becomes available it checks
-                // for pending parcels and sends those out.
-                return;
-            }
+                error_code ec;
+                std::shared_ptr<connection> sender_connection =
+                    get_connection(locality_id, force_connection, ec);
 
-            // repeat until no more parcels are to be sent
-            std::vector<parcel> parcels;
-            std::vector<write_handler_type> handlers;
+                if (!sender_connection)
+                {
+                    // We can safely return if no connection is available at
+                    // this point. As soon as a connection becomes available
+                    // it checks for pending parcels and sends those out.
+                    return;
+                }
+
+                // one of the connections is kept free of bulk transfers
+                bool const reserved_bulk = bulk_message_threshold_ != 0 &&
+                    connection_cache_.reserve_bulk(locality_id);
+                bool bulk = reserved_bulk;
+
+                std::vector<parcel> parcels;
+                std::vector<write_handler_type> handlers;
+
+                if (!dequeue_parcels(locality_id, parcels, handlers, bulk))
+                {
+                    if (reserved_bulk)
+                    {
+                        connection_cache_.release_bulk(locality_id);
+                    }
+
+                    // Give this connection back to the cache as we couldn't
+                    // dequeue parcels.
+                    connection_cache_.reclaim(locality_id, sender_connection);
+                    return;
+                }
+
+                if (reserved_bulk && !bulk)
+                {
+                    connection_cache_.release_bulk(locality_id);
+                }
+
+                more_pending = false;
+                if (bulk_message_threshold_ != 0 || priority_lanes_)
+                {
+                    std::lock_guard l(mtx_);
+                    auto const it = pending_parcels_.find(locality_id);
+                    more_pending = it != pending_parcels_.end() &&
+                        !hpx::get<0>(it->second).empty();
+                }
 
-            if (!dequeue_parcels(locality_id, parcels, handlers))
-            {
-                // Give this connection back to the cache as we couldn't dequeue
-                // parcels.
-                connection_cache_.reclaim(locality_id, sender_connection);
-            }
-            else
-            {
                 // send parcels if they didn't get sent by another connection
                 send_pending_parcels(locality_id, sender_connection,
-                    HPX_MOVE(parcels), HPX_MOVE(handlers));
+                    HPX_MOVE(parcels), HPX_MOVE(handlers), bulk);
             }
         }
 
-        void send_pending_parcels_trampoline(std::error_code const& ec,
-            locality const& locality_id,
+        void send_pending_parcels_trampoline(bool bulk,
+            std::error_code const& ec, locality const& locality_id,
             std::shared_ptr<connection> sender_connection)
         {
             HPX_ASSERT(operations_in_flight_ != 0);
             --operations_in_flight_;
 
+            if (bulk)
+            {
+                connection_cache_.release_bulk(locality_id);
+            }
+
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             sender_connection->set_state(connection::state_scheduled_thread);
 #endif
@@ -961,8 +1162,9 @@ namespace hpx::parcelset {
 
         void send_pending_parcels(parcelset::locality const& parcel_locality_id,
             std::shared_ptr<connection> sender_connection,
-            std::vector<parcel>&& parcels,                 //-V826
-            std::vector<write_handler_type>&& handlers)    //-V826
+            std::vector<parcel>&& parcels,                //-V826
+            std::vector<write_handler_type>&& handlers,    //-V826
+            bool bulk = false)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             sender_connection->set_state(connection::state_send_pending);
@@ -973,12 +1175,45 @@ namespace hpx::parcelset {
             // HPX_ASSERT(parcel_locality_id == sender_connection->destination());
             sender_connection->verify_(parcel_locality_id);
 #endif
+            using hpx::parcelset::detail::call_for_each;
+            if constexpr (connection_handler_traits<
+                              ConnectionHandler>::send_streaming_parcels::value)
+            {
+                if (threads::threadmanager_is(hpx::state::running) &&
+                    stream_parcels(*this, parcels.data(), parcels.size()))
+                {
+                    ++operations_in_flight_;
+
+                    // the parcels are moved into the write handler below,
+                    // their storage stays in place
+                    parcel const* ps = parcels.data();
+                    std::size_t const count = parcels.size();
+
+                    // serialize and send all parcels at the same time, this
+                    // returns once all data was handed to the network
+                    sender_connection->write_streaming(
+                        [this, ps, count](serialization::output_stream& stream,
+                            auto& buffer) {
+                            return encode_parcels_streaming(*this, ps, count,
+                                stream, buffer, archive_flags_);
+                        },
+                        call_for_each(HPX_MOVE(handlers), HPX_MOVE(parcels)),
+                        hpx::bind_front(
+                            &parcelport_impl::send_pending_parcels_trampoline,
+                            this, bulk));
+                    return;
+                }
+            }
+
             // encode the parcels
             std::size_t const num_parcels = encode_parcels(*this,
                 parcels.data(), parcels.size(), sender_connection->buffer_,
                 archive_flags_, this->get_max_outbound_message_size());
 
-            using hpx::parcelset::detail::call_for_each;
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            detail::parcel_tracer::stamp(
+                parcels.data(), num_parcels, parcel_trace_stage::send_posted);
+#endif
             if (num_parcels == parcels.size())
             {
                 ++operations_in_flight_;
@@ -988,7 +1223,7 @@ namespace hpx::parcelset {
                     call_for_each(HPX_MOVE(handlers), HPX_MOVE(parcels)),
                     hpx::bind_front(
                         &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, bulk));
             }
             else
             {
@@ -1015,7 +1250,7 @@ namespace hpx::parcelset {
                         HPX_MOVE(handled_handlers), HPX_MOVE(handled_parcels)),
                     hpx::bind_front(
                         &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, bulk));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin() + num_parcels);
@@ -1032,6 +1267,18 @@ namespace hpx::parcelset {
             hpx::execution_base::this_thread::yield();
         }
 
+        std::size_t count_high_priority_parcels(
+            std::vector<parcel> const& parcels) const
+        {
+            if (!priority_lanes_)
+            {
+                return 0;
+            }
+            return static_cast<std::size_t>(
+                std::count_if(parcels.begin(), parcels.end(),
+                    [](parcel const& p) { return p.has_high_priority(); }));
+        }
+
     public:
         std::size_t get_next_num_thread()
         {
@@ -1052,6 +1299,17 @@ namespace hpx::parcelset {
 
         std::atomic<std::size_t> num_thread_;
         std::size_t const max_background_thread_;
+
+        /// parcels of at least this (estimated) size are sent as bulk
+        /// transfers, zero if all parcels are handled alike
+        std::size_t const bulk_message_threshold_;
+
+        /// send high priority parcels separately, ahead of all others
+        bool const priority_lanes_;
+
+        /// number of high priority parcels pending for each destination (if
+        /// priority lanes are enabled), protected by mtx_
+        std::map<locality, std::size_t> pending_high_priority_parcels_;
     };
 }    // namespace hpx::parcelset
 
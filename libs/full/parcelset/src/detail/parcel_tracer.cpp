@@ -0,0 +1,305 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        // bucket zero counts zero values, bucket i counts v < 2^i
+        constexpr std::size_t get_bucket(std::uint64_t value) noexcept
+        {
+            std::size_t bucket = 0;
+            while (value != 0 &&
+                bucket != parcel_trace_histogram_num_buckets - 1)
+            {
+                value >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        // the stages delimiting the given interval
+        constexpr std::pair<parcel_trace_stage, parcel_trace_stage>
+        get_stages(std::size_t interval) noexcept
+        {
+            constexpr std::pair<parcel_trace_stage, parcel_trace_stage>
+                stages[num_parcel_trace_intervals] = {
+                    {parcel_trace_stage::enqueue,
+                        parcel_trace_stage::serialize_begin},
+                    {parcel_trace_stage::serialize_begin,
+                        parcel_trace_stage::serialize_end},
+                    {parcel_trace_stage::serialize_end,
+                        parcel_trace_stage::send_posted},
+                    {parcel_trace_stage::send_posted,
+                        parcel_trace_stage::send_complete},
+                    {parcel_trace_stage::receive, parcel_trace_stage::decode},
+                    {parcel_trace_stage::decode, parcel_trace_stage::schedule},
+                };
+            return stages[interval];
+        }
+
+        constexpr char const* const interval_names[] = {
+            "queue", "serialization", "post", "send", "decode", "schedule"};
+
+        // the first interval recorded by the receiving side
+        constexpr std::size_t first_received_interval =
+            static_cast<std::size_t>(parcel_trace_interval::decode);
+
+        std::string escape(char const* str)
+        {
+            std::string result;
+            for (/**/; *str != '\0'; ++str)
+            {
+                if (*str == '"' || *str == '\\')
+                {
+                    result += '\\';
+                }
+                result += *str;
+            }
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    parcel_tracer& parcel_tracer::instance()
+    {
+        static parcel_tracer tracer;
+        return tracer;
+    }
+
+    void parcel_tracer::init(util::runtime_configuration const& cfg)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        file_ = cfg.get_entry("hpx.parcel.tracing_file", "");
+        max_events_ = util::get_entry_as<std::size_t>(
+            cfg, "hpx.parcel.tracing_max_events", 1000000);
+
+        // writing trace events implies tracing
+        bool const enable =
+            util::get_entry_as<int>(cfg, "hpx.parcel.tracing", 0) != 0;
+        enabled_.store(enable || !file_.empty(), std::memory_order_relaxed);
+    }
+
+    void parcel_tracer::sent(parcel const& p)
+    {
+        if (enabled())
+        {
+            p.set_trace_stamp(parcel_trace_stage::send_complete,
+                chrono::high_resolution_clock::now());
+            record(p, true);
+        }
+    }
+
+    void parcel_tracer::scheduled(parcel const& p)
+    {
+        if (enabled())
+        {
+            p.set_trace_stamp(parcel_trace_stage::schedule,
+                chrono::high_resolution_clock::now());
+            record(p, false);
+        }
+    }
+
+    void parcel_tracer::record(parcel const& p, bool sent)
+    {
+        char const* action = p.get_action_name();
+
+        std::size_t const first = sent ? 0 : first_received_interval;
+        std::size_t const last =
+            sent ? first_received_interval : num_parcel_trace_intervals;
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        auto it = per_action_.find(action);
+        if (it == per_action_.end())
+        {
+            it = per_action_
+                     .emplace(action, std::make_unique<histograms_type>())
+                     .first;
+        }
+
+        parcel_trace_stamps stamps;
+        for (std::size_t i = 0; i != num_parcel_trace_stages; ++i)
+        {
+            stamps[i] = p.trace_stamp(static_cast<parcel_trace_stage>(i));
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            auto const [from, to] = get_stages(i);
+            std::uint64_t const begin = stamps[static_cast<std::size_t>(from)];
+            std::uint64_t const end = stamps[static_cast<std::size_t>(to)];
+
+            // stages may be missing, e.g. for parcels sent while streaming
+            if (begin == 0 || end < begin)
+            {
+                continue;
+            }
+
+            std::size_t const bucket = get_bucket(end - begin);
+            ++total_[i][bucket];
+            ++(*it->second)[i][bucket];
+        }
+
+        if (!file_.empty() && events_.size() < max_events_)
+        {
+            std::uint32_t const peer = sent ?
+                p.destination_locality_id() :
+                naming::get_locality_id_from_gid(p.parcel_id());
+            events_.push_back(trace_event{
+                p.parcel_id(), it->first.c_str(), peer, sent, stamps});
+        }
+    }
+
+    std::vector<std::int64_t> parcel_tracer::get_histogram(
+        parcel_trace_interval which, std::string const& action, bool reset)
+    {
+        std::vector<std::int64_t> result;
+        result.reserve(parcel_trace_histogram_num_buckets + 3);
+
+        // first add histogram parameters, the buckets are identified by their
+        // index
+        result.push_back(0);
+        result.push_back(
+            static_cast<std::int64_t>(parcel_trace_histogram_num_buckets));
+        result.push_back(
+            static_cast<std::int64_t>(parcel_trace_histogram_num_buckets));
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        histogram_type* histogram = nullptr;
+        if (action.empty())
+        {
+            histogram = &total_[static_cast<std::size_t>(which)];
+        }
+        else if (auto const it = per_action_.find(action);
+                 it != per_action_.end())
+        {
+            histogram = &(*it->second)[static_cast<std::size_t>(which)];
+        }
+
+        if (histogram == nullptr)
+        {
+            result.resize(parcel_trace_histogram_num_buckets + 3, 0);
+            return result;
+        }
+
+        result.insert(result.end(), histogram->begin(), histogram->end());
+        if (reset)
+        {
+            histogram->fill(0);
+        }
+        return result;
+    }
+
+    // The events are written in the Trace Event Format understood by
+    // chrome://tracing and Perfetto. Each locality writes its own file, the
+    // time stamps of different localities are not synchronized.
+    void parcel_tracer::write_trace_events(std::uint32_t locality_id)
+    {
+        std::vector<trace_event> events;
+        std::string file;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (file_.empty() || events_.empty())
+            {
+                return;
+            }
+            events = HPX_MOVE(events_);
+            events_.clear();
+            file = hpx::util::format("{}.{}", file_, locality_id);
+        }
+
+        std::ofstream out(file);
+        if (!out)
+        {
+            LPT_(error).format(
+                "parcel_tracer: could not open trace file: {}", file);
+            return;
+        }
+
+        out << "{\"traceEvents\":[\n";
+
+        char const* separator = "";
+        for (trace_event const& e : events)
+        {
+            std::string const id = hpx::util::format("{:016llx}{:016llx}",
+                e.parcel_id_.get_msb(), e.parcel_id_.get_lsb());
+            std::string const action = escape(e.action_);
+
+            std::size_t const first = e.sent_ ? 0 : first_received_interval;
+            std::size_t const last =
+                e.sent_ ? first_received_interval : num_parcel_trace_intervals;
+
+            for (std::size_t i = first; i != last; ++i)
+            {
+                auto const [from, to] = get_stages(i);
+                std::uint64_t const begin =
+                    e.stamps_[static_cast<std::size_t>(from)];
+                std::uint64_t const end =
+                    e.stamps_[static_cast<std::size_t>(to)];
+                if (begin == 0 || end < begin)
+                {
+                    continue;
+                }
+
+                // the time stamps are given in microseconds
+                hpx::util::format_to(out,
+                    "{}{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\","
+                    "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":{},\"tid\":{},"
+                    "\"args\":{{\"parcel\":\"{}\",\"peer\":{}}}}}",
+                    separator, action, interval_names[i],
+                    static_cast<double>(begin) * 1e-3,
+                    static_cast<double>(end - begin) * 1e-3, locality_id,
+                    e.sent_ ? 0 : 1, id, e.peer_);
+                separator = ",\n";
+            }
+
+            // connect the sending and the receiving side of the parcel
+            std::uint64_t const flow = e.sent_ ?
+                e.stamps_[static_cast<std::size_t>(
+                    parcel_trace_stage::send_posted)] :
+                e.stamps_[static_cast<std::size_t>(
+                    parcel_trace_stage::receive)];
+            if (flow != 0)
+            {
+                hpx::util::format_to(out,
+                    "{}{{\"name\":\"{}\",\"cat\":\"parcel\",\"ph\":\"{}\","
+                    "\"bp\":\"e\",\"id\":\"{}\",\"ts\":{:.3f},\"pid\":{},"
+                    "\"tid\":{}}}",
+                    separator, action, e.sent_ ? "s" : "f", id,
+                    static_cast<double>(flow) * 1e-3, locality_id,
+                    e.sent_ ? 0 : 1);
+                separator = ",\n";
+            }
+        }
+
+        out << "\n]}\n";
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
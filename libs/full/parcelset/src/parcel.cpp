@@ -42,7 +42,7 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
       , start_time_(0)
       , creation_time_(chrono::high_resolution_timer::now())
-
+      , trace_stamps_()
 #endif
       , has_continuation_(false)
     {
@@ -56,6 +56,7 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
       , start_time_(0)
       , creation_time_(chrono::high_resolution_timer::now())
+      , trace_stamps_()
 #endif
       , has_continuation_(has_continuation)
     {
@@ -69,6 +70,7 @@ namespace hpx::parcelset::detail {
       , parcel_id_(HPX_MOVE(rhs.parcel_id_))
       , start_time_(rhs.start_time_)
       , creation_time_(rhs.creation_time_)
+      , trace_stamps_(rhs.trace_stamps_)
 #endif
       , has_continuation_(rhs.has_continuation_)
     {
@@ -92,6 +94,7 @@ namespace hpx::parcelset::detail {
         parcel_id_ = HPX_MOVE(rhs.parcel_id_);
         start_time_ = rhs.start_time_;
         creation_time_ = rhs.creation_time_;
+        trace_stamps_ = rhs.trace_stamps_;
 #endif
         has_continuation_ = rhs.has_continuation_;
 
@@ -322,6 +325,16 @@ namespace hpx::parcelset::detail {
     {
         return data_.parcel_id_;
     }
+
+    std::uint64_t parcel::trace_stamp(parcel_trace_stage stage) const
+    {
+        return data_.trace_stamps_[static_cast<std::size_t>(stage)];
+    }
+
+    void parcel::set_trace_stamp(parcel_trace_stage stage, std::uint64_t time)
+    {
+        data_.trace_stamps_[static_cast<std::size_t>(stage)] = time;
+    }
 #endif
 
 #if defined(HPX_HAVE_NETWORKING)
@@ -481,6 +494,16 @@ namespace hpx::parcelset::detail {
                 action_->get_parent_thread_id().get()));
 #endif
 
+#if defined(HPX_HAVE_TASK_TRACING)
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        threads::tracing::parcel_receive(data_.parcel_id_.get_lsb(), size_,
+            naming::get_locality_id_from_gid(data_.source_id_));
+#else
+        threads::tracing::parcel_receive(
+            0, size_, naming::get_locality_id_from_gid(data_.source_id_));
+#endif
+#endif
+
         return false;
     }
 
@@ -518,10 +541,14 @@ namespace hpx::parcelset::detail {
 #if !defined(HPX_DEBUG)
         action_.reset(action_registry::create(id, data_.has_continuation_));
 #else
+        // trusted peers send the action id only
         std::string name;
-        ar >> name;
-        action_.reset(
-            action_registry::create(id, data_.has_continuation_, &name));
+        if (!ar.trusted_peer())
+        {
+            ar >> name;
+        }
+        action_.reset(action_registry::create(
+            id, data_.has_continuation_, ar.trusted_peer() ? nullptr : &name));
 #endif
     }
 
@@ -540,8 +567,11 @@ namespace hpx::parcelset::detail {
         ar << id;
 
 #if defined(HPX_DEBUG)
-        std::string const name(action_->get_action_name());
-        ar << name;
+        if (!ar.trusted_peer())
+        {
+            std::string const name(action_->get_action_name());
+            ar << name;
+        }
 #endif
     }
 
@@ -33,6 +33,7 @@
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/parcelset/init_parcelports.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
@@ -97,6 +98,9 @@ namespace hpx::parcelset {
       , is_networking_enabled_(false)
 #endif
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        detail::parcel_tracer::instance().init(cfg);
+#endif
         LPROGRESS_;
     }
 
@@ -429,6 +433,12 @@ namespace hpx::parcelset {
 
         // release all message handlers
         handlers_.clear();
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        error_code ec(throwmode::lightweight);    // ignore all errors
+        detail::parcel_tracer::instance().write_trace_events(
+            agas::get_locality_id(ec));
+#endif
     }
 
     bool parcelhandler::get_raw_remote_localities(
@@ -535,6 +545,12 @@ namespace hpx::parcelset {
                 hpx::detail::dijkstra_make_black();
             }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            if (!ec)
+            {
+                parcel_tracer::instance().sent(p);
+            }
+#endif
             // invoke the original handler
             f(ec, p);
 
@@ -547,6 +563,16 @@ namespace hpx::parcelset {
             // tell APEX about the sent parcel
             util::external_timer::send(
                 p.parcel_id().get_lsb(), p.size(), p.destination_locality_id());
+#endif
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            threads::tracing::parcel_send(p.parcel_id().get_lsb(), p.size(),
+                p.destination_locality_id());
+#else
+            threads::tracing::parcel_send(
+                0, p.size(), p.destination_locality_id());
+#endif
 #endif
         }
     }    // namespace detail
@@ -901,6 +927,28 @@ namespace hpx::parcelset {
         return parcel_count;
     }
 
+    bool parcelhandler::is_receive_throttled() const
+    {
+        for (pports_type::value_type const& pp : pports_)
+        {
+            if (pp.second->receive_backpressure())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::int64_t parcelhandler::get_receive_throttled_count(bool reset) const
+    {
+        std::int64_t count = 0;
+        for (pports_type::value_type const& pp : pports_)
+        {
+            count += pp.second->get_receive_throttled_count(reset);
+        }
+        return count;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // default callback for put_parcel
     void default_write_handler(std::error_code const& ec, parcel const& p)
@@ -1336,6 +1384,17 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // send buffer pool statistics
+    std::int64_t parcelhandler::get_send_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::send_buffer_pool_statistics_type stat_type,
+        bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_send_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1370,6 +1429,59 @@ namespace hpx::parcelset {
         }
     }
 
+    void parcelhandler::init(hpx::resource::partitioner& rp,
+        util::runtime_configuration const& cfg)
+    {
+        init(rp);
+
+        std::size_t num_progress_threads = util::get_entry_as<std::size_t>(
+            cfg, "hpx.parcel.progress_threads", 0);
+        if (num_progress_threads == 0)
+        {
+            return;
+        }
+
+        std::vector<hpx::resource::pu const*> pus;
+        for (auto const& numa_domain : rp.numa_domains())
+        {
+            for (auto const& core : numa_domain.cores())
+            {
+                for (auto const& pu : core.pus())
+                {
+                    pus.push_back(&pu);
+                }
+            }
+        }
+
+        // leave at least one processing unit for the default pool
+        if (pus.size() <= 1)
+        {
+            LPT_(warning).format("parcelhandler::init: not enough processing "
+                                 "units for a dedicated progress pool");
+            return;
+        }
+        num_progress_threads =
+            (std::min)(num_progress_threads, pus.size() - 1);
+
+        // The progress pool runs background work only (parcelport progress,
+        // polling, and callback dispatch). Any HPX thread created from it is
+        // handed off to the default pool (see get_self_or_default_pool).
+        std::string const pool_name =
+            cfg.get_entry("hpx.parcel.progress_pool", "parcel-progress-pool");
+
+        rp.create_thread_pool(pool_name,
+            hpx::resource::scheduling_policy::static_,
+            hpx::threads::policies::scheduler_mode::do_background_work_only);
+
+        // use the last processing units, keeping the first ones (which run
+        // the main thread) for the compute pools
+        for (std::size_t i = pus.size() - num_progress_threads;
+             i != pus.size(); ++i)
+        {
+            rp.add_resource(*pus[i], pool_name);
+        }
+    }
+
     std::vector<std::string> load_runtime_configuration()
     {
         std::vector<std::string> ini_defs;
@@ -1410,6 +1522,30 @@ namespace hpx::parcelset {
                               "$[hpx.parcel.zero_copy_optimization]}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.emplace_back(
+            "trusted_peers = ${HPX_PARCEL_TRUSTED_PEERS:0}");
+        ini_defs.emplace_back(
+            "streaming_threshold = ${HPX_PARCEL_STREAMING_THRESHOLD:0}");
+        ini_defs.emplace_back("streaming_chunk_size = "
+                              "${HPX_PARCEL_STREAMING_CHUNK_SIZE:1048576}");
+        ini_defs.emplace_back(
+            "bulk_message_threshold = ${HPX_PARCEL_BULK_MESSAGE_THRESHOLD:0}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}");
+        ini_defs.emplace_back("parallel_decode_threshold = "
+                              "${HPX_PARCEL_PARALLEL_DECODE_THRESHOLD:0}");
+        ini_defs.emplace_back(
+            "inline_direct_actions = ${HPX_PARCEL_INLINE_DIRECT_ACTIONS:0}");
+        ini_defs.emplace_back("backpressure_threshold = "
+                              "${HPX_PARCEL_BACKPRESSURE_THRESHOLD:0}");
+        ini_defs.emplace_back(
+            "backpressure_delay = ${HPX_PARCEL_BACKPRESSURE_DELAY:100}");
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        ini_defs.emplace_back("tracing = ${HPX_PARCEL_TRACING:0}");
+        ini_defs.emplace_back("tracing_file = ${HPX_PARCEL_TRACING_FILE:}");
+        ini_defs.emplace_back(
+            "tracing_max_events = ${HPX_PARCEL_TRACING_MAX_EVENTS:1000000}");
+#endif
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.emplace_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -1423,6 +1559,15 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back(
+            "send_buffer_pool_size = ${HPX_PARCEL_SEND_BUFFER_POOL_SIZE:4}");
+        ini_defs.emplace_back("send_buffer_pool_max_buffer_size = "
+                              "${HPX_PARCEL_SEND_BUFFER_POOL_MAX_BUFFER_SIZE:"
+                              "4194304}");
+        ini_defs.emplace_back(
+            "progress_threads = ${HPX_PARCEL_PROGRESS_THREADS:0}");
+        ini_defs.emplace_back(
+            "progress_pool = ${HPX_PARCEL_PROGRESS_POOL:parcel-progress-pool}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -1445,6 +1590,7 @@ namespace hpx::parcelset {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         // set the current local time for this locality
         p.set_start_time(hpx::chrono::high_resolution_timer::now());
+        detail::parcel_tracer::stamp(p, parcel_trace_stage::enqueue);
 
         if (!p.parcel_id())
         {
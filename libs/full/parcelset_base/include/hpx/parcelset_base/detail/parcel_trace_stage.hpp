@@ -0,0 +1,36 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset {
+
+    /// The stages of the lifecycle of a parcel which are time stamped if
+    /// parcel tracing is enabled (see hpx.parcel.tracing). The first five
+    /// stages are recorded on the sending locality, the remaining ones on the
+    /// receiving locality. All time stamps are taken from the local clock.
+    enum class parcel_trace_stage : std::uint8_t
+    {
+        enqueue = 0,            // the parcel was handed to the parcelhandler
+        serialize_begin = 1,    // the serialization of the parcel started
+        serialize_end = 2,      // the parcel was serialized
+        send_posted = 3,        // the message was handed to the network
+        send_complete = 4,      // the write handler of the parcel was called
+        receive = 5,            // the message was received completely
+        decode = 6,             // the parcel was de-serialized
+        schedule = 7            // the thread running the action was created
+    };
+
+    inline constexpr std::size_t num_parcel_trace_stages = 8;
+
+    /// The time stamps [ns] of a single parcel, zero if not recorded
+    using parcel_trace_stamps =
+        std::array<std::uint64_t, num_parcel_trace_stages>;
+}    // namespace hpx::parcelset
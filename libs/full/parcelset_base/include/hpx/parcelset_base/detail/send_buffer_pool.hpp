@@ -0,0 +1,75 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    // A pool of buffers for serializing outgoing messages. Once a send
+    // has completed, its buffer is handed back to the pool together with the
+    // memory it has already allocated (and touched), the next message then
+    // does not have to allocate (and page fault) a new buffer. The buffers
+    // are kept per worker thread, each worker retains at most
+    // max_buffers_per_thread buffers of no more than max_buffer_size bytes.
+    class HPX_EXPORT send_buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+
+        send_buffer_pool(std::size_t num_threads,
+            std::size_t max_buffers_per_thread, std::size_t max_buffer_size);
+
+        send_buffer_pool(send_buffer_pool const&) = delete;
+        send_buffer_pool(send_buffer_pool&&) = delete;
+        send_buffer_pool& operator=(send_buffer_pool const&) = delete;
+        send_buffer_pool& operator=(send_buffer_pool&&) = delete;
+
+        ~send_buffer_pool() = default;
+
+        // Make the given (empty) buffer hold at least the given capacity,
+        // reusing the smallest sufficiently large buffer of the calling
+        // worker if possible.
+        void get(buffer_type& buffer, std::size_t capacity);
+
+        // Return the buffer of a completed send to the pool of the calling
+        // worker.
+        void release(buffer_type&& buffer) noexcept;
+
+        std::int64_t hits(bool reset) noexcept;
+        std::int64_t misses(bool reset) noexcept;
+
+    private:
+        using mutex_type = hpx::spinlock;
+
+        struct thread_pool_data
+        {
+            mutex_type mtx_;
+            std::vector<buffer_type> buffers_;
+        };
+
+        thread_pool_data& get_thread_data() noexcept;
+
+        std::vector<util::cache_aligned_data<thread_pool_data>> data_;
+        std::size_t const max_buffers_per_thread_;
+        std::size_t const max_buffer_size_;
+
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#endif
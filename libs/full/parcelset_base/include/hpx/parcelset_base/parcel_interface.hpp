@@ -20,6 +20,7 @@
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/gid_type.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/parcelset_base/detail/parcel_trace_stage.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
@@ -107,6 +108,10 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         virtual naming::gid_type const& parcel_id() const = 0;
         virtual naming::gid_type& parcel_id() = 0;
+
+        virtual std::uint64_t trace_stamp(parcel_trace_stage stage) const = 0;
+        virtual void set_trace_stamp(
+            parcel_trace_stage stage, std::uint64_t time) = 0;
 #endif
 
         HPX_SERIALIZATION_SPLIT_MEMBER()
@@ -159,6 +164,10 @@ namespace hpx::parcelset {
         [[nodiscard]] threads::thread_priority get_thread_priority() const;
         [[nodiscard]] threads::thread_stacksize get_thread_stacksize() const;
 
+        // returns true if the action is executed on a high priority thread,
+        // such parcels are sent and scheduled ahead of all others
+        [[nodiscard]] bool has_high_priority() const;
+
         [[nodiscard]] std::uint32_t get_parent_locality_id() const;
         [[nodiscard]] threads::thread_id_type get_parent_thread_id() const;
         [[nodiscard]] std::uint64_t get_parent_thread_phase() const;
@@ -166,6 +175,11 @@ namespace hpx::parcelset {
         naming::gid_type const& parcel_id() const;
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         naming::gid_type& parcel_id();
+
+        // time stamps recorded by the parcel tracer
+        [[nodiscard]] std::uint64_t trace_stamp(parcel_trace_stage stage) const;
+        void set_trace_stamp(
+            parcel_trace_stage stage, std::uint64_t time) const;
 #endif
 
         serialization::binary_filter* get_serialization_filter() const;
@@ -22,6 +22,7 @@
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
+#include <hpx/parcelset_base/detail/send_buffer_pool.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 #include <hpx/parcelset_base/parcelset_base_fwd.hpp>
@@ -82,6 +83,24 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Make the given (empty) buffer hold at least the given capacity for
+        /// serializing an outgoing message, preferably by reusing the buffer
+        /// of a completed send.
+        void get_send_buffer(std::vector<char>& buffer, std::size_t capacity);
+
+        /// Hand the buffer of a completed send back for reuse.
+        void release_send_buffer(std::vector<char>&& buffer) noexcept;
+
+        /// Return the given send buffer pool statistic
+        enum send_buffer_pool_statistics_type
+        {
+            send_buffer_pool_hits = 0,
+            send_buffer_pool_misses = 1
+        };
+
+        std::int64_t get_send_buffer_pool_statistics(
+            send_buffer_pool_statistics_type, bool reset) noexcept;
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -324,6 +343,54 @@ namespace hpx::parcelset {
 
         bool async_serialization() const noexcept;
 
+        /// Return whether the localities this parcelport communicates with
+        /// are trusted to run the same binary on the same kind of hardware,
+        /// which allows to use a more compact serialization format
+        bool trusted_peers() const noexcept;
+
+        /// Return the minimal (estimated) size of a message which is sent
+        /// while it is being serialized, zero if messages are never streamed
+        std::size_t get_streaming_threshold() const noexcept;
+
+        /// Return the maximal size of the pieces streamed messages are sent
+        /// in
+        std::size_t get_streaming_chunk_size() const noexcept;
+
+        /// Return the minimal size of a received message which is decoded
+        /// on a new thread, zero if messages are decoded where received
+        std::size_t get_parallel_decode_threshold() const noexcept;
+
+        /// Return whether direct actions received as part of a message
+        /// containing several parcels are executed while decoding it
+        bool inline_direct_actions() const noexcept;
+
+        /// Return whether the zero-copy chunks of messages may be located in
+        /// device memory, i.e. whether the underlying transport is able to
+        /// access device memory directly
+        bool allow_device_memory() const noexcept;
+
+        /// Return whether the parcelport should stop receiving new messages
+        /// for now, i.e. whether the combined length of the queues of all
+        /// schedulers on this locality (the number of pending and staged HPX
+        /// threads) exceeds the configured backpressure threshold. The
+        /// parcelports re-check this every get_backpressure_delay()
+        /// microseconds before accepting further messages. Messages are
+        /// never held back during startup and shutdown.
+        bool receive_backpressure() noexcept;
+
+        /// Return the configured backpressure threshold, zero if the
+        /// receive backpressure is disabled
+        std::int64_t get_backpressure_threshold() const noexcept;
+
+        /// Return the time in microseconds after which the parcelport checks
+        /// again whether to resume receiving messages
+        std::int64_t get_backpressure_delay() const noexcept;
+
+        /// Return the number of times the queue lengths were found to exceed
+        /// the backpressure threshold (they are sampled at most once per
+        /// backpressure delay)
+        std::int64_t get_receive_throttled_count(bool reset) noexcept;
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(
             std::error_code const& ec, parcel const& p) const;
@@ -369,11 +436,35 @@ namespace hpx::parcelset {
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// use the compact serialization format for trusted peers
+        bool trusted_peers_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+
+        /// stream messages larger than this in pieces of the given size
+        std::size_t streaming_threshold_;
+        std::size_t streaming_chunk_size_;
+
+        /// decode messages larger than this on a new thread
+        std::size_t parallel_decode_threshold_;
+        bool inline_direct_actions_;
+
+        /// the transport sends and receives chunks in device memory
+        bool allow_device_memory_;
+
+        /// stop receiving while more HPX threads than this are queued
+        std::int64_t backpressure_threshold_;
+        std::int64_t backpressure_delay_;
+        std::atomic<std::int64_t> receive_throttled_count_;
+        std::atomic<std::uint64_t> backpressure_next_check_;
+        std::atomic<bool> backpressure_active_;
+
+        /// recycled buffers of completed sends
+        detail::send_buffer_pool send_buffer_pool_;
     };
 }    // namespace hpx::parcelset
 
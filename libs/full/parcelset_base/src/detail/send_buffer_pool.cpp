@@ -0,0 +1,152 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/parcelset_base/detail/send_buffer_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    // the last entry is used by all threads which are not HPX worker threads
+    send_buffer_pool::send_buffer_pool(std::size_t num_threads,
+        std::size_t max_buffers_per_thread, std::size_t max_buffer_size)
+      : data_(num_threads + 1)
+      , max_buffers_per_thread_(max_buffers_per_thread)
+      , max_buffer_size_(max_buffer_size)
+      , hits_(0)
+      , misses_(0)
+    {
+    }
+
+    send_buffer_pool::thread_pool_data&
+    send_buffer_pool::get_thread_data() noexcept
+    {
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread < data_.size() - 1)
+        {
+            return data_[num_thread].data_;
+        }
+        return data_.back().data_;
+    }
+
+    void send_buffer_pool::get(buffer_type& buffer, std::size_t capacity)
+    {
+        HPX_ASSERT(buffer.empty());
+        if (buffer.capacity() >= capacity)
+        {
+            return;
+        }
+
+        if (max_buffers_per_thread_ != 0)
+        {
+            thread_pool_data& data = get_thread_data();
+
+            std::unique_lock<mutex_type> l(data.mtx_);
+
+            // find the smallest buffer which is large enough
+            auto best = data.buffers_.end();
+            for (auto it = data.buffers_.begin(); it != data.buffers_.end();
+                 ++it)
+            {
+                if (it->capacity() >= capacity &&
+                    (best == data.buffers_.end() ||
+                        it->capacity() < best->capacity()))
+                {
+                    best = it;
+                }
+            }
+
+            if (best != data.buffers_.end())
+            {
+                buffer_type reused = HPX_MOVE(*best);
+                if (best != data.buffers_.end() - 1)
+                {
+                    *best = HPX_MOVE(data.buffers_.back());
+                }
+                data.buffers_.pop_back();
+                l.unlock();
+
+                buffer = HPX_MOVE(reused);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        buffer.reserve(capacity);
+    }
+
+    void send_buffer_pool::release(buffer_type&& buffer) noexcept
+    {
+        if (max_buffers_per_thread_ == 0 || buffer.capacity() == 0 ||
+            buffer.capacity() > max_buffer_size_)
+        {
+            return;
+        }
+
+        buffer.clear();
+
+        thread_pool_data& data = get_thread_data();
+
+        // an evicted buffer is released after the lock has been released
+        buffer_type evicted;
+
+        std::lock_guard<mutex_type> l(data.mtx_);
+        try
+        {
+            if (data.buffers_.size() < max_buffers_per_thread_)
+            {
+                data.buffers_.push_back(HPX_MOVE(buffer));
+                return;
+            }
+        }
+        catch (...)
+        {
+            // the buffer is released to the allocator
+            return;
+        }
+
+        // replace the smallest buffer if the new one is larger
+        auto smallest = data.buffers_.begin();
+        for (auto it = data.buffers_.begin(); it != data.buffers_.end(); ++it)
+        {
+            if (it->capacity() < smallest->capacity())
+            {
+                smallest = it;
+            }
+        }
+        if (smallest != data.buffers_.end() &&
+            smallest->capacity() < buffer.capacity())
+        {
+            evicted = HPX_MOVE(*smallest);
+            *smallest = HPX_MOVE(buffer);
+        }
+    }
+
+    std::int64_t send_buffer_pool::hits(bool reset) noexcept
+    {
+        return reset ? hits_.exchange(0, std::memory_order_relaxed) :
+                       hits_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t send_buffer_pool::misses(bool reset) noexcept
+    {
+        return reset ? misses_.exchange(0, std::memory_order_relaxed) :
+                       misses_.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
@@ -136,6 +136,20 @@ namespace hpx::parcelset {
         return data_->get_thread_stacksize();
     }
 
+    bool parcel::has_high_priority() const
+    {
+        switch (get_thread_priority())
+        {
+        case threads::thread_priority::high_recursive:
+        case threads::thread_priority::boost:
+        case threads::thread_priority::high:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
     std::uint32_t parcel::get_parent_locality_id() const
     {
         return data_->get_parent_locality_id();
@@ -223,6 +237,17 @@ namespace hpx::parcelset {
         return data_->parcel_id();
     }
 
+    std::uint64_t parcel::trace_stamp(parcel_trace_stage stage) const
+    {
+        return data_->trace_stamp(stage);
+    }
+
+    void parcel::set_trace_stamp(
+        parcel_trace_stage stage, std::uint64_t time) const
+    {
+        data_->set_trace_stamp(stage, time);
+    }
+
     // generate unique parcel id
     naming::gid_type parcel::generate_unique_id(std::uint32_t locality_id)
     {
@@ -15,6 +15,8 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/threadmanager.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/util.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/modules/threading_base.hpp>
@@ -45,10 +47,32 @@ namespace hpx::parcelset {
       , allow_zero_copy_optimizations_(true)
       , allow_zero_copy_receive_optimizations_(true)
       , async_serialization_(false)
+      , trusted_peers_(false)
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , streaming_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".streaming_threshold", 0))
+      , streaming_chunk_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".streaming_chunk_size", 1048576))
+      , parallel_decode_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".parallel_decode_threshold", 0))
+      , inline_direct_actions_(false)
+      , allow_device_memory_(false)
+      , backpressure_threshold_(hpx::util::get_entry_as<std::int64_t>(
+            ini, "hpx.parcel." + type + ".backpressure_threshold", 0))
+      , backpressure_delay_(hpx::util::get_entry_as<std::int64_t>(
+            ini, "hpx.parcel." + type + ".backpressure_delay", 100))
+      , receive_throttled_count_(0)
+      , backpressure_next_check_(0)
+      , backpressure_active_(false)
+      , send_buffer_pool_(ini.get_os_thread_count(),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel." + type + ".send_buffer_pool_size", 4),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel." + type + ".send_buffer_pool_max_buffer_size",
+                4194304))
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -77,6 +101,22 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".trusted_peers", 0) != 0)
+        {
+            trusted_peers_ = true;
+        }
+
+        if (hpx::util::get_entry_as<int>(
+                ini, key + ".inline_direct_actions", 0) != 0)
+        {
+            inline_direct_actions_ = true;
+        }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".device_memory", 0) != 0)
+        {
+            allow_device_memory_ = true;
+        }
     }
 
     int parcelport::priority() const noexcept
@@ -95,6 +135,34 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    void parcelport::get_send_buffer(
+        std::vector<char>& buffer, std::size_t capacity)
+    {
+        send_buffer_pool_.get(buffer, capacity);
+    }
+
+    void parcelport::release_send_buffer(std::vector<char>&& buffer) noexcept
+    {
+        send_buffer_pool_.release(HPX_MOVE(buffer));
+    }
+
+    std::int64_t parcelport::get_send_buffer_pool_statistics(
+        send_buffer_pool_statistics_type t, bool reset) noexcept
+    {
+        switch (t)
+        {
+        case send_buffer_pool_hits:
+            return send_buffer_pool_.hits(reset);
+
+        case send_buffer_pool_misses:
+            return send_buffer_pool_.misses(reset);
+
+        default:
+            break;
+        }
+        return 0;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
@@ -381,6 +449,88 @@ namespace hpx::parcelset {
         return async_serialization_;
     }
 
+    bool parcelport::trusted_peers() const noexcept
+    {
+        return trusted_peers_;
+    }
+
+    std::size_t parcelport::get_streaming_threshold() const noexcept
+    {
+        return streaming_threshold_;
+    }
+
+    std::size_t parcelport::get_streaming_chunk_size() const noexcept
+    {
+        return streaming_chunk_size_ != 0 ? streaming_chunk_size_ : 1048576;
+    }
+
+    std::size_t parcelport::get_parallel_decode_threshold() const noexcept
+    {
+        return parallel_decode_threshold_;
+    }
+
+    bool parcelport::inline_direct_actions() const noexcept
+    {
+        return inline_direct_actions_;
+    }
+
+    bool parcelport::allow_device_memory() const noexcept
+    {
+        return allow_device_memory_;
+    }
+
+    bool parcelport::receive_backpressure() noexcept
+    {
+        if (backpressure_threshold_ <= 0)
+        {
+            return false;
+        }
+
+        // never hold back messages during startup or shutdown
+        if (!threads::threadmanager_is(hpx::state::running))
+        {
+            return false;
+        }
+
+        // the queue lengths are sampled at most once per delay, the
+        // parcelports may ask for every message or while polling
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        if (now < backpressure_next_check_.load(std::memory_order_relaxed))
+        {
+            return backpressure_active_.load(std::memory_order_relaxed);
+        }
+        backpressure_next_check_.store(
+            now + static_cast<std::uint64_t>(backpressure_delay_) * 1000,
+            std::memory_order_relaxed);
+
+        bool const active =
+            threads::get_thread_manager().get_queue_length(false) >
+            backpressure_threshold_;
+        backpressure_active_.store(active, std::memory_order_relaxed);
+
+        if (active)
+        {
+            receive_throttled_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return active;
+    }
+
+    std::int64_t parcelport::get_backpressure_threshold() const noexcept
+    {
+        return backpressure_threshold_;
+    }
+
+    std::int64_t parcelport::get_backpressure_delay() const noexcept
+    {
+        return backpressure_delay_;
+    }
+
+    std::int64_t parcelport::get_receive_throttled_count(bool reset) noexcept
+    {
+        return reset ? receive_throttled_count_.exchange(0) :
+                       receive_throttled_count_.load();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the code below is needed to bootstrap the parcel layer
     void parcelport::early_pending_parcel_handler(
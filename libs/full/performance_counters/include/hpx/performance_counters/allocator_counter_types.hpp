@@ -0,0 +1,17 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+namespace hpx::performance_counters {
+
+    /// Install performance counter types exposing the statistics of the
+    /// NUMA-aware caching allocator (see
+    /// hpx::util::get_numa_caching_allocator_statistics).
+    HPX_EXPORT void register_allocator_counter_types();
+}    // namespace hpx::performance_counters
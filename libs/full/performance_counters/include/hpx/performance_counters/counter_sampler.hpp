@@ -0,0 +1,138 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/performance_counters/performance_counter_base.hpp>
+#include <hpx/performance_counters/performance_counter_set.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace performance_counters {
+
+    /// Periodically take snapshots of a set of local performance counters
+    /// and store them in a ring buffer for later export.
+    ///
+    /// The counters are queried by directly calling into the local counter
+    /// instances, no actions are invoked and no memory is allocated while
+    /// sampling. Every snapshot consists of the time stamp followed by the
+    /// raw (unscaled) value of each counter. Taking snapshots and draining
+    /// them never block each other. If the buffer is full, new snapshots are
+    /// dropped and counted.
+    class HPX_EXPORT counter_sampler
+    {
+        // avoid warning about using this in member initializer list
+        counter_sampler* this_()
+        {
+            return this;
+        }
+
+    public:
+        /// Create a sampler for the given counters (possibly containing
+        /// wild-card characters), taking a snapshot every \a interval
+        /// microseconds. The ring buffer holds up to \a capacity snapshots.
+        /// Only counters located on this locality are sampled.
+        counter_sampler(std::vector<std::string> const& names,
+            std::int64_t interval, std::size_t capacity = 4096);
+        ~counter_sampler();
+
+        counter_sampler(counter_sampler const&) = delete;
+        counter_sampler& operator=(counter_sampler const&) = delete;
+
+        /// Start/stop taking snapshots periodically
+        void start();
+        void stop();
+
+        /// Take one snapshot right away, returns false if the snapshot was
+        /// dropped because the buffer was full
+        bool sample();
+
+        /// Return the descriptions of the sampled counters, in the order
+        /// their values are stored in a snapshot
+        std::vector<counter_info> get_counter_infos() const;
+
+        /// Return the scaling of the sampled counters, the values stored in
+        /// a snapshot have to be scaled accordingly (see
+        /// counter_value::get_value)
+        std::vector<counter_value> const& get_counter_scaling() const noexcept
+        {
+            return scaling_;
+        }
+
+        std::size_t num_counters() const noexcept
+        {
+            return counters_.size();
+        }
+
+        /// Return the number of int64 values making up a snapshot
+        std::size_t snapshot_size() const noexcept
+        {
+            return counters_.size() + 1;
+        }
+
+        /// Return the number of snapshots currently held in the buffer
+        std::size_t size() const noexcept;
+
+        /// Return the number of snapshots dropped because the buffer was full
+        std::size_t dropped() const noexcept
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+        /// Append all buffered snapshots to \a data, returns the number of
+        /// snapshots appended
+        std::size_t drain(std::vector<std::int64_t>& data);
+
+        /// Asynchronously drain the buffer and write all snapshots to the
+        /// given binary stream. The first export of a sampler is preceded by
+        /// the header describing the counters. The stream has to stay valid
+        /// until the returned future has become ready, which holds the
+        /// number of exported snapshots.
+        hpx::future<std::size_t> export_samples(std::ostream& os);
+
+        /// Write the header describing the sampled counters to the given
+        /// stream
+        void write_header(std::ostream& os) const;
+
+    private:
+        bool evaluate();
+        std::size_t drain_locked(std::vector<std::int64_t>& data);
+
+        performance_counter_set set_;
+        std::vector<performance_counter_base*> counters_;
+        std::vector<counter_value> scaling_;
+
+        // the ring buffer, head_ and tail_ count the snapshots ever written
+        // and read
+        std::size_t capacity_;
+        std::vector<std::int64_t> buffer_;
+        std::atomic<std::size_t> head_;
+        std::atomic<std::size_t> tail_;
+        std::atomic<std::size_t> dropped_;
+
+        // serialize the producers and the consumers, respectively
+        hpx::spinlock producer_mtx_;
+        hpx::spinlock consumer_mtx_;
+        bool header_written_;
+
+        hpx::util::interval_timer timer_;
+    };
+}}    // namespace hpx::performance_counters
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,74 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::performance_counters::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return whether the given name matches the given wildcard pattern. The
+    /// pattern uses the same syntax as util::regex_from_pattern ('*', '?',
+    /// '[...]', '[!...]', and '\\' escapes) and has to be valid.
+    HPX_EXPORT bool matches_pattern(
+        std::string_view pattern, std::string_view name) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An index of the registered counter type names (e.g.
+    /// /threads/count/cumulative), stored as a trie over their path
+    /// components. Resolving a wildcard type name descends the trie along
+    /// the components (and the component prefix) before the first wildcard
+    /// and matches only the type names below that node. The matches of the
+    /// most recently used patterns are cached until the set of types
+    /// changes.
+    class HPX_EXPORT counter_type_index
+    {
+    private:
+        struct node
+        {
+            std::map<std::string, node, std::less<>> children_;
+            bool is_type_ = false;
+        };
+
+    public:
+        // the maximal number of cached patterns
+        static constexpr std::size_t max_cached_patterns = 64;
+
+        counter_type_index() = default;
+
+        void insert(std::string const& type_name);
+        void erase(std::string const& type_name);
+        void clear();
+
+        /// Return the (sorted) names of all types matching the given
+        /// pattern
+        std::vector<std::string> match(
+            std::string const& pattern, error_code& ec = throws) const;
+
+    private:
+        std::vector<std::string> match_locked(std::string const& pattern) const;
+
+        node root_;
+
+        mutable hpx::spinlock mtx_;
+        mutable std::map<std::string, std::vector<std::string>, std::less<>>
+            cache_;
+    };
+}    // namespace hpx::performance_counters::detail
+
+#include <hpx/config/warnings_suffix.hpp>
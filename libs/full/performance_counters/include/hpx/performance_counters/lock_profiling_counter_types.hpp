@@ -0,0 +1,20 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_PROFILING)
+
+namespace hpx::performance_counters {
+
+    /// Install performance counter types exposing the statistics collected
+    /// by the lock profiler (see hpx::util::get_lock_profile_totals).
+    HPX_EXPORT void register_lock_profiling_counter_types();
+}    // namespace hpx::performance_counters
+
+#endif
@@ -25,6 +25,17 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters {
+
+    /// The reduction operations supported by
+    /// performance_counter_set::reduce_counter_values
+    enum class counter_reduction : std::uint8_t
+    {
+        sum = 0,
+        min = 1,
+        max = 2,
+        average = 3
+    };
+
     // Make a collection of performance counters available as a set
     class HPX_EXPORT performance_counter_set
     {
@@ -55,6 +66,9 @@ namespace hpx { namespace performance_counters {
         /// Retrieve the counter infos for all counters in this set
         std::vector<counter_info> get_counter_infos() const;
 
+        /// Retrieve the ids of all counters in this set
+        std::vector<hpx::id_type> get_counter_ids() const;
+
         /// Retrieve the values for all counters in this set supporting
         /// this operation
         std::vector<hpx::future<counter_value>> get_counter_values(
@@ -62,6 +76,27 @@ namespace hpx { namespace performance_counters {
         std::vector<counter_value> get_counter_values(launch::sync_policy,
             bool reset = false, error_code& ec = throws) const;
 
+        /// Retrieve the values for all counters in this set supporting
+        /// this operation (in the same order as get_counter_values), sending
+        /// a single request to every locality holding some of the counters
+        hpx::future<std::vector<counter_value>> get_counter_values_batched(
+            bool reset = false) const;
+        std::vector<counter_value> get_counter_values_batched(
+            launch::sync_policy, bool reset = false,
+            error_code& ec = throws) const;
+
+        /// Reduce the values of all counters in this set supporting
+        /// get_counter_values into a single value. The localities holding
+        /// the counters reduce their own values and forward the request
+        /// along a tree, only one value is returned to the caller. Invalid
+        /// values are skipped, the result is invalid if no valid values
+        /// were found. All reduced counters must use the same scaling.
+        hpx::future<counter_value> reduce_counter_values(
+            counter_reduction op, bool reset = false) const;
+        counter_value reduce_counter_values(launch::sync_policy,
+            counter_reduction op, bool reset = false,
+            error_code& ec = throws) const;
+
         /// Retrieve the array-values for all counters in this set supporting
         /// this operation
         std::vector<hpx::future<counter_values_array>> get_counter_values_array(
@@ -109,6 +144,12 @@ namespace hpx { namespace performance_counters {
         std::size_t get_invocation_count() const;
 
     protected:
+        // Group the counters supporting get_counter_values by the locality
+        // they live on
+        void get_counter_groups(std::vector<std::vector<hpx::id_type>>& ids,
+            std::vector<std::vector<std::uint8_t>>& resets,
+            std::vector<std::vector<std::size_t>>* indices, bool reset) const;
+
         bool find_counter(counter_info const& info, bool reset, error_code& ec);
 
         template <typename T>
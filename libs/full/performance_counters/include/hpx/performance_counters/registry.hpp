@@ -10,6 +10,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/detail/counter_type_index.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -167,6 +168,7 @@ namespace hpx { namespace performance_counters {
 
     private:
         counter_type_map_type countertypes_;
+        detail::counter_type_index type_index_;
 
     public:
         static registry& instance();
@@ -10,10 +10,10 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/performance_counters/action_invocation_counter_discoverer.hpp>
 #include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/detail/counter_type_index.hpp>
 #include <hpx/performance_counters/registry.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
-#include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -74,16 +74,17 @@ namespace hpx { namespace performance_counters {
 
         if (p.parameters_.find_first_of("*?[]") != std::string::npos)
         {
-            std::string str_rx(util::regex_from_pattern(p.parameters_, ec));
+            // validate the pattern
+            util::regex_from_pattern(p.parameters_, ec);
             if (ec)
                 return false;
 
             bool found_one = false;
-            std::regex rx(str_rx);
 
             for (auto const& e : map)
             {
-                if (!std::regex_match(e.first, rx))
+                if (!performance_counters::detail::matches_pattern(
+                        p.parameters_, e.first))
                     continue;
                 found_one = true;
 
@@ -65,6 +65,13 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> refcnt_requests(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_requests, &client));
+        hpx::function<std::int64_t(bool)> refcnt_messages_saved(
+            hpx::bind_front(
+                &agas::addressing_service::get_refcnt_messages_saved,
+                &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +203,26 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of incref and decref requests issued "
+                    "by this locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_requests, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/messages_saved",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of incref and decref requests which "
+                    "did not require a separate message to AGAS",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_messages_saved, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -0,0 +1,197 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/memory_statistics.hpp>
+#include <hpx/allocator_support/numa_caching_allocator.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/allocator_counter_types.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::detail {
+
+    // The allocator statistics are shared by all counters, resetting a
+    // counter resets only the value reported by that counter.
+    struct allocator_counter_baseline
+    {
+        std::mutex mtx;
+        util::numa_caching_allocator_statistics stats;
+    };
+
+    naming::gid_type allocator_counter_creator(
+        std::uint64_t util::numa_caching_allocator_statistics::*which,
+        counter_info const& info, error_code& ec)
+    {
+        auto baseline = std::make_shared<allocator_counter_baseline>();
+        hpx::function<std::int64_t(bool)> f = [which, baseline](bool reset) {
+            auto const stats = util::get_numa_caching_allocator_statistics();
+
+            std::lock_guard<std::mutex> l(baseline->mtx);
+            std::uint64_t const result =
+                stats.*which - baseline->stats.*which;
+            if (reset)
+            {
+                baseline->stats = stats;
+            }
+            return static_cast<std::int64_t>(result);
+        };
+        return locality_raw_counter_creator(info, f, ec);
+    }
+
+    // the ratio of allocations served from the caches (in 0.01%)
+    naming::gid_type allocator_hit_ratio_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        auto baseline = std::make_shared<allocator_counter_baseline>();
+        hpx::function<std::int64_t(bool)> f = [baseline](bool reset) {
+            auto const stats = util::get_numa_caching_allocator_statistics();
+
+            std::lock_guard<std::mutex> l(baseline->mtx);
+            std::uint64_t const hits = stats.hits - baseline->stats.hits;
+            std::uint64_t const misses = stats.misses - baseline->stats.misses;
+            if (reset)
+            {
+                baseline->stats = stats;
+            }
+
+            if (hits + misses == 0)
+            {
+                return std::int64_t(0);
+            }
+            return static_cast<std::int64_t>(
+                (10000 * hits) / (hits + misses));
+        };
+        return locality_raw_counter_creator(info, f, ec);
+    }
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+    // the number of bytes currently allocated for a memory category
+    naming::gid_type memory_category_counter_creator(
+        util::memory_category category, counter_info const& info,
+        error_code& ec)
+    {
+        hpx::function<std::int64_t(bool)> f = [category](bool) {
+            return util::get_memory_statistics(category).bytes;
+        };
+        return locality_raw_counter_creator(info, f, ec);
+    }
+
+    // the number of allocations performed for a memory category
+    naming::gid_type memory_category_allocations_counter_creator(
+        util::memory_category category, counter_info const& info,
+        error_code& ec)
+    {
+        auto baseline = std::make_shared<std::atomic<std::uint64_t>>(0);
+        hpx::function<std::int64_t(bool)> f = [category, baseline](
+                                                  bool reset) {
+            std::uint64_t const allocations =
+                util::get_memory_statistics(category).allocations;
+            std::uint64_t const result = allocations -
+                (reset ? baseline->exchange(allocations) : baseline->load());
+            return static_cast<std::int64_t>(result);
+        };
+        return locality_raw_counter_creator(info, f, ec);
+    }
+#endif
+}    // namespace hpx::performance_counters::detail
+
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_allocator_counter_types()
+    {
+        using statistics = util::numa_caching_allocator_statistics;
+
+        generic_counter_type_data const counter_types[] = {
+            {"/allocator/count/cache-hits",
+                counter_type::monotonically_increasing,
+                "returns the number of allocations served from the caches of "
+                "the NUMA-aware caching allocator",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::allocator_counter_creator,
+                    &statistics::hits),
+                &locality_counter_discoverer, ""},
+            {"/allocator/count/cache-misses",
+                counter_type::monotonically_increasing,
+                "returns the number of allocations the NUMA-aware caching "
+                "allocator forwarded to the underlying allocator",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::allocator_counter_creator,
+                    &statistics::misses),
+                &locality_counter_discoverer, ""},
+            {"/allocator/count/remote-frees",
+                counter_type::monotonically_increasing,
+                "returns the number of blocks of the NUMA-aware caching "
+                "allocator which were deallocated on a different NUMA domain "
+                "and returned to their owning domain",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::allocator_counter_creator,
+                    &statistics::remote_frees),
+                &locality_counter_discoverer, ""},
+            {"/allocator/count/reclaimed",
+                counter_type::monotonically_increasing,
+                "returns the number of remotely deallocated blocks of the "
+                "NUMA-aware caching allocator which were taken back by their "
+                "owning NUMA domain",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::allocator_counter_creator,
+                    &statistics::reclaimed),
+                &locality_counter_discoverer, ""},
+            {"/allocator/cache-hit-ratio", counter_type::raw,
+                "returns the ratio of allocations served from the caches of "
+                "the NUMA-aware caching allocator",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &detail::allocator_hit_ratio_counter_creator,
+                &locality_counter_discoverer, "0.01%"},
+        };
+
+        install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_MEMORY_STATISTICS)
+        // the memory attributed to the HPX subsystems
+        for (std::size_t i = 0; i != util::num_memory_categories; ++i)
+        {
+            auto const category = static_cast<util::memory_category>(i);
+            std::string const name = util::get_memory_category_name(category);
+
+            generic_counter_type_data const memory_counter_types[] = {
+                {"/allocator/memory/" + name, counter_type::raw,
+                    "returns the number of bytes currently allocated for " +
+                        name,
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind_front(
+                        &detail::memory_category_counter_creator, category),
+                    &locality_counter_discoverer, "bytes"},
+                {"/allocator/count/" + name + "-allocations",
+                    counter_type::monotonically_increasing,
+                    "returns the number of allocations performed for " + name,
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind_front(
+                        &detail::memory_category_allocations_counter_creator,
+                        category),
+                    &locality_counter_discoverer, ""},
+            };
+
+            install_counter_types(memory_counter_types,
+                sizeof(memory_counter_types) /
+                    sizeof(memory_counter_types[0]));
+        }
+#endif
+    }
+}    // namespace hpx::performance_counters
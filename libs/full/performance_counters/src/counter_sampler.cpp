@@ -0,0 +1,223 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/get_lva.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_sampler.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace performance_counters {
+
+    namespace {
+
+        constexpr std::uint64_t counter_sampler_magic = 0x31504d5358505848;
+
+        template <typename T>
+        void write_binary(std::ostream& os, T const& value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    counter_sampler::counter_sampler(std::vector<std::string> const& names,
+        std::int64_t interval, std::size_t capacity)
+      : set_(true)
+      , capacity_(capacity)
+      , head_(0)
+      , tail_(0)
+      , dropped_(0)
+      , header_written_(false)
+      , timer_(hpx::bind_front(&counter_sampler::evaluate, this_()), interval,
+            "counter_sampler", true)
+    {
+        if (capacity_ == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "counter_sampler::counter_sampler",
+                "the capacity of the sample buffer must be non-zero");
+        }
+
+        std::vector<std::string> counter_names(names);
+        for (std::string& name : counter_names)
+        {
+            ensure_counter_prefix(name);
+        }
+        set_.add_counters(counter_names);
+
+        // resolve the counter instances once, sampling calls into them
+        // directly
+        naming::gid_type const here = agas::get_locality();
+        for (hpx::id_type const& id : set_.get_counter_ids())
+        {
+            naming::address const addr = agas::resolve(launch::sync, id);
+            if (addr.locality_ != here)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "counter_sampler::counter_sampler",
+                    "only local performance counters can be sampled");
+            }
+            counters_.push_back(
+                get_lva<server::base_performance_counter>::call(
+                    addr.address_));
+        }
+
+        buffer_.resize(capacity_ * snapshot_size());
+
+        // the scaling of the values is recorded in the header
+        scaling_.reserve(counters_.size());
+        for (performance_counter_base* counter : counters_)
+        {
+            scaling_.push_back(counter->get_counter_value(false));
+        }
+    }
+
+    counter_sampler::~counter_sampler()
+    {
+        timer_.stop(true);
+        set_.release();
+    }
+
+    void counter_sampler::start()
+    {
+        set_.start(launch::sync);
+        timer_.start();
+    }
+
+    void counter_sampler::stop()
+    {
+        timer_.stop();
+        set_.stop(launch::sync);
+    }
+
+    bool counter_sampler::evaluate()
+    {
+        sample();
+        return true;
+    }
+
+    std::vector<counter_info> counter_sampler::get_counter_infos() const
+    {
+        return set_.get_counter_infos();
+    }
+
+    std::size_t counter_sampler::size() const noexcept
+    {
+        return head_.load(std::memory_order_acquire) -
+            tail_.load(std::memory_order_acquire);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool counter_sampler::sample()
+    {
+        std::lock_guard<hpx::spinlock> l(producer_mtx_);
+
+        std::size_t const head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == capacity_)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        std::int64_t* snapshot =
+            buffer_.data() + (head % capacity_) * snapshot_size();
+
+        *snapshot++ = static_cast<std::int64_t>(
+            hpx::chrono::high_resolution_clock::now());
+        for (performance_counter_base* counter : counters_)
+        {
+            *snapshot++ = counter->get_counter_value(false).value_;
+        }
+
+        // publish the snapshot
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t counter_sampler::drain(std::vector<std::int64_t>& data)
+    {
+        std::lock_guard<hpx::spinlock> l(consumer_mtx_);
+        return drain_locked(data);
+    }
+
+    std::size_t counter_sampler::drain_locked(std::vector<std::int64_t>& data)
+    {
+        std::size_t const tail = tail_.load(std::memory_order_relaxed);
+        std::size_t const head = head_.load(std::memory_order_acquire);
+
+        std::size_t const size = snapshot_size();
+        data.reserve(data.size() + (head - tail) * size);
+        for (std::size_t i = tail; i != head; ++i)
+        {
+            std::int64_t const* snapshot =
+                buffer_.data() + (i % capacity_) * size;
+            data.insert(data.end(), snapshot, snapshot + size);
+        }
+
+        // release the slots to the producer
+        tail_.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void counter_sampler::write_header(std::ostream& os) const
+    {
+        std::vector<counter_info> const infos = set_.get_counter_infos();
+        HPX_ASSERT(infos.size() == scaling_.size());
+
+        write_binary(os, counter_sampler_magic);
+        write_binary(os, static_cast<std::uint64_t>(infos.size()));
+        for (std::size_t i = 0; i != infos.size(); ++i)
+        {
+            std::string const& name = infos[i].fullname_;
+            write_binary(os, static_cast<std::uint64_t>(name.size()));
+            os.write(name.data(), static_cast<std::streamsize>(name.size()));
+
+            write_binary(os, scaling_[i].scaling_);
+            write_binary(
+                os, static_cast<std::uint8_t>(scaling_[i].scale_inverse_));
+        }
+    }
+
+    hpx::future<std::size_t> counter_sampler::export_samples(std::ostream& os)
+    {
+        return hpx::async([this, &os]() -> std::size_t {
+            std::lock_guard<hpx::spinlock> l(consumer_mtx_);
+
+            std::vector<std::int64_t> data;
+            std::size_t const count = drain_locked(data);
+
+            if (!header_written_)
+            {
+                write_header(os);
+                header_written_ = true;
+            }
+
+            // snapshots are written as a block preceded by their count
+            write_binary(os, static_cast<std::uint64_t>(count));
+            os.write(reinterpret_cast<char const*>(data.data()),
+                static_cast<std::streamsize>(
+                    data.size() * sizeof(std::int64_t)));
+            return count;
+        });
+    }
+}}    // namespace hpx::performance_counters
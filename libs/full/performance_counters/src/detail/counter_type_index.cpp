@@ -0,0 +1,301 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/detail/counter_type_index.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hpx::performance_counters::detail {
+
+    namespace {
+
+        constexpr std::size_t npos = std::string_view::npos;
+
+        // Match the pattern element (a character, '?', an escaped character,
+        // or a character set) starting at pattern[pi] against the character
+        // c. Returns the position of the next element or npos if the element
+        // does not match.
+        std::size_t match_element(
+            std::string_view pattern, std::size_t pi, char c) noexcept
+        {
+            std::size_t const size = pattern.size();
+            switch (pattern[pi])
+            {
+            case '?':
+                return pi + 1;
+
+            case '\\':
+                return (pi + 1 != size && pattern[pi + 1] == c) ? pi + 2 :
+                                                                  npos;
+
+            case '[':
+            {
+                std::size_t i = pi + 1;
+                bool const negate = i != size && pattern[i] == '!';
+                if (negate)
+                    ++i;
+
+                bool found = false;
+                bool first = !negate;
+                while (i != size && (first || pattern[i] != ']'))
+                {
+                    first = false;
+
+                    char lower = pattern[i];
+                    if (lower == '\\' && i + 1 != size)
+                        lower = pattern[++i];
+
+                    char upper = lower;
+                    if (i + 2 < size && pattern[i + 1] == '-' &&
+                        pattern[i + 2] != ']')
+                    {
+                        i += 2;
+                        upper = pattern[i];
+                        if (upper == '\\' && i + 1 != size)
+                            upper = pattern[++i];
+                    }
+
+                    if (lower <= c && c <= upper)
+                        found = true;
+                    ++i;
+                }
+
+                if (i == size || found == negate)
+                    return npos;
+                return i + 1;    // skip ']'
+            }
+
+            default:
+                return pattern[pi] == c ? pi + 1 : npos;
+            }
+        }
+
+        // split the given name at the '/' separators
+        std::vector<std::string_view> split_components(std::string_view name)
+        {
+            std::vector<std::string_view> result;
+            std::size_t start = 0;
+            for (std::size_t pos = name.find('/'); pos != npos;
+                 pos = name.find('/', start))
+            {
+                result.push_back(name.substr(start, pos - start));
+                start = pos + 1;
+            }
+            result.push_back(name.substr(start));
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool matches_pattern(
+        std::string_view pattern, std::string_view name) noexcept
+    {
+        std::size_t const pattern_size = pattern.size();
+        std::size_t pi = 0;
+        std::size_t ni = 0;
+
+        // the position after the last '*' seen and the position in the name
+        // it currently is assumed to match up to
+        std::size_t star_pi = npos;
+        std::size_t star_ni = 0;
+
+        while (ni != name.size())
+        {
+            if (pi != pattern_size && pattern[pi] == '*')
+            {
+                star_pi = ++pi;
+                star_ni = ni;
+                continue;
+            }
+
+            if (pi != pattern_size)
+            {
+                if (std::size_t const next =
+                        match_element(pattern, pi, name[ni]);
+                    next != npos)
+                {
+                    pi = next;
+                    ++ni;
+                    continue;
+                }
+            }
+
+            // let the last '*' match one more character
+            if (star_pi == npos)
+                return false;
+
+            pi = star_pi;
+            ni = ++star_ni;
+        }
+
+        while (pi != pattern_size && pattern[pi] == '*')
+            ++pi;
+
+        return pi == pattern_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void counter_type_index::insert(std::string const& type_name)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+
+        node* current = &root_;
+        for (std::string_view const component : split_components(type_name))
+        {
+            auto it = current->children_.find(component);
+            if (it == current->children_.end())
+            {
+                it = current->children_
+                         .emplace(std::string(component), node())
+                         .first;
+            }
+            current = &it->second;
+        }
+        current->is_type_ = true;
+
+        cache_.clear();
+    }
+
+    void counter_type_index::erase(std::string const& type_name)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+
+        std::vector<std::string_view> const components =
+            split_components(type_name);
+
+        // remember the path to be able to remove the nodes which became
+        // empty
+        std::vector<std::pair<node*, node*>> path;
+        path.reserve(components.size());
+
+        node* current = &root_;
+        for (std::string_view const component : components)
+        {
+            auto const it = current->children_.find(component);
+            if (it == current->children_.end())
+                return;
+
+            path.emplace_back(current, &it->second);
+            current = &it->second;
+        }
+        current->is_type_ = false;
+
+        for (std::size_t i = path.size(); i != 0; --i)
+        {
+            auto [parent, child] = path[i - 1];
+            if (child->is_type_ || !child->children_.empty())
+                break;
+            parent->children_.erase(parent->children_.find(components[i - 1]));
+        }
+
+        cache_.clear();
+    }
+
+    void counter_type_index::clear()
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+
+        root_.children_.clear();
+        root_.is_type_ = false;
+        cache_.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> counter_type_index::match(
+        std::string const& pattern, error_code& ec) const
+    {
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+            if (auto const it = cache_.find(pattern); it != cache_.end())
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return it->second;
+            }
+        }
+
+        // report invalid patterns the same way as before
+        util::regex_from_pattern(pattern, ec);
+        if (ec)
+            return {};
+
+        std::lock_guard<hpx::spinlock> l(mtx_);
+
+        std::vector<std::string> result = match_locked(pattern);
+        if (cache_.size() >= max_cached_patterns)
+            cache_.clear();
+        cache_.emplace(pattern, result);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+        return result;
+    }
+
+    std::vector<std::string> counter_type_index::match_locked(
+        std::string const& pattern) const
+    {
+        std::vector<std::string> result;
+
+        // the literal part of the pattern selects the node to start from
+        std::size_t const wildcard = pattern.find_first_of("*?[\\");
+        std::string_view const literal =
+            std::string_view(pattern).substr(0, wildcard);
+        std::size_t const last_separator = literal.rfind('/');
+
+        node const* current = &root_;
+        std::string prefix;
+        std::string_view partial = literal;
+        if (last_separator != npos)
+        {
+            for (std::string_view const component :
+                split_components(literal.substr(0, last_separator)))
+            {
+                auto const it = current->children_.find(component);
+                if (it == current->children_.end())
+                    return result;
+                current = &it->second;
+            }
+            prefix = std::string(literal.substr(0, last_separator + 1));
+            partial = literal.substr(last_separator + 1);
+        }
+
+        // collect the matching types of the sub-tree
+        auto const collect = [&](auto const& self, node const& n,
+                                 std::string const& name) -> void {
+            if (n.is_type_ && matches_pattern(pattern, name))
+                result.push_back(name);
+
+            for (auto const& child : n.children_)
+            {
+                self(self, child.second, name + "/" + child.first);
+            }
+        };
+
+        // only the components starting with the literal part of the
+        // current component can match
+        for (auto it = current->children_.lower_bound(partial);
+             it != current->children_.end() &&
+             std::string_view(it->first).substr(0, partial.size()) == partial;
+             ++it)
+        {
+            if (wildcard == npos && it->first.size() != partial.size())
+                break;
+            collect(collect, it->second, prefix + it->first);
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}    // namespace hpx::performance_counters::detail
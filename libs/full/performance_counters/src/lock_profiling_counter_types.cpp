@@ -0,0 +1,82 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_PROFILING)
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/lock_registration/lock_profiling.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/lock_profiling_counter_types.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::detail {
+
+    // The lock profile is shared with the report printed at shutdown,
+    // resetting a counter resets only the value reported by that counter.
+    naming::gid_type lock_profiling_counter_creator(
+        std::uint64_t util::lock_profile::*which, counter_info const& info,
+        error_code& ec)
+    {
+        auto baseline = std::make_shared<std::atomic<std::uint64_t>>(0);
+        hpx::function<std::int64_t(bool)> f = [which, baseline](bool reset) {
+            std::uint64_t const value = util::get_lock_profile_totals().*which;
+            std::uint64_t const result = value - baseline->load();
+            if (reset)
+            {
+                baseline->store(value);
+            }
+            return static_cast<std::int64_t>(result);
+        };
+        return locality_raw_counter_creator(info, f, ec);
+    }
+}    // namespace hpx::performance_counters::detail
+
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_lock_profiling_counter_types()
+    {
+        generic_counter_type_data const counter_types[] = {
+            {"/locks/count/acquisitions",
+                counter_type::monotonically_increasing,
+                "returns the number of lock acquisitions recorded by the lock "
+                "profiler",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_profiling_counter_creator,
+                    &util::lock_profile::acquisitions),
+                &locality_counter_discoverer, ""},
+            {"/locks/count/contentions",
+                counter_type::monotonically_increasing,
+                "returns the number of lock acquisitions recorded by the lock "
+                "profiler which had to wait for the lock",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_profiling_counter_creator,
+                    &util::lock_profile::contentions),
+                &locality_counter_discoverer, ""},
+            {"/locks/time/wait", counter_type::monotonically_increasing,
+                "returns the overall time spent waiting for locks recorded "
+                "by the lock profiler",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_profiling_counter_creator,
+                    &util::lock_profile::wait_time),
+                &locality_counter_discoverer, "ns"},
+        };
+
+        install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+    }
+}    // namespace hpx::performance_counters
+
+#endif
@@ -9,14 +9,17 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace hpx::performance_counters {
 
@@ -518,6 +521,12 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> cache_reclaims(
             hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
                 &ph, pp_type, parcelport::connection_cache_reclaims));
+        hpx::function<std::int64_t(bool)> send_buffer_hits(
+            hpx::bind_front(&parcelhandler::get_send_buffer_pool_statistics,
+                &ph, pp_type, parcelport::send_buffer_pool_hits));
+        hpx::function<std::int64_t(bool)> send_buffer_misses(
+            hpx::bind_front(&parcelhandler::get_send_buffer_pool_statistics,
+                &ph, pp_type, parcelport::send_buffer_pool_misses));
 
         performance_counters::generic_counter_type_data const
             connection_cache_types[] = {
@@ -584,12 +593,128 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(cache_reclaims), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/send-buffer-hits", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of serialization buffers reused "
+                        "from the send buffer pool for the {} connection type "
+                        "on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_buffer_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/send-buffer-misses", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of serialization buffers which "
+                        "could not be taken from the send buffer pool for the "
+                        "{} connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_buffer_misses), _2),
                     &performance_counters::locality_counter_discoverer, ""}};
 
         performance_counters::install_counter_types(
             connection_cache_types, std::size(connection_cache_types));
     }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation function for the latency histograms collected by the parcel
+    // tracer, the optional counter parameter selects a single action:
+    //
+    //   /parcels{locality#<locality_id>/total}/trace/<interval>@<action>
+    //
+    namespace detail {
+
+        naming::gid_type parcel_trace_histogram_counter_creator(
+            parcelset::parcel_trace_interval which, counter_info const& info,
+            error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+            {
+                return naming::invalid_gid;
+            }
+
+            hpx::function<std::vector<std::int64_t>(bool)> f =
+                [which, action = HPX_MOVE(paths.parameters_)](bool reset) {
+                    return parcelset::detail::parcel_tracer::instance()
+                        .get_histogram(which, action, reset);
+                };
+            return locality_raw_values_counter_creator(info, f, ec);
+        }
+    }    // namespace detail
+
+    void register_parcel_trace_counter_types()
+    {
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcel_trace_interval;
+
+        performance_counters::generic_counter_type_data const counter_types[] =
+            {{"/parcels/trace/queue-time", counter_type::histogram,
+                 "returns the histogram of the time between handing a parcel "
+                 "to the parcelhandler and the start of its serialization "
+                 "[ns] (log2 buckets)",
+                 HPX_PERFORMANCE_COUNTER_V1,
+                 hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                     parcel_trace_interval::queue, _1, _2),
+                 &locality_counter_discoverer, "ns"},
+                {"/parcels/trace/serialization-time", counter_type::histogram,
+                    "returns the histogram of the time needed to serialize a "
+                    "parcel [ns] (log2 buckets)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                        parcel_trace_interval::serialization, _1, _2),
+                    &locality_counter_discoverer, "ns"},
+                {"/parcels/trace/post-time", counter_type::histogram,
+                    "returns the histogram of the time between the end of the "
+                    "serialization of a parcel and handing its message to the "
+                    "network [ns] (log2 buckets)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                        parcel_trace_interval::post, _1, _2),
+                    &locality_counter_discoverer, "ns"},
+                {"/parcels/trace/send-time", counter_type::histogram,
+                    "returns the histogram of the time between handing the "
+                    "message of a parcel to the network and the completion "
+                    "of the send operation [ns] (log2 buckets)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                        parcel_trace_interval::send, _1, _2),
+                    &locality_counter_discoverer, "ns"},
+                {"/parcels/trace/decode-time", counter_type::histogram,
+                    "returns the histogram of the time between receiving the "
+                    "message of a parcel and the end of its de-serialization "
+                    "[ns] (log2 buckets)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                        parcel_trace_interval::decode, _1, _2),
+                    &locality_counter_discoverer, "ns"},
+                {"/parcels/trace/schedule-time", counter_type::histogram,
+                    "returns the histogram of the time between the end of the "
+                    "de-serialization of a parcel and the creation of the "
+                    "thread running its action [ns] (log2 buckets)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&detail::parcel_trace_histogram_counter_creator,
+                        parcel_trace_interval::schedule, _1, _2),
+                    &locality_counter_discoverer, "ns"}};
+
+        performance_counters::install_counter_types(
+            counter_types, std::size(counter_types));
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     void register_parcelhandler_counter_types(parcelset::parcelhandler& ph)
     {
@@ -600,6 +725,10 @@ namespace hpx::performance_counters {
             return true;
         });
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        register_parcel_trace_counter_types();
+#endif
+
         using placeholders::_1;
         using placeholders::_2;
 
@@ -612,6 +741,8 @@ namespace hpx::performance_counters {
             hpx::bind_front(&parcelhandler::get_outgoing_queue_length, &ph));
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
+        hpx::function<std::int64_t(bool)> receive_throttled_count(
+            hpx::bind_front(&parcelhandler::get_receive_throttled_count, &ph));
 
         performance_counters::generic_counter_type_data const counter_types[] =
             {{"/parcelqueue/length/receive",
@@ -640,6 +771,17 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/throttled",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of times receiving parcels was held "
+                    "back because too many threads were queued on the "
+                    "locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        receive_throttled_count, _2),
                     &performance_counters::locality_counter_discoverer, ""}};
 
         performance_counters::install_counter_types(
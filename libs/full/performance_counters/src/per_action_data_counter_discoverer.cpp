@@ -13,11 +13,11 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/detail/counter_type_index.hpp>
 #include <hpx/performance_counters/per_action_data_counter_discoverer.hpp>
 #include <hpx/performance_counters/registry.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
-#include <regex>
 #include <string>
 #include <utility>
 
@@ -61,16 +61,17 @@ namespace hpx { namespace performance_counters {
 
         if (p.parameters_.find_first_of("*?[]") != std::string::npos)
         {
-            std::string str_rx(util::regex_from_pattern(p.parameters_, ec));
+            // validate the pattern
+            util::regex_from_pattern(p.parameters_, ec);
             if (ec)
                 return false;
 
             bool found_one = false;
-            std::regex rx(str_rx);
 
             for (auto const& e : map)
             {
-                if (!std::regex_match(e, rx))
+                if (!performance_counters::detail::matches_pattern(
+                        p.parameters_, e))
                     continue;
                 found_one = true;
 
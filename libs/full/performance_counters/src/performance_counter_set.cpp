@@ -5,25 +5,179 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/async_distributed.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/performance_counter.hpp>
 #include <hpx/performance_counters/performance_counter_set.hpp>
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/serialization/vector.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace performance_counters { namespace detail {
+
+    // Evaluate the given counters living on this locality
+    hpx::future<std::vector<counter_value>> get_local_counter_values(
+        std::vector<hpx::id_type> const& ids,
+        std::vector<std::uint8_t> const& resets)
+    {
+        HPX_ASSERT(ids.size() == resets.size());
+
+        std::vector<hpx::future<counter_value>> values;
+        values.reserve(ids.size());
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            performance_counter c(ids[i]);
+            values.emplace_back(c.get_counter_value(resets[i] != 0));
+        }
+
+        return hpx::dataflow(hpx::unwrapping(
+                                 [](std::vector<counter_value>&& values) {
+                                     return HPX_MOVE(values);
+                                 }),
+            HPX_MOVE(values));
+    }
+
+    // Reduce the given groups of counters, the counters of the first group
+    // live on this locality, the other groups are forwarded to the
+    // localities they live on
+    hpx::future<counter_value> reduce_local_counter_values(
+        counter_reduction op, std::vector<std::vector<hpx::id_type>> ids,
+        std::vector<std::vector<std::uint8_t>> resets);
+}}}    // namespace hpx::performance_counters::detail
+
+HPX_PLAIN_ACTION(hpx::performance_counters::detail::get_local_counter_values,
+    performance_counter_set_get_values_action)
+HPX_PLAIN_ACTION(hpx::performance_counters::detail::reduce_local_counter_values,
+    performance_counter_set_reduce_values_action)
+
+namespace hpx { namespace performance_counters { namespace detail {
+
+    // the number of localities every locality forwards a reduction to
+    constexpr std::size_t counter_reduction_arity = 4;
+
+    // Partial results of a reduction are represented as counter_values
+    // which hold the number of reduced values in count_
+    void reduce_counter_value(counter_reduction op, counter_value& result,
+        counter_value const& value, std::uint64_t count)
+    {
+        if (count == 0 || !status_is_valid(value.status_))
+        {
+            return;
+        }
+
+        if (result.count_ == 0)
+        {
+            result = value;
+            result.count_ = count;
+            return;
+        }
+
+        if (result.scaling_ != value.scaling_ ||
+            result.scale_inverse_ != value.scale_inverse_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "performance_counter_set::reduce_counter_values",
+                "counters using different scalings can't be reduced");
+        }
+
+        switch (op)
+        {
+        case counter_reduction::min:
+            result.value_ = (std::min)(result.value_, value.value_);
+            break;
+
+        case counter_reduction::max:
+            result.value_ = (std::max)(result.value_, value.value_);
+            break;
+
+        case counter_reduction::sum:
+            [[fallthrough]];
+        case counter_reduction::average:
+            [[fallthrough]];
+        default:
+            result.value_ += value.value_;
+            break;
+        }
+
+        result.time_ = (std::max)(result.time_, value.time_);
+        result.count_ += count;
+    }
+
+    hpx::future<counter_value> reduce_local_counter_values(
+        counter_reduction op, std::vector<std::vector<hpx::id_type>> ids,
+        std::vector<std::vector<std::uint8_t>> resets)
+    {
+        HPX_ASSERT(!ids.empty() && ids.size() == resets.size());
+
+        // forward the remaining groups to at most counter_reduction_arity
+        // localities, each of which handles a contiguous range of groups
+        std::vector<hpx::future<counter_value>> partials;
+        std::size_t const num_groups = ids.size() - 1;
+        std::size_t const chunk_size =
+            (num_groups + counter_reduction_arity - 1) /
+            counter_reduction_arity;
+
+        for (std::size_t begin = 1; begin < ids.size(); begin += chunk_size)
+        {
+            std::size_t const end = (std::min)(begin + chunk_size, ids.size());
+
+            std::vector<std::vector<hpx::id_type>> child_ids(
+                std::make_move_iterator(ids.begin() + begin),
+                std::make_move_iterator(ids.begin() + end));
+            std::vector<std::vector<std::uint8_t>> child_resets(
+                std::make_move_iterator(resets.begin() + begin),
+                std::make_move_iterator(resets.begin() + end));
+
+            hpx::id_type const dest =
+                naming::get_locality_from_id(child_ids.front().front());
+            partials.push_back(hpx::async(
+                performance_counter_set_reduce_values_action(), dest, op,
+                HPX_MOVE(child_ids), HPX_MOVE(child_resets)));
+        }
+
+        return hpx::dataflow(
+            hpx::unwrapping([op](std::vector<counter_value>&& values,
+                                std::vector<counter_value>&& partials) {
+                counter_value result;
+                for (counter_value const& value : values)
+                {
+                    reduce_counter_value(op, result, value, 1);
+                }
+                for (counter_value const& partial : partials)
+                {
+                    reduce_counter_value(op, result, partial, partial.count_);
+                }
+
+                if (result.count_ == 0)
+                {
+                    result.status_ = counter_status::invalid_data;
+                }
+                return result;
+            }),
+            get_local_counter_values(ids.front(), resets.front()),
+            HPX_MOVE(partials));
+    }
+}}}    // namespace hpx::performance_counters::detail
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters {
     performance_counter_set::performance_counter_set(
@@ -65,6 +219,12 @@ namespace hpx { namespace performance_counters {
         return infos_;
     }
 
+    std::vector<hpx::id_type> performance_counter_set::get_counter_ids() const
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return ids_;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool performance_counter_set::find_counter(
         counter_info const& info, bool reset, error_code& ec)
@@ -344,6 +504,169 @@ namespace hpx { namespace performance_counters {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void performance_counter_set::get_counter_groups(
+        std::vector<std::vector<hpx::id_type>>& ids,
+        std::vector<std::vector<std::uint8_t>>& resets,
+        std::vector<std::vector<std::size_t>>* indices, bool reset) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        ++invocation_count_;
+
+        // the groups are ordered by locality id, every index refers to the
+        // position of the value as returned by get_counter_values
+        std::map<std::uint32_t, std::size_t> groups;
+        std::size_t index = 0;
+        for (std::size_t i = 0; i != ids_.size(); ++i)
+        {
+            if (infos_[i].type_ == counter_type::histogram ||
+                infos_[i].type_ == counter_type::raw_values)
+            {
+                continue;
+            }
+
+            auto const p = groups.emplace(
+                naming::get_locality_id_from_id(ids_[i]), ids.size());
+            if (p.second)
+            {
+                ids.emplace_back();
+                resets.emplace_back();
+                if (indices != nullptr)
+                {
+                    indices->emplace_back();
+                }
+            }
+
+            std::size_t const group = p.first->second;
+            ids[group].push_back(ids_[i]);
+            resets[group].push_back(reset || reset_[i] ? 1 : 0);
+            if (indices != nullptr)
+            {
+                (*indices)[group].push_back(index);
+            }
+            ++index;
+        }
+    }
+
+    hpx::future<std::vector<counter_value>>
+    performance_counter_set::get_counter_values_batched(bool reset) const
+    {
+        std::vector<std::vector<hpx::id_type>> ids;
+        std::vector<std::vector<std::uint8_t>> resets;
+        std::vector<std::vector<std::size_t>> indices;
+        get_counter_groups(ids, resets, &indices, reset);
+
+        // send one request to every locality holding some of the counters
+        std::vector<hpx::future<std::vector<counter_value>>> v;
+        v.reserve(ids.size());
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            v.push_back(hpx::async(performance_counter_set_get_values_action(),
+                naming::get_locality_from_id(ids[i].front()), ids[i],
+                resets[i]));
+        }
+
+        return hpx::dataflow(
+            hpx::unwrapping([indices = HPX_MOVE(indices)](
+                                std::vector<std::vector<counter_value>>&&
+                                    values) {
+                std::size_t count = 0;
+                for (auto const& group : indices)
+                {
+                    count += group.size();
+                }
+
+                std::vector<counter_value> result(count);
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    HPX_ASSERT(values[i].size() == indices[i].size());
+                    for (std::size_t j = 0; j != values[i].size(); ++j)
+                    {
+                        result[indices[i][j]] = HPX_MOVE(values[i][j]);
+                    }
+                }
+                return result;
+            }),
+            HPX_MOVE(v));
+    }
+
+    std::vector<counter_value>
+    performance_counter_set::get_counter_values_batched(
+        launch::sync_policy, bool reset, error_code& ec) const
+    {
+        try
+        {
+            return get_counter_values_batched(reset).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(
+                ec, e, "performance_counter_set::get_counter_values_batched");
+            return std::vector<counter_value>();
+        }
+    }
+
+    hpx::future<counter_value> performance_counter_set::reduce_counter_values(
+        counter_reduction op, bool reset) const
+    {
+        std::vector<std::vector<hpx::id_type>> ids;
+        std::vector<std::vector<std::uint8_t>> resets;
+        get_counter_groups(ids, resets, nullptr, reset);
+
+        if (ids.empty())
+        {
+            counter_value result;
+            result.status_ = counter_status::invalid_data;
+            return hpx::make_ready_future(result);
+        }
+
+        std::uint64_t const invocation_count = get_invocation_count();
+        hpx::id_type const dest =
+            naming::get_locality_from_id(ids.front().front());
+
+        return hpx::async(performance_counter_set_reduce_values_action(), dest,
+            op, HPX_MOVE(ids), HPX_MOVE(resets))
+            .then(hpx::launch::sync,
+                [op, invocation_count](hpx::future<counter_value>&& f) {
+                    counter_value result = f.get();
+                    if (op == counter_reduction::average && result.count_ != 0)
+                    {
+                        // fold the number of values into the scaling of the
+                        // sum
+                        if (result.scale_inverse_)
+                        {
+                            result.scaling_ *=
+                                static_cast<std::int64_t>(result.count_);
+                        }
+                        else
+                        {
+                            result.value_ *= result.scaling_;
+                            result.scaling_ =
+                                static_cast<std::int64_t>(result.count_);
+                            result.scale_inverse_ = true;
+                        }
+                    }
+                    result.count_ = invocation_count;
+                    return result;
+                });
+    }
+
+    counter_value performance_counter_set::reduce_counter_values(
+        launch::sync_policy, counter_reduction op, bool reset,
+        error_code& ec) const
+    {
+        try
+        {
+            return reduce_counter_values(op, reset).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(
+                ec, e, "performance_counter_set::reduce_counter_values");
+            return counter_value();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::vector<hpx::future<counter_values_array>>
     performance_counter_set::get_counter_values_array(bool reset) const
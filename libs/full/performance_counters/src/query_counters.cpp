@@ -548,7 +548,7 @@ namespace hpx::util {
             output << description << std::endl;
 
         std::vector<performance_counters::counter_value> values =
-            counters_.get_counter_values(launch::sync, reset, ec);
+            counters_.get_counter_values_batched(launch::sync, reset, ec);
 
         HPX_ASSERT(values.size() == indices.size());
 
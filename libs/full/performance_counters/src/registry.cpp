@@ -22,7 +22,6 @@
 #include <hpx/performance_counters/server/statistics_counter.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
-#include <hpx/util/regex_from_pattern.hpp>
 
 #include <boost/accumulators/statistics/rolling_variance.hpp>
 #include <boost/accumulators/statistics_fwd.hpp>
@@ -30,7 +29,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,6 +40,7 @@ namespace hpx { namespace performance_counters {
     void registry::clear()
     {
         countertypes_.clear();
+        type_index_.clear();
     }
 
     registry::counter_type_map_type::iterator registry::locate_counter_type(
@@ -111,6 +110,8 @@ namespace hpx { namespace performance_counters {
             return counter_status::invalid_data;
         }
 
+        type_index_.insert(type_name);
+
         LPCS_(info).format("counter type {} registered", type_name);
 
         if (&ec != &throws)
@@ -170,7 +171,9 @@ namespace hpx { namespace performance_counters {
         }
         else
         {
-            std::string str_rx(util::regex_from_pattern(type_name, ec));
+            // resolve the pattern using the (cached) type index
+            std::vector<std::string> const matches =
+                type_index_.match(type_name, ec);
             if (ec)
                 return counter_status::invalid_data;
 
@@ -188,14 +191,11 @@ namespace hpx { namespace performance_counters {
                 return counter_status::invalid_data;
 
             bool found_one = false;
-            std::regex rx(str_rx);
-
-            counter_type_map_type::const_iterator end = countertypes_.end();
-            for (counter_type_map_type::const_iterator it =
-                     countertypes_.begin();
-                 it != end; ++it)
+            for (std::string const& name : matches)
             {
-                if (!std::regex_match((*it).first, rx))
+                counter_type_map_type::const_iterator it =
+                    countertypes_.find(name);
+                if (it == countertypes_.end())
                     continue;
                 found_one = true;
 
@@ -381,6 +381,7 @@ namespace hpx { namespace performance_counters {
 
         LPCS_(info).format("counter type {} unregistered", type_name);
 
+        type_index_.erase((*it).first);
         countertypes_.erase(it);
 
         if (&ec != &throws)
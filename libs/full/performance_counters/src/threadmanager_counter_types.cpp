@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -20,10 +21,17 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/schedulers/recycled_threads_trimmer.hpp>
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+#include <hpx/threading_base/annotation_statistics.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::performance_counters::detail {
@@ -249,6 +257,107 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    ///////////////////////////////////////////////////////////////////////
+    // steal histogram counter creation function
+    // /threads{locality#%d/total}/steals/victim-distance-histogram
+    // /threads{locality#%d/pool#%s/worker-thread#%d}/steals/...
+    std::vector<std::int64_t> make_steal_histogram(
+        std::vector<std::int64_t>&& buckets)
+    {
+        std::vector<std::int64_t> result;
+        result.reserve(buckets.size() + 3);
+
+        // first add histogram parameters, the buckets are identified by their
+        // index (see hpx::threads::policies::steal_histogram)
+        result.push_back(0);
+        result.push_back(static_cast<std::int64_t>(buckets.size()));
+        result.push_back(static_cast<std::int64_t>(buckets.size()));
+
+        result.insert(result.end(), buckets.begin(), buckets.end());
+        return result;
+    }
+
+    naming::gid_type steal_histogram_counter_creator(
+        threads::threadmanager* tm, threads::policies::steal_histogram which,
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "steal_histogram_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+
+        threads::thread_pool_base& pool = tm->default_pool();
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // overall counter
+            hpx::function<std::vector<std::int64_t>(bool)> f =
+                [tm, which](bool reset) {
+                    return make_steal_histogram(
+                        tm->get_steal_histogram(which, reset));
+                };
+            return create_raw_counter(info, HPX_MOVE(f), ec);
+        }
+        else if (paths.instancename_ == "pool")
+        {
+            if (paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) <
+                    hpx::resource::get_num_thread_pools())
+            {
+                // specific for given pool counter
+                threads::thread_pool_base* pool_instance =
+                    &hpx::resource::get_thread_pool(paths.instanceindex_);
+                auto const num_thread =
+                    static_cast<std::size_t>(paths.subinstanceindex_);
+
+                hpx::function<std::vector<std::int64_t>(bool)> f =
+                    [pool_instance, which, num_thread](bool reset) {
+                        return make_steal_histogram(
+                            pool_instance->get_steal_histogram(
+                                which, num_thread, reset));
+                    };
+                return create_raw_counter(info, HPX_MOVE(f), ec);
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+        {
+            // specific counter from default
+            threads::thread_pool_base* pool_instance = &pool;
+            auto const num_thread =
+                static_cast<std::size_t>(paths.instanceindex_);
+
+            hpx::function<std::vector<std::int64_t>(bool)> f =
+                [pool_instance, which, num_thread](bool reset) {
+                    return make_steal_histogram(
+                        pool_instance->get_steal_histogram(
+                            which, num_thread, reset));
+                };
+            return create_raw_counter(info, HPX_MOVE(f), ec);
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+            "steal_histogram_counter_creator",
+            "invalid counter instance name: {}", paths.instancename_);
+        return naming::invalid_gid;
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     naming::gid_type counter_creator(counter_info const& info,
         counter_path_elements const& paths,
@@ -289,7 +398,6 @@ namespace hpx::performance_counters::detail {
 
     ///////////////////////////////////////////////////////////////////////
     // thread counts counter creation function
-#if defined(HPX_HAVE_COROUTINE_COUNTERS)
     naming::gid_type thread_counts_counter_creator(
         counter_info const& info, error_code& ec)
     {
@@ -311,6 +419,15 @@ namespace hpx::performance_counters::detail {
         };
 
         creator_data data[] = {
+            // /threads{locality#%d/total}/count/trimmed-threads
+            {"count/trimmed-threads",
+                &threads::policies::get_trimmed_threads_count,
+                hpx::function<std::int64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/trimmed-bytes
+            {"count/trimmed-bytes",
+                &threads::policies::get_trimmed_threads_bytes,
+                hpx::function<std::int64_t(bool)>(), "", 0},
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
             // /threads{locality#%d/total}/count/stack-recycles
             {"count/stack-recycles",
                 hpx::bind_front(&threads::coroutine_type::impl_type::
@@ -322,6 +439,20 @@ namespace hpx::performance_counters::detail {
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                                     get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                &threads::coroutines::detail::posix::get_stack_pool_hits,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                &threads::coroutines::detail::posix::get_stack_pool_misses,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-resident-bytes
+            {"count/stack-pool-resident-bytes",
+                &threads::coroutines::detail::posix::
+                    get_stack_pool_resident_bytes,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -341,6 +472,190 @@ namespace hpx::performance_counters::detail {
             "invalid counter instance name: {}", paths.instancename_);
         return naming::invalid_gid;
     }
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+    ///////////////////////////////////////////////////////////////////////
+    // annotation histogram counter creation function
+    // /threads{locality#%d/total}/annotation/execution-time-histogram@<name>
+    std::vector<std::int64_t> make_annotation_histogram(
+        std::vector<std::int64_t>&& buckets)
+    {
+        std::vector<std::int64_t> result;
+        result.reserve(threads::annotation_histogram_num_buckets + 3);
+
+        // first add histogram parameters, the buckets are identified by their
+        // index (see hpx::threads::get_annotation_histogram_lower_bound)
+        constexpr auto num_buckets = static_cast<std::int64_t>(
+            threads::annotation_histogram_num_buckets);
+
+        result.push_back(0);
+        result.push_back(num_buckets);
+        result.push_back(num_buckets);
+
+        if (buckets.empty())
+        {
+            result.resize(threads::annotation_histogram_num_buckets + 3, 0);
+        }
+        else
+        {
+            result.insert(result.end(), buckets.begin(), buckets.end());
+        }
+        return result;
+    }
+
+    bool verify_annotation_counter_paths(counter_info const& info,
+        counter_path_elements& paths, char const* name, error_code& ec)
+    {
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return false;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return false;
+        }
+
+        if (paths.instancename_ != "total" || paths.instanceindex_ != -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "invalid counter instance name: {}", paths.instancename_);
+            return false;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "the counter {} requires the thread annotation as its "
+                "parameter",
+                info.fullname_);
+            return false;
+        }
+        return true;
+    }
+
+    naming::gid_type annotation_histogram_counter_creator(
+        threads::annotation_histogram which, counter_info const& info,
+        error_code& ec)
+    {
+        counter_path_elements paths;
+        if (!verify_annotation_counter_paths(
+                info, paths, "annotation_histogram_counter_creator", ec))
+        {
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        hpx::function<std::vector<std::int64_t>(bool)> f =
+            [annotation = paths.parameters_, which](bool reset) {
+                return make_annotation_histogram(
+                    threads::get_annotation_histogram(
+                        annotation, which, reset));
+            };
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+
+    // annotation percentile counter creation function
+    // /threads{locality#%d/total}/annotation/execution-time-percentile@<name>,
+    //      <percentile>
+    naming::gid_type annotation_percentile_counter_creator(
+        threads::annotation_histogram which, counter_info const& info,
+        error_code& ec)
+    {
+        counter_path_elements paths;
+        if (!verify_annotation_counter_paths(
+                info, paths, "annotation_percentile_counter_creator", ec))
+        {
+            return naming::invalid_gid;
+        }
+
+        // the annotation itself may contain commas
+        std::string::size_type const pos = paths.parameters_.rfind(',');
+        double percentile = 0.0;
+        if (pos != std::string::npos)
+        {
+            try
+            {
+                percentile = std::stod(paths.parameters_.substr(pos + 1));
+            }
+            catch (std::exception const&)
+            {
+                percentile = -1.0;
+            }
+        }
+
+        if (pos == std::string::npos || percentile < 0.0 || percentile > 100.0)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "annotation_percentile_counter_creator",
+                "the parameters of the counter {} have to be the thread "
+                "annotation followed by a comma and the percentile (0-100)",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        hpx::function<std::int64_t(bool)> f =
+            [annotation = paths.parameters_.substr(0, pos), which, percentile](
+                bool reset) {
+                return threads::get_annotation_histogram_percentile(
+                    threads::get_annotation_histogram(annotation, which, reset),
+                    percentile);
+            };
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+
+    // Expand the counter names to all annotations recorded so far if no
+    // annotation was given
+    bool annotation_counter_discoverer(counter_info const& info,
+        discover_counter_func const& f, discover_counters_mode mode,
+        error_code& ec)
+    {
+        counter_path_elements p;
+        counter_status const status =
+            get_counter_path_elements(info.fullname_, p, ec);
+        if (!status_is_valid(status))
+        {
+            return false;
+        }
+
+        if (mode == discover_counters_mode::minimal || !p.parameters_.empty())
+        {
+            return locality_counter_discoverer(info, f, mode, ec);
+        }
+
+        if (p.parentinstancename_.empty())
+        {
+            p.parentinstancename_ = "locality#*";
+            p.parentinstanceindex_ = -1;
+        }
+        if (p.instancename_.empty())
+        {
+            p.instancename_ = "total";
+            p.instanceindex_ = -1;
+        }
+
+        for (std::string& annotation : threads::get_recorded_annotations())
+        {
+            counter_info i = info;
+            p.parameters_ = HPX_MOVE(annotation);
+            if (!status_is_valid(get_counter_name(p, i.fullname_, ec)) ||
+                !f(i, ec) || ec)
+            {
+                return false;
+            }
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+        return true;
+    }
 #endif
 }    // namespace hpx::performance_counters::detail
 
@@ -349,10 +664,8 @@ namespace hpx::performance_counters {
     ///////////////////////////////////////////////////////////////////////////
     void register_threadmanager_counter_types(threads::threadmanager& tm)
     {
-#if defined(HPX_HAVE_COROUTINE_COUNTERS)
         create_counter_func counts_creator(
             hpx::bind_front(&detail::thread_counts_counter_creator));
-#endif
 
         generic_counter_type_data counter_types[] = {
             // length of thread queue(s)
@@ -595,6 +908,20 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_thread_count_staged,
                     &threads::thread_pool_base::get_thread_count_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/trimmed-threads",
+                counter_type::monotonically_increasing,
+                "returns the total number of recycled HPX-thread objects "
+                "released by the thread queues as they exceeded the recent "
+                "working set of the queues for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/trimmed-bytes",
+                counter_type::monotonically_increasing,
+                "returns the total number of bytes held by the recycled "
+                "HPX-thread objects and their stacks released by the thread "
+                "queues for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             {"/threads/count/stack-recycles",
                 counter_type::monotonically_increasing,
@@ -609,6 +936,25 @@ namespace hpx::performance_counters {
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks that were "
+                "reused from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks that had to be "
+                "newly allocated as the stack pool was empty for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-resident-bytes", counter_type::raw,
+                "returns the number of bytes currently held by unused "
+                "HPX-thread stacks in the stack pool for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
 #endif
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
@@ -672,6 +1018,84 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-batches",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal responses sent by the "
+                "referenced worker-thread that carried more than one "
+                "HPX-thread (work-requesting schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_batches,
+                    &threads::thread_pool_base::get_num_stolen_batches),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-batch-tasks",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads sent by the "
+                "referenced worker-thread as part of steal responses that "
+                "carried more than one HPX-thread (work-requesting "
+                "schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_batch_tasks,
+                    &threads::thread_pool_base::get_num_stolen_batch_tasks),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-remote",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times a steal request of the "
+                "referenced worker-thread was sent to a worker-thread located "
+                "in a remote NUMA domain (work-requesting schedulers with "
+                "hierarchical victim selection only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_steal_requests_remote,
+                    &threads::thread_pool_base::get_num_steal_requests_remote),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-attempts",
+                counter_type::monotonically_increasing,
+                "returns the overall number of attempts of the referenced "
+                "worker-thread to steal work from other worker-threads",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_steal_attempts,
+                    &threads::thread_pool_base::get_num_steal_attempts),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-successes",
+                counter_type::monotonically_increasing,
+                "returns the overall number of steal attempts of the "
+                "referenced worker-thread that yielded work",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_steal_successes,
+                    &threads::thread_pool_base::get_num_steal_successes),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/steals/victim-distance-histogram",
+                counter_type::histogram,
+                "returns the histogram of the topological distance between "
+                "the referenced worker-thread and the worker-threads it "
+                "successfully stole work from (same core, same NUMA domain, "
+                "remote NUMA domain)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_histogram_counter_creator, &tm,
+                    threads::policies::steal_histogram::victim_distance),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/steals/stolen-tasks-histogram",
+                counter_type::histogram,
+                "returns the histogram of the number of HPX-threads taken by "
+                "the successful steals of the referenced worker-thread "
+                "(log2 buckets)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_histogram_counter_creator, &tm,
+                    threads::policies::steal_histogram::stolen_tasks),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/steals/time-to-steal-histogram",
+                counter_type::histogram,
+                "returns the histogram of the time between starting a steal "
+                "attempt and receiving the stolen work for the successful "
+                "steals of the referenced worker-thread (log2 buckets)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_histogram_counter_creator, &tm,
+                    threads::policies::steal_histogram::time_to_steal),
+                &locality_pool_thread_counter_discoverer, "ns"},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
@@ -695,7 +1119,90 @@ namespace hpx::performance_counters {
                 hpx::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
-                &locality_pool_thread_no_total_counter_discoverer, ""}
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // idle parking
+            {"/threads/count/idle-parks",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times the referenced "
+                "worker-thread was parked while idling (hpx.idle_parking "
+                "only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_idle_park_count,
+                    &threads::thread_pool_base::get_idle_park_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/idle-unparks",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times the referenced "
+                "worker-thread was woken up because new work was added while "
+                "it was parked (hpx.idle_parking only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_idle_unpark_count,
+                    &threads::thread_pool_base::get_idle_unpark_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/missed-deadlines",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads executed by the "
+                "referenced worker-thread which finished after their deadline",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_missed_deadline_count,
+                    &threads::thread_pool_base::get_missed_deadline_count),
+                &locality_pool_thread_counter_discoverer, ""},
+#if defined(HPX_HAVE_THREAD_ANNOTATION_STATISTICS)
+            {"/threads/annotation/execution-time-histogram",
+                counter_type::histogram,
+                "returns the histogram of the overall execution time of the "
+                "terminated HPX-threads with the thread annotation given as "
+                "the counter parameter (HDR-style log buckets)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_histogram_counter_creator,
+                    threads::annotation_histogram::execution_time),
+                &detail::annotation_counter_discoverer, "ns"},
+            {"/threads/annotation/wait-time-histogram",
+                counter_type::histogram,
+                "returns the histogram of the time between creating and first "
+                "running the HPX-threads with the thread annotation given as "
+                "the counter parameter (HDR-style log buckets)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_histogram_counter_creator,
+                    threads::annotation_histogram::wait_time),
+                &detail::annotation_counter_discoverer, "ns"},
+            {"/threads/annotation/suspensions-histogram",
+                counter_type::histogram,
+                "returns the histogram of the number of suspensions of the "
+                "terminated HPX-threads with the thread annotation given as "
+                "the counter parameter (HDR-style log buckets)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_histogram_counter_creator,
+                    threads::annotation_histogram::suspensions),
+                &detail::annotation_counter_discoverer, ""},
+            {"/threads/annotation/execution-time-percentile", counter_type::raw,
+                "returns the given percentile of the overall execution time "
+                "of the terminated HPX-threads with the given thread "
+                "annotation (parameters: <annotation>,<percentile>)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_percentile_counter_creator,
+                    threads::annotation_histogram::execution_time),
+                &locality_counter_discoverer, "ns"},
+            {"/threads/annotation/wait-time-percentile", counter_type::raw,
+                "returns the given percentile of the time between creating "
+                "and first running the HPX-threads with the given thread "
+                "annotation (parameters: <annotation>,<percentile>)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_percentile_counter_creator,
+                    threads::annotation_histogram::wait_time),
+                &locality_counter_discoverer, "ns"},
+            {"/threads/annotation/suspensions-percentile", counter_type::raw,
+                "returns the given percentile of the number of suspensions "
+                "of the terminated HPX-threads with the given thread "
+                "annotation (parameters: <annotation>,<percentile>)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_percentile_counter_creator,
+                    threads::annotation_histogram::suspensions),
+                &locality_counter_discoverer, ""},
+#endif
         };
 
         install_counter_types(
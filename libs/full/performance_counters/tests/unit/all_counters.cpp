@@ -58,6 +58,8 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/count/steal-attempts",
+    "/threads/count/steal-successes",
 #endif
     nullptr
 };
@@ -0,0 +1,133 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the per-annotation histogram counters count every terminated
+// HPX-thread and that the percentile counters are consistent with them.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#ifdef HPX_HAVE_THREAD_ANNOTATION_STATISTICS
+#include <hpx/threading_base/annotation_statistics.hpp>
+
+constexpr std::size_t num_tasks = 100;
+
+std::vector<std::int64_t> get_histogram(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/threads{locality#0/total}/annotation/" + name +
+        "-histogram@annotation_histograms");
+    auto values = c.get_counter_values_array(hpx::launch::sync, false);
+
+    // lower and upper boundary, number of buckets, followed by the buckets
+    HPX_TEST_EQ(values.values_.size(),
+        hpx::threads::annotation_histogram_num_buckets + 3);
+    if (values.values_.size() !=
+        hpx::threads::annotation_histogram_num_buckets + 3)
+    {
+        return {};
+    }
+
+    HPX_TEST_EQ(values.values_[0], static_cast<std::int64_t>(0));
+    HPX_TEST_EQ(values.values_[2],
+        static_cast<std::int64_t>(
+            hpx::threads::annotation_histogram_num_buckets));
+
+    return std::vector<std::int64_t>(
+        values.values_.begin() + 3, values.values_.end());
+}
+
+std::int64_t get_percentile(std::string const& name, char const* percentile)
+{
+    hpx::performance_counters::performance_counter c(
+        "/threads{locality#0/total}/annotation/" + name +
+        "-percentile@annotation_histograms," + percentile);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_buckets()
+{
+    using hpx::threads::get_annotation_histogram_bucket;
+    using hpx::threads::get_annotation_histogram_lower_bound;
+    using hpx::threads::get_annotation_histogram_upper_bound;
+
+    // small values are counted exactly
+    HPX_TEST_EQ(get_annotation_histogram_bucket(0), std::size_t(0));
+    HPX_TEST_EQ(get_annotation_histogram_bucket(15), std::size_t(15));
+
+    for (std::size_t i = 0; i != hpx::threads::annotation_histogram_num_buckets;
+         ++i)
+    {
+        HPX_TEST_EQ(get_annotation_histogram_bucket(
+                        get_annotation_histogram_lower_bound(i)),
+            i);
+        HPX_TEST_EQ(get_annotation_histogram_bucket(
+                        get_annotation_histogram_upper_bound(i)),
+            i);
+    }
+}
+#endif
+
+int hpx_main()
+{
+#ifdef HPX_HAVE_THREAD_ANNOTATION_STATISTICS
+    test_buckets();
+
+    hpx::latch l(num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::post(hpx::annotated_function(
+            [&l]() {
+                // suspend once
+                hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+                l.count_down(1);
+            },
+            "annotation_histograms"));
+    }
+    l.arrive_and_wait();
+
+    // the last thread might still be about to terminate
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    for (char const* name : {"execution-time", "wait-time", "suspensions"})
+    {
+        std::vector<std::int64_t> const buckets = get_histogram(name);
+        HPX_TEST_EQ(std::accumulate(buckets.begin(), buckets.end(),
+                        std::int64_t(0)),
+            static_cast<std::int64_t>(num_tasks));
+
+        HPX_TEST_LTE(get_percentile(name, "50"), get_percentile(name, "99"));
+        HPX_TEST_LTE(
+            get_percentile(name, "99"), get_percentile(name, "99.9"));
+    }
+
+    // every thread has been suspended exactly once
+    HPX_TEST_EQ(get_percentile("suspensions", "0"), std::int64_t(1));
+    HPX_TEST_EQ(get_percentile("suspensions", "100"), std::int64_t(1));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
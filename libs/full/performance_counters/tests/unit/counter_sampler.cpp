@@ -0,0 +1,104 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/counter_sampler.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::counter_sampler;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_manual_sampling()
+{
+    counter_sampler sampler({"/runtime{locality#0/total}/uptime",
+                                "/threads{locality#0/total}/count/cumulative"},
+        1000, 4);
+    HPX_TEST_EQ(sampler.num_counters(), std::size_t(2));
+    HPX_TEST_EQ(sampler.snapshot_size(), std::size_t(3));
+
+    // the buffer drops snapshots once it is full
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(sampler.sample());
+    }
+    HPX_TEST(!sampler.sample());
+    HPX_TEST_EQ(sampler.size(), std::size_t(4));
+    HPX_TEST_EQ(sampler.dropped(), std::size_t(1));
+
+    std::vector<std::int64_t> data;
+    HPX_TEST_EQ(sampler.drain(data), std::size_t(4));
+    HPX_TEST_EQ(data.size(), std::size_t(4 * 3));
+    HPX_TEST_EQ(sampler.size(), std::size_t(0));
+
+    // time stamps and uptime are monotonic
+    for (std::size_t i = 1; i != 4; ++i)
+    {
+        HPX_TEST(data[i * 3] >= data[(i - 1) * 3]);
+        HPX_TEST(data[i * 3 + 1] >= data[(i - 1) * 3 + 1]);
+    }
+
+    // the buffer is usable after being drained
+    HPX_TEST(sampler.sample());
+    HPX_TEST_EQ(sampler.size(), std::size_t(1));
+}
+
+void test_periodic_sampling()
+{
+    counter_sampler sampler({"/runtime{locality#0/total}/uptime"}, 1000);
+
+    sampler.start();
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sampler.stop();
+
+    std::size_t const count = sampler.size();
+    HPX_TEST(count != 0);
+
+    std::stringstream stream;
+    HPX_TEST_EQ(sampler.export_samples(stream).get(), count);
+    HPX_TEST_EQ(sampler.size(), std::size_t(0));
+
+    // the export starts with the header describing the counters
+    std::string const data = stream.str();
+    std::uint64_t num_counters = 0;
+    HPX_TEST(data.size() > 2 * sizeof(std::uint64_t));
+    std::memcpy(&num_counters, data.data() + sizeof(std::uint64_t),
+        sizeof(std::uint64_t));
+    HPX_TEST_EQ(num_counters, std::uint64_t(1));
+
+    // subsequent exports hold the snapshots only
+    sampler.sample();
+    std::stringstream next;
+    HPX_TEST_EQ(sampler.export_samples(next).get(), std::size_t(1));
+    HPX_TEST_EQ(next.str().size(),
+        sizeof(std::uint64_t) + sampler.snapshot_size() * sizeof(std::int64_t));
+}
+
+int hpx_main()
+{
+    test_manual_sampling();
+    test_periodic_sampling();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,99 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::counter_reduction;
+using hpx::performance_counters::counter_value;
+using hpx::performance_counters::performance_counter_set;
+
+///////////////////////////////////////////////////////////////////////////////
+// every locality exposes a counter holding 2 * (locality_id + 1)
+std::int64_t get_value(bool)
+{
+    return 2 * (static_cast<std::int64_t>(hpx::get_locality_id()) + 1);
+}
+
+void register_counter_type()
+{
+    hpx::performance_counters::install_counter_type(
+        "/test/value", &get_value, "returns a value based on the locality id");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t reduce(counter_reduction op)
+{
+    performance_counter_set counters("/test{locality#*/total}/value");
+    return counters.reduce_counter_values(hpx::launch::sync, op)
+        .get_value<std::int64_t>();
+}
+
+int hpx_main()
+{
+    auto const num_localities =
+        static_cast<std::int64_t>(hpx::get_num_localities(hpx::launch::sync));
+
+    {
+        performance_counter_set counters(
+            std::vector<std::string>{"/test{locality#*/total}/value",
+                "/runtime{locality#*/total}/uptime"});
+
+        std::vector<counter_value> const values =
+            counters.get_counter_values(hpx::launch::sync);
+        std::vector<counter_value> const batched =
+            counters.get_counter_values_batched(hpx::launch::sync);
+
+        // the values are returned in the same order
+        HPX_TEST_EQ(batched.size(), values.size());
+        HPX_TEST_EQ(
+            batched.size(), static_cast<std::size_t>(2 * num_localities));
+        for (std::size_t i = 0; i != batched.size(); ++i)
+        {
+            if (i < static_cast<std::size_t>(num_localities))
+            {
+                HPX_TEST_EQ(batched[i].get_value<std::int64_t>(),
+                    values[i].get_value<std::int64_t>());
+            }
+            HPX_TEST_EQ(batched[i].scaling_, values[i].scaling_);
+        }
+    }
+
+    // the values are 2, 4, ..., 2 * num_localities
+    HPX_TEST_EQ(
+        reduce(counter_reduction::sum), num_localities * (num_localities + 1));
+    HPX_TEST_EQ(reduce(counter_reduction::min), std::int64_t(2));
+    HPX_TEST_EQ(reduce(counter_reduction::max), 2 * num_localities);
+    HPX_TEST_EQ(reduce(counter_reduction::average), num_localities + 1);
+
+    {
+        // an empty set results in an invalid value
+        performance_counter_set counters;
+        counter_value const value = counters.reduce_counter_values(
+            hpx::launch::sync, counter_reduction::sum);
+        HPX_TEST(!hpx::performance_counters::status_is_valid(value.status_));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::register_startup_function(&register_counter_type);
+
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,150 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/detail/counter_type_index.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
+
+#include <cstddef>
+#include <regex>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::detail::counter_type_index;
+using hpx::performance_counters::detail::matches_pattern;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_matches_pattern()
+{
+    std::vector<std::string> const patterns = {"*", "/threads/*",
+        "/threads/count/*", "/thr?ads/count/cum*", "/threads/count/[a-c]*",
+        "/threads/count/[!c]*", "*/idle-rate", "/threads\\/count/stack*",
+        "/threads/count/cumulative", "/thread*", "*-*", "/[ta]*/*"};
+
+    std::vector<std::string> const names = {"/threads", "/threads/idle-rate",
+        "/threads/count/cumulative", "/threads/count/cumulative-phases",
+        "/threads/count/stack-recycles", "/agas/count/bind",
+        "/threadsx/count", "/data/count/read", "/arithmetics/add"};
+
+    // the results have to be the same as for the equivalent regex
+    for (std::string const& pattern : patterns)
+    {
+        std::regex const rx(hpx::util::regex_from_pattern(pattern));
+        for (std::string const& name : names)
+        {
+            HPX_TEST_EQ_MSG(matches_pattern(pattern, name),
+                std::regex_match(name, rx), (pattern + " <-> " + name).c_str());
+        }
+    }
+}
+
+void test_index()
+{
+    counter_type_index index;
+    index.insert("/threads/count/cumulative");
+    index.insert("/threads/count/cumulative-phases");
+    index.insert("/threads/idle-rate");
+    index.insert("/threads");
+    index.insert("/agas/count/bind");
+
+    using names = std::vector<std::string>;
+
+    HPX_TEST(index.match("/threads/count/*") ==
+        names({"/threads/count/cumulative",
+            "/threads/count/cumulative-phases"}));
+    HPX_TEST(index.match("/threads/*") ==
+        names({"/threads/count/cumulative",
+            "/threads/count/cumulative-phases", "/threads/idle-rate"}));
+    HPX_TEST(index.match("/thr*") ==
+        names({"/threads", "/threads/count/cumulative",
+            "/threads/count/cumulative-phases", "/threads/idle-rate"}));
+    HPX_TEST(index.match("*/count/*") ==
+        names({"/agas/count/bind", "/threads/count/cumulative",
+            "/threads/count/cumulative-phases"}));
+    HPX_TEST(index.match("/threads/[!c]*") == names({"/threads/idle-rate"}));
+    HPX_TEST(index.match("/threads") == names({"/threads"}));
+    HPX_TEST(index.match("/parcels/*").empty());
+
+    // the cached results are invalidated if the types change
+    index.erase("/threads/count/cumulative-phases");
+    HPX_TEST(index.match("/threads/count/*") ==
+        names({"/threads/count/cumulative"}));
+
+    index.insert("/threads/count/stack-recycles");
+    HPX_TEST(index.match("/threads/count/*") ==
+        names({"/threads/count/cumulative", "/threads/count/stack-recycles"}));
+
+    // erasing a type keeps the types below it
+    index.erase("/threads");
+    HPX_TEST(index.match("/thr*") ==
+        names({"/threads/count/cumulative", "/threads/count/stack-recycles",
+            "/threads/idle-rate"}));
+
+    // invalid patterns are reported
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    HPX_TEST(index.match("/threads/[]", ec).empty());
+    HPX_TEST(ec);
+
+    index.clear();
+    HPX_TEST(index.match("*").empty());
+}
+
+// resolving wildcard counter types gives the same result as matching all
+// counter types
+void test_registry()
+{
+    using hpx::performance_counters::counter_info;
+
+    std::vector<counter_info> all;
+    hpx::performance_counters::discover_counter_types(all);
+
+    for (std::string const pattern : {"/threads/count/*", "/threads/*",
+             "/agas/count/*", "/*/count/cumulative"})
+    {
+        std::vector<counter_info> matches;
+        hpx::performance_counters::discover_counter_type(pattern, matches);
+
+        std::regex const rx(hpx::util::regex_from_pattern(pattern));
+        std::size_t expected = 0;
+        for (counter_info const& info : all)
+        {
+            std::string type_name;
+            hpx::performance_counters::get_counter_type_name(
+                info.fullname_, type_name);
+            if (std::regex_match(type_name, rx))
+                ++expected;
+        }
+
+        HPX_TEST_NEQ(expected, static_cast<std::size_t>(0));
+        HPX_TEST_EQ_MSG(matches.size(), expected, pattern.c_str());
+
+        // the second query uses the cached resolution
+        std::vector<counter_info> cached;
+        hpx::performance_counters::discover_counter_type(pattern, cached);
+        HPX_TEST_EQ(cached.size(), matches.size());
+    }
+}
+
+int hpx_main()
+{
+    test_matches_pattern();
+    test_index();
+    test_registry();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    return hpx::init(argc, argv);
+}
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the steal histogram counters are consistent with the number of
+// successful steals and steal attempts reported by the schedulers.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/functional.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+constexpr std::size_t num_tasks = 1000;
+
+void work(hpx::latch& l)
+{
+    hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+    l.count_down(1);
+}
+
+std::int64_t get_value(char const* name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// returns the sum of all buckets of the given histogram
+std::int64_t get_histogram_total(
+    std::string const& name, std::size_t num_buckets)
+{
+    hpx::performance_counters::performance_counter c(name);
+    auto values = c.get_counter_values_array(hpx::launch::sync, false);
+
+    // lower and upper boundary, number of buckets, followed by the buckets
+    HPX_TEST_EQ(values.values_.size(), num_buckets + 3);
+    if (values.values_.size() != num_buckets + 3)
+        return 0;
+
+    HPX_TEST_EQ(values.values_[0], static_cast<std::int64_t>(0));
+    HPX_TEST_EQ(values.values_[2], static_cast<std::int64_t>(num_buckets));
+
+    return std::accumulate(
+        values.values_.begin() + 3, values.values_.end(), std::int64_t(0));
+}
+#endif
+
+int hpx_main()
+{
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    // stealing requires more than one worker thread
+    if (hpx::get_os_thread_count() == 1)
+        return hpx::finalize();
+
+    // create all work on the first core, the other cores have to steal
+    hpx::latch l(num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        thread_init_data data(
+            make_thread_function_nullary(hpx::bind(&work, std::ref(l))),
+            "steal_histograms", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(0));
+        register_work(data);
+    }
+    l.arrive_and_wait();
+
+    char const* const successes_name =
+        "/threads{locality#0/total}/count/steal-successes";
+    char const* const attempts_name =
+        "/threads{locality#0/total}/count/steal-attempts";
+
+    // more steals might happen while the histograms are queried
+    std::int64_t const successes_before = get_value(successes_name);
+    HPX_TEST_LT(static_cast<std::int64_t>(0), successes_before);
+
+    std::int64_t const victim_distances = get_histogram_total(
+        "/threads{locality#0/total}/steals/victim-distance-histogram", 3);
+    std::int64_t const stolen_tasks = get_histogram_total(
+        "/threads{locality#0/total}/steals/stolen-tasks-histogram",
+        hpx::threads::policies::steal_histogram_num_buckets);
+    std::int64_t const times_to_steal = get_histogram_total(
+        "/threads{locality#0/total}/steals/time-to-steal-histogram",
+        hpx::threads::policies::steal_histogram_num_buckets);
+
+    std::int64_t const successes_after = get_value(successes_name);
+    std::int64_t const attempts_before = get_value(attempts_name);
+
+    // every successful steal is recorded in the stolen tasks histogram, the
+    // victim distance is recorded only once the distances are known, and the
+    // time to steal only if the attempt was still pending when the stolen
+    // work arrived
+    HPX_TEST_LTE(successes_before, stolen_tasks);
+    HPX_TEST_LTE(stolen_tasks, successes_after);
+    HPX_TEST_LTE(victim_distances, successes_after);
+    HPX_TEST_LT(static_cast<std::int64_t>(0), times_to_steal);
+    HPX_TEST_LTE(times_to_steal, successes_after);
+
+    // every steal attempt succeeds at most once
+    HPX_TEST_LTE(successes_after, attempts_before);
+
+    // idle worker threads keep looking for work, but all of their searches
+    // belong to the same attempt until they have found work again
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::int64_t const attempts_after = get_value(attempts_name);
+    HPX_TEST_LTE(attempts_before, attempts_after);
+    HPX_TEST_LT(
+        attempts_after - attempts_before, static_cast<std::int64_t>(100));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -123,10 +123,46 @@ namespace hpx::plugins {
                 name_uc +
                 "_MAX_BACKGROUND_THREADS:"
                 "$[hpx.parcel.max_background_threads]}");
+            fillini.emplace_back("send_buffer_pool_size = ${HPX_PARCEL_" +
+                name_uc +
+                "_SEND_BUFFER_POOL_SIZE:"
+                "$[hpx.parcel.send_buffer_pool_size]}");
+            fillini.emplace_back(
+                "send_buffer_pool_max_buffer_size = ${HPX_PARCEL_" + name_uc +
+                "_SEND_BUFFER_POOL_MAX_BUFFER_SIZE:"
+                "$[hpx.parcel.send_buffer_pool_max_buffer_size]}");
             fillini.emplace_back("async_serialization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("trusted_peers = ${HPX_PARCEL_" + name_uc +
+                "_TRUSTED_PEERS:$[hpx.parcel.trusted_peers]}");
+            fillini.emplace_back("streaming_threshold = ${HPX_PARCEL_" +
+                name_uc +
+                "_STREAMING_THRESHOLD:$[hpx.parcel.streaming_threshold]}");
+            fillini.emplace_back("streaming_chunk_size = ${HPX_PARCEL_" +
+                name_uc +
+                "_STREAMING_CHUNK_SIZE:$[hpx.parcel.streaming_chunk_size]}");
+            fillini.emplace_back("bulk_message_threshold = ${HPX_PARCEL_" +
+                name_uc +
+                "_BULK_MESSAGE_THRESHOLD:"
+                "$[hpx.parcel.bulk_message_threshold]}");
+            fillini.emplace_back("priority_lanes = ${HPX_PARCEL_" + name_uc +
+                "_PRIORITY_LANES:$[hpx.parcel.priority_lanes]}");
+            fillini.emplace_back("parallel_decode_threshold = ${HPX_PARCEL_" +
+                name_uc +
+                "_PARALLEL_DECODE_THRESHOLD:"
+                "$[hpx.parcel.parallel_decode_threshold]}");
+            fillini.emplace_back("inline_direct_actions = ${HPX_PARCEL_" +
+                name_uc +
+                "_INLINE_DIRECT_ACTIONS:$[hpx.parcel.inline_direct_actions]}");
+            fillini.emplace_back("backpressure_threshold = ${HPX_PARCEL_" +
+                name_uc +
+                "_BACKPRESSURE_THRESHOLD:"
+                "$[hpx.parcel.backpressure_threshold]}");
+            fillini.emplace_back("backpressure_delay = ${HPX_PARCEL_" +
+                name_uc +
+                "_BACKPRESSURE_DELAY:$[hpx.parcel.backpressure_delay]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
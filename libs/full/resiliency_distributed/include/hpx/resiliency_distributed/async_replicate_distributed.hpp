@@ -13,6 +13,7 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/resiliency/async_replicate.hpp>
 #include <hpx/resiliency/resiliency_cpos.hpp>
 #include <hpx/resiliency/util.hpp>
 
@@ -20,10 +21,14 @@
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/async_local.hpp>
+#include <hpx/naming_base/id_type.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -32,6 +37,89 @@ namespace hpx { namespace resiliency { namespace experimental {
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
+        ///////////////////////////////////////////////////////////////////////
+        // Keep track of the number of replicas launched from this locality
+        // that are still running on each of the target localities
+        HPX_EXPORT void replica_started(std::uint32_t locality);
+        HPX_EXPORT void replica_finished(std::uint32_t locality);
+
+        // Select \a n of the given localities, preferring the ones with the
+        // least replicas outstanding
+        HPX_EXPORT std::vector<hpx::id_type> select_least_loaded(
+            std::vector<hpx::id_type> const& ids, std::size_t n);
+
+        // Launch the given action on the given locality, the load of the
+        // locality is tracked until the replica has finished
+        template <typename Action, typename... Ts>
+        hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+            hpx::id_type, Ts...>::type>
+        async_replica(hpx::id_type const& id, Action& action, Ts&... ts)
+        {
+            using result_type =
+                typename hpx::util::detail::invoke_deferred_result<Action,
+                    hpx::id_type, Ts...>::type;
+
+            std::uint32_t const locality =
+                hpx::naming::get_locality_id_from_id(id);
+
+            replica_started(locality);
+            return hpx::async(action, id, ts...)
+                .then(hpx::launch::sync,
+                    [locality](hpx::future<result_type>&& f) {
+                        replica_finished(locality);
+                        return HPX_MOVE(f);
+                    });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return the first valid result as soon as it is available, replicas
+        // not dispatched until then are skipped
+        template <typename Pred, typename Action, typename... Ts>
+        hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+            hpx::id_type, Ts...>::type>
+        async_replicate_first(std::vector<hpx::id_type> const& ids,
+            Pred&& pred, Action&& action, Ts&&... ts)
+        {
+            using result_type =
+                typename hpx::util::detail::invoke_deferred_result<Action,
+                    hpx::id_type, Ts...>::type;
+            using state_type =
+                replicate_first_state<result_type, std::decay_t<Pred>>;
+
+            auto state = std::make_shared<state_type>(
+                ids.size(), std::decay_t<Pred>(HPX_FORWARD(Pred, pred)));
+
+            hpx::future<result_type> result = state->get_future();
+            for (hpx::id_type const& id : ids)
+            {
+                if (state->stop_requested())
+                {
+                    state->finished();
+                    continue;
+                }
+
+                async_replica(id, action, ts...)
+                    .then(hpx::launch::sync,
+                        [state](hpx::future<result_type>&& f) {
+                            if (f.has_exception())
+                            {
+                                state->set_exception(f.get_exception_ptr());
+                                return;
+                            }
+
+                            try
+                            {
+                                state->set_value(f.get());
+                            }
+                            catch (...)
+                            {
+                                state->set_exception(std::current_exception());
+                            }
+                        });
+            }
+            return result;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Vote, typename Pred, typename Action, typename... Ts>
         hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
@@ -49,7 +137,7 @@ namespace hpx { namespace resiliency { namespace experimental {
 
             for (std::size_t i = 0; i != ids.size(); ++i)
             {
-                results.emplace_back(hpx::async(action, ids.at(i), ts...));
+                results.emplace_back(async_replica(ids[i], action, ts...));
             }
 
             // wait for all threads to finish executing and return the first
@@ -153,8 +241,7 @@ namespace hpx { namespace resiliency { namespace experimental {
     {
         HPX_ASSERT(ids.size() > 0);
 
-        return detail::async_replicate_vote_validate(ids,
-            detail::replicate_voter{}, HPX_FORWARD(Pred, pred),
+        return detail::async_replicate_first(ids, HPX_FORWARD(Pred, pred),
             HPX_FORWARD(Action, action), HPX_FORWARD(Ts, ts)...);
     }
 
@@ -172,8 +259,90 @@ namespace hpx { namespace resiliency { namespace experimental {
     {
         HPX_ASSERT(ids.size() > 0);
 
-        return detail::async_replicate_vote_validate(ids,
-            detail::replicate_voter{}, detail::replicate_validator{},
+        return detail::async_replicate_first(ids,
+            detail::replicate_validator{}, HPX_FORWARD(Action, action),
+            HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times on \a n
+    // of the localities referred to by \a ids. The localities with the least
+    // replicas launched from this locality still running are preferred.
+    // Verify the result of those invocations using the given predicate
+    // \a pred. Run all the valid results against a user provided voting
+    // function. Return the valid output.
+    template <typename Vote, typename Pred, typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replicate_vote_validate_t, std::size_t n,
+        std::vector<hpx::id_type> const& ids, Vote&& vote, Pred&& pred,
+        Action&& action, Ts&&... ts)
+    {
+        HPX_ASSERT(n > 0 && n <= ids.size());
+
+        return detail::async_replicate_vote_validate(
+            detail::select_least_loaded(ids, n), HPX_FORWARD(Vote, vote),
+            HPX_FORWARD(Pred, pred), HPX_FORWARD(Action, action),
+            HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times on \a n
+    // of the localities referred to by \a ids. The localities with the least
+    // replicas launched from this locality still running are preferred. Run
+    // all the valid results against a user provided voting function. Return
+    // the valid output.
+    template <typename Vote, typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replicate_vote_t, std::size_t n,
+        std::vector<hpx::id_type> const& ids, Vote&& vote, Action&& action,
+        Ts&&... ts)
+    {
+        HPX_ASSERT(n > 0 && n <= ids.size());
+
+        return detail::async_replicate_vote_validate(
+            detail::select_least_loaded(ids, n), HPX_FORWARD(Vote, vote),
+            detail::replicate_validator{}, HPX_FORWARD(Action, action),
+            HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times on \a n
+    // of the localities referred to by \a ids. The localities with the least
+    // replicas launched from this locality still running are preferred.
+    // Verify the result of those invocations using the given predicate
+    // \a pred. Return the first valid result.
+    template <typename Pred, typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replicate_validate_t, std::size_t n,
+        std::vector<hpx::id_type> const& ids, Pred&& pred, Action&& action,
+        Ts&&... ts)
+    {
+        HPX_ASSERT(n > 0 && n <= ids.size());
+
+        return detail::async_replicate_first(
+            detail::select_least_loaded(ids, n), HPX_FORWARD(Pred, pred),
+            HPX_FORWARD(Action, action), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronously launch given function \a f exactly \a n times on \a n
+    // of the localities referred to by \a ids. The localities with the least
+    // replicas launched from this locality still running are preferred.
+    // Verify the result of those invocations by checking for exception.
+    // Return the first valid result.
+    template <typename Action, typename... Ts>
+    hpx::future<typename hpx::util::detail::invoke_deferred_result<Action,
+        hpx::id_type, Ts...>::type>
+    tag_invoke(async_replicate_t, std::size_t n,
+        std::vector<hpx::id_type> const& ids, Action&& action, Ts&&... ts)
+    {
+        HPX_ASSERT(n > 0 && n <= ids.size());
+
+        return detail::async_replicate_first(
+            detail::select_least_loaded(ids, n), detail::replicate_validator{},
             HPX_FORWARD(Action, action), HPX_FORWARD(Ts, ts)...);
     }
 
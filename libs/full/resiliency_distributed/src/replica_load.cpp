@@ -0,0 +1,101 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/resiliency_distributed/async_replicate_distributed.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace hpx::resiliency::experimental::detail {
+
+    namespace {
+
+        struct replica_load
+        {
+            hpx::spinlock mtx_;
+            std::unordered_map<std::uint32_t, std::size_t> outstanding_;
+        };
+
+        replica_load& get_replica_load()
+        {
+            static replica_load load;
+            return load;
+        }
+    }    // namespace
+
+    void replica_started(std::uint32_t locality)
+    {
+        replica_load& load = get_replica_load();
+
+        std::lock_guard<hpx::spinlock> l(load.mtx_);
+        ++load.outstanding_[locality];
+    }
+
+    void replica_finished(std::uint32_t locality)
+    {
+        replica_load& load = get_replica_load();
+
+        std::lock_guard<hpx::spinlock> l(load.mtx_);
+        auto const it = load.outstanding_.find(locality);
+        HPX_ASSERT(it != load.outstanding_.end() && it->second != 0);
+        if (--it->second == 0)
+        {
+            load.outstanding_.erase(it);
+        }
+    }
+
+    std::vector<hpx::id_type> select_least_loaded(
+        std::vector<hpx::id_type> const& ids, std::size_t n)
+    {
+        HPX_ASSERT(n <= ids.size());
+
+        // take a snapshot of the current load of all localities
+        std::vector<std::size_t> load(ids.size());
+        std::vector<std::uint32_t> locality_ids(ids.size());
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            locality_ids[i] = hpx::naming::get_locality_id_from_id(ids[i]);
+        }
+
+        {
+            replica_load& l = get_replica_load();
+
+            std::lock_guard<hpx::spinlock> lk(l.mtx_);
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                auto const it = l.outstanding_.find(locality_ids[i]);
+                load[i] = it != l.outstanding_.end() ? it->second : 0;
+            }
+        }
+
+        // the order of the given localities is kept for equal loads
+        std::vector<std::size_t> order(ids.size());
+        for (std::size_t i = 0; i != order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+                return load[lhs] < load[rhs];
+            });
+
+        std::vector<hpx::id_type> result;
+        result.reserve(n);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            result.push_back(ids[order[i]]);
+        }
+        return result;
+    }
+}    // namespace hpx::resiliency::experimental::detail
@@ -132,6 +132,39 @@ int hpx_main()
         }
     }
 
+    {
+        // replicate on a subset of the localities, preferring the ones with
+        // the least outstanding replicas
+        universal_action action;
+        hpx::future<int> f =
+            hpx::resiliency::experimental::async_replicate_validate(
+                2, locals, &validate, action);
+
+        try
+        {
+            HPX_TEST_EQ(f.get(), 42);
+        }
+        catch (hpx::resiliency::experimental::abort_replicate_exception const&)
+        {
+            HPX_TEST(true);
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+
+        f = hpx::resiliency::experimental::async_replicate_vote(
+            2, locals, &vote, action);
+        try
+        {
+            f.get();
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+    }
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,92 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that many names can be registered at once, and that
+// names resolve to the registered ids until they are unregistered (this test
+// is run with and without caching the resolved names).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+constexpr std::size_t num_names = 32;
+
+std::string get_name(std::size_t i)
+{
+    return "/register_names_test/" + std::to_string(i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    std::vector<std::pair<std::string, hpx::id_type>> entries;
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        entries.emplace_back(get_name(i),
+            hpx::new_<test_server>(localities[i % localities.size()]).get());
+    }
+
+    std::vector<bool> registered = hpx::agas::register_names(entries).get();
+    HPX_TEST_EQ(registered.size(), num_names);
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        HPX_TEST(registered[i]);
+    }
+
+    // names can't be registered twice
+    registered = hpx::agas::register_names(entries).get();
+    HPX_TEST_EQ(registered.size(), num_names);
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        HPX_TEST(!registered[i]);
+    }
+
+    // resolve all names twice, the second time the names may be cached
+    for (int iteration = 0; iteration != 2; ++iteration)
+    {
+        for (auto const& [name, id] : entries)
+        {
+            HPX_TEST_EQ(hpx::agas::resolve_name(hpx::launch::sync, name), id);
+        }
+    }
+
+    for (auto const& [name, id] : entries)
+    {
+        HPX_TEST_EQ(hpx::agas::unregister_name(hpx::launch::sync, name), id);
+        HPX_TEST_EQ(hpx::agas::resolve_name(hpx::launch::sync, name),
+            hpx::invalid_id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
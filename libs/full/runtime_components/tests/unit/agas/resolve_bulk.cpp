@@ -0,0 +1,83 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that resolving a list of ids at once yields the same
+// addresses as resolving each id separately, and that prefetching the
+// addresses of remote objects populates the local AGAS cache.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+constexpr std::size_t num_objects_per_locality = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> ids;
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        for (std::size_t i = 0; i != num_objects_per_locality; ++i)
+        {
+            ids.push_back(hpx::new_<test_server>(locality).get());
+        }
+    }
+
+    // prefetching must not change the resolved addresses
+    hpx::agas::prefetch(ids).get();
+
+    std::vector<hpx::naming::address> addrs = hpx::agas::resolve(ids).get();
+    HPX_TEST_EQ(addrs.size(), ids.size());
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        hpx::naming::address const addr = hpx::agas::resolve(ids[i]).get();
+        HPX_TEST(addrs[i] == addr);
+        HPX_TEST_EQ(hpx::naming::get_locality_id_from_gid(addrs[i].locality_),
+            hpx::naming::get_locality_id_from_id(ids[i]));
+    }
+
+    // the addresses of remote objects are now available locally
+    std::uint32_t const here = hpx::get_locality_id();
+    for (hpx::id_type const& id : ids)
+    {
+        hpx::naming::address addr;
+        if (hpx::naming::get_locality_id_from_id(id) != here)
+        {
+            HPX_TEST(hpx::agas::resolve_cached(id.get_gid(), addr));
+        }
+    }
+
+    // an empty list resolves to an empty list
+    HPX_TEST(hpx::agas::resolve(std::vector<hpx::id_type>()).get().empty());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
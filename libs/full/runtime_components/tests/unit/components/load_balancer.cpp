@@ -0,0 +1,152 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the load balancer migrates the instances of a busy component
+// away from the only locality they were created on.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_objects = 16;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::load_balancing_support<
+        hpx::components::migration_support<
+            hpx::components::component_base<test_server>>>
+{
+    using base_type = hpx::components::load_balancing_support<
+        hpx::components::migration_support<
+            hpx::components::component_base<test_server>>>;
+
+    test_server() = default;
+
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+    {
+    }
+    test_server(test_server&& rhs) noexcept
+      : base_type(std::move(rhs))
+    {
+    }
+
+    test_server& operator=(test_server const&)
+    {
+        return *this;
+    }
+    test_server& operator=(test_server&&) noexcept
+    {
+        return *this;
+    }
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    void busy_work() const
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, busy_work, busy_work_action)
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+using busy_work_action = test_server::busy_work_action;
+HPX_REGISTER_ACTION_DECLARATION(busy_work_action)
+HPX_REGISTER_ACTION(busy_work_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void generate_load(std::vector<hpx::id_type> const& objects)
+{
+    std::vector<hpx::future<void>> work;
+    work.reserve(objects.size());
+    for (hpx::id_type const& id : objects)
+    {
+        work.push_back(hpx::async<busy_work_action>(id));
+    }
+    hpx::wait_all(work);
+}
+
+void test_load_balancer()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    std::vector<hpx::id_type> objects;
+    objects.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        objects.push_back(hpx::new_<test_server>(hpx::find_here()).get());
+    }
+
+    hpx::components::load_balancing_parameters params;
+    params.imbalance_threshold = 1.1;
+    params.max_migrations = num_objects;
+
+    hpx::components::load_balancer<test_server> balancer(params);
+
+    generate_load(objects);
+    std::size_t const migrated = balancer.balance();
+
+    if (localities.size() < 2)
+    {
+        // nothing to balance
+        HPX_TEST_EQ(migrated, static_cast<std::size_t>(0));
+    }
+    else
+    {
+        HPX_TEST_LT(static_cast<std::size_t>(0), migrated);
+        HPX_TEST_LT(migrated, num_objects);
+    }
+    HPX_TEST_EQ(balancer.migrated(), migrated);
+
+    // the load was reset by the last balancing round
+    HPX_TEST_EQ(balancer.balance(), static_cast<std::size_t>(0));
+
+    // all objects are still reachable, the migrated ones are located on
+    // other localities
+    std::size_t remote = 0;
+    for (hpx::id_type const& id : objects)
+    {
+        if (hpx::async<call_action>(id).get() != hpx::find_here())
+        {
+            ++remote;
+        }
+    }
+    HPX_TEST_EQ(remote, migrated);
+}
+
+int main()
+{
+    test_load_balancer();
+    return hpx::util::report_errors();
+}
+#endif
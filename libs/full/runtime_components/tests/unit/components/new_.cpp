@@ -13,6 +13,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,33 @@ HPX_REGISTER_COMPONENT(server_type, test_server)
 typedef test_server::call_action call_action;
 HPX_REGISTER_ACTION(call_action)
 
+///////////////////////////////////////////////////////////////////////////////
+struct managed_test_server
+  : hpx::components::managed_component_base<managed_test_server>
+{
+    explicit managed_test_server(int value = 0)
+      : value_(value)
+    {
+    }
+
+    int get_value() const
+    {
+        return value_;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(managed_test_server, get_value)
+
+    int value_;
+};
+
+typedef hpx::components::managed_component<managed_test_server>
+    managed_server_type;
+HPX_REGISTER_COMPONENT(managed_server_type, managed_test_server)
+
+typedef managed_test_server::get_value_action get_value_action;
+HPX_REGISTER_ACTION(get_value_action)
+
+///////////////////////////////////////////////////////////////////////////////
 struct test_client : hpx::components::client_base<test_client, test_server>
 {
     typedef hpx::components::client_base<test_client, test_server> base_type;
@@ -157,11 +185,40 @@ void test_create_multiple_instances()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_create_multiple_instances_with_arguments()
+{
+    constexpr std::size_t count = 10000;
+
+    for (hpx::id_type const& loc : hpx::find_all_localities())
+    {
+        std::vector<hpx::id_type> ids =
+            hpx::new_<managed_test_server[]>(loc, count, 42).get();
+        HPX_TEST_EQ(ids.size(), count);
+
+        std::set<hpx::id_type> unique_ids(ids.begin(), ids.end());
+        HPX_TEST_EQ(unique_ids.size(), count);
+
+        std::vector<hpx::future<int>> values;
+        values.reserve(count);
+        for (hpx::id_type const& id : ids)
+        {
+            values.push_back(hpx::async<get_value_action>(id));
+        }
+
+        for (hpx::future<int>& f : values)
+        {
+            HPX_TEST_EQ(f.get(), 42);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
     test_create_single_instance();
     test_create_multiple_instances();
+    test_create_multiple_instances_with_arguments();
 
     return 0;
 }
@@ -59,6 +59,12 @@ namespace hpx { namespace agas {
 
         std::vector<parcelset::endpoints_type> localities;
 
+        // the number of children of every locality in the tree used to
+        // distribute the notifications during startup, zero if locality 0
+        // notifies every locality itself
+        std::size_t const tree_arity;
+        std::vector<notification_header> notifications;
+
         void spin();
 
         void notify();
@@ -86,12 +92,7 @@ namespace hpx { namespace agas {
             parcelset::endpoints_type const& endpoints_,
             util::runtime_configuration const& ini_);
 
-        ~big_boot_barrier()
-        {
-            hpx::move_only_function<void()>* f;
-            while (thunks.pop(f))
-                delete f;
-        }
+        ~big_boot_barrier();
 
         parcelset::locality here()
         {
@@ -116,6 +117,24 @@ namespace hpx { namespace agas {
             std::uint32_t target_locality_id, parcelset::locality const& dest,
             notification_header&& hdr);
 
+        // Send the notifications headers[first, last) down the tree: the
+        // range is split into at most tree_arity consecutive chunks, each
+        // of which is sent to the locality of its first notification, which
+        // forwards the rest of its chunk in the same way
+        void apply_notification_tree(std::uint32_t source_locality_id,
+            std::vector<notification_header> const& headers,
+            std::size_t first, std::size_t last,
+            std::vector<parcelset::endpoints_type> const& endpoints);
+
+        std::size_t get_tree_arity() const noexcept
+        {
+            return tree_arity;
+        }
+
+        // delay the notification of a registered locality until trigger()
+        // sends all of them down the tree
+        void add_notification(notification_header&& hdr);
+
         void wait_bootstrap();
         void wait_hosted(std::string const& locality_name,
             naming::address::address_type primary_ns_ptr,
@@ -0,0 +1,277 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_balancer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+#include <hpx/runtime_distributed/server/load_balancer.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::components {
+
+    /// The parameters controlling the load balancer. The defaults are read
+    /// from the configuration section [hpx.load_balancing].
+    struct load_balancing_parameters
+    {
+        /// The time between two balancing rounds in microseconds
+        /// (hpx.load_balancing.interval, default: 1s)
+        std::int64_t interval = 1000000;
+
+        /// A locality is considered to be overloaded if its load exceeds the
+        /// average load of all localities by this factor
+        /// (hpx.load_balancing.imbalance_threshold, default: 1.25)
+        double imbalance_threshold = 1.25;
+
+        /// The maximal number of objects migrated in one balancing round
+        /// (hpx.load_balancing.max_migrations, default: 16)
+        std::size_t max_migrations = 16;
+
+        /// The maximal number of the most loaded objects reported by each
+        /// locality to be considered for migration
+        /// (hpx.load_balancing.max_candidates, default: 64)
+        std::size_t max_candidates = 64;
+
+        /// Create the parameters from the runtime configuration
+        static load_balancing_parameters from_config()
+        {
+            load_balancing_parameters params;
+            params.interval = hpx::util::from_string<std::int64_t>(
+                hpx::get_config_entry("hpx.load_balancing.interval", ""),
+                params.interval);
+            params.imbalance_threshold = hpx::util::from_string<double>(
+                hpx::get_config_entry(
+                    "hpx.load_balancing.imbalance_threshold", ""),
+                params.imbalance_threshold);
+            params.max_migrations = hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry("hpx.load_balancing.max_migrations", ""),
+                params.max_migrations);
+            params.max_candidates = hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry("hpx.load_balancing.max_candidates", ""),
+                params.max_candidates);
+            return params;
+        }
+    };
+
+    /// The load balancer periodically collects the time spent executing
+    /// actions on all instances of the given component type on all
+    /// localities. If the load of a locality exceeds the average load by
+    /// more than the configured threshold, the most loaded instances living
+    /// on it are migrated (using hpx::components::migrate) to the least
+    /// loaded localities. All migrations of one balancing round are
+    /// performed concurrently.
+    ///
+    /// \tparam Component The component type of the instances to balance, it
+    ///                   has to derive from load_balancing_support and from
+    ///                   migration_support.
+    ///
+    /// The load balancer is usually created on one locality only (e.g. the
+    /// root locality). Its balancing rounds are either executed periodically
+    /// after start() has been called, or explicitly by invoking balance().
+    template <typename Component>
+    class load_balancer
+    {
+    public:
+        explicit load_balancer(load_balancing_parameters const& params =
+                                   load_balancing_parameters::from_config())
+          : params_(params)
+          , timer_(
+                [this]() {
+                    balance();
+                    return true;
+                },
+                params_.interval, "hpx::components::load_balancer", true)
+        {
+        }
+
+        load_balancer(load_balancer const&) = delete;
+        load_balancer(load_balancer&&) = delete;
+        load_balancer& operator=(load_balancer const&) = delete;
+        load_balancer& operator=(load_balancer&&) = delete;
+
+        ~load_balancer()
+        {
+            timer_.stop(true);
+        }
+
+        /// Start the periodic balancing rounds
+        bool start()
+        {
+            return timer_.start(false);
+        }
+
+        /// Stop the periodic balancing rounds
+        bool stop()
+        {
+            return timer_.stop();
+        }
+
+        /// Run one balancing round, returns the number of migrated objects.
+        /// Returns immediately if another balancing round is in progress.
+        std::size_t balance()
+        {
+            if (running_.exchange(true))
+            {
+                return 0;
+            }
+
+            std::size_t migrated = 0;
+            try
+            {
+                migrated = balance_locked();
+            }
+            catch (...)
+            {
+                running_.store(false);
+                throw;
+            }
+
+            running_.store(false);
+            migrated_ += migrated;
+            return migrated;
+        }
+
+        /// Return the overall number of objects migrated by this load
+        /// balancer
+        [[nodiscard]] std::size_t migrated() const noexcept
+        {
+            return migrated_.load();
+        }
+
+        [[nodiscard]] load_balancing_parameters const& parameters()
+            const noexcept
+        {
+            return params_;
+        }
+
+    private:
+        std::size_t balance_locked()
+        {
+            using action_type = server::get_load_report_action<Component>;
+
+            std::vector<hpx::id_type> const localities =
+                hpx::find_all_localities();
+            if (localities.size() < 2)
+            {
+                return 0;
+            }
+
+            std::vector<hpx::future<server::load_report>> futures;
+            futures.reserve(localities.size());
+            for (hpx::id_type const& locality : localities)
+            {
+                futures.push_back(hpx::async<action_type>(
+                    locality, params_.max_candidates));
+            }
+
+            std::vector<server::load_report> reports;
+            reports.reserve(localities.size());
+            std::uint64_t total = 0;
+            for (auto& f : futures)
+            {
+                reports.push_back(f.get());
+                total += reports.back().busy_time;
+            }
+
+            double const average = static_cast<double>(total) /
+                static_cast<double>(reports.size());
+            if (average == 0.0)
+            {
+                return 0;
+            }
+
+            // the instances of each report are sorted by decreasing load,
+            // next[i] is the next candidate to migrate from locality i
+            std::vector<std::size_t> next(reports.size(), 0);
+            std::vector<std::pair<hpx::id_type, hpx::id_type>> migrations;
+
+            auto const by_load = [](server::load_report const& lhs,
+                                     server::load_report const& rhs) {
+                return lhs.busy_time < rhs.busy_time;
+            };
+
+            while (migrations.size() < params_.max_migrations)
+            {
+                auto const donor =
+                    std::max_element(reports.begin(), reports.end(), by_load);
+                auto const receiver =
+                    std::min_element(reports.begin(), reports.end(), by_load);
+
+                if (static_cast<double>(donor->busy_time) <=
+                    params_.imbalance_threshold * average)
+                {
+                    break;
+                }
+
+                // choose the most loaded instance whose migration reduces
+                // the difference between the donor and the receiver
+                std::uint64_t const difference =
+                    donor->busy_time - receiver->busy_time;
+                std::size_t& candidate =
+                    next[static_cast<std::size_t>(donor - reports.begin())];
+                while (candidate != donor->instances.size() &&
+                    donor->instances[candidate].busy_time >= difference)
+                {
+                    ++candidate;
+                }
+
+                if (candidate == donor->instances.size())
+                {
+                    break;
+                }
+
+                server::instance_load const& instance =
+                    donor->instances[candidate++];
+
+                donor->busy_time -= instance.busy_time;
+                receiver->busy_time += instance.busy_time;
+                migrations.emplace_back(instance.id, receiver->locality);
+            }
+
+            // perform all migrations of this round concurrently
+            std::vector<hpx::future<hpx::id_type>> migrated;
+            migrated.reserve(migrations.size());
+            for (auto const& m : migrations)
+            {
+                migrated.push_back(
+                    hpx::components::migrate<Component>(m.first, m.second));
+            }
+            hpx::wait_all_nothrow(migrated);
+
+            // objects which were deleted or are already being migrated in
+            // the meantime are skipped
+            return static_cast<std::size_t>(
+                std::count_if(migrated.begin(), migrated.end(),
+                    [](hpx::future<hpx::id_type> const& f) {
+                        return !f.has_exception();
+                    }));
+        }
+
+        load_balancing_parameters params_;
+        hpx::util::interval_timer timer_;
+        std::atomic<bool> running_{false};
+        std::atomic<std::size_t> migrated_{0};
+    };
+}    // namespace hpx::components
+#endif
@@ -0,0 +1,105 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::components::server {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The load caused by a single component instance
+    struct instance_load
+    {
+        hpx::id_type id;
+        std::uint64_t busy_time = 0;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & id & busy_time;
+            // clang-format on
+        }
+    };
+
+    // The load of a locality caused by all instances of a component type, the
+    // instances are sorted by decreasing load
+    struct load_report
+    {
+        hpx::id_type locality;
+        std::uint64_t busy_time = 0;
+        std::vector<instance_load> instances;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & locality & busy_time & instances;
+            // clang-format on
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the time spent executing actions on all instances of the given
+    // component type living on this locality since the last invocation. At
+    // most max_instances of the most loaded instances are reported.
+    template <typename Component>
+    load_report get_load_report(std::size_t max_instances)
+    {
+        load_report report;
+        report.locality = hpx::find_here();
+
+        Component::for_each_instance([&](Component& instance) {
+            std::uint64_t const busy_time = instance.reset_busy_time();
+            if (busy_time != 0)
+            {
+                // only instances which have executed actions are bound to a
+                // global id
+                report.busy_time += busy_time;
+                report.instances.push_back(
+                    instance_load{instance.get_unmanaged_id(), busy_time});
+            }
+        });
+
+        auto const by_load = [](instance_load const& lhs,
+                                 instance_load const& rhs) {
+            return lhs.busy_time > rhs.busy_time;
+        };
+
+        if (report.instances.size() > max_instances)
+        {
+            std::partial_sort(report.instances.begin(),
+                report.instances.begin() +
+                    static_cast<std::ptrdiff_t>(max_instances),
+                report.instances.end(), by_load);
+            report.instances.resize(max_instances);
+        }
+        else
+        {
+            std::sort(
+                report.instances.begin(), report.instances.end(), by_load);
+        }
+        return report;
+    }
+
+    template <typename Component>
+    struct get_load_report_action
+      : ::hpx::actions::action<load_report (*)(std::size_t),
+            &get_load_report<Component>, get_load_report_action<Component>>
+    {
+    };
+}    // namespace hpx::components::server
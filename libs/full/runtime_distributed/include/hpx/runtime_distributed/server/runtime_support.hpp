@@ -425,14 +425,9 @@ namespace hpx::components::server {
         components::component_type const type =
             components::get_component_type<typename Component::wrapped_type>();
 
-        std::vector<naming::gid_type> ids;
-        ids.reserve(count);
-
         typedef typename Component::wrapping_type wrapping_type;
-        for (std::size_t i = 0; i != count; ++i)
-        {
-            ids.emplace_back(create<wrapping_type>());
-        }
+        std::vector<naming::gid_type> ids =
+            components::server::bulk_create<wrapping_type>(count);
 
         LRT_(info).format("successfully created {} component(s) of type: {}",
             count, components::get_component_type_name(type));
@@ -447,14 +442,9 @@ namespace hpx::components::server {
         components::component_type const type =
             components::get_component_type<typename Component::wrapped_type>();
 
-        std::vector<naming::gid_type> ids;
-        ids.reserve(count);
-
         typedef typename Component::wrapping_type wrapping_type;
-        for (std::size_t i = 0; i != count; ++i)
-        {
-            ids.push_back(create<wrapping_type>(v, vs...));
-        }
+        std::vector<naming::gid_type> ids =
+            components::server::bulk_create<wrapping_type>(count, v, vs...);
 
         LRT_(info).format("successfully created {} component(s) of type: {}",
             count, components::get_component_type_name(type));
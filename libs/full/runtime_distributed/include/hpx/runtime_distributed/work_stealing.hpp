@@ -0,0 +1,178 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file work_stealing.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/action_priority.hpp>
+#include <hpx/actions_base/action_stacksize.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/actions_base/traits/action_is_stealable.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/post.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/async_distributed/put_parcel.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::distributed {
+
+    /// The parameters controlling the work stealing between localities. The
+    /// defaults are read from the configuration section [hpx.work_stealing].
+    struct work_stealing_parameters
+    {
+        /// The time between two gossip rounds in milliseconds
+        /// (hpx.work_stealing.interval, default: 10ms)
+        std::int64_t interval = 10;
+
+        /// The number of randomly chosen localities the load information is
+        /// sent to in each gossip round (hpx.work_stealing.fanout, default: 2)
+        std::size_t fanout = 2;
+
+        /// The maximal number of load entries of other localities forwarded
+        /// in one gossip message (hpx.work_stealing.gossip_size, default: 8)
+        std::size_t gossip_size = 8;
+
+        /// The maximal number of tasks handed out in reply to one steal
+        /// request (hpx.work_stealing.max_batch, default: 64)
+        std::size_t max_batch = 64;
+
+        /// A locality without queued stealable tasks requests work from
+        /// others if its load does not exceed this value
+        /// (hpx.work_stealing.idle_threshold, default: 0)
+        std::int64_t idle_threshold = 0;
+
+        /// The performance counter used to estimate the load of a locality,
+        /// '*' is replaced by the locality id
+        /// (hpx.work_stealing.load_counter, default: the number of pending
+        /// HPX threads)
+        std::string load_counter =
+            "/threads{locality#*/total}/count/instantaneous/pending";
+
+        /// Create the parameters from the runtime configuration
+        static work_stealing_parameters from_config()
+        {
+            work_stealing_parameters params;
+            params.interval = hpx::util::from_string<std::int64_t>(
+                hpx::get_config_entry("hpx.work_stealing.interval", ""),
+                params.interval);
+            params.fanout = hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry("hpx.work_stealing.fanout", ""),
+                params.fanout);
+            params.gossip_size = hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry("hpx.work_stealing.gossip_size", ""),
+                params.gossip_size);
+            params.max_batch = hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry("hpx.work_stealing.max_batch", ""),
+                params.max_batch);
+            params.idle_threshold = hpx::util::from_string<std::int64_t>(
+                hpx::get_config_entry("hpx.work_stealing.idle_threshold", ""),
+                params.idle_threshold);
+            params.load_counter = hpx::get_config_entry(
+                "hpx.work_stealing.load_counter", params.load_counter);
+            return params;
+        }
+    };
+
+    /// The number of stealable tasks handled by this locality
+    struct work_stealing_statistics
+    {
+        /// The number of stealable tasks posted on this locality
+        std::uint64_t posted = 0;
+
+        /// The number of tasks this locality has stolen from others
+        std::uint64_t stolen = 0;
+
+        /// The number of tasks other localities have stolen from this one
+        std::uint64_t donated = 0;
+
+        /// The number of steal requests sent by this locality
+        std::uint64_t steal_requests = 0;
+    };
+
+    /// Return whether work stealing between localities is enabled
+    /// (hpx.work_stealing.enabled)
+    HPX_EXPORT bool is_work_stealing_enabled() noexcept;
+
+    /// Return the work stealing statistics of this locality
+    HPX_EXPORT work_stealing_statistics get_work_stealing_statistics();
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+#if defined(HPX_HAVE_NETWORKING)
+        HPX_EXPORT void enqueue_stealable(hpx::parcelset::parcel&& p);
+#endif
+        HPX_EXPORT void start_work_stealing(
+            work_stealing_parameters const& params);
+        HPX_EXPORT void stop_work_stealing();
+    }    // namespace detail
+    /// \endcond
+
+    /// Invoke the given stealable plain action asynchronously. The
+    /// invocation is queued on this locality and is executed here unless an
+    /// idle locality steals it first. Other localities learn about the
+    /// number of queued tasks through a gossip protocol and request batches
+    /// of them if their own load (see work_stealing_parameters) drops to the
+    /// idle threshold. Stolen tasks are executed right away, they are not
+    /// stolen again. If work stealing is disabled, this is equivalent to
+    /// hpx::post<Action>(hpx::find_here(), vs...).
+    ///
+    /// \tparam Action  The plain action to invoke, it has to be marked as
+    ///                 stealable using HPX_ACTION_IS_STEALABLE. Its arguments
+    ///                 should not refer to objects local to this locality.
+    template <typename Action, typename... Ts>
+    void post_stealable(Ts&&... vs)
+    {
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+
+        static_assert(hpx::traits::action_is_stealable_v<action_type>,
+            "post_stealable requires an action which is marked as stealable "
+            "(see HPX_ACTION_IS_STEALABLE)");
+        static_assert(std::is_same_v<typename action_type::component_type,
+                          hpx::actions::detail::plain_function>,
+            "only plain actions can be stolen by other localities");
+
+#if defined(HPX_HAVE_NETWORKING)
+        if (is_work_stealing_enabled())
+        {
+            // the task is wrapped into a parcel addressed to this locality,
+            // a thief retargets it before scheduling it
+            naming::gid_type const here = agas::get_locality();
+            naming::gid_type dest = here;
+
+            constexpr hpx::launch::async_policy policy(
+                actions::action_priority<action_type>(),
+                actions::action_stacksize<action_type>());
+
+            detail::enqueue_stealable(parcelset::detail::create_parcel::call(
+                HPX_MOVE(dest),
+                naming::address(
+                    here, components::component_plain_function, nullptr),
+                action_type(), policy, HPX_FORWARD(Ts, vs)...));
+            return;
+        }
+#endif
+        hpx::post<action_type>(hpx::find_here(), HPX_FORWARD(Ts, vs)...);
+    }
+}    // namespace hpx::distributed
@@ -35,7 +35,9 @@
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -416,9 +418,28 @@ namespace hpx::agas {
         }
     };
 
+    // This structure is used to distribute the responses from node zero
+    // through a tree (first roundtrip), the first header is the one of the
+    // receiving locality, the others are forwarded to its subtree
+    struct notification_tree_header
+    {
+        std::vector<notification_header> headers;
+        std::vector<parcelset::endpoints_type> endpoints;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int)
+        {
+            // clang-format off
+            ar & headers;
+            ar & endpoints;
+            // clang-format on
+        }
+    };
+
     // {{{ early action forwards
     void register_worker(registration_header const& header);
     void notify_worker(notification_header const& header);
+    void notify_worker_tree(notification_tree_header const& header);
     // }}}
 
     // {{{ early action types
@@ -429,19 +450,27 @@ namespace hpx::agas {
     using notify_worker_action =
         actions::direct_action<void (*)(notification_header const&),
             notify_worker>;
+
+    using notify_worker_tree_action =
+        actions::direct_action<void (*)(notification_tree_header const&),
+            notify_worker_tree>;
     // }}}
 }    // namespace hpx::agas
 
 using hpx::agas::notify_worker_action;
+using hpx::agas::notify_worker_tree_action;
 using hpx::agas::register_worker_action;
 
 HPX_ACTION_HAS_CRITICAL_PRIORITY(register_worker_action)
 HPX_ACTION_HAS_CRITICAL_PRIORITY(notify_worker_action)
+HPX_ACTION_HAS_CRITICAL_PRIORITY(notify_worker_tree_action)
 
 HPX_REGISTER_ACTION_ID(register_worker_action, register_worker_action,
     hpx::actions::register_worker_action_id)
 HPX_REGISTER_ACTION_ID(notify_worker_action, notify_worker_action,
     hpx::actions::notify_worker_action_id)
+HPX_REGISTER_ACTION_ID(notify_worker_tree_action, notify_worker_tree_action,
+    hpx::actions::notify_worker_tree_action_id)
 
 namespace hpx::agas {
 
@@ -544,6 +573,13 @@ namespace hpx::agas {
                 notify_worker_action(), HPX_MOVE(hdr));
         }
 
+        else if (bbb.get_tree_arity() != 0)
+        {
+            // AGAS is starting up; the responses to all localities
+            // participating in startup synchronization are sent through a
+            // tree once the runtime system is up and running
+            bbb.add_notification(HPX_MOVE(hdr));
+        }
         else
         {
             // AGAS is starting up; this locality is participating in startup
@@ -621,6 +657,25 @@ namespace hpx::agas {
         // pre-cache all known locality endpoints in local AGAS
         agas_client.pre_cache_endpoints(header.endpoints);
     }
+
+    // AGAS callback to client distributed through the tree of localities
+    // (first round trip response)
+    void notify_worker_tree(notification_tree_header const& header)
+    {
+        HPX_ASSERT(!header.headers.empty());
+
+        // pass the notifications on to our subtree first, so that the
+        // localities further down are notified as early as possible
+        big_boot_barrier& bbb = get_big_boot_barrier();
+        std::uint32_t const locality_id =
+            naming::get_locality_id_from_gid(header.headers.front().prefix);
+        bbb.apply_notification_tree(locality_id, header.headers, 1,
+            header.headers.size(), header.endpoints);
+
+        notification_header hdr = header.headers.front();
+        hdr.endpoints = header.endpoints;
+        notify_worker(hdr);
+    }
     // }}}
 
     void big_boot_barrier::apply_notification(std::uint32_t source_locality_id,
@@ -632,6 +687,59 @@ namespace hpx::agas {
             notify_worker_action(), HPX_MOVE(hdr));
     }
 
+    namespace detail {
+
+        // select the endpoint of the given locality which is reachable
+        // through the same parcelport as the given one
+        parcelset::locality get_locality_endpoint(
+            std::vector<parcelset::endpoints_type> const& endpoints,
+            std::uint32_t locality_id, parcelset::locality const& here)
+        {
+            HPX_ASSERT(locality_id < endpoints.size());
+            for (auto const& loc : endpoints[locality_id])
+            {
+                if (loc.second.type() == here.type())
+                {
+                    return loc.second;
+                }
+            }
+            return parcelset::locality();
+        }
+    }    // namespace detail
+
+    void big_boot_barrier::apply_notification_tree(
+        std::uint32_t source_locality_id,
+        std::vector<notification_header> const& headers, std::size_t first,
+        std::size_t last,
+        std::vector<parcelset::endpoints_type> const& endpoints_data)
+    {
+        HPX_ASSERT(tree_arity != 0 && first <= last);
+
+        std::size_t const chunk_size =
+            (last - first + tree_arity - 1) / tree_arity;
+        for (std::size_t begin = first; begin < last; begin += chunk_size)
+        {
+            std::size_t const end = (std::min)(begin + chunk_size, last);
+
+            notification_tree_header tree;
+            tree.headers.assign(headers.begin() + begin, headers.begin() + end);
+            tree.endpoints = endpoints_data;
+
+            std::uint32_t const target_locality_id =
+                naming::get_locality_id_from_gid(headers[begin].prefix);
+            apply(source_locality_id, target_locality_id,
+                detail::get_locality_endpoint(
+                    endpoints_data, target_locality_id, bootstrap_agas),
+                notify_worker_tree_action(), HPX_MOVE(tree));
+        }
+    }
+
+    void big_boot_barrier::add_notification(notification_header&& hdr)
+    {
+        // the caller holds the lock
+        notifications.push_back(HPX_MOVE(hdr));
+    }
+
     void big_boot_barrier::add_locality_endpoints(std::uint32_t locality_id,
         parcelset::endpoints_type const& endpoints_data)
     {
@@ -685,6 +793,8 @@ namespace hpx::agas {
       , mtx()
       , connected(get_number_of_bootstrap_connections(ini_))
       , thunks(32)    //-V112
+      , tree_arity(hpx::util::get_entry_as<std::size_t>(
+            ini_, "hpx.bootstrap_tree_arity", 0))
     {
         // register all not registered typenames
         if (service_type == service_mode::bootstrap)
@@ -695,6 +805,13 @@ namespace hpx::agas {
         }
     }
 
+    big_boot_barrier::~big_boot_barrier()
+    {
+        hpx::move_only_function<void()>* f;
+        while (thunks.pop(f))
+            delete f;
+    }
+
     void big_boot_barrier::wait_bootstrap()
     {    // {{{
         HPX_ASSERT(service_mode::bootstrap == service_type);
@@ -808,6 +925,25 @@ namespace hpx::agas {
                 }
                 delete p;
             }
+
+            // send the delayed notifications down the tree, the localities
+            // are ordered by their id
+            if (!notifications.empty())
+            {
+                std::vector<notification_header> headers;
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    headers.swap(notifications);
+                }
+
+                std::sort(headers.begin(), headers.end(),
+                    [](notification_header const& lhs,
+                        notification_header const& rhs) {
+                        return lhs.prefix < rhs.prefix;
+                    });
+                apply_notification_tree(
+                    0, headers, 0, headers.size(), localities);
+            }
         }
     }
 
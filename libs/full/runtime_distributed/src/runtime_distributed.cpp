@@ -50,6 +50,7 @@
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #include <hpx/runtime_distributed/server/runtime_support.hpp>
+#include <hpx/runtime_distributed/work_stealing.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -396,6 +397,14 @@ namespace hpx {
                 error_code ec(throwmode::lightweight);    // ignore errors
                 evaluate_active_counters(reset, "startup", ec);
             }
+
+            // start stealing stealable actions between localities, if
+            // requested
+            if (get_config_entry("hpx.work_stealing.enabled", "0") == "1")
+            {
+                hpx::distributed::detail::start_work_stealing(
+                    hpx::distributed::work_stealing_parameters::from_config());
+            }
         }
         catch (...)
         {
@@ -1353,9 +1362,16 @@ namespace hpx {
 
         notification_policy_type notifier;
 
+        // the threads of the service pools are bound separately from the
+        // worker threads
+        bool const service_thread =
+            type == runtime_local::os_thread_type::io_thread ||
+            type == runtime_local::os_thread_type::timer_thread ||
+            type == runtime_local::os_thread_type::parcel_thread;
+
         notifier.add_on_start_thread_callback(
             hpx::bind(&runtime_distributed::init_tss_helper, this, prefix, type,
-                _1, _2, _3, _4, false));
+                _1, _2, _3, _4, service_thread));
         notifier.add_on_stop_thread_callback(hpx::bind(
             &runtime_distributed::deinit_tss_helper, this, prefix, _1));
         notifier.set_on_error_callback(hpx::bind(
@@ -1438,12 +1454,19 @@ namespace hpx {
                 thread_manager_->get_used_processing_units();
 
             // --hpx:bind=none  should disable all affinity definitions
-            if (threads::any(used_processing_units))
+            if (threads::any(used_processing_units) &&
+                resource::is_partitioner_valid())
             {
-                this->topology_.set_thread_affinity_mask(
-                    this->topology_.get_service_affinity_mask(
-                        used_processing_units),
-                    ec);
+                // the binding can be configured using the resource
+                // partitioner or hpx.service_affinity (none leaves the
+                // threads unbound)
+                threads::mask_type const service_mask =
+                    resource::get_partitioner().get_service_affinity_mask(
+                        pool_name ? pool_name : "", used_processing_units);
+                if (threads::any(service_mask))
+                {
+                    this->topology_.set_thread_affinity_mask(service_mask, ec);
+                }
 
                 // comment this out for now as on CircleCI this is causing unending grief
                 //if (ec)
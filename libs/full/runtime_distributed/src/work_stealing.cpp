@@ -0,0 +1,485 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_distributed/work_stealing.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/post.hpp>
+#include <hpx/async_local/post.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/naming_base/naming_base.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The load of a locality as reported by the locality itself
+    struct locality_load
+    {
+        std::uint32_t locality = naming::invalid_locality_id;
+
+        // the value of the load counter
+        std::int64_t load = 0;
+
+        // the number of queued stealable tasks
+        std::uint64_t stealable = 0;
+
+        // incremented by the locality for every new report, newer reports
+        // replace older ones
+        std::uint64_t epoch = 0;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & locality & load & stealable & epoch;
+            // clang-format on
+        }
+    };
+
+    void work_stealing_gossip(std::vector<locality_load> const& entries);
+    std::vector<hpx::parcelset::parcel> work_stealing_steal(
+        std::uint64_t max_tasks);
+}    // namespace hpx::distributed::detail
+
+HPX_PLAIN_ACTION(hpx::distributed::detail::work_stealing_gossip,
+    work_stealing_gossip_action)
+HPX_PLAIN_ACTION(hpx::distributed::detail::work_stealing_steal,
+    work_stealing_steal_action)
+
+namespace hpx::distributed::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The stealable tasks queued on this locality and the load of all
+    // localities known to this one. Every locality periodically sends its
+    // own load and the entries of the localities with the most stealable
+    // tasks it knows about to a few randomly chosen localities. An idle
+    // locality requests a batch of tasks from the locality with the most
+    // stealable tasks. The victim hands out the most recently queued tasks,
+    // as the oldest ones are executed next on the victim itself.
+    class work_stealing
+    {
+        using mutex_type = hpx::spinlock;
+
+    public:
+        bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        void start(work_stealing_parameters const& params)
+        {
+            if (enabled_.load())
+            {
+                return;
+            }
+
+            here_ = agas::get_locality_id();
+            params_ = params;
+
+            std::string counter_name = params_.load_counter;
+            std::string::size_type const pos = counter_name.find('*');
+            if (pos != std::string::npos)
+            {
+                counter_name.replace(pos, 1, std::to_string(here_));
+            }
+            load_counter_ =
+                hpx::performance_counters::performance_counter(counter_name);
+
+            for (hpx::id_type const& locality : hpx::find_all_localities())
+            {
+                std::uint32_t const id =
+                    naming::get_locality_id_from_id(locality);
+                if (id != here_)
+                {
+                    peers_.push_back(locality);
+                }
+                if (id >= view_.size())
+                {
+                    view_.resize(static_cast<std::size_t>(id) + 1);
+                }
+            }
+            rng_.seed(here_);
+
+            enabled_.store(true);
+
+            timer_ = std::make_unique<hpx::util::interval_timer>(
+                [this]() {
+                    round();
+                    return true;
+                },
+                params_.interval * 1000, "hpx::distributed::work_stealing",
+                true);
+            timer_->start(false);
+        }
+
+        void stop()
+        {
+            if (!enabled_.exchange(false))
+            {
+                return;
+            }
+
+            timer_->stop(true);
+
+            // the queued tasks are still executed on this locality
+            std::lock_guard<mutex_type> l(mtx_);
+            load_counter_ = hpx::performance_counters::performance_counter();
+            peers_.clear();
+        }
+
+        void enqueue(hpx::parcelset::parcel&& p)
+        {
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                tasks_.push_back(HPX_MOVE(p));
+            }
+            ++posted_;
+
+            // every queued task is matched by one HPX thread executing the
+            // oldest queued task, if any is left
+            hpx::post([this]() {
+                hpx::parcelset::parcel p;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (tasks_.empty())
+                    {
+                        return;    // stolen in the meantime
+                    }
+                    p = HPX_MOVE(tasks_.front());
+                    tasks_.pop_front();
+                }
+                p.schedule_action();
+            });
+        }
+
+        std::vector<hpx::parcelset::parcel> donate(std::uint64_t max_tasks)
+        {
+            std::vector<hpx::parcelset::parcel> tasks;
+            if (!enabled())
+            {
+                return tasks;
+            }
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                // keep at least half of the queued tasks
+                std::size_t const count =
+                    (std::min)(static_cast<std::size_t>(max_tasks),
+                        (std::min)(params_.max_batch, tasks_.size() / 2));
+
+                tasks.reserve(count);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    tasks.push_back(HPX_MOVE(tasks_.back()));
+                    tasks_.pop_back();
+                }
+            }
+
+            donated_ += tasks.size();
+            return tasks;
+        }
+
+        void merge(std::vector<locality_load> const& entries)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            for (locality_load const& entry : entries)
+            {
+                if (entry.locality == here_)
+                {
+                    continue;
+                }
+                if (entry.locality >= view_.size())
+                {
+                    view_.resize(static_cast<std::size_t>(entry.locality) + 1);
+                }
+
+                locality_load& known = view_[entry.locality];
+                if (known.locality == naming::invalid_locality_id ||
+                    known.epoch < entry.epoch)
+                {
+                    known = entry;
+                }
+            }
+        }
+
+        work_stealing_statistics statistics() const
+        {
+            work_stealing_statistics stats;
+            stats.posted = posted_.load();
+            stats.stolen = stolen_.load();
+            stats.donated = donated_.load();
+            stats.steal_requests = steal_requests_.load();
+            return stats;
+        }
+
+    private:
+        // one gossip round, invoked periodically
+        void round()
+        {
+            if (!enabled())
+            {
+                return;
+            }
+
+            hpx::performance_counters::performance_counter counter;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                counter = load_counter_;
+            }
+
+            if (!counter.valid())
+            {
+                return;
+            }
+
+            std::int64_t load = 0;
+            try
+            {
+                load = counter.get_value<std::int64_t>(hpx::launch::sync);
+            }
+            catch (hpx::exception const&)
+            {
+                return;    // the counter is not available (yet)
+            }
+
+            std::vector<locality_load> entries;
+            std::vector<hpx::id_type> targets;
+            std::uint32_t victim = naming::invalid_locality_id;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                locality_load const own{
+                    here_, load, tasks_.size(), ++epoch_};
+                entries.push_back(own);
+
+                // forward what is known about the localities with the most
+                // stealable tasks
+                std::vector<locality_load> candidates;
+                for (locality_load const& entry : view_)
+                {
+                    if (entry.locality != naming::invalid_locality_id &&
+                        entry.stealable != 0)
+                    {
+                        candidates.push_back(entry);
+                    }
+                }
+                std::sort(candidates.begin(), candidates.end(),
+                    [](locality_load const& lhs, locality_load const& rhs) {
+                        return lhs.stealable > rhs.stealable;
+                    });
+                if (candidates.size() > params_.gossip_size)
+                {
+                    candidates.resize(params_.gossip_size);
+                }
+                entries.insert(
+                    entries.end(), candidates.begin(), candidates.end());
+
+                // a locality is asked for work only if it has queued at
+                // least two tasks, the victim keeps half of them
+                if (own.stealable == 0 && load <= params_.idle_threshold &&
+                    !candidates.empty() && candidates.front().stealable > 1)
+                {
+                    victim = candidates.front().locality;
+                }
+
+                std::size_t const fanout =
+                    (std::min)(params_.fanout, peers_.size());
+                for (std::size_t i = 0; i != fanout; ++i)
+                {
+                    // partial Fisher-Yates shuffle of the peers
+                    std::uniform_int_distribution<std::size_t> dist(
+                        i, peers_.size() - 1);
+                    std::swap(peers_[i], peers_[dist(rng_)]);
+                    targets.push_back(peers_[i]);
+                }
+            }
+
+            for (hpx::id_type const& target : targets)
+            {
+                hpx::post<work_stealing_gossip_action>(target, entries);
+            }
+
+            if (victim != naming::invalid_locality_id)
+            {
+                steal(victim);
+            }
+        }
+
+        void steal(std::uint32_t victim)
+        {
+            // at most one steal request is in flight at any time
+            if (steal_pending_.exchange(true))
+            {
+                return;
+            }
+            ++steal_requests_;
+
+            hpx::async<work_stealing_steal_action>(
+                naming::get_id_from_locality_id(victim),
+                static_cast<std::uint64_t>(params_.max_batch))
+                .then(hpx::launch::sync,
+                    [this, victim](
+                        hpx::future<std::vector<hpx::parcelset::parcel>>&& f) {
+                        std::vector<hpx::parcelset::parcel> tasks;
+                        if (!f.has_exception())
+                        {
+                            tasks = f.get();
+                        }
+
+                        {
+                            // don't ask the same locality again before it
+                            // reported its load anew
+                            std::lock_guard<mutex_type> l(mtx_);
+                            view_[victim].stealable = 0;
+                        }
+
+                        stolen_ += tasks.size();
+                        steal_pending_.store(false);
+
+                        naming::gid_type const here = agas::get_locality();
+                        for (hpx::parcelset::parcel& p : tasks)
+                        {
+                            // stolen tasks are executed right away
+                            p.set_destination_id(naming::gid_type(here));
+                            p.addr().locality_ = here;
+                            p.schedule_action();
+                        }
+                    });
+        }
+
+        mutable mutex_type mtx_;
+        std::deque<hpx::parcelset::parcel> tasks_;
+
+        // the most recent load reported by each locality, indexed by the
+        // locality id
+        std::vector<locality_load> view_;
+        std::vector<hpx::id_type> peers_;
+        std::uint32_t here_ = naming::invalid_locality_id;
+        std::uint64_t epoch_ = 0;
+        std::mt19937 rng_;
+
+        work_stealing_parameters params_;
+        hpx::performance_counters::performance_counter load_counter_;
+        std::unique_ptr<hpx::util::interval_timer> timer_;
+
+        std::atomic<bool> enabled_{false};
+        std::atomic<bool> steal_pending_{false};
+        std::atomic<std::uint64_t> posted_{0};
+        std::atomic<std::uint64_t> stolen_{0};
+        std::atomic<std::uint64_t> donated_{0};
+        std::atomic<std::uint64_t> steal_requests_{0};
+    };
+
+    work_stealing& get_work_stealing()
+    {
+        static work_stealing instance;
+        return instance;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void work_stealing_gossip(std::vector<locality_load> const& entries)
+    {
+        work_stealing& ws = get_work_stealing();
+        if (ws.enabled())
+        {
+            ws.merge(entries);
+        }
+    }
+
+    std::vector<hpx::parcelset::parcel> work_stealing_steal(
+        std::uint64_t max_tasks)
+    {
+        return get_work_stealing().donate(max_tasks);
+    }
+
+    void enqueue_stealable(hpx::parcelset::parcel&& p)
+    {
+        work_stealing& ws = get_work_stealing();
+        if (!ws.enabled())
+        {
+            // work stealing was stopped in the meantime
+            p.schedule_action();
+            return;
+        }
+        ws.enqueue(HPX_MOVE(p));
+    }
+
+    void start_work_stealing(work_stealing_parameters const& params)
+    {
+        get_work_stealing().start(params);
+        hpx::register_pre_shutdown_function(&stop_work_stealing);
+    }
+
+    void stop_work_stealing()
+    {
+        get_work_stealing().stop();
+    }
+}    // namespace hpx::distributed::detail
+
+namespace hpx::distributed {
+
+    bool is_work_stealing_enabled() noexcept
+    {
+        return detail::get_work_stealing().enabled();
+    }
+
+    work_stealing_statistics get_work_stealing_statistics()
+    {
+        return detail::get_work_stealing().statistics();
+    }
+}    // namespace hpx::distributed
+
+#else
+
+namespace hpx::distributed {
+
+    bool is_work_stealing_enabled() noexcept
+    {
+        return false;
+    }
+
+    work_stealing_statistics get_work_stealing_statistics()
+    {
+        return {};
+    }
+
+    namespace detail {
+
+        void start_work_stealing(work_stealing_parameters const&) {}
+
+        void stop_work_stealing() {}
+    }    // namespace detail
+}    // namespace hpx::distributed
+
+#endif
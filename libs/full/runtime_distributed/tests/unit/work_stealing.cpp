@@ -0,0 +1,111 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/runtime_distributed.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_tasks = 1000;
+
+std::mutex mtx;
+std::vector<std::size_t> executed(num_tasks, 0);
+std::vector<std::size_t> executed_on;
+std::size_t num_executed = 0;
+
+// invoked on locality 0 for every finished task
+void task_done(std::size_t i, std::uint32_t locality)
+{
+    std::lock_guard<std::mutex> l(mtx);
+    ++executed[i];
+    if (locality >= executed_on.size())
+    {
+        executed_on.resize(static_cast<std::size_t>(locality) + 1);
+    }
+    ++executed_on[locality];
+    ++num_executed;
+}
+HPX_PLAIN_ACTION(task_done, task_done_action)
+
+void stealable_task(std::size_t i)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    hpx::post<task_done_action>(
+        hpx::naming::get_id_from_locality_id(0), i, hpx::get_locality_id());
+}
+HPX_PLAIN_ACTION(stealable_task, stealable_task_action)
+HPX_ACTION_IS_STEALABLE(stealable_task_action)
+
+static_assert(hpx::traits::action_is_stealable_v<stealable_task_action>);
+static_assert(!hpx::traits::action_is_stealable_v<task_done_action>);
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST(hpx::distributed::is_work_stealing_enabled());
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::distributed::post_stealable<stealable_task_action>(i);
+    }
+
+    // wait for all tasks to report back
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx);
+            if (num_executed == num_tasks)
+            {
+                break;
+            }
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // every task was executed exactly once, no matter where
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        HPX_TEST_EQ(executed[i], std::size_t(1));
+    }
+
+    hpx::distributed::work_stealing_statistics const stats =
+        hpx::distributed::get_work_stealing_statistics();
+    HPX_TEST_EQ(stats.posted, static_cast<std::uint64_t>(num_tasks));
+    HPX_TEST_EQ(stats.stolen, std::uint64_t(0));
+
+    // all tasks executed elsewhere were donated by this locality
+    std::size_t const executed_here = executed_on.empty() ? 0 : executed_on[0];
+    HPX_TEST_EQ(stats.donated,
+        static_cast<std::uint64_t>(num_tasks - executed_here));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.work_stealing.enabled=1", "hpx.work_stealing.interval=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -12,9 +12,14 @@
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/vector.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -22,10 +27,15 @@
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace parallel { namespace detail {
 
@@ -341,4 +351,191 @@ namespace hpx { namespace parallel { namespace detail {
         }
         return f.get();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Resolve the addresses of all segments in [sit, send] with a single
+    // AGAS request per owning locality before the segments are visited one
+    // by one. Failures are ignored, the addresses will be resolved on demand
+    // in this case.
+    template <typename Traits, typename SegIter>
+    void prefetch_segments(SegIter sit, SegIter send)
+    {
+        std::vector<id_type> ids;
+        for (/**/; sit != send; ++sit)
+        {
+            ids.push_back(Traits::get_id(sit));
+        }
+        ids.push_back(Traits::get_id(send));
+
+        hpx::agas::prefetch(ids).wait();
+    }
+    ///////////////////////////////////////////////////////////////////////////
+    // The (partial) segments of a segmented range located on the same
+    // locality
+    template <typename LocalIter>
+    struct locality_segments
+    {
+        id_type id_;
+        std::vector<LocalIter> first_;
+        std::vector<LocalIter> last_;
+    };
+
+    // Group the non-empty (partial) segments of the range [first, last) by
+    // the locality they are located on, the segments of each locality are
+    // listed in the order they appear in the range.
+    template <typename SegIterB, typename SegIterE>
+    std::vector<locality_segments<typename hpx::traits::
+            segmented_iterator_traits<SegIterB>::local_iterator>>
+    group_segments_by_locality(SegIterB first, SegIterE last)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIterB>;
+        using segment_iterator = typename traits::segment_iterator;
+        using local_iterator_type = typename traits::local_iterator;
+
+        std::vector<locality_segments<local_iterator_type>> result;
+        std::vector<std::uint32_t> localities;
+
+        auto add_segment = [&](segment_iterator const& sit,
+                               local_iterator_type const& beg,
+                               local_iterator_type const& end) {
+            if (beg == end)
+            {
+                return;
+            }
+
+            id_type id = traits::get_id(sit);
+            std::uint32_t const locality =
+                naming::get_locality_id_from_id(id);
+
+            auto it =
+                std::find(localities.begin(), localities.end(), locality);
+            if (it == localities.end())
+            {
+                localities.push_back(locality);
+                result.push_back(
+                    locality_segments<local_iterator_type>{HPX_MOVE(id)});
+                it = std::prev(localities.end());
+            }
+
+            auto& segments = result[std::distance(localities.begin(), it)];
+            segments.first_.push_back(beg);
+            segments.last_.push_back(end);
+        };
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            add_segment(sit, traits::local(first), traits::local(last));
+        }
+        else
+        {
+            // handle the remaining part of the first partition, all of the
+            // full partitions, and the beginning of the last partition
+            add_segment(sit, traits::local(first), traits::end(sit));
+            for (++sit; sit != send; ++sit)
+            {
+                add_segment(sit, traits::begin(sit), traits::end(sit));
+            }
+            add_segment(sit, traits::begin(sit), traits::local(last));
+        }
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run an algorithm on all given segments of one locality and combine
+    // the results using the given reduction operation. The segments are
+    // processed concurrently unless the execution is sequential.
+    template <typename Algo, typename ExPolicy, typename IsSeq, typename R,
+        typename LocalIter, typename Reduce, typename... Args>
+    struct fused_reduce_dispatcher
+    {
+        using segment_dispatcher =
+            dispatcher<Algo, ExPolicy, LocalIter, LocalIter, Args...>;
+
+        static R call(Algo const& algo, ExPolicy policy,
+            std::vector<LocalIter> first, std::vector<LocalIter> last,
+            Reduce red_op, Args... args)
+        {
+            HPX_ASSERT(!first.empty() && first.size() == last.size());
+
+            if constexpr (IsSeq::value)
+            {
+                R result = segment_dispatcher::sequential(
+                    algo, policy, first[0], last[0], args...);
+                for (std::size_t i = 1; i != first.size(); ++i)
+                {
+                    result = HPX_INVOKE(red_op, HPX_MOVE(result),
+                        segment_dispatcher::sequential(
+                            algo, policy, first[i], last[i], args...));
+                }
+                return result;
+            }
+            else
+            {
+                std::vector<hpx::future<R>> results;
+                results.reserve(first.size());
+                for (std::size_t i = 0; i != first.size(); ++i)
+                {
+                    results.push_back(hpx::async([&, i]() -> R {
+                        return segment_dispatcher::parallel(
+                            algo, policy, first[i], last[i], args...);
+                    }));
+                }
+                hpx::wait_all(results);
+
+                // handle any exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(results, errors);
+
+                R result = results[0].get();
+                for (std::size_t i = 1; i != results.size(); ++i)
+                {
+                    result = HPX_INVOKE(
+                        red_op, HPX_MOVE(result), results[i].get());
+                }
+                return result;
+            }
+        }
+    };
+
+    template <typename Algo, typename ExPolicy, typename IsSeq, typename R,
+        typename LocalIter, typename Reduce, typename... Args>
+    struct fused_reduce_action
+      : hpx::actions::make_action<R (*)(Algo const&, ExPolicy,
+                                      std::vector<LocalIter>,
+                                      std::vector<LocalIter>, Reduce, Args...),
+            &fused_reduce_dispatcher<Algo, ExPolicy, IsSeq, R, LocalIter,
+                Reduce, Args...>::call,
+            fused_reduce_action<Algo, ExPolicy, IsSeq, R, LocalIter, Reduce,
+                Args...>>::type
+    {
+    };
+
+    // Invoke the algorithm on all segments of one locality using a single
+    // remote operation, the results of the segments are combined on the
+    // remote locality before being sent back.
+    template <typename Algo, typename ExPolicy, typename IsSeq,
+        typename LocalIter, typename Reduce, typename... Args>
+    future<typename std::decay_t<Algo>::result_type>
+    dispatch_fused_reduce_async(locality_segments<LocalIter> const& segments,
+        Algo&& algo, ExPolicy const& policy, IsSeq, Reduce&& red_op,
+        Args&&... args)
+    {
+        using algo_type = std::decay_t<Algo>;
+        using policy_type = decltype(policy(hpx::execution::non_task));
+        using result_type = typename algo_type::result_type;
+
+        fused_reduce_action<algo_type, policy_type, typename IsSeq::type,
+            result_type, LocalIter, std::decay_t<Reduce>, std::decay_t<Args>...>
+            act;
+
+        return hpx::async(act, hpx::colocated(segments.id_),
+            HPX_FORWARD(Algo, algo), policy(hpx::execution::non_task),
+            segments.first_, segments.last_, HPX_FORWARD(Reduce, red_op),
+            HPX_FORWARD(Args, args)...);
+    }
 }}}    // namespace hpx::parallel::detail
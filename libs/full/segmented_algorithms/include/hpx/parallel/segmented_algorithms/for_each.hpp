@@ -62,6 +62,8 @@ namespace hpx { namespace parallel {
             }
             else
             {
+                prefetch_segments<traits>(sit, send);
+
                 // handle the remaining part of the first partition
                 local_iterator_type beg = traits::local(first);
                 local_iterator_type end = traits::end(sit);
@@ -137,6 +139,8 @@ namespace hpx { namespace parallel {
             }
             else
             {
+                prefetch_segments<traits>(sit, send);
+
                 // handle the remaining part of the first partition
                 local_iterator_type beg = traits::local(first);
                 local_iterator_type end = traits::end(sit);
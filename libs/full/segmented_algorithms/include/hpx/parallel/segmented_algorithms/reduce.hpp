@@ -14,7 +14,6 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
-#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/reduce.hpp>
@@ -112,63 +111,22 @@ namespace hpx { namespace parallel {
         segmented_reduce(Algo&& algo, ExPolicy const& policy, SegIterB first,
             SegIterE last, T&& init, Reduce&& red_op, std::false_type)
         {
-            typedef hpx::traits::segmented_iterator_traits<SegIterB> traits;
-            typedef typename traits::segment_iterator segment_iterator;
-            typedef typename traits::local_iterator local_iterator_type;
             typedef util::detail::algorithm_result<ExPolicy, T> result;
 
             typedef std::integral_constant<bool,
                 !hpx::traits::is_forward_iterator<SegIterB>::value>
                 forced_seq;
 
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
+            // fuse all segments located on the same locality into a single
+            // remote operation
+            auto const localities = group_segments_by_locality(first, last);
 
             std::vector<shared_future<T>> segments;
-            segments.reserve(detail::distance(sit, send));
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op));
-                }
-            }
-            else
+            segments.reserve(localities.size());
+            for (auto const& l : localities)
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op));
-                }
-
-                // handle all of the full partitions
-                for (++sit; sit != send; ++sit)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    if (beg != end)
-                    {
-                        segments.push_back(dispatch_async(traits::get_id(sit),
-                            algo, policy, forced_seq(), beg, end, red_op));
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op));
-                }
+                segments.push_back(dispatch_fused_reduce_async(
+                    l, algo, policy, forced_seq(), red_op, red_op));
             }
 
             return result::get(dataflow(
@@ -0,0 +1,640 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/std_tuple.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // A range of sorted elements of one segment, together with the id
+        // of the segment
+        template <typename LocalIter>
+        struct sort_piece
+        {
+            hpx::id_type id_;
+            LocalIter first_;
+            LocalIter last_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & id_ & first_ & last_;
+                // clang-format on
+            }
+        };
+
+        // A bucket is made up of one piece of each segment, only the part
+        // [lo_, hi_) of the merged bucket is used by the target segment
+        template <typename LocalIter>
+        struct sort_bucket
+        {
+            std::vector<sort_piece<LocalIter>> pieces_;
+            std::size_t lo_ = 0;
+            std::size_t hi_ = 0;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & pieces_ & lo_ & hi_;
+                // clang-format on
+            }
+        };
+
+        // The merged data of a target segment is held on the locality of
+        // the segment until all segments have received their data, only
+        // then the segments are overwritten.
+        using segmented_sort_key =
+            std::tuple<std::uint32_t, std::uint64_t, std::size_t>;
+
+        template <typename T>
+        class segmented_sort_buffers
+        {
+        public:
+            static segmented_sort_buffers& get()
+            {
+                static segmented_sort_buffers buffers;
+                return buffers;
+            }
+
+            void put(segmented_sort_key const& key, std::vector<T>&& data)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                buffers_[key] = HPX_MOVE(data);
+            }
+
+            std::vector<T> take(segmented_sort_key const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto it = buffers_.find(key);
+                HPX_ASSERT(it != buffers_.end());
+
+                std::vector<T> result = HPX_MOVE(it->second);
+                buffers_.erase(it);
+                return result;
+            }
+
+        private:
+            hpx::spinlock mtx_;
+            std::map<segmented_sort_key, std::vector<T>> buffers_;
+        };
+
+        // Sort the elements of a segment
+        struct segmented_sort_local
+          : public algorithm<segmented_sort_local, void>
+        {
+            constexpr segmented_sort_local() noexcept
+              : algorithm<segmented_sort_local, void>("segmented_sort_local")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static hpx::util::unused_type sequential(
+                ExPolicy, Iter first, Iter last, Comp&& comp, Proj&& proj)
+            {
+                sort<Iter>().call(hpx::execution::seq, first, last,
+                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
+                return {};
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static void parallel(ExPolicy&& policy, Iter first, Iter last,
+                Comp&& comp, Proj&& proj)
+            {
+                sort<Iter>().call(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
+            }
+        };
+
+        // Select count evenly spaced elements of a sorted segment
+        template <typename T>
+        struct segmented_sort_sample
+          : public algorithm<segmented_sort_sample<T>, std::vector<T>>
+        {
+            constexpr segmented_sort_sample() noexcept
+              : algorithm<segmented_sort_sample, std::vector<T>>(
+                    "segmented_sort_sample")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::vector<T> sequential(
+                ExPolicy, Iter first, Iter last, std::size_t count)
+            {
+                auto const size =
+                    static_cast<std::size_t>(std::distance(first, last));
+
+                std::vector<T> result;
+                result.reserve(count);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    result.push_back(*std::next(
+                        first, ((2 * i + 1) * size) / (2 * count)));
+                }
+                return result;
+            }
+        };
+
+        // Compute the offsets of the buckets defined by the splitters in a
+        // sorted segment
+        template <typename T>
+        struct segmented_sort_bounds
+          : public algorithm<segmented_sort_bounds<T>, std::vector<std::size_t>>
+        {
+            constexpr segmented_sort_bounds() noexcept
+              : algorithm<segmented_sort_bounds, std::vector<std::size_t>>(
+                    "segmented_sort_bounds")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static std::vector<std::size_t> sequential(ExPolicy, Iter first,
+                Iter last, std::vector<T> const& splitters, Comp&& comp,
+                Proj&& proj)
+            {
+                std::vector<std::size_t> result;
+                result.reserve(splitters.size() + 2);
+                result.push_back(0);
+
+                auto const cmp =
+                    util::compare_projected<Comp&, Proj&>(comp, proj);
+
+                Iter it = first;
+                for (T const& splitter : splitters)
+                {
+                    it = std::upper_bound(it, last, splitter, cmp);
+                    result.push_back(
+                        static_cast<std::size_t>(std::distance(first, it)));
+                }
+
+                result.push_back(
+                    static_cast<std::size_t>(std::distance(first, last)));
+                return result;
+            }
+        };
+
+        // Copy the elements of a piece
+        template <typename T>
+        struct segmented_sort_fetch
+          : public algorithm<segmented_sort_fetch<T>, std::vector<T>>
+        {
+            constexpr segmented_sort_fetch() noexcept
+              : algorithm<segmented_sort_fetch, std::vector<T>>(
+                    "segmented_sort_fetch")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static std::vector<T> sequential(ExPolicy, Iter first, Iter last)
+            {
+                return std::vector<T>(first, last);
+            }
+        };
+
+        template <typename R>
+        std::vector<R> segmented_sort_get(std::vector<hpx::future<R>>&& r)
+        {
+            hpx::wait_all(r);
+
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<
+                hpx::execution::parallel_policy>::call(r, errors);
+
+            return hpx::unwrap(HPX_MOVE(r));
+        }
+
+        inline void segmented_sort_get(std::vector<hpx::future<void>>&& r)
+        {
+            hpx::wait_all(r);
+
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<
+                hpx::execution::parallel_policy>::call(r, errors);
+        }
+
+        // Fetch and merge all buckets overlapping with a target segment,
+        // executed on the locality of the target segment
+        template <typename T, typename LocalIter>
+        struct segmented_sort_gather
+          : public algorithm<segmented_sort_gather<T, LocalIter>, void>
+        {
+            constexpr segmented_sort_gather() noexcept
+              : algorithm<segmented_sort_gather, void>("segmented_sort_gather")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp,
+                typename Proj>
+            static hpx::util::unused_type sequential(ExPolicy, Iter first,
+                Iter last, std::vector<sort_bucket<LocalIter>> const& buckets,
+                Comp&& comp, Proj&& proj, segmented_sort_key const& key)
+            {
+                auto const cmp =
+                    util::compare_projected<Comp&, Proj&>(comp, proj);
+
+                // request all pieces at once
+                std::vector<std::vector<hpx::future<std::vector<T>>>> pieces;
+                pieces.reserve(buckets.size());
+                for (sort_bucket<LocalIter> const& bucket : buckets)
+                {
+                    std::vector<hpx::future<std::vector<T>>> fetched;
+                    fetched.reserve(bucket.pieces_.size());
+                    for (sort_piece<LocalIter> const& piece : bucket.pieces_)
+                    {
+                        fetched.push_back(dispatch_async(piece.id_,
+                            segmented_sort_fetch<T>(), hpx::execution::seq,
+                            std::true_type(), piece.first_, piece.last_));
+                    }
+                    pieces.push_back(HPX_MOVE(fetched));
+                }
+
+                std::vector<T> result;
+                result.reserve(
+                    static_cast<std::size_t>(std::distance(first, last)));
+
+                for (std::size_t i = 0; i != buckets.size(); ++i)
+                {
+                    // each piece is sorted already
+                    std::vector<T> merged;
+                    for (std::vector<T>& values :
+                        segmented_sort_get(HPX_MOVE(pieces[i])))
+                    {
+                        auto const mid = merged.size();
+                        merged.insert(merged.end(),
+                            std::make_move_iterator(values.begin()),
+                            std::make_move_iterator(values.end()));
+                        std::inplace_merge(merged.begin(),
+                            std::next(merged.begin(), mid), merged.end(), cmp);
+                    }
+
+                    HPX_ASSERT(buckets[i].hi_ <= merged.size());
+                    result.insert(result.end(),
+                        std::make_move_iterator(
+                            std::next(merged.begin(), buckets[i].lo_)),
+                        std::make_move_iterator(
+                            std::next(merged.begin(), buckets[i].hi_)));
+                }
+
+                HPX_ASSERT(result.size() ==
+                    static_cast<std::size_t>(std::distance(first, last)));
+                segmented_sort_buffers<T>::get().put(key, HPX_MOVE(result));
+                return {};
+            }
+        };
+
+        // Move the merged data into a target segment, executed on the
+        // locality of the target segment
+        template <typename T>
+        struct segmented_sort_store
+          : public algorithm<segmented_sort_store<T>, void>
+        {
+            constexpr segmented_sort_store() noexcept
+              : algorithm<segmented_sort_store, void>("segmented_sort_store")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter>
+            static hpx::util::unused_type sequential(ExPolicy, Iter first,
+                Iter last, segmented_sort_key const& key)
+            {
+                std::vector<T> data =
+                    segmented_sort_buffers<T>::get().take(key);
+
+                HPX_ASSERT(data.size() ==
+                    static_cast<std::size_t>(std::distance(first, last)));
+                HPX_UNUSED(last);
+
+                std::move(data.begin(), data.end(), first);
+                return {};
+            }
+        };
+
+        // A sample sort: after sorting all segments locally, splitters
+        // derived from a sample of each segment define one bucket per
+        // segment. Each segment then fetches the buckets overlapping with
+        // the range of global positions it covers directly from all other
+        // segments and merges them. The number of elements of each segment
+        // does not change.
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        void segmented_sort(ExPolicy&& policy, SegIter first, SegIter last,
+            Comp&& comp, Proj&& proj)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using segment_iterator = typename traits::segment_iterator;
+            using local_iterator_type = typename traits::local_iterator;
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            struct segment_range
+            {
+                hpx::id_type id_;
+                local_iterator_type first_;
+                local_iterator_type last_;
+                std::size_t size_;
+            };
+
+            // collect the (partial) segments covered by [first, last)
+            std::vector<segment_range> segments;
+            auto add_segment = [&](segment_iterator const& sit,
+                                   local_iterator_type const& beg,
+                                   local_iterator_type const& end) {
+                if (beg != end)
+                {
+                    auto const size =
+                        static_cast<std::size_t>(std::distance(beg, end));
+                    segments.push_back(
+                        segment_range{traits::get_id(sit), beg, end, size});
+                }
+            };
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+            if (sit == send)
+            {
+                add_segment(sit, traits::local(first), traits::local(last));
+            }
+            else
+            {
+                add_segment(sit, traits::local(first), traits::end(sit));
+                for (++sit; sit != send; ++sit)
+                {
+                    add_segment(sit, traits::begin(sit), traits::end(sit));
+                }
+                add_segment(sit, traits::begin(sit), traits::local(last));
+            }
+
+            std::size_t const num_segments = segments.size();
+            if (num_segments == 0)
+            {
+                return;
+            }
+
+            // sort all segments locally
+            {
+                std::vector<hpx::future<void>> sorted;
+                sorted.reserve(num_segments);
+                for (segment_range const& s : segments)
+                {
+                    sorted.push_back(dispatch_async(s.id_,
+                        segmented_sort_local(),
+                        policy(hpx::execution::non_task), is_seq(), s.first_,
+                        s.last_, comp, proj));
+                }
+                segmented_sort_get(HPX_MOVE(sorted));
+            }
+
+            if (num_segments == 1)
+            {
+                return;
+            }
+
+            // sample the segments, proportionally to their sizes
+            std::size_t total = 0;
+            for (segment_range const& s : segments)
+            {
+                total += s.size_;
+            }
+
+            std::size_t const num_samples = num_segments * num_segments;
+            std::vector<value_type> samples;
+            {
+                std::vector<hpx::future<std::vector<value_type>>> sampled;
+                sampled.reserve(num_segments);
+                for (segment_range const& s : segments)
+                {
+                    std::size_t const count = (std::min)(s.size_,
+                        (s.size_ * num_samples + total - 1) / total);
+                    sampled.push_back(dispatch_async(s.id_,
+                        segmented_sort_sample<value_type>(),
+                        hpx::execution::seq, std::true_type(), s.first_,
+                        s.last_, count));
+                }
+
+                for (std::vector<value_type>& values :
+                    segmented_sort_get(HPX_MOVE(sampled)))
+                {
+                    samples.insert(samples.end(),
+                        std::make_move_iterator(values.begin()),
+                        std::make_move_iterator(values.end()));
+                }
+            }
+
+            std::sort(samples.begin(), samples.end(),
+                util::compare_projected<Comp&, Proj&>(comp, proj));
+
+            std::vector<value_type> splitters;
+            splitters.reserve(num_segments - 1);
+            for (std::size_t b = 1; b != num_segments; ++b)
+            {
+                splitters.push_back(
+                    samples[(b * samples.size()) / num_segments]);
+            }
+
+            // offsets of the buckets in each of the segments
+            std::vector<std::vector<std::size_t>> bounds;
+            {
+                std::vector<hpx::future<std::vector<std::size_t>>> bucketed;
+                bucketed.reserve(num_segments);
+                for (segment_range const& s : segments)
+                {
+                    bucketed.push_back(dispatch_async(s.id_,
+                        segmented_sort_bounds<value_type>(),
+                        hpx::execution::seq, std::true_type(), s.first_,
+                        s.last_, splitters, comp, proj));
+                }
+                bounds = segmented_sort_get(HPX_MOVE(bucketed));
+            }
+
+            // global position of each bucket in the sorted sequence
+            std::vector<std::size_t> bucket_begin(num_segments + 1, 0);
+            for (std::size_t b = 0; b != num_segments; ++b)
+            {
+                std::size_t size = 0;
+                for (std::size_t i = 0; i != num_segments; ++i)
+                {
+                    size += bounds[i][b + 1] - bounds[i][b];
+                }
+                bucket_begin[b + 1] = bucket_begin[b] + size;
+            }
+            HPX_ASSERT(bucket_begin[num_segments] == total);
+
+            // every segment gathers the parts of all buckets ending up in
+            // the range of positions it covers
+            static std::atomic<std::uint64_t> sequence(0);
+            std::uint32_t const locality = hpx::get_locality_id();
+            std::uint64_t const generation = ++sequence;
+
+            std::vector<hpx::future<void>> gathered;
+            gathered.reserve(num_segments);
+
+            std::size_t begin = 0;
+            for (std::size_t j = 0; j != num_segments; ++j)
+            {
+                std::size_t const end = begin + segments[j].size_;
+
+                std::vector<sort_bucket<local_iterator_type>> buckets;
+                for (std::size_t b = 0; b != num_segments; ++b)
+                {
+                    if (bucket_begin[b + 1] <= begin ||
+                        bucket_begin[b] >= end)
+                    {
+                        continue;
+                    }
+
+                    sort_bucket<local_iterator_type> bucket;
+                    bucket.lo_ = (std::max)(begin, bucket_begin[b]) -
+                        bucket_begin[b];
+                    bucket.hi_ =
+                        (std::min)(end, bucket_begin[b + 1]) - bucket_begin[b];
+
+                    for (std::size_t i = 0; i != num_segments; ++i)
+                    {
+                        if (bounds[i][b] != bounds[i][b + 1])
+                        {
+                            bucket.pieces_.push_back(
+                                sort_piece<local_iterator_type>{segments[i].id_,
+                                    std::next(segments[i].first_, bounds[i][b]),
+                                    std::next(segments[i].first_,
+                                        bounds[i][b + 1])});
+                        }
+                    }
+                    buckets.push_back(HPX_MOVE(bucket));
+                }
+
+                gathered.push_back(dispatch_async(segments[j].id_,
+                    segmented_sort_gather<value_type, local_iterator_type>(),
+                    hpx::execution::seq, std::true_type(), segments[j].first_,
+                    segments[j].last_, buckets, comp, proj,
+                    segmented_sort_key(locality, generation, j)));
+
+                begin = end;
+            }
+            segmented_sort_get(HPX_MOVE(gathered));
+
+            // all data has been fetched, overwrite the segments
+            std::vector<hpx::future<void>> stored;
+            stored.reserve(num_segments);
+            for (std::size_t j = 0; j != num_segments; ++j)
+            {
+                stored.push_back(dispatch_async(segments[j].id_,
+                    segmented_sort_store<value_type>(), hpx::execution::seq,
+                    std::true_type(), segments[j].first_, segments[j].last_,
+                    segmented_sort_key(locality, generation, j)));
+            }
+            segmented_sort_get(HPX_MOVE(stored));
+        }
+        /// \endcond
+    }    // namespace detail
+}}       // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        hpx::parallel::detail::segmented_sort(hpx::execution::seq, first,
+            last, HPX_MOVE(comp), hpx::identity_v);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy>;
+
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return result::get(hpx::async([=]() mutable {
+                hpx::parallel::detail::segmented_sort(
+                    policy(hpx::execution::non_task), first, last,
+                    HPX_MOVE(comp), hpx::identity_v);
+            }));
+        }
+        else
+        {
+            hpx::parallel::detail::segmented_sort(HPX_FORWARD(ExPolicy, policy),
+                first, last, HPX_MOVE(comp), hpx::identity_v);
+            return result::get();
+        }
+    }
+}}    // namespace hpx::segmented
@@ -113,64 +113,22 @@ namespace hpx { namespace parallel {
             FwdIter first, FwdIter last, T&& init, Reduce&& red_op,
             Convert&& conv_op, std::false_type)
         {
-            typedef hpx::traits::segmented_iterator_traits<FwdIter> traits;
-            typedef typename traits::segment_iterator segment_iterator;
-            typedef typename traits::local_iterator local_iterator_type;
             typedef util::detail::algorithm_result<ExPolicy, T> result;
 
             typedef std::integral_constant<bool,
                 !hpx::traits::is_forward_iterator<FwdIter>::value>
                 forced_seq;
 
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
+            // fuse all segments located on the same locality into a single
+            // remote operation
+            auto const localities = group_segments_by_locality(first, last);
 
             std::vector<shared_future<T>> segments;
-            segments.reserve(std::distance(sit, send));
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op, conv_op));
-                }
-            }
-            else
+            segments.reserve(localities.size());
+            for (auto const& l : localities)
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op, conv_op));
-                }
-
-                // handle all of the full partitions
-                for (++sit; sit != send; ++sit)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    if (beg != end)
-                    {
-                        segments.push_back(
-                            dispatch_async(traits::get_id(sit), algo, policy,
-                                forced_seq(), beg, end, red_op, conv_op));
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, red_op, conv_op));
-                }
+                segments.push_back(dispatch_fused_reduce_async(
+                    l, algo, policy, forced_seq(), red_op, red_op, conv_op));
             }
 
             return result::get(dataflow(
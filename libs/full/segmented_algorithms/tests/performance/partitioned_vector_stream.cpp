@@ -0,0 +1,241 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Distributed version of the STREAM benchmark (see
+// tests/performance/local/stream.cpp): the kernels (copy, scale, add, triad)
+// are run with the segmented algorithms on partitioned_vectors distributed
+// over all localities. The reported bandwidth is the aggregate bandwidth of
+// all localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+
+///////////////////////////////////////////////////////////////////////////////
+struct scale_op
+{
+    double scalar = 3.0;
+
+    double operator()(double val) const
+    {
+        return scalar * val;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & scalar;
+        // clang-format on
+    }
+};
+
+struct add_op
+{
+    double operator()(double val1, double val2) const
+    {
+        return val1 + val2;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct triad_op
+{
+    double scalar = 3.0;
+
+    double operator()(double val1, double val2) const
+    {
+        return val1 + scalar * val2;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & scalar;
+        // clang-format on
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const vector_size =
+        (std::max)(vm["vector_size"].as<std::size_t>(), std::size_t(1));
+    std::size_t const iterations =
+        (std::max)(vm["iterations"].as<std::size_t>(), std::size_t(2));
+    std::size_t const partitions_per_locality =
+        (std::max)(vm["partitions"].as<std::size_t>(), std::size_t(1));
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    auto const layout = hpx::container_layout(
+        partitions_per_locality * localities.size(), localities);
+
+    hpx::partitioned_vector<double> a(vector_size, layout);
+    hpx::partitioned_vector<double> b(vector_size, layout);
+    hpx::partitioned_vector<double> c(vector_size, layout);
+
+    auto const policy = hpx::execution::par;
+    double const scalar = 3.0;
+
+    hpx::fill(policy, a.begin(), a.end(), 1.0);
+    hpx::fill(policy, b.begin(), b.end(), 2.0);
+    hpx::fill(policy, c.begin(), c.end(), 0.0);
+
+    // copy, scale, add, triad
+    char const* const labels[] = {"Copy", "Scale", "Add", "Triad"};
+    double const bytes[] = {2 * sizeof(double) * double(vector_size),
+        2 * sizeof(double) * double(vector_size),
+        3 * sizeof(double) * double(vector_size),
+        3 * sizeof(double) * double(vector_size)};
+
+    std::vector<std::vector<double>> timing(4, std::vector<double>(iterations));
+
+    for (std::size_t iteration = 0; iteration != iterations; ++iteration)
+    {
+        hpx::chrono::high_resolution_timer t;
+
+        hpx::copy(policy, a.begin(), a.end(), c.begin());
+        timing[0][iteration] = t.elapsed();
+
+        t.restart();
+        hpx::transform(
+            policy, c.begin(), c.end(), b.begin(), scale_op{scalar});
+        timing[1][iteration] = t.elapsed();
+
+        t.restart();
+        hpx::transform(
+            policy, a.begin(), a.end(), b.begin(), c.begin(), add_op{});
+        timing[2][iteration] = t.elapsed();
+
+        t.restart();
+        hpx::transform(policy, b.begin(), b.end(), c.begin(), a.begin(),
+            triad_op{scalar});
+        timing[3][iteration] = t.elapsed();
+    }
+
+    std::cout << "-------------------------------------------------------------"
+                 "\n"
+              << "Localities:  " << localities.size() << "\n"
+              << "Partitions:  " << layout.get_num_partitions() << "\n"
+              << "Vector size: " << vector_size << " (per vector, "
+              << sizeof(double) * double(vector_size) / 1e6 << " MB)\n"
+              << "Iterations:  " << iterations << "\n"
+              << "-------------------------------------------------------------"
+                 "\n"
+              << "Function    Best Rate MB/s  "
+                 "Avg time     Min time     Max time\n";
+
+    // the first iteration is not reported (warmup)
+    for (std::size_t j = 0; j != 4; ++j)
+    {
+        double avg = 0.0;
+        double min = (std::numeric_limits<double>::max)();
+        double max = 0.0;
+        for (std::size_t k = 1; k != iterations; ++k)
+        {
+            avg += timing[j][k];
+            min = (std::min)(min, timing[j][k]);
+            max = (std::max)(max, timing[j][k]);
+        }
+        avg /= static_cast<double>(iterations - 1);
+
+        std::cout << std::left << std::setw(12) << labels[j] << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(14)
+                  << 1e-6 * bytes[j] / min << std::setprecision(6)
+                  << std::setw(13) << avg << std::setw(13) << min
+                  << std::setw(13) << max << "\n";
+    }
+
+    // verify the results: after every iteration
+    //   c = a, b = scalar * c, c = a + b, a = b + scalar * c
+    double aj = 1.0, bj = 2.0, cj = 0.0;
+    for (std::size_t k = 0; k != iterations; ++k)
+    {
+        cj = aj;
+        bj = scalar * cj;
+        cj = aj + bj;
+        aj = bj + scalar * cj;
+    }
+
+    double const epsilon = 1.e-13;
+    bool failed = false;
+    for (auto [v, expected] : {std::pair(&a, aj), std::pair(&b, bj),
+             std::pair(&c, cj)})
+    {
+        double const value =
+            v->get_value(hpx::launch::sync, vector_size / 2);
+        if (std::abs(value - expected) / expected > epsilon)
+        {
+            std::cout << "Failed validation: expected " << expected
+                      << ", found " << value << "\n";
+            failed = true;
+        }
+    }
+
+    if (!failed)
+    {
+        std::cout << "Solution Validates\n";
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size",
+         hpx::program_options::value<std::size_t>()->default_value(1000000),
+         "size of each vector (default: 1000000)")
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(10),
+         "number of times to repeat the kernels, the first iteration is not "
+         "reported (default: 10)")
+        ("partitions",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "number of partitions per locality (default: 1)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -106,6 +106,37 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_ranged_access(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // the range spans several partitions if there are any
+    std::size_t const first = 1;
+    std::size_t const last = v.size() - 1;
+
+    std::vector<T> values(last - first);
+    fill_vector(values, T(48), T(3));
+
+    v.set_values(hpx::launch::sync, first, values);
+    std::vector<T> result = v.get_values(hpx::launch::sync, first, last);
+    compare_vectors(values, result);
+
+    // the elements outside of the range are untouched
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, 0), T(42));
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, last), T(42));
+
+    std::vector<T> all = v.get_values(0, v.size()).get();
+    HPX_TEST_EQ(all.size(), v.size());
+    for (std::size_t i = first; i != last; ++i)
+    {
+        HPX_TEST_EQ(all[i], values[i - first]);
+    }
+
+    HPX_TEST(v.get_values(hpx::launch::sync, first, first).empty());
+    v.set_values(first, std::vector<T>()).get();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -121,6 +152,11 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_ranged_access(v);
+    }
 }
 
 template <typename T>
@@ -141,6 +177,10 @@ void handle_values_tests()
         hpx::partitioned_vector<T> v(length, T(42));
         handle_values_tests(v);
     }
+    {
+        hpx::partitioned_vector<T> v(length);
+        handle_values_tests_ranged_access(v);
+    }
 
     handle_values_tests_with_policy<T>(length, 1, hpx::container_layout);
     handle_values_tests_with_policy<T>(length, 3, hpx::container_layout(3));
@@ -59,6 +59,16 @@ void reduce_tests(std::vector<hpx::id_type>& localities)
     hpx::partitioned_vector<T> xvalues(
         num, T(1), hpx::container_layout(localities));
     reduce_tests(num, xvalues);
+
+    // several partitions per locality are reduced by a single remote
+    // operation for each locality
+    hpx::partitioned_vector<T> yvalues(
+        num, T(1), hpx::container_layout(3 * localities.size(), localities));
+    reduce_tests(num, yvalues);
+
+    HPX_TEST_EQ(hpx::reduce(hpx::execution::par, yvalues.begin() + 1,
+                    yvalues.end() - 1, T(1), std::plus<T>()),
+        T(num - 1));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,105 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> initialize(hpx::partitioned_vector<int>& v, int max_value)
+{
+    std::mt19937 gen(static_cast<unsigned>(v.size()));
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<int> values(v.size());
+    std::generate(values.begin(), values.end(), [&]() { return dist(gen); });
+    v.set_values(hpx::launch::sync, 0, values);
+    return values;
+}
+
+template <typename ExPolicy, typename Comp>
+void test_sort(ExPolicy&& policy, hpx::partitioned_vector<int>& v,
+    int max_value, Comp comp)
+{
+    std::vector<int> expected = initialize(v, max_value);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, v.begin(), v.end(), comp);
+    HPX_TEST(v.get_values(hpx::launch::sync, 0, v.size()) == expected);
+}
+
+template <typename ExPolicy, typename Comp>
+void test_sort_async(ExPolicy&& policy, hpx::partitioned_vector<int>& v,
+    int max_value, Comp comp)
+{
+    std::vector<int> expected = initialize(v, max_value);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, v.begin(), v.end(), comp).get();
+    HPX_TEST(v.get_values(hpx::launch::sync, 0, v.size()) == expected);
+}
+
+void test_sort_subrange(hpx::partitioned_vector<int>& v)
+{
+    std::size_t const first = v.size() / 5;
+    std::size_t const last = v.size() - v.size() / 7;
+
+    std::vector<int> expected = initialize(v, 1000);
+    std::sort(expected.begin() + first, expected.begin() + last);
+
+    hpx::sort(hpx::execution::par, v.begin() + first, v.begin() + last);
+    HPX_TEST(v.get_values(hpx::launch::sync, 0, v.size()) == expected);
+}
+
+void sort_tests(std::size_t size, std::size_t num_partitions,
+    std::vector<hpx::id_type> const& localities)
+{
+    hpx::partitioned_vector<int> v(
+        size, 0, hpx::container_layout(num_partitions, localities));
+
+    test_sort(hpx::execution::seq, v, 100000, std::less<int>());
+    test_sort(hpx::execution::par, v, 100000, std::less<int>());
+    test_sort(hpx::execution::par, v, 100000, std::greater<int>());
+    test_sort_async(hpx::execution::seq(hpx::execution::task), v, 100000,
+        std::less<int>());
+    test_sort_async(hpx::execution::par(hpx::execution::task), v, 100000,
+        std::less<int>());
+
+    // many duplicates lead to unbalanced buckets
+    test_sort(hpx::execution::par, v, 3, std::less<int>());
+    test_sort(hpx::execution::par, v, 0, std::less<int>());
+
+    test_sort_subrange(v);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+    sort_tests(10007, 1, localities);
+    sort_tests(10007, 4, localities);
+    sort_tests(10007, 7, localities);
+    sort_tests(13, 7, localities);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -25,6 +25,7 @@
 #include <boost/accumulators/accumulators.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
@@ -230,6 +231,65 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the throughput of concurrent lookups in the (sharded) AGAS cache of
+// this locality. The GIDs pretend to be managed by a different locality as
+// locally managed GIDs are never cached.
+void test_concurrent_get(std::size_t num_entries, std::size_t num_lookups)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+    std::uint32_t remote_locality_id = hpx::get_locality_id() + 1;
+
+    std::vector<hpx::naming::gid_type> gids;
+    gids.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        gids.push_back(hpx::naming::replace_locality_id(
+            hpx::detail::get_next_id(), remote_locality_id));
+        agas.update_cache_entry(
+            gids.back(), hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0));
+    }
+
+    std::size_t num_threads = hpx::get_num_worker_threads();
+    std::atomic<std::size_t> hits(0);
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> lookups;
+    lookups.reserve(num_threads);
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        lookups.push_back(hpx::async([&, i]() {
+            std::size_t found = 0;
+            hpx::agas::gva g;
+            hpx::naming::gid_type idbase;
+
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                if (agas.get_cache_entry(
+                        gids[(i + j) % gids.size()], g, idbase))
+                {
+                    ++found;
+                }
+            }
+            hits += found;
+        }));
+    }
+    hpx::wait_all(lookups);
+
+    double elapsed = t.elapsed();
+    std::size_t total = num_threads * num_lookups;
+
+    std::cout << "concurrent get: " << num_threads << " threads, "
+              << hits.load() << " of " << total << " lookups hit, "
+              << std::setprecision(3) << (total / elapsed) * 1e-6
+              << " Mlookups/s" << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +301,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -255,6 +319,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    test_concurrent_get(num_entries, num_lookups);
+
     return hpx::finalize();
 }
 
@@ -268,7 +334,10 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent cache lookups per worker thread (default: "
+        "100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
@@ -4,7 +4,6 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
-#include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
@@ -14,7 +13,6 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iostream>
 #include <utility>
 #include <vector>
 
@@ -67,61 +65,35 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
+    hpx::util::perftests_init(vm, "async_overheads");
+
     std::size_t num_tasks = 128;
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
 
-    double seqential_time_per_task = 0;
-
-    {
-        std::vector<hpx::future<void>> tasks;
-        tasks.reserve(num_tasks);
-
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
-
-        for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
-
-        hpx::wait_all(tasks);
-
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
 
-        seqential_time_per_task =
-            static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed sequential time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
-                  << seqential_time_per_task << " [s])" << std::endl;
-        hpx::util::print_cdash_timing(
-            "AsyncSequential", seqential_time_per_task);
-    }
-
-    double hierarchical_time_per_task = 0;
+    hpx::util::perftests_report("async overheads - sequential", "async",
+        repetitions, [&]() {
+            std::vector<hpx::future<void>> tasks;
+            tasks.reserve(num_tasks);
 
-    {
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+            for (std::size_t i = 0; i != num_tasks; ++i)
+                tasks.push_back(hpx::async(&test_func));
 
-        hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
-        hpx::wait_all(f);
+            hpx::wait_all(tasks);
+        });
 
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+    hpx::util::perftests_report("async overheads - hierarchical", "async",
+        repetitions, [&]() {
+            hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
+            hpx::wait_all(f);
+        });
 
-        hierarchical_time_per_task =
-            static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed hierarchical time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
-                  << hierarchical_time_per_task << " [s])" << std::endl;
-        hpx::util::print_cdash_timing(
-            "AsyncHierarchical", hierarchical_time_per_task);
-    }
+    int const regressions = hpx::util::perftests_print_times();
 
-    std::cout << "Ratio (speedup): "
-              << seqential_time_per_task / hierarchical_time_per_task
-              << std::endl;
-
-    hpx::util::print_cdash_timing(
-        "AsyncSpeedup", seqential_time_per_task / hierarchical_time_per_task);
-
-    return hpx::finalize();
+    hpx::finalize();
+    return regressions == 0 ? 0 : 1;
 }
 
 int main(int argc, char* argv[])
@@ -139,9 +111,13 @@ int main(int argc, char* argv[])
         ("spread,p", value<std::size_t>(&spread)->default_value(2),
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
-        "time spent in the delay loop [ns]");
+        "time spent in the delay loop [ns]")
+        ("repetitions", value<std::size_t>()->default_value(1),
+         "number of timed repetitions of every variant (default: 1)");
     // clang-format on
 
+    hpx::util::perftests_cfg(desc_commandline);
+
     // Initialize and run HPX
     hpx::init_params init_args;
     init_args.desc_cmdline = desc_commandline;
@@ -0,0 +1,103 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of creating and destroying small
+// (managed) components from many HPX threads concurrently. The component
+// instances are allocated from the component heap of their type.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct small_server : hpx::components::managed_component_base<small_server>
+{
+    std::int64_t value = 0;
+};
+
+using small_server_type = hpx::components::managed_component<small_server>;
+HPX_REGISTER_COMPONENT(small_server_type, small_server)
+
+///////////////////////////////////////////////////////////////////////////////
+void create_destroy(std::size_t num_objects)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(num_objects);
+
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        ids.push_back(hpx::local_new<small_server>().get());
+    }
+
+    // releasing the last reference destroys the component
+    ids.clear();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_objects = vm["objects"].as<std::size_t>();
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    // warm up, this creates the heaps
+    create_destroy(num_objects);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::size_t j = 0; j != num_tasks; ++j)
+        {
+            tasks.push_back(hpx::async(create_destroy, num_objects));
+        }
+        hpx::wait_all(tasks);
+    }
+
+    double const elapsed = t.elapsed();
+    double const total =
+        static_cast<double>(num_objects * num_tasks * iterations);
+
+    std::cout << "components created and destroyed: " << total
+              << ", elapsed: " << elapsed << " [s], throughput: "
+              << total / elapsed << " [1/s], OS threads: "
+              << hpx::get_os_thread_count() << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("objects", value<std::size_t>()->default_value(10000),
+         "number of components created (and destroyed) by each task")
+        ("tasks", value<std::size_t>()->default_value(64),
+         "number of concurrently running tasks")
+        ("iterations", value<std::size_t>()->default_value(10),
+         "number of times the tasks are run");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,142 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the impact of false sharing on per-worker state.
+// Each worker thread repeatedly updates its own counter, once with all
+// counters packed into a plain array (neighboring counters share cache lines)
+// and once with every counter padded to a full cache line using
+// hpx::util::cache_line_data.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t iterations = 10000000;
+
+struct packed_counter
+{
+    std::atomic<std::uint64_t> value_{0};
+
+    std::atomic<std::uint64_t>& get() noexcept
+    {
+        return value_;
+    }
+};
+
+struct padded_counter
+{
+    hpx::util::cache_line_data<std::atomic<std::uint64_t>> value_{0};
+
+    std::atomic<std::uint64_t>& get() noexcept
+    {
+        return value_.data_;
+    }
+};
+
+template <typename Counter>
+void update(Counter& counter, hpx::latch& start, hpx::latch& stop)
+{
+    // make sure all workers are running before updating the counters
+    start.arrive_and_wait();
+
+    std::atomic<std::uint64_t>& value = counter.get();
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        value.fetch_add(1, std::memory_order_relaxed);
+    }
+    stop.count_down(1);
+}
+
+template <typename Counter>
+double measure(std::size_t num_workers)
+{
+    std::vector<Counter> counters(num_workers);
+
+    hpx::latch start(static_cast<std::ptrdiff_t>(num_workers));
+    hpx::latch stop(static_cast<std::ptrdiff_t>(num_workers + 1));
+
+    std::uint64_t const t = hpx::chrono::high_resolution_clock::now();
+
+    // run each update loop on a different core
+    for (std::size_t i = 0; i != num_workers; ++i)
+    {
+        thread_init_data data(
+            make_thread_function_nullary(hpx::bind(&update<Counter>,
+                std::ref(counters[i]), std::ref(start), std::ref(stop))),
+            "false_sharing", hpx::threads::thread_priority::bound,
+            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(i)));
+        register_work(data);
+    }
+    stop.arrive_and_wait();
+
+    std::uint64_t const elapsed =
+        hpx::chrono::high_resolution_clock::now() - t;
+    return static_cast<double>(elapsed) / 1e9;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    bool const print_header = vm.count("no-header") == 0;
+    std::size_t const num_workers = hpx::get_os_thread_count();
+
+    if (print_header)
+    {
+        std::cout << "OS-threads,Iterations,Packed Walltime (seconds),"
+                     "Padded Walltime (seconds),Speedup"
+                  << std::endl;
+    }
+
+    double const packed = measure<packed_counter>(num_workers);
+    double const padded = measure<padded_counter>(num_workers);
+
+    hpx::util::format_to(std::cout, "{},{},{:.6},{:.6},{:.2}\n", num_workers,
+        iterations, packed, padded, packed / padded)
+        << std::flush;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations",
+            po::value<std::uint64_t>(&iterations)->default_value(10000000),
+            "number of counter updates per worker thread (default: 10000000)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
@@ -369,6 +369,38 @@ void measure_function_futures_create_thread(std::uint64_t count, bool csv)
     print_stats("create_thread", "latch", "none", count, duration, csv);
 }
 
+// Time the creation of futures through promises and packaged tasks, no
+// threads are created, which leaves the allocation of the shared states as the
+// dominating cost
+void measure_promise_futures(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::promise<double> p;
+        future<double> f = p.get_future();
+        p.set_value(null_function());
+        global_scratch += f.get();
+    }
+
+    // stop the clock
+    double duration = walltime.elapsed();
+    print_stats("promise", "get", "none", count, duration, csv);
+
+    walltime.restart();
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::packaged_task<double()> task(&null_function);
+        future<double> f = task.get_future();
+        task();
+        global_scratch += f.get();
+    }
+
+    duration = walltime.elapsed();
+    print_stats("packaged_task", "get", "none", count, duration, csv);
+}
+
 void measure_function_futures_create_thread_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
@@ -533,6 +565,7 @@ int hpx_main(variables_map& vm)
                     count, csv, par_nostack, "parallel_executor_nostack");
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
+                measure_promise_futures(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
                     count, csv);
             }
@@ -139,12 +139,14 @@ void measure_function_futures_create_thread_hierarchical_placement(
             }
             l.wait();
         });
-    hpx::util::perftests_print_times();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
+    hpx::util::perftests_init(vm, "future_overhead_report");
+
+    int regressions = 0;
     {
         if (vm.count("hpx:queuing"))
             queuing = vm["hpx:queuing"].as<std::string>();
@@ -172,10 +174,12 @@ int hpx_main(variables_map& vm)
         {
             measure_function_futures_create_thread_hierarchical_placement(
                 count, repetitions);
+            regressions = hpx::util::perftests_print_times();
         }
     }
 
-    return hpx::local::finalize();
+    hpx::local::finalize();
+    return regressions == 0 ? 0 : 1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -200,6 +204,8 @@ int main(int argc, char* argv[])
          "extra info for plot output (e.g. branch name)");
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // Initialize and run HPX.
     hpx::local::init_params init_args;
     init_args.desc_cmdline = cmdline;
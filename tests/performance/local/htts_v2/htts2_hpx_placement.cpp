@@ -0,0 +1,386 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Variants of the homogeneous task spawn benchmark (see htts2_hpx.cpp) which
+// measure the effects of task placement on throughput and task latency (the
+// time between spawning a task and the start of its execution):
+//
+//  --mode=numa        one producer per NUMA domain, running on the domain,
+//                     spawns the tasks for all OS-threads of the domain using
+//                     NUMA scheduling hints
+//  --mode=pools       the OS-threads are split into --pools thread pools
+//                     (created through the resource partitioner), one
+//                     producer per pool spawns the tasks for all of its
+//                     OS-threads
+//  --mode=priorities  one producer per OS-thread (as in htts2_hpx), but the
+//                     given fraction of the tasks (--high-priority-ratio) is
+//                     spawned with high priority, the latencies are reported
+//                     separately for both priorities
+
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+
+#include "htts2.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename BaseClock = std::chrono::steady_clock>
+struct hpx_placement_driver : htts2::driver
+{
+    using rep = typename htts2::clocksource<BaseClock>::rep;
+
+    hpx_placement_driver(int argc, char** argv)
+      : htts2::driver(argc, argv, true)
+    {
+        hpx::program_options::options_description cmdline;
+
+        // clang-format off
+        cmdline.add_options()
+            ("mode",
+             hpx::program_options::value<std::string>(&mode_)
+                ->default_value("numa"),
+             "variant of the benchmark to run (numa, pools or priorities)")
+            ("pools",
+             hpx::program_options::value<std::uint64_t>(&pools_)
+                ->default_value(2),
+             "number of thread pools to create (mode=pools)")
+            ("high-priority-ratio",
+             hpx::program_options::value<double>(&high_priority_ratio_)
+                ->default_value(0.1),
+             "fraction of the tasks spawned with high priority "
+             "(mode=priorities)");
+        // clang-format on
+
+        hpx::program_options::variables_map vm;
+        hpx::program_options::store(
+            hpx::program_options::command_line_parser(argc, argv)
+                .options(cmdline)
+                .allow_unregistered()
+                .run(),
+            vm);
+        hpx::program_options::notify(vm);
+
+        if (mode_ != "numa" && mode_ != "pools" && mode_ != "priorities")
+        {
+            throw std::invalid_argument("unknown mode: " + mode_);
+        }
+        pools_ = (std::clamp)(pools_, std::uint64_t(1), osthreads_);
+        high_priority_ratio_ = (std::clamp)(high_priority_ratio_, 0.0, 1.0);
+    }
+
+    void run()
+    {
+        std::vector<std::string> const cfg = {
+            "hpx.os_threads=" + std::to_string(osthreads_),
+            "hpx.run_hpx_main!=0", "hpx.commandline.allow_unknown!=1"};
+
+        hpx::program_options::options_description desc;
+
+        hpx::local::init_params init_args;
+        init_args.cfg = cfg;
+        init_args.desc_cmdline = desc;
+
+        if (mode_ == "pools")
+        {
+            init_args.rp_callback =
+                [this](hpx::resource::partitioner& rp,
+                    hpx::program_options::variables_map const&) {
+                    create_pools(rp);
+                };
+        }
+
+        hpx::local::init(
+            std::function<int(hpx::program_options::variables_map&)>(
+                [this](hpx::program_options::variables_map&) {
+                    return run_impl();
+                }),
+            argc_, argv_, init_args);
+    }
+
+private:
+    // The tasks spawned by one producer
+    struct group
+    {
+        hpx::threads::thread_pool_base* pool = nullptr;
+        hpx::threads::thread_schedule_hint producer_hint;
+        hpx::threads::thread_schedule_hint task_hint;
+        std::uint64_t tasks = 0;
+    };
+
+    struct sample
+    {
+        rep latency = 0;
+        bool high_priority = false;
+    };
+
+    struct results_type
+    {
+        std::size_t groups = 0;
+        double walltime = 0;    // nanoseconds
+        std::vector<sample> samples;
+    };
+
+    // split the PUs into pools of (nearly) equal size
+    void create_pools(hpx::resource::partitioner& rp) const
+    {
+        rp.set_default_pool_name("pool-0");
+        for (std::uint64_t i = 1; i < pools_; ++i)
+        {
+            rp.create_thread_pool("pool-" + std::to_string(i));
+        }
+
+        std::vector<hpx::resource::pu const*> pus;
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (pus.size() < osthreads_)
+                    {
+                        pus.push_back(&p);
+                    }
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i != pus.size(); ++i)
+        {
+            rp.add_resource(
+                *pus[i], "pool-" + std::to_string(i * pools_ / pus.size()));
+        }
+    }
+
+    std::vector<group> get_groups() const
+    {
+        std::vector<group> groups;
+        if (mode_ == "numa")
+        {
+            auto const& rp = hpx::resource::get_partitioner();
+            auto const& topo = rp.get_topology();
+
+            std::map<std::size_t, std::vector<std::size_t>> domains;
+            std::size_t const num_threads = hpx::get_num_worker_threads();
+            for (std::size_t t = 0; t != num_threads; ++t)
+            {
+                domains[topo.get_numa_node_number(rp.get_pu_num(t))].push_back(
+                    t);
+            }
+
+            for (auto const& domain : domains)
+            {
+                group g;
+                g.producer_hint = hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(domain.second.front()));
+                g.task_hint = hpx::threads::thread_schedule_hint(
+                    hpx::threads::thread_schedule_hint_mode::numa,
+                    static_cast<std::int16_t>(domain.first));
+                g.tasks = tasks_ * domain.second.size();
+                groups.push_back(g);
+            }
+        }
+        else if (mode_ == "pools")
+        {
+            for (std::size_t i = 0; i != hpx::resource::get_num_thread_pools();
+                 ++i)
+            {
+                group g;
+                g.pool = &hpx::resource::get_thread_pool(i);
+                g.producer_hint = hpx::threads::thread_schedule_hint(0);
+                g.tasks = tasks_ * hpx::resource::get_num_threads(i);
+                groups.push_back(g);
+            }
+        }
+        else
+        {
+            std::size_t const num_threads = hpx::get_num_worker_threads();
+            for (std::size_t t = 0; t != num_threads; ++t)
+            {
+                group g;
+                g.producer_hint = hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(t));
+                g.task_hint = g.producer_hint;
+                g.tasks = tasks_;
+                groups.push_back(g);
+            }
+        }
+        return groups;
+    }
+
+    int run_impl()
+    {
+        results_type const results = kernel(get_groups());
+        print_results(results);
+
+        return hpx::local::finalize();
+    }
+
+    results_type kernel(std::vector<group> const& groups)
+    {
+        using hpx::threads::thread_priority;
+
+        results_type results;
+        results.groups = groups.size();
+
+        std::vector<std::size_t> offsets(groups.size() + 1, 0);
+        for (std::size_t i = 0; i != groups.size(); ++i)
+        {
+            offsets[i + 1] = offsets[i] + groups[i].tasks;
+        }
+        results.samples.resize(offsets.back());
+
+        // every high_priority_stride'th task is spawned with high priority
+        std::uint64_t const high_priority_stride =
+            mode_ == "priorities" && high_priority_ratio_ > 0.0 ?
+            static_cast<std::uint64_t>(1.0 / high_priority_ratio_ + 0.5) :
+            0;
+
+        std::atomic<std::size_t> remaining(offsets.back());
+        hpx::latch finished(2);
+
+        htts2::timer<BaseClock> t;
+
+        for (std::size_t i = 0; i != groups.size(); ++i)
+        {
+            group const& g = groups[i];
+            sample* samples = results.samples.data() + offsets[i];
+
+            hpx::execution::parallel_executor const producer_exec(g.pool,
+                thread_priority::normal, hpx::threads::thread_stacksize::small_,
+                g.producer_hint);
+
+            hpx::post(producer_exec, [&, g, samples]() {
+                for (std::uint64_t j = 0; j != g.tasks; ++j)
+                {
+                    bool const high_priority =
+                        high_priority_stride != 0 &&
+                        j % high_priority_stride == 0;
+
+                    hpx::execution::parallel_executor const exec(g.pool,
+                        high_priority ? thread_priority::high :
+                                        thread_priority::normal,
+                        hpx::threads::thread_stacksize::small_, g.task_hint);
+
+                    sample& s = samples[j];
+                    s.high_priority = high_priority;
+
+                    rep const spawned = htts2::clocksource<BaseClock>::now();
+                    hpx::post(exec, [&, spawned]() {
+                        s.latency =
+                            htts2::clocksource<BaseClock>::now() - spawned;
+                        htts2::payload<BaseClock>(this->payload_duration_);
+                        if (--remaining == 0)
+                        {
+                            finished.count_down(1);
+                        }
+                    });
+                }
+            });
+        }
+
+        if (offsets.back() == 0)
+        {
+            finished.count_down(1);
+        }
+        finished.arrive_and_wait();
+
+        // w_M [nanoseconds]
+        results.walltime = static_cast<double>(t.elapsed());
+        return results;
+    }
+
+    void print_results(results_type const& results) const
+    {
+        if (this->io_ == htts2::csv_with_headers)
+        {
+            std::cout
+                << "Mode,"
+                << "OS-threads (Independent Variable),"
+                << "Producers,"
+                << "Tasks per OS-thread (Control Variable) [tasks/OS-threads],"
+                << "Payload Duration (Control Variable) [nanoseconds],"
+                << "Total Walltime [nanoseconds],"
+                << "Throughput [tasks/second],"
+                << "Priority,"
+                << "Latency p50 [nanoseconds],"
+                << "Latency p99 [nanoseconds],"
+                << "Latency max [nanoseconds]"
+                << "\n";
+        }
+
+        double const throughput =
+            static_cast<double>(results.samples.size()) /
+            (results.walltime > 0 ? results.walltime * 1e-9 : 1.0);
+
+        auto const print_latencies = [&](char const* priority, bool all,
+                                         bool high_priority) {
+            std::vector<rep> latencies;
+            latencies.reserve(results.samples.size());
+            for (sample const& s : results.samples)
+            {
+                if (all || s.high_priority == high_priority)
+                {
+                    latencies.push_back(s.latency);
+                }
+            }
+            if (latencies.empty())
+            {
+                return;
+            }
+
+            std::sort(latencies.begin(), latencies.end());
+            std::size_t const size = latencies.size();
+
+            hpx::util::format_to(std::cout,
+                "{},{},{},{},{},{:.14g},{:.14g},{},{},{},{}\n", mode_,
+                this->osthreads_, results.groups, this->tasks_,
+                this->payload_duration_, results.walltime, throughput,
+                priority, latencies[size / 2],
+                latencies[(std::min)(size - 1, size * 99 / 100)],
+                latencies.back());
+        };
+
+        if (mode_ == "priorities")
+        {
+            print_latencies("high", false, true);
+            print_latencies("normal", false, false);
+        }
+        else
+        {
+            print_latencies("normal", true, false);
+        }
+    }
+
+    std::string mode_;
+    std::uint64_t pools_ = 2;
+    double high_priority_ratio_ = 0.1;
+};
+
+int main(int argc, char** argv)
+{
+    hpx_placement_driver<> d(argc, argv);
+
+    d.run();
+
+    return 0;
+}
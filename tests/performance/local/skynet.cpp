@@ -15,14 +15,15 @@
 // until reaching the root actor. (The answer should be 499999500000).
 
 // This code implements two versions of the skynet micro benchmark: a 'normal'
-// and a futurized one.
+// and a futurized one. The results are reported in the json format of the
+// performance test harness (see hpx::util::perftests_report).
 
-#include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
-#include <iostream>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -81,35 +82,45 @@ hpx::future<std::int64_t> skynet_f(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main()
+int hpx_main(hpx::program_options::variables_map& vm)
 {
-    {
-        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
-
-        hpx::future<std::int64_t> result = hpx::async(skynet, 0, 1000000, 10);
-        result.wait();
-
-        t = hpx::chrono::high_resolution_clock::now() - t;
+    hpx::util::perftests_init(vm, "skynet");
 
-        std::cout << "Result 1: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
-    }
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
+    constexpr std::int64_t expected = 499999500000;
 
-    {
-        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    hpx::util::perftests_report("skynet", "wait_all", repetitions, [&]() {
+        HPX_TEST_EQ(hpx::async(skynet, 0, 1000000, 10).get(), expected);
+    });
 
+    hpx::util::perftests_report("skynet", "dataflow", repetitions, [&]() {
         hpx::future<std::int64_t> result = hpx::async(skynet_f, 0, 1000000, 10);
-        result.wait();
+        HPX_TEST_EQ(result.get(), expected);
+    });
 
-        t = hpx::chrono::high_resolution_clock::now() - t;
+    int const regressions = hpx::util::perftests_print_times();
 
-        std::cout << "Result 2: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
-    }
-    return 0;
+    hpx::local::finalize();
+    return regressions == 0 ? hpx::util::report_errors() : 1;
 }
 
 int main(int argc, char* argv[])
 {
-    return hpx::local::init(hpx_main, argc, argv);
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("repetitions", value<std::size_t>()->default_value(1),
+         "number of timed repetitions of every variant (default: 1)");
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
 }
@@ -18,11 +18,13 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/mutex.hpp>
 
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -177,14 +179,17 @@ namespace test {
 }    // namespace test
 
 test::local_spinlock mtx[N];
+hpx::adaptive_mutex adaptive_mtx[N];
+bool use_adaptive_mutex = false;
 
 ///////////////////////////////////////////////////////////////////////////////
-double null_function(std::size_t i)
+template <typename Mutex>
+double null_function_impl(Mutex* mutexes, std::size_t i)
 {
     double d = 0.;
     std::size_t idx = i % N;
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mutexes[idx]);
         d = global_init[idx];
     }
     for (double j = 0; j < num_iterations; ++j)
@@ -192,12 +197,21 @@ double null_function(std::size_t i)
         d += 1 / (2. * j + 1);
     }
     {
-        std::lock_guard<test::local_spinlock> l(mtx[idx]);
+        std::lock_guard<Mutex> l(mutexes[idx]);
         global_init[idx] = d;
     }
     return d;
 }
 
+double null_function(std::size_t i)
+{
+    if (use_adaptive_mutex)
+    {
+        return null_function_impl(adaptive_mtx, i);
+    }
+    return null_function_impl(mtx, i);
+}
+
 HPX_PLAIN_ACTION(null_function, null_action)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -210,6 +224,7 @@ int hpx_main(variables_map& vm)
 
         k1 = vm["k1"].as<std::size_t>();
         k2 = vm["k2"].as<std::size_t>();
+        use_adaptive_mutex = vm.count("adaptive") != 0;
         k3 = vm["k3"].as<std::size_t>();
 
         const id_type here = find_here();
@@ -252,6 +267,23 @@ int hpx_main(variables_map& vm)
                         count, duration, k1, k2, k3)
                         << std::flush;
                 hpx::util::print_cdash_timing("Spinlock2", duration);
+
+                if (use_adaptive_mutex && !vm.count("csv"))
+                {
+                    hpx::adaptive_mutex::statistics total;
+                    for (auto const& m : adaptive_mtx)
+                    {
+                        auto const stats = m.get_statistics();
+                        total.contended += stats.contended;
+                        total.spin_acquired += stats.spin_acquired;
+                        total.suspended += stats.suspended;
+                    }
+                    hpx::util::format_to(cout,
+                        "adaptive_mutex: {1} contended, {2} acquired while "
+                        "spinning, {3} suspended\n",
+                        total.contended, total.spin_acquired, total.suspended)
+                        << std::flush;
+                }
             }
         }
     }
@@ -276,6 +308,7 @@ int main(int argc, char* argv[])
         ("k2", value<std::size_t>()->default_value(16), "")
         ("k3", value<std::size_t>()->default_value(32), "")
         ("csv", "output results as csv (format: count,duration)")
+        ("adaptive", "use hpx::adaptive_mutex instead of a spinlock")
         ;
     // clang-format on
 
@@ -0,0 +1,285 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of connecting many receivers to the
+// senders returned by split and ensure_started (fan-out). All worker threads
+// concurrently connect and start operation states while the predecessor has
+// not completed yet, the predecessor is completed once all of them have been
+// registered. The same fan-out is measured for a reference implementation
+// registering the continuations in a vector protected by a spinlock, which is
+// how split and ensure_started used to register continuations.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/type_support/detail/with_result_of.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fan_out = 100000;
+
+// The predecessor of the senders under test, it completes only once
+// release() is called.
+struct gate
+{
+    void* op = nullptr;
+    void (*complete)(void*) noexcept = nullptr;
+
+    void release() noexcept
+    {
+        complete(op);
+    }
+};
+
+struct gate_sender
+{
+    gate* g;
+
+    template <typename R>
+    struct operation_state
+    {
+        std::decay_t<R> r;
+        gate* g;
+
+        static void complete(void* op) noexcept
+        {
+            ex::set_value(HPX_MOVE(static_cast<operation_state*>(op)->r));
+        }
+
+        friend void tag_invoke(ex::start_t, operation_state& os) noexcept
+        {
+            os.g->op = &os;
+            os.g->complete = &operation_state::complete;
+        }
+    };
+
+    template <typename R>
+    friend operation_state<R> tag_invoke(
+        ex::connect_t, gate_sender&& s, R&& r) noexcept
+    {
+        return {HPX_FORWARD(R, r), s.g};
+    }
+
+    template <typename Env>
+    friend auto tag_invoke(
+        ex::get_completion_signatures_t, gate_sender const&, Env)
+        -> ex::completion_signatures<ex::set_value_t()>;
+};
+
+struct counting_receiver
+{
+    std::atomic<std::uint64_t>* count;
+
+    friend void tag_invoke(ex::set_value_t, counting_receiver&& r) noexcept
+    {
+        r.count->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend void tag_invoke(
+        ex::set_error_t, counting_receiver&&, std::exception_ptr) noexcept
+    {
+        std::terminate();
+    }
+
+    friend void tag_invoke(ex::set_stopped_t, counting_receiver&&) noexcept
+    {
+        std::terminate();
+    }
+};
+
+// The continuations are registered in a vector protected by a spinlock.
+struct locked_shared_state
+{
+    hpx::spinlock mtx;
+    std::atomic<bool> predecessor_done{false};
+    hpx::detail::small_vector<hpx::move_only_function<void()>, 1>
+        continuations;
+
+    void add_continuation(counting_receiver&& receiver)
+    {
+        if (!predecessor_done)
+        {
+            std::unique_lock l{mtx};
+            if (!predecessor_done)
+            {
+                continuations.emplace_back(
+                    [receiver = HPX_MOVE(receiver)]() mutable {
+                        ex::set_value(HPX_MOVE(receiver));
+                    });
+                return;
+            }
+        }
+        ex::set_value(HPX_MOVE(receiver));
+    }
+
+    void set_predecessor_done()
+    {
+        predecessor_done = true;
+        {
+            std::unique_lock l{mtx};
+        }
+        for (auto const& continuation : continuations)
+        {
+            continuation();
+        }
+        continuations.clear();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Invokes register_continuations(worker) on all worker threads concurrently,
+// and release() once all of them have returned. Returns the elapsed time in
+// seconds.
+template <typename Register, typename Release>
+double run_fan_out(std::size_t num_workers,
+    Register&& register_continuations, Release&& release)
+{
+    hpx::latch stop(static_cast<std::ptrdiff_t>(num_workers + 1));
+
+    std::uint64_t const t = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != num_workers; ++i)
+    {
+        hpx::post([&, i]() {
+            register_continuations(i);
+            stop.count_down(1);
+        });
+    }
+    stop.arrive_and_wait();
+    release();
+
+    std::uint64_t const elapsed =
+        hpx::chrono::high_resolution_clock::now() - t;
+    return static_cast<double>(elapsed) / 1e9;
+}
+
+template <typename Sender>
+double measure_sender(std::size_t num_workers, Sender s, gate& g)
+{
+    using operation_state_type =
+        ex::connect_result_t<Sender&, counting_receiver>;
+
+    std::atomic<std::uint64_t> count(0);
+    std::unique_ptr<std::optional<operation_state_type>[]> ops(
+        new std::optional<operation_state_type>[num_workers * fan_out]);
+
+    double const elapsed = run_fan_out(
+        num_workers,
+        [&](std::size_t worker) {
+            auto* first = &ops[worker * fan_out];
+            for (std::uint64_t i = 0; i != fan_out; ++i)
+            {
+                first[i].emplace(hpx::util::detail::with_result_of([&]() {
+                    return ex::connect(s, counting_receiver{&count});
+                }));
+                ex::start(*first[i]);
+            }
+        },
+        [&]() { g.release(); });
+
+    HPX_ASSERT(count.load() == num_workers * fan_out);
+    return elapsed;
+}
+
+double measure_split(std::size_t num_workers)
+{
+    gate g;
+    return measure_sender(num_workers, ex::split(gate_sender{&g}), g);
+}
+
+double measure_ensure_started(std::size_t num_workers)
+{
+    gate g;
+    return measure_sender(
+        num_workers, ex::ensure_started(gate_sender{&g}), g);
+}
+
+double measure_locked(std::size_t num_workers)
+{
+    std::atomic<std::uint64_t> count(0);
+    locked_shared_state state;
+
+    double const elapsed = run_fan_out(
+        num_workers,
+        [&](std::size_t) {
+            for (std::uint64_t i = 0; i != fan_out; ++i)
+            {
+                state.add_continuation(counting_receiver{&count});
+            }
+        },
+        [&]() { state.set_predecessor_done(); });
+
+    HPX_ASSERT(count.load() == num_workers * fan_out);
+    return elapsed;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    bool const print_header = vm.count("no-header") == 0;
+    std::size_t const num_workers = hpx::get_os_thread_count();
+
+    if (print_header)
+    {
+        std::cout << "OS-threads,Fan-out per thread,"
+                     "Locked Walltime (seconds),Split Walltime (seconds),"
+                     "Ensure-started Walltime (seconds),Split Speedup"
+                  << std::endl;
+    }
+
+    double const locked = measure_locked(num_workers);
+    double const split = measure_split(num_workers);
+    double const ensure_started = measure_ensure_started(num_workers);
+
+    hpx::util::format_to(std::cout, "{},{},{:.6},{:.6},{:.6},{:.2}\n",
+        num_workers, fan_out, locked, split, ensure_started, locked / split)
+        << std::flush;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("fan-out",
+            po::value<std::uint64_t>(&fan_out)->default_value(100000),
+            "number of receivers connected by each worker thread "
+            "(default: 100000)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,144 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of spawning (staged) HPX threads
+// while the number of concurrent producers is increased. Each producer is an
+// HPX thread that registers its share of the tasks on its own core, the
+// consumers convert the staged tasks into threads and run them.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/functional.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+#include "worker_timed.hpp"
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t tasks = 500000;
+std::uint64_t delay = 0;
+
+void worker(hpx::latch& l)
+{
+    worker_timed(delay * 1000);
+    l.count_down(1);
+}
+
+void produce(std::size_t num_tasks, hpx::latch& l)
+{
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        thread_init_data data(make_thread_function_nullary(
+                                  hpx::bind(&worker, std::ref(l))),
+            "staged_task_spawn");
+        register_work(data);
+    }
+    l.count_down(1);
+}
+
+double measure(std::size_t num_producers)
+{
+    std::size_t const tasks_per_producer = tasks / num_producers;
+    hpx::latch l(static_cast<std::ptrdiff_t>(
+        num_producers * (tasks_per_producer + 1) + 1));
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    // run each producer on a different core
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        thread_init_data data(
+            make_thread_function_nullary(hpx::bind(
+                &produce, tasks_per_producer, std::ref(l))),
+            "staged_task_spawn_producer", hpx::threads::thread_priority::high,
+            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(i)));
+        register_work(data);
+    }
+    l.arrive_and_wait();
+
+    std::uint64_t const stop = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(stop - start) / 1e9;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    bool const print_header = vm.count("no-header") == 0;
+
+    std::size_t const num_cores = hpx::get_os_thread_count();
+    std::size_t max_producers = num_cores;
+    if (vm.count("max-producers") != 0)
+    {
+        max_producers = vm["max-producers"].as<std::size_t>();
+        if (max_producers == 0 || max_producers > num_cores)
+            max_producers = num_cores;
+    }
+
+    if (print_header)
+    {
+        std::cout << "OS-threads,Producers,Tasks,Delay (microseconds),"
+                     "Total Walltime (seconds),Tasks per Second"
+                  << std::endl;
+    }
+
+    for (std::size_t producers = 1; producers <= max_producers;
+         producers *= 2)
+    {
+        double const walltime = measure(producers);
+        std::uint64_t const spawned = (tasks / producers) * producers;
+
+        hpx::util::format_to(std::cout, "{},{},{},{},{:.6},{:.1}\n",
+            num_cores, producers, spawned, delay, walltime,
+            static_cast<double>(spawned) / walltime)
+            << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks",
+            po::value<std::uint64_t>(&tasks)->default_value(500000),
+            "total number of tasks to spawn (default: 500000)")
+        ("delay",
+            po::value<std::uint64_t>(&delay)->default_value(0),
+            "time to busy wait in each task [microseconds] "
+            "(default: no busy waiting)")
+        ("max-producers",
+            po::value<std::size_t>(),
+            "maximal number of concurrently spawning tasks, the number of "
+            "producers is doubled starting from one (default: number of "
+            "cores)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
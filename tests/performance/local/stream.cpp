@@ -597,10 +597,25 @@ int hpx_main(hpx::program_options::variables_map& vm)
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
         }
+        else if (executor == 6)
+        {
+            // Block executor with serial allocator. This is the same as the
+            // block executor with block allocator, except that all of the
+            // memory is touched first (and is therefore placed) on the NUMA
+            // domain of the main thread.
+            using executor_type = hpx::compute::host::block_executor<>;
+
+            auto numa_nodes = hpx::compute::host::numa_domains();
+            executor_type exec(numa_nodes);
+            auto policy = hpx::execution::par.on(exec);
+
+            timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+                std::allocator<STREAM_TYPE>{}, std::move(policy));
+        }
         else
         {
             HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
-                "hpx_main", "Invalid executor id given (0-4 allowed");
+                "hpx_main", "Invalid executor id given (0-6 allowed");
         }
     }
     time_total = mysecond() - time_total;
@@ -654,10 +669,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
                 "triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 6;
+        std::size_t const num_executors = 7;
         const char* executors[num_executors] = {"parallel-serial", "block",
             "parallel-parallel", "fork_join_executor", "scheduler_executor",
-            "block_fork_join_executor"};
+            "block_fork_join_executor", "block-serial"};
         hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
             hpx::get_os_thread_count(), vector_size);
     }
@@ -733,7 +748,7 @@ int main(int argc, char* argv[])
             "size of vector (default: 1024)")
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
-            "executor to use (0-5) (default: 2, parallel_executor)")
+            "executor to use (0-6) (default: 2, parallel_executor)")
         ;
     // clang-format on
 
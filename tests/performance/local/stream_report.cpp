@@ -438,6 +438,8 @@ auto run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
+    hpx::util::perftests_init(vm, "stream_report");
+
     std::size_t vector_size = vm["vector_size"].as<std::size_t>();
     std::size_t iterations = vm["iterations"].as<std::size_t>();
     std::size_t warmup_iterations = vm["warmup_iterations"].as<std::size_t>();
@@ -504,9 +506,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
         }
     }
 
-    hpx::util::perftests_print_times();
+    int const regressions = hpx::util::perftests_print_times();
 
-    return hpx::finalize();
+    hpx::finalize();
+    return regressions == 0 ? 0 : 1;
 }
 
 int main(int argc, char* argv[])
@@ -534,6 +537,8 @@ int main(int argc, char* argv[])
         ;
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // parse command line here to extract the necessary settings for HPX
     parsed_options opts = command_line_parser(argc, argv)
                               .allow_unregistered()
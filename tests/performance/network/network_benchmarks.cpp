@@ -0,0 +1,375 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the performance of the parcelport used to connect
+// the localities it runs on: the latency and the (bidirectional) bandwidth
+// for varying message sizes, the message rate with several concurrent
+// senders, the message rate of all localities sending to the first one
+// (incast), and the round-trip time of actions with varying argument sizes.
+// The results are written as JSON to allow comparing parcelports. Parcel
+// coalescing is enabled for the benchmarked actions if message handlers are
+// enabled (--hpx:ini=hpx.parcel.message_handlers=1).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parcelset/coalescing_message_handler_registration.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using payload_type = hpx::serialization::serialize_buffer<char>;
+
+payload_type make_payload(std::size_t size)
+{
+    return payload_type(size);
+}
+
+// send the payload back to the caller
+payload_type echo(payload_type const& p)
+{
+    return p;
+}
+HPX_PLAIN_ACTION(echo, echo_action)
+
+// consume the payload, only its size is sent back
+std::size_t consume(payload_type const& p)
+{
+    return p.size();
+}
+HPX_PLAIN_ACTION(consume, consume_action)
+HPX_ACTION_USES_MESSAGE_COALESCING_NOTHROW(consume_action, "consume_action",
+    std::size_t(-1), std::size_t(-1))
+
+///////////////////////////////////////////////////////////////////////////////
+// Send windows of messages of the given size to the target, returns the
+// elapsed time in seconds.
+double send_windows(hpx::id_type const& target, std::size_t size,
+    std::size_t window, std::size_t iterations)
+{
+    payload_type const payload = make_payload(size);
+
+    std::vector<hpx::future<std::size_t>> futures;
+    futures.reserve(window);
+
+    hpx::chrono::high_resolution_timer const timer;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (std::size_t j = 0; j != window; ++j)
+        {
+            futures.push_back(hpx::async<consume_action>(target, payload));
+        }
+        hpx::wait_all(futures);
+        futures.clear();
+    }
+    return timer.elapsed();
+}
+HPX_PLAIN_ACTION(send_windows, send_windows_action)
+
+// Send the given number of messages from several concurrent tasks, returns
+// the elapsed time in seconds.
+double send_concurrently(hpx::id_type const& target, std::size_t size,
+    std::size_t senders, std::size_t window, std::size_t iterations)
+{
+    std::vector<hpx::future<double>> futures;
+    futures.reserve(senders);
+
+    hpx::chrono::high_resolution_timer const timer;
+    for (std::size_t i = 0; i != senders; ++i)
+    {
+        futures.push_back(
+            hpx::async(&send_windows, target, size, window, iterations));
+    }
+    hpx::wait_all(futures);
+    return timer.elapsed();
+}
+HPX_PLAIN_ACTION(send_concurrently, send_concurrently_action)
+
+///////////////////////////////////////////////////////////////////////////////
+struct options
+{
+    std::size_t min_size;
+    std::size_t max_size;
+    std::size_t iterations;
+    std::size_t window;
+    std::size_t senders;
+};
+
+struct result
+{
+    std::string benchmark;
+    std::size_t size;
+    std::size_t messages;
+    double time;
+    double latency_us;
+    double bandwidth_mb_s;
+    double message_rate_k_s;
+};
+
+result make_result(std::string benchmark, std::size_t size,
+    std::size_t messages, std::size_t bytes, double time)
+{
+    return result{HPX_MOVE(benchmark), size, messages, time,
+        time * 1e6 / static_cast<double>(messages),
+        static_cast<double>(bytes) / time / 1e6,
+        static_cast<double>(messages) / time / 1e3};
+}
+
+template <typename F>
+void for_each_size(options const& opts, F&& f)
+{
+    for (std::size_t size = opts.min_size; size <= opts.max_size; size *= 2)
+    {
+        f(size);
+    }
+}
+
+// half of the round-trip time of a message of the given size
+void benchmark_latency(hpx::id_type const& there, options const& opts,
+    std::vector<result>& results)
+{
+    for_each_size(opts, [&](std::size_t size) {
+        payload_type const payload = make_payload(size);
+
+        // warm up
+        echo_action()(there, payload);
+
+        hpx::chrono::high_resolution_timer const timer;
+        for (std::size_t i = 0; i != opts.iterations; ++i)
+        {
+            echo_action()(there, payload);
+        }
+        double const time = timer.elapsed() / 2;
+
+        results.push_back(make_result("latency", size, opts.iterations,
+            2 * size * opts.iterations, time));
+    });
+}
+
+// messages of the given size sent in windows to one destination
+void benchmark_bandwidth(hpx::id_type const& there, options const& opts,
+    std::vector<result>& results)
+{
+    for_each_size(opts, [&](std::size_t size) {
+        send_windows(there, size, opts.window, 1);
+
+        double const time =
+            send_windows(there, size, opts.window, opts.iterations);
+
+        std::size_t const messages = opts.window * opts.iterations;
+        results.push_back(
+            make_result("bandwidth", size, messages, size * messages, time));
+    });
+}
+
+// both localities send windows of messages to each other at the same time
+void benchmark_bibandwidth(hpx::id_type const& there, options const& opts,
+    std::vector<result>& results)
+{
+    hpx::id_type const here = hpx::find_here();
+    for_each_size(opts, [&](std::size_t size) {
+        send_windows(there, size, opts.window, 1);
+
+        hpx::chrono::high_resolution_timer const timer;
+        hpx::future<double> remote = hpx::async<send_windows_action>(
+            there, here, size, opts.window, opts.iterations);
+        send_windows(there, size, opts.window, opts.iterations);
+        remote.get();
+        double const time = timer.elapsed();
+
+        std::size_t const messages = 2 * opts.window * opts.iterations;
+        results.push_back(
+            make_result("bibandwidth", size, messages, size * messages, time));
+    });
+}
+
+// small messages sent by several concurrent tasks to one destination
+void benchmark_message_rate(hpx::id_type const& there, options const& opts,
+    std::vector<result>& results)
+{
+    std::size_t const size = opts.min_size;
+    send_concurrently(there, size, opts.senders, opts.window, 1);
+
+    double const time = send_concurrently(
+        there, size, opts.senders, opts.window, opts.iterations);
+
+    std::size_t const messages = opts.senders * opts.window * opts.iterations;
+    results.push_back(
+        make_result("message_rate", size, messages, size * messages, time));
+}
+
+// all other localities send messages to this one at the same time
+void benchmark_incast(std::vector<hpx::id_type> const& others,
+    options const& opts, std::vector<result>& results)
+{
+    hpx::id_type const here = hpx::find_here();
+    for_each_size(opts, [&](std::size_t size) {
+        std::vector<hpx::future<double>> futures;
+        futures.reserve(others.size());
+
+        hpx::chrono::high_resolution_timer const timer;
+        for (hpx::id_type const& id : others)
+        {
+            futures.push_back(hpx::async<send_concurrently_action>(id, here,
+                size, opts.senders, opts.window, opts.iterations));
+        }
+        hpx::wait_all(futures);
+        double const time = timer.elapsed();
+
+        std::size_t const messages =
+            others.size() * opts.senders * opts.window * opts.iterations;
+        results.push_back(
+            make_result("incast", size, messages, size * messages, time));
+    });
+}
+
+// round trip of an action with an argument of the given size and a small
+// result
+void benchmark_round_trip(hpx::id_type const& there, options const& opts,
+    std::vector<result>& results)
+{
+    for_each_size(opts, [&](std::size_t size) {
+        payload_type const payload = make_payload(size);
+
+        consume_action()(there, payload);
+
+        hpx::chrono::high_resolution_timer const timer;
+        for (std::size_t i = 0; i != opts.iterations; ++i)
+        {
+            consume_action()(there, payload);
+        }
+        double const time = timer.elapsed();
+
+        results.push_back(make_result("round_trip", size, opts.iterations,
+            size * opts.iterations, time));
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void write_json(std::ostream& os, options const& opts,
+    std::vector<result> const& results, std::size_t num_localities)
+{
+    hpx::util::format_to(os,
+        "{{\n"
+        "  \"parcelport\": \"{}\",\n"
+        "  \"localities\": {},\n"
+        "  \"threads\": {},\n"
+        "  \"coalescing\": {},\n"
+        "  \"iterations\": {},\n"
+        "  \"window\": {},\n"
+        "  \"senders\": {},\n"
+        "  \"results\": [",
+        hpx::get_config_entry("hpx.parcel.bootstrap", "unknown"),
+        num_localities, hpx::get_os_thread_count(),
+        hpx::get_config_entry("hpx.parcel.message_handlers", "0") != "0" ?
+            "true" :
+            "false",
+        opts.iterations, opts.window, opts.senders);
+
+    char const* separator = "\n";
+    for (result const& r : results)
+    {
+        hpx::util::format_to(os,
+            "{}    {{\"benchmark\": \"{}\", \"size\": {}, \"messages\": {}, "
+            "\"time_s\": {}, \"latency_us\": {}, \"bandwidth_mb_s\": {}, "
+            "\"message_rate_k_s\": {}}}",
+            separator, r.benchmark, r.size, r.messages, r.time, r.latency_us,
+            r.bandwidth_mb_s, r.message_rate_k_s);
+        separator = ",\n";
+    }
+    os << "\n  ]\n}\n";
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    options const opts{vm["min-size"].as<std::size_t>(),
+        vm["max-size"].as<std::size_t>(), vm["iterations"].as<std::size_t>(),
+        vm["window"].as<std::size_t>(), vm["senders"].as<std::size_t>()};
+    std::string const benchmark = vm["benchmark"].as<std::string>();
+
+    std::vector<hpx::id_type> const others = hpx::find_remote_localities();
+    if (others.empty() || opts.min_size == 0 ||
+        opts.min_size > opts.max_size || opts.iterations == 0 ||
+        opts.window == 0 || opts.senders == 0)
+    {
+        std::cerr << "network_benchmarks: this benchmark requires at least "
+                     "two localities and non-zero parameters\n";
+        return hpx::finalize();
+    }
+
+    hpx::id_type const& there = others[0];
+    bool const all = benchmark == "all";
+
+    std::vector<result> results;
+    if (all || benchmark == "latency")
+        benchmark_latency(there, opts, results);
+    if (all || benchmark == "bandwidth")
+        benchmark_bandwidth(there, opts, results);
+    if (all || benchmark == "bibandwidth")
+        benchmark_bibandwidth(there, opts, results);
+    if (all || benchmark == "message_rate")
+        benchmark_message_rate(there, opts, results);
+    if (all || benchmark == "incast")
+        benchmark_incast(others, opts, results);
+    if (all || benchmark == "round_trip")
+        benchmark_round_trip(there, opts, results);
+
+    if (vm.count("output") != 0)
+    {
+        std::ofstream os(vm["output"].as<std::string>());
+        write_json(os, opts, results, others.size() + 1);
+    }
+    else
+    {
+        write_json(std::cout, opts, results, others.size() + 1);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("benchmark", value<std::string>()->default_value("all"),
+         "the benchmark to run (all, latency, bandwidth, bibandwidth, "
+         "message_rate, incast, round_trip)")
+        ("min-size", value<std::size_t>()->default_value(1),
+         "the smallest message size in bytes")
+        ("max-size", value<std::size_t>()->default_value(4194304),
+         "the largest message size in bytes, sizes are doubled starting at "
+         "min-size")
+        ("iterations", value<std::size_t>()->default_value(100),
+         "the number of measured iterations for each message size")
+        ("window", value<std::size_t>()->default_value(64),
+         "the number of messages in flight for each sender")
+        ("senders", value<std::size_t>()->default_value(4),
+         "the number of concurrent senders on each locality")
+        ("output", value<std::string>(),
+         "the file the JSON results are written to (default: stdout)")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
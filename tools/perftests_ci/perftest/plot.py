@@ -38,9 +38,9 @@ class _OutputKey(typing.NamedTuple):
     @classmethod
     def outputs_by_key(cls, data):
         def split_output(o):
+            # the reports contain statistics of the series as well
             return cls(**{
-                k: v for k, v in o.items() \
-                    if k != 'series' and k != 'average' \
+                k: v for k, v in o.items() if k in cls._fields
             }), o['series']
 
         return dict(split_output(o) for o in data['outputs'])